@@ -44,10 +44,20 @@ set(GPA_SRC_VK_REL_PATH                                     "source/gpu_perf_api
 set(GPA_SRC_VK                                              "${GPA_ROOT}/${GPA_SRC_VK_REL_PATH}")
 set(GPA_SRC_CL_REL_PATH                                     "source/gpu_perf_api_cl")
 set(GPA_SRC_CL                                              "${GPA_ROOT}/${GPA_SRC_CL_REL_PATH}")
+set(GPA_SRC_MOCK_REL_PATH                                   "source/gpu_perf_api_mock")
+set(GPA_SRC_MOCK                                            "${GPA_ROOT}/${GPA_SRC_MOCK_REL_PATH}")
+set(GPA_SRC_MOCK_BENCHMARK_REL_PATH                         "source/gpu_perf_api_mock_benchmark")
+set(GPA_SRC_MOCK_BENCHMARK                                  "${GPA_ROOT}/${GPA_SRC_MOCK_BENCHMARK_REL_PATH}")
+set(GPA_SRC_MOCK_TESTS_REL_PATH                             "source/gpu_perf_api_mock_tests")
+set(GPA_SRC_MOCK_TESTS                                      "${GPA_ROOT}/${GPA_SRC_MOCK_TESTS_REL_PATH}")
+set(GPA_SRC_REPLAY_REL_PATH                                 "source/gpu_perf_api_replay")
+set(GPA_SRC_REPLAY                                          "${GPA_ROOT}/${GPA_SRC_REPLAY_REL_PATH}")
 set(GPA_SRC_TESTS_REL_PATH                                  "source/gpu_perf_api_unit_tests")
 set(GPA_SRC_TESTS                                           "${GPA_ROOT}/${GPA_SRC_TESTS_REL_PATH}")
 set(GPA_AUTOGEN_SRC_TESTS_REL_PATH                          "source/auto_generated/gpu_perf_api_unit_tests")
 set(GPA_AUTOGEN_SRC_TESTS                                   "${GPA_ROOT}/${GPA_AUTOGEN_SRC_TESTS_REL_PATH}")
+set(GPA_SRC_COUNTERS_BENCHMARK_REL_PATH                     "source/gpu_perf_api_counters_benchmark")
+set(GPA_SRC_COUNTERS_BENCHMARK                              "${GPA_ROOT}/${GPA_SRC_COUNTERS_BENCHMARK_REL_PATH}")
 set(GPA_SRC_PUBLIC_COUNTER_COMPILER_REL_PATH                "source/public_counter_compiler")
 set(GPA_SRC_PUBLIC_COUNTER_COMPILER                         "${GPA_ROOT}/${GPA_SRC_PUBLIC_COUNTER_COMPILER_REL_PATH}")
 set(GPA_SRC_PUBLIC_COUNTER_INPUT_FILES_REL_PATH             "source/public_counter_compiler_input_files")
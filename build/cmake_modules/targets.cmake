@@ -20,6 +20,11 @@ add_subdirectory(${GPA_SRC_COUNTERS} ${CMAKE_BINARY_DIR}/${GPA_SRC_COUNTERS_REL_
 
 if(NOT ${skipopencl})
     add_subdirectory(${GPA_SRC_CL} ${CMAKE_BINARY_DIR}/${GPA_SRC_CL_REL_PATH})
+
+    # The mock driver backend exposes the OpenCL counters, so it is built along with the OpenCL backend
+    add_subdirectory(${GPA_SRC_MOCK} ${CMAKE_BINARY_DIR}/${GPA_SRC_MOCK_REL_PATH})
+    add_subdirectory(${GPA_SRC_MOCK_BENCHMARK} ${CMAKE_BINARY_DIR}/${GPA_SRC_MOCK_BENCHMARK_REL_PATH})
+    add_subdirectory(${GPA_SRC_REPLAY} ${CMAKE_BINARY_DIR}/${GPA_SRC_REPLAY_REL_PATH})
 else()
     message(STATUS "Skipping OpenCL from the build")
 endif()
@@ -69,6 +74,11 @@ if(NOT ${skiptests})
     # Build GoogleTest libs
     add_subdirectory(${GPA_SRC_GOOGLE_TEST} ${CMAKE_BINARY_DIR}/${GPA_SRC_GOOGLE_TEST_REL_PATH})
     add_subdirectory(${GPA_SRC_TESTS} ${CMAKE_BINARY_DIR}/${GPA_SRC_TESTS_REL_PATH})
+    add_subdirectory(${GPA_SRC_COUNTERS_BENCHMARK} ${CMAKE_BINARY_DIR}/${GPA_SRC_COUNTERS_BENCHMARK_REL_PATH})
+
+    if(NOT ${skipopencl})
+        add_subdirectory(${GPA_SRC_MOCK_TESTS} ${CMAKE_BINARY_DIR}/${GPA_SRC_MOCK_TESTS_REL_PATH})
+    endif()
 else()
     message(STATUS "Skipping Tests from the build")
 endif()
@@ -224,6 +224,16 @@ GPALIB_DECL GPA_Status GPA_GetCounterUsageType(GPA_ContextId contextId, gpa_uint
 /// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
 GPALIB_DECL GPA_Status GPA_GetCounterUuid(GPA_ContextId contextId, gpa_uint32 index, GPA_UUID* pCounterUuid);
 
+/// \brief Gets index of a counter given its UUID.
+///
+/// Unlike the name of a counter, its UUID does not change when the counter is renamed, so a counter selection stored as UUIDs
+/// can be resolved by a later version of GPA. The first lookup indexes the counters of the context, later lookups take constant time.
+/// \param[in] contextId Unique identifier of the opened context.
+/// \param[in] pCounterUuid The UUID of the counter whose index is needed, as returned by GPA_GetCounterUuid.
+/// \param[out] pIndex The address which will hold the index upon successful execution.
+/// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
+GPALIB_DECL GPA_Status GPA_GetCounterIndexByUuid(GPA_ContextId contextId, const GPA_UUID* pCounterUuid, gpa_uint32* pIndex);
+
 /// \brief Gets the supported sample type of the specified counter.
 ///
 /// Currently, only a single counter type (discrete) is supported
@@ -287,6 +297,27 @@ GPALIB_DECL GPA_Status GPA_BeginSession(GPA_SessionId sessionId);
 /// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
 GPALIB_DECL GPA_Status GPA_EndSession(GPA_SessionId sessionId);
 
+/// \brief Resets an ended session so that it can be begun again to collect another set of samples.
+///
+/// All samples and command lists of the session, and their results, are discarded. The passes created by GPA_BeginSession,
+/// the counters scheduled in them and the API-specific objects they own are kept, so the next GPA_BeginSession on the
+/// session does not need to schedule the counters and create the passes again, as long as the set of enabled counters is
+/// not changed in between. This allows profiling the same set of counters every frame with a single session.
+/// \param[in] sessionId Unique identifier of the GPA Session Object.
+/// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
+GPALIB_DECL GPA_Status GPA_ResetSession(GPA_SessionId sessionId);
+
+/// \brief Supplies the largest sample id which will be used in a session.
+///
+/// This is an optional performance hint. Sample ids are usually assigned sequentially starting at 0; when the
+/// largest sample id is known up front, the sample storage of every pass is preallocated when the session is begun,
+/// so that samples can be created and looked up without growing that storage. Sample ids above the hint remain valid.
+/// This must be called after GPA_CreateSession is called, but before GPA_BeginSession is called.
+/// \param[in] sessionId Unique identifier of the GPA Session Object.
+/// \param[in] maxSampleId The largest sample id expected to be used in the session.
+/// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
+GPALIB_DECL GPA_Status GPA_SetSessionMaxSampleIdHint(GPA_SessionId sessionId, gpa_uint32 maxSampleId);
+
 // Counter Scheduling
 
 /// \brief Enables the specified counter.
@@ -433,6 +464,50 @@ GPALIB_DECL GPA_Status GPA_BeginSample(gpa_uint32 sampleId, GPA_CommandListId co
 /// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
 GPALIB_DECL GPA_Status GPA_EndSample(GPA_CommandListId commandListId);
 
+/// \brief Begins a block of consecutive samples in a command list.
+///
+/// When many samples are recorded back to back on a command list (for instance one sample per draw call), their ids can be reserved
+/// up front with this function. The ids firstSampleId to firstSampleId + numSamples - 1 are validated and reserved, and the samples are created,
+/// so that each of them can then be begun and ended with GPA_BeginBlockSample/GPA_EndBlockSample, which only move a cursor within the block.
+/// The samples of the block are begun in id order; the block does not need to be used entirely.
+/// A command list can only have one sample block at a time, and no other sample can be begun on the command list until the block is ended.
+/// As with GPA_BeginSample, a sample block must be begun in each pass.
+/// \param[in] commandListId unique identifier of a previously-created GPA Command List Object.
+/// \param[in] firstSampleId unique sample id of the first sample of the block.
+/// \param[in] numSamples number of samples in the block.
+/// \param[out] pSampleBlockId GPA-generated unique sample block id, valid until the command list is deleted with its session.
+/// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
+GPALIB_DECL GPA_Status GPA_BeginSampleBlock(GPA_CommandListId  commandListId,
+                                            gpa_uint32         firstSampleId,
+                                            gpa_uint32         numSamples,
+                                            GPA_SampleBlockId* pSampleBlockId);
+
+/// \brief Begins the next sample of a sample block.
+///
+/// The sample gets the id following the one of the previous sample of the block, starting from the first sample id of the block.
+/// For speed, the sample block id is not validated beyond a null check: it must have been returned by GPA_BeginSampleBlock
+/// on a command list which has not been deleted, and must only be used by the thread recording the command list.
+/// \param[in] sampleBlockId unique identifier of a sample block which has not been ended.
+/// \return GPA_STATUS_OK if the sample was begun, GPA_STATUS_ERROR_INDEX_OUT_OF_RANGE if all the samples of the block have been begun, otherwise an error code.
+GPALIB_DECL GPA_Status GPA_BeginBlockSample(GPA_SampleBlockId sampleBlockId);
+
+/// \brief Ends the sample of a sample block which was last begun.
+///
+/// For speed, the sample block id is not validated beyond a null check, see GPA_BeginBlockSample.
+/// \param[in] sampleBlockId unique identifier of the sample block.
+/// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
+GPALIB_DECL GPA_Status GPA_EndBlockSample(GPA_SampleBlockId sampleBlockId);
+
+/// \brief Ends a sample block.
+///
+/// The samples of the block which were begun become regular samples of the command list; the ids of the other samples are released
+/// and may be used again. A sample block which is still open is ended by GPA_EndCommandList.
+/// Unlike GPA_BeginBlockSample and GPA_EndBlockSample, the sample block id is validated: GPA_STATUS_ERROR_INVALID_PARAMETER is
+/// returned for an id which was not returned by GPA_BeginSampleBlock or whose command list was deleted.
+/// \param[in] sampleBlockId unique identifier of the sample block.
+/// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
+GPALIB_DECL GPA_Status GPA_EndSampleBlock(GPA_SampleBlockId sampleBlockId);
+
 /// \brief Continues a primary command list sample on another primary command list.
 ///
 /// This function is only supported for DirectX 12 and Vulkan.
@@ -467,6 +542,9 @@ GPALIB_DECL GPA_Status GPA_GetSampleCount(GPA_SessionId sessionId, gpa_uint32* p
 /// \brief Gets the sample id by index
 ///
 /// This is useful if sample ids are either not zero-based or not consecutive.
+/// The samples are indexed in the order in which they were begun or created by GPA_CopySecondarySamples; the samples of a sample
+/// block are indexed when the block is ended. The samples begun on a secondary command list are indexed too, although their results
+/// can only be queried through their copies.
 /// \param[in] sessionId Unique identifier of the GPA Session Object.
 /// \param[in] index The index of the sample. Must lie between 0 and (GPA_GetSampleCount result - 1).
 /// \param[out] pSampleId The value that will hold the id of the sample upon successful execution.
@@ -516,6 +594,154 @@ GPALIB_DECL GPA_Status GPA_GetSampleResultSize(GPA_SessionId sessionId, gpa_uint
 /// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
 GPALIB_DECL GPA_Status GPA_GetSampleResult(GPA_SessionId sessionId, gpa_uint32 sampleId, size_t sampleResultSizeInBytes, void* pCounterSampleResults);
 
+/// \brief Gets the result data for a given sample for the counters whose results are already available.
+///
+/// Unlike GPA_GetSampleResult, this function does not block until all passes are complete.
+/// A counter's result is available once every pass that contains one of its required internal counters has completed,
+/// so counters scheduled in early passes can be read while later passes are still being executed.
+/// The result buffer has the same layout as for GPA_GetSampleResult; only the entries flagged as available are written.
+/// \param[in] sessionId The session identifier with the sample you wish to retrieve the result of.
+/// \param[in] sampleId The identifier of the sample to get the result for.
+/// \param[in] sampleResultSizeInBytes size of sample in bytes.
+/// \param[out] pCounterSampleResults address to which the available counter data for the sample will be copied to.
+/// \param[out] pCounterResultAvailable array with one entry per enabled counter, set to 1 if the counter's result was written, otherwise 0.
+/// \return GPA_STATUS_OK if the results of all enabled counters were written, GPA_STATUS_RESULT_NOT_READY if only some (or none) were, otherwise an error code.
+GPALIB_DECL GPA_Status GPA_GetPartialSampleResult(GPA_SessionId sessionId,
+                                                  gpa_uint32    sampleId,
+                                                  size_t        sampleResultSizeInBytes,
+                                                  void*         pCounterSampleResults,
+                                                  gpa_uint8*    pCounterResultAvailable);
+
+/// \brief Gets the result data for all samples in a session, organized by counter.
+///
+/// This function will block until results are ready. Use GPA_IsSessionComplete to check if results are ready.
+/// The exported samples are the samples of the session in index order (see GPA_GetSampleId), except the samples begun on a
+/// secondary command list which were not copied: their results are exported through their copies only.
+/// The results are written as one contiguous column per enabled counter: the value of the i-th enabled counter
+/// for the j-th exported sample is found at element (i * exportedSampleCount) + j.
+/// Each element is a 64-bit value whose type is given by GPA_GetCounterDataType.
+/// The required buffer size is (number of enabled counters) * (number of exported samples) * sizeof(gpa_uint64).
+/// This is only supported for sessions created with GPA_SESSION_SAMPLE_TYPE_DISCRETE_COUNTER.
+/// \param[in] sessionId The session identifier with the samples you wish to retrieve the results of.
+/// \param[in] resultsSizeInBytes size of the supplied buffer in bytes.
+/// \param[out] pCounterResults address to which the counter data columns will be copied to.
+/// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
+GPALIB_DECL GPA_Status GPA_GetSessionResultsByCounter(GPA_SessionId sessionId, size_t resultsSizeInBytes, void* pCounterResults);
+
+/// \brief Gets the results of the next time buckets of a streaming counter session.
+///
+/// The streaming counters of a session created with GPA_SESSION_SAMPLE_TYPE_STREAMING_COUNTER are sampled at a regular interval while the session runs.
+/// The samples are grouped in buckets of the given duration and the counter results of each bucket are computed from the hardware counter values
+/// accumulated over the bucket. This function can be called repeatedly, both while the session runs and after it has ended: each call returns the
+/// buckets completed since the previous call, so that a long capture can be consumed incrementally. Samples which are not read before the buffer
+/// holding them is full are lost; they are reported by the next bucket. The same bucket duration should be used for all the calls on a session.
+/// The results of each bucket have the same layout as the results of a sample (see GPA_GetSampleResultSize), one bucket after the other.
+/// \param[in] sessionId The session identifier with the streaming counters you wish to retrieve the results of.
+/// \param[in] bucketDuration The duration of each bucket, in GPU timestamp units.
+/// \param[in] maxBuckets The largest number of buckets to retrieve.
+/// \param[out] pBuckets array of maxBuckets entries to which the time range of each retrieved bucket will be written.
+/// \param[out] pCounterResults address to which the counter results of the retrieved buckets will be copied to, with room for maxBuckets buckets.
+/// \param[out] pNumBuckets the number of buckets retrieved.
+/// \return GPA_STATUS_OK once all the samples of the session have been retrieved, GPA_STATUS_RESULT_NOT_READY if more buckets may follow, otherwise an error code.
+GPALIB_DECL GPA_Status GPA_GetStreamingCounterResults(GPA_SessionId               sessionId,
+                                                      gpa_uint64                  bucketDuration,
+                                                      gpa_uint32                  maxBuckets,
+                                                      GPA_StreamingCounterBucket* pBuckets,
+                                                      void*                       pCounterResults,
+                                                      gpa_uint32*                 pNumBuckets);
+
+// SQTT Data
+
+/// \brief Gets the number of chunks of SQTT data collected by a session.
+///
+/// The SQTT data of a session created with GPA_SESSION_SAMPLE_TYPE_SQTT or GPA_SESSION_SAMPLE_TYPE_STREAMING_COUNTER_AND_SQTT is written to a
+/// temporary trace file while the session runs, so that it does not need to fit in host memory. Once the session has ended and all of its
+/// SQTT data has been collected, the trace file is mapped and its chunks can be read with GPA_GetSQTTChunk.
+/// \param[in] sessionId The session identifier with the SQTT data you wish to retrieve.
+/// \param[out] pChunkCount the number of chunks of SQTT data.
+/// \return GPA_STATUS_OK if the SQTT data is available, GPA_STATUS_RESULT_NOT_READY if it is still being collected, otherwise an error code.
+GPALIB_DECL GPA_Status GPA_GetSQTTChunkCount(GPA_SessionId sessionId, gpa_uint32* pChunkCount);
+
+/// \brief Gets a chunk of the SQTT data collected by a session, without copying it.
+///
+/// The data of each trace stream (one per shader engine) is the concatenation of its chunks, in the order of their offsets within the stream.
+/// The view points into the mapped trace file of the session; it remains valid until the session is deleted or begun again.
+/// \param[in] sessionId The session identifier with the SQTT data you wish to retrieve.
+/// \param[in] chunkIndex The index of the chunk, less than the number of chunks returned by GPA_GetSQTTChunkCount.
+/// \param[out] pChunkView the trace stream, offset, size and data of the chunk.
+/// \return GPA_STATUS_OK if the chunk is available, GPA_STATUS_RESULT_NOT_READY if the SQTT data is still being collected, otherwise an error code.
+GPALIB_DECL GPA_Status GPA_GetSQTTChunk(GPA_SessionId sessionId, gpa_uint32 chunkIndex, GPA_SQTTChunkView* pChunkView);
+
+// Counter Statistics
+
+/// \brief Creates an object accumulating the statistics of the counter results of any number of sessions.
+///
+/// The statistics of each counter are its number of results, their sum, minimum, maximum, mean and variance, and the estimated median,
+/// 95th and 99th percentiles of the results. They are updated as the results of a session are computed, so the statistics of many
+/// frames can be gathered without keeping their per-sample results. The object is not tied to a context and can be used from any thread.
+/// \param[out] pCounterStatisticsId address of a counter statistics id which will hold the id of the created object.
+/// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
+GPALIB_DECL GPA_Status GPA_CreateCounterStatistics(GPA_CounterStatisticsId* pCounterStatisticsId);
+
+/// \brief Deletes a counter statistics object.
+///
+/// \param[in] counterStatisticsId the id of the counter statistics object to delete.
+/// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
+GPALIB_DECL GPA_Status GPA_DeleteCounterStatistics(GPA_CounterStatisticsId counterStatisticsId);
+
+/// \brief Adds the counter results of all the samples of a session to the statistics of the counters.
+///
+/// This function will block until results are ready. The results are computed a few samples at a time and are not kept, so the
+/// memory needed does not depend on the number of samples. Secondary samples which were not copied to a primary command list are skipped.
+/// The statistics are keyed by counter index, so only sessions of contexts exposing the same counters should be accumulated into the same object.
+/// This is only supported for sessions created with GPA_SESSION_SAMPLE_TYPE_DISCRETE_COUNTER.
+/// \param[in] counterStatisticsId the id of the counter statistics object to add the results to.
+/// \param[in] sessionId the session identifier with the samples whose results are added.
+/// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
+GPALIB_DECL GPA_Status GPA_AccumulateCounterStatistics(GPA_CounterStatisticsId counterStatisticsId, GPA_SessionId sessionId);
+
+/// \brief Adds the statistics of a counter statistics object to those of another one.
+///
+/// The merged statistics are the same as if the results accumulated in both objects had been accumulated in the destination object,
+/// so statistics gathered by different threads or over different frames can be combined.
+/// \param[in] destinationCounterStatisticsId the id of the counter statistics object to which the statistics are added.
+/// \param[in] sourceCounterStatisticsId the id of the counter statistics object whose statistics are added; it is not modified.
+/// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
+GPALIB_DECL GPA_Status GPA_MergeCounterStatistics(GPA_CounterStatisticsId destinationCounterStatisticsId, GPA_CounterStatisticsId sourceCounterStatisticsId);
+
+/// \brief Gets the statistics of the results of a counter.
+///
+/// \param[in] counterStatisticsId the id of the counter statistics object.
+/// \param[in] counterIndex the index of the counter, as given by GPA_GetCounterIndex.
+/// \param[out] pCounterStatistics address of the structure which will hold the statistics of the counter.
+/// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
+GPALIB_DECL GPA_Status GPA_GetCounterStatistics(GPA_CounterStatisticsId counterStatisticsId, gpa_uint32 counterIndex, GPA_CounterStatistics* pCounterStatistics);
+
+// Counter Cache
+
+/// \brief Sets the file in which the counters resolved for a device are cached across processes.
+///
+/// The first time a context is opened on a device, the public counters of the device are resolved and stored in the cache file.
+/// The contexts later opened on the same device, by this process or another one, map the cache file and use the counters stored in it
+/// instead of resolving them again. The file is only used by the version of GPA which wrote it, and is rewritten when it is stale or corrupt.
+/// This should be called before GPA_OpenContext; it does not affect the counters of the devices for which a context was already opened.
+/// \param[in] pCacheFilePath the path of the cache file, or nullptr or an empty string to disable the cache, which is the default.
+/// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
+GPALIB_DECL GPA_Status GPA_SetCounterCacheFilePath(const char* pCacheFilePath);
+
+// Memory Accounting
+
+/// \brief Gets the host memory held by GPA for a category of objects.
+///
+/// The memory is accounted for all of the contexts and sessions of the process; it includes the size of the objects of the category
+/// and the estimated size of the memory they allocate. An object count which keeps growing while the number of open contexts and
+/// sessions does not indicates a leak. Memory allocated by the driver on behalf of GPA is not included.
+/// \param[in] category the category of objects.
+/// \param[out] pNumBytes the number of bytes held by the objects of the category.
+/// \param[out] pNumObjects the number of live objects of the category.
+/// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
+GPALIB_DECL GPA_Status GPA_GetMemoryStats(GPA_Memory_Category category, gpa_uint64* pNumBytes, gpa_uint64* pNumObjects);
+
 // Status / Error Query
 
 /// \brief Gets a string representation of the specified GPA status value.
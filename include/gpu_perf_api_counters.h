@@ -317,6 +317,20 @@ GPU_PERF_API_COUNTERS_DECL GPA_Status GpaCounterLib_GetCounterUuid(const GPA_Cou
 /// typedef for GpaCounterLib_GetCounterUuid function pointer
 typedef GPA_Status (*GpaCounterLib_GetCounterUuidPtrType)(const GPA_CounterContext, gpa_uint32, GPA_UUID*);
 
+/// \brief Gets index of a counter given its UUID.
+///
+/// The first lookup indexes the counters of the context, later lookups take constant time.
+/// \param[in] gpa_virtual_context Unique identifier of the opened virtual context.
+/// \param[in] gpa_counter_uuid The UUID of the counter whose index is needed.
+/// \param[out] gpa_counter_index The address which will hold the index upon successful execution.
+/// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
+GPU_PERF_API_COUNTERS_DECL GPA_Status GpaCounterLib_GetCounterIndexByUuid(const GPA_CounterContext gpa_virtual_context,
+                                                                          const GPA_UUID*          gpa_counter_uuid,
+                                                                          gpa_uint32*              gpa_counter_index);
+
+/// typedef for GpaCounterLib_GetCounterIndexByUuid function pointer
+typedef GPA_Status (*GpaCounterLib_GetCounterIndexByUuidPtrType)(const GPA_CounterContext, const GPA_UUID*, gpa_uint32*);
+
 /// \brief Gets the supported sample type of the specified counter.
 ///
 /// Currently, only a single counter type (discrete) is supported
@@ -395,7 +409,8 @@ typedef GPA_Status (*GpaCounterLib_GetPassCountPtrType)(const GPA_CounterContext
     X(GpaCounterLib_GetCounterSampleType)        \
     X(GpaCounterLib_GetDerivedCounterInfo)       \
     X(GpaCounterLib_ComputeDerivedCounterResult) \
-    X(GpaCounterLib_GetPassCount)
+    X(GpaCounterLib_GetPassCount)                \
+    X(GpaCounterLib_GetCounterIndexByUuid)
 
 /// Gpa counter library function table
 typedef struct _GpaCounterLibFuncTable
@@ -54,6 +54,9 @@ typedef GPA_Status (*GPA_GetCounterUsageTypePtrType)(GPA_ContextId,
                                                      gpa_uint32,
                                                      GPA_Usage_Type*);                  ///< Typedef for a function pointer for GPA_GetCounterUsageType
 typedef GPA_Status (*GPA_GetCounterUuidPtrType)(GPA_ContextId, gpa_uint32, GPA_UUID*);  ///< Typedef for a function pointer for GPA_GetCounterUuid
+typedef GPA_Status (*GPA_GetCounterIndexByUuidPtrType)(GPA_ContextId,
+                                                       const GPA_UUID*,
+                                                       gpa_uint32*);  ///< Typedef for a function pointer for GPA_GetCounterIndexByUuid
 typedef GPA_Status (*GPA_GetCounterSampleTypePtrType)(GPA_ContextId,
                                                       gpa_uint32,
                                                       GPA_Counter_Sample_Type*);   ///< Typedef for a function pointer for GPA_GetCounterSampleType
@@ -105,6 +108,56 @@ typedef GPA_Status (*GPA_IsSessionCompletePtrType)(GPA_SessionId);
 typedef GPA_Status (*GPA_IsPassCompletePtrType)(GPA_SessionId, gpa_uint32);                  ///< Typedef for a function pointer for GPA_IsPassComplete
 typedef GPA_Status (*GPA_GetSampleResultSizePtrType)(GPA_SessionId, gpa_uint32, size_t*);    ///< Typedef for a function pointer for GPA_GetSampleResultSize
 typedef GPA_Status (*GPA_GetSampleResultPtrType)(GPA_SessionId, gpa_uint32, size_t, void*);  ///< Typedef for a function pointer for GPA_GetSampleResult
+typedef GPA_Status (*GPA_GetSessionResultsByCounterPtrType)(GPA_SessionId, size_t, void*);  ///< Typedef for a function pointer for GPA_GetSessionResultsByCounter
+typedef GPA_Status (*GPA_GetPartialSampleResultPtrType)(GPA_SessionId,
+                                                        gpa_uint32,
+                                                        size_t,
+                                                        void*,
+                                                        gpa_uint8*);  ///< Typedef for a function pointer for GPA_GetPartialSampleResult
+
+// Session hints
+typedef GPA_Status (*GPA_SetSessionMaxSampleIdHintPtrType)(GPA_SessionId, gpa_uint32);  ///< Typedef for a function pointer for GPA_SetSessionMaxSampleIdHint
+
+// Session reuse
+typedef GPA_Status (*GPA_ResetSessionPtrType)(GPA_SessionId);  ///< Typedef for a function pointer for GPA_ResetSession
+
+// Memory Accounting
+typedef GPA_Status (*GPA_GetMemoryStatsPtrType)(GPA_Memory_Category, gpa_uint64*, gpa_uint64*);  ///< Typedef for a function pointer for GPA_GetMemoryStats
+
+// Streaming Counter Results
+typedef GPA_Status (*GPA_GetStreamingCounterResultsPtrType)(GPA_SessionId,
+                                                            gpa_uint64,
+                                                            gpa_uint32,
+                                                            GPA_StreamingCounterBucket*,
+                                                            void*,
+                                                            gpa_uint32*);  ///< Typedef for a function pointer for GPA_GetStreamingCounterResults
+
+// SQTT Data
+typedef GPA_Status (*GPA_GetSQTTChunkCountPtrType)(GPA_SessionId, gpa_uint32*);                ///< Typedef for a function pointer for GPA_GetSQTTChunkCount
+typedef GPA_Status (*GPA_GetSQTTChunkPtrType)(GPA_SessionId, gpa_uint32, GPA_SQTTChunkView*);  ///< Typedef for a function pointer for GPA_GetSQTTChunk
+
+// Sample Blocks
+typedef GPA_Status (*GPA_BeginSampleBlockPtrType)(GPA_CommandListId,
+                                                  gpa_uint32,
+                                                  gpa_uint32,
+                                                  GPA_SampleBlockId*);   ///< Typedef for a function pointer for GPA_BeginSampleBlock
+typedef GPA_Status (*GPA_BeginBlockSamplePtrType)(GPA_SampleBlockId);  ///< Typedef for a function pointer for GPA_BeginBlockSample
+typedef GPA_Status (*GPA_EndBlockSamplePtrType)(GPA_SampleBlockId);    ///< Typedef for a function pointer for GPA_EndBlockSample
+typedef GPA_Status (*GPA_EndSampleBlockPtrType)(GPA_SampleBlockId);    ///< Typedef for a function pointer for GPA_EndSampleBlock
+
+// Counter Statistics
+typedef GPA_Status (*GPA_CreateCounterStatisticsPtrType)(GPA_CounterStatisticsId*);  ///< Typedef for a function pointer for GPA_CreateCounterStatistics
+typedef GPA_Status (*GPA_DeleteCounterStatisticsPtrType)(GPA_CounterStatisticsId);   ///< Typedef for a function pointer for GPA_DeleteCounterStatistics
+typedef GPA_Status (*GPA_AccumulateCounterStatisticsPtrType)(GPA_CounterStatisticsId,
+                                                             GPA_SessionId);  ///< Typedef for a function pointer for GPA_AccumulateCounterStatistics
+typedef GPA_Status (*GPA_MergeCounterStatisticsPtrType)(GPA_CounterStatisticsId,
+                                                        GPA_CounterStatisticsId);  ///< Typedef for a function pointer for GPA_MergeCounterStatistics
+typedef GPA_Status (*GPA_GetCounterStatisticsPtrType)(GPA_CounterStatisticsId,
+                                                      gpa_uint32,
+                                                      GPA_CounterStatistics*);  ///< Typedef for a function pointer for GPA_GetCounterStatistics
+
+// Counter Cache
+typedef GPA_Status (*GPA_SetCounterCacheFilePathPtrType)(const char*);  ///< Typedef for a function pointer for GPA_SetCounterCacheFilePath
 
 // Status / Error Query
 typedef const char* (*GPA_GetStatusAsStrPtrType)(GPA_Status);  ///< Typedef for a function pointer for GPA_GetStatusAsStr
@@ -86,6 +86,45 @@ GPA_FUNCTION_PREFIX(GPA_GetSampleId)
 // GPA API Version
 GPA_FUNCTION_PREFIX(GPA_GetVersion)
 
+// Query Results (by counter)
+GPA_FUNCTION_PREFIX(GPA_GetSessionResultsByCounter)
+GPA_FUNCTION_PREFIX(GPA_GetPartialSampleResult)
+
+// Session hints
+GPA_FUNCTION_PREFIX(GPA_SetSessionMaxSampleIdHint)
+
+// Session reuse
+GPA_FUNCTION_PREFIX(GPA_ResetSession)
+
+// Memory Accounting
+GPA_FUNCTION_PREFIX(GPA_GetMemoryStats)
+
+// Streaming Counter Results
+GPA_FUNCTION_PREFIX(GPA_GetStreamingCounterResults)
+
+// Sample Blocks
+GPA_FUNCTION_PREFIX(GPA_BeginSampleBlock)
+GPA_FUNCTION_PREFIX(GPA_BeginBlockSample)
+GPA_FUNCTION_PREFIX(GPA_EndBlockSample)
+GPA_FUNCTION_PREFIX(GPA_EndSampleBlock)
+
+// Counter Statistics
+GPA_FUNCTION_PREFIX(GPA_CreateCounterStatistics)
+GPA_FUNCTION_PREFIX(GPA_DeleteCounterStatistics)
+GPA_FUNCTION_PREFIX(GPA_AccumulateCounterStatistics)
+GPA_FUNCTION_PREFIX(GPA_MergeCounterStatistics)
+GPA_FUNCTION_PREFIX(GPA_GetCounterStatistics)
+
+// Counter Cache
+GPA_FUNCTION_PREFIX(GPA_SetCounterCacheFilePath)
+
+// Counter Interrogation by UUID
+GPA_FUNCTION_PREFIX(GPA_GetCounterIndexByUuid)
+
+// SQTT Data
+GPA_FUNCTION_PREFIX(GPA_GetSQTTChunkCount)
+GPA_FUNCTION_PREFIX(GPA_GetSQTTChunk)
+
 #ifdef NEED_TO_UNDEFINE_GPA_FUNCTION_PREFIX
 #undef GPA_FUNCTION_PREFIX
 #undef NEED_TO_UNDEFINE_GPA_FUNCTION_PREFIX
@@ -107,6 +107,11 @@ static inline GPA_Status GPA_GetCounterUuid(GPA_ContextId contextId, gpa_uint32
     RETURN_GPA_SUCCESS;
 }
 
+static inline GPA_Status GPA_GetCounterIndexByUuid(GPA_ContextId contextId, const GPA_UUID* pCounterUuid, gpa_uint32* pIndex)
+{
+    RETURN_GPA_SUCCESS;
+}
+
 static inline GPA_Status GPA_GetCounterSampleType(GPA_ContextId contextId, gpa_uint32 index, GPA_Counter_Sample_Type* pCounterSampleType)
 {
     RETURN_GPA_SUCCESS;
@@ -144,6 +149,16 @@ static inline GPA_Status GPA_EndSession(GPA_SessionId sessionId)
     RETURN_GPA_SUCCESS;
 }
 
+static inline GPA_Status GPA_ResetSession(GPA_SessionId sessionId)
+{
+    RETURN_GPA_SUCCESS;
+}
+
+static inline GPA_Status GPA_SetSessionMaxSampleIdHint(GPA_SessionId sessionId, gpa_uint32 maxSampleId)
+{
+    RETURN_GPA_SUCCESS;
+}
+
 // Counter Scheduling
 
 static inline GPA_Status GPA_EnableCounter(GPA_SessionId sessionId, gpa_uint32 index)
@@ -224,6 +239,29 @@ static inline GPA_Status GPA_EndSample(GPA_CommandListId commandListId)
     RETURN_GPA_SUCCESS;
 }
 
+static inline GPA_Status GPA_BeginSampleBlock(GPA_CommandListId  commandListId,
+                                              gpa_uint32         firstSampleId,
+                                              gpa_uint32         numSamples,
+                                              GPA_SampleBlockId* pSampleBlockId)
+{
+    RETURN_GPA_SUCCESS;
+}
+
+static inline GPA_Status GPA_BeginBlockSample(GPA_SampleBlockId sampleBlockId)
+{
+    RETURN_GPA_SUCCESS;
+}
+
+static inline GPA_Status GPA_EndBlockSample(GPA_SampleBlockId sampleBlockId)
+{
+    RETURN_GPA_SUCCESS;
+}
+
+static inline GPA_Status GPA_EndSampleBlock(GPA_SampleBlockId sampleBlockId)
+{
+    RETURN_GPA_SUCCESS;
+}
+
 static inline GPA_Status GPA_ContinueSampleOnCommandList(gpa_uint32 srcSampleId, GPA_CommandListId primaryCommandListId)
 {
     RETURN_GPA_SUCCESS;
@@ -269,6 +307,83 @@ static inline GPA_Status GPA_GetSampleResult(GPA_SessionId sessionId, gpa_uint32
     RETURN_GPA_SUCCESS;
 }
 
+static inline GPA_Status GPA_GetPartialSampleResult(GPA_SessionId sessionId,
+                                                     gpa_uint32    sampleId,
+                                                     size_t        sampleResultSizeInBytes,
+                                                     void*         pCounterSampleResults,
+                                                     gpa_uint8*    pCounterResultAvailable)
+{
+    RETURN_GPA_SUCCESS;
+}
+
+static inline GPA_Status GPA_GetSessionResultsByCounter(GPA_SessionId sessionId, size_t resultsSizeInBytes, void* pCounterResults)
+{
+    RETURN_GPA_SUCCESS;
+}
+
+static inline GPA_Status GPA_GetStreamingCounterResults(GPA_SessionId               sessionId,
+                                                        gpa_uint64                  bucketDuration,
+                                                        gpa_uint32                  maxBuckets,
+                                                        GPA_StreamingCounterBucket* pBuckets,
+                                                        void*                       pCounterResults,
+                                                        gpa_uint32*                 pNumBuckets)
+{
+    RETURN_GPA_SUCCESS;
+}
+
+// SQTT Data
+
+static inline GPA_Status GPA_GetSQTTChunkCount(GPA_SessionId sessionId, gpa_uint32* pChunkCount)
+{
+    RETURN_GPA_SUCCESS;
+}
+
+static inline GPA_Status GPA_GetSQTTChunk(GPA_SessionId sessionId, gpa_uint32 chunkIndex, GPA_SQTTChunkView* pChunkView)
+{
+    RETURN_GPA_SUCCESS;
+}
+
+// Counter Statistics
+
+static inline GPA_Status GPA_CreateCounterStatistics(GPA_CounterStatisticsId* pCounterStatisticsId)
+{
+    RETURN_GPA_SUCCESS;
+}
+
+static inline GPA_Status GPA_DeleteCounterStatistics(GPA_CounterStatisticsId counterStatisticsId)
+{
+    RETURN_GPA_SUCCESS;
+}
+
+static inline GPA_Status GPA_AccumulateCounterStatistics(GPA_CounterStatisticsId counterStatisticsId, GPA_SessionId sessionId)
+{
+    RETURN_GPA_SUCCESS;
+}
+
+static inline GPA_Status GPA_MergeCounterStatistics(GPA_CounterStatisticsId destinationCounterStatisticsId, GPA_CounterStatisticsId sourceCounterStatisticsId)
+{
+    RETURN_GPA_SUCCESS;
+}
+
+static inline GPA_Status GPA_GetCounterStatistics(GPA_CounterStatisticsId counterStatisticsId, gpa_uint32 counterIndex, GPA_CounterStatistics* pCounterStatistics)
+{
+    RETURN_GPA_SUCCESS;
+}
+
+// Counter Cache
+
+static inline GPA_Status GPA_SetCounterCacheFilePath(const char* pCacheFilePath)
+{
+    RETURN_GPA_SUCCESS;
+}
+
+// Memory Accounting
+
+static inline GPA_Status GPA_GetMemoryStats(GPA_Memory_Category category, gpa_uint64* pNumBytes, gpa_uint64* pNumObjects)
+{
+    RETURN_GPA_SUCCESS;
+}
+
 // Status / Error Query
 
 static inline const char* GPA_GetStatusAsStr(GPA_Status status)
@@ -122,6 +122,12 @@ GPA_DEFINE_OBJECT(SessionId)
 /// Command List ID opaque pointer type
 GPA_DEFINE_OBJECT(CommandListId)
 
+/// Sample Block ID opaque pointer type
+GPA_DEFINE_OBJECT(SampleBlockId)
+
+/// Counter Statistics ID opaque pointer type
+GPA_DEFINE_OBJECT(CounterStatisticsId)
+
 /// Macro for null command list
 #define GPA_NULL_COMMAND_LIST NULL
 
@@ -306,7 +312,9 @@ typedef enum
 /// Context Sample types -- used to indicate which sample types are supported by a context. A context can support any combination of these
 typedef enum
 {
-    GPA_CONTEXT_SAMPLE_TYPE_DISCRETE_COUNTER = 0x01,  ///< Discrete counters sample type -- discrete counters provide a single value per workload measured
+    GPA_CONTEXT_SAMPLE_TYPE_DISCRETE_COUNTER  = 0x01,  ///< Discrete counters sample type -- discrete counters provide a single value per workload measured
+    GPA_CONTEXT_SAMPLE_TYPE_SQTT              = 0x02,  ///< SQTT sample type -- SQTT (thread trace) data is a trace of the instructions executed by the shaders
+    GPA_CONTEXT_SAMPLE_TYPE_STREAMING_COUNTER = 0x04,  ///< Streaming counters sample type -- streaming counters provide a time series of values sampled at a regular interval
 } GPA_Context_Sample_Type_Bits;
 
 /// Allows GPA_Context_Sample_Type_Bits to be combined into a single parameter.
@@ -315,7 +323,59 @@ typedef GPA_Flags GPA_ContextSampleTypeFlags;
 /// Session Sample types -- used by the client to tell GPUPerfAPI which sample types will be created for a session
 typedef enum
 {
-    GPA_SESSION_SAMPLE_TYPE_DISCRETE_COUNTER,  ///< Discrete counters sample type -- discrete counters provide a single value per workload measured
+    GPA_SESSION_SAMPLE_TYPE_DISCRETE_COUNTER,            ///< Discrete counters sample type -- discrete counters provide a single value per workload measured
+    GPA_SESSION_SAMPLE_TYPE_SQTT,                        ///< SQTT sample type -- SQTT (thread trace) data is a trace of the instructions executed by the shaders
+    GPA_SESSION_SAMPLE_TYPE_STREAMING_COUNTER,           ///< Streaming counters sample type -- streaming counters provide a time series of values sampled at a regular interval
+    GPA_SESSION_SAMPLE_TYPE_STREAMING_COUNTER_AND_SQTT,  ///< Streaming counters and SQTT sample type -- both are collected while the session runs
 } GPA_Session_Sample_Type;
 
+/// Time range of a bucket of streaming counter results, as returned by GPA_GetStreamingCounterResults
+typedef struct GPA_StreamingCounterBucket
+{
+    gpa_uint64 m_startTimestamp;     ///< GPU timestamp of the start of the bucket, a multiple of the bucket duration
+    gpa_uint64 m_endTimestamp;       ///< GPU timestamp of the end of the bucket (exclusive)
+    gpa_uint64 m_numRecords;         ///< number of streaming counter records aggregated in the bucket
+    gpa_uint64 m_numDroppedRecords;  ///< number of records lost since the previous bucket, because they were not read before the record buffer was full
+} GPA_StreamingCounterBucket;
+
+/// Statistics of the results of a counter, accumulated across samples and sessions, as returned by GPA_GetCounterStatistics
+typedef struct GPA_CounterStatistics
+{
+    gpa_uint64  m_count;     ///< number of results accumulated
+    gpa_float64 m_sum;       ///< sum of the results
+    gpa_float64 m_min;       ///< smallest result
+    gpa_float64 m_max;       ///< largest result
+    gpa_float64 m_mean;      ///< mean of the results
+    gpa_float64 m_variance;  ///< population variance of the results
+    gpa_float64 m_p50;       ///< estimated median of the results, within 1% of the exact value
+    gpa_float64 m_p95;       ///< estimated 95th percentile of the results, within 1% of the exact value
+    gpa_float64 m_p99;       ///< estimated 99th percentile of the results, within 1% of the exact value
+} GPA_CounterStatistics;
+
+/// A chunk of the SQTT data of a session, as returned by GPA_GetSQTTChunk.
+/// The data of each trace stream (one per shader engine) is the concatenation of its chunks, in the order of their offsets.
+typedef struct GPA_SQTTChunkView
+{
+    gpa_uint32  m_streamId;      ///< id of the trace stream of the chunk
+    gpa_uint64  m_streamOffset;  ///< offset of the chunk within the data of its trace stream
+    gpa_uint64  m_size;          ///< size of the chunk in bytes
+    const void* m_pData;         ///< the data of the chunk, valid until the session is deleted or begun again
+} GPA_SQTTChunkView;
+
+/// Categories of the host memory held by GPUPerfAPI, as reported by GPA_GetMemoryStats
+typedef enum
+{
+    GPA_MEMORY_CATEGORY__START,                                       ///< Marker indicating first element
+    GPA_MEMORY_CATEGORY_COUNTER_CATALOG = GPA_MEMORY_CATEGORY__START,  ///< Counters generated for each device, shared by the contexts opened on it
+    GPA_MEMORY_CATEGORY_COUNTER_SCHEDULER,                            ///< Counter schedulers of the contexts, including the pass partitions of the enabled counters
+    GPA_MEMORY_CATEGORY_CONTEXT,                                      ///< Context objects
+    GPA_MEMORY_CATEGORY_SESSION,                                      ///< Session objects, including the result locations and the derived counter evaluation of the enabled counters
+    GPA_MEMORY_CATEGORY_PASS,                                         ///< Pass objects, including their sample indices
+    GPA_MEMORY_CATEGORY_SAMPLE,                                       ///< Sample objects
+    GPA_MEMORY_CATEGORY_SAMPLE_RESULT,                                ///< Result buffers of the samples
+    GPA_MEMORY_CATEGORY_BACKEND,                                      ///< API-specific host objects: the GL perf monitor and CL counter block pools and the GL driver counter cache; memory owned by the driver, such as query pools, is not tracked
+    GPA_MEMORY_CATEGORY_COUNTER_STATISTICS,                           ///< Counter statistics objects, including the quantile sketches of their counters
+    GPA_MEMORY_CATEGORY__LAST                                         ///< Marker indicating last element
+} GPA_Memory_Category;
+
 #endif  // _GPUPERFAPI_TYPES_H_
@@ -14,600 +14,454 @@
 
 namespace countergfx8baffin
 {
-    GPA_HardwareCounterDesc vgt0_counters_gfx8_baffin[] = {
-        {0, GPA_HIDE_NAME("VGT0_000"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 0 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {1, GPA_HIDE_NAME("VGT0_PERF_VGT_SPI_ESVERT_VALID"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("ES Vert is valid"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {2, GPA_HIDE_NAME("VGT0_002"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 2 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {3, GPA_HIDE_NAME("VGT0_003"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 3 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {4, GPA_HIDE_NAME("VGT0_004"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 4 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {5, GPA_HIDE_NAME("VGT0_005"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 5 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {6, GPA_HIDE_NAME("VGT0_006"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 6 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {7, GPA_HIDE_NAME("VGT0_007"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 7 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {8, GPA_HIDE_NAME("VGT0_008"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 8 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {9, GPA_HIDE_NAME("VGT0_PERF_VGT_SPI_GSPRIM_VALID"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("ES GS Primitive send is active"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {10, GPA_HIDE_NAME("VGT0_010"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 10 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {11, GPA_HIDE_NAME("VGT0_011"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 11 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {12, GPA_HIDE_NAME("VGT0_012"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 12 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {13, GPA_HIDE_NAME("VGT0_013"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 13 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {14, GPA_HIDE_NAME("VGT0_014"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 14 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {15, GPA_HIDE_NAME("VGT0_015"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 15 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {16, GPA_HIDE_NAME("VGT0_016"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 16 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {17, GPA_HIDE_NAME("VGT0_017"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 17 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {18, GPA_HIDE_NAME("VGT0_018"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 18 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {19, GPA_HIDE_NAME("VGT0_019"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 19 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {20, GPA_HIDE_NAME("VGT0_PERF_VGT_SPI_VSVERT_SEND"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("VS vert send"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {21, GPA_HIDE_NAME("VGT0_021"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 21 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {22, GPA_HIDE_NAME("VGT0_022"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 22 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {23, GPA_HIDE_NAME("VGT0_023"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 23 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {24, GPA_HIDE_NAME("VGT0_024"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 24 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {25, GPA_HIDE_NAME("VGT0_025"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 25 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {26, GPA_HIDE_NAME("VGT0_026"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 26 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {27, GPA_HIDE_NAME("VGT0_027"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 27 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {28, GPA_HIDE_NAME("VGT0_028"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 28 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {29, GPA_HIDE_NAME("VGT0_029"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 29 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {30, GPA_HIDE_NAME("VGT0_030"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 30 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {31, GPA_HIDE_NAME("VGT0_031"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 31 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {32, GPA_HIDE_NAME("VGT0_032"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 32 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {33, GPA_HIDE_NAME("VGT0_033"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 33 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {34, GPA_HIDE_NAME("VGT0_034"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 34 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {35, GPA_HIDE_NAME("VGT0_035"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 35 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {36, GPA_HIDE_NAME("VGT0_036"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 36 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {37, GPA_HIDE_NAME("VGT0_037"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 37 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {38, GPA_HIDE_NAME("VGT0_038"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 38 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {39, GPA_HIDE_NAME("VGT0_039"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 39 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {40, GPA_HIDE_NAME("VGT0_040"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 40 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {41, GPA_HIDE_NAME("VGT0_041"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 41 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {42, GPA_HIDE_NAME("VGT0_042"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 42 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {43, GPA_HIDE_NAME("VGT0_043"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 43 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {44, GPA_HIDE_NAME("VGT0_044"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 44 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {45, GPA_HIDE_NAME("VGT0_045"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 45 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {46, GPA_HIDE_NAME("VGT0_046"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 46 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {47, GPA_HIDE_NAME("VGT0_047"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 47 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {48, GPA_HIDE_NAME("VGT0_048"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 48 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {49, GPA_HIDE_NAME("VGT0_049"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 49 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {50, GPA_HIDE_NAME("VGT0_050"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 50 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {51, GPA_HIDE_NAME("VGT0_051"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 51 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {52, GPA_HIDE_NAME("VGT0_052"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 52 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {53, GPA_HIDE_NAME("VGT0_053"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 53 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {54, GPA_HIDE_NAME("VGT0_054"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 54 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {55, GPA_HIDE_NAME("VGT0_055"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 55 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {56, GPA_HIDE_NAME("VGT0_056"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 56 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {57, GPA_HIDE_NAME("VGT0_057"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 57 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {58, GPA_HIDE_NAME("VGT0_058"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 58 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {59, GPA_HIDE_NAME("VGT0_059"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 59 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {60, GPA_HIDE_NAME("VGT0_060"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 60 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {61, GPA_HIDE_NAME("VGT0_061"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 61 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {62, GPA_HIDE_NAME("VGT0_062"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 62 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {63, GPA_HIDE_NAME("VGT0_063"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 63 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {64, GPA_HIDE_NAME("VGT0_064"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 64 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {65, GPA_HIDE_NAME("VGT0_065"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 65 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {66, GPA_HIDE_NAME("VGT0_066"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 66 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {67, GPA_HIDE_NAME("VGT0_067"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 67 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {68, GPA_HIDE_NAME("VGT0_068"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 68 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {69, GPA_HIDE_NAME("VGT0_069"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 69 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {70, GPA_HIDE_NAME("VGT0_070"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 70 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {71, GPA_HIDE_NAME("VGT0_071"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 71 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {72, GPA_HIDE_NAME("VGT0_072"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 72 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {73, GPA_HIDE_NAME("VGT0_073"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 73 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {74, GPA_HIDE_NAME("VGT0_074"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 74 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {75, GPA_HIDE_NAME("VGT0_075"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 75 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {76, GPA_HIDE_NAME("VGT0_076"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 76 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {77, GPA_HIDE_NAME("VGT0_077"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 77 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {78, GPA_HIDE_NAME("VGT0_078"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 78 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {79, GPA_HIDE_NAME("VGT0_079"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 79 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {80, GPA_HIDE_NAME("VGT0_080"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 80 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {81, GPA_HIDE_NAME("VGT0_081"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 81 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {82, GPA_HIDE_NAME("VGT0_082"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 82 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {83, GPA_HIDE_NAME("VGT0_083"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 83 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {84, GPA_HIDE_NAME("VGT0_084"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 84 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {85, GPA_HIDE_NAME("VGT0_085"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 85 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {86, GPA_HIDE_NAME("VGT0_086"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 86 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {87, GPA_HIDE_NAME("VGT0_087"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 87 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {88, GPA_HIDE_NAME("VGT0_088"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 88 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {89, GPA_HIDE_NAME("VGT0_089"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 89 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {90, GPA_HIDE_NAME("VGT0_090"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 90 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {91, GPA_HIDE_NAME("VGT0_091"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 91 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {92, GPA_HIDE_NAME("VGT0_092"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 92 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {93, GPA_HIDE_NAME("VGT0_093"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 93 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {94, GPA_HIDE_NAME("VGT0_094"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 94 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {95, GPA_HIDE_NAME("VGT0_095"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 95 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {96, GPA_HIDE_NAME("VGT0_PERF_VGT_SPI_LSVERT_VALID"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("LS Vert is valid. Sensitive to PERF_SEID_IGNORE_MASK"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {97, GPA_HIDE_NAME("VGT0_097"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 97 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {98, GPA_HIDE_NAME("VGT0_098"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 98 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {99, GPA_HIDE_NAME("VGT0_099"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 99 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {100, GPA_HIDE_NAME("VGT0_100"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 100 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {101, GPA_HIDE_NAME("VGT0_101"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 101 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {102, GPA_HIDE_NAME("VGT0_102"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 102 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {103, GPA_HIDE_NAME("VGT0_103"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 103 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {104, GPA_HIDE_NAME("VGT0_104"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 104 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {105, GPA_HIDE_NAME("VGT0_PERF_VGT_SPI_HSVERT_VALID"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("HS Vert is valid. Sensitive to PERF_SEID_IGNORE_MASK"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {106, GPA_HIDE_NAME("VGT0_106"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 106 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {107, GPA_HIDE_NAME("VGT0_107"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 107 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {108, GPA_HIDE_NAME("VGT0_108"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 108 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {109, GPA_HIDE_NAME("VGT0_109"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 109 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {110, GPA_HIDE_NAME("VGT0_110"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 110 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {111, GPA_HIDE_NAME("VGT0_111"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 111 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {112, GPA_HIDE_NAME("VGT0_112"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 112 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {113, GPA_HIDE_NAME("VGT0_113"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 113 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {114, GPA_HIDE_NAME("VGT0_114"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 114 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {115, GPA_HIDE_NAME("VGT0_115"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 115 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {116, GPA_HIDE_NAME("VGT0_116"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 116 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {117, GPA_HIDE_NAME("VGT0_117"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 117 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {118, GPA_HIDE_NAME("VGT0_118"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 118 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {119, GPA_HIDE_NAME("VGT0_119"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 119 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {120, GPA_HIDE_NAME("VGT0_120"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 120 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {121, GPA_HIDE_NAME("VGT0_121"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 121 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {122, GPA_HIDE_NAME("VGT0_122"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 122 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {123, GPA_HIDE_NAME("VGT0_123"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 123 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {124, GPA_HIDE_NAME("VGT0_124"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 124 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {125, GPA_HIDE_NAME("VGT0_PERF_VGT_TE11_BUSY"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counts number of cycles the TE11 block is busy. (DX11 Tessellation Fixed Function Logic)"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {126, GPA_HIDE_NAME("VGT0_126"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 126 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {127, GPA_HIDE_NAME("VGT0_127"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 127 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {128, GPA_HIDE_NAME("VGT0_128"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 128 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {129, GPA_HIDE_NAME("VGT0_129"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 129 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {130, GPA_HIDE_NAME("VGT0_130"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 130 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {131, GPA_HIDE_NAME("VGT0_131"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 131 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {132, GPA_HIDE_NAME("VGT0_132"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 132 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {133, GPA_HIDE_NAME("VGT0_133"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 133 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {134, GPA_HIDE_NAME("VGT0_134"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 134 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {135, GPA_HIDE_NAME("VGT0_135"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 135 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {136, GPA_HIDE_NAME("VGT0_136"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 136 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {137, GPA_HIDE_NAME("VGT0_137"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 137 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {138, GPA_HIDE_NAME("VGT0_138"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 138 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {139, GPA_HIDE_NAME("VGT0_139"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 139 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {140, GPA_HIDE_NAME("VGT0_140"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 140 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {141, GPA_HIDE_NAME("VGT0_141"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 141 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {142, GPA_HIDE_NAME("VGT0_142"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 142 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {143, GPA_HIDE_NAME("VGT0_143"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 143 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {144, GPA_HIDE_NAME("VGT0_144"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 144 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {145, GPA_HIDE_NAME("VGT0_145"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 145 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {146, GPA_HIDE_NAME("VGT0_146"), GPA_HIDE_NAME("VGT0"), GPA_HIDE_NAME("Counter 146 from group VGT0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-    };
-    GPA_HardwareCounterDesc vgt1_counters_gfx8_baffin[] = {
-        {0, GPA_HIDE_NAME("VGT1_000"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 0 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {1, GPA_HIDE_NAME("VGT1_PERF_VGT_SPI_ESVERT_VALID"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("ES Vert is valid"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {2, GPA_HIDE_NAME("VGT1_002"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 2 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {3, GPA_HIDE_NAME("VGT1_003"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 3 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {4, GPA_HIDE_NAME("VGT1_004"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 4 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {5, GPA_HIDE_NAME("VGT1_005"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 5 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {6, GPA_HIDE_NAME("VGT1_006"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 6 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {7, GPA_HIDE_NAME("VGT1_007"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 7 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {8, GPA_HIDE_NAME("VGT1_008"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 8 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {9, GPA_HIDE_NAME("VGT1_PERF_VGT_SPI_GSPRIM_VALID"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("ES GS Primitive send is active"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {10, GPA_HIDE_NAME("VGT1_010"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 10 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {11, GPA_HIDE_NAME("VGT1_011"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 11 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {12, GPA_HIDE_NAME("VGT1_012"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 12 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {13, GPA_HIDE_NAME("VGT1_013"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 13 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {14, GPA_HIDE_NAME("VGT1_014"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 14 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {15, GPA_HIDE_NAME("VGT1_015"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 15 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {16, GPA_HIDE_NAME("VGT1_016"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 16 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {17, GPA_HIDE_NAME("VGT1_017"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 17 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {18, GPA_HIDE_NAME("VGT1_018"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 18 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {19, GPA_HIDE_NAME("VGT1_019"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 19 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {20, GPA_HIDE_NAME("VGT1_PERF_VGT_SPI_VSVERT_SEND"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("VS vert send"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {21, GPA_HIDE_NAME("VGT1_021"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 21 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {22, GPA_HIDE_NAME("VGT1_022"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 22 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {23, GPA_HIDE_NAME("VGT1_023"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 23 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {24, GPA_HIDE_NAME("VGT1_024"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 24 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {25, GPA_HIDE_NAME("VGT1_025"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 25 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {26, GPA_HIDE_NAME("VGT1_026"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 26 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {27, GPA_HIDE_NAME("VGT1_027"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 27 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {28, GPA_HIDE_NAME("VGT1_028"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 28 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {29, GPA_HIDE_NAME("VGT1_029"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 29 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {30, GPA_HIDE_NAME("VGT1_030"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 30 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {31, GPA_HIDE_NAME("VGT1_031"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 31 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {32, GPA_HIDE_NAME("VGT1_032"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 32 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {33, GPA_HIDE_NAME("VGT1_033"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 33 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {34, GPA_HIDE_NAME("VGT1_034"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 34 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {35, GPA_HIDE_NAME("VGT1_035"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 35 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {36, GPA_HIDE_NAME("VGT1_036"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 36 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {37, GPA_HIDE_NAME("VGT1_037"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 37 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {38, GPA_HIDE_NAME("VGT1_038"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 38 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {39, GPA_HIDE_NAME("VGT1_039"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 39 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {40, GPA_HIDE_NAME("VGT1_040"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 40 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {41, GPA_HIDE_NAME("VGT1_041"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 41 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {42, GPA_HIDE_NAME("VGT1_042"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 42 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {43, GPA_HIDE_NAME("VGT1_043"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 43 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {44, GPA_HIDE_NAME("VGT1_044"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 44 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {45, GPA_HIDE_NAME("VGT1_045"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 45 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {46, GPA_HIDE_NAME("VGT1_046"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 46 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {47, GPA_HIDE_NAME("VGT1_047"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 47 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {48, GPA_HIDE_NAME("VGT1_048"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 48 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {49, GPA_HIDE_NAME("VGT1_049"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 49 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {50, GPA_HIDE_NAME("VGT1_050"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 50 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {51, GPA_HIDE_NAME("VGT1_051"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 51 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {52, GPA_HIDE_NAME("VGT1_052"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 52 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {53, GPA_HIDE_NAME("VGT1_053"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 53 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {54, GPA_HIDE_NAME("VGT1_054"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 54 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {55, GPA_HIDE_NAME("VGT1_055"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 55 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {56, GPA_HIDE_NAME("VGT1_056"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 56 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {57, GPA_HIDE_NAME("VGT1_057"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 57 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {58, GPA_HIDE_NAME("VGT1_058"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 58 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {59, GPA_HIDE_NAME("VGT1_059"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 59 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {60, GPA_HIDE_NAME("VGT1_060"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 60 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {61, GPA_HIDE_NAME("VGT1_061"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 61 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {62, GPA_HIDE_NAME("VGT1_062"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 62 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {63, GPA_HIDE_NAME("VGT1_063"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 63 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {64, GPA_HIDE_NAME("VGT1_064"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 64 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {65, GPA_HIDE_NAME("VGT1_065"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 65 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {66, GPA_HIDE_NAME("VGT1_066"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 66 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {67, GPA_HIDE_NAME("VGT1_067"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 67 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {68, GPA_HIDE_NAME("VGT1_068"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 68 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {69, GPA_HIDE_NAME("VGT1_069"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 69 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {70, GPA_HIDE_NAME("VGT1_070"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 70 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {71, GPA_HIDE_NAME("VGT1_071"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 71 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {72, GPA_HIDE_NAME("VGT1_072"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 72 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {73, GPA_HIDE_NAME("VGT1_073"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 73 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {74, GPA_HIDE_NAME("VGT1_074"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 74 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {75, GPA_HIDE_NAME("VGT1_075"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 75 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {76, GPA_HIDE_NAME("VGT1_076"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 76 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {77, GPA_HIDE_NAME("VGT1_077"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 77 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {78, GPA_HIDE_NAME("VGT1_078"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 78 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {79, GPA_HIDE_NAME("VGT1_079"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 79 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {80, GPA_HIDE_NAME("VGT1_080"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 80 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {81, GPA_HIDE_NAME("VGT1_081"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 81 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {82, GPA_HIDE_NAME("VGT1_082"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 82 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {83, GPA_HIDE_NAME("VGT1_083"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 83 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {84, GPA_HIDE_NAME("VGT1_084"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 84 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {85, GPA_HIDE_NAME("VGT1_085"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 85 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {86, GPA_HIDE_NAME("VGT1_086"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 86 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {87, GPA_HIDE_NAME("VGT1_087"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 87 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {88, GPA_HIDE_NAME("VGT1_088"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 88 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {89, GPA_HIDE_NAME("VGT1_089"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 89 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {90, GPA_HIDE_NAME("VGT1_090"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 90 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {91, GPA_HIDE_NAME("VGT1_091"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 91 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {92, GPA_HIDE_NAME("VGT1_092"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 92 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {93, GPA_HIDE_NAME("VGT1_093"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 93 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {94, GPA_HIDE_NAME("VGT1_094"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 94 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {95, GPA_HIDE_NAME("VGT1_095"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 95 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {96, GPA_HIDE_NAME("VGT1_PERF_VGT_SPI_LSVERT_VALID"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("LS Vert is valid. Sensitive to PERF_SEID_IGNORE_MASK"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {97, GPA_HIDE_NAME("VGT1_097"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 97 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {98, GPA_HIDE_NAME("VGT1_098"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 98 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {99, GPA_HIDE_NAME("VGT1_099"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 99 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {100, GPA_HIDE_NAME("VGT1_100"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 100 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {101, GPA_HIDE_NAME("VGT1_101"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 101 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {102, GPA_HIDE_NAME("VGT1_102"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 102 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {103, GPA_HIDE_NAME("VGT1_103"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 103 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {104, GPA_HIDE_NAME("VGT1_104"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 104 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {105, GPA_HIDE_NAME("VGT1_PERF_VGT_SPI_HSVERT_VALID"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("HS Vert is valid. Sensitive to PERF_SEID_IGNORE_MASK"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {106, GPA_HIDE_NAME("VGT1_106"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 106 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {107, GPA_HIDE_NAME("VGT1_107"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 107 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {108, GPA_HIDE_NAME("VGT1_108"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 108 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {109, GPA_HIDE_NAME("VGT1_109"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 109 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {110, GPA_HIDE_NAME("VGT1_110"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 110 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {111, GPA_HIDE_NAME("VGT1_111"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 111 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {112, GPA_HIDE_NAME("VGT1_112"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 112 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {113, GPA_HIDE_NAME("VGT1_113"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 113 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {114, GPA_HIDE_NAME("VGT1_114"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 114 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {115, GPA_HIDE_NAME("VGT1_115"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 115 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {116, GPA_HIDE_NAME("VGT1_116"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 116 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {117, GPA_HIDE_NAME("VGT1_117"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 117 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {118, GPA_HIDE_NAME("VGT1_118"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 118 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {119, GPA_HIDE_NAME("VGT1_119"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 119 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {120, GPA_HIDE_NAME("VGT1_120"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 120 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {121, GPA_HIDE_NAME("VGT1_121"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 121 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {122, GPA_HIDE_NAME("VGT1_122"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 122 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {123, GPA_HIDE_NAME("VGT1_123"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 123 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {124, GPA_HIDE_NAME("VGT1_124"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 124 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {125, GPA_HIDE_NAME("VGT1_PERF_VGT_TE11_BUSY"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counts number of cycles the TE11 block is busy. (DX11 Tessellation Fixed Function Logic)"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {126, GPA_HIDE_NAME("VGT1_126"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 126 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {127, GPA_HIDE_NAME("VGT1_127"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 127 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {128, GPA_HIDE_NAME("VGT1_128"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 128 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {129, GPA_HIDE_NAME("VGT1_129"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 129 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {130, GPA_HIDE_NAME("VGT1_130"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 130 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {131, GPA_HIDE_NAME("VGT1_131"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 131 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {132, GPA_HIDE_NAME("VGT1_132"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 132 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {133, GPA_HIDE_NAME("VGT1_133"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 133 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {134, GPA_HIDE_NAME("VGT1_134"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 134 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {135, GPA_HIDE_NAME("VGT1_135"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 135 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {136, GPA_HIDE_NAME("VGT1_136"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 136 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {137, GPA_HIDE_NAME("VGT1_137"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 137 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {138, GPA_HIDE_NAME("VGT1_138"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 138 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {139, GPA_HIDE_NAME("VGT1_139"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 139 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {140, GPA_HIDE_NAME("VGT1_140"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 140 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {141, GPA_HIDE_NAME("VGT1_141"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 141 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {142, GPA_HIDE_NAME("VGT1_142"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 142 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {143, GPA_HIDE_NAME("VGT1_143"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 143 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {144, GPA_HIDE_NAME("VGT1_144"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 144 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {145, GPA_HIDE_NAME("VGT1_145"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 145 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {146, GPA_HIDE_NAME("VGT1_146"), GPA_HIDE_NAME("VGT1"), GPA_HIDE_NAME("Counter 146 from group VGT1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-    };
-    GPA_HardwareCounterDesc vgt2_counters_gfx8_baffin[] = {
-        {0, GPA_HIDE_NAME("VGT2_000"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 0 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {1, GPA_HIDE_NAME("VGT2_PERF_VGT_SPI_ESVERT_VALID"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("ES Vert is valid"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {2, GPA_HIDE_NAME("VGT2_002"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 2 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {3, GPA_HIDE_NAME("VGT2_003"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 3 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {4, GPA_HIDE_NAME("VGT2_004"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 4 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {5, GPA_HIDE_NAME("VGT2_005"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 5 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {6, GPA_HIDE_NAME("VGT2_006"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 6 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {7, GPA_HIDE_NAME("VGT2_007"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 7 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {8, GPA_HIDE_NAME("VGT2_008"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 8 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {9, GPA_HIDE_NAME("VGT2_PERF_VGT_SPI_GSPRIM_VALID"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("ES GS Primitive send is active"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {10, GPA_HIDE_NAME("VGT2_010"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 10 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {11, GPA_HIDE_NAME("VGT2_011"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 11 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {12, GPA_HIDE_NAME("VGT2_012"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 12 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {13, GPA_HIDE_NAME("VGT2_013"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 13 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {14, GPA_HIDE_NAME("VGT2_014"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 14 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {15, GPA_HIDE_NAME("VGT2_015"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 15 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {16, GPA_HIDE_NAME("VGT2_016"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 16 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {17, GPA_HIDE_NAME("VGT2_017"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 17 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {18, GPA_HIDE_NAME("VGT2_018"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 18 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {19, GPA_HIDE_NAME("VGT2_019"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 19 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {20, GPA_HIDE_NAME("VGT2_PERF_VGT_SPI_VSVERT_SEND"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("VS vert send"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {21, GPA_HIDE_NAME("VGT2_021"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 21 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {22, GPA_HIDE_NAME("VGT2_022"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 22 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {23, GPA_HIDE_NAME("VGT2_023"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 23 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {24, GPA_HIDE_NAME("VGT2_024"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 24 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {25, GPA_HIDE_NAME("VGT2_025"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 25 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {26, GPA_HIDE_NAME("VGT2_026"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 26 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {27, GPA_HIDE_NAME("VGT2_027"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 27 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {28, GPA_HIDE_NAME("VGT2_028"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 28 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {29, GPA_HIDE_NAME("VGT2_029"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 29 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {30, GPA_HIDE_NAME("VGT2_030"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 30 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {31, GPA_HIDE_NAME("VGT2_031"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 31 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {32, GPA_HIDE_NAME("VGT2_032"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 32 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {33, GPA_HIDE_NAME("VGT2_033"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 33 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {34, GPA_HIDE_NAME("VGT2_034"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 34 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {35, GPA_HIDE_NAME("VGT2_035"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 35 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {36, GPA_HIDE_NAME("VGT2_036"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 36 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {37, GPA_HIDE_NAME("VGT2_037"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 37 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {38, GPA_HIDE_NAME("VGT2_038"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 38 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {39, GPA_HIDE_NAME("VGT2_039"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 39 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {40, GPA_HIDE_NAME("VGT2_040"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 40 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {41, GPA_HIDE_NAME("VGT2_041"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 41 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {42, GPA_HIDE_NAME("VGT2_042"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 42 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {43, GPA_HIDE_NAME("VGT2_043"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 43 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {44, GPA_HIDE_NAME("VGT2_044"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 44 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {45, GPA_HIDE_NAME("VGT2_045"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 45 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {46, GPA_HIDE_NAME("VGT2_046"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 46 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {47, GPA_HIDE_NAME("VGT2_047"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 47 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {48, GPA_HIDE_NAME("VGT2_048"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 48 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {49, GPA_HIDE_NAME("VGT2_049"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 49 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {50, GPA_HIDE_NAME("VGT2_050"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 50 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {51, GPA_HIDE_NAME("VGT2_051"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 51 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {52, GPA_HIDE_NAME("VGT2_052"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 52 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {53, GPA_HIDE_NAME("VGT2_053"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 53 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {54, GPA_HIDE_NAME("VGT2_054"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 54 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {55, GPA_HIDE_NAME("VGT2_055"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 55 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {56, GPA_HIDE_NAME("VGT2_056"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 56 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {57, GPA_HIDE_NAME("VGT2_057"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 57 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {58, GPA_HIDE_NAME("VGT2_058"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 58 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {59, GPA_HIDE_NAME("VGT2_059"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 59 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {60, GPA_HIDE_NAME("VGT2_060"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 60 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {61, GPA_HIDE_NAME("VGT2_061"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 61 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {62, GPA_HIDE_NAME("VGT2_062"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 62 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {63, GPA_HIDE_NAME("VGT2_063"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 63 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {64, GPA_HIDE_NAME("VGT2_064"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 64 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {65, GPA_HIDE_NAME("VGT2_065"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 65 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {66, GPA_HIDE_NAME("VGT2_066"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 66 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {67, GPA_HIDE_NAME("VGT2_067"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 67 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {68, GPA_HIDE_NAME("VGT2_068"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 68 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {69, GPA_HIDE_NAME("VGT2_069"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 69 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {70, GPA_HIDE_NAME("VGT2_070"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 70 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {71, GPA_HIDE_NAME("VGT2_071"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 71 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {72, GPA_HIDE_NAME("VGT2_072"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 72 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {73, GPA_HIDE_NAME("VGT2_073"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 73 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {74, GPA_HIDE_NAME("VGT2_074"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 74 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {75, GPA_HIDE_NAME("VGT2_075"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 75 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {76, GPA_HIDE_NAME("VGT2_076"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 76 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {77, GPA_HIDE_NAME("VGT2_077"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 77 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {78, GPA_HIDE_NAME("VGT2_078"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 78 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {79, GPA_HIDE_NAME("VGT2_079"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 79 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {80, GPA_HIDE_NAME("VGT2_080"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 80 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {81, GPA_HIDE_NAME("VGT2_081"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 81 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {82, GPA_HIDE_NAME("VGT2_082"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 82 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {83, GPA_HIDE_NAME("VGT2_083"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 83 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {84, GPA_HIDE_NAME("VGT2_084"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 84 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {85, GPA_HIDE_NAME("VGT2_085"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 85 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {86, GPA_HIDE_NAME("VGT2_086"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 86 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {87, GPA_HIDE_NAME("VGT2_087"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 87 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {88, GPA_HIDE_NAME("VGT2_088"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 88 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {89, GPA_HIDE_NAME("VGT2_089"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 89 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {90, GPA_HIDE_NAME("VGT2_090"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 90 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {91, GPA_HIDE_NAME("VGT2_091"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 91 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {92, GPA_HIDE_NAME("VGT2_092"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 92 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {93, GPA_HIDE_NAME("VGT2_093"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 93 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {94, GPA_HIDE_NAME("VGT2_094"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 94 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {95, GPA_HIDE_NAME("VGT2_095"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 95 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {96, GPA_HIDE_NAME("VGT2_PERF_VGT_SPI_LSVERT_VALID"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("LS Vert is valid. Sensitive to PERF_SEID_IGNORE_MASK"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {97, GPA_HIDE_NAME("VGT2_097"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 97 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {98, GPA_HIDE_NAME("VGT2_098"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 98 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {99, GPA_HIDE_NAME("VGT2_099"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 99 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {100, GPA_HIDE_NAME("VGT2_100"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 100 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {101, GPA_HIDE_NAME("VGT2_101"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 101 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {102, GPA_HIDE_NAME("VGT2_102"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 102 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {103, GPA_HIDE_NAME("VGT2_103"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 103 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {104, GPA_HIDE_NAME("VGT2_104"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 104 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {105, GPA_HIDE_NAME("VGT2_PERF_VGT_SPI_HSVERT_VALID"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("HS Vert is valid. Sensitive to PERF_SEID_IGNORE_MASK"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {106, GPA_HIDE_NAME("VGT2_106"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 106 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {107, GPA_HIDE_NAME("VGT2_107"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 107 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {108, GPA_HIDE_NAME("VGT2_108"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 108 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {109, GPA_HIDE_NAME("VGT2_109"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 109 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {110, GPA_HIDE_NAME("VGT2_110"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 110 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {111, GPA_HIDE_NAME("VGT2_111"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 111 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {112, GPA_HIDE_NAME("VGT2_112"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 112 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {113, GPA_HIDE_NAME("VGT2_113"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 113 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {114, GPA_HIDE_NAME("VGT2_114"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 114 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {115, GPA_HIDE_NAME("VGT2_115"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 115 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {116, GPA_HIDE_NAME("VGT2_116"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 116 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {117, GPA_HIDE_NAME("VGT2_117"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 117 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {118, GPA_HIDE_NAME("VGT2_118"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 118 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {119, GPA_HIDE_NAME("VGT2_119"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 119 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {120, GPA_HIDE_NAME("VGT2_120"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 120 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {121, GPA_HIDE_NAME("VGT2_121"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 121 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {122, GPA_HIDE_NAME("VGT2_122"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 122 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {123, GPA_HIDE_NAME("VGT2_123"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 123 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {124, GPA_HIDE_NAME("VGT2_124"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 124 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {125, GPA_HIDE_NAME("VGT2_PERF_VGT_TE11_BUSY"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counts number of cycles the TE11 block is busy. (DX11 Tessellation Fixed Function Logic)"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {126, GPA_HIDE_NAME("VGT2_126"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 126 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {127, GPA_HIDE_NAME("VGT2_127"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 127 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {128, GPA_HIDE_NAME("VGT2_128"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 128 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {129, GPA_HIDE_NAME("VGT2_129"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 129 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {130, GPA_HIDE_NAME("VGT2_130"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 130 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {131, GPA_HIDE_NAME("VGT2_131"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 131 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {132, GPA_HIDE_NAME("VGT2_132"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 132 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {133, GPA_HIDE_NAME("VGT2_133"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 133 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {134, GPA_HIDE_NAME("VGT2_134"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 134 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {135, GPA_HIDE_NAME("VGT2_135"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 135 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {136, GPA_HIDE_NAME("VGT2_136"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 136 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {137, GPA_HIDE_NAME("VGT2_137"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 137 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {138, GPA_HIDE_NAME("VGT2_138"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 138 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {139, GPA_HIDE_NAME("VGT2_139"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 139 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {140, GPA_HIDE_NAME("VGT2_140"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 140 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {141, GPA_HIDE_NAME("VGT2_141"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 141 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {142, GPA_HIDE_NAME("VGT2_142"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 142 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {143, GPA_HIDE_NAME("VGT2_143"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 143 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {144, GPA_HIDE_NAME("VGT2_144"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 144 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {145, GPA_HIDE_NAME("VGT2_145"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 145 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {146, GPA_HIDE_NAME("VGT2_146"), GPA_HIDE_NAME("VGT2"), GPA_HIDE_NAME("Counter 146 from group VGT2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-    };
-    GPA_HardwareCounterDesc vgt3_counters_gfx8_baffin[] = {
-        {0, GPA_HIDE_NAME("VGT3_000"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 0 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {1, GPA_HIDE_NAME("VGT3_PERF_VGT_SPI_ESVERT_VALID"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("ES Vert is valid"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {2, GPA_HIDE_NAME("VGT3_002"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 2 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {3, GPA_HIDE_NAME("VGT3_003"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 3 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {4, GPA_HIDE_NAME("VGT3_004"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 4 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {5, GPA_HIDE_NAME("VGT3_005"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 5 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {6, GPA_HIDE_NAME("VGT3_006"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 6 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {7, GPA_HIDE_NAME("VGT3_007"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 7 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {8, GPA_HIDE_NAME("VGT3_008"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 8 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {9, GPA_HIDE_NAME("VGT3_PERF_VGT_SPI_GSPRIM_VALID"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("ES GS Primitive send is active"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {10, GPA_HIDE_NAME("VGT3_010"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 10 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {11, GPA_HIDE_NAME("VGT3_011"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 11 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {12, GPA_HIDE_NAME("VGT3_012"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 12 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {13, GPA_HIDE_NAME("VGT3_013"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 13 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {14, GPA_HIDE_NAME("VGT3_014"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 14 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {15, GPA_HIDE_NAME("VGT3_015"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 15 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {16, GPA_HIDE_NAME("VGT3_016"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 16 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {17, GPA_HIDE_NAME("VGT3_017"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 17 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {18, GPA_HIDE_NAME("VGT3_018"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 18 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {19, GPA_HIDE_NAME("VGT3_019"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 19 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {20, GPA_HIDE_NAME("VGT3_PERF_VGT_SPI_VSVERT_SEND"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("VS vert send"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {21, GPA_HIDE_NAME("VGT3_021"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 21 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {22, GPA_HIDE_NAME("VGT3_022"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 22 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {23, GPA_HIDE_NAME("VGT3_023"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 23 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {24, GPA_HIDE_NAME("VGT3_024"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 24 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {25, GPA_HIDE_NAME("VGT3_025"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 25 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {26, GPA_HIDE_NAME("VGT3_026"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 26 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {27, GPA_HIDE_NAME("VGT3_027"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 27 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {28, GPA_HIDE_NAME("VGT3_028"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 28 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {29, GPA_HIDE_NAME("VGT3_029"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 29 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {30, GPA_HIDE_NAME("VGT3_030"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 30 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {31, GPA_HIDE_NAME("VGT3_031"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 31 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {32, GPA_HIDE_NAME("VGT3_032"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 32 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {33, GPA_HIDE_NAME("VGT3_033"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 33 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {34, GPA_HIDE_NAME("VGT3_034"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 34 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {35, GPA_HIDE_NAME("VGT3_035"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 35 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {36, GPA_HIDE_NAME("VGT3_036"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 36 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {37, GPA_HIDE_NAME("VGT3_037"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 37 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {38, GPA_HIDE_NAME("VGT3_038"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 38 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {39, GPA_HIDE_NAME("VGT3_039"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 39 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {40, GPA_HIDE_NAME("VGT3_040"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 40 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {41, GPA_HIDE_NAME("VGT3_041"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 41 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {42, GPA_HIDE_NAME("VGT3_042"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 42 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {43, GPA_HIDE_NAME("VGT3_043"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 43 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {44, GPA_HIDE_NAME("VGT3_044"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 44 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {45, GPA_HIDE_NAME("VGT3_045"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 45 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {46, GPA_HIDE_NAME("VGT3_046"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 46 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {47, GPA_HIDE_NAME("VGT3_047"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 47 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {48, GPA_HIDE_NAME("VGT3_048"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 48 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {49, GPA_HIDE_NAME("VGT3_049"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 49 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {50, GPA_HIDE_NAME("VGT3_050"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 50 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {51, GPA_HIDE_NAME("VGT3_051"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 51 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {52, GPA_HIDE_NAME("VGT3_052"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 52 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {53, GPA_HIDE_NAME("VGT3_053"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 53 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {54, GPA_HIDE_NAME("VGT3_054"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 54 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {55, GPA_HIDE_NAME("VGT3_055"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 55 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {56, GPA_HIDE_NAME("VGT3_056"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 56 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {57, GPA_HIDE_NAME("VGT3_057"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 57 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {58, GPA_HIDE_NAME("VGT3_058"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 58 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {59, GPA_HIDE_NAME("VGT3_059"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 59 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {60, GPA_HIDE_NAME("VGT3_060"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 60 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {61, GPA_HIDE_NAME("VGT3_061"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 61 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {62, GPA_HIDE_NAME("VGT3_062"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 62 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {63, GPA_HIDE_NAME("VGT3_063"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 63 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {64, GPA_HIDE_NAME("VGT3_064"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 64 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {65, GPA_HIDE_NAME("VGT3_065"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 65 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {66, GPA_HIDE_NAME("VGT3_066"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 66 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {67, GPA_HIDE_NAME("VGT3_067"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 67 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {68, GPA_HIDE_NAME("VGT3_068"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 68 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {69, GPA_HIDE_NAME("VGT3_069"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 69 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {70, GPA_HIDE_NAME("VGT3_070"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 70 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {71, GPA_HIDE_NAME("VGT3_071"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 71 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {72, GPA_HIDE_NAME("VGT3_072"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 72 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {73, GPA_HIDE_NAME("VGT3_073"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 73 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {74, GPA_HIDE_NAME("VGT3_074"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 74 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {75, GPA_HIDE_NAME("VGT3_075"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 75 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {76, GPA_HIDE_NAME("VGT3_076"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 76 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {77, GPA_HIDE_NAME("VGT3_077"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 77 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {78, GPA_HIDE_NAME("VGT3_078"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 78 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {79, GPA_HIDE_NAME("VGT3_079"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 79 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {80, GPA_HIDE_NAME("VGT3_080"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 80 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {81, GPA_HIDE_NAME("VGT3_081"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 81 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {82, GPA_HIDE_NAME("VGT3_082"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 82 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {83, GPA_HIDE_NAME("VGT3_083"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 83 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {84, GPA_HIDE_NAME("VGT3_084"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 84 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {85, GPA_HIDE_NAME("VGT3_085"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 85 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {86, GPA_HIDE_NAME("VGT3_086"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 86 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {87, GPA_HIDE_NAME("VGT3_087"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 87 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {88, GPA_HIDE_NAME("VGT3_088"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 88 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {89, GPA_HIDE_NAME("VGT3_089"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 89 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {90, GPA_HIDE_NAME("VGT3_090"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 90 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {91, GPA_HIDE_NAME("VGT3_091"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 91 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {92, GPA_HIDE_NAME("VGT3_092"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 92 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {93, GPA_HIDE_NAME("VGT3_093"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 93 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {94, GPA_HIDE_NAME("VGT3_094"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 94 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {95, GPA_HIDE_NAME("VGT3_095"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 95 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {96, GPA_HIDE_NAME("VGT3_PERF_VGT_SPI_LSVERT_VALID"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("LS Vert is valid. Sensitive to PERF_SEID_IGNORE_MASK"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {97, GPA_HIDE_NAME("VGT3_097"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 97 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {98, GPA_HIDE_NAME("VGT3_098"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 98 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {99, GPA_HIDE_NAME("VGT3_099"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 99 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {100, GPA_HIDE_NAME("VGT3_100"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 100 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {101, GPA_HIDE_NAME("VGT3_101"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 101 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {102, GPA_HIDE_NAME("VGT3_102"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 102 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {103, GPA_HIDE_NAME("VGT3_103"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 103 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {104, GPA_HIDE_NAME("VGT3_104"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 104 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {105, GPA_HIDE_NAME("VGT3_PERF_VGT_SPI_HSVERT_VALID"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("HS Vert is valid. Sensitive to PERF_SEID_IGNORE_MASK"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {106, GPA_HIDE_NAME("VGT3_106"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 106 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {107, GPA_HIDE_NAME("VGT3_107"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 107 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {108, GPA_HIDE_NAME("VGT3_108"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 108 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {109, GPA_HIDE_NAME("VGT3_109"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 109 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {110, GPA_HIDE_NAME("VGT3_110"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 110 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {111, GPA_HIDE_NAME("VGT3_111"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 111 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {112, GPA_HIDE_NAME("VGT3_112"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 112 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {113, GPA_HIDE_NAME("VGT3_113"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 113 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {114, GPA_HIDE_NAME("VGT3_114"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 114 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {115, GPA_HIDE_NAME("VGT3_115"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 115 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {116, GPA_HIDE_NAME("VGT3_116"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 116 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {117, GPA_HIDE_NAME("VGT3_117"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 117 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {118, GPA_HIDE_NAME("VGT3_118"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 118 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {119, GPA_HIDE_NAME("VGT3_119"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 119 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {120, GPA_HIDE_NAME("VGT3_120"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 120 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {121, GPA_HIDE_NAME("VGT3_121"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 121 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {122, GPA_HIDE_NAME("VGT3_122"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 122 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {123, GPA_HIDE_NAME("VGT3_123"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 123 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {124, GPA_HIDE_NAME("VGT3_124"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 124 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {125, GPA_HIDE_NAME("VGT3_PERF_VGT_TE11_BUSY"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counts number of cycles the TE11 block is busy. (DX11 Tessellation Fixed Function Logic)"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {126, GPA_HIDE_NAME("VGT3_126"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 126 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {127, GPA_HIDE_NAME("VGT3_127"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 127 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {128, GPA_HIDE_NAME("VGT3_128"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 128 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {129, GPA_HIDE_NAME("VGT3_129"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 129 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {130, GPA_HIDE_NAME("VGT3_130"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 130 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {131, GPA_HIDE_NAME("VGT3_131"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 131 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {132, GPA_HIDE_NAME("VGT3_132"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 132 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {133, GPA_HIDE_NAME("VGT3_133"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 133 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {134, GPA_HIDE_NAME("VGT3_134"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 134 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {135, GPA_HIDE_NAME("VGT3_135"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 135 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {136, GPA_HIDE_NAME("VGT3_136"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 136 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {137, GPA_HIDE_NAME("VGT3_137"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 137 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {138, GPA_HIDE_NAME("VGT3_138"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 138 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {139, GPA_HIDE_NAME("VGT3_139"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 139 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {140, GPA_HIDE_NAME("VGT3_140"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 140 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {141, GPA_HIDE_NAME("VGT3_141"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 141 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {142, GPA_HIDE_NAME("VGT3_142"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 142 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {143, GPA_HIDE_NAME("VGT3_143"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 143 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {144, GPA_HIDE_NAME("VGT3_144"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 144 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {145, GPA_HIDE_NAME("VGT3_145"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 145 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {146, GPA_HIDE_NAME("VGT3_146"), GPA_HIDE_NAME("VGT3"), GPA_HIDE_NAME("Counter 146 from group VGT3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
+    /// String pool of the vgt block for gfx8_baffin family
+    const char vgt_strings_gfx8_baffin[] = GPA_HIDE_NAME(
+        "\0"
+        "VGT#\0"
+        "VGT#_000\0"
+        "Counter 0 from group VGT#\0"
+        "VGT#_PERF_VGT_SPI_ESVERT_VALID\0"
+        "ES Vert is valid\0"
+        "VGT#_002\0"
+        "Counter 2 from group VGT#\0"
+        "VGT#_003\0"
+        "Counter 3 from group VGT#\0"
+        "VGT#_004\0"
+        "Counter 4 from group VGT#\0"
+        "VGT#_005\0"
+        "Counter 5 from group VGT#\0"
+        "VGT#_006\0"
+        "Counter 6 from group VGT#\0"
+        "VGT#_007\0"
+        "Counter 7 from group VGT#\0"
+        "VGT#_008\0"
+        "Counter 8 from group VGT#\0"
+        "VGT#_PERF_VGT_SPI_GSPRIM_VALID\0"
+        "ES GS Primitive send is active\0"
+        "VGT#_010\0"
+        "Counter 10 from group VGT#\0"
+        "VGT#_011\0"
+        "Counter 11 from group VGT#\0"
+        "VGT#_012\0"
+        "Counter 12 from group VGT#\0"
+        "VGT#_013\0"
+        "Counter 13 from group VGT#\0"
+        "VGT#_014\0"
+        "Counter 14 from group VGT#\0"
+        "VGT#_015\0"
+        "Counter 15 from group VGT#\0"
+        "VGT#_016\0"
+        "Counter 16 from group VGT#\0"
+        "VGT#_017\0"
+        "Counter 17 from group VGT#\0"
+        "VGT#_018\0"
+        "Counter 18 from group VGT#\0"
+        "VGT#_019\0"
+        "Counter 19 from group VGT#\0"
+        "VGT#_PERF_VGT_SPI_VSVERT_SEND\0"
+        "VS vert send\0"
+        "VGT#_021\0"
+        "Counter 21 from group VGT#\0"
+        "VGT#_022\0"
+        "Counter 22 from group VGT#\0"
+        "VGT#_023\0"
+        "Counter 23 from group VGT#\0"
+        "VGT#_024\0"
+        "Counter 24 from group VGT#\0"
+        "VGT#_025\0"
+        "Counter 25 from group VGT#\0"
+        "VGT#_026\0"
+        "Counter 26 from group VGT#\0"
+        "VGT#_027\0"
+        "Counter 27 from group VGT#\0"
+        "VGT#_028\0"
+        "Counter 28 from group VGT#\0"
+        "VGT#_029\0"
+        "Counter 29 from group VGT#\0"
+        "VGT#_030\0"
+        "Counter 30 from group VGT#\0"
+        "VGT#_031\0"
+        "Counter 31 from group VGT#\0"
+        "VGT#_032\0"
+        "Counter 32 from group VGT#\0"
+        "VGT#_033\0"
+        "Counter 33 from group VGT#\0"
+        "VGT#_034\0"
+        "Counter 34 from group VGT#\0"
+        "VGT#_035\0"
+        "Counter 35 from group VGT#\0"
+        "VGT#_036\0"
+        "Counter 36 from group VGT#\0"
+        "VGT#_037\0"
+        "Counter 37 from group VGT#\0"
+        "VGT#_038\0"
+        "Counter 38 from group VGT#\0"
+        "VGT#_039\0"
+        "Counter 39 from group VGT#\0"
+        "VGT#_040\0"
+        "Counter 40 from group VGT#\0"
+        "VGT#_041\0"
+        "Counter 41 from group VGT#\0"
+        "VGT#_042\0"
+        "Counter 42 from group VGT#\0"
+        "VGT#_043\0"
+        "Counter 43 from group VGT#\0"
+        "VGT#_044\0"
+        "Counter 44 from group VGT#\0"
+        "VGT#_045\0"
+        "Counter 45 from group VGT#\0"
+        "VGT#_046\0"
+        "Counter 46 from group VGT#\0"
+        "VGT#_047\0"
+        "Counter 47 from group VGT#\0"
+        "VGT#_048\0"
+        "Counter 48 from group VGT#\0"
+        "VGT#_049\0"
+        "Counter 49 from group VGT#\0"
+        "VGT#_050\0"
+        "Counter 50 from group VGT#\0"
+        "VGT#_051\0"
+        "Counter 51 from group VGT#\0"
+        "VGT#_052\0"
+        "Counter 52 from group VGT#\0"
+        "VGT#_053\0"
+        "Counter 53 from group VGT#\0"
+        "VGT#_054\0"
+        "Counter 54 from group VGT#\0"
+        "VGT#_055\0"
+        "Counter 55 from group VGT#\0"
+        "VGT#_056\0"
+        "Counter 56 from group VGT#\0"
+        "VGT#_057\0"
+        "Counter 57 from group VGT#\0"
+        "VGT#_058\0"
+        "Counter 58 from group VGT#\0"
+        "VGT#_059\0"
+        "Counter 59 from group VGT#\0"
+        "VGT#_060\0"
+        "Counter 60 from group VGT#\0"
+        "VGT#_061\0"
+        "Counter 61 from group VGT#\0"
+        "VGT#_062\0"
+        "Counter 62 from group VGT#\0"
+        "VGT#_063\0"
+        "Counter 63 from group VGT#\0"
+        "VGT#_064\0"
+        "Counter 64 from group VGT#\0"
+        "VGT#_065\0"
+        "Counter 65 from group VGT#\0"
+        "VGT#_066\0"
+        "Counter 66 from group VGT#\0"
+        "VGT#_067\0"
+        "Counter 67 from group VGT#\0"
+        "VGT#_068\0"
+        "Counter 68 from group VGT#\0"
+        "VGT#_069\0"
+        "Counter 69 from group VGT#\0"
+        "VGT#_070\0"
+        "Counter 70 from group VGT#\0"
+        "VGT#_071\0"
+        "Counter 71 from group VGT#\0"
+        "VGT#_072\0"
+        "Counter 72 from group VGT#\0"
+        "VGT#_073\0"
+        "Counter 73 from group VGT#\0"
+        "VGT#_074\0"
+        "Counter 74 from group VGT#\0"
+        "VGT#_075\0"
+        "Counter 75 from group VGT#\0"
+        "VGT#_076\0"
+        "Counter 76 from group VGT#\0"
+        "VGT#_077\0"
+        "Counter 77 from group VGT#\0"
+        "VGT#_078\0"
+        "Counter 78 from group VGT#\0"
+        "VGT#_079\0"
+        "Counter 79 from group VGT#\0"
+        "VGT#_080\0"
+        "Counter 80 from group VGT#\0"
+        "VGT#_081\0"
+        "Counter 81 from group VGT#\0"
+        "VGT#_082\0"
+        "Counter 82 from group VGT#\0"
+        "VGT#_083\0"
+        "Counter 83 from group VGT#\0"
+        "VGT#_084\0"
+        "Counter 84 from group VGT#\0"
+        "VGT#_085\0"
+        "Counter 85 from group VGT#\0"
+        "VGT#_086\0"
+        "Counter 86 from group VGT#\0"
+        "VGT#_087\0"
+        "Counter 87 from group VGT#\0"
+        "VGT#_088\0"
+        "Counter 88 from group VGT#\0"
+        "VGT#_089\0"
+        "Counter 89 from group VGT#\0"
+        "VGT#_090\0"
+        "Counter 90 from group VGT#\0"
+        "VGT#_091\0"
+        "Counter 91 from group VGT#\0"
+        "VGT#_092\0"
+        "Counter 92 from group VGT#\0"
+        "VGT#_093\0"
+        "Counter 93 from group VGT#\0"
+        "VGT#_094\0"
+        "Counter 94 from group VGT#\0"
+        "VGT#_095\0"
+        "Counter 95 from group VGT#\0"
+        "VGT#_PERF_VGT_SPI_LSVERT_VALID\0"
+        "LS Vert is valid. Sensitive to PERF_SEID_IGNORE_MASK\0"
+        "VGT#_097\0"
+        "Counter 97 from group VGT#\0"
+        "VGT#_098\0"
+        "Counter 98 from group VGT#\0"
+        "VGT#_099\0"
+        "Counter 99 from group VGT#\0"
+        "VGT#_100\0"
+        "Counter 100 from group VGT#\0"
+        "VGT#_101\0"
+        "Counter 101 from group VGT#\0"
+        "VGT#_102\0"
+        "Counter 102 from group VGT#\0"
+        "VGT#_103\0"
+        "Counter 103 from group VGT#\0"
+        "VGT#_104\0"
+        "Counter 104 from group VGT#\0"
+        "VGT#_PERF_VGT_SPI_HSVERT_VALID\0"
+        "HS Vert is valid. Sensitive to PERF_SEID_IGNORE_MASK\0"
+        "VGT#_106\0"
+        "Counter 106 from group VGT#\0"
+        "VGT#_107\0"
+        "Counter 107 from group VGT#\0"
+        "VGT#_108\0"
+        "Counter 108 from group VGT#\0"
+        "VGT#_109\0"
+        "Counter 109 from group VGT#\0"
+        "VGT#_110\0"
+        "Counter 110 from group VGT#\0"
+        "VGT#_111\0"
+        "Counter 111 from group VGT#\0"
+        "VGT#_112\0"
+        "Counter 112 from group VGT#\0"
+        "VGT#_113\0"
+        "Counter 113 from group VGT#\0"
+        "VGT#_114\0"
+        "Counter 114 from group VGT#\0"
+        "VGT#_115\0"
+        "Counter 115 from group VGT#\0"
+        "VGT#_116\0"
+        "Counter 116 from group VGT#\0"
+        "VGT#_117\0"
+        "Counter 117 from group VGT#\0"
+        "VGT#_118\0"
+        "Counter 118 from group VGT#\0"
+        "VGT#_119\0"
+        "Counter 119 from group VGT#\0"
+        "VGT#_120\0"
+        "Counter 120 from group VGT#\0"
+        "VGT#_121\0"
+        "Counter 121 from group VGT#\0"
+        "VGT#_122\0"
+        "Counter 122 from group VGT#\0"
+        "VGT#_123\0"
+        "Counter 123 from group VGT#\0"
+        "VGT#_124\0"
+        "Counter 124 from group VGT#\0"
+        "VGT#_PERF_VGT_TE11_BUSY\0"
+        "Counts number of cycles the TE11 block is busy. (DX11 Tessellation Fixed Function Logic)\0"
+        "VGT#_126\0"
+        "Counter 126 from group VGT#\0"
+        "VGT#_127\0"
+        "Counter 127 from group VGT#\0"
+        "VGT#_128\0"
+        "Counter 128 from group VGT#\0"
+        "VGT#_129\0"
+        "Counter 129 from group VGT#\0"
+        "VGT#_130\0"
+        "Counter 130 from group VGT#\0"
+        "VGT#_131\0"
+        "Counter 131 from group VGT#\0"
+        "VGT#_132\0"
+        "Counter 132 from group VGT#\0"
+        "VGT#_133\0"
+        "Counter 133 from group VGT#\0"
+        "VGT#_134\0"
+        "Counter 134 from group VGT#\0"
+        "VGT#_135\0"
+        "Counter 135 from group VGT#\0"
+        "VGT#_136\0"
+        "Counter 136 from group VGT#\0"
+        "VGT#_137\0"
+        "Counter 137 from group VGT#\0"
+        "VGT#_138\0"
+        "Counter 138 from group VGT#\0"
+        "VGT#_139\0"
+        "Counter 139 from group VGT#\0"
+        "VGT#_140\0"
+        "Counter 140 from group VGT#\0"
+        "VGT#_141\0"
+        "Counter 141 from group VGT#\0"
+        "VGT#_142\0"
+        "Counter 142 from group VGT#\0"
+        "VGT#_143\0"
+        "Counter 143 from group VGT#\0"
+        "VGT#_144\0"
+        "Counter 144 from group VGT#\0"
+        "VGT#_145\0"
+        "Counter 145 from group VGT#\0"
+        "VGT#_146\0"
+        "Counter 146 from group VGT#");
+
+    const GPA_HardwareBlockCounterDesc vgt_block_counters_gfx8_baffin[] = {
+        {GPA_HIDE_NAME_OFFSET(6), GPA_HIDE_NAME_OFFSET(15)},
+        {GPA_HIDE_NAME_OFFSET(41), GPA_HIDE_NAME_OFFSET(72)},
+        {GPA_HIDE_NAME_OFFSET(89), GPA_HIDE_NAME_OFFSET(98)},
+        {GPA_HIDE_NAME_OFFSET(124), GPA_HIDE_NAME_OFFSET(133)},
+        {GPA_HIDE_NAME_OFFSET(159), GPA_HIDE_NAME_OFFSET(168)},
+        {GPA_HIDE_NAME_OFFSET(194), GPA_HIDE_NAME_OFFSET(203)},
+        {GPA_HIDE_NAME_OFFSET(229), GPA_HIDE_NAME_OFFSET(238)},
+        {GPA_HIDE_NAME_OFFSET(264), GPA_HIDE_NAME_OFFSET(273)},
+        {GPA_HIDE_NAME_OFFSET(299), GPA_HIDE_NAME_OFFSET(308)},
+        {GPA_HIDE_NAME_OFFSET(334), GPA_HIDE_NAME_OFFSET(365)},
+        {GPA_HIDE_NAME_OFFSET(396), GPA_HIDE_NAME_OFFSET(405)},
+        {GPA_HIDE_NAME_OFFSET(432), GPA_HIDE_NAME_OFFSET(441)},
+        {GPA_HIDE_NAME_OFFSET(468), GPA_HIDE_NAME_OFFSET(477)},
+        {GPA_HIDE_NAME_OFFSET(504), GPA_HIDE_NAME_OFFSET(513)},
+        {GPA_HIDE_NAME_OFFSET(540), GPA_HIDE_NAME_OFFSET(549)},
+        {GPA_HIDE_NAME_OFFSET(576), GPA_HIDE_NAME_OFFSET(585)},
+        {GPA_HIDE_NAME_OFFSET(612), GPA_HIDE_NAME_OFFSET(621)},
+        {GPA_HIDE_NAME_OFFSET(648), GPA_HIDE_NAME_OFFSET(657)},
+        {GPA_HIDE_NAME_OFFSET(684), GPA_HIDE_NAME_OFFSET(693)},
+        {GPA_HIDE_NAME_OFFSET(720), GPA_HIDE_NAME_OFFSET(729)},
+        {GPA_HIDE_NAME_OFFSET(756), GPA_HIDE_NAME_OFFSET(786)},
+        {GPA_HIDE_NAME_OFFSET(799), GPA_HIDE_NAME_OFFSET(808)},
+        {GPA_HIDE_NAME_OFFSET(835), GPA_HIDE_NAME_OFFSET(844)},
+        {GPA_HIDE_NAME_OFFSET(871), GPA_HIDE_NAME_OFFSET(880)},
+        {GPA_HIDE_NAME_OFFSET(907), GPA_HIDE_NAME_OFFSET(916)},
+        {GPA_HIDE_NAME_OFFSET(943), GPA_HIDE_NAME_OFFSET(952)},
+        {GPA_HIDE_NAME_OFFSET(979), GPA_HIDE_NAME_OFFSET(988)},
+        {GPA_HIDE_NAME_OFFSET(1015), GPA_HIDE_NAME_OFFSET(1024)},
+        {GPA_HIDE_NAME_OFFSET(1051), GPA_HIDE_NAME_OFFSET(1060)},
+        {GPA_HIDE_NAME_OFFSET(1087), GPA_HIDE_NAME_OFFSET(1096)},
+        {GPA_HIDE_NAME_OFFSET(1123), GPA_HIDE_NAME_OFFSET(1132)},
+        {GPA_HIDE_NAME_OFFSET(1159), GPA_HIDE_NAME_OFFSET(1168)},
+        {GPA_HIDE_NAME_OFFSET(1195), GPA_HIDE_NAME_OFFSET(1204)},
+        {GPA_HIDE_NAME_OFFSET(1231), GPA_HIDE_NAME_OFFSET(1240)},
+        {GPA_HIDE_NAME_OFFSET(1267), GPA_HIDE_NAME_OFFSET(1276)},
+        {GPA_HIDE_NAME_OFFSET(1303), GPA_HIDE_NAME_OFFSET(1312)},
+        {GPA_HIDE_NAME_OFFSET(1339), GPA_HIDE_NAME_OFFSET(1348)},
+        {GPA_HIDE_NAME_OFFSET(1375), GPA_HIDE_NAME_OFFSET(1384)},
+        {GPA_HIDE_NAME_OFFSET(1411), GPA_HIDE_NAME_OFFSET(1420)},
+        {GPA_HIDE_NAME_OFFSET(1447), GPA_HIDE_NAME_OFFSET(1456)},
+        {GPA_HIDE_NAME_OFFSET(1483), GPA_HIDE_NAME_OFFSET(1492)},
+        {GPA_HIDE_NAME_OFFSET(1519), GPA_HIDE_NAME_OFFSET(1528)},
+        {GPA_HIDE_NAME_OFFSET(1555), GPA_HIDE_NAME_OFFSET(1564)},
+        {GPA_HIDE_NAME_OFFSET(1591), GPA_HIDE_NAME_OFFSET(1600)},
+        {GPA_HIDE_NAME_OFFSET(1627), GPA_HIDE_NAME_OFFSET(1636)},
+        {GPA_HIDE_NAME_OFFSET(1663), GPA_HIDE_NAME_OFFSET(1672)},
+        {GPA_HIDE_NAME_OFFSET(1699), GPA_HIDE_NAME_OFFSET(1708)},
+        {GPA_HIDE_NAME_OFFSET(1735), GPA_HIDE_NAME_OFFSET(1744)},
+        {GPA_HIDE_NAME_OFFSET(1771), GPA_HIDE_NAME_OFFSET(1780)},
+        {GPA_HIDE_NAME_OFFSET(1807), GPA_HIDE_NAME_OFFSET(1816)},
+        {GPA_HIDE_NAME_OFFSET(1843), GPA_HIDE_NAME_OFFSET(1852)},
+        {GPA_HIDE_NAME_OFFSET(1879), GPA_HIDE_NAME_OFFSET(1888)},
+        {GPA_HIDE_NAME_OFFSET(1915), GPA_HIDE_NAME_OFFSET(1924)},
+        {GPA_HIDE_NAME_OFFSET(1951), GPA_HIDE_NAME_OFFSET(1960)},
+        {GPA_HIDE_NAME_OFFSET(1987), GPA_HIDE_NAME_OFFSET(1996)},
+        {GPA_HIDE_NAME_OFFSET(2023), GPA_HIDE_NAME_OFFSET(2032)},
+        {GPA_HIDE_NAME_OFFSET(2059), GPA_HIDE_NAME_OFFSET(2068)},
+        {GPA_HIDE_NAME_OFFSET(2095), GPA_HIDE_NAME_OFFSET(2104)},
+        {GPA_HIDE_NAME_OFFSET(2131), GPA_HIDE_NAME_OFFSET(2140)},
+        {GPA_HIDE_NAME_OFFSET(2167), GPA_HIDE_NAME_OFFSET(2176)},
+        {GPA_HIDE_NAME_OFFSET(2203), GPA_HIDE_NAME_OFFSET(2212)},
+        {GPA_HIDE_NAME_OFFSET(2239), GPA_HIDE_NAME_OFFSET(2248)},
+        {GPA_HIDE_NAME_OFFSET(2275), GPA_HIDE_NAME_OFFSET(2284)},
+        {GPA_HIDE_NAME_OFFSET(2311), GPA_HIDE_NAME_OFFSET(2320)},
+        {GPA_HIDE_NAME_OFFSET(2347), GPA_HIDE_NAME_OFFSET(2356)},
+        {GPA_HIDE_NAME_OFFSET(2383), GPA_HIDE_NAME_OFFSET(2392)},
+        {GPA_HIDE_NAME_OFFSET(2419), GPA_HIDE_NAME_OFFSET(2428)},
+        {GPA_HIDE_NAME_OFFSET(2455), GPA_HIDE_NAME_OFFSET(2464)},
+        {GPA_HIDE_NAME_OFFSET(2491), GPA_HIDE_NAME_OFFSET(2500)},
+        {GPA_HIDE_NAME_OFFSET(2527), GPA_HIDE_NAME_OFFSET(2536)},
+        {GPA_HIDE_NAME_OFFSET(2563), GPA_HIDE_NAME_OFFSET(2572)},
+        {GPA_HIDE_NAME_OFFSET(2599), GPA_HIDE_NAME_OFFSET(2608)},
+        {GPA_HIDE_NAME_OFFSET(2635), GPA_HIDE_NAME_OFFSET(2644)},
+        {GPA_HIDE_NAME_OFFSET(2671), GPA_HIDE_NAME_OFFSET(2680)},
+        {GPA_HIDE_NAME_OFFSET(2707), GPA_HIDE_NAME_OFFSET(2716)},
+        {GPA_HIDE_NAME_OFFSET(2743), GPA_HIDE_NAME_OFFSET(2752)},
+        {GPA_HIDE_NAME_OFFSET(2779), GPA_HIDE_NAME_OFFSET(2788)},
+        {GPA_HIDE_NAME_OFFSET(2815), GPA_HIDE_NAME_OFFSET(2824)},
+        {GPA_HIDE_NAME_OFFSET(2851), GPA_HIDE_NAME_OFFSET(2860)},
+        {GPA_HIDE_NAME_OFFSET(2887), GPA_HIDE_NAME_OFFSET(2896)},
+        {GPA_HIDE_NAME_OFFSET(2923), GPA_HIDE_NAME_OFFSET(2932)},
+        {GPA_HIDE_NAME_OFFSET(2959), GPA_HIDE_NAME_OFFSET(2968)},
+        {GPA_HIDE_NAME_OFFSET(2995), GPA_HIDE_NAME_OFFSET(3004)},
+        {GPA_HIDE_NAME_OFFSET(3031), GPA_HIDE_NAME_OFFSET(3040)},
+        {GPA_HIDE_NAME_OFFSET(3067), GPA_HIDE_NAME_OFFSET(3076)},
+        {GPA_HIDE_NAME_OFFSET(3103), GPA_HIDE_NAME_OFFSET(3112)},
+        {GPA_HIDE_NAME_OFFSET(3139), GPA_HIDE_NAME_OFFSET(3148)},
+        {GPA_HIDE_NAME_OFFSET(3175), GPA_HIDE_NAME_OFFSET(3184)},
+        {GPA_HIDE_NAME_OFFSET(3211), GPA_HIDE_NAME_OFFSET(3220)},
+        {GPA_HIDE_NAME_OFFSET(3247), GPA_HIDE_NAME_OFFSET(3256)},
+        {GPA_HIDE_NAME_OFFSET(3283), GPA_HIDE_NAME_OFFSET(3292)},
+        {GPA_HIDE_NAME_OFFSET(3319), GPA_HIDE_NAME_OFFSET(3328)},
+        {GPA_HIDE_NAME_OFFSET(3355), GPA_HIDE_NAME_OFFSET(3364)},
+        {GPA_HIDE_NAME_OFFSET(3391), GPA_HIDE_NAME_OFFSET(3400)},
+        {GPA_HIDE_NAME_OFFSET(3427), GPA_HIDE_NAME_OFFSET(3436)},
+        {GPA_HIDE_NAME_OFFSET(3463), GPA_HIDE_NAME_OFFSET(3472)},
+        {GPA_HIDE_NAME_OFFSET(3499), GPA_HIDE_NAME_OFFSET(3530)},
+        {GPA_HIDE_NAME_OFFSET(3583), GPA_HIDE_NAME_OFFSET(3592)},
+        {GPA_HIDE_NAME_OFFSET(3619), GPA_HIDE_NAME_OFFSET(3628)},
+        {GPA_HIDE_NAME_OFFSET(3655), GPA_HIDE_NAME_OFFSET(3664)},
+        {GPA_HIDE_NAME_OFFSET(3691), GPA_HIDE_NAME_OFFSET(3700)},
+        {GPA_HIDE_NAME_OFFSET(3728), GPA_HIDE_NAME_OFFSET(3737)},
+        {GPA_HIDE_NAME_OFFSET(3765), GPA_HIDE_NAME_OFFSET(3774)},
+        {GPA_HIDE_NAME_OFFSET(3802), GPA_HIDE_NAME_OFFSET(3811)},
+        {GPA_HIDE_NAME_OFFSET(3839), GPA_HIDE_NAME_OFFSET(3848)},
+        {GPA_HIDE_NAME_OFFSET(3876), GPA_HIDE_NAME_OFFSET(3907)},
+        {GPA_HIDE_NAME_OFFSET(3960), GPA_HIDE_NAME_OFFSET(3969)},
+        {GPA_HIDE_NAME_OFFSET(3997), GPA_HIDE_NAME_OFFSET(4006)},
+        {GPA_HIDE_NAME_OFFSET(4034), GPA_HIDE_NAME_OFFSET(4043)},
+        {GPA_HIDE_NAME_OFFSET(4071), GPA_HIDE_NAME_OFFSET(4080)},
+        {GPA_HIDE_NAME_OFFSET(4108), GPA_HIDE_NAME_OFFSET(4117)},
+        {GPA_HIDE_NAME_OFFSET(4145), GPA_HIDE_NAME_OFFSET(4154)},
+        {GPA_HIDE_NAME_OFFSET(4182), GPA_HIDE_NAME_OFFSET(4191)},
+        {GPA_HIDE_NAME_OFFSET(4219), GPA_HIDE_NAME_OFFSET(4228)},
+        {GPA_HIDE_NAME_OFFSET(4256), GPA_HIDE_NAME_OFFSET(4265)},
+        {GPA_HIDE_NAME_OFFSET(4293), GPA_HIDE_NAME_OFFSET(4302)},
+        {GPA_HIDE_NAME_OFFSET(4330), GPA_HIDE_NAME_OFFSET(4339)},
+        {GPA_HIDE_NAME_OFFSET(4367), GPA_HIDE_NAME_OFFSET(4376)},
+        {GPA_HIDE_NAME_OFFSET(4404), GPA_HIDE_NAME_OFFSET(4413)},
+        {GPA_HIDE_NAME_OFFSET(4441), GPA_HIDE_NAME_OFFSET(4450)},
+        {GPA_HIDE_NAME_OFFSET(4478), GPA_HIDE_NAME_OFFSET(4487)},
+        {GPA_HIDE_NAME_OFFSET(4515), GPA_HIDE_NAME_OFFSET(4524)},
+        {GPA_HIDE_NAME_OFFSET(4552), GPA_HIDE_NAME_OFFSET(4561)},
+        {GPA_HIDE_NAME_OFFSET(4589), GPA_HIDE_NAME_OFFSET(4598)},
+        {GPA_HIDE_NAME_OFFSET(4626), GPA_HIDE_NAME_OFFSET(4635)},
+        {GPA_HIDE_NAME_OFFSET(4663), GPA_HIDE_NAME_OFFSET(4687)},
+        {GPA_HIDE_NAME_OFFSET(4776), GPA_HIDE_NAME_OFFSET(4785)},
+        {GPA_HIDE_NAME_OFFSET(4813), GPA_HIDE_NAME_OFFSET(4822)},
+        {GPA_HIDE_NAME_OFFSET(4850), GPA_HIDE_NAME_OFFSET(4859)},
+        {GPA_HIDE_NAME_OFFSET(4887), GPA_HIDE_NAME_OFFSET(4896)},
+        {GPA_HIDE_NAME_OFFSET(4924), GPA_HIDE_NAME_OFFSET(4933)},
+        {GPA_HIDE_NAME_OFFSET(4961), GPA_HIDE_NAME_OFFSET(4970)},
+        {GPA_HIDE_NAME_OFFSET(4998), GPA_HIDE_NAME_OFFSET(5007)},
+        {GPA_HIDE_NAME_OFFSET(5035), GPA_HIDE_NAME_OFFSET(5044)},
+        {GPA_HIDE_NAME_OFFSET(5072), GPA_HIDE_NAME_OFFSET(5081)},
+        {GPA_HIDE_NAME_OFFSET(5109), GPA_HIDE_NAME_OFFSET(5118)},
+        {GPA_HIDE_NAME_OFFSET(5146), GPA_HIDE_NAME_OFFSET(5155)},
+        {GPA_HIDE_NAME_OFFSET(5183), GPA_HIDE_NAME_OFFSET(5192)},
+        {GPA_HIDE_NAME_OFFSET(5220), GPA_HIDE_NAME_OFFSET(5229)},
+        {GPA_HIDE_NAME_OFFSET(5257), GPA_HIDE_NAME_OFFSET(5266)},
+        {GPA_HIDE_NAME_OFFSET(5294), GPA_HIDE_NAME_OFFSET(5303)},
+        {GPA_HIDE_NAME_OFFSET(5331), GPA_HIDE_NAME_OFFSET(5340)},
+        {GPA_HIDE_NAME_OFFSET(5368), GPA_HIDE_NAME_OFFSET(5377)},
+        {GPA_HIDE_NAME_OFFSET(5405), GPA_HIDE_NAME_OFFSET(5414)},
+        {GPA_HIDE_NAME_OFFSET(5442), GPA_HIDE_NAME_OFFSET(5451)},
+        {GPA_HIDE_NAME_OFFSET(5479), GPA_HIDE_NAME_OFFSET(5488)},
+        {GPA_HIDE_NAME_OFFSET(5516), GPA_HIDE_NAME_OFFSET(5525)},
     };
+
+    const GPA_HardwareBlockDesc vgt_block_gfx8_baffin = {vgt_strings_gfx8_baffin, GPA_HIDE_NAME_OFFSET(1), 4, 147, vgt_block_counters_gfx8_baffin};
 } // countergfx8baffin
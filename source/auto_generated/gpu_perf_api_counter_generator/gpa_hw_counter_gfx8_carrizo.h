@@ -13,6 +13,7 @@
 #include <set>
 
 struct GPA_HardwareCounterDesc;
+struct GPA_HardwareBlockDesc;
 #include "gpa_hw_counter_gfx8.h"
 
 namespace countergfx8carrizo
@@ -32,20 +33,16 @@ inline bool MatchAsic(GDT_HW_ASIC_TYPE asic_type)
     return true;
 }
 
-    extern GPA_HardwareCounterDesc vgt0_counters_gfx8_carrizo[]; ///< Array of internal counters for vgt0 block for gfx8_carrizo family
-    extern GPA_HardwareCounterDesc vgt1_counters_gfx8_carrizo[]; ///< Array of internal counters for vgt1 block for gfx8_carrizo family
-    extern GPA_HardwareCounterDesc vgt2_counters_gfx8_carrizo[]; ///< Array of internal counters for vgt2 block for gfx8_carrizo family
-    extern GPA_HardwareCounterDesc vgt3_counters_gfx8_carrizo[]; ///< Array of internal counters for vgt3 block for gfx8_carrizo family
+    extern const GPA_HardwareBlockDesc vgt_block_gfx8_carrizo; ///< Internal counters of the vgt block for gfx8_carrizo family, shared by its 4 instances
 
-/// Replaces count number of block instance counters at the destination with the overriding source counters.
-/// \param dest_counter Destination to update.
-/// \param src_counter Source to update from.
-/// \param count Number of counters to update.
-inline void ReplaceBlockInstanceCounters(GPA_HardwareCounterDesc* dest_counter, GPA_HardwareCounterDesc* src_counter, uint32_t count)
+/// Replaces the counters of every instance of a block with the overriding counters of the block.
+/// \param dest_instances Destination counters of each block instance to update.
+/// \param block Block to update from.
+inline void ReplaceBlockInstanceCounters(GPA_HardwareCounterDesc* const* dest_instances, const GPA_HardwareBlockDesc& block)
 {
-    for (uint32_t i = 0; i < count; i++)
+    for (uint32_t i = 0; i < block.m_numInstances; i++)
     {
-        dest_counter[i] = src_counter[i];
+        ExpandHardwareBlockCounters(block, dest_instances[i]);
     }
 }
 
@@ -59,10 +56,13 @@ inline bool OverrideBlockInstanceCounters(GDT_HW_ASIC_TYPE asic_type)
         return false;
     }
 
-    ReplaceBlockInstanceCounters(countergfx8::vgt0_counters_gfx8, vgt0_counters_gfx8_carrizo, 146);
-    ReplaceBlockInstanceCounters(countergfx8::vgt1_counters_gfx8, vgt1_counters_gfx8_carrizo, 146);
-    ReplaceBlockInstanceCounters(countergfx8::vgt2_counters_gfx8, vgt2_counters_gfx8_carrizo, 146);
-    ReplaceBlockInstanceCounters(countergfx8::vgt3_counters_gfx8, vgt3_counters_gfx8_carrizo, 146);
+    GPA_HardwareCounterDesc* const vgt_instances[] = {
+        countergfx8::vgt0_counters_gfx8,
+        countergfx8::vgt1_counters_gfx8,
+        countergfx8::vgt2_counters_gfx8,
+        countergfx8::vgt3_counters_gfx8,
+    };
+    ReplaceBlockInstanceCounters(vgt_instances, vgt_block_gfx8_carrizo);
 
     return true;
 }
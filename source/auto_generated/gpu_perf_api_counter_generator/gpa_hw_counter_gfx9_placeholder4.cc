@@ -14,4818 +14,2914 @@
 
 namespace countergfx9placeholder4
 {
-    GPA_HardwareCounterDesc pa_su0_counters_gfx9_placeholder4[] = {
-        {0, GPA_HIDE_NAME("PA_SU0_000"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 0 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {1, GPA_HIDE_NAME("PA_SU0_001"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 1 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {2, GPA_HIDE_NAME("PA_SU0_002"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 2 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {3, GPA_HIDE_NAME("PA_SU0_003"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 3 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {4, GPA_HIDE_NAME("PA_SU0_004"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 4 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {5, GPA_HIDE_NAME("PA_SU0_005"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 5 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {6, GPA_HIDE_NAME("PA_SU0_006"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 6 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {7, GPA_HIDE_NAME("PA_SU0_007"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 7 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {8, GPA_HIDE_NAME("PA_SU0_PERF_PAPC_PA_INPUT_PRIM"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("PERF_PAPC_PA_INPUT_PRIM Number of Primitives input to PA; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {9, GPA_HIDE_NAME("PA_SU0_009"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 9 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {10, GPA_HIDE_NAME("PA_SU0_010"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 10 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {11, GPA_HIDE_NAME("PA_SU0_011"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 11 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {12, GPA_HIDE_NAME("PA_SU0_012"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 12 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {13, GPA_HIDE_NAME("PA_SU0_013"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 13 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {14, GPA_HIDE_NAME("PA_SU0_PERF_PAPC_CLPR_CULL_PRIM"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("PERF_PAPC_CLPR_CULL_PRIM Number of Prims Culled by Clipper for VV, UCP, VTX_KILL, VTX_NAN; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; combined with _CLPR_VVUCP_CULL_PRIM , _CLPR_VV_CULL_PRIM, _VV_CULL_PRIM ,_UCP_CULL_PRIM, _VTX_KILL_CULL_PRIM, _VTX_NAN_CULL_PRIM"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {15, GPA_HIDE_NAME("PA_SU0_015"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 15 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {16, GPA_HIDE_NAME("PA_SU0_016"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 16 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {17, GPA_HIDE_NAME("PA_SU0_017"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 17 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {18, GPA_HIDE_NAME("PA_SU0_018"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 18 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {19, GPA_HIDE_NAME("PA_SU0_019"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 19 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {20, GPA_HIDE_NAME("PA_SU0_020"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 20 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {21, GPA_HIDE_NAME("PA_SU0_PERF_PAPC_CLPR_VVUCP_CLIP_PRIM"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("PERF_PAPC_CLPR_VVUCP_CLIP_PRIM Number of Prims Clipped by Clipper for VV and/or UCP; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {22, GPA_HIDE_NAME("PA_SU0_022"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 22 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {23, GPA_HIDE_NAME("PA_SU0_023"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 23 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {24, GPA_HIDE_NAME("PA_SU0_024"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 24 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {25, GPA_HIDE_NAME("PA_SU0_025"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 25 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {26, GPA_HIDE_NAME("PA_SU0_026"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 26 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {27, GPA_HIDE_NAME("PA_SU0_027"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 27 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {28, GPA_HIDE_NAME("PA_SU0_028"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 28 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {29, GPA_HIDE_NAME("PA_SU0_029"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 29 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {30, GPA_HIDE_NAME("PA_SU0_030"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 30 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {31, GPA_HIDE_NAME("PA_SU0_031"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 31 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {32, GPA_HIDE_NAME("PA_SU0_032"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 32 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {33, GPA_HIDE_NAME("PA_SU0_033"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 33 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {34, GPA_HIDE_NAME("PA_SU0_034"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 34 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {35, GPA_HIDE_NAME("PA_SU0_035"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 35 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {36, GPA_HIDE_NAME("PA_SU0_036"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 36 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {37, GPA_HIDE_NAME("PA_SU0_037"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 37 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {38, GPA_HIDE_NAME("PA_SU0_038"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 38 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {39, GPA_HIDE_NAME("PA_SU0_039"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 39 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {40, GPA_HIDE_NAME("PA_SU0_040"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 40 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {41, GPA_HIDE_NAME("PA_SU0_041"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 41 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {42, GPA_HIDE_NAME("PA_SU0_042"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 42 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {43, GPA_HIDE_NAME("PA_SU0_043"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 43 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {44, GPA_HIDE_NAME("PA_SU0_044"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 44 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {45, GPA_HIDE_NAME("PA_SU0_045"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 45 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {46, GPA_HIDE_NAME("PA_SU0_046"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 46 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {47, GPA_HIDE_NAME("PA_SU0_047"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 47 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {48, GPA_HIDE_NAME("PA_SU0_048"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 48 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {49, GPA_HIDE_NAME("PA_SU0_049"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 49 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {50, GPA_HIDE_NAME("PA_SU0_050"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 50 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {51, GPA_HIDE_NAME("PA_SU0_051"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 51 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {52, GPA_HIDE_NAME("PA_SU0_052"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 52 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {53, GPA_HIDE_NAME("PA_SU0_053"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 53 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {54, GPA_HIDE_NAME("PA_SU0_PERF_PAPC_SU_ZERO_AREA_CULL_PRIM"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("PERF_PAPC_SU_ZERO_AREA_CULL_PRIM Number of primitives culled due to zero area; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {55, GPA_HIDE_NAME("PA_SU0_PERF_PAPC_SU_BACK_FACE_CULL_PRIM"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("PERF_PAPC_SU_BACK_FACE_CULL_PRIM Number of back-face primitives culled due to facedness; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {56, GPA_HIDE_NAME("PA_SU0_PERF_PAPC_SU_FRONT_FACE_CULL_PRIM"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("PERF_PAPC_SU_FRONT_FACE_CULL_PRIM Number of front-face primitives culled due to facedness; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {57, GPA_HIDE_NAME("PA_SU0_PERF_PAPC_SU_POLYMODE_FACE_CULL"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("PERF_PAPC_SU_POLYMODE_FACE_CULL Number of polymode cull-determination primitives culled; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {58, GPA_HIDE_NAME("PA_SU0_058"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 58 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {59, GPA_HIDE_NAME("PA_SU0_059"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 59 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {60, GPA_HIDE_NAME("PA_SU0_060"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 60 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {61, GPA_HIDE_NAME("PA_SU0_PERF_PAPC_SU_OUTPUT_PRIM"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("PERF_PAPC_SU_OUTPUT_PRIM Number of primitives output from the Setup block; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {62, GPA_HIDE_NAME("PA_SU0_PERF_PAPC_SU_OUTPUT_CLIP_PRIM"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("PERF_PAPC_SU_OUTPUT_CLIP_PRIM Number of clipped primitives output from the Setup block; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {63, GPA_HIDE_NAME("PA_SU0_063"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 63 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {64, GPA_HIDE_NAME("PA_SU0_064"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 64 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {65, GPA_HIDE_NAME("PA_SU0_065"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 65 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {66, GPA_HIDE_NAME("PA_SU0_066"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 66 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {67, GPA_HIDE_NAME("PA_SU0_067"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 67 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {68, GPA_HIDE_NAME("PA_SU0_068"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 68 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {69, GPA_HIDE_NAME("PA_SU0_069"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 69 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {70, GPA_HIDE_NAME("PA_SU0_070"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 70 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {71, GPA_HIDE_NAME("PA_SU0_071"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 71 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {72, GPA_HIDE_NAME("PA_SU0_072"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 72 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {73, GPA_HIDE_NAME("PA_SU0_PERF_PAPC_SU_OUTPUT_PRIM_DUAL"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("PERF_PAPC_SU_OUTPUT_PRIM_DUAL Number of dual gradient primitives output from the Setup block; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {74, GPA_HIDE_NAME("PA_SU0_PERF_PAPC_SU_OUTPUT_CLIP_PRIM_DUAL"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("PERF_PAPC_SU_OUTPUT_CLIP_PRIM_DUAL Number of dual gradient clipped primitives output from the Setup block; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {75, GPA_HIDE_NAME("PA_SU0_075"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 75 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {76, GPA_HIDE_NAME("PA_SU0_076"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 76 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {77, GPA_HIDE_NAME("PA_SU0_077"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 77 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {78, GPA_HIDE_NAME("PA_SU0_078"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 78 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {79, GPA_HIDE_NAME("PA_SU0_079"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 79 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {80, GPA_HIDE_NAME("PA_SU0_080"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 80 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {81, GPA_HIDE_NAME("PA_SU0_081"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 81 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {82, GPA_HIDE_NAME("PA_SU0_082"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 82 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {83, GPA_HIDE_NAME("PA_SU0_083"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 83 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {84, GPA_HIDE_NAME("PA_SU0_084"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 84 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {85, GPA_HIDE_NAME("PA_SU0_085"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 85 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {86, GPA_HIDE_NAME("PA_SU0_086"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 86 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {87, GPA_HIDE_NAME("PA_SU0_087"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 87 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {88, GPA_HIDE_NAME("PA_SU0_088"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 88 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {89, GPA_HIDE_NAME("PA_SU0_089"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 89 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {90, GPA_HIDE_NAME("PA_SU0_090"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 90 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {91, GPA_HIDE_NAME("PA_SU0_091"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 91 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {92, GPA_HIDE_NAME("PA_SU0_092"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 92 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {93, GPA_HIDE_NAME("PA_SU0_093"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 93 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {94, GPA_HIDE_NAME("PA_SU0_094"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 94 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {95, GPA_HIDE_NAME("PA_SU0_095"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 95 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {96, GPA_HIDE_NAME("PA_SU0_096"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 96 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {97, GPA_HIDE_NAME("PA_SU0_097"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 97 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {98, GPA_HIDE_NAME("PA_SU0_098"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 98 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {99, GPA_HIDE_NAME("PA_SU0_099"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 99 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {100, GPA_HIDE_NAME("PA_SU0_100"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 100 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {101, GPA_HIDE_NAME("PA_SU0_101"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 101 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {102, GPA_HIDE_NAME("PA_SU0_102"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 102 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {103, GPA_HIDE_NAME("PA_SU0_103"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 103 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {104, GPA_HIDE_NAME("PA_SU0_104"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 104 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {105, GPA_HIDE_NAME("PA_SU0_PERF_PAPC_CLIP_BUSY"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("PERF_PAPC_CLIP_BUSY Number of clocks Clip is Busy; range-1/clk;it can potentially be used to detect bad performance;all instances report the same result; can be used to detect bottlenecks in combination with other signals"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {106, GPA_HIDE_NAME("PA_SU0_106"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 106 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {107, GPA_HIDE_NAME("PA_SU0_107"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 107 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {108, GPA_HIDE_NAME("PA_SU0_108"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 108 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {109, GPA_HIDE_NAME("PA_SU0_PERF_PAPC_SU_STALLED_SC"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("PERF_PAPC_SU_STALLED_SC Number of clocks Setup is stalled by SC; range-1/clk;it can potentially be used to detect bad performance;all instances report the same result"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {110, GPA_HIDE_NAME("PA_SU0_110"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 110 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {111, GPA_HIDE_NAME("PA_SU0_111"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 111 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {112, GPA_HIDE_NAME("PA_SU0_112"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 112 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {113, GPA_HIDE_NAME("PA_SU0_113"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 113 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {114, GPA_HIDE_NAME("PA_SU0_114"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 114 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {115, GPA_HIDE_NAME("PA_SU0_115"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 115 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {116, GPA_HIDE_NAME("PA_SU0_116"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 116 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {117, GPA_HIDE_NAME("PA_SU0_117"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 117 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {118, GPA_HIDE_NAME("PA_SU0_118"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 118 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {119, GPA_HIDE_NAME("PA_SU0_119"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 119 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {120, GPA_HIDE_NAME("PA_SU0_120"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 120 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {121, GPA_HIDE_NAME("PA_SU0_121"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 121 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {122, GPA_HIDE_NAME("PA_SU0_122"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 122 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {123, GPA_HIDE_NAME("PA_SU0_123"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 123 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {124, GPA_HIDE_NAME("PA_SU0_124"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 124 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {125, GPA_HIDE_NAME("PA_SU0_125"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 125 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {126, GPA_HIDE_NAME("PA_SU0_126"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 126 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {127, GPA_HIDE_NAME("PA_SU0_127"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 127 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {128, GPA_HIDE_NAME("PA_SU0_128"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 128 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {129, GPA_HIDE_NAME("PA_SU0_129"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 129 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {130, GPA_HIDE_NAME("PA_SU0_130"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 130 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {131, GPA_HIDE_NAME("PA_SU0_131"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 131 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {132, GPA_HIDE_NAME("PA_SU0_132"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 132 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {133, GPA_HIDE_NAME("PA_SU0_133"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 133 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {134, GPA_HIDE_NAME("PA_SU0_134"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 134 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {135, GPA_HIDE_NAME("PA_SU0_135"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 135 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {136, GPA_HIDE_NAME("PA_SU0_136"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 136 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {137, GPA_HIDE_NAME("PA_SU0_137"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 137 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {138, GPA_HIDE_NAME("PA_SU0_138"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 138 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {139, GPA_HIDE_NAME("PA_SU0_139"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 139 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {140, GPA_HIDE_NAME("PA_SU0_140"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 140 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {141, GPA_HIDE_NAME("PA_SU0_141"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 141 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {142, GPA_HIDE_NAME("PA_SU0_142"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 142 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {143, GPA_HIDE_NAME("PA_SU0_143"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 143 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {144, GPA_HIDE_NAME("PA_SU0_144"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 144 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {145, GPA_HIDE_NAME("PA_SU0_145"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 145 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {146, GPA_HIDE_NAME("PA_SU0_146"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 146 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {147, GPA_HIDE_NAME("PA_SU0_147"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 147 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {148, GPA_HIDE_NAME("PA_SU0_148"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 148 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {149, GPA_HIDE_NAME("PA_SU0_149"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 149 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {150, GPA_HIDE_NAME("PA_SU0_150"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 150 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {151, GPA_HIDE_NAME("PA_SU0_151"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 151 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {152, GPA_HIDE_NAME("PA_SU0_152"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 152 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {153, GPA_HIDE_NAME("PA_SU0_153"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 153 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {154, GPA_HIDE_NAME("PA_SU0_154"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 154 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {155, GPA_HIDE_NAME("PA_SU0_155"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 155 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {156, GPA_HIDE_NAME("PA_SU0_156"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 156 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {157, GPA_HIDE_NAME("PA_SU0_157"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 157 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {158, GPA_HIDE_NAME("PA_SU0_158"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 158 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {159, GPA_HIDE_NAME("PA_SU0_159"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 159 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {160, GPA_HIDE_NAME("PA_SU0_160"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 160 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {161, GPA_HIDE_NAME("PA_SU0_161"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 161 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {162, GPA_HIDE_NAME("PA_SU0_162"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 162 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {163, GPA_HIDE_NAME("PA_SU0_163"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 163 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {164, GPA_HIDE_NAME("PA_SU0_164"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 164 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {165, GPA_HIDE_NAME("PA_SU0_165"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 165 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {166, GPA_HIDE_NAME("PA_SU0_166"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 166 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {167, GPA_HIDE_NAME("PA_SU0_167"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 167 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {168, GPA_HIDE_NAME("PA_SU0_168"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 168 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {169, GPA_HIDE_NAME("PA_SU0_169"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 169 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {170, GPA_HIDE_NAME("PA_SU0_170"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 170 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {171, GPA_HIDE_NAME("PA_SU0_171"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 171 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {172, GPA_HIDE_NAME("PA_SU0_172"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 172 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {173, GPA_HIDE_NAME("PA_SU0_173"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 173 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {174, GPA_HIDE_NAME("PA_SU0_174"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 174 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {175, GPA_HIDE_NAME("PA_SU0_175"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 175 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {176, GPA_HIDE_NAME("PA_SU0_176"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 176 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {177, GPA_HIDE_NAME("PA_SU0_177"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 177 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {178, GPA_HIDE_NAME("PA_SU0_178"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 178 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {179, GPA_HIDE_NAME("PA_SU0_179"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 179 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {180, GPA_HIDE_NAME("PA_SU0_180"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 180 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {181, GPA_HIDE_NAME("PA_SU0_181"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 181 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {182, GPA_HIDE_NAME("PA_SU0_182"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 182 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {183, GPA_HIDE_NAME("PA_SU0_183"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 183 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {184, GPA_HIDE_NAME("PA_SU0_184"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 184 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {185, GPA_HIDE_NAME("PA_SU0_185"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 185 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {186, GPA_HIDE_NAME("PA_SU0_186"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 186 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {187, GPA_HIDE_NAME("PA_SU0_187"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 187 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {188, GPA_HIDE_NAME("PA_SU0_188"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 188 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {189, GPA_HIDE_NAME("PA_SU0_189"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 189 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {190, GPA_HIDE_NAME("PA_SU0_190"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 190 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {191, GPA_HIDE_NAME("PA_SU0_191"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 191 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {192, GPA_HIDE_NAME("PA_SU0_192"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 192 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {193, GPA_HIDE_NAME("PA_SU0_193"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 193 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {194, GPA_HIDE_NAME("PA_SU0_194"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 194 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {195, GPA_HIDE_NAME("PA_SU0_195"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 195 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {196, GPA_HIDE_NAME("PA_SU0_196"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 196 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {197, GPA_HIDE_NAME("PA_SU0_197"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 197 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {198, GPA_HIDE_NAME("PA_SU0_198"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 198 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {199, GPA_HIDE_NAME("PA_SU0_199"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 199 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {200, GPA_HIDE_NAME("PA_SU0_200"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 200 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {201, GPA_HIDE_NAME("PA_SU0_201"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 201 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {202, GPA_HIDE_NAME("PA_SU0_202"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 202 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {203, GPA_HIDE_NAME("PA_SU0_203"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 203 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {204, GPA_HIDE_NAME("PA_SU0_204"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 204 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {205, GPA_HIDE_NAME("PA_SU0_205"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 205 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {206, GPA_HIDE_NAME("PA_SU0_206"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 206 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {207, GPA_HIDE_NAME("PA_SU0_207"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 207 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {208, GPA_HIDE_NAME("PA_SU0_208"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 208 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {209, GPA_HIDE_NAME("PA_SU0_209"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 209 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {210, GPA_HIDE_NAME("PA_SU0_210"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 210 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {211, GPA_HIDE_NAME("PA_SU0_211"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 211 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {212, GPA_HIDE_NAME("PA_SU0_212"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 212 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {213, GPA_HIDE_NAME("PA_SU0_213"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 213 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {214, GPA_HIDE_NAME("PA_SU0_214"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 214 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {215, GPA_HIDE_NAME("PA_SU0_215"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 215 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {216, GPA_HIDE_NAME("PA_SU0_216"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 216 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {217, GPA_HIDE_NAME("PA_SU0_217"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 217 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {218, GPA_HIDE_NAME("PA_SU0_218"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 218 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {219, GPA_HIDE_NAME("PA_SU0_219"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 219 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {220, GPA_HIDE_NAME("PA_SU0_220"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 220 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {221, GPA_HIDE_NAME("PA_SU0_221"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 221 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {222, GPA_HIDE_NAME("PA_SU0_222"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 222 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {223, GPA_HIDE_NAME("PA_SU0_223"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 223 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {224, GPA_HIDE_NAME("PA_SU0_224"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 224 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {225, GPA_HIDE_NAME("PA_SU0_225"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 225 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {226, GPA_HIDE_NAME("PA_SU0_226"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 226 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {227, GPA_HIDE_NAME("PA_SU0_227"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 227 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {228, GPA_HIDE_NAME("PA_SU0_228"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 228 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {229, GPA_HIDE_NAME("PA_SU0_229"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 229 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {230, GPA_HIDE_NAME("PA_SU0_230"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 230 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {231, GPA_HIDE_NAME("PA_SU0_231"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 231 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {232, GPA_HIDE_NAME("PA_SU0_232"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 232 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {233, GPA_HIDE_NAME("PA_SU0_233"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 233 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {234, GPA_HIDE_NAME("PA_SU0_234"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 234 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {235, GPA_HIDE_NAME("PA_SU0_235"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 235 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {236, GPA_HIDE_NAME("PA_SU0_236"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 236 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {237, GPA_HIDE_NAME("PA_SU0_237"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 237 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {238, GPA_HIDE_NAME("PA_SU0_238"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 238 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {239, GPA_HIDE_NAME("PA_SU0_239"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 239 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {240, GPA_HIDE_NAME("PA_SU0_240"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 240 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {241, GPA_HIDE_NAME("PA_SU0_241"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 241 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {242, GPA_HIDE_NAME("PA_SU0_242"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 242 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {243, GPA_HIDE_NAME("PA_SU0_243"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 243 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {244, GPA_HIDE_NAME("PA_SU0_244"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 244 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {245, GPA_HIDE_NAME("PA_SU0_245"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 245 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {246, GPA_HIDE_NAME("PA_SU0_246"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 246 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {247, GPA_HIDE_NAME("PA_SU0_247"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 247 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {248, GPA_HIDE_NAME("PA_SU0_248"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 248 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {249, GPA_HIDE_NAME("PA_SU0_249"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 249 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {250, GPA_HIDE_NAME("PA_SU0_250"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 250 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {251, GPA_HIDE_NAME("PA_SU0_251"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 251 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {252, GPA_HIDE_NAME("PA_SU0_252"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 252 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {253, GPA_HIDE_NAME("PA_SU0_253"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 253 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {254, GPA_HIDE_NAME("PA_SU0_254"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 254 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {255, GPA_HIDE_NAME("PA_SU0_255"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 255 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {256, GPA_HIDE_NAME("PA_SU0_256"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 256 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {257, GPA_HIDE_NAME("PA_SU0_257"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 257 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {258, GPA_HIDE_NAME("PA_SU0_258"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 258 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {259, GPA_HIDE_NAME("PA_SU0_259"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 259 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {260, GPA_HIDE_NAME("PA_SU0_260"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 260 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {261, GPA_HIDE_NAME("PA_SU0_261"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 261 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {262, GPA_HIDE_NAME("PA_SU0_262"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 262 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {263, GPA_HIDE_NAME("PA_SU0_263"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 263 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {264, GPA_HIDE_NAME("PA_SU0_264"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 264 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {265, GPA_HIDE_NAME("PA_SU0_265"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 265 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {266, GPA_HIDE_NAME("PA_SU0_266"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 266 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {267, GPA_HIDE_NAME("PA_SU0_267"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 267 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {268, GPA_HIDE_NAME("PA_SU0_268"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 268 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {269, GPA_HIDE_NAME("PA_SU0_269"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 269 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {270, GPA_HIDE_NAME("PA_SU0_270"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 270 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {271, GPA_HIDE_NAME("PA_SU0_271"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 271 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {272, GPA_HIDE_NAME("PA_SU0_272"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 272 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {273, GPA_HIDE_NAME("PA_SU0_273"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 273 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {274, GPA_HIDE_NAME("PA_SU0_274"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 274 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {275, GPA_HIDE_NAME("PA_SU0_275"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 275 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {276, GPA_HIDE_NAME("PA_SU0_276"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 276 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {277, GPA_HIDE_NAME("PA_SU0_277"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 277 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {278, GPA_HIDE_NAME("PA_SU0_278"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 278 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {279, GPA_HIDE_NAME("PA_SU0_279"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 279 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {280, GPA_HIDE_NAME("PA_SU0_280"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 280 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {281, GPA_HIDE_NAME("PA_SU0_281"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 281 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {282, GPA_HIDE_NAME("PA_SU0_282"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 282 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {283, GPA_HIDE_NAME("PA_SU0_283"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 283 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {284, GPA_HIDE_NAME("PA_SU0_284"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 284 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {285, GPA_HIDE_NAME("PA_SU0_285"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 285 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {286, GPA_HIDE_NAME("PA_SU0_286"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 286 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {287, GPA_HIDE_NAME("PA_SU0_287"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 287 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {288, GPA_HIDE_NAME("PA_SU0_288"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 288 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {289, GPA_HIDE_NAME("PA_SU0_289"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 289 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {290, GPA_HIDE_NAME("PA_SU0_290"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 290 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {291, GPA_HIDE_NAME("PA_SU0_291"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 291 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {292, GPA_HIDE_NAME("PA_SU0_292"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 292 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {293, GPA_HIDE_NAME("PA_SU0_293"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 293 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {294, GPA_HIDE_NAME("PA_SU0_294"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 294 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {295, GPA_HIDE_NAME("PA_SU0_295"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 295 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {296, GPA_HIDE_NAME("PA_SU0_296"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 296 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {297, GPA_HIDE_NAME("PA_SU0_297"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 297 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {298, GPA_HIDE_NAME("PA_SU0_298"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 298 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {299, GPA_HIDE_NAME("PA_SU0_299"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 299 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {300, GPA_HIDE_NAME("PA_SU0_300"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 300 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {301, GPA_HIDE_NAME("PA_SU0_301"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 301 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {302, GPA_HIDE_NAME("PA_SU0_302"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 302 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {303, GPA_HIDE_NAME("PA_SU0_303"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 303 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {304, GPA_HIDE_NAME("PA_SU0_304"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 304 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {305, GPA_HIDE_NAME("PA_SU0_305"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 305 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {306, GPA_HIDE_NAME("PA_SU0_306"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 306 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {307, GPA_HIDE_NAME("PA_SU0_307"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 307 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {308, GPA_HIDE_NAME("PA_SU0_308"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 308 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {309, GPA_HIDE_NAME("PA_SU0_309"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 309 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {310, GPA_HIDE_NAME("PA_SU0_310"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 310 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {311, GPA_HIDE_NAME("PA_SU0_311"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 311 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {312, GPA_HIDE_NAME("PA_SU0_312"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 312 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {313, GPA_HIDE_NAME("PA_SU0_313"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 313 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {314, GPA_HIDE_NAME("PA_SU0_314"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 314 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {315, GPA_HIDE_NAME("PA_SU0_315"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 315 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {316, GPA_HIDE_NAME("PA_SU0_316"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 316 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {317, GPA_HIDE_NAME("PA_SU0_317"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 317 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {318, GPA_HIDE_NAME("PA_SU0_318"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 318 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {319, GPA_HIDE_NAME("PA_SU0_319"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 319 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {320, GPA_HIDE_NAME("PA_SU0_320"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 320 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {321, GPA_HIDE_NAME("PA_SU0_321"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 321 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {322, GPA_HIDE_NAME("PA_SU0_322"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 322 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {323, GPA_HIDE_NAME("PA_SU0_323"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 323 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {324, GPA_HIDE_NAME("PA_SU0_324"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 324 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {325, GPA_HIDE_NAME("PA_SU0_325"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 325 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {326, GPA_HIDE_NAME("PA_SU0_326"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 326 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {327, GPA_HIDE_NAME("PA_SU0_327"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 327 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {328, GPA_HIDE_NAME("PA_SU0_328"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 328 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {329, GPA_HIDE_NAME("PA_SU0_329"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 329 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {330, GPA_HIDE_NAME("PA_SU0_330"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 330 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {331, GPA_HIDE_NAME("PA_SU0_331"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 331 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {332, GPA_HIDE_NAME("PA_SU0_332"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 332 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {333, GPA_HIDE_NAME("PA_SU0_333"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 333 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {334, GPA_HIDE_NAME("PA_SU0_334"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 334 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {335, GPA_HIDE_NAME("PA_SU0_335"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 335 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {336, GPA_HIDE_NAME("PA_SU0_336"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 336 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {337, GPA_HIDE_NAME("PA_SU0_337"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 337 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {338, GPA_HIDE_NAME("PA_SU0_338"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 338 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {339, GPA_HIDE_NAME("PA_SU0_339"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 339 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {340, GPA_HIDE_NAME("PA_SU0_340"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 340 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {341, GPA_HIDE_NAME("PA_SU0_341"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 341 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {342, GPA_HIDE_NAME("PA_SU0_342"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 342 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {343, GPA_HIDE_NAME("PA_SU0_343"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 343 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {344, GPA_HIDE_NAME("PA_SU0_344"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 344 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {345, GPA_HIDE_NAME("PA_SU0_345"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 345 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {346, GPA_HIDE_NAME("PA_SU0_346"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 346 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {347, GPA_HIDE_NAME("PA_SU0_347"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 347 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {348, GPA_HIDE_NAME("PA_SU0_348"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 348 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {349, GPA_HIDE_NAME("PA_SU0_349"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 349 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {350, GPA_HIDE_NAME("PA_SU0_350"), GPA_HIDE_NAME("PA_SU0"), GPA_HIDE_NAME("Counter 350 from group PA_SU0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-    };
-    GPA_HardwareCounterDesc pa_su1_counters_gfx9_placeholder4[] = {
-        {0, GPA_HIDE_NAME("PA_SU1_000"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 0 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {1, GPA_HIDE_NAME("PA_SU1_001"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 1 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {2, GPA_HIDE_NAME("PA_SU1_002"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 2 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {3, GPA_HIDE_NAME("PA_SU1_003"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 3 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {4, GPA_HIDE_NAME("PA_SU1_004"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 4 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {5, GPA_HIDE_NAME("PA_SU1_005"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 5 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {6, GPA_HIDE_NAME("PA_SU1_006"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 6 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {7, GPA_HIDE_NAME("PA_SU1_007"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 7 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {8, GPA_HIDE_NAME("PA_SU1_PERF_PAPC_PA_INPUT_PRIM"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("PERF_PAPC_PA_INPUT_PRIM Number of Primitives input to PA; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {9, GPA_HIDE_NAME("PA_SU1_009"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 9 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {10, GPA_HIDE_NAME("PA_SU1_010"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 10 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {11, GPA_HIDE_NAME("PA_SU1_011"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 11 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {12, GPA_HIDE_NAME("PA_SU1_012"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 12 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {13, GPA_HIDE_NAME("PA_SU1_013"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 13 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {14, GPA_HIDE_NAME("PA_SU1_PERF_PAPC_CLPR_CULL_PRIM"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("PERF_PAPC_CLPR_CULL_PRIM Number of Prims Culled by Clipper for VV, UCP, VTX_KILL, VTX_NAN; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; combined with _CLPR_VVUCP_CULL_PRIM , _CLPR_VV_CULL_PRIM, _VV_CULL_PRIM ,_UCP_CULL_PRIM, _VTX_KILL_CULL_PRIM, _VTX_NAN_CULL_PRIM"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {15, GPA_HIDE_NAME("PA_SU1_015"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 15 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {16, GPA_HIDE_NAME("PA_SU1_016"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 16 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {17, GPA_HIDE_NAME("PA_SU1_017"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 17 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {18, GPA_HIDE_NAME("PA_SU1_018"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 18 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {19, GPA_HIDE_NAME("PA_SU1_019"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 19 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {20, GPA_HIDE_NAME("PA_SU1_020"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 20 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {21, GPA_HIDE_NAME("PA_SU1_PERF_PAPC_CLPR_VVUCP_CLIP_PRIM"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("PERF_PAPC_CLPR_VVUCP_CLIP_PRIM Number of Prims Clipped by Clipper for VV and/or UCP; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {22, GPA_HIDE_NAME("PA_SU1_022"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 22 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {23, GPA_HIDE_NAME("PA_SU1_023"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 23 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {24, GPA_HIDE_NAME("PA_SU1_024"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 24 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {25, GPA_HIDE_NAME("PA_SU1_025"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 25 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {26, GPA_HIDE_NAME("PA_SU1_026"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 26 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {27, GPA_HIDE_NAME("PA_SU1_027"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 27 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {28, GPA_HIDE_NAME("PA_SU1_028"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 28 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {29, GPA_HIDE_NAME("PA_SU1_029"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 29 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {30, GPA_HIDE_NAME("PA_SU1_030"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 30 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {31, GPA_HIDE_NAME("PA_SU1_031"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 31 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {32, GPA_HIDE_NAME("PA_SU1_032"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 32 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {33, GPA_HIDE_NAME("PA_SU1_033"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 33 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {34, GPA_HIDE_NAME("PA_SU1_034"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 34 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {35, GPA_HIDE_NAME("PA_SU1_035"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 35 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {36, GPA_HIDE_NAME("PA_SU1_036"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 36 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {37, GPA_HIDE_NAME("PA_SU1_037"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 37 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {38, GPA_HIDE_NAME("PA_SU1_038"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 38 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {39, GPA_HIDE_NAME("PA_SU1_039"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 39 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {40, GPA_HIDE_NAME("PA_SU1_040"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 40 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {41, GPA_HIDE_NAME("PA_SU1_041"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 41 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {42, GPA_HIDE_NAME("PA_SU1_042"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 42 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {43, GPA_HIDE_NAME("PA_SU1_043"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 43 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {44, GPA_HIDE_NAME("PA_SU1_044"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 44 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {45, GPA_HIDE_NAME("PA_SU1_045"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 45 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {46, GPA_HIDE_NAME("PA_SU1_046"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 46 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {47, GPA_HIDE_NAME("PA_SU1_047"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 47 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {48, GPA_HIDE_NAME("PA_SU1_048"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 48 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {49, GPA_HIDE_NAME("PA_SU1_049"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 49 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {50, GPA_HIDE_NAME("PA_SU1_050"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 50 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {51, GPA_HIDE_NAME("PA_SU1_051"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 51 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {52, GPA_HIDE_NAME("PA_SU1_052"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 52 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {53, GPA_HIDE_NAME("PA_SU1_053"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 53 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {54, GPA_HIDE_NAME("PA_SU1_PERF_PAPC_SU_ZERO_AREA_CULL_PRIM"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("PERF_PAPC_SU_ZERO_AREA_CULL_PRIM Number of primitives culled due to zero area; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {55, GPA_HIDE_NAME("PA_SU1_PERF_PAPC_SU_BACK_FACE_CULL_PRIM"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("PERF_PAPC_SU_BACK_FACE_CULL_PRIM Number of back-face primitives culled due to facedness; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {56, GPA_HIDE_NAME("PA_SU1_PERF_PAPC_SU_FRONT_FACE_CULL_PRIM"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("PERF_PAPC_SU_FRONT_FACE_CULL_PRIM Number of front-face primitives culled due to facedness; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {57, GPA_HIDE_NAME("PA_SU1_PERF_PAPC_SU_POLYMODE_FACE_CULL"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("PERF_PAPC_SU_POLYMODE_FACE_CULL Number of polymode cull-determination primitives culled; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {58, GPA_HIDE_NAME("PA_SU1_058"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 58 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {59, GPA_HIDE_NAME("PA_SU1_059"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 59 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {60, GPA_HIDE_NAME("PA_SU1_060"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 60 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {61, GPA_HIDE_NAME("PA_SU1_PERF_PAPC_SU_OUTPUT_PRIM"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("PERF_PAPC_SU_OUTPUT_PRIM Number of primitives output from the Setup block; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {62, GPA_HIDE_NAME("PA_SU1_PERF_PAPC_SU_OUTPUT_CLIP_PRIM"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("PERF_PAPC_SU_OUTPUT_CLIP_PRIM Number of clipped primitives output from the Setup block; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {63, GPA_HIDE_NAME("PA_SU1_063"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 63 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {64, GPA_HIDE_NAME("PA_SU1_064"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 64 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {65, GPA_HIDE_NAME("PA_SU1_065"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 65 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {66, GPA_HIDE_NAME("PA_SU1_066"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 66 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {67, GPA_HIDE_NAME("PA_SU1_067"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 67 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {68, GPA_HIDE_NAME("PA_SU1_068"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 68 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {69, GPA_HIDE_NAME("PA_SU1_069"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 69 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {70, GPA_HIDE_NAME("PA_SU1_070"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 70 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {71, GPA_HIDE_NAME("PA_SU1_071"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 71 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {72, GPA_HIDE_NAME("PA_SU1_072"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 72 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {73, GPA_HIDE_NAME("PA_SU1_PERF_PAPC_SU_OUTPUT_PRIM_DUAL"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("PERF_PAPC_SU_OUTPUT_PRIM_DUAL Number of dual gradient primitives output from the Setup block; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {74, GPA_HIDE_NAME("PA_SU1_PERF_PAPC_SU_OUTPUT_CLIP_PRIM_DUAL"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("PERF_PAPC_SU_OUTPUT_CLIP_PRIM_DUAL Number of dual gradient clipped primitives output from the Setup block; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {75, GPA_HIDE_NAME("PA_SU1_075"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 75 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {76, GPA_HIDE_NAME("PA_SU1_076"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 76 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {77, GPA_HIDE_NAME("PA_SU1_077"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 77 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {78, GPA_HIDE_NAME("PA_SU1_078"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 78 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {79, GPA_HIDE_NAME("PA_SU1_079"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 79 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {80, GPA_HIDE_NAME("PA_SU1_080"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 80 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {81, GPA_HIDE_NAME("PA_SU1_081"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 81 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {82, GPA_HIDE_NAME("PA_SU1_082"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 82 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {83, GPA_HIDE_NAME("PA_SU1_083"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 83 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {84, GPA_HIDE_NAME("PA_SU1_084"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 84 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {85, GPA_HIDE_NAME("PA_SU1_085"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 85 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {86, GPA_HIDE_NAME("PA_SU1_086"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 86 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {87, GPA_HIDE_NAME("PA_SU1_087"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 87 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {88, GPA_HIDE_NAME("PA_SU1_088"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 88 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {89, GPA_HIDE_NAME("PA_SU1_089"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 89 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {90, GPA_HIDE_NAME("PA_SU1_090"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 90 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {91, GPA_HIDE_NAME("PA_SU1_091"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 91 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {92, GPA_HIDE_NAME("PA_SU1_092"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 92 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {93, GPA_HIDE_NAME("PA_SU1_093"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 93 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {94, GPA_HIDE_NAME("PA_SU1_094"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 94 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {95, GPA_HIDE_NAME("PA_SU1_095"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 95 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {96, GPA_HIDE_NAME("PA_SU1_096"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 96 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {97, GPA_HIDE_NAME("PA_SU1_097"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 97 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {98, GPA_HIDE_NAME("PA_SU1_098"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 98 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {99, GPA_HIDE_NAME("PA_SU1_099"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 99 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {100, GPA_HIDE_NAME("PA_SU1_100"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 100 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {101, GPA_HIDE_NAME("PA_SU1_101"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 101 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {102, GPA_HIDE_NAME("PA_SU1_102"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 102 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {103, GPA_HIDE_NAME("PA_SU1_103"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 103 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {104, GPA_HIDE_NAME("PA_SU1_104"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 104 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {105, GPA_HIDE_NAME("PA_SU1_PERF_PAPC_CLIP_BUSY"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("PERF_PAPC_CLIP_BUSY Number of clocks Clip is Busy; range-1/clk;it can potentially be used to detect bad performance;all instances report the same result; can be used to detect bottlenecks in combination with other signals"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {106, GPA_HIDE_NAME("PA_SU1_106"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 106 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {107, GPA_HIDE_NAME("PA_SU1_107"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 107 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {108, GPA_HIDE_NAME("PA_SU1_108"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 108 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {109, GPA_HIDE_NAME("PA_SU1_PERF_PAPC_SU_STALLED_SC"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("PERF_PAPC_SU_STALLED_SC Number of clocks Setup is stalled by SC; range-1/clk;it can potentially be used to detect bad performance;all instances report the same result"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {110, GPA_HIDE_NAME("PA_SU1_110"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 110 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {111, GPA_HIDE_NAME("PA_SU1_111"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 111 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {112, GPA_HIDE_NAME("PA_SU1_112"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 112 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {113, GPA_HIDE_NAME("PA_SU1_113"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 113 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {114, GPA_HIDE_NAME("PA_SU1_114"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 114 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {115, GPA_HIDE_NAME("PA_SU1_115"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 115 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {116, GPA_HIDE_NAME("PA_SU1_116"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 116 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {117, GPA_HIDE_NAME("PA_SU1_117"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 117 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {118, GPA_HIDE_NAME("PA_SU1_118"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 118 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {119, GPA_HIDE_NAME("PA_SU1_119"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 119 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {120, GPA_HIDE_NAME("PA_SU1_120"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 120 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {121, GPA_HIDE_NAME("PA_SU1_121"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 121 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {122, GPA_HIDE_NAME("PA_SU1_122"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 122 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {123, GPA_HIDE_NAME("PA_SU1_123"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 123 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {124, GPA_HIDE_NAME("PA_SU1_124"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 124 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {125, GPA_HIDE_NAME("PA_SU1_125"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 125 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {126, GPA_HIDE_NAME("PA_SU1_126"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 126 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {127, GPA_HIDE_NAME("PA_SU1_127"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 127 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {128, GPA_HIDE_NAME("PA_SU1_128"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 128 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {129, GPA_HIDE_NAME("PA_SU1_129"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 129 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {130, GPA_HIDE_NAME("PA_SU1_130"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 130 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {131, GPA_HIDE_NAME("PA_SU1_131"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 131 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {132, GPA_HIDE_NAME("PA_SU1_132"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 132 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {133, GPA_HIDE_NAME("PA_SU1_133"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 133 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {134, GPA_HIDE_NAME("PA_SU1_134"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 134 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {135, GPA_HIDE_NAME("PA_SU1_135"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 135 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {136, GPA_HIDE_NAME("PA_SU1_136"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 136 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {137, GPA_HIDE_NAME("PA_SU1_137"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 137 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {138, GPA_HIDE_NAME("PA_SU1_138"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 138 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {139, GPA_HIDE_NAME("PA_SU1_139"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 139 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {140, GPA_HIDE_NAME("PA_SU1_140"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 140 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {141, GPA_HIDE_NAME("PA_SU1_141"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 141 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {142, GPA_HIDE_NAME("PA_SU1_142"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 142 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {143, GPA_HIDE_NAME("PA_SU1_143"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 143 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {144, GPA_HIDE_NAME("PA_SU1_144"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 144 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {145, GPA_HIDE_NAME("PA_SU1_145"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 145 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {146, GPA_HIDE_NAME("PA_SU1_146"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 146 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {147, GPA_HIDE_NAME("PA_SU1_147"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 147 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {148, GPA_HIDE_NAME("PA_SU1_148"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 148 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {149, GPA_HIDE_NAME("PA_SU1_149"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 149 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {150, GPA_HIDE_NAME("PA_SU1_150"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 150 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {151, GPA_HIDE_NAME("PA_SU1_151"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 151 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {152, GPA_HIDE_NAME("PA_SU1_152"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 152 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {153, GPA_HIDE_NAME("PA_SU1_153"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 153 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {154, GPA_HIDE_NAME("PA_SU1_154"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 154 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {155, GPA_HIDE_NAME("PA_SU1_155"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 155 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {156, GPA_HIDE_NAME("PA_SU1_156"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 156 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {157, GPA_HIDE_NAME("PA_SU1_157"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 157 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {158, GPA_HIDE_NAME("PA_SU1_158"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 158 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {159, GPA_HIDE_NAME("PA_SU1_159"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 159 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {160, GPA_HIDE_NAME("PA_SU1_160"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 160 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {161, GPA_HIDE_NAME("PA_SU1_161"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 161 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {162, GPA_HIDE_NAME("PA_SU1_162"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 162 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {163, GPA_HIDE_NAME("PA_SU1_163"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 163 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {164, GPA_HIDE_NAME("PA_SU1_164"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 164 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {165, GPA_HIDE_NAME("PA_SU1_165"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 165 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {166, GPA_HIDE_NAME("PA_SU1_166"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 166 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {167, GPA_HIDE_NAME("PA_SU1_167"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 167 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {168, GPA_HIDE_NAME("PA_SU1_168"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 168 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {169, GPA_HIDE_NAME("PA_SU1_169"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 169 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {170, GPA_HIDE_NAME("PA_SU1_170"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 170 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {171, GPA_HIDE_NAME("PA_SU1_171"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 171 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {172, GPA_HIDE_NAME("PA_SU1_172"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 172 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {173, GPA_HIDE_NAME("PA_SU1_173"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 173 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {174, GPA_HIDE_NAME("PA_SU1_174"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 174 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {175, GPA_HIDE_NAME("PA_SU1_175"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 175 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {176, GPA_HIDE_NAME("PA_SU1_176"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 176 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {177, GPA_HIDE_NAME("PA_SU1_177"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 177 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {178, GPA_HIDE_NAME("PA_SU1_178"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 178 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {179, GPA_HIDE_NAME("PA_SU1_179"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 179 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {180, GPA_HIDE_NAME("PA_SU1_180"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 180 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {181, GPA_HIDE_NAME("PA_SU1_181"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 181 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {182, GPA_HIDE_NAME("PA_SU1_182"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 182 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {183, GPA_HIDE_NAME("PA_SU1_183"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 183 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {184, GPA_HIDE_NAME("PA_SU1_184"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 184 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {185, GPA_HIDE_NAME("PA_SU1_185"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 185 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {186, GPA_HIDE_NAME("PA_SU1_186"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 186 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {187, GPA_HIDE_NAME("PA_SU1_187"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 187 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {188, GPA_HIDE_NAME("PA_SU1_188"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 188 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {189, GPA_HIDE_NAME("PA_SU1_189"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 189 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {190, GPA_HIDE_NAME("PA_SU1_190"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 190 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {191, GPA_HIDE_NAME("PA_SU1_191"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 191 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {192, GPA_HIDE_NAME("PA_SU1_192"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 192 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {193, GPA_HIDE_NAME("PA_SU1_193"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 193 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {194, GPA_HIDE_NAME("PA_SU1_194"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 194 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {195, GPA_HIDE_NAME("PA_SU1_195"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 195 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {196, GPA_HIDE_NAME("PA_SU1_196"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 196 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {197, GPA_HIDE_NAME("PA_SU1_197"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 197 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {198, GPA_HIDE_NAME("PA_SU1_198"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 198 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {199, GPA_HIDE_NAME("PA_SU1_199"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 199 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {200, GPA_HIDE_NAME("PA_SU1_200"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 200 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {201, GPA_HIDE_NAME("PA_SU1_201"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 201 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {202, GPA_HIDE_NAME("PA_SU1_202"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 202 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {203, GPA_HIDE_NAME("PA_SU1_203"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 203 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {204, GPA_HIDE_NAME("PA_SU1_204"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 204 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {205, GPA_HIDE_NAME("PA_SU1_205"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 205 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {206, GPA_HIDE_NAME("PA_SU1_206"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 206 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {207, GPA_HIDE_NAME("PA_SU1_207"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 207 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {208, GPA_HIDE_NAME("PA_SU1_208"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 208 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {209, GPA_HIDE_NAME("PA_SU1_209"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 209 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {210, GPA_HIDE_NAME("PA_SU1_210"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 210 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {211, GPA_HIDE_NAME("PA_SU1_211"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 211 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {212, GPA_HIDE_NAME("PA_SU1_212"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 212 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {213, GPA_HIDE_NAME("PA_SU1_213"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 213 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {214, GPA_HIDE_NAME("PA_SU1_214"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 214 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {215, GPA_HIDE_NAME("PA_SU1_215"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 215 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {216, GPA_HIDE_NAME("PA_SU1_216"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 216 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {217, GPA_HIDE_NAME("PA_SU1_217"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 217 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {218, GPA_HIDE_NAME("PA_SU1_218"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 218 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {219, GPA_HIDE_NAME("PA_SU1_219"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 219 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {220, GPA_HIDE_NAME("PA_SU1_220"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 220 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {221, GPA_HIDE_NAME("PA_SU1_221"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 221 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {222, GPA_HIDE_NAME("PA_SU1_222"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 222 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {223, GPA_HIDE_NAME("PA_SU1_223"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 223 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {224, GPA_HIDE_NAME("PA_SU1_224"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 224 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {225, GPA_HIDE_NAME("PA_SU1_225"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 225 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {226, GPA_HIDE_NAME("PA_SU1_226"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 226 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {227, GPA_HIDE_NAME("PA_SU1_227"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 227 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {228, GPA_HIDE_NAME("PA_SU1_228"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 228 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {229, GPA_HIDE_NAME("PA_SU1_229"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 229 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {230, GPA_HIDE_NAME("PA_SU1_230"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 230 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {231, GPA_HIDE_NAME("PA_SU1_231"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 231 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {232, GPA_HIDE_NAME("PA_SU1_232"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 232 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {233, GPA_HIDE_NAME("PA_SU1_233"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 233 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {234, GPA_HIDE_NAME("PA_SU1_234"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 234 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {235, GPA_HIDE_NAME("PA_SU1_235"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 235 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {236, GPA_HIDE_NAME("PA_SU1_236"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 236 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {237, GPA_HIDE_NAME("PA_SU1_237"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 237 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {238, GPA_HIDE_NAME("PA_SU1_238"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 238 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {239, GPA_HIDE_NAME("PA_SU1_239"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 239 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {240, GPA_HIDE_NAME("PA_SU1_240"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 240 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {241, GPA_HIDE_NAME("PA_SU1_241"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 241 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {242, GPA_HIDE_NAME("PA_SU1_242"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 242 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {243, GPA_HIDE_NAME("PA_SU1_243"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 243 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {244, GPA_HIDE_NAME("PA_SU1_244"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 244 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {245, GPA_HIDE_NAME("PA_SU1_245"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 245 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {246, GPA_HIDE_NAME("PA_SU1_246"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 246 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {247, GPA_HIDE_NAME("PA_SU1_247"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 247 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {248, GPA_HIDE_NAME("PA_SU1_248"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 248 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {249, GPA_HIDE_NAME("PA_SU1_249"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 249 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {250, GPA_HIDE_NAME("PA_SU1_250"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 250 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {251, GPA_HIDE_NAME("PA_SU1_251"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 251 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {252, GPA_HIDE_NAME("PA_SU1_252"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 252 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {253, GPA_HIDE_NAME("PA_SU1_253"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 253 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {254, GPA_HIDE_NAME("PA_SU1_254"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 254 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {255, GPA_HIDE_NAME("PA_SU1_255"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 255 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {256, GPA_HIDE_NAME("PA_SU1_256"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 256 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {257, GPA_HIDE_NAME("PA_SU1_257"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 257 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {258, GPA_HIDE_NAME("PA_SU1_258"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 258 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {259, GPA_HIDE_NAME("PA_SU1_259"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 259 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {260, GPA_HIDE_NAME("PA_SU1_260"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 260 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {261, GPA_HIDE_NAME("PA_SU1_261"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 261 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {262, GPA_HIDE_NAME("PA_SU1_262"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 262 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {263, GPA_HIDE_NAME("PA_SU1_263"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 263 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {264, GPA_HIDE_NAME("PA_SU1_264"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 264 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {265, GPA_HIDE_NAME("PA_SU1_265"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 265 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {266, GPA_HIDE_NAME("PA_SU1_266"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 266 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {267, GPA_HIDE_NAME("PA_SU1_267"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 267 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {268, GPA_HIDE_NAME("PA_SU1_268"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 268 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {269, GPA_HIDE_NAME("PA_SU1_269"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 269 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {270, GPA_HIDE_NAME("PA_SU1_270"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 270 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {271, GPA_HIDE_NAME("PA_SU1_271"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 271 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {272, GPA_HIDE_NAME("PA_SU1_272"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 272 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {273, GPA_HIDE_NAME("PA_SU1_273"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 273 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {274, GPA_HIDE_NAME("PA_SU1_274"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 274 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {275, GPA_HIDE_NAME("PA_SU1_275"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 275 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {276, GPA_HIDE_NAME("PA_SU1_276"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 276 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {277, GPA_HIDE_NAME("PA_SU1_277"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 277 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {278, GPA_HIDE_NAME("PA_SU1_278"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 278 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {279, GPA_HIDE_NAME("PA_SU1_279"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 279 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {280, GPA_HIDE_NAME("PA_SU1_280"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 280 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {281, GPA_HIDE_NAME("PA_SU1_281"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 281 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {282, GPA_HIDE_NAME("PA_SU1_282"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 282 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {283, GPA_HIDE_NAME("PA_SU1_283"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 283 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {284, GPA_HIDE_NAME("PA_SU1_284"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 284 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {285, GPA_HIDE_NAME("PA_SU1_285"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 285 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {286, GPA_HIDE_NAME("PA_SU1_286"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 286 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {287, GPA_HIDE_NAME("PA_SU1_287"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 287 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {288, GPA_HIDE_NAME("PA_SU1_288"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 288 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {289, GPA_HIDE_NAME("PA_SU1_289"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 289 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {290, GPA_HIDE_NAME("PA_SU1_290"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 290 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {291, GPA_HIDE_NAME("PA_SU1_291"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 291 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {292, GPA_HIDE_NAME("PA_SU1_292"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 292 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {293, GPA_HIDE_NAME("PA_SU1_293"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 293 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {294, GPA_HIDE_NAME("PA_SU1_294"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 294 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {295, GPA_HIDE_NAME("PA_SU1_295"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 295 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {296, GPA_HIDE_NAME("PA_SU1_296"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 296 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {297, GPA_HIDE_NAME("PA_SU1_297"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 297 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {298, GPA_HIDE_NAME("PA_SU1_298"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 298 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {299, GPA_HIDE_NAME("PA_SU1_299"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 299 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {300, GPA_HIDE_NAME("PA_SU1_300"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 300 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {301, GPA_HIDE_NAME("PA_SU1_301"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 301 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {302, GPA_HIDE_NAME("PA_SU1_302"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 302 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {303, GPA_HIDE_NAME("PA_SU1_303"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 303 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {304, GPA_HIDE_NAME("PA_SU1_304"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 304 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {305, GPA_HIDE_NAME("PA_SU1_305"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 305 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {306, GPA_HIDE_NAME("PA_SU1_306"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 306 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {307, GPA_HIDE_NAME("PA_SU1_307"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 307 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {308, GPA_HIDE_NAME("PA_SU1_308"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 308 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {309, GPA_HIDE_NAME("PA_SU1_309"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 309 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {310, GPA_HIDE_NAME("PA_SU1_310"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 310 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {311, GPA_HIDE_NAME("PA_SU1_311"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 311 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {312, GPA_HIDE_NAME("PA_SU1_312"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 312 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {313, GPA_HIDE_NAME("PA_SU1_313"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 313 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {314, GPA_HIDE_NAME("PA_SU1_314"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 314 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {315, GPA_HIDE_NAME("PA_SU1_315"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 315 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {316, GPA_HIDE_NAME("PA_SU1_316"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 316 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {317, GPA_HIDE_NAME("PA_SU1_317"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 317 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {318, GPA_HIDE_NAME("PA_SU1_318"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 318 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {319, GPA_HIDE_NAME("PA_SU1_319"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 319 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {320, GPA_HIDE_NAME("PA_SU1_320"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 320 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {321, GPA_HIDE_NAME("PA_SU1_321"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 321 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {322, GPA_HIDE_NAME("PA_SU1_322"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 322 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {323, GPA_HIDE_NAME("PA_SU1_323"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 323 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {324, GPA_HIDE_NAME("PA_SU1_324"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 324 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {325, GPA_HIDE_NAME("PA_SU1_325"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 325 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {326, GPA_HIDE_NAME("PA_SU1_326"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 326 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {327, GPA_HIDE_NAME("PA_SU1_327"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 327 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {328, GPA_HIDE_NAME("PA_SU1_328"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 328 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {329, GPA_HIDE_NAME("PA_SU1_329"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 329 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {330, GPA_HIDE_NAME("PA_SU1_330"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 330 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {331, GPA_HIDE_NAME("PA_SU1_331"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 331 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {332, GPA_HIDE_NAME("PA_SU1_332"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 332 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {333, GPA_HIDE_NAME("PA_SU1_333"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 333 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {334, GPA_HIDE_NAME("PA_SU1_334"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 334 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {335, GPA_HIDE_NAME("PA_SU1_335"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 335 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {336, GPA_HIDE_NAME("PA_SU1_336"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 336 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {337, GPA_HIDE_NAME("PA_SU1_337"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 337 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {338, GPA_HIDE_NAME("PA_SU1_338"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 338 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {339, GPA_HIDE_NAME("PA_SU1_339"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 339 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {340, GPA_HIDE_NAME("PA_SU1_340"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 340 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {341, GPA_HIDE_NAME("PA_SU1_341"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 341 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {342, GPA_HIDE_NAME("PA_SU1_342"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 342 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {343, GPA_HIDE_NAME("PA_SU1_343"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 343 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {344, GPA_HIDE_NAME("PA_SU1_344"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 344 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {345, GPA_HIDE_NAME("PA_SU1_345"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 345 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {346, GPA_HIDE_NAME("PA_SU1_346"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 346 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {347, GPA_HIDE_NAME("PA_SU1_347"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 347 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {348, GPA_HIDE_NAME("PA_SU1_348"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 348 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {349, GPA_HIDE_NAME("PA_SU1_349"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 349 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {350, GPA_HIDE_NAME("PA_SU1_350"), GPA_HIDE_NAME("PA_SU1"), GPA_HIDE_NAME("Counter 350 from group PA_SU1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-    };
-    GPA_HardwareCounterDesc pa_su2_counters_gfx9_placeholder4[] = {
-        {0, GPA_HIDE_NAME("PA_SU2_000"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 0 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {1, GPA_HIDE_NAME("PA_SU2_001"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 1 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {2, GPA_HIDE_NAME("PA_SU2_002"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 2 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {3, GPA_HIDE_NAME("PA_SU2_003"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 3 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {4, GPA_HIDE_NAME("PA_SU2_004"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 4 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {5, GPA_HIDE_NAME("PA_SU2_005"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 5 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {6, GPA_HIDE_NAME("PA_SU2_006"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 6 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {7, GPA_HIDE_NAME("PA_SU2_007"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 7 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {8, GPA_HIDE_NAME("PA_SU2_PERF_PAPC_PA_INPUT_PRIM"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("PERF_PAPC_PA_INPUT_PRIM Number of Primitives input to PA; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {9, GPA_HIDE_NAME("PA_SU2_009"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 9 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {10, GPA_HIDE_NAME("PA_SU2_010"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 10 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {11, GPA_HIDE_NAME("PA_SU2_011"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 11 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {12, GPA_HIDE_NAME("PA_SU2_012"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 12 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {13, GPA_HIDE_NAME("PA_SU2_013"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 13 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {14, GPA_HIDE_NAME("PA_SU2_PERF_PAPC_CLPR_CULL_PRIM"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("PERF_PAPC_CLPR_CULL_PRIM Number of Prims Culled by Clipper for VV, UCP, VTX_KILL, VTX_NAN; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; combined with _CLPR_VVUCP_CULL_PRIM , _CLPR_VV_CULL_PRIM, _VV_CULL_PRIM ,_UCP_CULL_PRIM, _VTX_KILL_CULL_PRIM, _VTX_NAN_CULL_PRIM"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {15, GPA_HIDE_NAME("PA_SU2_015"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 15 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {16, GPA_HIDE_NAME("PA_SU2_016"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 16 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {17, GPA_HIDE_NAME("PA_SU2_017"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 17 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {18, GPA_HIDE_NAME("PA_SU2_018"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 18 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {19, GPA_HIDE_NAME("PA_SU2_019"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 19 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {20, GPA_HIDE_NAME("PA_SU2_020"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 20 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {21, GPA_HIDE_NAME("PA_SU2_PERF_PAPC_CLPR_VVUCP_CLIP_PRIM"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("PERF_PAPC_CLPR_VVUCP_CLIP_PRIM Number of Prims Clipped by Clipper for VV and/or UCP; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {22, GPA_HIDE_NAME("PA_SU2_022"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 22 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {23, GPA_HIDE_NAME("PA_SU2_023"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 23 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {24, GPA_HIDE_NAME("PA_SU2_024"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 24 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {25, GPA_HIDE_NAME("PA_SU2_025"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 25 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {26, GPA_HIDE_NAME("PA_SU2_026"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 26 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {27, GPA_HIDE_NAME("PA_SU2_027"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 27 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {28, GPA_HIDE_NAME("PA_SU2_028"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 28 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {29, GPA_HIDE_NAME("PA_SU2_029"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 29 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {30, GPA_HIDE_NAME("PA_SU2_030"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 30 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {31, GPA_HIDE_NAME("PA_SU2_031"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 31 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {32, GPA_HIDE_NAME("PA_SU2_032"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 32 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {33, GPA_HIDE_NAME("PA_SU2_033"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 33 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {34, GPA_HIDE_NAME("PA_SU2_034"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 34 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {35, GPA_HIDE_NAME("PA_SU2_035"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 35 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {36, GPA_HIDE_NAME("PA_SU2_036"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 36 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {37, GPA_HIDE_NAME("PA_SU2_037"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 37 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {38, GPA_HIDE_NAME("PA_SU2_038"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 38 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {39, GPA_HIDE_NAME("PA_SU2_039"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 39 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {40, GPA_HIDE_NAME("PA_SU2_040"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 40 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {41, GPA_HIDE_NAME("PA_SU2_041"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 41 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {42, GPA_HIDE_NAME("PA_SU2_042"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 42 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {43, GPA_HIDE_NAME("PA_SU2_043"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 43 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {44, GPA_HIDE_NAME("PA_SU2_044"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 44 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {45, GPA_HIDE_NAME("PA_SU2_045"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 45 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {46, GPA_HIDE_NAME("PA_SU2_046"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 46 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {47, GPA_HIDE_NAME("PA_SU2_047"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 47 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {48, GPA_HIDE_NAME("PA_SU2_048"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 48 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {49, GPA_HIDE_NAME("PA_SU2_049"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 49 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {50, GPA_HIDE_NAME("PA_SU2_050"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 50 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {51, GPA_HIDE_NAME("PA_SU2_051"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 51 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {52, GPA_HIDE_NAME("PA_SU2_052"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 52 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {53, GPA_HIDE_NAME("PA_SU2_053"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 53 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {54, GPA_HIDE_NAME("PA_SU2_PERF_PAPC_SU_ZERO_AREA_CULL_PRIM"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("PERF_PAPC_SU_ZERO_AREA_CULL_PRIM Number of primitives culled due to zero area; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {55, GPA_HIDE_NAME("PA_SU2_PERF_PAPC_SU_BACK_FACE_CULL_PRIM"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("PERF_PAPC_SU_BACK_FACE_CULL_PRIM Number of back-face primitives culled due to facedness; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {56, GPA_HIDE_NAME("PA_SU2_PERF_PAPC_SU_FRONT_FACE_CULL_PRIM"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("PERF_PAPC_SU_FRONT_FACE_CULL_PRIM Number of front-face primitives culled due to facedness; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {57, GPA_HIDE_NAME("PA_SU2_PERF_PAPC_SU_POLYMODE_FACE_CULL"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("PERF_PAPC_SU_POLYMODE_FACE_CULL Number of polymode cull-determination primitives culled; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {58, GPA_HIDE_NAME("PA_SU2_058"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 58 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {59, GPA_HIDE_NAME("PA_SU2_059"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 59 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {60, GPA_HIDE_NAME("PA_SU2_060"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 60 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {61, GPA_HIDE_NAME("PA_SU2_PERF_PAPC_SU_OUTPUT_PRIM"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("PERF_PAPC_SU_OUTPUT_PRIM Number of primitives output from the Setup block; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {62, GPA_HIDE_NAME("PA_SU2_PERF_PAPC_SU_OUTPUT_CLIP_PRIM"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("PERF_PAPC_SU_OUTPUT_CLIP_PRIM Number of clipped primitives output from the Setup block; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {63, GPA_HIDE_NAME("PA_SU2_063"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 63 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {64, GPA_HIDE_NAME("PA_SU2_064"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 64 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {65, GPA_HIDE_NAME("PA_SU2_065"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 65 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {66, GPA_HIDE_NAME("PA_SU2_066"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 66 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {67, GPA_HIDE_NAME("PA_SU2_067"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 67 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {68, GPA_HIDE_NAME("PA_SU2_068"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 68 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {69, GPA_HIDE_NAME("PA_SU2_069"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 69 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {70, GPA_HIDE_NAME("PA_SU2_070"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 70 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {71, GPA_HIDE_NAME("PA_SU2_071"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 71 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {72, GPA_HIDE_NAME("PA_SU2_072"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 72 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {73, GPA_HIDE_NAME("PA_SU2_PERF_PAPC_SU_OUTPUT_PRIM_DUAL"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("PERF_PAPC_SU_OUTPUT_PRIM_DUAL Number of dual gradient primitives output from the Setup block; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {74, GPA_HIDE_NAME("PA_SU2_PERF_PAPC_SU_OUTPUT_CLIP_PRIM_DUAL"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("PERF_PAPC_SU_OUTPUT_CLIP_PRIM_DUAL Number of dual gradient clipped primitives output from the Setup block; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {75, GPA_HIDE_NAME("PA_SU2_075"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 75 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {76, GPA_HIDE_NAME("PA_SU2_076"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 76 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {77, GPA_HIDE_NAME("PA_SU2_077"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 77 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {78, GPA_HIDE_NAME("PA_SU2_078"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 78 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {79, GPA_HIDE_NAME("PA_SU2_079"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 79 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {80, GPA_HIDE_NAME("PA_SU2_080"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 80 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {81, GPA_HIDE_NAME("PA_SU2_081"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 81 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {82, GPA_HIDE_NAME("PA_SU2_082"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 82 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {83, GPA_HIDE_NAME("PA_SU2_083"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 83 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {84, GPA_HIDE_NAME("PA_SU2_084"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 84 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {85, GPA_HIDE_NAME("PA_SU2_085"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 85 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {86, GPA_HIDE_NAME("PA_SU2_086"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 86 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {87, GPA_HIDE_NAME("PA_SU2_087"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 87 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {88, GPA_HIDE_NAME("PA_SU2_088"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 88 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {89, GPA_HIDE_NAME("PA_SU2_089"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 89 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {90, GPA_HIDE_NAME("PA_SU2_090"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 90 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {91, GPA_HIDE_NAME("PA_SU2_091"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 91 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {92, GPA_HIDE_NAME("PA_SU2_092"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 92 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {93, GPA_HIDE_NAME("PA_SU2_093"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 93 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {94, GPA_HIDE_NAME("PA_SU2_094"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 94 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {95, GPA_HIDE_NAME("PA_SU2_095"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 95 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {96, GPA_HIDE_NAME("PA_SU2_096"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 96 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {97, GPA_HIDE_NAME("PA_SU2_097"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 97 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {98, GPA_HIDE_NAME("PA_SU2_098"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 98 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {99, GPA_HIDE_NAME("PA_SU2_099"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 99 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {100, GPA_HIDE_NAME("PA_SU2_100"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 100 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {101, GPA_HIDE_NAME("PA_SU2_101"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 101 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {102, GPA_HIDE_NAME("PA_SU2_102"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 102 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {103, GPA_HIDE_NAME("PA_SU2_103"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 103 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {104, GPA_HIDE_NAME("PA_SU2_104"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 104 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {105, GPA_HIDE_NAME("PA_SU2_PERF_PAPC_CLIP_BUSY"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("PERF_PAPC_CLIP_BUSY Number of clocks Clip is Busy; range-1/clk;it can potentially be used to detect bad performance;all instances report the same result; can be used to detect bottlenecks in combination with other signals"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {106, GPA_HIDE_NAME("PA_SU2_106"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 106 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {107, GPA_HIDE_NAME("PA_SU2_107"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 107 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {108, GPA_HIDE_NAME("PA_SU2_108"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 108 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {109, GPA_HIDE_NAME("PA_SU2_PERF_PAPC_SU_STALLED_SC"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("PERF_PAPC_SU_STALLED_SC Number of clocks Setup is stalled by SC; range-1/clk;it can potentially be used to detect bad performance;all instances report the same result"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {110, GPA_HIDE_NAME("PA_SU2_110"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 110 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {111, GPA_HIDE_NAME("PA_SU2_111"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 111 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {112, GPA_HIDE_NAME("PA_SU2_112"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 112 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {113, GPA_HIDE_NAME("PA_SU2_113"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 113 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {114, GPA_HIDE_NAME("PA_SU2_114"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 114 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {115, GPA_HIDE_NAME("PA_SU2_115"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 115 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {116, GPA_HIDE_NAME("PA_SU2_116"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 116 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {117, GPA_HIDE_NAME("PA_SU2_117"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 117 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {118, GPA_HIDE_NAME("PA_SU2_118"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 118 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {119, GPA_HIDE_NAME("PA_SU2_119"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 119 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {120, GPA_HIDE_NAME("PA_SU2_120"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 120 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {121, GPA_HIDE_NAME("PA_SU2_121"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 121 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {122, GPA_HIDE_NAME("PA_SU2_122"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 122 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {123, GPA_HIDE_NAME("PA_SU2_123"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 123 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {124, GPA_HIDE_NAME("PA_SU2_124"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 124 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {125, GPA_HIDE_NAME("PA_SU2_125"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 125 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {126, GPA_HIDE_NAME("PA_SU2_126"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 126 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {127, GPA_HIDE_NAME("PA_SU2_127"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 127 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {128, GPA_HIDE_NAME("PA_SU2_128"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 128 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {129, GPA_HIDE_NAME("PA_SU2_129"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 129 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {130, GPA_HIDE_NAME("PA_SU2_130"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 130 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {131, GPA_HIDE_NAME("PA_SU2_131"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 131 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {132, GPA_HIDE_NAME("PA_SU2_132"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 132 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {133, GPA_HIDE_NAME("PA_SU2_133"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 133 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {134, GPA_HIDE_NAME("PA_SU2_134"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 134 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {135, GPA_HIDE_NAME("PA_SU2_135"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 135 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {136, GPA_HIDE_NAME("PA_SU2_136"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 136 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {137, GPA_HIDE_NAME("PA_SU2_137"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 137 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {138, GPA_HIDE_NAME("PA_SU2_138"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 138 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {139, GPA_HIDE_NAME("PA_SU2_139"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 139 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {140, GPA_HIDE_NAME("PA_SU2_140"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 140 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {141, GPA_HIDE_NAME("PA_SU2_141"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 141 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {142, GPA_HIDE_NAME("PA_SU2_142"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 142 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {143, GPA_HIDE_NAME("PA_SU2_143"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 143 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {144, GPA_HIDE_NAME("PA_SU2_144"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 144 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {145, GPA_HIDE_NAME("PA_SU2_145"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 145 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {146, GPA_HIDE_NAME("PA_SU2_146"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 146 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {147, GPA_HIDE_NAME("PA_SU2_147"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 147 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {148, GPA_HIDE_NAME("PA_SU2_148"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 148 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {149, GPA_HIDE_NAME("PA_SU2_149"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 149 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {150, GPA_HIDE_NAME("PA_SU2_150"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 150 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {151, GPA_HIDE_NAME("PA_SU2_151"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 151 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {152, GPA_HIDE_NAME("PA_SU2_152"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 152 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {153, GPA_HIDE_NAME("PA_SU2_153"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 153 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {154, GPA_HIDE_NAME("PA_SU2_154"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 154 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {155, GPA_HIDE_NAME("PA_SU2_155"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 155 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {156, GPA_HIDE_NAME("PA_SU2_156"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 156 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {157, GPA_HIDE_NAME("PA_SU2_157"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 157 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {158, GPA_HIDE_NAME("PA_SU2_158"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 158 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {159, GPA_HIDE_NAME("PA_SU2_159"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 159 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {160, GPA_HIDE_NAME("PA_SU2_160"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 160 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {161, GPA_HIDE_NAME("PA_SU2_161"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 161 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {162, GPA_HIDE_NAME("PA_SU2_162"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 162 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {163, GPA_HIDE_NAME("PA_SU2_163"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 163 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {164, GPA_HIDE_NAME("PA_SU2_164"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 164 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {165, GPA_HIDE_NAME("PA_SU2_165"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 165 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {166, GPA_HIDE_NAME("PA_SU2_166"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 166 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {167, GPA_HIDE_NAME("PA_SU2_167"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 167 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {168, GPA_HIDE_NAME("PA_SU2_168"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 168 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {169, GPA_HIDE_NAME("PA_SU2_169"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 169 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {170, GPA_HIDE_NAME("PA_SU2_170"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 170 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {171, GPA_HIDE_NAME("PA_SU2_171"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 171 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {172, GPA_HIDE_NAME("PA_SU2_172"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 172 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {173, GPA_HIDE_NAME("PA_SU2_173"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 173 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {174, GPA_HIDE_NAME("PA_SU2_174"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 174 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {175, GPA_HIDE_NAME("PA_SU2_175"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 175 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {176, GPA_HIDE_NAME("PA_SU2_176"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 176 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {177, GPA_HIDE_NAME("PA_SU2_177"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 177 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {178, GPA_HIDE_NAME("PA_SU2_178"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 178 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {179, GPA_HIDE_NAME("PA_SU2_179"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 179 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {180, GPA_HIDE_NAME("PA_SU2_180"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 180 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {181, GPA_HIDE_NAME("PA_SU2_181"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 181 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {182, GPA_HIDE_NAME("PA_SU2_182"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 182 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {183, GPA_HIDE_NAME("PA_SU2_183"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 183 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {184, GPA_HIDE_NAME("PA_SU2_184"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 184 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {185, GPA_HIDE_NAME("PA_SU2_185"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 185 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {186, GPA_HIDE_NAME("PA_SU2_186"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 186 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {187, GPA_HIDE_NAME("PA_SU2_187"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 187 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {188, GPA_HIDE_NAME("PA_SU2_188"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 188 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {189, GPA_HIDE_NAME("PA_SU2_189"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 189 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {190, GPA_HIDE_NAME("PA_SU2_190"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 190 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {191, GPA_HIDE_NAME("PA_SU2_191"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 191 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {192, GPA_HIDE_NAME("PA_SU2_192"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 192 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {193, GPA_HIDE_NAME("PA_SU2_193"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 193 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {194, GPA_HIDE_NAME("PA_SU2_194"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 194 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {195, GPA_HIDE_NAME("PA_SU2_195"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 195 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {196, GPA_HIDE_NAME("PA_SU2_196"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 196 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {197, GPA_HIDE_NAME("PA_SU2_197"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 197 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {198, GPA_HIDE_NAME("PA_SU2_198"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 198 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {199, GPA_HIDE_NAME("PA_SU2_199"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 199 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {200, GPA_HIDE_NAME("PA_SU2_200"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 200 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {201, GPA_HIDE_NAME("PA_SU2_201"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 201 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {202, GPA_HIDE_NAME("PA_SU2_202"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 202 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {203, GPA_HIDE_NAME("PA_SU2_203"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 203 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {204, GPA_HIDE_NAME("PA_SU2_204"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 204 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {205, GPA_HIDE_NAME("PA_SU2_205"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 205 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {206, GPA_HIDE_NAME("PA_SU2_206"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 206 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {207, GPA_HIDE_NAME("PA_SU2_207"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 207 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {208, GPA_HIDE_NAME("PA_SU2_208"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 208 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {209, GPA_HIDE_NAME("PA_SU2_209"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 209 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {210, GPA_HIDE_NAME("PA_SU2_210"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 210 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {211, GPA_HIDE_NAME("PA_SU2_211"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 211 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {212, GPA_HIDE_NAME("PA_SU2_212"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 212 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {213, GPA_HIDE_NAME("PA_SU2_213"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 213 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {214, GPA_HIDE_NAME("PA_SU2_214"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 214 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {215, GPA_HIDE_NAME("PA_SU2_215"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 215 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {216, GPA_HIDE_NAME("PA_SU2_216"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 216 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {217, GPA_HIDE_NAME("PA_SU2_217"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 217 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {218, GPA_HIDE_NAME("PA_SU2_218"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 218 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {219, GPA_HIDE_NAME("PA_SU2_219"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 219 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {220, GPA_HIDE_NAME("PA_SU2_220"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 220 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {221, GPA_HIDE_NAME("PA_SU2_221"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 221 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {222, GPA_HIDE_NAME("PA_SU2_222"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 222 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {223, GPA_HIDE_NAME("PA_SU2_223"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 223 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {224, GPA_HIDE_NAME("PA_SU2_224"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 224 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {225, GPA_HIDE_NAME("PA_SU2_225"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 225 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {226, GPA_HIDE_NAME("PA_SU2_226"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 226 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {227, GPA_HIDE_NAME("PA_SU2_227"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 227 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {228, GPA_HIDE_NAME("PA_SU2_228"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 228 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {229, GPA_HIDE_NAME("PA_SU2_229"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 229 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {230, GPA_HIDE_NAME("PA_SU2_230"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 230 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {231, GPA_HIDE_NAME("PA_SU2_231"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 231 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {232, GPA_HIDE_NAME("PA_SU2_232"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 232 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {233, GPA_HIDE_NAME("PA_SU2_233"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 233 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {234, GPA_HIDE_NAME("PA_SU2_234"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 234 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {235, GPA_HIDE_NAME("PA_SU2_235"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 235 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {236, GPA_HIDE_NAME("PA_SU2_236"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 236 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {237, GPA_HIDE_NAME("PA_SU2_237"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 237 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {238, GPA_HIDE_NAME("PA_SU2_238"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 238 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {239, GPA_HIDE_NAME("PA_SU2_239"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 239 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {240, GPA_HIDE_NAME("PA_SU2_240"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 240 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {241, GPA_HIDE_NAME("PA_SU2_241"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 241 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {242, GPA_HIDE_NAME("PA_SU2_242"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 242 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {243, GPA_HIDE_NAME("PA_SU2_243"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 243 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {244, GPA_HIDE_NAME("PA_SU2_244"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 244 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {245, GPA_HIDE_NAME("PA_SU2_245"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 245 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {246, GPA_HIDE_NAME("PA_SU2_246"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 246 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {247, GPA_HIDE_NAME("PA_SU2_247"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 247 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {248, GPA_HIDE_NAME("PA_SU2_248"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 248 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {249, GPA_HIDE_NAME("PA_SU2_249"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 249 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {250, GPA_HIDE_NAME("PA_SU2_250"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 250 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {251, GPA_HIDE_NAME("PA_SU2_251"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 251 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {252, GPA_HIDE_NAME("PA_SU2_252"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 252 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {253, GPA_HIDE_NAME("PA_SU2_253"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 253 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {254, GPA_HIDE_NAME("PA_SU2_254"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 254 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {255, GPA_HIDE_NAME("PA_SU2_255"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 255 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {256, GPA_HIDE_NAME("PA_SU2_256"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 256 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {257, GPA_HIDE_NAME("PA_SU2_257"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 257 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {258, GPA_HIDE_NAME("PA_SU2_258"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 258 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {259, GPA_HIDE_NAME("PA_SU2_259"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 259 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {260, GPA_HIDE_NAME("PA_SU2_260"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 260 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {261, GPA_HIDE_NAME("PA_SU2_261"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 261 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {262, GPA_HIDE_NAME("PA_SU2_262"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 262 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {263, GPA_HIDE_NAME("PA_SU2_263"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 263 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {264, GPA_HIDE_NAME("PA_SU2_264"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 264 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {265, GPA_HIDE_NAME("PA_SU2_265"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 265 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {266, GPA_HIDE_NAME("PA_SU2_266"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 266 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {267, GPA_HIDE_NAME("PA_SU2_267"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 267 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {268, GPA_HIDE_NAME("PA_SU2_268"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 268 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {269, GPA_HIDE_NAME("PA_SU2_269"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 269 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {270, GPA_HIDE_NAME("PA_SU2_270"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 270 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {271, GPA_HIDE_NAME("PA_SU2_271"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 271 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {272, GPA_HIDE_NAME("PA_SU2_272"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 272 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {273, GPA_HIDE_NAME("PA_SU2_273"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 273 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {274, GPA_HIDE_NAME("PA_SU2_274"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 274 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {275, GPA_HIDE_NAME("PA_SU2_275"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 275 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {276, GPA_HIDE_NAME("PA_SU2_276"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 276 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {277, GPA_HIDE_NAME("PA_SU2_277"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 277 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {278, GPA_HIDE_NAME("PA_SU2_278"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 278 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {279, GPA_HIDE_NAME("PA_SU2_279"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 279 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {280, GPA_HIDE_NAME("PA_SU2_280"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 280 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {281, GPA_HIDE_NAME("PA_SU2_281"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 281 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {282, GPA_HIDE_NAME("PA_SU2_282"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 282 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {283, GPA_HIDE_NAME("PA_SU2_283"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 283 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {284, GPA_HIDE_NAME("PA_SU2_284"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 284 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {285, GPA_HIDE_NAME("PA_SU2_285"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 285 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {286, GPA_HIDE_NAME("PA_SU2_286"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 286 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {287, GPA_HIDE_NAME("PA_SU2_287"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 287 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {288, GPA_HIDE_NAME("PA_SU2_288"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 288 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {289, GPA_HIDE_NAME("PA_SU2_289"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 289 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {290, GPA_HIDE_NAME("PA_SU2_290"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 290 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {291, GPA_HIDE_NAME("PA_SU2_291"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 291 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {292, GPA_HIDE_NAME("PA_SU2_292"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 292 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {293, GPA_HIDE_NAME("PA_SU2_293"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 293 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {294, GPA_HIDE_NAME("PA_SU2_294"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 294 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {295, GPA_HIDE_NAME("PA_SU2_295"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 295 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {296, GPA_HIDE_NAME("PA_SU2_296"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 296 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {297, GPA_HIDE_NAME("PA_SU2_297"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 297 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {298, GPA_HIDE_NAME("PA_SU2_298"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 298 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {299, GPA_HIDE_NAME("PA_SU2_299"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 299 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {300, GPA_HIDE_NAME("PA_SU2_300"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 300 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {301, GPA_HIDE_NAME("PA_SU2_301"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 301 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {302, GPA_HIDE_NAME("PA_SU2_302"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 302 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {303, GPA_HIDE_NAME("PA_SU2_303"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 303 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {304, GPA_HIDE_NAME("PA_SU2_304"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 304 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {305, GPA_HIDE_NAME("PA_SU2_305"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 305 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {306, GPA_HIDE_NAME("PA_SU2_306"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 306 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {307, GPA_HIDE_NAME("PA_SU2_307"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 307 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {308, GPA_HIDE_NAME("PA_SU2_308"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 308 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {309, GPA_HIDE_NAME("PA_SU2_309"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 309 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {310, GPA_HIDE_NAME("PA_SU2_310"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 310 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {311, GPA_HIDE_NAME("PA_SU2_311"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 311 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {312, GPA_HIDE_NAME("PA_SU2_312"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 312 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {313, GPA_HIDE_NAME("PA_SU2_313"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 313 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {314, GPA_HIDE_NAME("PA_SU2_314"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 314 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {315, GPA_HIDE_NAME("PA_SU2_315"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 315 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {316, GPA_HIDE_NAME("PA_SU2_316"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 316 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {317, GPA_HIDE_NAME("PA_SU2_317"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 317 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {318, GPA_HIDE_NAME("PA_SU2_318"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 318 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {319, GPA_HIDE_NAME("PA_SU2_319"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 319 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {320, GPA_HIDE_NAME("PA_SU2_320"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 320 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {321, GPA_HIDE_NAME("PA_SU2_321"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 321 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {322, GPA_HIDE_NAME("PA_SU2_322"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 322 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {323, GPA_HIDE_NAME("PA_SU2_323"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 323 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {324, GPA_HIDE_NAME("PA_SU2_324"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 324 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {325, GPA_HIDE_NAME("PA_SU2_325"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 325 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {326, GPA_HIDE_NAME("PA_SU2_326"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 326 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {327, GPA_HIDE_NAME("PA_SU2_327"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 327 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {328, GPA_HIDE_NAME("PA_SU2_328"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 328 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {329, GPA_HIDE_NAME("PA_SU2_329"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 329 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {330, GPA_HIDE_NAME("PA_SU2_330"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 330 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {331, GPA_HIDE_NAME("PA_SU2_331"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 331 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {332, GPA_HIDE_NAME("PA_SU2_332"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 332 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {333, GPA_HIDE_NAME("PA_SU2_333"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 333 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {334, GPA_HIDE_NAME("PA_SU2_334"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 334 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {335, GPA_HIDE_NAME("PA_SU2_335"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 335 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {336, GPA_HIDE_NAME("PA_SU2_336"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 336 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {337, GPA_HIDE_NAME("PA_SU2_337"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 337 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {338, GPA_HIDE_NAME("PA_SU2_338"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 338 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {339, GPA_HIDE_NAME("PA_SU2_339"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 339 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {340, GPA_HIDE_NAME("PA_SU2_340"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 340 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {341, GPA_HIDE_NAME("PA_SU2_341"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 341 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {342, GPA_HIDE_NAME("PA_SU2_342"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 342 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {343, GPA_HIDE_NAME("PA_SU2_343"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 343 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {344, GPA_HIDE_NAME("PA_SU2_344"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 344 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {345, GPA_HIDE_NAME("PA_SU2_345"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 345 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {346, GPA_HIDE_NAME("PA_SU2_346"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 346 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {347, GPA_HIDE_NAME("PA_SU2_347"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 347 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {348, GPA_HIDE_NAME("PA_SU2_348"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 348 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {349, GPA_HIDE_NAME("PA_SU2_349"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 349 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {350, GPA_HIDE_NAME("PA_SU2_350"), GPA_HIDE_NAME("PA_SU2"), GPA_HIDE_NAME("Counter 350 from group PA_SU2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-    };
-    GPA_HardwareCounterDesc pa_su3_counters_gfx9_placeholder4[] = {
-        {0, GPA_HIDE_NAME("PA_SU3_000"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 0 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {1, GPA_HIDE_NAME("PA_SU3_001"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 1 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {2, GPA_HIDE_NAME("PA_SU3_002"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 2 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {3, GPA_HIDE_NAME("PA_SU3_003"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 3 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {4, GPA_HIDE_NAME("PA_SU3_004"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 4 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {5, GPA_HIDE_NAME("PA_SU3_005"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 5 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {6, GPA_HIDE_NAME("PA_SU3_006"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 6 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {7, GPA_HIDE_NAME("PA_SU3_007"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 7 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {8, GPA_HIDE_NAME("PA_SU3_PERF_PAPC_PA_INPUT_PRIM"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("PERF_PAPC_PA_INPUT_PRIM Number of Primitives input to PA; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {9, GPA_HIDE_NAME("PA_SU3_009"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 9 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {10, GPA_HIDE_NAME("PA_SU3_010"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 10 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {11, GPA_HIDE_NAME("PA_SU3_011"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 11 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {12, GPA_HIDE_NAME("PA_SU3_012"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 12 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {13, GPA_HIDE_NAME("PA_SU3_013"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 13 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {14, GPA_HIDE_NAME("PA_SU3_PERF_PAPC_CLPR_CULL_PRIM"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("PERF_PAPC_CLPR_CULL_PRIM Number of Prims Culled by Clipper for VV, UCP, VTX_KILL, VTX_NAN; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; combined with _CLPR_VVUCP_CULL_PRIM , _CLPR_VV_CULL_PRIM, _VV_CULL_PRIM ,_UCP_CULL_PRIM, _VTX_KILL_CULL_PRIM, _VTX_NAN_CULL_PRIM"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {15, GPA_HIDE_NAME("PA_SU3_015"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 15 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {16, GPA_HIDE_NAME("PA_SU3_016"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 16 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {17, GPA_HIDE_NAME("PA_SU3_017"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 17 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {18, GPA_HIDE_NAME("PA_SU3_018"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 18 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {19, GPA_HIDE_NAME("PA_SU3_019"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 19 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {20, GPA_HIDE_NAME("PA_SU3_020"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 20 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {21, GPA_HIDE_NAME("PA_SU3_PERF_PAPC_CLPR_VVUCP_CLIP_PRIM"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("PERF_PAPC_CLPR_VVUCP_CLIP_PRIM Number of Prims Clipped by Clipper for VV and/or UCP; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {22, GPA_HIDE_NAME("PA_SU3_022"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 22 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {23, GPA_HIDE_NAME("PA_SU3_023"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 23 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {24, GPA_HIDE_NAME("PA_SU3_024"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 24 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {25, GPA_HIDE_NAME("PA_SU3_025"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 25 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {26, GPA_HIDE_NAME("PA_SU3_026"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 26 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {27, GPA_HIDE_NAME("PA_SU3_027"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 27 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {28, GPA_HIDE_NAME("PA_SU3_028"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 28 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {29, GPA_HIDE_NAME("PA_SU3_029"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 29 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {30, GPA_HIDE_NAME("PA_SU3_030"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 30 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {31, GPA_HIDE_NAME("PA_SU3_031"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 31 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {32, GPA_HIDE_NAME("PA_SU3_032"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 32 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {33, GPA_HIDE_NAME("PA_SU3_033"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 33 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {34, GPA_HIDE_NAME("PA_SU3_034"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 34 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {35, GPA_HIDE_NAME("PA_SU3_035"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 35 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {36, GPA_HIDE_NAME("PA_SU3_036"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 36 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {37, GPA_HIDE_NAME("PA_SU3_037"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 37 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {38, GPA_HIDE_NAME("PA_SU3_038"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 38 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {39, GPA_HIDE_NAME("PA_SU3_039"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 39 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {40, GPA_HIDE_NAME("PA_SU3_040"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 40 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {41, GPA_HIDE_NAME("PA_SU3_041"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 41 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {42, GPA_HIDE_NAME("PA_SU3_042"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 42 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {43, GPA_HIDE_NAME("PA_SU3_043"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 43 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {44, GPA_HIDE_NAME("PA_SU3_044"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 44 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {45, GPA_HIDE_NAME("PA_SU3_045"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 45 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {46, GPA_HIDE_NAME("PA_SU3_046"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 46 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {47, GPA_HIDE_NAME("PA_SU3_047"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 47 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {48, GPA_HIDE_NAME("PA_SU3_048"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 48 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {49, GPA_HIDE_NAME("PA_SU3_049"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 49 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {50, GPA_HIDE_NAME("PA_SU3_050"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 50 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {51, GPA_HIDE_NAME("PA_SU3_051"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 51 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {52, GPA_HIDE_NAME("PA_SU3_052"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 52 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {53, GPA_HIDE_NAME("PA_SU3_053"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 53 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {54, GPA_HIDE_NAME("PA_SU3_PERF_PAPC_SU_ZERO_AREA_CULL_PRIM"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("PERF_PAPC_SU_ZERO_AREA_CULL_PRIM Number of primitives culled due to zero area; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {55, GPA_HIDE_NAME("PA_SU3_PERF_PAPC_SU_BACK_FACE_CULL_PRIM"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("PERF_PAPC_SU_BACK_FACE_CULL_PRIM Number of back-face primitives culled due to facedness; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {56, GPA_HIDE_NAME("PA_SU3_PERF_PAPC_SU_FRONT_FACE_CULL_PRIM"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("PERF_PAPC_SU_FRONT_FACE_CULL_PRIM Number of front-face primitives culled due to facedness; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {57, GPA_HIDE_NAME("PA_SU3_PERF_PAPC_SU_POLYMODE_FACE_CULL"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("PERF_PAPC_SU_POLYMODE_FACE_CULL Number of polymode cull-determination primitives culled; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {58, GPA_HIDE_NAME("PA_SU3_058"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 58 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {59, GPA_HIDE_NAME("PA_SU3_059"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 59 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {60, GPA_HIDE_NAME("PA_SU3_060"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 60 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {61, GPA_HIDE_NAME("PA_SU3_PERF_PAPC_SU_OUTPUT_PRIM"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("PERF_PAPC_SU_OUTPUT_PRIM Number of primitives output from the Setup block; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {62, GPA_HIDE_NAME("PA_SU3_PERF_PAPC_SU_OUTPUT_CLIP_PRIM"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("PERF_PAPC_SU_OUTPUT_CLIP_PRIM Number of clipped primitives output from the Setup block; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {63, GPA_HIDE_NAME("PA_SU3_063"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 63 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {64, GPA_HIDE_NAME("PA_SU3_064"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 64 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {65, GPA_HIDE_NAME("PA_SU3_065"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 65 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {66, GPA_HIDE_NAME("PA_SU3_066"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 66 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {67, GPA_HIDE_NAME("PA_SU3_067"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 67 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {68, GPA_HIDE_NAME("PA_SU3_068"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 68 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {69, GPA_HIDE_NAME("PA_SU3_069"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 69 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {70, GPA_HIDE_NAME("PA_SU3_070"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 70 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {71, GPA_HIDE_NAME("PA_SU3_071"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 71 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {72, GPA_HIDE_NAME("PA_SU3_072"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 72 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {73, GPA_HIDE_NAME("PA_SU3_PERF_PAPC_SU_OUTPUT_PRIM_DUAL"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("PERF_PAPC_SU_OUTPUT_PRIM_DUAL Number of dual gradient primitives output from the Setup block; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {74, GPA_HIDE_NAME("PA_SU3_PERF_PAPC_SU_OUTPUT_CLIP_PRIM_DUAL"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("PERF_PAPC_SU_OUTPUT_CLIP_PRIM_DUAL Number of dual gradient clipped primitives output from the Setup block; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {75, GPA_HIDE_NAME("PA_SU3_075"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 75 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {76, GPA_HIDE_NAME("PA_SU3_076"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 76 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {77, GPA_HIDE_NAME("PA_SU3_077"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 77 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {78, GPA_HIDE_NAME("PA_SU3_078"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 78 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {79, GPA_HIDE_NAME("PA_SU3_079"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 79 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {80, GPA_HIDE_NAME("PA_SU3_080"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 80 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {81, GPA_HIDE_NAME("PA_SU3_081"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 81 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {82, GPA_HIDE_NAME("PA_SU3_082"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 82 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {83, GPA_HIDE_NAME("PA_SU3_083"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 83 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {84, GPA_HIDE_NAME("PA_SU3_084"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 84 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {85, GPA_HIDE_NAME("PA_SU3_085"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 85 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {86, GPA_HIDE_NAME("PA_SU3_086"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 86 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {87, GPA_HIDE_NAME("PA_SU3_087"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 87 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {88, GPA_HIDE_NAME("PA_SU3_088"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 88 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {89, GPA_HIDE_NAME("PA_SU3_089"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 89 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {90, GPA_HIDE_NAME("PA_SU3_090"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 90 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {91, GPA_HIDE_NAME("PA_SU3_091"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 91 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {92, GPA_HIDE_NAME("PA_SU3_092"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 92 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {93, GPA_HIDE_NAME("PA_SU3_093"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 93 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {94, GPA_HIDE_NAME("PA_SU3_094"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 94 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {95, GPA_HIDE_NAME("PA_SU3_095"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 95 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {96, GPA_HIDE_NAME("PA_SU3_096"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 96 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {97, GPA_HIDE_NAME("PA_SU3_097"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 97 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {98, GPA_HIDE_NAME("PA_SU3_098"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 98 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {99, GPA_HIDE_NAME("PA_SU3_099"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 99 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {100, GPA_HIDE_NAME("PA_SU3_100"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 100 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {101, GPA_HIDE_NAME("PA_SU3_101"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 101 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {102, GPA_HIDE_NAME("PA_SU3_102"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 102 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {103, GPA_HIDE_NAME("PA_SU3_103"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 103 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {104, GPA_HIDE_NAME("PA_SU3_104"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 104 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {105, GPA_HIDE_NAME("PA_SU3_PERF_PAPC_CLIP_BUSY"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("PERF_PAPC_CLIP_BUSY Number of clocks Clip is Busy; range-1/clk;it can potentially be used to detect bad performance;all instances report the same result; can be used to detect bottlenecks in combination with other signals"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {106, GPA_HIDE_NAME("PA_SU3_106"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 106 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {107, GPA_HIDE_NAME("PA_SU3_107"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 107 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {108, GPA_HIDE_NAME("PA_SU3_108"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 108 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {109, GPA_HIDE_NAME("PA_SU3_PERF_PAPC_SU_STALLED_SC"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("PERF_PAPC_SU_STALLED_SC Number of clocks Setup is stalled by SC; range-1/clk;it can potentially be used to detect bad performance;all instances report the same result"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {110, GPA_HIDE_NAME("PA_SU3_110"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 110 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {111, GPA_HIDE_NAME("PA_SU3_111"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 111 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {112, GPA_HIDE_NAME("PA_SU3_112"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 112 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {113, GPA_HIDE_NAME("PA_SU3_113"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 113 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {114, GPA_HIDE_NAME("PA_SU3_114"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 114 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {115, GPA_HIDE_NAME("PA_SU3_115"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 115 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {116, GPA_HIDE_NAME("PA_SU3_116"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 116 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {117, GPA_HIDE_NAME("PA_SU3_117"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 117 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {118, GPA_HIDE_NAME("PA_SU3_118"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 118 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {119, GPA_HIDE_NAME("PA_SU3_119"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 119 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {120, GPA_HIDE_NAME("PA_SU3_120"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 120 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {121, GPA_HIDE_NAME("PA_SU3_121"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 121 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {122, GPA_HIDE_NAME("PA_SU3_122"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 122 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {123, GPA_HIDE_NAME("PA_SU3_123"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 123 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {124, GPA_HIDE_NAME("PA_SU3_124"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 124 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {125, GPA_HIDE_NAME("PA_SU3_125"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 125 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {126, GPA_HIDE_NAME("PA_SU3_126"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 126 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {127, GPA_HIDE_NAME("PA_SU3_127"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 127 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {128, GPA_HIDE_NAME("PA_SU3_128"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 128 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {129, GPA_HIDE_NAME("PA_SU3_129"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 129 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {130, GPA_HIDE_NAME("PA_SU3_130"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 130 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {131, GPA_HIDE_NAME("PA_SU3_131"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 131 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {132, GPA_HIDE_NAME("PA_SU3_132"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 132 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {133, GPA_HIDE_NAME("PA_SU3_133"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 133 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {134, GPA_HIDE_NAME("PA_SU3_134"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 134 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {135, GPA_HIDE_NAME("PA_SU3_135"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 135 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {136, GPA_HIDE_NAME("PA_SU3_136"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 136 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {137, GPA_HIDE_NAME("PA_SU3_137"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 137 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {138, GPA_HIDE_NAME("PA_SU3_138"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 138 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {139, GPA_HIDE_NAME("PA_SU3_139"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 139 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {140, GPA_HIDE_NAME("PA_SU3_140"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 140 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {141, GPA_HIDE_NAME("PA_SU3_141"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 141 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {142, GPA_HIDE_NAME("PA_SU3_142"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 142 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {143, GPA_HIDE_NAME("PA_SU3_143"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 143 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {144, GPA_HIDE_NAME("PA_SU3_144"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 144 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {145, GPA_HIDE_NAME("PA_SU3_145"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 145 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {146, GPA_HIDE_NAME("PA_SU3_146"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 146 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {147, GPA_HIDE_NAME("PA_SU3_147"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 147 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {148, GPA_HIDE_NAME("PA_SU3_148"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 148 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {149, GPA_HIDE_NAME("PA_SU3_149"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 149 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {150, GPA_HIDE_NAME("PA_SU3_150"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 150 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {151, GPA_HIDE_NAME("PA_SU3_151"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 151 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {152, GPA_HIDE_NAME("PA_SU3_152"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 152 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {153, GPA_HIDE_NAME("PA_SU3_153"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 153 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {154, GPA_HIDE_NAME("PA_SU3_154"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 154 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {155, GPA_HIDE_NAME("PA_SU3_155"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 155 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {156, GPA_HIDE_NAME("PA_SU3_156"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 156 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {157, GPA_HIDE_NAME("PA_SU3_157"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 157 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {158, GPA_HIDE_NAME("PA_SU3_158"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 158 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {159, GPA_HIDE_NAME("PA_SU3_159"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 159 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {160, GPA_HIDE_NAME("PA_SU3_160"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 160 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {161, GPA_HIDE_NAME("PA_SU3_161"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 161 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {162, GPA_HIDE_NAME("PA_SU3_162"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 162 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {163, GPA_HIDE_NAME("PA_SU3_163"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 163 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {164, GPA_HIDE_NAME("PA_SU3_164"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 164 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {165, GPA_HIDE_NAME("PA_SU3_165"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 165 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {166, GPA_HIDE_NAME("PA_SU3_166"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 166 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {167, GPA_HIDE_NAME("PA_SU3_167"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 167 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {168, GPA_HIDE_NAME("PA_SU3_168"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 168 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {169, GPA_HIDE_NAME("PA_SU3_169"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 169 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {170, GPA_HIDE_NAME("PA_SU3_170"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 170 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {171, GPA_HIDE_NAME("PA_SU3_171"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 171 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {172, GPA_HIDE_NAME("PA_SU3_172"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 172 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {173, GPA_HIDE_NAME("PA_SU3_173"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 173 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {174, GPA_HIDE_NAME("PA_SU3_174"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 174 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {175, GPA_HIDE_NAME("PA_SU3_175"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 175 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {176, GPA_HIDE_NAME("PA_SU3_176"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 176 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {177, GPA_HIDE_NAME("PA_SU3_177"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 177 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {178, GPA_HIDE_NAME("PA_SU3_178"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 178 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {179, GPA_HIDE_NAME("PA_SU3_179"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 179 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {180, GPA_HIDE_NAME("PA_SU3_180"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 180 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {181, GPA_HIDE_NAME("PA_SU3_181"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 181 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {182, GPA_HIDE_NAME("PA_SU3_182"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 182 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {183, GPA_HIDE_NAME("PA_SU3_183"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 183 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {184, GPA_HIDE_NAME("PA_SU3_184"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 184 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {185, GPA_HIDE_NAME("PA_SU3_185"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 185 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {186, GPA_HIDE_NAME("PA_SU3_186"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 186 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {187, GPA_HIDE_NAME("PA_SU3_187"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 187 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {188, GPA_HIDE_NAME("PA_SU3_188"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 188 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {189, GPA_HIDE_NAME("PA_SU3_189"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 189 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {190, GPA_HIDE_NAME("PA_SU3_190"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 190 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {191, GPA_HIDE_NAME("PA_SU3_191"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 191 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {192, GPA_HIDE_NAME("PA_SU3_192"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 192 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {193, GPA_HIDE_NAME("PA_SU3_193"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 193 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {194, GPA_HIDE_NAME("PA_SU3_194"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 194 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {195, GPA_HIDE_NAME("PA_SU3_195"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 195 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {196, GPA_HIDE_NAME("PA_SU3_196"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 196 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {197, GPA_HIDE_NAME("PA_SU3_197"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 197 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {198, GPA_HIDE_NAME("PA_SU3_198"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 198 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {199, GPA_HIDE_NAME("PA_SU3_199"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 199 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {200, GPA_HIDE_NAME("PA_SU3_200"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 200 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {201, GPA_HIDE_NAME("PA_SU3_201"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 201 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {202, GPA_HIDE_NAME("PA_SU3_202"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 202 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {203, GPA_HIDE_NAME("PA_SU3_203"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 203 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {204, GPA_HIDE_NAME("PA_SU3_204"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 204 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {205, GPA_HIDE_NAME("PA_SU3_205"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 205 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {206, GPA_HIDE_NAME("PA_SU3_206"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 206 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {207, GPA_HIDE_NAME("PA_SU3_207"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 207 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {208, GPA_HIDE_NAME("PA_SU3_208"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 208 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {209, GPA_HIDE_NAME("PA_SU3_209"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 209 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {210, GPA_HIDE_NAME("PA_SU3_210"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 210 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {211, GPA_HIDE_NAME("PA_SU3_211"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 211 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {212, GPA_HIDE_NAME("PA_SU3_212"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 212 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {213, GPA_HIDE_NAME("PA_SU3_213"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 213 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {214, GPA_HIDE_NAME("PA_SU3_214"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 214 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {215, GPA_HIDE_NAME("PA_SU3_215"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 215 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {216, GPA_HIDE_NAME("PA_SU3_216"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 216 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {217, GPA_HIDE_NAME("PA_SU3_217"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 217 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {218, GPA_HIDE_NAME("PA_SU3_218"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 218 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {219, GPA_HIDE_NAME("PA_SU3_219"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 219 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {220, GPA_HIDE_NAME("PA_SU3_220"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 220 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {221, GPA_HIDE_NAME("PA_SU3_221"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 221 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {222, GPA_HIDE_NAME("PA_SU3_222"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 222 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {223, GPA_HIDE_NAME("PA_SU3_223"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 223 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {224, GPA_HIDE_NAME("PA_SU3_224"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 224 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {225, GPA_HIDE_NAME("PA_SU3_225"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 225 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {226, GPA_HIDE_NAME("PA_SU3_226"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 226 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {227, GPA_HIDE_NAME("PA_SU3_227"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 227 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {228, GPA_HIDE_NAME("PA_SU3_228"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 228 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {229, GPA_HIDE_NAME("PA_SU3_229"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 229 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {230, GPA_HIDE_NAME("PA_SU3_230"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 230 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {231, GPA_HIDE_NAME("PA_SU3_231"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 231 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {232, GPA_HIDE_NAME("PA_SU3_232"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 232 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {233, GPA_HIDE_NAME("PA_SU3_233"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 233 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {234, GPA_HIDE_NAME("PA_SU3_234"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 234 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {235, GPA_HIDE_NAME("PA_SU3_235"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 235 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {236, GPA_HIDE_NAME("PA_SU3_236"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 236 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {237, GPA_HIDE_NAME("PA_SU3_237"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 237 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {238, GPA_HIDE_NAME("PA_SU3_238"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 238 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {239, GPA_HIDE_NAME("PA_SU3_239"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 239 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {240, GPA_HIDE_NAME("PA_SU3_240"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 240 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {241, GPA_HIDE_NAME("PA_SU3_241"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 241 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {242, GPA_HIDE_NAME("PA_SU3_242"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 242 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {243, GPA_HIDE_NAME("PA_SU3_243"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 243 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {244, GPA_HIDE_NAME("PA_SU3_244"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 244 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {245, GPA_HIDE_NAME("PA_SU3_245"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 245 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {246, GPA_HIDE_NAME("PA_SU3_246"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 246 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {247, GPA_HIDE_NAME("PA_SU3_247"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 247 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {248, GPA_HIDE_NAME("PA_SU3_248"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 248 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {249, GPA_HIDE_NAME("PA_SU3_249"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 249 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {250, GPA_HIDE_NAME("PA_SU3_250"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 250 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {251, GPA_HIDE_NAME("PA_SU3_251"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 251 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {252, GPA_HIDE_NAME("PA_SU3_252"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 252 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {253, GPA_HIDE_NAME("PA_SU3_253"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 253 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {254, GPA_HIDE_NAME("PA_SU3_254"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 254 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {255, GPA_HIDE_NAME("PA_SU3_255"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 255 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {256, GPA_HIDE_NAME("PA_SU3_256"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 256 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {257, GPA_HIDE_NAME("PA_SU3_257"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 257 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {258, GPA_HIDE_NAME("PA_SU3_258"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 258 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {259, GPA_HIDE_NAME("PA_SU3_259"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 259 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {260, GPA_HIDE_NAME("PA_SU3_260"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 260 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {261, GPA_HIDE_NAME("PA_SU3_261"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 261 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {262, GPA_HIDE_NAME("PA_SU3_262"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 262 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {263, GPA_HIDE_NAME("PA_SU3_263"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 263 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {264, GPA_HIDE_NAME("PA_SU3_264"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 264 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {265, GPA_HIDE_NAME("PA_SU3_265"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 265 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {266, GPA_HIDE_NAME("PA_SU3_266"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 266 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {267, GPA_HIDE_NAME("PA_SU3_267"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 267 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {268, GPA_HIDE_NAME("PA_SU3_268"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 268 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {269, GPA_HIDE_NAME("PA_SU3_269"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 269 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {270, GPA_HIDE_NAME("PA_SU3_270"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 270 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {271, GPA_HIDE_NAME("PA_SU3_271"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 271 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {272, GPA_HIDE_NAME("PA_SU3_272"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 272 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {273, GPA_HIDE_NAME("PA_SU3_273"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 273 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {274, GPA_HIDE_NAME("PA_SU3_274"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 274 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {275, GPA_HIDE_NAME("PA_SU3_275"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 275 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {276, GPA_HIDE_NAME("PA_SU3_276"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 276 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {277, GPA_HIDE_NAME("PA_SU3_277"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 277 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {278, GPA_HIDE_NAME("PA_SU3_278"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 278 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {279, GPA_HIDE_NAME("PA_SU3_279"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 279 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {280, GPA_HIDE_NAME("PA_SU3_280"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 280 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {281, GPA_HIDE_NAME("PA_SU3_281"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 281 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {282, GPA_HIDE_NAME("PA_SU3_282"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 282 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {283, GPA_HIDE_NAME("PA_SU3_283"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 283 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {284, GPA_HIDE_NAME("PA_SU3_284"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 284 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {285, GPA_HIDE_NAME("PA_SU3_285"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 285 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {286, GPA_HIDE_NAME("PA_SU3_286"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 286 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {287, GPA_HIDE_NAME("PA_SU3_287"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 287 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {288, GPA_HIDE_NAME("PA_SU3_288"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 288 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {289, GPA_HIDE_NAME("PA_SU3_289"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 289 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {290, GPA_HIDE_NAME("PA_SU3_290"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 290 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {291, GPA_HIDE_NAME("PA_SU3_291"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 291 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {292, GPA_HIDE_NAME("PA_SU3_292"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 292 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {293, GPA_HIDE_NAME("PA_SU3_293"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 293 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {294, GPA_HIDE_NAME("PA_SU3_294"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 294 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {295, GPA_HIDE_NAME("PA_SU3_295"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 295 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {296, GPA_HIDE_NAME("PA_SU3_296"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 296 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {297, GPA_HIDE_NAME("PA_SU3_297"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 297 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {298, GPA_HIDE_NAME("PA_SU3_298"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 298 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {299, GPA_HIDE_NAME("PA_SU3_299"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 299 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {300, GPA_HIDE_NAME("PA_SU3_300"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 300 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {301, GPA_HIDE_NAME("PA_SU3_301"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 301 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {302, GPA_HIDE_NAME("PA_SU3_302"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 302 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {303, GPA_HIDE_NAME("PA_SU3_303"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 303 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {304, GPA_HIDE_NAME("PA_SU3_304"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 304 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {305, GPA_HIDE_NAME("PA_SU3_305"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 305 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {306, GPA_HIDE_NAME("PA_SU3_306"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 306 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {307, GPA_HIDE_NAME("PA_SU3_307"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 307 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {308, GPA_HIDE_NAME("PA_SU3_308"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 308 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {309, GPA_HIDE_NAME("PA_SU3_309"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 309 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {310, GPA_HIDE_NAME("PA_SU3_310"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 310 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {311, GPA_HIDE_NAME("PA_SU3_311"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 311 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {312, GPA_HIDE_NAME("PA_SU3_312"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 312 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {313, GPA_HIDE_NAME("PA_SU3_313"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 313 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {314, GPA_HIDE_NAME("PA_SU3_314"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 314 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {315, GPA_HIDE_NAME("PA_SU3_315"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 315 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {316, GPA_HIDE_NAME("PA_SU3_316"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 316 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {317, GPA_HIDE_NAME("PA_SU3_317"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 317 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {318, GPA_HIDE_NAME("PA_SU3_318"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 318 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {319, GPA_HIDE_NAME("PA_SU3_319"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 319 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {320, GPA_HIDE_NAME("PA_SU3_320"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 320 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {321, GPA_HIDE_NAME("PA_SU3_321"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 321 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {322, GPA_HIDE_NAME("PA_SU3_322"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 322 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {323, GPA_HIDE_NAME("PA_SU3_323"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 323 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {324, GPA_HIDE_NAME("PA_SU3_324"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 324 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {325, GPA_HIDE_NAME("PA_SU3_325"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 325 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {326, GPA_HIDE_NAME("PA_SU3_326"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 326 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {327, GPA_HIDE_NAME("PA_SU3_327"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 327 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {328, GPA_HIDE_NAME("PA_SU3_328"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 328 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {329, GPA_HIDE_NAME("PA_SU3_329"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 329 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {330, GPA_HIDE_NAME("PA_SU3_330"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 330 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {331, GPA_HIDE_NAME("PA_SU3_331"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 331 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {332, GPA_HIDE_NAME("PA_SU3_332"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 332 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {333, GPA_HIDE_NAME("PA_SU3_333"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 333 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {334, GPA_HIDE_NAME("PA_SU3_334"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 334 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {335, GPA_HIDE_NAME("PA_SU3_335"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 335 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {336, GPA_HIDE_NAME("PA_SU3_336"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 336 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {337, GPA_HIDE_NAME("PA_SU3_337"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 337 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {338, GPA_HIDE_NAME("PA_SU3_338"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 338 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {339, GPA_HIDE_NAME("PA_SU3_339"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 339 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {340, GPA_HIDE_NAME("PA_SU3_340"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 340 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {341, GPA_HIDE_NAME("PA_SU3_341"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 341 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {342, GPA_HIDE_NAME("PA_SU3_342"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 342 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {343, GPA_HIDE_NAME("PA_SU3_343"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 343 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {344, GPA_HIDE_NAME("PA_SU3_344"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 344 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {345, GPA_HIDE_NAME("PA_SU3_345"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 345 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {346, GPA_HIDE_NAME("PA_SU3_346"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 346 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {347, GPA_HIDE_NAME("PA_SU3_347"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 347 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {348, GPA_HIDE_NAME("PA_SU3_348"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 348 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {349, GPA_HIDE_NAME("PA_SU3_349"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 349 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {350, GPA_HIDE_NAME("PA_SU3_350"), GPA_HIDE_NAME("PA_SU3"), GPA_HIDE_NAME("Counter 350 from group PA_SU3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-    };
-    GPA_HardwareCounterDesc pa_sc0_counters_gfx9_placeholder4[] = {
-        {0, GPA_HIDE_NAME("PA_SC0_000"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 0 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {1, GPA_HIDE_NAME("PA_SC0_001"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 1 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {2, GPA_HIDE_NAME("PA_SC0_002"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 2 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {3, GPA_HIDE_NAME("PA_SC0_003"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 3 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {4, GPA_HIDE_NAME("PA_SC0_004"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 4 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {5, GPA_HIDE_NAME("PA_SC0_005"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 5 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {6, GPA_HIDE_NAME("PA_SC0_006"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 6 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {7, GPA_HIDE_NAME("PA_SC0_007"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 7 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {8, GPA_HIDE_NAME("PA_SC0_008"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 8 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {9, GPA_HIDE_NAME("PA_SC0_009"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 9 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {10, GPA_HIDE_NAME("PA_SC0_010"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 10 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {11, GPA_HIDE_NAME("PA_SC0_011"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 11 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {12, GPA_HIDE_NAME("PA_SC0_012"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 12 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {13, GPA_HIDE_NAME("PA_SC0_013"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 13 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {14, GPA_HIDE_NAME("PA_SC0_014"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 14 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {15, GPA_HIDE_NAME("PA_SC0_015"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 15 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {16, GPA_HIDE_NAME("PA_SC0_016"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 16 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {17, GPA_HIDE_NAME("PA_SC0_017"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 17 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {18, GPA_HIDE_NAME("PA_SC0_018"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 18 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {19, GPA_HIDE_NAME("PA_SC0_019"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 19 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {20, GPA_HIDE_NAME("PA_SC0_020"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 20 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {21, GPA_HIDE_NAME("PA_SC0_021"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 21 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {22, GPA_HIDE_NAME("PA_SC0_022"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 22 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {23, GPA_HIDE_NAME("PA_SC0_023"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 23 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {24, GPA_HIDE_NAME("PA_SC0_024"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 24 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {25, GPA_HIDE_NAME("PA_SC0_025"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 25 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {26, GPA_HIDE_NAME("PA_SC0_026"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 26 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {27, GPA_HIDE_NAME("PA_SC0_027"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 27 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {28, GPA_HIDE_NAME("PA_SC0_028"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 28 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {29, GPA_HIDE_NAME("PA_SC0_029"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 29 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {30, GPA_HIDE_NAME("PA_SC0_030"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 30 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {31, GPA_HIDE_NAME("PA_SC0_031"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 31 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {32, GPA_HIDE_NAME("PA_SC0_032"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 32 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {33, GPA_HIDE_NAME("PA_SC0_033"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 33 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {34, GPA_HIDE_NAME("PA_SC0_034"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 34 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {35, GPA_HIDE_NAME("PA_SC0_035"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 35 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {36, GPA_HIDE_NAME("PA_SC0_036"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 36 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {37, GPA_HIDE_NAME("PA_SC0_037"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 37 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {38, GPA_HIDE_NAME("PA_SC0_038"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 38 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {39, GPA_HIDE_NAME("PA_SC0_039"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 39 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {40, GPA_HIDE_NAME("PA_SC0_040"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 40 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {41, GPA_HIDE_NAME("PA_SC0_041"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 41 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {42, GPA_HIDE_NAME("PA_SC0_042"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 42 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {43, GPA_HIDE_NAME("PA_SC0_043"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 43 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {44, GPA_HIDE_NAME("PA_SC0_044"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 44 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {45, GPA_HIDE_NAME("PA_SC0_045"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 45 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {46, GPA_HIDE_NAME("PA_SC0_046"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 46 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {47, GPA_HIDE_NAME("PA_SC0_047"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 47 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {48, GPA_HIDE_NAME("PA_SC0_048"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 48 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {49, GPA_HIDE_NAME("PA_SC0_049"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 49 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {50, GPA_HIDE_NAME("PA_SC0_050"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 50 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {51, GPA_HIDE_NAME("PA_SC0_051"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 51 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {52, GPA_HIDE_NAME("PA_SC0_052"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 52 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {53, GPA_HIDE_NAME("PA_SC0_053"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 53 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {54, GPA_HIDE_NAME("PA_SC0_054"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 54 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {55, GPA_HIDE_NAME("PA_SC0_055"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 55 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {56, GPA_HIDE_NAME("PA_SC0_056"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 56 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {57, GPA_HIDE_NAME("PA_SC0_057"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 57 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {58, GPA_HIDE_NAME("PA_SC0_058"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 58 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {59, GPA_HIDE_NAME("PA_SC0_059"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 59 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {60, GPA_HIDE_NAME("PA_SC0_060"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 60 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {61, GPA_HIDE_NAME("PA_SC0_061"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 61 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {62, GPA_HIDE_NAME("PA_SC0_062"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 62 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {63, GPA_HIDE_NAME("PA_SC0_063"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 63 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {64, GPA_HIDE_NAME("PA_SC0_064"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 64 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {65, GPA_HIDE_NAME("PA_SC0_065"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 65 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {66, GPA_HIDE_NAME("PA_SC0_066"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 66 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {67, GPA_HIDE_NAME("PA_SC0_067"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 67 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {68, GPA_HIDE_NAME("PA_SC0_068"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 68 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {69, GPA_HIDE_NAME("PA_SC0_069"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 69 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {70, GPA_HIDE_NAME("PA_SC0_070"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 70 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {71, GPA_HIDE_NAME("PA_SC0_071"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 71 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {72, GPA_HIDE_NAME("PA_SC0_072"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 72 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {73, GPA_HIDE_NAME("PA_SC0_073"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 73 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {74, GPA_HIDE_NAME("PA_SC0_074"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 74 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {75, GPA_HIDE_NAME("PA_SC0_075"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 75 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {76, GPA_HIDE_NAME("PA_SC0_076"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 76 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {77, GPA_HIDE_NAME("PA_SC0_077"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 77 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {78, GPA_HIDE_NAME("PA_SC0_078"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 78 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {79, GPA_HIDE_NAME("PA_SC0_079"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 79 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {80, GPA_HIDE_NAME("PA_SC0_080"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 80 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {81, GPA_HIDE_NAME("PA_SC0_081"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 81 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {82, GPA_HIDE_NAME("PA_SC0_082"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 82 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {83, GPA_HIDE_NAME("PA_SC0_083"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 83 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {84, GPA_HIDE_NAME("PA_SC0_084"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 84 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {85, GPA_HIDE_NAME("PA_SC0_085"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 85 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {86, GPA_HIDE_NAME("PA_SC0_086"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 86 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {87, GPA_HIDE_NAME("PA_SC0_087"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 87 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {88, GPA_HIDE_NAME("PA_SC0_088"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 88 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {89, GPA_HIDE_NAME("PA_SC0_089"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 89 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {90, GPA_HIDE_NAME("PA_SC0_090"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 90 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {91, GPA_HIDE_NAME("PA_SC0_091"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 91 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {92, GPA_HIDE_NAME("PA_SC0_092"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 92 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {93, GPA_HIDE_NAME("PA_SC0_093"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 93 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {94, GPA_HIDE_NAME("PA_SC0_094"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 94 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {95, GPA_HIDE_NAME("PA_SC0_095"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 95 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {96, GPA_HIDE_NAME("PA_SC0_096"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 96 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {97, GPA_HIDE_NAME("PA_SC0_097"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 97 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {98, GPA_HIDE_NAME("PA_SC0_098"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 98 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {99, GPA_HIDE_NAME("PA_SC0_099"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 99 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {100, GPA_HIDE_NAME("PA_SC0_100"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 100 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {101, GPA_HIDE_NAME("PA_SC0_101"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 101 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {102, GPA_HIDE_NAME("PA_SC0_102"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 102 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {103, GPA_HIDE_NAME("PA_SC0_103"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 103 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {104, GPA_HIDE_NAME("PA_SC0_104"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 104 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {105, GPA_HIDE_NAME("PA_SC0_105"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 105 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {106, GPA_HIDE_NAME("PA_SC0_106"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 106 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {107, GPA_HIDE_NAME("PA_SC0_107"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 107 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {108, GPA_HIDE_NAME("PA_SC0_108"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 108 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {109, GPA_HIDE_NAME("PA_SC0_109"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 109 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {110, GPA_HIDE_NAME("PA_SC0_110"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 110 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {111, GPA_HIDE_NAME("PA_SC0_111"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 111 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {112, GPA_HIDE_NAME("PA_SC0_112"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 112 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {113, GPA_HIDE_NAME("PA_SC0_113"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 113 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {114, GPA_HIDE_NAME("PA_SC0_114"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 114 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {115, GPA_HIDE_NAME("PA_SC0_115"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 115 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {116, GPA_HIDE_NAME("PA_SC0_116"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 116 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {117, GPA_HIDE_NAME("PA_SC0_117"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 117 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {118, GPA_HIDE_NAME("PA_SC0_118"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 118 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {119, GPA_HIDE_NAME("PA_SC0_119"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 119 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {120, GPA_HIDE_NAME("PA_SC0_120"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 120 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {121, GPA_HIDE_NAME("PA_SC0_121"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 121 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {122, GPA_HIDE_NAME("PA_SC0_122"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 122 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {123, GPA_HIDE_NAME("PA_SC0_123"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 123 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {124, GPA_HIDE_NAME("PA_SC0_124"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 124 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {125, GPA_HIDE_NAME("PA_SC0_125"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 125 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {126, GPA_HIDE_NAME("PA_SC0_126"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 126 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {127, GPA_HIDE_NAME("PA_SC0_127"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 127 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {128, GPA_HIDE_NAME("PA_SC0_128"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 128 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {129, GPA_HIDE_NAME("PA_SC0_129"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 129 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {130, GPA_HIDE_NAME("PA_SC0_130"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 130 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {131, GPA_HIDE_NAME("PA_SC0_131"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 131 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {132, GPA_HIDE_NAME("PA_SC0_132"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 132 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {133, GPA_HIDE_NAME("PA_SC0_133"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 133 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {134, GPA_HIDE_NAME("PA_SC0_134"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 134 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {135, GPA_HIDE_NAME("PA_SC0_135"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 135 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {136, GPA_HIDE_NAME("PA_SC0_136"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 136 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {137, GPA_HIDE_NAME("PA_SC0_137"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 137 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {138, GPA_HIDE_NAME("PA_SC0_138"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 138 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {139, GPA_HIDE_NAME("PA_SC0_139"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 139 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {140, GPA_HIDE_NAME("PA_SC0_140"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 140 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {141, GPA_HIDE_NAME("PA_SC0_141"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 141 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {142, GPA_HIDE_NAME("PA_SC0_142"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 142 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {143, GPA_HIDE_NAME("PA_SC0_143"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 143 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {144, GPA_HIDE_NAME("PA_SC0_144"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 144 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {145, GPA_HIDE_NAME("PA_SC0_145"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 145 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {146, GPA_HIDE_NAME("PA_SC0_146"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 146 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {147, GPA_HIDE_NAME("PA_SC0_147"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 147 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {148, GPA_HIDE_NAME("PA_SC0_148"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 148 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {149, GPA_HIDE_NAME("PA_SC0_149"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 149 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {150, GPA_HIDE_NAME("PA_SC0_150"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 150 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {151, GPA_HIDE_NAME("PA_SC0_151"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 151 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {152, GPA_HIDE_NAME("PA_SC0_152"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 152 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {153, GPA_HIDE_NAME("PA_SC0_153"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 153 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {154, GPA_HIDE_NAME("PA_SC0_154"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 154 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {155, GPA_HIDE_NAME("PA_SC0_155"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 155 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {156, GPA_HIDE_NAME("PA_SC0_156"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 156 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {157, GPA_HIDE_NAME("PA_SC0_157"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 157 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {158, GPA_HIDE_NAME("PA_SC0_158"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 158 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {159, GPA_HIDE_NAME("PA_SC0_QZ0_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("quad count; quad-z pipe 0;Where measured: sc sc_qdmsk_z output to sc_z_interp in db pipe 0;increment rate-one to 16  per clock;range-1/clk;CONTEXT_STATE_SENSITIVE=YES;Results reported per SE, INSTANCE_INDEX=0 to num_packer_per_sc-1."), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {160, GPA_HIDE_NAME("PA_SC0_QZ1_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("quad count; quad-z pipe 1;Where measured: sc sc_qdmsk_z output to sc_z_interp in db pipe 1;increment rate-one to 16 per clock;range-1/clk;CONTEXT_STATE_SENSITIVE=YES;Results reported per SE, INSTANCE_INDEX=0 to num_packer_per_sc-1. Valid only if NUM_DB_PER_PACKER=2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {161, GPA_HIDE_NAME("PA_SC0_QZ2_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("quad count; quad-z pipe 2 DEPRECATED (NUM_DB_PER_PACKER=4 variants only)"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {162, GPA_HIDE_NAME("PA_SC0_QZ3_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("quad count; quad-z pipe 3 DEPRECATED (NUM_DB_PER_PACKER=4 variants only)"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {163, GPA_HIDE_NAME("PA_SC0_163"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 163 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {164, GPA_HIDE_NAME("PA_SC0_164"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 164 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {165, GPA_HIDE_NAME("PA_SC0_165"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 165 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {166, GPA_HIDE_NAME("PA_SC0_166"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 166 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {167, GPA_HIDE_NAME("PA_SC0_167"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 167 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {168, GPA_HIDE_NAME("PA_SC0_168"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 168 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {169, GPA_HIDE_NAME("PA_SC0_169"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 169 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {170, GPA_HIDE_NAME("PA_SC0_170"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 170 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {171, GPA_HIDE_NAME("PA_SC0_171"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 171 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {172, GPA_HIDE_NAME("PA_SC0_172"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 172 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {173, GPA_HIDE_NAME("PA_SC0_173"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 173 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {174, GPA_HIDE_NAME("PA_SC0_174"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 174 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {175, GPA_HIDE_NAME("PA_SC0_175"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 175 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {176, GPA_HIDE_NAME("PA_SC0_176"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 176 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {177, GPA_HIDE_NAME("PA_SC0_177"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 177 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {178, GPA_HIDE_NAME("PA_SC0_178"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 178 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {179, GPA_HIDE_NAME("PA_SC0_179"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 179 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {180, GPA_HIDE_NAME("PA_SC0_180"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 180 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {181, GPA_HIDE_NAME("PA_SC0_181"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 181 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {182, GPA_HIDE_NAME("PA_SC0_182"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 182 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {183, GPA_HIDE_NAME("PA_SC0_183"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 183 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {184, GPA_HIDE_NAME("PA_SC0_184"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 184 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {185, GPA_HIDE_NAME("PA_SC0_185"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 185 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {186, GPA_HIDE_NAME("PA_SC0_186"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 186 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {187, GPA_HIDE_NAME("PA_SC0_187"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 187 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {188, GPA_HIDE_NAME("PA_SC0_188"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 188 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {189, GPA_HIDE_NAME("PA_SC0_189"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 189 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {190, GPA_HIDE_NAME("PA_SC0_190"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 190 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {191, GPA_HIDE_NAME("PA_SC0_191"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 191 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {192, GPA_HIDE_NAME("PA_SC0_192"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 192 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {193, GPA_HIDE_NAME("PA_SC0_193"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 193 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {194, GPA_HIDE_NAME("PA_SC0_194"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 194 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {195, GPA_HIDE_NAME("PA_SC0_195"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 195 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {196, GPA_HIDE_NAME("PA_SC0_196"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 196 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {197, GPA_HIDE_NAME("PA_SC0_197"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 197 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {198, GPA_HIDE_NAME("PA_SC0_198"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 198 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {199, GPA_HIDE_NAME("PA_SC0_199"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 199 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {200, GPA_HIDE_NAME("PA_SC0_200"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 200 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {201, GPA_HIDE_NAME("PA_SC0_201"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 201 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {202, GPA_HIDE_NAME("PA_SC0_202"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 202 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {203, GPA_HIDE_NAME("PA_SC0_203"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 203 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {204, GPA_HIDE_NAME("PA_SC0_204"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 204 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {205, GPA_HIDE_NAME("PA_SC0_205"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 205 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {206, GPA_HIDE_NAME("PA_SC0_206"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 206 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {207, GPA_HIDE_NAME("PA_SC0_207"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 207 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {208, GPA_HIDE_NAME("PA_SC0_208"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 208 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {209, GPA_HIDE_NAME("PA_SC0_209"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 209 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {210, GPA_HIDE_NAME("PA_SC0_210"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 210 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {211, GPA_HIDE_NAME("PA_SC0_211"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 211 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {212, GPA_HIDE_NAME("PA_SC0_212"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 212 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {213, GPA_HIDE_NAME("PA_SC0_213"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 213 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {214, GPA_HIDE_NAME("PA_SC0_214"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 214 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {215, GPA_HIDE_NAME("PA_SC0_215"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 215 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {216, GPA_HIDE_NAME("PA_SC0_216"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 216 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {217, GPA_HIDE_NAME("PA_SC0_217"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 217 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {218, GPA_HIDE_NAME("PA_SC0_218"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 218 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {219, GPA_HIDE_NAME("PA_SC0_219"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 219 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {220, GPA_HIDE_NAME("PA_SC0_220"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 220 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {221, GPA_HIDE_NAME("PA_SC0_221"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 221 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {222, GPA_HIDE_NAME("PA_SC0_222"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 222 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {223, GPA_HIDE_NAME("PA_SC0_223"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 223 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {224, GPA_HIDE_NAME("PA_SC0_224"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 224 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {225, GPA_HIDE_NAME("PA_SC0_225"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 225 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {226, GPA_HIDE_NAME("PA_SC0_226"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 226 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {227, GPA_HIDE_NAME("PA_SC0_227"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 227 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {228, GPA_HIDE_NAME("PA_SC0_228"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 228 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {229, GPA_HIDE_NAME("PA_SC0_229"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 229 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {230, GPA_HIDE_NAME("PA_SC0_230"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 230 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {231, GPA_HIDE_NAME("PA_SC0_231"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 231 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {232, GPA_HIDE_NAME("PA_SC0_232"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 232 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {233, GPA_HIDE_NAME("PA_SC0_233"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 233 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {234, GPA_HIDE_NAME("PA_SC0_234"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 234 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {235, GPA_HIDE_NAME("PA_SC0_P0_HIZ_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("total quads surviving hi-z; db pipe 0;Where measured: sc sc_quad_proc usc_tile_mask_return_fifo in db pipe 1;increment rate-one per clock;range-1/clk;CONTEXT_STATE_SENSITIVE=YES;Results reported per SE, INSTANCE_INDEX=0 to num_packer_per_sc-1;"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {236, GPA_HIDE_NAME("PA_SC0_P1_HIZ_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("total quads surviving hi-z; db pipe 1;Where measured: sc sc_quad_proc usc_tile_mask_return_fifo in db pipe 1;increment rate-one per clock;range-1/clk;CONTEXT_STATE_SENSITIVE=YES;Results reported per SE, INSTANCE_INDEX=0 to num_packer_per_sc-1. Valid only if NUM_DB_PER_PACKER=2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {237, GPA_HIDE_NAME("PA_SC0_P2_HIZ_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("total quads surviving hi-z; db pipe 2 (DEPRECATED only valid for NUM_DB_PER_PACKER=4)"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {238, GPA_HIDE_NAME("PA_SC0_P3_HIZ_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("total quads surviving hi-z; db pipe 3 (DEPRECATED only valid for NUM_DB_PER_PACKER=4)"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {239, GPA_HIDE_NAME("PA_SC0_239"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 239 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {240, GPA_HIDE_NAME("PA_SC0_240"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 240 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {241, GPA_HIDE_NAME("PA_SC0_241"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 241 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {242, GPA_HIDE_NAME("PA_SC0_242"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 242 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {243, GPA_HIDE_NAME("PA_SC0_243"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 243 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {244, GPA_HIDE_NAME("PA_SC0_244"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 244 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {245, GPA_HIDE_NAME("PA_SC0_245"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 245 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {246, GPA_HIDE_NAME("PA_SC0_246"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 246 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {247, GPA_HIDE_NAME("PA_SC0_247"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 247 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {248, GPA_HIDE_NAME("PA_SC0_248"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 248 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {249, GPA_HIDE_NAME("PA_SC0_249"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 249 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {250, GPA_HIDE_NAME("PA_SC0_250"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 250 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {251, GPA_HIDE_NAME("PA_SC0_251"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 251 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {252, GPA_HIDE_NAME("PA_SC0_252"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 252 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {253, GPA_HIDE_NAME("PA_SC0_253"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 253 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {254, GPA_HIDE_NAME("PA_SC0_254"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 254 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {255, GPA_HIDE_NAME("PA_SC0_255"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 255 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {256, GPA_HIDE_NAME("PA_SC0_256"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 256 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {257, GPA_HIDE_NAME("PA_SC0_257"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 257 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {258, GPA_HIDE_NAME("PA_SC0_258"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 258 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {259, GPA_HIDE_NAME("PA_SC0_EARLYZ_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("total quads surviving early-z;Where measured: sc_tileaccum (sc_quadaccum if 1db per packer) inputs to packer;increment rate 1 to 2 quads per clock;range-1/clk;CONTEXT_STATE_SENSITIVE=YES;Results reported per SE, INSTANCE_INDEX=0 to num_packer_per_sc-1."), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {260, GPA_HIDE_NAME("PA_SC0_260"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 260 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {261, GPA_HIDE_NAME("PA_SC0_261"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 261 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {262, GPA_HIDE_NAME("PA_SC0_262"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 262 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {263, GPA_HIDE_NAME("PA_SC0_263"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 263 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {264, GPA_HIDE_NAME("PA_SC0_264"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 264 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {265, GPA_HIDE_NAME("PA_SC0_265"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 265 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {266, GPA_HIDE_NAME("PA_SC0_266"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 266 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {267, GPA_HIDE_NAME("PA_SC0_267"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 267 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {268, GPA_HIDE_NAME("PA_SC0_268"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 268 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {269, GPA_HIDE_NAME("PA_SC0_269"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 269 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {270, GPA_HIDE_NAME("PA_SC0_270"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 270 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {271, GPA_HIDE_NAME("PA_SC0_271"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 271 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {272, GPA_HIDE_NAME("PA_SC0_272"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 272 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {273, GPA_HIDE_NAME("PA_SC0_273"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 273 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {274, GPA_HIDE_NAME("PA_SC0_274"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 274 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {275, GPA_HIDE_NAME("PA_SC0_275"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 275 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {276, GPA_HIDE_NAME("PA_SC0_276"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 276 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {277, GPA_HIDE_NAME("PA_SC0_277"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 277 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {278, GPA_HIDE_NAME("PA_SC0_278"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 278 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {279, GPA_HIDE_NAME("PA_SC0_279"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 279 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {280, GPA_HIDE_NAME("PA_SC0_280"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 280 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {281, GPA_HIDE_NAME("PA_SC0_281"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 281 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {282, GPA_HIDE_NAME("PA_SC0_282"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 282 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {283, GPA_HIDE_NAME("PA_SC0_283"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 283 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {284, GPA_HIDE_NAME("PA_SC0_284"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 284 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {285, GPA_HIDE_NAME("PA_SC0_285"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 285 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {286, GPA_HIDE_NAME("PA_SC0_286"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 286 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {287, GPA_HIDE_NAME("PA_SC0_287"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 287 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {288, GPA_HIDE_NAME("PA_SC0_288"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 288 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {289, GPA_HIDE_NAME("PA_SC0_289"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 289 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {290, GPA_HIDE_NAME("PA_SC0_290"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 290 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {291, GPA_HIDE_NAME("PA_SC0_291"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 291 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {292, GPA_HIDE_NAME("PA_SC0_292"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 292 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {293, GPA_HIDE_NAME("PA_SC0_293"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 293 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {294, GPA_HIDE_NAME("PA_SC0_294"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 294 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {295, GPA_HIDE_NAME("PA_SC0_295"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 295 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {296, GPA_HIDE_NAME("PA_SC0_296"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 296 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {297, GPA_HIDE_NAME("PA_SC0_297"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 297 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {298, GPA_HIDE_NAME("PA_SC0_298"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 298 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {299, GPA_HIDE_NAME("PA_SC0_299"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 299 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {300, GPA_HIDE_NAME("PA_SC0_300"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 300 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {301, GPA_HIDE_NAME("PA_SC0_301"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 301 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {302, GPA_HIDE_NAME("PA_SC0_302"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 302 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {303, GPA_HIDE_NAME("PA_SC0_303"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 303 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {304, GPA_HIDE_NAME("PA_SC0_304"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 304 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {305, GPA_HIDE_NAME("PA_SC0_305"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 305 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {306, GPA_HIDE_NAME("PA_SC0_306"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 306 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {307, GPA_HIDE_NAME("PA_SC0_307"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 307 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {308, GPA_HIDE_NAME("PA_SC0_308"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 308 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {309, GPA_HIDE_NAME("PA_SC0_309"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 309 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {310, GPA_HIDE_NAME("PA_SC0_310"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 310 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {311, GPA_HIDE_NAME("PA_SC0_311"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 311 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {312, GPA_HIDE_NAME("PA_SC0_312"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 312 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {313, GPA_HIDE_NAME("PA_SC0_313"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 313 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {314, GPA_HIDE_NAME("PA_SC0_314"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 314 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {315, GPA_HIDE_NAME("PA_SC0_315"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 315 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {316, GPA_HIDE_NAME("PA_SC0_316"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 316 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {317, GPA_HIDE_NAME("PA_SC0_317"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 317 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {318, GPA_HIDE_NAME("PA_SC0_318"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 318 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {319, GPA_HIDE_NAME("PA_SC0_319"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 319 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {320, GPA_HIDE_NAME("PA_SC0_320"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 320 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {321, GPA_HIDE_NAME("PA_SC0_321"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 321 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {322, GPA_HIDE_NAME("PA_SC0_322"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 322 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {323, GPA_HIDE_NAME("PA_SC0_323"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 323 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {324, GPA_HIDE_NAME("PA_SC0_324"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 324 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {325, GPA_HIDE_NAME("PA_SC0_325"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 325 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {326, GPA_HIDE_NAME("PA_SC0_326"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 326 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {327, GPA_HIDE_NAME("PA_SC0_327"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 327 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {328, GPA_HIDE_NAME("PA_SC0_328"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 328 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {329, GPA_HIDE_NAME("PA_SC0_329"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 329 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {330, GPA_HIDE_NAME("PA_SC0_330"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 330 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {331, GPA_HIDE_NAME("PA_SC0_331"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 331 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {332, GPA_HIDE_NAME("PA_SC0_332"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 332 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {333, GPA_HIDE_NAME("PA_SC0_333"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 333 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {334, GPA_HIDE_NAME("PA_SC0_334"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 334 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {335, GPA_HIDE_NAME("PA_SC0_335"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 335 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {336, GPA_HIDE_NAME("PA_SC0_336"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 336 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {337, GPA_HIDE_NAME("PA_SC0_337"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 337 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {338, GPA_HIDE_NAME("PA_SC0_338"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 338 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {339, GPA_HIDE_NAME("PA_SC0_339"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 339 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {340, GPA_HIDE_NAME("PA_SC0_340"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 340 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {341, GPA_HIDE_NAME("PA_SC0_341"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 341 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {342, GPA_HIDE_NAME("PA_SC0_342"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 342 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {343, GPA_HIDE_NAME("PA_SC0_343"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 343 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {344, GPA_HIDE_NAME("PA_SC0_344"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 344 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {345, GPA_HIDE_NAME("PA_SC0_345"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 345 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {346, GPA_HIDE_NAME("PA_SC0_346"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 346 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {347, GPA_HIDE_NAME("PA_SC0_347"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 347 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {348, GPA_HIDE_NAME("PA_SC0_348"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 348 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {349, GPA_HIDE_NAME("PA_SC0_349"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 349 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {350, GPA_HIDE_NAME("PA_SC0_350"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 350 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {351, GPA_HIDE_NAME("PA_SC0_351"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 351 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {352, GPA_HIDE_NAME("PA_SC0_352"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 352 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {353, GPA_HIDE_NAME("PA_SC0_353"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 353 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {354, GPA_HIDE_NAME("PA_SC0_354"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 354 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {355, GPA_HIDE_NAME("PA_SC0_355"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 355 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {356, GPA_HIDE_NAME("PA_SC0_356"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 356 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {357, GPA_HIDE_NAME("PA_SC0_357"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 357 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {358, GPA_HIDE_NAME("PA_SC0_358"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 358 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {359, GPA_HIDE_NAME("PA_SC0_359"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 359 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {360, GPA_HIDE_NAME("PA_SC0_360"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 360 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {361, GPA_HIDE_NAME("PA_SC0_361"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 361 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {362, GPA_HIDE_NAME("PA_SC0_362"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 362 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {363, GPA_HIDE_NAME("PA_SC0_363"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 363 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {364, GPA_HIDE_NAME("PA_SC0_364"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 364 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {365, GPA_HIDE_NAME("PA_SC0_365"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 365 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {366, GPA_HIDE_NAME("PA_SC0_366"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 366 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {367, GPA_HIDE_NAME("PA_SC0_367"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 367 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {368, GPA_HIDE_NAME("PA_SC0_368"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 368 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {369, GPA_HIDE_NAME("PA_SC0_369"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 369 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {370, GPA_HIDE_NAME("PA_SC0_370"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 370 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {371, GPA_HIDE_NAME("PA_SC0_371"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 371 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {372, GPA_HIDE_NAME("PA_SC0_372"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 372 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {373, GPA_HIDE_NAME("PA_SC0_373"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 373 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {374, GPA_HIDE_NAME("PA_SC0_374"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 374 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {375, GPA_HIDE_NAME("PA_SC0_375"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 375 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {376, GPA_HIDE_NAME("PA_SC0_376"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 376 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {377, GPA_HIDE_NAME("PA_SC0_377"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 377 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {378, GPA_HIDE_NAME("PA_SC0_378"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 378 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {379, GPA_HIDE_NAME("PA_SC0_379"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 379 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {380, GPA_HIDE_NAME("PA_SC0_380"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 380 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {381, GPA_HIDE_NAME("PA_SC0_381"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 381 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {382, GPA_HIDE_NAME("PA_SC0_382"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 382 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {383, GPA_HIDE_NAME("PA_SC0_383"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 383 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {384, GPA_HIDE_NAME("PA_SC0_384"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 384 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {385, GPA_HIDE_NAME("PA_SC0_385"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 385 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {386, GPA_HIDE_NAME("PA_SC0_386"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 386 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {387, GPA_HIDE_NAME("PA_SC0_387"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 387 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {388, GPA_HIDE_NAME("PA_SC0_388"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 388 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {389, GPA_HIDE_NAME("PA_SC0_389"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 389 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {390, GPA_HIDE_NAME("PA_SC0_390"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 390 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {391, GPA_HIDE_NAME("PA_SC0_391"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 391 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {392, GPA_HIDE_NAME("PA_SC0_392"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 392 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {393, GPA_HIDE_NAME("PA_SC0_393"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 393 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {394, GPA_HIDE_NAME("PA_SC0_394"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 394 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {395, GPA_HIDE_NAME("PA_SC0_395"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 395 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {396, GPA_HIDE_NAME("PA_SC0_396"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 396 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {397, GPA_HIDE_NAME("PA_SC0_397"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 397 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {398, GPA_HIDE_NAME("PA_SC0_398"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 398 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {399, GPA_HIDE_NAME("PA_SC0_399"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 399 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {400, GPA_HIDE_NAME("PA_SC0_400"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 400 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {401, GPA_HIDE_NAME("PA_SC0_401"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 401 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {402, GPA_HIDE_NAME("PA_SC0_402"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 402 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {403, GPA_HIDE_NAME("PA_SC0_403"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 403 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {404, GPA_HIDE_NAME("PA_SC0_404"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 404 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {405, GPA_HIDE_NAME("PA_SC0_405"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 405 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {406, GPA_HIDE_NAME("PA_SC0_406"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 406 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {407, GPA_HIDE_NAME("PA_SC0_407"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 407 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {408, GPA_HIDE_NAME("PA_SC0_408"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 408 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {409, GPA_HIDE_NAME("PA_SC0_409"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 409 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {410, GPA_HIDE_NAME("PA_SC0_410"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 410 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {411, GPA_HIDE_NAME("PA_SC0_411"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 411 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {412, GPA_HIDE_NAME("PA_SC0_412"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 412 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {413, GPA_HIDE_NAME("PA_SC0_413"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 413 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {414, GPA_HIDE_NAME("PA_SC0_414"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 414 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {415, GPA_HIDE_NAME("PA_SC0_415"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 415 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {416, GPA_HIDE_NAME("PA_SC0_416"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 416 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {417, GPA_HIDE_NAME("PA_SC0_417"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 417 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {418, GPA_HIDE_NAME("PA_SC0_418"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 418 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {419, GPA_HIDE_NAME("PA_SC0_419"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 419 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {420, GPA_HIDE_NAME("PA_SC0_420"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 420 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {421, GPA_HIDE_NAME("PA_SC0_421"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 421 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {422, GPA_HIDE_NAME("PA_SC0_422"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 422 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {423, GPA_HIDE_NAME("PA_SC0_423"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 423 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {424, GPA_HIDE_NAME("PA_SC0_424"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 424 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {425, GPA_HIDE_NAME("PA_SC0_425"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 425 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {426, GPA_HIDE_NAME("PA_SC0_426"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 426 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {427, GPA_HIDE_NAME("PA_SC0_427"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 427 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {428, GPA_HIDE_NAME("PA_SC0_428"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 428 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {429, GPA_HIDE_NAME("PA_SC0_429"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 429 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {430, GPA_HIDE_NAME("PA_SC0_430"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 430 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {431, GPA_HIDE_NAME("PA_SC0_431"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 431 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {432, GPA_HIDE_NAME("PA_SC0_432"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 432 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {433, GPA_HIDE_NAME("PA_SC0_433"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 433 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {434, GPA_HIDE_NAME("PA_SC0_434"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 434 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {435, GPA_HIDE_NAME("PA_SC0_435"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 435 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {436, GPA_HIDE_NAME("PA_SC0_436"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 436 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {437, GPA_HIDE_NAME("PA_SC0_437"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 437 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {438, GPA_HIDE_NAME("PA_SC0_438"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 438 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {439, GPA_HIDE_NAME("PA_SC0_439"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 439 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {440, GPA_HIDE_NAME("PA_SC0_440"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 440 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {441, GPA_HIDE_NAME("PA_SC0_441"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 441 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {442, GPA_HIDE_NAME("PA_SC0_442"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 442 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {443, GPA_HIDE_NAME("PA_SC0_443"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 443 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {444, GPA_HIDE_NAME("PA_SC0_444"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 444 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {445, GPA_HIDE_NAME("PA_SC0_445"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 445 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {446, GPA_HIDE_NAME("PA_SC0_446"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 446 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {447, GPA_HIDE_NAME("PA_SC0_447"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 447 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {448, GPA_HIDE_NAME("PA_SC0_448"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 448 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {449, GPA_HIDE_NAME("PA_SC0_449"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 449 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {450, GPA_HIDE_NAME("PA_SC0_450"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 450 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {451, GPA_HIDE_NAME("PA_SC0_451"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 451 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {452, GPA_HIDE_NAME("PA_SC0_452"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 452 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {453, GPA_HIDE_NAME("PA_SC0_453"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 453 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {454, GPA_HIDE_NAME("PA_SC0_454"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 454 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {455, GPA_HIDE_NAME("PA_SC0_455"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 455 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {456, GPA_HIDE_NAME("PA_SC0_456"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 456 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {457, GPA_HIDE_NAME("PA_SC0_457"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 457 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {458, GPA_HIDE_NAME("PA_SC0_458"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 458 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {459, GPA_HIDE_NAME("PA_SC0_459"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 459 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {460, GPA_HIDE_NAME("PA_SC0_460"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 460 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {461, GPA_HIDE_NAME("PA_SC0_461"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 461 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {462, GPA_HIDE_NAME("PA_SC0_462"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 462 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {463, GPA_HIDE_NAME("PA_SC0_463"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 463 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {464, GPA_HIDE_NAME("PA_SC0_464"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 464 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {465, GPA_HIDE_NAME("PA_SC0_465"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 465 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {466, GPA_HIDE_NAME("PA_SC0_466"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 466 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {467, GPA_HIDE_NAME("PA_SC0_467"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 467 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {468, GPA_HIDE_NAME("PA_SC0_468"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 468 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {469, GPA_HIDE_NAME("PA_SC0_469"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 469 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {470, GPA_HIDE_NAME("PA_SC0_470"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 470 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {471, GPA_HIDE_NAME("PA_SC0_471"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 471 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {472, GPA_HIDE_NAME("PA_SC0_472"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 472 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {473, GPA_HIDE_NAME("PA_SC0_473"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 473 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {474, GPA_HIDE_NAME("PA_SC0_474"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 474 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {475, GPA_HIDE_NAME("PA_SC0_475"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 475 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {476, GPA_HIDE_NAME("PA_SC0_476"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 476 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {477, GPA_HIDE_NAME("PA_SC0_477"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 477 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {478, GPA_HIDE_NAME("PA_SC0_478"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 478 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {479, GPA_HIDE_NAME("PA_SC0_479"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 479 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {480, GPA_HIDE_NAME("PA_SC0_480"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 480 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {481, GPA_HIDE_NAME("PA_SC0_481"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 481 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {482, GPA_HIDE_NAME("PA_SC0_482"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 482 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {483, GPA_HIDE_NAME("PA_SC0_483"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 483 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {484, GPA_HIDE_NAME("PA_SC0_484"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 484 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {485, GPA_HIDE_NAME("PA_SC0_485"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 485 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {486, GPA_HIDE_NAME("PA_SC0_486"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 486 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {487, GPA_HIDE_NAME("PA_SC0_487"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 487 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {488, GPA_HIDE_NAME("PA_SC0_488"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 488 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {489, GPA_HIDE_NAME("PA_SC0_489"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 489 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {490, GPA_HIDE_NAME("PA_SC0_490"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 490 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {491, GPA_HIDE_NAME("PA_SC0_491"), GPA_HIDE_NAME("PA_SC0"), GPA_HIDE_NAME("Counter 491 from group PA_SC0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-    };
-    GPA_HardwareCounterDesc pa_sc1_counters_gfx9_placeholder4[] = {
-        {0, GPA_HIDE_NAME("PA_SC1_000"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 0 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {1, GPA_HIDE_NAME("PA_SC1_001"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 1 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {2, GPA_HIDE_NAME("PA_SC1_002"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 2 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {3, GPA_HIDE_NAME("PA_SC1_003"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 3 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {4, GPA_HIDE_NAME("PA_SC1_004"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 4 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {5, GPA_HIDE_NAME("PA_SC1_005"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 5 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {6, GPA_HIDE_NAME("PA_SC1_006"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 6 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {7, GPA_HIDE_NAME("PA_SC1_007"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 7 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {8, GPA_HIDE_NAME("PA_SC1_008"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 8 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {9, GPA_HIDE_NAME("PA_SC1_009"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 9 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {10, GPA_HIDE_NAME("PA_SC1_010"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 10 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {11, GPA_HIDE_NAME("PA_SC1_011"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 11 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {12, GPA_HIDE_NAME("PA_SC1_012"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 12 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {13, GPA_HIDE_NAME("PA_SC1_013"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 13 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {14, GPA_HIDE_NAME("PA_SC1_014"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 14 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {15, GPA_HIDE_NAME("PA_SC1_015"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 15 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {16, GPA_HIDE_NAME("PA_SC1_016"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 16 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {17, GPA_HIDE_NAME("PA_SC1_017"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 17 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {18, GPA_HIDE_NAME("PA_SC1_018"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 18 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {19, GPA_HIDE_NAME("PA_SC1_019"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 19 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {20, GPA_HIDE_NAME("PA_SC1_020"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 20 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {21, GPA_HIDE_NAME("PA_SC1_021"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 21 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {22, GPA_HIDE_NAME("PA_SC1_022"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 22 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {23, GPA_HIDE_NAME("PA_SC1_023"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 23 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {24, GPA_HIDE_NAME("PA_SC1_024"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 24 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {25, GPA_HIDE_NAME("PA_SC1_025"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 25 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {26, GPA_HIDE_NAME("PA_SC1_026"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 26 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {27, GPA_HIDE_NAME("PA_SC1_027"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 27 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {28, GPA_HIDE_NAME("PA_SC1_028"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 28 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {29, GPA_HIDE_NAME("PA_SC1_029"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 29 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {30, GPA_HIDE_NAME("PA_SC1_030"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 30 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {31, GPA_HIDE_NAME("PA_SC1_031"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 31 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {32, GPA_HIDE_NAME("PA_SC1_032"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 32 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {33, GPA_HIDE_NAME("PA_SC1_033"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 33 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {34, GPA_HIDE_NAME("PA_SC1_034"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 34 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {35, GPA_HIDE_NAME("PA_SC1_035"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 35 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {36, GPA_HIDE_NAME("PA_SC1_036"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 36 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {37, GPA_HIDE_NAME("PA_SC1_037"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 37 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {38, GPA_HIDE_NAME("PA_SC1_038"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 38 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {39, GPA_HIDE_NAME("PA_SC1_039"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 39 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {40, GPA_HIDE_NAME("PA_SC1_040"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 40 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {41, GPA_HIDE_NAME("PA_SC1_041"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 41 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {42, GPA_HIDE_NAME("PA_SC1_042"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 42 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {43, GPA_HIDE_NAME("PA_SC1_043"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 43 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {44, GPA_HIDE_NAME("PA_SC1_044"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 44 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {45, GPA_HIDE_NAME("PA_SC1_045"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 45 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {46, GPA_HIDE_NAME("PA_SC1_046"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 46 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {47, GPA_HIDE_NAME("PA_SC1_047"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 47 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {48, GPA_HIDE_NAME("PA_SC1_048"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 48 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {49, GPA_HIDE_NAME("PA_SC1_049"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 49 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {50, GPA_HIDE_NAME("PA_SC1_050"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 50 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {51, GPA_HIDE_NAME("PA_SC1_051"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 51 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {52, GPA_HIDE_NAME("PA_SC1_052"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 52 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {53, GPA_HIDE_NAME("PA_SC1_053"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 53 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {54, GPA_HIDE_NAME("PA_SC1_054"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 54 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {55, GPA_HIDE_NAME("PA_SC1_055"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 55 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {56, GPA_HIDE_NAME("PA_SC1_056"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 56 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {57, GPA_HIDE_NAME("PA_SC1_057"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 57 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {58, GPA_HIDE_NAME("PA_SC1_058"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 58 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {59, GPA_HIDE_NAME("PA_SC1_059"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 59 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {60, GPA_HIDE_NAME("PA_SC1_060"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 60 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {61, GPA_HIDE_NAME("PA_SC1_061"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 61 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {62, GPA_HIDE_NAME("PA_SC1_062"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 62 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {63, GPA_HIDE_NAME("PA_SC1_063"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 63 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {64, GPA_HIDE_NAME("PA_SC1_064"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 64 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {65, GPA_HIDE_NAME("PA_SC1_065"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 65 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {66, GPA_HIDE_NAME("PA_SC1_066"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 66 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {67, GPA_HIDE_NAME("PA_SC1_067"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 67 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {68, GPA_HIDE_NAME("PA_SC1_068"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 68 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {69, GPA_HIDE_NAME("PA_SC1_069"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 69 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {70, GPA_HIDE_NAME("PA_SC1_070"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 70 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {71, GPA_HIDE_NAME("PA_SC1_071"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 71 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {72, GPA_HIDE_NAME("PA_SC1_072"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 72 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {73, GPA_HIDE_NAME("PA_SC1_073"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 73 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {74, GPA_HIDE_NAME("PA_SC1_074"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 74 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {75, GPA_HIDE_NAME("PA_SC1_075"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 75 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {76, GPA_HIDE_NAME("PA_SC1_076"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 76 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {77, GPA_HIDE_NAME("PA_SC1_077"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 77 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {78, GPA_HIDE_NAME("PA_SC1_078"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 78 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {79, GPA_HIDE_NAME("PA_SC1_079"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 79 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {80, GPA_HIDE_NAME("PA_SC1_080"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 80 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {81, GPA_HIDE_NAME("PA_SC1_081"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 81 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {82, GPA_HIDE_NAME("PA_SC1_082"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 82 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {83, GPA_HIDE_NAME("PA_SC1_083"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 83 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {84, GPA_HIDE_NAME("PA_SC1_084"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 84 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {85, GPA_HIDE_NAME("PA_SC1_085"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 85 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {86, GPA_HIDE_NAME("PA_SC1_086"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 86 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {87, GPA_HIDE_NAME("PA_SC1_087"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 87 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {88, GPA_HIDE_NAME("PA_SC1_088"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 88 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {89, GPA_HIDE_NAME("PA_SC1_089"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 89 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {90, GPA_HIDE_NAME("PA_SC1_090"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 90 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {91, GPA_HIDE_NAME("PA_SC1_091"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 91 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {92, GPA_HIDE_NAME("PA_SC1_092"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 92 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {93, GPA_HIDE_NAME("PA_SC1_093"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 93 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {94, GPA_HIDE_NAME("PA_SC1_094"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 94 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {95, GPA_HIDE_NAME("PA_SC1_095"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 95 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {96, GPA_HIDE_NAME("PA_SC1_096"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 96 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {97, GPA_HIDE_NAME("PA_SC1_097"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 97 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {98, GPA_HIDE_NAME("PA_SC1_098"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 98 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {99, GPA_HIDE_NAME("PA_SC1_099"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 99 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {100, GPA_HIDE_NAME("PA_SC1_100"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 100 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {101, GPA_HIDE_NAME("PA_SC1_101"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 101 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {102, GPA_HIDE_NAME("PA_SC1_102"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 102 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {103, GPA_HIDE_NAME("PA_SC1_103"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 103 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {104, GPA_HIDE_NAME("PA_SC1_104"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 104 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {105, GPA_HIDE_NAME("PA_SC1_105"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 105 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {106, GPA_HIDE_NAME("PA_SC1_106"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 106 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {107, GPA_HIDE_NAME("PA_SC1_107"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 107 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {108, GPA_HIDE_NAME("PA_SC1_108"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 108 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {109, GPA_HIDE_NAME("PA_SC1_109"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 109 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {110, GPA_HIDE_NAME("PA_SC1_110"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 110 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {111, GPA_HIDE_NAME("PA_SC1_111"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 111 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {112, GPA_HIDE_NAME("PA_SC1_112"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 112 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {113, GPA_HIDE_NAME("PA_SC1_113"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 113 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {114, GPA_HIDE_NAME("PA_SC1_114"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 114 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {115, GPA_HIDE_NAME("PA_SC1_115"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 115 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {116, GPA_HIDE_NAME("PA_SC1_116"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 116 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {117, GPA_HIDE_NAME("PA_SC1_117"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 117 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {118, GPA_HIDE_NAME("PA_SC1_118"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 118 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {119, GPA_HIDE_NAME("PA_SC1_119"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 119 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {120, GPA_HIDE_NAME("PA_SC1_120"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 120 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {121, GPA_HIDE_NAME("PA_SC1_121"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 121 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {122, GPA_HIDE_NAME("PA_SC1_122"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 122 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {123, GPA_HIDE_NAME("PA_SC1_123"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 123 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {124, GPA_HIDE_NAME("PA_SC1_124"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 124 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {125, GPA_HIDE_NAME("PA_SC1_125"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 125 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {126, GPA_HIDE_NAME("PA_SC1_126"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 126 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {127, GPA_HIDE_NAME("PA_SC1_127"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 127 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {128, GPA_HIDE_NAME("PA_SC1_128"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 128 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {129, GPA_HIDE_NAME("PA_SC1_129"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 129 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {130, GPA_HIDE_NAME("PA_SC1_130"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 130 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {131, GPA_HIDE_NAME("PA_SC1_131"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 131 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {132, GPA_HIDE_NAME("PA_SC1_132"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 132 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {133, GPA_HIDE_NAME("PA_SC1_133"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 133 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {134, GPA_HIDE_NAME("PA_SC1_134"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 134 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {135, GPA_HIDE_NAME("PA_SC1_135"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 135 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {136, GPA_HIDE_NAME("PA_SC1_136"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 136 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {137, GPA_HIDE_NAME("PA_SC1_137"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 137 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {138, GPA_HIDE_NAME("PA_SC1_138"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 138 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {139, GPA_HIDE_NAME("PA_SC1_139"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 139 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {140, GPA_HIDE_NAME("PA_SC1_140"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 140 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {141, GPA_HIDE_NAME("PA_SC1_141"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 141 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {142, GPA_HIDE_NAME("PA_SC1_142"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 142 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {143, GPA_HIDE_NAME("PA_SC1_143"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 143 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {144, GPA_HIDE_NAME("PA_SC1_144"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 144 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {145, GPA_HIDE_NAME("PA_SC1_145"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 145 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {146, GPA_HIDE_NAME("PA_SC1_146"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 146 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {147, GPA_HIDE_NAME("PA_SC1_147"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 147 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {148, GPA_HIDE_NAME("PA_SC1_148"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 148 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {149, GPA_HIDE_NAME("PA_SC1_149"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 149 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {150, GPA_HIDE_NAME("PA_SC1_150"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 150 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {151, GPA_HIDE_NAME("PA_SC1_151"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 151 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {152, GPA_HIDE_NAME("PA_SC1_152"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 152 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {153, GPA_HIDE_NAME("PA_SC1_153"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 153 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {154, GPA_HIDE_NAME("PA_SC1_154"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 154 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {155, GPA_HIDE_NAME("PA_SC1_155"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 155 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {156, GPA_HIDE_NAME("PA_SC1_156"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 156 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {157, GPA_HIDE_NAME("PA_SC1_157"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 157 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {158, GPA_HIDE_NAME("PA_SC1_158"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 158 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {159, GPA_HIDE_NAME("PA_SC1_QZ0_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("quad count; quad-z pipe 0;Where measured: sc sc_qdmsk_z output to sc_z_interp in db pipe 0;increment rate-one to 16  per clock;range-1/clk;CONTEXT_STATE_SENSITIVE=YES;Results reported per SE, INSTANCE_INDEX=0 to num_packer_per_sc-1."), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {160, GPA_HIDE_NAME("PA_SC1_QZ1_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("quad count; quad-z pipe 1;Where measured: sc sc_qdmsk_z output to sc_z_interp in db pipe 1;increment rate-one to 16 per clock;range-1/clk;CONTEXT_STATE_SENSITIVE=YES;Results reported per SE, INSTANCE_INDEX=0 to num_packer_per_sc-1. Valid only if NUM_DB_PER_PACKER=2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {161, GPA_HIDE_NAME("PA_SC1_QZ2_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("quad count; quad-z pipe 2 DEPRECATED (NUM_DB_PER_PACKER=4 variants only)"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {162, GPA_HIDE_NAME("PA_SC1_QZ3_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("quad count; quad-z pipe 3 DEPRECATED (NUM_DB_PER_PACKER=4 variants only)"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {163, GPA_HIDE_NAME("PA_SC1_163"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 163 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {164, GPA_HIDE_NAME("PA_SC1_164"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 164 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {165, GPA_HIDE_NAME("PA_SC1_165"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 165 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {166, GPA_HIDE_NAME("PA_SC1_166"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 166 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {167, GPA_HIDE_NAME("PA_SC1_167"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 167 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {168, GPA_HIDE_NAME("PA_SC1_168"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 168 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {169, GPA_HIDE_NAME("PA_SC1_169"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 169 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {170, GPA_HIDE_NAME("PA_SC1_170"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 170 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {171, GPA_HIDE_NAME("PA_SC1_171"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 171 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {172, GPA_HIDE_NAME("PA_SC1_172"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 172 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {173, GPA_HIDE_NAME("PA_SC1_173"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 173 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {174, GPA_HIDE_NAME("PA_SC1_174"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 174 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {175, GPA_HIDE_NAME("PA_SC1_175"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 175 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {176, GPA_HIDE_NAME("PA_SC1_176"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 176 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {177, GPA_HIDE_NAME("PA_SC1_177"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 177 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {178, GPA_HIDE_NAME("PA_SC1_178"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 178 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {179, GPA_HIDE_NAME("PA_SC1_179"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 179 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {180, GPA_HIDE_NAME("PA_SC1_180"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 180 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {181, GPA_HIDE_NAME("PA_SC1_181"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 181 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {182, GPA_HIDE_NAME("PA_SC1_182"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 182 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {183, GPA_HIDE_NAME("PA_SC1_183"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 183 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {184, GPA_HIDE_NAME("PA_SC1_184"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 184 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {185, GPA_HIDE_NAME("PA_SC1_185"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 185 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {186, GPA_HIDE_NAME("PA_SC1_186"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 186 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {187, GPA_HIDE_NAME("PA_SC1_187"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 187 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {188, GPA_HIDE_NAME("PA_SC1_188"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 188 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {189, GPA_HIDE_NAME("PA_SC1_189"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 189 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {190, GPA_HIDE_NAME("PA_SC1_190"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 190 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {191, GPA_HIDE_NAME("PA_SC1_191"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 191 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {192, GPA_HIDE_NAME("PA_SC1_192"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 192 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {193, GPA_HIDE_NAME("PA_SC1_193"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 193 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {194, GPA_HIDE_NAME("PA_SC1_194"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 194 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {195, GPA_HIDE_NAME("PA_SC1_195"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 195 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {196, GPA_HIDE_NAME("PA_SC1_196"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 196 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {197, GPA_HIDE_NAME("PA_SC1_197"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 197 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {198, GPA_HIDE_NAME("PA_SC1_198"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 198 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {199, GPA_HIDE_NAME("PA_SC1_199"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 199 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {200, GPA_HIDE_NAME("PA_SC1_200"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 200 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {201, GPA_HIDE_NAME("PA_SC1_201"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 201 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {202, GPA_HIDE_NAME("PA_SC1_202"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 202 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {203, GPA_HIDE_NAME("PA_SC1_203"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 203 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {204, GPA_HIDE_NAME("PA_SC1_204"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 204 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {205, GPA_HIDE_NAME("PA_SC1_205"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 205 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {206, GPA_HIDE_NAME("PA_SC1_206"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 206 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {207, GPA_HIDE_NAME("PA_SC1_207"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 207 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {208, GPA_HIDE_NAME("PA_SC1_208"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 208 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {209, GPA_HIDE_NAME("PA_SC1_209"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 209 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {210, GPA_HIDE_NAME("PA_SC1_210"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 210 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {211, GPA_HIDE_NAME("PA_SC1_211"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 211 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {212, GPA_HIDE_NAME("PA_SC1_212"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 212 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {213, GPA_HIDE_NAME("PA_SC1_213"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 213 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {214, GPA_HIDE_NAME("PA_SC1_214"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 214 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {215, GPA_HIDE_NAME("PA_SC1_215"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 215 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {216, GPA_HIDE_NAME("PA_SC1_216"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 216 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {217, GPA_HIDE_NAME("PA_SC1_217"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 217 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {218, GPA_HIDE_NAME("PA_SC1_218"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 218 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {219, GPA_HIDE_NAME("PA_SC1_219"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 219 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {220, GPA_HIDE_NAME("PA_SC1_220"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 220 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {221, GPA_HIDE_NAME("PA_SC1_221"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 221 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {222, GPA_HIDE_NAME("PA_SC1_222"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 222 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {223, GPA_HIDE_NAME("PA_SC1_223"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 223 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {224, GPA_HIDE_NAME("PA_SC1_224"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 224 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {225, GPA_HIDE_NAME("PA_SC1_225"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 225 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {226, GPA_HIDE_NAME("PA_SC1_226"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 226 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {227, GPA_HIDE_NAME("PA_SC1_227"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 227 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {228, GPA_HIDE_NAME("PA_SC1_228"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 228 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {229, GPA_HIDE_NAME("PA_SC1_229"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 229 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {230, GPA_HIDE_NAME("PA_SC1_230"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 230 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {231, GPA_HIDE_NAME("PA_SC1_231"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 231 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {232, GPA_HIDE_NAME("PA_SC1_232"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 232 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {233, GPA_HIDE_NAME("PA_SC1_233"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 233 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {234, GPA_HIDE_NAME("PA_SC1_234"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 234 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {235, GPA_HIDE_NAME("PA_SC1_P0_HIZ_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("total quads surviving hi-z; db pipe 0;Where measured: sc sc_quad_proc usc_tile_mask_return_fifo in db pipe 1;increment rate-one per clock;range-1/clk;CONTEXT_STATE_SENSITIVE=YES;Results reported per SE, INSTANCE_INDEX=0 to num_packer_per_sc-1;"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {236, GPA_HIDE_NAME("PA_SC1_P1_HIZ_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("total quads surviving hi-z; db pipe 1;Where measured: sc sc_quad_proc usc_tile_mask_return_fifo in db pipe 1;increment rate-one per clock;range-1/clk;CONTEXT_STATE_SENSITIVE=YES;Results reported per SE, INSTANCE_INDEX=0 to num_packer_per_sc-1. Valid only if NUM_DB_PER_PACKER=2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {237, GPA_HIDE_NAME("PA_SC1_P2_HIZ_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("total quads surviving hi-z; db pipe 2 (DEPRECATED only valid for NUM_DB_PER_PACKER=4)"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {238, GPA_HIDE_NAME("PA_SC1_P3_HIZ_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("total quads surviving hi-z; db pipe 3 (DEPRECATED only valid for NUM_DB_PER_PACKER=4)"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {239, GPA_HIDE_NAME("PA_SC1_239"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 239 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {240, GPA_HIDE_NAME("PA_SC1_240"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 240 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {241, GPA_HIDE_NAME("PA_SC1_241"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 241 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {242, GPA_HIDE_NAME("PA_SC1_242"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 242 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {243, GPA_HIDE_NAME("PA_SC1_243"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 243 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {244, GPA_HIDE_NAME("PA_SC1_244"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 244 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {245, GPA_HIDE_NAME("PA_SC1_245"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 245 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {246, GPA_HIDE_NAME("PA_SC1_246"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 246 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {247, GPA_HIDE_NAME("PA_SC1_247"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 247 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {248, GPA_HIDE_NAME("PA_SC1_248"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 248 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {249, GPA_HIDE_NAME("PA_SC1_249"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 249 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {250, GPA_HIDE_NAME("PA_SC1_250"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 250 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {251, GPA_HIDE_NAME("PA_SC1_251"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 251 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {252, GPA_HIDE_NAME("PA_SC1_252"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 252 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {253, GPA_HIDE_NAME("PA_SC1_253"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 253 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {254, GPA_HIDE_NAME("PA_SC1_254"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 254 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {255, GPA_HIDE_NAME("PA_SC1_255"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 255 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {256, GPA_HIDE_NAME("PA_SC1_256"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 256 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {257, GPA_HIDE_NAME("PA_SC1_257"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 257 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {258, GPA_HIDE_NAME("PA_SC1_258"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 258 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {259, GPA_HIDE_NAME("PA_SC1_EARLYZ_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("total quads surviving early-z;Where measured: sc_tileaccum (sc_quadaccum if 1db per packer) inputs to packer;increment rate 1 to 2 quads per clock;range-1/clk;CONTEXT_STATE_SENSITIVE=YES;Results reported per SE, INSTANCE_INDEX=0 to num_packer_per_sc-1."), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {260, GPA_HIDE_NAME("PA_SC1_260"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 260 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {261, GPA_HIDE_NAME("PA_SC1_261"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 261 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {262, GPA_HIDE_NAME("PA_SC1_262"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 262 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {263, GPA_HIDE_NAME("PA_SC1_263"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 263 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {264, GPA_HIDE_NAME("PA_SC1_264"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 264 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {265, GPA_HIDE_NAME("PA_SC1_265"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 265 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {266, GPA_HIDE_NAME("PA_SC1_266"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 266 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {267, GPA_HIDE_NAME("PA_SC1_267"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 267 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {268, GPA_HIDE_NAME("PA_SC1_268"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 268 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {269, GPA_HIDE_NAME("PA_SC1_269"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 269 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {270, GPA_HIDE_NAME("PA_SC1_270"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 270 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {271, GPA_HIDE_NAME("PA_SC1_271"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 271 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {272, GPA_HIDE_NAME("PA_SC1_272"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 272 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {273, GPA_HIDE_NAME("PA_SC1_273"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 273 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {274, GPA_HIDE_NAME("PA_SC1_274"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 274 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {275, GPA_HIDE_NAME("PA_SC1_275"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 275 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {276, GPA_HIDE_NAME("PA_SC1_276"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 276 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {277, GPA_HIDE_NAME("PA_SC1_277"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 277 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {278, GPA_HIDE_NAME("PA_SC1_278"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 278 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {279, GPA_HIDE_NAME("PA_SC1_279"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 279 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {280, GPA_HIDE_NAME("PA_SC1_280"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 280 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {281, GPA_HIDE_NAME("PA_SC1_281"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 281 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {282, GPA_HIDE_NAME("PA_SC1_282"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 282 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {283, GPA_HIDE_NAME("PA_SC1_283"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 283 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {284, GPA_HIDE_NAME("PA_SC1_284"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 284 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {285, GPA_HIDE_NAME("PA_SC1_285"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 285 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {286, GPA_HIDE_NAME("PA_SC1_286"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 286 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {287, GPA_HIDE_NAME("PA_SC1_287"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 287 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {288, GPA_HIDE_NAME("PA_SC1_288"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 288 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {289, GPA_HIDE_NAME("PA_SC1_289"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 289 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {290, GPA_HIDE_NAME("PA_SC1_290"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 290 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {291, GPA_HIDE_NAME("PA_SC1_291"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 291 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {292, GPA_HIDE_NAME("PA_SC1_292"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 292 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {293, GPA_HIDE_NAME("PA_SC1_293"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 293 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {294, GPA_HIDE_NAME("PA_SC1_294"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 294 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {295, GPA_HIDE_NAME("PA_SC1_295"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 295 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {296, GPA_HIDE_NAME("PA_SC1_296"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 296 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {297, GPA_HIDE_NAME("PA_SC1_297"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 297 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {298, GPA_HIDE_NAME("PA_SC1_298"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 298 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {299, GPA_HIDE_NAME("PA_SC1_299"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 299 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {300, GPA_HIDE_NAME("PA_SC1_300"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 300 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {301, GPA_HIDE_NAME("PA_SC1_301"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 301 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {302, GPA_HIDE_NAME("PA_SC1_302"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 302 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {303, GPA_HIDE_NAME("PA_SC1_303"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 303 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {304, GPA_HIDE_NAME("PA_SC1_304"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 304 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {305, GPA_HIDE_NAME("PA_SC1_305"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 305 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {306, GPA_HIDE_NAME("PA_SC1_306"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 306 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {307, GPA_HIDE_NAME("PA_SC1_307"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 307 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {308, GPA_HIDE_NAME("PA_SC1_308"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 308 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {309, GPA_HIDE_NAME("PA_SC1_309"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 309 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {310, GPA_HIDE_NAME("PA_SC1_310"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 310 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {311, GPA_HIDE_NAME("PA_SC1_311"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 311 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {312, GPA_HIDE_NAME("PA_SC1_312"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 312 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {313, GPA_HIDE_NAME("PA_SC1_313"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 313 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {314, GPA_HIDE_NAME("PA_SC1_314"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 314 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {315, GPA_HIDE_NAME("PA_SC1_315"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 315 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {316, GPA_HIDE_NAME("PA_SC1_316"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 316 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {317, GPA_HIDE_NAME("PA_SC1_317"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 317 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {318, GPA_HIDE_NAME("PA_SC1_318"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 318 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {319, GPA_HIDE_NAME("PA_SC1_319"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 319 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {320, GPA_HIDE_NAME("PA_SC1_320"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 320 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {321, GPA_HIDE_NAME("PA_SC1_321"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 321 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {322, GPA_HIDE_NAME("PA_SC1_322"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 322 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {323, GPA_HIDE_NAME("PA_SC1_323"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 323 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {324, GPA_HIDE_NAME("PA_SC1_324"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 324 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {325, GPA_HIDE_NAME("PA_SC1_325"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 325 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {326, GPA_HIDE_NAME("PA_SC1_326"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 326 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {327, GPA_HIDE_NAME("PA_SC1_327"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 327 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {328, GPA_HIDE_NAME("PA_SC1_328"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 328 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {329, GPA_HIDE_NAME("PA_SC1_329"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 329 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {330, GPA_HIDE_NAME("PA_SC1_330"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 330 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {331, GPA_HIDE_NAME("PA_SC1_331"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 331 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {332, GPA_HIDE_NAME("PA_SC1_332"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 332 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {333, GPA_HIDE_NAME("PA_SC1_333"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 333 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {334, GPA_HIDE_NAME("PA_SC1_334"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 334 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {335, GPA_HIDE_NAME("PA_SC1_335"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 335 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {336, GPA_HIDE_NAME("PA_SC1_336"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 336 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {337, GPA_HIDE_NAME("PA_SC1_337"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 337 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {338, GPA_HIDE_NAME("PA_SC1_338"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 338 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {339, GPA_HIDE_NAME("PA_SC1_339"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 339 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {340, GPA_HIDE_NAME("PA_SC1_340"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 340 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {341, GPA_HIDE_NAME("PA_SC1_341"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 341 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {342, GPA_HIDE_NAME("PA_SC1_342"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 342 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {343, GPA_HIDE_NAME("PA_SC1_343"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 343 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {344, GPA_HIDE_NAME("PA_SC1_344"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 344 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {345, GPA_HIDE_NAME("PA_SC1_345"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 345 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {346, GPA_HIDE_NAME("PA_SC1_346"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 346 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {347, GPA_HIDE_NAME("PA_SC1_347"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 347 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {348, GPA_HIDE_NAME("PA_SC1_348"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 348 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {349, GPA_HIDE_NAME("PA_SC1_349"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 349 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {350, GPA_HIDE_NAME("PA_SC1_350"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 350 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {351, GPA_HIDE_NAME("PA_SC1_351"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 351 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {352, GPA_HIDE_NAME("PA_SC1_352"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 352 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {353, GPA_HIDE_NAME("PA_SC1_353"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 353 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {354, GPA_HIDE_NAME("PA_SC1_354"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 354 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {355, GPA_HIDE_NAME("PA_SC1_355"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 355 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {356, GPA_HIDE_NAME("PA_SC1_356"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 356 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {357, GPA_HIDE_NAME("PA_SC1_357"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 357 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {358, GPA_HIDE_NAME("PA_SC1_358"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 358 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {359, GPA_HIDE_NAME("PA_SC1_359"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 359 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {360, GPA_HIDE_NAME("PA_SC1_360"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 360 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {361, GPA_HIDE_NAME("PA_SC1_361"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 361 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {362, GPA_HIDE_NAME("PA_SC1_362"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 362 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {363, GPA_HIDE_NAME("PA_SC1_363"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 363 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {364, GPA_HIDE_NAME("PA_SC1_364"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 364 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {365, GPA_HIDE_NAME("PA_SC1_365"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 365 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {366, GPA_HIDE_NAME("PA_SC1_366"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 366 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {367, GPA_HIDE_NAME("PA_SC1_367"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 367 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {368, GPA_HIDE_NAME("PA_SC1_368"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 368 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {369, GPA_HIDE_NAME("PA_SC1_369"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 369 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {370, GPA_HIDE_NAME("PA_SC1_370"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 370 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {371, GPA_HIDE_NAME("PA_SC1_371"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 371 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {372, GPA_HIDE_NAME("PA_SC1_372"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 372 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {373, GPA_HIDE_NAME("PA_SC1_373"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 373 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {374, GPA_HIDE_NAME("PA_SC1_374"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 374 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {375, GPA_HIDE_NAME("PA_SC1_375"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 375 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {376, GPA_HIDE_NAME("PA_SC1_376"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 376 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {377, GPA_HIDE_NAME("PA_SC1_377"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 377 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {378, GPA_HIDE_NAME("PA_SC1_378"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 378 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {379, GPA_HIDE_NAME("PA_SC1_379"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 379 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {380, GPA_HIDE_NAME("PA_SC1_380"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 380 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {381, GPA_HIDE_NAME("PA_SC1_381"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 381 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {382, GPA_HIDE_NAME("PA_SC1_382"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 382 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {383, GPA_HIDE_NAME("PA_SC1_383"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 383 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {384, GPA_HIDE_NAME("PA_SC1_384"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 384 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {385, GPA_HIDE_NAME("PA_SC1_385"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 385 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {386, GPA_HIDE_NAME("PA_SC1_386"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 386 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {387, GPA_HIDE_NAME("PA_SC1_387"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 387 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {388, GPA_HIDE_NAME("PA_SC1_388"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 388 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {389, GPA_HIDE_NAME("PA_SC1_389"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 389 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {390, GPA_HIDE_NAME("PA_SC1_390"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 390 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {391, GPA_HIDE_NAME("PA_SC1_391"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 391 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {392, GPA_HIDE_NAME("PA_SC1_392"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 392 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {393, GPA_HIDE_NAME("PA_SC1_393"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 393 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {394, GPA_HIDE_NAME("PA_SC1_394"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 394 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {395, GPA_HIDE_NAME("PA_SC1_395"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 395 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {396, GPA_HIDE_NAME("PA_SC1_396"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 396 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {397, GPA_HIDE_NAME("PA_SC1_397"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 397 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {398, GPA_HIDE_NAME("PA_SC1_398"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 398 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {399, GPA_HIDE_NAME("PA_SC1_399"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 399 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {400, GPA_HIDE_NAME("PA_SC1_400"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 400 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {401, GPA_HIDE_NAME("PA_SC1_401"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 401 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {402, GPA_HIDE_NAME("PA_SC1_402"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 402 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {403, GPA_HIDE_NAME("PA_SC1_403"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 403 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {404, GPA_HIDE_NAME("PA_SC1_404"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 404 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {405, GPA_HIDE_NAME("PA_SC1_405"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 405 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {406, GPA_HIDE_NAME("PA_SC1_406"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 406 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {407, GPA_HIDE_NAME("PA_SC1_407"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 407 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {408, GPA_HIDE_NAME("PA_SC1_408"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 408 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {409, GPA_HIDE_NAME("PA_SC1_409"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 409 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {410, GPA_HIDE_NAME("PA_SC1_410"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 410 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {411, GPA_HIDE_NAME("PA_SC1_411"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 411 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {412, GPA_HIDE_NAME("PA_SC1_412"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 412 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {413, GPA_HIDE_NAME("PA_SC1_413"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 413 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {414, GPA_HIDE_NAME("PA_SC1_414"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 414 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {415, GPA_HIDE_NAME("PA_SC1_415"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 415 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {416, GPA_HIDE_NAME("PA_SC1_416"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 416 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {417, GPA_HIDE_NAME("PA_SC1_417"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 417 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {418, GPA_HIDE_NAME("PA_SC1_418"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 418 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {419, GPA_HIDE_NAME("PA_SC1_419"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 419 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {420, GPA_HIDE_NAME("PA_SC1_420"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 420 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {421, GPA_HIDE_NAME("PA_SC1_421"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 421 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {422, GPA_HIDE_NAME("PA_SC1_422"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 422 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {423, GPA_HIDE_NAME("PA_SC1_423"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 423 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {424, GPA_HIDE_NAME("PA_SC1_424"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 424 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {425, GPA_HIDE_NAME("PA_SC1_425"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 425 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {426, GPA_HIDE_NAME("PA_SC1_426"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 426 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {427, GPA_HIDE_NAME("PA_SC1_427"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 427 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {428, GPA_HIDE_NAME("PA_SC1_428"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 428 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {429, GPA_HIDE_NAME("PA_SC1_429"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 429 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {430, GPA_HIDE_NAME("PA_SC1_430"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 430 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {431, GPA_HIDE_NAME("PA_SC1_431"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 431 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {432, GPA_HIDE_NAME("PA_SC1_432"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 432 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {433, GPA_HIDE_NAME("PA_SC1_433"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 433 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {434, GPA_HIDE_NAME("PA_SC1_434"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 434 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {435, GPA_HIDE_NAME("PA_SC1_435"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 435 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {436, GPA_HIDE_NAME("PA_SC1_436"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 436 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {437, GPA_HIDE_NAME("PA_SC1_437"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 437 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {438, GPA_HIDE_NAME("PA_SC1_438"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 438 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {439, GPA_HIDE_NAME("PA_SC1_439"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 439 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {440, GPA_HIDE_NAME("PA_SC1_440"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 440 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {441, GPA_HIDE_NAME("PA_SC1_441"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 441 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {442, GPA_HIDE_NAME("PA_SC1_442"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 442 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {443, GPA_HIDE_NAME("PA_SC1_443"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 443 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {444, GPA_HIDE_NAME("PA_SC1_444"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 444 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {445, GPA_HIDE_NAME("PA_SC1_445"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 445 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {446, GPA_HIDE_NAME("PA_SC1_446"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 446 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {447, GPA_HIDE_NAME("PA_SC1_447"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 447 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {448, GPA_HIDE_NAME("PA_SC1_448"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 448 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {449, GPA_HIDE_NAME("PA_SC1_449"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 449 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {450, GPA_HIDE_NAME("PA_SC1_450"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 450 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {451, GPA_HIDE_NAME("PA_SC1_451"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 451 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {452, GPA_HIDE_NAME("PA_SC1_452"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 452 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {453, GPA_HIDE_NAME("PA_SC1_453"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 453 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {454, GPA_HIDE_NAME("PA_SC1_454"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 454 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {455, GPA_HIDE_NAME("PA_SC1_455"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 455 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {456, GPA_HIDE_NAME("PA_SC1_456"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 456 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {457, GPA_HIDE_NAME("PA_SC1_457"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 457 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {458, GPA_HIDE_NAME("PA_SC1_458"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 458 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {459, GPA_HIDE_NAME("PA_SC1_459"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 459 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {460, GPA_HIDE_NAME("PA_SC1_460"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 460 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {461, GPA_HIDE_NAME("PA_SC1_461"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 461 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {462, GPA_HIDE_NAME("PA_SC1_462"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 462 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {463, GPA_HIDE_NAME("PA_SC1_463"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 463 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {464, GPA_HIDE_NAME("PA_SC1_464"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 464 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {465, GPA_HIDE_NAME("PA_SC1_465"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 465 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {466, GPA_HIDE_NAME("PA_SC1_466"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 466 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {467, GPA_HIDE_NAME("PA_SC1_467"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 467 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {468, GPA_HIDE_NAME("PA_SC1_468"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 468 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {469, GPA_HIDE_NAME("PA_SC1_469"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 469 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {470, GPA_HIDE_NAME("PA_SC1_470"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 470 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {471, GPA_HIDE_NAME("PA_SC1_471"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 471 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {472, GPA_HIDE_NAME("PA_SC1_472"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 472 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {473, GPA_HIDE_NAME("PA_SC1_473"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 473 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {474, GPA_HIDE_NAME("PA_SC1_474"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 474 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {475, GPA_HIDE_NAME("PA_SC1_475"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 475 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {476, GPA_HIDE_NAME("PA_SC1_476"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 476 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {477, GPA_HIDE_NAME("PA_SC1_477"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 477 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {478, GPA_HIDE_NAME("PA_SC1_478"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 478 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {479, GPA_HIDE_NAME("PA_SC1_479"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 479 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {480, GPA_HIDE_NAME("PA_SC1_480"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 480 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {481, GPA_HIDE_NAME("PA_SC1_481"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 481 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {482, GPA_HIDE_NAME("PA_SC1_482"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 482 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {483, GPA_HIDE_NAME("PA_SC1_483"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 483 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {484, GPA_HIDE_NAME("PA_SC1_484"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 484 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {485, GPA_HIDE_NAME("PA_SC1_485"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 485 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {486, GPA_HIDE_NAME("PA_SC1_486"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 486 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {487, GPA_HIDE_NAME("PA_SC1_487"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 487 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {488, GPA_HIDE_NAME("PA_SC1_488"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 488 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {489, GPA_HIDE_NAME("PA_SC1_489"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 489 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {490, GPA_HIDE_NAME("PA_SC1_490"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 490 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {491, GPA_HIDE_NAME("PA_SC1_491"), GPA_HIDE_NAME("PA_SC1"), GPA_HIDE_NAME("Counter 491 from group PA_SC1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-    };
-    GPA_HardwareCounterDesc pa_sc2_counters_gfx9_placeholder4[] = {
-        {0, GPA_HIDE_NAME("PA_SC2_000"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 0 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {1, GPA_HIDE_NAME("PA_SC2_001"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 1 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {2, GPA_HIDE_NAME("PA_SC2_002"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 2 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {3, GPA_HIDE_NAME("PA_SC2_003"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 3 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {4, GPA_HIDE_NAME("PA_SC2_004"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 4 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {5, GPA_HIDE_NAME("PA_SC2_005"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 5 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {6, GPA_HIDE_NAME("PA_SC2_006"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 6 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {7, GPA_HIDE_NAME("PA_SC2_007"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 7 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {8, GPA_HIDE_NAME("PA_SC2_008"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 8 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {9, GPA_HIDE_NAME("PA_SC2_009"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 9 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {10, GPA_HIDE_NAME("PA_SC2_010"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 10 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {11, GPA_HIDE_NAME("PA_SC2_011"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 11 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {12, GPA_HIDE_NAME("PA_SC2_012"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 12 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {13, GPA_HIDE_NAME("PA_SC2_013"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 13 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {14, GPA_HIDE_NAME("PA_SC2_014"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 14 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {15, GPA_HIDE_NAME("PA_SC2_015"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 15 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {16, GPA_HIDE_NAME("PA_SC2_016"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 16 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {17, GPA_HIDE_NAME("PA_SC2_017"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 17 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {18, GPA_HIDE_NAME("PA_SC2_018"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 18 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {19, GPA_HIDE_NAME("PA_SC2_019"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 19 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {20, GPA_HIDE_NAME("PA_SC2_020"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 20 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {21, GPA_HIDE_NAME("PA_SC2_021"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 21 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {22, GPA_HIDE_NAME("PA_SC2_022"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 22 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {23, GPA_HIDE_NAME("PA_SC2_023"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 23 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {24, GPA_HIDE_NAME("PA_SC2_024"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 24 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {25, GPA_HIDE_NAME("PA_SC2_025"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 25 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {26, GPA_HIDE_NAME("PA_SC2_026"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 26 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {27, GPA_HIDE_NAME("PA_SC2_027"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 27 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {28, GPA_HIDE_NAME("PA_SC2_028"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 28 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {29, GPA_HIDE_NAME("PA_SC2_029"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 29 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {30, GPA_HIDE_NAME("PA_SC2_030"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 30 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {31, GPA_HIDE_NAME("PA_SC2_031"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 31 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {32, GPA_HIDE_NAME("PA_SC2_032"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 32 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {33, GPA_HIDE_NAME("PA_SC2_033"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 33 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {34, GPA_HIDE_NAME("PA_SC2_034"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 34 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {35, GPA_HIDE_NAME("PA_SC2_035"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 35 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {36, GPA_HIDE_NAME("PA_SC2_036"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 36 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {37, GPA_HIDE_NAME("PA_SC2_037"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 37 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {38, GPA_HIDE_NAME("PA_SC2_038"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 38 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {39, GPA_HIDE_NAME("PA_SC2_039"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 39 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {40, GPA_HIDE_NAME("PA_SC2_040"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 40 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {41, GPA_HIDE_NAME("PA_SC2_041"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 41 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {42, GPA_HIDE_NAME("PA_SC2_042"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 42 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {43, GPA_HIDE_NAME("PA_SC2_043"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 43 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {44, GPA_HIDE_NAME("PA_SC2_044"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 44 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {45, GPA_HIDE_NAME("PA_SC2_045"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 45 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {46, GPA_HIDE_NAME("PA_SC2_046"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 46 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {47, GPA_HIDE_NAME("PA_SC2_047"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 47 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {48, GPA_HIDE_NAME("PA_SC2_048"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 48 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {49, GPA_HIDE_NAME("PA_SC2_049"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 49 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {50, GPA_HIDE_NAME("PA_SC2_050"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 50 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {51, GPA_HIDE_NAME("PA_SC2_051"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 51 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {52, GPA_HIDE_NAME("PA_SC2_052"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 52 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {53, GPA_HIDE_NAME("PA_SC2_053"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 53 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {54, GPA_HIDE_NAME("PA_SC2_054"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 54 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {55, GPA_HIDE_NAME("PA_SC2_055"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 55 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {56, GPA_HIDE_NAME("PA_SC2_056"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 56 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {57, GPA_HIDE_NAME("PA_SC2_057"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 57 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {58, GPA_HIDE_NAME("PA_SC2_058"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 58 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {59, GPA_HIDE_NAME("PA_SC2_059"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 59 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {60, GPA_HIDE_NAME("PA_SC2_060"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 60 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {61, GPA_HIDE_NAME("PA_SC2_061"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 61 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {62, GPA_HIDE_NAME("PA_SC2_062"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 62 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {63, GPA_HIDE_NAME("PA_SC2_063"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 63 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {64, GPA_HIDE_NAME("PA_SC2_064"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 64 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {65, GPA_HIDE_NAME("PA_SC2_065"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 65 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {66, GPA_HIDE_NAME("PA_SC2_066"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 66 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {67, GPA_HIDE_NAME("PA_SC2_067"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 67 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {68, GPA_HIDE_NAME("PA_SC2_068"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 68 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {69, GPA_HIDE_NAME("PA_SC2_069"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 69 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {70, GPA_HIDE_NAME("PA_SC2_070"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 70 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {71, GPA_HIDE_NAME("PA_SC2_071"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 71 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {72, GPA_HIDE_NAME("PA_SC2_072"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 72 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {73, GPA_HIDE_NAME("PA_SC2_073"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 73 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {74, GPA_HIDE_NAME("PA_SC2_074"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 74 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {75, GPA_HIDE_NAME("PA_SC2_075"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 75 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {76, GPA_HIDE_NAME("PA_SC2_076"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 76 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {77, GPA_HIDE_NAME("PA_SC2_077"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 77 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {78, GPA_HIDE_NAME("PA_SC2_078"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 78 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {79, GPA_HIDE_NAME("PA_SC2_079"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 79 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {80, GPA_HIDE_NAME("PA_SC2_080"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 80 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {81, GPA_HIDE_NAME("PA_SC2_081"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 81 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {82, GPA_HIDE_NAME("PA_SC2_082"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 82 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {83, GPA_HIDE_NAME("PA_SC2_083"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 83 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {84, GPA_HIDE_NAME("PA_SC2_084"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 84 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {85, GPA_HIDE_NAME("PA_SC2_085"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 85 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {86, GPA_HIDE_NAME("PA_SC2_086"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 86 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {87, GPA_HIDE_NAME("PA_SC2_087"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 87 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {88, GPA_HIDE_NAME("PA_SC2_088"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 88 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {89, GPA_HIDE_NAME("PA_SC2_089"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 89 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {90, GPA_HIDE_NAME("PA_SC2_090"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 90 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {91, GPA_HIDE_NAME("PA_SC2_091"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 91 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {92, GPA_HIDE_NAME("PA_SC2_092"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 92 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {93, GPA_HIDE_NAME("PA_SC2_093"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 93 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {94, GPA_HIDE_NAME("PA_SC2_094"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 94 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {95, GPA_HIDE_NAME("PA_SC2_095"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 95 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {96, GPA_HIDE_NAME("PA_SC2_096"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 96 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {97, GPA_HIDE_NAME("PA_SC2_097"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 97 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {98, GPA_HIDE_NAME("PA_SC2_098"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 98 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {99, GPA_HIDE_NAME("PA_SC2_099"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 99 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {100, GPA_HIDE_NAME("PA_SC2_100"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 100 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {101, GPA_HIDE_NAME("PA_SC2_101"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 101 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {102, GPA_HIDE_NAME("PA_SC2_102"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 102 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {103, GPA_HIDE_NAME("PA_SC2_103"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 103 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {104, GPA_HIDE_NAME("PA_SC2_104"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 104 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {105, GPA_HIDE_NAME("PA_SC2_105"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 105 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {106, GPA_HIDE_NAME("PA_SC2_106"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 106 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {107, GPA_HIDE_NAME("PA_SC2_107"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 107 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {108, GPA_HIDE_NAME("PA_SC2_108"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 108 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {109, GPA_HIDE_NAME("PA_SC2_109"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 109 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {110, GPA_HIDE_NAME("PA_SC2_110"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 110 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {111, GPA_HIDE_NAME("PA_SC2_111"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 111 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {112, GPA_HIDE_NAME("PA_SC2_112"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 112 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {113, GPA_HIDE_NAME("PA_SC2_113"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 113 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {114, GPA_HIDE_NAME("PA_SC2_114"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 114 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {115, GPA_HIDE_NAME("PA_SC2_115"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 115 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {116, GPA_HIDE_NAME("PA_SC2_116"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 116 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {117, GPA_HIDE_NAME("PA_SC2_117"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 117 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {118, GPA_HIDE_NAME("PA_SC2_118"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 118 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {119, GPA_HIDE_NAME("PA_SC2_119"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 119 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {120, GPA_HIDE_NAME("PA_SC2_120"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 120 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {121, GPA_HIDE_NAME("PA_SC2_121"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 121 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {122, GPA_HIDE_NAME("PA_SC2_122"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 122 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {123, GPA_HIDE_NAME("PA_SC2_123"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 123 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {124, GPA_HIDE_NAME("PA_SC2_124"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 124 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {125, GPA_HIDE_NAME("PA_SC2_125"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 125 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {126, GPA_HIDE_NAME("PA_SC2_126"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 126 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {127, GPA_HIDE_NAME("PA_SC2_127"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 127 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {128, GPA_HIDE_NAME("PA_SC2_128"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 128 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {129, GPA_HIDE_NAME("PA_SC2_129"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 129 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {130, GPA_HIDE_NAME("PA_SC2_130"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 130 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {131, GPA_HIDE_NAME("PA_SC2_131"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 131 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {132, GPA_HIDE_NAME("PA_SC2_132"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 132 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {133, GPA_HIDE_NAME("PA_SC2_133"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 133 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {134, GPA_HIDE_NAME("PA_SC2_134"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 134 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {135, GPA_HIDE_NAME("PA_SC2_135"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 135 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {136, GPA_HIDE_NAME("PA_SC2_136"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 136 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {137, GPA_HIDE_NAME("PA_SC2_137"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 137 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {138, GPA_HIDE_NAME("PA_SC2_138"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 138 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {139, GPA_HIDE_NAME("PA_SC2_139"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 139 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {140, GPA_HIDE_NAME("PA_SC2_140"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 140 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {141, GPA_HIDE_NAME("PA_SC2_141"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 141 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {142, GPA_HIDE_NAME("PA_SC2_142"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 142 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {143, GPA_HIDE_NAME("PA_SC2_143"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 143 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {144, GPA_HIDE_NAME("PA_SC2_144"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 144 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {145, GPA_HIDE_NAME("PA_SC2_145"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 145 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {146, GPA_HIDE_NAME("PA_SC2_146"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 146 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {147, GPA_HIDE_NAME("PA_SC2_147"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 147 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {148, GPA_HIDE_NAME("PA_SC2_148"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 148 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {149, GPA_HIDE_NAME("PA_SC2_149"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 149 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {150, GPA_HIDE_NAME("PA_SC2_150"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 150 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {151, GPA_HIDE_NAME("PA_SC2_151"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 151 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {152, GPA_HIDE_NAME("PA_SC2_152"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 152 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {153, GPA_HIDE_NAME("PA_SC2_153"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 153 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {154, GPA_HIDE_NAME("PA_SC2_154"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 154 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {155, GPA_HIDE_NAME("PA_SC2_155"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 155 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {156, GPA_HIDE_NAME("PA_SC2_156"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 156 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {157, GPA_HIDE_NAME("PA_SC2_157"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 157 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {158, GPA_HIDE_NAME("PA_SC2_158"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 158 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {159, GPA_HIDE_NAME("PA_SC2_QZ0_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("quad count; quad-z pipe 0;Where measured: sc sc_qdmsk_z output to sc_z_interp in db pipe 0;increment rate-one to 16  per clock;range-1/clk;CONTEXT_STATE_SENSITIVE=YES;Results reported per SE, INSTANCE_INDEX=0 to num_packer_per_sc-1."), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {160, GPA_HIDE_NAME("PA_SC2_QZ1_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("quad count; quad-z pipe 1;Where measured: sc sc_qdmsk_z output to sc_z_interp in db pipe 1;increment rate-one to 16 per clock;range-1/clk;CONTEXT_STATE_SENSITIVE=YES;Results reported per SE, INSTANCE_INDEX=0 to num_packer_per_sc-1. Valid only if NUM_DB_PER_PACKER=2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {161, GPA_HIDE_NAME("PA_SC2_QZ2_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("quad count; quad-z pipe 2 DEPRECATED (NUM_DB_PER_PACKER=4 variants only)"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {162, GPA_HIDE_NAME("PA_SC2_QZ3_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("quad count; quad-z pipe 3 DEPRECATED (NUM_DB_PER_PACKER=4 variants only)"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {163, GPA_HIDE_NAME("PA_SC2_163"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 163 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {164, GPA_HIDE_NAME("PA_SC2_164"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 164 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {165, GPA_HIDE_NAME("PA_SC2_165"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 165 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {166, GPA_HIDE_NAME("PA_SC2_166"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 166 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {167, GPA_HIDE_NAME("PA_SC2_167"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 167 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {168, GPA_HIDE_NAME("PA_SC2_168"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 168 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {169, GPA_HIDE_NAME("PA_SC2_169"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 169 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {170, GPA_HIDE_NAME("PA_SC2_170"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 170 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {171, GPA_HIDE_NAME("PA_SC2_171"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 171 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {172, GPA_HIDE_NAME("PA_SC2_172"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 172 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {173, GPA_HIDE_NAME("PA_SC2_173"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 173 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {174, GPA_HIDE_NAME("PA_SC2_174"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 174 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {175, GPA_HIDE_NAME("PA_SC2_175"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 175 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {176, GPA_HIDE_NAME("PA_SC2_176"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 176 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {177, GPA_HIDE_NAME("PA_SC2_177"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 177 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {178, GPA_HIDE_NAME("PA_SC2_178"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 178 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {179, GPA_HIDE_NAME("PA_SC2_179"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 179 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {180, GPA_HIDE_NAME("PA_SC2_180"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 180 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {181, GPA_HIDE_NAME("PA_SC2_181"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 181 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {182, GPA_HIDE_NAME("PA_SC2_182"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 182 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {183, GPA_HIDE_NAME("PA_SC2_183"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 183 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {184, GPA_HIDE_NAME("PA_SC2_184"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 184 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {185, GPA_HIDE_NAME("PA_SC2_185"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 185 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {186, GPA_HIDE_NAME("PA_SC2_186"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 186 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {187, GPA_HIDE_NAME("PA_SC2_187"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 187 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {188, GPA_HIDE_NAME("PA_SC2_188"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 188 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {189, GPA_HIDE_NAME("PA_SC2_189"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 189 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {190, GPA_HIDE_NAME("PA_SC2_190"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 190 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {191, GPA_HIDE_NAME("PA_SC2_191"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 191 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {192, GPA_HIDE_NAME("PA_SC2_192"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 192 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {193, GPA_HIDE_NAME("PA_SC2_193"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 193 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {194, GPA_HIDE_NAME("PA_SC2_194"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 194 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {195, GPA_HIDE_NAME("PA_SC2_195"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 195 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {196, GPA_HIDE_NAME("PA_SC2_196"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 196 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {197, GPA_HIDE_NAME("PA_SC2_197"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 197 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {198, GPA_HIDE_NAME("PA_SC2_198"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 198 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {199, GPA_HIDE_NAME("PA_SC2_199"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 199 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {200, GPA_HIDE_NAME("PA_SC2_200"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 200 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {201, GPA_HIDE_NAME("PA_SC2_201"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 201 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {202, GPA_HIDE_NAME("PA_SC2_202"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 202 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {203, GPA_HIDE_NAME("PA_SC2_203"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 203 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {204, GPA_HIDE_NAME("PA_SC2_204"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 204 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {205, GPA_HIDE_NAME("PA_SC2_205"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 205 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {206, GPA_HIDE_NAME("PA_SC2_206"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 206 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {207, GPA_HIDE_NAME("PA_SC2_207"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 207 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {208, GPA_HIDE_NAME("PA_SC2_208"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 208 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {209, GPA_HIDE_NAME("PA_SC2_209"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 209 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {210, GPA_HIDE_NAME("PA_SC2_210"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 210 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {211, GPA_HIDE_NAME("PA_SC2_211"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 211 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {212, GPA_HIDE_NAME("PA_SC2_212"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 212 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {213, GPA_HIDE_NAME("PA_SC2_213"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 213 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {214, GPA_HIDE_NAME("PA_SC2_214"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 214 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {215, GPA_HIDE_NAME("PA_SC2_215"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 215 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {216, GPA_HIDE_NAME("PA_SC2_216"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 216 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {217, GPA_HIDE_NAME("PA_SC2_217"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 217 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {218, GPA_HIDE_NAME("PA_SC2_218"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 218 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {219, GPA_HIDE_NAME("PA_SC2_219"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 219 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {220, GPA_HIDE_NAME("PA_SC2_220"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 220 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {221, GPA_HIDE_NAME("PA_SC2_221"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 221 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {222, GPA_HIDE_NAME("PA_SC2_222"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 222 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {223, GPA_HIDE_NAME("PA_SC2_223"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 223 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {224, GPA_HIDE_NAME("PA_SC2_224"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 224 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {225, GPA_HIDE_NAME("PA_SC2_225"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 225 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {226, GPA_HIDE_NAME("PA_SC2_226"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 226 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {227, GPA_HIDE_NAME("PA_SC2_227"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 227 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {228, GPA_HIDE_NAME("PA_SC2_228"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 228 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {229, GPA_HIDE_NAME("PA_SC2_229"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 229 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {230, GPA_HIDE_NAME("PA_SC2_230"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 230 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {231, GPA_HIDE_NAME("PA_SC2_231"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 231 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {232, GPA_HIDE_NAME("PA_SC2_232"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 232 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {233, GPA_HIDE_NAME("PA_SC2_233"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 233 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {234, GPA_HIDE_NAME("PA_SC2_234"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 234 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {235, GPA_HIDE_NAME("PA_SC2_P0_HIZ_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("total quads surviving hi-z; db pipe 0;Where measured: sc sc_quad_proc usc_tile_mask_return_fifo in db pipe 1;increment rate-one per clock;range-1/clk;CONTEXT_STATE_SENSITIVE=YES;Results reported per SE, INSTANCE_INDEX=0 to num_packer_per_sc-1;"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {236, GPA_HIDE_NAME("PA_SC2_P1_HIZ_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("total quads surviving hi-z; db pipe 1;Where measured: sc sc_quad_proc usc_tile_mask_return_fifo in db pipe 1;increment rate-one per clock;range-1/clk;CONTEXT_STATE_SENSITIVE=YES;Results reported per SE, INSTANCE_INDEX=0 to num_packer_per_sc-1. Valid only if NUM_DB_PER_PACKER=2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {237, GPA_HIDE_NAME("PA_SC2_P2_HIZ_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("total quads surviving hi-z; db pipe 2 (DEPRECATED only valid for NUM_DB_PER_PACKER=4)"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {238, GPA_HIDE_NAME("PA_SC2_P3_HIZ_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("total quads surviving hi-z; db pipe 3 (DEPRECATED only valid for NUM_DB_PER_PACKER=4)"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {239, GPA_HIDE_NAME("PA_SC2_239"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 239 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {240, GPA_HIDE_NAME("PA_SC2_240"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 240 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {241, GPA_HIDE_NAME("PA_SC2_241"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 241 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {242, GPA_HIDE_NAME("PA_SC2_242"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 242 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {243, GPA_HIDE_NAME("PA_SC2_243"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 243 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {244, GPA_HIDE_NAME("PA_SC2_244"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 244 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {245, GPA_HIDE_NAME("PA_SC2_245"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 245 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {246, GPA_HIDE_NAME("PA_SC2_246"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 246 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {247, GPA_HIDE_NAME("PA_SC2_247"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 247 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {248, GPA_HIDE_NAME("PA_SC2_248"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 248 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {249, GPA_HIDE_NAME("PA_SC2_249"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 249 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {250, GPA_HIDE_NAME("PA_SC2_250"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 250 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {251, GPA_HIDE_NAME("PA_SC2_251"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 251 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {252, GPA_HIDE_NAME("PA_SC2_252"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 252 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {253, GPA_HIDE_NAME("PA_SC2_253"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 253 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {254, GPA_HIDE_NAME("PA_SC2_254"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 254 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {255, GPA_HIDE_NAME("PA_SC2_255"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 255 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {256, GPA_HIDE_NAME("PA_SC2_256"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 256 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {257, GPA_HIDE_NAME("PA_SC2_257"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 257 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {258, GPA_HIDE_NAME("PA_SC2_258"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 258 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {259, GPA_HIDE_NAME("PA_SC2_EARLYZ_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("total quads surviving early-z;Where measured: sc_tileaccum (sc_quadaccum if 1db per packer) inputs to packer;increment rate 1 to 2 quads per clock;range-1/clk;CONTEXT_STATE_SENSITIVE=YES;Results reported per SE, INSTANCE_INDEX=0 to num_packer_per_sc-1."), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {260, GPA_HIDE_NAME("PA_SC2_260"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 260 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {261, GPA_HIDE_NAME("PA_SC2_261"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 261 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {262, GPA_HIDE_NAME("PA_SC2_262"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 262 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {263, GPA_HIDE_NAME("PA_SC2_263"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 263 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {264, GPA_HIDE_NAME("PA_SC2_264"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 264 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {265, GPA_HIDE_NAME("PA_SC2_265"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 265 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {266, GPA_HIDE_NAME("PA_SC2_266"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 266 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {267, GPA_HIDE_NAME("PA_SC2_267"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 267 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {268, GPA_HIDE_NAME("PA_SC2_268"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 268 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {269, GPA_HIDE_NAME("PA_SC2_269"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 269 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {270, GPA_HIDE_NAME("PA_SC2_270"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 270 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {271, GPA_HIDE_NAME("PA_SC2_271"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 271 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {272, GPA_HIDE_NAME("PA_SC2_272"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 272 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {273, GPA_HIDE_NAME("PA_SC2_273"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 273 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {274, GPA_HIDE_NAME("PA_SC2_274"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 274 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {275, GPA_HIDE_NAME("PA_SC2_275"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 275 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {276, GPA_HIDE_NAME("PA_SC2_276"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 276 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {277, GPA_HIDE_NAME("PA_SC2_277"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 277 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {278, GPA_HIDE_NAME("PA_SC2_278"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 278 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {279, GPA_HIDE_NAME("PA_SC2_279"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 279 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {280, GPA_HIDE_NAME("PA_SC2_280"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 280 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {281, GPA_HIDE_NAME("PA_SC2_281"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 281 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {282, GPA_HIDE_NAME("PA_SC2_282"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 282 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {283, GPA_HIDE_NAME("PA_SC2_283"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 283 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {284, GPA_HIDE_NAME("PA_SC2_284"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 284 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {285, GPA_HIDE_NAME("PA_SC2_285"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 285 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {286, GPA_HIDE_NAME("PA_SC2_286"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 286 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {287, GPA_HIDE_NAME("PA_SC2_287"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 287 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {288, GPA_HIDE_NAME("PA_SC2_288"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 288 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {289, GPA_HIDE_NAME("PA_SC2_289"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 289 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {290, GPA_HIDE_NAME("PA_SC2_290"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 290 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {291, GPA_HIDE_NAME("PA_SC2_291"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 291 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {292, GPA_HIDE_NAME("PA_SC2_292"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 292 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {293, GPA_HIDE_NAME("PA_SC2_293"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 293 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {294, GPA_HIDE_NAME("PA_SC2_294"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 294 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {295, GPA_HIDE_NAME("PA_SC2_295"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 295 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {296, GPA_HIDE_NAME("PA_SC2_296"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 296 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {297, GPA_HIDE_NAME("PA_SC2_297"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 297 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {298, GPA_HIDE_NAME("PA_SC2_298"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 298 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {299, GPA_HIDE_NAME("PA_SC2_299"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 299 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {300, GPA_HIDE_NAME("PA_SC2_300"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 300 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {301, GPA_HIDE_NAME("PA_SC2_301"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 301 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {302, GPA_HIDE_NAME("PA_SC2_302"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 302 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {303, GPA_HIDE_NAME("PA_SC2_303"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 303 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {304, GPA_HIDE_NAME("PA_SC2_304"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 304 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {305, GPA_HIDE_NAME("PA_SC2_305"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 305 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {306, GPA_HIDE_NAME("PA_SC2_306"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 306 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {307, GPA_HIDE_NAME("PA_SC2_307"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 307 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {308, GPA_HIDE_NAME("PA_SC2_308"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 308 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {309, GPA_HIDE_NAME("PA_SC2_309"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 309 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {310, GPA_HIDE_NAME("PA_SC2_310"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 310 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {311, GPA_HIDE_NAME("PA_SC2_311"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 311 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {312, GPA_HIDE_NAME("PA_SC2_312"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 312 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {313, GPA_HIDE_NAME("PA_SC2_313"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 313 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {314, GPA_HIDE_NAME("PA_SC2_314"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 314 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {315, GPA_HIDE_NAME("PA_SC2_315"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 315 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {316, GPA_HIDE_NAME("PA_SC2_316"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 316 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {317, GPA_HIDE_NAME("PA_SC2_317"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 317 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {318, GPA_HIDE_NAME("PA_SC2_318"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 318 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {319, GPA_HIDE_NAME("PA_SC2_319"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 319 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {320, GPA_HIDE_NAME("PA_SC2_320"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 320 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {321, GPA_HIDE_NAME("PA_SC2_321"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 321 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {322, GPA_HIDE_NAME("PA_SC2_322"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 322 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {323, GPA_HIDE_NAME("PA_SC2_323"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 323 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {324, GPA_HIDE_NAME("PA_SC2_324"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 324 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {325, GPA_HIDE_NAME("PA_SC2_325"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 325 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {326, GPA_HIDE_NAME("PA_SC2_326"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 326 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {327, GPA_HIDE_NAME("PA_SC2_327"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 327 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {328, GPA_HIDE_NAME("PA_SC2_328"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 328 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {329, GPA_HIDE_NAME("PA_SC2_329"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 329 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {330, GPA_HIDE_NAME("PA_SC2_330"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 330 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {331, GPA_HIDE_NAME("PA_SC2_331"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 331 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {332, GPA_HIDE_NAME("PA_SC2_332"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 332 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {333, GPA_HIDE_NAME("PA_SC2_333"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 333 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {334, GPA_HIDE_NAME("PA_SC2_334"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 334 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {335, GPA_HIDE_NAME("PA_SC2_335"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 335 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {336, GPA_HIDE_NAME("PA_SC2_336"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 336 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {337, GPA_HIDE_NAME("PA_SC2_337"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 337 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {338, GPA_HIDE_NAME("PA_SC2_338"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 338 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {339, GPA_HIDE_NAME("PA_SC2_339"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 339 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {340, GPA_HIDE_NAME("PA_SC2_340"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 340 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {341, GPA_HIDE_NAME("PA_SC2_341"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 341 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {342, GPA_HIDE_NAME("PA_SC2_342"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 342 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {343, GPA_HIDE_NAME("PA_SC2_343"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 343 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {344, GPA_HIDE_NAME("PA_SC2_344"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 344 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {345, GPA_HIDE_NAME("PA_SC2_345"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 345 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {346, GPA_HIDE_NAME("PA_SC2_346"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 346 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {347, GPA_HIDE_NAME("PA_SC2_347"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 347 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {348, GPA_HIDE_NAME("PA_SC2_348"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 348 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {349, GPA_HIDE_NAME("PA_SC2_349"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 349 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {350, GPA_HIDE_NAME("PA_SC2_350"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 350 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {351, GPA_HIDE_NAME("PA_SC2_351"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 351 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {352, GPA_HIDE_NAME("PA_SC2_352"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 352 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {353, GPA_HIDE_NAME("PA_SC2_353"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 353 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {354, GPA_HIDE_NAME("PA_SC2_354"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 354 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {355, GPA_HIDE_NAME("PA_SC2_355"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 355 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {356, GPA_HIDE_NAME("PA_SC2_356"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 356 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {357, GPA_HIDE_NAME("PA_SC2_357"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 357 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {358, GPA_HIDE_NAME("PA_SC2_358"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 358 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {359, GPA_HIDE_NAME("PA_SC2_359"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 359 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {360, GPA_HIDE_NAME("PA_SC2_360"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 360 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {361, GPA_HIDE_NAME("PA_SC2_361"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 361 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {362, GPA_HIDE_NAME("PA_SC2_362"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 362 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {363, GPA_HIDE_NAME("PA_SC2_363"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 363 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {364, GPA_HIDE_NAME("PA_SC2_364"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 364 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {365, GPA_HIDE_NAME("PA_SC2_365"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 365 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {366, GPA_HIDE_NAME("PA_SC2_366"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 366 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {367, GPA_HIDE_NAME("PA_SC2_367"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 367 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {368, GPA_HIDE_NAME("PA_SC2_368"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 368 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {369, GPA_HIDE_NAME("PA_SC2_369"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 369 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {370, GPA_HIDE_NAME("PA_SC2_370"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 370 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {371, GPA_HIDE_NAME("PA_SC2_371"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 371 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {372, GPA_HIDE_NAME("PA_SC2_372"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 372 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {373, GPA_HIDE_NAME("PA_SC2_373"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 373 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {374, GPA_HIDE_NAME("PA_SC2_374"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 374 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {375, GPA_HIDE_NAME("PA_SC2_375"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 375 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {376, GPA_HIDE_NAME("PA_SC2_376"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 376 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {377, GPA_HIDE_NAME("PA_SC2_377"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 377 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {378, GPA_HIDE_NAME("PA_SC2_378"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 378 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {379, GPA_HIDE_NAME("PA_SC2_379"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 379 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {380, GPA_HIDE_NAME("PA_SC2_380"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 380 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {381, GPA_HIDE_NAME("PA_SC2_381"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 381 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {382, GPA_HIDE_NAME("PA_SC2_382"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 382 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {383, GPA_HIDE_NAME("PA_SC2_383"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 383 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {384, GPA_HIDE_NAME("PA_SC2_384"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 384 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {385, GPA_HIDE_NAME("PA_SC2_385"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 385 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {386, GPA_HIDE_NAME("PA_SC2_386"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 386 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {387, GPA_HIDE_NAME("PA_SC2_387"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 387 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {388, GPA_HIDE_NAME("PA_SC2_388"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 388 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {389, GPA_HIDE_NAME("PA_SC2_389"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 389 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {390, GPA_HIDE_NAME("PA_SC2_390"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 390 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {391, GPA_HIDE_NAME("PA_SC2_391"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 391 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {392, GPA_HIDE_NAME("PA_SC2_392"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 392 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {393, GPA_HIDE_NAME("PA_SC2_393"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 393 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {394, GPA_HIDE_NAME("PA_SC2_394"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 394 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {395, GPA_HIDE_NAME("PA_SC2_395"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 395 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {396, GPA_HIDE_NAME("PA_SC2_396"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 396 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {397, GPA_HIDE_NAME("PA_SC2_397"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 397 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {398, GPA_HIDE_NAME("PA_SC2_398"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 398 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {399, GPA_HIDE_NAME("PA_SC2_399"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 399 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {400, GPA_HIDE_NAME("PA_SC2_400"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 400 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {401, GPA_HIDE_NAME("PA_SC2_401"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 401 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {402, GPA_HIDE_NAME("PA_SC2_402"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 402 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {403, GPA_HIDE_NAME("PA_SC2_403"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 403 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {404, GPA_HIDE_NAME("PA_SC2_404"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 404 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {405, GPA_HIDE_NAME("PA_SC2_405"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 405 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {406, GPA_HIDE_NAME("PA_SC2_406"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 406 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {407, GPA_HIDE_NAME("PA_SC2_407"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 407 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {408, GPA_HIDE_NAME("PA_SC2_408"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 408 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {409, GPA_HIDE_NAME("PA_SC2_409"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 409 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {410, GPA_HIDE_NAME("PA_SC2_410"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 410 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {411, GPA_HIDE_NAME("PA_SC2_411"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 411 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {412, GPA_HIDE_NAME("PA_SC2_412"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 412 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {413, GPA_HIDE_NAME("PA_SC2_413"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 413 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {414, GPA_HIDE_NAME("PA_SC2_414"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 414 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {415, GPA_HIDE_NAME("PA_SC2_415"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 415 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {416, GPA_HIDE_NAME("PA_SC2_416"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 416 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {417, GPA_HIDE_NAME("PA_SC2_417"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 417 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {418, GPA_HIDE_NAME("PA_SC2_418"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 418 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {419, GPA_HIDE_NAME("PA_SC2_419"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 419 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {420, GPA_HIDE_NAME("PA_SC2_420"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 420 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {421, GPA_HIDE_NAME("PA_SC2_421"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 421 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {422, GPA_HIDE_NAME("PA_SC2_422"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 422 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {423, GPA_HIDE_NAME("PA_SC2_423"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 423 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {424, GPA_HIDE_NAME("PA_SC2_424"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 424 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {425, GPA_HIDE_NAME("PA_SC2_425"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 425 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {426, GPA_HIDE_NAME("PA_SC2_426"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 426 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {427, GPA_HIDE_NAME("PA_SC2_427"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 427 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {428, GPA_HIDE_NAME("PA_SC2_428"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 428 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {429, GPA_HIDE_NAME("PA_SC2_429"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 429 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {430, GPA_HIDE_NAME("PA_SC2_430"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 430 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {431, GPA_HIDE_NAME("PA_SC2_431"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 431 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {432, GPA_HIDE_NAME("PA_SC2_432"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 432 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {433, GPA_HIDE_NAME("PA_SC2_433"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 433 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {434, GPA_HIDE_NAME("PA_SC2_434"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 434 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {435, GPA_HIDE_NAME("PA_SC2_435"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 435 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {436, GPA_HIDE_NAME("PA_SC2_436"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 436 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {437, GPA_HIDE_NAME("PA_SC2_437"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 437 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {438, GPA_HIDE_NAME("PA_SC2_438"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 438 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {439, GPA_HIDE_NAME("PA_SC2_439"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 439 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {440, GPA_HIDE_NAME("PA_SC2_440"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 440 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {441, GPA_HIDE_NAME("PA_SC2_441"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 441 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {442, GPA_HIDE_NAME("PA_SC2_442"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 442 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {443, GPA_HIDE_NAME("PA_SC2_443"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 443 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {444, GPA_HIDE_NAME("PA_SC2_444"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 444 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {445, GPA_HIDE_NAME("PA_SC2_445"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 445 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {446, GPA_HIDE_NAME("PA_SC2_446"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 446 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {447, GPA_HIDE_NAME("PA_SC2_447"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 447 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {448, GPA_HIDE_NAME("PA_SC2_448"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 448 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {449, GPA_HIDE_NAME("PA_SC2_449"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 449 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {450, GPA_HIDE_NAME("PA_SC2_450"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 450 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {451, GPA_HIDE_NAME("PA_SC2_451"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 451 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {452, GPA_HIDE_NAME("PA_SC2_452"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 452 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {453, GPA_HIDE_NAME("PA_SC2_453"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 453 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {454, GPA_HIDE_NAME("PA_SC2_454"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 454 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {455, GPA_HIDE_NAME("PA_SC2_455"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 455 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {456, GPA_HIDE_NAME("PA_SC2_456"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 456 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {457, GPA_HIDE_NAME("PA_SC2_457"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 457 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {458, GPA_HIDE_NAME("PA_SC2_458"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 458 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {459, GPA_HIDE_NAME("PA_SC2_459"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 459 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {460, GPA_HIDE_NAME("PA_SC2_460"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 460 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {461, GPA_HIDE_NAME("PA_SC2_461"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 461 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {462, GPA_HIDE_NAME("PA_SC2_462"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 462 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {463, GPA_HIDE_NAME("PA_SC2_463"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 463 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {464, GPA_HIDE_NAME("PA_SC2_464"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 464 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {465, GPA_HIDE_NAME("PA_SC2_465"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 465 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {466, GPA_HIDE_NAME("PA_SC2_466"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 466 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {467, GPA_HIDE_NAME("PA_SC2_467"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 467 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {468, GPA_HIDE_NAME("PA_SC2_468"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 468 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {469, GPA_HIDE_NAME("PA_SC2_469"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 469 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {470, GPA_HIDE_NAME("PA_SC2_470"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 470 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {471, GPA_HIDE_NAME("PA_SC2_471"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 471 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {472, GPA_HIDE_NAME("PA_SC2_472"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 472 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {473, GPA_HIDE_NAME("PA_SC2_473"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 473 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {474, GPA_HIDE_NAME("PA_SC2_474"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 474 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {475, GPA_HIDE_NAME("PA_SC2_475"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 475 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {476, GPA_HIDE_NAME("PA_SC2_476"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 476 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {477, GPA_HIDE_NAME("PA_SC2_477"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 477 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {478, GPA_HIDE_NAME("PA_SC2_478"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 478 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {479, GPA_HIDE_NAME("PA_SC2_479"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 479 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {480, GPA_HIDE_NAME("PA_SC2_480"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 480 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {481, GPA_HIDE_NAME("PA_SC2_481"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 481 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {482, GPA_HIDE_NAME("PA_SC2_482"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 482 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {483, GPA_HIDE_NAME("PA_SC2_483"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 483 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {484, GPA_HIDE_NAME("PA_SC2_484"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 484 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {485, GPA_HIDE_NAME("PA_SC2_485"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 485 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {486, GPA_HIDE_NAME("PA_SC2_486"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 486 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {487, GPA_HIDE_NAME("PA_SC2_487"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 487 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {488, GPA_HIDE_NAME("PA_SC2_488"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 488 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {489, GPA_HIDE_NAME("PA_SC2_489"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 489 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {490, GPA_HIDE_NAME("PA_SC2_490"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 490 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {491, GPA_HIDE_NAME("PA_SC2_491"), GPA_HIDE_NAME("PA_SC2"), GPA_HIDE_NAME("Counter 491 from group PA_SC2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-    };
-    GPA_HardwareCounterDesc pa_sc3_counters_gfx9_placeholder4[] = {
-        {0, GPA_HIDE_NAME("PA_SC3_000"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 0 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {1, GPA_HIDE_NAME("PA_SC3_001"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 1 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {2, GPA_HIDE_NAME("PA_SC3_002"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 2 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {3, GPA_HIDE_NAME("PA_SC3_003"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 3 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {4, GPA_HIDE_NAME("PA_SC3_004"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 4 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {5, GPA_HIDE_NAME("PA_SC3_005"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 5 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {6, GPA_HIDE_NAME("PA_SC3_006"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 6 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {7, GPA_HIDE_NAME("PA_SC3_007"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 7 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {8, GPA_HIDE_NAME("PA_SC3_008"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 8 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {9, GPA_HIDE_NAME("PA_SC3_009"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 9 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {10, GPA_HIDE_NAME("PA_SC3_010"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 10 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {11, GPA_HIDE_NAME("PA_SC3_011"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 11 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {12, GPA_HIDE_NAME("PA_SC3_012"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 12 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {13, GPA_HIDE_NAME("PA_SC3_013"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 13 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {14, GPA_HIDE_NAME("PA_SC3_014"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 14 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {15, GPA_HIDE_NAME("PA_SC3_015"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 15 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {16, GPA_HIDE_NAME("PA_SC3_016"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 16 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {17, GPA_HIDE_NAME("PA_SC3_017"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 17 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {18, GPA_HIDE_NAME("PA_SC3_018"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 18 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {19, GPA_HIDE_NAME("PA_SC3_019"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 19 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {20, GPA_HIDE_NAME("PA_SC3_020"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 20 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {21, GPA_HIDE_NAME("PA_SC3_021"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 21 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {22, GPA_HIDE_NAME("PA_SC3_022"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 22 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {23, GPA_HIDE_NAME("PA_SC3_023"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 23 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {24, GPA_HIDE_NAME("PA_SC3_024"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 24 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {25, GPA_HIDE_NAME("PA_SC3_025"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 25 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {26, GPA_HIDE_NAME("PA_SC3_026"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 26 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {27, GPA_HIDE_NAME("PA_SC3_027"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 27 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {28, GPA_HIDE_NAME("PA_SC3_028"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 28 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {29, GPA_HIDE_NAME("PA_SC3_029"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 29 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {30, GPA_HIDE_NAME("PA_SC3_030"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 30 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {31, GPA_HIDE_NAME("PA_SC3_031"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 31 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {32, GPA_HIDE_NAME("PA_SC3_032"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 32 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {33, GPA_HIDE_NAME("PA_SC3_033"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 33 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {34, GPA_HIDE_NAME("PA_SC3_034"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 34 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {35, GPA_HIDE_NAME("PA_SC3_035"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 35 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {36, GPA_HIDE_NAME("PA_SC3_036"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 36 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {37, GPA_HIDE_NAME("PA_SC3_037"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 37 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {38, GPA_HIDE_NAME("PA_SC3_038"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 38 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {39, GPA_HIDE_NAME("PA_SC3_039"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 39 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {40, GPA_HIDE_NAME("PA_SC3_040"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 40 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {41, GPA_HIDE_NAME("PA_SC3_041"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 41 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {42, GPA_HIDE_NAME("PA_SC3_042"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 42 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {43, GPA_HIDE_NAME("PA_SC3_043"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 43 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {44, GPA_HIDE_NAME("PA_SC3_044"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 44 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {45, GPA_HIDE_NAME("PA_SC3_045"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 45 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {46, GPA_HIDE_NAME("PA_SC3_046"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 46 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {47, GPA_HIDE_NAME("PA_SC3_047"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 47 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {48, GPA_HIDE_NAME("PA_SC3_048"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 48 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {49, GPA_HIDE_NAME("PA_SC3_049"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 49 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {50, GPA_HIDE_NAME("PA_SC3_050"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 50 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {51, GPA_HIDE_NAME("PA_SC3_051"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 51 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {52, GPA_HIDE_NAME("PA_SC3_052"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 52 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {53, GPA_HIDE_NAME("PA_SC3_053"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 53 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {54, GPA_HIDE_NAME("PA_SC3_054"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 54 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {55, GPA_HIDE_NAME("PA_SC3_055"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 55 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {56, GPA_HIDE_NAME("PA_SC3_056"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 56 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {57, GPA_HIDE_NAME("PA_SC3_057"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 57 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {58, GPA_HIDE_NAME("PA_SC3_058"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 58 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {59, GPA_HIDE_NAME("PA_SC3_059"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 59 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {60, GPA_HIDE_NAME("PA_SC3_060"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 60 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {61, GPA_HIDE_NAME("PA_SC3_061"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 61 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {62, GPA_HIDE_NAME("PA_SC3_062"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 62 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {63, GPA_HIDE_NAME("PA_SC3_063"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 63 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {64, GPA_HIDE_NAME("PA_SC3_064"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 64 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {65, GPA_HIDE_NAME("PA_SC3_065"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 65 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {66, GPA_HIDE_NAME("PA_SC3_066"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 66 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {67, GPA_HIDE_NAME("PA_SC3_067"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 67 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {68, GPA_HIDE_NAME("PA_SC3_068"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 68 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {69, GPA_HIDE_NAME("PA_SC3_069"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 69 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {70, GPA_HIDE_NAME("PA_SC3_070"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 70 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {71, GPA_HIDE_NAME("PA_SC3_071"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 71 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {72, GPA_HIDE_NAME("PA_SC3_072"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 72 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {73, GPA_HIDE_NAME("PA_SC3_073"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 73 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {74, GPA_HIDE_NAME("PA_SC3_074"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 74 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {75, GPA_HIDE_NAME("PA_SC3_075"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 75 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {76, GPA_HIDE_NAME("PA_SC3_076"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 76 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {77, GPA_HIDE_NAME("PA_SC3_077"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 77 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {78, GPA_HIDE_NAME("PA_SC3_078"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 78 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {79, GPA_HIDE_NAME("PA_SC3_079"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 79 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {80, GPA_HIDE_NAME("PA_SC3_080"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 80 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {81, GPA_HIDE_NAME("PA_SC3_081"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 81 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {82, GPA_HIDE_NAME("PA_SC3_082"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 82 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {83, GPA_HIDE_NAME("PA_SC3_083"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 83 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {84, GPA_HIDE_NAME("PA_SC3_084"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 84 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {85, GPA_HIDE_NAME("PA_SC3_085"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 85 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {86, GPA_HIDE_NAME("PA_SC3_086"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 86 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {87, GPA_HIDE_NAME("PA_SC3_087"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 87 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {88, GPA_HIDE_NAME("PA_SC3_088"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 88 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {89, GPA_HIDE_NAME("PA_SC3_089"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 89 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {90, GPA_HIDE_NAME("PA_SC3_090"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 90 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {91, GPA_HIDE_NAME("PA_SC3_091"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 91 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {92, GPA_HIDE_NAME("PA_SC3_092"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 92 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {93, GPA_HIDE_NAME("PA_SC3_093"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 93 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {94, GPA_HIDE_NAME("PA_SC3_094"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 94 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {95, GPA_HIDE_NAME("PA_SC3_095"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 95 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {96, GPA_HIDE_NAME("PA_SC3_096"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 96 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {97, GPA_HIDE_NAME("PA_SC3_097"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 97 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {98, GPA_HIDE_NAME("PA_SC3_098"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 98 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {99, GPA_HIDE_NAME("PA_SC3_099"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 99 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {100, GPA_HIDE_NAME("PA_SC3_100"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 100 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {101, GPA_HIDE_NAME("PA_SC3_101"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 101 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {102, GPA_HIDE_NAME("PA_SC3_102"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 102 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {103, GPA_HIDE_NAME("PA_SC3_103"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 103 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {104, GPA_HIDE_NAME("PA_SC3_104"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 104 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {105, GPA_HIDE_NAME("PA_SC3_105"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 105 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {106, GPA_HIDE_NAME("PA_SC3_106"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 106 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {107, GPA_HIDE_NAME("PA_SC3_107"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 107 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {108, GPA_HIDE_NAME("PA_SC3_108"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 108 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {109, GPA_HIDE_NAME("PA_SC3_109"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 109 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {110, GPA_HIDE_NAME("PA_SC3_110"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 110 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {111, GPA_HIDE_NAME("PA_SC3_111"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 111 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {112, GPA_HIDE_NAME("PA_SC3_112"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 112 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {113, GPA_HIDE_NAME("PA_SC3_113"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 113 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {114, GPA_HIDE_NAME("PA_SC3_114"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 114 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {115, GPA_HIDE_NAME("PA_SC3_115"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 115 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {116, GPA_HIDE_NAME("PA_SC3_116"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 116 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {117, GPA_HIDE_NAME("PA_SC3_117"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 117 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {118, GPA_HIDE_NAME("PA_SC3_118"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 118 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {119, GPA_HIDE_NAME("PA_SC3_119"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 119 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {120, GPA_HIDE_NAME("PA_SC3_120"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 120 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {121, GPA_HIDE_NAME("PA_SC3_121"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 121 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {122, GPA_HIDE_NAME("PA_SC3_122"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 122 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {123, GPA_HIDE_NAME("PA_SC3_123"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 123 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {124, GPA_HIDE_NAME("PA_SC3_124"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 124 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {125, GPA_HIDE_NAME("PA_SC3_125"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 125 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {126, GPA_HIDE_NAME("PA_SC3_126"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 126 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {127, GPA_HIDE_NAME("PA_SC3_127"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 127 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {128, GPA_HIDE_NAME("PA_SC3_128"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 128 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {129, GPA_HIDE_NAME("PA_SC3_129"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 129 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {130, GPA_HIDE_NAME("PA_SC3_130"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 130 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {131, GPA_HIDE_NAME("PA_SC3_131"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 131 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {132, GPA_HIDE_NAME("PA_SC3_132"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 132 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {133, GPA_HIDE_NAME("PA_SC3_133"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 133 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {134, GPA_HIDE_NAME("PA_SC3_134"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 134 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {135, GPA_HIDE_NAME("PA_SC3_135"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 135 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {136, GPA_HIDE_NAME("PA_SC3_136"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 136 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {137, GPA_HIDE_NAME("PA_SC3_137"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 137 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {138, GPA_HIDE_NAME("PA_SC3_138"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 138 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {139, GPA_HIDE_NAME("PA_SC3_139"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 139 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {140, GPA_HIDE_NAME("PA_SC3_140"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 140 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {141, GPA_HIDE_NAME("PA_SC3_141"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 141 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {142, GPA_HIDE_NAME("PA_SC3_142"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 142 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {143, GPA_HIDE_NAME("PA_SC3_143"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 143 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {144, GPA_HIDE_NAME("PA_SC3_144"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 144 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {145, GPA_HIDE_NAME("PA_SC3_145"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 145 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {146, GPA_HIDE_NAME("PA_SC3_146"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 146 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {147, GPA_HIDE_NAME("PA_SC3_147"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 147 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {148, GPA_HIDE_NAME("PA_SC3_148"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 148 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {149, GPA_HIDE_NAME("PA_SC3_149"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 149 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {150, GPA_HIDE_NAME("PA_SC3_150"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 150 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {151, GPA_HIDE_NAME("PA_SC3_151"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 151 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {152, GPA_HIDE_NAME("PA_SC3_152"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 152 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {153, GPA_HIDE_NAME("PA_SC3_153"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 153 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {154, GPA_HIDE_NAME("PA_SC3_154"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 154 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {155, GPA_HIDE_NAME("PA_SC3_155"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 155 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {156, GPA_HIDE_NAME("PA_SC3_156"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 156 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {157, GPA_HIDE_NAME("PA_SC3_157"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 157 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {158, GPA_HIDE_NAME("PA_SC3_158"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 158 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {159, GPA_HIDE_NAME("PA_SC3_QZ0_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("quad count; quad-z pipe 0;Where measured: sc sc_qdmsk_z output to sc_z_interp in db pipe 0;increment rate-one to 16  per clock;range-1/clk;CONTEXT_STATE_SENSITIVE=YES;Results reported per SE, INSTANCE_INDEX=0 to num_packer_per_sc-1."), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {160, GPA_HIDE_NAME("PA_SC3_QZ1_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("quad count; quad-z pipe 1;Where measured: sc sc_qdmsk_z output to sc_z_interp in db pipe 1;increment rate-one to 16 per clock;range-1/clk;CONTEXT_STATE_SENSITIVE=YES;Results reported per SE, INSTANCE_INDEX=0 to num_packer_per_sc-1. Valid only if NUM_DB_PER_PACKER=2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {161, GPA_HIDE_NAME("PA_SC3_QZ2_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("quad count; quad-z pipe 2 DEPRECATED (NUM_DB_PER_PACKER=4 variants only)"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {162, GPA_HIDE_NAME("PA_SC3_QZ3_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("quad count; quad-z pipe 3 DEPRECATED (NUM_DB_PER_PACKER=4 variants only)"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {163, GPA_HIDE_NAME("PA_SC3_163"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 163 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {164, GPA_HIDE_NAME("PA_SC3_164"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 164 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {165, GPA_HIDE_NAME("PA_SC3_165"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 165 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {166, GPA_HIDE_NAME("PA_SC3_166"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 166 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {167, GPA_HIDE_NAME("PA_SC3_167"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 167 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {168, GPA_HIDE_NAME("PA_SC3_168"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 168 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {169, GPA_HIDE_NAME("PA_SC3_169"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 169 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {170, GPA_HIDE_NAME("PA_SC3_170"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 170 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {171, GPA_HIDE_NAME("PA_SC3_171"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 171 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {172, GPA_HIDE_NAME("PA_SC3_172"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 172 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {173, GPA_HIDE_NAME("PA_SC3_173"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 173 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {174, GPA_HIDE_NAME("PA_SC3_174"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 174 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {175, GPA_HIDE_NAME("PA_SC3_175"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 175 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {176, GPA_HIDE_NAME("PA_SC3_176"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 176 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {177, GPA_HIDE_NAME("PA_SC3_177"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 177 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {178, GPA_HIDE_NAME("PA_SC3_178"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 178 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {179, GPA_HIDE_NAME("PA_SC3_179"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 179 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {180, GPA_HIDE_NAME("PA_SC3_180"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 180 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {181, GPA_HIDE_NAME("PA_SC3_181"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 181 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {182, GPA_HIDE_NAME("PA_SC3_182"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 182 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {183, GPA_HIDE_NAME("PA_SC3_183"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 183 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {184, GPA_HIDE_NAME("PA_SC3_184"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 184 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {185, GPA_HIDE_NAME("PA_SC3_185"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 185 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {186, GPA_HIDE_NAME("PA_SC3_186"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 186 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {187, GPA_HIDE_NAME("PA_SC3_187"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 187 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {188, GPA_HIDE_NAME("PA_SC3_188"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 188 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {189, GPA_HIDE_NAME("PA_SC3_189"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 189 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {190, GPA_HIDE_NAME("PA_SC3_190"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 190 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {191, GPA_HIDE_NAME("PA_SC3_191"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 191 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {192, GPA_HIDE_NAME("PA_SC3_192"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 192 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {193, GPA_HIDE_NAME("PA_SC3_193"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 193 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {194, GPA_HIDE_NAME("PA_SC3_194"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 194 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {195, GPA_HIDE_NAME("PA_SC3_195"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 195 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {196, GPA_HIDE_NAME("PA_SC3_196"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 196 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {197, GPA_HIDE_NAME("PA_SC3_197"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 197 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {198, GPA_HIDE_NAME("PA_SC3_198"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 198 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {199, GPA_HIDE_NAME("PA_SC3_199"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 199 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {200, GPA_HIDE_NAME("PA_SC3_200"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 200 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {201, GPA_HIDE_NAME("PA_SC3_201"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 201 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {202, GPA_HIDE_NAME("PA_SC3_202"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 202 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {203, GPA_HIDE_NAME("PA_SC3_203"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 203 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {204, GPA_HIDE_NAME("PA_SC3_204"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 204 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {205, GPA_HIDE_NAME("PA_SC3_205"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 205 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {206, GPA_HIDE_NAME("PA_SC3_206"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 206 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {207, GPA_HIDE_NAME("PA_SC3_207"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 207 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {208, GPA_HIDE_NAME("PA_SC3_208"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 208 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {209, GPA_HIDE_NAME("PA_SC3_209"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 209 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {210, GPA_HIDE_NAME("PA_SC3_210"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 210 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {211, GPA_HIDE_NAME("PA_SC3_211"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 211 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {212, GPA_HIDE_NAME("PA_SC3_212"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 212 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {213, GPA_HIDE_NAME("PA_SC3_213"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 213 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {214, GPA_HIDE_NAME("PA_SC3_214"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 214 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {215, GPA_HIDE_NAME("PA_SC3_215"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 215 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {216, GPA_HIDE_NAME("PA_SC3_216"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 216 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {217, GPA_HIDE_NAME("PA_SC3_217"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 217 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {218, GPA_HIDE_NAME("PA_SC3_218"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 218 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {219, GPA_HIDE_NAME("PA_SC3_219"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 219 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {220, GPA_HIDE_NAME("PA_SC3_220"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 220 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {221, GPA_HIDE_NAME("PA_SC3_221"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 221 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {222, GPA_HIDE_NAME("PA_SC3_222"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 222 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {223, GPA_HIDE_NAME("PA_SC3_223"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 223 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {224, GPA_HIDE_NAME("PA_SC3_224"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 224 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {225, GPA_HIDE_NAME("PA_SC3_225"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 225 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {226, GPA_HIDE_NAME("PA_SC3_226"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 226 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {227, GPA_HIDE_NAME("PA_SC3_227"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 227 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {228, GPA_HIDE_NAME("PA_SC3_228"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 228 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {229, GPA_HIDE_NAME("PA_SC3_229"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 229 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {230, GPA_HIDE_NAME("PA_SC3_230"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 230 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {231, GPA_HIDE_NAME("PA_SC3_231"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 231 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {232, GPA_HIDE_NAME("PA_SC3_232"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 232 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {233, GPA_HIDE_NAME("PA_SC3_233"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 233 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {234, GPA_HIDE_NAME("PA_SC3_234"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 234 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {235, GPA_HIDE_NAME("PA_SC3_P0_HIZ_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("total quads surviving hi-z; db pipe 0;Where measured: sc sc_quad_proc usc_tile_mask_return_fifo in db pipe 1;increment rate-one per clock;range-1/clk;CONTEXT_STATE_SENSITIVE=YES;Results reported per SE, INSTANCE_INDEX=0 to num_packer_per_sc-1;"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {236, GPA_HIDE_NAME("PA_SC3_P1_HIZ_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("total quads surviving hi-z; db pipe 1;Where measured: sc sc_quad_proc usc_tile_mask_return_fifo in db pipe 1;increment rate-one per clock;range-1/clk;CONTEXT_STATE_SENSITIVE=YES;Results reported per SE, INSTANCE_INDEX=0 to num_packer_per_sc-1. Valid only if NUM_DB_PER_PACKER=2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {237, GPA_HIDE_NAME("PA_SC3_P2_HIZ_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("total quads surviving hi-z; db pipe 2 (DEPRECATED only valid for NUM_DB_PER_PACKER=4)"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {238, GPA_HIDE_NAME("PA_SC3_P3_HIZ_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("total quads surviving hi-z; db pipe 3 (DEPRECATED only valid for NUM_DB_PER_PACKER=4)"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {239, GPA_HIDE_NAME("PA_SC3_239"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 239 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {240, GPA_HIDE_NAME("PA_SC3_240"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 240 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {241, GPA_HIDE_NAME("PA_SC3_241"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 241 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {242, GPA_HIDE_NAME("PA_SC3_242"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 242 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {243, GPA_HIDE_NAME("PA_SC3_243"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 243 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {244, GPA_HIDE_NAME("PA_SC3_244"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 244 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {245, GPA_HIDE_NAME("PA_SC3_245"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 245 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {246, GPA_HIDE_NAME("PA_SC3_246"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 246 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {247, GPA_HIDE_NAME("PA_SC3_247"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 247 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {248, GPA_HIDE_NAME("PA_SC3_248"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 248 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {249, GPA_HIDE_NAME("PA_SC3_249"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 249 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {250, GPA_HIDE_NAME("PA_SC3_250"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 250 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {251, GPA_HIDE_NAME("PA_SC3_251"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 251 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {252, GPA_HIDE_NAME("PA_SC3_252"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 252 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {253, GPA_HIDE_NAME("PA_SC3_253"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 253 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {254, GPA_HIDE_NAME("PA_SC3_254"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 254 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {255, GPA_HIDE_NAME("PA_SC3_255"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 255 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {256, GPA_HIDE_NAME("PA_SC3_256"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 256 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {257, GPA_HIDE_NAME("PA_SC3_257"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 257 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {258, GPA_HIDE_NAME("PA_SC3_258"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 258 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {259, GPA_HIDE_NAME("PA_SC3_EARLYZ_QUAD_COUNT"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("total quads surviving early-z;Where measured: sc_tileaccum (sc_quadaccum if 1db per packer) inputs to packer;increment rate 1 to 2 quads per clock;range-1/clk;CONTEXT_STATE_SENSITIVE=YES;Results reported per SE, INSTANCE_INDEX=0 to num_packer_per_sc-1."), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {260, GPA_HIDE_NAME("PA_SC3_260"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 260 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {261, GPA_HIDE_NAME("PA_SC3_261"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 261 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {262, GPA_HIDE_NAME("PA_SC3_262"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 262 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {263, GPA_HIDE_NAME("PA_SC3_263"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 263 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {264, GPA_HIDE_NAME("PA_SC3_264"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 264 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {265, GPA_HIDE_NAME("PA_SC3_265"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 265 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {266, GPA_HIDE_NAME("PA_SC3_266"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 266 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {267, GPA_HIDE_NAME("PA_SC3_267"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 267 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {268, GPA_HIDE_NAME("PA_SC3_268"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 268 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {269, GPA_HIDE_NAME("PA_SC3_269"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 269 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {270, GPA_HIDE_NAME("PA_SC3_270"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 270 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {271, GPA_HIDE_NAME("PA_SC3_271"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 271 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {272, GPA_HIDE_NAME("PA_SC3_272"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 272 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {273, GPA_HIDE_NAME("PA_SC3_273"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 273 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {274, GPA_HIDE_NAME("PA_SC3_274"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 274 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {275, GPA_HIDE_NAME("PA_SC3_275"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 275 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {276, GPA_HIDE_NAME("PA_SC3_276"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 276 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {277, GPA_HIDE_NAME("PA_SC3_277"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 277 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {278, GPA_HIDE_NAME("PA_SC3_278"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 278 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {279, GPA_HIDE_NAME("PA_SC3_279"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 279 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {280, GPA_HIDE_NAME("PA_SC3_280"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 280 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {281, GPA_HIDE_NAME("PA_SC3_281"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 281 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {282, GPA_HIDE_NAME("PA_SC3_282"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 282 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {283, GPA_HIDE_NAME("PA_SC3_283"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 283 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {284, GPA_HIDE_NAME("PA_SC3_284"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 284 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {285, GPA_HIDE_NAME("PA_SC3_285"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 285 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {286, GPA_HIDE_NAME("PA_SC3_286"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 286 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {287, GPA_HIDE_NAME("PA_SC3_287"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 287 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {288, GPA_HIDE_NAME("PA_SC3_288"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 288 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {289, GPA_HIDE_NAME("PA_SC3_289"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 289 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {290, GPA_HIDE_NAME("PA_SC3_290"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 290 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {291, GPA_HIDE_NAME("PA_SC3_291"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 291 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {292, GPA_HIDE_NAME("PA_SC3_292"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 292 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {293, GPA_HIDE_NAME("PA_SC3_293"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 293 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {294, GPA_HIDE_NAME("PA_SC3_294"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 294 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {295, GPA_HIDE_NAME("PA_SC3_295"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 295 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {296, GPA_HIDE_NAME("PA_SC3_296"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 296 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {297, GPA_HIDE_NAME("PA_SC3_297"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 297 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {298, GPA_HIDE_NAME("PA_SC3_298"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 298 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {299, GPA_HIDE_NAME("PA_SC3_299"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 299 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {300, GPA_HIDE_NAME("PA_SC3_300"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 300 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {301, GPA_HIDE_NAME("PA_SC3_301"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 301 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {302, GPA_HIDE_NAME("PA_SC3_302"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 302 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {303, GPA_HIDE_NAME("PA_SC3_303"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 303 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {304, GPA_HIDE_NAME("PA_SC3_304"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 304 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {305, GPA_HIDE_NAME("PA_SC3_305"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 305 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {306, GPA_HIDE_NAME("PA_SC3_306"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 306 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {307, GPA_HIDE_NAME("PA_SC3_307"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 307 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {308, GPA_HIDE_NAME("PA_SC3_308"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 308 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {309, GPA_HIDE_NAME("PA_SC3_309"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 309 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {310, GPA_HIDE_NAME("PA_SC3_310"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 310 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {311, GPA_HIDE_NAME("PA_SC3_311"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 311 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {312, GPA_HIDE_NAME("PA_SC3_312"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 312 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {313, GPA_HIDE_NAME("PA_SC3_313"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 313 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {314, GPA_HIDE_NAME("PA_SC3_314"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 314 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {315, GPA_HIDE_NAME("PA_SC3_315"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 315 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {316, GPA_HIDE_NAME("PA_SC3_316"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 316 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {317, GPA_HIDE_NAME("PA_SC3_317"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 317 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {318, GPA_HIDE_NAME("PA_SC3_318"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 318 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {319, GPA_HIDE_NAME("PA_SC3_319"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 319 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {320, GPA_HIDE_NAME("PA_SC3_320"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 320 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {321, GPA_HIDE_NAME("PA_SC3_321"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 321 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {322, GPA_HIDE_NAME("PA_SC3_322"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 322 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {323, GPA_HIDE_NAME("PA_SC3_323"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 323 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {324, GPA_HIDE_NAME("PA_SC3_324"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 324 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {325, GPA_HIDE_NAME("PA_SC3_325"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 325 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {326, GPA_HIDE_NAME("PA_SC3_326"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 326 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {327, GPA_HIDE_NAME("PA_SC3_327"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 327 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {328, GPA_HIDE_NAME("PA_SC3_328"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 328 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {329, GPA_HIDE_NAME("PA_SC3_329"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 329 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {330, GPA_HIDE_NAME("PA_SC3_330"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 330 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {331, GPA_HIDE_NAME("PA_SC3_331"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 331 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {332, GPA_HIDE_NAME("PA_SC3_332"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 332 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {333, GPA_HIDE_NAME("PA_SC3_333"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 333 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {334, GPA_HIDE_NAME("PA_SC3_334"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 334 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {335, GPA_HIDE_NAME("PA_SC3_335"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 335 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {336, GPA_HIDE_NAME("PA_SC3_336"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 336 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {337, GPA_HIDE_NAME("PA_SC3_337"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 337 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {338, GPA_HIDE_NAME("PA_SC3_338"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 338 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {339, GPA_HIDE_NAME("PA_SC3_339"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 339 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {340, GPA_HIDE_NAME("PA_SC3_340"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 340 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {341, GPA_HIDE_NAME("PA_SC3_341"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 341 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {342, GPA_HIDE_NAME("PA_SC3_342"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 342 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {343, GPA_HIDE_NAME("PA_SC3_343"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 343 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {344, GPA_HIDE_NAME("PA_SC3_344"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 344 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {345, GPA_HIDE_NAME("PA_SC3_345"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 345 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {346, GPA_HIDE_NAME("PA_SC3_346"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 346 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {347, GPA_HIDE_NAME("PA_SC3_347"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 347 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {348, GPA_HIDE_NAME("PA_SC3_348"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 348 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {349, GPA_HIDE_NAME("PA_SC3_349"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 349 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {350, GPA_HIDE_NAME("PA_SC3_350"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 350 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {351, GPA_HIDE_NAME("PA_SC3_351"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 351 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {352, GPA_HIDE_NAME("PA_SC3_352"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 352 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {353, GPA_HIDE_NAME("PA_SC3_353"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 353 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {354, GPA_HIDE_NAME("PA_SC3_354"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 354 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {355, GPA_HIDE_NAME("PA_SC3_355"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 355 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {356, GPA_HIDE_NAME("PA_SC3_356"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 356 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {357, GPA_HIDE_NAME("PA_SC3_357"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 357 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {358, GPA_HIDE_NAME("PA_SC3_358"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 358 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {359, GPA_HIDE_NAME("PA_SC3_359"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 359 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {360, GPA_HIDE_NAME("PA_SC3_360"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 360 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {361, GPA_HIDE_NAME("PA_SC3_361"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 361 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {362, GPA_HIDE_NAME("PA_SC3_362"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 362 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {363, GPA_HIDE_NAME("PA_SC3_363"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 363 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {364, GPA_HIDE_NAME("PA_SC3_364"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 364 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {365, GPA_HIDE_NAME("PA_SC3_365"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 365 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {366, GPA_HIDE_NAME("PA_SC3_366"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 366 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {367, GPA_HIDE_NAME("PA_SC3_367"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 367 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {368, GPA_HIDE_NAME("PA_SC3_368"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 368 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {369, GPA_HIDE_NAME("PA_SC3_369"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 369 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {370, GPA_HIDE_NAME("PA_SC3_370"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 370 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {371, GPA_HIDE_NAME("PA_SC3_371"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 371 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {372, GPA_HIDE_NAME("PA_SC3_372"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 372 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {373, GPA_HIDE_NAME("PA_SC3_373"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 373 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {374, GPA_HIDE_NAME("PA_SC3_374"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 374 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {375, GPA_HIDE_NAME("PA_SC3_375"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 375 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {376, GPA_HIDE_NAME("PA_SC3_376"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 376 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {377, GPA_HIDE_NAME("PA_SC3_377"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 377 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {378, GPA_HIDE_NAME("PA_SC3_378"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 378 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {379, GPA_HIDE_NAME("PA_SC3_379"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 379 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {380, GPA_HIDE_NAME("PA_SC3_380"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 380 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {381, GPA_HIDE_NAME("PA_SC3_381"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 381 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {382, GPA_HIDE_NAME("PA_SC3_382"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 382 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {383, GPA_HIDE_NAME("PA_SC3_383"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 383 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {384, GPA_HIDE_NAME("PA_SC3_384"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 384 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {385, GPA_HIDE_NAME("PA_SC3_385"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 385 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {386, GPA_HIDE_NAME("PA_SC3_386"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 386 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {387, GPA_HIDE_NAME("PA_SC3_387"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 387 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {388, GPA_HIDE_NAME("PA_SC3_388"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 388 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {389, GPA_HIDE_NAME("PA_SC3_389"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 389 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {390, GPA_HIDE_NAME("PA_SC3_390"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 390 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {391, GPA_HIDE_NAME("PA_SC3_391"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 391 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {392, GPA_HIDE_NAME("PA_SC3_392"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 392 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {393, GPA_HIDE_NAME("PA_SC3_393"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 393 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {394, GPA_HIDE_NAME("PA_SC3_394"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 394 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {395, GPA_HIDE_NAME("PA_SC3_395"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 395 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {396, GPA_HIDE_NAME("PA_SC3_396"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 396 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {397, GPA_HIDE_NAME("PA_SC3_397"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 397 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {398, GPA_HIDE_NAME("PA_SC3_398"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 398 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {399, GPA_HIDE_NAME("PA_SC3_399"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 399 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {400, GPA_HIDE_NAME("PA_SC3_400"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 400 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {401, GPA_HIDE_NAME("PA_SC3_401"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 401 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {402, GPA_HIDE_NAME("PA_SC3_402"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 402 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {403, GPA_HIDE_NAME("PA_SC3_403"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 403 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {404, GPA_HIDE_NAME("PA_SC3_404"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 404 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {405, GPA_HIDE_NAME("PA_SC3_405"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 405 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {406, GPA_HIDE_NAME("PA_SC3_406"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 406 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {407, GPA_HIDE_NAME("PA_SC3_407"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 407 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {408, GPA_HIDE_NAME("PA_SC3_408"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 408 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {409, GPA_HIDE_NAME("PA_SC3_409"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 409 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {410, GPA_HIDE_NAME("PA_SC3_410"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 410 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {411, GPA_HIDE_NAME("PA_SC3_411"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 411 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {412, GPA_HIDE_NAME("PA_SC3_412"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 412 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {413, GPA_HIDE_NAME("PA_SC3_413"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 413 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {414, GPA_HIDE_NAME("PA_SC3_414"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 414 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {415, GPA_HIDE_NAME("PA_SC3_415"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 415 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {416, GPA_HIDE_NAME("PA_SC3_416"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 416 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {417, GPA_HIDE_NAME("PA_SC3_417"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 417 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {418, GPA_HIDE_NAME("PA_SC3_418"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 418 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {419, GPA_HIDE_NAME("PA_SC3_419"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 419 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {420, GPA_HIDE_NAME("PA_SC3_420"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 420 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {421, GPA_HIDE_NAME("PA_SC3_421"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 421 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {422, GPA_HIDE_NAME("PA_SC3_422"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 422 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {423, GPA_HIDE_NAME("PA_SC3_423"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 423 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {424, GPA_HIDE_NAME("PA_SC3_424"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 424 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {425, GPA_HIDE_NAME("PA_SC3_425"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 425 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {426, GPA_HIDE_NAME("PA_SC3_426"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 426 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {427, GPA_HIDE_NAME("PA_SC3_427"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 427 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {428, GPA_HIDE_NAME("PA_SC3_428"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 428 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {429, GPA_HIDE_NAME("PA_SC3_429"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 429 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {430, GPA_HIDE_NAME("PA_SC3_430"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 430 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {431, GPA_HIDE_NAME("PA_SC3_431"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 431 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {432, GPA_HIDE_NAME("PA_SC3_432"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 432 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {433, GPA_HIDE_NAME("PA_SC3_433"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 433 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {434, GPA_HIDE_NAME("PA_SC3_434"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 434 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {435, GPA_HIDE_NAME("PA_SC3_435"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 435 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {436, GPA_HIDE_NAME("PA_SC3_436"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 436 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {437, GPA_HIDE_NAME("PA_SC3_437"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 437 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {438, GPA_HIDE_NAME("PA_SC3_438"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 438 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {439, GPA_HIDE_NAME("PA_SC3_439"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 439 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {440, GPA_HIDE_NAME("PA_SC3_440"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 440 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {441, GPA_HIDE_NAME("PA_SC3_441"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 441 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {442, GPA_HIDE_NAME("PA_SC3_442"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 442 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {443, GPA_HIDE_NAME("PA_SC3_443"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 443 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {444, GPA_HIDE_NAME("PA_SC3_444"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 444 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {445, GPA_HIDE_NAME("PA_SC3_445"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 445 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {446, GPA_HIDE_NAME("PA_SC3_446"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 446 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {447, GPA_HIDE_NAME("PA_SC3_447"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 447 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {448, GPA_HIDE_NAME("PA_SC3_448"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 448 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {449, GPA_HIDE_NAME("PA_SC3_449"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 449 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {450, GPA_HIDE_NAME("PA_SC3_450"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 450 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {451, GPA_HIDE_NAME("PA_SC3_451"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 451 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {452, GPA_HIDE_NAME("PA_SC3_452"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 452 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {453, GPA_HIDE_NAME("PA_SC3_453"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 453 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {454, GPA_HIDE_NAME("PA_SC3_454"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 454 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {455, GPA_HIDE_NAME("PA_SC3_455"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 455 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {456, GPA_HIDE_NAME("PA_SC3_456"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 456 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {457, GPA_HIDE_NAME("PA_SC3_457"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 457 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {458, GPA_HIDE_NAME("PA_SC3_458"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 458 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {459, GPA_HIDE_NAME("PA_SC3_459"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 459 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {460, GPA_HIDE_NAME("PA_SC3_460"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 460 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {461, GPA_HIDE_NAME("PA_SC3_461"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 461 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {462, GPA_HIDE_NAME("PA_SC3_462"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 462 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {463, GPA_HIDE_NAME("PA_SC3_463"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 463 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {464, GPA_HIDE_NAME("PA_SC3_464"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 464 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {465, GPA_HIDE_NAME("PA_SC3_465"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 465 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {466, GPA_HIDE_NAME("PA_SC3_466"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 466 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {467, GPA_HIDE_NAME("PA_SC3_467"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 467 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {468, GPA_HIDE_NAME("PA_SC3_468"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 468 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {469, GPA_HIDE_NAME("PA_SC3_469"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 469 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {470, GPA_HIDE_NAME("PA_SC3_470"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 470 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {471, GPA_HIDE_NAME("PA_SC3_471"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 471 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {472, GPA_HIDE_NAME("PA_SC3_472"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 472 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {473, GPA_HIDE_NAME("PA_SC3_473"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 473 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {474, GPA_HIDE_NAME("PA_SC3_474"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 474 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {475, GPA_HIDE_NAME("PA_SC3_475"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 475 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {476, GPA_HIDE_NAME("PA_SC3_476"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 476 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {477, GPA_HIDE_NAME("PA_SC3_477"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 477 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {478, GPA_HIDE_NAME("PA_SC3_478"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 478 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {479, GPA_HIDE_NAME("PA_SC3_479"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 479 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {480, GPA_HIDE_NAME("PA_SC3_480"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 480 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {481, GPA_HIDE_NAME("PA_SC3_481"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 481 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {482, GPA_HIDE_NAME("PA_SC3_482"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 482 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {483, GPA_HIDE_NAME("PA_SC3_483"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 483 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {484, GPA_HIDE_NAME("PA_SC3_484"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 484 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {485, GPA_HIDE_NAME("PA_SC3_485"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 485 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {486, GPA_HIDE_NAME("PA_SC3_486"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 486 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {487, GPA_HIDE_NAME("PA_SC3_487"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 487 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {488, GPA_HIDE_NAME("PA_SC3_488"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 488 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {489, GPA_HIDE_NAME("PA_SC3_489"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 489 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {490, GPA_HIDE_NAME("PA_SC3_490"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 490 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {491, GPA_HIDE_NAME("PA_SC3_491"), GPA_HIDE_NAME("PA_SC3"), GPA_HIDE_NAME("Counter 491 from group PA_SC3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-    };
-    GPA_HardwareCounterDesc ia0_counters_gfx9_placeholder4[] = {
-        {0, GPA_HIDE_NAME("IA0_000"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 0 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {1, GPA_HIDE_NAME("IA0_001"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 1 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {2, GPA_HIDE_NAME("IA0_002"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 2 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {3, GPA_HIDE_NAME("IA0_003"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 3 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {4, GPA_HIDE_NAME("IA0_004"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 4 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {5, GPA_HIDE_NAME("IA0_005"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 5 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {6, GPA_HIDE_NAME("IA0_006"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 6 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {7, GPA_HIDE_NAME("IA0_007"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 7 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {8, GPA_HIDE_NAME("IA0_008"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 8 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {9, GPA_HIDE_NAME("IA0_009"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 9 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {10, GPA_HIDE_NAME("IA0_010"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 10 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {11, GPA_HIDE_NAME("IA0_011"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 11 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {12, GPA_HIDE_NAME("IA0_012"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 12 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {13, GPA_HIDE_NAME("IA0_013"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 13 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {14, GPA_HIDE_NAME("IA0_014"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 14 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {15, GPA_HIDE_NAME("IA0_015"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 15 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {16, GPA_HIDE_NAME("IA0_016"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 16 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {17, GPA_HIDE_NAME("IA0_017"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 17 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {18, GPA_HIDE_NAME("IA0_018"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 18 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {19, GPA_HIDE_NAME("IA0_019"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 19 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {20, GPA_HIDE_NAME("IA0_020"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 20 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {21, GPA_HIDE_NAME("IA0_021"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 21 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {22, GPA_HIDE_NAME("IA0_022"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 22 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {23, GPA_HIDE_NAME("IA0_023"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 23 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {24, GPA_HIDE_NAME("IA0_024"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 24 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {25, GPA_HIDE_NAME("IA0_025"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 25 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {26, GPA_HIDE_NAME("IA0_026"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 26 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {27, GPA_HIDE_NAME("IA0_027"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 27 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {28, GPA_HIDE_NAME("IA0_028"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 28 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {29, GPA_HIDE_NAME("IA0_029"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 29 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {30, GPA_HIDE_NAME("IA0_030"), GPA_HIDE_NAME("IA0"), GPA_HIDE_NAME("Counter 30 from group IA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-    };
-    GPA_HardwareCounterDesc ia1_counters_gfx9_placeholder4[] = {
-        {0, GPA_HIDE_NAME("IA1_000"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 0 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {1, GPA_HIDE_NAME("IA1_001"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 1 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {2, GPA_HIDE_NAME("IA1_002"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 2 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {3, GPA_HIDE_NAME("IA1_003"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 3 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {4, GPA_HIDE_NAME("IA1_004"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 4 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {5, GPA_HIDE_NAME("IA1_005"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 5 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {6, GPA_HIDE_NAME("IA1_006"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 6 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {7, GPA_HIDE_NAME("IA1_007"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 7 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {8, GPA_HIDE_NAME("IA1_008"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 8 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {9, GPA_HIDE_NAME("IA1_009"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 9 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {10, GPA_HIDE_NAME("IA1_010"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 10 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {11, GPA_HIDE_NAME("IA1_011"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 11 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {12, GPA_HIDE_NAME("IA1_012"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 12 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {13, GPA_HIDE_NAME("IA1_013"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 13 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {14, GPA_HIDE_NAME("IA1_014"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 14 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {15, GPA_HIDE_NAME("IA1_015"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 15 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {16, GPA_HIDE_NAME("IA1_016"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 16 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {17, GPA_HIDE_NAME("IA1_017"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 17 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {18, GPA_HIDE_NAME("IA1_018"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 18 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {19, GPA_HIDE_NAME("IA1_019"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 19 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {20, GPA_HIDE_NAME("IA1_020"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 20 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {21, GPA_HIDE_NAME("IA1_021"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 21 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {22, GPA_HIDE_NAME("IA1_022"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 22 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {23, GPA_HIDE_NAME("IA1_023"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 23 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {24, GPA_HIDE_NAME("IA1_024"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 24 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {25, GPA_HIDE_NAME("IA1_025"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 25 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {26, GPA_HIDE_NAME("IA1_026"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 26 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {27, GPA_HIDE_NAME("IA1_027"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 27 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {28, GPA_HIDE_NAME("IA1_028"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 28 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {29, GPA_HIDE_NAME("IA1_029"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 29 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {30, GPA_HIDE_NAME("IA1_030"), GPA_HIDE_NAME("IA1"), GPA_HIDE_NAME("Counter 30 from group IA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-    };
-    GPA_HardwareCounterDesc gcea0_counters_gfx9_placeholder4[] = {
-        {0, GPA_HIDE_NAME("GCEA0_000"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 0 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {1, GPA_HIDE_NAME("GCEA0_001"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 1 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {2, GPA_HIDE_NAME("GCEA0_002"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 2 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {3, GPA_HIDE_NAME("GCEA0_003"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 3 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {4, GPA_HIDE_NAME("GCEA0_004"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 4 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {5, GPA_HIDE_NAME("GCEA0_005"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 5 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {6, GPA_HIDE_NAME("GCEA0_006"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 6 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {7, GPA_HIDE_NAME("GCEA0_007"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 7 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {8, GPA_HIDE_NAME("GCEA0_008"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 8 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {9, GPA_HIDE_NAME("GCEA0_009"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 9 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {10, GPA_HIDE_NAME("GCEA0_010"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 10 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {11, GPA_HIDE_NAME("GCEA0_011"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 11 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {12, GPA_HIDE_NAME("GCEA0_012"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 12 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {13, GPA_HIDE_NAME("GCEA0_013"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 13 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {14, GPA_HIDE_NAME("GCEA0_014"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 14 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {15, GPA_HIDE_NAME("GCEA0_015"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 15 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {16, GPA_HIDE_NAME("GCEA0_016"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 16 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {17, GPA_HIDE_NAME("GCEA0_017"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 17 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {18, GPA_HIDE_NAME("GCEA0_018"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 18 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {19, GPA_HIDE_NAME("GCEA0_019"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 19 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {20, GPA_HIDE_NAME("GCEA0_020"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 20 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {21, GPA_HIDE_NAME("GCEA0_021"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 21 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {22, GPA_HIDE_NAME("GCEA0_022"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 22 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {23, GPA_HIDE_NAME("GCEA0_023"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 23 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {24, GPA_HIDE_NAME("GCEA0_024"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 24 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {25, GPA_HIDE_NAME("GCEA0_025"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 25 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {26, GPA_HIDE_NAME("GCEA0_026"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 26 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {27, GPA_HIDE_NAME("GCEA0_027"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 27 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {28, GPA_HIDE_NAME("GCEA0_028"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 28 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {29, GPA_HIDE_NAME("GCEA0_029"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 29 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {30, GPA_HIDE_NAME("GCEA0_030"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 30 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {31, GPA_HIDE_NAME("GCEA0_031"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 31 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {32, GPA_HIDE_NAME("GCEA0_032"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 32 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {33, GPA_HIDE_NAME("GCEA0_033"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 33 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {34, GPA_HIDE_NAME("GCEA0_034"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 34 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {35, GPA_HIDE_NAME("GCEA0_035"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 35 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {36, GPA_HIDE_NAME("GCEA0_036"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 36 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {37, GPA_HIDE_NAME("GCEA0_037"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 37 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {38, GPA_HIDE_NAME("GCEA0_038"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 38 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {39, GPA_HIDE_NAME("GCEA0_039"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 39 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {40, GPA_HIDE_NAME("GCEA0_040"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 40 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {41, GPA_HIDE_NAME("GCEA0_041"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 41 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {42, GPA_HIDE_NAME("GCEA0_042"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 42 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {43, GPA_HIDE_NAME("GCEA0_043"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 43 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {44, GPA_HIDE_NAME("GCEA0_044"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 44 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {45, GPA_HIDE_NAME("GCEA0_045"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 45 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {46, GPA_HIDE_NAME("GCEA0_046"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 46 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {47, GPA_HIDE_NAME("GCEA0_047"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 47 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {48, GPA_HIDE_NAME("GCEA0_048"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 48 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {49, GPA_HIDE_NAME("GCEA0_049"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 49 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {50, GPA_HIDE_NAME("GCEA0_050"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 50 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {51, GPA_HIDE_NAME("GCEA0_051"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 51 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {52, GPA_HIDE_NAME("GCEA0_052"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 52 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {53, GPA_HIDE_NAME("GCEA0_053"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 53 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {54, GPA_HIDE_NAME("GCEA0_054"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 54 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {55, GPA_HIDE_NAME("GCEA0_PERF_SEL_SARB_DRAM_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("DRAM sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {56, GPA_HIDE_NAME("GCEA0_056"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 56 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {57, GPA_HIDE_NAME("GCEA0_PERF_SEL_SARB_IO_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("I/O sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {58, GPA_HIDE_NAME("GCEA0_058"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 58 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {59, GPA_HIDE_NAME("GCEA0_059"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 59 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {60, GPA_HIDE_NAME("GCEA0_060"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 60 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {61, GPA_HIDE_NAME("GCEA0_061"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 61 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {62, GPA_HIDE_NAME("GCEA0_062"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 62 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {63, GPA_HIDE_NAME("GCEA0_063"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 63 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {64, GPA_HIDE_NAME("GCEA0_064"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 64 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {65, GPA_HIDE_NAME("GCEA0_065"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 65 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {66, GPA_HIDE_NAME("GCEA0_066"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 66 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {67, GPA_HIDE_NAME("GCEA0_067"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 67 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {68, GPA_HIDE_NAME("GCEA0_068"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 68 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {69, GPA_HIDE_NAME("GCEA0_069"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 69 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {70, GPA_HIDE_NAME("GCEA0_070"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 70 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {71, GPA_HIDE_NAME("GCEA0_071"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 71 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {72, GPA_HIDE_NAME("GCEA0_072"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 72 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {73, GPA_HIDE_NAME("GCEA0_073"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 73 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {74, GPA_HIDE_NAME("GCEA0_074"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 74 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {75, GPA_HIDE_NAME("GCEA0_075"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 75 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {76, GPA_HIDE_NAME("GCEA0_076"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 76 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {77, GPA_HIDE_NAME("GCEA0_077"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 77 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {78, GPA_HIDE_NAME("GCEA0_078"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 78 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {79, GPA_HIDE_NAME("GCEA0_079"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 79 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {80, GPA_HIDE_NAME("GCEA0_080"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 80 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {81, GPA_HIDE_NAME("GCEA0_081"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 81 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {82, GPA_HIDE_NAME("GCEA0_082"), GPA_HIDE_NAME("GCEA0"), GPA_HIDE_NAME("Counter 82 from group GCEA0"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-    };
-    GPA_HardwareCounterDesc gcea1_counters_gfx9_placeholder4[] = {
-        {0, GPA_HIDE_NAME("GCEA1_000"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 0 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {1, GPA_HIDE_NAME("GCEA1_001"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 1 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {2, GPA_HIDE_NAME("GCEA1_002"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 2 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {3, GPA_HIDE_NAME("GCEA1_003"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 3 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {4, GPA_HIDE_NAME("GCEA1_004"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 4 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {5, GPA_HIDE_NAME("GCEA1_005"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 5 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {6, GPA_HIDE_NAME("GCEA1_006"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 6 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {7, GPA_HIDE_NAME("GCEA1_007"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 7 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {8, GPA_HIDE_NAME("GCEA1_008"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 8 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {9, GPA_HIDE_NAME("GCEA1_009"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 9 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {10, GPA_HIDE_NAME("GCEA1_010"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 10 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {11, GPA_HIDE_NAME("GCEA1_011"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 11 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {12, GPA_HIDE_NAME("GCEA1_012"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 12 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {13, GPA_HIDE_NAME("GCEA1_013"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 13 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {14, GPA_HIDE_NAME("GCEA1_014"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 14 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {15, GPA_HIDE_NAME("GCEA1_015"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 15 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {16, GPA_HIDE_NAME("GCEA1_016"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 16 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {17, GPA_HIDE_NAME("GCEA1_017"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 17 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {18, GPA_HIDE_NAME("GCEA1_018"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 18 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {19, GPA_HIDE_NAME("GCEA1_019"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 19 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {20, GPA_HIDE_NAME("GCEA1_020"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 20 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {21, GPA_HIDE_NAME("GCEA1_021"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 21 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {22, GPA_HIDE_NAME("GCEA1_022"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 22 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {23, GPA_HIDE_NAME("GCEA1_023"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 23 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {24, GPA_HIDE_NAME("GCEA1_024"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 24 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {25, GPA_HIDE_NAME("GCEA1_025"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 25 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {26, GPA_HIDE_NAME("GCEA1_026"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 26 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {27, GPA_HIDE_NAME("GCEA1_027"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 27 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {28, GPA_HIDE_NAME("GCEA1_028"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 28 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {29, GPA_HIDE_NAME("GCEA1_029"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 29 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {30, GPA_HIDE_NAME("GCEA1_030"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 30 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {31, GPA_HIDE_NAME("GCEA1_031"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 31 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {32, GPA_HIDE_NAME("GCEA1_032"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 32 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {33, GPA_HIDE_NAME("GCEA1_033"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 33 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {34, GPA_HIDE_NAME("GCEA1_034"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 34 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {35, GPA_HIDE_NAME("GCEA1_035"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 35 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {36, GPA_HIDE_NAME("GCEA1_036"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 36 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {37, GPA_HIDE_NAME("GCEA1_037"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 37 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {38, GPA_HIDE_NAME("GCEA1_038"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 38 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {39, GPA_HIDE_NAME("GCEA1_039"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 39 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {40, GPA_HIDE_NAME("GCEA1_040"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 40 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {41, GPA_HIDE_NAME("GCEA1_041"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 41 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {42, GPA_HIDE_NAME("GCEA1_042"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 42 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {43, GPA_HIDE_NAME("GCEA1_043"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 43 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {44, GPA_HIDE_NAME("GCEA1_044"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 44 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {45, GPA_HIDE_NAME("GCEA1_045"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 45 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {46, GPA_HIDE_NAME("GCEA1_046"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 46 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {47, GPA_HIDE_NAME("GCEA1_047"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 47 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {48, GPA_HIDE_NAME("GCEA1_048"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 48 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {49, GPA_HIDE_NAME("GCEA1_049"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 49 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {50, GPA_HIDE_NAME("GCEA1_050"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 50 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {51, GPA_HIDE_NAME("GCEA1_051"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 51 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {52, GPA_HIDE_NAME("GCEA1_052"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 52 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {53, GPA_HIDE_NAME("GCEA1_053"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 53 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {54, GPA_HIDE_NAME("GCEA1_054"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 54 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {55, GPA_HIDE_NAME("GCEA1_PERF_SEL_SARB_DRAM_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("DRAM sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {56, GPA_HIDE_NAME("GCEA1_056"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 56 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {57, GPA_HIDE_NAME("GCEA1_PERF_SEL_SARB_IO_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("I/O sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {58, GPA_HIDE_NAME("GCEA1_058"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 58 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {59, GPA_HIDE_NAME("GCEA1_059"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 59 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {60, GPA_HIDE_NAME("GCEA1_060"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 60 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {61, GPA_HIDE_NAME("GCEA1_061"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 61 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {62, GPA_HIDE_NAME("GCEA1_062"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 62 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {63, GPA_HIDE_NAME("GCEA1_063"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 63 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {64, GPA_HIDE_NAME("GCEA1_064"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 64 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {65, GPA_HIDE_NAME("GCEA1_065"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 65 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {66, GPA_HIDE_NAME("GCEA1_066"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 66 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {67, GPA_HIDE_NAME("GCEA1_067"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 67 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {68, GPA_HIDE_NAME("GCEA1_068"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 68 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {69, GPA_HIDE_NAME("GCEA1_069"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 69 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {70, GPA_HIDE_NAME("GCEA1_070"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 70 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {71, GPA_HIDE_NAME("GCEA1_071"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 71 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {72, GPA_HIDE_NAME("GCEA1_072"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 72 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {73, GPA_HIDE_NAME("GCEA1_073"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 73 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {74, GPA_HIDE_NAME("GCEA1_074"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 74 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {75, GPA_HIDE_NAME("GCEA1_075"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 75 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {76, GPA_HIDE_NAME("GCEA1_076"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 76 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {77, GPA_HIDE_NAME("GCEA1_077"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 77 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {78, GPA_HIDE_NAME("GCEA1_078"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 78 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {79, GPA_HIDE_NAME("GCEA1_079"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 79 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {80, GPA_HIDE_NAME("GCEA1_080"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 80 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {81, GPA_HIDE_NAME("GCEA1_081"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 81 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {82, GPA_HIDE_NAME("GCEA1_082"), GPA_HIDE_NAME("GCEA1"), GPA_HIDE_NAME("Counter 82 from group GCEA1"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-    };
-    GPA_HardwareCounterDesc gcea2_counters_gfx9_placeholder4[] = {
-        {0, GPA_HIDE_NAME("GCEA2_000"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 0 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {1, GPA_HIDE_NAME("GCEA2_001"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 1 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {2, GPA_HIDE_NAME("GCEA2_002"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 2 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {3, GPA_HIDE_NAME("GCEA2_003"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 3 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {4, GPA_HIDE_NAME("GCEA2_004"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 4 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {5, GPA_HIDE_NAME("GCEA2_005"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 5 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {6, GPA_HIDE_NAME("GCEA2_006"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 6 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {7, GPA_HIDE_NAME("GCEA2_007"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 7 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {8, GPA_HIDE_NAME("GCEA2_008"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 8 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {9, GPA_HIDE_NAME("GCEA2_009"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 9 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {10, GPA_HIDE_NAME("GCEA2_010"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 10 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {11, GPA_HIDE_NAME("GCEA2_011"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 11 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {12, GPA_HIDE_NAME("GCEA2_012"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 12 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {13, GPA_HIDE_NAME("GCEA2_013"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 13 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {14, GPA_HIDE_NAME("GCEA2_014"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 14 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {15, GPA_HIDE_NAME("GCEA2_015"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 15 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {16, GPA_HIDE_NAME("GCEA2_016"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 16 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {17, GPA_HIDE_NAME("GCEA2_017"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 17 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {18, GPA_HIDE_NAME("GCEA2_018"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 18 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {19, GPA_HIDE_NAME("GCEA2_019"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 19 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {20, GPA_HIDE_NAME("GCEA2_020"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 20 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {21, GPA_HIDE_NAME("GCEA2_021"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 21 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {22, GPA_HIDE_NAME("GCEA2_022"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 22 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {23, GPA_HIDE_NAME("GCEA2_023"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 23 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {24, GPA_HIDE_NAME("GCEA2_024"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 24 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {25, GPA_HIDE_NAME("GCEA2_025"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 25 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {26, GPA_HIDE_NAME("GCEA2_026"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 26 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {27, GPA_HIDE_NAME("GCEA2_027"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 27 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {28, GPA_HIDE_NAME("GCEA2_028"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 28 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {29, GPA_HIDE_NAME("GCEA2_029"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 29 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {30, GPA_HIDE_NAME("GCEA2_030"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 30 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {31, GPA_HIDE_NAME("GCEA2_031"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 31 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {32, GPA_HIDE_NAME("GCEA2_032"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 32 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {33, GPA_HIDE_NAME("GCEA2_033"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 33 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {34, GPA_HIDE_NAME("GCEA2_034"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 34 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {35, GPA_HIDE_NAME("GCEA2_035"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 35 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {36, GPA_HIDE_NAME("GCEA2_036"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 36 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {37, GPA_HIDE_NAME("GCEA2_037"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 37 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {38, GPA_HIDE_NAME("GCEA2_038"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 38 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {39, GPA_HIDE_NAME("GCEA2_039"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 39 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {40, GPA_HIDE_NAME("GCEA2_040"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 40 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {41, GPA_HIDE_NAME("GCEA2_041"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 41 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {42, GPA_HIDE_NAME("GCEA2_042"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 42 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {43, GPA_HIDE_NAME("GCEA2_043"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 43 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {44, GPA_HIDE_NAME("GCEA2_044"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 44 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {45, GPA_HIDE_NAME("GCEA2_045"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 45 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {46, GPA_HIDE_NAME("GCEA2_046"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 46 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {47, GPA_HIDE_NAME("GCEA2_047"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 47 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {48, GPA_HIDE_NAME("GCEA2_048"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 48 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {49, GPA_HIDE_NAME("GCEA2_049"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 49 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {50, GPA_HIDE_NAME("GCEA2_050"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 50 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {51, GPA_HIDE_NAME("GCEA2_051"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 51 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {52, GPA_HIDE_NAME("GCEA2_052"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 52 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {53, GPA_HIDE_NAME("GCEA2_053"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 53 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {54, GPA_HIDE_NAME("GCEA2_054"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 54 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {55, GPA_HIDE_NAME("GCEA2_PERF_SEL_SARB_DRAM_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("DRAM sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {56, GPA_HIDE_NAME("GCEA2_056"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 56 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {57, GPA_HIDE_NAME("GCEA2_PERF_SEL_SARB_IO_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("I/O sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {58, GPA_HIDE_NAME("GCEA2_058"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 58 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {59, GPA_HIDE_NAME("GCEA2_059"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 59 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {60, GPA_HIDE_NAME("GCEA2_060"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 60 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {61, GPA_HIDE_NAME("GCEA2_061"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 61 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {62, GPA_HIDE_NAME("GCEA2_062"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 62 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {63, GPA_HIDE_NAME("GCEA2_063"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 63 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {64, GPA_HIDE_NAME("GCEA2_064"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 64 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {65, GPA_HIDE_NAME("GCEA2_065"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 65 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {66, GPA_HIDE_NAME("GCEA2_066"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 66 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {67, GPA_HIDE_NAME("GCEA2_067"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 67 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {68, GPA_HIDE_NAME("GCEA2_068"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 68 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {69, GPA_HIDE_NAME("GCEA2_069"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 69 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {70, GPA_HIDE_NAME("GCEA2_070"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 70 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {71, GPA_HIDE_NAME("GCEA2_071"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 71 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {72, GPA_HIDE_NAME("GCEA2_072"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 72 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {73, GPA_HIDE_NAME("GCEA2_073"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 73 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {74, GPA_HIDE_NAME("GCEA2_074"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 74 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {75, GPA_HIDE_NAME("GCEA2_075"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 75 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {76, GPA_HIDE_NAME("GCEA2_076"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 76 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {77, GPA_HIDE_NAME("GCEA2_077"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 77 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {78, GPA_HIDE_NAME("GCEA2_078"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 78 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {79, GPA_HIDE_NAME("GCEA2_079"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 79 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {80, GPA_HIDE_NAME("GCEA2_080"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 80 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {81, GPA_HIDE_NAME("GCEA2_081"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 81 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {82, GPA_HIDE_NAME("GCEA2_082"), GPA_HIDE_NAME("GCEA2"), GPA_HIDE_NAME("Counter 82 from group GCEA2"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-    };
-    GPA_HardwareCounterDesc gcea3_counters_gfx9_placeholder4[] = {
-        {0, GPA_HIDE_NAME("GCEA3_000"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 0 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {1, GPA_HIDE_NAME("GCEA3_001"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 1 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {2, GPA_HIDE_NAME("GCEA3_002"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 2 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {3, GPA_HIDE_NAME("GCEA3_003"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 3 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {4, GPA_HIDE_NAME("GCEA3_004"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 4 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {5, GPA_HIDE_NAME("GCEA3_005"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 5 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {6, GPA_HIDE_NAME("GCEA3_006"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 6 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {7, GPA_HIDE_NAME("GCEA3_007"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 7 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {8, GPA_HIDE_NAME("GCEA3_008"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 8 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {9, GPA_HIDE_NAME("GCEA3_009"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 9 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {10, GPA_HIDE_NAME("GCEA3_010"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 10 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {11, GPA_HIDE_NAME("GCEA3_011"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 11 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {12, GPA_HIDE_NAME("GCEA3_012"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 12 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {13, GPA_HIDE_NAME("GCEA3_013"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 13 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {14, GPA_HIDE_NAME("GCEA3_014"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 14 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {15, GPA_HIDE_NAME("GCEA3_015"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 15 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {16, GPA_HIDE_NAME("GCEA3_016"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 16 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {17, GPA_HIDE_NAME("GCEA3_017"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 17 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {18, GPA_HIDE_NAME("GCEA3_018"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 18 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {19, GPA_HIDE_NAME("GCEA3_019"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 19 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {20, GPA_HIDE_NAME("GCEA3_020"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 20 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {21, GPA_HIDE_NAME("GCEA3_021"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 21 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {22, GPA_HIDE_NAME("GCEA3_022"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 22 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {23, GPA_HIDE_NAME("GCEA3_023"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 23 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {24, GPA_HIDE_NAME("GCEA3_024"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 24 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {25, GPA_HIDE_NAME("GCEA3_025"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 25 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {26, GPA_HIDE_NAME("GCEA3_026"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 26 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {27, GPA_HIDE_NAME("GCEA3_027"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 27 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {28, GPA_HIDE_NAME("GCEA3_028"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 28 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {29, GPA_HIDE_NAME("GCEA3_029"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 29 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {30, GPA_HIDE_NAME("GCEA3_030"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 30 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {31, GPA_HIDE_NAME("GCEA3_031"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 31 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {32, GPA_HIDE_NAME("GCEA3_032"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 32 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {33, GPA_HIDE_NAME("GCEA3_033"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 33 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {34, GPA_HIDE_NAME("GCEA3_034"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 34 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {35, GPA_HIDE_NAME("GCEA3_035"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 35 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {36, GPA_HIDE_NAME("GCEA3_036"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 36 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {37, GPA_HIDE_NAME("GCEA3_037"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 37 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {38, GPA_HIDE_NAME("GCEA3_038"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 38 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {39, GPA_HIDE_NAME("GCEA3_039"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 39 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {40, GPA_HIDE_NAME("GCEA3_040"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 40 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {41, GPA_HIDE_NAME("GCEA3_041"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 41 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {42, GPA_HIDE_NAME("GCEA3_042"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 42 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {43, GPA_HIDE_NAME("GCEA3_043"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 43 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {44, GPA_HIDE_NAME("GCEA3_044"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 44 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {45, GPA_HIDE_NAME("GCEA3_045"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 45 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {46, GPA_HIDE_NAME("GCEA3_046"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 46 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {47, GPA_HIDE_NAME("GCEA3_047"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 47 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {48, GPA_HIDE_NAME("GCEA3_048"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 48 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {49, GPA_HIDE_NAME("GCEA3_049"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 49 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {50, GPA_HIDE_NAME("GCEA3_050"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 50 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {51, GPA_HIDE_NAME("GCEA3_051"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 51 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {52, GPA_HIDE_NAME("GCEA3_052"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 52 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {53, GPA_HIDE_NAME("GCEA3_053"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 53 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {54, GPA_HIDE_NAME("GCEA3_054"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 54 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {55, GPA_HIDE_NAME("GCEA3_PERF_SEL_SARB_DRAM_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("DRAM sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {56, GPA_HIDE_NAME("GCEA3_056"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 56 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {57, GPA_HIDE_NAME("GCEA3_PERF_SEL_SARB_IO_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("I/O sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {58, GPA_HIDE_NAME("GCEA3_058"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 58 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {59, GPA_HIDE_NAME("GCEA3_059"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 59 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {60, GPA_HIDE_NAME("GCEA3_060"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 60 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {61, GPA_HIDE_NAME("GCEA3_061"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 61 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {62, GPA_HIDE_NAME("GCEA3_062"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 62 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {63, GPA_HIDE_NAME("GCEA3_063"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 63 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {64, GPA_HIDE_NAME("GCEA3_064"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 64 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {65, GPA_HIDE_NAME("GCEA3_065"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 65 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {66, GPA_HIDE_NAME("GCEA3_066"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 66 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {67, GPA_HIDE_NAME("GCEA3_067"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 67 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {68, GPA_HIDE_NAME("GCEA3_068"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 68 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {69, GPA_HIDE_NAME("GCEA3_069"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 69 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {70, GPA_HIDE_NAME("GCEA3_070"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 70 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {71, GPA_HIDE_NAME("GCEA3_071"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 71 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {72, GPA_HIDE_NAME("GCEA3_072"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 72 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {73, GPA_HIDE_NAME("GCEA3_073"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 73 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {74, GPA_HIDE_NAME("GCEA3_074"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 74 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {75, GPA_HIDE_NAME("GCEA3_075"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 75 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {76, GPA_HIDE_NAME("GCEA3_076"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 76 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {77, GPA_HIDE_NAME("GCEA3_077"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 77 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {78, GPA_HIDE_NAME("GCEA3_078"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 78 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {79, GPA_HIDE_NAME("GCEA3_079"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 79 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {80, GPA_HIDE_NAME("GCEA3_080"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 80 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {81, GPA_HIDE_NAME("GCEA3_081"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 81 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {82, GPA_HIDE_NAME("GCEA3_082"), GPA_HIDE_NAME("GCEA3"), GPA_HIDE_NAME("Counter 82 from group GCEA3"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-    };
-    GPA_HardwareCounterDesc gcea4_counters_gfx9_placeholder4[] = {
-        {0, GPA_HIDE_NAME("GCEA4_000"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 0 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {1, GPA_HIDE_NAME("GCEA4_001"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 1 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {2, GPA_HIDE_NAME("GCEA4_002"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 2 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {3, GPA_HIDE_NAME("GCEA4_003"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 3 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {4, GPA_HIDE_NAME("GCEA4_004"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 4 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {5, GPA_HIDE_NAME("GCEA4_005"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 5 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {6, GPA_HIDE_NAME("GCEA4_006"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 6 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {7, GPA_HIDE_NAME("GCEA4_007"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 7 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {8, GPA_HIDE_NAME("GCEA4_008"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 8 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {9, GPA_HIDE_NAME("GCEA4_009"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 9 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {10, GPA_HIDE_NAME("GCEA4_010"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 10 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {11, GPA_HIDE_NAME("GCEA4_011"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 11 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {12, GPA_HIDE_NAME("GCEA4_012"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 12 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {13, GPA_HIDE_NAME("GCEA4_013"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 13 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {14, GPA_HIDE_NAME("GCEA4_014"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 14 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {15, GPA_HIDE_NAME("GCEA4_015"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 15 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {16, GPA_HIDE_NAME("GCEA4_016"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 16 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {17, GPA_HIDE_NAME("GCEA4_017"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 17 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {18, GPA_HIDE_NAME("GCEA4_018"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 18 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {19, GPA_HIDE_NAME("GCEA4_019"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 19 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {20, GPA_HIDE_NAME("GCEA4_020"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 20 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {21, GPA_HIDE_NAME("GCEA4_021"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 21 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {22, GPA_HIDE_NAME("GCEA4_022"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 22 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {23, GPA_HIDE_NAME("GCEA4_023"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 23 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {24, GPA_HIDE_NAME("GCEA4_024"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 24 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {25, GPA_HIDE_NAME("GCEA4_025"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 25 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {26, GPA_HIDE_NAME("GCEA4_026"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 26 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {27, GPA_HIDE_NAME("GCEA4_027"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 27 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {28, GPA_HIDE_NAME("GCEA4_028"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 28 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {29, GPA_HIDE_NAME("GCEA4_029"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 29 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {30, GPA_HIDE_NAME("GCEA4_030"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 30 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {31, GPA_HIDE_NAME("GCEA4_031"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 31 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {32, GPA_HIDE_NAME("GCEA4_032"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 32 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {33, GPA_HIDE_NAME("GCEA4_033"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 33 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {34, GPA_HIDE_NAME("GCEA4_034"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 34 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {35, GPA_HIDE_NAME("GCEA4_035"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 35 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {36, GPA_HIDE_NAME("GCEA4_036"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 36 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {37, GPA_HIDE_NAME("GCEA4_037"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 37 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {38, GPA_HIDE_NAME("GCEA4_038"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 38 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {39, GPA_HIDE_NAME("GCEA4_039"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 39 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {40, GPA_HIDE_NAME("GCEA4_040"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 40 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {41, GPA_HIDE_NAME("GCEA4_041"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 41 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {42, GPA_HIDE_NAME("GCEA4_042"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 42 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {43, GPA_HIDE_NAME("GCEA4_043"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 43 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {44, GPA_HIDE_NAME("GCEA4_044"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 44 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {45, GPA_HIDE_NAME("GCEA4_045"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 45 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {46, GPA_HIDE_NAME("GCEA4_046"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 46 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {47, GPA_HIDE_NAME("GCEA4_047"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 47 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {48, GPA_HIDE_NAME("GCEA4_048"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 48 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {49, GPA_HIDE_NAME("GCEA4_049"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 49 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {50, GPA_HIDE_NAME("GCEA4_050"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 50 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {51, GPA_HIDE_NAME("GCEA4_051"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 51 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {52, GPA_HIDE_NAME("GCEA4_052"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 52 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {53, GPA_HIDE_NAME("GCEA4_053"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 53 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {54, GPA_HIDE_NAME("GCEA4_054"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 54 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {55, GPA_HIDE_NAME("GCEA4_PERF_SEL_SARB_DRAM_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("DRAM sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {56, GPA_HIDE_NAME("GCEA4_056"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 56 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {57, GPA_HIDE_NAME("GCEA4_PERF_SEL_SARB_IO_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("I/O sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {58, GPA_HIDE_NAME("GCEA4_058"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 58 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {59, GPA_HIDE_NAME("GCEA4_059"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 59 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {60, GPA_HIDE_NAME("GCEA4_060"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 60 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {61, GPA_HIDE_NAME("GCEA4_061"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 61 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {62, GPA_HIDE_NAME("GCEA4_062"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 62 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {63, GPA_HIDE_NAME("GCEA4_063"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 63 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {64, GPA_HIDE_NAME("GCEA4_064"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 64 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {65, GPA_HIDE_NAME("GCEA4_065"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 65 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {66, GPA_HIDE_NAME("GCEA4_066"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 66 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {67, GPA_HIDE_NAME("GCEA4_067"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 67 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {68, GPA_HIDE_NAME("GCEA4_068"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 68 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {69, GPA_HIDE_NAME("GCEA4_069"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 69 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {70, GPA_HIDE_NAME("GCEA4_070"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 70 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {71, GPA_HIDE_NAME("GCEA4_071"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 71 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {72, GPA_HIDE_NAME("GCEA4_072"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 72 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {73, GPA_HIDE_NAME("GCEA4_073"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 73 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {74, GPA_HIDE_NAME("GCEA4_074"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 74 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {75, GPA_HIDE_NAME("GCEA4_075"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 75 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {76, GPA_HIDE_NAME("GCEA4_076"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 76 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {77, GPA_HIDE_NAME("GCEA4_077"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 77 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {78, GPA_HIDE_NAME("GCEA4_078"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 78 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {79, GPA_HIDE_NAME("GCEA4_079"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 79 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {80, GPA_HIDE_NAME("GCEA4_080"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 80 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {81, GPA_HIDE_NAME("GCEA4_081"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 81 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {82, GPA_HIDE_NAME("GCEA4_082"), GPA_HIDE_NAME("GCEA4"), GPA_HIDE_NAME("Counter 82 from group GCEA4"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-    };
-    GPA_HardwareCounterDesc gcea5_counters_gfx9_placeholder4[] = {
-        {0, GPA_HIDE_NAME("GCEA5_000"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 0 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {1, GPA_HIDE_NAME("GCEA5_001"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 1 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {2, GPA_HIDE_NAME("GCEA5_002"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 2 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {3, GPA_HIDE_NAME("GCEA5_003"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 3 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {4, GPA_HIDE_NAME("GCEA5_004"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 4 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {5, GPA_HIDE_NAME("GCEA5_005"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 5 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {6, GPA_HIDE_NAME("GCEA5_006"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 6 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {7, GPA_HIDE_NAME("GCEA5_007"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 7 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {8, GPA_HIDE_NAME("GCEA5_008"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 8 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {9, GPA_HIDE_NAME("GCEA5_009"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 9 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {10, GPA_HIDE_NAME("GCEA5_010"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 10 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {11, GPA_HIDE_NAME("GCEA5_011"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 11 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {12, GPA_HIDE_NAME("GCEA5_012"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 12 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {13, GPA_HIDE_NAME("GCEA5_013"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 13 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {14, GPA_HIDE_NAME("GCEA5_014"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 14 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {15, GPA_HIDE_NAME("GCEA5_015"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 15 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {16, GPA_HIDE_NAME("GCEA5_016"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 16 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {17, GPA_HIDE_NAME("GCEA5_017"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 17 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {18, GPA_HIDE_NAME("GCEA5_018"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 18 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {19, GPA_HIDE_NAME("GCEA5_019"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 19 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {20, GPA_HIDE_NAME("GCEA5_020"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 20 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {21, GPA_HIDE_NAME("GCEA5_021"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 21 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {22, GPA_HIDE_NAME("GCEA5_022"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 22 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {23, GPA_HIDE_NAME("GCEA5_023"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 23 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {24, GPA_HIDE_NAME("GCEA5_024"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 24 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {25, GPA_HIDE_NAME("GCEA5_025"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 25 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {26, GPA_HIDE_NAME("GCEA5_026"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 26 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {27, GPA_HIDE_NAME("GCEA5_027"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 27 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {28, GPA_HIDE_NAME("GCEA5_028"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 28 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {29, GPA_HIDE_NAME("GCEA5_029"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 29 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {30, GPA_HIDE_NAME("GCEA5_030"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 30 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {31, GPA_HIDE_NAME("GCEA5_031"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 31 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {32, GPA_HIDE_NAME("GCEA5_032"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 32 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {33, GPA_HIDE_NAME("GCEA5_033"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 33 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {34, GPA_HIDE_NAME("GCEA5_034"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 34 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {35, GPA_HIDE_NAME("GCEA5_035"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 35 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {36, GPA_HIDE_NAME("GCEA5_036"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 36 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {37, GPA_HIDE_NAME("GCEA5_037"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 37 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {38, GPA_HIDE_NAME("GCEA5_038"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 38 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {39, GPA_HIDE_NAME("GCEA5_039"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 39 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {40, GPA_HIDE_NAME("GCEA5_040"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 40 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {41, GPA_HIDE_NAME("GCEA5_041"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 41 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {42, GPA_HIDE_NAME("GCEA5_042"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 42 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {43, GPA_HIDE_NAME("GCEA5_043"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 43 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {44, GPA_HIDE_NAME("GCEA5_044"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 44 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {45, GPA_HIDE_NAME("GCEA5_045"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 45 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {46, GPA_HIDE_NAME("GCEA5_046"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 46 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {47, GPA_HIDE_NAME("GCEA5_047"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 47 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {48, GPA_HIDE_NAME("GCEA5_048"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 48 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {49, GPA_HIDE_NAME("GCEA5_049"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 49 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {50, GPA_HIDE_NAME("GCEA5_050"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 50 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {51, GPA_HIDE_NAME("GCEA5_051"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 51 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {52, GPA_HIDE_NAME("GCEA5_052"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 52 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {53, GPA_HIDE_NAME("GCEA5_053"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 53 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {54, GPA_HIDE_NAME("GCEA5_054"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 54 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {55, GPA_HIDE_NAME("GCEA5_PERF_SEL_SARB_DRAM_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("DRAM sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {56, GPA_HIDE_NAME("GCEA5_056"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 56 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {57, GPA_HIDE_NAME("GCEA5_PERF_SEL_SARB_IO_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("I/O sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {58, GPA_HIDE_NAME("GCEA5_058"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 58 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {59, GPA_HIDE_NAME("GCEA5_059"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 59 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {60, GPA_HIDE_NAME("GCEA5_060"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 60 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {61, GPA_HIDE_NAME("GCEA5_061"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 61 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {62, GPA_HIDE_NAME("GCEA5_062"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 62 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {63, GPA_HIDE_NAME("GCEA5_063"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 63 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {64, GPA_HIDE_NAME("GCEA5_064"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 64 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {65, GPA_HIDE_NAME("GCEA5_065"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 65 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {66, GPA_HIDE_NAME("GCEA5_066"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 66 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {67, GPA_HIDE_NAME("GCEA5_067"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 67 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {68, GPA_HIDE_NAME("GCEA5_068"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 68 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {69, GPA_HIDE_NAME("GCEA5_069"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 69 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {70, GPA_HIDE_NAME("GCEA5_070"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 70 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {71, GPA_HIDE_NAME("GCEA5_071"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 71 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {72, GPA_HIDE_NAME("GCEA5_072"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 72 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {73, GPA_HIDE_NAME("GCEA5_073"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 73 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {74, GPA_HIDE_NAME("GCEA5_074"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 74 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {75, GPA_HIDE_NAME("GCEA5_075"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 75 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {76, GPA_HIDE_NAME("GCEA5_076"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 76 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {77, GPA_HIDE_NAME("GCEA5_077"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 77 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {78, GPA_HIDE_NAME("GCEA5_078"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 78 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {79, GPA_HIDE_NAME("GCEA5_079"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 79 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {80, GPA_HIDE_NAME("GCEA5_080"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 80 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {81, GPA_HIDE_NAME("GCEA5_081"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 81 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {82, GPA_HIDE_NAME("GCEA5_082"), GPA_HIDE_NAME("GCEA5"), GPA_HIDE_NAME("Counter 82 from group GCEA5"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-    };
-    GPA_HardwareCounterDesc gcea6_counters_gfx9_placeholder4[] = {
-        {0, GPA_HIDE_NAME("GCEA6_000"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 0 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {1, GPA_HIDE_NAME("GCEA6_001"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 1 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {2, GPA_HIDE_NAME("GCEA6_002"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 2 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {3, GPA_HIDE_NAME("GCEA6_003"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 3 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {4, GPA_HIDE_NAME("GCEA6_004"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 4 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {5, GPA_HIDE_NAME("GCEA6_005"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 5 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {6, GPA_HIDE_NAME("GCEA6_006"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 6 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {7, GPA_HIDE_NAME("GCEA6_007"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 7 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {8, GPA_HIDE_NAME("GCEA6_008"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 8 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {9, GPA_HIDE_NAME("GCEA6_009"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 9 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {10, GPA_HIDE_NAME("GCEA6_010"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 10 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {11, GPA_HIDE_NAME("GCEA6_011"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 11 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {12, GPA_HIDE_NAME("GCEA6_012"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 12 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {13, GPA_HIDE_NAME("GCEA6_013"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 13 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {14, GPA_HIDE_NAME("GCEA6_014"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 14 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {15, GPA_HIDE_NAME("GCEA6_015"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 15 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {16, GPA_HIDE_NAME("GCEA6_016"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 16 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {17, GPA_HIDE_NAME("GCEA6_017"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 17 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {18, GPA_HIDE_NAME("GCEA6_018"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 18 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {19, GPA_HIDE_NAME("GCEA6_019"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 19 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {20, GPA_HIDE_NAME("GCEA6_020"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 20 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {21, GPA_HIDE_NAME("GCEA6_021"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 21 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {22, GPA_HIDE_NAME("GCEA6_022"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 22 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {23, GPA_HIDE_NAME("GCEA6_023"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 23 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {24, GPA_HIDE_NAME("GCEA6_024"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 24 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {25, GPA_HIDE_NAME("GCEA6_025"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 25 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {26, GPA_HIDE_NAME("GCEA6_026"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 26 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {27, GPA_HIDE_NAME("GCEA6_027"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 27 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {28, GPA_HIDE_NAME("GCEA6_028"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 28 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {29, GPA_HIDE_NAME("GCEA6_029"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 29 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {30, GPA_HIDE_NAME("GCEA6_030"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 30 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {31, GPA_HIDE_NAME("GCEA6_031"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 31 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {32, GPA_HIDE_NAME("GCEA6_032"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 32 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {33, GPA_HIDE_NAME("GCEA6_033"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 33 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {34, GPA_HIDE_NAME("GCEA6_034"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 34 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {35, GPA_HIDE_NAME("GCEA6_035"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 35 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {36, GPA_HIDE_NAME("GCEA6_036"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 36 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {37, GPA_HIDE_NAME("GCEA6_037"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 37 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {38, GPA_HIDE_NAME("GCEA6_038"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 38 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {39, GPA_HIDE_NAME("GCEA6_039"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 39 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {40, GPA_HIDE_NAME("GCEA6_040"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 40 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {41, GPA_HIDE_NAME("GCEA6_041"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 41 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {42, GPA_HIDE_NAME("GCEA6_042"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 42 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {43, GPA_HIDE_NAME("GCEA6_043"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 43 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {44, GPA_HIDE_NAME("GCEA6_044"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 44 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {45, GPA_HIDE_NAME("GCEA6_045"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 45 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {46, GPA_HIDE_NAME("GCEA6_046"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 46 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {47, GPA_HIDE_NAME("GCEA6_047"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 47 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {48, GPA_HIDE_NAME("GCEA6_048"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 48 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {49, GPA_HIDE_NAME("GCEA6_049"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 49 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {50, GPA_HIDE_NAME("GCEA6_050"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 50 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {51, GPA_HIDE_NAME("GCEA6_051"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 51 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {52, GPA_HIDE_NAME("GCEA6_052"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 52 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {53, GPA_HIDE_NAME("GCEA6_053"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 53 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {54, GPA_HIDE_NAME("GCEA6_054"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 54 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {55, GPA_HIDE_NAME("GCEA6_PERF_SEL_SARB_DRAM_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("DRAM sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {56, GPA_HIDE_NAME("GCEA6_056"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 56 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {57, GPA_HIDE_NAME("GCEA6_PERF_SEL_SARB_IO_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("I/O sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {58, GPA_HIDE_NAME("GCEA6_058"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 58 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {59, GPA_HIDE_NAME("GCEA6_059"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 59 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {60, GPA_HIDE_NAME("GCEA6_060"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 60 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {61, GPA_HIDE_NAME("GCEA6_061"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 61 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {62, GPA_HIDE_NAME("GCEA6_062"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 62 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {63, GPA_HIDE_NAME("GCEA6_063"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 63 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {64, GPA_HIDE_NAME("GCEA6_064"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 64 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {65, GPA_HIDE_NAME("GCEA6_065"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 65 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {66, GPA_HIDE_NAME("GCEA6_066"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 66 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {67, GPA_HIDE_NAME("GCEA6_067"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 67 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {68, GPA_HIDE_NAME("GCEA6_068"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 68 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {69, GPA_HIDE_NAME("GCEA6_069"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 69 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {70, GPA_HIDE_NAME("GCEA6_070"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 70 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {71, GPA_HIDE_NAME("GCEA6_071"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 71 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {72, GPA_HIDE_NAME("GCEA6_072"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 72 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {73, GPA_HIDE_NAME("GCEA6_073"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 73 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {74, GPA_HIDE_NAME("GCEA6_074"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 74 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {75, GPA_HIDE_NAME("GCEA6_075"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 75 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {76, GPA_HIDE_NAME("GCEA6_076"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 76 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {77, GPA_HIDE_NAME("GCEA6_077"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 77 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {78, GPA_HIDE_NAME("GCEA6_078"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 78 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {79, GPA_HIDE_NAME("GCEA6_079"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 79 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {80, GPA_HIDE_NAME("GCEA6_080"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 80 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {81, GPA_HIDE_NAME("GCEA6_081"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 81 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {82, GPA_HIDE_NAME("GCEA6_082"), GPA_HIDE_NAME("GCEA6"), GPA_HIDE_NAME("Counter 82 from group GCEA6"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-    };
-    GPA_HardwareCounterDesc gcea7_counters_gfx9_placeholder4[] = {
-        {0, GPA_HIDE_NAME("GCEA7_000"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 0 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {1, GPA_HIDE_NAME("GCEA7_001"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 1 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {2, GPA_HIDE_NAME("GCEA7_002"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 2 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {3, GPA_HIDE_NAME("GCEA7_003"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 3 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {4, GPA_HIDE_NAME("GCEA7_004"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 4 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {5, GPA_HIDE_NAME("GCEA7_005"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 5 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {6, GPA_HIDE_NAME("GCEA7_006"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 6 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {7, GPA_HIDE_NAME("GCEA7_007"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 7 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {8, GPA_HIDE_NAME("GCEA7_008"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 8 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {9, GPA_HIDE_NAME("GCEA7_009"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 9 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {10, GPA_HIDE_NAME("GCEA7_010"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 10 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {11, GPA_HIDE_NAME("GCEA7_011"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 11 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {12, GPA_HIDE_NAME("GCEA7_012"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 12 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {13, GPA_HIDE_NAME("GCEA7_013"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 13 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {14, GPA_HIDE_NAME("GCEA7_014"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 14 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {15, GPA_HIDE_NAME("GCEA7_015"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 15 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {16, GPA_HIDE_NAME("GCEA7_016"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 16 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {17, GPA_HIDE_NAME("GCEA7_017"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 17 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {18, GPA_HIDE_NAME("GCEA7_018"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 18 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {19, GPA_HIDE_NAME("GCEA7_019"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 19 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {20, GPA_HIDE_NAME("GCEA7_020"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 20 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {21, GPA_HIDE_NAME("GCEA7_021"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 21 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {22, GPA_HIDE_NAME("GCEA7_022"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 22 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {23, GPA_HIDE_NAME("GCEA7_023"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 23 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {24, GPA_HIDE_NAME("GCEA7_024"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 24 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {25, GPA_HIDE_NAME("GCEA7_025"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 25 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {26, GPA_HIDE_NAME("GCEA7_026"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 26 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {27, GPA_HIDE_NAME("GCEA7_027"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 27 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {28, GPA_HIDE_NAME("GCEA7_028"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 28 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {29, GPA_HIDE_NAME("GCEA7_029"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 29 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {30, GPA_HIDE_NAME("GCEA7_030"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 30 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {31, GPA_HIDE_NAME("GCEA7_031"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 31 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {32, GPA_HIDE_NAME("GCEA7_032"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 32 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {33, GPA_HIDE_NAME("GCEA7_033"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 33 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {34, GPA_HIDE_NAME("GCEA7_034"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 34 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {35, GPA_HIDE_NAME("GCEA7_035"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 35 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {36, GPA_HIDE_NAME("GCEA7_036"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 36 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {37, GPA_HIDE_NAME("GCEA7_037"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 37 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {38, GPA_HIDE_NAME("GCEA7_038"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 38 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {39, GPA_HIDE_NAME("GCEA7_039"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 39 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {40, GPA_HIDE_NAME("GCEA7_040"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 40 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {41, GPA_HIDE_NAME("GCEA7_041"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 41 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {42, GPA_HIDE_NAME("GCEA7_042"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 42 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {43, GPA_HIDE_NAME("GCEA7_043"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 43 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {44, GPA_HIDE_NAME("GCEA7_044"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 44 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {45, GPA_HIDE_NAME("GCEA7_045"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 45 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {46, GPA_HIDE_NAME("GCEA7_046"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 46 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {47, GPA_HIDE_NAME("GCEA7_047"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 47 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {48, GPA_HIDE_NAME("GCEA7_048"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 48 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {49, GPA_HIDE_NAME("GCEA7_049"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 49 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {50, GPA_HIDE_NAME("GCEA7_050"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 50 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {51, GPA_HIDE_NAME("GCEA7_051"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 51 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {52, GPA_HIDE_NAME("GCEA7_052"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 52 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {53, GPA_HIDE_NAME("GCEA7_053"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 53 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {54, GPA_HIDE_NAME("GCEA7_054"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 54 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {55, GPA_HIDE_NAME("GCEA7_PERF_SEL_SARB_DRAM_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("DRAM sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {56, GPA_HIDE_NAME("GCEA7_056"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 56 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {57, GPA_HIDE_NAME("GCEA7_PERF_SEL_SARB_IO_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("I/O sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {58, GPA_HIDE_NAME("GCEA7_058"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 58 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {59, GPA_HIDE_NAME("GCEA7_059"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 59 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {60, GPA_HIDE_NAME("GCEA7_060"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 60 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {61, GPA_HIDE_NAME("GCEA7_061"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 61 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {62, GPA_HIDE_NAME("GCEA7_062"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 62 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {63, GPA_HIDE_NAME("GCEA7_063"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 63 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {64, GPA_HIDE_NAME("GCEA7_064"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 64 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {65, GPA_HIDE_NAME("GCEA7_065"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 65 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {66, GPA_HIDE_NAME("GCEA7_066"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 66 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {67, GPA_HIDE_NAME("GCEA7_067"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 67 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {68, GPA_HIDE_NAME("GCEA7_068"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 68 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {69, GPA_HIDE_NAME("GCEA7_069"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 69 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {70, GPA_HIDE_NAME("GCEA7_070"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 70 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {71, GPA_HIDE_NAME("GCEA7_071"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 71 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {72, GPA_HIDE_NAME("GCEA7_072"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 72 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {73, GPA_HIDE_NAME("GCEA7_073"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 73 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {74, GPA_HIDE_NAME("GCEA7_074"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 74 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {75, GPA_HIDE_NAME("GCEA7_075"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 75 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {76, GPA_HIDE_NAME("GCEA7_076"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 76 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {77, GPA_HIDE_NAME("GCEA7_077"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 77 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {78, GPA_HIDE_NAME("GCEA7_078"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 78 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {79, GPA_HIDE_NAME("GCEA7_079"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 79 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {80, GPA_HIDE_NAME("GCEA7_080"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 80 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {81, GPA_HIDE_NAME("GCEA7_081"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 81 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {82, GPA_HIDE_NAME("GCEA7_082"), GPA_HIDE_NAME("GCEA7"), GPA_HIDE_NAME("Counter 82 from group GCEA7"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-    };
-    GPA_HardwareCounterDesc gcea8_counters_gfx9_placeholder4[] = {
-        {0, GPA_HIDE_NAME("GCEA8_000"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 0 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {1, GPA_HIDE_NAME("GCEA8_001"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 1 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {2, GPA_HIDE_NAME("GCEA8_002"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 2 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {3, GPA_HIDE_NAME("GCEA8_003"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 3 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {4, GPA_HIDE_NAME("GCEA8_004"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 4 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {5, GPA_HIDE_NAME("GCEA8_005"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 5 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {6, GPA_HIDE_NAME("GCEA8_006"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 6 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {7, GPA_HIDE_NAME("GCEA8_007"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 7 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {8, GPA_HIDE_NAME("GCEA8_008"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 8 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {9, GPA_HIDE_NAME("GCEA8_009"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 9 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {10, GPA_HIDE_NAME("GCEA8_010"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 10 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {11, GPA_HIDE_NAME("GCEA8_011"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 11 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {12, GPA_HIDE_NAME("GCEA8_012"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 12 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {13, GPA_HIDE_NAME("GCEA8_013"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 13 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {14, GPA_HIDE_NAME("GCEA8_014"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 14 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {15, GPA_HIDE_NAME("GCEA8_015"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 15 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {16, GPA_HIDE_NAME("GCEA8_016"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 16 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {17, GPA_HIDE_NAME("GCEA8_017"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 17 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {18, GPA_HIDE_NAME("GCEA8_018"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 18 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {19, GPA_HIDE_NAME("GCEA8_019"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 19 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {20, GPA_HIDE_NAME("GCEA8_020"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 20 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {21, GPA_HIDE_NAME("GCEA8_021"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 21 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {22, GPA_HIDE_NAME("GCEA8_022"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 22 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {23, GPA_HIDE_NAME("GCEA8_023"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 23 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {24, GPA_HIDE_NAME("GCEA8_024"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 24 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {25, GPA_HIDE_NAME("GCEA8_025"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 25 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {26, GPA_HIDE_NAME("GCEA8_026"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 26 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {27, GPA_HIDE_NAME("GCEA8_027"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 27 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {28, GPA_HIDE_NAME("GCEA8_028"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 28 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {29, GPA_HIDE_NAME("GCEA8_029"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 29 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {30, GPA_HIDE_NAME("GCEA8_030"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 30 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {31, GPA_HIDE_NAME("GCEA8_031"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 31 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {32, GPA_HIDE_NAME("GCEA8_032"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 32 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {33, GPA_HIDE_NAME("GCEA8_033"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 33 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {34, GPA_HIDE_NAME("GCEA8_034"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 34 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {35, GPA_HIDE_NAME("GCEA8_035"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 35 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {36, GPA_HIDE_NAME("GCEA8_036"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 36 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {37, GPA_HIDE_NAME("GCEA8_037"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 37 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {38, GPA_HIDE_NAME("GCEA8_038"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 38 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {39, GPA_HIDE_NAME("GCEA8_039"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 39 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {40, GPA_HIDE_NAME("GCEA8_040"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 40 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {41, GPA_HIDE_NAME("GCEA8_041"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 41 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {42, GPA_HIDE_NAME("GCEA8_042"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 42 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {43, GPA_HIDE_NAME("GCEA8_043"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 43 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {44, GPA_HIDE_NAME("GCEA8_044"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 44 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {45, GPA_HIDE_NAME("GCEA8_045"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 45 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {46, GPA_HIDE_NAME("GCEA8_046"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 46 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {47, GPA_HIDE_NAME("GCEA8_047"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 47 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {48, GPA_HIDE_NAME("GCEA8_048"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 48 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {49, GPA_HIDE_NAME("GCEA8_049"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 49 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {50, GPA_HIDE_NAME("GCEA8_050"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 50 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {51, GPA_HIDE_NAME("GCEA8_051"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 51 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {52, GPA_HIDE_NAME("GCEA8_052"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 52 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {53, GPA_HIDE_NAME("GCEA8_053"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 53 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {54, GPA_HIDE_NAME("GCEA8_054"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 54 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {55, GPA_HIDE_NAME("GCEA8_PERF_SEL_SARB_DRAM_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("DRAM sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {56, GPA_HIDE_NAME("GCEA8_056"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 56 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {57, GPA_HIDE_NAME("GCEA8_PERF_SEL_SARB_IO_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("I/O sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {58, GPA_HIDE_NAME("GCEA8_058"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 58 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {59, GPA_HIDE_NAME("GCEA8_059"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 59 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {60, GPA_HIDE_NAME("GCEA8_060"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 60 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {61, GPA_HIDE_NAME("GCEA8_061"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 61 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {62, GPA_HIDE_NAME("GCEA8_062"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 62 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {63, GPA_HIDE_NAME("GCEA8_063"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 63 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {64, GPA_HIDE_NAME("GCEA8_064"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 64 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {65, GPA_HIDE_NAME("GCEA8_065"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 65 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {66, GPA_HIDE_NAME("GCEA8_066"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 66 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {67, GPA_HIDE_NAME("GCEA8_067"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 67 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {68, GPA_HIDE_NAME("GCEA8_068"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 68 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {69, GPA_HIDE_NAME("GCEA8_069"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 69 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {70, GPA_HIDE_NAME("GCEA8_070"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 70 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {71, GPA_HIDE_NAME("GCEA8_071"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 71 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {72, GPA_HIDE_NAME("GCEA8_072"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 72 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {73, GPA_HIDE_NAME("GCEA8_073"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 73 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {74, GPA_HIDE_NAME("GCEA8_074"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 74 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {75, GPA_HIDE_NAME("GCEA8_075"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 75 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {76, GPA_HIDE_NAME("GCEA8_076"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 76 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {77, GPA_HIDE_NAME("GCEA8_077"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 77 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {78, GPA_HIDE_NAME("GCEA8_078"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 78 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {79, GPA_HIDE_NAME("GCEA8_079"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 79 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {80, GPA_HIDE_NAME("GCEA8_080"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 80 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {81, GPA_HIDE_NAME("GCEA8_081"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 81 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {82, GPA_HIDE_NAME("GCEA8_082"), GPA_HIDE_NAME("GCEA8"), GPA_HIDE_NAME("Counter 82 from group GCEA8"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-    };
-    GPA_HardwareCounterDesc gcea9_counters_gfx9_placeholder4[] = {
-        {0, GPA_HIDE_NAME("GCEA9_000"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 0 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {1, GPA_HIDE_NAME("GCEA9_001"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 1 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {2, GPA_HIDE_NAME("GCEA9_002"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 2 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {3, GPA_HIDE_NAME("GCEA9_003"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 3 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {4, GPA_HIDE_NAME("GCEA9_004"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 4 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {5, GPA_HIDE_NAME("GCEA9_005"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 5 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {6, GPA_HIDE_NAME("GCEA9_006"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 6 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {7, GPA_HIDE_NAME("GCEA9_007"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 7 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {8, GPA_HIDE_NAME("GCEA9_008"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 8 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {9, GPA_HIDE_NAME("GCEA9_009"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 9 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {10, GPA_HIDE_NAME("GCEA9_010"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 10 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {11, GPA_HIDE_NAME("GCEA9_011"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 11 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {12, GPA_HIDE_NAME("GCEA9_012"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 12 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {13, GPA_HIDE_NAME("GCEA9_013"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 13 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {14, GPA_HIDE_NAME("GCEA9_014"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 14 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {15, GPA_HIDE_NAME("GCEA9_015"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 15 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {16, GPA_HIDE_NAME("GCEA9_016"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 16 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {17, GPA_HIDE_NAME("GCEA9_017"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 17 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {18, GPA_HIDE_NAME("GCEA9_018"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 18 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {19, GPA_HIDE_NAME("GCEA9_019"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 19 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {20, GPA_HIDE_NAME("GCEA9_020"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 20 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {21, GPA_HIDE_NAME("GCEA9_021"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 21 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {22, GPA_HIDE_NAME("GCEA9_022"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 22 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {23, GPA_HIDE_NAME("GCEA9_023"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 23 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {24, GPA_HIDE_NAME("GCEA9_024"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 24 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {25, GPA_HIDE_NAME("GCEA9_025"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 25 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {26, GPA_HIDE_NAME("GCEA9_026"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 26 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {27, GPA_HIDE_NAME("GCEA9_027"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 27 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {28, GPA_HIDE_NAME("GCEA9_028"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 28 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {29, GPA_HIDE_NAME("GCEA9_029"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 29 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {30, GPA_HIDE_NAME("GCEA9_030"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 30 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {31, GPA_HIDE_NAME("GCEA9_031"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 31 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {32, GPA_HIDE_NAME("GCEA9_032"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 32 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {33, GPA_HIDE_NAME("GCEA9_033"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 33 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {34, GPA_HIDE_NAME("GCEA9_034"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 34 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {35, GPA_HIDE_NAME("GCEA9_035"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 35 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {36, GPA_HIDE_NAME("GCEA9_036"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 36 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {37, GPA_HIDE_NAME("GCEA9_037"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 37 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {38, GPA_HIDE_NAME("GCEA9_038"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 38 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {39, GPA_HIDE_NAME("GCEA9_039"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 39 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {40, GPA_HIDE_NAME("GCEA9_040"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 40 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {41, GPA_HIDE_NAME("GCEA9_041"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 41 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {42, GPA_HIDE_NAME("GCEA9_042"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 42 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {43, GPA_HIDE_NAME("GCEA9_043"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 43 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {44, GPA_HIDE_NAME("GCEA9_044"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 44 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {45, GPA_HIDE_NAME("GCEA9_045"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 45 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {46, GPA_HIDE_NAME("GCEA9_046"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 46 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {47, GPA_HIDE_NAME("GCEA9_047"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 47 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {48, GPA_HIDE_NAME("GCEA9_048"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 48 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {49, GPA_HIDE_NAME("GCEA9_049"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 49 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {50, GPA_HIDE_NAME("GCEA9_050"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 50 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {51, GPA_HIDE_NAME("GCEA9_051"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 51 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {52, GPA_HIDE_NAME("GCEA9_052"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 52 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {53, GPA_HIDE_NAME("GCEA9_053"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 53 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {54, GPA_HIDE_NAME("GCEA9_054"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 54 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {55, GPA_HIDE_NAME("GCEA9_PERF_SEL_SARB_DRAM_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("DRAM sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {56, GPA_HIDE_NAME("GCEA9_056"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 56 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {57, GPA_HIDE_NAME("GCEA9_PERF_SEL_SARB_IO_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("I/O sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {58, GPA_HIDE_NAME("GCEA9_058"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 58 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {59, GPA_HIDE_NAME("GCEA9_059"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 59 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {60, GPA_HIDE_NAME("GCEA9_060"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 60 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {61, GPA_HIDE_NAME("GCEA9_061"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 61 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {62, GPA_HIDE_NAME("GCEA9_062"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 62 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {63, GPA_HIDE_NAME("GCEA9_063"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 63 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {64, GPA_HIDE_NAME("GCEA9_064"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 64 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {65, GPA_HIDE_NAME("GCEA9_065"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 65 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {66, GPA_HIDE_NAME("GCEA9_066"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 66 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {67, GPA_HIDE_NAME("GCEA9_067"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 67 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {68, GPA_HIDE_NAME("GCEA9_068"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 68 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {69, GPA_HIDE_NAME("GCEA9_069"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 69 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {70, GPA_HIDE_NAME("GCEA9_070"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 70 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {71, GPA_HIDE_NAME("GCEA9_071"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 71 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {72, GPA_HIDE_NAME("GCEA9_072"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 72 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {73, GPA_HIDE_NAME("GCEA9_073"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 73 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {74, GPA_HIDE_NAME("GCEA9_074"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 74 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {75, GPA_HIDE_NAME("GCEA9_075"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 75 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {76, GPA_HIDE_NAME("GCEA9_076"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 76 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {77, GPA_HIDE_NAME("GCEA9_077"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 77 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {78, GPA_HIDE_NAME("GCEA9_078"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 78 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {79, GPA_HIDE_NAME("GCEA9_079"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 79 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {80, GPA_HIDE_NAME("GCEA9_080"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 80 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {81, GPA_HIDE_NAME("GCEA9_081"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 81 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {82, GPA_HIDE_NAME("GCEA9_082"), GPA_HIDE_NAME("GCEA9"), GPA_HIDE_NAME("Counter 82 from group GCEA9"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-    };
-    GPA_HardwareCounterDesc gcea10_counters_gfx9_placeholder4[] = {
-        {0, GPA_HIDE_NAME("GCEA10_000"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 0 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {1, GPA_HIDE_NAME("GCEA10_001"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 1 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {2, GPA_HIDE_NAME("GCEA10_002"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 2 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {3, GPA_HIDE_NAME("GCEA10_003"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 3 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {4, GPA_HIDE_NAME("GCEA10_004"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 4 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {5, GPA_HIDE_NAME("GCEA10_005"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 5 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {6, GPA_HIDE_NAME("GCEA10_006"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 6 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {7, GPA_HIDE_NAME("GCEA10_007"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 7 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {8, GPA_HIDE_NAME("GCEA10_008"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 8 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {9, GPA_HIDE_NAME("GCEA10_009"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 9 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {10, GPA_HIDE_NAME("GCEA10_010"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 10 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {11, GPA_HIDE_NAME("GCEA10_011"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 11 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {12, GPA_HIDE_NAME("GCEA10_012"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 12 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {13, GPA_HIDE_NAME("GCEA10_013"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 13 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {14, GPA_HIDE_NAME("GCEA10_014"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 14 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {15, GPA_HIDE_NAME("GCEA10_015"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 15 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {16, GPA_HIDE_NAME("GCEA10_016"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 16 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {17, GPA_HIDE_NAME("GCEA10_017"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 17 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {18, GPA_HIDE_NAME("GCEA10_018"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 18 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {19, GPA_HIDE_NAME("GCEA10_019"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 19 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {20, GPA_HIDE_NAME("GCEA10_020"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 20 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {21, GPA_HIDE_NAME("GCEA10_021"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 21 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {22, GPA_HIDE_NAME("GCEA10_022"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 22 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {23, GPA_HIDE_NAME("GCEA10_023"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 23 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {24, GPA_HIDE_NAME("GCEA10_024"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 24 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {25, GPA_HIDE_NAME("GCEA10_025"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 25 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {26, GPA_HIDE_NAME("GCEA10_026"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 26 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {27, GPA_HIDE_NAME("GCEA10_027"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 27 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {28, GPA_HIDE_NAME("GCEA10_028"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 28 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {29, GPA_HIDE_NAME("GCEA10_029"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 29 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {30, GPA_HIDE_NAME("GCEA10_030"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 30 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {31, GPA_HIDE_NAME("GCEA10_031"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 31 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {32, GPA_HIDE_NAME("GCEA10_032"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 32 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {33, GPA_HIDE_NAME("GCEA10_033"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 33 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {34, GPA_HIDE_NAME("GCEA10_034"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 34 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {35, GPA_HIDE_NAME("GCEA10_035"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 35 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {36, GPA_HIDE_NAME("GCEA10_036"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 36 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {37, GPA_HIDE_NAME("GCEA10_037"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 37 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {38, GPA_HIDE_NAME("GCEA10_038"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 38 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {39, GPA_HIDE_NAME("GCEA10_039"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 39 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {40, GPA_HIDE_NAME("GCEA10_040"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 40 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {41, GPA_HIDE_NAME("GCEA10_041"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 41 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {42, GPA_HIDE_NAME("GCEA10_042"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 42 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {43, GPA_HIDE_NAME("GCEA10_043"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 43 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {44, GPA_HIDE_NAME("GCEA10_044"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 44 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {45, GPA_HIDE_NAME("GCEA10_045"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 45 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {46, GPA_HIDE_NAME("GCEA10_046"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 46 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {47, GPA_HIDE_NAME("GCEA10_047"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 47 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {48, GPA_HIDE_NAME("GCEA10_048"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 48 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {49, GPA_HIDE_NAME("GCEA10_049"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 49 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {50, GPA_HIDE_NAME("GCEA10_050"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 50 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {51, GPA_HIDE_NAME("GCEA10_051"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 51 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {52, GPA_HIDE_NAME("GCEA10_052"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 52 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {53, GPA_HIDE_NAME("GCEA10_053"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 53 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {54, GPA_HIDE_NAME("GCEA10_054"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 54 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {55, GPA_HIDE_NAME("GCEA10_PERF_SEL_SARB_DRAM_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("DRAM sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {56, GPA_HIDE_NAME("GCEA10_056"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 56 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {57, GPA_HIDE_NAME("GCEA10_PERF_SEL_SARB_IO_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("I/O sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {58, GPA_HIDE_NAME("GCEA10_058"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 58 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {59, GPA_HIDE_NAME("GCEA10_059"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 59 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {60, GPA_HIDE_NAME("GCEA10_060"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 60 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {61, GPA_HIDE_NAME("GCEA10_061"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 61 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {62, GPA_HIDE_NAME("GCEA10_062"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 62 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {63, GPA_HIDE_NAME("GCEA10_063"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 63 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {64, GPA_HIDE_NAME("GCEA10_064"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 64 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {65, GPA_HIDE_NAME("GCEA10_065"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 65 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {66, GPA_HIDE_NAME("GCEA10_066"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 66 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {67, GPA_HIDE_NAME("GCEA10_067"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 67 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {68, GPA_HIDE_NAME("GCEA10_068"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 68 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {69, GPA_HIDE_NAME("GCEA10_069"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 69 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {70, GPA_HIDE_NAME("GCEA10_070"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 70 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {71, GPA_HIDE_NAME("GCEA10_071"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 71 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {72, GPA_HIDE_NAME("GCEA10_072"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 72 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {73, GPA_HIDE_NAME("GCEA10_073"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 73 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {74, GPA_HIDE_NAME("GCEA10_074"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 74 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {75, GPA_HIDE_NAME("GCEA10_075"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 75 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {76, GPA_HIDE_NAME("GCEA10_076"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 76 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {77, GPA_HIDE_NAME("GCEA10_077"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 77 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {78, GPA_HIDE_NAME("GCEA10_078"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 78 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {79, GPA_HIDE_NAME("GCEA10_079"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 79 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {80, GPA_HIDE_NAME("GCEA10_080"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 80 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {81, GPA_HIDE_NAME("GCEA10_081"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 81 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {82, GPA_HIDE_NAME("GCEA10_082"), GPA_HIDE_NAME("GCEA10"), GPA_HIDE_NAME("Counter 82 from group GCEA10"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-    };
-    GPA_HardwareCounterDesc gcea11_counters_gfx9_placeholder4[] = {
-        {0, GPA_HIDE_NAME("GCEA11_000"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 0 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {1, GPA_HIDE_NAME("GCEA11_001"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 1 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {2, GPA_HIDE_NAME("GCEA11_002"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 2 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {3, GPA_HIDE_NAME("GCEA11_003"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 3 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {4, GPA_HIDE_NAME("GCEA11_004"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 4 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {5, GPA_HIDE_NAME("GCEA11_005"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 5 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {6, GPA_HIDE_NAME("GCEA11_006"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 6 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {7, GPA_HIDE_NAME("GCEA11_007"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 7 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {8, GPA_HIDE_NAME("GCEA11_008"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 8 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {9, GPA_HIDE_NAME("GCEA11_009"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 9 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {10, GPA_HIDE_NAME("GCEA11_010"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 10 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {11, GPA_HIDE_NAME("GCEA11_011"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 11 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {12, GPA_HIDE_NAME("GCEA11_012"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 12 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {13, GPA_HIDE_NAME("GCEA11_013"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 13 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {14, GPA_HIDE_NAME("GCEA11_014"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 14 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {15, GPA_HIDE_NAME("GCEA11_015"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 15 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {16, GPA_HIDE_NAME("GCEA11_016"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 16 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {17, GPA_HIDE_NAME("GCEA11_017"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 17 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {18, GPA_HIDE_NAME("GCEA11_018"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 18 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {19, GPA_HIDE_NAME("GCEA11_019"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 19 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {20, GPA_HIDE_NAME("GCEA11_020"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 20 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {21, GPA_HIDE_NAME("GCEA11_021"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 21 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {22, GPA_HIDE_NAME("GCEA11_022"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 22 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {23, GPA_HIDE_NAME("GCEA11_023"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 23 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {24, GPA_HIDE_NAME("GCEA11_024"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 24 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {25, GPA_HIDE_NAME("GCEA11_025"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 25 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {26, GPA_HIDE_NAME("GCEA11_026"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 26 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {27, GPA_HIDE_NAME("GCEA11_027"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 27 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {28, GPA_HIDE_NAME("GCEA11_028"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 28 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {29, GPA_HIDE_NAME("GCEA11_029"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 29 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {30, GPA_HIDE_NAME("GCEA11_030"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 30 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {31, GPA_HIDE_NAME("GCEA11_031"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 31 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {32, GPA_HIDE_NAME("GCEA11_032"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 32 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {33, GPA_HIDE_NAME("GCEA11_033"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 33 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {34, GPA_HIDE_NAME("GCEA11_034"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 34 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {35, GPA_HIDE_NAME("GCEA11_035"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 35 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {36, GPA_HIDE_NAME("GCEA11_036"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 36 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {37, GPA_HIDE_NAME("GCEA11_037"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 37 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {38, GPA_HIDE_NAME("GCEA11_038"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 38 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {39, GPA_HIDE_NAME("GCEA11_039"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 39 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {40, GPA_HIDE_NAME("GCEA11_040"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 40 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {41, GPA_HIDE_NAME("GCEA11_041"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 41 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {42, GPA_HIDE_NAME("GCEA11_042"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 42 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {43, GPA_HIDE_NAME("GCEA11_043"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 43 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {44, GPA_HIDE_NAME("GCEA11_044"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 44 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {45, GPA_HIDE_NAME("GCEA11_045"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 45 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {46, GPA_HIDE_NAME("GCEA11_046"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 46 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {47, GPA_HIDE_NAME("GCEA11_047"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 47 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {48, GPA_HIDE_NAME("GCEA11_048"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 48 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {49, GPA_HIDE_NAME("GCEA11_049"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 49 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {50, GPA_HIDE_NAME("GCEA11_050"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 50 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {51, GPA_HIDE_NAME("GCEA11_051"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 51 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {52, GPA_HIDE_NAME("GCEA11_052"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 52 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {53, GPA_HIDE_NAME("GCEA11_053"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 53 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {54, GPA_HIDE_NAME("GCEA11_054"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 54 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {55, GPA_HIDE_NAME("GCEA11_PERF_SEL_SARB_DRAM_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("DRAM sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {56, GPA_HIDE_NAME("GCEA11_056"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 56 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {57, GPA_HIDE_NAME("GCEA11_PERF_SEL_SARB_IO_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("I/O sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {58, GPA_HIDE_NAME("GCEA11_058"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 58 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {59, GPA_HIDE_NAME("GCEA11_059"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 59 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {60, GPA_HIDE_NAME("GCEA11_060"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 60 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {61, GPA_HIDE_NAME("GCEA11_061"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 61 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {62, GPA_HIDE_NAME("GCEA11_062"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 62 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {63, GPA_HIDE_NAME("GCEA11_063"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 63 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {64, GPA_HIDE_NAME("GCEA11_064"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 64 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {65, GPA_HIDE_NAME("GCEA11_065"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 65 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {66, GPA_HIDE_NAME("GCEA11_066"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 66 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {67, GPA_HIDE_NAME("GCEA11_067"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 67 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {68, GPA_HIDE_NAME("GCEA11_068"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 68 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {69, GPA_HIDE_NAME("GCEA11_069"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 69 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {70, GPA_HIDE_NAME("GCEA11_070"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 70 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {71, GPA_HIDE_NAME("GCEA11_071"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 71 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {72, GPA_HIDE_NAME("GCEA11_072"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 72 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {73, GPA_HIDE_NAME("GCEA11_073"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 73 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {74, GPA_HIDE_NAME("GCEA11_074"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 74 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {75, GPA_HIDE_NAME("GCEA11_075"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 75 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {76, GPA_HIDE_NAME("GCEA11_076"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 76 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {77, GPA_HIDE_NAME("GCEA11_077"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 77 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {78, GPA_HIDE_NAME("GCEA11_078"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 78 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {79, GPA_HIDE_NAME("GCEA11_079"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 79 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {80, GPA_HIDE_NAME("GCEA11_080"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 80 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {81, GPA_HIDE_NAME("GCEA11_081"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 81 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {82, GPA_HIDE_NAME("GCEA11_082"), GPA_HIDE_NAME("GCEA11"), GPA_HIDE_NAME("Counter 82 from group GCEA11"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-    };
-    GPA_HardwareCounterDesc gcea12_counters_gfx9_placeholder4[] = {
-        {0, GPA_HIDE_NAME("GCEA12_000"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 0 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {1, GPA_HIDE_NAME("GCEA12_001"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 1 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {2, GPA_HIDE_NAME("GCEA12_002"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 2 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {3, GPA_HIDE_NAME("GCEA12_003"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 3 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {4, GPA_HIDE_NAME("GCEA12_004"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 4 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {5, GPA_HIDE_NAME("GCEA12_005"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 5 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {6, GPA_HIDE_NAME("GCEA12_006"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 6 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {7, GPA_HIDE_NAME("GCEA12_007"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 7 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {8, GPA_HIDE_NAME("GCEA12_008"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 8 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {9, GPA_HIDE_NAME("GCEA12_009"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 9 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {10, GPA_HIDE_NAME("GCEA12_010"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 10 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {11, GPA_HIDE_NAME("GCEA12_011"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 11 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {12, GPA_HIDE_NAME("GCEA12_012"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 12 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {13, GPA_HIDE_NAME("GCEA12_013"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 13 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {14, GPA_HIDE_NAME("GCEA12_014"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 14 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {15, GPA_HIDE_NAME("GCEA12_015"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 15 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {16, GPA_HIDE_NAME("GCEA12_016"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 16 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {17, GPA_HIDE_NAME("GCEA12_017"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 17 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {18, GPA_HIDE_NAME("GCEA12_018"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 18 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {19, GPA_HIDE_NAME("GCEA12_019"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 19 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {20, GPA_HIDE_NAME("GCEA12_020"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 20 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {21, GPA_HIDE_NAME("GCEA12_021"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 21 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {22, GPA_HIDE_NAME("GCEA12_022"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 22 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {23, GPA_HIDE_NAME("GCEA12_023"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 23 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {24, GPA_HIDE_NAME("GCEA12_024"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 24 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {25, GPA_HIDE_NAME("GCEA12_025"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 25 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {26, GPA_HIDE_NAME("GCEA12_026"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 26 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {27, GPA_HIDE_NAME("GCEA12_027"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 27 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {28, GPA_HIDE_NAME("GCEA12_028"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 28 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {29, GPA_HIDE_NAME("GCEA12_029"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 29 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {30, GPA_HIDE_NAME("GCEA12_030"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 30 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {31, GPA_HIDE_NAME("GCEA12_031"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 31 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {32, GPA_HIDE_NAME("GCEA12_032"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 32 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {33, GPA_HIDE_NAME("GCEA12_033"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 33 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {34, GPA_HIDE_NAME("GCEA12_034"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 34 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {35, GPA_HIDE_NAME("GCEA12_035"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 35 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {36, GPA_HIDE_NAME("GCEA12_036"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 36 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {37, GPA_HIDE_NAME("GCEA12_037"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 37 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {38, GPA_HIDE_NAME("GCEA12_038"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 38 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {39, GPA_HIDE_NAME("GCEA12_039"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 39 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {40, GPA_HIDE_NAME("GCEA12_040"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 40 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {41, GPA_HIDE_NAME("GCEA12_041"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 41 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {42, GPA_HIDE_NAME("GCEA12_042"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 42 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {43, GPA_HIDE_NAME("GCEA12_043"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 43 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {44, GPA_HIDE_NAME("GCEA12_044"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 44 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {45, GPA_HIDE_NAME("GCEA12_045"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 45 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {46, GPA_HIDE_NAME("GCEA12_046"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 46 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {47, GPA_HIDE_NAME("GCEA12_047"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 47 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {48, GPA_HIDE_NAME("GCEA12_048"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 48 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {49, GPA_HIDE_NAME("GCEA12_049"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 49 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {50, GPA_HIDE_NAME("GCEA12_050"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 50 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {51, GPA_HIDE_NAME("GCEA12_051"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 51 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {52, GPA_HIDE_NAME("GCEA12_052"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 52 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {53, GPA_HIDE_NAME("GCEA12_053"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 53 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {54, GPA_HIDE_NAME("GCEA12_054"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 54 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {55, GPA_HIDE_NAME("GCEA12_PERF_SEL_SARB_DRAM_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("DRAM sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {56, GPA_HIDE_NAME("GCEA12_056"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 56 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {57, GPA_HIDE_NAME("GCEA12_PERF_SEL_SARB_IO_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("I/O sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {58, GPA_HIDE_NAME("GCEA12_058"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 58 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {59, GPA_HIDE_NAME("GCEA12_059"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 59 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {60, GPA_HIDE_NAME("GCEA12_060"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 60 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {61, GPA_HIDE_NAME("GCEA12_061"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 61 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {62, GPA_HIDE_NAME("GCEA12_062"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 62 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {63, GPA_HIDE_NAME("GCEA12_063"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 63 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {64, GPA_HIDE_NAME("GCEA12_064"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 64 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {65, GPA_HIDE_NAME("GCEA12_065"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 65 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {66, GPA_HIDE_NAME("GCEA12_066"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 66 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {67, GPA_HIDE_NAME("GCEA12_067"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 67 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {68, GPA_HIDE_NAME("GCEA12_068"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 68 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {69, GPA_HIDE_NAME("GCEA12_069"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 69 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {70, GPA_HIDE_NAME("GCEA12_070"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 70 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {71, GPA_HIDE_NAME("GCEA12_071"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 71 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {72, GPA_HIDE_NAME("GCEA12_072"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 72 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {73, GPA_HIDE_NAME("GCEA12_073"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 73 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {74, GPA_HIDE_NAME("GCEA12_074"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 74 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {75, GPA_HIDE_NAME("GCEA12_075"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 75 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {76, GPA_HIDE_NAME("GCEA12_076"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 76 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {77, GPA_HIDE_NAME("GCEA12_077"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 77 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {78, GPA_HIDE_NAME("GCEA12_078"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 78 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {79, GPA_HIDE_NAME("GCEA12_079"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 79 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {80, GPA_HIDE_NAME("GCEA12_080"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 80 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {81, GPA_HIDE_NAME("GCEA12_081"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 81 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {82, GPA_HIDE_NAME("GCEA12_082"), GPA_HIDE_NAME("GCEA12"), GPA_HIDE_NAME("Counter 82 from group GCEA12"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
+    /// String pool of the pa_su block for gfx9_placeholder4 family
+    const char pa_su_strings_gfx9_placeholder4[] = GPA_HIDE_NAME(
+        "\0"
+        "PA_SU#\0"
+        "PA_SU#_000\0"
+        "Counter 0 from group PA_SU#\0"
+        "PA_SU#_001\0"
+        "Counter 1 from group PA_SU#\0"
+        "PA_SU#_002\0"
+        "Counter 2 from group PA_SU#\0"
+        "PA_SU#_003\0"
+        "Counter 3 from group PA_SU#\0"
+        "PA_SU#_004\0"
+        "Counter 4 from group PA_SU#\0"
+        "PA_SU#_005\0"
+        "Counter 5 from group PA_SU#\0"
+        "PA_SU#_006\0"
+        "Counter 6 from group PA_SU#\0"
+        "PA_SU#_007\0"
+        "Counter 7 from group PA_SU#\0"
+        "PA_SU#_PERF_PAPC_PA_INPUT_PRIM\0"
+        "PERF_PAPC_PA_INPUT_PRIM Number of Primitives input to PA; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations\0"
+        "PA_SU#_009\0"
+        "Counter 9 from group PA_SU#\0"
+        "PA_SU#_010\0"
+        "Counter 10 from group PA_SU#\0"
+        "PA_SU#_011\0"
+        "Counter 11 from group PA_SU#\0"
+        "PA_SU#_012\0"
+        "Counter 12 from group PA_SU#\0"
+        "PA_SU#_013\0"
+        "Counter 13 from group PA_SU#\0"
+        "PA_SU#_PERF_PAPC_CLPR_CULL_PRIM\0"
+        "PERF_PAPC_CLPR_CULL_PRIM Number of Prims Culled by Clipper for VV, UCP, VTX_KILL, VTX_NAN; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; combined with _CLPR_VVUCP_CULL_PRIM , _CLPR_VV_CULL_PRIM, _VV_CULL_PRIM ,_UCP_CULL_PRIM, _VTX_KILL_CULL_PRIM, _VTX_NAN_CULL_PRIM\0"
+        "PA_SU#_015\0"
+        "Counter 15 from group PA_SU#\0"
+        "PA_SU#_016\0"
+        "Counter 16 from group PA_SU#\0"
+        "PA_SU#_017\0"
+        "Counter 17 from group PA_SU#\0"
+        "PA_SU#_018\0"
+        "Counter 18 from group PA_SU#\0"
+        "PA_SU#_019\0"
+        "Counter 19 from group PA_SU#\0"
+        "PA_SU#_020\0"
+        "Counter 20 from group PA_SU#\0"
+        "PA_SU#_PERF_PAPC_CLPR_VVUCP_CLIP_PRIM\0"
+        "PERF_PAPC_CLPR_VVUCP_CLIP_PRIM Number of Prims Clipped by Clipper for VV and/or UCP; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations\0"
+        "PA_SU#_022\0"
+        "Counter 22 from group PA_SU#\0"
+        "PA_SU#_023\0"
+        "Counter 23 from group PA_SU#\0"
+        "PA_SU#_024\0"
+        "Counter 24 from group PA_SU#\0"
+        "PA_SU#_025\0"
+        "Counter 25 from group PA_SU#\0"
+        "PA_SU#_026\0"
+        "Counter 26 from group PA_SU#\0"
+        "PA_SU#_027\0"
+        "Counter 27 from group PA_SU#\0"
+        "PA_SU#_028\0"
+        "Counter 28 from group PA_SU#\0"
+        "PA_SU#_029\0"
+        "Counter 29 from group PA_SU#\0"
+        "PA_SU#_030\0"
+        "Counter 30 from group PA_SU#\0"
+        "PA_SU#_031\0"
+        "Counter 31 from group PA_SU#\0"
+        "PA_SU#_032\0"
+        "Counter 32 from group PA_SU#\0"
+        "PA_SU#_033\0"
+        "Counter 33 from group PA_SU#\0"
+        "PA_SU#_034\0"
+        "Counter 34 from group PA_SU#\0"
+        "PA_SU#_035\0"
+        "Counter 35 from group PA_SU#\0"
+        "PA_SU#_036\0"
+        "Counter 36 from group PA_SU#\0"
+        "PA_SU#_037\0"
+        "Counter 37 from group PA_SU#\0"
+        "PA_SU#_038\0"
+        "Counter 38 from group PA_SU#\0"
+        "PA_SU#_039\0"
+        "Counter 39 from group PA_SU#\0"
+        "PA_SU#_040\0"
+        "Counter 40 from group PA_SU#\0"
+        "PA_SU#_041\0"
+        "Counter 41 from group PA_SU#\0"
+        "PA_SU#_042\0"
+        "Counter 42 from group PA_SU#\0"
+        "PA_SU#_043\0"
+        "Counter 43 from group PA_SU#\0"
+        "PA_SU#_044\0"
+        "Counter 44 from group PA_SU#\0"
+        "PA_SU#_045\0"
+        "Counter 45 from group PA_SU#\0"
+        "PA_SU#_046\0"
+        "Counter 46 from group PA_SU#\0"
+        "PA_SU#_047\0"
+        "Counter 47 from group PA_SU#\0"
+        "PA_SU#_048\0"
+        "Counter 48 from group PA_SU#\0"
+        "PA_SU#_049\0"
+        "Counter 49 from group PA_SU#\0"
+        "PA_SU#_050\0"
+        "Counter 50 from group PA_SU#\0"
+        "PA_SU#_051\0"
+        "Counter 51 from group PA_SU#\0"
+        "PA_SU#_052\0"
+        "Counter 52 from group PA_SU#\0"
+        "PA_SU#_053\0"
+        "Counter 53 from group PA_SU#\0"
+        "PA_SU#_PERF_PAPC_SU_ZERO_AREA_CULL_PRIM\0"
+        "PERF_PAPC_SU_ZERO_AREA_CULL_PRIM Number of primitives culled due to zero area; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations\0"
+        "PA_SU#_PERF_PAPC_SU_BACK_FACE_CULL_PRIM\0"
+        "PERF_PAPC_SU_BACK_FACE_CULL_PRIM Number of back-face primitives culled due to facedness; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations\0"
+        "PA_SU#_PERF_PAPC_SU_FRONT_FACE_CULL_PRIM\0"
+        "PERF_PAPC_SU_FRONT_FACE_CULL_PRIM Number of front-face primitives culled due to facedness; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations\0"
+        "PA_SU#_PERF_PAPC_SU_POLYMODE_FACE_CULL\0"
+        "PERF_PAPC_SU_POLYMODE_FACE_CULL Number of polymode cull-determination primitives culled; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations\0"
+        "PA_SU#_058\0"
+        "Counter 58 from group PA_SU#\0"
+        "PA_SU#_059\0"
+        "Counter 59 from group PA_SU#\0"
+        "PA_SU#_060\0"
+        "Counter 60 from group PA_SU#\0"
+        "PA_SU#_PERF_PAPC_SU_OUTPUT_PRIM\0"
+        "PERF_PAPC_SU_OUTPUT_PRIM Number of primitives output from the Setup block; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations\0"
+        "PA_SU#_PERF_PAPC_SU_OUTPUT_CLIP_PRIM\0"
+        "PERF_PAPC_SU_OUTPUT_CLIP_PRIM Number of clipped primitives output from the Setup block; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations\0"
+        "PA_SU#_063\0"
+        "Counter 63 from group PA_SU#\0"
+        "PA_SU#_064\0"
+        "Counter 64 from group PA_SU#\0"
+        "PA_SU#_065\0"
+        "Counter 65 from group PA_SU#\0"
+        "PA_SU#_066\0"
+        "Counter 66 from group PA_SU#\0"
+        "PA_SU#_067\0"
+        "Counter 67 from group PA_SU#\0"
+        "PA_SU#_068\0"
+        "Counter 68 from group PA_SU#\0"
+        "PA_SU#_069\0"
+        "Counter 69 from group PA_SU#\0"
+        "PA_SU#_070\0"
+        "Counter 70 from group PA_SU#\0"
+        "PA_SU#_071\0"
+        "Counter 71 from group PA_SU#\0"
+        "PA_SU#_072\0"
+        "Counter 72 from group PA_SU#\0"
+        "PA_SU#_PERF_PAPC_SU_OUTPUT_PRIM_DUAL\0"
+        "PERF_PAPC_SU_OUTPUT_PRIM_DUAL Number of dual gradient primitives output from the Setup block; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations\0"
+        "PA_SU#_PERF_PAPC_SU_OUTPUT_CLIP_PRIM_DUAL\0"
+        "PERF_PAPC_SU_OUTPUT_CLIP_PRIM_DUAL Number of dual gradient clipped primitives output from the Setup block; increment rate-one per clock ; range-1/clk;it does not indicate bad performance; no bottleneck detection;all instances report the same result; no combinations\0"
+        "PA_SU#_075\0"
+        "Counter 75 from group PA_SU#\0"
+        "PA_SU#_076\0"
+        "Counter 76 from group PA_SU#\0"
+        "PA_SU#_077\0"
+        "Counter 77 from group PA_SU#\0"
+        "PA_SU#_078\0"
+        "Counter 78 from group PA_SU#\0"
+        "PA_SU#_079\0"
+        "Counter 79 from group PA_SU#\0"
+        "PA_SU#_080\0"
+        "Counter 80 from group PA_SU#\0"
+        "PA_SU#_081\0"
+        "Counter 81 from group PA_SU#\0"
+        "PA_SU#_082\0"
+        "Counter 82 from group PA_SU#\0"
+        "PA_SU#_083\0"
+        "Counter 83 from group PA_SU#\0"
+        "PA_SU#_084\0"
+        "Counter 84 from group PA_SU#\0"
+        "PA_SU#_085\0"
+        "Counter 85 from group PA_SU#\0"
+        "PA_SU#_086\0"
+        "Counter 86 from group PA_SU#\0"
+        "PA_SU#_087\0"
+        "Counter 87 from group PA_SU#\0"
+        "PA_SU#_088\0"
+        "Counter 88 from group PA_SU#\0"
+        "PA_SU#_089\0"
+        "Counter 89 from group PA_SU#\0"
+        "PA_SU#_090\0"
+        "Counter 90 from group PA_SU#\0"
+        "PA_SU#_091\0"
+        "Counter 91 from group PA_SU#\0"
+        "PA_SU#_092\0"
+        "Counter 92 from group PA_SU#\0"
+        "PA_SU#_093\0"
+        "Counter 93 from group PA_SU#\0"
+        "PA_SU#_094\0"
+        "Counter 94 from group PA_SU#\0"
+        "PA_SU#_095\0"
+        "Counter 95 from group PA_SU#\0"
+        "PA_SU#_096\0"
+        "Counter 96 from group PA_SU#\0"
+        "PA_SU#_097\0"
+        "Counter 97 from group PA_SU#\0"
+        "PA_SU#_098\0"
+        "Counter 98 from group PA_SU#\0"
+        "PA_SU#_099\0"
+        "Counter 99 from group PA_SU#\0"
+        "PA_SU#_100\0"
+        "Counter 100 from group PA_SU#\0"
+        "PA_SU#_101\0"
+        "Counter 101 from group PA_SU#\0"
+        "PA_SU#_102\0"
+        "Counter 102 from group PA_SU#\0"
+        "PA_SU#_103\0"
+        "Counter 103 from group PA_SU#\0"
+        "PA_SU#_104\0"
+        "Counter 104 from group PA_SU#\0"
+        "PA_SU#_PERF_PAPC_CLIP_BUSY\0"
+        "PERF_PAPC_CLIP_BUSY Number of clocks Clip is Busy; range-1/clk;it can potentially be used to detect bad performance;all instances report the same result; can be used to detect bottlenecks in combination with other signals\0"
+        "PA_SU#_106\0"
+        "Counter 106 from group PA_SU#\0"
+        "PA_SU#_107\0"
+        "Counter 107 from group PA_SU#\0"
+        "PA_SU#_108\0"
+        "Counter 108 from group PA_SU#\0"
+        "PA_SU#_PERF_PAPC_SU_STALLED_SC\0"
+        "PERF_PAPC_SU_STALLED_SC Number of clocks Setup is stalled by SC; range-1/clk;it can potentially be used to detect bad performance;all instances report the same result\0"
+        "PA_SU#_110\0"
+        "Counter 110 from group PA_SU#\0"
+        "PA_SU#_111\0"
+        "Counter 111 from group PA_SU#\0"
+        "PA_SU#_112\0"
+        "Counter 112 from group PA_SU#\0"
+        "PA_SU#_113\0"
+        "Counter 113 from group PA_SU#\0"
+        "PA_SU#_114\0"
+        "Counter 114 from group PA_SU#\0"
+        "PA_SU#_115\0"
+        "Counter 115 from group PA_SU#\0"
+        "PA_SU#_116\0"
+        "Counter 116 from group PA_SU#\0"
+        "PA_SU#_117\0"
+        "Counter 117 from group PA_SU#\0"
+        "PA_SU#_118\0"
+        "Counter 118 from group PA_SU#\0"
+        "PA_SU#_119\0"
+        "Counter 119 from group PA_SU#\0"
+        "PA_SU#_120\0"
+        "Counter 120 from group PA_SU#\0"
+        "PA_SU#_121\0"
+        "Counter 121 from group PA_SU#\0"
+        "PA_SU#_122\0"
+        "Counter 122 from group PA_SU#\0"
+        "PA_SU#_123\0"
+        "Counter 123 from group PA_SU#\0"
+        "PA_SU#_124\0"
+        "Counter 124 from group PA_SU#\0"
+        "PA_SU#_125\0"
+        "Counter 125 from group PA_SU#\0"
+        "PA_SU#_126\0"
+        "Counter 126 from group PA_SU#\0"
+        "PA_SU#_127\0"
+        "Counter 127 from group PA_SU#\0"
+        "PA_SU#_128\0"
+        "Counter 128 from group PA_SU#\0"
+        "PA_SU#_129\0"
+        "Counter 129 from group PA_SU#\0"
+        "PA_SU#_130\0"
+        "Counter 130 from group PA_SU#\0"
+        "PA_SU#_131\0"
+        "Counter 131 from group PA_SU#\0"
+        "PA_SU#_132\0"
+        "Counter 132 from group PA_SU#\0"
+        "PA_SU#_133\0"
+        "Counter 133 from group PA_SU#\0"
+        "PA_SU#_134\0"
+        "Counter 134 from group PA_SU#\0"
+        "PA_SU#_135\0"
+        "Counter 135 from group PA_SU#\0"
+        "PA_SU#_136\0"
+        "Counter 136 from group PA_SU#\0"
+        "PA_SU#_137\0"
+        "Counter 137 from group PA_SU#\0"
+        "PA_SU#_138\0"
+        "Counter 138 from group PA_SU#\0"
+        "PA_SU#_139\0"
+        "Counter 139 from group PA_SU#\0"
+        "PA_SU#_140\0"
+        "Counter 140 from group PA_SU#\0"
+        "PA_SU#_141\0"
+        "Counter 141 from group PA_SU#\0"
+        "PA_SU#_142\0"
+        "Counter 142 from group PA_SU#\0"
+        "PA_SU#_143\0"
+        "Counter 143 from group PA_SU#\0"
+        "PA_SU#_144\0"
+        "Counter 144 from group PA_SU#\0"
+        "PA_SU#_145\0"
+        "Counter 145 from group PA_SU#\0"
+        "PA_SU#_146\0"
+        "Counter 146 from group PA_SU#\0"
+        "PA_SU#_147\0"
+        "Counter 147 from group PA_SU#\0"
+        "PA_SU#_148\0"
+        "Counter 148 from group PA_SU#\0"
+        "PA_SU#_149\0"
+        "Counter 149 from group PA_SU#\0"
+        "PA_SU#_150\0"
+        "Counter 150 from group PA_SU#\0"
+        "PA_SU#_151\0"
+        "Counter 151 from group PA_SU#\0"
+        "PA_SU#_152\0"
+        "Counter 152 from group PA_SU#\0"
+        "PA_SU#_153\0"
+        "Counter 153 from group PA_SU#\0"
+        "PA_SU#_154\0"
+        "Counter 154 from group PA_SU#\0"
+        "PA_SU#_155\0"
+        "Counter 155 from group PA_SU#\0"
+        "PA_SU#_156\0"
+        "Counter 156 from group PA_SU#\0"
+        "PA_SU#_157\0"
+        "Counter 157 from group PA_SU#\0"
+        "PA_SU#_158\0"
+        "Counter 158 from group PA_SU#\0"
+        "PA_SU#_159\0"
+        "Counter 159 from group PA_SU#\0"
+        "PA_SU#_160\0"
+        "Counter 160 from group PA_SU#\0"
+        "PA_SU#_161\0"
+        "Counter 161 from group PA_SU#\0"
+        "PA_SU#_162\0"
+        "Counter 162 from group PA_SU#\0"
+        "PA_SU#_163\0"
+        "Counter 163 from group PA_SU#\0"
+        "PA_SU#_164\0"
+        "Counter 164 from group PA_SU#\0"
+        "PA_SU#_165\0"
+        "Counter 165 from group PA_SU#\0"
+        "PA_SU#_166\0"
+        "Counter 166 from group PA_SU#\0"
+        "PA_SU#_167\0"
+        "Counter 167 from group PA_SU#\0"
+        "PA_SU#_168\0"
+        "Counter 168 from group PA_SU#\0"
+        "PA_SU#_169\0"
+        "Counter 169 from group PA_SU#\0"
+        "PA_SU#_170\0"
+        "Counter 170 from group PA_SU#\0"
+        "PA_SU#_171\0"
+        "Counter 171 from group PA_SU#\0"
+        "PA_SU#_172\0"
+        "Counter 172 from group PA_SU#\0"
+        "PA_SU#_173\0"
+        "Counter 173 from group PA_SU#\0"
+        "PA_SU#_174\0"
+        "Counter 174 from group PA_SU#\0"
+        "PA_SU#_175\0"
+        "Counter 175 from group PA_SU#\0"
+        "PA_SU#_176\0"
+        "Counter 176 from group PA_SU#\0"
+        "PA_SU#_177\0"
+        "Counter 177 from group PA_SU#\0"
+        "PA_SU#_178\0"
+        "Counter 178 from group PA_SU#\0"
+        "PA_SU#_179\0"
+        "Counter 179 from group PA_SU#\0"
+        "PA_SU#_180\0"
+        "Counter 180 from group PA_SU#\0"
+        "PA_SU#_181\0"
+        "Counter 181 from group PA_SU#\0"
+        "PA_SU#_182\0"
+        "Counter 182 from group PA_SU#\0"
+        "PA_SU#_183\0"
+        "Counter 183 from group PA_SU#\0"
+        "PA_SU#_184\0"
+        "Counter 184 from group PA_SU#\0"
+        "PA_SU#_185\0"
+        "Counter 185 from group PA_SU#\0"
+        "PA_SU#_186\0"
+        "Counter 186 from group PA_SU#\0"
+        "PA_SU#_187\0"
+        "Counter 187 from group PA_SU#\0"
+        "PA_SU#_188\0"
+        "Counter 188 from group PA_SU#\0"
+        "PA_SU#_189\0"
+        "Counter 189 from group PA_SU#\0"
+        "PA_SU#_190\0"
+        "Counter 190 from group PA_SU#\0"
+        "PA_SU#_191\0"
+        "Counter 191 from group PA_SU#\0"
+        "PA_SU#_192\0"
+        "Counter 192 from group PA_SU#\0"
+        "PA_SU#_193\0"
+        "Counter 193 from group PA_SU#\0"
+        "PA_SU#_194\0"
+        "Counter 194 from group PA_SU#\0"
+        "PA_SU#_195\0"
+        "Counter 195 from group PA_SU#\0"
+        "PA_SU#_196\0"
+        "Counter 196 from group PA_SU#\0"
+        "PA_SU#_197\0"
+        "Counter 197 from group PA_SU#\0"
+        "PA_SU#_198\0"
+        "Counter 198 from group PA_SU#\0"
+        "PA_SU#_199\0"
+        "Counter 199 from group PA_SU#\0"
+        "PA_SU#_200\0"
+        "Counter 200 from group PA_SU#\0"
+        "PA_SU#_201\0"
+        "Counter 201 from group PA_SU#\0"
+        "PA_SU#_202\0"
+        "Counter 202 from group PA_SU#\0"
+        "PA_SU#_203\0"
+        "Counter 203 from group PA_SU#\0"
+        "PA_SU#_204\0"
+        "Counter 204 from group PA_SU#\0"
+        "PA_SU#_205\0"
+        "Counter 205 from group PA_SU#\0"
+        "PA_SU#_206\0"
+        "Counter 206 from group PA_SU#\0"
+        "PA_SU#_207\0"
+        "Counter 207 from group PA_SU#\0"
+        "PA_SU#_208\0"
+        "Counter 208 from group PA_SU#\0"
+        "PA_SU#_209\0"
+        "Counter 209 from group PA_SU#\0"
+        "PA_SU#_210\0"
+        "Counter 210 from group PA_SU#\0"
+        "PA_SU#_211\0"
+        "Counter 211 from group PA_SU#\0"
+        "PA_SU#_212\0"
+        "Counter 212 from group PA_SU#\0"
+        "PA_SU#_213\0"
+        "Counter 213 from group PA_SU#\0"
+        "PA_SU#_214\0"
+        "Counter 214 from group PA_SU#\0"
+        "PA_SU#_215\0"
+        "Counter 215 from group PA_SU#\0"
+        "PA_SU#_216\0"
+        "Counter 216 from group PA_SU#\0"
+        "PA_SU#_217\0"
+        "Counter 217 from group PA_SU#\0"
+        "PA_SU#_218\0"
+        "Counter 218 from group PA_SU#\0"
+        "PA_SU#_219\0"
+        "Counter 219 from group PA_SU#\0"
+        "PA_SU#_220\0"
+        "Counter 220 from group PA_SU#\0"
+        "PA_SU#_221\0"
+        "Counter 221 from group PA_SU#\0"
+        "PA_SU#_222\0"
+        "Counter 222 from group PA_SU#\0"
+        "PA_SU#_223\0"
+        "Counter 223 from group PA_SU#\0"
+        "PA_SU#_224\0"
+        "Counter 224 from group PA_SU#\0"
+        "PA_SU#_225\0"
+        "Counter 225 from group PA_SU#\0"
+        "PA_SU#_226\0"
+        "Counter 226 from group PA_SU#\0"
+        "PA_SU#_227\0"
+        "Counter 227 from group PA_SU#\0"
+        "PA_SU#_228\0"
+        "Counter 228 from group PA_SU#\0"
+        "PA_SU#_229\0"
+        "Counter 229 from group PA_SU#\0"
+        "PA_SU#_230\0"
+        "Counter 230 from group PA_SU#\0"
+        "PA_SU#_231\0"
+        "Counter 231 from group PA_SU#\0"
+        "PA_SU#_232\0"
+        "Counter 232 from group PA_SU#\0"
+        "PA_SU#_233\0"
+        "Counter 233 from group PA_SU#\0"
+        "PA_SU#_234\0"
+        "Counter 234 from group PA_SU#\0"
+        "PA_SU#_235\0"
+        "Counter 235 from group PA_SU#\0"
+        "PA_SU#_236\0"
+        "Counter 236 from group PA_SU#\0"
+        "PA_SU#_237\0"
+        "Counter 237 from group PA_SU#\0"
+        "PA_SU#_238\0"
+        "Counter 238 from group PA_SU#\0"
+        "PA_SU#_239\0"
+        "Counter 239 from group PA_SU#\0"
+        "PA_SU#_240\0"
+        "Counter 240 from group PA_SU#\0"
+        "PA_SU#_241\0"
+        "Counter 241 from group PA_SU#\0"
+        "PA_SU#_242\0"
+        "Counter 242 from group PA_SU#\0"
+        "PA_SU#_243\0"
+        "Counter 243 from group PA_SU#\0"
+        "PA_SU#_244\0"
+        "Counter 244 from group PA_SU#\0"
+        "PA_SU#_245\0"
+        "Counter 245 from group PA_SU#\0"
+        "PA_SU#_246\0"
+        "Counter 246 from group PA_SU#\0"
+        "PA_SU#_247\0"
+        "Counter 247 from group PA_SU#\0"
+        "PA_SU#_248\0"
+        "Counter 248 from group PA_SU#\0"
+        "PA_SU#_249\0"
+        "Counter 249 from group PA_SU#\0"
+        "PA_SU#_250\0"
+        "Counter 250 from group PA_SU#\0"
+        "PA_SU#_251\0"
+        "Counter 251 from group PA_SU#\0"
+        "PA_SU#_252\0"
+        "Counter 252 from group PA_SU#\0"
+        "PA_SU#_253\0"
+        "Counter 253 from group PA_SU#\0"
+        "PA_SU#_254\0"
+        "Counter 254 from group PA_SU#\0"
+        "PA_SU#_255\0"
+        "Counter 255 from group PA_SU#\0"
+        "PA_SU#_256\0"
+        "Counter 256 from group PA_SU#\0"
+        "PA_SU#_257\0"
+        "Counter 257 from group PA_SU#\0"
+        "PA_SU#_258\0"
+        "Counter 258 from group PA_SU#\0"
+        "PA_SU#_259\0"
+        "Counter 259 from group PA_SU#\0"
+        "PA_SU#_260\0"
+        "Counter 260 from group PA_SU#\0"
+        "PA_SU#_261\0"
+        "Counter 261 from group PA_SU#\0"
+        "PA_SU#_262\0"
+        "Counter 262 from group PA_SU#\0"
+        "PA_SU#_263\0"
+        "Counter 263 from group PA_SU#\0"
+        "PA_SU#_264\0"
+        "Counter 264 from group PA_SU#\0"
+        "PA_SU#_265\0"
+        "Counter 265 from group PA_SU#\0"
+        "PA_SU#_266\0"
+        "Counter 266 from group PA_SU#\0"
+        "PA_SU#_267\0"
+        "Counter 267 from group PA_SU#\0"
+        "PA_SU#_268\0"
+        "Counter 268 from group PA_SU#\0"
+        "PA_SU#_269\0"
+        "Counter 269 from group PA_SU#\0"
+        "PA_SU#_270\0"
+        "Counter 270 from group PA_SU#\0"
+        "PA_SU#_271\0"
+        "Counter 271 from group PA_SU#\0"
+        "PA_SU#_272\0"
+        "Counter 272 from group PA_SU#\0"
+        "PA_SU#_273\0"
+        "Counter 273 from group PA_SU#\0"
+        "PA_SU#_274\0"
+        "Counter 274 from group PA_SU#\0"
+        "PA_SU#_275\0"
+        "Counter 275 from group PA_SU#\0"
+        "PA_SU#_276\0"
+        "Counter 276 from group PA_SU#\0"
+        "PA_SU#_277\0"
+        "Counter 277 from group PA_SU#\0"
+        "PA_SU#_278\0"
+        "Counter 278 from group PA_SU#\0"
+        "PA_SU#_279\0"
+        "Counter 279 from group PA_SU#\0"
+        "PA_SU#_280\0"
+        "Counter 280 from group PA_SU#\0"
+        "PA_SU#_281\0"
+        "Counter 281 from group PA_SU#\0"
+        "PA_SU#_282\0"
+        "Counter 282 from group PA_SU#\0"
+        "PA_SU#_283\0"
+        "Counter 283 from group PA_SU#\0"
+        "PA_SU#_284\0"
+        "Counter 284 from group PA_SU#\0"
+        "PA_SU#_285\0"
+        "Counter 285 from group PA_SU#\0"
+        "PA_SU#_286\0"
+        "Counter 286 from group PA_SU#\0"
+        "PA_SU#_287\0"
+        "Counter 287 from group PA_SU#\0"
+        "PA_SU#_288\0"
+        "Counter 288 from group PA_SU#\0"
+        "PA_SU#_289\0"
+        "Counter 289 from group PA_SU#\0"
+        "PA_SU#_290\0"
+        "Counter 290 from group PA_SU#\0"
+        "PA_SU#_291\0"
+        "Counter 291 from group PA_SU#\0"
+        "PA_SU#_292\0"
+        "Counter 292 from group PA_SU#\0"
+        "PA_SU#_293\0"
+        "Counter 293 from group PA_SU#\0"
+        "PA_SU#_294\0"
+        "Counter 294 from group PA_SU#\0"
+        "PA_SU#_295\0"
+        "Counter 295 from group PA_SU#\0"
+        "PA_SU#_296\0"
+        "Counter 296 from group PA_SU#\0"
+        "PA_SU#_297\0"
+        "Counter 297 from group PA_SU#\0"
+        "PA_SU#_298\0"
+        "Counter 298 from group PA_SU#\0"
+        "PA_SU#_299\0"
+        "Counter 299 from group PA_SU#\0"
+        "PA_SU#_300\0"
+        "Counter 300 from group PA_SU#\0"
+        "PA_SU#_301\0"
+        "Counter 301 from group PA_SU#\0"
+        "PA_SU#_302\0"
+        "Counter 302 from group PA_SU#\0"
+        "PA_SU#_303\0"
+        "Counter 303 from group PA_SU#\0"
+        "PA_SU#_304\0"
+        "Counter 304 from group PA_SU#\0"
+        "PA_SU#_305\0"
+        "Counter 305 from group PA_SU#\0"
+        "PA_SU#_306\0"
+        "Counter 306 from group PA_SU#\0"
+        "PA_SU#_307\0"
+        "Counter 307 from group PA_SU#\0"
+        "PA_SU#_308\0"
+        "Counter 308 from group PA_SU#\0"
+        "PA_SU#_309\0"
+        "Counter 309 from group PA_SU#\0"
+        "PA_SU#_310\0"
+        "Counter 310 from group PA_SU#\0"
+        "PA_SU#_311\0"
+        "Counter 311 from group PA_SU#\0"
+        "PA_SU#_312\0"
+        "Counter 312 from group PA_SU#\0"
+        "PA_SU#_313\0"
+        "Counter 313 from group PA_SU#\0"
+        "PA_SU#_314\0"
+        "Counter 314 from group PA_SU#\0"
+        "PA_SU#_315\0"
+        "Counter 315 from group PA_SU#\0"
+        "PA_SU#_316\0"
+        "Counter 316 from group PA_SU#\0"
+        "PA_SU#_317\0"
+        "Counter 317 from group PA_SU#\0"
+        "PA_SU#_318\0"
+        "Counter 318 from group PA_SU#\0"
+        "PA_SU#_319\0"
+        "Counter 319 from group PA_SU#\0"
+        "PA_SU#_320\0"
+        "Counter 320 from group PA_SU#\0"
+        "PA_SU#_321\0"
+        "Counter 321 from group PA_SU#\0"
+        "PA_SU#_322\0"
+        "Counter 322 from group PA_SU#\0"
+        "PA_SU#_323\0"
+        "Counter 323 from group PA_SU#\0"
+        "PA_SU#_324\0"
+        "Counter 324 from group PA_SU#\0"
+        "PA_SU#_325\0"
+        "Counter 325 from group PA_SU#\0"
+        "PA_SU#_326\0"
+        "Counter 326 from group PA_SU#\0"
+        "PA_SU#_327\0"
+        "Counter 327 from group PA_SU#\0"
+        "PA_SU#_328\0"
+        "Counter 328 from group PA_SU#\0"
+        "PA_SU#_329\0"
+        "Counter 329 from group PA_SU#\0"
+        "PA_SU#_330\0"
+        "Counter 330 from group PA_SU#\0"
+        "PA_SU#_331\0"
+        "Counter 331 from group PA_SU#\0"
+        "PA_SU#_332\0"
+        "Counter 332 from group PA_SU#\0"
+        "PA_SU#_333\0"
+        "Counter 333 from group PA_SU#\0"
+        "PA_SU#_334\0"
+        "Counter 334 from group PA_SU#\0"
+        "PA_SU#_335\0"
+        "Counter 335 from group PA_SU#\0"
+        "PA_SU#_336\0"
+        "Counter 336 from group PA_SU#\0"
+        "PA_SU#_337\0"
+        "Counter 337 from group PA_SU#\0"
+        "PA_SU#_338\0"
+        "Counter 338 from group PA_SU#\0"
+        "PA_SU#_339\0"
+        "Counter 339 from group PA_SU#\0"
+        "PA_SU#_340\0"
+        "Counter 340 from group PA_SU#\0"
+        "PA_SU#_341\0"
+        "Counter 341 from group PA_SU#\0"
+        "PA_SU#_342\0"
+        "Counter 342 from group PA_SU#\0"
+        "PA_SU#_343\0"
+        "Counter 343 from group PA_SU#\0"
+        "PA_SU#_344\0"
+        "Counter 344 from group PA_SU#\0"
+        "PA_SU#_345\0"
+        "Counter 345 from group PA_SU#\0"
+        "PA_SU#_346\0"
+        "Counter 346 from group PA_SU#\0"
+        "PA_SU#_347\0"
+        "Counter 347 from group PA_SU#\0"
+        "PA_SU#_348\0"
+        "Counter 348 from group PA_SU#\0"
+        "PA_SU#_349\0"
+        "Counter 349 from group PA_SU#\0"
+        "PA_SU#_350\0"
+        "Counter 350 from group PA_SU#");
+
+    const GPA_HardwareBlockCounterDesc pa_su_block_counters_gfx9_placeholder4[] = {
+        {GPA_HIDE_NAME_OFFSET(8), GPA_HIDE_NAME_OFFSET(19)},
+        {GPA_HIDE_NAME_OFFSET(47), GPA_HIDE_NAME_OFFSET(58)},
+        {GPA_HIDE_NAME_OFFSET(86), GPA_HIDE_NAME_OFFSET(97)},
+        {GPA_HIDE_NAME_OFFSET(125), GPA_HIDE_NAME_OFFSET(136)},
+        {GPA_HIDE_NAME_OFFSET(164), GPA_HIDE_NAME_OFFSET(175)},
+        {GPA_HIDE_NAME_OFFSET(203), GPA_HIDE_NAME_OFFSET(214)},
+        {GPA_HIDE_NAME_OFFSET(242), GPA_HIDE_NAME_OFFSET(253)},
+        {GPA_HIDE_NAME_OFFSET(281), GPA_HIDE_NAME_OFFSET(292)},
+        {GPA_HIDE_NAME_OFFSET(320), GPA_HIDE_NAME_OFFSET(351)},
+        {GPA_HIDE_NAME_OFFSET(568), GPA_HIDE_NAME_OFFSET(579)},
+        {GPA_HIDE_NAME_OFFSET(607), GPA_HIDE_NAME_OFFSET(618)},
+        {GPA_HIDE_NAME_OFFSET(647), GPA_HIDE_NAME_OFFSET(658)},
+        {GPA_HIDE_NAME_OFFSET(687), GPA_HIDE_NAME_OFFSET(698)},
+        {GPA_HIDE_NAME_OFFSET(727), GPA_HIDE_NAME_OFFSET(738)},
+        {GPA_HIDE_NAME_OFFSET(767), GPA_HIDE_NAME_OFFSET(799)},
+        {GPA_HIDE_NAME_OFFSET(1162), GPA_HIDE_NAME_OFFSET(1173)},
+        {GPA_HIDE_NAME_OFFSET(1202), GPA_HIDE_NAME_OFFSET(1213)},
+        {GPA_HIDE_NAME_OFFSET(1242), GPA_HIDE_NAME_OFFSET(1253)},
+        {GPA_HIDE_NAME_OFFSET(1282), GPA_HIDE_NAME_OFFSET(1293)},
+        {GPA_HIDE_NAME_OFFSET(1322), GPA_HIDE_NAME_OFFSET(1333)},
+        {GPA_HIDE_NAME_OFFSET(1362), GPA_HIDE_NAME_OFFSET(1373)},
+        {GPA_HIDE_NAME_OFFSET(1402), GPA_HIDE_NAME_OFFSET(1440)},
+        {GPA_HIDE_NAME_OFFSET(1684), GPA_HIDE_NAME_OFFSET(1695)},
+        {GPA_HIDE_NAME_OFFSET(1724), GPA_HIDE_NAME_OFFSET(1735)},
+        {GPA_HIDE_NAME_OFFSET(1764), GPA_HIDE_NAME_OFFSET(1775)},
+        {GPA_HIDE_NAME_OFFSET(1804), GPA_HIDE_NAME_OFFSET(1815)},
+        {GPA_HIDE_NAME_OFFSET(1844), GPA_HIDE_NAME_OFFSET(1855)},
+        {GPA_HIDE_NAME_OFFSET(1884), GPA_HIDE_NAME_OFFSET(1895)},
+        {GPA_HIDE_NAME_OFFSET(1924), GPA_HIDE_NAME_OFFSET(1935)},
+        {GPA_HIDE_NAME_OFFSET(1964), GPA_HIDE_NAME_OFFSET(1975)},
+        {GPA_HIDE_NAME_OFFSET(2004), GPA_HIDE_NAME_OFFSET(2015)},
+        {GPA_HIDE_NAME_OFFSET(2044), GPA_HIDE_NAME_OFFSET(2055)},
+        {GPA_HIDE_NAME_OFFSET(2084), GPA_HIDE_NAME_OFFSET(2095)},
+        {GPA_HIDE_NAME_OFFSET(2124), GPA_HIDE_NAME_OFFSET(2135)},
+        {GPA_HIDE_NAME_OFFSET(2164), GPA_HIDE_NAME_OFFSET(2175)},
+        {GPA_HIDE_NAME_OFFSET(2204), GPA_HIDE_NAME_OFFSET(2215)},
+        {GPA_HIDE_NAME_OFFSET(2244), GPA_HIDE_NAME_OFFSET(2255)},
+        {GPA_HIDE_NAME_OFFSET(2284), GPA_HIDE_NAME_OFFSET(2295)},
+        {GPA_HIDE_NAME_OFFSET(2324), GPA_HIDE_NAME_OFFSET(2335)},
+        {GPA_HIDE_NAME_OFFSET(2364), GPA_HIDE_NAME_OFFSET(2375)},
+        {GPA_HIDE_NAME_OFFSET(2404), GPA_HIDE_NAME_OFFSET(2415)},
+        {GPA_HIDE_NAME_OFFSET(2444), GPA_HIDE_NAME_OFFSET(2455)},
+        {GPA_HIDE_NAME_OFFSET(2484), GPA_HIDE_NAME_OFFSET(2495)},
+        {GPA_HIDE_NAME_OFFSET(2524), GPA_HIDE_NAME_OFFSET(2535)},
+        {GPA_HIDE_NAME_OFFSET(2564), GPA_HIDE_NAME_OFFSET(2575)},
+        {GPA_HIDE_NAME_OFFSET(2604), GPA_HIDE_NAME_OFFSET(2615)},
+        {GPA_HIDE_NAME_OFFSET(2644), GPA_HIDE_NAME_OFFSET(2655)},
+        {GPA_HIDE_NAME_OFFSET(2684), GPA_HIDE_NAME_OFFSET(2695)},
+        {GPA_HIDE_NAME_OFFSET(2724), GPA_HIDE_NAME_OFFSET(2735)},
+        {GPA_HIDE_NAME_OFFSET(2764), GPA_HIDE_NAME_OFFSET(2775)},
+        {GPA_HIDE_NAME_OFFSET(2804), GPA_HIDE_NAME_OFFSET(2815)},
+        {GPA_HIDE_NAME_OFFSET(2844), GPA_HIDE_NAME_OFFSET(2855)},
+        {GPA_HIDE_NAME_OFFSET(2884), GPA_HIDE_NAME_OFFSET(2895)},
+        {GPA_HIDE_NAME_OFFSET(2924), GPA_HIDE_NAME_OFFSET(2935)},
+        {GPA_HIDE_NAME_OFFSET(2964), GPA_HIDE_NAME_OFFSET(3004)},
+        {GPA_HIDE_NAME_OFFSET(3242), GPA_HIDE_NAME_OFFSET(3282)},
+        {GPA_HIDE_NAME_OFFSET(3530), GPA_HIDE_NAME_OFFSET(3571)},
+        {GPA_HIDE_NAME_OFFSET(3821), GPA_HIDE_NAME_OFFSET(3860)},
+        {GPA_HIDE_NAME_OFFSET(4108), GPA_HIDE_NAME_OFFSET(4119)},
+        {GPA_HIDE_NAME_OFFSET(4148), GPA_HIDE_NAME_OFFSET(4159)},
+        {GPA_HIDE_NAME_OFFSET(4188), GPA_HIDE_NAME_OFFSET(4199)},
+        {GPA_HIDE_NAME_OFFSET(4228), GPA_HIDE_NAME_OFFSET(4260)},
+        {GPA_HIDE_NAME_OFFSET(4494), GPA_HIDE_NAME_OFFSET(4531)},
+        {GPA_HIDE_NAME_OFFSET(4778), GPA_HIDE_NAME_OFFSET(4789)},
+        {GPA_HIDE_NAME_OFFSET(4818), GPA_HIDE_NAME_OFFSET(4829)},
+        {GPA_HIDE_NAME_OFFSET(4858), GPA_HIDE_NAME_OFFSET(4869)},
+        {GPA_HIDE_NAME_OFFSET(4898), GPA_HIDE_NAME_OFFSET(4909)},
+        {GPA_HIDE_NAME_OFFSET(4938), GPA_HIDE_NAME_OFFSET(4949)},
+        {GPA_HIDE_NAME_OFFSET(4978), GPA_HIDE_NAME_OFFSET(4989)},
+        {GPA_HIDE_NAME_OFFSET(5018), GPA_HIDE_NAME_OFFSET(5029)},
+        {GPA_HIDE_NAME_OFFSET(5058), GPA_HIDE_NAME_OFFSET(5069)},
+        {GPA_HIDE_NAME_OFFSET(5098), GPA_HIDE_NAME_OFFSET(5109)},
+        {GPA_HIDE_NAME_OFFSET(5138), GPA_HIDE_NAME_OFFSET(5149)},
+        {GPA_HIDE_NAME_OFFSET(5178), GPA_HIDE_NAME_OFFSET(5215)},
+        {GPA_HIDE_NAME_OFFSET(5468), GPA_HIDE_NAME_OFFSET(5510)},
+        {GPA_HIDE_NAME_OFFSET(5776), GPA_HIDE_NAME_OFFSET(5787)},
+        {GPA_HIDE_NAME_OFFSET(5816), GPA_HIDE_NAME_OFFSET(5827)},
+        {GPA_HIDE_NAME_OFFSET(5856), GPA_HIDE_NAME_OFFSET(5867)},
+        {GPA_HIDE_NAME_OFFSET(5896), GPA_HIDE_NAME_OFFSET(5907)},
+        {GPA_HIDE_NAME_OFFSET(5936), GPA_HIDE_NAME_OFFSET(5947)},
+        {GPA_HIDE_NAME_OFFSET(5976), GPA_HIDE_NAME_OFFSET(5987)},
+        {GPA_HIDE_NAME_OFFSET(6016), GPA_HIDE_NAME_OFFSET(6027)},
+        {GPA_HIDE_NAME_OFFSET(6056), GPA_HIDE_NAME_OFFSET(6067)},
+        {GPA_HIDE_NAME_OFFSET(6096), GPA_HIDE_NAME_OFFSET(6107)},
+        {GPA_HIDE_NAME_OFFSET(6136), GPA_HIDE_NAME_OFFSET(6147)},
+        {GPA_HIDE_NAME_OFFSET(6176), GPA_HIDE_NAME_OFFSET(6187)},
+        {GPA_HIDE_NAME_OFFSET(6216), GPA_HIDE_NAME_OFFSET(6227)},
+        {GPA_HIDE_NAME_OFFSET(6256), GPA_HIDE_NAME_OFFSET(6267)},
+        {GPA_HIDE_NAME_OFFSET(6296), GPA_HIDE_NAME_OFFSET(6307)},
+        {GPA_HIDE_NAME_OFFSET(6336), GPA_HIDE_NAME_OFFSET(6347)},
+        {GPA_HIDE_NAME_OFFSET(6376), GPA_HIDE_NAME_OFFSET(6387)},
+        {GPA_HIDE_NAME_OFFSET(6416), GPA_HIDE_NAME_OFFSET(6427)},
+        {GPA_HIDE_NAME_OFFSET(6456), GPA_HIDE_NAME_OFFSET(6467)},
+        {GPA_HIDE_NAME_OFFSET(6496), GPA_HIDE_NAME_OFFSET(6507)},
+        {GPA_HIDE_NAME_OFFSET(6536), GPA_HIDE_NAME_OFFSET(6547)},
+        {GPA_HIDE_NAME_OFFSET(6576), GPA_HIDE_NAME_OFFSET(6587)},
+        {GPA_HIDE_NAME_OFFSET(6616), GPA_HIDE_NAME_OFFSET(6627)},
+        {GPA_HIDE_NAME_OFFSET(6656), GPA_HIDE_NAME_OFFSET(6667)},
+        {GPA_HIDE_NAME_OFFSET(6696), GPA_HIDE_NAME_OFFSET(6707)},
+        {GPA_HIDE_NAME_OFFSET(6736), GPA_HIDE_NAME_OFFSET(6747)},
+        {GPA_HIDE_NAME_OFFSET(6776), GPA_HIDE_NAME_OFFSET(6787)},
+        {GPA_HIDE_NAME_OFFSET(6817), GPA_HIDE_NAME_OFFSET(6828)},
+        {GPA_HIDE_NAME_OFFSET(6858), GPA_HIDE_NAME_OFFSET(6869)},
+        {GPA_HIDE_NAME_OFFSET(6899), GPA_HIDE_NAME_OFFSET(6910)},
+        {GPA_HIDE_NAME_OFFSET(6940), GPA_HIDE_NAME_OFFSET(6951)},
+        {GPA_HIDE_NAME_OFFSET(6981), GPA_HIDE_NAME_OFFSET(7008)},
+        {GPA_HIDE_NAME_OFFSET(7230), GPA_HIDE_NAME_OFFSET(7241)},
+        {GPA_HIDE_NAME_OFFSET(7271), GPA_HIDE_NAME_OFFSET(7282)},
+        {GPA_HIDE_NAME_OFFSET(7312), GPA_HIDE_NAME_OFFSET(7323)},
+        {GPA_HIDE_NAME_OFFSET(7353), GPA_HIDE_NAME_OFFSET(7384)},
+        {GPA_HIDE_NAME_OFFSET(7551), GPA_HIDE_NAME_OFFSET(7562)},
+        {GPA_HIDE_NAME_OFFSET(7592), GPA_HIDE_NAME_OFFSET(7603)},
+        {GPA_HIDE_NAME_OFFSET(7633), GPA_HIDE_NAME_OFFSET(7644)},
+        {GPA_HIDE_NAME_OFFSET(7674), GPA_HIDE_NAME_OFFSET(7685)},
+        {GPA_HIDE_NAME_OFFSET(7715), GPA_HIDE_NAME_OFFSET(7726)},
+        {GPA_HIDE_NAME_OFFSET(7756), GPA_HIDE_NAME_OFFSET(7767)},
+        {GPA_HIDE_NAME_OFFSET(7797), GPA_HIDE_NAME_OFFSET(7808)},
+        {GPA_HIDE_NAME_OFFSET(7838), GPA_HIDE_NAME_OFFSET(7849)},
+        {GPA_HIDE_NAME_OFFSET(7879), GPA_HIDE_NAME_OFFSET(7890)},
+        {GPA_HIDE_NAME_OFFSET(7920), GPA_HIDE_NAME_OFFSET(7931)},
+        {GPA_HIDE_NAME_OFFSET(7961), GPA_HIDE_NAME_OFFSET(7972)},
+        {GPA_HIDE_NAME_OFFSET(8002), GPA_HIDE_NAME_OFFSET(8013)},
+        {GPA_HIDE_NAME_OFFSET(8043), GPA_HIDE_NAME_OFFSET(8054)},
+        {GPA_HIDE_NAME_OFFSET(8084), GPA_HIDE_NAME_OFFSET(8095)},
+        {GPA_HIDE_NAME_OFFSET(8125), GPA_HIDE_NAME_OFFSET(8136)},
+        {GPA_HIDE_NAME_OFFSET(8166), GPA_HIDE_NAME_OFFSET(8177)},
+        {GPA_HIDE_NAME_OFFSET(8207), GPA_HIDE_NAME_OFFSET(8218)},
+        {GPA_HIDE_NAME_OFFSET(8248), GPA_HIDE_NAME_OFFSET(8259)},
+        {GPA_HIDE_NAME_OFFSET(8289), GPA_HIDE_NAME_OFFSET(8300)},
+        {GPA_HIDE_NAME_OFFSET(8330), GPA_HIDE_NAME_OFFSET(8341)},
+        {GPA_HIDE_NAME_OFFSET(8371), GPA_HIDE_NAME_OFFSET(8382)},
+        {GPA_HIDE_NAME_OFFSET(8412), GPA_HIDE_NAME_OFFSET(8423)},
+        {GPA_HIDE_NAME_OFFSET(8453), GPA_HIDE_NAME_OFFSET(8464)},
+        {GPA_HIDE_NAME_OFFSET(8494), GPA_HIDE_NAME_OFFSET(8505)},
+        {GPA_HIDE_NAME_OFFSET(8535), GPA_HIDE_NAME_OFFSET(8546)},
+        {GPA_HIDE_NAME_OFFSET(8576), GPA_HIDE_NAME_OFFSET(8587)},
+        {GPA_HIDE_NAME_OFFSET(8617), GPA_HIDE_NAME_OFFSET(8628)},
+        {GPA_HIDE_NAME_OFFSET(8658), GPA_HIDE_NAME_OFFSET(8669)},
+        {GPA_HIDE_NAME_OFFSET(8699), GPA_HIDE_NAME_OFFSET(8710)},
+        {GPA_HIDE_NAME_OFFSET(8740), GPA_HIDE_NAME_OFFSET(8751)},
+        {GPA_HIDE_NAME_OFFSET(8781), GPA_HIDE_NAME_OFFSET(8792)},
+        {GPA_HIDE_NAME_OFFSET(8822), GPA_HIDE_NAME_OFFSET(8833)},
+        {GPA_HIDE_NAME_OFFSET(8863), GPA_HIDE_NAME_OFFSET(8874)},
+        {GPA_HIDE_NAME_OFFSET(8904), GPA_HIDE_NAME_OFFSET(8915)},
+        {GPA_HIDE_NAME_OFFSET(8945), GPA_HIDE_NAME_OFFSET(8956)},
+        {GPA_HIDE_NAME_OFFSET(8986), GPA_HIDE_NAME_OFFSET(8997)},
+        {GPA_HIDE_NAME_OFFSET(9027), GPA_HIDE_NAME_OFFSET(9038)},
+        {GPA_HIDE_NAME_OFFSET(9068), GPA_HIDE_NAME_OFFSET(9079)},
+        {GPA_HIDE_NAME_OFFSET(9109), GPA_HIDE_NAME_OFFSET(9120)},
+        {GPA_HIDE_NAME_OFFSET(9150), GPA_HIDE_NAME_OFFSET(9161)},
+        {GPA_HIDE_NAME_OFFSET(9191), GPA_HIDE_NAME_OFFSET(9202)},
+        {GPA_HIDE_NAME_OFFSET(9232), GPA_HIDE_NAME_OFFSET(9243)},
+        {GPA_HIDE_NAME_OFFSET(9273), GPA_HIDE_NAME_OFFSET(9284)},
+        {GPA_HIDE_NAME_OFFSET(9314), GPA_HIDE_NAME_OFFSET(9325)},
+        {GPA_HIDE_NAME_OFFSET(9355), GPA_HIDE_NAME_OFFSET(9366)},
+        {GPA_HIDE_NAME_OFFSET(9396), GPA_HIDE_NAME_OFFSET(9407)},
+        {GPA_HIDE_NAME_OFFSET(9437), GPA_HIDE_NAME_OFFSET(9448)},
+        {GPA_HIDE_NAME_OFFSET(9478), GPA_HIDE_NAME_OFFSET(9489)},
+        {GPA_HIDE_NAME_OFFSET(9519), GPA_HIDE_NAME_OFFSET(9530)},
+        {GPA_HIDE_NAME_OFFSET(9560), GPA_HIDE_NAME_OFFSET(9571)},
+        {GPA_HIDE_NAME_OFFSET(9601), GPA_HIDE_NAME_OFFSET(9612)},
+        {GPA_HIDE_NAME_OFFSET(9642), GPA_HIDE_NAME_OFFSET(9653)},
+        {GPA_HIDE_NAME_OFFSET(9683), GPA_HIDE_NAME_OFFSET(9694)},
+        {GPA_HIDE_NAME_OFFSET(9724), GPA_HIDE_NAME_OFFSET(9735)},
+        {GPA_HIDE_NAME_OFFSET(9765), GPA_HIDE_NAME_OFFSET(9776)},
+        {GPA_HIDE_NAME_OFFSET(9806), GPA_HIDE_NAME_OFFSET(9817)},
+        {GPA_HIDE_NAME_OFFSET(9847), GPA_HIDE_NAME_OFFSET(9858)},
+        {GPA_HIDE_NAME_OFFSET(9888), GPA_HIDE_NAME_OFFSET(9899)},
+        {GPA_HIDE_NAME_OFFSET(9929), GPA_HIDE_NAME_OFFSET(9940)},
+        {GPA_HIDE_NAME_OFFSET(9970), GPA_HIDE_NAME_OFFSET(9981)},
+        {GPA_HIDE_NAME_OFFSET(10011), GPA_HIDE_NAME_OFFSET(10022)},
+        {GPA_HIDE_NAME_OFFSET(10052), GPA_HIDE_NAME_OFFSET(10063)},
+        {GPA_HIDE_NAME_OFFSET(10093), GPA_HIDE_NAME_OFFSET(10104)},
+        {GPA_HIDE_NAME_OFFSET(10134), GPA_HIDE_NAME_OFFSET(10145)},
+        {GPA_HIDE_NAME_OFFSET(10175), GPA_HIDE_NAME_OFFSET(10186)},
+        {GPA_HIDE_NAME_OFFSET(10216), GPA_HIDE_NAME_OFFSET(10227)},
+        {GPA_HIDE_NAME_OFFSET(10257), GPA_HIDE_NAME_OFFSET(10268)},
+        {GPA_HIDE_NAME_OFFSET(10298), GPA_HIDE_NAME_OFFSET(10309)},
+        {GPA_HIDE_NAME_OFFSET(10339), GPA_HIDE_NAME_OFFSET(10350)},
+        {GPA_HIDE_NAME_OFFSET(10380), GPA_HIDE_NAME_OFFSET(10391)},
+        {GPA_HIDE_NAME_OFFSET(10421), GPA_HIDE_NAME_OFFSET(10432)},
+        {GPA_HIDE_NAME_OFFSET(10462), GPA_HIDE_NAME_OFFSET(10473)},
+        {GPA_HIDE_NAME_OFFSET(10503), GPA_HIDE_NAME_OFFSET(10514)},
+        {GPA_HIDE_NAME_OFFSET(10544), GPA_HIDE_NAME_OFFSET(10555)},
+        {GPA_HIDE_NAME_OFFSET(10585), GPA_HIDE_NAME_OFFSET(10596)},
+        {GPA_HIDE_NAME_OFFSET(10626), GPA_HIDE_NAME_OFFSET(10637)},
+        {GPA_HIDE_NAME_OFFSET(10667), GPA_HIDE_NAME_OFFSET(10678)},
+        {GPA_HIDE_NAME_OFFSET(10708), GPA_HIDE_NAME_OFFSET(10719)},
+        {GPA_HIDE_NAME_OFFSET(10749), GPA_HIDE_NAME_OFFSET(10760)},
+        {GPA_HIDE_NAME_OFFSET(10790), GPA_HIDE_NAME_OFFSET(10801)},
+        {GPA_HIDE_NAME_OFFSET(10831), GPA_HIDE_NAME_OFFSET(10842)},
+        {GPA_HIDE_NAME_OFFSET(10872), GPA_HIDE_NAME_OFFSET(10883)},
+        {GPA_HIDE_NAME_OFFSET(10913), GPA_HIDE_NAME_OFFSET(10924)},
+        {GPA_HIDE_NAME_OFFSET(10954), GPA_HIDE_NAME_OFFSET(10965)},
+        {GPA_HIDE_NAME_OFFSET(10995), GPA_HIDE_NAME_OFFSET(11006)},
+        {GPA_HIDE_NAME_OFFSET(11036), GPA_HIDE_NAME_OFFSET(11047)},
+        {GPA_HIDE_NAME_OFFSET(11077), GPA_HIDE_NAME_OFFSET(11088)},
+        {GPA_HIDE_NAME_OFFSET(11118), GPA_HIDE_NAME_OFFSET(11129)},
+        {GPA_HIDE_NAME_OFFSET(11159), GPA_HIDE_NAME_OFFSET(11170)},
+        {GPA_HIDE_NAME_OFFSET(11200), GPA_HIDE_NAME_OFFSET(11211)},
+        {GPA_HIDE_NAME_OFFSET(11241), GPA_HIDE_NAME_OFFSET(11252)},
+        {GPA_HIDE_NAME_OFFSET(11282), GPA_HIDE_NAME_OFFSET(11293)},
+        {GPA_HIDE_NAME_OFFSET(11323), GPA_HIDE_NAME_OFFSET(11334)},
+        {GPA_HIDE_NAME_OFFSET(11364), GPA_HIDE_NAME_OFFSET(11375)},
+        {GPA_HIDE_NAME_OFFSET(11405), GPA_HIDE_NAME_OFFSET(11416)},
+        {GPA_HIDE_NAME_OFFSET(11446), GPA_HIDE_NAME_OFFSET(11457)},
+        {GPA_HIDE_NAME_OFFSET(11487), GPA_HIDE_NAME_OFFSET(11498)},
+        {GPA_HIDE_NAME_OFFSET(11528), GPA_HIDE_NAME_OFFSET(11539)},
+        {GPA_HIDE_NAME_OFFSET(11569), GPA_HIDE_NAME_OFFSET(11580)},
+        {GPA_HIDE_NAME_OFFSET(11610), GPA_HIDE_NAME_OFFSET(11621)},
+        {GPA_HIDE_NAME_OFFSET(11651), GPA_HIDE_NAME_OFFSET(11662)},
+        {GPA_HIDE_NAME_OFFSET(11692), GPA_HIDE_NAME_OFFSET(11703)},
+        {GPA_HIDE_NAME_OFFSET(11733), GPA_HIDE_NAME_OFFSET(11744)},
+        {GPA_HIDE_NAME_OFFSET(11774), GPA_HIDE_NAME_OFFSET(11785)},
+        {GPA_HIDE_NAME_OFFSET(11815), GPA_HIDE_NAME_OFFSET(11826)},
+        {GPA_HIDE_NAME_OFFSET(11856), GPA_HIDE_NAME_OFFSET(11867)},
+        {GPA_HIDE_NAME_OFFSET(11897), GPA_HIDE_NAME_OFFSET(11908)},
+        {GPA_HIDE_NAME_OFFSET(11938), GPA_HIDE_NAME_OFFSET(11949)},
+        {GPA_HIDE_NAME_OFFSET(11979), GPA_HIDE_NAME_OFFSET(11990)},
+        {GPA_HIDE_NAME_OFFSET(12020), GPA_HIDE_NAME_OFFSET(12031)},
+        {GPA_HIDE_NAME_OFFSET(12061), GPA_HIDE_NAME_OFFSET(12072)},
+        {GPA_HIDE_NAME_OFFSET(12102), GPA_HIDE_NAME_OFFSET(12113)},
+        {GPA_HIDE_NAME_OFFSET(12143), GPA_HIDE_NAME_OFFSET(12154)},
+        {GPA_HIDE_NAME_OFFSET(12184), GPA_HIDE_NAME_OFFSET(12195)},
+        {GPA_HIDE_NAME_OFFSET(12225), GPA_HIDE_NAME_OFFSET(12236)},
+        {GPA_HIDE_NAME_OFFSET(12266), GPA_HIDE_NAME_OFFSET(12277)},
+        {GPA_HIDE_NAME_OFFSET(12307), GPA_HIDE_NAME_OFFSET(12318)},
+        {GPA_HIDE_NAME_OFFSET(12348), GPA_HIDE_NAME_OFFSET(12359)},
+        {GPA_HIDE_NAME_OFFSET(12389), GPA_HIDE_NAME_OFFSET(12400)},
+        {GPA_HIDE_NAME_OFFSET(12430), GPA_HIDE_NAME_OFFSET(12441)},
+        {GPA_HIDE_NAME_OFFSET(12471), GPA_HIDE_NAME_OFFSET(12482)},
+        {GPA_HIDE_NAME_OFFSET(12512), GPA_HIDE_NAME_OFFSET(12523)},
+        {GPA_HIDE_NAME_OFFSET(12553), GPA_HIDE_NAME_OFFSET(12564)},
+        {GPA_HIDE_NAME_OFFSET(12594), GPA_HIDE_NAME_OFFSET(12605)},
+        {GPA_HIDE_NAME_OFFSET(12635), GPA_HIDE_NAME_OFFSET(12646)},
+        {GPA_HIDE_NAME_OFFSET(12676), GPA_HIDE_NAME_OFFSET(12687)},
+        {GPA_HIDE_NAME_OFFSET(12717), GPA_HIDE_NAME_OFFSET(12728)},
+        {GPA_HIDE_NAME_OFFSET(12758), GPA_HIDE_NAME_OFFSET(12769)},
+        {GPA_HIDE_NAME_OFFSET(12799), GPA_HIDE_NAME_OFFSET(12810)},
+        {GPA_HIDE_NAME_OFFSET(12840), GPA_HIDE_NAME_OFFSET(12851)},
+        {GPA_HIDE_NAME_OFFSET(12881), GPA_HIDE_NAME_OFFSET(12892)},
+        {GPA_HIDE_NAME_OFFSET(12922), GPA_HIDE_NAME_OFFSET(12933)},
+        {GPA_HIDE_NAME_OFFSET(12963), GPA_HIDE_NAME_OFFSET(12974)},
+        {GPA_HIDE_NAME_OFFSET(13004), GPA_HIDE_NAME_OFFSET(13015)},
+        {GPA_HIDE_NAME_OFFSET(13045), GPA_HIDE_NAME_OFFSET(13056)},
+        {GPA_HIDE_NAME_OFFSET(13086), GPA_HIDE_NAME_OFFSET(13097)},
+        {GPA_HIDE_NAME_OFFSET(13127), GPA_HIDE_NAME_OFFSET(13138)},
+        {GPA_HIDE_NAME_OFFSET(13168), GPA_HIDE_NAME_OFFSET(13179)},
+        {GPA_HIDE_NAME_OFFSET(13209), GPA_HIDE_NAME_OFFSET(13220)},
+        {GPA_HIDE_NAME_OFFSET(13250), GPA_HIDE_NAME_OFFSET(13261)},
+        {GPA_HIDE_NAME_OFFSET(13291), GPA_HIDE_NAME_OFFSET(13302)},
+        {GPA_HIDE_NAME_OFFSET(13332), GPA_HIDE_NAME_OFFSET(13343)},
+        {GPA_HIDE_NAME_OFFSET(13373), GPA_HIDE_NAME_OFFSET(13384)},
+        {GPA_HIDE_NAME_OFFSET(13414), GPA_HIDE_NAME_OFFSET(13425)},
+        {GPA_HIDE_NAME_OFFSET(13455), GPA_HIDE_NAME_OFFSET(13466)},
+        {GPA_HIDE_NAME_OFFSET(13496), GPA_HIDE_NAME_OFFSET(13507)},
+        {GPA_HIDE_NAME_OFFSET(13537), GPA_HIDE_NAME_OFFSET(13548)},
+        {GPA_HIDE_NAME_OFFSET(13578), GPA_HIDE_NAME_OFFSET(13589)},
+        {GPA_HIDE_NAME_OFFSET(13619), GPA_HIDE_NAME_OFFSET(13630)},
+        {GPA_HIDE_NAME_OFFSET(13660), GPA_HIDE_NAME_OFFSET(13671)},
+        {GPA_HIDE_NAME_OFFSET(13701), GPA_HIDE_NAME_OFFSET(13712)},
+        {GPA_HIDE_NAME_OFFSET(13742), GPA_HIDE_NAME_OFFSET(13753)},
+        {GPA_HIDE_NAME_OFFSET(13783), GPA_HIDE_NAME_OFFSET(13794)},
+        {GPA_HIDE_NAME_OFFSET(13824), GPA_HIDE_NAME_OFFSET(13835)},
+        {GPA_HIDE_NAME_OFFSET(13865), GPA_HIDE_NAME_OFFSET(13876)},
+        {GPA_HIDE_NAME_OFFSET(13906), GPA_HIDE_NAME_OFFSET(13917)},
+        {GPA_HIDE_NAME_OFFSET(13947), GPA_HIDE_NAME_OFFSET(13958)},
+        {GPA_HIDE_NAME_OFFSET(13988), GPA_HIDE_NAME_OFFSET(13999)},
+        {GPA_HIDE_NAME_OFFSET(14029), GPA_HIDE_NAME_OFFSET(14040)},
+        {GPA_HIDE_NAME_OFFSET(14070), GPA_HIDE_NAME_OFFSET(14081)},
+        {GPA_HIDE_NAME_OFFSET(14111), GPA_HIDE_NAME_OFFSET(14122)},
+        {GPA_HIDE_NAME_OFFSET(14152), GPA_HIDE_NAME_OFFSET(14163)},
+        {GPA_HIDE_NAME_OFFSET(14193), GPA_HIDE_NAME_OFFSET(14204)},
+        {GPA_HIDE_NAME_OFFSET(14234), GPA_HIDE_NAME_OFFSET(14245)},
+        {GPA_HIDE_NAME_OFFSET(14275), GPA_HIDE_NAME_OFFSET(14286)},
+        {GPA_HIDE_NAME_OFFSET(14316), GPA_HIDE_NAME_OFFSET(14327)},
+        {GPA_HIDE_NAME_OFFSET(14357), GPA_HIDE_NAME_OFFSET(14368)},
+        {GPA_HIDE_NAME_OFFSET(14398), GPA_HIDE_NAME_OFFSET(14409)},
+        {GPA_HIDE_NAME_OFFSET(14439), GPA_HIDE_NAME_OFFSET(14450)},
+        {GPA_HIDE_NAME_OFFSET(14480), GPA_HIDE_NAME_OFFSET(14491)},
+        {GPA_HIDE_NAME_OFFSET(14521), GPA_HIDE_NAME_OFFSET(14532)},
+        {GPA_HIDE_NAME_OFFSET(14562), GPA_HIDE_NAME_OFFSET(14573)},
+        {GPA_HIDE_NAME_OFFSET(14603), GPA_HIDE_NAME_OFFSET(14614)},
+        {GPA_HIDE_NAME_OFFSET(14644), GPA_HIDE_NAME_OFFSET(14655)},
+        {GPA_HIDE_NAME_OFFSET(14685), GPA_HIDE_NAME_OFFSET(14696)},
+        {GPA_HIDE_NAME_OFFSET(14726), GPA_HIDE_NAME_OFFSET(14737)},
+        {GPA_HIDE_NAME_OFFSET(14767), GPA_HIDE_NAME_OFFSET(14778)},
+        {GPA_HIDE_NAME_OFFSET(14808), GPA_HIDE_NAME_OFFSET(14819)},
+        {GPA_HIDE_NAME_OFFSET(14849), GPA_HIDE_NAME_OFFSET(14860)},
+        {GPA_HIDE_NAME_OFFSET(14890), GPA_HIDE_NAME_OFFSET(14901)},
+        {GPA_HIDE_NAME_OFFSET(14931), GPA_HIDE_NAME_OFFSET(14942)},
+        {GPA_HIDE_NAME_OFFSET(14972), GPA_HIDE_NAME_OFFSET(14983)},
+        {GPA_HIDE_NAME_OFFSET(15013), GPA_HIDE_NAME_OFFSET(15024)},
+        {GPA_HIDE_NAME_OFFSET(15054), GPA_HIDE_NAME_OFFSET(15065)},
+        {GPA_HIDE_NAME_OFFSET(15095), GPA_HIDE_NAME_OFFSET(15106)},
+        {GPA_HIDE_NAME_OFFSET(15136), GPA_HIDE_NAME_OFFSET(15147)},
+        {GPA_HIDE_NAME_OFFSET(15177), GPA_HIDE_NAME_OFFSET(15188)},
+        {GPA_HIDE_NAME_OFFSET(15218), GPA_HIDE_NAME_OFFSET(15229)},
+        {GPA_HIDE_NAME_OFFSET(15259), GPA_HIDE_NAME_OFFSET(15270)},
+        {GPA_HIDE_NAME_OFFSET(15300), GPA_HIDE_NAME_OFFSET(15311)},
+        {GPA_HIDE_NAME_OFFSET(15341), GPA_HIDE_NAME_OFFSET(15352)},
+        {GPA_HIDE_NAME_OFFSET(15382), GPA_HIDE_NAME_OFFSET(15393)},
+        {GPA_HIDE_NAME_OFFSET(15423), GPA_HIDE_NAME_OFFSET(15434)},
+        {GPA_HIDE_NAME_OFFSET(15464), GPA_HIDE_NAME_OFFSET(15475)},
+        {GPA_HIDE_NAME_OFFSET(15505), GPA_HIDE_NAME_OFFSET(15516)},
+        {GPA_HIDE_NAME_OFFSET(15546), GPA_HIDE_NAME_OFFSET(15557)},
+        {GPA_HIDE_NAME_OFFSET(15587), GPA_HIDE_NAME_OFFSET(15598)},
+        {GPA_HIDE_NAME_OFFSET(15628), GPA_HIDE_NAME_OFFSET(15639)},
+        {GPA_HIDE_NAME_OFFSET(15669), GPA_HIDE_NAME_OFFSET(15680)},
+        {GPA_HIDE_NAME_OFFSET(15710), GPA_HIDE_NAME_OFFSET(15721)},
+        {GPA_HIDE_NAME_OFFSET(15751), GPA_HIDE_NAME_OFFSET(15762)},
+        {GPA_HIDE_NAME_OFFSET(15792), GPA_HIDE_NAME_OFFSET(15803)},
+        {GPA_HIDE_NAME_OFFSET(15833), GPA_HIDE_NAME_OFFSET(15844)},
+        {GPA_HIDE_NAME_OFFSET(15874), GPA_HIDE_NAME_OFFSET(15885)},
+        {GPA_HIDE_NAME_OFFSET(15915), GPA_HIDE_NAME_OFFSET(15926)},
+        {GPA_HIDE_NAME_OFFSET(15956), GPA_HIDE_NAME_OFFSET(15967)},
+        {GPA_HIDE_NAME_OFFSET(15997), GPA_HIDE_NAME_OFFSET(16008)},
+        {GPA_HIDE_NAME_OFFSET(16038), GPA_HIDE_NAME_OFFSET(16049)},
+        {GPA_HIDE_NAME_OFFSET(16079), GPA_HIDE_NAME_OFFSET(16090)},
+        {GPA_HIDE_NAME_OFFSET(16120), GPA_HIDE_NAME_OFFSET(16131)},
+        {GPA_HIDE_NAME_OFFSET(16161), GPA_HIDE_NAME_OFFSET(16172)},
+        {GPA_HIDE_NAME_OFFSET(16202), GPA_HIDE_NAME_OFFSET(16213)},
+        {GPA_HIDE_NAME_OFFSET(16243), GPA_HIDE_NAME_OFFSET(16254)},
+        {GPA_HIDE_NAME_OFFSET(16284), GPA_HIDE_NAME_OFFSET(16295)},
+        {GPA_HIDE_NAME_OFFSET(16325), GPA_HIDE_NAME_OFFSET(16336)},
+        {GPA_HIDE_NAME_OFFSET(16366), GPA_HIDE_NAME_OFFSET(16377)},
+        {GPA_HIDE_NAME_OFFSET(16407), GPA_HIDE_NAME_OFFSET(16418)},
+        {GPA_HIDE_NAME_OFFSET(16448), GPA_HIDE_NAME_OFFSET(16459)},
+        {GPA_HIDE_NAME_OFFSET(16489), GPA_HIDE_NAME_OFFSET(16500)},
+        {GPA_HIDE_NAME_OFFSET(16530), GPA_HIDE_NAME_OFFSET(16541)},
+        {GPA_HIDE_NAME_OFFSET(16571), GPA_HIDE_NAME_OFFSET(16582)},
+        {GPA_HIDE_NAME_OFFSET(16612), GPA_HIDE_NAME_OFFSET(16623)},
+        {GPA_HIDE_NAME_OFFSET(16653), GPA_HIDE_NAME_OFFSET(16664)},
+        {GPA_HIDE_NAME_OFFSET(16694), GPA_HIDE_NAME_OFFSET(16705)},
+        {GPA_HIDE_NAME_OFFSET(16735), GPA_HIDE_NAME_OFFSET(16746)},
+        {GPA_HIDE_NAME_OFFSET(16776), GPA_HIDE_NAME_OFFSET(16787)},
+        {GPA_HIDE_NAME_OFFSET(16817), GPA_HIDE_NAME_OFFSET(16828)},
+        {GPA_HIDE_NAME_OFFSET(16858), GPA_HIDE_NAME_OFFSET(16869)},
+        {GPA_HIDE_NAME_OFFSET(16899), GPA_HIDE_NAME_OFFSET(16910)},
+        {GPA_HIDE_NAME_OFFSET(16940), GPA_HIDE_NAME_OFFSET(16951)},
+        {GPA_HIDE_NAME_OFFSET(16981), GPA_HIDE_NAME_OFFSET(16992)},
+        {GPA_HIDE_NAME_OFFSET(17022), GPA_HIDE_NAME_OFFSET(17033)},
+        {GPA_HIDE_NAME_OFFSET(17063), GPA_HIDE_NAME_OFFSET(17074)},
+        {GPA_HIDE_NAME_OFFSET(17104), GPA_HIDE_NAME_OFFSET(17115)},
+        {GPA_HIDE_NAME_OFFSET(17145), GPA_HIDE_NAME_OFFSET(17156)},
+        {GPA_HIDE_NAME_OFFSET(17186), GPA_HIDE_NAME_OFFSET(17197)},
+        {GPA_HIDE_NAME_OFFSET(17227), GPA_HIDE_NAME_OFFSET(17238)},
+        {GPA_HIDE_NAME_OFFSET(17268), GPA_HIDE_NAME_OFFSET(17279)},
+        {GPA_HIDE_NAME_OFFSET(17309), GPA_HIDE_NAME_OFFSET(17320)},
+        {GPA_HIDE_NAME_OFFSET(17350), GPA_HIDE_NAME_OFFSET(17361)},
+        {GPA_HIDE_NAME_OFFSET(17391), GPA_HIDE_NAME_OFFSET(17402)},
     };
-    GPA_HardwareCounterDesc gcea13_counters_gfx9_placeholder4[] = {
-        {0, GPA_HIDE_NAME("GCEA13_000"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 0 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {1, GPA_HIDE_NAME("GCEA13_001"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 1 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {2, GPA_HIDE_NAME("GCEA13_002"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 2 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {3, GPA_HIDE_NAME("GCEA13_003"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 3 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {4, GPA_HIDE_NAME("GCEA13_004"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 4 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {5, GPA_HIDE_NAME("GCEA13_005"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 5 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {6, GPA_HIDE_NAME("GCEA13_006"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 6 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {7, GPA_HIDE_NAME("GCEA13_007"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 7 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {8, GPA_HIDE_NAME("GCEA13_008"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 8 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {9, GPA_HIDE_NAME("GCEA13_009"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 9 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {10, GPA_HIDE_NAME("GCEA13_010"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 10 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {11, GPA_HIDE_NAME("GCEA13_011"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 11 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {12, GPA_HIDE_NAME("GCEA13_012"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 12 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {13, GPA_HIDE_NAME("GCEA13_013"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 13 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {14, GPA_HIDE_NAME("GCEA13_014"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 14 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {15, GPA_HIDE_NAME("GCEA13_015"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 15 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {16, GPA_HIDE_NAME("GCEA13_016"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 16 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {17, GPA_HIDE_NAME("GCEA13_017"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 17 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {18, GPA_HIDE_NAME("GCEA13_018"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 18 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {19, GPA_HIDE_NAME("GCEA13_019"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 19 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {20, GPA_HIDE_NAME("GCEA13_020"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 20 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {21, GPA_HIDE_NAME("GCEA13_021"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 21 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {22, GPA_HIDE_NAME("GCEA13_022"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 22 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {23, GPA_HIDE_NAME("GCEA13_023"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 23 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {24, GPA_HIDE_NAME("GCEA13_024"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 24 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {25, GPA_HIDE_NAME("GCEA13_025"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 25 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {26, GPA_HIDE_NAME("GCEA13_026"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 26 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {27, GPA_HIDE_NAME("GCEA13_027"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 27 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {28, GPA_HIDE_NAME("GCEA13_028"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 28 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {29, GPA_HIDE_NAME("GCEA13_029"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 29 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {30, GPA_HIDE_NAME("GCEA13_030"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 30 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {31, GPA_HIDE_NAME("GCEA13_031"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 31 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {32, GPA_HIDE_NAME("GCEA13_032"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 32 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {33, GPA_HIDE_NAME("GCEA13_033"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 33 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {34, GPA_HIDE_NAME("GCEA13_034"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 34 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {35, GPA_HIDE_NAME("GCEA13_035"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 35 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {36, GPA_HIDE_NAME("GCEA13_036"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 36 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {37, GPA_HIDE_NAME("GCEA13_037"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 37 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {38, GPA_HIDE_NAME("GCEA13_038"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 38 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {39, GPA_HIDE_NAME("GCEA13_039"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 39 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {40, GPA_HIDE_NAME("GCEA13_040"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 40 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {41, GPA_HIDE_NAME("GCEA13_041"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 41 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {42, GPA_HIDE_NAME("GCEA13_042"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 42 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {43, GPA_HIDE_NAME("GCEA13_043"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 43 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {44, GPA_HIDE_NAME("GCEA13_044"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 44 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {45, GPA_HIDE_NAME("GCEA13_045"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 45 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {46, GPA_HIDE_NAME("GCEA13_046"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 46 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {47, GPA_HIDE_NAME("GCEA13_047"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 47 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {48, GPA_HIDE_NAME("GCEA13_048"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 48 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {49, GPA_HIDE_NAME("GCEA13_049"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 49 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {50, GPA_HIDE_NAME("GCEA13_050"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 50 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {51, GPA_HIDE_NAME("GCEA13_051"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 51 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {52, GPA_HIDE_NAME("GCEA13_052"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 52 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {53, GPA_HIDE_NAME("GCEA13_053"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 53 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {54, GPA_HIDE_NAME("GCEA13_054"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 54 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {55, GPA_HIDE_NAME("GCEA13_PERF_SEL_SARB_DRAM_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("DRAM sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {56, GPA_HIDE_NAME("GCEA13_056"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 56 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {57, GPA_HIDE_NAME("GCEA13_PERF_SEL_SARB_IO_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("I/O sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {58, GPA_HIDE_NAME("GCEA13_058"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 58 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {59, GPA_HIDE_NAME("GCEA13_059"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 59 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {60, GPA_HIDE_NAME("GCEA13_060"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 60 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {61, GPA_HIDE_NAME("GCEA13_061"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 61 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {62, GPA_HIDE_NAME("GCEA13_062"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 62 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {63, GPA_HIDE_NAME("GCEA13_063"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 63 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {64, GPA_HIDE_NAME("GCEA13_064"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 64 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {65, GPA_HIDE_NAME("GCEA13_065"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 65 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {66, GPA_HIDE_NAME("GCEA13_066"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 66 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {67, GPA_HIDE_NAME("GCEA13_067"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 67 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {68, GPA_HIDE_NAME("GCEA13_068"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 68 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {69, GPA_HIDE_NAME("GCEA13_069"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 69 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {70, GPA_HIDE_NAME("GCEA13_070"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 70 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {71, GPA_HIDE_NAME("GCEA13_071"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 71 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {72, GPA_HIDE_NAME("GCEA13_072"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 72 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {73, GPA_HIDE_NAME("GCEA13_073"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 73 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {74, GPA_HIDE_NAME("GCEA13_074"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 74 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {75, GPA_HIDE_NAME("GCEA13_075"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 75 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {76, GPA_HIDE_NAME("GCEA13_076"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 76 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {77, GPA_HIDE_NAME("GCEA13_077"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 77 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {78, GPA_HIDE_NAME("GCEA13_078"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 78 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {79, GPA_HIDE_NAME("GCEA13_079"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 79 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {80, GPA_HIDE_NAME("GCEA13_080"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 80 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {81, GPA_HIDE_NAME("GCEA13_081"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 81 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {82, GPA_HIDE_NAME("GCEA13_082"), GPA_HIDE_NAME("GCEA13"), GPA_HIDE_NAME("Counter 82 from group GCEA13"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
+
+    const GPA_HardwareBlockDesc pa_su_block_gfx9_placeholder4 = {pa_su_strings_gfx9_placeholder4, GPA_HIDE_NAME_OFFSET(1), 4, 351, pa_su_block_counters_gfx9_placeholder4};
+
+    /// String pool of the pa_sc block for gfx9_placeholder4 family
+    const char pa_sc_strings_gfx9_placeholder4[] = GPA_HIDE_NAME(
+        "\0"
+        "PA_SC#\0"
+        "PA_SC#_000\0"
+        "Counter 0 from group PA_SC#\0"
+        "PA_SC#_001\0"
+        "Counter 1 from group PA_SC#\0"
+        "PA_SC#_002\0"
+        "Counter 2 from group PA_SC#\0"
+        "PA_SC#_003\0"
+        "Counter 3 from group PA_SC#\0"
+        "PA_SC#_004\0"
+        "Counter 4 from group PA_SC#\0"
+        "PA_SC#_005\0"
+        "Counter 5 from group PA_SC#\0"
+        "PA_SC#_006\0"
+        "Counter 6 from group PA_SC#\0"
+        "PA_SC#_007\0"
+        "Counter 7 from group PA_SC#\0"
+        "PA_SC#_008\0"
+        "Counter 8 from group PA_SC#\0"
+        "PA_SC#_009\0"
+        "Counter 9 from group PA_SC#\0"
+        "PA_SC#_010\0"
+        "Counter 10 from group PA_SC#\0"
+        "PA_SC#_011\0"
+        "Counter 11 from group PA_SC#\0"
+        "PA_SC#_012\0"
+        "Counter 12 from group PA_SC#\0"
+        "PA_SC#_013\0"
+        "Counter 13 from group PA_SC#\0"
+        "PA_SC#_014\0"
+        "Counter 14 from group PA_SC#\0"
+        "PA_SC#_015\0"
+        "Counter 15 from group PA_SC#\0"
+        "PA_SC#_016\0"
+        "Counter 16 from group PA_SC#\0"
+        "PA_SC#_017\0"
+        "Counter 17 from group PA_SC#\0"
+        "PA_SC#_018\0"
+        "Counter 18 from group PA_SC#\0"
+        "PA_SC#_019\0"
+        "Counter 19 from group PA_SC#\0"
+        "PA_SC#_020\0"
+        "Counter 20 from group PA_SC#\0"
+        "PA_SC#_021\0"
+        "Counter 21 from group PA_SC#\0"
+        "PA_SC#_022\0"
+        "Counter 22 from group PA_SC#\0"
+        "PA_SC#_023\0"
+        "Counter 23 from group PA_SC#\0"
+        "PA_SC#_024\0"
+        "Counter 24 from group PA_SC#\0"
+        "PA_SC#_025\0"
+        "Counter 25 from group PA_SC#\0"
+        "PA_SC#_026\0"
+        "Counter 26 from group PA_SC#\0"
+        "PA_SC#_027\0"
+        "Counter 27 from group PA_SC#\0"
+        "PA_SC#_028\0"
+        "Counter 28 from group PA_SC#\0"
+        "PA_SC#_029\0"
+        "Counter 29 from group PA_SC#\0"
+        "PA_SC#_030\0"
+        "Counter 30 from group PA_SC#\0"
+        "PA_SC#_031\0"
+        "Counter 31 from group PA_SC#\0"
+        "PA_SC#_032\0"
+        "Counter 32 from group PA_SC#\0"
+        "PA_SC#_033\0"
+        "Counter 33 from group PA_SC#\0"
+        "PA_SC#_034\0"
+        "Counter 34 from group PA_SC#\0"
+        "PA_SC#_035\0"
+        "Counter 35 from group PA_SC#\0"
+        "PA_SC#_036\0"
+        "Counter 36 from group PA_SC#\0"
+        "PA_SC#_037\0"
+        "Counter 37 from group PA_SC#\0"
+        "PA_SC#_038\0"
+        "Counter 38 from group PA_SC#\0"
+        "PA_SC#_039\0"
+        "Counter 39 from group PA_SC#\0"
+        "PA_SC#_040\0"
+        "Counter 40 from group PA_SC#\0"
+        "PA_SC#_041\0"
+        "Counter 41 from group PA_SC#\0"
+        "PA_SC#_042\0"
+        "Counter 42 from group PA_SC#\0"
+        "PA_SC#_043\0"
+        "Counter 43 from group PA_SC#\0"
+        "PA_SC#_044\0"
+        "Counter 44 from group PA_SC#\0"
+        "PA_SC#_045\0"
+        "Counter 45 from group PA_SC#\0"
+        "PA_SC#_046\0"
+        "Counter 46 from group PA_SC#\0"
+        "PA_SC#_047\0"
+        "Counter 47 from group PA_SC#\0"
+        "PA_SC#_048\0"
+        "Counter 48 from group PA_SC#\0"
+        "PA_SC#_049\0"
+        "Counter 49 from group PA_SC#\0"
+        "PA_SC#_050\0"
+        "Counter 50 from group PA_SC#\0"
+        "PA_SC#_051\0"
+        "Counter 51 from group PA_SC#\0"
+        "PA_SC#_052\0"
+        "Counter 52 from group PA_SC#\0"
+        "PA_SC#_053\0"
+        "Counter 53 from group PA_SC#\0"
+        "PA_SC#_054\0"
+        "Counter 54 from group PA_SC#\0"
+        "PA_SC#_055\0"
+        "Counter 55 from group PA_SC#\0"
+        "PA_SC#_056\0"
+        "Counter 56 from group PA_SC#\0"
+        "PA_SC#_057\0"
+        "Counter 57 from group PA_SC#\0"
+        "PA_SC#_058\0"
+        "Counter 58 from group PA_SC#\0"
+        "PA_SC#_059\0"
+        "Counter 59 from group PA_SC#\0"
+        "PA_SC#_060\0"
+        "Counter 60 from group PA_SC#\0"
+        "PA_SC#_061\0"
+        "Counter 61 from group PA_SC#\0"
+        "PA_SC#_062\0"
+        "Counter 62 from group PA_SC#\0"
+        "PA_SC#_063\0"
+        "Counter 63 from group PA_SC#\0"
+        "PA_SC#_064\0"
+        "Counter 64 from group PA_SC#\0"
+        "PA_SC#_065\0"
+        "Counter 65 from group PA_SC#\0"
+        "PA_SC#_066\0"
+        "Counter 66 from group PA_SC#\0"
+        "PA_SC#_067\0"
+        "Counter 67 from group PA_SC#\0"
+        "PA_SC#_068\0"
+        "Counter 68 from group PA_SC#\0"
+        "PA_SC#_069\0"
+        "Counter 69 from group PA_SC#\0"
+        "PA_SC#_070\0"
+        "Counter 70 from group PA_SC#\0"
+        "PA_SC#_071\0"
+        "Counter 71 from group PA_SC#\0"
+        "PA_SC#_072\0"
+        "Counter 72 from group PA_SC#\0"
+        "PA_SC#_073\0"
+        "Counter 73 from group PA_SC#\0"
+        "PA_SC#_074\0"
+        "Counter 74 from group PA_SC#\0"
+        "PA_SC#_075\0"
+        "Counter 75 from group PA_SC#\0"
+        "PA_SC#_076\0"
+        "Counter 76 from group PA_SC#\0"
+        "PA_SC#_077\0"
+        "Counter 77 from group PA_SC#\0"
+        "PA_SC#_078\0"
+        "Counter 78 from group PA_SC#\0"
+        "PA_SC#_079\0"
+        "Counter 79 from group PA_SC#\0"
+        "PA_SC#_080\0"
+        "Counter 80 from group PA_SC#\0"
+        "PA_SC#_081\0"
+        "Counter 81 from group PA_SC#\0"
+        "PA_SC#_082\0"
+        "Counter 82 from group PA_SC#\0"
+        "PA_SC#_083\0"
+        "Counter 83 from group PA_SC#\0"
+        "PA_SC#_084\0"
+        "Counter 84 from group PA_SC#\0"
+        "PA_SC#_085\0"
+        "Counter 85 from group PA_SC#\0"
+        "PA_SC#_086\0"
+        "Counter 86 from group PA_SC#\0"
+        "PA_SC#_087\0"
+        "Counter 87 from group PA_SC#\0"
+        "PA_SC#_088\0"
+        "Counter 88 from group PA_SC#\0"
+        "PA_SC#_089\0"
+        "Counter 89 from group PA_SC#\0"
+        "PA_SC#_090\0"
+        "Counter 90 from group PA_SC#\0"
+        "PA_SC#_091\0"
+        "Counter 91 from group PA_SC#\0"
+        "PA_SC#_092\0"
+        "Counter 92 from group PA_SC#\0"
+        "PA_SC#_093\0"
+        "Counter 93 from group PA_SC#\0"
+        "PA_SC#_094\0"
+        "Counter 94 from group PA_SC#\0"
+        "PA_SC#_095\0"
+        "Counter 95 from group PA_SC#\0"
+        "PA_SC#_096\0"
+        "Counter 96 from group PA_SC#\0"
+        "PA_SC#_097\0"
+        "Counter 97 from group PA_SC#\0"
+        "PA_SC#_098\0"
+        "Counter 98 from group PA_SC#\0"
+        "PA_SC#_099\0"
+        "Counter 99 from group PA_SC#\0"
+        "PA_SC#_100\0"
+        "Counter 100 from group PA_SC#\0"
+        "PA_SC#_101\0"
+        "Counter 101 from group PA_SC#\0"
+        "PA_SC#_102\0"
+        "Counter 102 from group PA_SC#\0"
+        "PA_SC#_103\0"
+        "Counter 103 from group PA_SC#\0"
+        "PA_SC#_104\0"
+        "Counter 104 from group PA_SC#\0"
+        "PA_SC#_105\0"
+        "Counter 105 from group PA_SC#\0"
+        "PA_SC#_106\0"
+        "Counter 106 from group PA_SC#\0"
+        "PA_SC#_107\0"
+        "Counter 107 from group PA_SC#\0"
+        "PA_SC#_108\0"
+        "Counter 108 from group PA_SC#\0"
+        "PA_SC#_109\0"
+        "Counter 109 from group PA_SC#\0"
+        "PA_SC#_110\0"
+        "Counter 110 from group PA_SC#\0"
+        "PA_SC#_111\0"
+        "Counter 111 from group PA_SC#\0"
+        "PA_SC#_112\0"
+        "Counter 112 from group PA_SC#\0"
+        "PA_SC#_113\0"
+        "Counter 113 from group PA_SC#\0"
+        "PA_SC#_114\0"
+        "Counter 114 from group PA_SC#\0"
+        "PA_SC#_115\0"
+        "Counter 115 from group PA_SC#\0"
+        "PA_SC#_116\0"
+        "Counter 116 from group PA_SC#\0"
+        "PA_SC#_117\0"
+        "Counter 117 from group PA_SC#\0"
+        "PA_SC#_118\0"
+        "Counter 118 from group PA_SC#\0"
+        "PA_SC#_119\0"
+        "Counter 119 from group PA_SC#\0"
+        "PA_SC#_120\0"
+        "Counter 120 from group PA_SC#\0"
+        "PA_SC#_121\0"
+        "Counter 121 from group PA_SC#\0"
+        "PA_SC#_122\0"
+        "Counter 122 from group PA_SC#\0"
+        "PA_SC#_123\0"
+        "Counter 123 from group PA_SC#\0"
+        "PA_SC#_124\0"
+        "Counter 124 from group PA_SC#\0"
+        "PA_SC#_125\0"
+        "Counter 125 from group PA_SC#\0"
+        "PA_SC#_126\0"
+        "Counter 126 from group PA_SC#\0"
+        "PA_SC#_127\0"
+        "Counter 127 from group PA_SC#\0"
+        "PA_SC#_128\0"
+        "Counter 128 from group PA_SC#\0"
+        "PA_SC#_129\0"
+        "Counter 129 from group PA_SC#\0"
+        "PA_SC#_130\0"
+        "Counter 130 from group PA_SC#\0"
+        "PA_SC#_131\0"
+        "Counter 131 from group PA_SC#\0"
+        "PA_SC#_132\0"
+        "Counter 132 from group PA_SC#\0"
+        "PA_SC#_133\0"
+        "Counter 133 from group PA_SC#\0"
+        "PA_SC#_134\0"
+        "Counter 134 from group PA_SC#\0"
+        "PA_SC#_135\0"
+        "Counter 135 from group PA_SC#\0"
+        "PA_SC#_136\0"
+        "Counter 136 from group PA_SC#\0"
+        "PA_SC#_137\0"
+        "Counter 137 from group PA_SC#\0"
+        "PA_SC#_138\0"
+        "Counter 138 from group PA_SC#\0"
+        "PA_SC#_139\0"
+        "Counter 139 from group PA_SC#\0"
+        "PA_SC#_140\0"
+        "Counter 140 from group PA_SC#\0"
+        "PA_SC#_141\0"
+        "Counter 141 from group PA_SC#\0"
+        "PA_SC#_142\0"
+        "Counter 142 from group PA_SC#\0"
+        "PA_SC#_143\0"
+        "Counter 143 from group PA_SC#\0"
+        "PA_SC#_144\0"
+        "Counter 144 from group PA_SC#\0"
+        "PA_SC#_145\0"
+        "Counter 145 from group PA_SC#\0"
+        "PA_SC#_146\0"
+        "Counter 146 from group PA_SC#\0"
+        "PA_SC#_147\0"
+        "Counter 147 from group PA_SC#\0"
+        "PA_SC#_148\0"
+        "Counter 148 from group PA_SC#\0"
+        "PA_SC#_149\0"
+        "Counter 149 from group PA_SC#\0"
+        "PA_SC#_150\0"
+        "Counter 150 from group PA_SC#\0"
+        "PA_SC#_151\0"
+        "Counter 151 from group PA_SC#\0"
+        "PA_SC#_152\0"
+        "Counter 152 from group PA_SC#\0"
+        "PA_SC#_153\0"
+        "Counter 153 from group PA_SC#\0"
+        "PA_SC#_154\0"
+        "Counter 154 from group PA_SC#\0"
+        "PA_SC#_155\0"
+        "Counter 155 from group PA_SC#\0"
+        "PA_SC#_156\0"
+        "Counter 156 from group PA_SC#\0"
+        "PA_SC#_157\0"
+        "Counter 157 from group PA_SC#\0"
+        "PA_SC#_158\0"
+        "Counter 158 from group PA_SC#\0"
+        "PA_SC#_QZ0_QUAD_COUNT\0"
+        "quad count; quad-z pipe 0;Where measured: sc sc_qdmsk_z output to sc_z_interp in db pipe 0;increment rate-one to 16  per clock;range-1/clk;CONTEXT_STATE_SENSITIVE=YES;Results reported per SE, INSTANCE_INDEX=0 to num_packer_per_sc-1.\0"
+        "PA_SC#_QZ1_QUAD_COUNT\0"
+        "quad count; quad-z pipe 1;Where measured: sc sc_qdmsk_z output to sc_z_interp in db pipe 1;increment rate-one to 16 per clock;range-1/clk;CONTEXT_STATE_SENSITIVE=YES;Results reported per SE, INSTANCE_INDEX=0 to num_packer_per_sc-1. Valid only if NUM_DB_PER_PACKER=2\0"
+        "PA_SC#_QZ2_QUAD_COUNT\0"
+        "quad count; quad-z pipe 2 DEPRECATED (NUM_DB_PER_PACKER=4 variants only)\0"
+        "PA_SC#_QZ3_QUAD_COUNT\0"
+        "quad count; quad-z pipe 3 DEPRECATED (NUM_DB_PER_PACKER=4 variants only)\0"
+        "PA_SC#_163\0"
+        "Counter 163 from group PA_SC#\0"
+        "PA_SC#_164\0"
+        "Counter 164 from group PA_SC#\0"
+        "PA_SC#_165\0"
+        "Counter 165 from group PA_SC#\0"
+        "PA_SC#_166\0"
+        "Counter 166 from group PA_SC#\0"
+        "PA_SC#_167\0"
+        "Counter 167 from group PA_SC#\0"
+        "PA_SC#_168\0"
+        "Counter 168 from group PA_SC#\0"
+        "PA_SC#_169\0"
+        "Counter 169 from group PA_SC#\0"
+        "PA_SC#_170\0"
+        "Counter 170 from group PA_SC#\0"
+        "PA_SC#_171\0"
+        "Counter 171 from group PA_SC#\0"
+        "PA_SC#_172\0"
+        "Counter 172 from group PA_SC#\0"
+        "PA_SC#_173\0"
+        "Counter 173 from group PA_SC#\0"
+        "PA_SC#_174\0"
+        "Counter 174 from group PA_SC#\0"
+        "PA_SC#_175\0"
+        "Counter 175 from group PA_SC#\0"
+        "PA_SC#_176\0"
+        "Counter 176 from group PA_SC#\0"
+        "PA_SC#_177\0"
+        "Counter 177 from group PA_SC#\0"
+        "PA_SC#_178\0"
+        "Counter 178 from group PA_SC#\0"
+        "PA_SC#_179\0"
+        "Counter 179 from group PA_SC#\0"
+        "PA_SC#_180\0"
+        "Counter 180 from group PA_SC#\0"
+        "PA_SC#_181\0"
+        "Counter 181 from group PA_SC#\0"
+        "PA_SC#_182\0"
+        "Counter 182 from group PA_SC#\0"
+        "PA_SC#_183\0"
+        "Counter 183 from group PA_SC#\0"
+        "PA_SC#_184\0"
+        "Counter 184 from group PA_SC#\0"
+        "PA_SC#_185\0"
+        "Counter 185 from group PA_SC#\0"
+        "PA_SC#_186\0"
+        "Counter 186 from group PA_SC#\0"
+        "PA_SC#_187\0"
+        "Counter 187 from group PA_SC#\0"
+        "PA_SC#_188\0"
+        "Counter 188 from group PA_SC#\0"
+        "PA_SC#_189\0"
+        "Counter 189 from group PA_SC#\0"
+        "PA_SC#_190\0"
+        "Counter 190 from group PA_SC#\0"
+        "PA_SC#_191\0"
+        "Counter 191 from group PA_SC#\0"
+        "PA_SC#_192\0"
+        "Counter 192 from group PA_SC#\0"
+        "PA_SC#_193\0"
+        "Counter 193 from group PA_SC#\0"
+        "PA_SC#_194\0"
+        "Counter 194 from group PA_SC#\0"
+        "PA_SC#_195\0"
+        "Counter 195 from group PA_SC#\0"
+        "PA_SC#_196\0"
+        "Counter 196 from group PA_SC#\0"
+        "PA_SC#_197\0"
+        "Counter 197 from group PA_SC#\0"
+        "PA_SC#_198\0"
+        "Counter 198 from group PA_SC#\0"
+        "PA_SC#_199\0"
+        "Counter 199 from group PA_SC#\0"
+        "PA_SC#_200\0"
+        "Counter 200 from group PA_SC#\0"
+        "PA_SC#_201\0"
+        "Counter 201 from group PA_SC#\0"
+        "PA_SC#_202\0"
+        "Counter 202 from group PA_SC#\0"
+        "PA_SC#_203\0"
+        "Counter 203 from group PA_SC#\0"
+        "PA_SC#_204\0"
+        "Counter 204 from group PA_SC#\0"
+        "PA_SC#_205\0"
+        "Counter 205 from group PA_SC#\0"
+        "PA_SC#_206\0"
+        "Counter 206 from group PA_SC#\0"
+        "PA_SC#_207\0"
+        "Counter 207 from group PA_SC#\0"
+        "PA_SC#_208\0"
+        "Counter 208 from group PA_SC#\0"
+        "PA_SC#_209\0"
+        "Counter 209 from group PA_SC#\0"
+        "PA_SC#_210\0"
+        "Counter 210 from group PA_SC#\0"
+        "PA_SC#_211\0"
+        "Counter 211 from group PA_SC#\0"
+        "PA_SC#_212\0"
+        "Counter 212 from group PA_SC#\0"
+        "PA_SC#_213\0"
+        "Counter 213 from group PA_SC#\0"
+        "PA_SC#_214\0"
+        "Counter 214 from group PA_SC#\0"
+        "PA_SC#_215\0"
+        "Counter 215 from group PA_SC#\0"
+        "PA_SC#_216\0"
+        "Counter 216 from group PA_SC#\0"
+        "PA_SC#_217\0"
+        "Counter 217 from group PA_SC#\0"
+        "PA_SC#_218\0"
+        "Counter 218 from group PA_SC#\0"
+        "PA_SC#_219\0"
+        "Counter 219 from group PA_SC#\0"
+        "PA_SC#_220\0"
+        "Counter 220 from group PA_SC#\0"
+        "PA_SC#_221\0"
+        "Counter 221 from group PA_SC#\0"
+        "PA_SC#_222\0"
+        "Counter 222 from group PA_SC#\0"
+        "PA_SC#_223\0"
+        "Counter 223 from group PA_SC#\0"
+        "PA_SC#_224\0"
+        "Counter 224 from group PA_SC#\0"
+        "PA_SC#_225\0"
+        "Counter 225 from group PA_SC#\0"
+        "PA_SC#_226\0"
+        "Counter 226 from group PA_SC#\0"
+        "PA_SC#_227\0"
+        "Counter 227 from group PA_SC#\0"
+        "PA_SC#_228\0"
+        "Counter 228 from group PA_SC#\0"
+        "PA_SC#_229\0"
+        "Counter 229 from group PA_SC#\0"
+        "PA_SC#_230\0"
+        "Counter 230 from group PA_SC#\0"
+        "PA_SC#_231\0"
+        "Counter 231 from group PA_SC#\0"
+        "PA_SC#_232\0"
+        "Counter 232 from group PA_SC#\0"
+        "PA_SC#_233\0"
+        "Counter 233 from group PA_SC#\0"
+        "PA_SC#_234\0"
+        "Counter 234 from group PA_SC#\0"
+        "PA_SC#_P0_HIZ_QUAD_COUNT\0"
+        "total quads surviving hi-z; db pipe 0;Where measured: sc sc_quad_proc usc_tile_mask_return_fifo in db pipe 1;increment rate-one per clock;range-1/clk;CONTEXT_STATE_SENSITIVE=YES;Results reported per SE, INSTANCE_INDEX=0 to num_packer_per_sc-1;\0"
+        "PA_SC#_P1_HIZ_QUAD_COUNT\0"
+        "total quads surviving hi-z; db pipe 1;Where measured: sc sc_quad_proc usc_tile_mask_return_fifo in db pipe 1;increment rate-one per clock;range-1/clk;CONTEXT_STATE_SENSITIVE=YES;Results reported per SE, INSTANCE_INDEX=0 to num_packer_per_sc-1. Valid only if NUM_DB_PER_PACKER=2\0"
+        "PA_SC#_P2_HIZ_QUAD_COUNT\0"
+        "total quads surviving hi-z; db pipe 2 (DEPRECATED only valid for NUM_DB_PER_PACKER=4)\0"
+        "PA_SC#_P3_HIZ_QUAD_COUNT\0"
+        "total quads surviving hi-z; db pipe 3 (DEPRECATED only valid for NUM_DB_PER_PACKER=4)\0"
+        "PA_SC#_239\0"
+        "Counter 239 from group PA_SC#\0"
+        "PA_SC#_240\0"
+        "Counter 240 from group PA_SC#\0"
+        "PA_SC#_241\0"
+        "Counter 241 from group PA_SC#\0"
+        "PA_SC#_242\0"
+        "Counter 242 from group PA_SC#\0"
+        "PA_SC#_243\0"
+        "Counter 243 from group PA_SC#\0"
+        "PA_SC#_244\0"
+        "Counter 244 from group PA_SC#\0"
+        "PA_SC#_245\0"
+        "Counter 245 from group PA_SC#\0"
+        "PA_SC#_246\0"
+        "Counter 246 from group PA_SC#\0"
+        "PA_SC#_247\0"
+        "Counter 247 from group PA_SC#\0"
+        "PA_SC#_248\0"
+        "Counter 248 from group PA_SC#\0"
+        "PA_SC#_249\0"
+        "Counter 249 from group PA_SC#\0"
+        "PA_SC#_250\0"
+        "Counter 250 from group PA_SC#\0"
+        "PA_SC#_251\0"
+        "Counter 251 from group PA_SC#\0"
+        "PA_SC#_252\0"
+        "Counter 252 from group PA_SC#\0"
+        "PA_SC#_253\0"
+        "Counter 253 from group PA_SC#\0"
+        "PA_SC#_254\0"
+        "Counter 254 from group PA_SC#\0"
+        "PA_SC#_255\0"
+        "Counter 255 from group PA_SC#\0"
+        "PA_SC#_256\0"
+        "Counter 256 from group PA_SC#\0"
+        "PA_SC#_257\0"
+        "Counter 257 from group PA_SC#\0"
+        "PA_SC#_258\0"
+        "Counter 258 from group PA_SC#\0"
+        "PA_SC#_EARLYZ_QUAD_COUNT\0"
+        "total quads surviving early-z;Where measured: sc_tileaccum (sc_quadaccum if 1db per packer) inputs to packer;increment rate 1 to 2 quads per clock;range-1/clk;CONTEXT_STATE_SENSITIVE=YES;Results reported per SE, INSTANCE_INDEX=0 to num_packer_per_sc-1.\0"
+        "PA_SC#_260\0"
+        "Counter 260 from group PA_SC#\0"
+        "PA_SC#_261\0"
+        "Counter 261 from group PA_SC#\0"
+        "PA_SC#_262\0"
+        "Counter 262 from group PA_SC#\0"
+        "PA_SC#_263\0"
+        "Counter 263 from group PA_SC#\0"
+        "PA_SC#_264\0"
+        "Counter 264 from group PA_SC#\0"
+        "PA_SC#_265\0"
+        "Counter 265 from group PA_SC#\0"
+        "PA_SC#_266\0"
+        "Counter 266 from group PA_SC#\0"
+        "PA_SC#_267\0"
+        "Counter 267 from group PA_SC#\0"
+        "PA_SC#_268\0"
+        "Counter 268 from group PA_SC#\0"
+        "PA_SC#_269\0"
+        "Counter 269 from group PA_SC#\0"
+        "PA_SC#_270\0"
+        "Counter 270 from group PA_SC#\0"
+        "PA_SC#_271\0"
+        "Counter 271 from group PA_SC#\0"
+        "PA_SC#_272\0"
+        "Counter 272 from group PA_SC#\0"
+        "PA_SC#_273\0"
+        "Counter 273 from group PA_SC#\0"
+        "PA_SC#_274\0"
+        "Counter 274 from group PA_SC#\0"
+        "PA_SC#_275\0"
+        "Counter 275 from group PA_SC#\0"
+        "PA_SC#_276\0"
+        "Counter 276 from group PA_SC#\0"
+        "PA_SC#_277\0"
+        "Counter 277 from group PA_SC#\0"
+        "PA_SC#_278\0"
+        "Counter 278 from group PA_SC#\0"
+        "PA_SC#_279\0"
+        "Counter 279 from group PA_SC#\0"
+        "PA_SC#_280\0"
+        "Counter 280 from group PA_SC#\0"
+        "PA_SC#_281\0"
+        "Counter 281 from group PA_SC#\0"
+        "PA_SC#_282\0"
+        "Counter 282 from group PA_SC#\0"
+        "PA_SC#_283\0"
+        "Counter 283 from group PA_SC#\0"
+        "PA_SC#_284\0"
+        "Counter 284 from group PA_SC#\0"
+        "PA_SC#_285\0"
+        "Counter 285 from group PA_SC#\0"
+        "PA_SC#_286\0"
+        "Counter 286 from group PA_SC#\0"
+        "PA_SC#_287\0"
+        "Counter 287 from group PA_SC#\0"
+        "PA_SC#_288\0"
+        "Counter 288 from group PA_SC#\0"
+        "PA_SC#_289\0"
+        "Counter 289 from group PA_SC#\0"
+        "PA_SC#_290\0"
+        "Counter 290 from group PA_SC#\0"
+        "PA_SC#_291\0"
+        "Counter 291 from group PA_SC#\0"
+        "PA_SC#_292\0"
+        "Counter 292 from group PA_SC#\0"
+        "PA_SC#_293\0"
+        "Counter 293 from group PA_SC#\0"
+        "PA_SC#_294\0"
+        "Counter 294 from group PA_SC#\0"
+        "PA_SC#_295\0"
+        "Counter 295 from group PA_SC#\0"
+        "PA_SC#_296\0"
+        "Counter 296 from group PA_SC#\0"
+        "PA_SC#_297\0"
+        "Counter 297 from group PA_SC#\0"
+        "PA_SC#_298\0"
+        "Counter 298 from group PA_SC#\0"
+        "PA_SC#_299\0"
+        "Counter 299 from group PA_SC#\0"
+        "PA_SC#_300\0"
+        "Counter 300 from group PA_SC#\0"
+        "PA_SC#_301\0"
+        "Counter 301 from group PA_SC#\0"
+        "PA_SC#_302\0"
+        "Counter 302 from group PA_SC#\0"
+        "PA_SC#_303\0"
+        "Counter 303 from group PA_SC#\0"
+        "PA_SC#_304\0"
+        "Counter 304 from group PA_SC#\0"
+        "PA_SC#_305\0"
+        "Counter 305 from group PA_SC#\0"
+        "PA_SC#_306\0"
+        "Counter 306 from group PA_SC#\0"
+        "PA_SC#_307\0"
+        "Counter 307 from group PA_SC#\0"
+        "PA_SC#_308\0"
+        "Counter 308 from group PA_SC#\0"
+        "PA_SC#_309\0"
+        "Counter 309 from group PA_SC#\0"
+        "PA_SC#_310\0"
+        "Counter 310 from group PA_SC#\0"
+        "PA_SC#_311\0"
+        "Counter 311 from group PA_SC#\0"
+        "PA_SC#_312\0"
+        "Counter 312 from group PA_SC#\0"
+        "PA_SC#_313\0"
+        "Counter 313 from group PA_SC#\0"
+        "PA_SC#_314\0"
+        "Counter 314 from group PA_SC#\0"
+        "PA_SC#_315\0"
+        "Counter 315 from group PA_SC#\0"
+        "PA_SC#_316\0"
+        "Counter 316 from group PA_SC#\0"
+        "PA_SC#_317\0"
+        "Counter 317 from group PA_SC#\0"
+        "PA_SC#_318\0"
+        "Counter 318 from group PA_SC#\0"
+        "PA_SC#_319\0"
+        "Counter 319 from group PA_SC#\0"
+        "PA_SC#_320\0"
+        "Counter 320 from group PA_SC#\0"
+        "PA_SC#_321\0"
+        "Counter 321 from group PA_SC#\0"
+        "PA_SC#_322\0"
+        "Counter 322 from group PA_SC#\0"
+        "PA_SC#_323\0"
+        "Counter 323 from group PA_SC#\0"
+        "PA_SC#_324\0"
+        "Counter 324 from group PA_SC#\0"
+        "PA_SC#_325\0"
+        "Counter 325 from group PA_SC#\0"
+        "PA_SC#_326\0"
+        "Counter 326 from group PA_SC#\0"
+        "PA_SC#_327\0"
+        "Counter 327 from group PA_SC#\0"
+        "PA_SC#_328\0"
+        "Counter 328 from group PA_SC#\0"
+        "PA_SC#_329\0"
+        "Counter 329 from group PA_SC#\0"
+        "PA_SC#_330\0"
+        "Counter 330 from group PA_SC#\0"
+        "PA_SC#_331\0"
+        "Counter 331 from group PA_SC#\0"
+        "PA_SC#_332\0"
+        "Counter 332 from group PA_SC#\0"
+        "PA_SC#_333\0"
+        "Counter 333 from group PA_SC#\0"
+        "PA_SC#_334\0"
+        "Counter 334 from group PA_SC#\0"
+        "PA_SC#_335\0"
+        "Counter 335 from group PA_SC#\0"
+        "PA_SC#_336\0"
+        "Counter 336 from group PA_SC#\0"
+        "PA_SC#_337\0"
+        "Counter 337 from group PA_SC#\0"
+        "PA_SC#_338\0"
+        "Counter 338 from group PA_SC#\0"
+        "PA_SC#_339\0"
+        "Counter 339 from group PA_SC#\0"
+        "PA_SC#_340\0"
+        "Counter 340 from group PA_SC#\0"
+        "PA_SC#_341\0"
+        "Counter 341 from group PA_SC#\0"
+        "PA_SC#_342\0"
+        "Counter 342 from group PA_SC#\0"
+        "PA_SC#_343\0"
+        "Counter 343 from group PA_SC#\0"
+        "PA_SC#_344\0"
+        "Counter 344 from group PA_SC#\0"
+        "PA_SC#_345\0"
+        "Counter 345 from group PA_SC#\0"
+        "PA_SC#_346\0"
+        "Counter 346 from group PA_SC#\0"
+        "PA_SC#_347\0"
+        "Counter 347 from group PA_SC#\0"
+        "PA_SC#_348\0"
+        "Counter 348 from group PA_SC#\0"
+        "PA_SC#_349\0"
+        "Counter 349 from group PA_SC#\0"
+        "PA_SC#_350\0"
+        "Counter 350 from group PA_SC#\0"
+        "PA_SC#_351\0"
+        "Counter 351 from group PA_SC#\0"
+        "PA_SC#_352\0"
+        "Counter 352 from group PA_SC#\0"
+        "PA_SC#_353\0"
+        "Counter 353 from group PA_SC#\0"
+        "PA_SC#_354\0"
+        "Counter 354 from group PA_SC#\0"
+        "PA_SC#_355\0"
+        "Counter 355 from group PA_SC#\0"
+        "PA_SC#_356\0"
+        "Counter 356 from group PA_SC#\0"
+        "PA_SC#_357\0"
+        "Counter 357 from group PA_SC#\0"
+        "PA_SC#_358\0"
+        "Counter 358 from group PA_SC#\0"
+        "PA_SC#_359\0"
+        "Counter 359 from group PA_SC#\0"
+        "PA_SC#_360\0"
+        "Counter 360 from group PA_SC#\0"
+        "PA_SC#_361\0"
+        "Counter 361 from group PA_SC#\0"
+        "PA_SC#_362\0"
+        "Counter 362 from group PA_SC#\0"
+        "PA_SC#_363\0"
+        "Counter 363 from group PA_SC#\0"
+        "PA_SC#_364\0"
+        "Counter 364 from group PA_SC#\0"
+        "PA_SC#_365\0"
+        "Counter 365 from group PA_SC#\0"
+        "PA_SC#_366\0"
+        "Counter 366 from group PA_SC#\0"
+        "PA_SC#_367\0"
+        "Counter 367 from group PA_SC#\0"
+        "PA_SC#_368\0"
+        "Counter 368 from group PA_SC#\0"
+        "PA_SC#_369\0"
+        "Counter 369 from group PA_SC#\0"
+        "PA_SC#_370\0"
+        "Counter 370 from group PA_SC#\0"
+        "PA_SC#_371\0"
+        "Counter 371 from group PA_SC#\0"
+        "PA_SC#_372\0"
+        "Counter 372 from group PA_SC#\0"
+        "PA_SC#_373\0"
+        "Counter 373 from group PA_SC#\0"
+        "PA_SC#_374\0"
+        "Counter 374 from group PA_SC#\0"
+        "PA_SC#_375\0"
+        "Counter 375 from group PA_SC#\0"
+        "PA_SC#_376\0"
+        "Counter 376 from group PA_SC#\0"
+        "PA_SC#_377\0"
+        "Counter 377 from group PA_SC#\0"
+        "PA_SC#_378\0"
+        "Counter 378 from group PA_SC#\0"
+        "PA_SC#_379\0"
+        "Counter 379 from group PA_SC#\0"
+        "PA_SC#_380\0"
+        "Counter 380 from group PA_SC#\0"
+        "PA_SC#_381\0"
+        "Counter 381 from group PA_SC#\0"
+        "PA_SC#_382\0"
+        "Counter 382 from group PA_SC#\0"
+        "PA_SC#_383\0"
+        "Counter 383 from group PA_SC#\0"
+        "PA_SC#_384\0"
+        "Counter 384 from group PA_SC#\0"
+        "PA_SC#_385\0"
+        "Counter 385 from group PA_SC#\0"
+        "PA_SC#_386\0"
+        "Counter 386 from group PA_SC#\0"
+        "PA_SC#_387\0"
+        "Counter 387 from group PA_SC#\0"
+        "PA_SC#_388\0"
+        "Counter 388 from group PA_SC#\0"
+        "PA_SC#_389\0"
+        "Counter 389 from group PA_SC#\0"
+        "PA_SC#_390\0"
+        "Counter 390 from group PA_SC#\0"
+        "PA_SC#_391\0"
+        "Counter 391 from group PA_SC#\0"
+        "PA_SC#_392\0"
+        "Counter 392 from group PA_SC#\0"
+        "PA_SC#_393\0"
+        "Counter 393 from group PA_SC#\0"
+        "PA_SC#_394\0"
+        "Counter 394 from group PA_SC#\0"
+        "PA_SC#_395\0"
+        "Counter 395 from group PA_SC#\0"
+        "PA_SC#_396\0"
+        "Counter 396 from group PA_SC#\0"
+        "PA_SC#_397\0"
+        "Counter 397 from group PA_SC#\0"
+        "PA_SC#_398\0"
+        "Counter 398 from group PA_SC#\0"
+        "PA_SC#_399\0"
+        "Counter 399 from group PA_SC#\0"
+        "PA_SC#_400\0"
+        "Counter 400 from group PA_SC#\0"
+        "PA_SC#_401\0"
+        "Counter 401 from group PA_SC#\0"
+        "PA_SC#_402\0"
+        "Counter 402 from group PA_SC#\0"
+        "PA_SC#_403\0"
+        "Counter 403 from group PA_SC#\0"
+        "PA_SC#_404\0"
+        "Counter 404 from group PA_SC#\0"
+        "PA_SC#_405\0"
+        "Counter 405 from group PA_SC#\0"
+        "PA_SC#_406\0"
+        "Counter 406 from group PA_SC#\0"
+        "PA_SC#_407\0"
+        "Counter 407 from group PA_SC#\0"
+        "PA_SC#_408\0"
+        "Counter 408 from group PA_SC#\0"
+        "PA_SC#_409\0"
+        "Counter 409 from group PA_SC#\0"
+        "PA_SC#_410\0"
+        "Counter 410 from group PA_SC#\0"
+        "PA_SC#_411\0"
+        "Counter 411 from group PA_SC#\0"
+        "PA_SC#_412\0"
+        "Counter 412 from group PA_SC#\0"
+        "PA_SC#_413\0"
+        "Counter 413 from group PA_SC#\0"
+        "PA_SC#_414\0"
+        "Counter 414 from group PA_SC#\0"
+        "PA_SC#_415\0"
+        "Counter 415 from group PA_SC#\0"
+        "PA_SC#_416\0"
+        "Counter 416 from group PA_SC#\0"
+        "PA_SC#_417\0"
+        "Counter 417 from group PA_SC#\0"
+        "PA_SC#_418\0"
+        "Counter 418 from group PA_SC#\0"
+        "PA_SC#_419\0"
+        "Counter 419 from group PA_SC#\0"
+        "PA_SC#_420\0"
+        "Counter 420 from group PA_SC#\0"
+        "PA_SC#_421\0"
+        "Counter 421 from group PA_SC#\0"
+        "PA_SC#_422\0"
+        "Counter 422 from group PA_SC#\0"
+        "PA_SC#_423\0"
+        "Counter 423 from group PA_SC#\0"
+        "PA_SC#_424\0"
+        "Counter 424 from group PA_SC#\0"
+        "PA_SC#_425\0"
+        "Counter 425 from group PA_SC#\0"
+        "PA_SC#_426\0"
+        "Counter 426 from group PA_SC#\0"
+        "PA_SC#_427\0"
+        "Counter 427 from group PA_SC#\0"
+        "PA_SC#_428\0"
+        "Counter 428 from group PA_SC#\0"
+        "PA_SC#_429\0"
+        "Counter 429 from group PA_SC#\0"
+        "PA_SC#_430\0"
+        "Counter 430 from group PA_SC#\0"
+        "PA_SC#_431\0"
+        "Counter 431 from group PA_SC#\0"
+        "PA_SC#_432\0"
+        "Counter 432 from group PA_SC#\0"
+        "PA_SC#_433\0"
+        "Counter 433 from group PA_SC#\0"
+        "PA_SC#_434\0"
+        "Counter 434 from group PA_SC#\0"
+        "PA_SC#_435\0"
+        "Counter 435 from group PA_SC#\0"
+        "PA_SC#_436\0"
+        "Counter 436 from group PA_SC#\0"
+        "PA_SC#_437\0"
+        "Counter 437 from group PA_SC#\0"
+        "PA_SC#_438\0"
+        "Counter 438 from group PA_SC#\0"
+        "PA_SC#_439\0"
+        "Counter 439 from group PA_SC#\0"
+        "PA_SC#_440\0"
+        "Counter 440 from group PA_SC#\0"
+        "PA_SC#_441\0"
+        "Counter 441 from group PA_SC#\0"
+        "PA_SC#_442\0"
+        "Counter 442 from group PA_SC#\0"
+        "PA_SC#_443\0"
+        "Counter 443 from group PA_SC#\0"
+        "PA_SC#_444\0"
+        "Counter 444 from group PA_SC#\0"
+        "PA_SC#_445\0"
+        "Counter 445 from group PA_SC#\0"
+        "PA_SC#_446\0"
+        "Counter 446 from group PA_SC#\0"
+        "PA_SC#_447\0"
+        "Counter 447 from group PA_SC#\0"
+        "PA_SC#_448\0"
+        "Counter 448 from group PA_SC#\0"
+        "PA_SC#_449\0"
+        "Counter 449 from group PA_SC#\0"
+        "PA_SC#_450\0"
+        "Counter 450 from group PA_SC#\0"
+        "PA_SC#_451\0"
+        "Counter 451 from group PA_SC#\0"
+        "PA_SC#_452\0"
+        "Counter 452 from group PA_SC#\0"
+        "PA_SC#_453\0"
+        "Counter 453 from group PA_SC#\0"
+        "PA_SC#_454\0"
+        "Counter 454 from group PA_SC#\0"
+        "PA_SC#_455\0"
+        "Counter 455 from group PA_SC#\0"
+        "PA_SC#_456\0"
+        "Counter 456 from group PA_SC#\0"
+        "PA_SC#_457\0"
+        "Counter 457 from group PA_SC#\0"
+        "PA_SC#_458\0"
+        "Counter 458 from group PA_SC#\0"
+        "PA_SC#_459\0"
+        "Counter 459 from group PA_SC#\0"
+        "PA_SC#_460\0"
+        "Counter 460 from group PA_SC#\0"
+        "PA_SC#_461\0"
+        "Counter 461 from group PA_SC#\0"
+        "PA_SC#_462\0"
+        "Counter 462 from group PA_SC#\0"
+        "PA_SC#_463\0"
+        "Counter 463 from group PA_SC#\0"
+        "PA_SC#_464\0"
+        "Counter 464 from group PA_SC#\0"
+        "PA_SC#_465\0"
+        "Counter 465 from group PA_SC#\0"
+        "PA_SC#_466\0"
+        "Counter 466 from group PA_SC#\0"
+        "PA_SC#_467\0"
+        "Counter 467 from group PA_SC#\0"
+        "PA_SC#_468\0"
+        "Counter 468 from group PA_SC#\0"
+        "PA_SC#_469\0"
+        "Counter 469 from group PA_SC#\0"
+        "PA_SC#_470\0"
+        "Counter 470 from group PA_SC#\0"
+        "PA_SC#_471\0"
+        "Counter 471 from group PA_SC#\0"
+        "PA_SC#_472\0"
+        "Counter 472 from group PA_SC#\0"
+        "PA_SC#_473\0"
+        "Counter 473 from group PA_SC#\0"
+        "PA_SC#_474\0"
+        "Counter 474 from group PA_SC#\0"
+        "PA_SC#_475\0"
+        "Counter 475 from group PA_SC#\0"
+        "PA_SC#_476\0"
+        "Counter 476 from group PA_SC#\0"
+        "PA_SC#_477\0"
+        "Counter 477 from group PA_SC#\0"
+        "PA_SC#_478\0"
+        "Counter 478 from group PA_SC#\0"
+        "PA_SC#_479\0"
+        "Counter 479 from group PA_SC#\0"
+        "PA_SC#_480\0"
+        "Counter 480 from group PA_SC#\0"
+        "PA_SC#_481\0"
+        "Counter 481 from group PA_SC#\0"
+        "PA_SC#_482\0"
+        "Counter 482 from group PA_SC#\0"
+        "PA_SC#_483\0"
+        "Counter 483 from group PA_SC#\0"
+        "PA_SC#_484\0"
+        "Counter 484 from group PA_SC#\0"
+        "PA_SC#_485\0"
+        "Counter 485 from group PA_SC#\0"
+        "PA_SC#_486\0"
+        "Counter 486 from group PA_SC#\0"
+        "PA_SC#_487\0"
+        "Counter 487 from group PA_SC#\0"
+        "PA_SC#_488\0"
+        "Counter 488 from group PA_SC#\0"
+        "PA_SC#_489\0"
+        "Counter 489 from group PA_SC#\0"
+        "PA_SC#_490\0"
+        "Counter 490 from group PA_SC#\0"
+        "PA_SC#_491\0"
+        "Counter 491 from group PA_SC#");
+
+    const GPA_HardwareBlockCounterDesc pa_sc_block_counters_gfx9_placeholder4[] = {
+        {GPA_HIDE_NAME_OFFSET(8), GPA_HIDE_NAME_OFFSET(19)},
+        {GPA_HIDE_NAME_OFFSET(47), GPA_HIDE_NAME_OFFSET(58)},
+        {GPA_HIDE_NAME_OFFSET(86), GPA_HIDE_NAME_OFFSET(97)},
+        {GPA_HIDE_NAME_OFFSET(125), GPA_HIDE_NAME_OFFSET(136)},
+        {GPA_HIDE_NAME_OFFSET(164), GPA_HIDE_NAME_OFFSET(175)},
+        {GPA_HIDE_NAME_OFFSET(203), GPA_HIDE_NAME_OFFSET(214)},
+        {GPA_HIDE_NAME_OFFSET(242), GPA_HIDE_NAME_OFFSET(253)},
+        {GPA_HIDE_NAME_OFFSET(281), GPA_HIDE_NAME_OFFSET(292)},
+        {GPA_HIDE_NAME_OFFSET(320), GPA_HIDE_NAME_OFFSET(331)},
+        {GPA_HIDE_NAME_OFFSET(359), GPA_HIDE_NAME_OFFSET(370)},
+        {GPA_HIDE_NAME_OFFSET(398), GPA_HIDE_NAME_OFFSET(409)},
+        {GPA_HIDE_NAME_OFFSET(438), GPA_HIDE_NAME_OFFSET(449)},
+        {GPA_HIDE_NAME_OFFSET(478), GPA_HIDE_NAME_OFFSET(489)},
+        {GPA_HIDE_NAME_OFFSET(518), GPA_HIDE_NAME_OFFSET(529)},
+        {GPA_HIDE_NAME_OFFSET(558), GPA_HIDE_NAME_OFFSET(569)},
+        {GPA_HIDE_NAME_OFFSET(598), GPA_HIDE_NAME_OFFSET(609)},
+        {GPA_HIDE_NAME_OFFSET(638), GPA_HIDE_NAME_OFFSET(649)},
+        {GPA_HIDE_NAME_OFFSET(678), GPA_HIDE_NAME_OFFSET(689)},
+        {GPA_HIDE_NAME_OFFSET(718), GPA_HIDE_NAME_OFFSET(729)},
+        {GPA_HIDE_NAME_OFFSET(758), GPA_HIDE_NAME_OFFSET(769)},
+        {GPA_HIDE_NAME_OFFSET(798), GPA_HIDE_NAME_OFFSET(809)},
+        {GPA_HIDE_NAME_OFFSET(838), GPA_HIDE_NAME_OFFSET(849)},
+        {GPA_HIDE_NAME_OFFSET(878), GPA_HIDE_NAME_OFFSET(889)},
+        {GPA_HIDE_NAME_OFFSET(918), GPA_HIDE_NAME_OFFSET(929)},
+        {GPA_HIDE_NAME_OFFSET(958), GPA_HIDE_NAME_OFFSET(969)},
+        {GPA_HIDE_NAME_OFFSET(998), GPA_HIDE_NAME_OFFSET(1009)},
+        {GPA_HIDE_NAME_OFFSET(1038), GPA_HIDE_NAME_OFFSET(1049)},
+        {GPA_HIDE_NAME_OFFSET(1078), GPA_HIDE_NAME_OFFSET(1089)},
+        {GPA_HIDE_NAME_OFFSET(1118), GPA_HIDE_NAME_OFFSET(1129)},
+        {GPA_HIDE_NAME_OFFSET(1158), GPA_HIDE_NAME_OFFSET(1169)},
+        {GPA_HIDE_NAME_OFFSET(1198), GPA_HIDE_NAME_OFFSET(1209)},
+        {GPA_HIDE_NAME_OFFSET(1238), GPA_HIDE_NAME_OFFSET(1249)},
+        {GPA_HIDE_NAME_OFFSET(1278), GPA_HIDE_NAME_OFFSET(1289)},
+        {GPA_HIDE_NAME_OFFSET(1318), GPA_HIDE_NAME_OFFSET(1329)},
+        {GPA_HIDE_NAME_OFFSET(1358), GPA_HIDE_NAME_OFFSET(1369)},
+        {GPA_HIDE_NAME_OFFSET(1398), GPA_HIDE_NAME_OFFSET(1409)},
+        {GPA_HIDE_NAME_OFFSET(1438), GPA_HIDE_NAME_OFFSET(1449)},
+        {GPA_HIDE_NAME_OFFSET(1478), GPA_HIDE_NAME_OFFSET(1489)},
+        {GPA_HIDE_NAME_OFFSET(1518), GPA_HIDE_NAME_OFFSET(1529)},
+        {GPA_HIDE_NAME_OFFSET(1558), GPA_HIDE_NAME_OFFSET(1569)},
+        {GPA_HIDE_NAME_OFFSET(1598), GPA_HIDE_NAME_OFFSET(1609)},
+        {GPA_HIDE_NAME_OFFSET(1638), GPA_HIDE_NAME_OFFSET(1649)},
+        {GPA_HIDE_NAME_OFFSET(1678), GPA_HIDE_NAME_OFFSET(1689)},
+        {GPA_HIDE_NAME_OFFSET(1718), GPA_HIDE_NAME_OFFSET(1729)},
+        {GPA_HIDE_NAME_OFFSET(1758), GPA_HIDE_NAME_OFFSET(1769)},
+        {GPA_HIDE_NAME_OFFSET(1798), GPA_HIDE_NAME_OFFSET(1809)},
+        {GPA_HIDE_NAME_OFFSET(1838), GPA_HIDE_NAME_OFFSET(1849)},
+        {GPA_HIDE_NAME_OFFSET(1878), GPA_HIDE_NAME_OFFSET(1889)},
+        {GPA_HIDE_NAME_OFFSET(1918), GPA_HIDE_NAME_OFFSET(1929)},
+        {GPA_HIDE_NAME_OFFSET(1958), GPA_HIDE_NAME_OFFSET(1969)},
+        {GPA_HIDE_NAME_OFFSET(1998), GPA_HIDE_NAME_OFFSET(2009)},
+        {GPA_HIDE_NAME_OFFSET(2038), GPA_HIDE_NAME_OFFSET(2049)},
+        {GPA_HIDE_NAME_OFFSET(2078), GPA_HIDE_NAME_OFFSET(2089)},
+        {GPA_HIDE_NAME_OFFSET(2118), GPA_HIDE_NAME_OFFSET(2129)},
+        {GPA_HIDE_NAME_OFFSET(2158), GPA_HIDE_NAME_OFFSET(2169)},
+        {GPA_HIDE_NAME_OFFSET(2198), GPA_HIDE_NAME_OFFSET(2209)},
+        {GPA_HIDE_NAME_OFFSET(2238), GPA_HIDE_NAME_OFFSET(2249)},
+        {GPA_HIDE_NAME_OFFSET(2278), GPA_HIDE_NAME_OFFSET(2289)},
+        {GPA_HIDE_NAME_OFFSET(2318), GPA_HIDE_NAME_OFFSET(2329)},
+        {GPA_HIDE_NAME_OFFSET(2358), GPA_HIDE_NAME_OFFSET(2369)},
+        {GPA_HIDE_NAME_OFFSET(2398), GPA_HIDE_NAME_OFFSET(2409)},
+        {GPA_HIDE_NAME_OFFSET(2438), GPA_HIDE_NAME_OFFSET(2449)},
+        {GPA_HIDE_NAME_OFFSET(2478), GPA_HIDE_NAME_OFFSET(2489)},
+        {GPA_HIDE_NAME_OFFSET(2518), GPA_HIDE_NAME_OFFSET(2529)},
+        {GPA_HIDE_NAME_OFFSET(2558), GPA_HIDE_NAME_OFFSET(2569)},
+        {GPA_HIDE_NAME_OFFSET(2598), GPA_HIDE_NAME_OFFSET(2609)},
+        {GPA_HIDE_NAME_OFFSET(2638), GPA_HIDE_NAME_OFFSET(2649)},
+        {GPA_HIDE_NAME_OFFSET(2678), GPA_HIDE_NAME_OFFSET(2689)},
+        {GPA_HIDE_NAME_OFFSET(2718), GPA_HIDE_NAME_OFFSET(2729)},
+        {GPA_HIDE_NAME_OFFSET(2758), GPA_HIDE_NAME_OFFSET(2769)},
+        {GPA_HIDE_NAME_OFFSET(2798), GPA_HIDE_NAME_OFFSET(2809)},
+        {GPA_HIDE_NAME_OFFSET(2838), GPA_HIDE_NAME_OFFSET(2849)},
+        {GPA_HIDE_NAME_OFFSET(2878), GPA_HIDE_NAME_OFFSET(2889)},
+        {GPA_HIDE_NAME_OFFSET(2918), GPA_HIDE_NAME_OFFSET(2929)},
+        {GPA_HIDE_NAME_OFFSET(2958), GPA_HIDE_NAME_OFFSET(2969)},
+        {GPA_HIDE_NAME_OFFSET(2998), GPA_HIDE_NAME_OFFSET(3009)},
+        {GPA_HIDE_NAME_OFFSET(3038), GPA_HIDE_NAME_OFFSET(3049)},
+        {GPA_HIDE_NAME_OFFSET(3078), GPA_HIDE_NAME_OFFSET(3089)},
+        {GPA_HIDE_NAME_OFFSET(3118), GPA_HIDE_NAME_OFFSET(3129)},
+        {GPA_HIDE_NAME_OFFSET(3158), GPA_HIDE_NAME_OFFSET(3169)},
+        {GPA_HIDE_NAME_OFFSET(3198), GPA_HIDE_NAME_OFFSET(3209)},
+        {GPA_HIDE_NAME_OFFSET(3238), GPA_HIDE_NAME_OFFSET(3249)},
+        {GPA_HIDE_NAME_OFFSET(3278), GPA_HIDE_NAME_OFFSET(3289)},
+        {GPA_HIDE_NAME_OFFSET(3318), GPA_HIDE_NAME_OFFSET(3329)},
+        {GPA_HIDE_NAME_OFFSET(3358), GPA_HIDE_NAME_OFFSET(3369)},
+        {GPA_HIDE_NAME_OFFSET(3398), GPA_HIDE_NAME_OFFSET(3409)},
+        {GPA_HIDE_NAME_OFFSET(3438), GPA_HIDE_NAME_OFFSET(3449)},
+        {GPA_HIDE_NAME_OFFSET(3478), GPA_HIDE_NAME_OFFSET(3489)},
+        {GPA_HIDE_NAME_OFFSET(3518), GPA_HIDE_NAME_OFFSET(3529)},
+        {GPA_HIDE_NAME_OFFSET(3558), GPA_HIDE_NAME_OFFSET(3569)},
+        {GPA_HIDE_NAME_OFFSET(3598), GPA_HIDE_NAME_OFFSET(3609)},
+        {GPA_HIDE_NAME_OFFSET(3638), GPA_HIDE_NAME_OFFSET(3649)},
+        {GPA_HIDE_NAME_OFFSET(3678), GPA_HIDE_NAME_OFFSET(3689)},
+        {GPA_HIDE_NAME_OFFSET(3718), GPA_HIDE_NAME_OFFSET(3729)},
+        {GPA_HIDE_NAME_OFFSET(3758), GPA_HIDE_NAME_OFFSET(3769)},
+        {GPA_HIDE_NAME_OFFSET(3798), GPA_HIDE_NAME_OFFSET(3809)},
+        {GPA_HIDE_NAME_OFFSET(3838), GPA_HIDE_NAME_OFFSET(3849)},
+        {GPA_HIDE_NAME_OFFSET(3878), GPA_HIDE_NAME_OFFSET(3889)},
+        {GPA_HIDE_NAME_OFFSET(3918), GPA_HIDE_NAME_OFFSET(3929)},
+        {GPA_HIDE_NAME_OFFSET(3958), GPA_HIDE_NAME_OFFSET(3969)},
+        {GPA_HIDE_NAME_OFFSET(3998), GPA_HIDE_NAME_OFFSET(4009)},
+        {GPA_HIDE_NAME_OFFSET(4039), GPA_HIDE_NAME_OFFSET(4050)},
+        {GPA_HIDE_NAME_OFFSET(4080), GPA_HIDE_NAME_OFFSET(4091)},
+        {GPA_HIDE_NAME_OFFSET(4121), GPA_HIDE_NAME_OFFSET(4132)},
+        {GPA_HIDE_NAME_OFFSET(4162), GPA_HIDE_NAME_OFFSET(4173)},
+        {GPA_HIDE_NAME_OFFSET(4203), GPA_HIDE_NAME_OFFSET(4214)},
+        {GPA_HIDE_NAME_OFFSET(4244), GPA_HIDE_NAME_OFFSET(4255)},
+        {GPA_HIDE_NAME_OFFSET(4285), GPA_HIDE_NAME_OFFSET(4296)},
+        {GPA_HIDE_NAME_OFFSET(4326), GPA_HIDE_NAME_OFFSET(4337)},
+        {GPA_HIDE_NAME_OFFSET(4367), GPA_HIDE_NAME_OFFSET(4378)},
+        {GPA_HIDE_NAME_OFFSET(4408), GPA_HIDE_NAME_OFFSET(4419)},
+        {GPA_HIDE_NAME_OFFSET(4449), GPA_HIDE_NAME_OFFSET(4460)},
+        {GPA_HIDE_NAME_OFFSET(4490), GPA_HIDE_NAME_OFFSET(4501)},
+        {GPA_HIDE_NAME_OFFSET(4531), GPA_HIDE_NAME_OFFSET(4542)},
+        {GPA_HIDE_NAME_OFFSET(4572), GPA_HIDE_NAME_OFFSET(4583)},
+        {GPA_HIDE_NAME_OFFSET(4613), GPA_HIDE_NAME_OFFSET(4624)},
+        {GPA_HIDE_NAME_OFFSET(4654), GPA_HIDE_NAME_OFFSET(4665)},
+        {GPA_HIDE_NAME_OFFSET(4695), GPA_HIDE_NAME_OFFSET(4706)},
+        {GPA_HIDE_NAME_OFFSET(4736), GPA_HIDE_NAME_OFFSET(4747)},
+        {GPA_HIDE_NAME_OFFSET(4777), GPA_HIDE_NAME_OFFSET(4788)},
+        {GPA_HIDE_NAME_OFFSET(4818), GPA_HIDE_NAME_OFFSET(4829)},
+        {GPA_HIDE_NAME_OFFSET(4859), GPA_HIDE_NAME_OFFSET(4870)},
+        {GPA_HIDE_NAME_OFFSET(4900), GPA_HIDE_NAME_OFFSET(4911)},
+        {GPA_HIDE_NAME_OFFSET(4941), GPA_HIDE_NAME_OFFSET(4952)},
+        {GPA_HIDE_NAME_OFFSET(4982), GPA_HIDE_NAME_OFFSET(4993)},
+        {GPA_HIDE_NAME_OFFSET(5023), GPA_HIDE_NAME_OFFSET(5034)},
+        {GPA_HIDE_NAME_OFFSET(5064), GPA_HIDE_NAME_OFFSET(5075)},
+        {GPA_HIDE_NAME_OFFSET(5105), GPA_HIDE_NAME_OFFSET(5116)},
+        {GPA_HIDE_NAME_OFFSET(5146), GPA_HIDE_NAME_OFFSET(5157)},
+        {GPA_HIDE_NAME_OFFSET(5187), GPA_HIDE_NAME_OFFSET(5198)},
+        {GPA_HIDE_NAME_OFFSET(5228), GPA_HIDE_NAME_OFFSET(5239)},
+        {GPA_HIDE_NAME_OFFSET(5269), GPA_HIDE_NAME_OFFSET(5280)},
+        {GPA_HIDE_NAME_OFFSET(5310), GPA_HIDE_NAME_OFFSET(5321)},
+        {GPA_HIDE_NAME_OFFSET(5351), GPA_HIDE_NAME_OFFSET(5362)},
+        {GPA_HIDE_NAME_OFFSET(5392), GPA_HIDE_NAME_OFFSET(5403)},
+        {GPA_HIDE_NAME_OFFSET(5433), GPA_HIDE_NAME_OFFSET(5444)},
+        {GPA_HIDE_NAME_OFFSET(5474), GPA_HIDE_NAME_OFFSET(5485)},
+        {GPA_HIDE_NAME_OFFSET(5515), GPA_HIDE_NAME_OFFSET(5526)},
+        {GPA_HIDE_NAME_OFFSET(5556), GPA_HIDE_NAME_OFFSET(5567)},
+        {GPA_HIDE_NAME_OFFSET(5597), GPA_HIDE_NAME_OFFSET(5608)},
+        {GPA_HIDE_NAME_OFFSET(5638), GPA_HIDE_NAME_OFFSET(5649)},
+        {GPA_HIDE_NAME_OFFSET(5679), GPA_HIDE_NAME_OFFSET(5690)},
+        {GPA_HIDE_NAME_OFFSET(5720), GPA_HIDE_NAME_OFFSET(5731)},
+        {GPA_HIDE_NAME_OFFSET(5761), GPA_HIDE_NAME_OFFSET(5772)},
+        {GPA_HIDE_NAME_OFFSET(5802), GPA_HIDE_NAME_OFFSET(5813)},
+        {GPA_HIDE_NAME_OFFSET(5843), GPA_HIDE_NAME_OFFSET(5854)},
+        {GPA_HIDE_NAME_OFFSET(5884), GPA_HIDE_NAME_OFFSET(5895)},
+        {GPA_HIDE_NAME_OFFSET(5925), GPA_HIDE_NAME_OFFSET(5936)},
+        {GPA_HIDE_NAME_OFFSET(5966), GPA_HIDE_NAME_OFFSET(5977)},
+        {GPA_HIDE_NAME_OFFSET(6007), GPA_HIDE_NAME_OFFSET(6018)},
+        {GPA_HIDE_NAME_OFFSET(6048), GPA_HIDE_NAME_OFFSET(6059)},
+        {GPA_HIDE_NAME_OFFSET(6089), GPA_HIDE_NAME_OFFSET(6100)},
+        {GPA_HIDE_NAME_OFFSET(6130), GPA_HIDE_NAME_OFFSET(6141)},
+        {GPA_HIDE_NAME_OFFSET(6171), GPA_HIDE_NAME_OFFSET(6182)},
+        {GPA_HIDE_NAME_OFFSET(6212), GPA_HIDE_NAME_OFFSET(6223)},
+        {GPA_HIDE_NAME_OFFSET(6253), GPA_HIDE_NAME_OFFSET(6264)},
+        {GPA_HIDE_NAME_OFFSET(6294), GPA_HIDE_NAME_OFFSET(6305)},
+        {GPA_HIDE_NAME_OFFSET(6335), GPA_HIDE_NAME_OFFSET(6346)},
+        {GPA_HIDE_NAME_OFFSET(6376), GPA_HIDE_NAME_OFFSET(6387)},
+        {GPA_HIDE_NAME_OFFSET(6417), GPA_HIDE_NAME_OFFSET(6439)},
+        {GPA_HIDE_NAME_OFFSET(6672), GPA_HIDE_NAME_OFFSET(6694)},
+        {GPA_HIDE_NAME_OFFSET(6960), GPA_HIDE_NAME_OFFSET(6982)},
+        {GPA_HIDE_NAME_OFFSET(7055), GPA_HIDE_NAME_OFFSET(7077)},
+        {GPA_HIDE_NAME_OFFSET(7150), GPA_HIDE_NAME_OFFSET(7161)},
+        {GPA_HIDE_NAME_OFFSET(7191), GPA_HIDE_NAME_OFFSET(7202)},
+        {GPA_HIDE_NAME_OFFSET(7232), GPA_HIDE_NAME_OFFSET(7243)},
+        {GPA_HIDE_NAME_OFFSET(7273), GPA_HIDE_NAME_OFFSET(7284)},
+        {GPA_HIDE_NAME_OFFSET(7314), GPA_HIDE_NAME_OFFSET(7325)},
+        {GPA_HIDE_NAME_OFFSET(7355), GPA_HIDE_NAME_OFFSET(7366)},
+        {GPA_HIDE_NAME_OFFSET(7396), GPA_HIDE_NAME_OFFSET(7407)},
+        {GPA_HIDE_NAME_OFFSET(7437), GPA_HIDE_NAME_OFFSET(7448)},
+        {GPA_HIDE_NAME_OFFSET(7478), GPA_HIDE_NAME_OFFSET(7489)},
+        {GPA_HIDE_NAME_OFFSET(7519), GPA_HIDE_NAME_OFFSET(7530)},
+        {GPA_HIDE_NAME_OFFSET(7560), GPA_HIDE_NAME_OFFSET(7571)},
+        {GPA_HIDE_NAME_OFFSET(7601), GPA_HIDE_NAME_OFFSET(7612)},
+        {GPA_HIDE_NAME_OFFSET(7642), GPA_HIDE_NAME_OFFSET(7653)},
+        {GPA_HIDE_NAME_OFFSET(7683), GPA_HIDE_NAME_OFFSET(7694)},
+        {GPA_HIDE_NAME_OFFSET(7724), GPA_HIDE_NAME_OFFSET(7735)},
+        {GPA_HIDE_NAME_OFFSET(7765), GPA_HIDE_NAME_OFFSET(7776)},
+        {GPA_HIDE_NAME_OFFSET(7806), GPA_HIDE_NAME_OFFSET(7817)},
+        {GPA_HIDE_NAME_OFFSET(7847), GPA_HIDE_NAME_OFFSET(7858)},
+        {GPA_HIDE_NAME_OFFSET(7888), GPA_HIDE_NAME_OFFSET(7899)},
+        {GPA_HIDE_NAME_OFFSET(7929), GPA_HIDE_NAME_OFFSET(7940)},
+        {GPA_HIDE_NAME_OFFSET(7970), GPA_HIDE_NAME_OFFSET(7981)},
+        {GPA_HIDE_NAME_OFFSET(8011), GPA_HIDE_NAME_OFFSET(8022)},
+        {GPA_HIDE_NAME_OFFSET(8052), GPA_HIDE_NAME_OFFSET(8063)},
+        {GPA_HIDE_NAME_OFFSET(8093), GPA_HIDE_NAME_OFFSET(8104)},
+        {GPA_HIDE_NAME_OFFSET(8134), GPA_HIDE_NAME_OFFSET(8145)},
+        {GPA_HIDE_NAME_OFFSET(8175), GPA_HIDE_NAME_OFFSET(8186)},
+        {GPA_HIDE_NAME_OFFSET(8216), GPA_HIDE_NAME_OFFSET(8227)},
+        {GPA_HIDE_NAME_OFFSET(8257), GPA_HIDE_NAME_OFFSET(8268)},
+        {GPA_HIDE_NAME_OFFSET(8298), GPA_HIDE_NAME_OFFSET(8309)},
+        {GPA_HIDE_NAME_OFFSET(8339), GPA_HIDE_NAME_OFFSET(8350)},
+        {GPA_HIDE_NAME_OFFSET(8380), GPA_HIDE_NAME_OFFSET(8391)},
+        {GPA_HIDE_NAME_OFFSET(8421), GPA_HIDE_NAME_OFFSET(8432)},
+        {GPA_HIDE_NAME_OFFSET(8462), GPA_HIDE_NAME_OFFSET(8473)},
+        {GPA_HIDE_NAME_OFFSET(8503), GPA_HIDE_NAME_OFFSET(8514)},
+        {GPA_HIDE_NAME_OFFSET(8544), GPA_HIDE_NAME_OFFSET(8555)},
+        {GPA_HIDE_NAME_OFFSET(8585), GPA_HIDE_NAME_OFFSET(8596)},
+        {GPA_HIDE_NAME_OFFSET(8626), GPA_HIDE_NAME_OFFSET(8637)},
+        {GPA_HIDE_NAME_OFFSET(8667), GPA_HIDE_NAME_OFFSET(8678)},
+        {GPA_HIDE_NAME_OFFSET(8708), GPA_HIDE_NAME_OFFSET(8719)},
+        {GPA_HIDE_NAME_OFFSET(8749), GPA_HIDE_NAME_OFFSET(8760)},
+        {GPA_HIDE_NAME_OFFSET(8790), GPA_HIDE_NAME_OFFSET(8801)},
+        {GPA_HIDE_NAME_OFFSET(8831), GPA_HIDE_NAME_OFFSET(8842)},
+        {GPA_HIDE_NAME_OFFSET(8872), GPA_HIDE_NAME_OFFSET(8883)},
+        {GPA_HIDE_NAME_OFFSET(8913), GPA_HIDE_NAME_OFFSET(8924)},
+        {GPA_HIDE_NAME_OFFSET(8954), GPA_HIDE_NAME_OFFSET(8965)},
+        {GPA_HIDE_NAME_OFFSET(8995), GPA_HIDE_NAME_OFFSET(9006)},
+        {GPA_HIDE_NAME_OFFSET(9036), GPA_HIDE_NAME_OFFSET(9047)},
+        {GPA_HIDE_NAME_OFFSET(9077), GPA_HIDE_NAME_OFFSET(9088)},
+        {GPA_HIDE_NAME_OFFSET(9118), GPA_HIDE_NAME_OFFSET(9129)},
+        {GPA_HIDE_NAME_OFFSET(9159), GPA_HIDE_NAME_OFFSET(9170)},
+        {GPA_HIDE_NAME_OFFSET(9200), GPA_HIDE_NAME_OFFSET(9211)},
+        {GPA_HIDE_NAME_OFFSET(9241), GPA_HIDE_NAME_OFFSET(9252)},
+        {GPA_HIDE_NAME_OFFSET(9282), GPA_HIDE_NAME_OFFSET(9293)},
+        {GPA_HIDE_NAME_OFFSET(9323), GPA_HIDE_NAME_OFFSET(9334)},
+        {GPA_HIDE_NAME_OFFSET(9364), GPA_HIDE_NAME_OFFSET(9375)},
+        {GPA_HIDE_NAME_OFFSET(9405), GPA_HIDE_NAME_OFFSET(9416)},
+        {GPA_HIDE_NAME_OFFSET(9446), GPA_HIDE_NAME_OFFSET(9457)},
+        {GPA_HIDE_NAME_OFFSET(9487), GPA_HIDE_NAME_OFFSET(9498)},
+        {GPA_HIDE_NAME_OFFSET(9528), GPA_HIDE_NAME_OFFSET(9539)},
+        {GPA_HIDE_NAME_OFFSET(9569), GPA_HIDE_NAME_OFFSET(9580)},
+        {GPA_HIDE_NAME_OFFSET(9610), GPA_HIDE_NAME_OFFSET(9621)},
+        {GPA_HIDE_NAME_OFFSET(9651), GPA_HIDE_NAME_OFFSET(9662)},
+        {GPA_HIDE_NAME_OFFSET(9692), GPA_HIDE_NAME_OFFSET(9703)},
+        {GPA_HIDE_NAME_OFFSET(9733), GPA_HIDE_NAME_OFFSET(9744)},
+        {GPA_HIDE_NAME_OFFSET(9774), GPA_HIDE_NAME_OFFSET(9785)},
+        {GPA_HIDE_NAME_OFFSET(9815), GPA_HIDE_NAME_OFFSET(9826)},
+        {GPA_HIDE_NAME_OFFSET(9856), GPA_HIDE_NAME_OFFSET(9867)},
+        {GPA_HIDE_NAME_OFFSET(9897), GPA_HIDE_NAME_OFFSET(9908)},
+        {GPA_HIDE_NAME_OFFSET(9938), GPA_HIDE_NAME_OFFSET(9949)},
+        {GPA_HIDE_NAME_OFFSET(9979), GPA_HIDE_NAME_OFFSET(9990)},
+        {GPA_HIDE_NAME_OFFSET(10020), GPA_HIDE_NAME_OFFSET(10031)},
+        {GPA_HIDE_NAME_OFFSET(10061), GPA_HIDE_NAME_OFFSET(10072)},
+        {GPA_HIDE_NAME_OFFSET(10102), GPA_HIDE_NAME_OFFSET(10127)},
+        {GPA_HIDE_NAME_OFFSET(10371), GPA_HIDE_NAME_OFFSET(10396)},
+        {GPA_HIDE_NAME_OFFSET(10674), GPA_HIDE_NAME_OFFSET(10699)},
+        {GPA_HIDE_NAME_OFFSET(10785), GPA_HIDE_NAME_OFFSET(10810)},
+        {GPA_HIDE_NAME_OFFSET(10896), GPA_HIDE_NAME_OFFSET(10907)},
+        {GPA_HIDE_NAME_OFFSET(10937), GPA_HIDE_NAME_OFFSET(10948)},
+        {GPA_HIDE_NAME_OFFSET(10978), GPA_HIDE_NAME_OFFSET(10989)},
+        {GPA_HIDE_NAME_OFFSET(11019), GPA_HIDE_NAME_OFFSET(11030)},
+        {GPA_HIDE_NAME_OFFSET(11060), GPA_HIDE_NAME_OFFSET(11071)},
+        {GPA_HIDE_NAME_OFFSET(11101), GPA_HIDE_NAME_OFFSET(11112)},
+        {GPA_HIDE_NAME_OFFSET(11142), GPA_HIDE_NAME_OFFSET(11153)},
+        {GPA_HIDE_NAME_OFFSET(11183), GPA_HIDE_NAME_OFFSET(11194)},
+        {GPA_HIDE_NAME_OFFSET(11224), GPA_HIDE_NAME_OFFSET(11235)},
+        {GPA_HIDE_NAME_OFFSET(11265), GPA_HIDE_NAME_OFFSET(11276)},
+        {GPA_HIDE_NAME_OFFSET(11306), GPA_HIDE_NAME_OFFSET(11317)},
+        {GPA_HIDE_NAME_OFFSET(11347), GPA_HIDE_NAME_OFFSET(11358)},
+        {GPA_HIDE_NAME_OFFSET(11388), GPA_HIDE_NAME_OFFSET(11399)},
+        {GPA_HIDE_NAME_OFFSET(11429), GPA_HIDE_NAME_OFFSET(11440)},
+        {GPA_HIDE_NAME_OFFSET(11470), GPA_HIDE_NAME_OFFSET(11481)},
+        {GPA_HIDE_NAME_OFFSET(11511), GPA_HIDE_NAME_OFFSET(11522)},
+        {GPA_HIDE_NAME_OFFSET(11552), GPA_HIDE_NAME_OFFSET(11563)},
+        {GPA_HIDE_NAME_OFFSET(11593), GPA_HIDE_NAME_OFFSET(11604)},
+        {GPA_HIDE_NAME_OFFSET(11634), GPA_HIDE_NAME_OFFSET(11645)},
+        {GPA_HIDE_NAME_OFFSET(11675), GPA_HIDE_NAME_OFFSET(11686)},
+        {GPA_HIDE_NAME_OFFSET(11716), GPA_HIDE_NAME_OFFSET(11741)},
+        {GPA_HIDE_NAME_OFFSET(11994), GPA_HIDE_NAME_OFFSET(12005)},
+        {GPA_HIDE_NAME_OFFSET(12035), GPA_HIDE_NAME_OFFSET(12046)},
+        {GPA_HIDE_NAME_OFFSET(12076), GPA_HIDE_NAME_OFFSET(12087)},
+        {GPA_HIDE_NAME_OFFSET(12117), GPA_HIDE_NAME_OFFSET(12128)},
+        {GPA_HIDE_NAME_OFFSET(12158), GPA_HIDE_NAME_OFFSET(12169)},
+        {GPA_HIDE_NAME_OFFSET(12199), GPA_HIDE_NAME_OFFSET(12210)},
+        {GPA_HIDE_NAME_OFFSET(12240), GPA_HIDE_NAME_OFFSET(12251)},
+        {GPA_HIDE_NAME_OFFSET(12281), GPA_HIDE_NAME_OFFSET(12292)},
+        {GPA_HIDE_NAME_OFFSET(12322), GPA_HIDE_NAME_OFFSET(12333)},
+        {GPA_HIDE_NAME_OFFSET(12363), GPA_HIDE_NAME_OFFSET(12374)},
+        {GPA_HIDE_NAME_OFFSET(12404), GPA_HIDE_NAME_OFFSET(12415)},
+        {GPA_HIDE_NAME_OFFSET(12445), GPA_HIDE_NAME_OFFSET(12456)},
+        {GPA_HIDE_NAME_OFFSET(12486), GPA_HIDE_NAME_OFFSET(12497)},
+        {GPA_HIDE_NAME_OFFSET(12527), GPA_HIDE_NAME_OFFSET(12538)},
+        {GPA_HIDE_NAME_OFFSET(12568), GPA_HIDE_NAME_OFFSET(12579)},
+        {GPA_HIDE_NAME_OFFSET(12609), GPA_HIDE_NAME_OFFSET(12620)},
+        {GPA_HIDE_NAME_OFFSET(12650), GPA_HIDE_NAME_OFFSET(12661)},
+        {GPA_HIDE_NAME_OFFSET(12691), GPA_HIDE_NAME_OFFSET(12702)},
+        {GPA_HIDE_NAME_OFFSET(12732), GPA_HIDE_NAME_OFFSET(12743)},
+        {GPA_HIDE_NAME_OFFSET(12773), GPA_HIDE_NAME_OFFSET(12784)},
+        {GPA_HIDE_NAME_OFFSET(12814), GPA_HIDE_NAME_OFFSET(12825)},
+        {GPA_HIDE_NAME_OFFSET(12855), GPA_HIDE_NAME_OFFSET(12866)},
+        {GPA_HIDE_NAME_OFFSET(12896), GPA_HIDE_NAME_OFFSET(12907)},
+        {GPA_HIDE_NAME_OFFSET(12937), GPA_HIDE_NAME_OFFSET(12948)},
+        {GPA_HIDE_NAME_OFFSET(12978), GPA_HIDE_NAME_OFFSET(12989)},
+        {GPA_HIDE_NAME_OFFSET(13019), GPA_HIDE_NAME_OFFSET(13030)},
+        {GPA_HIDE_NAME_OFFSET(13060), GPA_HIDE_NAME_OFFSET(13071)},
+        {GPA_HIDE_NAME_OFFSET(13101), GPA_HIDE_NAME_OFFSET(13112)},
+        {GPA_HIDE_NAME_OFFSET(13142), GPA_HIDE_NAME_OFFSET(13153)},
+        {GPA_HIDE_NAME_OFFSET(13183), GPA_HIDE_NAME_OFFSET(13194)},
+        {GPA_HIDE_NAME_OFFSET(13224), GPA_HIDE_NAME_OFFSET(13235)},
+        {GPA_HIDE_NAME_OFFSET(13265), GPA_HIDE_NAME_OFFSET(13276)},
+        {GPA_HIDE_NAME_OFFSET(13306), GPA_HIDE_NAME_OFFSET(13317)},
+        {GPA_HIDE_NAME_OFFSET(13347), GPA_HIDE_NAME_OFFSET(13358)},
+        {GPA_HIDE_NAME_OFFSET(13388), GPA_HIDE_NAME_OFFSET(13399)},
+        {GPA_HIDE_NAME_OFFSET(13429), GPA_HIDE_NAME_OFFSET(13440)},
+        {GPA_HIDE_NAME_OFFSET(13470), GPA_HIDE_NAME_OFFSET(13481)},
+        {GPA_HIDE_NAME_OFFSET(13511), GPA_HIDE_NAME_OFFSET(13522)},
+        {GPA_HIDE_NAME_OFFSET(13552), GPA_HIDE_NAME_OFFSET(13563)},
+        {GPA_HIDE_NAME_OFFSET(13593), GPA_HIDE_NAME_OFFSET(13604)},
+        {GPA_HIDE_NAME_OFFSET(13634), GPA_HIDE_NAME_OFFSET(13645)},
+        {GPA_HIDE_NAME_OFFSET(13675), GPA_HIDE_NAME_OFFSET(13686)},
+        {GPA_HIDE_NAME_OFFSET(13716), GPA_HIDE_NAME_OFFSET(13727)},
+        {GPA_HIDE_NAME_OFFSET(13757), GPA_HIDE_NAME_OFFSET(13768)},
+        {GPA_HIDE_NAME_OFFSET(13798), GPA_HIDE_NAME_OFFSET(13809)},
+        {GPA_HIDE_NAME_OFFSET(13839), GPA_HIDE_NAME_OFFSET(13850)},
+        {GPA_HIDE_NAME_OFFSET(13880), GPA_HIDE_NAME_OFFSET(13891)},
+        {GPA_HIDE_NAME_OFFSET(13921), GPA_HIDE_NAME_OFFSET(13932)},
+        {GPA_HIDE_NAME_OFFSET(13962), GPA_HIDE_NAME_OFFSET(13973)},
+        {GPA_HIDE_NAME_OFFSET(14003), GPA_HIDE_NAME_OFFSET(14014)},
+        {GPA_HIDE_NAME_OFFSET(14044), GPA_HIDE_NAME_OFFSET(14055)},
+        {GPA_HIDE_NAME_OFFSET(14085), GPA_HIDE_NAME_OFFSET(14096)},
+        {GPA_HIDE_NAME_OFFSET(14126), GPA_HIDE_NAME_OFFSET(14137)},
+        {GPA_HIDE_NAME_OFFSET(14167), GPA_HIDE_NAME_OFFSET(14178)},
+        {GPA_HIDE_NAME_OFFSET(14208), GPA_HIDE_NAME_OFFSET(14219)},
+        {GPA_HIDE_NAME_OFFSET(14249), GPA_HIDE_NAME_OFFSET(14260)},
+        {GPA_HIDE_NAME_OFFSET(14290), GPA_HIDE_NAME_OFFSET(14301)},
+        {GPA_HIDE_NAME_OFFSET(14331), GPA_HIDE_NAME_OFFSET(14342)},
+        {GPA_HIDE_NAME_OFFSET(14372), GPA_HIDE_NAME_OFFSET(14383)},
+        {GPA_HIDE_NAME_OFFSET(14413), GPA_HIDE_NAME_OFFSET(14424)},
+        {GPA_HIDE_NAME_OFFSET(14454), GPA_HIDE_NAME_OFFSET(14465)},
+        {GPA_HIDE_NAME_OFFSET(14495), GPA_HIDE_NAME_OFFSET(14506)},
+        {GPA_HIDE_NAME_OFFSET(14536), GPA_HIDE_NAME_OFFSET(14547)},
+        {GPA_HIDE_NAME_OFFSET(14577), GPA_HIDE_NAME_OFFSET(14588)},
+        {GPA_HIDE_NAME_OFFSET(14618), GPA_HIDE_NAME_OFFSET(14629)},
+        {GPA_HIDE_NAME_OFFSET(14659), GPA_HIDE_NAME_OFFSET(14670)},
+        {GPA_HIDE_NAME_OFFSET(14700), GPA_HIDE_NAME_OFFSET(14711)},
+        {GPA_HIDE_NAME_OFFSET(14741), GPA_HIDE_NAME_OFFSET(14752)},
+        {GPA_HIDE_NAME_OFFSET(14782), GPA_HIDE_NAME_OFFSET(14793)},
+        {GPA_HIDE_NAME_OFFSET(14823), GPA_HIDE_NAME_OFFSET(14834)},
+        {GPA_HIDE_NAME_OFFSET(14864), GPA_HIDE_NAME_OFFSET(14875)},
+        {GPA_HIDE_NAME_OFFSET(14905), GPA_HIDE_NAME_OFFSET(14916)},
+        {GPA_HIDE_NAME_OFFSET(14946), GPA_HIDE_NAME_OFFSET(14957)},
+        {GPA_HIDE_NAME_OFFSET(14987), GPA_HIDE_NAME_OFFSET(14998)},
+        {GPA_HIDE_NAME_OFFSET(15028), GPA_HIDE_NAME_OFFSET(15039)},
+        {GPA_HIDE_NAME_OFFSET(15069), GPA_HIDE_NAME_OFFSET(15080)},
+        {GPA_HIDE_NAME_OFFSET(15110), GPA_HIDE_NAME_OFFSET(15121)},
+        {GPA_HIDE_NAME_OFFSET(15151), GPA_HIDE_NAME_OFFSET(15162)},
+        {GPA_HIDE_NAME_OFFSET(15192), GPA_HIDE_NAME_OFFSET(15203)},
+        {GPA_HIDE_NAME_OFFSET(15233), GPA_HIDE_NAME_OFFSET(15244)},
+        {GPA_HIDE_NAME_OFFSET(15274), GPA_HIDE_NAME_OFFSET(15285)},
+        {GPA_HIDE_NAME_OFFSET(15315), GPA_HIDE_NAME_OFFSET(15326)},
+        {GPA_HIDE_NAME_OFFSET(15356), GPA_HIDE_NAME_OFFSET(15367)},
+        {GPA_HIDE_NAME_OFFSET(15397), GPA_HIDE_NAME_OFFSET(15408)},
+        {GPA_HIDE_NAME_OFFSET(15438), GPA_HIDE_NAME_OFFSET(15449)},
+        {GPA_HIDE_NAME_OFFSET(15479), GPA_HIDE_NAME_OFFSET(15490)},
+        {GPA_HIDE_NAME_OFFSET(15520), GPA_HIDE_NAME_OFFSET(15531)},
+        {GPA_HIDE_NAME_OFFSET(15561), GPA_HIDE_NAME_OFFSET(15572)},
+        {GPA_HIDE_NAME_OFFSET(15602), GPA_HIDE_NAME_OFFSET(15613)},
+        {GPA_HIDE_NAME_OFFSET(15643), GPA_HIDE_NAME_OFFSET(15654)},
+        {GPA_HIDE_NAME_OFFSET(15684), GPA_HIDE_NAME_OFFSET(15695)},
+        {GPA_HIDE_NAME_OFFSET(15725), GPA_HIDE_NAME_OFFSET(15736)},
+        {GPA_HIDE_NAME_OFFSET(15766), GPA_HIDE_NAME_OFFSET(15777)},
+        {GPA_HIDE_NAME_OFFSET(15807), GPA_HIDE_NAME_OFFSET(15818)},
+        {GPA_HIDE_NAME_OFFSET(15848), GPA_HIDE_NAME_OFFSET(15859)},
+        {GPA_HIDE_NAME_OFFSET(15889), GPA_HIDE_NAME_OFFSET(15900)},
+        {GPA_HIDE_NAME_OFFSET(15930), GPA_HIDE_NAME_OFFSET(15941)},
+        {GPA_HIDE_NAME_OFFSET(15971), GPA_HIDE_NAME_OFFSET(15982)},
+        {GPA_HIDE_NAME_OFFSET(16012), GPA_HIDE_NAME_OFFSET(16023)},
+        {GPA_HIDE_NAME_OFFSET(16053), GPA_HIDE_NAME_OFFSET(16064)},
+        {GPA_HIDE_NAME_OFFSET(16094), GPA_HIDE_NAME_OFFSET(16105)},
+        {GPA_HIDE_NAME_OFFSET(16135), GPA_HIDE_NAME_OFFSET(16146)},
+        {GPA_HIDE_NAME_OFFSET(16176), GPA_HIDE_NAME_OFFSET(16187)},
+        {GPA_HIDE_NAME_OFFSET(16217), GPA_HIDE_NAME_OFFSET(16228)},
+        {GPA_HIDE_NAME_OFFSET(16258), GPA_HIDE_NAME_OFFSET(16269)},
+        {GPA_HIDE_NAME_OFFSET(16299), GPA_HIDE_NAME_OFFSET(16310)},
+        {GPA_HIDE_NAME_OFFSET(16340), GPA_HIDE_NAME_OFFSET(16351)},
+        {GPA_HIDE_NAME_OFFSET(16381), GPA_HIDE_NAME_OFFSET(16392)},
+        {GPA_HIDE_NAME_OFFSET(16422), GPA_HIDE_NAME_OFFSET(16433)},
+        {GPA_HIDE_NAME_OFFSET(16463), GPA_HIDE_NAME_OFFSET(16474)},
+        {GPA_HIDE_NAME_OFFSET(16504), GPA_HIDE_NAME_OFFSET(16515)},
+        {GPA_HIDE_NAME_OFFSET(16545), GPA_HIDE_NAME_OFFSET(16556)},
+        {GPA_HIDE_NAME_OFFSET(16586), GPA_HIDE_NAME_OFFSET(16597)},
+        {GPA_HIDE_NAME_OFFSET(16627), GPA_HIDE_NAME_OFFSET(16638)},
+        {GPA_HIDE_NAME_OFFSET(16668), GPA_HIDE_NAME_OFFSET(16679)},
+        {GPA_HIDE_NAME_OFFSET(16709), GPA_HIDE_NAME_OFFSET(16720)},
+        {GPA_HIDE_NAME_OFFSET(16750), GPA_HIDE_NAME_OFFSET(16761)},
+        {GPA_HIDE_NAME_OFFSET(16791), GPA_HIDE_NAME_OFFSET(16802)},
+        {GPA_HIDE_NAME_OFFSET(16832), GPA_HIDE_NAME_OFFSET(16843)},
+        {GPA_HIDE_NAME_OFFSET(16873), GPA_HIDE_NAME_OFFSET(16884)},
+        {GPA_HIDE_NAME_OFFSET(16914), GPA_HIDE_NAME_OFFSET(16925)},
+        {GPA_HIDE_NAME_OFFSET(16955), GPA_HIDE_NAME_OFFSET(16966)},
+        {GPA_HIDE_NAME_OFFSET(16996), GPA_HIDE_NAME_OFFSET(17007)},
+        {GPA_HIDE_NAME_OFFSET(17037), GPA_HIDE_NAME_OFFSET(17048)},
+        {GPA_HIDE_NAME_OFFSET(17078), GPA_HIDE_NAME_OFFSET(17089)},
+        {GPA_HIDE_NAME_OFFSET(17119), GPA_HIDE_NAME_OFFSET(17130)},
+        {GPA_HIDE_NAME_OFFSET(17160), GPA_HIDE_NAME_OFFSET(17171)},
+        {GPA_HIDE_NAME_OFFSET(17201), GPA_HIDE_NAME_OFFSET(17212)},
+        {GPA_HIDE_NAME_OFFSET(17242), GPA_HIDE_NAME_OFFSET(17253)},
+        {GPA_HIDE_NAME_OFFSET(17283), GPA_HIDE_NAME_OFFSET(17294)},
+        {GPA_HIDE_NAME_OFFSET(17324), GPA_HIDE_NAME_OFFSET(17335)},
+        {GPA_HIDE_NAME_OFFSET(17365), GPA_HIDE_NAME_OFFSET(17376)},
+        {GPA_HIDE_NAME_OFFSET(17406), GPA_HIDE_NAME_OFFSET(17417)},
+        {GPA_HIDE_NAME_OFFSET(17447), GPA_HIDE_NAME_OFFSET(17458)},
+        {GPA_HIDE_NAME_OFFSET(17488), GPA_HIDE_NAME_OFFSET(17499)},
+        {GPA_HIDE_NAME_OFFSET(17529), GPA_HIDE_NAME_OFFSET(17540)},
+        {GPA_HIDE_NAME_OFFSET(17570), GPA_HIDE_NAME_OFFSET(17581)},
+        {GPA_HIDE_NAME_OFFSET(17611), GPA_HIDE_NAME_OFFSET(17622)},
+        {GPA_HIDE_NAME_OFFSET(17652), GPA_HIDE_NAME_OFFSET(17663)},
+        {GPA_HIDE_NAME_OFFSET(17693), GPA_HIDE_NAME_OFFSET(17704)},
+        {GPA_HIDE_NAME_OFFSET(17734), GPA_HIDE_NAME_OFFSET(17745)},
+        {GPA_HIDE_NAME_OFFSET(17775), GPA_HIDE_NAME_OFFSET(17786)},
+        {GPA_HIDE_NAME_OFFSET(17816), GPA_HIDE_NAME_OFFSET(17827)},
+        {GPA_HIDE_NAME_OFFSET(17857), GPA_HIDE_NAME_OFFSET(17868)},
+        {GPA_HIDE_NAME_OFFSET(17898), GPA_HIDE_NAME_OFFSET(17909)},
+        {GPA_HIDE_NAME_OFFSET(17939), GPA_HIDE_NAME_OFFSET(17950)},
+        {GPA_HIDE_NAME_OFFSET(17980), GPA_HIDE_NAME_OFFSET(17991)},
+        {GPA_HIDE_NAME_OFFSET(18021), GPA_HIDE_NAME_OFFSET(18032)},
+        {GPA_HIDE_NAME_OFFSET(18062), GPA_HIDE_NAME_OFFSET(18073)},
+        {GPA_HIDE_NAME_OFFSET(18103), GPA_HIDE_NAME_OFFSET(18114)},
+        {GPA_HIDE_NAME_OFFSET(18144), GPA_HIDE_NAME_OFFSET(18155)},
+        {GPA_HIDE_NAME_OFFSET(18185), GPA_HIDE_NAME_OFFSET(18196)},
+        {GPA_HIDE_NAME_OFFSET(18226), GPA_HIDE_NAME_OFFSET(18237)},
+        {GPA_HIDE_NAME_OFFSET(18267), GPA_HIDE_NAME_OFFSET(18278)},
+        {GPA_HIDE_NAME_OFFSET(18308), GPA_HIDE_NAME_OFFSET(18319)},
+        {GPA_HIDE_NAME_OFFSET(18349), GPA_HIDE_NAME_OFFSET(18360)},
+        {GPA_HIDE_NAME_OFFSET(18390), GPA_HIDE_NAME_OFFSET(18401)},
+        {GPA_HIDE_NAME_OFFSET(18431), GPA_HIDE_NAME_OFFSET(18442)},
+        {GPA_HIDE_NAME_OFFSET(18472), GPA_HIDE_NAME_OFFSET(18483)},
+        {GPA_HIDE_NAME_OFFSET(18513), GPA_HIDE_NAME_OFFSET(18524)},
+        {GPA_HIDE_NAME_OFFSET(18554), GPA_HIDE_NAME_OFFSET(18565)},
+        {GPA_HIDE_NAME_OFFSET(18595), GPA_HIDE_NAME_OFFSET(18606)},
+        {GPA_HIDE_NAME_OFFSET(18636), GPA_HIDE_NAME_OFFSET(18647)},
+        {GPA_HIDE_NAME_OFFSET(18677), GPA_HIDE_NAME_OFFSET(18688)},
+        {GPA_HIDE_NAME_OFFSET(18718), GPA_HIDE_NAME_OFFSET(18729)},
+        {GPA_HIDE_NAME_OFFSET(18759), GPA_HIDE_NAME_OFFSET(18770)},
+        {GPA_HIDE_NAME_OFFSET(18800), GPA_HIDE_NAME_OFFSET(18811)},
+        {GPA_HIDE_NAME_OFFSET(18841), GPA_HIDE_NAME_OFFSET(18852)},
+        {GPA_HIDE_NAME_OFFSET(18882), GPA_HIDE_NAME_OFFSET(18893)},
+        {GPA_HIDE_NAME_OFFSET(18923), GPA_HIDE_NAME_OFFSET(18934)},
+        {GPA_HIDE_NAME_OFFSET(18964), GPA_HIDE_NAME_OFFSET(18975)},
+        {GPA_HIDE_NAME_OFFSET(19005), GPA_HIDE_NAME_OFFSET(19016)},
+        {GPA_HIDE_NAME_OFFSET(19046), GPA_HIDE_NAME_OFFSET(19057)},
+        {GPA_HIDE_NAME_OFFSET(19087), GPA_HIDE_NAME_OFFSET(19098)},
+        {GPA_HIDE_NAME_OFFSET(19128), GPA_HIDE_NAME_OFFSET(19139)},
+        {GPA_HIDE_NAME_OFFSET(19169), GPA_HIDE_NAME_OFFSET(19180)},
+        {GPA_HIDE_NAME_OFFSET(19210), GPA_HIDE_NAME_OFFSET(19221)},
+        {GPA_HIDE_NAME_OFFSET(19251), GPA_HIDE_NAME_OFFSET(19262)},
+        {GPA_HIDE_NAME_OFFSET(19292), GPA_HIDE_NAME_OFFSET(19303)},
+        {GPA_HIDE_NAME_OFFSET(19333), GPA_HIDE_NAME_OFFSET(19344)},
+        {GPA_HIDE_NAME_OFFSET(19374), GPA_HIDE_NAME_OFFSET(19385)},
+        {GPA_HIDE_NAME_OFFSET(19415), GPA_HIDE_NAME_OFFSET(19426)},
+        {GPA_HIDE_NAME_OFFSET(19456), GPA_HIDE_NAME_OFFSET(19467)},
+        {GPA_HIDE_NAME_OFFSET(19497), GPA_HIDE_NAME_OFFSET(19508)},
+        {GPA_HIDE_NAME_OFFSET(19538), GPA_HIDE_NAME_OFFSET(19549)},
+        {GPA_HIDE_NAME_OFFSET(19579), GPA_HIDE_NAME_OFFSET(19590)},
+        {GPA_HIDE_NAME_OFFSET(19620), GPA_HIDE_NAME_OFFSET(19631)},
+        {GPA_HIDE_NAME_OFFSET(19661), GPA_HIDE_NAME_OFFSET(19672)},
+        {GPA_HIDE_NAME_OFFSET(19702), GPA_HIDE_NAME_OFFSET(19713)},
+        {GPA_HIDE_NAME_OFFSET(19743), GPA_HIDE_NAME_OFFSET(19754)},
+        {GPA_HIDE_NAME_OFFSET(19784), GPA_HIDE_NAME_OFFSET(19795)},
+        {GPA_HIDE_NAME_OFFSET(19825), GPA_HIDE_NAME_OFFSET(19836)},
+        {GPA_HIDE_NAME_OFFSET(19866), GPA_HIDE_NAME_OFFSET(19877)},
+        {GPA_HIDE_NAME_OFFSET(19907), GPA_HIDE_NAME_OFFSET(19918)},
+        {GPA_HIDE_NAME_OFFSET(19948), GPA_HIDE_NAME_OFFSET(19959)},
+        {GPA_HIDE_NAME_OFFSET(19989), GPA_HIDE_NAME_OFFSET(20000)},
+        {GPA_HIDE_NAME_OFFSET(20030), GPA_HIDE_NAME_OFFSET(20041)},
+        {GPA_HIDE_NAME_OFFSET(20071), GPA_HIDE_NAME_OFFSET(20082)},
+        {GPA_HIDE_NAME_OFFSET(20112), GPA_HIDE_NAME_OFFSET(20123)},
+        {GPA_HIDE_NAME_OFFSET(20153), GPA_HIDE_NAME_OFFSET(20164)},
+        {GPA_HIDE_NAME_OFFSET(20194), GPA_HIDE_NAME_OFFSET(20205)},
+        {GPA_HIDE_NAME_OFFSET(20235), GPA_HIDE_NAME_OFFSET(20246)},
+        {GPA_HIDE_NAME_OFFSET(20276), GPA_HIDE_NAME_OFFSET(20287)},
+        {GPA_HIDE_NAME_OFFSET(20317), GPA_HIDE_NAME_OFFSET(20328)},
+        {GPA_HIDE_NAME_OFFSET(20358), GPA_HIDE_NAME_OFFSET(20369)},
+        {GPA_HIDE_NAME_OFFSET(20399), GPA_HIDE_NAME_OFFSET(20410)},
+        {GPA_HIDE_NAME_OFFSET(20440), GPA_HIDE_NAME_OFFSET(20451)},
+        {GPA_HIDE_NAME_OFFSET(20481), GPA_HIDE_NAME_OFFSET(20492)},
+        {GPA_HIDE_NAME_OFFSET(20522), GPA_HIDE_NAME_OFFSET(20533)},
+        {GPA_HIDE_NAME_OFFSET(20563), GPA_HIDE_NAME_OFFSET(20574)},
+        {GPA_HIDE_NAME_OFFSET(20604), GPA_HIDE_NAME_OFFSET(20615)},
+        {GPA_HIDE_NAME_OFFSET(20645), GPA_HIDE_NAME_OFFSET(20656)},
+        {GPA_HIDE_NAME_OFFSET(20686), GPA_HIDE_NAME_OFFSET(20697)},
+        {GPA_HIDE_NAME_OFFSET(20727), GPA_HIDE_NAME_OFFSET(20738)},
+        {GPA_HIDE_NAME_OFFSET(20768), GPA_HIDE_NAME_OFFSET(20779)},
+        {GPA_HIDE_NAME_OFFSET(20809), GPA_HIDE_NAME_OFFSET(20820)},
+        {GPA_HIDE_NAME_OFFSET(20850), GPA_HIDE_NAME_OFFSET(20861)},
+        {GPA_HIDE_NAME_OFFSET(20891), GPA_HIDE_NAME_OFFSET(20902)},
+        {GPA_HIDE_NAME_OFFSET(20932), GPA_HIDE_NAME_OFFSET(20943)},
+        {GPA_HIDE_NAME_OFFSET(20973), GPA_HIDE_NAME_OFFSET(20984)},
+        {GPA_HIDE_NAME_OFFSET(21014), GPA_HIDE_NAME_OFFSET(21025)},
+        {GPA_HIDE_NAME_OFFSET(21055), GPA_HIDE_NAME_OFFSET(21066)},
+        {GPA_HIDE_NAME_OFFSET(21096), GPA_HIDE_NAME_OFFSET(21107)},
+        {GPA_HIDE_NAME_OFFSET(21137), GPA_HIDE_NAME_OFFSET(21148)},
+        {GPA_HIDE_NAME_OFFSET(21178), GPA_HIDE_NAME_OFFSET(21189)},
+        {GPA_HIDE_NAME_OFFSET(21219), GPA_HIDE_NAME_OFFSET(21230)},
+        {GPA_HIDE_NAME_OFFSET(21260), GPA_HIDE_NAME_OFFSET(21271)},
+        {GPA_HIDE_NAME_OFFSET(21301), GPA_HIDE_NAME_OFFSET(21312)},
+        {GPA_HIDE_NAME_OFFSET(21342), GPA_HIDE_NAME_OFFSET(21353)},
+        {GPA_HIDE_NAME_OFFSET(21383), GPA_HIDE_NAME_OFFSET(21394)},
+        {GPA_HIDE_NAME_OFFSET(21424), GPA_HIDE_NAME_OFFSET(21435)},
+        {GPA_HIDE_NAME_OFFSET(21465), GPA_HIDE_NAME_OFFSET(21476)},
     };
-    GPA_HardwareCounterDesc gcea14_counters_gfx9_placeholder4[] = {
-        {0, GPA_HIDE_NAME("GCEA14_000"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 0 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {1, GPA_HIDE_NAME("GCEA14_001"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 1 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {2, GPA_HIDE_NAME("GCEA14_002"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 2 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {3, GPA_HIDE_NAME("GCEA14_003"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 3 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {4, GPA_HIDE_NAME("GCEA14_004"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 4 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {5, GPA_HIDE_NAME("GCEA14_005"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 5 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {6, GPA_HIDE_NAME("GCEA14_006"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 6 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {7, GPA_HIDE_NAME("GCEA14_007"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 7 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {8, GPA_HIDE_NAME("GCEA14_008"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 8 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {9, GPA_HIDE_NAME("GCEA14_009"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 9 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {10, GPA_HIDE_NAME("GCEA14_010"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 10 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {11, GPA_HIDE_NAME("GCEA14_011"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 11 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {12, GPA_HIDE_NAME("GCEA14_012"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 12 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {13, GPA_HIDE_NAME("GCEA14_013"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 13 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {14, GPA_HIDE_NAME("GCEA14_014"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 14 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {15, GPA_HIDE_NAME("GCEA14_015"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 15 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {16, GPA_HIDE_NAME("GCEA14_016"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 16 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {17, GPA_HIDE_NAME("GCEA14_017"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 17 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {18, GPA_HIDE_NAME("GCEA14_018"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 18 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {19, GPA_HIDE_NAME("GCEA14_019"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 19 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {20, GPA_HIDE_NAME("GCEA14_020"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 20 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {21, GPA_HIDE_NAME("GCEA14_021"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 21 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {22, GPA_HIDE_NAME("GCEA14_022"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 22 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {23, GPA_HIDE_NAME("GCEA14_023"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 23 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {24, GPA_HIDE_NAME("GCEA14_024"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 24 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {25, GPA_HIDE_NAME("GCEA14_025"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 25 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {26, GPA_HIDE_NAME("GCEA14_026"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 26 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {27, GPA_HIDE_NAME("GCEA14_027"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 27 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {28, GPA_HIDE_NAME("GCEA14_028"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 28 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {29, GPA_HIDE_NAME("GCEA14_029"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 29 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {30, GPA_HIDE_NAME("GCEA14_030"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 30 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {31, GPA_HIDE_NAME("GCEA14_031"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 31 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {32, GPA_HIDE_NAME("GCEA14_032"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 32 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {33, GPA_HIDE_NAME("GCEA14_033"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 33 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {34, GPA_HIDE_NAME("GCEA14_034"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 34 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {35, GPA_HIDE_NAME("GCEA14_035"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 35 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {36, GPA_HIDE_NAME("GCEA14_036"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 36 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {37, GPA_HIDE_NAME("GCEA14_037"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 37 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {38, GPA_HIDE_NAME("GCEA14_038"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 38 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {39, GPA_HIDE_NAME("GCEA14_039"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 39 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {40, GPA_HIDE_NAME("GCEA14_040"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 40 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {41, GPA_HIDE_NAME("GCEA14_041"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 41 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {42, GPA_HIDE_NAME("GCEA14_042"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 42 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {43, GPA_HIDE_NAME("GCEA14_043"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 43 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {44, GPA_HIDE_NAME("GCEA14_044"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 44 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {45, GPA_HIDE_NAME("GCEA14_045"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 45 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {46, GPA_HIDE_NAME("GCEA14_046"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 46 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {47, GPA_HIDE_NAME("GCEA14_047"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 47 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {48, GPA_HIDE_NAME("GCEA14_048"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 48 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {49, GPA_HIDE_NAME("GCEA14_049"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 49 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {50, GPA_HIDE_NAME("GCEA14_050"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 50 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {51, GPA_HIDE_NAME("GCEA14_051"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 51 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {52, GPA_HIDE_NAME("GCEA14_052"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 52 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {53, GPA_HIDE_NAME("GCEA14_053"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 53 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {54, GPA_HIDE_NAME("GCEA14_054"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 54 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {55, GPA_HIDE_NAME("GCEA14_PERF_SEL_SARB_DRAM_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("DRAM sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {56, GPA_HIDE_NAME("GCEA14_056"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 56 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {57, GPA_HIDE_NAME("GCEA14_PERF_SEL_SARB_IO_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("I/O sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {58, GPA_HIDE_NAME("GCEA14_058"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 58 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {59, GPA_HIDE_NAME("GCEA14_059"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 59 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {60, GPA_HIDE_NAME("GCEA14_060"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 60 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {61, GPA_HIDE_NAME("GCEA14_061"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 61 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {62, GPA_HIDE_NAME("GCEA14_062"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 62 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {63, GPA_HIDE_NAME("GCEA14_063"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 63 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {64, GPA_HIDE_NAME("GCEA14_064"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 64 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {65, GPA_HIDE_NAME("GCEA14_065"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 65 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {66, GPA_HIDE_NAME("GCEA14_066"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 66 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {67, GPA_HIDE_NAME("GCEA14_067"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 67 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {68, GPA_HIDE_NAME("GCEA14_068"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 68 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {69, GPA_HIDE_NAME("GCEA14_069"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 69 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {70, GPA_HIDE_NAME("GCEA14_070"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 70 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {71, GPA_HIDE_NAME("GCEA14_071"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 71 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {72, GPA_HIDE_NAME("GCEA14_072"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 72 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {73, GPA_HIDE_NAME("GCEA14_073"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 73 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {74, GPA_HIDE_NAME("GCEA14_074"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 74 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {75, GPA_HIDE_NAME("GCEA14_075"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 75 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {76, GPA_HIDE_NAME("GCEA14_076"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 76 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {77, GPA_HIDE_NAME("GCEA14_077"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 77 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {78, GPA_HIDE_NAME("GCEA14_078"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 78 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {79, GPA_HIDE_NAME("GCEA14_079"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 79 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {80, GPA_HIDE_NAME("GCEA14_080"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 80 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {81, GPA_HIDE_NAME("GCEA14_081"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 81 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {82, GPA_HIDE_NAME("GCEA14_082"), GPA_HIDE_NAME("GCEA14"), GPA_HIDE_NAME("Counter 82 from group GCEA14"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
+
+    const GPA_HardwareBlockDesc pa_sc_block_gfx9_placeholder4 = {pa_sc_strings_gfx9_placeholder4, GPA_HIDE_NAME_OFFSET(1), 4, 492, pa_sc_block_counters_gfx9_placeholder4};
+
+    /// String pool of the ia block for gfx9_placeholder4 family
+    const char ia_strings_gfx9_placeholder4[] = GPA_HIDE_NAME(
+        "\0"
+        "IA#\0"
+        "IA#_000\0"
+        "Counter 0 from group IA#\0"
+        "IA#_001\0"
+        "Counter 1 from group IA#\0"
+        "IA#_002\0"
+        "Counter 2 from group IA#\0"
+        "IA#_003\0"
+        "Counter 3 from group IA#\0"
+        "IA#_004\0"
+        "Counter 4 from group IA#\0"
+        "IA#_005\0"
+        "Counter 5 from group IA#\0"
+        "IA#_006\0"
+        "Counter 6 from group IA#\0"
+        "IA#_007\0"
+        "Counter 7 from group IA#\0"
+        "IA#_008\0"
+        "Counter 8 from group IA#\0"
+        "IA#_009\0"
+        "Counter 9 from group IA#\0"
+        "IA#_010\0"
+        "Counter 10 from group IA#\0"
+        "IA#_011\0"
+        "Counter 11 from group IA#\0"
+        "IA#_012\0"
+        "Counter 12 from group IA#\0"
+        "IA#_013\0"
+        "Counter 13 from group IA#\0"
+        "IA#_014\0"
+        "Counter 14 from group IA#\0"
+        "IA#_015\0"
+        "Counter 15 from group IA#\0"
+        "IA#_016\0"
+        "Counter 16 from group IA#\0"
+        "IA#_017\0"
+        "Counter 17 from group IA#\0"
+        "IA#_018\0"
+        "Counter 18 from group IA#\0"
+        "IA#_019\0"
+        "Counter 19 from group IA#\0"
+        "IA#_020\0"
+        "Counter 20 from group IA#\0"
+        "IA#_021\0"
+        "Counter 21 from group IA#\0"
+        "IA#_022\0"
+        "Counter 22 from group IA#\0"
+        "IA#_023\0"
+        "Counter 23 from group IA#\0"
+        "IA#_024\0"
+        "Counter 24 from group IA#\0"
+        "IA#_025\0"
+        "Counter 25 from group IA#\0"
+        "IA#_026\0"
+        "Counter 26 from group IA#\0"
+        "IA#_027\0"
+        "Counter 27 from group IA#\0"
+        "IA#_028\0"
+        "Counter 28 from group IA#\0"
+        "IA#_029\0"
+        "Counter 29 from group IA#\0"
+        "IA#_030\0"
+        "Counter 30 from group IA#");
+
+    const GPA_HardwareBlockCounterDesc ia_block_counters_gfx9_placeholder4[] = {
+        {GPA_HIDE_NAME_OFFSET(5), GPA_HIDE_NAME_OFFSET(13)},
+        {GPA_HIDE_NAME_OFFSET(38), GPA_HIDE_NAME_OFFSET(46)},
+        {GPA_HIDE_NAME_OFFSET(71), GPA_HIDE_NAME_OFFSET(79)},
+        {GPA_HIDE_NAME_OFFSET(104), GPA_HIDE_NAME_OFFSET(112)},
+        {GPA_HIDE_NAME_OFFSET(137), GPA_HIDE_NAME_OFFSET(145)},
+        {GPA_HIDE_NAME_OFFSET(170), GPA_HIDE_NAME_OFFSET(178)},
+        {GPA_HIDE_NAME_OFFSET(203), GPA_HIDE_NAME_OFFSET(211)},
+        {GPA_HIDE_NAME_OFFSET(236), GPA_HIDE_NAME_OFFSET(244)},
+        {GPA_HIDE_NAME_OFFSET(269), GPA_HIDE_NAME_OFFSET(277)},
+        {GPA_HIDE_NAME_OFFSET(302), GPA_HIDE_NAME_OFFSET(310)},
+        {GPA_HIDE_NAME_OFFSET(335), GPA_HIDE_NAME_OFFSET(343)},
+        {GPA_HIDE_NAME_OFFSET(369), GPA_HIDE_NAME_OFFSET(377)},
+        {GPA_HIDE_NAME_OFFSET(403), GPA_HIDE_NAME_OFFSET(411)},
+        {GPA_HIDE_NAME_OFFSET(437), GPA_HIDE_NAME_OFFSET(445)},
+        {GPA_HIDE_NAME_OFFSET(471), GPA_HIDE_NAME_OFFSET(479)},
+        {GPA_HIDE_NAME_OFFSET(505), GPA_HIDE_NAME_OFFSET(513)},
+        {GPA_HIDE_NAME_OFFSET(539), GPA_HIDE_NAME_OFFSET(547)},
+        {GPA_HIDE_NAME_OFFSET(573), GPA_HIDE_NAME_OFFSET(581)},
+        {GPA_HIDE_NAME_OFFSET(607), GPA_HIDE_NAME_OFFSET(615)},
+        {GPA_HIDE_NAME_OFFSET(641), GPA_HIDE_NAME_OFFSET(649)},
+        {GPA_HIDE_NAME_OFFSET(675), GPA_HIDE_NAME_OFFSET(683)},
+        {GPA_HIDE_NAME_OFFSET(709), GPA_HIDE_NAME_OFFSET(717)},
+        {GPA_HIDE_NAME_OFFSET(743), GPA_HIDE_NAME_OFFSET(751)},
+        {GPA_HIDE_NAME_OFFSET(777), GPA_HIDE_NAME_OFFSET(785)},
+        {GPA_HIDE_NAME_OFFSET(811), GPA_HIDE_NAME_OFFSET(819)},
+        {GPA_HIDE_NAME_OFFSET(845), GPA_HIDE_NAME_OFFSET(853)},
+        {GPA_HIDE_NAME_OFFSET(879), GPA_HIDE_NAME_OFFSET(887)},
+        {GPA_HIDE_NAME_OFFSET(913), GPA_HIDE_NAME_OFFSET(921)},
+        {GPA_HIDE_NAME_OFFSET(947), GPA_HIDE_NAME_OFFSET(955)},
+        {GPA_HIDE_NAME_OFFSET(981), GPA_HIDE_NAME_OFFSET(989)},
+        {GPA_HIDE_NAME_OFFSET(1015), GPA_HIDE_NAME_OFFSET(1023)},
     };
-    GPA_HardwareCounterDesc gcea15_counters_gfx9_placeholder4[] = {
-        {0, GPA_HIDE_NAME("GCEA15_000"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 0 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {1, GPA_HIDE_NAME("GCEA15_001"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 1 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {2, GPA_HIDE_NAME("GCEA15_002"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 2 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {3, GPA_HIDE_NAME("GCEA15_003"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 3 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {4, GPA_HIDE_NAME("GCEA15_004"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 4 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {5, GPA_HIDE_NAME("GCEA15_005"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 5 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {6, GPA_HIDE_NAME("GCEA15_006"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 6 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {7, GPA_HIDE_NAME("GCEA15_007"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 7 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {8, GPA_HIDE_NAME("GCEA15_008"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 8 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {9, GPA_HIDE_NAME("GCEA15_009"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 9 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {10, GPA_HIDE_NAME("GCEA15_010"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 10 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {11, GPA_HIDE_NAME("GCEA15_011"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 11 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {12, GPA_HIDE_NAME("GCEA15_012"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 12 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {13, GPA_HIDE_NAME("GCEA15_013"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 13 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {14, GPA_HIDE_NAME("GCEA15_014"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 14 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {15, GPA_HIDE_NAME("GCEA15_015"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 15 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {16, GPA_HIDE_NAME("GCEA15_016"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 16 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {17, GPA_HIDE_NAME("GCEA15_017"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 17 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {18, GPA_HIDE_NAME("GCEA15_018"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 18 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {19, GPA_HIDE_NAME("GCEA15_019"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 19 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {20, GPA_HIDE_NAME("GCEA15_020"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 20 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {21, GPA_HIDE_NAME("GCEA15_021"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 21 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {22, GPA_HIDE_NAME("GCEA15_022"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 22 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {23, GPA_HIDE_NAME("GCEA15_023"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 23 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {24, GPA_HIDE_NAME("GCEA15_024"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 24 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {25, GPA_HIDE_NAME("GCEA15_025"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 25 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {26, GPA_HIDE_NAME("GCEA15_026"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 26 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {27, GPA_HIDE_NAME("GCEA15_027"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 27 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {28, GPA_HIDE_NAME("GCEA15_028"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 28 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {29, GPA_HIDE_NAME("GCEA15_029"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 29 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {30, GPA_HIDE_NAME("GCEA15_030"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 30 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {31, GPA_HIDE_NAME("GCEA15_031"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 31 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {32, GPA_HIDE_NAME("GCEA15_032"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 32 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {33, GPA_HIDE_NAME("GCEA15_033"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 33 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {34, GPA_HIDE_NAME("GCEA15_034"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 34 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {35, GPA_HIDE_NAME("GCEA15_035"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 35 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {36, GPA_HIDE_NAME("GCEA15_036"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 36 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {37, GPA_HIDE_NAME("GCEA15_037"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 37 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {38, GPA_HIDE_NAME("GCEA15_038"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 38 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {39, GPA_HIDE_NAME("GCEA15_039"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 39 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {40, GPA_HIDE_NAME("GCEA15_040"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 40 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {41, GPA_HIDE_NAME("GCEA15_041"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 41 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {42, GPA_HIDE_NAME("GCEA15_042"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 42 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {43, GPA_HIDE_NAME("GCEA15_043"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 43 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {44, GPA_HIDE_NAME("GCEA15_044"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 44 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {45, GPA_HIDE_NAME("GCEA15_045"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 45 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {46, GPA_HIDE_NAME("GCEA15_046"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 46 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {47, GPA_HIDE_NAME("GCEA15_047"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 47 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {48, GPA_HIDE_NAME("GCEA15_048"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 48 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {49, GPA_HIDE_NAME("GCEA15_049"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 49 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {50, GPA_HIDE_NAME("GCEA15_050"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 50 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {51, GPA_HIDE_NAME("GCEA15_051"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 51 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {52, GPA_HIDE_NAME("GCEA15_052"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 52 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {53, GPA_HIDE_NAME("GCEA15_053"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 53 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {54, GPA_HIDE_NAME("GCEA15_054"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 54 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {55, GPA_HIDE_NAME("GCEA15_PERF_SEL_SARB_DRAM_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("DRAM sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {56, GPA_HIDE_NAME("GCEA15_056"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 56 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {57, GPA_HIDE_NAME("GCEA15_PERF_SEL_SARB_IO_SIZED_REQUESTS"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("I/O sized (in 32 byte increments) requests"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {58, GPA_HIDE_NAME("GCEA15_058"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 58 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {59, GPA_HIDE_NAME("GCEA15_059"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 59 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {60, GPA_HIDE_NAME("GCEA15_060"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 60 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {61, GPA_HIDE_NAME("GCEA15_061"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 61 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {62, GPA_HIDE_NAME("GCEA15_062"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 62 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {63, GPA_HIDE_NAME("GCEA15_063"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 63 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {64, GPA_HIDE_NAME("GCEA15_064"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 64 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {65, GPA_HIDE_NAME("GCEA15_065"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 65 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {66, GPA_HIDE_NAME("GCEA15_066"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 66 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {67, GPA_HIDE_NAME("GCEA15_067"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 67 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {68, GPA_HIDE_NAME("GCEA15_068"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 68 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {69, GPA_HIDE_NAME("GCEA15_069"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 69 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {70, GPA_HIDE_NAME("GCEA15_070"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 70 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {71, GPA_HIDE_NAME("GCEA15_071"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 71 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {72, GPA_HIDE_NAME("GCEA15_072"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 72 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {73, GPA_HIDE_NAME("GCEA15_073"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 73 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {74, GPA_HIDE_NAME("GCEA15_074"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 74 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {75, GPA_HIDE_NAME("GCEA15_075"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 75 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {76, GPA_HIDE_NAME("GCEA15_076"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 76 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {77, GPA_HIDE_NAME("GCEA15_077"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 77 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {78, GPA_HIDE_NAME("GCEA15_078"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 78 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {79, GPA_HIDE_NAME("GCEA15_079"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 79 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {80, GPA_HIDE_NAME("GCEA15_080"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 80 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {81, GPA_HIDE_NAME("GCEA15_081"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 81 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
-        {82, GPA_HIDE_NAME("GCEA15_082"), GPA_HIDE_NAME("GCEA15"), GPA_HIDE_NAME("Counter 82 from group GCEA15"), GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX},
+
+    const GPA_HardwareBlockDesc ia_block_gfx9_placeholder4 = {ia_strings_gfx9_placeholder4, GPA_HIDE_NAME_OFFSET(1), 2, 31, ia_block_counters_gfx9_placeholder4};
+
+    /// String pool of the gcea block for gfx9_placeholder4 family
+    const char gcea_strings_gfx9_placeholder4[] = GPA_HIDE_NAME(
+        "\0"
+        "GCEA#\0"
+        "GCEA#_000\0"
+        "Counter 0 from group GCEA#\0"
+        "GCEA#_001\0"
+        "Counter 1 from group GCEA#\0"
+        "GCEA#_002\0"
+        "Counter 2 from group GCEA#\0"
+        "GCEA#_003\0"
+        "Counter 3 from group GCEA#\0"
+        "GCEA#_004\0"
+        "Counter 4 from group GCEA#\0"
+        "GCEA#_005\0"
+        "Counter 5 from group GCEA#\0"
+        "GCEA#_006\0"
+        "Counter 6 from group GCEA#\0"
+        "GCEA#_007\0"
+        "Counter 7 from group GCEA#\0"
+        "GCEA#_008\0"
+        "Counter 8 from group GCEA#\0"
+        "GCEA#_009\0"
+        "Counter 9 from group GCEA#\0"
+        "GCEA#_010\0"
+        "Counter 10 from group GCEA#\0"
+        "GCEA#_011\0"
+        "Counter 11 from group GCEA#\0"
+        "GCEA#_012\0"
+        "Counter 12 from group GCEA#\0"
+        "GCEA#_013\0"
+        "Counter 13 from group GCEA#\0"
+        "GCEA#_014\0"
+        "Counter 14 from group GCEA#\0"
+        "GCEA#_015\0"
+        "Counter 15 from group GCEA#\0"
+        "GCEA#_016\0"
+        "Counter 16 from group GCEA#\0"
+        "GCEA#_017\0"
+        "Counter 17 from group GCEA#\0"
+        "GCEA#_018\0"
+        "Counter 18 from group GCEA#\0"
+        "GCEA#_019\0"
+        "Counter 19 from group GCEA#\0"
+        "GCEA#_020\0"
+        "Counter 20 from group GCEA#\0"
+        "GCEA#_021\0"
+        "Counter 21 from group GCEA#\0"
+        "GCEA#_022\0"
+        "Counter 22 from group GCEA#\0"
+        "GCEA#_023\0"
+        "Counter 23 from group GCEA#\0"
+        "GCEA#_024\0"
+        "Counter 24 from group GCEA#\0"
+        "GCEA#_025\0"
+        "Counter 25 from group GCEA#\0"
+        "GCEA#_026\0"
+        "Counter 26 from group GCEA#\0"
+        "GCEA#_027\0"
+        "Counter 27 from group GCEA#\0"
+        "GCEA#_028\0"
+        "Counter 28 from group GCEA#\0"
+        "GCEA#_029\0"
+        "Counter 29 from group GCEA#\0"
+        "GCEA#_030\0"
+        "Counter 30 from group GCEA#\0"
+        "GCEA#_031\0"
+        "Counter 31 from group GCEA#\0"
+        "GCEA#_032\0"
+        "Counter 32 from group GCEA#\0"
+        "GCEA#_033\0"
+        "Counter 33 from group GCEA#\0"
+        "GCEA#_034\0"
+        "Counter 34 from group GCEA#\0"
+        "GCEA#_035\0"
+        "Counter 35 from group GCEA#\0"
+        "GCEA#_036\0"
+        "Counter 36 from group GCEA#\0"
+        "GCEA#_037\0"
+        "Counter 37 from group GCEA#\0"
+        "GCEA#_038\0"
+        "Counter 38 from group GCEA#\0"
+        "GCEA#_039\0"
+        "Counter 39 from group GCEA#\0"
+        "GCEA#_040\0"
+        "Counter 40 from group GCEA#\0"
+        "GCEA#_041\0"
+        "Counter 41 from group GCEA#\0"
+        "GCEA#_042\0"
+        "Counter 42 from group GCEA#\0"
+        "GCEA#_043\0"
+        "Counter 43 from group GCEA#\0"
+        "GCEA#_044\0"
+        "Counter 44 from group GCEA#\0"
+        "GCEA#_045\0"
+        "Counter 45 from group GCEA#\0"
+        "GCEA#_046\0"
+        "Counter 46 from group GCEA#\0"
+        "GCEA#_047\0"
+        "Counter 47 from group GCEA#\0"
+        "GCEA#_048\0"
+        "Counter 48 from group GCEA#\0"
+        "GCEA#_049\0"
+        "Counter 49 from group GCEA#\0"
+        "GCEA#_050\0"
+        "Counter 50 from group GCEA#\0"
+        "GCEA#_051\0"
+        "Counter 51 from group GCEA#\0"
+        "GCEA#_052\0"
+        "Counter 52 from group GCEA#\0"
+        "GCEA#_053\0"
+        "Counter 53 from group GCEA#\0"
+        "GCEA#_054\0"
+        "Counter 54 from group GCEA#\0"
+        "GCEA#_PERF_SEL_SARB_DRAM_SIZED_REQUESTS\0"
+        "DRAM sized (in 32 byte increments) requests\0"
+        "GCEA#_056\0"
+        "Counter 56 from group GCEA#\0"
+        "GCEA#_PERF_SEL_SARB_IO_SIZED_REQUESTS\0"
+        "I/O sized (in 32 byte increments) requests\0"
+        "GCEA#_058\0"
+        "Counter 58 from group GCEA#\0"
+        "GCEA#_059\0"
+        "Counter 59 from group GCEA#\0"
+        "GCEA#_060\0"
+        "Counter 60 from group GCEA#\0"
+        "GCEA#_061\0"
+        "Counter 61 from group GCEA#\0"
+        "GCEA#_062\0"
+        "Counter 62 from group GCEA#\0"
+        "GCEA#_063\0"
+        "Counter 63 from group GCEA#\0"
+        "GCEA#_064\0"
+        "Counter 64 from group GCEA#\0"
+        "GCEA#_065\0"
+        "Counter 65 from group GCEA#\0"
+        "GCEA#_066\0"
+        "Counter 66 from group GCEA#\0"
+        "GCEA#_067\0"
+        "Counter 67 from group GCEA#\0"
+        "GCEA#_068\0"
+        "Counter 68 from group GCEA#\0"
+        "GCEA#_069\0"
+        "Counter 69 from group GCEA#\0"
+        "GCEA#_070\0"
+        "Counter 70 from group GCEA#\0"
+        "GCEA#_071\0"
+        "Counter 71 from group GCEA#\0"
+        "GCEA#_072\0"
+        "Counter 72 from group GCEA#\0"
+        "GCEA#_073\0"
+        "Counter 73 from group GCEA#\0"
+        "GCEA#_074\0"
+        "Counter 74 from group GCEA#\0"
+        "GCEA#_075\0"
+        "Counter 75 from group GCEA#\0"
+        "GCEA#_076\0"
+        "Counter 76 from group GCEA#\0"
+        "GCEA#_077\0"
+        "Counter 77 from group GCEA#\0"
+        "GCEA#_078\0"
+        "Counter 78 from group GCEA#\0"
+        "GCEA#_079\0"
+        "Counter 79 from group GCEA#\0"
+        "GCEA#_080\0"
+        "Counter 80 from group GCEA#\0"
+        "GCEA#_081\0"
+        "Counter 81 from group GCEA#\0"
+        "GCEA#_082\0"
+        "Counter 82 from group GCEA#");
+
+    const GPA_HardwareBlockCounterDesc gcea_block_counters_gfx9_placeholder4[] = {
+        {GPA_HIDE_NAME_OFFSET(7), GPA_HIDE_NAME_OFFSET(17)},
+        {GPA_HIDE_NAME_OFFSET(44), GPA_HIDE_NAME_OFFSET(54)},
+        {GPA_HIDE_NAME_OFFSET(81), GPA_HIDE_NAME_OFFSET(91)},
+        {GPA_HIDE_NAME_OFFSET(118), GPA_HIDE_NAME_OFFSET(128)},
+        {GPA_HIDE_NAME_OFFSET(155), GPA_HIDE_NAME_OFFSET(165)},
+        {GPA_HIDE_NAME_OFFSET(192), GPA_HIDE_NAME_OFFSET(202)},
+        {GPA_HIDE_NAME_OFFSET(229), GPA_HIDE_NAME_OFFSET(239)},
+        {GPA_HIDE_NAME_OFFSET(266), GPA_HIDE_NAME_OFFSET(276)},
+        {GPA_HIDE_NAME_OFFSET(303), GPA_HIDE_NAME_OFFSET(313)},
+        {GPA_HIDE_NAME_OFFSET(340), GPA_HIDE_NAME_OFFSET(350)},
+        {GPA_HIDE_NAME_OFFSET(377), GPA_HIDE_NAME_OFFSET(387)},
+        {GPA_HIDE_NAME_OFFSET(415), GPA_HIDE_NAME_OFFSET(425)},
+        {GPA_HIDE_NAME_OFFSET(453), GPA_HIDE_NAME_OFFSET(463)},
+        {GPA_HIDE_NAME_OFFSET(491), GPA_HIDE_NAME_OFFSET(501)},
+        {GPA_HIDE_NAME_OFFSET(529), GPA_HIDE_NAME_OFFSET(539)},
+        {GPA_HIDE_NAME_OFFSET(567), GPA_HIDE_NAME_OFFSET(577)},
+        {GPA_HIDE_NAME_OFFSET(605), GPA_HIDE_NAME_OFFSET(615)},
+        {GPA_HIDE_NAME_OFFSET(643), GPA_HIDE_NAME_OFFSET(653)},
+        {GPA_HIDE_NAME_OFFSET(681), GPA_HIDE_NAME_OFFSET(691)},
+        {GPA_HIDE_NAME_OFFSET(719), GPA_HIDE_NAME_OFFSET(729)},
+        {GPA_HIDE_NAME_OFFSET(757), GPA_HIDE_NAME_OFFSET(767)},
+        {GPA_HIDE_NAME_OFFSET(795), GPA_HIDE_NAME_OFFSET(805)},
+        {GPA_HIDE_NAME_OFFSET(833), GPA_HIDE_NAME_OFFSET(843)},
+        {GPA_HIDE_NAME_OFFSET(871), GPA_HIDE_NAME_OFFSET(881)},
+        {GPA_HIDE_NAME_OFFSET(909), GPA_HIDE_NAME_OFFSET(919)},
+        {GPA_HIDE_NAME_OFFSET(947), GPA_HIDE_NAME_OFFSET(957)},
+        {GPA_HIDE_NAME_OFFSET(985), GPA_HIDE_NAME_OFFSET(995)},
+        {GPA_HIDE_NAME_OFFSET(1023), GPA_HIDE_NAME_OFFSET(1033)},
+        {GPA_HIDE_NAME_OFFSET(1061), GPA_HIDE_NAME_OFFSET(1071)},
+        {GPA_HIDE_NAME_OFFSET(1099), GPA_HIDE_NAME_OFFSET(1109)},
+        {GPA_HIDE_NAME_OFFSET(1137), GPA_HIDE_NAME_OFFSET(1147)},
+        {GPA_HIDE_NAME_OFFSET(1175), GPA_HIDE_NAME_OFFSET(1185)},
+        {GPA_HIDE_NAME_OFFSET(1213), GPA_HIDE_NAME_OFFSET(1223)},
+        {GPA_HIDE_NAME_OFFSET(1251), GPA_HIDE_NAME_OFFSET(1261)},
+        {GPA_HIDE_NAME_OFFSET(1289), GPA_HIDE_NAME_OFFSET(1299)},
+        {GPA_HIDE_NAME_OFFSET(1327), GPA_HIDE_NAME_OFFSET(1337)},
+        {GPA_HIDE_NAME_OFFSET(1365), GPA_HIDE_NAME_OFFSET(1375)},
+        {GPA_HIDE_NAME_OFFSET(1403), GPA_HIDE_NAME_OFFSET(1413)},
+        {GPA_HIDE_NAME_OFFSET(1441), GPA_HIDE_NAME_OFFSET(1451)},
+        {GPA_HIDE_NAME_OFFSET(1479), GPA_HIDE_NAME_OFFSET(1489)},
+        {GPA_HIDE_NAME_OFFSET(1517), GPA_HIDE_NAME_OFFSET(1527)},
+        {GPA_HIDE_NAME_OFFSET(1555), GPA_HIDE_NAME_OFFSET(1565)},
+        {GPA_HIDE_NAME_OFFSET(1593), GPA_HIDE_NAME_OFFSET(1603)},
+        {GPA_HIDE_NAME_OFFSET(1631), GPA_HIDE_NAME_OFFSET(1641)},
+        {GPA_HIDE_NAME_OFFSET(1669), GPA_HIDE_NAME_OFFSET(1679)},
+        {GPA_HIDE_NAME_OFFSET(1707), GPA_HIDE_NAME_OFFSET(1717)},
+        {GPA_HIDE_NAME_OFFSET(1745), GPA_HIDE_NAME_OFFSET(1755)},
+        {GPA_HIDE_NAME_OFFSET(1783), GPA_HIDE_NAME_OFFSET(1793)},
+        {GPA_HIDE_NAME_OFFSET(1821), GPA_HIDE_NAME_OFFSET(1831)},
+        {GPA_HIDE_NAME_OFFSET(1859), GPA_HIDE_NAME_OFFSET(1869)},
+        {GPA_HIDE_NAME_OFFSET(1897), GPA_HIDE_NAME_OFFSET(1907)},
+        {GPA_HIDE_NAME_OFFSET(1935), GPA_HIDE_NAME_OFFSET(1945)},
+        {GPA_HIDE_NAME_OFFSET(1973), GPA_HIDE_NAME_OFFSET(1983)},
+        {GPA_HIDE_NAME_OFFSET(2011), GPA_HIDE_NAME_OFFSET(2021)},
+        {GPA_HIDE_NAME_OFFSET(2049), GPA_HIDE_NAME_OFFSET(2059)},
+        {GPA_HIDE_NAME_OFFSET(2087), GPA_HIDE_NAME_OFFSET(2127)},
+        {GPA_HIDE_NAME_OFFSET(2171), GPA_HIDE_NAME_OFFSET(2181)},
+        {GPA_HIDE_NAME_OFFSET(2209), GPA_HIDE_NAME_OFFSET(2247)},
+        {GPA_HIDE_NAME_OFFSET(2290), GPA_HIDE_NAME_OFFSET(2300)},
+        {GPA_HIDE_NAME_OFFSET(2328), GPA_HIDE_NAME_OFFSET(2338)},
+        {GPA_HIDE_NAME_OFFSET(2366), GPA_HIDE_NAME_OFFSET(2376)},
+        {GPA_HIDE_NAME_OFFSET(2404), GPA_HIDE_NAME_OFFSET(2414)},
+        {GPA_HIDE_NAME_OFFSET(2442), GPA_HIDE_NAME_OFFSET(2452)},
+        {GPA_HIDE_NAME_OFFSET(2480), GPA_HIDE_NAME_OFFSET(2490)},
+        {GPA_HIDE_NAME_OFFSET(2518), GPA_HIDE_NAME_OFFSET(2528)},
+        {GPA_HIDE_NAME_OFFSET(2556), GPA_HIDE_NAME_OFFSET(2566)},
+        {GPA_HIDE_NAME_OFFSET(2594), GPA_HIDE_NAME_OFFSET(2604)},
+        {GPA_HIDE_NAME_OFFSET(2632), GPA_HIDE_NAME_OFFSET(2642)},
+        {GPA_HIDE_NAME_OFFSET(2670), GPA_HIDE_NAME_OFFSET(2680)},
+        {GPA_HIDE_NAME_OFFSET(2708), GPA_HIDE_NAME_OFFSET(2718)},
+        {GPA_HIDE_NAME_OFFSET(2746), GPA_HIDE_NAME_OFFSET(2756)},
+        {GPA_HIDE_NAME_OFFSET(2784), GPA_HIDE_NAME_OFFSET(2794)},
+        {GPA_HIDE_NAME_OFFSET(2822), GPA_HIDE_NAME_OFFSET(2832)},
+        {GPA_HIDE_NAME_OFFSET(2860), GPA_HIDE_NAME_OFFSET(2870)},
+        {GPA_HIDE_NAME_OFFSET(2898), GPA_HIDE_NAME_OFFSET(2908)},
+        {GPA_HIDE_NAME_OFFSET(2936), GPA_HIDE_NAME_OFFSET(2946)},
+        {GPA_HIDE_NAME_OFFSET(2974), GPA_HIDE_NAME_OFFSET(2984)},
+        {GPA_HIDE_NAME_OFFSET(3012), GPA_HIDE_NAME_OFFSET(3022)},
+        {GPA_HIDE_NAME_OFFSET(3050), GPA_HIDE_NAME_OFFSET(3060)},
+        {GPA_HIDE_NAME_OFFSET(3088), GPA_HIDE_NAME_OFFSET(3098)},
+        {GPA_HIDE_NAME_OFFSET(3126), GPA_HIDE_NAME_OFFSET(3136)},
+        {GPA_HIDE_NAME_OFFSET(3164), GPA_HIDE_NAME_OFFSET(3174)},
+        {GPA_HIDE_NAME_OFFSET(3202), GPA_HIDE_NAME_OFFSET(3212)},
     };
+
+    const GPA_HardwareBlockDesc gcea_block_gfx9_placeholder4 = {gcea_strings_gfx9_placeholder4, GPA_HIDE_NAME_OFFSET(1), 16, 83, gcea_block_counters_gfx9_placeholder4};
 } // countergfx9placeholder4
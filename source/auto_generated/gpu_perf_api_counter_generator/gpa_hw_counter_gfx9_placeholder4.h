@@ -13,6 +13,7 @@
 #include <set>
 
 struct GPA_HardwareCounterDesc;
+struct GPA_HardwareBlockDesc;
 #include "gpa_hw_counter_gfx9.h"
 
 namespace countergfx9placeholder4
@@ -32,42 +33,19 @@ inline bool MatchAsic(GDT_HW_ASIC_TYPE asic_type)
     return true;
 }
 
-    extern GPA_HardwareCounterDesc pa_su0_counters_gfx9_placeholder4[]; ///< Array of internal counters for pa_su0 block for gfx9_placeholder4 family
-    extern GPA_HardwareCounterDesc pa_su1_counters_gfx9_placeholder4[]; ///< Array of internal counters for pa_su1 block for gfx9_placeholder4 family
-    extern GPA_HardwareCounterDesc pa_su2_counters_gfx9_placeholder4[]; ///< Array of internal counters for pa_su2 block for gfx9_placeholder4 family
-    extern GPA_HardwareCounterDesc pa_su3_counters_gfx9_placeholder4[]; ///< Array of internal counters for pa_su3 block for gfx9_placeholder4 family
-    extern GPA_HardwareCounterDesc pa_sc0_counters_gfx9_placeholder4[]; ///< Array of internal counters for pa_sc0 block for gfx9_placeholder4 family
-    extern GPA_HardwareCounterDesc pa_sc1_counters_gfx9_placeholder4[]; ///< Array of internal counters for pa_sc1 block for gfx9_placeholder4 family
-    extern GPA_HardwareCounterDesc pa_sc2_counters_gfx9_placeholder4[]; ///< Array of internal counters for pa_sc2 block for gfx9_placeholder4 family
-    extern GPA_HardwareCounterDesc pa_sc3_counters_gfx9_placeholder4[]; ///< Array of internal counters for pa_sc3 block for gfx9_placeholder4 family
-    extern GPA_HardwareCounterDesc ia0_counters_gfx9_placeholder4[]; ///< Array of internal counters for ia0 block for gfx9_placeholder4 family
-    extern GPA_HardwareCounterDesc ia1_counters_gfx9_placeholder4[]; ///< Array of internal counters for ia1 block for gfx9_placeholder4 family
-    extern GPA_HardwareCounterDesc gcea0_counters_gfx9_placeholder4[]; ///< Array of internal counters for gcea0 block for gfx9_placeholder4 family
-    extern GPA_HardwareCounterDesc gcea1_counters_gfx9_placeholder4[]; ///< Array of internal counters for gcea1 block for gfx9_placeholder4 family
-    extern GPA_HardwareCounterDesc gcea2_counters_gfx9_placeholder4[]; ///< Array of internal counters for gcea2 block for gfx9_placeholder4 family
-    extern GPA_HardwareCounterDesc gcea3_counters_gfx9_placeholder4[]; ///< Array of internal counters for gcea3 block for gfx9_placeholder4 family
-    extern GPA_HardwareCounterDesc gcea4_counters_gfx9_placeholder4[]; ///< Array of internal counters for gcea4 block for gfx9_placeholder4 family
-    extern GPA_HardwareCounterDesc gcea5_counters_gfx9_placeholder4[]; ///< Array of internal counters for gcea5 block for gfx9_placeholder4 family
-    extern GPA_HardwareCounterDesc gcea6_counters_gfx9_placeholder4[]; ///< Array of internal counters for gcea6 block for gfx9_placeholder4 family
-    extern GPA_HardwareCounterDesc gcea7_counters_gfx9_placeholder4[]; ///< Array of internal counters for gcea7 block for gfx9_placeholder4 family
-    extern GPA_HardwareCounterDesc gcea8_counters_gfx9_placeholder4[]; ///< Array of internal counters for gcea8 block for gfx9_placeholder4 family
-    extern GPA_HardwareCounterDesc gcea9_counters_gfx9_placeholder4[]; ///< Array of internal counters for gcea9 block for gfx9_placeholder4 family
-    extern GPA_HardwareCounterDesc gcea10_counters_gfx9_placeholder4[]; ///< Array of internal counters for gcea10 block for gfx9_placeholder4 family
-    extern GPA_HardwareCounterDesc gcea11_counters_gfx9_placeholder4[]; ///< Array of internal counters for gcea11 block for gfx9_placeholder4 family
-    extern GPA_HardwareCounterDesc gcea12_counters_gfx9_placeholder4[]; ///< Array of internal counters for gcea12 block for gfx9_placeholder4 family
-    extern GPA_HardwareCounterDesc gcea13_counters_gfx9_placeholder4[]; ///< Array of internal counters for gcea13 block for gfx9_placeholder4 family
-    extern GPA_HardwareCounterDesc gcea14_counters_gfx9_placeholder4[]; ///< Array of internal counters for gcea14 block for gfx9_placeholder4 family
-    extern GPA_HardwareCounterDesc gcea15_counters_gfx9_placeholder4[]; ///< Array of internal counters for gcea15 block for gfx9_placeholder4 family
-
-/// Replaces count number of block instance counters at the destination with the overriding source counters.
-/// \param dest_counter Destination to update.
-/// \param src_counter Source to update from.
-/// \param count Number of counters to update.
-inline void ReplaceBlockInstanceCounters(GPA_HardwareCounterDesc* dest_counter, GPA_HardwareCounterDesc* src_counter, uint32_t count)
+    extern const GPA_HardwareBlockDesc pa_su_block_gfx9_placeholder4; ///< Internal counters of the pa_su block for gfx9_placeholder4 family, shared by its 4 instances
+    extern const GPA_HardwareBlockDesc pa_sc_block_gfx9_placeholder4; ///< Internal counters of the pa_sc block for gfx9_placeholder4 family, shared by its 4 instances
+    extern const GPA_HardwareBlockDesc ia_block_gfx9_placeholder4; ///< Internal counters of the ia block for gfx9_placeholder4 family, shared by its 2 instances
+    extern const GPA_HardwareBlockDesc gcea_block_gfx9_placeholder4; ///< Internal counters of the gcea block for gfx9_placeholder4 family, shared by its 16 instances
+
+/// Replaces the counters of every instance of a block with the overriding counters of the block.
+/// \param dest_instances Destination counters of each block instance to update.
+/// \param block Block to update from.
+inline void ReplaceBlockInstanceCounters(GPA_HardwareCounterDesc* const* dest_instances, const GPA_HardwareBlockDesc& block)
 {
-    for (uint32_t i = 0; i < count; i++)
+    for (uint32_t i = 0; i < block.m_numInstances; i++)
     {
-        dest_counter[i] = src_counter[i];
+        ExpandHardwareBlockCounters(block, dest_instances[i]);
     }
 }
 
@@ -81,32 +59,47 @@ inline bool OverrideBlockInstanceCounters(GDT_HW_ASIC_TYPE asic_type)
         return false;
     }
 
-    ReplaceBlockInstanceCounters(countergfx9::pa_su0_counters_gfx9, pa_su0_counters_gfx9_placeholder4, 351);
-    ReplaceBlockInstanceCounters(countergfx9::pa_su1_counters_gfx9, pa_su1_counters_gfx9_placeholder4, 351);
-    ReplaceBlockInstanceCounters(countergfx9::pa_su2_counters_gfx9, pa_su2_counters_gfx9_placeholder4, 351);
-    ReplaceBlockInstanceCounters(countergfx9::pa_su3_counters_gfx9, pa_su3_counters_gfx9_placeholder4, 351);
-    ReplaceBlockInstanceCounters(countergfx9::pa_sc0_counters_gfx9, pa_sc0_counters_gfx9_placeholder4, 492);
-    ReplaceBlockInstanceCounters(countergfx9::pa_sc1_counters_gfx9, pa_sc1_counters_gfx9_placeholder4, 492);
-    ReplaceBlockInstanceCounters(countergfx9::pa_sc2_counters_gfx9, pa_sc2_counters_gfx9_placeholder4, 492);
-    ReplaceBlockInstanceCounters(countergfx9::pa_sc3_counters_gfx9, pa_sc3_counters_gfx9_placeholder4, 492);
-    ReplaceBlockInstanceCounters(countergfx9::ia0_counters_gfx9, ia0_counters_gfx9_placeholder4, 31);
-    ReplaceBlockInstanceCounters(countergfx9::ia1_counters_gfx9, ia1_counters_gfx9_placeholder4, 31);
-    ReplaceBlockInstanceCounters(countergfx9::gcea0_counters_gfx9, gcea0_counters_gfx9_placeholder4, 83);
-    ReplaceBlockInstanceCounters(countergfx9::gcea1_counters_gfx9, gcea1_counters_gfx9_placeholder4, 83);
-    ReplaceBlockInstanceCounters(countergfx9::gcea2_counters_gfx9, gcea2_counters_gfx9_placeholder4, 83);
-    ReplaceBlockInstanceCounters(countergfx9::gcea3_counters_gfx9, gcea3_counters_gfx9_placeholder4, 83);
-    ReplaceBlockInstanceCounters(countergfx9::gcea4_counters_gfx9, gcea4_counters_gfx9_placeholder4, 83);
-    ReplaceBlockInstanceCounters(countergfx9::gcea5_counters_gfx9, gcea5_counters_gfx9_placeholder4, 83);
-    ReplaceBlockInstanceCounters(countergfx9::gcea6_counters_gfx9, gcea6_counters_gfx9_placeholder4, 83);
-    ReplaceBlockInstanceCounters(countergfx9::gcea7_counters_gfx9, gcea7_counters_gfx9_placeholder4, 83);
-    ReplaceBlockInstanceCounters(countergfx9::gcea8_counters_gfx9, gcea8_counters_gfx9_placeholder4, 83);
-    ReplaceBlockInstanceCounters(countergfx9::gcea9_counters_gfx9, gcea9_counters_gfx9_placeholder4, 83);
-    ReplaceBlockInstanceCounters(countergfx9::gcea10_counters_gfx9, gcea10_counters_gfx9_placeholder4, 83);
-    ReplaceBlockInstanceCounters(countergfx9::gcea11_counters_gfx9, gcea11_counters_gfx9_placeholder4, 83);
-    ReplaceBlockInstanceCounters(countergfx9::gcea12_counters_gfx9, gcea12_counters_gfx9_placeholder4, 83);
-    ReplaceBlockInstanceCounters(countergfx9::gcea13_counters_gfx9, gcea13_counters_gfx9_placeholder4, 83);
-    ReplaceBlockInstanceCounters(countergfx9::gcea14_counters_gfx9, gcea14_counters_gfx9_placeholder4, 83);
-    ReplaceBlockInstanceCounters(countergfx9::gcea15_counters_gfx9, gcea15_counters_gfx9_placeholder4, 83);
+    GPA_HardwareCounterDesc* const pa_su_instances[] = {
+        countergfx9::pa_su0_counters_gfx9,
+        countergfx9::pa_su1_counters_gfx9,
+        countergfx9::pa_su2_counters_gfx9,
+        countergfx9::pa_su3_counters_gfx9,
+    };
+    ReplaceBlockInstanceCounters(pa_su_instances, pa_su_block_gfx9_placeholder4);
+
+    GPA_HardwareCounterDesc* const pa_sc_instances[] = {
+        countergfx9::pa_sc0_counters_gfx9,
+        countergfx9::pa_sc1_counters_gfx9,
+        countergfx9::pa_sc2_counters_gfx9,
+        countergfx9::pa_sc3_counters_gfx9,
+    };
+    ReplaceBlockInstanceCounters(pa_sc_instances, pa_sc_block_gfx9_placeholder4);
+
+    GPA_HardwareCounterDesc* const ia_instances[] = {
+        countergfx9::ia0_counters_gfx9,
+        countergfx9::ia1_counters_gfx9,
+    };
+    ReplaceBlockInstanceCounters(ia_instances, ia_block_gfx9_placeholder4);
+
+    GPA_HardwareCounterDesc* const gcea_instances[] = {
+        countergfx9::gcea0_counters_gfx9,
+        countergfx9::gcea1_counters_gfx9,
+        countergfx9::gcea2_counters_gfx9,
+        countergfx9::gcea3_counters_gfx9,
+        countergfx9::gcea4_counters_gfx9,
+        countergfx9::gcea5_counters_gfx9,
+        countergfx9::gcea6_counters_gfx9,
+        countergfx9::gcea7_counters_gfx9,
+        countergfx9::gcea8_counters_gfx9,
+        countergfx9::gcea9_counters_gfx9,
+        countergfx9::gcea10_counters_gfx9,
+        countergfx9::gcea11_counters_gfx9,
+        countergfx9::gcea12_counters_gfx9,
+        countergfx9::gcea13_counters_gfx9,
+        countergfx9::gcea14_counters_gfx9,
+        countergfx9::gcea15_counters_gfx9,
+    };
+    ReplaceBlockInstanceCounters(gcea_instances, gcea_block_gfx9_placeholder4);
 
     return true;
 }
@@ -6,66 +6,688 @@
 //==============================================================================
 
 #include "gpa_counter.h"
+#include "gpa_common_defs.h"
 #include "public_counter_definitions_cl_gfx10.h"
 
 // *** Note, this is an auto-generated file. Do not edit. Execute PublicCounterCompiler to rebuild.
 
+/// Computes the Wavefronts counter: 0
+static void ComputeWavefronts(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+
+    *static_cast<gpa_float64*>(pResult) = r0;
+}
+
+/// Computes the VALUInsts counter: 0,1,/
+static void ComputeVALUInsts(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+
+    const gpa_float64 v0 = (r1 != 0.0) ? (r0 / r1) : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the SALUInsts counter: 0,1,/
+static void ComputeSALUInsts(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+
+    const gpa_float64 v0 = (r1 != 0.0) ? (r0 / r1) : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the VFetchInsts counter: 0,1,/
+static void ComputeVFetchInsts(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+
+    const gpa_float64 v0 = (r1 != 0.0) ? (r0 / r1) : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the SFetchInsts counter: 0,1,/
+static void ComputeSFetchInsts(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+
+    const gpa_float64 v0 = (r1 != 0.0) ? (r0 / r1) : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the VWriteInsts counter: 0,1,/
+static void ComputeVWriteInsts(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+
+    const gpa_float64 v0 = (r1 != 0.0) ? (r0 / r1) : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the LDSInsts counter: 0,1,/
+static void ComputeLDSInsts(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+
+    const gpa_float64 v0 = (r1 != 0.0) ? (r0 / r1) : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the GDSInsts counter: 0,1,/
+static void ComputeGDSInsts(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+
+    const gpa_float64 v0 = (r1 != 0.0) ? (r0 / r1) : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the VALUUtilization counter: 0,1,(64),(32),2,ifnotzero,*,/,(100),*,(100),min
+static void ComputeVALUUtilization(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+
+    const gpa_float64 v0 = (r2 != 0.0) ? 32.0 : 64.0;
+    const gpa_float64 v1 = r1 * v0;
+    const gpa_float64 v2 = (v1 != 0.0) ? (r0 / v1) : 0.0;
+    const gpa_float64 v3 = v2 * 100.0;
+    const gpa_float64 v4 = (v3 < 100.0) ? v3 : 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v4;
+}
+
+/// Computes the VALUBusy counter: 0,NUM_SIMDS,/,1,/,(100),*
+static void ComputeVALUBusy(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_simds = static_cast<gpa_float64>(pHwInfo->GetNumberSIMDs());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+
+    const gpa_float64 v0 = (num_simds != 0.0) ? (r0 / num_simds) : 0.0;
+    const gpa_float64 v1 = (r1 != 0.0) ? (v0 / r1) : 0.0;
+    const gpa_float64 v2 = v1 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v2;
+}
+
+/// Computes the SALUBusy counter: 0,NUM_CUS,/,1,/,(100),*
+static void ComputeSALUBusy(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_cus = static_cast<gpa_float64>(pHwInfo->GetNumberCUs());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+
+    const gpa_float64 v0 = (num_cus != 0.0) ? (r0 / num_cus) : 0.0;
+    const gpa_float64 v1 = (r1 != 0.0) ? (v0 / r1) : 0.0;
+    const gpa_float64 v2 = v1 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v2;
+}
+
+/// Computes the FetchSize counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,sum24,(32),*,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,sum24,(64),*,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,70,71,sum24,(96),*,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,sum24,(128),*,sum4,(1024),/
+static void ComputeFetchSize(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+    const gpa_float64 r32 = static_cast<gpa_float64>(*results[32]);
+    const gpa_float64 r33 = static_cast<gpa_float64>(*results[33]);
+    const gpa_float64 r34 = static_cast<gpa_float64>(*results[34]);
+    const gpa_float64 r35 = static_cast<gpa_float64>(*results[35]);
+    const gpa_float64 r36 = static_cast<gpa_float64>(*results[36]);
+    const gpa_float64 r37 = static_cast<gpa_float64>(*results[37]);
+    const gpa_float64 r38 = static_cast<gpa_float64>(*results[38]);
+    const gpa_float64 r39 = static_cast<gpa_float64>(*results[39]);
+    const gpa_float64 r40 = static_cast<gpa_float64>(*results[40]);
+    const gpa_float64 r41 = static_cast<gpa_float64>(*results[41]);
+    const gpa_float64 r42 = static_cast<gpa_float64>(*results[42]);
+    const gpa_float64 r43 = static_cast<gpa_float64>(*results[43]);
+    const gpa_float64 r44 = static_cast<gpa_float64>(*results[44]);
+    const gpa_float64 r45 = static_cast<gpa_float64>(*results[45]);
+    const gpa_float64 r46 = static_cast<gpa_float64>(*results[46]);
+    const gpa_float64 r47 = static_cast<gpa_float64>(*results[47]);
+    const gpa_float64 r48 = static_cast<gpa_float64>(*results[48]);
+    const gpa_float64 r49 = static_cast<gpa_float64>(*results[49]);
+    const gpa_float64 r50 = static_cast<gpa_float64>(*results[50]);
+    const gpa_float64 r51 = static_cast<gpa_float64>(*results[51]);
+    const gpa_float64 r52 = static_cast<gpa_float64>(*results[52]);
+    const gpa_float64 r53 = static_cast<gpa_float64>(*results[53]);
+    const gpa_float64 r54 = static_cast<gpa_float64>(*results[54]);
+    const gpa_float64 r55 = static_cast<gpa_float64>(*results[55]);
+    const gpa_float64 r56 = static_cast<gpa_float64>(*results[56]);
+    const gpa_float64 r57 = static_cast<gpa_float64>(*results[57]);
+    const gpa_float64 r58 = static_cast<gpa_float64>(*results[58]);
+    const gpa_float64 r59 = static_cast<gpa_float64>(*results[59]);
+    const gpa_float64 r60 = static_cast<gpa_float64>(*results[60]);
+    const gpa_float64 r61 = static_cast<gpa_float64>(*results[61]);
+    const gpa_float64 r62 = static_cast<gpa_float64>(*results[62]);
+    const gpa_float64 r63 = static_cast<gpa_float64>(*results[63]);
+    const gpa_float64 r64 = static_cast<gpa_float64>(*results[64]);
+    const gpa_float64 r65 = static_cast<gpa_float64>(*results[65]);
+    const gpa_float64 r66 = static_cast<gpa_float64>(*results[66]);
+    const gpa_float64 r67 = static_cast<gpa_float64>(*results[67]);
+    const gpa_float64 r68 = static_cast<gpa_float64>(*results[68]);
+    const gpa_float64 r69 = static_cast<gpa_float64>(*results[69]);
+    const gpa_float64 r70 = static_cast<gpa_float64>(*results[70]);
+    const gpa_float64 r71 = static_cast<gpa_float64>(*results[71]);
+    const gpa_float64 r72 = static_cast<gpa_float64>(*results[72]);
+    const gpa_float64 r73 = static_cast<gpa_float64>(*results[73]);
+    const gpa_float64 r74 = static_cast<gpa_float64>(*results[74]);
+    const gpa_float64 r75 = static_cast<gpa_float64>(*results[75]);
+    const gpa_float64 r76 = static_cast<gpa_float64>(*results[76]);
+    const gpa_float64 r77 = static_cast<gpa_float64>(*results[77]);
+    const gpa_float64 r78 = static_cast<gpa_float64>(*results[78]);
+    const gpa_float64 r79 = static_cast<gpa_float64>(*results[79]);
+    const gpa_float64 r80 = static_cast<gpa_float64>(*results[80]);
+    const gpa_float64 r81 = static_cast<gpa_float64>(*results[81]);
+    const gpa_float64 r82 = static_cast<gpa_float64>(*results[82]);
+    const gpa_float64 r83 = static_cast<gpa_float64>(*results[83]);
+    const gpa_float64 r84 = static_cast<gpa_float64>(*results[84]);
+    const gpa_float64 r85 = static_cast<gpa_float64>(*results[85]);
+    const gpa_float64 r86 = static_cast<gpa_float64>(*results[86]);
+    const gpa_float64 r87 = static_cast<gpa_float64>(*results[87]);
+    const gpa_float64 r88 = static_cast<gpa_float64>(*results[88]);
+    const gpa_float64 r89 = static_cast<gpa_float64>(*results[89]);
+    const gpa_float64 r90 = static_cast<gpa_float64>(*results[90]);
+    const gpa_float64 r91 = static_cast<gpa_float64>(*results[91]);
+    const gpa_float64 r92 = static_cast<gpa_float64>(*results[92]);
+    const gpa_float64 r93 = static_cast<gpa_float64>(*results[93]);
+    const gpa_float64 r94 = static_cast<gpa_float64>(*results[94]);
+    const gpa_float64 r95 = static_cast<gpa_float64>(*results[95]);
+
+    const gpa_float64 v0 = r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16 + r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = v0 * 32.0;
+    const gpa_float64 v2 = r47 + r46 + r45 + r44 + r43 + r42 + r41 + r40 + r39 + r38 + r37 + r36 + r35 + r34 + r33 + r32 + r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24;
+    const gpa_float64 v3 = v2 * 64.0;
+    const gpa_float64 v4 = r71 + r70 + r69 + r68 + r67 + r66 + r65 + r64 + r63 + r62 + r61 + r60 + r59 + r58 + r57 + r56 + r55 + r54 + r53 + r52 + r51 + r50 + r49 + r48;
+    const gpa_float64 v5 = v4 * 96.0;
+    const gpa_float64 v6 = r95 + r94 + r93 + r92 + r91 + r90 + r89 + r88 + r87 + r86 + r85 + r84 + r83 + r82 + r81 + r80 + r79 + r78 + r77 + r76 + r75 + r74 + r73 + r72;
+    const gpa_float64 v7 = v6 * 128.0;
+    const gpa_float64 v8 = v7 + v5 + v3 + v1;
+    const gpa_float64 v9 = (1024.0 != 0.0) ? (v8 / 1024.0) : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v9;
+}
+
+/// Computes the WriteSize counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,sum24,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,sum24,-,(32),*,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,sum24,(64),*,+,(1024),/
+static void ComputeWriteSize(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+    const gpa_float64 r32 = static_cast<gpa_float64>(*results[32]);
+    const gpa_float64 r33 = static_cast<gpa_float64>(*results[33]);
+    const gpa_float64 r34 = static_cast<gpa_float64>(*results[34]);
+    const gpa_float64 r35 = static_cast<gpa_float64>(*results[35]);
+    const gpa_float64 r36 = static_cast<gpa_float64>(*results[36]);
+    const gpa_float64 r37 = static_cast<gpa_float64>(*results[37]);
+    const gpa_float64 r38 = static_cast<gpa_float64>(*results[38]);
+    const gpa_float64 r39 = static_cast<gpa_float64>(*results[39]);
+    const gpa_float64 r40 = static_cast<gpa_float64>(*results[40]);
+    const gpa_float64 r41 = static_cast<gpa_float64>(*results[41]);
+    const gpa_float64 r42 = static_cast<gpa_float64>(*results[42]);
+    const gpa_float64 r43 = static_cast<gpa_float64>(*results[43]);
+    const gpa_float64 r44 = static_cast<gpa_float64>(*results[44]);
+    const gpa_float64 r45 = static_cast<gpa_float64>(*results[45]);
+    const gpa_float64 r46 = static_cast<gpa_float64>(*results[46]);
+    const gpa_float64 r47 = static_cast<gpa_float64>(*results[47]);
+
+    const gpa_float64 v0 = r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16 + r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r47 + r46 + r45 + r44 + r43 + r42 + r41 + r40 + r39 + r38 + r37 + r36 + r35 + r34 + r33 + r32 + r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24;
+    const gpa_float64 v2 = v0 - v1;
+    const gpa_float64 v3 = v2 * 32.0;
+    const gpa_float64 v4 = r47 + r46 + r45 + r44 + r43 + r42 + r41 + r40 + r39 + r38 + r37 + r36 + r35 + r34 + r33 + r32 + r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24;
+    const gpa_float64 v5 = v4 * 64.0;
+    const gpa_float64 v6 = v3 + v5;
+    const gpa_float64 v7 = (1024.0 != 0.0) ? (v6 / 1024.0) : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v7;
+}
+
+/// Computes the L0CacheHit counter: (0),(1),16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,/,-,(100),*,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,ifnotzero
+static void ComputeL0CacheHit(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+
+    const gpa_float64 v0 = r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16;
+    const gpa_float64 v1 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v2 = (v1 != 0.0) ? (v0 / v1) : 0.0;
+    const gpa_float64 v3 = 1.0 - v2;
+    const gpa_float64 v4 = v3 * 100.0;
+    const gpa_float64 v5 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v6 = (v5 != 0.0) ? v4 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v6;
+}
+
+/// Computes the L1CacheHit counter: (0),(1),1,0,/,-,(100),*,0,ifnotzero
+static void ComputeL1CacheHit(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+
+    const gpa_float64 v0 = (r0 != 0.0) ? (r1 / r0) : 0.0;
+    const gpa_float64 v1 = 1.0 - v0;
+    const gpa_float64 v2 = v1 * 100.0;
+    const gpa_float64 v3 = (r0 != 0.0) ? v2 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v3;
+}
+
+/// Computes the L2CacheHit counter: (0),(1),24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,sum24,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,sum24,/,-,(100),*,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,sum24,ifnotzero
+static void ComputeL2CacheHit(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+    const gpa_float64 r32 = static_cast<gpa_float64>(*results[32]);
+    const gpa_float64 r33 = static_cast<gpa_float64>(*results[33]);
+    const gpa_float64 r34 = static_cast<gpa_float64>(*results[34]);
+    const gpa_float64 r35 = static_cast<gpa_float64>(*results[35]);
+    const gpa_float64 r36 = static_cast<gpa_float64>(*results[36]);
+    const gpa_float64 r37 = static_cast<gpa_float64>(*results[37]);
+    const gpa_float64 r38 = static_cast<gpa_float64>(*results[38]);
+    const gpa_float64 r39 = static_cast<gpa_float64>(*results[39]);
+    const gpa_float64 r40 = static_cast<gpa_float64>(*results[40]);
+    const gpa_float64 r41 = static_cast<gpa_float64>(*results[41]);
+    const gpa_float64 r42 = static_cast<gpa_float64>(*results[42]);
+    const gpa_float64 r43 = static_cast<gpa_float64>(*results[43]);
+    const gpa_float64 r44 = static_cast<gpa_float64>(*results[44]);
+    const gpa_float64 r45 = static_cast<gpa_float64>(*results[45]);
+    const gpa_float64 r46 = static_cast<gpa_float64>(*results[46]);
+    const gpa_float64 r47 = static_cast<gpa_float64>(*results[47]);
+
+    const gpa_float64 v0 = r47 + r46 + r45 + r44 + r43 + r42 + r41 + r40 + r39 + r38 + r37 + r36 + r35 + r34 + r33 + r32 + r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24;
+    const gpa_float64 v1 = r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16 + r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v2 = (v1 != 0.0) ? (v0 / v1) : 0.0;
+    const gpa_float64 v3 = 1.0 - v2;
+    const gpa_float64 v4 = v3 * 100.0;
+    const gpa_float64 v5 = r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16 + r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v6 = (v5 != 0.0) ? v4 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v6;
+}
+
+/// Computes the MemUnitBusy counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16,16,/,NUM_SHADER_ARRAYS,/,(100),*
+static void ComputeMemUnitBusy(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_shader_arrays = static_cast<gpa_float64>(pHwInfo->GetNumberShaderArrays());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+
+    const gpa_float64 v0 = (r15 > r14) ? r15 : r14;
+    const gpa_float64 v1 = (v0 > r13) ? v0 : r13;
+    const gpa_float64 v2 = (v1 > r12) ? v1 : r12;
+    const gpa_float64 v3 = (v2 > r11) ? v2 : r11;
+    const gpa_float64 v4 = (v3 > r10) ? v3 : r10;
+    const gpa_float64 v5 = (v4 > r9) ? v4 : r9;
+    const gpa_float64 v6 = (v5 > r8) ? v5 : r8;
+    const gpa_float64 v7 = (v6 > r7) ? v6 : r7;
+    const gpa_float64 v8 = (v7 > r6) ? v7 : r6;
+    const gpa_float64 v9 = (v8 > r5) ? v8 : r5;
+    const gpa_float64 v10 = (v9 > r4) ? v9 : r4;
+    const gpa_float64 v11 = (v10 > r3) ? v10 : r3;
+    const gpa_float64 v12 = (v11 > r2) ? v11 : r2;
+    const gpa_float64 v13 = (v12 > r1) ? v12 : r1;
+    const gpa_float64 v14 = (v13 > r0) ? v13 : r0;
+    const gpa_float64 v15 = (r16 != 0.0) ? (v14 / r16) : 0.0;
+    const gpa_float64 v16 = (num_shader_arrays != 0.0) ? (v15 / num_shader_arrays) : 0.0;
+    const gpa_float64 v17 = v16 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v17;
+}
+
+/// Computes the MemUnitStalled counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16,16,/,NUM_SHADER_ARRAYS,/,(100),*
+static void ComputeMemUnitStalled(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_shader_arrays = static_cast<gpa_float64>(pHwInfo->GetNumberShaderArrays());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+
+    const gpa_float64 v0 = (r15 > r14) ? r15 : r14;
+    const gpa_float64 v1 = (v0 > r13) ? v0 : r13;
+    const gpa_float64 v2 = (v1 > r12) ? v1 : r12;
+    const gpa_float64 v3 = (v2 > r11) ? v2 : r11;
+    const gpa_float64 v4 = (v3 > r10) ? v3 : r10;
+    const gpa_float64 v5 = (v4 > r9) ? v4 : r9;
+    const gpa_float64 v6 = (v5 > r8) ? v5 : r8;
+    const gpa_float64 v7 = (v6 > r7) ? v6 : r7;
+    const gpa_float64 v8 = (v7 > r6) ? v7 : r6;
+    const gpa_float64 v9 = (v8 > r5) ? v8 : r5;
+    const gpa_float64 v10 = (v9 > r4) ? v9 : r4;
+    const gpa_float64 v11 = (v10 > r3) ? v10 : r3;
+    const gpa_float64 v12 = (v11 > r2) ? v11 : r2;
+    const gpa_float64 v13 = (v12 > r1) ? v12 : r1;
+    const gpa_float64 v14 = (v13 > r0) ? v13 : r0;
+    const gpa_float64 v15 = (r16 != 0.0) ? (v14 / r16) : 0.0;
+    const gpa_float64 v16 = (num_shader_arrays != 0.0) ? (v15 / num_shader_arrays) : 0.0;
+    const gpa_float64 v17 = v16 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v17;
+}
+
+/// Computes the WriteUnitStalled counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,max24,24,/,(100),*
+static void ComputeWriteUnitStalled(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+
+    const gpa_float64 v0 = (r23 > r22) ? r23 : r22;
+    const gpa_float64 v1 = (v0 > r21) ? v0 : r21;
+    const gpa_float64 v2 = (v1 > r20) ? v1 : r20;
+    const gpa_float64 v3 = (v2 > r19) ? v2 : r19;
+    const gpa_float64 v4 = (v3 > r18) ? v3 : r18;
+    const gpa_float64 v5 = (v4 > r17) ? v4 : r17;
+    const gpa_float64 v6 = (v5 > r16) ? v5 : r16;
+    const gpa_float64 v7 = (v6 > r15) ? v6 : r15;
+    const gpa_float64 v8 = (v7 > r14) ? v7 : r14;
+    const gpa_float64 v9 = (v8 > r13) ? v8 : r13;
+    const gpa_float64 v10 = (v9 > r12) ? v9 : r12;
+    const gpa_float64 v11 = (v10 > r11) ? v10 : r11;
+    const gpa_float64 v12 = (v11 > r10) ? v11 : r10;
+    const gpa_float64 v13 = (v12 > r9) ? v12 : r9;
+    const gpa_float64 v14 = (v13 > r8) ? v13 : r8;
+    const gpa_float64 v15 = (v14 > r7) ? v14 : r7;
+    const gpa_float64 v16 = (v15 > r6) ? v15 : r6;
+    const gpa_float64 v17 = (v16 > r5) ? v16 : r5;
+    const gpa_float64 v18 = (v17 > r4) ? v17 : r4;
+    const gpa_float64 v19 = (v18 > r3) ? v18 : r3;
+    const gpa_float64 v20 = (v19 > r2) ? v19 : r2;
+    const gpa_float64 v21 = (v20 > r1) ? v20 : r1;
+    const gpa_float64 v22 = (v21 > r0) ? v21 : r0;
+    const gpa_float64 v23 = (r24 != 0.0) ? (v22 / r24) : 0.0;
+    const gpa_float64 v24 = v23 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v24;
+}
+
+/// Computes the LDSBankConflict counter: 0,1,/,NUM_SIMDS,/,(100),*
+static void ComputeLDSBankConflict(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_simds = static_cast<gpa_float64>(pHwInfo->GetNumberSIMDs());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+
+    const gpa_float64 v0 = (r1 != 0.0) ? (r0 / r1) : 0.0;
+    const gpa_float64 v1 = (num_simds != 0.0) ? (v0 / num_simds) : 0.0;
+    const gpa_float64 v2 = v1 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v2;
+}
+
 void AutoDefinePublicDerivedCountersCLGfx10(GPA_DerivedCounters& c)
 {
     {
         vector<gpa_uint32> internalCounters;
         internalCounters.push_back(5133);
 
-        c.DefineDerivedCounter("Wavefronts", "General", "Total wavefronts.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0", "e8999836-489d-80a6-8e94-2c3ea191fd58");
+        c.DefineDerivedCounter("Wavefronts", "General", "Total wavefronts.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0", "e8999836-489d-80a6-8e94-2c3ea191fd58", ComputeWavefronts);
     }
     {
         vector<gpa_uint32> internalCounters;
         internalCounters.push_back(5193);
         internalCounters.push_back(5133);
 
-        c.DefineDerivedCounter("VALUInsts", "General", "The average number of vector ALU instructions executed per work-item (affected by flow control).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,/", "17c27c10-3d5c-64c2-e7b4-4ee1abdbbb46");
+        c.DefineDerivedCounter("VALUInsts", "General", "The average number of vector ALU instructions executed per work-item (affected by flow control).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,/", "17c27c10-3d5c-64c2-e7b4-4ee1abdbbb46", ComputeVALUInsts);
     }
     {
         vector<gpa_uint32> internalCounters;
         internalCounters.push_back(5189);
         internalCounters.push_back(5133);
 
-        c.DefineDerivedCounter("SALUInsts", "General", "The average number of scalar ALU instructions executed per work-item (affected by flow control).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,/", "e5693881-8d63-951d-1f4f-f9e4c84236f5");
+        c.DefineDerivedCounter("SALUInsts", "General", "The average number of scalar ALU instructions executed per work-item (affected by flow control).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,/", "e5693881-8d63-951d-1f4f-f9e4c84236f5", ComputeSALUInsts);
     }
     {
         vector<gpa_uint32> internalCounters;
         internalCounters.push_back(5198);
         internalCounters.push_back(5133);
 
-        c.DefineDerivedCounter("VFetchInsts", "General", "The average number of vector fetch instructions from the video memory executed per work-item (affected by flow control). Excludes FLAT instructions that fetch from video memory.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,/", "85970f8f-0b2c-6431-9e52-7999236e6e8a");
+        c.DefineDerivedCounter("VFetchInsts", "General", "The average number of vector fetch instructions from the video memory executed per work-item (affected by flow control). Excludes FLAT instructions that fetch from video memory.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,/", "85970f8f-0b2c-6431-9e52-7999236e6e8a", ComputeVFetchInsts);
     }
     {
         vector<gpa_uint32> internalCounters;
         internalCounters.push_back(5190);
         internalCounters.push_back(5133);
 
-        c.DefineDerivedCounter("SFetchInsts", "General", "The average number of scalar fetch instructions from the video memory executed per work-item (affected by flow control).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,/", "7d9e4356-a8f5-04c7-f7a8-fe68dc01c441");
+        c.DefineDerivedCounter("SFetchInsts", "General", "The average number of scalar fetch instructions from the video memory executed per work-item (affected by flow control).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,/", "7d9e4356-a8f5-04c7-f7a8-fe68dc01c441", ComputeSFetchInsts);
     }
     {
         vector<gpa_uint32> internalCounters;
         internalCounters.push_back(5199);
         internalCounters.push_back(5133);
 
-        c.DefineDerivedCounter("VWriteInsts", "General", "The average number of vector write instructions to the video memory executed per work-item (affected by flow control). Excludes FLAT instructions that write to video memory.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,/", "d8154a17-224d-704e-73d2-bb5d150f3196");
+        c.DefineDerivedCounter("VWriteInsts", "General", "The average number of vector write instructions to the video memory executed per work-item (affected by flow control). Excludes FLAT instructions that write to video memory.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,/", "d8154a17-224d-704e-73d2-bb5d150f3196", ComputeVWriteInsts);
     }
     {
         vector<gpa_uint32> internalCounters;
         internalCounters.push_back(5188);
         internalCounters.push_back(5133);
 
-        c.DefineDerivedCounter("LDSInsts", "LocalMemory", "The average number of LDS read or LDS write instructions executed per work item (affected by flow control).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,/", "852ccd67-d2eb-d238-567a-0d1f7bf5f34f");
+        c.DefineDerivedCounter("LDSInsts", "LocalMemory", "The average number of LDS read or LDS write instructions executed per work item (affected by flow control).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,/", "852ccd67-d2eb-d238-567a-0d1f7bf5f34f", ComputeLDSInsts);
     }
     {
         vector<gpa_uint32> internalCounters;
         internalCounters.push_back(5184);
         internalCounters.push_back(5133);
 
-        c.DefineDerivedCounter("GDSInsts", "General", "The average number of GDS read or GDS write instructions executed per work item (affected by flow control).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,/", "c63fc276-151e-3b88-6edb-a0c92507aadb");
+        c.DefineDerivedCounter("GDSInsts", "General", "The average number of GDS read or GDS write instructions executed per work item (affected by flow control).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,/", "c63fc276-151e-3b88-6edb-a0c92507aadb", ComputeGDSInsts);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -73,21 +695,21 @@ void AutoDefinePublicDerivedCountersCLGfx10(GPA_DerivedCounters& c)
         internalCounters.push_back(5246);
         internalCounters.push_back(5134);
 
-        c.DefineDerivedCounter("VALUUtilization", "General", "The percentage of active vector ALU threads in a wave. A lower number can mean either more thread divergence in a wave or that the work-group size is not a multiple of the wave size. Value range: 0% (bad), 100% (ideal - no thread divergence).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,(64),(32),2,ifnotzero,*,/,(100),*,(100),min", "435fc505-4d15-095e-79f1-80346bcd0a24");
+        c.DefineDerivedCounter("VALUUtilization", "General", "The percentage of active vector ALU threads in a wave. A lower number can mean either more thread divergence in a wave or that the work-group size is not a multiple of the wave size. Value range: 0% (bad), 100% (ideal - no thread divergence).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,(64),(32),2,ifnotzero,*,/,(100),*,(100),min", "435fc505-4d15-095e-79f1-80346bcd0a24", ComputeVALUUtilization);
     }
     {
         vector<gpa_uint32> internalCounters;
         internalCounters.push_back(5246);
         internalCounters.push_back(1868);
 
-        c.DefineDerivedCounter("VALUBusy", "General", "The percentage of GPUTime vector ALU instructions are processed. Value range: 0% (bad) to 100% (optimal).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,NUM_SIMDS,/,1,/,(100),*", "51800108-e003-3c1f-b92a-e224aaab3c1b");
+        c.DefineDerivedCounter("VALUBusy", "General", "The percentage of GPUTime vector ALU instructions are processed. Value range: 0% (bad) to 100% (optimal).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,NUM_SIMDS,/,1,/,(100),*", "51800108-e003-3c1f-b92a-e224aaab3c1b", ComputeVALUBusy);
     }
     {
         vector<gpa_uint32> internalCounters;
         internalCounters.push_back(5189);
         internalCounters.push_back(1868);
 
-        c.DefineDerivedCounter("SALUBusy", "General", "The percentage of GPUTime scalar ALU instructions are processed. Value range: 0% (bad) to 100% (optimal).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,NUM_CUS,/,1,/,(100),*", "f1d53e7a-0182-42f8-7d2c-6029bff6bc2d");
+        c.DefineDerivedCounter("SALUBusy", "General", "The percentage of GPUTime scalar ALU instructions are processed. Value range: 0% (bad) to 100% (optimal).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,NUM_CUS,/,1,/,(100),*", "f1d53e7a-0182-42f8-7d2c-6029bff6bc2d", ComputeSALUBusy);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -188,7 +810,7 @@ void AutoDefinePublicDerivedCountersCLGfx10(GPA_DerivedCounters& c)
         internalCounters.push_back(23779);
         internalCounters.push_back(24014);
 
-        c.DefineDerivedCounter("FetchSize", "GlobalMemory", "The total kilobytes fetched from the video memory. This is measured with all extra fetches and any cache or memory effects taken into account.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_KILOBYTES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,sum24,(32),*,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,sum24,(64),*,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,70,71,sum24,(96),*,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,sum24,(128),*,sum4,(1024),/", "d91ac445-b44f-f821-9123-9d829e544c33");
+        c.DefineDerivedCounter("FetchSize", "GlobalMemory", "The total kilobytes fetched from the video memory. This is measured with all extra fetches and any cache or memory effects taken into account.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_KILOBYTES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,sum24,(32),*,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,sum24,(64),*,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,70,71,sum24,(96),*,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,sum24,(128),*,sum4,(1024),/", "d91ac445-b44f-f821-9123-9d829e544c33", ComputeFetchSize);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -241,7 +863,7 @@ void AutoDefinePublicDerivedCountersCLGfx10(GPA_DerivedCounters& c)
         internalCounters.push_back(23763);
         internalCounters.push_back(23998);
 
-        c.DefineDerivedCounter("WriteSize", "GlobalMemory", "The total kilobytes written to the video memory. This is measured with all extra fetches and any cache or memory effects taken into account.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_KILOBYTES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,sum24,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,sum24,-,(32),*,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,sum24,(64),*,+,(1024),/", "e09d95da-2772-f7cb-51f5-4fad27bb998b");
+        c.DefineDerivedCounter("WriteSize", "GlobalMemory", "The total kilobytes written to the video memory. This is measured with all extra fetches and any cache or memory effects taken into account.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_KILOBYTES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,sum24,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,sum24,-,(32),*,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,sum24,(64),*,+,(1024),/", "e09d95da-2772-f7cb-51f5-4fad27bb998b", ComputeWriteSize);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -278,14 +900,14 @@ void AutoDefinePublicDerivedCountersCLGfx10(GPA_DerivedCounters& c)
         internalCounters.push_back(15138);
         internalCounters.push_back(15215);
 
-        c.DefineDerivedCounter("L0CacheHit", "GlobalMemory", "The percentage of fetch, write, atomic, and other instructions that hit the data in L0 cache. Value range: 0% (no hit) to 100% (optimal).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),(1),16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,/,-,(100),*,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,ifnotzero", "be1e0578-82b8-ad7f-ba3f-3afce150937a");
+        c.DefineDerivedCounter("L0CacheHit", "GlobalMemory", "The percentage of fetch, write, atomic, and other instructions that hit the data in L0 cache. Value range: 0% (no hit) to 100% (optimal).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),(1),16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,/,-,(100),*,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,ifnotzero", "be1e0578-82b8-ad7f-ba3f-3afce150937a", ComputeL0CacheHit);
     }
     {
         vector<gpa_uint32> internalCounters;
         internalCounters.push_back(17951);
         internalCounters.push_back(17955);
 
-        c.DefineDerivedCounter("L1CacheHit", "GlobalMemory", "The percentage of fetch, write, atomic, and other instructions that hit the data in L1 cache. Writes and atomics always miss this cache. Value range: 0% (no hit) to 100% (optimal).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),(1),1,0,/,-,(100),*,0,ifnotzero", "b10c589c-f7a5-b8f2-46c2-e0aed4a84105");
+        c.DefineDerivedCounter("L1CacheHit", "GlobalMemory", "The percentage of fetch, write, atomic, and other instructions that hit the data in L1 cache. Writes and atomics always miss this cache. Value range: 0% (no hit) to 100% (optimal).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),(1),1,0,/,-,(100),*,0,ifnotzero", "b10c589c-f7a5-b8f2-46c2-e0aed4a84105", ComputeL1CacheHit);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -338,7 +960,7 @@ void AutoDefinePublicDerivedCountersCLGfx10(GPA_DerivedCounters& c)
         internalCounters.push_back(23722);
         internalCounters.push_back(23957);
 
-        c.DefineDerivedCounter("L2CacheHit", "GlobalMemory", "The percentage of fetch, write, atomic, and other instructions that hit the data in L2 cache. Value range: 0% (no hit) to 100% (optimal).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),(1),24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,sum24,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,sum24,/,-,(100),*,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,sum24,ifnotzero", "7507935e-ed29-f169-ee27-9b0fa9b88f3c");
+        c.DefineDerivedCounter("L2CacheHit", "GlobalMemory", "The percentage of fetch, write, atomic, and other instructions that hit the data in L2 cache. Value range: 0% (no hit) to 100% (optimal).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),(1),24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,sum24,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,sum24,/,-,(100),*,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,sum24,ifnotzero", "7507935e-ed29-f169-ee27-9b0fa9b88f3c", ComputeL2CacheHit);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -360,7 +982,7 @@ void AutoDefinePublicDerivedCountersCLGfx10(GPA_DerivedCounters& c)
         internalCounters.push_back(12855);
         internalCounters.push_back(1868);
 
-        c.DefineDerivedCounter("MemUnitBusy", "GlobalMemory", "The percentage of GPUTime the memory unit is active. The result includes the stall time (MemUnitStalled). This is measured with all extra fetches and writes and any cache or memory effects taken into account. Value range: 0% to 100% (fetch-bound).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16,16,/,NUM_SHADER_ARRAYS,/,(100),*", "a1efa380-4a72-e066-e06a-2ab71a488521");
+        c.DefineDerivedCounter("MemUnitBusy", "GlobalMemory", "The percentage of GPUTime the memory unit is active. The result includes the stall time (MemUnitStalled). This is measured with all extra fetches and writes and any cache or memory effects taken into account. Value range: 0% to 100% (fetch-bound).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16,16,/,NUM_SHADER_ARRAYS,/,(100),*", "a1efa380-4a72-e066-e06a-2ab71a488521", ComputeMemUnitBusy);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -382,7 +1004,7 @@ void AutoDefinePublicDerivedCountersCLGfx10(GPA_DerivedCounters& c)
         internalCounters.push_back(15233);
         internalCounters.push_back(1868);
 
-        c.DefineDerivedCounter("MemUnitStalled", "GlobalMemory", "The percentage of GPUTime the memory unit is stalled. Try reducing the number or size of fetches and writes if possible. Value range: 0% (optimal) to 100% (bad).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16,16,/,NUM_SHADER_ARRAYS,/,(100),*", "465ba54f-d250-1453-790a-731b10d230b1");
+        c.DefineDerivedCounter("MemUnitStalled", "GlobalMemory", "The percentage of GPUTime the memory unit is stalled. Try reducing the number or size of fetches and writes if possible. Value range: 0% (optimal) to 100% (bad).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16,16,/,NUM_SHADER_ARRAYS,/,(100),*", "465ba54f-d250-1453-790a-731b10d230b1", ComputeMemUnitStalled);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -412,14 +1034,46 @@ void AutoDefinePublicDerivedCountersCLGfx10(GPA_DerivedCounters& c)
         internalCounters.push_back(24001);
         internalCounters.push_back(1868);
 
-        c.DefineDerivedCounter("WriteUnitStalled", "GlobalMemory", "The percentage of GPUTime the Write unit is stalled. Value range: 0% to 100% (bad).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,max24,24,/,(100),*", "594ad3ce-d1ec-10fc-7d59-25738e397d72");
+        c.DefineDerivedCounter("WriteUnitStalled", "GlobalMemory", "The percentage of GPUTime the Write unit is stalled. Value range: 0% to 100% (bad).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,max24,24,/,(100),*", "594ad3ce-d1ec-10fc-7d59-25738e397d72", ComputeWriteUnitStalled);
     }
     {
         vector<gpa_uint32> internalCounters;
         internalCounters.push_back(5414);
         internalCounters.push_back(1868);
 
-        c.DefineDerivedCounter("LDSBankConflict", "LocalMemory", "The percentage of GPUTime LDS is stalled by bank conflicts. Value range: 0% (optimal) to 100% (bad).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,/,NUM_SIMDS,/,(100),*", "b3387100-3d5a-3235-e612-58b941683eb6");
+        c.DefineDerivedCounter("LDSBankConflict", "LocalMemory", "The percentage of GPUTime LDS is stalled by bank conflicts. Value range: 0% (optimal) to 100% (bad).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,/,NUM_SIMDS,/,(100),*", "b3387100-3d5a-3235-e612-58b941683eb6", ComputeLDSBankConflict);
     }
 }
 
+/// Native functions of the Public derived counters, in the order the counters are defined
+static const GPA_DerivedCounterFunctionEntry counterFunctions[] = {
+    {"Wavefronts", "0", ComputeWavefronts},
+    {"VALUInsts", "0,1,/", ComputeVALUInsts},
+    {"SALUInsts", "0,1,/", ComputeSALUInsts},
+    {"VFetchInsts", "0,1,/", ComputeVFetchInsts},
+    {"SFetchInsts", "0,1,/", ComputeSFetchInsts},
+    {"VWriteInsts", "0,1,/", ComputeVWriteInsts},
+    {"LDSInsts", "0,1,/", ComputeLDSInsts},
+    {"GDSInsts", "0,1,/", ComputeGDSInsts},
+    {"VALUUtilization", "0,1,(64),(32),2,ifnotzero,*,/,(100),*,(100),min", ComputeVALUUtilization},
+    {"VALUBusy", "0,NUM_SIMDS,/,1,/,(100),*", ComputeVALUBusy},
+    {"SALUBusy", "0,NUM_CUS,/,1,/,(100),*", ComputeSALUBusy},
+    {"FetchSize", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,sum24,(32),*,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,sum24,(64),*,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,70,71,sum24,(96),*,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,sum24,(128),*,sum4,(1024),/", ComputeFetchSize},
+    {"WriteSize", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,sum24,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,sum24,-,(32),*,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,sum24,(64),*,+,(1024),/", ComputeWriteSize},
+    {"L0CacheHit", "(0),(1),16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,/,-,(100),*,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,ifnotzero", ComputeL0CacheHit},
+    {"L1CacheHit", "(0),(1),1,0,/,-,(100),*,0,ifnotzero", ComputeL1CacheHit},
+    {"L2CacheHit", "(0),(1),24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,sum24,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,sum24,/,-,(100),*,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,sum24,ifnotzero", ComputeL2CacheHit},
+    {"MemUnitBusy", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16,16,/,NUM_SHADER_ARRAYS,/,(100),*", ComputeMemUnitBusy},
+    {"MemUnitStalled", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16,16,/,NUM_SHADER_ARRAYS,/,(100),*", ComputeMemUnitStalled},
+    {"WriteUnitStalled", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,max24,24,/,(100),*", ComputeWriteUnitStalled},
+    {"LDSBankConflict", "0,1,/,NUM_SIMDS,/,(100),*", ComputeLDSBankConflict},
+};
+
+GPA_DerivedCounterFunctionTable GetPublicDerivedCounterFunctionsCLGfx10()
+{
+    GPA_DerivedCounterFunctionTable functions;
+    functions.m_pEntries   = counterFunctions;
+    functions.m_numEntries = sizeof(counterFunctions) / sizeof(counterFunctions[0]);
+    return functions;
+}
+
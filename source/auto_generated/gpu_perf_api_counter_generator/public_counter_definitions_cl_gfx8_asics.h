@@ -59,6 +59,46 @@ namespace clgfx8asics
         }
     }
 
+    /// Gets the native functions of the ASIC specific derived counters if available.
+    /// \param desired_generation Hardware generation currently in use.
+    /// \param asic_type The ASIC type that is currently in use.
+    /// \param functions Returned native functions, if available.
+    /// \return True if the ASIC matched one available, and functions was set.
+    inline bool GetPublicAsicSpecificCounterFunctions(GDT_HW_GENERATION desired_generation, GDT_HW_ASIC_TYPE asic_type, GPA_DerivedCounterFunctionTable& functions)
+    {
+        if (clgfx8baffin::GetPublicAsicSpecificCounterFunctions(desired_generation, asic_type, functions))
+        {
+            return true;
+        }
+
+        if (clgfx8carrizo::GetPublicAsicSpecificCounterFunctions(desired_generation, asic_type, functions))
+        {
+            return true;
+        }
+
+        if (clgfx8ellesmere::GetPublicAsicSpecificCounterFunctions(desired_generation, asic_type, functions))
+        {
+            return true;
+        }
+
+        if (clgfx8fiji::GetPublicAsicSpecificCounterFunctions(desired_generation, asic_type, functions))
+        {
+            return true;
+        }
+
+        if (clgfx8iceland::GetPublicAsicSpecificCounterFunctions(desired_generation, asic_type, functions))
+        {
+            return true;
+        }
+
+        if (clgfx8tonga::GetPublicAsicSpecificCounterFunctions(desired_generation, asic_type, functions))
+        {
+            return true;
+        }
+
+        return false;
+    }
+
 }  // namespace clgfx8asics
 
 #endif  // _PUBLIC__COUNTER_DEFINITIONS_CLGFX8_ASICS_H_
@@ -6,6 +6,7 @@
 //==============================================================================
 
 #include "gpa_counter.h"
+#include "gpa_common_defs.h"
 #include "public_counter_definitions_cl_gfx8_baffin.h"
 
 // *** Note, this is an auto-generated file. Do not edit. Execute PublicCounterCompiler to rebuild.
@@ -29,5 +30,19 @@ bool UpdatePublicAsicSpecificCounters(GDT_HW_GENERATION desired_generation, GDT_
     return true;
 }
 
+bool GetPublicAsicSpecificCounterFunctions(GDT_HW_GENERATION desired_generation, GDT_HW_ASIC_TYPE asic_type, GPA_DerivedCounterFunctionTable& functions)
+{
+    UNREFERENCED_PARAMETER(desired_generation);
+
+    if (!countergfx8baffin::MatchAsic(asic_type))
+    {
+        return false;
+    }
+
+    functions.m_pEntries   = nullptr;
+    functions.m_numEntries = 0;
+    return true;
+}
+
 }  // namespace clgfx8baffin
 
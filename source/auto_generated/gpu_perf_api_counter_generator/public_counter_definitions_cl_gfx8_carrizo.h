@@ -21,6 +21,13 @@ namespace clgfx8carrizo
     /// \return True if the ASIC matched one available, and derivedCounters was updated.
     extern bool UpdatePublicAsicSpecificCounters(GDT_HW_GENERATION desired_generation, GDT_HW_ASIC_TYPE asic_type, GPA_DerivedCounters& c);
 
+    /// Gets the native functions of the ASIC specific Public derived counters if available.
+    /// \param desired_generation Hardware generation currently in use.
+    /// \param asic_type The ASIC type that is currently in use.
+    /// \param functions Returned native functions, in the order the counters are updated.
+    /// \return True if the ASIC matched one available, and functions was set.
+    extern bool GetPublicAsicSpecificCounterFunctions(GDT_HW_GENERATION desired_generation, GDT_HW_ASIC_TYPE asic_type, GPA_DerivedCounterFunctionTable& functions);
+
 }  // namespace clgfx8carrizo
 
 #endif  // _PUBLIC_COUNTER_DEFINITIONS_CL_GFX8_CARRIZO_H_
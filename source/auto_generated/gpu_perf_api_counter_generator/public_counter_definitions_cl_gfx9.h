@@ -16,4 +16,8 @@
 /// \param c derived counters instance
 void AutoDefinePublicDerivedCountersCLGfx9(GPA_DerivedCounters& c);
 
+/// Gets the native functions of the Public derived counters for CL GFX9
+/// \return the native functions, in the order the counters are defined
+GPA_DerivedCounterFunctionTable GetPublicDerivedCounterFunctionsCLGfx9();
+
 #endif  // _PUBLIC_COUNTER_DEFINITIONS_CL_GFX9_H_
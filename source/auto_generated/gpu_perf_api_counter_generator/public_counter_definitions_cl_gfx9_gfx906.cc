@@ -6,6 +6,7 @@
 //==============================================================================
 
 #include "gpa_counter.h"
+#include "gpa_common_defs.h"
 #include "public_counter_definitions_cl_gfx9_gfx906.h"
 
 // *** Note, this is an auto-generated file. Do not edit. Execute PublicCounterCompiler to rebuild.
@@ -14,6 +15,198 @@
 
 namespace clgfx9gfx906
 {
+/// Computes the FetchSize counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,-,(64),*,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,(32),*,+,(1024),/
+static void ComputeFetchSize(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+
+    const gpa_float64 v0 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16;
+    const gpa_float64 v2 = v0 - v1;
+    const gpa_float64 v3 = v2 * 64.0;
+    const gpa_float64 v4 = r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16;
+    const gpa_float64 v5 = v4 * 32.0;
+    const gpa_float64 v6 = v3 + v5;
+    const gpa_float64 v7 = (1024.0 != 0.0) ? (v6 / 1024.0) : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v7;
+}
+
+/// Computes the WriteSize counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,-,(32),*,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,(64),*,+,(1024),/
+static void ComputeWriteSize(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+
+    const gpa_float64 v0 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16;
+    const gpa_float64 v2 = v0 - v1;
+    const gpa_float64 v3 = v2 * 32.0;
+    const gpa_float64 v4 = r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16;
+    const gpa_float64 v5 = v4 * 64.0;
+    const gpa_float64 v6 = v3 + v5;
+    const gpa_float64 v7 = (1024.0 != 0.0) ? (v6 / 1024.0) : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v7;
+}
+
+/// Computes the L2CacheHit counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,+,/,(100),*
+static void ComputeL2CacheHit(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+
+    const gpa_float64 v0 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v2 = r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16;
+    const gpa_float64 v3 = v1 + v2;
+    const gpa_float64 v4 = (v3 != 0.0) ? (v0 / v3) : 0.0;
+    const gpa_float64 v5 = v4 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v5;
+}
+
+/// Computes the WriteUnitStalled counter: 0,1,max,2,max,3,max,4,max,5,max,6,max,7,max,8,max,9,max,10,max,11,max,12,max,13,max,14,max,15,max,16,/,(100),*
+static void ComputeWriteUnitStalled(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+
+    const gpa_float64 v0 = (r0 > r1) ? r0 : r1;
+    const gpa_float64 v1 = (v0 > r2) ? v0 : r2;
+    const gpa_float64 v2 = (v1 > r3) ? v1 : r3;
+    const gpa_float64 v3 = (v2 > r4) ? v2 : r4;
+    const gpa_float64 v4 = (v3 > r5) ? v3 : r5;
+    const gpa_float64 v5 = (v4 > r6) ? v4 : r6;
+    const gpa_float64 v6 = (v5 > r7) ? v5 : r7;
+    const gpa_float64 v7 = (v6 > r8) ? v6 : r8;
+    const gpa_float64 v8 = (v7 > r9) ? v7 : r9;
+    const gpa_float64 v9 = (v8 > r10) ? v8 : r10;
+    const gpa_float64 v10 = (v9 > r11) ? v9 : r11;
+    const gpa_float64 v11 = (v10 > r12) ? v10 : r12;
+    const gpa_float64 v12 = (v11 > r13) ? v11 : r13;
+    const gpa_float64 v13 = (v12 > r14) ? v12 : r14;
+    const gpa_float64 v14 = (v13 > r15) ? v13 : r15;
+    const gpa_float64 v15 = (r16 != 0.0) ? (v14 / r16) : 0.0;
+    const gpa_float64 v16 = v15 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v16;
+}
+
 bool UpdatePublicAsicSpecificCounters(GDT_HW_GENERATION desired_generation, GDT_HW_ASIC_TYPE asic_type, GPA_DerivedCounters& c)
 {
     UNREFERENCED_PARAMETER(desired_generation);
@@ -61,7 +254,7 @@ bool UpdatePublicAsicSpecificCounters(GDT_HW_GENERATION desired_generation, GDT_
         internalCounters.push_back(13377);
         internalCounters.push_back(13659);
 
-        c.UpdateAsicSpecificDerivedCounter("FetchSize", internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,-,(64),*,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,(32),*,+,(1024),/");
+        c.UpdateAsicSpecificDerivedCounter("FetchSize", internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,-,(64),*,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,(32),*,+,(1024),/", ComputeFetchSize);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -98,7 +291,7 @@ bool UpdatePublicAsicSpecificCounters(GDT_HW_GENERATION desired_generation, GDT_
         internalCounters.push_back(13365);
         internalCounters.push_back(13647);
 
-        c.UpdateAsicSpecificDerivedCounter("WriteSize", internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,-,(32),*,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,(64),*,+,(1024),/");
+        c.UpdateAsicSpecificDerivedCounter("WriteSize", internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,-,(32),*,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,(64),*,+,(1024),/", ComputeWriteSize);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -135,7 +328,7 @@ bool UpdatePublicAsicSpecificCounters(GDT_HW_GENERATION desired_generation, GDT_
         internalCounters.push_back(13357);
         internalCounters.push_back(13639);
 
-        c.UpdateAsicSpecificDerivedCounter("L2CacheHit", internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,+,/,(100),*");
+        c.UpdateAsicSpecificDerivedCounter("L2CacheHit", internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,+,/,(100),*", ComputeL2CacheHit);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -157,8 +350,30 @@ bool UpdatePublicAsicSpecificCounters(GDT_HW_GENERATION desired_generation, GDT_
         internalCounters.push_back(13650);
         internalCounters.push_back(1799);
 
-        c.UpdateAsicSpecificDerivedCounter("WriteUnitStalled", internalCounters, "0,1,max,2,max,3,max,4,max,5,max,6,max,7,max,8,max,9,max,10,max,11,max,12,max,13,max,14,max,15,max,16,/,(100),*");
+        c.UpdateAsicSpecificDerivedCounter("WriteUnitStalled", internalCounters, "0,1,max,2,max,3,max,4,max,5,max,6,max,7,max,8,max,9,max,10,max,11,max,12,max,13,max,14,max,15,max,16,/,(100),*", ComputeWriteUnitStalled);
+    }
+    return true;
+}
+
+/// Native functions of the Public derived counters, in the order the counters are updated
+static const GPA_DerivedCounterFunctionEntry counterFunctions[] = {
+    {"FetchSize", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,-,(64),*,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,(32),*,+,(1024),/", ComputeFetchSize},
+    {"WriteSize", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,-,(32),*,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,(64),*,+,(1024),/", ComputeWriteSize},
+    {"L2CacheHit", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,+,/,(100),*", ComputeL2CacheHit},
+    {"WriteUnitStalled", "0,1,max,2,max,3,max,4,max,5,max,6,max,7,max,8,max,9,max,10,max,11,max,12,max,13,max,14,max,15,max,16,/,(100),*", ComputeWriteUnitStalled},
+};
+
+bool GetPublicAsicSpecificCounterFunctions(GDT_HW_GENERATION desired_generation, GDT_HW_ASIC_TYPE asic_type, GPA_DerivedCounterFunctionTable& functions)
+{
+    UNREFERENCED_PARAMETER(desired_generation);
+
+    if (!countergfx9gfx906::MatchAsic(asic_type))
+    {
+        return false;
     }
+
+    functions.m_pEntries   = counterFunctions;
+    functions.m_numEntries = sizeof(counterFunctions) / sizeof(counterFunctions[0]);
     return true;
 }
 
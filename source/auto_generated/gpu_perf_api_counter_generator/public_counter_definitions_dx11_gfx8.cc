@@ -6,30 +6,7156 @@
 //==============================================================================
 
 #include "gpa_counter.h"
+#include "gpa_common_defs.h"
 #include "public_counter_definitions_dx11_gfx8.h"
 
 // *** Note, this is an auto-generated file. Do not edit. Execute PublicCounterCompiler to rebuild.
 
+/// Computes the GPUTime counter: 0,TS_FREQ,/,(1000000000),*
+static void ComputeGPUTime(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    gpa_uint64 timestampFrequency = 1u;
+    GPA_ASSERT(pHwInfo->GetTimeStampFrequency(timestampFrequency));
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+
+    const gpa_float64 v0 = (static_cast<gpa_float64>(timestampFrequency) != 0.0) ? (r0 / static_cast<gpa_float64>(timestampFrequency)) : 0.0;
+    const gpa_float64 v1 = v0 * 1000000000.0;
+
+    *static_cast<gpa_float64*>(pResult) = v1;
+}
+
+/// Computes the GPUBusy counter: 0,1,/,(100),*,(100),min
+static void ComputeGPUBusy(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+
+    const gpa_float64 v0 = (r1 != 0.0) ? (r0 / r1) : 0.0;
+    const gpa_float64 v1 = v0 * 100.0;
+    const gpa_float64 v2 = (v1 < 100.0) ? v1 : 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v2;
+}
+
+/// Computes the GPUBusyCycles counter: 0
+static void ComputeGPUBusyCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+
+    *static_cast<gpa_float64*>(pResult) = r0;
+}
+
+/// Computes the TessellatorBusy counter: 0,1,max,2,max,3,max,4,/,(100),*
+static void ComputeTessellatorBusy(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+
+    const gpa_float64 v0 = (r0 > r1) ? r0 : r1;
+    const gpa_float64 v1 = (v0 > r2) ? v0 : r2;
+    const gpa_float64 v2 = (v1 > r3) ? v1 : r3;
+    const gpa_float64 v3 = (r4 != 0.0) ? (v2 / r4) : 0.0;
+    const gpa_float64 v4 = v3 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v4;
+}
+
+/// Computes the TessellatorBusyCycles counter: 0,1,max,2,max,3,max
+static void ComputeTessellatorBusyCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+
+    const gpa_float64 v0 = (r0 > r1) ? r0 : r1;
+    const gpa_float64 v1 = (v0 > r2) ? v0 : r2;
+    const gpa_float64 v2 = (v1 > r3) ? v1 : r3;
+
+    *static_cast<gpa_float64*>(pResult) = v2;
+}
+
+/// Computes the VSBusy counter: (0),0,16,ifnotzero,4,20,ifnotzero,8,24,ifnotzero,(0),1,17,ifnotzero,5,21,ifnotzero,9,25,ifnotzero,max,(0),2,18,ifnotzero,6,22,ifnotzero,10,26,ifnotzero,max,(0),3,19,ifnotzero,7,23,ifnotzero,11,27,ifnotzero,max,28,/,(100),*,(100),min
+static void ComputeVSBusy(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+
+    const gpa_float64 v0 = (r16 != 0.0) ? r0 : 0.0;
+    const gpa_float64 v1 = (r20 != 0.0) ? r4 : v0;
+    const gpa_float64 v2 = (r24 != 0.0) ? r8 : v1;
+    const gpa_float64 v3 = (r17 != 0.0) ? r1 : 0.0;
+    const gpa_float64 v4 = (r21 != 0.0) ? r5 : v3;
+    const gpa_float64 v5 = (r25 != 0.0) ? r9 : v4;
+    const gpa_float64 v6 = (v2 > v5) ? v2 : v5;
+    const gpa_float64 v7 = (r18 != 0.0) ? r2 : 0.0;
+    const gpa_float64 v8 = (r22 != 0.0) ? r6 : v7;
+    const gpa_float64 v9 = (r26 != 0.0) ? r10 : v8;
+    const gpa_float64 v10 = (v6 > v9) ? v6 : v9;
+    const gpa_float64 v11 = (r19 != 0.0) ? r3 : 0.0;
+    const gpa_float64 v12 = (r23 != 0.0) ? r7 : v11;
+    const gpa_float64 v13 = (r27 != 0.0) ? r11 : v12;
+    const gpa_float64 v14 = (v10 > v13) ? v10 : v13;
+    const gpa_float64 v15 = (r28 != 0.0) ? (v14 / r28) : 0.0;
+    const gpa_float64 v16 = v15 * 100.0;
+    const gpa_float64 v17 = (v16 < 100.0) ? v16 : 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v17;
+}
+
+/// Computes the VSBusyCycles counter: (0),0,16,ifnotzero,4,20,ifnotzero,8,24,ifnotzero,(0),1,17,ifnotzero,5,21,ifnotzero,9,25,ifnotzero,max,(0),2,18,ifnotzero,6,22,ifnotzero,10,26,ifnotzero,max,(0),3,19,ifnotzero,7,23,ifnotzero,11,27,ifnotzero,max
+static void ComputeVSBusyCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+
+    const gpa_float64 v0 = (r16 != 0.0) ? r0 : 0.0;
+    const gpa_float64 v1 = (r20 != 0.0) ? r4 : v0;
+    const gpa_float64 v2 = (r24 != 0.0) ? r8 : v1;
+    const gpa_float64 v3 = (r17 != 0.0) ? r1 : 0.0;
+    const gpa_float64 v4 = (r21 != 0.0) ? r5 : v3;
+    const gpa_float64 v5 = (r25 != 0.0) ? r9 : v4;
+    const gpa_float64 v6 = (v2 > v5) ? v2 : v5;
+    const gpa_float64 v7 = (r18 != 0.0) ? r2 : 0.0;
+    const gpa_float64 v8 = (r22 != 0.0) ? r6 : v7;
+    const gpa_float64 v9 = (r26 != 0.0) ? r10 : v8;
+    const gpa_float64 v10 = (v6 > v9) ? v6 : v9;
+    const gpa_float64 v11 = (r19 != 0.0) ? r3 : 0.0;
+    const gpa_float64 v12 = (r23 != 0.0) ? r7 : v11;
+    const gpa_float64 v13 = (r27 != 0.0) ? r11 : v12;
+    const gpa_float64 v14 = (v10 > v13) ? v10 : v13;
+
+    *static_cast<gpa_float64*>(pResult) = v14;
+}
+
+/// Computes the VSTime counter: (0),1,17,ifnotzero,5,21,ifnotzero,9,25,ifnotzero,(0),2,18,ifnotzero,6,22,ifnotzero,10,26,ifnotzero,max,(0),3,19,ifnotzero,7,23,ifnotzero,11,27,ifnotzero,max,(0),4,20,ifnotzero,8,24,ifnotzero,12,28,ifnotzero,max,29,/,(1),min,0,TS_FREQ,/,(1000000000),*,*
+static void ComputeVSTime(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    gpa_uint64 timestampFrequency = 1u;
+    GPA_ASSERT(pHwInfo->GetTimeStampFrequency(timestampFrequency));
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+
+    const gpa_float64 v0 = (r17 != 0.0) ? r1 : 0.0;
+    const gpa_float64 v1 = (r21 != 0.0) ? r5 : v0;
+    const gpa_float64 v2 = (r25 != 0.0) ? r9 : v1;
+    const gpa_float64 v3 = (r18 != 0.0) ? r2 : 0.0;
+    const gpa_float64 v4 = (r22 != 0.0) ? r6 : v3;
+    const gpa_float64 v5 = (r26 != 0.0) ? r10 : v4;
+    const gpa_float64 v6 = (v2 > v5) ? v2 : v5;
+    const gpa_float64 v7 = (r19 != 0.0) ? r3 : 0.0;
+    const gpa_float64 v8 = (r23 != 0.0) ? r7 : v7;
+    const gpa_float64 v9 = (r27 != 0.0) ? r11 : v8;
+    const gpa_float64 v10 = (v6 > v9) ? v6 : v9;
+    const gpa_float64 v11 = (r20 != 0.0) ? r4 : 0.0;
+    const gpa_float64 v12 = (r24 != 0.0) ? r8 : v11;
+    const gpa_float64 v13 = (r28 != 0.0) ? r12 : v12;
+    const gpa_float64 v14 = (v10 > v13) ? v10 : v13;
+    const gpa_float64 v15 = (r29 != 0.0) ? (v14 / r29) : 0.0;
+    const gpa_float64 v16 = (v15 < 1.0) ? v15 : 1.0;
+    const gpa_float64 v17 = (static_cast<gpa_float64>(timestampFrequency) != 0.0) ? (r0 / static_cast<gpa_float64>(timestampFrequency)) : 0.0;
+    const gpa_float64 v18 = v17 * 1000000000.0;
+    const gpa_float64 v19 = v16 * v18;
+
+    *static_cast<gpa_float64*>(pResult) = v19;
+}
+
+/// Computes the HSBusy counter: (0),0,4,ifnotzero,(0),1,5,ifnotzero,max,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max,8,/,(100),*,(100),min
+static void ComputeHSBusy(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+
+    const gpa_float64 v0 = (r4 != 0.0) ? r0 : 0.0;
+    const gpa_float64 v1 = (r5 != 0.0) ? r1 : 0.0;
+    const gpa_float64 v2 = (v0 > v1) ? v0 : v1;
+    const gpa_float64 v3 = (r6 != 0.0) ? r2 : 0.0;
+    const gpa_float64 v4 = (v2 > v3) ? v2 : v3;
+    const gpa_float64 v5 = (r7 != 0.0) ? r3 : 0.0;
+    const gpa_float64 v6 = (v4 > v5) ? v4 : v5;
+    const gpa_float64 v7 = (r8 != 0.0) ? (v6 / r8) : 0.0;
+    const gpa_float64 v8 = v7 * 100.0;
+    const gpa_float64 v9 = (v8 < 100.0) ? v8 : 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v9;
+}
+
+/// Computes the HSBusyCycles counter: (0),0,4,ifnotzero,(0),1,5,ifnotzero,max,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max
+static void ComputeHSBusyCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+
+    const gpa_float64 v0 = (r4 != 0.0) ? r0 : 0.0;
+    const gpa_float64 v1 = (r5 != 0.0) ? r1 : 0.0;
+    const gpa_float64 v2 = (v0 > v1) ? v0 : v1;
+    const gpa_float64 v3 = (r6 != 0.0) ? r2 : 0.0;
+    const gpa_float64 v4 = (v2 > v3) ? v2 : v3;
+    const gpa_float64 v5 = (r7 != 0.0) ? r3 : 0.0;
+    const gpa_float64 v6 = (v4 > v5) ? v4 : v5;
+
+    *static_cast<gpa_float64*>(pResult) = v6;
+}
+
+/// Computes the HSTime counter: (0),1,5,ifnotzero,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max,(0),4,8,ifnotzero,max,9,/,(1),min,0,TS_FREQ,/,(1000000000),*,*
+static void ComputeHSTime(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    gpa_uint64 timestampFrequency = 1u;
+    GPA_ASSERT(pHwInfo->GetTimeStampFrequency(timestampFrequency));
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+
+    const gpa_float64 v0 = (r5 != 0.0) ? r1 : 0.0;
+    const gpa_float64 v1 = (r6 != 0.0) ? r2 : 0.0;
+    const gpa_float64 v2 = (v0 > v1) ? v0 : v1;
+    const gpa_float64 v3 = (r7 != 0.0) ? r3 : 0.0;
+    const gpa_float64 v4 = (v2 > v3) ? v2 : v3;
+    const gpa_float64 v5 = (r8 != 0.0) ? r4 : 0.0;
+    const gpa_float64 v6 = (v4 > v5) ? v4 : v5;
+    const gpa_float64 v7 = (r9 != 0.0) ? (v6 / r9) : 0.0;
+    const gpa_float64 v8 = (v7 < 1.0) ? v7 : 1.0;
+    const gpa_float64 v9 = (static_cast<gpa_float64>(timestampFrequency) != 0.0) ? (r0 / static_cast<gpa_float64>(timestampFrequency)) : 0.0;
+    const gpa_float64 v10 = v9 * 1000000000.0;
+    const gpa_float64 v11 = v8 * v10;
+
+    *static_cast<gpa_float64*>(pResult) = v11;
+}
+
+/// Computes the DSBusy counter: (0),0,4,12,ifnotzero,16,ifnotzero,(0),1,5,13,ifnotzero,17,ifnotzero,max,(0),2,6,14,ifnotzero,18,ifnotzero,max,(0),3,7,15,ifnotzero,19,ifnotzero,max,20,/,(100),*,(100),min
+static void ComputeDSBusy(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+
+    const gpa_float64 v0 = (r12 != 0.0) ? r4 : r0;
+    const gpa_float64 v1 = (r16 != 0.0) ? v0 : 0.0;
+    const gpa_float64 v2 = (r13 != 0.0) ? r5 : r1;
+    const gpa_float64 v3 = (r17 != 0.0) ? v2 : 0.0;
+    const gpa_float64 v4 = (v1 > v3) ? v1 : v3;
+    const gpa_float64 v5 = (r14 != 0.0) ? r6 : r2;
+    const gpa_float64 v6 = (r18 != 0.0) ? v5 : 0.0;
+    const gpa_float64 v7 = (v4 > v6) ? v4 : v6;
+    const gpa_float64 v8 = (r15 != 0.0) ? r7 : r3;
+    const gpa_float64 v9 = (r19 != 0.0) ? v8 : 0.0;
+    const gpa_float64 v10 = (v7 > v9) ? v7 : v9;
+    const gpa_float64 v11 = (r20 != 0.0) ? (v10 / r20) : 0.0;
+    const gpa_float64 v12 = v11 * 100.0;
+    const gpa_float64 v13 = (v12 < 100.0) ? v12 : 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v13;
+}
+
+/// Computes the DSBusyCycles counter: (0),0,4,12,ifnotzero,16,ifnotzero,(0),1,5,13,ifnotzero,17,ifnotzero,max,(0),2,6,14,ifnotzero,18,ifnotzero,max,(0),3,7,15,ifnotzero,19,ifnotzero,max
+static void ComputeDSBusyCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+
+    const gpa_float64 v0 = (r12 != 0.0) ? r4 : r0;
+    const gpa_float64 v1 = (r16 != 0.0) ? v0 : 0.0;
+    const gpa_float64 v2 = (r13 != 0.0) ? r5 : r1;
+    const gpa_float64 v3 = (r17 != 0.0) ? v2 : 0.0;
+    const gpa_float64 v4 = (v1 > v3) ? v1 : v3;
+    const gpa_float64 v5 = (r14 != 0.0) ? r6 : r2;
+    const gpa_float64 v6 = (r18 != 0.0) ? v5 : 0.0;
+    const gpa_float64 v7 = (v4 > v6) ? v4 : v6;
+    const gpa_float64 v8 = (r15 != 0.0) ? r7 : r3;
+    const gpa_float64 v9 = (r19 != 0.0) ? v8 : 0.0;
+    const gpa_float64 v10 = (v7 > v9) ? v7 : v9;
+
+    *static_cast<gpa_float64*>(pResult) = v10;
+}
+
+/// Computes the DSTime counter: (0),1,5,13,ifnotzero,17,ifnotzero,(0),2,6,14,ifnotzero,18,ifnotzero,max,(0),3,7,15,ifnotzero,19,ifnotzero,max,(0),4,8,16,ifnotzero,20,ifnotzero,max,21,/,(1),min,0,TS_FREQ,/,(1000000000),*,*
+static void ComputeDSTime(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    gpa_uint64 timestampFrequency = 1u;
+    GPA_ASSERT(pHwInfo->GetTimeStampFrequency(timestampFrequency));
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+
+    const gpa_float64 v0 = (r13 != 0.0) ? r5 : r1;
+    const gpa_float64 v1 = (r17 != 0.0) ? v0 : 0.0;
+    const gpa_float64 v2 = (r14 != 0.0) ? r6 : r2;
+    const gpa_float64 v3 = (r18 != 0.0) ? v2 : 0.0;
+    const gpa_float64 v4 = (v1 > v3) ? v1 : v3;
+    const gpa_float64 v5 = (r15 != 0.0) ? r7 : r3;
+    const gpa_float64 v6 = (r19 != 0.0) ? v5 : 0.0;
+    const gpa_float64 v7 = (v4 > v6) ? v4 : v6;
+    const gpa_float64 v8 = (r16 != 0.0) ? r8 : r4;
+    const gpa_float64 v9 = (r20 != 0.0) ? v8 : 0.0;
+    const gpa_float64 v10 = (v7 > v9) ? v7 : v9;
+    const gpa_float64 v11 = (r21 != 0.0) ? (v10 / r21) : 0.0;
+    const gpa_float64 v12 = (v11 < 1.0) ? v11 : 1.0;
+    const gpa_float64 v13 = (static_cast<gpa_float64>(timestampFrequency) != 0.0) ? (r0 / static_cast<gpa_float64>(timestampFrequency)) : 0.0;
+    const gpa_float64 v14 = v13 * 1000000000.0;
+    const gpa_float64 v15 = v12 * v14;
+
+    *static_cast<gpa_float64*>(pResult) = v15;
+}
+
+/// Computes the GSBusy counter: (0),0,4,ifnotzero,(0),1,5,ifnotzero,max,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max,8,/,(100),*,(100),min
+static void ComputeGSBusy(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+
+    const gpa_float64 v0 = (r4 != 0.0) ? r0 : 0.0;
+    const gpa_float64 v1 = (r5 != 0.0) ? r1 : 0.0;
+    const gpa_float64 v2 = (v0 > v1) ? v0 : v1;
+    const gpa_float64 v3 = (r6 != 0.0) ? r2 : 0.0;
+    const gpa_float64 v4 = (v2 > v3) ? v2 : v3;
+    const gpa_float64 v5 = (r7 != 0.0) ? r3 : 0.0;
+    const gpa_float64 v6 = (v4 > v5) ? v4 : v5;
+    const gpa_float64 v7 = (r8 != 0.0) ? (v6 / r8) : 0.0;
+    const gpa_float64 v8 = v7 * 100.0;
+    const gpa_float64 v9 = (v8 < 100.0) ? v8 : 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v9;
+}
+
+/// Computes the GSBusyCycles counter: (0),0,4,ifnotzero,(0),1,5,ifnotzero,max,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max
+static void ComputeGSBusyCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+
+    const gpa_float64 v0 = (r4 != 0.0) ? r0 : 0.0;
+    const gpa_float64 v1 = (r5 != 0.0) ? r1 : 0.0;
+    const gpa_float64 v2 = (v0 > v1) ? v0 : v1;
+    const gpa_float64 v3 = (r6 != 0.0) ? r2 : 0.0;
+    const gpa_float64 v4 = (v2 > v3) ? v2 : v3;
+    const gpa_float64 v5 = (r7 != 0.0) ? r3 : 0.0;
+    const gpa_float64 v6 = (v4 > v5) ? v4 : v5;
+
+    *static_cast<gpa_float64*>(pResult) = v6;
+}
+
+/// Computes the GSTime counter: (0),1,5,ifnotzero,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max,(0),4,8,ifnotzero,max,9,/,(1),min,0,TS_FREQ,/,(1000000000),*,*
+static void ComputeGSTime(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    gpa_uint64 timestampFrequency = 1u;
+    GPA_ASSERT(pHwInfo->GetTimeStampFrequency(timestampFrequency));
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+
+    const gpa_float64 v0 = (r5 != 0.0) ? r1 : 0.0;
+    const gpa_float64 v1 = (r6 != 0.0) ? r2 : 0.0;
+    const gpa_float64 v2 = (v0 > v1) ? v0 : v1;
+    const gpa_float64 v3 = (r7 != 0.0) ? r3 : 0.0;
+    const gpa_float64 v4 = (v2 > v3) ? v2 : v3;
+    const gpa_float64 v5 = (r8 != 0.0) ? r4 : 0.0;
+    const gpa_float64 v6 = (v4 > v5) ? v4 : v5;
+    const gpa_float64 v7 = (r9 != 0.0) ? (v6 / r9) : 0.0;
+    const gpa_float64 v8 = (v7 < 1.0) ? v7 : 1.0;
+    const gpa_float64 v9 = (static_cast<gpa_float64>(timestampFrequency) != 0.0) ? (r0 / static_cast<gpa_float64>(timestampFrequency)) : 0.0;
+    const gpa_float64 v10 = v9 * 1000000000.0;
+    const gpa_float64 v11 = v8 * v10;
+
+    *static_cast<gpa_float64*>(pResult) = v11;
+}
+
+/// Computes the PSBusy counter: (0),0,4,ifnotzero,(0),1,5,ifnotzero,max,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max,8,/,(100),*
+static void ComputePSBusy(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+
+    const gpa_float64 v0 = (r4 != 0.0) ? r0 : 0.0;
+    const gpa_float64 v1 = (r5 != 0.0) ? r1 : 0.0;
+    const gpa_float64 v2 = (v0 > v1) ? v0 : v1;
+    const gpa_float64 v3 = (r6 != 0.0) ? r2 : 0.0;
+    const gpa_float64 v4 = (v2 > v3) ? v2 : v3;
+    const gpa_float64 v5 = (r7 != 0.0) ? r3 : 0.0;
+    const gpa_float64 v6 = (v4 > v5) ? v4 : v5;
+    const gpa_float64 v7 = (r8 != 0.0) ? (v6 / r8) : 0.0;
+    const gpa_float64 v8 = v7 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v8;
+}
+
+/// Computes the PSBusyCycles counter: (0),0,4,ifnotzero,(0),1,5,ifnotzero,max,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max
+static void ComputePSBusyCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+
+    const gpa_float64 v0 = (r4 != 0.0) ? r0 : 0.0;
+    const gpa_float64 v1 = (r5 != 0.0) ? r1 : 0.0;
+    const gpa_float64 v2 = (v0 > v1) ? v0 : v1;
+    const gpa_float64 v3 = (r6 != 0.0) ? r2 : 0.0;
+    const gpa_float64 v4 = (v2 > v3) ? v2 : v3;
+    const gpa_float64 v5 = (r7 != 0.0) ? r3 : 0.0;
+    const gpa_float64 v6 = (v4 > v5) ? v4 : v5;
+
+    *static_cast<gpa_float64*>(pResult) = v6;
+}
+
+/// Computes the PSTime counter: (0),1,5,ifnotzero,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max,(0),4,8,ifnotzero,max,9,/,0,TS_FREQ,/,(1000000000),*,*
+static void ComputePSTime(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    gpa_uint64 timestampFrequency = 1u;
+    GPA_ASSERT(pHwInfo->GetTimeStampFrequency(timestampFrequency));
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+
+    const gpa_float64 v0 = (r5 != 0.0) ? r1 : 0.0;
+    const gpa_float64 v1 = (r6 != 0.0) ? r2 : 0.0;
+    const gpa_float64 v2 = (v0 > v1) ? v0 : v1;
+    const gpa_float64 v3 = (r7 != 0.0) ? r3 : 0.0;
+    const gpa_float64 v4 = (v2 > v3) ? v2 : v3;
+    const gpa_float64 v5 = (r8 != 0.0) ? r4 : 0.0;
+    const gpa_float64 v6 = (v4 > v5) ? v4 : v5;
+    const gpa_float64 v7 = (r9 != 0.0) ? (v6 / r9) : 0.0;
+    const gpa_float64 v8 = (static_cast<gpa_float64>(timestampFrequency) != 0.0) ? (r0 / static_cast<gpa_float64>(timestampFrequency)) : 0.0;
+    const gpa_float64 v9 = v8 * 1000000000.0;
+    const gpa_float64 v10 = v7 * v9;
+
+    *static_cast<gpa_float64*>(pResult) = v10;
+}
+
+/// Computes the CSBusy counter: 0,1,2,3,4,5,6,7,comparemax4,8,9,10,11,12,13,14,15,comparemax4,max,16,/,(100),*,(100),min
+static void ComputeCSBusy(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+
+    gpa_float64 v0 = 0.0;
+    bool v0Found = false;
+    if ((r7 != 0.0) && (!v0Found || (v0 < r3)))
+    {
+        v0 = r3;
+        v0Found = true;
+    }
+    if ((r6 != 0.0) && (!v0Found || (v0 < r2)))
+    {
+        v0 = r2;
+        v0Found = true;
+    }
+    if ((r5 != 0.0) && (!v0Found || (v0 < r1)))
+    {
+        v0 = r1;
+        v0Found = true;
+    }
+    if ((r4 != 0.0) && (!v0Found || (v0 < r0)))
+    {
+        v0 = r0;
+        v0Found = true;
+    }
+    gpa_float64 v1 = 0.0;
+    bool v1Found = false;
+    if ((r15 != 0.0) && (!v1Found || (v1 < r11)))
+    {
+        v1 = r11;
+        v1Found = true;
+    }
+    if ((r14 != 0.0) && (!v1Found || (v1 < r10)))
+    {
+        v1 = r10;
+        v1Found = true;
+    }
+    if ((r13 != 0.0) && (!v1Found || (v1 < r9)))
+    {
+        v1 = r9;
+        v1Found = true;
+    }
+    if ((r12 != 0.0) && (!v1Found || (v1 < r8)))
+    {
+        v1 = r8;
+        v1Found = true;
+    }
+    const gpa_float64 v2 = (v0 > v1) ? v0 : v1;
+    const gpa_float64 v3 = (r16 != 0.0) ? (v2 / r16) : 0.0;
+    const gpa_float64 v4 = v3 * 100.0;
+    const gpa_float64 v5 = (v4 < 100.0) ? v4 : 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v5;
+}
+
+/// Computes the CSBusyCycles counter: 0,1,2,3,4,5,6,7,comparemax4,8,9,10,11,12,13,14,15,comparemax4,max
+static void ComputeCSBusyCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    gpa_float64 v0 = 0.0;
+    bool v0Found = false;
+    if ((r7 != 0.0) && (!v0Found || (v0 < r3)))
+    {
+        v0 = r3;
+        v0Found = true;
+    }
+    if ((r6 != 0.0) && (!v0Found || (v0 < r2)))
+    {
+        v0 = r2;
+        v0Found = true;
+    }
+    if ((r5 != 0.0) && (!v0Found || (v0 < r1)))
+    {
+        v0 = r1;
+        v0Found = true;
+    }
+    if ((r4 != 0.0) && (!v0Found || (v0 < r0)))
+    {
+        v0 = r0;
+        v0Found = true;
+    }
+    gpa_float64 v1 = 0.0;
+    bool v1Found = false;
+    if ((r15 != 0.0) && (!v1Found || (v1 < r11)))
+    {
+        v1 = r11;
+        v1Found = true;
+    }
+    if ((r14 != 0.0) && (!v1Found || (v1 < r10)))
+    {
+        v1 = r10;
+        v1Found = true;
+    }
+    if ((r13 != 0.0) && (!v1Found || (v1 < r9)))
+    {
+        v1 = r9;
+        v1Found = true;
+    }
+    if ((r12 != 0.0) && (!v1Found || (v1 < r8)))
+    {
+        v1 = r8;
+        v1Found = true;
+    }
+    const gpa_float64 v2 = (v0 > v1) ? v0 : v1;
+
+    *static_cast<gpa_float64*>(pResult) = v2;
+}
+
+/// Computes the CSTime counter: 1,2,3,4,5,6,7,8,comparemax4,9,10,11,12,13,14,15,16,comparemax4,max,17,/,(1),min,0,TS_FREQ,/,(1000000000),*,*
+static void ComputeCSTime(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    gpa_uint64 timestampFrequency = 1u;
+    GPA_ASSERT(pHwInfo->GetTimeStampFrequency(timestampFrequency));
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+
+    gpa_float64 v0 = 0.0;
+    bool v0Found = false;
+    if ((r8 != 0.0) && (!v0Found || (v0 < r4)))
+    {
+        v0 = r4;
+        v0Found = true;
+    }
+    if ((r7 != 0.0) && (!v0Found || (v0 < r3)))
+    {
+        v0 = r3;
+        v0Found = true;
+    }
+    if ((r6 != 0.0) && (!v0Found || (v0 < r2)))
+    {
+        v0 = r2;
+        v0Found = true;
+    }
+    if ((r5 != 0.0) && (!v0Found || (v0 < r1)))
+    {
+        v0 = r1;
+        v0Found = true;
+    }
+    gpa_float64 v1 = 0.0;
+    bool v1Found = false;
+    if ((r16 != 0.0) && (!v1Found || (v1 < r12)))
+    {
+        v1 = r12;
+        v1Found = true;
+    }
+    if ((r15 != 0.0) && (!v1Found || (v1 < r11)))
+    {
+        v1 = r11;
+        v1Found = true;
+    }
+    if ((r14 != 0.0) && (!v1Found || (v1 < r10)))
+    {
+        v1 = r10;
+        v1Found = true;
+    }
+    if ((r13 != 0.0) && (!v1Found || (v1 < r9)))
+    {
+        v1 = r9;
+        v1Found = true;
+    }
+    const gpa_float64 v2 = (v0 > v1) ? v0 : v1;
+    const gpa_float64 v3 = (r17 != 0.0) ? (v2 / r17) : 0.0;
+    const gpa_float64 v4 = (v3 < 1.0) ? v3 : 1.0;
+    const gpa_float64 v5 = (static_cast<gpa_float64>(timestampFrequency) != 0.0) ? (r0 / static_cast<gpa_float64>(timestampFrequency)) : 0.0;
+    const gpa_float64 v6 = v5 * 1000000000.0;
+    const gpa_float64 v7 = v4 * v6;
+
+    *static_cast<gpa_float64*>(pResult) = v7;
+}
+
+/// Computes the VSVerticesIn counter: 0,1,2,3,sum4,4,5,6,7,sum4,4,5,6,7,sum4,ifnotzero,8,9,10,11,sum4,8,9,10,11,sum4,ifnotzero
+static void ComputeVSVerticesIn(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = r7 + r6 + r5 + r4;
+    const gpa_float64 v3 = (v2 != 0.0) ? v1 : v0;
+    const gpa_float64 v4 = r11 + r10 + r9 + r8;
+    const gpa_float64 v5 = r11 + r10 + r9 + r8;
+    const gpa_float64 v6 = (v5 != 0.0) ? v4 : v3;
+
+    *static_cast<gpa_float64*>(pResult) = v6;
+}
+
+/// Computes the VSVALUInstCount counter: 0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,sum4,12,13,14,15,sum4,/,16,17,18,19,sum4,ifnotzero,20,21,22,23,sum4,24,25,26,27,sum4,/,28,29,30,31,sum4,ifnotzero
+static void ComputeVSVALUInstCount(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = (v1 != 0.0) ? (v0 / v1) : 0.0;
+    const gpa_float64 v3 = r11 + r10 + r9 + r8;
+    const gpa_float64 v4 = r15 + r14 + r13 + r12;
+    const gpa_float64 v5 = (v4 != 0.0) ? (v3 / v4) : 0.0;
+    const gpa_float64 v6 = r19 + r18 + r17 + r16;
+    const gpa_float64 v7 = (v6 != 0.0) ? v5 : v2;
+    const gpa_float64 v8 = r23 + r22 + r21 + r20;
+    const gpa_float64 v9 = r27 + r26 + r25 + r24;
+    const gpa_float64 v10 = (v9 != 0.0) ? (v8 / v9) : 0.0;
+    const gpa_float64 v11 = r31 + r30 + r29 + r28;
+    const gpa_float64 v12 = (v11 != 0.0) ? v10 : v7;
+
+    *static_cast<gpa_float64*>(pResult) = v12;
+}
+
+/// Computes the VSSALUInstCount counter: 0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,sum4,12,13,14,15,sum4,/,16,17,18,19,sum4,ifnotzero,20,21,22,23,sum4,24,25,26,27,sum4,/,28,29,30,31,sum4,ifnotzero
+static void ComputeVSSALUInstCount(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = (v1 != 0.0) ? (v0 / v1) : 0.0;
+    const gpa_float64 v3 = r11 + r10 + r9 + r8;
+    const gpa_float64 v4 = r15 + r14 + r13 + r12;
+    const gpa_float64 v5 = (v4 != 0.0) ? (v3 / v4) : 0.0;
+    const gpa_float64 v6 = r19 + r18 + r17 + r16;
+    const gpa_float64 v7 = (v6 != 0.0) ? v5 : v2;
+    const gpa_float64 v8 = r23 + r22 + r21 + r20;
+    const gpa_float64 v9 = r27 + r26 + r25 + r24;
+    const gpa_float64 v10 = (v9 != 0.0) ? (v8 / v9) : 0.0;
+    const gpa_float64 v11 = r31 + r30 + r29 + r28;
+    const gpa_float64 v12 = (v11 != 0.0) ? v10 : v7;
+
+    *static_cast<gpa_float64*>(pResult) = v12;
+}
+
+/// Computes the VSVALUBusy counter: 0,1,2,3,sum4,4,5,6,7,sum4,8,9,10,11,sum4,ifnotzero,13,14,15,16,sum4,17,18,19,20,sum4,ifnotzero,(4),*,NUM_SIMDS,/,12,/,(100),*
+static void ComputeVSVALUBusy(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_simds = static_cast<gpa_float64>(pHwInfo->GetNumberSIMDs());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = r11 + r10 + r9 + r8;
+    const gpa_float64 v3 = (v2 != 0.0) ? v1 : v0;
+    const gpa_float64 v4 = r16 + r15 + r14 + r13;
+    const gpa_float64 v5 = r20 + r19 + r18 + r17;
+    const gpa_float64 v6 = (v5 != 0.0) ? v4 : v3;
+    const gpa_float64 v7 = v6 * 4.0;
+    const gpa_float64 v8 = (num_simds != 0.0) ? (v7 / num_simds) : 0.0;
+    const gpa_float64 v9 = (r12 != 0.0) ? (v8 / r12) : 0.0;
+    const gpa_float64 v10 = v9 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v10;
+}
+
+/// Computes the VSVALUBusyCycles counter: 0,1,2,3,sum4,4,5,6,7,sum4,8,9,10,11,sum4,ifnotzero,12,13,14,15,sum4,16,17,18,19,sum4,ifnotzero,(4),*,NUM_SIMDS,/
+static void ComputeVSVALUBusyCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_simds = static_cast<gpa_float64>(pHwInfo->GetNumberSIMDs());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = r11 + r10 + r9 + r8;
+    const gpa_float64 v3 = (v2 != 0.0) ? v1 : v0;
+    const gpa_float64 v4 = r15 + r14 + r13 + r12;
+    const gpa_float64 v5 = r19 + r18 + r17 + r16;
+    const gpa_float64 v6 = (v5 != 0.0) ? v4 : v3;
+    const gpa_float64 v7 = v6 * 4.0;
+    const gpa_float64 v8 = (num_simds != 0.0) ? (v7 / num_simds) : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v8;
+}
+
+/// Computes the VSSALUBusy counter: 0,1,2,3,sum4,4,5,6,7,sum4,8,9,10,11,sum4,ifnotzero,13,14,15,16,sum4,17,18,19,20,sum4,ifnotzero,NUM_CUS,/,12,/,(100),*
+static void ComputeVSSALUBusy(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_cus = static_cast<gpa_float64>(pHwInfo->GetNumberCUs());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = r11 + r10 + r9 + r8;
+    const gpa_float64 v3 = (v2 != 0.0) ? v1 : v0;
+    const gpa_float64 v4 = r16 + r15 + r14 + r13;
+    const gpa_float64 v5 = r20 + r19 + r18 + r17;
+    const gpa_float64 v6 = (v5 != 0.0) ? v4 : v3;
+    const gpa_float64 v7 = (num_cus != 0.0) ? (v6 / num_cus) : 0.0;
+    const gpa_float64 v8 = (r12 != 0.0) ? (v7 / r12) : 0.0;
+    const gpa_float64 v9 = v8 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v9;
+}
+
+/// Computes the VSSALUBusyCycles counter: 0,1,2,3,sum4,4,5,6,7,sum4,8,9,10,11,sum4,ifnotzero,12,13,14,15,sum4,16,17,18,19,sum4,ifnotzero,NUM_CUS,/
+static void ComputeVSSALUBusyCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_cus = static_cast<gpa_float64>(pHwInfo->GetNumberCUs());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = r11 + r10 + r9 + r8;
+    const gpa_float64 v3 = (v2 != 0.0) ? v1 : v0;
+    const gpa_float64 v4 = r15 + r14 + r13 + r12;
+    const gpa_float64 v5 = r19 + r18 + r17 + r16;
+    const gpa_float64 v6 = (v5 != 0.0) ? v4 : v3;
+    const gpa_float64 v7 = (num_cus != 0.0) ? (v6 / num_cus) : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v7;
+}
+
+/// Computes the HSPatches counter: 0,1,2,3,sum4
+static void ComputeHSPatches(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the HSVALUInstCount counter: 0,1,2,3,sum4,4,5,6,7,sum4,/
+static void ComputeHSVALUInstCount(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = (v1 != 0.0) ? (v0 / v1) : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v2;
+}
+
+/// Computes the HSSALUInstCount counter: 0,1,2,3,sum4,4,5,6,7,sum4,/
+static void ComputeHSSALUInstCount(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = (v1 != 0.0) ? (v0 / v1) : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v2;
+}
+
+/// Computes the HSVALUBusy counter: 0,1,2,3,sum4,(4),*,NUM_SIMDS,/,4,/,(100),*
+static void ComputeHSVALUBusy(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_simds = static_cast<gpa_float64>(pHwInfo->GetNumberSIMDs());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = v0 * 4.0;
+    const gpa_float64 v2 = (num_simds != 0.0) ? (v1 / num_simds) : 0.0;
+    const gpa_float64 v3 = (r4 != 0.0) ? (v2 / r4) : 0.0;
+    const gpa_float64 v4 = v3 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v4;
+}
+
+/// Computes the HSVALUBusyCycles counter: 0,1,2,3,sum4,(4),*,NUM_SIMDS,/
+static void ComputeHSVALUBusyCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_simds = static_cast<gpa_float64>(pHwInfo->GetNumberSIMDs());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = v0 * 4.0;
+    const gpa_float64 v2 = (num_simds != 0.0) ? (v1 / num_simds) : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v2;
+}
+
+/// Computes the HSSALUBusy counter: 0,1,2,3,sum4,NUM_CUS,/,4,/,(100),*
+static void ComputeHSSALUBusy(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_cus = static_cast<gpa_float64>(pHwInfo->GetNumberCUs());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = (num_cus != 0.0) ? (v0 / num_cus) : 0.0;
+    const gpa_float64 v2 = (r4 != 0.0) ? (v1 / r4) : 0.0;
+    const gpa_float64 v3 = v2 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v3;
+}
+
+/// Computes the HSSALUBusyCycles counter: 0,1,2,3,sum4,NUM_CUS,/
+static void ComputeHSSALUBusyCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_cus = static_cast<gpa_float64>(pHwInfo->GetNumberCUs());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = (num_cus != 0.0) ? (v0 / num_cus) : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v1;
+}
+
+/// Computes the DSVerticesIn counter: (0),0,1,2,3,sum4,4,5,6,7,sum4,4,5,6,7,sum4,ifnotzero,8,9,10,11,sum4,ifnotzero
+static void ComputeDSVerticesIn(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = r7 + r6 + r5 + r4;
+    const gpa_float64 v3 = (v2 != 0.0) ? v1 : v0;
+    const gpa_float64 v4 = r11 + r10 + r9 + r8;
+    const gpa_float64 v5 = (v4 != 0.0) ? v3 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v5;
+}
+
+/// Computes the DSVALUInstCount counter: (0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,sum4,12,13,14,15,sum4,/,16,17,18,19,sum4,ifnotzero,20,21,22,23,sum4,ifnotzero
+static void ComputeDSVALUInstCount(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = (v1 != 0.0) ? (v0 / v1) : 0.0;
+    const gpa_float64 v3 = r11 + r10 + r9 + r8;
+    const gpa_float64 v4 = r15 + r14 + r13 + r12;
+    const gpa_float64 v5 = (v4 != 0.0) ? (v3 / v4) : 0.0;
+    const gpa_float64 v6 = r19 + r18 + r17 + r16;
+    const gpa_float64 v7 = (v6 != 0.0) ? v5 : v2;
+    const gpa_float64 v8 = r23 + r22 + r21 + r20;
+    const gpa_float64 v9 = (v8 != 0.0) ? v7 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v9;
+}
+
+/// Computes the DSSALUInstCount counter: (0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,sum4,12,13,14,15,sum4,/,16,17,18,19,sum4,ifnotzero,20,21,22,23,sum4,ifnotzero
+static void ComputeDSSALUInstCount(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = (v1 != 0.0) ? (v0 / v1) : 0.0;
+    const gpa_float64 v3 = r11 + r10 + r9 + r8;
+    const gpa_float64 v4 = r15 + r14 + r13 + r12;
+    const gpa_float64 v5 = (v4 != 0.0) ? (v3 / v4) : 0.0;
+    const gpa_float64 v6 = r19 + r18 + r17 + r16;
+    const gpa_float64 v7 = (v6 != 0.0) ? v5 : v2;
+    const gpa_float64 v8 = r23 + r22 + r21 + r20;
+    const gpa_float64 v9 = (v8 != 0.0) ? v7 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v9;
+}
+
+/// Computes the DSVALUBusy counter: (0),0,1,2,3,sum4,4,5,6,7,sum4,9,10,11,12,sum4,ifnotzero,13,14,15,16,sum4,ifnotzero,(4),*,NUM_SIMDS,/,8,/,(100),*
+static void ComputeDSVALUBusy(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_simds = static_cast<gpa_float64>(pHwInfo->GetNumberSIMDs());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = r12 + r11 + r10 + r9;
+    const gpa_float64 v3 = (v2 != 0.0) ? v1 : v0;
+    const gpa_float64 v4 = r16 + r15 + r14 + r13;
+    const gpa_float64 v5 = (v4 != 0.0) ? v3 : 0.0;
+    const gpa_float64 v6 = v5 * 4.0;
+    const gpa_float64 v7 = (num_simds != 0.0) ? (v6 / num_simds) : 0.0;
+    const gpa_float64 v8 = (r8 != 0.0) ? (v7 / r8) : 0.0;
+    const gpa_float64 v9 = v8 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v9;
+}
+
+/// Computes the DSVALUBusyCycles counter: (0),0,1,2,3,sum4,4,5,6,7,sum4,8,9,10,11,sum4,ifnotzero,12,13,14,15,sum4,ifnotzero,(4),*,NUM_SIMDS,/
+static void ComputeDSVALUBusyCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_simds = static_cast<gpa_float64>(pHwInfo->GetNumberSIMDs());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = r11 + r10 + r9 + r8;
+    const gpa_float64 v3 = (v2 != 0.0) ? v1 : v0;
+    const gpa_float64 v4 = r15 + r14 + r13 + r12;
+    const gpa_float64 v5 = (v4 != 0.0) ? v3 : 0.0;
+    const gpa_float64 v6 = v5 * 4.0;
+    const gpa_float64 v7 = (num_simds != 0.0) ? (v6 / num_simds) : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v7;
+}
+
+/// Computes the DSSALUBusy counter: (0),0,1,2,3,sum4,4,5,6,7,sum4,9,10,11,12,sum4,ifnotzero,13,14,15,16,sum4,ifnotzero,NUM_CUS,/,8,/,(100),*
+static void ComputeDSSALUBusy(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_cus = static_cast<gpa_float64>(pHwInfo->GetNumberCUs());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = r12 + r11 + r10 + r9;
+    const gpa_float64 v3 = (v2 != 0.0) ? v1 : v0;
+    const gpa_float64 v4 = r16 + r15 + r14 + r13;
+    const gpa_float64 v5 = (v4 != 0.0) ? v3 : 0.0;
+    const gpa_float64 v6 = (num_cus != 0.0) ? (v5 / num_cus) : 0.0;
+    const gpa_float64 v7 = (r8 != 0.0) ? (v6 / r8) : 0.0;
+    const gpa_float64 v8 = v7 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v8;
+}
+
+/// Computes the DSSALUBusyCycles counter: (0),0,1,2,3,sum4,4,5,6,7,sum4,8,9,10,11,sum4,ifnotzero,12,13,14,15,sum4,ifnotzero,NUM_CUS,/
+static void ComputeDSSALUBusyCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_cus = static_cast<gpa_float64>(pHwInfo->GetNumberCUs());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = r11 + r10 + r9 + r8;
+    const gpa_float64 v3 = (v2 != 0.0) ? v1 : v0;
+    const gpa_float64 v4 = r15 + r14 + r13 + r12;
+    const gpa_float64 v5 = (v4 != 0.0) ? v3 : 0.0;
+    const gpa_float64 v6 = (num_cus != 0.0) ? (v5 / num_cus) : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v6;
+}
+
+/// Computes the GSPrimsIn counter: 0,1,2,3,sum4
+static void ComputeGSPrimsIn(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the GSVerticesOut counter: (0),0,1,2,3,sum4,4,5,6,7,sum4,ifnotzero
+static void ComputeGSVerticesOut(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = (v1 != 0.0) ? v0 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v2;
+}
+
+/// Computes the GSVALUInstCount counter: 0,1,2,3,sum4,4,5,6,7,sum4,/
+static void ComputeGSVALUInstCount(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = (v1 != 0.0) ? (v0 / v1) : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v2;
+}
+
+/// Computes the GSSALUInstCount counter: 0,1,2,3,sum4,4,5,6,7,sum4,/
+static void ComputeGSSALUInstCount(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = (v1 != 0.0) ? (v0 / v1) : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v2;
+}
+
+/// Computes the GSVALUBusy counter: 0,1,2,3,sum4,(4),*,NUM_SIMDS,/,4,/,(100),*
+static void ComputeGSVALUBusy(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_simds = static_cast<gpa_float64>(pHwInfo->GetNumberSIMDs());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = v0 * 4.0;
+    const gpa_float64 v2 = (num_simds != 0.0) ? (v1 / num_simds) : 0.0;
+    const gpa_float64 v3 = (r4 != 0.0) ? (v2 / r4) : 0.0;
+    const gpa_float64 v4 = v3 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v4;
+}
+
+/// Computes the GSVALUBusyCycles counter: 0,1,2,3,sum4,(4),*,NUM_SIMDS,/
+static void ComputeGSVALUBusyCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_simds = static_cast<gpa_float64>(pHwInfo->GetNumberSIMDs());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = v0 * 4.0;
+    const gpa_float64 v2 = (num_simds != 0.0) ? (v1 / num_simds) : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v2;
+}
+
+/// Computes the GSSALUBusy counter: 0,1,2,3,sum4,NUM_CUS,/,4,/,(100),*
+static void ComputeGSSALUBusy(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_cus = static_cast<gpa_float64>(pHwInfo->GetNumberCUs());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = (num_cus != 0.0) ? (v0 / num_cus) : 0.0;
+    const gpa_float64 v2 = (r4 != 0.0) ? (v1 / r4) : 0.0;
+    const gpa_float64 v3 = v2 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v3;
+}
+
+/// Computes the GSSALUBusyCycles counter: 0,1,2,3,sum4,NUM_CUS,/
+static void ComputeGSSALUBusyCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_cus = static_cast<gpa_float64>(pHwInfo->GetNumberCUs());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = (num_cus != 0.0) ? (v0 / num_cus) : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v1;
+}
+
+/// Computes the PrimitiveAssemblyBusy counter: 0,4,-,8,12,+,16,+,20,(2),*,+,SU_CLOCKS_PRIM,*,-,1,5,-,9,13,+,17,+,21,(2),*,+,SU_CLOCKS_PRIM,*,-,max,2,6,-,10,14,+,18,+,22,(2),*,+,SU_CLOCKS_PRIM,*,-,max,3,7,-,11,15,+,19,+,23,(2),*,+,SU_CLOCKS_PRIM,*,-,max,(0),max,24,/,(100),*,(100),min
+static void ComputePrimitiveAssemblyBusy(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 su_clocks_prim = static_cast<gpa_float64>(pHwInfo->GetSUClocksPrim());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+
+    const gpa_float64 v0 = r0 - r4;
+    const gpa_float64 v1 = r8 + r12;
+    const gpa_float64 v2 = v1 + r16;
+    const gpa_float64 v3 = r20 * 2.0;
+    const gpa_float64 v4 = v2 + v3;
+    const gpa_float64 v5 = v4 * su_clocks_prim;
+    const gpa_float64 v6 = v0 - v5;
+    const gpa_float64 v7 = r1 - r5;
+    const gpa_float64 v8 = r9 + r13;
+    const gpa_float64 v9 = v8 + r17;
+    const gpa_float64 v10 = r21 * 2.0;
+    const gpa_float64 v11 = v9 + v10;
+    const gpa_float64 v12 = v11 * su_clocks_prim;
+    const gpa_float64 v13 = v7 - v12;
+    const gpa_float64 v14 = (v6 > v13) ? v6 : v13;
+    const gpa_float64 v15 = r2 - r6;
+    const gpa_float64 v16 = r10 + r14;
+    const gpa_float64 v17 = v16 + r18;
+    const gpa_float64 v18 = r22 * 2.0;
+    const gpa_float64 v19 = v17 + v18;
+    const gpa_float64 v20 = v19 * su_clocks_prim;
+    const gpa_float64 v21 = v15 - v20;
+    const gpa_float64 v22 = (v14 > v21) ? v14 : v21;
+    const gpa_float64 v23 = r3 - r7;
+    const gpa_float64 v24 = r11 + r15;
+    const gpa_float64 v25 = v24 + r19;
+    const gpa_float64 v26 = r23 * 2.0;
+    const gpa_float64 v27 = v25 + v26;
+    const gpa_float64 v28 = v27 * su_clocks_prim;
+    const gpa_float64 v29 = v23 - v28;
+    const gpa_float64 v30 = (v22 > v29) ? v22 : v29;
+    const gpa_float64 v31 = (v30 > 0.0) ? v30 : 0.0;
+    const gpa_float64 v32 = (r24 != 0.0) ? (v31 / r24) : 0.0;
+    const gpa_float64 v33 = v32 * 100.0;
+    const gpa_float64 v34 = (v33 < 100.0) ? v33 : 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v34;
+}
+
+/// Computes the PrimitiveAssemblyBusyCycles counter: 0,4,-,8,12,+,16,+,20,(2),*,+,SU_CLOCKS_PRIM,*,-,1,5,-,9,13,+,17,+,21,(2),*,+,SU_CLOCKS_PRIM,*,-,max,2,6,-,10,14,+,18,+,22,(2),*,+,SU_CLOCKS_PRIM,*,-,max,3,7,-,11,15,+,19,+,23,(2),*,+,SU_CLOCKS_PRIM,*,-,max,(0),max
+static void ComputePrimitiveAssemblyBusyCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 su_clocks_prim = static_cast<gpa_float64>(pHwInfo->GetSUClocksPrim());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+
+    const gpa_float64 v0 = r0 - r4;
+    const gpa_float64 v1 = r8 + r12;
+    const gpa_float64 v2 = v1 + r16;
+    const gpa_float64 v3 = r20 * 2.0;
+    const gpa_float64 v4 = v2 + v3;
+    const gpa_float64 v5 = v4 * su_clocks_prim;
+    const gpa_float64 v6 = v0 - v5;
+    const gpa_float64 v7 = r1 - r5;
+    const gpa_float64 v8 = r9 + r13;
+    const gpa_float64 v9 = v8 + r17;
+    const gpa_float64 v10 = r21 * 2.0;
+    const gpa_float64 v11 = v9 + v10;
+    const gpa_float64 v12 = v11 * su_clocks_prim;
+    const gpa_float64 v13 = v7 - v12;
+    const gpa_float64 v14 = (v6 > v13) ? v6 : v13;
+    const gpa_float64 v15 = r2 - r6;
+    const gpa_float64 v16 = r10 + r14;
+    const gpa_float64 v17 = v16 + r18;
+    const gpa_float64 v18 = r22 * 2.0;
+    const gpa_float64 v19 = v17 + v18;
+    const gpa_float64 v20 = v19 * su_clocks_prim;
+    const gpa_float64 v21 = v15 - v20;
+    const gpa_float64 v22 = (v14 > v21) ? v14 : v21;
+    const gpa_float64 v23 = r3 - r7;
+    const gpa_float64 v24 = r11 + r15;
+    const gpa_float64 v25 = v24 + r19;
+    const gpa_float64 v26 = r23 * 2.0;
+    const gpa_float64 v27 = v25 + v26;
+    const gpa_float64 v28 = v27 * su_clocks_prim;
+    const gpa_float64 v29 = v23 - v28;
+    const gpa_float64 v30 = (v22 > v29) ? v22 : v29;
+    const gpa_float64 v31 = (v30 > 0.0) ? v30 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v31;
+}
+
+/// Computes the PrimitivesIn counter: 0,1,2,3,sum4
+static void ComputePrimitivesIn(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the CulledPrims counter: 0,1,+,2,+,3,+,4,+,5,+,6,+,7,+,8,+,9,+,10,+,11,+,12,+,13,+,14,+,15,+,16,+,17,+,18,+,19,+
+static void ComputeCulledPrims(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+
+    const gpa_float64 v0 = r0 + r1;
+    const gpa_float64 v1 = v0 + r2;
+    const gpa_float64 v2 = v1 + r3;
+    const gpa_float64 v3 = v2 + r4;
+    const gpa_float64 v4 = v3 + r5;
+    const gpa_float64 v5 = v4 + r6;
+    const gpa_float64 v6 = v5 + r7;
+    const gpa_float64 v7 = v6 + r8;
+    const gpa_float64 v8 = v7 + r9;
+    const gpa_float64 v9 = v8 + r10;
+    const gpa_float64 v10 = v9 + r11;
+    const gpa_float64 v11 = v10 + r12;
+    const gpa_float64 v12 = v11 + r13;
+    const gpa_float64 v13 = v12 + r14;
+    const gpa_float64 v14 = v13 + r15;
+    const gpa_float64 v15 = v14 + r16;
+    const gpa_float64 v16 = v15 + r17;
+    const gpa_float64 v17 = v16 + r18;
+    const gpa_float64 v18 = v17 + r19;
+
+    *static_cast<gpa_float64*>(pResult) = v18;
+}
+
+/// Computes the ClippedPrims counter: 0,1,2,3,sum4
+static void ComputeClippedPrims(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the PAStalledOnRasterizer counter: 0,1,max,2,max,3,max,4,/,(100),*
+static void ComputePAStalledOnRasterizer(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+
+    const gpa_float64 v0 = (r0 > r1) ? r0 : r1;
+    const gpa_float64 v1 = (v0 > r2) ? v0 : r2;
+    const gpa_float64 v2 = (v1 > r3) ? v1 : r3;
+    const gpa_float64 v3 = (r4 != 0.0) ? (v2 / r4) : 0.0;
+    const gpa_float64 v4 = v3 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v4;
+}
+
+/// Computes the PAStalledOnRasterizerCycles counter: 0,1,max,2,max,3,max
+static void ComputePAStalledOnRasterizerCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+
+    const gpa_float64 v0 = (r0 > r1) ? r0 : r1;
+    const gpa_float64 v1 = (v0 > r2) ? v0 : r2;
+    const gpa_float64 v2 = (v1 > r3) ? v1 : r3;
+
+    *static_cast<gpa_float64*>(pResult) = v2;
+}
+
+/// Computes the PSPixelsOut counter: 0,1,2,3,sum4,4,5,6,7,sum4,8,9,10,11,sum4,12,13,14,15,sum4,sum4
+static void ComputePSPixelsOut(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = r11 + r10 + r9 + r8;
+    const gpa_float64 v3 = r15 + r14 + r13 + r12;
+    const gpa_float64 v4 = v3 + v2 + v1 + v0;
+
+    *static_cast<gpa_float64*>(pResult) = v4;
+}
+
+/// Computes the PSExportStalls counter: 0,1,max,2,max,3,max,4,max,5,max,6,max,7,max,8,max,9,max,10,max,11,max,12,max,13,max,14,max,15,max,16,/,(100),*
+static void ComputePSExportStalls(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+
+    const gpa_float64 v0 = (r0 > r1) ? r0 : r1;
+    const gpa_float64 v1 = (v0 > r2) ? v0 : r2;
+    const gpa_float64 v2 = (v1 > r3) ? v1 : r3;
+    const gpa_float64 v3 = (v2 > r4) ? v2 : r4;
+    const gpa_float64 v4 = (v3 > r5) ? v3 : r5;
+    const gpa_float64 v5 = (v4 > r6) ? v4 : r6;
+    const gpa_float64 v6 = (v5 > r7) ? v5 : r7;
+    const gpa_float64 v7 = (v6 > r8) ? v6 : r8;
+    const gpa_float64 v8 = (v7 > r9) ? v7 : r9;
+    const gpa_float64 v9 = (v8 > r10) ? v8 : r10;
+    const gpa_float64 v10 = (v9 > r11) ? v9 : r11;
+    const gpa_float64 v11 = (v10 > r12) ? v10 : r12;
+    const gpa_float64 v12 = (v11 > r13) ? v11 : r13;
+    const gpa_float64 v13 = (v12 > r14) ? v12 : r14;
+    const gpa_float64 v14 = (v13 > r15) ? v13 : r15;
+    const gpa_float64 v15 = (r16 != 0.0) ? (v14 / r16) : 0.0;
+    const gpa_float64 v16 = v15 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v16;
+}
+
+/// Computes the PSExportStallsCycles counter: 0,1,max,2,max,3,max,4,max,5,max,6,max,7,max,8,max,9,max,10,max,11,max,12,max,13,max,14,max,15,max
+static void ComputePSExportStallsCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = (r0 > r1) ? r0 : r1;
+    const gpa_float64 v1 = (v0 > r2) ? v0 : r2;
+    const gpa_float64 v2 = (v1 > r3) ? v1 : r3;
+    const gpa_float64 v3 = (v2 > r4) ? v2 : r4;
+    const gpa_float64 v4 = (v3 > r5) ? v3 : r5;
+    const gpa_float64 v5 = (v4 > r6) ? v4 : r6;
+    const gpa_float64 v6 = (v5 > r7) ? v5 : r7;
+    const gpa_float64 v7 = (v6 > r8) ? v6 : r8;
+    const gpa_float64 v8 = (v7 > r9) ? v7 : r9;
+    const gpa_float64 v9 = (v8 > r10) ? v8 : r10;
+    const gpa_float64 v10 = (v9 > r11) ? v9 : r11;
+    const gpa_float64 v11 = (v10 > r12) ? v10 : r12;
+    const gpa_float64 v12 = (v11 > r13) ? v11 : r13;
+    const gpa_float64 v13 = (v12 > r14) ? v12 : r14;
+    const gpa_float64 v14 = (v13 > r15) ? v13 : r15;
+
+    *static_cast<gpa_float64*>(pResult) = v14;
+}
+
+/// Computes the PSVALUInstCount counter: 0,1,2,3,sum4,4,5,6,7,sum4,/
+static void ComputePSVALUInstCount(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = (v1 != 0.0) ? (v0 / v1) : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v2;
+}
+
+/// Computes the PSSALUInstCount counter: 0,1,2,3,sum4,4,5,6,7,sum4,/
+static void ComputePSSALUInstCount(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = (v1 != 0.0) ? (v0 / v1) : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v2;
+}
+
+/// Computes the PSVALUBusy counter: 0,1,2,3,sum4,(4),*,NUM_SIMDS,/,4,/,(100),*
+static void ComputePSVALUBusy(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_simds = static_cast<gpa_float64>(pHwInfo->GetNumberSIMDs());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = v0 * 4.0;
+    const gpa_float64 v2 = (num_simds != 0.0) ? (v1 / num_simds) : 0.0;
+    const gpa_float64 v3 = (r4 != 0.0) ? (v2 / r4) : 0.0;
+    const gpa_float64 v4 = v3 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v4;
+}
+
+/// Computes the PSVALUBusyCycles counter: 0,1,2,3,sum4,(4),*,NUM_SIMDS,/
+static void ComputePSVALUBusyCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_simds = static_cast<gpa_float64>(pHwInfo->GetNumberSIMDs());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = v0 * 4.0;
+    const gpa_float64 v2 = (num_simds != 0.0) ? (v1 / num_simds) : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v2;
+}
+
+/// Computes the PSSALUBusy counter: 0,1,2,3,sum4,NUM_CUS,/,4,/,(100),*
+static void ComputePSSALUBusy(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_cus = static_cast<gpa_float64>(pHwInfo->GetNumberCUs());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = (num_cus != 0.0) ? (v0 / num_cus) : 0.0;
+    const gpa_float64 v2 = (r4 != 0.0) ? (v1 / r4) : 0.0;
+    const gpa_float64 v3 = v2 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v3;
+}
+
+/// Computes the PSSALUBusyCycles counter: 0,1,2,3,sum4,NUM_CUS,/
+static void ComputePSSALUBusyCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_cus = static_cast<gpa_float64>(pHwInfo->GetNumberCUs());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = (num_cus != 0.0) ? (v0 / num_cus) : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v1;
+}
+
+/// Computes the CSThreadGroups counter: 0,1,2,3,4,5,6,7,sum8
+static void ComputeCSThreadGroups(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+
+    const gpa_float64 v0 = r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the CSWavefronts counter: 0,1,2,3,4,5,6,7,sum8
+static void ComputeCSWavefronts(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+
+    const gpa_float64 v0 = r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the CSThreads counter: (0),0,1,2,3,4,5,6,7,sum8,8,9,10,11,sum4,ifnotzero
+static void ComputeCSThreads(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+
+    const gpa_float64 v0 = r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r11 + r10 + r9 + r8;
+    const gpa_float64 v2 = (v1 != 0.0) ? v0 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v2;
+}
+
+/// Computes the CSVALUInsts counter: (0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,12,13,14,15,sum8,ifnotzero
+static void ComputeCSVALUInsts(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = (v1 != 0.0) ? (v0 / v1) : 0.0;
+    const gpa_float64 v3 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8;
+    const gpa_float64 v4 = (v3 != 0.0) ? v2 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v4;
+}
+
+/// Computes the CSVALUUtilization counter: (0),0,1,2,3,sum4,4,5,6,7,sum4,(64),*,/,(100),*,8,9,10,11,12,13,14,15,sum8,ifnotzero,(100),min
+static void ComputeCSVALUUtilization(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = v1 * 64.0;
+    const gpa_float64 v3 = (v2 != 0.0) ? (v0 / v2) : 0.0;
+    const gpa_float64 v4 = v3 * 100.0;
+    const gpa_float64 v5 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8;
+    const gpa_float64 v6 = (v5 != 0.0) ? v4 : 0.0;
+    const gpa_float64 v7 = (v6 < 100.0) ? v6 : 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v7;
+}
+
+/// Computes the CSSALUInsts counter: (0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,12,13,14,15,sum8,ifnotzero
+static void ComputeCSSALUInsts(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = (v1 != 0.0) ? (v0 / v1) : 0.0;
+    const gpa_float64 v3 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8;
+    const gpa_float64 v4 = (v3 != 0.0) ? v2 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v4;
+}
+
+/// Computes the CSVFetchInsts counter: (0),0,1,2,3,sum4,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,sum64,-,68,69,70,71,sum4,/,72,73,74,75,76,77,78,79,sum8,ifnotzero
+static void ComputeCSVFetchInsts(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+    const gpa_float64 r32 = static_cast<gpa_float64>(*results[32]);
+    const gpa_float64 r33 = static_cast<gpa_float64>(*results[33]);
+    const gpa_float64 r34 = static_cast<gpa_float64>(*results[34]);
+    const gpa_float64 r35 = static_cast<gpa_float64>(*results[35]);
+    const gpa_float64 r36 = static_cast<gpa_float64>(*results[36]);
+    const gpa_float64 r37 = static_cast<gpa_float64>(*results[37]);
+    const gpa_float64 r38 = static_cast<gpa_float64>(*results[38]);
+    const gpa_float64 r39 = static_cast<gpa_float64>(*results[39]);
+    const gpa_float64 r40 = static_cast<gpa_float64>(*results[40]);
+    const gpa_float64 r41 = static_cast<gpa_float64>(*results[41]);
+    const gpa_float64 r42 = static_cast<gpa_float64>(*results[42]);
+    const gpa_float64 r43 = static_cast<gpa_float64>(*results[43]);
+    const gpa_float64 r44 = static_cast<gpa_float64>(*results[44]);
+    const gpa_float64 r45 = static_cast<gpa_float64>(*results[45]);
+    const gpa_float64 r46 = static_cast<gpa_float64>(*results[46]);
+    const gpa_float64 r47 = static_cast<gpa_float64>(*results[47]);
+    const gpa_float64 r48 = static_cast<gpa_float64>(*results[48]);
+    const gpa_float64 r49 = static_cast<gpa_float64>(*results[49]);
+    const gpa_float64 r50 = static_cast<gpa_float64>(*results[50]);
+    const gpa_float64 r51 = static_cast<gpa_float64>(*results[51]);
+    const gpa_float64 r52 = static_cast<gpa_float64>(*results[52]);
+    const gpa_float64 r53 = static_cast<gpa_float64>(*results[53]);
+    const gpa_float64 r54 = static_cast<gpa_float64>(*results[54]);
+    const gpa_float64 r55 = static_cast<gpa_float64>(*results[55]);
+    const gpa_float64 r56 = static_cast<gpa_float64>(*results[56]);
+    const gpa_float64 r57 = static_cast<gpa_float64>(*results[57]);
+    const gpa_float64 r58 = static_cast<gpa_float64>(*results[58]);
+    const gpa_float64 r59 = static_cast<gpa_float64>(*results[59]);
+    const gpa_float64 r60 = static_cast<gpa_float64>(*results[60]);
+    const gpa_float64 r61 = static_cast<gpa_float64>(*results[61]);
+    const gpa_float64 r62 = static_cast<gpa_float64>(*results[62]);
+    const gpa_float64 r63 = static_cast<gpa_float64>(*results[63]);
+    const gpa_float64 r64 = static_cast<gpa_float64>(*results[64]);
+    const gpa_float64 r65 = static_cast<gpa_float64>(*results[65]);
+    const gpa_float64 r66 = static_cast<gpa_float64>(*results[66]);
+    const gpa_float64 r67 = static_cast<gpa_float64>(*results[67]);
+    const gpa_float64 r68 = static_cast<gpa_float64>(*results[68]);
+    const gpa_float64 r69 = static_cast<gpa_float64>(*results[69]);
+    const gpa_float64 r70 = static_cast<gpa_float64>(*results[70]);
+    const gpa_float64 r71 = static_cast<gpa_float64>(*results[71]);
+    const gpa_float64 r72 = static_cast<gpa_float64>(*results[72]);
+    const gpa_float64 r73 = static_cast<gpa_float64>(*results[73]);
+    const gpa_float64 r74 = static_cast<gpa_float64>(*results[74]);
+    const gpa_float64 r75 = static_cast<gpa_float64>(*results[75]);
+    const gpa_float64 r76 = static_cast<gpa_float64>(*results[76]);
+    const gpa_float64 r77 = static_cast<gpa_float64>(*results[77]);
+    const gpa_float64 r78 = static_cast<gpa_float64>(*results[78]);
+    const gpa_float64 r79 = static_cast<gpa_float64>(*results[79]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r67 + r66 + r65 + r64 + r63 + r62 + r61 + r60 + r59 + r58 + r57 + r56 + r55 + r54 + r53 + r52 + r51 + r50 + r49 + r48 + r47 + r46 + r45 + r44 + r43 + r42 + r41 + r40 + r39 + r38 + r37 + r36 + r35 + r34 + r33 + r32 + r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16 + r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = v0 - v1;
+    const gpa_float64 v3 = r71 + r70 + r69 + r68;
+    const gpa_float64 v4 = (v3 != 0.0) ? (v2 / v3) : 0.0;
+    const gpa_float64 v5 = r79 + r78 + r77 + r76 + r75 + r74 + r73 + r72;
+    const gpa_float64 v6 = (v5 != 0.0) ? v4 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v6;
+}
+
+/// Computes the CSSFetchInsts counter: (0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,12,13,14,15,sum8,ifnotzero
+static void ComputeCSSFetchInsts(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = (v1 != 0.0) ? (v0 / v1) : 0.0;
+    const gpa_float64 v3 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8;
+    const gpa_float64 v4 = (v3 != 0.0) ? v2 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v4;
+}
+
+/// Computes the CSVWriteInsts counter: (0),0,1,2,3,sum4,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,sum64,-,68,69,70,71,sum4,/,72,73,74,75,76,77,78,79,sum8,ifnotzero
+static void ComputeCSVWriteInsts(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+    const gpa_float64 r32 = static_cast<gpa_float64>(*results[32]);
+    const gpa_float64 r33 = static_cast<gpa_float64>(*results[33]);
+    const gpa_float64 r34 = static_cast<gpa_float64>(*results[34]);
+    const gpa_float64 r35 = static_cast<gpa_float64>(*results[35]);
+    const gpa_float64 r36 = static_cast<gpa_float64>(*results[36]);
+    const gpa_float64 r37 = static_cast<gpa_float64>(*results[37]);
+    const gpa_float64 r38 = static_cast<gpa_float64>(*results[38]);
+    const gpa_float64 r39 = static_cast<gpa_float64>(*results[39]);
+    const gpa_float64 r40 = static_cast<gpa_float64>(*results[40]);
+    const gpa_float64 r41 = static_cast<gpa_float64>(*results[41]);
+    const gpa_float64 r42 = static_cast<gpa_float64>(*results[42]);
+    const gpa_float64 r43 = static_cast<gpa_float64>(*results[43]);
+    const gpa_float64 r44 = static_cast<gpa_float64>(*results[44]);
+    const gpa_float64 r45 = static_cast<gpa_float64>(*results[45]);
+    const gpa_float64 r46 = static_cast<gpa_float64>(*results[46]);
+    const gpa_float64 r47 = static_cast<gpa_float64>(*results[47]);
+    const gpa_float64 r48 = static_cast<gpa_float64>(*results[48]);
+    const gpa_float64 r49 = static_cast<gpa_float64>(*results[49]);
+    const gpa_float64 r50 = static_cast<gpa_float64>(*results[50]);
+    const gpa_float64 r51 = static_cast<gpa_float64>(*results[51]);
+    const gpa_float64 r52 = static_cast<gpa_float64>(*results[52]);
+    const gpa_float64 r53 = static_cast<gpa_float64>(*results[53]);
+    const gpa_float64 r54 = static_cast<gpa_float64>(*results[54]);
+    const gpa_float64 r55 = static_cast<gpa_float64>(*results[55]);
+    const gpa_float64 r56 = static_cast<gpa_float64>(*results[56]);
+    const gpa_float64 r57 = static_cast<gpa_float64>(*results[57]);
+    const gpa_float64 r58 = static_cast<gpa_float64>(*results[58]);
+    const gpa_float64 r59 = static_cast<gpa_float64>(*results[59]);
+    const gpa_float64 r60 = static_cast<gpa_float64>(*results[60]);
+    const gpa_float64 r61 = static_cast<gpa_float64>(*results[61]);
+    const gpa_float64 r62 = static_cast<gpa_float64>(*results[62]);
+    const gpa_float64 r63 = static_cast<gpa_float64>(*results[63]);
+    const gpa_float64 r64 = static_cast<gpa_float64>(*results[64]);
+    const gpa_float64 r65 = static_cast<gpa_float64>(*results[65]);
+    const gpa_float64 r66 = static_cast<gpa_float64>(*results[66]);
+    const gpa_float64 r67 = static_cast<gpa_float64>(*results[67]);
+    const gpa_float64 r68 = static_cast<gpa_float64>(*results[68]);
+    const gpa_float64 r69 = static_cast<gpa_float64>(*results[69]);
+    const gpa_float64 r70 = static_cast<gpa_float64>(*results[70]);
+    const gpa_float64 r71 = static_cast<gpa_float64>(*results[71]);
+    const gpa_float64 r72 = static_cast<gpa_float64>(*results[72]);
+    const gpa_float64 r73 = static_cast<gpa_float64>(*results[73]);
+    const gpa_float64 r74 = static_cast<gpa_float64>(*results[74]);
+    const gpa_float64 r75 = static_cast<gpa_float64>(*results[75]);
+    const gpa_float64 r76 = static_cast<gpa_float64>(*results[76]);
+    const gpa_float64 r77 = static_cast<gpa_float64>(*results[77]);
+    const gpa_float64 r78 = static_cast<gpa_float64>(*results[78]);
+    const gpa_float64 r79 = static_cast<gpa_float64>(*results[79]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r67 + r66 + r65 + r64 + r63 + r62 + r61 + r60 + r59 + r58 + r57 + r56 + r55 + r54 + r53 + r52 + r51 + r50 + r49 + r48 + r47 + r46 + r45 + r44 + r43 + r42 + r41 + r40 + r39 + r38 + r37 + r36 + r35 + r34 + r33 + r32 + r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16 + r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = v0 - v1;
+    const gpa_float64 v3 = r71 + r70 + r69 + r68;
+    const gpa_float64 v4 = (v3 != 0.0) ? (v2 / v3) : 0.0;
+    const gpa_float64 v5 = r79 + r78 + r77 + r76 + r75 + r74 + r73 + r72;
+    const gpa_float64 v6 = (v5 != 0.0) ? v4 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v6;
+}
+
+/// Computes the CSFlatVMemInsts counter: (0),0,1,2,3,sum4,4,5,6,7,sum4,-,8,9,10,11,sum4,/,12,13,14,15,16,17,18,19,sum8,ifnotzero
+static void ComputeCSFlatVMemInsts(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = v0 - v1;
+    const gpa_float64 v3 = r11 + r10 + r9 + r8;
+    const gpa_float64 v4 = (v3 != 0.0) ? (v2 / v3) : 0.0;
+    const gpa_float64 v5 = r19 + r18 + r17 + r16 + r15 + r14 + r13 + r12;
+    const gpa_float64 v6 = (v5 != 0.0) ? v4 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v6;
+}
+
+/// Computes the CSVALUBusy counter: (0),0,1,2,3,sum4,(4),*,NUM_SIMDS,/,4,/,(100),*,5,6,7,8,9,10,11,12,sum8,ifnotzero
+static void ComputeCSVALUBusy(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_simds = static_cast<gpa_float64>(pHwInfo->GetNumberSIMDs());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = v0 * 4.0;
+    const gpa_float64 v2 = (num_simds != 0.0) ? (v1 / num_simds) : 0.0;
+    const gpa_float64 v3 = (r4 != 0.0) ? (v2 / r4) : 0.0;
+    const gpa_float64 v4 = v3 * 100.0;
+    const gpa_float64 v5 = r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5;
+    const gpa_float64 v6 = (v5 != 0.0) ? v4 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v6;
+}
+
+/// Computes the CSVALUBusyCycles counter: (0),0,1,2,3,sum4,(4),*,NUM_SIMDS,/,4,5,6,7,8,9,10,11,sum8,ifnotzero
+static void ComputeCSVALUBusyCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_simds = static_cast<gpa_float64>(pHwInfo->GetNumberSIMDs());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = v0 * 4.0;
+    const gpa_float64 v2 = (num_simds != 0.0) ? (v1 / num_simds) : 0.0;
+    const gpa_float64 v3 = r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4;
+    const gpa_float64 v4 = (v3 != 0.0) ? v2 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v4;
+}
+
+/// Computes the CSSALUBusy counter: (0),0,1,2,3,sum4,NUM_CUS,/,4,/,(100),*,5,6,7,8,9,10,11,12,sum8,ifnotzero
+static void ComputeCSSALUBusy(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_cus = static_cast<gpa_float64>(pHwInfo->GetNumberCUs());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = (num_cus != 0.0) ? (v0 / num_cus) : 0.0;
+    const gpa_float64 v2 = (r4 != 0.0) ? (v1 / r4) : 0.0;
+    const gpa_float64 v3 = v2 * 100.0;
+    const gpa_float64 v4 = r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5;
+    const gpa_float64 v5 = (v4 != 0.0) ? v3 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v5;
+}
+
+/// Computes the CSSALUBusyCycles counter: (0),0,1,2,3,sum4,NUM_CUS,/,4,5,6,7,8,9,10,11,sum8,ifnotzero
+static void ComputeCSSALUBusyCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_cus = static_cast<gpa_float64>(pHwInfo->GetNumberCUs());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = (num_cus != 0.0) ? (v0 / num_cus) : 0.0;
+    const gpa_float64 v2 = r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4;
+    const gpa_float64 v3 = (v2 != 0.0) ? v1 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v3;
+}
+
+/// Computes the CSMemUnitBusy counter: (0),0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64,64,/,(100),*,65,66,67,68,69,70,71,72,sum8,ifnotzero
+static void ComputeCSMemUnitBusy(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+    const gpa_float64 r32 = static_cast<gpa_float64>(*results[32]);
+    const gpa_float64 r33 = static_cast<gpa_float64>(*results[33]);
+    const gpa_float64 r34 = static_cast<gpa_float64>(*results[34]);
+    const gpa_float64 r35 = static_cast<gpa_float64>(*results[35]);
+    const gpa_float64 r36 = static_cast<gpa_float64>(*results[36]);
+    const gpa_float64 r37 = static_cast<gpa_float64>(*results[37]);
+    const gpa_float64 r38 = static_cast<gpa_float64>(*results[38]);
+    const gpa_float64 r39 = static_cast<gpa_float64>(*results[39]);
+    const gpa_float64 r40 = static_cast<gpa_float64>(*results[40]);
+    const gpa_float64 r41 = static_cast<gpa_float64>(*results[41]);
+    const gpa_float64 r42 = static_cast<gpa_float64>(*results[42]);
+    const gpa_float64 r43 = static_cast<gpa_float64>(*results[43]);
+    const gpa_float64 r44 = static_cast<gpa_float64>(*results[44]);
+    const gpa_float64 r45 = static_cast<gpa_float64>(*results[45]);
+    const gpa_float64 r46 = static_cast<gpa_float64>(*results[46]);
+    const gpa_float64 r47 = static_cast<gpa_float64>(*results[47]);
+    const gpa_float64 r48 = static_cast<gpa_float64>(*results[48]);
+    const gpa_float64 r49 = static_cast<gpa_float64>(*results[49]);
+    const gpa_float64 r50 = static_cast<gpa_float64>(*results[50]);
+    const gpa_float64 r51 = static_cast<gpa_float64>(*results[51]);
+    const gpa_float64 r52 = static_cast<gpa_float64>(*results[52]);
+    const gpa_float64 r53 = static_cast<gpa_float64>(*results[53]);
+    const gpa_float64 r54 = static_cast<gpa_float64>(*results[54]);
+    const gpa_float64 r55 = static_cast<gpa_float64>(*results[55]);
+    const gpa_float64 r56 = static_cast<gpa_float64>(*results[56]);
+    const gpa_float64 r57 = static_cast<gpa_float64>(*results[57]);
+    const gpa_float64 r58 = static_cast<gpa_float64>(*results[58]);
+    const gpa_float64 r59 = static_cast<gpa_float64>(*results[59]);
+    const gpa_float64 r60 = static_cast<gpa_float64>(*results[60]);
+    const gpa_float64 r61 = static_cast<gpa_float64>(*results[61]);
+    const gpa_float64 r62 = static_cast<gpa_float64>(*results[62]);
+    const gpa_float64 r63 = static_cast<gpa_float64>(*results[63]);
+    const gpa_float64 r64 = static_cast<gpa_float64>(*results[64]);
+    const gpa_float64 r65 = static_cast<gpa_float64>(*results[65]);
+    const gpa_float64 r66 = static_cast<gpa_float64>(*results[66]);
+    const gpa_float64 r67 = static_cast<gpa_float64>(*results[67]);
+    const gpa_float64 r68 = static_cast<gpa_float64>(*results[68]);
+    const gpa_float64 r69 = static_cast<gpa_float64>(*results[69]);
+    const gpa_float64 r70 = static_cast<gpa_float64>(*results[70]);
+    const gpa_float64 r71 = static_cast<gpa_float64>(*results[71]);
+    const gpa_float64 r72 = static_cast<gpa_float64>(*results[72]);
+
+    const gpa_float64 v0 = (r63 > r62) ? r63 : r62;
+    const gpa_float64 v1 = (v0 > r61) ? v0 : r61;
+    const gpa_float64 v2 = (v1 > r60) ? v1 : r60;
+    const gpa_float64 v3 = (v2 > r59) ? v2 : r59;
+    const gpa_float64 v4 = (v3 > r58) ? v3 : r58;
+    const gpa_float64 v5 = (v4 > r57) ? v4 : r57;
+    const gpa_float64 v6 = (v5 > r56) ? v5 : r56;
+    const gpa_float64 v7 = (v6 > r55) ? v6 : r55;
+    const gpa_float64 v8 = (v7 > r54) ? v7 : r54;
+    const gpa_float64 v9 = (v8 > r53) ? v8 : r53;
+    const gpa_float64 v10 = (v9 > r52) ? v9 : r52;
+    const gpa_float64 v11 = (v10 > r51) ? v10 : r51;
+    const gpa_float64 v12 = (v11 > r50) ? v11 : r50;
+    const gpa_float64 v13 = (v12 > r49) ? v12 : r49;
+    const gpa_float64 v14 = (v13 > r48) ? v13 : r48;
+    const gpa_float64 v15 = (v14 > r47) ? v14 : r47;
+    const gpa_float64 v16 = (v15 > r46) ? v15 : r46;
+    const gpa_float64 v17 = (v16 > r45) ? v16 : r45;
+    const gpa_float64 v18 = (v17 > r44) ? v17 : r44;
+    const gpa_float64 v19 = (v18 > r43) ? v18 : r43;
+    const gpa_float64 v20 = (v19 > r42) ? v19 : r42;
+    const gpa_float64 v21 = (v20 > r41) ? v20 : r41;
+    const gpa_float64 v22 = (v21 > r40) ? v21 : r40;
+    const gpa_float64 v23 = (v22 > r39) ? v22 : r39;
+    const gpa_float64 v24 = (v23 > r38) ? v23 : r38;
+    const gpa_float64 v25 = (v24 > r37) ? v24 : r37;
+    const gpa_float64 v26 = (v25 > r36) ? v25 : r36;
+    const gpa_float64 v27 = (v26 > r35) ? v26 : r35;
+    const gpa_float64 v28 = (v27 > r34) ? v27 : r34;
+    const gpa_float64 v29 = (v28 > r33) ? v28 : r33;
+    const gpa_float64 v30 = (v29 > r32) ? v29 : r32;
+    const gpa_float64 v31 = (v30 > r31) ? v30 : r31;
+    const gpa_float64 v32 = (v31 > r30) ? v31 : r30;
+    const gpa_float64 v33 = (v32 > r29) ? v32 : r29;
+    const gpa_float64 v34 = (v33 > r28) ? v33 : r28;
+    const gpa_float64 v35 = (v34 > r27) ? v34 : r27;
+    const gpa_float64 v36 = (v35 > r26) ? v35 : r26;
+    const gpa_float64 v37 = (v36 > r25) ? v36 : r25;
+    const gpa_float64 v38 = (v37 > r24) ? v37 : r24;
+    const gpa_float64 v39 = (v38 > r23) ? v38 : r23;
+    const gpa_float64 v40 = (v39 > r22) ? v39 : r22;
+    const gpa_float64 v41 = (v40 > r21) ? v40 : r21;
+    const gpa_float64 v42 = (v41 > r20) ? v41 : r20;
+    const gpa_float64 v43 = (v42 > r19) ? v42 : r19;
+    const gpa_float64 v44 = (v43 > r18) ? v43 : r18;
+    const gpa_float64 v45 = (v44 > r17) ? v44 : r17;
+    const gpa_float64 v46 = (v45 > r16) ? v45 : r16;
+    const gpa_float64 v47 = (v46 > r15) ? v46 : r15;
+    const gpa_float64 v48 = (v47 > r14) ? v47 : r14;
+    const gpa_float64 v49 = (v48 > r13) ? v48 : r13;
+    const gpa_float64 v50 = (v49 > r12) ? v49 : r12;
+    const gpa_float64 v51 = (v50 > r11) ? v50 : r11;
+    const gpa_float64 v52 = (v51 > r10) ? v51 : r10;
+    const gpa_float64 v53 = (v52 > r9) ? v52 : r9;
+    const gpa_float64 v54 = (v53 > r8) ? v53 : r8;
+    const gpa_float64 v55 = (v54 > r7) ? v54 : r7;
+    const gpa_float64 v56 = (v55 > r6) ? v55 : r6;
+    const gpa_float64 v57 = (v56 > r5) ? v56 : r5;
+    const gpa_float64 v58 = (v57 > r4) ? v57 : r4;
+    const gpa_float64 v59 = (v58 > r3) ? v58 : r3;
+    const gpa_float64 v60 = (v59 > r2) ? v59 : r2;
+    const gpa_float64 v61 = (v60 > r1) ? v60 : r1;
+    const gpa_float64 v62 = (v61 > r0) ? v61 : r0;
+    const gpa_float64 v63 = (r64 != 0.0) ? (v62 / r64) : 0.0;
+    const gpa_float64 v64 = v63 * 100.0;
+    const gpa_float64 v65 = r72 + r71 + r70 + r69 + r68 + r67 + r66 + r65;
+    const gpa_float64 v66 = (v65 != 0.0) ? v64 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v66;
+}
+
+/// Computes the CSMemUnitBusyCycles counter: (0),0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64,64,65,66,67,68,69,70,71,sum8,ifnotzero
+static void ComputeCSMemUnitBusyCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+    const gpa_float64 r32 = static_cast<gpa_float64>(*results[32]);
+    const gpa_float64 r33 = static_cast<gpa_float64>(*results[33]);
+    const gpa_float64 r34 = static_cast<gpa_float64>(*results[34]);
+    const gpa_float64 r35 = static_cast<gpa_float64>(*results[35]);
+    const gpa_float64 r36 = static_cast<gpa_float64>(*results[36]);
+    const gpa_float64 r37 = static_cast<gpa_float64>(*results[37]);
+    const gpa_float64 r38 = static_cast<gpa_float64>(*results[38]);
+    const gpa_float64 r39 = static_cast<gpa_float64>(*results[39]);
+    const gpa_float64 r40 = static_cast<gpa_float64>(*results[40]);
+    const gpa_float64 r41 = static_cast<gpa_float64>(*results[41]);
+    const gpa_float64 r42 = static_cast<gpa_float64>(*results[42]);
+    const gpa_float64 r43 = static_cast<gpa_float64>(*results[43]);
+    const gpa_float64 r44 = static_cast<gpa_float64>(*results[44]);
+    const gpa_float64 r45 = static_cast<gpa_float64>(*results[45]);
+    const gpa_float64 r46 = static_cast<gpa_float64>(*results[46]);
+    const gpa_float64 r47 = static_cast<gpa_float64>(*results[47]);
+    const gpa_float64 r48 = static_cast<gpa_float64>(*results[48]);
+    const gpa_float64 r49 = static_cast<gpa_float64>(*results[49]);
+    const gpa_float64 r50 = static_cast<gpa_float64>(*results[50]);
+    const gpa_float64 r51 = static_cast<gpa_float64>(*results[51]);
+    const gpa_float64 r52 = static_cast<gpa_float64>(*results[52]);
+    const gpa_float64 r53 = static_cast<gpa_float64>(*results[53]);
+    const gpa_float64 r54 = static_cast<gpa_float64>(*results[54]);
+    const gpa_float64 r55 = static_cast<gpa_float64>(*results[55]);
+    const gpa_float64 r56 = static_cast<gpa_float64>(*results[56]);
+    const gpa_float64 r57 = static_cast<gpa_float64>(*results[57]);
+    const gpa_float64 r58 = static_cast<gpa_float64>(*results[58]);
+    const gpa_float64 r59 = static_cast<gpa_float64>(*results[59]);
+    const gpa_float64 r60 = static_cast<gpa_float64>(*results[60]);
+    const gpa_float64 r61 = static_cast<gpa_float64>(*results[61]);
+    const gpa_float64 r62 = static_cast<gpa_float64>(*results[62]);
+    const gpa_float64 r63 = static_cast<gpa_float64>(*results[63]);
+    const gpa_float64 r64 = static_cast<gpa_float64>(*results[64]);
+    const gpa_float64 r65 = static_cast<gpa_float64>(*results[65]);
+    const gpa_float64 r66 = static_cast<gpa_float64>(*results[66]);
+    const gpa_float64 r67 = static_cast<gpa_float64>(*results[67]);
+    const gpa_float64 r68 = static_cast<gpa_float64>(*results[68]);
+    const gpa_float64 r69 = static_cast<gpa_float64>(*results[69]);
+    const gpa_float64 r70 = static_cast<gpa_float64>(*results[70]);
+    const gpa_float64 r71 = static_cast<gpa_float64>(*results[71]);
+
+    const gpa_float64 v0 = (r63 > r62) ? r63 : r62;
+    const gpa_float64 v1 = (v0 > r61) ? v0 : r61;
+    const gpa_float64 v2 = (v1 > r60) ? v1 : r60;
+    const gpa_float64 v3 = (v2 > r59) ? v2 : r59;
+    const gpa_float64 v4 = (v3 > r58) ? v3 : r58;
+    const gpa_float64 v5 = (v4 > r57) ? v4 : r57;
+    const gpa_float64 v6 = (v5 > r56) ? v5 : r56;
+    const gpa_float64 v7 = (v6 > r55) ? v6 : r55;
+    const gpa_float64 v8 = (v7 > r54) ? v7 : r54;
+    const gpa_float64 v9 = (v8 > r53) ? v8 : r53;
+    const gpa_float64 v10 = (v9 > r52) ? v9 : r52;
+    const gpa_float64 v11 = (v10 > r51) ? v10 : r51;
+    const gpa_float64 v12 = (v11 > r50) ? v11 : r50;
+    const gpa_float64 v13 = (v12 > r49) ? v12 : r49;
+    const gpa_float64 v14 = (v13 > r48) ? v13 : r48;
+    const gpa_float64 v15 = (v14 > r47) ? v14 : r47;
+    const gpa_float64 v16 = (v15 > r46) ? v15 : r46;
+    const gpa_float64 v17 = (v16 > r45) ? v16 : r45;
+    const gpa_float64 v18 = (v17 > r44) ? v17 : r44;
+    const gpa_float64 v19 = (v18 > r43) ? v18 : r43;
+    const gpa_float64 v20 = (v19 > r42) ? v19 : r42;
+    const gpa_float64 v21 = (v20 > r41) ? v20 : r41;
+    const gpa_float64 v22 = (v21 > r40) ? v21 : r40;
+    const gpa_float64 v23 = (v22 > r39) ? v22 : r39;
+    const gpa_float64 v24 = (v23 > r38) ? v23 : r38;
+    const gpa_float64 v25 = (v24 > r37) ? v24 : r37;
+    const gpa_float64 v26 = (v25 > r36) ? v25 : r36;
+    const gpa_float64 v27 = (v26 > r35) ? v26 : r35;
+    const gpa_float64 v28 = (v27 > r34) ? v27 : r34;
+    const gpa_float64 v29 = (v28 > r33) ? v28 : r33;
+    const gpa_float64 v30 = (v29 > r32) ? v29 : r32;
+    const gpa_float64 v31 = (v30 > r31) ? v30 : r31;
+    const gpa_float64 v32 = (v31 > r30) ? v31 : r30;
+    const gpa_float64 v33 = (v32 > r29) ? v32 : r29;
+    const gpa_float64 v34 = (v33 > r28) ? v33 : r28;
+    const gpa_float64 v35 = (v34 > r27) ? v34 : r27;
+    const gpa_float64 v36 = (v35 > r26) ? v35 : r26;
+    const gpa_float64 v37 = (v36 > r25) ? v36 : r25;
+    const gpa_float64 v38 = (v37 > r24) ? v37 : r24;
+    const gpa_float64 v39 = (v38 > r23) ? v38 : r23;
+    const gpa_float64 v40 = (v39 > r22) ? v39 : r22;
+    const gpa_float64 v41 = (v40 > r21) ? v40 : r21;
+    const gpa_float64 v42 = (v41 > r20) ? v41 : r20;
+    const gpa_float64 v43 = (v42 > r19) ? v42 : r19;
+    const gpa_float64 v44 = (v43 > r18) ? v43 : r18;
+    const gpa_float64 v45 = (v44 > r17) ? v44 : r17;
+    const gpa_float64 v46 = (v45 > r16) ? v45 : r16;
+    const gpa_float64 v47 = (v46 > r15) ? v46 : r15;
+    const gpa_float64 v48 = (v47 > r14) ? v47 : r14;
+    const gpa_float64 v49 = (v48 > r13) ? v48 : r13;
+    const gpa_float64 v50 = (v49 > r12) ? v49 : r12;
+    const gpa_float64 v51 = (v50 > r11) ? v50 : r11;
+    const gpa_float64 v52 = (v51 > r10) ? v51 : r10;
+    const gpa_float64 v53 = (v52 > r9) ? v52 : r9;
+    const gpa_float64 v54 = (v53 > r8) ? v53 : r8;
+    const gpa_float64 v55 = (v54 > r7) ? v54 : r7;
+    const gpa_float64 v56 = (v55 > r6) ? v55 : r6;
+    const gpa_float64 v57 = (v56 > r5) ? v56 : r5;
+    const gpa_float64 v58 = (v57 > r4) ? v57 : r4;
+    const gpa_float64 v59 = (v58 > r3) ? v58 : r3;
+    const gpa_float64 v60 = (v59 > r2) ? v59 : r2;
+    const gpa_float64 v61 = (v60 > r1) ? v60 : r1;
+    const gpa_float64 v62 = (v61 > r0) ? v61 : r0;
+    const gpa_float64 v63 = r71 + r70 + r69 + r68 + r67 + r66 + r65 + r64;
+    const gpa_float64 v64 = (v63 != 0.0) ? v62 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v64;
+}
+
+/// Computes the CSMemUnitStalled counter: (0),0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64,64,/,(100),*,65,66,67,68,69,70,71,72,sum8,ifnotzero
+static void ComputeCSMemUnitStalled(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+    const gpa_float64 r32 = static_cast<gpa_float64>(*results[32]);
+    const gpa_float64 r33 = static_cast<gpa_float64>(*results[33]);
+    const gpa_float64 r34 = static_cast<gpa_float64>(*results[34]);
+    const gpa_float64 r35 = static_cast<gpa_float64>(*results[35]);
+    const gpa_float64 r36 = static_cast<gpa_float64>(*results[36]);
+    const gpa_float64 r37 = static_cast<gpa_float64>(*results[37]);
+    const gpa_float64 r38 = static_cast<gpa_float64>(*results[38]);
+    const gpa_float64 r39 = static_cast<gpa_float64>(*results[39]);
+    const gpa_float64 r40 = static_cast<gpa_float64>(*results[40]);
+    const gpa_float64 r41 = static_cast<gpa_float64>(*results[41]);
+    const gpa_float64 r42 = static_cast<gpa_float64>(*results[42]);
+    const gpa_float64 r43 = static_cast<gpa_float64>(*results[43]);
+    const gpa_float64 r44 = static_cast<gpa_float64>(*results[44]);
+    const gpa_float64 r45 = static_cast<gpa_float64>(*results[45]);
+    const gpa_float64 r46 = static_cast<gpa_float64>(*results[46]);
+    const gpa_float64 r47 = static_cast<gpa_float64>(*results[47]);
+    const gpa_float64 r48 = static_cast<gpa_float64>(*results[48]);
+    const gpa_float64 r49 = static_cast<gpa_float64>(*results[49]);
+    const gpa_float64 r50 = static_cast<gpa_float64>(*results[50]);
+    const gpa_float64 r51 = static_cast<gpa_float64>(*results[51]);
+    const gpa_float64 r52 = static_cast<gpa_float64>(*results[52]);
+    const gpa_float64 r53 = static_cast<gpa_float64>(*results[53]);
+    const gpa_float64 r54 = static_cast<gpa_float64>(*results[54]);
+    const gpa_float64 r55 = static_cast<gpa_float64>(*results[55]);
+    const gpa_float64 r56 = static_cast<gpa_float64>(*results[56]);
+    const gpa_float64 r57 = static_cast<gpa_float64>(*results[57]);
+    const gpa_float64 r58 = static_cast<gpa_float64>(*results[58]);
+    const gpa_float64 r59 = static_cast<gpa_float64>(*results[59]);
+    const gpa_float64 r60 = static_cast<gpa_float64>(*results[60]);
+    const gpa_float64 r61 = static_cast<gpa_float64>(*results[61]);
+    const gpa_float64 r62 = static_cast<gpa_float64>(*results[62]);
+    const gpa_float64 r63 = static_cast<gpa_float64>(*results[63]);
+    const gpa_float64 r64 = static_cast<gpa_float64>(*results[64]);
+    const gpa_float64 r65 = static_cast<gpa_float64>(*results[65]);
+    const gpa_float64 r66 = static_cast<gpa_float64>(*results[66]);
+    const gpa_float64 r67 = static_cast<gpa_float64>(*results[67]);
+    const gpa_float64 r68 = static_cast<gpa_float64>(*results[68]);
+    const gpa_float64 r69 = static_cast<gpa_float64>(*results[69]);
+    const gpa_float64 r70 = static_cast<gpa_float64>(*results[70]);
+    const gpa_float64 r71 = static_cast<gpa_float64>(*results[71]);
+    const gpa_float64 r72 = static_cast<gpa_float64>(*results[72]);
+
+    const gpa_float64 v0 = (r63 > r62) ? r63 : r62;
+    const gpa_float64 v1 = (v0 > r61) ? v0 : r61;
+    const gpa_float64 v2 = (v1 > r60) ? v1 : r60;
+    const gpa_float64 v3 = (v2 > r59) ? v2 : r59;
+    const gpa_float64 v4 = (v3 > r58) ? v3 : r58;
+    const gpa_float64 v5 = (v4 > r57) ? v4 : r57;
+    const gpa_float64 v6 = (v5 > r56) ? v5 : r56;
+    const gpa_float64 v7 = (v6 > r55) ? v6 : r55;
+    const gpa_float64 v8 = (v7 > r54) ? v7 : r54;
+    const gpa_float64 v9 = (v8 > r53) ? v8 : r53;
+    const gpa_float64 v10 = (v9 > r52) ? v9 : r52;
+    const gpa_float64 v11 = (v10 > r51) ? v10 : r51;
+    const gpa_float64 v12 = (v11 > r50) ? v11 : r50;
+    const gpa_float64 v13 = (v12 > r49) ? v12 : r49;
+    const gpa_float64 v14 = (v13 > r48) ? v13 : r48;
+    const gpa_float64 v15 = (v14 > r47) ? v14 : r47;
+    const gpa_float64 v16 = (v15 > r46) ? v15 : r46;
+    const gpa_float64 v17 = (v16 > r45) ? v16 : r45;
+    const gpa_float64 v18 = (v17 > r44) ? v17 : r44;
+    const gpa_float64 v19 = (v18 > r43) ? v18 : r43;
+    const gpa_float64 v20 = (v19 > r42) ? v19 : r42;
+    const gpa_float64 v21 = (v20 > r41) ? v20 : r41;
+    const gpa_float64 v22 = (v21 > r40) ? v21 : r40;
+    const gpa_float64 v23 = (v22 > r39) ? v22 : r39;
+    const gpa_float64 v24 = (v23 > r38) ? v23 : r38;
+    const gpa_float64 v25 = (v24 > r37) ? v24 : r37;
+    const gpa_float64 v26 = (v25 > r36) ? v25 : r36;
+    const gpa_float64 v27 = (v26 > r35) ? v26 : r35;
+    const gpa_float64 v28 = (v27 > r34) ? v27 : r34;
+    const gpa_float64 v29 = (v28 > r33) ? v28 : r33;
+    const gpa_float64 v30 = (v29 > r32) ? v29 : r32;
+    const gpa_float64 v31 = (v30 > r31) ? v30 : r31;
+    const gpa_float64 v32 = (v31 > r30) ? v31 : r30;
+    const gpa_float64 v33 = (v32 > r29) ? v32 : r29;
+    const gpa_float64 v34 = (v33 > r28) ? v33 : r28;
+    const gpa_float64 v35 = (v34 > r27) ? v34 : r27;
+    const gpa_float64 v36 = (v35 > r26) ? v35 : r26;
+    const gpa_float64 v37 = (v36 > r25) ? v36 : r25;
+    const gpa_float64 v38 = (v37 > r24) ? v37 : r24;
+    const gpa_float64 v39 = (v38 > r23) ? v38 : r23;
+    const gpa_float64 v40 = (v39 > r22) ? v39 : r22;
+    const gpa_float64 v41 = (v40 > r21) ? v40 : r21;
+    const gpa_float64 v42 = (v41 > r20) ? v41 : r20;
+    const gpa_float64 v43 = (v42 > r19) ? v42 : r19;
+    const gpa_float64 v44 = (v43 > r18) ? v43 : r18;
+    const gpa_float64 v45 = (v44 > r17) ? v44 : r17;
+    const gpa_float64 v46 = (v45 > r16) ? v45 : r16;
+    const gpa_float64 v47 = (v46 > r15) ? v46 : r15;
+    const gpa_float64 v48 = (v47 > r14) ? v47 : r14;
+    const gpa_float64 v49 = (v48 > r13) ? v48 : r13;
+    const gpa_float64 v50 = (v49 > r12) ? v49 : r12;
+    const gpa_float64 v51 = (v50 > r11) ? v50 : r11;
+    const gpa_float64 v52 = (v51 > r10) ? v51 : r10;
+    const gpa_float64 v53 = (v52 > r9) ? v52 : r9;
+    const gpa_float64 v54 = (v53 > r8) ? v53 : r8;
+    const gpa_float64 v55 = (v54 > r7) ? v54 : r7;
+    const gpa_float64 v56 = (v55 > r6) ? v55 : r6;
+    const gpa_float64 v57 = (v56 > r5) ? v56 : r5;
+    const gpa_float64 v58 = (v57 > r4) ? v57 : r4;
+    const gpa_float64 v59 = (v58 > r3) ? v58 : r3;
+    const gpa_float64 v60 = (v59 > r2) ? v59 : r2;
+    const gpa_float64 v61 = (v60 > r1) ? v60 : r1;
+    const gpa_float64 v62 = (v61 > r0) ? v61 : r0;
+    const gpa_float64 v63 = (r64 != 0.0) ? (v62 / r64) : 0.0;
+    const gpa_float64 v64 = v63 * 100.0;
+    const gpa_float64 v65 = r72 + r71 + r70 + r69 + r68 + r67 + r66 + r65;
+    const gpa_float64 v66 = (v65 != 0.0) ? v64 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v66;
+}
+
+/// Computes the CSMemUnitStalledCycles counter: (0),0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64,64,65,66,67,68,69,70,71,sum8,ifnotzero
+static void ComputeCSMemUnitStalledCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+    const gpa_float64 r32 = static_cast<gpa_float64>(*results[32]);
+    const gpa_float64 r33 = static_cast<gpa_float64>(*results[33]);
+    const gpa_float64 r34 = static_cast<gpa_float64>(*results[34]);
+    const gpa_float64 r35 = static_cast<gpa_float64>(*results[35]);
+    const gpa_float64 r36 = static_cast<gpa_float64>(*results[36]);
+    const gpa_float64 r37 = static_cast<gpa_float64>(*results[37]);
+    const gpa_float64 r38 = static_cast<gpa_float64>(*results[38]);
+    const gpa_float64 r39 = static_cast<gpa_float64>(*results[39]);
+    const gpa_float64 r40 = static_cast<gpa_float64>(*results[40]);
+    const gpa_float64 r41 = static_cast<gpa_float64>(*results[41]);
+    const gpa_float64 r42 = static_cast<gpa_float64>(*results[42]);
+    const gpa_float64 r43 = static_cast<gpa_float64>(*results[43]);
+    const gpa_float64 r44 = static_cast<gpa_float64>(*results[44]);
+    const gpa_float64 r45 = static_cast<gpa_float64>(*results[45]);
+    const gpa_float64 r46 = static_cast<gpa_float64>(*results[46]);
+    const gpa_float64 r47 = static_cast<gpa_float64>(*results[47]);
+    const gpa_float64 r48 = static_cast<gpa_float64>(*results[48]);
+    const gpa_float64 r49 = static_cast<gpa_float64>(*results[49]);
+    const gpa_float64 r50 = static_cast<gpa_float64>(*results[50]);
+    const gpa_float64 r51 = static_cast<gpa_float64>(*results[51]);
+    const gpa_float64 r52 = static_cast<gpa_float64>(*results[52]);
+    const gpa_float64 r53 = static_cast<gpa_float64>(*results[53]);
+    const gpa_float64 r54 = static_cast<gpa_float64>(*results[54]);
+    const gpa_float64 r55 = static_cast<gpa_float64>(*results[55]);
+    const gpa_float64 r56 = static_cast<gpa_float64>(*results[56]);
+    const gpa_float64 r57 = static_cast<gpa_float64>(*results[57]);
+    const gpa_float64 r58 = static_cast<gpa_float64>(*results[58]);
+    const gpa_float64 r59 = static_cast<gpa_float64>(*results[59]);
+    const gpa_float64 r60 = static_cast<gpa_float64>(*results[60]);
+    const gpa_float64 r61 = static_cast<gpa_float64>(*results[61]);
+    const gpa_float64 r62 = static_cast<gpa_float64>(*results[62]);
+    const gpa_float64 r63 = static_cast<gpa_float64>(*results[63]);
+    const gpa_float64 r64 = static_cast<gpa_float64>(*results[64]);
+    const gpa_float64 r65 = static_cast<gpa_float64>(*results[65]);
+    const gpa_float64 r66 = static_cast<gpa_float64>(*results[66]);
+    const gpa_float64 r67 = static_cast<gpa_float64>(*results[67]);
+    const gpa_float64 r68 = static_cast<gpa_float64>(*results[68]);
+    const gpa_float64 r69 = static_cast<gpa_float64>(*results[69]);
+    const gpa_float64 r70 = static_cast<gpa_float64>(*results[70]);
+    const gpa_float64 r71 = static_cast<gpa_float64>(*results[71]);
+
+    const gpa_float64 v0 = (r63 > r62) ? r63 : r62;
+    const gpa_float64 v1 = (v0 > r61) ? v0 : r61;
+    const gpa_float64 v2 = (v1 > r60) ? v1 : r60;
+    const gpa_float64 v3 = (v2 > r59) ? v2 : r59;
+    const gpa_float64 v4 = (v3 > r58) ? v3 : r58;
+    const gpa_float64 v5 = (v4 > r57) ? v4 : r57;
+    const gpa_float64 v6 = (v5 > r56) ? v5 : r56;
+    const gpa_float64 v7 = (v6 > r55) ? v6 : r55;
+    const gpa_float64 v8 = (v7 > r54) ? v7 : r54;
+    const gpa_float64 v9 = (v8 > r53) ? v8 : r53;
+    const gpa_float64 v10 = (v9 > r52) ? v9 : r52;
+    const gpa_float64 v11 = (v10 > r51) ? v10 : r51;
+    const gpa_float64 v12 = (v11 > r50) ? v11 : r50;
+    const gpa_float64 v13 = (v12 > r49) ? v12 : r49;
+    const gpa_float64 v14 = (v13 > r48) ? v13 : r48;
+    const gpa_float64 v15 = (v14 > r47) ? v14 : r47;
+    const gpa_float64 v16 = (v15 > r46) ? v15 : r46;
+    const gpa_float64 v17 = (v16 > r45) ? v16 : r45;
+    const gpa_float64 v18 = (v17 > r44) ? v17 : r44;
+    const gpa_float64 v19 = (v18 > r43) ? v18 : r43;
+    const gpa_float64 v20 = (v19 > r42) ? v19 : r42;
+    const gpa_float64 v21 = (v20 > r41) ? v20 : r41;
+    const gpa_float64 v22 = (v21 > r40) ? v21 : r40;
+    const gpa_float64 v23 = (v22 > r39) ? v22 : r39;
+    const gpa_float64 v24 = (v23 > r38) ? v23 : r38;
+    const gpa_float64 v25 = (v24 > r37) ? v24 : r37;
+    const gpa_float64 v26 = (v25 > r36) ? v25 : r36;
+    const gpa_float64 v27 = (v26 > r35) ? v26 : r35;
+    const gpa_float64 v28 = (v27 > r34) ? v27 : r34;
+    const gpa_float64 v29 = (v28 > r33) ? v28 : r33;
+    const gpa_float64 v30 = (v29 > r32) ? v29 : r32;
+    const gpa_float64 v31 = (v30 > r31) ? v30 : r31;
+    const gpa_float64 v32 = (v31 > r30) ? v31 : r30;
+    const gpa_float64 v33 = (v32 > r29) ? v32 : r29;
+    const gpa_float64 v34 = (v33 > r28) ? v33 : r28;
+    const gpa_float64 v35 = (v34 > r27) ? v34 : r27;
+    const gpa_float64 v36 = (v35 > r26) ? v35 : r26;
+    const gpa_float64 v37 = (v36 > r25) ? v36 : r25;
+    const gpa_float64 v38 = (v37 > r24) ? v37 : r24;
+    const gpa_float64 v39 = (v38 > r23) ? v38 : r23;
+    const gpa_float64 v40 = (v39 > r22) ? v39 : r22;
+    const gpa_float64 v41 = (v40 > r21) ? v40 : r21;
+    const gpa_float64 v42 = (v41 > r20) ? v41 : r20;
+    const gpa_float64 v43 = (v42 > r19) ? v42 : r19;
+    const gpa_float64 v44 = (v43 > r18) ? v43 : r18;
+    const gpa_float64 v45 = (v44 > r17) ? v44 : r17;
+    const gpa_float64 v46 = (v45 > r16) ? v45 : r16;
+    const gpa_float64 v47 = (v46 > r15) ? v46 : r15;
+    const gpa_float64 v48 = (v47 > r14) ? v47 : r14;
+    const gpa_float64 v49 = (v48 > r13) ? v48 : r13;
+    const gpa_float64 v50 = (v49 > r12) ? v49 : r12;
+    const gpa_float64 v51 = (v50 > r11) ? v50 : r11;
+    const gpa_float64 v52 = (v51 > r10) ? v51 : r10;
+    const gpa_float64 v53 = (v52 > r9) ? v52 : r9;
+    const gpa_float64 v54 = (v53 > r8) ? v53 : r8;
+    const gpa_float64 v55 = (v54 > r7) ? v54 : r7;
+    const gpa_float64 v56 = (v55 > r6) ? v55 : r6;
+    const gpa_float64 v57 = (v56 > r5) ? v56 : r5;
+    const gpa_float64 v58 = (v57 > r4) ? v57 : r4;
+    const gpa_float64 v59 = (v58 > r3) ? v58 : r3;
+    const gpa_float64 v60 = (v59 > r2) ? v59 : r2;
+    const gpa_float64 v61 = (v60 > r1) ? v60 : r1;
+    const gpa_float64 v62 = (v61 > r0) ? v61 : r0;
+    const gpa_float64 v63 = r71 + r70 + r69 + r68 + r67 + r66 + r65 + r64;
+    const gpa_float64 v64 = (v63 != 0.0) ? v62 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v64;
+}
+
+/// Computes the CSWriteUnitStalled counter: (0),0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16,16,/,(100),*,17,18,19,20,21,22,23,24,sum8,ifnotzero
+static void ComputeCSWriteUnitStalled(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+
+    const gpa_float64 v0 = (r15 > r14) ? r15 : r14;
+    const gpa_float64 v1 = (v0 > r13) ? v0 : r13;
+    const gpa_float64 v2 = (v1 > r12) ? v1 : r12;
+    const gpa_float64 v3 = (v2 > r11) ? v2 : r11;
+    const gpa_float64 v4 = (v3 > r10) ? v3 : r10;
+    const gpa_float64 v5 = (v4 > r9) ? v4 : r9;
+    const gpa_float64 v6 = (v5 > r8) ? v5 : r8;
+    const gpa_float64 v7 = (v6 > r7) ? v6 : r7;
+    const gpa_float64 v8 = (v7 > r6) ? v7 : r6;
+    const gpa_float64 v9 = (v8 > r5) ? v8 : r5;
+    const gpa_float64 v10 = (v9 > r4) ? v9 : r4;
+    const gpa_float64 v11 = (v10 > r3) ? v10 : r3;
+    const gpa_float64 v12 = (v11 > r2) ? v11 : r2;
+    const gpa_float64 v13 = (v12 > r1) ? v12 : r1;
+    const gpa_float64 v14 = (v13 > r0) ? v13 : r0;
+    const gpa_float64 v15 = (r16 != 0.0) ? (v14 / r16) : 0.0;
+    const gpa_float64 v16 = v15 * 100.0;
+    const gpa_float64 v17 = r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17;
+    const gpa_float64 v18 = (v17 != 0.0) ? v16 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v18;
+}
+
+/// Computes the CSWriteUnitStalledCycles counter: (0),0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16,16,17,18,19,20,21,22,23,sum8,ifnotzero
+static void ComputeCSWriteUnitStalledCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+
+    const gpa_float64 v0 = (r15 > r14) ? r15 : r14;
+    const gpa_float64 v1 = (v0 > r13) ? v0 : r13;
+    const gpa_float64 v2 = (v1 > r12) ? v1 : r12;
+    const gpa_float64 v3 = (v2 > r11) ? v2 : r11;
+    const gpa_float64 v4 = (v3 > r10) ? v3 : r10;
+    const gpa_float64 v5 = (v4 > r9) ? v4 : r9;
+    const gpa_float64 v6 = (v5 > r8) ? v5 : r8;
+    const gpa_float64 v7 = (v6 > r7) ? v6 : r7;
+    const gpa_float64 v8 = (v7 > r6) ? v7 : r6;
+    const gpa_float64 v9 = (v8 > r5) ? v8 : r5;
+    const gpa_float64 v10 = (v9 > r4) ? v9 : r4;
+    const gpa_float64 v11 = (v10 > r3) ? v10 : r3;
+    const gpa_float64 v12 = (v11 > r2) ? v11 : r2;
+    const gpa_float64 v13 = (v12 > r1) ? v12 : r1;
+    const gpa_float64 v14 = (v13 > r0) ? v13 : r0;
+    const gpa_float64 v15 = r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16;
+    const gpa_float64 v16 = (v15 != 0.0) ? v14 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v16;
+}
+
+/// Computes the CSGDSInsts counter: (0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,12,13,14,15,sum8,ifnotzero
+static void ComputeCSGDSInsts(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = (v1 != 0.0) ? (v0 / v1) : 0.0;
+    const gpa_float64 v3 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8;
+    const gpa_float64 v4 = (v3 != 0.0) ? v2 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v4;
+}
+
+/// Computes the CSLDSInsts counter: (0),0,1,2,3,sum4,4,5,6,7,sum4,-,8,9,10,11,sum4,/,12,13,14,15,16,17,18,19,sum8,ifnotzero
+static void ComputeCSLDSInsts(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = v0 - v1;
+    const gpa_float64 v3 = r11 + r10 + r9 + r8;
+    const gpa_float64 v4 = (v3 != 0.0) ? (v2 / v3) : 0.0;
+    const gpa_float64 v5 = r19 + r18 + r17 + r16 + r15 + r14 + r13 + r12;
+    const gpa_float64 v6 = (v5 != 0.0) ? v4 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v6;
+}
+
+/// Computes the CSFlatLDSInsts counter: (0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,12,13,14,15,sum8,ifnotzero
+static void ComputeCSFlatLDSInsts(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = (v1 != 0.0) ? (v0 / v1) : 0.0;
+    const gpa_float64 v3 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8;
+    const gpa_float64 v4 = (v3 != 0.0) ? v2 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v4;
+}
+
+/// Computes the CSALUStalledByLDS counter: (0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,/,NUM_SHADER_ENGINES,/,(100),*,9,10,11,12,13,14,15,16,sum8,ifnotzero
+static void ComputeCSALUStalledByLDS(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_shader_engines = static_cast<gpa_float64>(pHwInfo->GetNumberShaderEngines());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = (v1 != 0.0) ? (v0 / v1) : 0.0;
+    const gpa_float64 v3 = (r8 != 0.0) ? (v2 / r8) : 0.0;
+    const gpa_float64 v4 = (num_shader_engines != 0.0) ? (v3 / num_shader_engines) : 0.0;
+    const gpa_float64 v5 = v4 * 100.0;
+    const gpa_float64 v6 = r16 + r15 + r14 + r13 + r12 + r11 + r10 + r9;
+    const gpa_float64 v7 = (v6 != 0.0) ? v5 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v7;
+}
+
+/// Computes the CSALUStalledByLDSCycles counter: (0),0,1,2,3,sum4,NUM_SHADER_ENGINES,/,4,5,6,7,8,9,10,11,sum8,ifnotzero
+static void ComputeCSALUStalledByLDSCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_shader_engines = static_cast<gpa_float64>(pHwInfo->GetNumberShaderEngines());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = (num_shader_engines != 0.0) ? (v0 / num_shader_engines) : 0.0;
+    const gpa_float64 v2 = r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4;
+    const gpa_float64 v3 = (v2 != 0.0) ? v1 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v3;
+}
+
+/// Computes the CSLDSBankConflict counter: (0),0,1,2,3,sum4,4,/,NUM_SIMDS,/,(100),*,5,6,7,8,9,10,11,12,sum8,ifnotzero
+static void ComputeCSLDSBankConflict(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_simds = static_cast<gpa_float64>(pHwInfo->GetNumberSIMDs());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = (r4 != 0.0) ? (v0 / r4) : 0.0;
+    const gpa_float64 v2 = (num_simds != 0.0) ? (v1 / num_simds) : 0.0;
+    const gpa_float64 v3 = v2 * 100.0;
+    const gpa_float64 v4 = r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5;
+    const gpa_float64 v5 = (v4 != 0.0) ? v3 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v5;
+}
+
+/// Computes the CSLDSBankConflictCycles counter: (0),0,1,2,3,sum4,NUM_SIMDS,/,4,5,6,7,8,9,10,11,sum8,ifnotzero
+static void ComputeCSLDSBankConflictCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    const gpa_float64 num_simds = static_cast<gpa_float64>(pHwInfo->GetNumberSIMDs());
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = (num_simds != 0.0) ? (v0 / num_simds) : 0.0;
+    const gpa_float64 v2 = r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4;
+    const gpa_float64 v3 = (v2 != 0.0) ? v1 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v3;
+}
+
+/// Computes the TexUnitBusy counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64,64,/,(100),*
+static void ComputeTexUnitBusy(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+    const gpa_float64 r32 = static_cast<gpa_float64>(*results[32]);
+    const gpa_float64 r33 = static_cast<gpa_float64>(*results[33]);
+    const gpa_float64 r34 = static_cast<gpa_float64>(*results[34]);
+    const gpa_float64 r35 = static_cast<gpa_float64>(*results[35]);
+    const gpa_float64 r36 = static_cast<gpa_float64>(*results[36]);
+    const gpa_float64 r37 = static_cast<gpa_float64>(*results[37]);
+    const gpa_float64 r38 = static_cast<gpa_float64>(*results[38]);
+    const gpa_float64 r39 = static_cast<gpa_float64>(*results[39]);
+    const gpa_float64 r40 = static_cast<gpa_float64>(*results[40]);
+    const gpa_float64 r41 = static_cast<gpa_float64>(*results[41]);
+    const gpa_float64 r42 = static_cast<gpa_float64>(*results[42]);
+    const gpa_float64 r43 = static_cast<gpa_float64>(*results[43]);
+    const gpa_float64 r44 = static_cast<gpa_float64>(*results[44]);
+    const gpa_float64 r45 = static_cast<gpa_float64>(*results[45]);
+    const gpa_float64 r46 = static_cast<gpa_float64>(*results[46]);
+    const gpa_float64 r47 = static_cast<gpa_float64>(*results[47]);
+    const gpa_float64 r48 = static_cast<gpa_float64>(*results[48]);
+    const gpa_float64 r49 = static_cast<gpa_float64>(*results[49]);
+    const gpa_float64 r50 = static_cast<gpa_float64>(*results[50]);
+    const gpa_float64 r51 = static_cast<gpa_float64>(*results[51]);
+    const gpa_float64 r52 = static_cast<gpa_float64>(*results[52]);
+    const gpa_float64 r53 = static_cast<gpa_float64>(*results[53]);
+    const gpa_float64 r54 = static_cast<gpa_float64>(*results[54]);
+    const gpa_float64 r55 = static_cast<gpa_float64>(*results[55]);
+    const gpa_float64 r56 = static_cast<gpa_float64>(*results[56]);
+    const gpa_float64 r57 = static_cast<gpa_float64>(*results[57]);
+    const gpa_float64 r58 = static_cast<gpa_float64>(*results[58]);
+    const gpa_float64 r59 = static_cast<gpa_float64>(*results[59]);
+    const gpa_float64 r60 = static_cast<gpa_float64>(*results[60]);
+    const gpa_float64 r61 = static_cast<gpa_float64>(*results[61]);
+    const gpa_float64 r62 = static_cast<gpa_float64>(*results[62]);
+    const gpa_float64 r63 = static_cast<gpa_float64>(*results[63]);
+    const gpa_float64 r64 = static_cast<gpa_float64>(*results[64]);
+
+    const gpa_float64 v0 = (r63 > r62) ? r63 : r62;
+    const gpa_float64 v1 = (v0 > r61) ? v0 : r61;
+    const gpa_float64 v2 = (v1 > r60) ? v1 : r60;
+    const gpa_float64 v3 = (v2 > r59) ? v2 : r59;
+    const gpa_float64 v4 = (v3 > r58) ? v3 : r58;
+    const gpa_float64 v5 = (v4 > r57) ? v4 : r57;
+    const gpa_float64 v6 = (v5 > r56) ? v5 : r56;
+    const gpa_float64 v7 = (v6 > r55) ? v6 : r55;
+    const gpa_float64 v8 = (v7 > r54) ? v7 : r54;
+    const gpa_float64 v9 = (v8 > r53) ? v8 : r53;
+    const gpa_float64 v10 = (v9 > r52) ? v9 : r52;
+    const gpa_float64 v11 = (v10 > r51) ? v10 : r51;
+    const gpa_float64 v12 = (v11 > r50) ? v11 : r50;
+    const gpa_float64 v13 = (v12 > r49) ? v12 : r49;
+    const gpa_float64 v14 = (v13 > r48) ? v13 : r48;
+    const gpa_float64 v15 = (v14 > r47) ? v14 : r47;
+    const gpa_float64 v16 = (v15 > r46) ? v15 : r46;
+    const gpa_float64 v17 = (v16 > r45) ? v16 : r45;
+    const gpa_float64 v18 = (v17 > r44) ? v17 : r44;
+    const gpa_float64 v19 = (v18 > r43) ? v18 : r43;
+    const gpa_float64 v20 = (v19 > r42) ? v19 : r42;
+    const gpa_float64 v21 = (v20 > r41) ? v20 : r41;
+    const gpa_float64 v22 = (v21 > r40) ? v21 : r40;
+    const gpa_float64 v23 = (v22 > r39) ? v22 : r39;
+    const gpa_float64 v24 = (v23 > r38) ? v23 : r38;
+    const gpa_float64 v25 = (v24 > r37) ? v24 : r37;
+    const gpa_float64 v26 = (v25 > r36) ? v25 : r36;
+    const gpa_float64 v27 = (v26 > r35) ? v26 : r35;
+    const gpa_float64 v28 = (v27 > r34) ? v27 : r34;
+    const gpa_float64 v29 = (v28 > r33) ? v28 : r33;
+    const gpa_float64 v30 = (v29 > r32) ? v29 : r32;
+    const gpa_float64 v31 = (v30 > r31) ? v30 : r31;
+    const gpa_float64 v32 = (v31 > r30) ? v31 : r30;
+    const gpa_float64 v33 = (v32 > r29) ? v32 : r29;
+    const gpa_float64 v34 = (v33 > r28) ? v33 : r28;
+    const gpa_float64 v35 = (v34 > r27) ? v34 : r27;
+    const gpa_float64 v36 = (v35 > r26) ? v35 : r26;
+    const gpa_float64 v37 = (v36 > r25) ? v36 : r25;
+    const gpa_float64 v38 = (v37 > r24) ? v37 : r24;
+    const gpa_float64 v39 = (v38 > r23) ? v38 : r23;
+    const gpa_float64 v40 = (v39 > r22) ? v39 : r22;
+    const gpa_float64 v41 = (v40 > r21) ? v40 : r21;
+    const gpa_float64 v42 = (v41 > r20) ? v41 : r20;
+    const gpa_float64 v43 = (v42 > r19) ? v42 : r19;
+    const gpa_float64 v44 = (v43 > r18) ? v43 : r18;
+    const gpa_float64 v45 = (v44 > r17) ? v44 : r17;
+    const gpa_float64 v46 = (v45 > r16) ? v45 : r16;
+    const gpa_float64 v47 = (v46 > r15) ? v46 : r15;
+    const gpa_float64 v48 = (v47 > r14) ? v47 : r14;
+    const gpa_float64 v49 = (v48 > r13) ? v48 : r13;
+    const gpa_float64 v50 = (v49 > r12) ? v49 : r12;
+    const gpa_float64 v51 = (v50 > r11) ? v50 : r11;
+    const gpa_float64 v52 = (v51 > r10) ? v51 : r10;
+    const gpa_float64 v53 = (v52 > r9) ? v52 : r9;
+    const gpa_float64 v54 = (v53 > r8) ? v53 : r8;
+    const gpa_float64 v55 = (v54 > r7) ? v54 : r7;
+    const gpa_float64 v56 = (v55 > r6) ? v55 : r6;
+    const gpa_float64 v57 = (v56 > r5) ? v56 : r5;
+    const gpa_float64 v58 = (v57 > r4) ? v57 : r4;
+    const gpa_float64 v59 = (v58 > r3) ? v58 : r3;
+    const gpa_float64 v60 = (v59 > r2) ? v59 : r2;
+    const gpa_float64 v61 = (v60 > r1) ? v60 : r1;
+    const gpa_float64 v62 = (v61 > r0) ? v61 : r0;
+    const gpa_float64 v63 = (r64 != 0.0) ? (v62 / r64) : 0.0;
+    const gpa_float64 v64 = v63 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v64;
+}
+
+/// Computes the TexUnitBusyCycles counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64
+static void ComputeTexUnitBusyCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+    const gpa_float64 r32 = static_cast<gpa_float64>(*results[32]);
+    const gpa_float64 r33 = static_cast<gpa_float64>(*results[33]);
+    const gpa_float64 r34 = static_cast<gpa_float64>(*results[34]);
+    const gpa_float64 r35 = static_cast<gpa_float64>(*results[35]);
+    const gpa_float64 r36 = static_cast<gpa_float64>(*results[36]);
+    const gpa_float64 r37 = static_cast<gpa_float64>(*results[37]);
+    const gpa_float64 r38 = static_cast<gpa_float64>(*results[38]);
+    const gpa_float64 r39 = static_cast<gpa_float64>(*results[39]);
+    const gpa_float64 r40 = static_cast<gpa_float64>(*results[40]);
+    const gpa_float64 r41 = static_cast<gpa_float64>(*results[41]);
+    const gpa_float64 r42 = static_cast<gpa_float64>(*results[42]);
+    const gpa_float64 r43 = static_cast<gpa_float64>(*results[43]);
+    const gpa_float64 r44 = static_cast<gpa_float64>(*results[44]);
+    const gpa_float64 r45 = static_cast<gpa_float64>(*results[45]);
+    const gpa_float64 r46 = static_cast<gpa_float64>(*results[46]);
+    const gpa_float64 r47 = static_cast<gpa_float64>(*results[47]);
+    const gpa_float64 r48 = static_cast<gpa_float64>(*results[48]);
+    const gpa_float64 r49 = static_cast<gpa_float64>(*results[49]);
+    const gpa_float64 r50 = static_cast<gpa_float64>(*results[50]);
+    const gpa_float64 r51 = static_cast<gpa_float64>(*results[51]);
+    const gpa_float64 r52 = static_cast<gpa_float64>(*results[52]);
+    const gpa_float64 r53 = static_cast<gpa_float64>(*results[53]);
+    const gpa_float64 r54 = static_cast<gpa_float64>(*results[54]);
+    const gpa_float64 r55 = static_cast<gpa_float64>(*results[55]);
+    const gpa_float64 r56 = static_cast<gpa_float64>(*results[56]);
+    const gpa_float64 r57 = static_cast<gpa_float64>(*results[57]);
+    const gpa_float64 r58 = static_cast<gpa_float64>(*results[58]);
+    const gpa_float64 r59 = static_cast<gpa_float64>(*results[59]);
+    const gpa_float64 r60 = static_cast<gpa_float64>(*results[60]);
+    const gpa_float64 r61 = static_cast<gpa_float64>(*results[61]);
+    const gpa_float64 r62 = static_cast<gpa_float64>(*results[62]);
+    const gpa_float64 r63 = static_cast<gpa_float64>(*results[63]);
+
+    const gpa_float64 v0 = (r63 > r62) ? r63 : r62;
+    const gpa_float64 v1 = (v0 > r61) ? v0 : r61;
+    const gpa_float64 v2 = (v1 > r60) ? v1 : r60;
+    const gpa_float64 v3 = (v2 > r59) ? v2 : r59;
+    const gpa_float64 v4 = (v3 > r58) ? v3 : r58;
+    const gpa_float64 v5 = (v4 > r57) ? v4 : r57;
+    const gpa_float64 v6 = (v5 > r56) ? v5 : r56;
+    const gpa_float64 v7 = (v6 > r55) ? v6 : r55;
+    const gpa_float64 v8 = (v7 > r54) ? v7 : r54;
+    const gpa_float64 v9 = (v8 > r53) ? v8 : r53;
+    const gpa_float64 v10 = (v9 > r52) ? v9 : r52;
+    const gpa_float64 v11 = (v10 > r51) ? v10 : r51;
+    const gpa_float64 v12 = (v11 > r50) ? v11 : r50;
+    const gpa_float64 v13 = (v12 > r49) ? v12 : r49;
+    const gpa_float64 v14 = (v13 > r48) ? v13 : r48;
+    const gpa_float64 v15 = (v14 > r47) ? v14 : r47;
+    const gpa_float64 v16 = (v15 > r46) ? v15 : r46;
+    const gpa_float64 v17 = (v16 > r45) ? v16 : r45;
+    const gpa_float64 v18 = (v17 > r44) ? v17 : r44;
+    const gpa_float64 v19 = (v18 > r43) ? v18 : r43;
+    const gpa_float64 v20 = (v19 > r42) ? v19 : r42;
+    const gpa_float64 v21 = (v20 > r41) ? v20 : r41;
+    const gpa_float64 v22 = (v21 > r40) ? v21 : r40;
+    const gpa_float64 v23 = (v22 > r39) ? v22 : r39;
+    const gpa_float64 v24 = (v23 > r38) ? v23 : r38;
+    const gpa_float64 v25 = (v24 > r37) ? v24 : r37;
+    const gpa_float64 v26 = (v25 > r36) ? v25 : r36;
+    const gpa_float64 v27 = (v26 > r35) ? v26 : r35;
+    const gpa_float64 v28 = (v27 > r34) ? v27 : r34;
+    const gpa_float64 v29 = (v28 > r33) ? v28 : r33;
+    const gpa_float64 v30 = (v29 > r32) ? v29 : r32;
+    const gpa_float64 v31 = (v30 > r31) ? v30 : r31;
+    const gpa_float64 v32 = (v31 > r30) ? v31 : r30;
+    const gpa_float64 v33 = (v32 > r29) ? v32 : r29;
+    const gpa_float64 v34 = (v33 > r28) ? v33 : r28;
+    const gpa_float64 v35 = (v34 > r27) ? v34 : r27;
+    const gpa_float64 v36 = (v35 > r26) ? v35 : r26;
+    const gpa_float64 v37 = (v36 > r25) ? v36 : r25;
+    const gpa_float64 v38 = (v37 > r24) ? v37 : r24;
+    const gpa_float64 v39 = (v38 > r23) ? v38 : r23;
+    const gpa_float64 v40 = (v39 > r22) ? v39 : r22;
+    const gpa_float64 v41 = (v40 > r21) ? v40 : r21;
+    const gpa_float64 v42 = (v41 > r20) ? v41 : r20;
+    const gpa_float64 v43 = (v42 > r19) ? v42 : r19;
+    const gpa_float64 v44 = (v43 > r18) ? v43 : r18;
+    const gpa_float64 v45 = (v44 > r17) ? v44 : r17;
+    const gpa_float64 v46 = (v45 > r16) ? v45 : r16;
+    const gpa_float64 v47 = (v46 > r15) ? v46 : r15;
+    const gpa_float64 v48 = (v47 > r14) ? v47 : r14;
+    const gpa_float64 v49 = (v48 > r13) ? v48 : r13;
+    const gpa_float64 v50 = (v49 > r12) ? v49 : r12;
+    const gpa_float64 v51 = (v50 > r11) ? v50 : r11;
+    const gpa_float64 v52 = (v51 > r10) ? v51 : r10;
+    const gpa_float64 v53 = (v52 > r9) ? v52 : r9;
+    const gpa_float64 v54 = (v53 > r8) ? v53 : r8;
+    const gpa_float64 v55 = (v54 > r7) ? v54 : r7;
+    const gpa_float64 v56 = (v55 > r6) ? v55 : r6;
+    const gpa_float64 v57 = (v56 > r5) ? v56 : r5;
+    const gpa_float64 v58 = (v57 > r4) ? v57 : r4;
+    const gpa_float64 v59 = (v58 > r3) ? v58 : r3;
+    const gpa_float64 v60 = (v59 > r2) ? v59 : r2;
+    const gpa_float64 v61 = (v60 > r1) ? v60 : r1;
+    const gpa_float64 v62 = (v61 > r0) ? v61 : r0;
+
+    *static_cast<gpa_float64*>(pResult) = v62;
+}
+
+/// Computes the TexTriFilteringPct counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,sum64,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,+,/,(100),*
+static void ComputeTexTriFilteringPct(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+    const gpa_float64 r32 = static_cast<gpa_float64>(*results[32]);
+    const gpa_float64 r33 = static_cast<gpa_float64>(*results[33]);
+    const gpa_float64 r34 = static_cast<gpa_float64>(*results[34]);
+    const gpa_float64 r35 = static_cast<gpa_float64>(*results[35]);
+    const gpa_float64 r36 = static_cast<gpa_float64>(*results[36]);
+    const gpa_float64 r37 = static_cast<gpa_float64>(*results[37]);
+    const gpa_float64 r38 = static_cast<gpa_float64>(*results[38]);
+    const gpa_float64 r39 = static_cast<gpa_float64>(*results[39]);
+    const gpa_float64 r40 = static_cast<gpa_float64>(*results[40]);
+    const gpa_float64 r41 = static_cast<gpa_float64>(*results[41]);
+    const gpa_float64 r42 = static_cast<gpa_float64>(*results[42]);
+    const gpa_float64 r43 = static_cast<gpa_float64>(*results[43]);
+    const gpa_float64 r44 = static_cast<gpa_float64>(*results[44]);
+    const gpa_float64 r45 = static_cast<gpa_float64>(*results[45]);
+    const gpa_float64 r46 = static_cast<gpa_float64>(*results[46]);
+    const gpa_float64 r47 = static_cast<gpa_float64>(*results[47]);
+    const gpa_float64 r48 = static_cast<gpa_float64>(*results[48]);
+    const gpa_float64 r49 = static_cast<gpa_float64>(*results[49]);
+    const gpa_float64 r50 = static_cast<gpa_float64>(*results[50]);
+    const gpa_float64 r51 = static_cast<gpa_float64>(*results[51]);
+    const gpa_float64 r52 = static_cast<gpa_float64>(*results[52]);
+    const gpa_float64 r53 = static_cast<gpa_float64>(*results[53]);
+    const gpa_float64 r54 = static_cast<gpa_float64>(*results[54]);
+    const gpa_float64 r55 = static_cast<gpa_float64>(*results[55]);
+    const gpa_float64 r56 = static_cast<gpa_float64>(*results[56]);
+    const gpa_float64 r57 = static_cast<gpa_float64>(*results[57]);
+    const gpa_float64 r58 = static_cast<gpa_float64>(*results[58]);
+    const gpa_float64 r59 = static_cast<gpa_float64>(*results[59]);
+    const gpa_float64 r60 = static_cast<gpa_float64>(*results[60]);
+    const gpa_float64 r61 = static_cast<gpa_float64>(*results[61]);
+    const gpa_float64 r62 = static_cast<gpa_float64>(*results[62]);
+    const gpa_float64 r63 = static_cast<gpa_float64>(*results[63]);
+    const gpa_float64 r64 = static_cast<gpa_float64>(*results[64]);
+    const gpa_float64 r65 = static_cast<gpa_float64>(*results[65]);
+    const gpa_float64 r66 = static_cast<gpa_float64>(*results[66]);
+    const gpa_float64 r67 = static_cast<gpa_float64>(*results[67]);
+    const gpa_float64 r68 = static_cast<gpa_float64>(*results[68]);
+    const gpa_float64 r69 = static_cast<gpa_float64>(*results[69]);
+    const gpa_float64 r70 = static_cast<gpa_float64>(*results[70]);
+    const gpa_float64 r71 = static_cast<gpa_float64>(*results[71]);
+    const gpa_float64 r72 = static_cast<gpa_float64>(*results[72]);
+    const gpa_float64 r73 = static_cast<gpa_float64>(*results[73]);
+    const gpa_float64 r74 = static_cast<gpa_float64>(*results[74]);
+    const gpa_float64 r75 = static_cast<gpa_float64>(*results[75]);
+    const gpa_float64 r76 = static_cast<gpa_float64>(*results[76]);
+    const gpa_float64 r77 = static_cast<gpa_float64>(*results[77]);
+    const gpa_float64 r78 = static_cast<gpa_float64>(*results[78]);
+    const gpa_float64 r79 = static_cast<gpa_float64>(*results[79]);
+    const gpa_float64 r80 = static_cast<gpa_float64>(*results[80]);
+    const gpa_float64 r81 = static_cast<gpa_float64>(*results[81]);
+    const gpa_float64 r82 = static_cast<gpa_float64>(*results[82]);
+    const gpa_float64 r83 = static_cast<gpa_float64>(*results[83]);
+    const gpa_float64 r84 = static_cast<gpa_float64>(*results[84]);
+    const gpa_float64 r85 = static_cast<gpa_float64>(*results[85]);
+    const gpa_float64 r86 = static_cast<gpa_float64>(*results[86]);
+    const gpa_float64 r87 = static_cast<gpa_float64>(*results[87]);
+    const gpa_float64 r88 = static_cast<gpa_float64>(*results[88]);
+    const gpa_float64 r89 = static_cast<gpa_float64>(*results[89]);
+    const gpa_float64 r90 = static_cast<gpa_float64>(*results[90]);
+    const gpa_float64 r91 = static_cast<gpa_float64>(*results[91]);
+    const gpa_float64 r92 = static_cast<gpa_float64>(*results[92]);
+    const gpa_float64 r93 = static_cast<gpa_float64>(*results[93]);
+    const gpa_float64 r94 = static_cast<gpa_float64>(*results[94]);
+    const gpa_float64 r95 = static_cast<gpa_float64>(*results[95]);
+    const gpa_float64 r96 = static_cast<gpa_float64>(*results[96]);
+    const gpa_float64 r97 = static_cast<gpa_float64>(*results[97]);
+    const gpa_float64 r98 = static_cast<gpa_float64>(*results[98]);
+    const gpa_float64 r99 = static_cast<gpa_float64>(*results[99]);
+    const gpa_float64 r100 = static_cast<gpa_float64>(*results[100]);
+    const gpa_float64 r101 = static_cast<gpa_float64>(*results[101]);
+    const gpa_float64 r102 = static_cast<gpa_float64>(*results[102]);
+    const gpa_float64 r103 = static_cast<gpa_float64>(*results[103]);
+    const gpa_float64 r104 = static_cast<gpa_float64>(*results[104]);
+    const gpa_float64 r105 = static_cast<gpa_float64>(*results[105]);
+    const gpa_float64 r106 = static_cast<gpa_float64>(*results[106]);
+    const gpa_float64 r107 = static_cast<gpa_float64>(*results[107]);
+    const gpa_float64 r108 = static_cast<gpa_float64>(*results[108]);
+    const gpa_float64 r109 = static_cast<gpa_float64>(*results[109]);
+    const gpa_float64 r110 = static_cast<gpa_float64>(*results[110]);
+    const gpa_float64 r111 = static_cast<gpa_float64>(*results[111]);
+    const gpa_float64 r112 = static_cast<gpa_float64>(*results[112]);
+    const gpa_float64 r113 = static_cast<gpa_float64>(*results[113]);
+    const gpa_float64 r114 = static_cast<gpa_float64>(*results[114]);
+    const gpa_float64 r115 = static_cast<gpa_float64>(*results[115]);
+    const gpa_float64 r116 = static_cast<gpa_float64>(*results[116]);
+    const gpa_float64 r117 = static_cast<gpa_float64>(*results[117]);
+    const gpa_float64 r118 = static_cast<gpa_float64>(*results[118]);
+    const gpa_float64 r119 = static_cast<gpa_float64>(*results[119]);
+    const gpa_float64 r120 = static_cast<gpa_float64>(*results[120]);
+    const gpa_float64 r121 = static_cast<gpa_float64>(*results[121]);
+    const gpa_float64 r122 = static_cast<gpa_float64>(*results[122]);
+    const gpa_float64 r123 = static_cast<gpa_float64>(*results[123]);
+    const gpa_float64 r124 = static_cast<gpa_float64>(*results[124]);
+    const gpa_float64 r125 = static_cast<gpa_float64>(*results[125]);
+    const gpa_float64 r126 = static_cast<gpa_float64>(*results[126]);
+    const gpa_float64 r127 = static_cast<gpa_float64>(*results[127]);
+
+    const gpa_float64 v0 = r63 + r62 + r61 + r60 + r59 + r58 + r57 + r56 + r55 + r54 + r53 + r52 + r51 + r50 + r49 + r48 + r47 + r46 + r45 + r44 + r43 + r42 + r41 + r40 + r39 + r38 + r37 + r36 + r35 + r34 + r33 + r32 + r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16 + r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r127 + r126 + r125 + r124 + r123 + r122 + r121 + r120 + r119 + r118 + r117 + r116 + r115 + r114 + r113 + r112 + r111 + r110 + r109 + r108 + r107 + r106 + r105 + r104 + r103 + r102 + r101 + r100 + r99 + r98 + r97 + r96 + r95 + r94 + r93 + r92 + r91 + r90 + r89 + r88 + r87 + r86 + r85 + r84 + r83 + r82 + r81 + r80 + r79 + r78 + r77 + r76 + r75 + r74 + r73 + r72 + r71 + r70 + r69 + r68 + r67 + r66 + r65 + r64;
+    const gpa_float64 v2 = r63 + r62 + r61 + r60 + r59 + r58 + r57 + r56 + r55 + r54 + r53 + r52 + r51 + r50 + r49 + r48 + r47 + r46 + r45 + r44 + r43 + r42 + r41 + r40 + r39 + r38 + r37 + r36 + r35 + r34 + r33 + r32 + r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16 + r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v3 = v1 + v2;
+    const gpa_float64 v4 = (v3 != 0.0) ? (v0 / v3) : 0.0;
+    const gpa_float64 v5 = v4 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v5;
+}
+
+/// Computes the TexTriFilteringCount counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64
+static void ComputeTexTriFilteringCount(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+    const gpa_float64 r32 = static_cast<gpa_float64>(*results[32]);
+    const gpa_float64 r33 = static_cast<gpa_float64>(*results[33]);
+    const gpa_float64 r34 = static_cast<gpa_float64>(*results[34]);
+    const gpa_float64 r35 = static_cast<gpa_float64>(*results[35]);
+    const gpa_float64 r36 = static_cast<gpa_float64>(*results[36]);
+    const gpa_float64 r37 = static_cast<gpa_float64>(*results[37]);
+    const gpa_float64 r38 = static_cast<gpa_float64>(*results[38]);
+    const gpa_float64 r39 = static_cast<gpa_float64>(*results[39]);
+    const gpa_float64 r40 = static_cast<gpa_float64>(*results[40]);
+    const gpa_float64 r41 = static_cast<gpa_float64>(*results[41]);
+    const gpa_float64 r42 = static_cast<gpa_float64>(*results[42]);
+    const gpa_float64 r43 = static_cast<gpa_float64>(*results[43]);
+    const gpa_float64 r44 = static_cast<gpa_float64>(*results[44]);
+    const gpa_float64 r45 = static_cast<gpa_float64>(*results[45]);
+    const gpa_float64 r46 = static_cast<gpa_float64>(*results[46]);
+    const gpa_float64 r47 = static_cast<gpa_float64>(*results[47]);
+    const gpa_float64 r48 = static_cast<gpa_float64>(*results[48]);
+    const gpa_float64 r49 = static_cast<gpa_float64>(*results[49]);
+    const gpa_float64 r50 = static_cast<gpa_float64>(*results[50]);
+    const gpa_float64 r51 = static_cast<gpa_float64>(*results[51]);
+    const gpa_float64 r52 = static_cast<gpa_float64>(*results[52]);
+    const gpa_float64 r53 = static_cast<gpa_float64>(*results[53]);
+    const gpa_float64 r54 = static_cast<gpa_float64>(*results[54]);
+    const gpa_float64 r55 = static_cast<gpa_float64>(*results[55]);
+    const gpa_float64 r56 = static_cast<gpa_float64>(*results[56]);
+    const gpa_float64 r57 = static_cast<gpa_float64>(*results[57]);
+    const gpa_float64 r58 = static_cast<gpa_float64>(*results[58]);
+    const gpa_float64 r59 = static_cast<gpa_float64>(*results[59]);
+    const gpa_float64 r60 = static_cast<gpa_float64>(*results[60]);
+    const gpa_float64 r61 = static_cast<gpa_float64>(*results[61]);
+    const gpa_float64 r62 = static_cast<gpa_float64>(*results[62]);
+    const gpa_float64 r63 = static_cast<gpa_float64>(*results[63]);
+
+    const gpa_float64 v0 = r63 + r62 + r61 + r60 + r59 + r58 + r57 + r56 + r55 + r54 + r53 + r52 + r51 + r50 + r49 + r48 + r47 + r46 + r45 + r44 + r43 + r42 + r41 + r40 + r39 + r38 + r37 + r36 + r35 + r34 + r33 + r32 + r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16 + r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the NoTexTriFilteringCount counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64
+static void ComputeNoTexTriFilteringCount(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+    const gpa_float64 r32 = static_cast<gpa_float64>(*results[32]);
+    const gpa_float64 r33 = static_cast<gpa_float64>(*results[33]);
+    const gpa_float64 r34 = static_cast<gpa_float64>(*results[34]);
+    const gpa_float64 r35 = static_cast<gpa_float64>(*results[35]);
+    const gpa_float64 r36 = static_cast<gpa_float64>(*results[36]);
+    const gpa_float64 r37 = static_cast<gpa_float64>(*results[37]);
+    const gpa_float64 r38 = static_cast<gpa_float64>(*results[38]);
+    const gpa_float64 r39 = static_cast<gpa_float64>(*results[39]);
+    const gpa_float64 r40 = static_cast<gpa_float64>(*results[40]);
+    const gpa_float64 r41 = static_cast<gpa_float64>(*results[41]);
+    const gpa_float64 r42 = static_cast<gpa_float64>(*results[42]);
+    const gpa_float64 r43 = static_cast<gpa_float64>(*results[43]);
+    const gpa_float64 r44 = static_cast<gpa_float64>(*results[44]);
+    const gpa_float64 r45 = static_cast<gpa_float64>(*results[45]);
+    const gpa_float64 r46 = static_cast<gpa_float64>(*results[46]);
+    const gpa_float64 r47 = static_cast<gpa_float64>(*results[47]);
+    const gpa_float64 r48 = static_cast<gpa_float64>(*results[48]);
+    const gpa_float64 r49 = static_cast<gpa_float64>(*results[49]);
+    const gpa_float64 r50 = static_cast<gpa_float64>(*results[50]);
+    const gpa_float64 r51 = static_cast<gpa_float64>(*results[51]);
+    const gpa_float64 r52 = static_cast<gpa_float64>(*results[52]);
+    const gpa_float64 r53 = static_cast<gpa_float64>(*results[53]);
+    const gpa_float64 r54 = static_cast<gpa_float64>(*results[54]);
+    const gpa_float64 r55 = static_cast<gpa_float64>(*results[55]);
+    const gpa_float64 r56 = static_cast<gpa_float64>(*results[56]);
+    const gpa_float64 r57 = static_cast<gpa_float64>(*results[57]);
+    const gpa_float64 r58 = static_cast<gpa_float64>(*results[58]);
+    const gpa_float64 r59 = static_cast<gpa_float64>(*results[59]);
+    const gpa_float64 r60 = static_cast<gpa_float64>(*results[60]);
+    const gpa_float64 r61 = static_cast<gpa_float64>(*results[61]);
+    const gpa_float64 r62 = static_cast<gpa_float64>(*results[62]);
+    const gpa_float64 r63 = static_cast<gpa_float64>(*results[63]);
+
+    const gpa_float64 v0 = r63 + r62 + r61 + r60 + r59 + r58 + r57 + r56 + r55 + r54 + r53 + r52 + r51 + r50 + r49 + r48 + r47 + r46 + r45 + r44 + r43 + r42 + r41 + r40 + r39 + r38 + r37 + r36 + r35 + r34 + r33 + r32 + r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16 + r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the TexVolFilteringPct counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,sum64,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,+,/,(100),*
+static void ComputeTexVolFilteringPct(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+    const gpa_float64 r32 = static_cast<gpa_float64>(*results[32]);
+    const gpa_float64 r33 = static_cast<gpa_float64>(*results[33]);
+    const gpa_float64 r34 = static_cast<gpa_float64>(*results[34]);
+    const gpa_float64 r35 = static_cast<gpa_float64>(*results[35]);
+    const gpa_float64 r36 = static_cast<gpa_float64>(*results[36]);
+    const gpa_float64 r37 = static_cast<gpa_float64>(*results[37]);
+    const gpa_float64 r38 = static_cast<gpa_float64>(*results[38]);
+    const gpa_float64 r39 = static_cast<gpa_float64>(*results[39]);
+    const gpa_float64 r40 = static_cast<gpa_float64>(*results[40]);
+    const gpa_float64 r41 = static_cast<gpa_float64>(*results[41]);
+    const gpa_float64 r42 = static_cast<gpa_float64>(*results[42]);
+    const gpa_float64 r43 = static_cast<gpa_float64>(*results[43]);
+    const gpa_float64 r44 = static_cast<gpa_float64>(*results[44]);
+    const gpa_float64 r45 = static_cast<gpa_float64>(*results[45]);
+    const gpa_float64 r46 = static_cast<gpa_float64>(*results[46]);
+    const gpa_float64 r47 = static_cast<gpa_float64>(*results[47]);
+    const gpa_float64 r48 = static_cast<gpa_float64>(*results[48]);
+    const gpa_float64 r49 = static_cast<gpa_float64>(*results[49]);
+    const gpa_float64 r50 = static_cast<gpa_float64>(*results[50]);
+    const gpa_float64 r51 = static_cast<gpa_float64>(*results[51]);
+    const gpa_float64 r52 = static_cast<gpa_float64>(*results[52]);
+    const gpa_float64 r53 = static_cast<gpa_float64>(*results[53]);
+    const gpa_float64 r54 = static_cast<gpa_float64>(*results[54]);
+    const gpa_float64 r55 = static_cast<gpa_float64>(*results[55]);
+    const gpa_float64 r56 = static_cast<gpa_float64>(*results[56]);
+    const gpa_float64 r57 = static_cast<gpa_float64>(*results[57]);
+    const gpa_float64 r58 = static_cast<gpa_float64>(*results[58]);
+    const gpa_float64 r59 = static_cast<gpa_float64>(*results[59]);
+    const gpa_float64 r60 = static_cast<gpa_float64>(*results[60]);
+    const gpa_float64 r61 = static_cast<gpa_float64>(*results[61]);
+    const gpa_float64 r62 = static_cast<gpa_float64>(*results[62]);
+    const gpa_float64 r63 = static_cast<gpa_float64>(*results[63]);
+    const gpa_float64 r64 = static_cast<gpa_float64>(*results[64]);
+    const gpa_float64 r65 = static_cast<gpa_float64>(*results[65]);
+    const gpa_float64 r66 = static_cast<gpa_float64>(*results[66]);
+    const gpa_float64 r67 = static_cast<gpa_float64>(*results[67]);
+    const gpa_float64 r68 = static_cast<gpa_float64>(*results[68]);
+    const gpa_float64 r69 = static_cast<gpa_float64>(*results[69]);
+    const gpa_float64 r70 = static_cast<gpa_float64>(*results[70]);
+    const gpa_float64 r71 = static_cast<gpa_float64>(*results[71]);
+    const gpa_float64 r72 = static_cast<gpa_float64>(*results[72]);
+    const gpa_float64 r73 = static_cast<gpa_float64>(*results[73]);
+    const gpa_float64 r74 = static_cast<gpa_float64>(*results[74]);
+    const gpa_float64 r75 = static_cast<gpa_float64>(*results[75]);
+    const gpa_float64 r76 = static_cast<gpa_float64>(*results[76]);
+    const gpa_float64 r77 = static_cast<gpa_float64>(*results[77]);
+    const gpa_float64 r78 = static_cast<gpa_float64>(*results[78]);
+    const gpa_float64 r79 = static_cast<gpa_float64>(*results[79]);
+    const gpa_float64 r80 = static_cast<gpa_float64>(*results[80]);
+    const gpa_float64 r81 = static_cast<gpa_float64>(*results[81]);
+    const gpa_float64 r82 = static_cast<gpa_float64>(*results[82]);
+    const gpa_float64 r83 = static_cast<gpa_float64>(*results[83]);
+    const gpa_float64 r84 = static_cast<gpa_float64>(*results[84]);
+    const gpa_float64 r85 = static_cast<gpa_float64>(*results[85]);
+    const gpa_float64 r86 = static_cast<gpa_float64>(*results[86]);
+    const gpa_float64 r87 = static_cast<gpa_float64>(*results[87]);
+    const gpa_float64 r88 = static_cast<gpa_float64>(*results[88]);
+    const gpa_float64 r89 = static_cast<gpa_float64>(*results[89]);
+    const gpa_float64 r90 = static_cast<gpa_float64>(*results[90]);
+    const gpa_float64 r91 = static_cast<gpa_float64>(*results[91]);
+    const gpa_float64 r92 = static_cast<gpa_float64>(*results[92]);
+    const gpa_float64 r93 = static_cast<gpa_float64>(*results[93]);
+    const gpa_float64 r94 = static_cast<gpa_float64>(*results[94]);
+    const gpa_float64 r95 = static_cast<gpa_float64>(*results[95]);
+    const gpa_float64 r96 = static_cast<gpa_float64>(*results[96]);
+    const gpa_float64 r97 = static_cast<gpa_float64>(*results[97]);
+    const gpa_float64 r98 = static_cast<gpa_float64>(*results[98]);
+    const gpa_float64 r99 = static_cast<gpa_float64>(*results[99]);
+    const gpa_float64 r100 = static_cast<gpa_float64>(*results[100]);
+    const gpa_float64 r101 = static_cast<gpa_float64>(*results[101]);
+    const gpa_float64 r102 = static_cast<gpa_float64>(*results[102]);
+    const gpa_float64 r103 = static_cast<gpa_float64>(*results[103]);
+    const gpa_float64 r104 = static_cast<gpa_float64>(*results[104]);
+    const gpa_float64 r105 = static_cast<gpa_float64>(*results[105]);
+    const gpa_float64 r106 = static_cast<gpa_float64>(*results[106]);
+    const gpa_float64 r107 = static_cast<gpa_float64>(*results[107]);
+    const gpa_float64 r108 = static_cast<gpa_float64>(*results[108]);
+    const gpa_float64 r109 = static_cast<gpa_float64>(*results[109]);
+    const gpa_float64 r110 = static_cast<gpa_float64>(*results[110]);
+    const gpa_float64 r111 = static_cast<gpa_float64>(*results[111]);
+    const gpa_float64 r112 = static_cast<gpa_float64>(*results[112]);
+    const gpa_float64 r113 = static_cast<gpa_float64>(*results[113]);
+    const gpa_float64 r114 = static_cast<gpa_float64>(*results[114]);
+    const gpa_float64 r115 = static_cast<gpa_float64>(*results[115]);
+    const gpa_float64 r116 = static_cast<gpa_float64>(*results[116]);
+    const gpa_float64 r117 = static_cast<gpa_float64>(*results[117]);
+    const gpa_float64 r118 = static_cast<gpa_float64>(*results[118]);
+    const gpa_float64 r119 = static_cast<gpa_float64>(*results[119]);
+    const gpa_float64 r120 = static_cast<gpa_float64>(*results[120]);
+    const gpa_float64 r121 = static_cast<gpa_float64>(*results[121]);
+    const gpa_float64 r122 = static_cast<gpa_float64>(*results[122]);
+    const gpa_float64 r123 = static_cast<gpa_float64>(*results[123]);
+    const gpa_float64 r124 = static_cast<gpa_float64>(*results[124]);
+    const gpa_float64 r125 = static_cast<gpa_float64>(*results[125]);
+    const gpa_float64 r126 = static_cast<gpa_float64>(*results[126]);
+    const gpa_float64 r127 = static_cast<gpa_float64>(*results[127]);
+
+    const gpa_float64 v0 = r63 + r62 + r61 + r60 + r59 + r58 + r57 + r56 + r55 + r54 + r53 + r52 + r51 + r50 + r49 + r48 + r47 + r46 + r45 + r44 + r43 + r42 + r41 + r40 + r39 + r38 + r37 + r36 + r35 + r34 + r33 + r32 + r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16 + r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r127 + r126 + r125 + r124 + r123 + r122 + r121 + r120 + r119 + r118 + r117 + r116 + r115 + r114 + r113 + r112 + r111 + r110 + r109 + r108 + r107 + r106 + r105 + r104 + r103 + r102 + r101 + r100 + r99 + r98 + r97 + r96 + r95 + r94 + r93 + r92 + r91 + r90 + r89 + r88 + r87 + r86 + r85 + r84 + r83 + r82 + r81 + r80 + r79 + r78 + r77 + r76 + r75 + r74 + r73 + r72 + r71 + r70 + r69 + r68 + r67 + r66 + r65 + r64;
+    const gpa_float64 v2 = r63 + r62 + r61 + r60 + r59 + r58 + r57 + r56 + r55 + r54 + r53 + r52 + r51 + r50 + r49 + r48 + r47 + r46 + r45 + r44 + r43 + r42 + r41 + r40 + r39 + r38 + r37 + r36 + r35 + r34 + r33 + r32 + r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16 + r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v3 = v1 + v2;
+    const gpa_float64 v4 = (v3 != 0.0) ? (v0 / v3) : 0.0;
+    const gpa_float64 v5 = v4 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v5;
+}
+
+/// Computes the TexVolFilteringCount counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64
+static void ComputeTexVolFilteringCount(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+    const gpa_float64 r32 = static_cast<gpa_float64>(*results[32]);
+    const gpa_float64 r33 = static_cast<gpa_float64>(*results[33]);
+    const gpa_float64 r34 = static_cast<gpa_float64>(*results[34]);
+    const gpa_float64 r35 = static_cast<gpa_float64>(*results[35]);
+    const gpa_float64 r36 = static_cast<gpa_float64>(*results[36]);
+    const gpa_float64 r37 = static_cast<gpa_float64>(*results[37]);
+    const gpa_float64 r38 = static_cast<gpa_float64>(*results[38]);
+    const gpa_float64 r39 = static_cast<gpa_float64>(*results[39]);
+    const gpa_float64 r40 = static_cast<gpa_float64>(*results[40]);
+    const gpa_float64 r41 = static_cast<gpa_float64>(*results[41]);
+    const gpa_float64 r42 = static_cast<gpa_float64>(*results[42]);
+    const gpa_float64 r43 = static_cast<gpa_float64>(*results[43]);
+    const gpa_float64 r44 = static_cast<gpa_float64>(*results[44]);
+    const gpa_float64 r45 = static_cast<gpa_float64>(*results[45]);
+    const gpa_float64 r46 = static_cast<gpa_float64>(*results[46]);
+    const gpa_float64 r47 = static_cast<gpa_float64>(*results[47]);
+    const gpa_float64 r48 = static_cast<gpa_float64>(*results[48]);
+    const gpa_float64 r49 = static_cast<gpa_float64>(*results[49]);
+    const gpa_float64 r50 = static_cast<gpa_float64>(*results[50]);
+    const gpa_float64 r51 = static_cast<gpa_float64>(*results[51]);
+    const gpa_float64 r52 = static_cast<gpa_float64>(*results[52]);
+    const gpa_float64 r53 = static_cast<gpa_float64>(*results[53]);
+    const gpa_float64 r54 = static_cast<gpa_float64>(*results[54]);
+    const gpa_float64 r55 = static_cast<gpa_float64>(*results[55]);
+    const gpa_float64 r56 = static_cast<gpa_float64>(*results[56]);
+    const gpa_float64 r57 = static_cast<gpa_float64>(*results[57]);
+    const gpa_float64 r58 = static_cast<gpa_float64>(*results[58]);
+    const gpa_float64 r59 = static_cast<gpa_float64>(*results[59]);
+    const gpa_float64 r60 = static_cast<gpa_float64>(*results[60]);
+    const gpa_float64 r61 = static_cast<gpa_float64>(*results[61]);
+    const gpa_float64 r62 = static_cast<gpa_float64>(*results[62]);
+    const gpa_float64 r63 = static_cast<gpa_float64>(*results[63]);
+
+    const gpa_float64 v0 = r63 + r62 + r61 + r60 + r59 + r58 + r57 + r56 + r55 + r54 + r53 + r52 + r51 + r50 + r49 + r48 + r47 + r46 + r45 + r44 + r43 + r42 + r41 + r40 + r39 + r38 + r37 + r36 + r35 + r34 + r33 + r32 + r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16 + r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the NoTexVolFilteringCount counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64
+static void ComputeNoTexVolFilteringCount(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+    const gpa_float64 r32 = static_cast<gpa_float64>(*results[32]);
+    const gpa_float64 r33 = static_cast<gpa_float64>(*results[33]);
+    const gpa_float64 r34 = static_cast<gpa_float64>(*results[34]);
+    const gpa_float64 r35 = static_cast<gpa_float64>(*results[35]);
+    const gpa_float64 r36 = static_cast<gpa_float64>(*results[36]);
+    const gpa_float64 r37 = static_cast<gpa_float64>(*results[37]);
+    const gpa_float64 r38 = static_cast<gpa_float64>(*results[38]);
+    const gpa_float64 r39 = static_cast<gpa_float64>(*results[39]);
+    const gpa_float64 r40 = static_cast<gpa_float64>(*results[40]);
+    const gpa_float64 r41 = static_cast<gpa_float64>(*results[41]);
+    const gpa_float64 r42 = static_cast<gpa_float64>(*results[42]);
+    const gpa_float64 r43 = static_cast<gpa_float64>(*results[43]);
+    const gpa_float64 r44 = static_cast<gpa_float64>(*results[44]);
+    const gpa_float64 r45 = static_cast<gpa_float64>(*results[45]);
+    const gpa_float64 r46 = static_cast<gpa_float64>(*results[46]);
+    const gpa_float64 r47 = static_cast<gpa_float64>(*results[47]);
+    const gpa_float64 r48 = static_cast<gpa_float64>(*results[48]);
+    const gpa_float64 r49 = static_cast<gpa_float64>(*results[49]);
+    const gpa_float64 r50 = static_cast<gpa_float64>(*results[50]);
+    const gpa_float64 r51 = static_cast<gpa_float64>(*results[51]);
+    const gpa_float64 r52 = static_cast<gpa_float64>(*results[52]);
+    const gpa_float64 r53 = static_cast<gpa_float64>(*results[53]);
+    const gpa_float64 r54 = static_cast<gpa_float64>(*results[54]);
+    const gpa_float64 r55 = static_cast<gpa_float64>(*results[55]);
+    const gpa_float64 r56 = static_cast<gpa_float64>(*results[56]);
+    const gpa_float64 r57 = static_cast<gpa_float64>(*results[57]);
+    const gpa_float64 r58 = static_cast<gpa_float64>(*results[58]);
+    const gpa_float64 r59 = static_cast<gpa_float64>(*results[59]);
+    const gpa_float64 r60 = static_cast<gpa_float64>(*results[60]);
+    const gpa_float64 r61 = static_cast<gpa_float64>(*results[61]);
+    const gpa_float64 r62 = static_cast<gpa_float64>(*results[62]);
+    const gpa_float64 r63 = static_cast<gpa_float64>(*results[63]);
+
+    const gpa_float64 v0 = r63 + r62 + r61 + r60 + r59 + r58 + r57 + r56 + r55 + r54 + r53 + r52 + r51 + r50 + r49 + r48 + r47 + r46 + r45 + r44 + r43 + r42 + r41 + r40 + r39 + r38 + r37 + r36 + r35 + r34 + r33 + r32 + r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16 + r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the TexAveAnisotropy counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,(2),64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,sum64,*,+,(4),128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,166,167,168,169,170,171,172,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,sum64,*,+,(6),192,193,194,195,196,197,198,199,200,201,202,203,204,205,206,207,208,209,210,211,212,213,214,215,216,217,218,219,220,221,222,223,224,225,226,227,228,229,230,231,232,233,234,235,236,237,238,239,240,241,242,243,244,245,246,247,248,249,250,251,252,253,254,255,sum64,*,+,(8),256,257,258,259,260,261,262,263,264,265,266,267,268,269,270,271,272,273,274,275,276,277,278,279,280,281,282,283,284,285,286,287,288,289,290,291,292,293,294,295,296,297,298,299,300,301,302,303,304,305,306,307,308,309,310,311,312,313,314,315,316,317,318,319,sum64,*,+,(10),320,321,322,323,324,325,326,327,328,329,330,331,332,333,334,335,336,337,338,339,340,341,342,343,344,345,346,347,348,349,350,351,352,353,354,355,356,357,358,359,360,361,362,363,364,365,366,367,368,369,370,371,372,373,374,375,376,377,378,379,380,381,382,383,sum64,*,+,(12),384,385,386,387,388,389,390,391,392,393,394,395,396,397,398,399,400,401,402,403,404,405,406,407,408,409,410,411,412,413,414,415,416,417,418,419,420,421,422,423,424,425,426,427,428,429,430,431,432,433,434,435,436,437,438,439,440,441,442,443,444,445,446,447,sum64,*,+,(14),448,449,450,451,452,453,454,455,456,457,458,459,460,461,462,463,464,465,466,467,468,469,470,471,472,473,474,475,476,477,478,479,480,481,482,483,484,485,486,487,488,489,490,491,492,493,494,495,496,497,498,499,500,501,502,503,504,505,506,507,508,509,510,511,sum64,*,+,(16),512,513,514,515,516,517,518,519,520,521,522,523,524,525,526,527,528,529,530,531,532,533,534,535,536,537,538,539,540,541,542,543,544,545,546,547,548,549,550,551,552,553,554,555,556,557,558,559,560,561,562,563,564,565,566,567,568,569,570,571,572,573,574,575,sum64,*,+,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,sum64,+,128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,166,167,168,169,170,171,172,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,sum64,+,192,193,194,195,196,197,198,199,200,201,202,203,204,205,206,207,208,209,210,211,212,213,214,215,216,217,218,219,220,221,222,223,224,225,226,227,228,229,230,231,232,233,234,235,236,237,238,239,240,241,242,243,244,245,246,247,248,249,250,251,252,253,254,255,sum64,+,256,257,258,259,260,261,262,263,264,265,266,267,268,269,270,271,272,273,274,275,276,277,278,279,280,281,282,283,284,285,286,287,288,289,290,291,292,293,294,295,296,297,298,299,300,301,302,303,304,305,306,307,308,309,310,311,312,313,314,315,316,317,318,319,sum64,+,320,321,322,323,324,325,326,327,328,329,330,331,332,333,334,335,336,337,338,339,340,341,342,343,344,345,346,347,348,349,350,351,352,353,354,355,356,357,358,359,360,361,362,363,364,365,366,367,368,369,370,371,372,373,374,375,376,377,378,379,380,381,382,383,sum64,+,384,385,386,387,388,389,390,391,392,393,394,395,396,397,398,399,400,401,402,403,404,405,406,407,408,409,410,411,412,413,414,415,416,417,418,419,420,421,422,423,424,425,426,427,428,429,430,431,432,433,434,435,436,437,438,439,440,441,442,443,444,445,446,447,sum64,+,448,449,450,451,452,453,454,455,456,457,458,459,460,461,462,463,464,465,466,467,468,469,470,471,472,473,474,475,476,477,478,479,480,481,482,483,484,485,486,487,488,489,490,491,492,493,494,495,496,497,498,499,500,501,502,503,504,505,506,507,508,509,510,511,sum64,+,512,513,514,515,516,517,518,519,520,521,522,523,524,525,526,527,528,529,530,531,532,533,534,535,536,537,538,539,540,541,542,543,544,545,546,547,548,549,550,551,552,553,554,555,556,557,558,559,560,561,562,563,564,565,566,567,568,569,570,571,572,573,574,575,sum64,+,/
+static void ComputeTexAveAnisotropy(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+    const gpa_float64 r32 = static_cast<gpa_float64>(*results[32]);
+    const gpa_float64 r33 = static_cast<gpa_float64>(*results[33]);
+    const gpa_float64 r34 = static_cast<gpa_float64>(*results[34]);
+    const gpa_float64 r35 = static_cast<gpa_float64>(*results[35]);
+    const gpa_float64 r36 = static_cast<gpa_float64>(*results[36]);
+    const gpa_float64 r37 = static_cast<gpa_float64>(*results[37]);
+    const gpa_float64 r38 = static_cast<gpa_float64>(*results[38]);
+    const gpa_float64 r39 = static_cast<gpa_float64>(*results[39]);
+    const gpa_float64 r40 = static_cast<gpa_float64>(*results[40]);
+    const gpa_float64 r41 = static_cast<gpa_float64>(*results[41]);
+    const gpa_float64 r42 = static_cast<gpa_float64>(*results[42]);
+    const gpa_float64 r43 = static_cast<gpa_float64>(*results[43]);
+    const gpa_float64 r44 = static_cast<gpa_float64>(*results[44]);
+    const gpa_float64 r45 = static_cast<gpa_float64>(*results[45]);
+    const gpa_float64 r46 = static_cast<gpa_float64>(*results[46]);
+    const gpa_float64 r47 = static_cast<gpa_float64>(*results[47]);
+    const gpa_float64 r48 = static_cast<gpa_float64>(*results[48]);
+    const gpa_float64 r49 = static_cast<gpa_float64>(*results[49]);
+    const gpa_float64 r50 = static_cast<gpa_float64>(*results[50]);
+    const gpa_float64 r51 = static_cast<gpa_float64>(*results[51]);
+    const gpa_float64 r52 = static_cast<gpa_float64>(*results[52]);
+    const gpa_float64 r53 = static_cast<gpa_float64>(*results[53]);
+    const gpa_float64 r54 = static_cast<gpa_float64>(*results[54]);
+    const gpa_float64 r55 = static_cast<gpa_float64>(*results[55]);
+    const gpa_float64 r56 = static_cast<gpa_float64>(*results[56]);
+    const gpa_float64 r57 = static_cast<gpa_float64>(*results[57]);
+    const gpa_float64 r58 = static_cast<gpa_float64>(*results[58]);
+    const gpa_float64 r59 = static_cast<gpa_float64>(*results[59]);
+    const gpa_float64 r60 = static_cast<gpa_float64>(*results[60]);
+    const gpa_float64 r61 = static_cast<gpa_float64>(*results[61]);
+    const gpa_float64 r62 = static_cast<gpa_float64>(*results[62]);
+    const gpa_float64 r63 = static_cast<gpa_float64>(*results[63]);
+    const gpa_float64 r64 = static_cast<gpa_float64>(*results[64]);
+    const gpa_float64 r65 = static_cast<gpa_float64>(*results[65]);
+    const gpa_float64 r66 = static_cast<gpa_float64>(*results[66]);
+    const gpa_float64 r67 = static_cast<gpa_float64>(*results[67]);
+    const gpa_float64 r68 = static_cast<gpa_float64>(*results[68]);
+    const gpa_float64 r69 = static_cast<gpa_float64>(*results[69]);
+    const gpa_float64 r70 = static_cast<gpa_float64>(*results[70]);
+    const gpa_float64 r71 = static_cast<gpa_float64>(*results[71]);
+    const gpa_float64 r72 = static_cast<gpa_float64>(*results[72]);
+    const gpa_float64 r73 = static_cast<gpa_float64>(*results[73]);
+    const gpa_float64 r74 = static_cast<gpa_float64>(*results[74]);
+    const gpa_float64 r75 = static_cast<gpa_float64>(*results[75]);
+    const gpa_float64 r76 = static_cast<gpa_float64>(*results[76]);
+    const gpa_float64 r77 = static_cast<gpa_float64>(*results[77]);
+    const gpa_float64 r78 = static_cast<gpa_float64>(*results[78]);
+    const gpa_float64 r79 = static_cast<gpa_float64>(*results[79]);
+    const gpa_float64 r80 = static_cast<gpa_float64>(*results[80]);
+    const gpa_float64 r81 = static_cast<gpa_float64>(*results[81]);
+    const gpa_float64 r82 = static_cast<gpa_float64>(*results[82]);
+    const gpa_float64 r83 = static_cast<gpa_float64>(*results[83]);
+    const gpa_float64 r84 = static_cast<gpa_float64>(*results[84]);
+    const gpa_float64 r85 = static_cast<gpa_float64>(*results[85]);
+    const gpa_float64 r86 = static_cast<gpa_float64>(*results[86]);
+    const gpa_float64 r87 = static_cast<gpa_float64>(*results[87]);
+    const gpa_float64 r88 = static_cast<gpa_float64>(*results[88]);
+    const gpa_float64 r89 = static_cast<gpa_float64>(*results[89]);
+    const gpa_float64 r90 = static_cast<gpa_float64>(*results[90]);
+    const gpa_float64 r91 = static_cast<gpa_float64>(*results[91]);
+    const gpa_float64 r92 = static_cast<gpa_float64>(*results[92]);
+    const gpa_float64 r93 = static_cast<gpa_float64>(*results[93]);
+    const gpa_float64 r94 = static_cast<gpa_float64>(*results[94]);
+    const gpa_float64 r95 = static_cast<gpa_float64>(*results[95]);
+    const gpa_float64 r96 = static_cast<gpa_float64>(*results[96]);
+    const gpa_float64 r97 = static_cast<gpa_float64>(*results[97]);
+    const gpa_float64 r98 = static_cast<gpa_float64>(*results[98]);
+    const gpa_float64 r99 = static_cast<gpa_float64>(*results[99]);
+    const gpa_float64 r100 = static_cast<gpa_float64>(*results[100]);
+    const gpa_float64 r101 = static_cast<gpa_float64>(*results[101]);
+    const gpa_float64 r102 = static_cast<gpa_float64>(*results[102]);
+    const gpa_float64 r103 = static_cast<gpa_float64>(*results[103]);
+    const gpa_float64 r104 = static_cast<gpa_float64>(*results[104]);
+    const gpa_float64 r105 = static_cast<gpa_float64>(*results[105]);
+    const gpa_float64 r106 = static_cast<gpa_float64>(*results[106]);
+    const gpa_float64 r107 = static_cast<gpa_float64>(*results[107]);
+    const gpa_float64 r108 = static_cast<gpa_float64>(*results[108]);
+    const gpa_float64 r109 = static_cast<gpa_float64>(*results[109]);
+    const gpa_float64 r110 = static_cast<gpa_float64>(*results[110]);
+    const gpa_float64 r111 = static_cast<gpa_float64>(*results[111]);
+    const gpa_float64 r112 = static_cast<gpa_float64>(*results[112]);
+    const gpa_float64 r113 = static_cast<gpa_float64>(*results[113]);
+    const gpa_float64 r114 = static_cast<gpa_float64>(*results[114]);
+    const gpa_float64 r115 = static_cast<gpa_float64>(*results[115]);
+    const gpa_float64 r116 = static_cast<gpa_float64>(*results[116]);
+    const gpa_float64 r117 = static_cast<gpa_float64>(*results[117]);
+    const gpa_float64 r118 = static_cast<gpa_float64>(*results[118]);
+    const gpa_float64 r119 = static_cast<gpa_float64>(*results[119]);
+    const gpa_float64 r120 = static_cast<gpa_float64>(*results[120]);
+    const gpa_float64 r121 = static_cast<gpa_float64>(*results[121]);
+    const gpa_float64 r122 = static_cast<gpa_float64>(*results[122]);
+    const gpa_float64 r123 = static_cast<gpa_float64>(*results[123]);
+    const gpa_float64 r124 = static_cast<gpa_float64>(*results[124]);
+    const gpa_float64 r125 = static_cast<gpa_float64>(*results[125]);
+    const gpa_float64 r126 = static_cast<gpa_float64>(*results[126]);
+    const gpa_float64 r127 = static_cast<gpa_float64>(*results[127]);
+    const gpa_float64 r128 = static_cast<gpa_float64>(*results[128]);
+    const gpa_float64 r129 = static_cast<gpa_float64>(*results[129]);
+    const gpa_float64 r130 = static_cast<gpa_float64>(*results[130]);
+    const gpa_float64 r131 = static_cast<gpa_float64>(*results[131]);
+    const gpa_float64 r132 = static_cast<gpa_float64>(*results[132]);
+    const gpa_float64 r133 = static_cast<gpa_float64>(*results[133]);
+    const gpa_float64 r134 = static_cast<gpa_float64>(*results[134]);
+    const gpa_float64 r135 = static_cast<gpa_float64>(*results[135]);
+    const gpa_float64 r136 = static_cast<gpa_float64>(*results[136]);
+    const gpa_float64 r137 = static_cast<gpa_float64>(*results[137]);
+    const gpa_float64 r138 = static_cast<gpa_float64>(*results[138]);
+    const gpa_float64 r139 = static_cast<gpa_float64>(*results[139]);
+    const gpa_float64 r140 = static_cast<gpa_float64>(*results[140]);
+    const gpa_float64 r141 = static_cast<gpa_float64>(*results[141]);
+    const gpa_float64 r142 = static_cast<gpa_float64>(*results[142]);
+    const gpa_float64 r143 = static_cast<gpa_float64>(*results[143]);
+    const gpa_float64 r144 = static_cast<gpa_float64>(*results[144]);
+    const gpa_float64 r145 = static_cast<gpa_float64>(*results[145]);
+    const gpa_float64 r146 = static_cast<gpa_float64>(*results[146]);
+    const gpa_float64 r147 = static_cast<gpa_float64>(*results[147]);
+    const gpa_float64 r148 = static_cast<gpa_float64>(*results[148]);
+    const gpa_float64 r149 = static_cast<gpa_float64>(*results[149]);
+    const gpa_float64 r150 = static_cast<gpa_float64>(*results[150]);
+    const gpa_float64 r151 = static_cast<gpa_float64>(*results[151]);
+    const gpa_float64 r152 = static_cast<gpa_float64>(*results[152]);
+    const gpa_float64 r153 = static_cast<gpa_float64>(*results[153]);
+    const gpa_float64 r154 = static_cast<gpa_float64>(*results[154]);
+    const gpa_float64 r155 = static_cast<gpa_float64>(*results[155]);
+    const gpa_float64 r156 = static_cast<gpa_float64>(*results[156]);
+    const gpa_float64 r157 = static_cast<gpa_float64>(*results[157]);
+    const gpa_float64 r158 = static_cast<gpa_float64>(*results[158]);
+    const gpa_float64 r159 = static_cast<gpa_float64>(*results[159]);
+    const gpa_float64 r160 = static_cast<gpa_float64>(*results[160]);
+    const gpa_float64 r161 = static_cast<gpa_float64>(*results[161]);
+    const gpa_float64 r162 = static_cast<gpa_float64>(*results[162]);
+    const gpa_float64 r163 = static_cast<gpa_float64>(*results[163]);
+    const gpa_float64 r164 = static_cast<gpa_float64>(*results[164]);
+    const gpa_float64 r165 = static_cast<gpa_float64>(*results[165]);
+    const gpa_float64 r166 = static_cast<gpa_float64>(*results[166]);
+    const gpa_float64 r167 = static_cast<gpa_float64>(*results[167]);
+    const gpa_float64 r168 = static_cast<gpa_float64>(*results[168]);
+    const gpa_float64 r169 = static_cast<gpa_float64>(*results[169]);
+    const gpa_float64 r170 = static_cast<gpa_float64>(*results[170]);
+    const gpa_float64 r171 = static_cast<gpa_float64>(*results[171]);
+    const gpa_float64 r172 = static_cast<gpa_float64>(*results[172]);
+    const gpa_float64 r173 = static_cast<gpa_float64>(*results[173]);
+    const gpa_float64 r174 = static_cast<gpa_float64>(*results[174]);
+    const gpa_float64 r175 = static_cast<gpa_float64>(*results[175]);
+    const gpa_float64 r176 = static_cast<gpa_float64>(*results[176]);
+    const gpa_float64 r177 = static_cast<gpa_float64>(*results[177]);
+    const gpa_float64 r178 = static_cast<gpa_float64>(*results[178]);
+    const gpa_float64 r179 = static_cast<gpa_float64>(*results[179]);
+    const gpa_float64 r180 = static_cast<gpa_float64>(*results[180]);
+    const gpa_float64 r181 = static_cast<gpa_float64>(*results[181]);
+    const gpa_float64 r182 = static_cast<gpa_float64>(*results[182]);
+    const gpa_float64 r183 = static_cast<gpa_float64>(*results[183]);
+    const gpa_float64 r184 = static_cast<gpa_float64>(*results[184]);
+    const gpa_float64 r185 = static_cast<gpa_float64>(*results[185]);
+    const gpa_float64 r186 = static_cast<gpa_float64>(*results[186]);
+    const gpa_float64 r187 = static_cast<gpa_float64>(*results[187]);
+    const gpa_float64 r188 = static_cast<gpa_float64>(*results[188]);
+    const gpa_float64 r189 = static_cast<gpa_float64>(*results[189]);
+    const gpa_float64 r190 = static_cast<gpa_float64>(*results[190]);
+    const gpa_float64 r191 = static_cast<gpa_float64>(*results[191]);
+    const gpa_float64 r192 = static_cast<gpa_float64>(*results[192]);
+    const gpa_float64 r193 = static_cast<gpa_float64>(*results[193]);
+    const gpa_float64 r194 = static_cast<gpa_float64>(*results[194]);
+    const gpa_float64 r195 = static_cast<gpa_float64>(*results[195]);
+    const gpa_float64 r196 = static_cast<gpa_float64>(*results[196]);
+    const gpa_float64 r197 = static_cast<gpa_float64>(*results[197]);
+    const gpa_float64 r198 = static_cast<gpa_float64>(*results[198]);
+    const gpa_float64 r199 = static_cast<gpa_float64>(*results[199]);
+    const gpa_float64 r200 = static_cast<gpa_float64>(*results[200]);
+    const gpa_float64 r201 = static_cast<gpa_float64>(*results[201]);
+    const gpa_float64 r202 = static_cast<gpa_float64>(*results[202]);
+    const gpa_float64 r203 = static_cast<gpa_float64>(*results[203]);
+    const gpa_float64 r204 = static_cast<gpa_float64>(*results[204]);
+    const gpa_float64 r205 = static_cast<gpa_float64>(*results[205]);
+    const gpa_float64 r206 = static_cast<gpa_float64>(*results[206]);
+    const gpa_float64 r207 = static_cast<gpa_float64>(*results[207]);
+    const gpa_float64 r208 = static_cast<gpa_float64>(*results[208]);
+    const gpa_float64 r209 = static_cast<gpa_float64>(*results[209]);
+    const gpa_float64 r210 = static_cast<gpa_float64>(*results[210]);
+    const gpa_float64 r211 = static_cast<gpa_float64>(*results[211]);
+    const gpa_float64 r212 = static_cast<gpa_float64>(*results[212]);
+    const gpa_float64 r213 = static_cast<gpa_float64>(*results[213]);
+    const gpa_float64 r214 = static_cast<gpa_float64>(*results[214]);
+    const gpa_float64 r215 = static_cast<gpa_float64>(*results[215]);
+    const gpa_float64 r216 = static_cast<gpa_float64>(*results[216]);
+    const gpa_float64 r217 = static_cast<gpa_float64>(*results[217]);
+    const gpa_float64 r218 = static_cast<gpa_float64>(*results[218]);
+    const gpa_float64 r219 = static_cast<gpa_float64>(*results[219]);
+    const gpa_float64 r220 = static_cast<gpa_float64>(*results[220]);
+    const gpa_float64 r221 = static_cast<gpa_float64>(*results[221]);
+    const gpa_float64 r222 = static_cast<gpa_float64>(*results[222]);
+    const gpa_float64 r223 = static_cast<gpa_float64>(*results[223]);
+    const gpa_float64 r224 = static_cast<gpa_float64>(*results[224]);
+    const gpa_float64 r225 = static_cast<gpa_float64>(*results[225]);
+    const gpa_float64 r226 = static_cast<gpa_float64>(*results[226]);
+    const gpa_float64 r227 = static_cast<gpa_float64>(*results[227]);
+    const gpa_float64 r228 = static_cast<gpa_float64>(*results[228]);
+    const gpa_float64 r229 = static_cast<gpa_float64>(*results[229]);
+    const gpa_float64 r230 = static_cast<gpa_float64>(*results[230]);
+    const gpa_float64 r231 = static_cast<gpa_float64>(*results[231]);
+    const gpa_float64 r232 = static_cast<gpa_float64>(*results[232]);
+    const gpa_float64 r233 = static_cast<gpa_float64>(*results[233]);
+    const gpa_float64 r234 = static_cast<gpa_float64>(*results[234]);
+    const gpa_float64 r235 = static_cast<gpa_float64>(*results[235]);
+    const gpa_float64 r236 = static_cast<gpa_float64>(*results[236]);
+    const gpa_float64 r237 = static_cast<gpa_float64>(*results[237]);
+    const gpa_float64 r238 = static_cast<gpa_float64>(*results[238]);
+    const gpa_float64 r239 = static_cast<gpa_float64>(*results[239]);
+    const gpa_float64 r240 = static_cast<gpa_float64>(*results[240]);
+    const gpa_float64 r241 = static_cast<gpa_float64>(*results[241]);
+    const gpa_float64 r242 = static_cast<gpa_float64>(*results[242]);
+    const gpa_float64 r243 = static_cast<gpa_float64>(*results[243]);
+    const gpa_float64 r244 = static_cast<gpa_float64>(*results[244]);
+    const gpa_float64 r245 = static_cast<gpa_float64>(*results[245]);
+    const gpa_float64 r246 = static_cast<gpa_float64>(*results[246]);
+    const gpa_float64 r247 = static_cast<gpa_float64>(*results[247]);
+    const gpa_float64 r248 = static_cast<gpa_float64>(*results[248]);
+    const gpa_float64 r249 = static_cast<gpa_float64>(*results[249]);
+    const gpa_float64 r250 = static_cast<gpa_float64>(*results[250]);
+    const gpa_float64 r251 = static_cast<gpa_float64>(*results[251]);
+    const gpa_float64 r252 = static_cast<gpa_float64>(*results[252]);
+    const gpa_float64 r253 = static_cast<gpa_float64>(*results[253]);
+    const gpa_float64 r254 = static_cast<gpa_float64>(*results[254]);
+    const gpa_float64 r255 = static_cast<gpa_float64>(*results[255]);
+    const gpa_float64 r256 = static_cast<gpa_float64>(*results[256]);
+    const gpa_float64 r257 = static_cast<gpa_float64>(*results[257]);
+    const gpa_float64 r258 = static_cast<gpa_float64>(*results[258]);
+    const gpa_float64 r259 = static_cast<gpa_float64>(*results[259]);
+    const gpa_float64 r260 = static_cast<gpa_float64>(*results[260]);
+    const gpa_float64 r261 = static_cast<gpa_float64>(*results[261]);
+    const gpa_float64 r262 = static_cast<gpa_float64>(*results[262]);
+    const gpa_float64 r263 = static_cast<gpa_float64>(*results[263]);
+    const gpa_float64 r264 = static_cast<gpa_float64>(*results[264]);
+    const gpa_float64 r265 = static_cast<gpa_float64>(*results[265]);
+    const gpa_float64 r266 = static_cast<gpa_float64>(*results[266]);
+    const gpa_float64 r267 = static_cast<gpa_float64>(*results[267]);
+    const gpa_float64 r268 = static_cast<gpa_float64>(*results[268]);
+    const gpa_float64 r269 = static_cast<gpa_float64>(*results[269]);
+    const gpa_float64 r270 = static_cast<gpa_float64>(*results[270]);
+    const gpa_float64 r271 = static_cast<gpa_float64>(*results[271]);
+    const gpa_float64 r272 = static_cast<gpa_float64>(*results[272]);
+    const gpa_float64 r273 = static_cast<gpa_float64>(*results[273]);
+    const gpa_float64 r274 = static_cast<gpa_float64>(*results[274]);
+    const gpa_float64 r275 = static_cast<gpa_float64>(*results[275]);
+    const gpa_float64 r276 = static_cast<gpa_float64>(*results[276]);
+    const gpa_float64 r277 = static_cast<gpa_float64>(*results[277]);
+    const gpa_float64 r278 = static_cast<gpa_float64>(*results[278]);
+    const gpa_float64 r279 = static_cast<gpa_float64>(*results[279]);
+    const gpa_float64 r280 = static_cast<gpa_float64>(*results[280]);
+    const gpa_float64 r281 = static_cast<gpa_float64>(*results[281]);
+    const gpa_float64 r282 = static_cast<gpa_float64>(*results[282]);
+    const gpa_float64 r283 = static_cast<gpa_float64>(*results[283]);
+    const gpa_float64 r284 = static_cast<gpa_float64>(*results[284]);
+    const gpa_float64 r285 = static_cast<gpa_float64>(*results[285]);
+    const gpa_float64 r286 = static_cast<gpa_float64>(*results[286]);
+    const gpa_float64 r287 = static_cast<gpa_float64>(*results[287]);
+    const gpa_float64 r288 = static_cast<gpa_float64>(*results[288]);
+    const gpa_float64 r289 = static_cast<gpa_float64>(*results[289]);
+    const gpa_float64 r290 = static_cast<gpa_float64>(*results[290]);
+    const gpa_float64 r291 = static_cast<gpa_float64>(*results[291]);
+    const gpa_float64 r292 = static_cast<gpa_float64>(*results[292]);
+    const gpa_float64 r293 = static_cast<gpa_float64>(*results[293]);
+    const gpa_float64 r294 = static_cast<gpa_float64>(*results[294]);
+    const gpa_float64 r295 = static_cast<gpa_float64>(*results[295]);
+    const gpa_float64 r296 = static_cast<gpa_float64>(*results[296]);
+    const gpa_float64 r297 = static_cast<gpa_float64>(*results[297]);
+    const gpa_float64 r298 = static_cast<gpa_float64>(*results[298]);
+    const gpa_float64 r299 = static_cast<gpa_float64>(*results[299]);
+    const gpa_float64 r300 = static_cast<gpa_float64>(*results[300]);
+    const gpa_float64 r301 = static_cast<gpa_float64>(*results[301]);
+    const gpa_float64 r302 = static_cast<gpa_float64>(*results[302]);
+    const gpa_float64 r303 = static_cast<gpa_float64>(*results[303]);
+    const gpa_float64 r304 = static_cast<gpa_float64>(*results[304]);
+    const gpa_float64 r305 = static_cast<gpa_float64>(*results[305]);
+    const gpa_float64 r306 = static_cast<gpa_float64>(*results[306]);
+    const gpa_float64 r307 = static_cast<gpa_float64>(*results[307]);
+    const gpa_float64 r308 = static_cast<gpa_float64>(*results[308]);
+    const gpa_float64 r309 = static_cast<gpa_float64>(*results[309]);
+    const gpa_float64 r310 = static_cast<gpa_float64>(*results[310]);
+    const gpa_float64 r311 = static_cast<gpa_float64>(*results[311]);
+    const gpa_float64 r312 = static_cast<gpa_float64>(*results[312]);
+    const gpa_float64 r313 = static_cast<gpa_float64>(*results[313]);
+    const gpa_float64 r314 = static_cast<gpa_float64>(*results[314]);
+    const gpa_float64 r315 = static_cast<gpa_float64>(*results[315]);
+    const gpa_float64 r316 = static_cast<gpa_float64>(*results[316]);
+    const gpa_float64 r317 = static_cast<gpa_float64>(*results[317]);
+    const gpa_float64 r318 = static_cast<gpa_float64>(*results[318]);
+    const gpa_float64 r319 = static_cast<gpa_float64>(*results[319]);
+    const gpa_float64 r320 = static_cast<gpa_float64>(*results[320]);
+    const gpa_float64 r321 = static_cast<gpa_float64>(*results[321]);
+    const gpa_float64 r322 = static_cast<gpa_float64>(*results[322]);
+    const gpa_float64 r323 = static_cast<gpa_float64>(*results[323]);
+    const gpa_float64 r324 = static_cast<gpa_float64>(*results[324]);
+    const gpa_float64 r325 = static_cast<gpa_float64>(*results[325]);
+    const gpa_float64 r326 = static_cast<gpa_float64>(*results[326]);
+    const gpa_float64 r327 = static_cast<gpa_float64>(*results[327]);
+    const gpa_float64 r328 = static_cast<gpa_float64>(*results[328]);
+    const gpa_float64 r329 = static_cast<gpa_float64>(*results[329]);
+    const gpa_float64 r330 = static_cast<gpa_float64>(*results[330]);
+    const gpa_float64 r331 = static_cast<gpa_float64>(*results[331]);
+    const gpa_float64 r332 = static_cast<gpa_float64>(*results[332]);
+    const gpa_float64 r333 = static_cast<gpa_float64>(*results[333]);
+    const gpa_float64 r334 = static_cast<gpa_float64>(*results[334]);
+    const gpa_float64 r335 = static_cast<gpa_float64>(*results[335]);
+    const gpa_float64 r336 = static_cast<gpa_float64>(*results[336]);
+    const gpa_float64 r337 = static_cast<gpa_float64>(*results[337]);
+    const gpa_float64 r338 = static_cast<gpa_float64>(*results[338]);
+    const gpa_float64 r339 = static_cast<gpa_float64>(*results[339]);
+    const gpa_float64 r340 = static_cast<gpa_float64>(*results[340]);
+    const gpa_float64 r341 = static_cast<gpa_float64>(*results[341]);
+    const gpa_float64 r342 = static_cast<gpa_float64>(*results[342]);
+    const gpa_float64 r343 = static_cast<gpa_float64>(*results[343]);
+    const gpa_float64 r344 = static_cast<gpa_float64>(*results[344]);
+    const gpa_float64 r345 = static_cast<gpa_float64>(*results[345]);
+    const gpa_float64 r346 = static_cast<gpa_float64>(*results[346]);
+    const gpa_float64 r347 = static_cast<gpa_float64>(*results[347]);
+    const gpa_float64 r348 = static_cast<gpa_float64>(*results[348]);
+    const gpa_float64 r349 = static_cast<gpa_float64>(*results[349]);
+    const gpa_float64 r350 = static_cast<gpa_float64>(*results[350]);
+    const gpa_float64 r351 = static_cast<gpa_float64>(*results[351]);
+    const gpa_float64 r352 = static_cast<gpa_float64>(*results[352]);
+    const gpa_float64 r353 = static_cast<gpa_float64>(*results[353]);
+    const gpa_float64 r354 = static_cast<gpa_float64>(*results[354]);
+    const gpa_float64 r355 = static_cast<gpa_float64>(*results[355]);
+    const gpa_float64 r356 = static_cast<gpa_float64>(*results[356]);
+    const gpa_float64 r357 = static_cast<gpa_float64>(*results[357]);
+    const gpa_float64 r358 = static_cast<gpa_float64>(*results[358]);
+    const gpa_float64 r359 = static_cast<gpa_float64>(*results[359]);
+    const gpa_float64 r360 = static_cast<gpa_float64>(*results[360]);
+    const gpa_float64 r361 = static_cast<gpa_float64>(*results[361]);
+    const gpa_float64 r362 = static_cast<gpa_float64>(*results[362]);
+    const gpa_float64 r363 = static_cast<gpa_float64>(*results[363]);
+    const gpa_float64 r364 = static_cast<gpa_float64>(*results[364]);
+    const gpa_float64 r365 = static_cast<gpa_float64>(*results[365]);
+    const gpa_float64 r366 = static_cast<gpa_float64>(*results[366]);
+    const gpa_float64 r367 = static_cast<gpa_float64>(*results[367]);
+    const gpa_float64 r368 = static_cast<gpa_float64>(*results[368]);
+    const gpa_float64 r369 = static_cast<gpa_float64>(*results[369]);
+    const gpa_float64 r370 = static_cast<gpa_float64>(*results[370]);
+    const gpa_float64 r371 = static_cast<gpa_float64>(*results[371]);
+    const gpa_float64 r372 = static_cast<gpa_float64>(*results[372]);
+    const gpa_float64 r373 = static_cast<gpa_float64>(*results[373]);
+    const gpa_float64 r374 = static_cast<gpa_float64>(*results[374]);
+    const gpa_float64 r375 = static_cast<gpa_float64>(*results[375]);
+    const gpa_float64 r376 = static_cast<gpa_float64>(*results[376]);
+    const gpa_float64 r377 = static_cast<gpa_float64>(*results[377]);
+    const gpa_float64 r378 = static_cast<gpa_float64>(*results[378]);
+    const gpa_float64 r379 = static_cast<gpa_float64>(*results[379]);
+    const gpa_float64 r380 = static_cast<gpa_float64>(*results[380]);
+    const gpa_float64 r381 = static_cast<gpa_float64>(*results[381]);
+    const gpa_float64 r382 = static_cast<gpa_float64>(*results[382]);
+    const gpa_float64 r383 = static_cast<gpa_float64>(*results[383]);
+    const gpa_float64 r384 = static_cast<gpa_float64>(*results[384]);
+    const gpa_float64 r385 = static_cast<gpa_float64>(*results[385]);
+    const gpa_float64 r386 = static_cast<gpa_float64>(*results[386]);
+    const gpa_float64 r387 = static_cast<gpa_float64>(*results[387]);
+    const gpa_float64 r388 = static_cast<gpa_float64>(*results[388]);
+    const gpa_float64 r389 = static_cast<gpa_float64>(*results[389]);
+    const gpa_float64 r390 = static_cast<gpa_float64>(*results[390]);
+    const gpa_float64 r391 = static_cast<gpa_float64>(*results[391]);
+    const gpa_float64 r392 = static_cast<gpa_float64>(*results[392]);
+    const gpa_float64 r393 = static_cast<gpa_float64>(*results[393]);
+    const gpa_float64 r394 = static_cast<gpa_float64>(*results[394]);
+    const gpa_float64 r395 = static_cast<gpa_float64>(*results[395]);
+    const gpa_float64 r396 = static_cast<gpa_float64>(*results[396]);
+    const gpa_float64 r397 = static_cast<gpa_float64>(*results[397]);
+    const gpa_float64 r398 = static_cast<gpa_float64>(*results[398]);
+    const gpa_float64 r399 = static_cast<gpa_float64>(*results[399]);
+    const gpa_float64 r400 = static_cast<gpa_float64>(*results[400]);
+    const gpa_float64 r401 = static_cast<gpa_float64>(*results[401]);
+    const gpa_float64 r402 = static_cast<gpa_float64>(*results[402]);
+    const gpa_float64 r403 = static_cast<gpa_float64>(*results[403]);
+    const gpa_float64 r404 = static_cast<gpa_float64>(*results[404]);
+    const gpa_float64 r405 = static_cast<gpa_float64>(*results[405]);
+    const gpa_float64 r406 = static_cast<gpa_float64>(*results[406]);
+    const gpa_float64 r407 = static_cast<gpa_float64>(*results[407]);
+    const gpa_float64 r408 = static_cast<gpa_float64>(*results[408]);
+    const gpa_float64 r409 = static_cast<gpa_float64>(*results[409]);
+    const gpa_float64 r410 = static_cast<gpa_float64>(*results[410]);
+    const gpa_float64 r411 = static_cast<gpa_float64>(*results[411]);
+    const gpa_float64 r412 = static_cast<gpa_float64>(*results[412]);
+    const gpa_float64 r413 = static_cast<gpa_float64>(*results[413]);
+    const gpa_float64 r414 = static_cast<gpa_float64>(*results[414]);
+    const gpa_float64 r415 = static_cast<gpa_float64>(*results[415]);
+    const gpa_float64 r416 = static_cast<gpa_float64>(*results[416]);
+    const gpa_float64 r417 = static_cast<gpa_float64>(*results[417]);
+    const gpa_float64 r418 = static_cast<gpa_float64>(*results[418]);
+    const gpa_float64 r419 = static_cast<gpa_float64>(*results[419]);
+    const gpa_float64 r420 = static_cast<gpa_float64>(*results[420]);
+    const gpa_float64 r421 = static_cast<gpa_float64>(*results[421]);
+    const gpa_float64 r422 = static_cast<gpa_float64>(*results[422]);
+    const gpa_float64 r423 = static_cast<gpa_float64>(*results[423]);
+    const gpa_float64 r424 = static_cast<gpa_float64>(*results[424]);
+    const gpa_float64 r425 = static_cast<gpa_float64>(*results[425]);
+    const gpa_float64 r426 = static_cast<gpa_float64>(*results[426]);
+    const gpa_float64 r427 = static_cast<gpa_float64>(*results[427]);
+    const gpa_float64 r428 = static_cast<gpa_float64>(*results[428]);
+    const gpa_float64 r429 = static_cast<gpa_float64>(*results[429]);
+    const gpa_float64 r430 = static_cast<gpa_float64>(*results[430]);
+    const gpa_float64 r431 = static_cast<gpa_float64>(*results[431]);
+    const gpa_float64 r432 = static_cast<gpa_float64>(*results[432]);
+    const gpa_float64 r433 = static_cast<gpa_float64>(*results[433]);
+    const gpa_float64 r434 = static_cast<gpa_float64>(*results[434]);
+    const gpa_float64 r435 = static_cast<gpa_float64>(*results[435]);
+    const gpa_float64 r436 = static_cast<gpa_float64>(*results[436]);
+    const gpa_float64 r437 = static_cast<gpa_float64>(*results[437]);
+    const gpa_float64 r438 = static_cast<gpa_float64>(*results[438]);
+    const gpa_float64 r439 = static_cast<gpa_float64>(*results[439]);
+    const gpa_float64 r440 = static_cast<gpa_float64>(*results[440]);
+    const gpa_float64 r441 = static_cast<gpa_float64>(*results[441]);
+    const gpa_float64 r442 = static_cast<gpa_float64>(*results[442]);
+    const gpa_float64 r443 = static_cast<gpa_float64>(*results[443]);
+    const gpa_float64 r444 = static_cast<gpa_float64>(*results[444]);
+    const gpa_float64 r445 = static_cast<gpa_float64>(*results[445]);
+    const gpa_float64 r446 = static_cast<gpa_float64>(*results[446]);
+    const gpa_float64 r447 = static_cast<gpa_float64>(*results[447]);
+    const gpa_float64 r448 = static_cast<gpa_float64>(*results[448]);
+    const gpa_float64 r449 = static_cast<gpa_float64>(*results[449]);
+    const gpa_float64 r450 = static_cast<gpa_float64>(*results[450]);
+    const gpa_float64 r451 = static_cast<gpa_float64>(*results[451]);
+    const gpa_float64 r452 = static_cast<gpa_float64>(*results[452]);
+    const gpa_float64 r453 = static_cast<gpa_float64>(*results[453]);
+    const gpa_float64 r454 = static_cast<gpa_float64>(*results[454]);
+    const gpa_float64 r455 = static_cast<gpa_float64>(*results[455]);
+    const gpa_float64 r456 = static_cast<gpa_float64>(*results[456]);
+    const gpa_float64 r457 = static_cast<gpa_float64>(*results[457]);
+    const gpa_float64 r458 = static_cast<gpa_float64>(*results[458]);
+    const gpa_float64 r459 = static_cast<gpa_float64>(*results[459]);
+    const gpa_float64 r460 = static_cast<gpa_float64>(*results[460]);
+    const gpa_float64 r461 = static_cast<gpa_float64>(*results[461]);
+    const gpa_float64 r462 = static_cast<gpa_float64>(*results[462]);
+    const gpa_float64 r463 = static_cast<gpa_float64>(*results[463]);
+    const gpa_float64 r464 = static_cast<gpa_float64>(*results[464]);
+    const gpa_float64 r465 = static_cast<gpa_float64>(*results[465]);
+    const gpa_float64 r466 = static_cast<gpa_float64>(*results[466]);
+    const gpa_float64 r467 = static_cast<gpa_float64>(*results[467]);
+    const gpa_float64 r468 = static_cast<gpa_float64>(*results[468]);
+    const gpa_float64 r469 = static_cast<gpa_float64>(*results[469]);
+    const gpa_float64 r470 = static_cast<gpa_float64>(*results[470]);
+    const gpa_float64 r471 = static_cast<gpa_float64>(*results[471]);
+    const gpa_float64 r472 = static_cast<gpa_float64>(*results[472]);
+    const gpa_float64 r473 = static_cast<gpa_float64>(*results[473]);
+    const gpa_float64 r474 = static_cast<gpa_float64>(*results[474]);
+    const gpa_float64 r475 = static_cast<gpa_float64>(*results[475]);
+    const gpa_float64 r476 = static_cast<gpa_float64>(*results[476]);
+    const gpa_float64 r477 = static_cast<gpa_float64>(*results[477]);
+    const gpa_float64 r478 = static_cast<gpa_float64>(*results[478]);
+    const gpa_float64 r479 = static_cast<gpa_float64>(*results[479]);
+    const gpa_float64 r480 = static_cast<gpa_float64>(*results[480]);
+    const gpa_float64 r481 = static_cast<gpa_float64>(*results[481]);
+    const gpa_float64 r482 = static_cast<gpa_float64>(*results[482]);
+    const gpa_float64 r483 = static_cast<gpa_float64>(*results[483]);
+    const gpa_float64 r484 = static_cast<gpa_float64>(*results[484]);
+    const gpa_float64 r485 = static_cast<gpa_float64>(*results[485]);
+    const gpa_float64 r486 = static_cast<gpa_float64>(*results[486]);
+    const gpa_float64 r487 = static_cast<gpa_float64>(*results[487]);
+    const gpa_float64 r488 = static_cast<gpa_float64>(*results[488]);
+    const gpa_float64 r489 = static_cast<gpa_float64>(*results[489]);
+    const gpa_float64 r490 = static_cast<gpa_float64>(*results[490]);
+    const gpa_float64 r491 = static_cast<gpa_float64>(*results[491]);
+    const gpa_float64 r492 = static_cast<gpa_float64>(*results[492]);
+    const gpa_float64 r493 = static_cast<gpa_float64>(*results[493]);
+    const gpa_float64 r494 = static_cast<gpa_float64>(*results[494]);
+    const gpa_float64 r495 = static_cast<gpa_float64>(*results[495]);
+    const gpa_float64 r496 = static_cast<gpa_float64>(*results[496]);
+    const gpa_float64 r497 = static_cast<gpa_float64>(*results[497]);
+    const gpa_float64 r498 = static_cast<gpa_float64>(*results[498]);
+    const gpa_float64 r499 = static_cast<gpa_float64>(*results[499]);
+    const gpa_float64 r500 = static_cast<gpa_float64>(*results[500]);
+    const gpa_float64 r501 = static_cast<gpa_float64>(*results[501]);
+    const gpa_float64 r502 = static_cast<gpa_float64>(*results[502]);
+    const gpa_float64 r503 = static_cast<gpa_float64>(*results[503]);
+    const gpa_float64 r504 = static_cast<gpa_float64>(*results[504]);
+    const gpa_float64 r505 = static_cast<gpa_float64>(*results[505]);
+    const gpa_float64 r506 = static_cast<gpa_float64>(*results[506]);
+    const gpa_float64 r507 = static_cast<gpa_float64>(*results[507]);
+    const gpa_float64 r508 = static_cast<gpa_float64>(*results[508]);
+    const gpa_float64 r509 = static_cast<gpa_float64>(*results[509]);
+    const gpa_float64 r510 = static_cast<gpa_float64>(*results[510]);
+    const gpa_float64 r511 = static_cast<gpa_float64>(*results[511]);
+    const gpa_float64 r512 = static_cast<gpa_float64>(*results[512]);
+    const gpa_float64 r513 = static_cast<gpa_float64>(*results[513]);
+    const gpa_float64 r514 = static_cast<gpa_float64>(*results[514]);
+    const gpa_float64 r515 = static_cast<gpa_float64>(*results[515]);
+    const gpa_float64 r516 = static_cast<gpa_float64>(*results[516]);
+    const gpa_float64 r517 = static_cast<gpa_float64>(*results[517]);
+    const gpa_float64 r518 = static_cast<gpa_float64>(*results[518]);
+    const gpa_float64 r519 = static_cast<gpa_float64>(*results[519]);
+    const gpa_float64 r520 = static_cast<gpa_float64>(*results[520]);
+    const gpa_float64 r521 = static_cast<gpa_float64>(*results[521]);
+    const gpa_float64 r522 = static_cast<gpa_float64>(*results[522]);
+    const gpa_float64 r523 = static_cast<gpa_float64>(*results[523]);
+    const gpa_float64 r524 = static_cast<gpa_float64>(*results[524]);
+    const gpa_float64 r525 = static_cast<gpa_float64>(*results[525]);
+    const gpa_float64 r526 = static_cast<gpa_float64>(*results[526]);
+    const gpa_float64 r527 = static_cast<gpa_float64>(*results[527]);
+    const gpa_float64 r528 = static_cast<gpa_float64>(*results[528]);
+    const gpa_float64 r529 = static_cast<gpa_float64>(*results[529]);
+    const gpa_float64 r530 = static_cast<gpa_float64>(*results[530]);
+    const gpa_float64 r531 = static_cast<gpa_float64>(*results[531]);
+    const gpa_float64 r532 = static_cast<gpa_float64>(*results[532]);
+    const gpa_float64 r533 = static_cast<gpa_float64>(*results[533]);
+    const gpa_float64 r534 = static_cast<gpa_float64>(*results[534]);
+    const gpa_float64 r535 = static_cast<gpa_float64>(*results[535]);
+    const gpa_float64 r536 = static_cast<gpa_float64>(*results[536]);
+    const gpa_float64 r537 = static_cast<gpa_float64>(*results[537]);
+    const gpa_float64 r538 = static_cast<gpa_float64>(*results[538]);
+    const gpa_float64 r539 = static_cast<gpa_float64>(*results[539]);
+    const gpa_float64 r540 = static_cast<gpa_float64>(*results[540]);
+    const gpa_float64 r541 = static_cast<gpa_float64>(*results[541]);
+    const gpa_float64 r542 = static_cast<gpa_float64>(*results[542]);
+    const gpa_float64 r543 = static_cast<gpa_float64>(*results[543]);
+    const gpa_float64 r544 = static_cast<gpa_float64>(*results[544]);
+    const gpa_float64 r545 = static_cast<gpa_float64>(*results[545]);
+    const gpa_float64 r546 = static_cast<gpa_float64>(*results[546]);
+    const gpa_float64 r547 = static_cast<gpa_float64>(*results[547]);
+    const gpa_float64 r548 = static_cast<gpa_float64>(*results[548]);
+    const gpa_float64 r549 = static_cast<gpa_float64>(*results[549]);
+    const gpa_float64 r550 = static_cast<gpa_float64>(*results[550]);
+    const gpa_float64 r551 = static_cast<gpa_float64>(*results[551]);
+    const gpa_float64 r552 = static_cast<gpa_float64>(*results[552]);
+    const gpa_float64 r553 = static_cast<gpa_float64>(*results[553]);
+    const gpa_float64 r554 = static_cast<gpa_float64>(*results[554]);
+    const gpa_float64 r555 = static_cast<gpa_float64>(*results[555]);
+    const gpa_float64 r556 = static_cast<gpa_float64>(*results[556]);
+    const gpa_float64 r557 = static_cast<gpa_float64>(*results[557]);
+    const gpa_float64 r558 = static_cast<gpa_float64>(*results[558]);
+    const gpa_float64 r559 = static_cast<gpa_float64>(*results[559]);
+    const gpa_float64 r560 = static_cast<gpa_float64>(*results[560]);
+    const gpa_float64 r561 = static_cast<gpa_float64>(*results[561]);
+    const gpa_float64 r562 = static_cast<gpa_float64>(*results[562]);
+    const gpa_float64 r563 = static_cast<gpa_float64>(*results[563]);
+    const gpa_float64 r564 = static_cast<gpa_float64>(*results[564]);
+    const gpa_float64 r565 = static_cast<gpa_float64>(*results[565]);
+    const gpa_float64 r566 = static_cast<gpa_float64>(*results[566]);
+    const gpa_float64 r567 = static_cast<gpa_float64>(*results[567]);
+    const gpa_float64 r568 = static_cast<gpa_float64>(*results[568]);
+    const gpa_float64 r569 = static_cast<gpa_float64>(*results[569]);
+    const gpa_float64 r570 = static_cast<gpa_float64>(*results[570]);
+    const gpa_float64 r571 = static_cast<gpa_float64>(*results[571]);
+    const gpa_float64 r572 = static_cast<gpa_float64>(*results[572]);
+    const gpa_float64 r573 = static_cast<gpa_float64>(*results[573]);
+    const gpa_float64 r574 = static_cast<gpa_float64>(*results[574]);
+    const gpa_float64 r575 = static_cast<gpa_float64>(*results[575]);
+
+    const gpa_float64 v0 = r63 + r62 + r61 + r60 + r59 + r58 + r57 + r56 + r55 + r54 + r53 + r52 + r51 + r50 + r49 + r48 + r47 + r46 + r45 + r44 + r43 + r42 + r41 + r40 + r39 + r38 + r37 + r36 + r35 + r34 + r33 + r32 + r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16 + r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r127 + r126 + r125 + r124 + r123 + r122 + r121 + r120 + r119 + r118 + r117 + r116 + r115 + r114 + r113 + r112 + r111 + r110 + r109 + r108 + r107 + r106 + r105 + r104 + r103 + r102 + r101 + r100 + r99 + r98 + r97 + r96 + r95 + r94 + r93 + r92 + r91 + r90 + r89 + r88 + r87 + r86 + r85 + r84 + r83 + r82 + r81 + r80 + r79 + r78 + r77 + r76 + r75 + r74 + r73 + r72 + r71 + r70 + r69 + r68 + r67 + r66 + r65 + r64;
+    const gpa_float64 v2 = 2.0 * v1;
+    const gpa_float64 v3 = v0 + v2;
+    const gpa_float64 v4 = r191 + r190 + r189 + r188 + r187 + r186 + r185 + r184 + r183 + r182 + r181 + r180 + r179 + r178 + r177 + r176 + r175 + r174 + r173 + r172 + r171 + r170 + r169 + r168 + r167 + r166 + r165 + r164 + r163 + r162 + r161 + r160 + r159 + r158 + r157 + r156 + r155 + r154 + r153 + r152 + r151 + r150 + r149 + r148 + r147 + r146 + r145 + r144 + r143 + r142 + r141 + r140 + r139 + r138 + r137 + r136 + r135 + r134 + r133 + r132 + r131 + r130 + r129 + r128;
+    const gpa_float64 v5 = 4.0 * v4;
+    const gpa_float64 v6 = v3 + v5;
+    const gpa_float64 v7 = r255 + r254 + r253 + r252 + r251 + r250 + r249 + r248 + r247 + r246 + r245 + r244 + r243 + r242 + r241 + r240 + r239 + r238 + r237 + r236 + r235 + r234 + r233 + r232 + r231 + r230 + r229 + r228 + r227 + r226 + r225 + r224 + r223 + r222 + r221 + r220 + r219 + r218 + r217 + r216 + r215 + r214 + r213 + r212 + r211 + r210 + r209 + r208 + r207 + r206 + r205 + r204 + r203 + r202 + r201 + r200 + r199 + r198 + r197 + r196 + r195 + r194 + r193 + r192;
+    const gpa_float64 v8 = 6.0 * v7;
+    const gpa_float64 v9 = v6 + v8;
+    const gpa_float64 v10 = r319 + r318 + r317 + r316 + r315 + r314 + r313 + r312 + r311 + r310 + r309 + r308 + r307 + r306 + r305 + r304 + r303 + r302 + r301 + r300 + r299 + r298 + r297 + r296 + r295 + r294 + r293 + r292 + r291 + r290 + r289 + r288 + r287 + r286 + r285 + r284 + r283 + r282 + r281 + r280 + r279 + r278 + r277 + r276 + r275 + r274 + r273 + r272 + r271 + r270 + r269 + r268 + r267 + r266 + r265 + r264 + r263 + r262 + r261 + r260 + r259 + r258 + r257 + r256;
+    const gpa_float64 v11 = 8.0 * v10;
+    const gpa_float64 v12 = v9 + v11;
+    const gpa_float64 v13 = r383 + r382 + r381 + r380 + r379 + r378 + r377 + r376 + r375 + r374 + r373 + r372 + r371 + r370 + r369 + r368 + r367 + r366 + r365 + r364 + r363 + r362 + r361 + r360 + r359 + r358 + r357 + r356 + r355 + r354 + r353 + r352 + r351 + r350 + r349 + r348 + r347 + r346 + r345 + r344 + r343 + r342 + r341 + r340 + r339 + r338 + r337 + r336 + r335 + r334 + r333 + r332 + r331 + r330 + r329 + r328 + r327 + r326 + r325 + r324 + r323 + r322 + r321 + r320;
+    const gpa_float64 v14 = 10.0 * v13;
+    const gpa_float64 v15 = v12 + v14;
+    const gpa_float64 v16 = r447 + r446 + r445 + r444 + r443 + r442 + r441 + r440 + r439 + r438 + r437 + r436 + r435 + r434 + r433 + r432 + r431 + r430 + r429 + r428 + r427 + r426 + r425 + r424 + r423 + r422 + r421 + r420 + r419 + r418 + r417 + r416 + r415 + r414 + r413 + r412 + r411 + r410 + r409 + r408 + r407 + r406 + r405 + r404 + r403 + r402 + r401 + r400 + r399 + r398 + r397 + r396 + r395 + r394 + r393 + r392 + r391 + r390 + r389 + r388 + r387 + r386 + r385 + r384;
+    const gpa_float64 v17 = 12.0 * v16;
+    const gpa_float64 v18 = v15 + v17;
+    const gpa_float64 v19 = r511 + r510 + r509 + r508 + r507 + r506 + r505 + r504 + r503 + r502 + r501 + r500 + r499 + r498 + r497 + r496 + r495 + r494 + r493 + r492 + r491 + r490 + r489 + r488 + r487 + r486 + r485 + r484 + r483 + r482 + r481 + r480 + r479 + r478 + r477 + r476 + r475 + r474 + r473 + r472 + r471 + r470 + r469 + r468 + r467 + r466 + r465 + r464 + r463 + r462 + r461 + r460 + r459 + r458 + r457 + r456 + r455 + r454 + r453 + r452 + r451 + r450 + r449 + r448;
+    const gpa_float64 v20 = 14.0 * v19;
+    const gpa_float64 v21 = v18 + v20;
+    const gpa_float64 v22 = r575 + r574 + r573 + r572 + r571 + r570 + r569 + r568 + r567 + r566 + r565 + r564 + r563 + r562 + r561 + r560 + r559 + r558 + r557 + r556 + r555 + r554 + r553 + r552 + r551 + r550 + r549 + r548 + r547 + r546 + r545 + r544 + r543 + r542 + r541 + r540 + r539 + r538 + r537 + r536 + r535 + r534 + r533 + r532 + r531 + r530 + r529 + r528 + r527 + r526 + r525 + r524 + r523 + r522 + r521 + r520 + r519 + r518 + r517 + r516 + r515 + r514 + r513 + r512;
+    const gpa_float64 v23 = 16.0 * v22;
+    const gpa_float64 v24 = v21 + v23;
+    const gpa_float64 v25 = r63 + r62 + r61 + r60 + r59 + r58 + r57 + r56 + r55 + r54 + r53 + r52 + r51 + r50 + r49 + r48 + r47 + r46 + r45 + r44 + r43 + r42 + r41 + r40 + r39 + r38 + r37 + r36 + r35 + r34 + r33 + r32 + r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16 + r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v26 = r127 + r126 + r125 + r124 + r123 + r122 + r121 + r120 + r119 + r118 + r117 + r116 + r115 + r114 + r113 + r112 + r111 + r110 + r109 + r108 + r107 + r106 + r105 + r104 + r103 + r102 + r101 + r100 + r99 + r98 + r97 + r96 + r95 + r94 + r93 + r92 + r91 + r90 + r89 + r88 + r87 + r86 + r85 + r84 + r83 + r82 + r81 + r80 + r79 + r78 + r77 + r76 + r75 + r74 + r73 + r72 + r71 + r70 + r69 + r68 + r67 + r66 + r65 + r64;
+    const gpa_float64 v27 = v25 + v26;
+    const gpa_float64 v28 = r191 + r190 + r189 + r188 + r187 + r186 + r185 + r184 + r183 + r182 + r181 + r180 + r179 + r178 + r177 + r176 + r175 + r174 + r173 + r172 + r171 + r170 + r169 + r168 + r167 + r166 + r165 + r164 + r163 + r162 + r161 + r160 + r159 + r158 + r157 + r156 + r155 + r154 + r153 + r152 + r151 + r150 + r149 + r148 + r147 + r146 + r145 + r144 + r143 + r142 + r141 + r140 + r139 + r138 + r137 + r136 + r135 + r134 + r133 + r132 + r131 + r130 + r129 + r128;
+    const gpa_float64 v29 = v27 + v28;
+    const gpa_float64 v30 = r255 + r254 + r253 + r252 + r251 + r250 + r249 + r248 + r247 + r246 + r245 + r244 + r243 + r242 + r241 + r240 + r239 + r238 + r237 + r236 + r235 + r234 + r233 + r232 + r231 + r230 + r229 + r228 + r227 + r226 + r225 + r224 + r223 + r222 + r221 + r220 + r219 + r218 + r217 + r216 + r215 + r214 + r213 + r212 + r211 + r210 + r209 + r208 + r207 + r206 + r205 + r204 + r203 + r202 + r201 + r200 + r199 + r198 + r197 + r196 + r195 + r194 + r193 + r192;
+    const gpa_float64 v31 = v29 + v30;
+    const gpa_float64 v32 = r319 + r318 + r317 + r316 + r315 + r314 + r313 + r312 + r311 + r310 + r309 + r308 + r307 + r306 + r305 + r304 + r303 + r302 + r301 + r300 + r299 + r298 + r297 + r296 + r295 + r294 + r293 + r292 + r291 + r290 + r289 + r288 + r287 + r286 + r285 + r284 + r283 + r282 + r281 + r280 + r279 + r278 + r277 + r276 + r275 + r274 + r273 + r272 + r271 + r270 + r269 + r268 + r267 + r266 + r265 + r264 + r263 + r262 + r261 + r260 + r259 + r258 + r257 + r256;
+    const gpa_float64 v33 = v31 + v32;
+    const gpa_float64 v34 = r383 + r382 + r381 + r380 + r379 + r378 + r377 + r376 + r375 + r374 + r373 + r372 + r371 + r370 + r369 + r368 + r367 + r366 + r365 + r364 + r363 + r362 + r361 + r360 + r359 + r358 + r357 + r356 + r355 + r354 + r353 + r352 + r351 + r350 + r349 + r348 + r347 + r346 + r345 + r344 + r343 + r342 + r341 + r340 + r339 + r338 + r337 + r336 + r335 + r334 + r333 + r332 + r331 + r330 + r329 + r328 + r327 + r326 + r325 + r324 + r323 + r322 + r321 + r320;
+    const gpa_float64 v35 = v33 + v34;
+    const gpa_float64 v36 = r447 + r446 + r445 + r444 + r443 + r442 + r441 + r440 + r439 + r438 + r437 + r436 + r435 + r434 + r433 + r432 + r431 + r430 + r429 + r428 + r427 + r426 + r425 + r424 + r423 + r422 + r421 + r420 + r419 + r418 + r417 + r416 + r415 + r414 + r413 + r412 + r411 + r410 + r409 + r408 + r407 + r406 + r405 + r404 + r403 + r402 + r401 + r400 + r399 + r398 + r397 + r396 + r395 + r394 + r393 + r392 + r391 + r390 + r389 + r388 + r387 + r386 + r385 + r384;
+    const gpa_float64 v37 = v35 + v36;
+    const gpa_float64 v38 = r511 + r510 + r509 + r508 + r507 + r506 + r505 + r504 + r503 + r502 + r501 + r500 + r499 + r498 + r497 + r496 + r495 + r494 + r493 + r492 + r491 + r490 + r489 + r488 + r487 + r486 + r485 + r484 + r483 + r482 + r481 + r480 + r479 + r478 + r477 + r476 + r475 + r474 + r473 + r472 + r471 + r470 + r469 + r468 + r467 + r466 + r465 + r464 + r463 + r462 + r461 + r460 + r459 + r458 + r457 + r456 + r455 + r454 + r453 + r452 + r451 + r450 + r449 + r448;
+    const gpa_float64 v39 = v37 + v38;
+    const gpa_float64 v40 = r575 + r574 + r573 + r572 + r571 + r570 + r569 + r568 + r567 + r566 + r565 + r564 + r563 + r562 + r561 + r560 + r559 + r558 + r557 + r556 + r555 + r554 + r553 + r552 + r551 + r550 + r549 + r548 + r547 + r546 + r545 + r544 + r543 + r542 + r541 + r540 + r539 + r538 + r537 + r536 + r535 + r534 + r533 + r532 + r531 + r530 + r529 + r528 + r527 + r526 + r525 + r524 + r523 + r522 + r521 + r520 + r519 + r518 + r517 + r516 + r515 + r514 + r513 + r512;
+    const gpa_float64 v41 = v39 + v40;
+    const gpa_float64 v42 = (v41 != 0.0) ? (v24 / v41) : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v42;
+}
+
+/// Computes the DepthStencilTestBusy counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16,16,/,(100),*
+static void ComputeDepthStencilTestBusy(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+
+    const gpa_float64 v0 = (r15 > r14) ? r15 : r14;
+    const gpa_float64 v1 = (v0 > r13) ? v0 : r13;
+    const gpa_float64 v2 = (v1 > r12) ? v1 : r12;
+    const gpa_float64 v3 = (v2 > r11) ? v2 : r11;
+    const gpa_float64 v4 = (v3 > r10) ? v3 : r10;
+    const gpa_float64 v5 = (v4 > r9) ? v4 : r9;
+    const gpa_float64 v6 = (v5 > r8) ? v5 : r8;
+    const gpa_float64 v7 = (v6 > r7) ? v6 : r7;
+    const gpa_float64 v8 = (v7 > r6) ? v7 : r6;
+    const gpa_float64 v9 = (v8 > r5) ? v8 : r5;
+    const gpa_float64 v10 = (v9 > r4) ? v9 : r4;
+    const gpa_float64 v11 = (v10 > r3) ? v10 : r3;
+    const gpa_float64 v12 = (v11 > r2) ? v11 : r2;
+    const gpa_float64 v13 = (v12 > r1) ? v12 : r1;
+    const gpa_float64 v14 = (v13 > r0) ? v13 : r0;
+    const gpa_float64 v15 = (r16 != 0.0) ? (v14 / r16) : 0.0;
+    const gpa_float64 v16 = v15 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v16;
+}
+
+/// Computes the DepthStencilTestBusyCount counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16
+static void ComputeDepthStencilTestBusyCount(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = (r15 > r14) ? r15 : r14;
+    const gpa_float64 v1 = (v0 > r13) ? v0 : r13;
+    const gpa_float64 v2 = (v1 > r12) ? v1 : r12;
+    const gpa_float64 v3 = (v2 > r11) ? v2 : r11;
+    const gpa_float64 v4 = (v3 > r10) ? v3 : r10;
+    const gpa_float64 v5 = (v4 > r9) ? v4 : r9;
+    const gpa_float64 v6 = (v5 > r8) ? v5 : r8;
+    const gpa_float64 v7 = (v6 > r7) ? v6 : r7;
+    const gpa_float64 v8 = (v7 > r6) ? v7 : r6;
+    const gpa_float64 v9 = (v8 > r5) ? v8 : r5;
+    const gpa_float64 v10 = (v9 > r4) ? v9 : r4;
+    const gpa_float64 v11 = (v10 > r3) ? v10 : r3;
+    const gpa_float64 v12 = (v11 > r2) ? v11 : r2;
+    const gpa_float64 v13 = (v12 > r1) ? v12 : r1;
+    const gpa_float64 v14 = (v13 > r0) ? v13 : r0;
+
+    *static_cast<gpa_float64*>(pResult) = v14;
+}
+
+/// Computes the HiZTilesAccepted counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,/,(100),*
+static void ComputeHiZTilesAccepted(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+
+    const gpa_float64 v0 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16;
+    const gpa_float64 v2 = (v1 != 0.0) ? (v0 / v1) : 0.0;
+    const gpa_float64 v3 = v2 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v3;
+}
+
+/// Computes the HiZTilesAcceptedCount counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16
+static void ComputeHiZTilesAcceptedCount(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the HiZTilesRejectedCount counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16
+static void ComputeHiZTilesRejectedCount(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the PreZTilesDetailCulled counter: 16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,/,(100),*
+static void ComputePreZTilesDetailCulled(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+
+    const gpa_float64 v0 = r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16;
+    const gpa_float64 v1 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v2 = (v1 != 0.0) ? (v0 / v1) : 0.0;
+    const gpa_float64 v3 = v2 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v3;
+}
+
+/// Computes the PreZTilesDetailCulledCount counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16
+static void ComputePreZTilesDetailCulledCount(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the PreZTilesDetailSurvivingCount counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16
+static void ComputePreZTilesDetailSurvivingCount(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the HiZQuadsCulled counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,-,(0),max,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,/,(100),*
+static void ComputeHiZQuadsCulled(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+
+    const gpa_float64 v0 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16;
+    const gpa_float64 v2 = v0 - v1;
+    const gpa_float64 v3 = (v2 > 0.0) ? v2 : 0.0;
+    const gpa_float64 v4 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v5 = (v4 != 0.0) ? (v3 / v4) : 0.0;
+    const gpa_float64 v6 = v5 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v6;
+}
+
+/// Computes the HiZQuadsCulledCount counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,-,(0),max
+static void ComputeHiZQuadsCulledCount(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+
+    const gpa_float64 v0 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16;
+    const gpa_float64 v2 = v0 - v1;
+    const gpa_float64 v3 = (v2 > 0.0) ? v2 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v3;
+}
+
+/// Computes the HiZQuadsAcceptedCount counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16
+static void ComputeHiZQuadsAcceptedCount(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the PreZQuadsCulled counter: 20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,sum16,16,17,18,19,sum4,-,(0),max,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,/,(100),*
+static void ComputePreZQuadsCulled(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+    const gpa_float64 r32 = static_cast<gpa_float64>(*results[32]);
+    const gpa_float64 r33 = static_cast<gpa_float64>(*results[33]);
+    const gpa_float64 r34 = static_cast<gpa_float64>(*results[34]);
+    const gpa_float64 r35 = static_cast<gpa_float64>(*results[35]);
+
+    const gpa_float64 v0 = r35 + r34 + r33 + r32 + r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20;
+    const gpa_float64 v1 = r19 + r18 + r17 + r16;
+    const gpa_float64 v2 = v0 - v1;
+    const gpa_float64 v3 = (v2 > 0.0) ? v2 : 0.0;
+    const gpa_float64 v4 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v5 = (v4 != 0.0) ? (v3 / v4) : 0.0;
+    const gpa_float64 v6 = v5 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v6;
+}
+
+/// Computes the PreZQuadsCulledCount counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,sum4,+
+static void ComputePreZQuadsCulledCount(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+
+    const gpa_float64 v0 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r19 + r18 + r17 + r16;
+    const gpa_float64 v2 = v0 + v1;
+
+    *static_cast<gpa_float64*>(pResult) = v2;
+}
+
+/// Computes the PreZQuadsSurvivingCount counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,-,(0),max
+static void ComputePreZQuadsSurvivingCount(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+
+    const gpa_float64 v0 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16;
+    const gpa_float64 v2 = v0 - v1;
+    const gpa_float64 v3 = (v2 > 0.0) ? v2 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v3;
+}
+
+/// Computes the PostZQuads counter: 0,1,2,3,sum4,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,sum16,/,(100),*
+static void ComputePostZQuads(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r19 + r18 + r17 + r16 + r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = (v1 != 0.0) ? (v0 / v1) : 0.0;
+    const gpa_float64 v3 = v2 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v3;
+}
+
+/// Computes the PostZQuadCount counter: 0,1,2,3,sum4
+static void ComputePostZQuadCount(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the PreZSamplesPassing counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16
+static void ComputePreZSamplesPassing(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the PreZSamplesFailingS counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16
+static void ComputePreZSamplesFailingS(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the PreZSamplesFailingZ counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16
+static void ComputePreZSamplesFailingZ(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the PostZSamplesPassing counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16
+static void ComputePostZSamplesPassing(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the PostZSamplesFailingS counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16
+static void ComputePostZSamplesFailingS(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the PostZSamplesFailingZ counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16
+static void ComputePostZSamplesFailingZ(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the ZUnitStalled counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16,16,/,(100),*
+static void ComputeZUnitStalled(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+
+    const gpa_float64 v0 = (r15 > r14) ? r15 : r14;
+    const gpa_float64 v1 = (v0 > r13) ? v0 : r13;
+    const gpa_float64 v2 = (v1 > r12) ? v1 : r12;
+    const gpa_float64 v3 = (v2 > r11) ? v2 : r11;
+    const gpa_float64 v4 = (v3 > r10) ? v3 : r10;
+    const gpa_float64 v5 = (v4 > r9) ? v4 : r9;
+    const gpa_float64 v6 = (v5 > r8) ? v5 : r8;
+    const gpa_float64 v7 = (v6 > r7) ? v6 : r7;
+    const gpa_float64 v8 = (v7 > r6) ? v7 : r6;
+    const gpa_float64 v9 = (v8 > r5) ? v8 : r5;
+    const gpa_float64 v10 = (v9 > r4) ? v9 : r4;
+    const gpa_float64 v11 = (v10 > r3) ? v10 : r3;
+    const gpa_float64 v12 = (v11 > r2) ? v11 : r2;
+    const gpa_float64 v13 = (v12 > r1) ? v12 : r1;
+    const gpa_float64 v14 = (v13 > r0) ? v13 : r0;
+    const gpa_float64 v15 = (r16 != 0.0) ? (v14 / r16) : 0.0;
+    const gpa_float64 v16 = v15 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v16;
+}
+
+/// Computes the ZUnitStalledCycles counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16
+static void ComputeZUnitStalledCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = (r15 > r14) ? r15 : r14;
+    const gpa_float64 v1 = (v0 > r13) ? v0 : r13;
+    const gpa_float64 v2 = (v1 > r12) ? v1 : r12;
+    const gpa_float64 v3 = (v2 > r11) ? v2 : r11;
+    const gpa_float64 v4 = (v3 > r10) ? v3 : r10;
+    const gpa_float64 v5 = (v4 > r9) ? v4 : r9;
+    const gpa_float64 v6 = (v5 > r8) ? v5 : r8;
+    const gpa_float64 v7 = (v6 > r7) ? v6 : r7;
+    const gpa_float64 v8 = (v7 > r6) ? v7 : r6;
+    const gpa_float64 v9 = (v8 > r5) ? v8 : r5;
+    const gpa_float64 v10 = (v9 > r4) ? v9 : r4;
+    const gpa_float64 v11 = (v10 > r3) ? v10 : r3;
+    const gpa_float64 v12 = (v11 > r2) ? v11 : r2;
+    const gpa_float64 v13 = (v12 > r1) ? v12 : r1;
+    const gpa_float64 v14 = (v13 > r0) ? v13 : r0;
+
+    *static_cast<gpa_float64*>(pResult) = v14;
+}
+
+/// Computes the DBMemRead counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,(256),*,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,(32),*,+
+static void ComputeDBMemRead(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+
+    const gpa_float64 v0 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = v0 * 256.0;
+    const gpa_float64 v2 = r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16;
+    const gpa_float64 v3 = v2 * 32.0;
+    const gpa_float64 v4 = v1 + v3;
+
+    *static_cast<gpa_float64*>(pResult) = v4;
+}
+
+/// Computes the DBMemWritten counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,(32),*,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,(32),*,+
+static void ComputeDBMemWritten(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+
+    const gpa_float64 v0 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = v0 * 32.0;
+    const gpa_float64 v2 = r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16;
+    const gpa_float64 v3 = v2 * 32.0;
+    const gpa_float64 v4 = v1 + v3;
+
+    *static_cast<gpa_float64*>(pResult) = v4;
+}
+
+/// Computes the CBMemRead counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,(32),*
+static void ComputeCBMemRead(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = v0 * 32.0;
+
+    *static_cast<gpa_float64*>(pResult) = v1;
+}
+
+/// Computes the CBColorAndMaskRead counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,(32),*
+static void ComputeCBColorAndMaskRead(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+    const gpa_float64 r32 = static_cast<gpa_float64>(*results[32]);
+    const gpa_float64 r33 = static_cast<gpa_float64>(*results[33]);
+    const gpa_float64 r34 = static_cast<gpa_float64>(*results[34]);
+    const gpa_float64 r35 = static_cast<gpa_float64>(*results[35]);
+    const gpa_float64 r36 = static_cast<gpa_float64>(*results[36]);
+    const gpa_float64 r37 = static_cast<gpa_float64>(*results[37]);
+    const gpa_float64 r38 = static_cast<gpa_float64>(*results[38]);
+    const gpa_float64 r39 = static_cast<gpa_float64>(*results[39]);
+    const gpa_float64 r40 = static_cast<gpa_float64>(*results[40]);
+    const gpa_float64 r41 = static_cast<gpa_float64>(*results[41]);
+    const gpa_float64 r42 = static_cast<gpa_float64>(*results[42]);
+    const gpa_float64 r43 = static_cast<gpa_float64>(*results[43]);
+    const gpa_float64 r44 = static_cast<gpa_float64>(*results[44]);
+    const gpa_float64 r45 = static_cast<gpa_float64>(*results[45]);
+    const gpa_float64 r46 = static_cast<gpa_float64>(*results[46]);
+    const gpa_float64 r47 = static_cast<gpa_float64>(*results[47]);
+    const gpa_float64 r48 = static_cast<gpa_float64>(*results[48]);
+    const gpa_float64 r49 = static_cast<gpa_float64>(*results[49]);
+    const gpa_float64 r50 = static_cast<gpa_float64>(*results[50]);
+    const gpa_float64 r51 = static_cast<gpa_float64>(*results[51]);
+    const gpa_float64 r52 = static_cast<gpa_float64>(*results[52]);
+    const gpa_float64 r53 = static_cast<gpa_float64>(*results[53]);
+    const gpa_float64 r54 = static_cast<gpa_float64>(*results[54]);
+    const gpa_float64 r55 = static_cast<gpa_float64>(*results[55]);
+    const gpa_float64 r56 = static_cast<gpa_float64>(*results[56]);
+    const gpa_float64 r57 = static_cast<gpa_float64>(*results[57]);
+    const gpa_float64 r58 = static_cast<gpa_float64>(*results[58]);
+    const gpa_float64 r59 = static_cast<gpa_float64>(*results[59]);
+    const gpa_float64 r60 = static_cast<gpa_float64>(*results[60]);
+    const gpa_float64 r61 = static_cast<gpa_float64>(*results[61]);
+    const gpa_float64 r62 = static_cast<gpa_float64>(*results[62]);
+    const gpa_float64 r63 = static_cast<gpa_float64>(*results[63]);
+
+    const gpa_float64 v0 = r63 + r62 + r61 + r60 + r59 + r58 + r57 + r56 + r55 + r54 + r53 + r52 + r51 + r50 + r49 + r48 + r47 + r46 + r45 + r44 + r43 + r42 + r41 + r40 + r39 + r38 + r37 + r36 + r35 + r34 + r33 + r32 + r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16 + r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = v0 * 32.0;
+
+    *static_cast<gpa_float64*>(pResult) = v1;
+}
+
+/// Computes the CBMemWritten counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,(32),*
+static void ComputeCBMemWritten(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = v0 * 32.0;
+
+    *static_cast<gpa_float64*>(pResult) = v1;
+}
+
+/// Computes the CBColorAndMaskWritten counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,(32),*
+static void ComputeCBColorAndMaskWritten(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+    const gpa_float64 r32 = static_cast<gpa_float64>(*results[32]);
+    const gpa_float64 r33 = static_cast<gpa_float64>(*results[33]);
+    const gpa_float64 r34 = static_cast<gpa_float64>(*results[34]);
+    const gpa_float64 r35 = static_cast<gpa_float64>(*results[35]);
+    const gpa_float64 r36 = static_cast<gpa_float64>(*results[36]);
+    const gpa_float64 r37 = static_cast<gpa_float64>(*results[37]);
+    const gpa_float64 r38 = static_cast<gpa_float64>(*results[38]);
+    const gpa_float64 r39 = static_cast<gpa_float64>(*results[39]);
+    const gpa_float64 r40 = static_cast<gpa_float64>(*results[40]);
+    const gpa_float64 r41 = static_cast<gpa_float64>(*results[41]);
+    const gpa_float64 r42 = static_cast<gpa_float64>(*results[42]);
+    const gpa_float64 r43 = static_cast<gpa_float64>(*results[43]);
+    const gpa_float64 r44 = static_cast<gpa_float64>(*results[44]);
+    const gpa_float64 r45 = static_cast<gpa_float64>(*results[45]);
+    const gpa_float64 r46 = static_cast<gpa_float64>(*results[46]);
+    const gpa_float64 r47 = static_cast<gpa_float64>(*results[47]);
+    const gpa_float64 r48 = static_cast<gpa_float64>(*results[48]);
+    const gpa_float64 r49 = static_cast<gpa_float64>(*results[49]);
+    const gpa_float64 r50 = static_cast<gpa_float64>(*results[50]);
+    const gpa_float64 r51 = static_cast<gpa_float64>(*results[51]);
+    const gpa_float64 r52 = static_cast<gpa_float64>(*results[52]);
+    const gpa_float64 r53 = static_cast<gpa_float64>(*results[53]);
+    const gpa_float64 r54 = static_cast<gpa_float64>(*results[54]);
+    const gpa_float64 r55 = static_cast<gpa_float64>(*results[55]);
+    const gpa_float64 r56 = static_cast<gpa_float64>(*results[56]);
+    const gpa_float64 r57 = static_cast<gpa_float64>(*results[57]);
+    const gpa_float64 r58 = static_cast<gpa_float64>(*results[58]);
+    const gpa_float64 r59 = static_cast<gpa_float64>(*results[59]);
+    const gpa_float64 r60 = static_cast<gpa_float64>(*results[60]);
+    const gpa_float64 r61 = static_cast<gpa_float64>(*results[61]);
+    const gpa_float64 r62 = static_cast<gpa_float64>(*results[62]);
+    const gpa_float64 r63 = static_cast<gpa_float64>(*results[63]);
+
+    const gpa_float64 v0 = r63 + r62 + r61 + r60 + r59 + r58 + r57 + r56 + r55 + r54 + r53 + r52 + r51 + r50 + r49 + r48 + r47 + r46 + r45 + r44 + r43 + r42 + r41 + r40 + r39 + r38 + r37 + r36 + r35 + r34 + r33 + r32 + r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16 + r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = v0 * 32.0;
+
+    *static_cast<gpa_float64*>(pResult) = v1;
+}
+
+/// Computes the CBSlowPixelPct counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,/,(100),*,(100),min
+static void ComputeCBSlowPixelPct(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+
+    const gpa_float64 v0 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16;
+    const gpa_float64 v2 = (v1 != 0.0) ? (v0 / v1) : 0.0;
+    const gpa_float64 v3 = v2 * 100.0;
+    const gpa_float64 v4 = (v3 < 100.0) ? v3 : 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v4;
+}
+
+/// Computes the CBSlowPixelCount counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16
+static void ComputeCBSlowPixelCount(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the FetchSize counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,(32),*
+static void ComputeFetchSize(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = v0 * 32.0;
+
+    *static_cast<gpa_float64*>(pResult) = v1;
+}
+
+/// Computes the WriteSize counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,(32),*
+static void ComputeWriteSize(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = v0 * 32.0;
+
+    *static_cast<gpa_float64*>(pResult) = v1;
+}
+
+/// Computes the CacheHit counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,+,/,(100),*
+static void ComputeCacheHit(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+
+    const gpa_float64 v0 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v2 = r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16;
+    const gpa_float64 v3 = v1 + v2;
+    const gpa_float64 v4 = (v3 != 0.0) ? (v0 / v3) : 0.0;
+    const gpa_float64 v5 = v4 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v5;
+}
+
+/// Computes the CacheMiss counter: 16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,+,/,(100),*
+static void ComputeCacheMiss(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+
+    const gpa_float64 v0 = r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16;
+    const gpa_float64 v1 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+    const gpa_float64 v2 = r31 + r30 + r29 + r28 + r27 + r26 + r25 + r24 + r23 + r22 + r21 + r20 + r19 + r18 + r17 + r16;
+    const gpa_float64 v3 = v1 + v2;
+    const gpa_float64 v4 = (v3 != 0.0) ? (v0 / v3) : 0.0;
+    const gpa_float64 v5 = v4 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v5;
+}
+
+/// Computes the CacheHitCount counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16
+static void ComputeCacheHitCount(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the CacheMissCount counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16
+static void ComputeCacheMissCount(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = r15 + r14 + r13 + r12 + r11 + r10 + r9 + r8 + r7 + r6 + r5 + r4 + r3 + r2 + r1 + r0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the MemUnitBusy counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64,64,/,(100),*
+static void ComputeMemUnitBusy(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+    const gpa_float64 r32 = static_cast<gpa_float64>(*results[32]);
+    const gpa_float64 r33 = static_cast<gpa_float64>(*results[33]);
+    const gpa_float64 r34 = static_cast<gpa_float64>(*results[34]);
+    const gpa_float64 r35 = static_cast<gpa_float64>(*results[35]);
+    const gpa_float64 r36 = static_cast<gpa_float64>(*results[36]);
+    const gpa_float64 r37 = static_cast<gpa_float64>(*results[37]);
+    const gpa_float64 r38 = static_cast<gpa_float64>(*results[38]);
+    const gpa_float64 r39 = static_cast<gpa_float64>(*results[39]);
+    const gpa_float64 r40 = static_cast<gpa_float64>(*results[40]);
+    const gpa_float64 r41 = static_cast<gpa_float64>(*results[41]);
+    const gpa_float64 r42 = static_cast<gpa_float64>(*results[42]);
+    const gpa_float64 r43 = static_cast<gpa_float64>(*results[43]);
+    const gpa_float64 r44 = static_cast<gpa_float64>(*results[44]);
+    const gpa_float64 r45 = static_cast<gpa_float64>(*results[45]);
+    const gpa_float64 r46 = static_cast<gpa_float64>(*results[46]);
+    const gpa_float64 r47 = static_cast<gpa_float64>(*results[47]);
+    const gpa_float64 r48 = static_cast<gpa_float64>(*results[48]);
+    const gpa_float64 r49 = static_cast<gpa_float64>(*results[49]);
+    const gpa_float64 r50 = static_cast<gpa_float64>(*results[50]);
+    const gpa_float64 r51 = static_cast<gpa_float64>(*results[51]);
+    const gpa_float64 r52 = static_cast<gpa_float64>(*results[52]);
+    const gpa_float64 r53 = static_cast<gpa_float64>(*results[53]);
+    const gpa_float64 r54 = static_cast<gpa_float64>(*results[54]);
+    const gpa_float64 r55 = static_cast<gpa_float64>(*results[55]);
+    const gpa_float64 r56 = static_cast<gpa_float64>(*results[56]);
+    const gpa_float64 r57 = static_cast<gpa_float64>(*results[57]);
+    const gpa_float64 r58 = static_cast<gpa_float64>(*results[58]);
+    const gpa_float64 r59 = static_cast<gpa_float64>(*results[59]);
+    const gpa_float64 r60 = static_cast<gpa_float64>(*results[60]);
+    const gpa_float64 r61 = static_cast<gpa_float64>(*results[61]);
+    const gpa_float64 r62 = static_cast<gpa_float64>(*results[62]);
+    const gpa_float64 r63 = static_cast<gpa_float64>(*results[63]);
+    const gpa_float64 r64 = static_cast<gpa_float64>(*results[64]);
+
+    const gpa_float64 v0 = (r63 > r62) ? r63 : r62;
+    const gpa_float64 v1 = (v0 > r61) ? v0 : r61;
+    const gpa_float64 v2 = (v1 > r60) ? v1 : r60;
+    const gpa_float64 v3 = (v2 > r59) ? v2 : r59;
+    const gpa_float64 v4 = (v3 > r58) ? v3 : r58;
+    const gpa_float64 v5 = (v4 > r57) ? v4 : r57;
+    const gpa_float64 v6 = (v5 > r56) ? v5 : r56;
+    const gpa_float64 v7 = (v6 > r55) ? v6 : r55;
+    const gpa_float64 v8 = (v7 > r54) ? v7 : r54;
+    const gpa_float64 v9 = (v8 > r53) ? v8 : r53;
+    const gpa_float64 v10 = (v9 > r52) ? v9 : r52;
+    const gpa_float64 v11 = (v10 > r51) ? v10 : r51;
+    const gpa_float64 v12 = (v11 > r50) ? v11 : r50;
+    const gpa_float64 v13 = (v12 > r49) ? v12 : r49;
+    const gpa_float64 v14 = (v13 > r48) ? v13 : r48;
+    const gpa_float64 v15 = (v14 > r47) ? v14 : r47;
+    const gpa_float64 v16 = (v15 > r46) ? v15 : r46;
+    const gpa_float64 v17 = (v16 > r45) ? v16 : r45;
+    const gpa_float64 v18 = (v17 > r44) ? v17 : r44;
+    const gpa_float64 v19 = (v18 > r43) ? v18 : r43;
+    const gpa_float64 v20 = (v19 > r42) ? v19 : r42;
+    const gpa_float64 v21 = (v20 > r41) ? v20 : r41;
+    const gpa_float64 v22 = (v21 > r40) ? v21 : r40;
+    const gpa_float64 v23 = (v22 > r39) ? v22 : r39;
+    const gpa_float64 v24 = (v23 > r38) ? v23 : r38;
+    const gpa_float64 v25 = (v24 > r37) ? v24 : r37;
+    const gpa_float64 v26 = (v25 > r36) ? v25 : r36;
+    const gpa_float64 v27 = (v26 > r35) ? v26 : r35;
+    const gpa_float64 v28 = (v27 > r34) ? v27 : r34;
+    const gpa_float64 v29 = (v28 > r33) ? v28 : r33;
+    const gpa_float64 v30 = (v29 > r32) ? v29 : r32;
+    const gpa_float64 v31 = (v30 > r31) ? v30 : r31;
+    const gpa_float64 v32 = (v31 > r30) ? v31 : r30;
+    const gpa_float64 v33 = (v32 > r29) ? v32 : r29;
+    const gpa_float64 v34 = (v33 > r28) ? v33 : r28;
+    const gpa_float64 v35 = (v34 > r27) ? v34 : r27;
+    const gpa_float64 v36 = (v35 > r26) ? v35 : r26;
+    const gpa_float64 v37 = (v36 > r25) ? v36 : r25;
+    const gpa_float64 v38 = (v37 > r24) ? v37 : r24;
+    const gpa_float64 v39 = (v38 > r23) ? v38 : r23;
+    const gpa_float64 v40 = (v39 > r22) ? v39 : r22;
+    const gpa_float64 v41 = (v40 > r21) ? v40 : r21;
+    const gpa_float64 v42 = (v41 > r20) ? v41 : r20;
+    const gpa_float64 v43 = (v42 > r19) ? v42 : r19;
+    const gpa_float64 v44 = (v43 > r18) ? v43 : r18;
+    const gpa_float64 v45 = (v44 > r17) ? v44 : r17;
+    const gpa_float64 v46 = (v45 > r16) ? v45 : r16;
+    const gpa_float64 v47 = (v46 > r15) ? v46 : r15;
+    const gpa_float64 v48 = (v47 > r14) ? v47 : r14;
+    const gpa_float64 v49 = (v48 > r13) ? v48 : r13;
+    const gpa_float64 v50 = (v49 > r12) ? v49 : r12;
+    const gpa_float64 v51 = (v50 > r11) ? v50 : r11;
+    const gpa_float64 v52 = (v51 > r10) ? v51 : r10;
+    const gpa_float64 v53 = (v52 > r9) ? v52 : r9;
+    const gpa_float64 v54 = (v53 > r8) ? v53 : r8;
+    const gpa_float64 v55 = (v54 > r7) ? v54 : r7;
+    const gpa_float64 v56 = (v55 > r6) ? v55 : r6;
+    const gpa_float64 v57 = (v56 > r5) ? v56 : r5;
+    const gpa_float64 v58 = (v57 > r4) ? v57 : r4;
+    const gpa_float64 v59 = (v58 > r3) ? v58 : r3;
+    const gpa_float64 v60 = (v59 > r2) ? v59 : r2;
+    const gpa_float64 v61 = (v60 > r1) ? v60 : r1;
+    const gpa_float64 v62 = (v61 > r0) ? v61 : r0;
+    const gpa_float64 v63 = (r64 != 0.0) ? (v62 / r64) : 0.0;
+    const gpa_float64 v64 = v63 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v64;
+}
+
+/// Computes the MemUnitBusyCycles counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64
+static void ComputeMemUnitBusyCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+    const gpa_float64 r32 = static_cast<gpa_float64>(*results[32]);
+    const gpa_float64 r33 = static_cast<gpa_float64>(*results[33]);
+    const gpa_float64 r34 = static_cast<gpa_float64>(*results[34]);
+    const gpa_float64 r35 = static_cast<gpa_float64>(*results[35]);
+    const gpa_float64 r36 = static_cast<gpa_float64>(*results[36]);
+    const gpa_float64 r37 = static_cast<gpa_float64>(*results[37]);
+    const gpa_float64 r38 = static_cast<gpa_float64>(*results[38]);
+    const gpa_float64 r39 = static_cast<gpa_float64>(*results[39]);
+    const gpa_float64 r40 = static_cast<gpa_float64>(*results[40]);
+    const gpa_float64 r41 = static_cast<gpa_float64>(*results[41]);
+    const gpa_float64 r42 = static_cast<gpa_float64>(*results[42]);
+    const gpa_float64 r43 = static_cast<gpa_float64>(*results[43]);
+    const gpa_float64 r44 = static_cast<gpa_float64>(*results[44]);
+    const gpa_float64 r45 = static_cast<gpa_float64>(*results[45]);
+    const gpa_float64 r46 = static_cast<gpa_float64>(*results[46]);
+    const gpa_float64 r47 = static_cast<gpa_float64>(*results[47]);
+    const gpa_float64 r48 = static_cast<gpa_float64>(*results[48]);
+    const gpa_float64 r49 = static_cast<gpa_float64>(*results[49]);
+    const gpa_float64 r50 = static_cast<gpa_float64>(*results[50]);
+    const gpa_float64 r51 = static_cast<gpa_float64>(*results[51]);
+    const gpa_float64 r52 = static_cast<gpa_float64>(*results[52]);
+    const gpa_float64 r53 = static_cast<gpa_float64>(*results[53]);
+    const gpa_float64 r54 = static_cast<gpa_float64>(*results[54]);
+    const gpa_float64 r55 = static_cast<gpa_float64>(*results[55]);
+    const gpa_float64 r56 = static_cast<gpa_float64>(*results[56]);
+    const gpa_float64 r57 = static_cast<gpa_float64>(*results[57]);
+    const gpa_float64 r58 = static_cast<gpa_float64>(*results[58]);
+    const gpa_float64 r59 = static_cast<gpa_float64>(*results[59]);
+    const gpa_float64 r60 = static_cast<gpa_float64>(*results[60]);
+    const gpa_float64 r61 = static_cast<gpa_float64>(*results[61]);
+    const gpa_float64 r62 = static_cast<gpa_float64>(*results[62]);
+    const gpa_float64 r63 = static_cast<gpa_float64>(*results[63]);
+
+    const gpa_float64 v0 = (r63 > r62) ? r63 : r62;
+    const gpa_float64 v1 = (v0 > r61) ? v0 : r61;
+    const gpa_float64 v2 = (v1 > r60) ? v1 : r60;
+    const gpa_float64 v3 = (v2 > r59) ? v2 : r59;
+    const gpa_float64 v4 = (v3 > r58) ? v3 : r58;
+    const gpa_float64 v5 = (v4 > r57) ? v4 : r57;
+    const gpa_float64 v6 = (v5 > r56) ? v5 : r56;
+    const gpa_float64 v7 = (v6 > r55) ? v6 : r55;
+    const gpa_float64 v8 = (v7 > r54) ? v7 : r54;
+    const gpa_float64 v9 = (v8 > r53) ? v8 : r53;
+    const gpa_float64 v10 = (v9 > r52) ? v9 : r52;
+    const gpa_float64 v11 = (v10 > r51) ? v10 : r51;
+    const gpa_float64 v12 = (v11 > r50) ? v11 : r50;
+    const gpa_float64 v13 = (v12 > r49) ? v12 : r49;
+    const gpa_float64 v14 = (v13 > r48) ? v13 : r48;
+    const gpa_float64 v15 = (v14 > r47) ? v14 : r47;
+    const gpa_float64 v16 = (v15 > r46) ? v15 : r46;
+    const gpa_float64 v17 = (v16 > r45) ? v16 : r45;
+    const gpa_float64 v18 = (v17 > r44) ? v17 : r44;
+    const gpa_float64 v19 = (v18 > r43) ? v18 : r43;
+    const gpa_float64 v20 = (v19 > r42) ? v19 : r42;
+    const gpa_float64 v21 = (v20 > r41) ? v20 : r41;
+    const gpa_float64 v22 = (v21 > r40) ? v21 : r40;
+    const gpa_float64 v23 = (v22 > r39) ? v22 : r39;
+    const gpa_float64 v24 = (v23 > r38) ? v23 : r38;
+    const gpa_float64 v25 = (v24 > r37) ? v24 : r37;
+    const gpa_float64 v26 = (v25 > r36) ? v25 : r36;
+    const gpa_float64 v27 = (v26 > r35) ? v26 : r35;
+    const gpa_float64 v28 = (v27 > r34) ? v27 : r34;
+    const gpa_float64 v29 = (v28 > r33) ? v28 : r33;
+    const gpa_float64 v30 = (v29 > r32) ? v29 : r32;
+    const gpa_float64 v31 = (v30 > r31) ? v30 : r31;
+    const gpa_float64 v32 = (v31 > r30) ? v31 : r30;
+    const gpa_float64 v33 = (v32 > r29) ? v32 : r29;
+    const gpa_float64 v34 = (v33 > r28) ? v33 : r28;
+    const gpa_float64 v35 = (v34 > r27) ? v34 : r27;
+    const gpa_float64 v36 = (v35 > r26) ? v35 : r26;
+    const gpa_float64 v37 = (v36 > r25) ? v36 : r25;
+    const gpa_float64 v38 = (v37 > r24) ? v37 : r24;
+    const gpa_float64 v39 = (v38 > r23) ? v38 : r23;
+    const gpa_float64 v40 = (v39 > r22) ? v39 : r22;
+    const gpa_float64 v41 = (v40 > r21) ? v40 : r21;
+    const gpa_float64 v42 = (v41 > r20) ? v41 : r20;
+    const gpa_float64 v43 = (v42 > r19) ? v42 : r19;
+    const gpa_float64 v44 = (v43 > r18) ? v43 : r18;
+    const gpa_float64 v45 = (v44 > r17) ? v44 : r17;
+    const gpa_float64 v46 = (v45 > r16) ? v45 : r16;
+    const gpa_float64 v47 = (v46 > r15) ? v46 : r15;
+    const gpa_float64 v48 = (v47 > r14) ? v47 : r14;
+    const gpa_float64 v49 = (v48 > r13) ? v48 : r13;
+    const gpa_float64 v50 = (v49 > r12) ? v49 : r12;
+    const gpa_float64 v51 = (v50 > r11) ? v50 : r11;
+    const gpa_float64 v52 = (v51 > r10) ? v51 : r10;
+    const gpa_float64 v53 = (v52 > r9) ? v52 : r9;
+    const gpa_float64 v54 = (v53 > r8) ? v53 : r8;
+    const gpa_float64 v55 = (v54 > r7) ? v54 : r7;
+    const gpa_float64 v56 = (v55 > r6) ? v55 : r6;
+    const gpa_float64 v57 = (v56 > r5) ? v56 : r5;
+    const gpa_float64 v58 = (v57 > r4) ? v57 : r4;
+    const gpa_float64 v59 = (v58 > r3) ? v58 : r3;
+    const gpa_float64 v60 = (v59 > r2) ? v59 : r2;
+    const gpa_float64 v61 = (v60 > r1) ? v60 : r1;
+    const gpa_float64 v62 = (v61 > r0) ? v61 : r0;
+
+    *static_cast<gpa_float64*>(pResult) = v62;
+}
+
+/// Computes the MemUnitStalled counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64,64,/,(100),*
+static void ComputeMemUnitStalled(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+    const gpa_float64 r32 = static_cast<gpa_float64>(*results[32]);
+    const gpa_float64 r33 = static_cast<gpa_float64>(*results[33]);
+    const gpa_float64 r34 = static_cast<gpa_float64>(*results[34]);
+    const gpa_float64 r35 = static_cast<gpa_float64>(*results[35]);
+    const gpa_float64 r36 = static_cast<gpa_float64>(*results[36]);
+    const gpa_float64 r37 = static_cast<gpa_float64>(*results[37]);
+    const gpa_float64 r38 = static_cast<gpa_float64>(*results[38]);
+    const gpa_float64 r39 = static_cast<gpa_float64>(*results[39]);
+    const gpa_float64 r40 = static_cast<gpa_float64>(*results[40]);
+    const gpa_float64 r41 = static_cast<gpa_float64>(*results[41]);
+    const gpa_float64 r42 = static_cast<gpa_float64>(*results[42]);
+    const gpa_float64 r43 = static_cast<gpa_float64>(*results[43]);
+    const gpa_float64 r44 = static_cast<gpa_float64>(*results[44]);
+    const gpa_float64 r45 = static_cast<gpa_float64>(*results[45]);
+    const gpa_float64 r46 = static_cast<gpa_float64>(*results[46]);
+    const gpa_float64 r47 = static_cast<gpa_float64>(*results[47]);
+    const gpa_float64 r48 = static_cast<gpa_float64>(*results[48]);
+    const gpa_float64 r49 = static_cast<gpa_float64>(*results[49]);
+    const gpa_float64 r50 = static_cast<gpa_float64>(*results[50]);
+    const gpa_float64 r51 = static_cast<gpa_float64>(*results[51]);
+    const gpa_float64 r52 = static_cast<gpa_float64>(*results[52]);
+    const gpa_float64 r53 = static_cast<gpa_float64>(*results[53]);
+    const gpa_float64 r54 = static_cast<gpa_float64>(*results[54]);
+    const gpa_float64 r55 = static_cast<gpa_float64>(*results[55]);
+    const gpa_float64 r56 = static_cast<gpa_float64>(*results[56]);
+    const gpa_float64 r57 = static_cast<gpa_float64>(*results[57]);
+    const gpa_float64 r58 = static_cast<gpa_float64>(*results[58]);
+    const gpa_float64 r59 = static_cast<gpa_float64>(*results[59]);
+    const gpa_float64 r60 = static_cast<gpa_float64>(*results[60]);
+    const gpa_float64 r61 = static_cast<gpa_float64>(*results[61]);
+    const gpa_float64 r62 = static_cast<gpa_float64>(*results[62]);
+    const gpa_float64 r63 = static_cast<gpa_float64>(*results[63]);
+    const gpa_float64 r64 = static_cast<gpa_float64>(*results[64]);
+
+    const gpa_float64 v0 = (r63 > r62) ? r63 : r62;
+    const gpa_float64 v1 = (v0 > r61) ? v0 : r61;
+    const gpa_float64 v2 = (v1 > r60) ? v1 : r60;
+    const gpa_float64 v3 = (v2 > r59) ? v2 : r59;
+    const gpa_float64 v4 = (v3 > r58) ? v3 : r58;
+    const gpa_float64 v5 = (v4 > r57) ? v4 : r57;
+    const gpa_float64 v6 = (v5 > r56) ? v5 : r56;
+    const gpa_float64 v7 = (v6 > r55) ? v6 : r55;
+    const gpa_float64 v8 = (v7 > r54) ? v7 : r54;
+    const gpa_float64 v9 = (v8 > r53) ? v8 : r53;
+    const gpa_float64 v10 = (v9 > r52) ? v9 : r52;
+    const gpa_float64 v11 = (v10 > r51) ? v10 : r51;
+    const gpa_float64 v12 = (v11 > r50) ? v11 : r50;
+    const gpa_float64 v13 = (v12 > r49) ? v12 : r49;
+    const gpa_float64 v14 = (v13 > r48) ? v13 : r48;
+    const gpa_float64 v15 = (v14 > r47) ? v14 : r47;
+    const gpa_float64 v16 = (v15 > r46) ? v15 : r46;
+    const gpa_float64 v17 = (v16 > r45) ? v16 : r45;
+    const gpa_float64 v18 = (v17 > r44) ? v17 : r44;
+    const gpa_float64 v19 = (v18 > r43) ? v18 : r43;
+    const gpa_float64 v20 = (v19 > r42) ? v19 : r42;
+    const gpa_float64 v21 = (v20 > r41) ? v20 : r41;
+    const gpa_float64 v22 = (v21 > r40) ? v21 : r40;
+    const gpa_float64 v23 = (v22 > r39) ? v22 : r39;
+    const gpa_float64 v24 = (v23 > r38) ? v23 : r38;
+    const gpa_float64 v25 = (v24 > r37) ? v24 : r37;
+    const gpa_float64 v26 = (v25 > r36) ? v25 : r36;
+    const gpa_float64 v27 = (v26 > r35) ? v26 : r35;
+    const gpa_float64 v28 = (v27 > r34) ? v27 : r34;
+    const gpa_float64 v29 = (v28 > r33) ? v28 : r33;
+    const gpa_float64 v30 = (v29 > r32) ? v29 : r32;
+    const gpa_float64 v31 = (v30 > r31) ? v30 : r31;
+    const gpa_float64 v32 = (v31 > r30) ? v31 : r30;
+    const gpa_float64 v33 = (v32 > r29) ? v32 : r29;
+    const gpa_float64 v34 = (v33 > r28) ? v33 : r28;
+    const gpa_float64 v35 = (v34 > r27) ? v34 : r27;
+    const gpa_float64 v36 = (v35 > r26) ? v35 : r26;
+    const gpa_float64 v37 = (v36 > r25) ? v36 : r25;
+    const gpa_float64 v38 = (v37 > r24) ? v37 : r24;
+    const gpa_float64 v39 = (v38 > r23) ? v38 : r23;
+    const gpa_float64 v40 = (v39 > r22) ? v39 : r22;
+    const gpa_float64 v41 = (v40 > r21) ? v40 : r21;
+    const gpa_float64 v42 = (v41 > r20) ? v41 : r20;
+    const gpa_float64 v43 = (v42 > r19) ? v42 : r19;
+    const gpa_float64 v44 = (v43 > r18) ? v43 : r18;
+    const gpa_float64 v45 = (v44 > r17) ? v44 : r17;
+    const gpa_float64 v46 = (v45 > r16) ? v45 : r16;
+    const gpa_float64 v47 = (v46 > r15) ? v46 : r15;
+    const gpa_float64 v48 = (v47 > r14) ? v47 : r14;
+    const gpa_float64 v49 = (v48 > r13) ? v48 : r13;
+    const gpa_float64 v50 = (v49 > r12) ? v49 : r12;
+    const gpa_float64 v51 = (v50 > r11) ? v50 : r11;
+    const gpa_float64 v52 = (v51 > r10) ? v51 : r10;
+    const gpa_float64 v53 = (v52 > r9) ? v52 : r9;
+    const gpa_float64 v54 = (v53 > r8) ? v53 : r8;
+    const gpa_float64 v55 = (v54 > r7) ? v54 : r7;
+    const gpa_float64 v56 = (v55 > r6) ? v55 : r6;
+    const gpa_float64 v57 = (v56 > r5) ? v56 : r5;
+    const gpa_float64 v58 = (v57 > r4) ? v57 : r4;
+    const gpa_float64 v59 = (v58 > r3) ? v58 : r3;
+    const gpa_float64 v60 = (v59 > r2) ? v59 : r2;
+    const gpa_float64 v61 = (v60 > r1) ? v60 : r1;
+    const gpa_float64 v62 = (v61 > r0) ? v61 : r0;
+    const gpa_float64 v63 = (r64 != 0.0) ? (v62 / r64) : 0.0;
+    const gpa_float64 v64 = v63 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v64;
+}
+
+/// Computes the MemUnitStalledCycles counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64
+static void ComputeMemUnitStalledCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+    const gpa_float64 r17 = static_cast<gpa_float64>(*results[17]);
+    const gpa_float64 r18 = static_cast<gpa_float64>(*results[18]);
+    const gpa_float64 r19 = static_cast<gpa_float64>(*results[19]);
+    const gpa_float64 r20 = static_cast<gpa_float64>(*results[20]);
+    const gpa_float64 r21 = static_cast<gpa_float64>(*results[21]);
+    const gpa_float64 r22 = static_cast<gpa_float64>(*results[22]);
+    const gpa_float64 r23 = static_cast<gpa_float64>(*results[23]);
+    const gpa_float64 r24 = static_cast<gpa_float64>(*results[24]);
+    const gpa_float64 r25 = static_cast<gpa_float64>(*results[25]);
+    const gpa_float64 r26 = static_cast<gpa_float64>(*results[26]);
+    const gpa_float64 r27 = static_cast<gpa_float64>(*results[27]);
+    const gpa_float64 r28 = static_cast<gpa_float64>(*results[28]);
+    const gpa_float64 r29 = static_cast<gpa_float64>(*results[29]);
+    const gpa_float64 r30 = static_cast<gpa_float64>(*results[30]);
+    const gpa_float64 r31 = static_cast<gpa_float64>(*results[31]);
+    const gpa_float64 r32 = static_cast<gpa_float64>(*results[32]);
+    const gpa_float64 r33 = static_cast<gpa_float64>(*results[33]);
+    const gpa_float64 r34 = static_cast<gpa_float64>(*results[34]);
+    const gpa_float64 r35 = static_cast<gpa_float64>(*results[35]);
+    const gpa_float64 r36 = static_cast<gpa_float64>(*results[36]);
+    const gpa_float64 r37 = static_cast<gpa_float64>(*results[37]);
+    const gpa_float64 r38 = static_cast<gpa_float64>(*results[38]);
+    const gpa_float64 r39 = static_cast<gpa_float64>(*results[39]);
+    const gpa_float64 r40 = static_cast<gpa_float64>(*results[40]);
+    const gpa_float64 r41 = static_cast<gpa_float64>(*results[41]);
+    const gpa_float64 r42 = static_cast<gpa_float64>(*results[42]);
+    const gpa_float64 r43 = static_cast<gpa_float64>(*results[43]);
+    const gpa_float64 r44 = static_cast<gpa_float64>(*results[44]);
+    const gpa_float64 r45 = static_cast<gpa_float64>(*results[45]);
+    const gpa_float64 r46 = static_cast<gpa_float64>(*results[46]);
+    const gpa_float64 r47 = static_cast<gpa_float64>(*results[47]);
+    const gpa_float64 r48 = static_cast<gpa_float64>(*results[48]);
+    const gpa_float64 r49 = static_cast<gpa_float64>(*results[49]);
+    const gpa_float64 r50 = static_cast<gpa_float64>(*results[50]);
+    const gpa_float64 r51 = static_cast<gpa_float64>(*results[51]);
+    const gpa_float64 r52 = static_cast<gpa_float64>(*results[52]);
+    const gpa_float64 r53 = static_cast<gpa_float64>(*results[53]);
+    const gpa_float64 r54 = static_cast<gpa_float64>(*results[54]);
+    const gpa_float64 r55 = static_cast<gpa_float64>(*results[55]);
+    const gpa_float64 r56 = static_cast<gpa_float64>(*results[56]);
+    const gpa_float64 r57 = static_cast<gpa_float64>(*results[57]);
+    const gpa_float64 r58 = static_cast<gpa_float64>(*results[58]);
+    const gpa_float64 r59 = static_cast<gpa_float64>(*results[59]);
+    const gpa_float64 r60 = static_cast<gpa_float64>(*results[60]);
+    const gpa_float64 r61 = static_cast<gpa_float64>(*results[61]);
+    const gpa_float64 r62 = static_cast<gpa_float64>(*results[62]);
+    const gpa_float64 r63 = static_cast<gpa_float64>(*results[63]);
+
+    const gpa_float64 v0 = (r63 > r62) ? r63 : r62;
+    const gpa_float64 v1 = (v0 > r61) ? v0 : r61;
+    const gpa_float64 v2 = (v1 > r60) ? v1 : r60;
+    const gpa_float64 v3 = (v2 > r59) ? v2 : r59;
+    const gpa_float64 v4 = (v3 > r58) ? v3 : r58;
+    const gpa_float64 v5 = (v4 > r57) ? v4 : r57;
+    const gpa_float64 v6 = (v5 > r56) ? v5 : r56;
+    const gpa_float64 v7 = (v6 > r55) ? v6 : r55;
+    const gpa_float64 v8 = (v7 > r54) ? v7 : r54;
+    const gpa_float64 v9 = (v8 > r53) ? v8 : r53;
+    const gpa_float64 v10 = (v9 > r52) ? v9 : r52;
+    const gpa_float64 v11 = (v10 > r51) ? v10 : r51;
+    const gpa_float64 v12 = (v11 > r50) ? v11 : r50;
+    const gpa_float64 v13 = (v12 > r49) ? v12 : r49;
+    const gpa_float64 v14 = (v13 > r48) ? v13 : r48;
+    const gpa_float64 v15 = (v14 > r47) ? v14 : r47;
+    const gpa_float64 v16 = (v15 > r46) ? v15 : r46;
+    const gpa_float64 v17 = (v16 > r45) ? v16 : r45;
+    const gpa_float64 v18 = (v17 > r44) ? v17 : r44;
+    const gpa_float64 v19 = (v18 > r43) ? v18 : r43;
+    const gpa_float64 v20 = (v19 > r42) ? v19 : r42;
+    const gpa_float64 v21 = (v20 > r41) ? v20 : r41;
+    const gpa_float64 v22 = (v21 > r40) ? v21 : r40;
+    const gpa_float64 v23 = (v22 > r39) ? v22 : r39;
+    const gpa_float64 v24 = (v23 > r38) ? v23 : r38;
+    const gpa_float64 v25 = (v24 > r37) ? v24 : r37;
+    const gpa_float64 v26 = (v25 > r36) ? v25 : r36;
+    const gpa_float64 v27 = (v26 > r35) ? v26 : r35;
+    const gpa_float64 v28 = (v27 > r34) ? v27 : r34;
+    const gpa_float64 v29 = (v28 > r33) ? v28 : r33;
+    const gpa_float64 v30 = (v29 > r32) ? v29 : r32;
+    const gpa_float64 v31 = (v30 > r31) ? v30 : r31;
+    const gpa_float64 v32 = (v31 > r30) ? v31 : r30;
+    const gpa_float64 v33 = (v32 > r29) ? v32 : r29;
+    const gpa_float64 v34 = (v33 > r28) ? v33 : r28;
+    const gpa_float64 v35 = (v34 > r27) ? v34 : r27;
+    const gpa_float64 v36 = (v35 > r26) ? v35 : r26;
+    const gpa_float64 v37 = (v36 > r25) ? v36 : r25;
+    const gpa_float64 v38 = (v37 > r24) ? v37 : r24;
+    const gpa_float64 v39 = (v38 > r23) ? v38 : r23;
+    const gpa_float64 v40 = (v39 > r22) ? v39 : r22;
+    const gpa_float64 v41 = (v40 > r21) ? v40 : r21;
+    const gpa_float64 v42 = (v41 > r20) ? v41 : r20;
+    const gpa_float64 v43 = (v42 > r19) ? v42 : r19;
+    const gpa_float64 v44 = (v43 > r18) ? v43 : r18;
+    const gpa_float64 v45 = (v44 > r17) ? v44 : r17;
+    const gpa_float64 v46 = (v45 > r16) ? v45 : r16;
+    const gpa_float64 v47 = (v46 > r15) ? v46 : r15;
+    const gpa_float64 v48 = (v47 > r14) ? v47 : r14;
+    const gpa_float64 v49 = (v48 > r13) ? v48 : r13;
+    const gpa_float64 v50 = (v49 > r12) ? v49 : r12;
+    const gpa_float64 v51 = (v50 > r11) ? v50 : r11;
+    const gpa_float64 v52 = (v51 > r10) ? v51 : r10;
+    const gpa_float64 v53 = (v52 > r9) ? v52 : r9;
+    const gpa_float64 v54 = (v53 > r8) ? v53 : r8;
+    const gpa_float64 v55 = (v54 > r7) ? v54 : r7;
+    const gpa_float64 v56 = (v55 > r6) ? v55 : r6;
+    const gpa_float64 v57 = (v56 > r5) ? v56 : r5;
+    const gpa_float64 v58 = (v57 > r4) ? v57 : r4;
+    const gpa_float64 v59 = (v58 > r3) ? v58 : r3;
+    const gpa_float64 v60 = (v59 > r2) ? v59 : r2;
+    const gpa_float64 v61 = (v60 > r1) ? v60 : r1;
+    const gpa_float64 v62 = (v61 > r0) ? v61 : r0;
+
+    *static_cast<gpa_float64*>(pResult) = v62;
+}
+
+/// Computes the WriteUnitStalled counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16,16,/,(100),*
+static void ComputeWriteUnitStalled(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+    const gpa_float64 r16 = static_cast<gpa_float64>(*results[16]);
+
+    const gpa_float64 v0 = (r15 > r14) ? r15 : r14;
+    const gpa_float64 v1 = (v0 > r13) ? v0 : r13;
+    const gpa_float64 v2 = (v1 > r12) ? v1 : r12;
+    const gpa_float64 v3 = (v2 > r11) ? v2 : r11;
+    const gpa_float64 v4 = (v3 > r10) ? v3 : r10;
+    const gpa_float64 v5 = (v4 > r9) ? v4 : r9;
+    const gpa_float64 v6 = (v5 > r8) ? v5 : r8;
+    const gpa_float64 v7 = (v6 > r7) ? v6 : r7;
+    const gpa_float64 v8 = (v7 > r6) ? v7 : r6;
+    const gpa_float64 v9 = (v8 > r5) ? v8 : r5;
+    const gpa_float64 v10 = (v9 > r4) ? v9 : r4;
+    const gpa_float64 v11 = (v10 > r3) ? v10 : r3;
+    const gpa_float64 v12 = (v11 > r2) ? v11 : r2;
+    const gpa_float64 v13 = (v12 > r1) ? v12 : r1;
+    const gpa_float64 v14 = (v13 > r0) ? v13 : r0;
+    const gpa_float64 v15 = (r16 != 0.0) ? (v14 / r16) : 0.0;
+    const gpa_float64 v16 = v15 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v16;
+}
+
+/// Computes the WriteUnitStalledCycles counter: 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16
+static void ComputeWriteUnitStalledCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+    const gpa_float64 r12 = static_cast<gpa_float64>(*results[12]);
+    const gpa_float64 r13 = static_cast<gpa_float64>(*results[13]);
+    const gpa_float64 r14 = static_cast<gpa_float64>(*results[14]);
+    const gpa_float64 r15 = static_cast<gpa_float64>(*results[15]);
+
+    const gpa_float64 v0 = (r15 > r14) ? r15 : r14;
+    const gpa_float64 v1 = (v0 > r13) ? v0 : r13;
+    const gpa_float64 v2 = (v1 > r12) ? v1 : r12;
+    const gpa_float64 v3 = (v2 > r11) ? v2 : r11;
+    const gpa_float64 v4 = (v3 > r10) ? v3 : r10;
+    const gpa_float64 v5 = (v4 > r9) ? v4 : r9;
+    const gpa_float64 v6 = (v5 > r8) ? v5 : r8;
+    const gpa_float64 v7 = (v6 > r7) ? v6 : r7;
+    const gpa_float64 v8 = (v7 > r6) ? v7 : r6;
+    const gpa_float64 v9 = (v8 > r5) ? v8 : r5;
+    const gpa_float64 v10 = (v9 > r4) ? v9 : r4;
+    const gpa_float64 v11 = (v10 > r3) ? v10 : r3;
+    const gpa_float64 v12 = (v11 > r2) ? v11 : r2;
+    const gpa_float64 v13 = (v12 > r1) ? v12 : r1;
+    const gpa_float64 v14 = (v13 > r0) ? v13 : r0;
+
+    *static_cast<gpa_float64*>(pResult) = v14;
+}
+
 void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
 {
     {
         vector<gpa_uint32> internalCounters;
         internalCounters.push_back(51132);
 
-        c.DefineDerivedCounter("GPUTime", "Timing", "Time this API command took to execute on the GPU in nanoseconds from the time the previous command reached the bottom of the pipeline (BOP) to the time this command reaches the bottom of the pipeline (BOP). Does not include time that draw calls are processed in parallel.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_NANOSECONDS, internalCounters, "0,TS_FREQ,/,(1000000000),*", "cbd338f2-de6c-7b14-92ad-ba724ca2e501");
+        c.DefineDerivedCounter("GPUTime", "Timing", "Time this API command took to execute on the GPU in nanoseconds from the time the previous command reached the bottom of the pipeline (BOP) to the time this command reaches the bottom of the pipeline (BOP). Does not include time that draw calls are processed in parallel.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_NANOSECONDS, internalCounters, "0,TS_FREQ,/,(1000000000),*", "cbd338f2-de6c-7b14-92ad-ba724ca2e501", ComputeGPUTime);
     }
     {
         vector<gpa_uint32> internalCounters;
         internalCounters.push_back(10620);
         internalCounters.push_back(10618);
 
-        c.DefineDerivedCounter("GPUBusy", "Timing", "The percentage of time GPU was busy.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,/,(100),*,(100),min", "bef38bf3-1167-0844-81f0-67d2d28ddbc5");
+        c.DefineDerivedCounter("GPUBusy", "Timing", "The percentage of time GPU was busy.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,/,(100),*,(100),min", "bef38bf3-1167-0844-81f0-67d2d28ddbc5", ComputeGPUBusy);
     }
     {
         vector<gpa_uint32> internalCounters;
         internalCounters.push_back(10620);
 
-        c.DefineDerivedCounter("GPUBusyCycles", "Timing", "Number of GPU cycles that the GPU was busy.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0", "1e84970d-7014-2b8d-d61e-388b5f782691");
+        c.DefineDerivedCounter("GPUBusyCycles", "Timing", "Number of GPU cycles that the GPU was busy.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0", "1e84970d-7014-2b8d-d61e-388b5f782691", ComputeGPUBusyCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -39,7 +7165,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(49943);
         internalCounters.push_back(10620);
 
-        c.DefineDerivedCounter("TessellatorBusy", "Timing", "The percentage of time the tessellation engine is busy.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,max,2,max,3,max,4,/,(100),*", "36af6c72-dcfb-8102-4fd4-ce8ddc573365");
+        c.DefineDerivedCounter("TessellatorBusy", "Timing", "The percentage of time the tessellation engine is busy.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,max,2,max,3,max,4,/,(100),*", "36af6c72-dcfb-8102-4fd4-ce8ddc573365", ComputeTessellatorBusy);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -48,7 +7174,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(49796);
         internalCounters.push_back(49943);
 
-        c.DefineDerivedCounter("TessellatorBusyCycles", "Timing", "Number of GPU cycles that the tessellation engine is busy.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,max,2,max,3,max", "60289dcb-7b33-46e7-26d1-8a2121605543");
+        c.DefineDerivedCounter("TessellatorBusyCycles", "Timing", "Number of GPU cycles that the tessellation engine is busy.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,max,2,max,3,max", "60289dcb-7b33-46e7-26d1-8a2121605543", ComputeTessellatorBusyCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -82,7 +7208,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13700);
         internalCounters.push_back(10620);
 
-        c.DefineDerivedCounter("VSBusy", "Timing", "The percentage of time the ShaderUnit has vertex shader work to do.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),0,16,ifnotzero,4,20,ifnotzero,8,24,ifnotzero,(0),1,17,ifnotzero,5,21,ifnotzero,9,25,ifnotzero,max,(0),2,18,ifnotzero,6,22,ifnotzero,10,26,ifnotzero,max,(0),3,19,ifnotzero,7,23,ifnotzero,11,27,ifnotzero,max,28,/,(100),*,(100),min", "94caad5e-867c-6c09-cf3a-d05b51df8f3b");
+        c.DefineDerivedCounter("VSBusy", "Timing", "The percentage of time the ShaderUnit has vertex shader work to do.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),0,16,ifnotzero,4,20,ifnotzero,8,24,ifnotzero,(0),1,17,ifnotzero,5,21,ifnotzero,9,25,ifnotzero,max,(0),2,18,ifnotzero,6,22,ifnotzero,10,26,ifnotzero,max,(0),3,19,ifnotzero,7,23,ifnotzero,11,27,ifnotzero,max,28,/,(100),*,(100),min", "94caad5e-867c-6c09-cf3a-d05b51df8f3b", ComputeVSBusy);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -115,7 +7241,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13503);
         internalCounters.push_back(13700);
 
-        c.DefineDerivedCounter("VSBusyCycles", "Timing", "Number of GPU cycles that the ShaderUnit has vertex shader work to do.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "(0),0,16,ifnotzero,4,20,ifnotzero,8,24,ifnotzero,(0),1,17,ifnotzero,5,21,ifnotzero,9,25,ifnotzero,max,(0),2,18,ifnotzero,6,22,ifnotzero,10,26,ifnotzero,max,(0),3,19,ifnotzero,7,23,ifnotzero,11,27,ifnotzero,max", "a2086d4e-274b-48a8-3e08-a4ab76ac15dd");
+        c.DefineDerivedCounter("VSBusyCycles", "Timing", "Number of GPU cycles that the ShaderUnit has vertex shader work to do.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "(0),0,16,ifnotzero,4,20,ifnotzero,8,24,ifnotzero,(0),1,17,ifnotzero,5,21,ifnotzero,9,25,ifnotzero,max,(0),2,18,ifnotzero,6,22,ifnotzero,10,26,ifnotzero,max,(0),3,19,ifnotzero,7,23,ifnotzero,11,27,ifnotzero,max", "a2086d4e-274b-48a8-3e08-a4ab76ac15dd", ComputeVSBusyCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -150,7 +7276,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13700);
         internalCounters.push_back(10620);
 
-        c.DefineDerivedCounter("VSTime", "Timing", "Time vertex shaders are busy in nanoseconds.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_NANOSECONDS, internalCounters, "(0),1,17,ifnotzero,5,21,ifnotzero,9,25,ifnotzero,(0),2,18,ifnotzero,6,22,ifnotzero,10,26,ifnotzero,max,(0),3,19,ifnotzero,7,23,ifnotzero,11,27,ifnotzero,max,(0),4,20,ifnotzero,8,24,ifnotzero,12,28,ifnotzero,max,29,/,(1),min,0,TS_FREQ,/,(1000000000),*,*", "d6ce819e-69af-a241-d07a-5dd8d146e436");
+        c.DefineDerivedCounter("VSTime", "Timing", "Time vertex shaders are busy in nanoseconds.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_NANOSECONDS, internalCounters, "(0),1,17,ifnotzero,5,21,ifnotzero,9,25,ifnotzero,(0),2,18,ifnotzero,6,22,ifnotzero,10,26,ifnotzero,max,(0),3,19,ifnotzero,7,23,ifnotzero,11,27,ifnotzero,max,(0),4,20,ifnotzero,8,24,ifnotzero,12,28,ifnotzero,max,29,/,(1),min,0,TS_FREQ,/,(1000000000),*,*", "d6ce819e-69af-a241-d07a-5dd8d146e436", ComputeVSTime);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -164,7 +7290,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13690);
         internalCounters.push_back(10620);
 
-        c.DefineDerivedCounter("HSBusy", "Timing", "The percentage of time the ShaderUnit has hull shader work to do.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),0,4,ifnotzero,(0),1,5,ifnotzero,max,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max,8,/,(100),*,(100),min", "16f30a0b-4cbf-eccd-b13f-ab68dd254d32");
+        c.DefineDerivedCounter("HSBusy", "Timing", "The percentage of time the ShaderUnit has hull shader work to do.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),0,4,ifnotzero,(0),1,5,ifnotzero,max,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max,8,/,(100),*,(100),min", "16f30a0b-4cbf-eccd-b13f-ab68dd254d32", ComputeHSBusy);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -177,7 +7303,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13493);
         internalCounters.push_back(13690);
 
-        c.DefineDerivedCounter("HSBusyCycles", "Timing", "Number of GPU cycles that the ShaderUnit has hull shader work to do.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "(0),0,4,ifnotzero,(0),1,5,ifnotzero,max,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max", "753e76ef-8ef8-3f13-b511-4bd9f3589fdb");
+        c.DefineDerivedCounter("HSBusyCycles", "Timing", "Number of GPU cycles that the ShaderUnit has hull shader work to do.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "(0),0,4,ifnotzero,(0),1,5,ifnotzero,max,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max", "753e76ef-8ef8-3f13-b511-4bd9f3589fdb", ComputeHSBusyCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -192,7 +7318,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13690);
         internalCounters.push_back(10620);
 
-        c.DefineDerivedCounter("HSTime", "Timing", "Time hull shaders are busy in nanoseconds.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_NANOSECONDS, internalCounters, "(0),1,5,ifnotzero,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max,(0),4,8,ifnotzero,max,9,/,(1),min,0,TS_FREQ,/,(1000000000),*,*", "8386a863-dd34-1526-f703-0f0c7b241bc4");
+        c.DefineDerivedCounter("HSTime", "Timing", "Time hull shaders are busy in nanoseconds.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_NANOSECONDS, internalCounters, "(0),1,5,ifnotzero,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max,(0),4,8,ifnotzero,max,9,/,(1),min,0,TS_FREQ,/,(1000000000),*,*", "8386a863-dd34-1526-f703-0f0c7b241bc4", ComputeHSTime);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -218,7 +7344,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13700);
         internalCounters.push_back(10620);
 
-        c.DefineDerivedCounter("DSBusy", "Timing", "The percentage of time the ShaderUnit has domain shader work to do.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),0,4,12,ifnotzero,16,ifnotzero,(0),1,5,13,ifnotzero,17,ifnotzero,max,(0),2,6,14,ifnotzero,18,ifnotzero,max,(0),3,7,15,ifnotzero,19,ifnotzero,max,20,/,(100),*,(100),min", "0c626e8a-9b82-b6d4-d9a3-578509316301");
+        c.DefineDerivedCounter("DSBusy", "Timing", "The percentage of time the ShaderUnit has domain shader work to do.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),0,4,12,ifnotzero,16,ifnotzero,(0),1,5,13,ifnotzero,17,ifnotzero,max,(0),2,6,14,ifnotzero,18,ifnotzero,max,(0),3,7,15,ifnotzero,19,ifnotzero,max,20,/,(100),*,(100),min", "0c626e8a-9b82-b6d4-d9a3-578509316301", ComputeDSBusy);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -243,7 +7369,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13503);
         internalCounters.push_back(13700);
 
-        c.DefineDerivedCounter("DSBusyCycles", "Timing", "Number of GPU cycles that the ShaderUnit has domain shader work to do.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "(0),0,4,12,ifnotzero,16,ifnotzero,(0),1,5,13,ifnotzero,17,ifnotzero,max,(0),2,6,14,ifnotzero,18,ifnotzero,max,(0),3,7,15,ifnotzero,19,ifnotzero,max", "2f3f7561-0549-2232-536d-129ffc5f7703");
+        c.DefineDerivedCounter("DSBusyCycles", "Timing", "Number of GPU cycles that the ShaderUnit has domain shader work to do.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "(0),0,4,12,ifnotzero,16,ifnotzero,(0),1,5,13,ifnotzero,17,ifnotzero,max,(0),2,6,14,ifnotzero,18,ifnotzero,max,(0),3,7,15,ifnotzero,19,ifnotzero,max", "2f3f7561-0549-2232-536d-129ffc5f7703", ComputeDSBusyCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -270,7 +7396,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13700);
         internalCounters.push_back(10620);
 
-        c.DefineDerivedCounter("DSTime", "Timing", "Time domain shaders are busy in nanoseconds.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_NANOSECONDS, internalCounters, "(0),1,5,13,ifnotzero,17,ifnotzero,(0),2,6,14,ifnotzero,18,ifnotzero,max,(0),3,7,15,ifnotzero,19,ifnotzero,max,(0),4,8,16,ifnotzero,20,ifnotzero,max,21,/,(1),min,0,TS_FREQ,/,(1000000000),*,*", "bfe28947-c727-8a9f-aa59-c218e58bfba5");
+        c.DefineDerivedCounter("DSTime", "Timing", "Time domain shaders are busy in nanoseconds.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_NANOSECONDS, internalCounters, "(0),1,5,13,ifnotzero,17,ifnotzero,(0),2,6,14,ifnotzero,18,ifnotzero,max,(0),3,7,15,ifnotzero,19,ifnotzero,max,(0),4,8,16,ifnotzero,20,ifnotzero,max,21,/,(1),min,0,TS_FREQ,/,(1000000000),*,*", "bfe28947-c727-8a9f-aa59-c218e58bfba5", ComputeDSTime);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -284,7 +7410,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13666);
         internalCounters.push_back(10620);
 
-        c.DefineDerivedCounter("GSBusy", "Timing", "The percentage of time the ShaderUnit has geometry shader work to do.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),0,4,ifnotzero,(0),1,5,ifnotzero,max,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max,8,/,(100),*,(100),min", "876f36d8-d046-833f-7832-673cbffd0a45");
+        c.DefineDerivedCounter("GSBusy", "Timing", "The percentage of time the ShaderUnit has geometry shader work to do.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),0,4,ifnotzero,(0),1,5,ifnotzero,max,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max,8,/,(100),*,(100),min", "876f36d8-d046-833f-7832-673cbffd0a45", ComputeGSBusy);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -297,7 +7423,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13469);
         internalCounters.push_back(13666);
 
-        c.DefineDerivedCounter("GSBusyCycles", "Timing", "Number of GPU cycles that the ShaderUnit has geometry shader work to do.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "(0),0,4,ifnotzero,(0),1,5,ifnotzero,max,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max", "48203b6b-8983-c067-d63e-05da8be5111b");
+        c.DefineDerivedCounter("GSBusyCycles", "Timing", "Number of GPU cycles that the ShaderUnit has geometry shader work to do.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "(0),0,4,ifnotzero,(0),1,5,ifnotzero,max,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max", "48203b6b-8983-c067-d63e-05da8be5111b", ComputeGSBusyCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -312,7 +7438,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13666);
         internalCounters.push_back(10620);
 
-        c.DefineDerivedCounter("GSTime", "Timing", "Time geometry shaders are busy in nanoseconds.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_NANOSECONDS, internalCounters, "(0),1,5,ifnotzero,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max,(0),4,8,ifnotzero,max,9,/,(1),min,0,TS_FREQ,/,(1000000000),*,*", "c73e715f-59af-76e8-9e22-097b94c066c4");
+        c.DefineDerivedCounter("GSTime", "Timing", "Time geometry shaders are busy in nanoseconds.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_NANOSECONDS, internalCounters, "(0),1,5,ifnotzero,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max,(0),4,8,ifnotzero,max,9,/,(1),min,0,TS_FREQ,/,(1000000000),*,*", "c73e715f-59af-76e8-9e22-097b94c066c4", ComputeGSTime);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -326,7 +7452,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13721);
         internalCounters.push_back(10620);
 
-        c.DefineDerivedCounter("PSBusy", "Timing", "The percentage of time the ShaderUnit has pixel shader work to do.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),0,4,ifnotzero,(0),1,5,ifnotzero,max,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max,8,/,(100),*", "7e772beb-d82c-bd9a-aed0-fe504d416ce5");
+        c.DefineDerivedCounter("PSBusy", "Timing", "The percentage of time the ShaderUnit has pixel shader work to do.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),0,4,ifnotzero,(0),1,5,ifnotzero,max,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max,8,/,(100),*", "7e772beb-d82c-bd9a-aed0-fe504d416ce5", ComputePSBusy);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -339,7 +7465,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13524);
         internalCounters.push_back(13721);
 
-        c.DefineDerivedCounter("PSBusyCycles", "Timing", "Number of GPU cycles that the ShaderUnit has pixel shader work to do.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "(0),0,4,ifnotzero,(0),1,5,ifnotzero,max,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max", "b58bea04-ce8e-2984-80f4-8aba7d4c817b");
+        c.DefineDerivedCounter("PSBusyCycles", "Timing", "Number of GPU cycles that the ShaderUnit has pixel shader work to do.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "(0),0,4,ifnotzero,(0),1,5,ifnotzero,max,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max", "b58bea04-ce8e-2984-80f4-8aba7d4c817b", ComputePSBusyCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -354,7 +7480,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13721);
         internalCounters.push_back(10620);
 
-        c.DefineDerivedCounter("PSTime", "Timing", "Time pixel shaders are busy in nanoseconds.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_NANOSECONDS, internalCounters, "(0),1,5,ifnotzero,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max,(0),4,8,ifnotzero,max,9,/,0,TS_FREQ,/,(1000000000),*,*", "edca7694-7416-e8a6-0c5a-63a5ad5f3d74");
+        c.DefineDerivedCounter("PSTime", "Timing", "Time pixel shaders are busy in nanoseconds.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_NANOSECONDS, internalCounters, "(0),1,5,ifnotzero,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max,(0),4,8,ifnotzero,max,9,/,0,TS_FREQ,/,(1000000000),*,*", "edca7694-7416-e8a6-0c5a-63a5ad5f3d74", ComputePSTime);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -376,7 +7502,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13714);
         internalCounters.push_back(10620);
 
-        c.DefineDerivedCounter("CSBusy", "Timing", "The percentage of time the ShaderUnit has compute shader work to do.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,comparemax4,8,9,10,11,12,13,14,15,comparemax4,max,16,/,(100),*,(100),min", "493fdd90-8d2b-a055-5e4e-2d29c3396b8c");
+        c.DefineDerivedCounter("CSBusy", "Timing", "The percentage of time the ShaderUnit has compute shader work to do.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,comparemax4,8,9,10,11,12,13,14,15,comparemax4,max,16,/,(100),*,(100),min", "493fdd90-8d2b-a055-5e4e-2d29c3396b8c", ComputeCSBusy);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -397,7 +7523,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13517);
         internalCounters.push_back(13714);
 
-        c.DefineDerivedCounter("CSBusyCycles", "Timing", "Number of GPU cycles that the ShaderUnit has compute shader work to do.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,2,3,4,5,6,7,comparemax4,8,9,10,11,12,13,14,15,comparemax4,max", "39bcf1b8-f6b2-4c37-f9af-0a2bb59512f9");
+        c.DefineDerivedCounter("CSBusyCycles", "Timing", "Number of GPU cycles that the ShaderUnit has compute shader work to do.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,2,3,4,5,6,7,comparemax4,8,9,10,11,12,13,14,15,comparemax4,max", "39bcf1b8-f6b2-4c37-f9af-0a2bb59512f9", ComputeCSBusyCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -420,7 +7546,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13714);
         internalCounters.push_back(10620);
 
-        c.DefineDerivedCounter("CSTime", "Timing", "Time compute shaders are busy in nanoseconds.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_NANOSECONDS, internalCounters, "1,2,3,4,5,6,7,8,comparemax4,9,10,11,12,13,14,15,16,comparemax4,max,17,/,(1),min,0,TS_FREQ,/,(1000000000),*,*", "dbc24916-ecb2-7eef-8d63-7afadaaab6bc");
+        c.DefineDerivedCounter("CSTime", "Timing", "Time compute shaders are busy in nanoseconds.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_NANOSECONDS, internalCounters, "1,2,3,4,5,6,7,8,comparemax4,9,10,11,12,13,14,15,16,comparemax4,max,17,/,(1),min,0,TS_FREQ,/,(1000000000),*,*", "dbc24916-ecb2-7eef-8d63-7afadaaab6bc", ComputeCSTime);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -437,7 +7563,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(49768);
         internalCounters.push_back(49915);
 
-        c.DefineDerivedCounter("VSVerticesIn", "VertexShader", "The number of vertices processed by the VS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,4,5,6,7,sum4,ifnotzero,8,9,10,11,sum4,8,9,10,11,sum4,ifnotzero", "810a04c8-2ff4-081d-766d-bfa2bd4ad916");
+        c.DefineDerivedCounter("VSVerticesIn", "VertexShader", "The number of vertices processed by the VS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,4,5,6,7,sum4,ifnotzero,8,9,10,11,sum4,8,9,10,11,sum4,ifnotzero", "810a04c8-2ff4-081d-766d-bfa2bd4ad916", ComputeVSVerticesIn);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -474,7 +7600,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(20435);
         internalCounters.push_back(20734);
 
-        c.DefineDerivedCounter("VSVALUInstCount", "VertexShader", "Average number of vector ALU instructions executed in the VS. Affected by flow control.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,sum4,12,13,14,15,sum4,/,16,17,18,19,sum4,ifnotzero,20,21,22,23,sum4,24,25,26,27,sum4,/,28,29,30,31,sum4,ifnotzero", "8ec604e4-63f5-e6b5-4558-c38f0b26d4b1");
+        c.DefineDerivedCounter("VSVALUInstCount", "VertexShader", "Average number of vector ALU instructions executed in the VS. Affected by flow control.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,sum4,12,13,14,15,sum4,/,16,17,18,19,sum4,ifnotzero,20,21,22,23,sum4,24,25,26,27,sum4,/,28,29,30,31,sum4,ifnotzero", "8ec604e4-63f5-e6b5-4558-c38f0b26d4b1", ComputeVSVALUInstCount);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -511,7 +7637,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(20435);
         internalCounters.push_back(20734);
 
-        c.DefineDerivedCounter("VSSALUInstCount", "VertexShader", "Average number of scalar ALU instructions executed in the VS. Affected by flow control.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,sum4,12,13,14,15,sum4,/,16,17,18,19,sum4,ifnotzero,20,21,22,23,sum4,24,25,26,27,sum4,/,28,29,30,31,sum4,ifnotzero", "e3da0383-7322-7f65-8cf2-3ce641578e54");
+        c.DefineDerivedCounter("VSSALUInstCount", "VertexShader", "Average number of scalar ALU instructions executed in the VS. Affected by flow control.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,sum4,12,13,14,15,sum4,/,16,17,18,19,sum4,ifnotzero,20,21,22,23,sum4,24,25,26,27,sum4,/,28,29,30,31,sum4,ifnotzero", "e3da0383-7322-7f65-8cf2-3ce641578e54", ComputeVSSALUInstCount);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -537,7 +7663,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(20435);
         internalCounters.push_back(20734);
 
-        c.DefineDerivedCounter("VSVALUBusy", "VertexShader", "The percentage of GPUTime vector ALU instructions are being processed by the VS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,8,9,10,11,sum4,ifnotzero,13,14,15,16,sum4,17,18,19,20,sum4,ifnotzero,(4),*,NUM_SIMDS,/,12,/,(100),*", "8b3572f7-fda0-eddf-6c93-2ab145b8754b");
+        c.DefineDerivedCounter("VSVALUBusy", "VertexShader", "The percentage of GPUTime vector ALU instructions are being processed by the VS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,8,9,10,11,sum4,ifnotzero,13,14,15,16,sum4,17,18,19,20,sum4,ifnotzero,(4),*,NUM_SIMDS,/,12,/,(100),*", "8b3572f7-fda0-eddf-6c93-2ab145b8754b", ComputeVSVALUBusy);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -562,7 +7688,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(20435);
         internalCounters.push_back(20734);
 
-        c.DefineDerivedCounter("VSVALUBusyCycles", "VertexShader", "Number of GPU cycles where vector ALU instructions are being processed by the VS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,8,9,10,11,sum4,ifnotzero,12,13,14,15,sum4,16,17,18,19,sum4,ifnotzero,(4),*,NUM_SIMDS,/", "0af1686e-6d77-2f6e-2862-7bb8e869a776");
+        c.DefineDerivedCounter("VSVALUBusyCycles", "VertexShader", "Number of GPU cycles where vector ALU instructions are being processed by the VS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,8,9,10,11,sum4,ifnotzero,12,13,14,15,sum4,16,17,18,19,sum4,ifnotzero,(4),*,NUM_SIMDS,/", "0af1686e-6d77-2f6e-2862-7bb8e869a776", ComputeVSVALUBusyCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -588,7 +7714,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(20435);
         internalCounters.push_back(20734);
 
-        c.DefineDerivedCounter("VSSALUBusy", "VertexShader", "The percentage of GPUTime scalar ALU instructions are being processed by the VS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,8,9,10,11,sum4,ifnotzero,13,14,15,16,sum4,17,18,19,20,sum4,ifnotzero,NUM_CUS,/,12,/,(100),*", "3bc8730c-e3bc-e2f0-7d24-36974064c25a");
+        c.DefineDerivedCounter("VSSALUBusy", "VertexShader", "The percentage of GPUTime scalar ALU instructions are being processed by the VS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,8,9,10,11,sum4,ifnotzero,13,14,15,16,sum4,17,18,19,20,sum4,ifnotzero,NUM_CUS,/,12,/,(100),*", "3bc8730c-e3bc-e2f0-7d24-36974064c25a", ComputeVSSALUBusy);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -613,7 +7739,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(20435);
         internalCounters.push_back(20734);
 
-        c.DefineDerivedCounter("VSSALUBusyCycles", "VertexShader", "Number of GPU cycles where scalar ALU instructions are being processed by the VS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,8,9,10,11,sum4,ifnotzero,12,13,14,15,sum4,16,17,18,19,sum4,ifnotzero,NUM_CUS,/", "357ac7cd-2e1c-dcb0-77f6-37527237f35b");
+        c.DefineDerivedCounter("VSSALUBusyCycles", "VertexShader", "Number of GPU cycles where scalar ALU instructions are being processed by the VS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,8,9,10,11,sum4,ifnotzero,12,13,14,15,sum4,16,17,18,19,sum4,ifnotzero,NUM_CUS,/", "357ac7cd-2e1c-dcb0-77f6-37527237f35b", ComputeVSSALUBusyCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -622,7 +7748,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(49777);
         internalCounters.push_back(49924);
 
-        c.DefineDerivedCounter("HSPatches", "HullShader", "The number of patches processed by the HS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,sum4", "d1bbd27d-d591-4509-df52-d329fb73a98f");
+        c.DefineDerivedCounter("HSPatches", "HullShader", "The number of patches processed by the HS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,sum4", "d1bbd27d-d591-4509-df52-d329fb73a98f", ComputeHSPatches);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -635,7 +7761,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(21621);
         internalCounters.push_back(21920);
 
-        c.DefineDerivedCounter("HSVALUInstCount", "HullShader", "Average number of vector ALU instructions executed in the HS. Affected by flow control.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,/", "786673bf-d58f-9895-3a37-9d6efb5e5804");
+        c.DefineDerivedCounter("HSVALUInstCount", "HullShader", "Average number of vector ALU instructions executed in the HS. Affected by flow control.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,/", "786673bf-d58f-9895-3a37-9d6efb5e5804", ComputeHSVALUInstCount);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -648,7 +7774,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(21621);
         internalCounters.push_back(21920);
 
-        c.DefineDerivedCounter("HSSALUInstCount", "HullShader", "Average number of scalar ALU instructions executed in the HS. Affected by flow control.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,/", "1af675c4-cb0b-c4c5-c131-2796750f683e");
+        c.DefineDerivedCounter("HSSALUInstCount", "HullShader", "Average number of scalar ALU instructions executed in the HS. Affected by flow control.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,/", "1af675c4-cb0b-c4c5-c131-2796750f683e", ComputeHSSALUInstCount);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -658,7 +7784,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(21997);
         internalCounters.push_back(10620);
 
-        c.DefineDerivedCounter("HSVALUBusy", "HullShader", "The percentage of GPUTime vector ALU instructions are being processed by the HS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,sum4,(4),*,NUM_SIMDS,/,4,/,(100),*", "7880d192-8015-0311-d43e-fb0b7a4df179");
+        c.DefineDerivedCounter("HSVALUBusy", "HullShader", "The percentage of GPUTime vector ALU instructions are being processed by the HS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,sum4,(4),*,NUM_SIMDS,/,4,/,(100),*", "7880d192-8015-0311-d43e-fb0b7a4df179", ComputeHSVALUBusy);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -667,7 +7793,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(21698);
         internalCounters.push_back(21997);
 
-        c.DefineDerivedCounter("HSVALUBusyCycles", "HullShader", "Number of GPU cycles vector where ALU instructions are being processed by the HS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,2,3,sum4,(4),*,NUM_SIMDS,/", "3afb94e4-e937-5730-0cc9-41d3113ba012");
+        c.DefineDerivedCounter("HSVALUBusyCycles", "HullShader", "Number of GPU cycles vector where ALU instructions are being processed by the HS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,2,3,sum4,(4),*,NUM_SIMDS,/", "3afb94e4-e937-5730-0cc9-41d3113ba012", ComputeHSVALUBusyCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -677,7 +7803,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(22002);
         internalCounters.push_back(10620);
 
-        c.DefineDerivedCounter("HSSALUBusy", "HullShader", "The percentage of GPUTime scalar ALU instructions are being processed by the HS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,sum4,NUM_CUS,/,4,/,(100),*", "34748a4b-9148-0b06-b7b9-5700d6631bde");
+        c.DefineDerivedCounter("HSSALUBusy", "HullShader", "The percentage of GPUTime scalar ALU instructions are being processed by the HS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,sum4,NUM_CUS,/,4,/,(100),*", "34748a4b-9148-0b06-b7b9-5700d6631bde", ComputeHSSALUBusy);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -686,7 +7812,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(21703);
         internalCounters.push_back(22002);
 
-        c.DefineDerivedCounter("HSSALUBusyCycles", "HullShader", "Number of GPU cycles where scalar ALU instructions are being processed by the HS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,2,3,sum4,NUM_CUS,/", "9bceabf7-3f01-2fd9-7b1d-8fe46c729efc");
+        c.DefineDerivedCounter("HSSALUBusyCycles", "HullShader", "Number of GPU cycles where scalar ALU instructions are being processed by the HS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,2,3,sum4,NUM_CUS,/", "9bceabf7-3f01-2fd9-7b1d-8fe46c729efc", ComputeHSSALUBusyCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -703,7 +7829,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(49768);
         internalCounters.push_back(49915);
 
-        c.DefineDerivedCounter("DSVerticesIn", "DomainShader", "The number of vertices processed by the DS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,4,5,6,7,sum4,ifnotzero,8,9,10,11,sum4,ifnotzero", "b88d9d05-2418-e639-4e3d-3a5815855f8d");
+        c.DefineDerivedCounter("DSVerticesIn", "DomainShader", "The number of vertices processed by the DS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,4,5,6,7,sum4,ifnotzero,8,9,10,11,sum4,ifnotzero", "b88d9d05-2418-e639-4e3d-3a5815855f8d", ComputeDSVerticesIn);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -732,7 +7858,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(20435);
         internalCounters.push_back(20734);
 
-        c.DefineDerivedCounter("DSVALUInstCount", "DomainShader", "Average number of vector ALU instructions executed in the DS. Affected by flow control.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,sum4,12,13,14,15,sum4,/,16,17,18,19,sum4,ifnotzero,20,21,22,23,sum4,ifnotzero", "03a3e949-82f9-be4d-7228-5eb5ad80915a");
+        c.DefineDerivedCounter("DSVALUInstCount", "DomainShader", "Average number of vector ALU instructions executed in the DS. Affected by flow control.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,sum4,12,13,14,15,sum4,/,16,17,18,19,sum4,ifnotzero,20,21,22,23,sum4,ifnotzero", "03a3e949-82f9-be4d-7228-5eb5ad80915a", ComputeDSVALUInstCount);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -761,7 +7887,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(20435);
         internalCounters.push_back(20734);
 
-        c.DefineDerivedCounter("DSSALUInstCount", "DomainShader", "Average number of scalar ALU instructions executed in the DS. Affected by flow control.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,sum4,12,13,14,15,sum4,/,16,17,18,19,sum4,ifnotzero,20,21,22,23,sum4,ifnotzero", "73daa728-483e-95d0-5b40-504719aadc1c");
+        c.DefineDerivedCounter("DSSALUInstCount", "DomainShader", "Average number of scalar ALU instructions executed in the DS. Affected by flow control.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,sum4,12,13,14,15,sum4,/,16,17,18,19,sum4,ifnotzero,20,21,22,23,sum4,ifnotzero", "73daa728-483e-95d0-5b40-504719aadc1c", ComputeDSSALUInstCount);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -783,7 +7909,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(20435);
         internalCounters.push_back(20734);
 
-        c.DefineDerivedCounter("DSVALUBusy", "DomainShader", "The percentage of GPUTime vector ALU instructions are being processed by the DS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,9,10,11,12,sum4,ifnotzero,13,14,15,16,sum4,ifnotzero,(4),*,NUM_SIMDS,/,8,/,(100),*", "ddc0dd0c-0c73-b831-a410-cfea8b9713d9");
+        c.DefineDerivedCounter("DSVALUBusy", "DomainShader", "The percentage of GPUTime vector ALU instructions are being processed by the DS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,9,10,11,12,sum4,ifnotzero,13,14,15,16,sum4,ifnotzero,(4),*,NUM_SIMDS,/,8,/,(100),*", "ddc0dd0c-0c73-b831-a410-cfea8b9713d9", ComputeDSVALUBusy);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -804,7 +7930,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(20435);
         internalCounters.push_back(20734);
 
-        c.DefineDerivedCounter("DSVALUBusyCycles", "DomainShader", "Number of GPU cycles where vector ALU instructions are being processed by the DS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,8,9,10,11,sum4,ifnotzero,12,13,14,15,sum4,ifnotzero,(4),*,NUM_SIMDS,/", "1e280912-81ee-a684-823b-94c468d8ebda");
+        c.DefineDerivedCounter("DSVALUBusyCycles", "DomainShader", "Number of GPU cycles where vector ALU instructions are being processed by the DS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,8,9,10,11,sum4,ifnotzero,12,13,14,15,sum4,ifnotzero,(4),*,NUM_SIMDS,/", "1e280912-81ee-a684-823b-94c468d8ebda", ComputeDSVALUBusyCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -826,7 +7952,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(20435);
         internalCounters.push_back(20734);
 
-        c.DefineDerivedCounter("DSSALUBusy", "DomainShader", "The percentage of GPUTime scalar ALU instructions are being processed by the DS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,9,10,11,12,sum4,ifnotzero,13,14,15,16,sum4,ifnotzero,NUM_CUS,/,8,/,(100),*", "b639f64c-24af-348f-6439-43c701b4fc07");
+        c.DefineDerivedCounter("DSSALUBusy", "DomainShader", "The percentage of GPUTime scalar ALU instructions are being processed by the DS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,9,10,11,12,sum4,ifnotzero,13,14,15,16,sum4,ifnotzero,NUM_CUS,/,8,/,(100),*", "b639f64c-24af-348f-6439-43c701b4fc07", ComputeDSSALUBusy);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -847,7 +7973,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(20435);
         internalCounters.push_back(20734);
 
-        c.DefineDerivedCounter("DSSALUBusyCycles", "DomainShader", "Number of GPU cycles where scalar ALU instructions are being processed by the DS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,8,9,10,11,sum4,ifnotzero,12,13,14,15,sum4,ifnotzero,NUM_CUS,/", "b5bf8a0c-e682-1aa6-23d7-c6c6784ffa5c");
+        c.DefineDerivedCounter("DSSALUBusyCycles", "DomainShader", "Number of GPU cycles where scalar ALU instructions are being processed by the DS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,8,9,10,11,sum4,ifnotzero,12,13,14,15,sum4,ifnotzero,NUM_CUS,/", "b5bf8a0c-e682-1aa6-23d7-c6c6784ffa5c", ComputeDSSALUBusyCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -856,7 +7982,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(49681);
         internalCounters.push_back(49828);
 
-        c.DefineDerivedCounter("GSPrimsIn", "GeometryShader", "The number of primitives passed into the GS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,sum4", "20c29866-509a-aaab-2697-6b2c38f79953");
+        c.DefineDerivedCounter("GSPrimsIn", "GeometryShader", "The number of primitives passed into the GS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,sum4", "20c29866-509a-aaab-2697-6b2c38f79953", ComputeGSPrimsIn);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -869,7 +7995,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(49673);
         internalCounters.push_back(49820);
 
-        c.DefineDerivedCounter("GSVerticesOut", "GeometryShader", "The number of vertices output by the GS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,ifnotzero", "775b9736-319a-bd8a-48c9-68db9c91d978");
+        c.DefineDerivedCounter("GSVerticesOut", "GeometryShader", "The number of vertices output by the GS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,ifnotzero", "775b9736-319a-bd8a-48c9-68db9c91d978", ComputeGSVerticesOut);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -882,7 +8008,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(16837);
         internalCounters.push_back(17136);
 
-        c.DefineDerivedCounter("GSVALUInstCount", "GeometryShader", "Average number of vector ALU instructions executed in the GS. Affected by flow control.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,/", "21b12bfa-b8cd-2e71-a2d5-f9e9f1d65d61");
+        c.DefineDerivedCounter("GSVALUInstCount", "GeometryShader", "Average number of vector ALU instructions executed in the GS. Affected by flow control.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,/", "21b12bfa-b8cd-2e71-a2d5-f9e9f1d65d61", ComputeGSVALUInstCount);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -895,7 +8021,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(16837);
         internalCounters.push_back(17136);
 
-        c.DefineDerivedCounter("GSSALUInstCount", "GeometryShader", "Average number of scalar ALU instructions executed in the GS. Affected by flow control.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,/", "a8562594-d335-ca43-61bf-03b72d2b98a5");
+        c.DefineDerivedCounter("GSSALUInstCount", "GeometryShader", "Average number of scalar ALU instructions executed in the GS. Affected by flow control.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,/", "a8562594-d335-ca43-61bf-03b72d2b98a5", ComputeGSSALUInstCount);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -905,7 +8031,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(17213);
         internalCounters.push_back(10620);
 
-        c.DefineDerivedCounter("GSVALUBusy", "GeometryShader", "The percentage of GPUTime vector ALU instructions are being processed by the GS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,sum4,(4),*,NUM_SIMDS,/,4,/,(100),*", "228a4818-1e56-cebb-0720-3b2cdc057a6f");
+        c.DefineDerivedCounter("GSVALUBusy", "GeometryShader", "The percentage of GPUTime vector ALU instructions are being processed by the GS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,sum4,(4),*,NUM_SIMDS,/,4,/,(100),*", "228a4818-1e56-cebb-0720-3b2cdc057a6f", ComputeGSVALUBusy);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -914,7 +8040,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(16914);
         internalCounters.push_back(17213);
 
-        c.DefineDerivedCounter("GSVALUBusyCycles", "GeometryShader", "Number of GPU cycles where vector ALU instructions are being processed by the GS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,2,3,sum4,(4),*,NUM_SIMDS,/", "be217edd-226f-bd97-9a48-46e2809b1933");
+        c.DefineDerivedCounter("GSVALUBusyCycles", "GeometryShader", "Number of GPU cycles where vector ALU instructions are being processed by the GS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,2,3,sum4,(4),*,NUM_SIMDS,/", "be217edd-226f-bd97-9a48-46e2809b1933", ComputeGSVALUBusyCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -924,7 +8050,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(17218);
         internalCounters.push_back(10620);
 
-        c.DefineDerivedCounter("GSSALUBusy", "GeometryShader", "The percentage of GPUTime scalar ALU instructions are being processed by the GS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,sum4,NUM_CUS,/,4,/,(100),*", "f28ce300-800e-9822-39e4-f48528bdb935");
+        c.DefineDerivedCounter("GSSALUBusy", "GeometryShader", "The percentage of GPUTime scalar ALU instructions are being processed by the GS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,sum4,NUM_CUS,/,4,/,(100),*", "f28ce300-800e-9822-39e4-f48528bdb935", ComputeGSSALUBusy);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -933,7 +8059,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(16919);
         internalCounters.push_back(17218);
 
-        c.DefineDerivedCounter("GSSALUBusyCycles", "GeometryShader", "Number of GPU cycles where scalar ALU instructions are being processed by the GS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,2,3,sum4,NUM_CUS,/", "b3eace7c-3bc4-0107-887f-923851dc8ea7");
+        c.DefineDerivedCounter("GSSALUBusyCycles", "GeometryShader", "Number of GPU cycles where scalar ALU instructions are being processed by the GS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,2,3,sum4,NUM_CUS,/", "b3eace7c-3bc4-0107-887f-923851dc8ea7", ComputeGSSALUBusyCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -963,7 +8089,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(11252);
         internalCounters.push_back(10620);
 
-        c.DefineDerivedCounter("PrimitiveAssemblyBusy", "Timing", "The percentage of GPUTime that primitive assembly (clipping and culling) is busy. High values may be caused by having many small primitives; mid to low values may indicate pixel shader or output buffer bottleneck.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,4,-,8,12,+,16,+,20,(2),*,+,SU_CLOCKS_PRIM,*,-,1,5,-,9,13,+,17,+,21,(2),*,+,SU_CLOCKS_PRIM,*,-,max,2,6,-,10,14,+,18,+,22,(2),*,+,SU_CLOCKS_PRIM,*,-,max,3,7,-,11,15,+,19,+,23,(2),*,+,SU_CLOCKS_PRIM,*,-,max,(0),max,24,/,(100),*,(100),min", "54ac5640-c4d7-95e2-20e0-6a9fdfc07333");
+        c.DefineDerivedCounter("PrimitiveAssemblyBusy", "Timing", "The percentage of GPUTime that primitive assembly (clipping and culling) is busy. High values may be caused by having many small primitives; mid to low values may indicate pixel shader or output buffer bottleneck.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,4,-,8,12,+,16,+,20,(2),*,+,SU_CLOCKS_PRIM,*,-,1,5,-,9,13,+,17,+,21,(2),*,+,SU_CLOCKS_PRIM,*,-,max,2,6,-,10,14,+,18,+,22,(2),*,+,SU_CLOCKS_PRIM,*,-,max,3,7,-,11,15,+,19,+,23,(2),*,+,SU_CLOCKS_PRIM,*,-,max,(0),max,24,/,(100),*,(100),min", "54ac5640-c4d7-95e2-20e0-6a9fdfc07333", ComputePrimitiveAssemblyBusy);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -992,7 +8118,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(11099);
         internalCounters.push_back(11252);
 
-        c.DefineDerivedCounter("PrimitiveAssemblyBusyCycles", "Timing", "Number of GPU cycles the primitive assembly (clipping and culling) is busy. High values may be caused by having many small primitives; mid to low values may indicate pixel shader or output buffer bottleneck.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,4,-,8,12,+,16,+,20,(2),*,+,SU_CLOCKS_PRIM,*,-,1,5,-,9,13,+,17,+,21,(2),*,+,SU_CLOCKS_PRIM,*,-,max,2,6,-,10,14,+,18,+,22,(2),*,+,SU_CLOCKS_PRIM,*,-,max,3,7,-,11,15,+,19,+,23,(2),*,+,SU_CLOCKS_PRIM,*,-,max,(0),max", "99777f2d-9626-c78a-a97c-c4505eba1e5f");
+        c.DefineDerivedCounter("PrimitiveAssemblyBusyCycles", "Timing", "Number of GPU cycles the primitive assembly (clipping and culling) is busy. High values may be caused by having many small primitives; mid to low values may indicate pixel shader or output buffer bottleneck.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,4,-,8,12,+,16,+,20,(2),*,+,SU_CLOCKS_PRIM,*,-,1,5,-,9,13,+,17,+,21,(2),*,+,SU_CLOCKS_PRIM,*,-,max,2,6,-,10,14,+,18,+,22,(2),*,+,SU_CLOCKS_PRIM,*,-,max,3,7,-,11,15,+,19,+,23,(2),*,+,SU_CLOCKS_PRIM,*,-,max,(0),max", "99777f2d-9626-c78a-a97c-c4505eba1e5f", ComputePrimitiveAssemblyBusyCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1001,7 +8127,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(11033);
         internalCounters.push_back(11186);
 
-        c.DefineDerivedCounter("PrimitivesIn", "PrimitiveAssembly", "The number of primitives received by the hardware. This includes primitives generated by tessellation.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,sum4", "a515b80d-75c3-c7d2-0d2f-d7766b4759a6");
+        c.DefineDerivedCounter("PrimitivesIn", "PrimitiveAssembly", "The number of primitives received by the hardware. This includes primitives generated by tessellation.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,sum4", "a515b80d-75c3-c7d2-0d2f-d7766b4759a6", ComputePrimitivesIn);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1026,7 +8152,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(11082);
         internalCounters.push_back(11235);
 
-        c.DefineDerivedCounter("CulledPrims", "PrimitiveAssembly", "The number of culled primitives. Typical reasons include scissor, the primitive having zero area, and back or front face culling.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,+,2,+,3,+,4,+,5,+,6,+,7,+,8,+,9,+,10,+,11,+,12,+,13,+,14,+,15,+,16,+,17,+,18,+,19,+", "589bdf55-9192-280a-41c3-584bc94f2562");
+        c.DefineDerivedCounter("CulledPrims", "PrimitiveAssembly", "The number of culled primitives. Typical reasons include scissor, the primitive having zero area, and back or front face culling.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,+,2,+,3,+,4,+,5,+,6,+,7,+,8,+,9,+,10,+,11,+,12,+,13,+,14,+,15,+,16,+,17,+,18,+,19,+", "589bdf55-9192-280a-41c3-584bc94f2562", ComputeCulledPrims);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1035,7 +8161,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(11046);
         internalCounters.push_back(11199);
 
-        c.DefineDerivedCounter("ClippedPrims", "PrimitiveAssembly", "The number of primitives that required one or more clipping operations due to intersecting the view volume or user clip planes.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,sum4", "5ef6f9d5-155e-5baa-163f-8359d9ea9bbf");
+        c.DefineDerivedCounter("ClippedPrims", "PrimitiveAssembly", "The number of primitives that required one or more clipping operations due to intersecting the view volume or user clip planes.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,sum4", "5ef6f9d5-155e-5baa-163f-8359d9ea9bbf", ComputeClippedPrims);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1045,7 +8171,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(11287);
         internalCounters.push_back(10620);
 
-        c.DefineDerivedCounter("PAStalledOnRasterizer", "PrimitiveAssembly", "Percentage of GPUTime that primitive assembly waits for rasterization to be ready to accept data. This roughly indicates for what percentage of time the pipeline is bottlenecked by pixel operations.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,max,2,max,3,max,4,/,(100),*", "6f9f416b-53c1-0457-f88c-7b6ba8973974");
+        c.DefineDerivedCounter("PAStalledOnRasterizer", "PrimitiveAssembly", "Percentage of GPUTime that primitive assembly waits for rasterization to be ready to accept data. This roughly indicates for what percentage of time the pipeline is bottlenecked by pixel operations.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,max,2,max,3,max,4,/,(100),*", "6f9f416b-53c1-0457-f88c-7b6ba8973974", ComputePAStalledOnRasterizer);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1054,7 +8180,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(11134);
         internalCounters.push_back(11287);
 
-        c.DefineDerivedCounter("PAStalledOnRasterizerCycles", "PrimitiveAssembly", "Number of GPU cycles the primitive assembly waits for rasterization to be ready to accept data. Indicates the number of GPU cycles the pipeline is bottlenecked by pixel operations.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,max,2,max,3,max", "7a8c492a-c566-9328-6805-760dbff5c0f2");
+        c.DefineDerivedCounter("PAStalledOnRasterizerCycles", "PrimitiveAssembly", "Number of GPU cycles the primitive assembly waits for rasterization to be ready to accept data. Indicates the number of GPU cycles the pipeline is bottlenecked by pixel operations.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,max,2,max,3,max", "7a8c492a-c566-9328-6805-760dbff5c0f2", ComputePAStalledOnRasterizerCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1075,7 +8201,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13014);
         internalCounters.push_back(13048);
 
-        c.DefineDerivedCounter("PSPixelsOut", "PixelShader", "Pixels exported from shader to color buffers. Does not include killed or alpha tested pixels; if there are multiple render targets, each render target receives one export, so this will be 2 for 1 pixel written to two RTs.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,8,9,10,11,sum4,12,13,14,15,sum4,sum4", "24cba16c-baa6-6ecd-95ad-92ecb1338da1");
+        c.DefineDerivedCounter("PSPixelsOut", "PixelShader", "Pixels exported from shader to color buffers. Does not include killed or alpha tested pixels; if there are multiple render targets, each render target receives one export, so this will be 2 for 1 pixel written to two RTs.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,8,9,10,11,sum4,12,13,14,15,sum4,sum4", "24cba16c-baa6-6ecd-95ad-92ecb1338da1", ComputePSPixelsOut);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1097,7 +8223,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13050);
         internalCounters.push_back(10620);
 
-        c.DefineDerivedCounter("PSExportStalls", "PixelShader", "Pixel shader output stalls. Percentage of GPUBusy. Should be zero for PS or further upstream limited cases; if not zero, indicates a bottleneck in late Z testing or in the color buffer.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,max,2,max,3,max,4,max,5,max,6,max,7,max,8,max,9,max,10,max,11,max,12,max,13,max,14,max,15,max,16,/,(100),*", "9b4f466c-ff97-22bb-557d-84d3c4c51895");
+        c.DefineDerivedCounter("PSExportStalls", "PixelShader", "Pixel shader output stalls. Percentage of GPUBusy. Should be zero for PS or further upstream limited cases; if not zero, indicates a bottleneck in late Z testing or in the color buffer.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,max,2,max,3,max,4,max,5,max,6,max,7,max,8,max,9,max,10,max,11,max,12,max,13,max,14,max,15,max,16,/,(100),*", "9b4f466c-ff97-22bb-557d-84d3c4c51895", ComputePSExportStalls);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1118,7 +8244,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13016);
         internalCounters.push_back(13050);
 
-        c.DefineDerivedCounter("PSExportStallsCycles", "PixelShader", "Number of GPU cycles the pixel shader output stalls. Should be zero for PS or further upstream limited cases; if not zero, indicates a bottleneck in late Z testing or in the color buffer.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,max,2,max,3,max,4,max,5,max,6,max,7,max,8,max,9,max,10,max,11,max,12,max,13,max,14,max,15,max", "47c72aad-64e6-0864-d533-d8e0bc27c156");
+        c.DefineDerivedCounter("PSExportStallsCycles", "PixelShader", "Number of GPU cycles the pixel shader output stalls. Should be zero for PS or further upstream limited cases; if not zero, indicates a bottleneck in late Z testing or in the color buffer.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,max,2,max,3,max,4,max,5,max,6,max,7,max,8,max,9,max,10,max,11,max,12,max,13,max,14,max,15,max", "47c72aad-64e6-0864-d533-d8e0bc27c156", ComputePSExportStallsCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1131,7 +8257,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(19229);
         internalCounters.push_back(19528);
 
-        c.DefineDerivedCounter("PSVALUInstCount", "PixelShader", "Average number of vector ALU instructions executed in the PS. Affected by flow control.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,/", "eb74389e-435c-4137-ecf1-39eb5bc1cbfe");
+        c.DefineDerivedCounter("PSVALUInstCount", "PixelShader", "Average number of vector ALU instructions executed in the PS. Affected by flow control.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,/", "eb74389e-435c-4137-ecf1-39eb5bc1cbfe", ComputePSVALUInstCount);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1144,7 +8270,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(19229);
         internalCounters.push_back(19528);
 
-        c.DefineDerivedCounter("PSSALUInstCount", "PixelShader", "Average number of scalar ALU instructions executed in the PS. Affected by flow control.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,/", "e6a06580-8a82-96d6-976c-acc121fc5516");
+        c.DefineDerivedCounter("PSSALUInstCount", "PixelShader", "Average number of scalar ALU instructions executed in the PS. Affected by flow control.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,/", "e6a06580-8a82-96d6-976c-acc121fc5516", ComputePSSALUInstCount);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1154,7 +8280,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(19605);
         internalCounters.push_back(10620);
 
-        c.DefineDerivedCounter("PSVALUBusy", "PixelShader", "The percentage of GPUTime vector ALU instructions are being processed by the PS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,sum4,(4),*,NUM_SIMDS,/,4,/,(100),*", "6ce6fef7-8e33-10b4-f351-af755e177e85");
+        c.DefineDerivedCounter("PSVALUBusy", "PixelShader", "The percentage of GPUTime vector ALU instructions are being processed by the PS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,sum4,(4),*,NUM_SIMDS,/,4,/,(100),*", "6ce6fef7-8e33-10b4-f351-af755e177e85", ComputePSVALUBusy);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1163,7 +8289,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(19306);
         internalCounters.push_back(19605);
 
-        c.DefineDerivedCounter("PSVALUBusyCycles", "PixelShader", "Number of GPU cycles where vector ALU instructions are being processed by the PS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,2,3,sum4,(4),*,NUM_SIMDS,/", "1e276f86-cd2a-72e7-fc9d-004f666f2981");
+        c.DefineDerivedCounter("PSVALUBusyCycles", "PixelShader", "Number of GPU cycles where vector ALU instructions are being processed by the PS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,2,3,sum4,(4),*,NUM_SIMDS,/", "1e276f86-cd2a-72e7-fc9d-004f666f2981", ComputePSVALUBusyCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1173,7 +8299,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(19610);
         internalCounters.push_back(10620);
 
-        c.DefineDerivedCounter("PSSALUBusy", "PixelShader", "The percentage of GPUTime scalar ALU instructions are being processed by the PS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,sum4,NUM_CUS,/,4,/,(100),*", "2ff9f34f-e94b-af4d-18c2-5fbbf6d1727a");
+        c.DefineDerivedCounter("PSSALUBusy", "PixelShader", "The percentage of GPUTime scalar ALU instructions are being processed by the PS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,sum4,NUM_CUS,/,4,/,(100),*", "2ff9f34f-e94b-af4d-18c2-5fbbf6d1727a", ComputePSSALUBusy);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1182,7 +8308,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(19311);
         internalCounters.push_back(19610);
 
-        c.DefineDerivedCounter("PSSALUBusyCycles", "PixelShader", "Number of GPU cycles where scalar ALU instructions are being processed by the PS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,2,3,sum4,NUM_CUS,/", "29808906-f128-b078-fc79-820a4b3b3b8d");
+        c.DefineDerivedCounter("PSSALUBusyCycles", "PixelShader", "Number of GPU cycles where scalar ALU instructions are being processed by the PS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,2,3,sum4,NUM_CUS,/", "29808906-f128-b078-fc79-820a4b3b3b8d", ComputePSSALUBusyCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1195,7 +8321,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13514);
         internalCounters.push_back(13711);
 
-        c.DefineDerivedCounter("CSThreadGroups", "ComputeShader", "Total number of thread groups.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,sum8", "8ce3fc80-56b2-97f9-8e70-2e8c747cea68");
+        c.DefineDerivedCounter("CSThreadGroups", "ComputeShader", "Total number of thread groups.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,sum8", "8ce3fc80-56b2-97f9-8e70-2e8c747cea68", ComputeCSThreadGroups);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1208,7 +8334,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13517);
         internalCounters.push_back(13714);
 
-        c.DefineDerivedCounter("CSWavefronts", "ComputeShader", "The total number of wavefronts used for the CS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,sum8", "42379c6e-369b-c237-8b25-cdb9cdc65c4d");
+        c.DefineDerivedCounter("CSWavefronts", "ComputeShader", "The total number of wavefronts used for the CS.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,sum8", "42379c6e-369b-c237-8b25-cdb9cdc65c4d", ComputeCSWavefronts);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1225,7 +8351,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(22827);
         internalCounters.push_back(23126);
 
-        c.DefineDerivedCounter("CSThreads", "ComputeShader", "The number of CS threads processed by the hardware.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "(0),0,1,2,3,4,5,6,7,sum8,8,9,10,11,sum4,ifnotzero", "7a648013-6eac-2665-ac36-13c6f4ac9c26");
+        c.DefineDerivedCounter("CSThreads", "ComputeShader", "The number of CS threads processed by the hardware.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "(0),0,1,2,3,4,5,6,7,sum8,8,9,10,11,sum4,ifnotzero", "7a648013-6eac-2665-ac36-13c6f4ac9c26", ComputeCSThreads);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1246,7 +8372,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13514);
         internalCounters.push_back(13711);
 
-        c.DefineDerivedCounter("CSVALUInsts", "ComputeShader", "The average number of vector ALU instructions executed per work-item (affected by flow control).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,12,13,14,15,sum8,ifnotzero", "376cb1cc-5a40-9d1d-404c-f1736c0c5084");
+        c.DefineDerivedCounter("CSVALUInsts", "ComputeShader", "The average number of vector ALU instructions executed per work-item (affected by flow control).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,12,13,14,15,sum8,ifnotzero", "376cb1cc-5a40-9d1d-404c-f1736c0c5084", ComputeCSVALUInsts);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1267,7 +8393,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13514);
         internalCounters.push_back(13711);
 
-        c.DefineDerivedCounter("CSVALUUtilization", "ComputeShader", "The percentage of active vector ALU threads in a wave. A lower number can mean either more thread divergence in a wave or that the work-group size is not a multiple of 64. Value range: 0% (bad), 100% (ideal - no thread divergence).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,(64),*,/,(100),*,8,9,10,11,12,13,14,15,sum8,ifnotzero,(100),min", "4476879e-cdc0-d602-b24e-9b4a8d38438f");
+        c.DefineDerivedCounter("CSVALUUtilization", "ComputeShader", "The percentage of active vector ALU threads in a wave. A lower number can mean either more thread divergence in a wave or that the work-group size is not a multiple of 64. Value range: 0% (bad), 100% (ideal - no thread divergence).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,(64),*,/,(100),*,8,9,10,11,12,13,14,15,sum8,ifnotzero,(100),min", "4476879e-cdc0-d602-b24e-9b4a8d38438f", ComputeCSVALUUtilization);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1288,7 +8414,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13514);
         internalCounters.push_back(13711);
 
-        c.DefineDerivedCounter("CSSALUInsts", "ComputeShader", "The average number of scalar ALU instructions executed per work-item (affected by flow control).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,12,13,14,15,sum8,ifnotzero", "eb211144-8136-ff86-e8bf-4d0493a904cb");
+        c.DefineDerivedCounter("CSSALUInsts", "ComputeShader", "The average number of scalar ALU instructions executed per work-item (affected by flow control).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,12,13,14,15,sum8,ifnotzero", "eb211144-8136-ff86-e8bf-4d0493a904cb", ComputeCSSALUInsts);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1373,7 +8499,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13514);
         internalCounters.push_back(13711);
 
-        c.DefineDerivedCounter("CSVFetchInsts", "ComputeShader", "The average number of vector fetch instructions from the video memory executed per work-item (affected by flow control).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,sum64,-,68,69,70,71,sum4,/,72,73,74,75,76,77,78,79,sum8,ifnotzero", "3e2829c0-6215-783b-c271-6d57ff2c520e");
+        c.DefineDerivedCounter("CSVFetchInsts", "ComputeShader", "The average number of vector fetch instructions from the video memory executed per work-item (affected by flow control).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,sum64,-,68,69,70,71,sum4,/,72,73,74,75,76,77,78,79,sum8,ifnotzero", "3e2829c0-6215-783b-c271-6d57ff2c520e", ComputeCSVFetchInsts);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1394,7 +8520,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13514);
         internalCounters.push_back(13711);
 
-        c.DefineDerivedCounter("CSSFetchInsts", "ComputeShader", "The average number of scalar fetch instructions from the video memory executed per work-item (affected by flow control).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,12,13,14,15,sum8,ifnotzero", "da09171c-6a0a-584f-fddc-dc5062d63a3e");
+        c.DefineDerivedCounter("CSSFetchInsts", "ComputeShader", "The average number of scalar fetch instructions from the video memory executed per work-item (affected by flow control).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,12,13,14,15,sum8,ifnotzero", "da09171c-6a0a-584f-fddc-dc5062d63a3e", ComputeCSSFetchInsts);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1479,7 +8605,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13514);
         internalCounters.push_back(13711);
 
-        c.DefineDerivedCounter("CSVWriteInsts", "ComputeShader", "The average number of vector write instructions to the video memory executed per work-item (affected by flow control).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,sum64,-,68,69,70,71,sum4,/,72,73,74,75,76,77,78,79,sum8,ifnotzero", "43438c22-e910-b377-b767-b32902e0df0d");
+        c.DefineDerivedCounter("CSVWriteInsts", "ComputeShader", "The average number of vector write instructions to the video memory executed per work-item (affected by flow control).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,sum64,-,68,69,70,71,sum4,/,72,73,74,75,76,77,78,79,sum8,ifnotzero", "43438c22-e910-b377-b767-b32902e0df0d", ComputeCSVWriteInsts);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1504,7 +8630,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13514);
         internalCounters.push_back(13711);
 
-        c.DefineDerivedCounter("CSFlatVMemInsts", "ComputeShader", "The average number of FLAT instructions that read from or write to the video memory executed per work item (affected by flow control). Includes FLAT instructions that read from or write to scratch.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,-,8,9,10,11,sum4,/,12,13,14,15,16,17,18,19,sum8,ifnotzero", "2570b477-13e3-f5b6-e6ff-7159373bc74d");
+        c.DefineDerivedCounter("CSFlatVMemInsts", "ComputeShader", "The average number of FLAT instructions that read from or write to the video memory executed per work item (affected by flow control). Includes FLAT instructions that read from or write to scratch.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,-,8,9,10,11,sum4,/,12,13,14,15,16,17,18,19,sum8,ifnotzero", "2570b477-13e3-f5b6-e6ff-7159373bc74d", ComputeCSFlatVMemInsts);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1522,7 +8648,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13514);
         internalCounters.push_back(13711);
 
-        c.DefineDerivedCounter("CSVALUBusy", "ComputeShader", "The percentage of GPUTime vector ALU instructions are processed. Value range: 0% (bad) to 100% (optimal).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),0,1,2,3,sum4,(4),*,NUM_SIMDS,/,4,/,(100),*,5,6,7,8,9,10,11,12,sum8,ifnotzero", "f1e64815-f6a8-c277-d4f9-d054b443e205");
+        c.DefineDerivedCounter("CSVALUBusy", "ComputeShader", "The percentage of GPUTime vector ALU instructions are processed. Value range: 0% (bad) to 100% (optimal).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),0,1,2,3,sum4,(4),*,NUM_SIMDS,/,4,/,(100),*,5,6,7,8,9,10,11,12,sum8,ifnotzero", "f1e64815-f6a8-c277-d4f9-d054b443e205", ComputeCSVALUBusy);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1539,7 +8665,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13514);
         internalCounters.push_back(13711);
 
-        c.DefineDerivedCounter("CSVALUBusyCycles", "ComputeShader", "Number of GPU cycles where vector ALU instructions are processed.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "(0),0,1,2,3,sum4,(4),*,NUM_SIMDS,/,4,5,6,7,8,9,10,11,sum8,ifnotzero", "2d0d5852-2658-eb73-68d2-f23f7118c9c3");
+        c.DefineDerivedCounter("CSVALUBusyCycles", "ComputeShader", "Number of GPU cycles where vector ALU instructions are processed.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "(0),0,1,2,3,sum4,(4),*,NUM_SIMDS,/,4,5,6,7,8,9,10,11,sum8,ifnotzero", "2d0d5852-2658-eb73-68d2-f23f7118c9c3", ComputeCSVALUBusyCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1557,7 +8683,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13514);
         internalCounters.push_back(13711);
 
-        c.DefineDerivedCounter("CSSALUBusy", "ComputeShader", "The percentage of GPUTime scalar ALU instructions are processed. Value range: 0% (bad) to 100% (optimal).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),0,1,2,3,sum4,NUM_CUS,/,4,/,(100),*,5,6,7,8,9,10,11,12,sum8,ifnotzero", "3fc35f4e-9882-94e3-6f5f-4e81cd97082a");
+        c.DefineDerivedCounter("CSSALUBusy", "ComputeShader", "The percentage of GPUTime scalar ALU instructions are processed. Value range: 0% (bad) to 100% (optimal).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),0,1,2,3,sum4,NUM_CUS,/,4,/,(100),*,5,6,7,8,9,10,11,12,sum8,ifnotzero", "3fc35f4e-9882-94e3-6f5f-4e81cd97082a", ComputeCSSALUBusy);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1574,7 +8700,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13514);
         internalCounters.push_back(13711);
 
-        c.DefineDerivedCounter("CSSALUBusyCycles", "ComputeShader", "Number of GPU cycles where scalar ALU instructions are processed.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "(0),0,1,2,3,sum4,NUM_CUS,/,4,5,6,7,8,9,10,11,sum8,ifnotzero", "de58f8fc-8ed4-a799-648d-62ded7b1c4c4");
+        c.DefineDerivedCounter("CSSALUBusyCycles", "ComputeShader", "Number of GPU cycles where scalar ALU instructions are processed.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "(0),0,1,2,3,sum4,NUM_CUS,/,4,5,6,7,8,9,10,11,sum8,ifnotzero", "de58f8fc-8ed4-a799-648d-62ded7b1c4c4", ComputeCSSALUBusyCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1652,7 +8778,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13514);
         internalCounters.push_back(13711);
 
-        c.DefineDerivedCounter("CSMemUnitBusy", "ComputeShader", "The percentage of GPUTime the memory unit is active. The result includes the stall time (MemUnitStalled). This is measured with all extra fetches and writes and any cache or memory effects taken into account. Value range: 0% to 100% (fetch-bound).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64,64,/,(100),*,65,66,67,68,69,70,71,72,sum8,ifnotzero", "42ab96e1-0a24-96c8-c4ff-098fa267d78e");
+        c.DefineDerivedCounter("CSMemUnitBusy", "ComputeShader", "The percentage of GPUTime the memory unit is active. The result includes the stall time (MemUnitStalled). This is measured with all extra fetches and writes and any cache or memory effects taken into account. Value range: 0% to 100% (fetch-bound).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64,64,/,(100),*,65,66,67,68,69,70,71,72,sum8,ifnotzero", "42ab96e1-0a24-96c8-c4ff-098fa267d78e", ComputeCSMemUnitBusy);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1729,7 +8855,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13514);
         internalCounters.push_back(13711);
 
-        c.DefineDerivedCounter("CSMemUnitBusyCycles", "ComputeShader", "Number of GPU cycles the memory unit is active. The result includes the stall time (MemUnitStalled). This is measured with all extra fetches and writes and any cache or memory effects taken into account.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "(0),0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64,64,65,66,67,68,69,70,71,sum8,ifnotzero", "39d5687f-c727-7c0c-af82-bb711d3897ed");
+        c.DefineDerivedCounter("CSMemUnitBusyCycles", "ComputeShader", "Number of GPU cycles the memory unit is active. The result includes the stall time (MemUnitStalled). This is measured with all extra fetches and writes and any cache or memory effects taken into account.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "(0),0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64,64,65,66,67,68,69,70,71,sum8,ifnotzero", "39d5687f-c727-7c0c-af82-bb711d3897ed", ComputeCSMemUnitBusyCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1807,7 +8933,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13514);
         internalCounters.push_back(13711);
 
-        c.DefineDerivedCounter("CSMemUnitStalled", "ComputeShader", "The percentage of GPUTime the memory unit is stalled. Try reducing the number or size of fetches and writes if possible. Value range: 0% (optimal) to 100% (bad).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64,64,/,(100),*,65,66,67,68,69,70,71,72,sum8,ifnotzero", "f18e8679-1511-d533-d9ee-4365197f7d0c");
+        c.DefineDerivedCounter("CSMemUnitStalled", "ComputeShader", "The percentage of GPUTime the memory unit is stalled. Try reducing the number or size of fetches and writes if possible. Value range: 0% (optimal) to 100% (bad).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64,64,/,(100),*,65,66,67,68,69,70,71,72,sum8,ifnotzero", "f18e8679-1511-d533-d9ee-4365197f7d0c", ComputeCSMemUnitStalled);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1884,7 +9010,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13514);
         internalCounters.push_back(13711);
 
-        c.DefineDerivedCounter("CSMemUnitStalledCycles", "ComputeShader", "Number of GPU cycles the memory unit is stalled. Try reducing the number or size of fetches and writes if possible.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "(0),0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64,64,65,66,67,68,69,70,71,sum8,ifnotzero", "51991c84-ed2b-bf31-c4ab-8f8e9eb8f29f");
+        c.DefineDerivedCounter("CSMemUnitStalledCycles", "ComputeShader", "Number of GPU cycles the memory unit is stalled. Try reducing the number or size of fetches and writes if possible.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "(0),0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64,64,65,66,67,68,69,70,71,sum8,ifnotzero", "51991c84-ed2b-bf31-c4ab-8f8e9eb8f29f", ComputeCSMemUnitStalledCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1914,7 +9040,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13514);
         internalCounters.push_back(13711);
 
-        c.DefineDerivedCounter("CSWriteUnitStalled", "ComputeShader", "The percentage of GPUTime the write unit is stalled.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16,16,/,(100),*,17,18,19,20,21,22,23,24,sum8,ifnotzero", "55118f7a-8f92-726f-78c6-407f689a2eb4");
+        c.DefineDerivedCounter("CSWriteUnitStalled", "ComputeShader", "The percentage of GPUTime the write unit is stalled.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16,16,/,(100),*,17,18,19,20,21,22,23,24,sum8,ifnotzero", "55118f7a-8f92-726f-78c6-407f689a2eb4", ComputeCSWriteUnitStalled);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1943,7 +9069,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13514);
         internalCounters.push_back(13711);
 
-        c.DefineDerivedCounter("CSWriteUnitStalledCycles", "ComputeShader", "Number of GPU cycles the write unit is stalled.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "(0),0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16,16,17,18,19,20,21,22,23,sum8,ifnotzero", "be164c60-5e48-acac-9622-29616d09aa9a");
+        c.DefineDerivedCounter("CSWriteUnitStalledCycles", "ComputeShader", "Number of GPU cycles the write unit is stalled.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "(0),0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16,16,17,18,19,20,21,22,23,sum8,ifnotzero", "be164c60-5e48-acac-9622-29616d09aa9a", ComputeCSWriteUnitStalledCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1964,7 +9090,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13514);
         internalCounters.push_back(13711);
 
-        c.DefineDerivedCounter("CSGDSInsts", "ComputeShader", "The average number of GDS read or GDS write instructions executed per work item (affected by flow control).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,12,13,14,15,sum8,ifnotzero", "2a867f3e-4a37-ad16-55d1-f03d74707819");
+        c.DefineDerivedCounter("CSGDSInsts", "ComputeShader", "The average number of GDS read or GDS write instructions executed per work item (affected by flow control).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,12,13,14,15,sum8,ifnotzero", "2a867f3e-4a37-ad16-55d1-f03d74707819", ComputeCSGDSInsts);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -1989,7 +9115,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13514);
         internalCounters.push_back(13711);
 
-        c.DefineDerivedCounter("CSLDSInsts", "ComputeShader", "The average number of LDS read/write instructions executed per work-item (affected by flow control).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,-,8,9,10,11,sum4,/,12,13,14,15,16,17,18,19,sum8,ifnotzero", "61b0b351-7e06-ef8e-a8e0-7a9e3200a836");
+        c.DefineDerivedCounter("CSLDSInsts", "ComputeShader", "The average number of LDS read/write instructions executed per work-item (affected by flow control).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,-,8,9,10,11,sum4,/,12,13,14,15,16,17,18,19,sum8,ifnotzero", "61b0b351-7e06-ef8e-a8e0-7a9e3200a836", ComputeCSLDSInsts);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -2010,7 +9136,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13514);
         internalCounters.push_back(13711);
 
-        c.DefineDerivedCounter("CSFlatLDSInsts", "ComputeShader", "The average number of FLAT instructions that read from or write to LDS executed per work item (affected by flow control).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,12,13,14,15,sum8,ifnotzero", "99672cda-de2b-014c-482e-cf73b90068d5");
+        c.DefineDerivedCounter("CSFlatLDSInsts", "ComputeShader", "The average number of FLAT instructions that read from or write to LDS executed per work item (affected by flow control).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,12,13,14,15,sum8,ifnotzero", "99672cda-de2b-014c-482e-cf73b90068d5", ComputeCSFlatLDSInsts);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -2032,7 +9158,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13514);
         internalCounters.push_back(13711);
 
-        c.DefineDerivedCounter("CSALUStalledByLDS", "ComputeShader", "The percentage of GPUTime ALU units are stalled by the LDS input queue being full or the output queue being not ready. If there are LDS bank conflicts, reduce them. Otherwise, try reducing the number of LDS accesses if possible. Value range: 0% (optimal) to 100% (bad).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,/,NUM_SHADER_ENGINES,/,(100),*,9,10,11,12,13,14,15,16,sum8,ifnotzero", "6dc4f1c2-bad0-c9ff-156e-883b319a752a");
+        c.DefineDerivedCounter("CSALUStalledByLDS", "ComputeShader", "The percentage of GPUTime ALU units are stalled by the LDS input queue being full or the output queue being not ready. If there are LDS bank conflicts, reduce them. Otherwise, try reducing the number of LDS accesses if possible. Value range: 0% (optimal) to 100% (bad).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,/,NUM_SHADER_ENGINES,/,(100),*,9,10,11,12,13,14,15,16,sum8,ifnotzero", "6dc4f1c2-bad0-c9ff-156e-883b319a752a", ComputeCSALUStalledByLDS);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -2049,7 +9175,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13514);
         internalCounters.push_back(13711);
 
-        c.DefineDerivedCounter("CSALUStalledByLDSCycles", "ComputeShader", "Number of GPU cycles the ALU units are stalled by the LDS input queue being full or the output queue being not ready. If there are LDS bank conflicts, reduce them. Otherwise, try reducing the number of LDS accesses if possible.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "(0),0,1,2,3,sum4,NUM_SHADER_ENGINES,/,4,5,6,7,8,9,10,11,sum8,ifnotzero", "8f3d5f25-2159-0374-fafe-e26a7799b6c8");
+        c.DefineDerivedCounter("CSALUStalledByLDSCycles", "ComputeShader", "Number of GPU cycles the ALU units are stalled by the LDS input queue being full or the output queue being not ready. If there are LDS bank conflicts, reduce them. Otherwise, try reducing the number of LDS accesses if possible.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "(0),0,1,2,3,sum4,NUM_SHADER_ENGINES,/,4,5,6,7,8,9,10,11,sum8,ifnotzero", "8f3d5f25-2159-0374-fafe-e26a7799b6c8", ComputeCSALUStalledByLDSCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -2067,7 +9193,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13514);
         internalCounters.push_back(13711);
 
-        c.DefineDerivedCounter("CSLDSBankConflict", "ComputeShader", "The percentage of GPUTime LDS is stalled by bank conflicts. Value range: 0% (optimal) to 100% (bad).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),0,1,2,3,sum4,4,/,NUM_SIMDS,/,(100),*,5,6,7,8,9,10,11,12,sum8,ifnotzero", "1065ee10-2e41-ea41-1eb3-b61b491752f4");
+        c.DefineDerivedCounter("CSLDSBankConflict", "ComputeShader", "The percentage of GPUTime LDS is stalled by bank conflicts. Value range: 0% (optimal) to 100% (bad).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "(0),0,1,2,3,sum4,4,/,NUM_SIMDS,/,(100),*,5,6,7,8,9,10,11,12,sum8,ifnotzero", "1065ee10-2e41-ea41-1eb3-b61b491752f4", ComputeCSLDSBankConflict);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -2084,7 +9210,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(13514);
         internalCounters.push_back(13711);
 
-        c.DefineDerivedCounter("CSLDSBankConflictCycles", "ComputeShader", "Number of GPU cycles the LDS is stalled by bank conflicts. Value range: 0 (optimal) to GPUBusyCycles (bad).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "(0),0,1,2,3,sum4,NUM_SIMDS,/,4,5,6,7,8,9,10,11,sum8,ifnotzero", "1fd1adf3-c51e-94fd-083e-c482a0a0809e");
+        c.DefineDerivedCounter("CSLDSBankConflictCycles", "ComputeShader", "Number of GPU cycles the LDS is stalled by bank conflicts. Value range: 0 (optimal) to GPUBusyCycles (bad).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "(0),0,1,2,3,sum4,NUM_SIMDS,/,4,5,6,7,8,9,10,11,sum8,ifnotzero", "1fd1adf3-c51e-94fd-083e-c482a0a0809e", ComputeCSLDSBankConflictCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -2154,7 +9280,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(30923);
         internalCounters.push_back(10620);
 
-        c.DefineDerivedCounter("TexUnitBusy", "Timing", "The percentage of GPUTime the texture unit is active. This is measured with all extra fetches and any cache or memory effects taken into account.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64,64,/,(100),*", "36afb8d9-42fc-aafe-66c5-449542153b2c");
+        c.DefineDerivedCounter("TexUnitBusy", "Timing", "The percentage of GPUTime the texture unit is active. This is measured with all extra fetches and any cache or memory effects taken into account.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64,64,/,(100),*", "36afb8d9-42fc-aafe-66c5-449542153b2c", ComputeTexUnitBusy);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -2223,7 +9349,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(30804);
         internalCounters.push_back(30923);
 
-        c.DefineDerivedCounter("TexUnitBusyCycles", "Timing", "Number of GPU cycles the texture unit is active. This is measured with all extra fetches and any cache or memory effects taken into account.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64", "c68761f2-248c-4f39-6528-c308b1c0807c");
+        c.DefineDerivedCounter("TexUnitBusyCycles", "Timing", "Number of GPU cycles the texture unit is active. This is measured with all extra fetches and any cache or memory effects taken into account.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64", "c68761f2-248c-4f39-6528-c308b1c0807c", ComputeTexUnitBusyCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -2356,7 +9482,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(30857);
         internalCounters.push_back(30976);
 
-        c.DefineDerivedCounter("TexTriFilteringPct", "TextureUnit", "Percentage of pixels that received trilinear filtering. Note that not all pixels for which trilinear filtering is enabled will receive it (e.g. if the texture is magnified).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,sum64,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,+,/,(100),*", "1affc3c8-b917-5c81-622b-7004527208ae");
+        c.DefineDerivedCounter("TexTriFilteringPct", "TextureUnit", "Percentage of pixels that received trilinear filtering. Note that not all pixels for which trilinear filtering is enabled will receive it (e.g. if the texture is magnified).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,sum64,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,+,/,(100),*", "1affc3c8-b917-5c81-622b-7004527208ae", ComputeTexTriFilteringPct);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -2425,7 +9551,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(30858);
         internalCounters.push_back(30977);
 
-        c.DefineDerivedCounter("TexTriFilteringCount", "TextureUnit", "Count of pixels that received trilinear filtering. Note that not all pixels for which trilinear filtering is enabled will receive it (e.g. if the texture is magnified).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64", "5785b3a1-a513-18db-4b1c-bdeef75bb2b6");
+        c.DefineDerivedCounter("TexTriFilteringCount", "TextureUnit", "Count of pixels that received trilinear filtering. Note that not all pixels for which trilinear filtering is enabled will receive it (e.g. if the texture is magnified).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64", "5785b3a1-a513-18db-4b1c-bdeef75bb2b6", ComputeTexTriFilteringCount);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -2494,7 +9620,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(30857);
         internalCounters.push_back(30976);
 
-        c.DefineDerivedCounter("NoTexTriFilteringCount", "TextureUnit", "Count of pixels that did not receive trilinear filtering.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64", "179da29a-81af-c06e-ce8c-a0a731ea030d");
+        c.DefineDerivedCounter("NoTexTriFilteringCount", "TextureUnit", "Count of pixels that did not receive trilinear filtering.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64", "179da29a-81af-c06e-ce8c-a0a731ea030d", ComputeNoTexTriFilteringCount);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -2627,7 +9753,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(30859);
         internalCounters.push_back(30978);
 
-        c.DefineDerivedCounter("TexVolFilteringPct", "TextureUnit", "Percentage of pixels that received volume filtering.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,sum64,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,+,/,(100),*", "b5ff6bed-3178-aee4-42dd-c74391c02a2d");
+        c.DefineDerivedCounter("TexVolFilteringPct", "TextureUnit", "Percentage of pixels that received volume filtering.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,sum64,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,+,/,(100),*", "b5ff6bed-3178-aee4-42dd-c74391c02a2d", ComputeTexVolFilteringPct);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -2696,7 +9822,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(30860);
         internalCounters.push_back(30979);
 
-        c.DefineDerivedCounter("TexVolFilteringCount", "TextureUnit", "Count of pixels that received volume filtering.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64", "4bddc587-d589-8128-e18c-762eab2c871f");
+        c.DefineDerivedCounter("TexVolFilteringCount", "TextureUnit", "Count of pixels that received volume filtering.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64", "4bddc587-d589-8128-e18c-762eab2c871f", ComputeTexVolFilteringCount);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -2765,7 +9891,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(30859);
         internalCounters.push_back(30978);
 
-        c.DefineDerivedCounter("NoTexVolFilteringCount", "TextureUnit", "Count of pixels that did not receive volume filtering.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64", "9fe1a854-17c6-9d26-b2b9-80610cd5827d");
+        c.DefineDerivedCounter("NoTexVolFilteringCount", "TextureUnit", "Count of pixels that did not receive volume filtering.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64", "9fe1a854-17c6-9d26-b2b9-80610cd5827d", ComputeNoTexVolFilteringCount);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -3346,7 +10472,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(30886);
         internalCounters.push_back(31005);
 
-        c.DefineDerivedCounter("TexAveAnisotropy", "TextureUnit", "The average degree of anisotropy applied. A number between 1 and 16. The anisotropic filtering algorithm only applies samples where they are required (e.g. there will be no extra anisotropic samples if the view vector is perpendicular to the surface) so this can be much lower than the requested anisotropy.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,(2),64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,sum64,*,+,(4),128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,166,167,168,169,170,171,172,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,sum64,*,+,(6),192,193,194,195,196,197,198,199,200,201,202,203,204,205,206,207,208,209,210,211,212,213,214,215,216,217,218,219,220,221,222,223,224,225,226,227,228,229,230,231,232,233,234,235,236,237,238,239,240,241,242,243,244,245,246,247,248,249,250,251,252,253,254,255,sum64,*,+,(8),256,257,258,259,260,261,262,263,264,265,266,267,268,269,270,271,272,273,274,275,276,277,278,279,280,281,282,283,284,285,286,287,288,289,290,291,292,293,294,295,296,297,298,299,300,301,302,303,304,305,306,307,308,309,310,311,312,313,314,315,316,317,318,319,sum64,*,+,(10),320,321,322,323,324,325,326,327,328,329,330,331,332,333,334,335,336,337,338,339,340,341,342,343,344,345,346,347,348,349,350,351,352,353,354,355,356,357,358,359,360,361,362,363,364,365,366,367,368,369,370,371,372,373,374,375,376,377,378,379,380,381,382,383,sum64,*,+,(12),384,385,386,387,388,389,390,391,392,393,394,395,396,397,398,399,400,401,402,403,404,405,406,407,408,409,410,411,412,413,414,415,416,417,418,419,420,421,422,423,424,425,426,427,428,429,430,431,432,433,434,435,436,437,438,439,440,441,442,443,444,445,446,447,sum64,*,+,(14),448,449,450,451,452,453,454,455,456,457,458,459,460,461,462,463,464,465,466,467,468,469,470,471,472,473,474,475,476,477,478,479,480,481,482,483,484,485,486,487,488,489,490,491,492,493,494,495,496,497,498,499,500,501,502,503,504,505,506,507,508,509,510,511,sum64,*,+,(16),512,513,514,515,516,517,518,519,520,521,522,523,524,525,526,527,528,529,530,531,532,533,534,535,536,537,538,539,540,541,542,543,544,545,546,547,548,549,550,551,552,553,554,555,556,557,558,559,560,561,562,563,564,565,566,567,568,569,570,571,572,573,574,575,sum64,*,+,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,sum64,+,128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,166,167,168,169,170,171,172,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,sum64,+,192,193,194,195,196,197,198,199,200,201,202,203,204,205,206,207,208,209,210,211,212,213,214,215,216,217,218,219,220,221,222,223,224,225,226,227,228,229,230,231,232,233,234,235,236,237,238,239,240,241,242,243,244,245,246,247,248,249,250,251,252,253,254,255,sum64,+,256,257,258,259,260,261,262,263,264,265,266,267,268,269,270,271,272,273,274,275,276,277,278,279,280,281,282,283,284,285,286,287,288,289,290,291,292,293,294,295,296,297,298,299,300,301,302,303,304,305,306,307,308,309,310,311,312,313,314,315,316,317,318,319,sum64,+,320,321,322,323,324,325,326,327,328,329,330,331,332,333,334,335,336,337,338,339,340,341,342,343,344,345,346,347,348,349,350,351,352,353,354,355,356,357,358,359,360,361,362,363,364,365,366,367,368,369,370,371,372,373,374,375,376,377,378,379,380,381,382,383,sum64,+,384,385,386,387,388,389,390,391,392,393,394,395,396,397,398,399,400,401,402,403,404,405,406,407,408,409,410,411,412,413,414,415,416,417,418,419,420,421,422,423,424,425,426,427,428,429,430,431,432,433,434,435,436,437,438,439,440,441,442,443,444,445,446,447,sum64,+,448,449,450,451,452,453,454,455,456,457,458,459,460,461,462,463,464,465,466,467,468,469,470,471,472,473,474,475,476,477,478,479,480,481,482,483,484,485,486,487,488,489,490,491,492,493,494,495,496,497,498,499,500,501,502,503,504,505,506,507,508,509,510,511,sum64,+,512,513,514,515,516,517,518,519,520,521,522,523,524,525,526,527,528,529,530,531,532,533,534,535,536,537,538,539,540,541,542,543,544,545,546,547,548,549,550,551,552,553,554,555,556,557,558,559,560,561,562,563,564,565,566,567,568,569,570,571,572,573,574,575,sum64,+,/", "7ca2a2b9-a4eb-ce23-d163-59147e672396");
+        c.DefineDerivedCounter("TexAveAnisotropy", "TextureUnit", "The average degree of anisotropy applied. A number between 1 and 16. The anisotropic filtering algorithm only applies samples where they are required (e.g. there will be no extra anisotropic samples if the view vector is perpendicular to the surface) so this can be much lower than the requested anisotropy.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,(2),64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,sum64,*,+,(4),128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,166,167,168,169,170,171,172,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,sum64,*,+,(6),192,193,194,195,196,197,198,199,200,201,202,203,204,205,206,207,208,209,210,211,212,213,214,215,216,217,218,219,220,221,222,223,224,225,226,227,228,229,230,231,232,233,234,235,236,237,238,239,240,241,242,243,244,245,246,247,248,249,250,251,252,253,254,255,sum64,*,+,(8),256,257,258,259,260,261,262,263,264,265,266,267,268,269,270,271,272,273,274,275,276,277,278,279,280,281,282,283,284,285,286,287,288,289,290,291,292,293,294,295,296,297,298,299,300,301,302,303,304,305,306,307,308,309,310,311,312,313,314,315,316,317,318,319,sum64,*,+,(10),320,321,322,323,324,325,326,327,328,329,330,331,332,333,334,335,336,337,338,339,340,341,342,343,344,345,346,347,348,349,350,351,352,353,354,355,356,357,358,359,360,361,362,363,364,365,366,367,368,369,370,371,372,373,374,375,376,377,378,379,380,381,382,383,sum64,*,+,(12),384,385,386,387,388,389,390,391,392,393,394,395,396,397,398,399,400,401,402,403,404,405,406,407,408,409,410,411,412,413,414,415,416,417,418,419,420,421,422,423,424,425,426,427,428,429,430,431,432,433,434,435,436,437,438,439,440,441,442,443,444,445,446,447,sum64,*,+,(14),448,449,450,451,452,453,454,455,456,457,458,459,460,461,462,463,464,465,466,467,468,469,470,471,472,473,474,475,476,477,478,479,480,481,482,483,484,485,486,487,488,489,490,491,492,493,494,495,496,497,498,499,500,501,502,503,504,505,506,507,508,509,510,511,sum64,*,+,(16),512,513,514,515,516,517,518,519,520,521,522,523,524,525,526,527,528,529,530,531,532,533,534,535,536,537,538,539,540,541,542,543,544,545,546,547,548,549,550,551,552,553,554,555,556,557,558,559,560,561,562,563,564,565,566,567,568,569,570,571,572,573,574,575,sum64,*,+,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,sum64,+,128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,166,167,168,169,170,171,172,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,sum64,+,192,193,194,195,196,197,198,199,200,201,202,203,204,205,206,207,208,209,210,211,212,213,214,215,216,217,218,219,220,221,222,223,224,225,226,227,228,229,230,231,232,233,234,235,236,237,238,239,240,241,242,243,244,245,246,247,248,249,250,251,252,253,254,255,sum64,+,256,257,258,259,260,261,262,263,264,265,266,267,268,269,270,271,272,273,274,275,276,277,278,279,280,281,282,283,284,285,286,287,288,289,290,291,292,293,294,295,296,297,298,299,300,301,302,303,304,305,306,307,308,309,310,311,312,313,314,315,316,317,318,319,sum64,+,320,321,322,323,324,325,326,327,328,329,330,331,332,333,334,335,336,337,338,339,340,341,342,343,344,345,346,347,348,349,350,351,352,353,354,355,356,357,358,359,360,361,362,363,364,365,366,367,368,369,370,371,372,373,374,375,376,377,378,379,380,381,382,383,sum64,+,384,385,386,387,388,389,390,391,392,393,394,395,396,397,398,399,400,401,402,403,404,405,406,407,408,409,410,411,412,413,414,415,416,417,418,419,420,421,422,423,424,425,426,427,428,429,430,431,432,433,434,435,436,437,438,439,440,441,442,443,444,445,446,447,sum64,+,448,449,450,451,452,453,454,455,456,457,458,459,460,461,462,463,464,465,466,467,468,469,470,471,472,473,474,475,476,477,478,479,480,481,482,483,484,485,486,487,488,489,490,491,492,493,494,495,496,497,498,499,500,501,502,503,504,505,506,507,508,509,510,511,sum64,+,512,513,514,515,516,517,518,519,520,521,522,523,524,525,526,527,528,529,530,531,532,533,534,535,536,537,538,539,540,541,542,543,544,545,546,547,548,549,550,551,552,553,554,555,556,557,558,559,560,561,562,563,564,565,566,567,568,569,570,571,572,573,574,575,sum64,+,/", "7ca2a2b9-a4eb-ce23-d163-59147e672396", ComputeTexAveAnisotropy);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -3368,7 +10494,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(10505);
         internalCounters.push_back(10620);
 
-        c.DefineDerivedCounter("DepthStencilTestBusy", "Timing", "Percentage of time GPU spent performing depth and stencil tests relative to GPUBusy.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16,16,/,(100),*", "6834fb52-42e8-bb50-fd48-ec2f2904e7e0");
+        c.DefineDerivedCounter("DepthStencilTestBusy", "Timing", "Percentage of time GPU spent performing depth and stencil tests relative to GPUBusy.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16,16,/,(100),*", "6834fb52-42e8-bb50-fd48-ec2f2904e7e0", ComputeDepthStencilTestBusy);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -3389,7 +10515,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(10248);
         internalCounters.push_back(10505);
 
-        c.DefineDerivedCounter("DepthStencilTestBusyCount", "Timing", "Number of GPU cycles spent performing depth and stencil tests.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16", "e02860fa-c7bd-90ea-2149-69b4e98a636c");
+        c.DefineDerivedCounter("DepthStencilTestBusyCount", "Timing", "Number of GPU cycles spent performing depth and stencil tests.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16", "e02860fa-c7bd-90ea-2149-69b4e98a636c", ComputeDepthStencilTestBusyCount);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -3426,7 +10552,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(10108);
         internalCounters.push_back(10365);
 
-        c.DefineDerivedCounter("HiZTilesAccepted", "DepthAndStencil", "Percentage of tiles accepted by HiZ and will be rendered to the depth or color buffers.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,/,(100),*", "56176f45-d7ff-813d-4f05-3b2f046067e7");
+        c.DefineDerivedCounter("HiZTilesAccepted", "DepthAndStencil", "Percentage of tiles accepted by HiZ and will be rendered to the depth or color buffers.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,/,(100),*", "56176f45-d7ff-813d-4f05-3b2f046067e7", ComputeHiZTilesAccepted);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -3447,7 +10573,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(10108);
         internalCounters.push_back(10365);
 
-        c.DefineDerivedCounter("HiZTilesAcceptedCount", "DepthAndStencil", "Count of tiles accepted by HiZ and will be rendered to the depth or color buffers.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", "95d4e3f6-b2f0-f26e-8423-aacdfaf79ea3");
+        c.DefineDerivedCounter("HiZTilesAcceptedCount", "DepthAndStencil", "Count of tiles accepted by HiZ and will be rendered to the depth or color buffers.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", "95d4e3f6-b2f0-f26e-8423-aacdfaf79ea3", ComputeHiZTilesAcceptedCount);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -3468,7 +10594,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(10119);
         internalCounters.push_back(10376);
 
-        c.DefineDerivedCounter("HiZTilesRejectedCount", "DepthAndStencil", "Count of tiles not accepted by HiZ.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", "156ba142-7eeb-aa6e-a00a-f8aea4e41e0b");
+        c.DefineDerivedCounter("HiZTilesRejectedCount", "DepthAndStencil", "Count of tiles not accepted by HiZ.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", "156ba142-7eeb-aa6e-a00a-f8aea4e41e0b", ComputeHiZTilesRejectedCount);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -3505,7 +10631,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(10132);
         internalCounters.push_back(10389);
 
-        c.DefineDerivedCounter("PreZTilesDetailCulled", "DepthAndStencil", "Percentage of tiles rejected because the associated prim had no contributing area.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,/,(100),*", "cad7f54d-a044-7574-c472-6f2065cbeeac");
+        c.DefineDerivedCounter("PreZTilesDetailCulled", "DepthAndStencil", "Percentage of tiles rejected because the associated prim had no contributing area.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,/,(100),*", "cad7f54d-a044-7574-c472-6f2065cbeeac", ComputePreZTilesDetailCulled);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -3526,7 +10652,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(10132);
         internalCounters.push_back(10389);
 
-        c.DefineDerivedCounter("PreZTilesDetailCulledCount", "DepthAndStencil", "Count of tiles rejected because the associated primitive had no contributing area.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", "49262c8a-b1e6-90dd-f096-0fc4921715e9");
+        c.DefineDerivedCounter("PreZTilesDetailCulledCount", "DepthAndStencil", "Count of tiles rejected because the associated primitive had no contributing area.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", "49262c8a-b1e6-90dd-f096-0fc4921715e9", ComputePreZTilesDetailCulledCount);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -3547,7 +10673,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(10108);
         internalCounters.push_back(10365);
 
-        c.DefineDerivedCounter("PreZTilesDetailSurvivingCount", "DepthAndStencil", "Count of tiles surviving because the associated primitive had contributing area.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", "f803eaa4-bbed-bd39-775f-a64df92e2c08");
+        c.DefineDerivedCounter("PreZTilesDetailSurvivingCount", "DepthAndStencil", "Count of tiles surviving because the associated primitive had contributing area.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", "f803eaa4-bbed-bd39-775f-a64df92e2c08", ComputePreZTilesDetailSurvivingCount);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -3584,7 +10710,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(12367);
         internalCounters.push_back(12764);
 
-        c.DefineDerivedCounter("HiZQuadsCulled", "DepthAndStencil", "Percentage of quads that did not have to continue on in the pipeline after HiZ. They may be written directly to the depth buffer, or culled completely. Consistently low values here may suggest that the Z-range is not being fully utilized.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,-,(0),max,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,/,(100),*", "fa0e319b-5573-6d34-5bab-904769925036");
+        c.DefineDerivedCounter("HiZQuadsCulled", "DepthAndStencil", "Percentage of quads that did not have to continue on in the pipeline after HiZ. They may be written directly to the depth buffer, or culled completely. Consistently low values here may suggest that the Z-range is not being fully utilized.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,-,(0),max,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,/,(100),*", "fa0e319b-5573-6d34-5bab-904769925036", ComputeHiZQuadsCulled);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -3621,7 +10747,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(12367);
         internalCounters.push_back(12764);
 
-        c.DefineDerivedCounter("HiZQuadsCulledCount", "DepthAndStencil", "Count of quads that did not have to continue on in the pipeline after HiZ. They may be written directly to the depth buffer, or culled completely. Consistently low values here may suggest that the Z-range is not being fully utilized.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,-,(0),max", "73b0b39d-6df2-3e24-0b5c-7cb0ac8b6f39");
+        c.DefineDerivedCounter("HiZQuadsCulledCount", "DepthAndStencil", "Count of quads that did not have to continue on in the pipeline after HiZ. They may be written directly to the depth buffer, or culled completely. Consistently low values here may suggest that the Z-range is not being fully utilized.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,-,(0),max", "73b0b39d-6df2-3e24-0b5c-7cb0ac8b6f39", ComputeHiZQuadsCulledCount);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -3642,7 +10768,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(12367);
         internalCounters.push_back(12764);
 
-        c.DefineDerivedCounter("HiZQuadsAcceptedCount", "DepthAndStencil", "Count of quads that did continue on in the pipeline after HiZ.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", "59049ad9-42b5-c7cb-3616-6a8f6a8e4894");
+        c.DefineDerivedCounter("HiZQuadsAcceptedCount", "DepthAndStencil", "Count of quads that did continue on in the pipeline after HiZ.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", "59049ad9-42b5-c7cb-3616-6a8f6a8e4894", ComputeHiZQuadsAcceptedCount);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -3683,7 +10809,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(12367);
         internalCounters.push_back(12764);
 
-        c.DefineDerivedCounter("PreZQuadsCulled", "DepthAndStencil", "Percentage of quads rejected based on the detailZ and earlyZ tests.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,sum16,16,17,18,19,sum4,-,(0),max,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,/,(100),*", "4e77547b-ec55-5663-f034-af59be66d77d");
+        c.DefineDerivedCounter("PreZQuadsCulled", "DepthAndStencil", "Percentage of quads rejected based on the detailZ and earlyZ tests.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,sum16,16,17,18,19,sum4,-,(0),max,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,/,(100),*", "4e77547b-ec55-5663-f034-af59be66d77d", ComputePreZQuadsCulled);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -3708,7 +10834,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(12367);
         internalCounters.push_back(12764);
 
-        c.DefineDerivedCounter("PreZQuadsCulledCount", "DepthAndStencil", "Count of quads rejected based on the detailZ and earlyZ tests.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,sum4,+", "1bf169e6-9304-834e-df5f-0c44d7890a08");
+        c.DefineDerivedCounter("PreZQuadsCulledCount", "DepthAndStencil", "Count of quads rejected based on the detailZ and earlyZ tests.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,sum4,+", "1bf169e6-9304-834e-df5f-0c44d7890a08", ComputePreZQuadsCulledCount);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -3745,7 +10871,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(12367);
         internalCounters.push_back(12764);
 
-        c.DefineDerivedCounter("PreZQuadsSurvivingCount", "DepthAndStencil", "Count of quads surviving detailZ and earlyZ tests.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,-,(0),max", "50e25e51-3713-89cb-7f92-559cde5e5532");
+        c.DefineDerivedCounter("PreZQuadsSurvivingCount", "DepthAndStencil", "Count of quads surviving detailZ and earlyZ tests.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,-,(0),max", "50e25e51-3713-89cb-7f92-559cde5e5532", ComputePreZQuadsSurvivingCount);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -3770,7 +10896,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(12291);
         internalCounters.push_back(12688);
 
-        c.DefineDerivedCounter("PostZQuads", "DepthAndStencil", "Percentage of quads for which the pixel shader will run and may be postZ tested.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,sum4,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,sum16,/,(100),*", "58f0d34b-eeb8-e8db-abce-cb72584144be");
+        c.DefineDerivedCounter("PostZQuads", "DepthAndStencil", "Percentage of quads for which the pixel shader will run and may be postZ tested.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,sum4,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,sum16,/,(100),*", "58f0d34b-eeb8-e8db-abce-cb72584144be", ComputePostZQuads);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -3779,7 +10905,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(12388);
         internalCounters.push_back(12785);
 
-        c.DefineDerivedCounter("PostZQuadCount", "DepthAndStencil", "Count of quads for which the pixel shader will run and may be postZ tested.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,sum4", "08404526-ce35-939b-34c8-a7a35a0ff4d6");
+        c.DefineDerivedCounter("PostZQuadCount", "DepthAndStencil", "Count of quads for which the pixel shader will run and may be postZ tested.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,sum4", "08404526-ce35-939b-34c8-a7a35a0ff4d6", ComputePostZQuadCount);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -3800,7 +10926,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(10281);
         internalCounters.push_back(10538);
 
-        c.DefineDerivedCounter("PreZSamplesPassing", "DepthAndStencil", "Number of samples tested for Z before shading and passed.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", "3bfe6c4d-7422-ca03-7ea5-e67ff1a00136");
+        c.DefineDerivedCounter("PreZSamplesPassing", "DepthAndStencil", "Number of samples tested for Z before shading and passed.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", "3bfe6c4d-7422-ca03-7ea5-e67ff1a00136", ComputePreZSamplesPassing);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -3821,7 +10947,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(10283);
         internalCounters.push_back(10540);
 
-        c.DefineDerivedCounter("PreZSamplesFailingS", "DepthAndStencil", "Number of samples tested for Z before shading and failed stencil test.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", "df7f705e-5162-d3b5-da8b-63466cf9c4e5");
+        c.DefineDerivedCounter("PreZSamplesFailingS", "DepthAndStencil", "Number of samples tested for Z before shading and failed stencil test.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", "df7f705e-5162-d3b5-da8b-63466cf9c4e5", ComputePreZSamplesFailingS);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -3842,7 +10968,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(10282);
         internalCounters.push_back(10539);
 
-        c.DefineDerivedCounter("PreZSamplesFailingZ", "DepthAndStencil", "Number of samples tested for Z before shading and failed Z test.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", "4484e950-f7a4-3800-bc74-78dd297f017e");
+        c.DefineDerivedCounter("PreZSamplesFailingZ", "DepthAndStencil", "Number of samples tested for Z before shading and failed Z test.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", "4484e950-f7a4-3800-bc74-78dd297f017e", ComputePreZSamplesFailingZ);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -3863,7 +10989,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(10278);
         internalCounters.push_back(10535);
 
-        c.DefineDerivedCounter("PostZSamplesPassing", "DepthAndStencil", "Number of samples tested for Z after shading and passed.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", "4995d5d6-2330-b986-508b-fae24856f44c");
+        c.DefineDerivedCounter("PostZSamplesPassing", "DepthAndStencil", "Number of samples tested for Z after shading and passed.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", "4995d5d6-2330-b986-508b-fae24856f44c", ComputePostZSamplesPassing);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -3884,7 +11010,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(10280);
         internalCounters.push_back(10537);
 
-        c.DefineDerivedCounter("PostZSamplesFailingS", "DepthAndStencil", "Number of samples tested for Z after shading and failed stencil test.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", "ae558af4-f4be-3dd4-7316-b2c4dcf0def8");
+        c.DefineDerivedCounter("PostZSamplesFailingS", "DepthAndStencil", "Number of samples tested for Z after shading and failed stencil test.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", "ae558af4-f4be-3dd4-7316-b2c4dcf0def8", ComputePostZSamplesFailingS);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -3905,7 +11031,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(10279);
         internalCounters.push_back(10536);
 
-        c.DefineDerivedCounter("PostZSamplesFailingZ", "DepthAndStencil", "Number of samples tested for Z after shading and failed Z test.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", "b3684c94-814a-c695-c85d-a5b6ab798b35");
+        c.DefineDerivedCounter("PostZSamplesFailingZ", "DepthAndStencil", "Number of samples tested for Z after shading and failed Z test.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", "b3684c94-814a-c695-c85d-a5b6ab798b35", ComputePostZSamplesFailingZ);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -3927,7 +11053,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(10407);
         internalCounters.push_back(10620);
 
-        c.DefineDerivedCounter("ZUnitStalled", "DepthAndStencil", "The percentage of GPUTime the depth buffer spends waiting for the color buffer to be ready to accept data. High figures here indicate a bottleneck in color buffer operations.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16,16,/,(100),*", "5e86c3ad-1726-3157-1d01-7ed188bf854d");
+        c.DefineDerivedCounter("ZUnitStalled", "DepthAndStencil", "The percentage of GPUTime the depth buffer spends waiting for the color buffer to be ready to accept data. High figures here indicate a bottleneck in color buffer operations.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16,16,/,(100),*", "5e86c3ad-1726-3157-1d01-7ed188bf854d", ComputeZUnitStalled);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -3948,7 +11074,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(10150);
         internalCounters.push_back(10407);
 
-        c.DefineDerivedCounter("ZUnitStalledCycles", "DepthAndStencil", "Number of GPU cycles the depth buffer spends waiting for the color buffer to be ready to accept data. Larger numbers indicate a bottleneck in color buffer operations.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16", "4351fa7f-6737-2c3e-3ffb-b3addbdceedd");
+        c.DefineDerivedCounter("ZUnitStalledCycles", "DepthAndStencil", "Number of GPU cycles the depth buffer spends waiting for the color buffer to be ready to accept data. Larger numbers indicate a bottleneck in color buffer operations.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16", "4351fa7f-6737-2c3e-3ffb-b3addbdceedd", ComputeZUnitStalledCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -3985,7 +11111,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(10159);
         internalCounters.push_back(10416);
 
-        c.DefineDerivedCounter("DBMemRead", "DepthAndStencil", "Number of bytes read from the depth buffer.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_BYTES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,(256),*,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,(32),*,+", "dcdb4ee7-bd50-00f7-c028-9e5f4ce888c0");
+        c.DefineDerivedCounter("DBMemRead", "DepthAndStencil", "Number of bytes read from the depth buffer.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_BYTES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,(256),*,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,(32),*,+", "dcdb4ee7-bd50-00f7-c028-9e5f4ce888c0", ComputeDBMemRead);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -4022,7 +11148,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(10167);
         internalCounters.push_back(10424);
 
-        c.DefineDerivedCounter("DBMemWritten", "DepthAndStencil", "Number of bytes written to the depth buffer.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_BYTES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,(32),*,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,(32),*,+", "de5717f8-8a49-ee44-4645-10de51b37dcf");
+        c.DefineDerivedCounter("DBMemWritten", "DepthAndStencil", "Number of bytes written to the depth buffer.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_BYTES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,(32),*,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,(32),*,+", "de5717f8-8a49-ee44-4645-10de51b37dcf", ComputeDBMemWritten);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -4043,7 +11169,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(5842);
         internalCounters.push_back(6238);
 
-        c.DefineDerivedCounter("CBMemRead", "ColorBuffer", "Number of bytes read from the color buffer.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_BYTES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,(32),*", "84b531d8-a1f8-7f49-7c27-7bc97801f1e6");
+        c.DefineDerivedCounter("CBMemRead", "ColorBuffer", "Number of bytes read from the color buffer.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_BYTES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,(32),*", "84b531d8-a1f8-7f49-7c27-7bc97801f1e6", ComputeCBMemRead);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -4112,7 +11238,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(5842);
         internalCounters.push_back(6238);
 
-        c.DefineDerivedCounter("CBColorAndMaskRead", "ColorBuffer", "Total number of bytes read from the color and mask buffers.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_BYTES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,(32),*", "da41660e-eb6f-32ec-8a64-b32ca17bd7eb");
+        c.DefineDerivedCounter("CBColorAndMaskRead", "ColorBuffer", "Total number of bytes read from the color and mask buffers.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_BYTES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,(32),*", "da41660e-eb6f-32ec-8a64-b32ca17bd7eb", ComputeCBColorAndMaskRead);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -4133,7 +11259,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(5832);
         internalCounters.push_back(6228);
 
-        c.DefineDerivedCounter("CBMemWritten", "ColorBuffer", "Number of bytes written to the color buffer.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_BYTES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,(32),*", "550f8ff8-60b6-a6bf-87d0-25ac9e87de70");
+        c.DefineDerivedCounter("CBMemWritten", "ColorBuffer", "Number of bytes written to the color buffer.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_BYTES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,(32),*", "550f8ff8-60b6-a6bf-87d0-25ac9e87de70", ComputeCBMemWritten);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -4202,7 +11328,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(5832);
         internalCounters.push_back(6228);
 
-        c.DefineDerivedCounter("CBColorAndMaskWritten", "ColorBuffer", "Total number of bytes written to the color and mask buffers.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_BYTES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,(32),*", "29a04b69-8f5f-b770-a0f2-3453e2c99e49");
+        c.DefineDerivedCounter("CBColorAndMaskWritten", "ColorBuffer", "Total number of bytes written to the color and mask buffers.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_BYTES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,(32),*", "29a04b69-8f5f-b770-a0f2-3453e2c99e49", ComputeCBColorAndMaskWritten);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -4239,7 +11365,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(5721);
         internalCounters.push_back(6117);
 
-        c.DefineDerivedCounter("CBSlowPixelPct", "ColorBuffer", "Percentage of pixels written to the color buffer using a half-rate or quarter-rate format.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,/,(100),*,(100),min", "5775943f-0313-7e52-9638-b24a449197bc");
+        c.DefineDerivedCounter("CBSlowPixelPct", "ColorBuffer", "Percentage of pixels written to the color buffer using a half-rate or quarter-rate format.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,/,(100),*,(100),min", "5775943f-0313-7e52-9638-b24a449197bc", ComputeCBSlowPixelPct);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -4260,7 +11386,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(5876);
         internalCounters.push_back(6272);
 
-        c.DefineDerivedCounter("CBSlowPixelCount", "ColorBuffer", "Number of pixels written to the color buffer using a half-rate or quarter-rate format.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", "47eacbb0-28c8-22b4-5c69-c00d5813bb1c");
+        c.DefineDerivedCounter("CBSlowPixelCount", "ColorBuffer", "Number of pixels written to the color buffer using a half-rate or quarter-rate format.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", "47eacbb0-28c8-22b4-5c69-c00d5813bb1c", ComputeCBSlowPixelCount);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -4281,7 +11407,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(48790);
         internalCounters.push_back(48982);
 
-        c.DefineDerivedCounter("FetchSize", "GlobalMemory", "The total bytes fetched from the video memory. This is measured with all extra fetches and any cache or memory effects taken into account.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_KILOBYTES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,(32),*", "664bb3ef-6eca-86b1-1e2d-30cb897b5fa9");
+        c.DefineDerivedCounter("FetchSize", "GlobalMemory", "The total bytes fetched from the video memory. This is measured with all extra fetches and any cache or memory effects taken into account.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_KILOBYTES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,(32),*", "664bb3ef-6eca-86b1-1e2d-30cb897b5fa9", ComputeFetchSize);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -4302,7 +11428,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(48781);
         internalCounters.push_back(48973);
 
-        c.DefineDerivedCounter("WriteSize", "GlobalMemory", "The total bytes written to the video memory. This is measured with all extra fetches and any cache or memory effects taken into account.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_KILOBYTES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,(32),*", "f96f2c16-b1b4-4ec4-229c-fc82e6f80a82");
+        c.DefineDerivedCounter("WriteSize", "GlobalMemory", "The total bytes written to the video memory. This is measured with all extra fetches and any cache or memory effects taken into account.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_KILOBYTES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,(32),*", "f96f2c16-b1b4-4ec4-229c-fc82e6f80a82", ComputeWriteSize);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -4339,7 +11465,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(48774);
         internalCounters.push_back(48966);
 
-        c.DefineDerivedCounter("CacheHit", "GlobalMemory", "The percentage of fetch, write, atomic, and other instructions that hit the data cache. Value range: 0% (no hit) to 100% (optimal).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,+,/,(100),*", "dfbeebab-f7c1-1211-e502-4aae361e2ad7");
+        c.DefineDerivedCounter("CacheHit", "GlobalMemory", "The percentage of fetch, write, atomic, and other instructions that hit the data cache. Value range: 0% (no hit) to 100% (optimal).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,+,/,(100),*", "dfbeebab-f7c1-1211-e502-4aae361e2ad7", ComputeCacheHit);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -4376,7 +11502,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(48774);
         internalCounters.push_back(48966);
 
-        c.DefineDerivedCounter("CacheMiss", "GlobalMemory", "The percentage of fetch, write, atomic, and other instructions that miss the data cache. Value range: 0% (optimal) to 100% (all miss).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,+,/,(100),*", "aebc0a53-7f87-60bd-4c4b-2b956846ef83");
+        c.DefineDerivedCounter("CacheMiss", "GlobalMemory", "The percentage of fetch, write, atomic, and other instructions that miss the data cache. Value range: 0% (optimal) to 100% (all miss).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,+,/,(100),*", "aebc0a53-7f87-60bd-4c4b-2b956846ef83", ComputeCacheMiss);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -4397,7 +11523,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(48773);
         internalCounters.push_back(48965);
 
-        c.DefineDerivedCounter("CacheHitCount", "GlobalMemory", "Count of fetch, write, atomic, and other instructions that hit the data cache.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", "43437652-1024-9737-2eb0-0899c0c1feae");
+        c.DefineDerivedCounter("CacheHitCount", "GlobalMemory", "Count of fetch, write, atomic, and other instructions that hit the data cache.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", "43437652-1024-9737-2eb0-0899c0c1feae", ComputeCacheHitCount);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -4418,7 +11544,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(48774);
         internalCounters.push_back(48966);
 
-        c.DefineDerivedCounter("CacheMissCount", "GlobalMemory", "Count of fetch, write, atomic, and other instructions that miss the data cache.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", "d0f8a812-f41b-644f-09d1-14ee03ea3671");
+        c.DefineDerivedCounter("CacheMissCount", "GlobalMemory", "Count of fetch, write, atomic, and other instructions that miss the data cache.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", "d0f8a812-f41b-644f-09d1-14ee03ea3671", ComputeCacheMissCount);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -4488,7 +11614,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(30923);
         internalCounters.push_back(10620);
 
-        c.DefineDerivedCounter("MemUnitBusy", "GlobalMemory", "The percentage of GPUTime the memory unit is active. The result includes the stall time (MemUnitStalled). This is measured with all extra fetches and writes and any cache or memory effects taken into account. Value range: 0% to 100% (fetch-bound).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64,64,/,(100),*", "a1efa380-4a72-e066-e06a-2ab71a488521");
+        c.DefineDerivedCounter("MemUnitBusy", "GlobalMemory", "The percentage of GPUTime the memory unit is active. The result includes the stall time (MemUnitStalled). This is measured with all extra fetches and writes and any cache or memory effects taken into account. Value range: 0% to 100% (fetch-bound).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64,64,/,(100),*", "a1efa380-4a72-e066-e06a-2ab71a488521", ComputeMemUnitBusy);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -4557,7 +11683,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(30804);
         internalCounters.push_back(30923);
 
-        c.DefineDerivedCounter("MemUnitBusyCycles", "GlobalMemory", "Number of GPU cycles the memory unit is active. The result includes the stall time (MemUnitStalledCycles). This is measured with all extra fetches and writes and any cache or memory effects taken into account.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64", "168f077c-4797-b2f5-717f-105c725266c8");
+        c.DefineDerivedCounter("MemUnitBusyCycles", "GlobalMemory", "Number of GPU cycles the memory unit is active. The result includes the stall time (MemUnitStalledCycles). This is measured with all extra fetches and writes and any cache or memory effects taken into account.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64", "168f077c-4797-b2f5-717f-105c725266c8", ComputeMemUnitBusyCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -4627,7 +11753,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(45890);
         internalCounters.push_back(10620);
 
-        c.DefineDerivedCounter("MemUnitStalled", "GlobalMemory", "The percentage of GPUTime the memory unit is stalled. Try reducing the number or size of fetches and writes if possible. Value range: 0% (optimal) to 100% (bad).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64,64,/,(100),*", "465ba54f-d250-1453-790a-731b10d230b1");
+        c.DefineDerivedCounter("MemUnitStalled", "GlobalMemory", "The percentage of GPUTime the memory unit is stalled. Try reducing the number or size of fetches and writes if possible. Value range: 0% (optimal) to 100% (bad).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64,64,/,(100),*", "465ba54f-d250-1453-790a-731b10d230b1", ComputeMemUnitStalled);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -4696,7 +11822,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(45710);
         internalCounters.push_back(45890);
 
-        c.DefineDerivedCounter("MemUnitStalledCycles", "GlobalMemory", "Number of GPU cycles the memory unit is stalled.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64", "2745659a-0e40-bace-3b9b-86a54f8e4623");
+        c.DefineDerivedCounter("MemUnitStalledCycles", "GlobalMemory", "Number of GPU cycles the memory unit is stalled.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64", "2745659a-0e40-bace-3b9b-86a54f8e4623", ComputeMemUnitStalledCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -4718,7 +11844,7 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(48975);
         internalCounters.push_back(10620);
 
-        c.DefineDerivedCounter("WriteUnitStalled", "GlobalMemory", "The percentage of GPUTime the Write unit is stalled. Value range: 0% to 100% (bad).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16,16,/,(100),*", "594ad3ce-d1ec-10fc-7d59-25738e397d72");
+        c.DefineDerivedCounter("WriteUnitStalled", "GlobalMemory", "The percentage of GPUTime the Write unit is stalled. Value range: 0% to 100% (bad).", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16,16,/,(100),*", "594ad3ce-d1ec-10fc-7d59-25738e397d72", ComputeWriteUnitStalled);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -4739,7 +11865,167 @@ void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c)
         internalCounters.push_back(48783);
         internalCounters.push_back(48975);
 
-        c.DefineDerivedCounter("WriteUnitStalledCycles", "GlobalMemory", "Number of GPU cycles the Write unit is stalled.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16", "ede3305e-abd4-d6bf-6b00-ffc57a29fce3");
+        c.DefineDerivedCounter("WriteUnitStalledCycles", "GlobalMemory", "Number of GPU cycles the Write unit is stalled.", GPA_DATA_TYPE_FLOAT64, GPA_USAGE_TYPE_CYCLES, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16", "ede3305e-abd4-d6bf-6b00-ffc57a29fce3", ComputeWriteUnitStalledCycles);
     }
 }
 
+/// Native functions of the Public derived counters, in the order the counters are defined
+static const GPA_DerivedCounterFunctionEntry counterFunctions[] = {
+    {"GPUTime", "0,TS_FREQ,/,(1000000000),*", ComputeGPUTime},
+    {"GPUBusy", "0,1,/,(100),*,(100),min", ComputeGPUBusy},
+    {"GPUBusyCycles", "0", ComputeGPUBusyCycles},
+    {"TessellatorBusy", "0,1,max,2,max,3,max,4,/,(100),*", ComputeTessellatorBusy},
+    {"TessellatorBusyCycles", "0,1,max,2,max,3,max", ComputeTessellatorBusyCycles},
+    {"VSBusy", "(0),0,16,ifnotzero,4,20,ifnotzero,8,24,ifnotzero,(0),1,17,ifnotzero,5,21,ifnotzero,9,25,ifnotzero,max,(0),2,18,ifnotzero,6,22,ifnotzero,10,26,ifnotzero,max,(0),3,19,ifnotzero,7,23,ifnotzero,11,27,ifnotzero,max,28,/,(100),*,(100),min", ComputeVSBusy},
+    {"VSBusyCycles", "(0),0,16,ifnotzero,4,20,ifnotzero,8,24,ifnotzero,(0),1,17,ifnotzero,5,21,ifnotzero,9,25,ifnotzero,max,(0),2,18,ifnotzero,6,22,ifnotzero,10,26,ifnotzero,max,(0),3,19,ifnotzero,7,23,ifnotzero,11,27,ifnotzero,max", ComputeVSBusyCycles},
+    {"VSTime", "(0),1,17,ifnotzero,5,21,ifnotzero,9,25,ifnotzero,(0),2,18,ifnotzero,6,22,ifnotzero,10,26,ifnotzero,max,(0),3,19,ifnotzero,7,23,ifnotzero,11,27,ifnotzero,max,(0),4,20,ifnotzero,8,24,ifnotzero,12,28,ifnotzero,max,29,/,(1),min,0,TS_FREQ,/,(1000000000),*,*", ComputeVSTime},
+    {"HSBusy", "(0),0,4,ifnotzero,(0),1,5,ifnotzero,max,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max,8,/,(100),*,(100),min", ComputeHSBusy},
+    {"HSBusyCycles", "(0),0,4,ifnotzero,(0),1,5,ifnotzero,max,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max", ComputeHSBusyCycles},
+    {"HSTime", "(0),1,5,ifnotzero,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max,(0),4,8,ifnotzero,max,9,/,(1),min,0,TS_FREQ,/,(1000000000),*,*", ComputeHSTime},
+    {"DSBusy", "(0),0,4,12,ifnotzero,16,ifnotzero,(0),1,5,13,ifnotzero,17,ifnotzero,max,(0),2,6,14,ifnotzero,18,ifnotzero,max,(0),3,7,15,ifnotzero,19,ifnotzero,max,20,/,(100),*,(100),min", ComputeDSBusy},
+    {"DSBusyCycles", "(0),0,4,12,ifnotzero,16,ifnotzero,(0),1,5,13,ifnotzero,17,ifnotzero,max,(0),2,6,14,ifnotzero,18,ifnotzero,max,(0),3,7,15,ifnotzero,19,ifnotzero,max", ComputeDSBusyCycles},
+    {"DSTime", "(0),1,5,13,ifnotzero,17,ifnotzero,(0),2,6,14,ifnotzero,18,ifnotzero,max,(0),3,7,15,ifnotzero,19,ifnotzero,max,(0),4,8,16,ifnotzero,20,ifnotzero,max,21,/,(1),min,0,TS_FREQ,/,(1000000000),*,*", ComputeDSTime},
+    {"GSBusy", "(0),0,4,ifnotzero,(0),1,5,ifnotzero,max,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max,8,/,(100),*,(100),min", ComputeGSBusy},
+    {"GSBusyCycles", "(0),0,4,ifnotzero,(0),1,5,ifnotzero,max,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max", ComputeGSBusyCycles},
+    {"GSTime", "(0),1,5,ifnotzero,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max,(0),4,8,ifnotzero,max,9,/,(1),min,0,TS_FREQ,/,(1000000000),*,*", ComputeGSTime},
+    {"PSBusy", "(0),0,4,ifnotzero,(0),1,5,ifnotzero,max,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max,8,/,(100),*", ComputePSBusy},
+    {"PSBusyCycles", "(0),0,4,ifnotzero,(0),1,5,ifnotzero,max,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max", ComputePSBusyCycles},
+    {"PSTime", "(0),1,5,ifnotzero,(0),2,6,ifnotzero,max,(0),3,7,ifnotzero,max,(0),4,8,ifnotzero,max,9,/,0,TS_FREQ,/,(1000000000),*,*", ComputePSTime},
+    {"CSBusy", "0,1,2,3,4,5,6,7,comparemax4,8,9,10,11,12,13,14,15,comparemax4,max,16,/,(100),*,(100),min", ComputeCSBusy},
+    {"CSBusyCycles", "0,1,2,3,4,5,6,7,comparemax4,8,9,10,11,12,13,14,15,comparemax4,max", ComputeCSBusyCycles},
+    {"CSTime", "1,2,3,4,5,6,7,8,comparemax4,9,10,11,12,13,14,15,16,comparemax4,max,17,/,(1),min,0,TS_FREQ,/,(1000000000),*,*", ComputeCSTime},
+    {"VSVerticesIn", "0,1,2,3,sum4,4,5,6,7,sum4,4,5,6,7,sum4,ifnotzero,8,9,10,11,sum4,8,9,10,11,sum4,ifnotzero", ComputeVSVerticesIn},
+    {"VSVALUInstCount", "0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,sum4,12,13,14,15,sum4,/,16,17,18,19,sum4,ifnotzero,20,21,22,23,sum4,24,25,26,27,sum4,/,28,29,30,31,sum4,ifnotzero", ComputeVSVALUInstCount},
+    {"VSSALUInstCount", "0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,sum4,12,13,14,15,sum4,/,16,17,18,19,sum4,ifnotzero,20,21,22,23,sum4,24,25,26,27,sum4,/,28,29,30,31,sum4,ifnotzero", ComputeVSSALUInstCount},
+    {"VSVALUBusy", "0,1,2,3,sum4,4,5,6,7,sum4,8,9,10,11,sum4,ifnotzero,13,14,15,16,sum4,17,18,19,20,sum4,ifnotzero,(4),*,NUM_SIMDS,/,12,/,(100),*", ComputeVSVALUBusy},
+    {"VSVALUBusyCycles", "0,1,2,3,sum4,4,5,6,7,sum4,8,9,10,11,sum4,ifnotzero,12,13,14,15,sum4,16,17,18,19,sum4,ifnotzero,(4),*,NUM_SIMDS,/", ComputeVSVALUBusyCycles},
+    {"VSSALUBusy", "0,1,2,3,sum4,4,5,6,7,sum4,8,9,10,11,sum4,ifnotzero,13,14,15,16,sum4,17,18,19,20,sum4,ifnotzero,NUM_CUS,/,12,/,(100),*", ComputeVSSALUBusy},
+    {"VSSALUBusyCycles", "0,1,2,3,sum4,4,5,6,7,sum4,8,9,10,11,sum4,ifnotzero,12,13,14,15,sum4,16,17,18,19,sum4,ifnotzero,NUM_CUS,/", ComputeVSSALUBusyCycles},
+    {"HSPatches", "0,1,2,3,sum4", ComputeHSPatches},
+    {"HSVALUInstCount", "0,1,2,3,sum4,4,5,6,7,sum4,/", ComputeHSVALUInstCount},
+    {"HSSALUInstCount", "0,1,2,3,sum4,4,5,6,7,sum4,/", ComputeHSSALUInstCount},
+    {"HSVALUBusy", "0,1,2,3,sum4,(4),*,NUM_SIMDS,/,4,/,(100),*", ComputeHSVALUBusy},
+    {"HSVALUBusyCycles", "0,1,2,3,sum4,(4),*,NUM_SIMDS,/", ComputeHSVALUBusyCycles},
+    {"HSSALUBusy", "0,1,2,3,sum4,NUM_CUS,/,4,/,(100),*", ComputeHSSALUBusy},
+    {"HSSALUBusyCycles", "0,1,2,3,sum4,NUM_CUS,/", ComputeHSSALUBusyCycles},
+    {"DSVerticesIn", "(0),0,1,2,3,sum4,4,5,6,7,sum4,4,5,6,7,sum4,ifnotzero,8,9,10,11,sum4,ifnotzero", ComputeDSVerticesIn},
+    {"DSVALUInstCount", "(0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,sum4,12,13,14,15,sum4,/,16,17,18,19,sum4,ifnotzero,20,21,22,23,sum4,ifnotzero", ComputeDSVALUInstCount},
+    {"DSSALUInstCount", "(0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,sum4,12,13,14,15,sum4,/,16,17,18,19,sum4,ifnotzero,20,21,22,23,sum4,ifnotzero", ComputeDSSALUInstCount},
+    {"DSVALUBusy", "(0),0,1,2,3,sum4,4,5,6,7,sum4,9,10,11,12,sum4,ifnotzero,13,14,15,16,sum4,ifnotzero,(4),*,NUM_SIMDS,/,8,/,(100),*", ComputeDSVALUBusy},
+    {"DSVALUBusyCycles", "(0),0,1,2,3,sum4,4,5,6,7,sum4,8,9,10,11,sum4,ifnotzero,12,13,14,15,sum4,ifnotzero,(4),*,NUM_SIMDS,/", ComputeDSVALUBusyCycles},
+    {"DSSALUBusy", "(0),0,1,2,3,sum4,4,5,6,7,sum4,9,10,11,12,sum4,ifnotzero,13,14,15,16,sum4,ifnotzero,NUM_CUS,/,8,/,(100),*", ComputeDSSALUBusy},
+    {"DSSALUBusyCycles", "(0),0,1,2,3,sum4,4,5,6,7,sum4,8,9,10,11,sum4,ifnotzero,12,13,14,15,sum4,ifnotzero,NUM_CUS,/", ComputeDSSALUBusyCycles},
+    {"GSPrimsIn", "0,1,2,3,sum4", ComputeGSPrimsIn},
+    {"GSVerticesOut", "(0),0,1,2,3,sum4,4,5,6,7,sum4,ifnotzero", ComputeGSVerticesOut},
+    {"GSVALUInstCount", "0,1,2,3,sum4,4,5,6,7,sum4,/", ComputeGSVALUInstCount},
+    {"GSSALUInstCount", "0,1,2,3,sum4,4,5,6,7,sum4,/", ComputeGSSALUInstCount},
+    {"GSVALUBusy", "0,1,2,3,sum4,(4),*,NUM_SIMDS,/,4,/,(100),*", ComputeGSVALUBusy},
+    {"GSVALUBusyCycles", "0,1,2,3,sum4,(4),*,NUM_SIMDS,/", ComputeGSVALUBusyCycles},
+    {"GSSALUBusy", "0,1,2,3,sum4,NUM_CUS,/,4,/,(100),*", ComputeGSSALUBusy},
+    {"GSSALUBusyCycles", "0,1,2,3,sum4,NUM_CUS,/", ComputeGSSALUBusyCycles},
+    {"PrimitiveAssemblyBusy", "0,4,-,8,12,+,16,+,20,(2),*,+,SU_CLOCKS_PRIM,*,-,1,5,-,9,13,+,17,+,21,(2),*,+,SU_CLOCKS_PRIM,*,-,max,2,6,-,10,14,+,18,+,22,(2),*,+,SU_CLOCKS_PRIM,*,-,max,3,7,-,11,15,+,19,+,23,(2),*,+,SU_CLOCKS_PRIM,*,-,max,(0),max,24,/,(100),*,(100),min", ComputePrimitiveAssemblyBusy},
+    {"PrimitiveAssemblyBusyCycles", "0,4,-,8,12,+,16,+,20,(2),*,+,SU_CLOCKS_PRIM,*,-,1,5,-,9,13,+,17,+,21,(2),*,+,SU_CLOCKS_PRIM,*,-,max,2,6,-,10,14,+,18,+,22,(2),*,+,SU_CLOCKS_PRIM,*,-,max,3,7,-,11,15,+,19,+,23,(2),*,+,SU_CLOCKS_PRIM,*,-,max,(0),max", ComputePrimitiveAssemblyBusyCycles},
+    {"PrimitivesIn", "0,1,2,3,sum4", ComputePrimitivesIn},
+    {"CulledPrims", "0,1,+,2,+,3,+,4,+,5,+,6,+,7,+,8,+,9,+,10,+,11,+,12,+,13,+,14,+,15,+,16,+,17,+,18,+,19,+", ComputeCulledPrims},
+    {"ClippedPrims", "0,1,2,3,sum4", ComputeClippedPrims},
+    {"PAStalledOnRasterizer", "0,1,max,2,max,3,max,4,/,(100),*", ComputePAStalledOnRasterizer},
+    {"PAStalledOnRasterizerCycles", "0,1,max,2,max,3,max", ComputePAStalledOnRasterizerCycles},
+    {"PSPixelsOut", "0,1,2,3,sum4,4,5,6,7,sum4,8,9,10,11,sum4,12,13,14,15,sum4,sum4", ComputePSPixelsOut},
+    {"PSExportStalls", "0,1,max,2,max,3,max,4,max,5,max,6,max,7,max,8,max,9,max,10,max,11,max,12,max,13,max,14,max,15,max,16,/,(100),*", ComputePSExportStalls},
+    {"PSExportStallsCycles", "0,1,max,2,max,3,max,4,max,5,max,6,max,7,max,8,max,9,max,10,max,11,max,12,max,13,max,14,max,15,max", ComputePSExportStallsCycles},
+    {"PSVALUInstCount", "0,1,2,3,sum4,4,5,6,7,sum4,/", ComputePSVALUInstCount},
+    {"PSSALUInstCount", "0,1,2,3,sum4,4,5,6,7,sum4,/", ComputePSSALUInstCount},
+    {"PSVALUBusy", "0,1,2,3,sum4,(4),*,NUM_SIMDS,/,4,/,(100),*", ComputePSVALUBusy},
+    {"PSVALUBusyCycles", "0,1,2,3,sum4,(4),*,NUM_SIMDS,/", ComputePSVALUBusyCycles},
+    {"PSSALUBusy", "0,1,2,3,sum4,NUM_CUS,/,4,/,(100),*", ComputePSSALUBusy},
+    {"PSSALUBusyCycles", "0,1,2,3,sum4,NUM_CUS,/", ComputePSSALUBusyCycles},
+    {"CSThreadGroups", "0,1,2,3,4,5,6,7,sum8", ComputeCSThreadGroups},
+    {"CSWavefronts", "0,1,2,3,4,5,6,7,sum8", ComputeCSWavefronts},
+    {"CSThreads", "(0),0,1,2,3,4,5,6,7,sum8,8,9,10,11,sum4,ifnotzero", ComputeCSThreads},
+    {"CSVALUInsts", "(0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,12,13,14,15,sum8,ifnotzero", ComputeCSVALUInsts},
+    {"CSVALUUtilization", "(0),0,1,2,3,sum4,4,5,6,7,sum4,(64),*,/,(100),*,8,9,10,11,12,13,14,15,sum8,ifnotzero,(100),min", ComputeCSVALUUtilization},
+    {"CSSALUInsts", "(0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,12,13,14,15,sum8,ifnotzero", ComputeCSSALUInsts},
+    {"CSVFetchInsts", "(0),0,1,2,3,sum4,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,sum64,-,68,69,70,71,sum4,/,72,73,74,75,76,77,78,79,sum8,ifnotzero", ComputeCSVFetchInsts},
+    {"CSSFetchInsts", "(0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,12,13,14,15,sum8,ifnotzero", ComputeCSSFetchInsts},
+    {"CSVWriteInsts", "(0),0,1,2,3,sum4,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,sum64,-,68,69,70,71,sum4,/,72,73,74,75,76,77,78,79,sum8,ifnotzero", ComputeCSVWriteInsts},
+    {"CSFlatVMemInsts", "(0),0,1,2,3,sum4,4,5,6,7,sum4,-,8,9,10,11,sum4,/,12,13,14,15,16,17,18,19,sum8,ifnotzero", ComputeCSFlatVMemInsts},
+    {"CSVALUBusy", "(0),0,1,2,3,sum4,(4),*,NUM_SIMDS,/,4,/,(100),*,5,6,7,8,9,10,11,12,sum8,ifnotzero", ComputeCSVALUBusy},
+    {"CSVALUBusyCycles", "(0),0,1,2,3,sum4,(4),*,NUM_SIMDS,/,4,5,6,7,8,9,10,11,sum8,ifnotzero", ComputeCSVALUBusyCycles},
+    {"CSSALUBusy", "(0),0,1,2,3,sum4,NUM_CUS,/,4,/,(100),*,5,6,7,8,9,10,11,12,sum8,ifnotzero", ComputeCSSALUBusy},
+    {"CSSALUBusyCycles", "(0),0,1,2,3,sum4,NUM_CUS,/,4,5,6,7,8,9,10,11,sum8,ifnotzero", ComputeCSSALUBusyCycles},
+    {"CSMemUnitBusy", "(0),0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64,64,/,(100),*,65,66,67,68,69,70,71,72,sum8,ifnotzero", ComputeCSMemUnitBusy},
+    {"CSMemUnitBusyCycles", "(0),0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64,64,65,66,67,68,69,70,71,sum8,ifnotzero", ComputeCSMemUnitBusyCycles},
+    {"CSMemUnitStalled", "(0),0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64,64,/,(100),*,65,66,67,68,69,70,71,72,sum8,ifnotzero", ComputeCSMemUnitStalled},
+    {"CSMemUnitStalledCycles", "(0),0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64,64,65,66,67,68,69,70,71,sum8,ifnotzero", ComputeCSMemUnitStalledCycles},
+    {"CSWriteUnitStalled", "(0),0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16,16,/,(100),*,17,18,19,20,21,22,23,24,sum8,ifnotzero", ComputeCSWriteUnitStalled},
+    {"CSWriteUnitStalledCycles", "(0),0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16,16,17,18,19,20,21,22,23,sum8,ifnotzero", ComputeCSWriteUnitStalledCycles},
+    {"CSGDSInsts", "(0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,12,13,14,15,sum8,ifnotzero", ComputeCSGDSInsts},
+    {"CSLDSInsts", "(0),0,1,2,3,sum4,4,5,6,7,sum4,-,8,9,10,11,sum4,/,12,13,14,15,16,17,18,19,sum8,ifnotzero", ComputeCSLDSInsts},
+    {"CSFlatLDSInsts", "(0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,9,10,11,12,13,14,15,sum8,ifnotzero", ComputeCSFlatLDSInsts},
+    {"CSALUStalledByLDS", "(0),0,1,2,3,sum4,4,5,6,7,sum4,/,8,/,NUM_SHADER_ENGINES,/,(100),*,9,10,11,12,13,14,15,16,sum8,ifnotzero", ComputeCSALUStalledByLDS},
+    {"CSALUStalledByLDSCycles", "(0),0,1,2,3,sum4,NUM_SHADER_ENGINES,/,4,5,6,7,8,9,10,11,sum8,ifnotzero", ComputeCSALUStalledByLDSCycles},
+    {"CSLDSBankConflict", "(0),0,1,2,3,sum4,4,/,NUM_SIMDS,/,(100),*,5,6,7,8,9,10,11,12,sum8,ifnotzero", ComputeCSLDSBankConflict},
+    {"CSLDSBankConflictCycles", "(0),0,1,2,3,sum4,NUM_SIMDS,/,4,5,6,7,8,9,10,11,sum8,ifnotzero", ComputeCSLDSBankConflictCycles},
+    {"TexUnitBusy", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64,64,/,(100),*", ComputeTexUnitBusy},
+    {"TexUnitBusyCycles", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64", ComputeTexUnitBusyCycles},
+    {"TexTriFilteringPct", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,sum64,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,+,/,(100),*", ComputeTexTriFilteringPct},
+    {"TexTriFilteringCount", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64", ComputeTexTriFilteringCount},
+    {"NoTexTriFilteringCount", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64", ComputeNoTexTriFilteringCount},
+    {"TexVolFilteringPct", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,sum64,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,+,/,(100),*", ComputeTexVolFilteringPct},
+    {"TexVolFilteringCount", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64", ComputeTexVolFilteringCount},
+    {"NoTexVolFilteringCount", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64", ComputeNoTexVolFilteringCount},
+    {"TexAveAnisotropy", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,(2),64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,sum64,*,+,(4),128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,166,167,168,169,170,171,172,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,sum64,*,+,(6),192,193,194,195,196,197,198,199,200,201,202,203,204,205,206,207,208,209,210,211,212,213,214,215,216,217,218,219,220,221,222,223,224,225,226,227,228,229,230,231,232,233,234,235,236,237,238,239,240,241,242,243,244,245,246,247,248,249,250,251,252,253,254,255,sum64,*,+,(8),256,257,258,259,260,261,262,263,264,265,266,267,268,269,270,271,272,273,274,275,276,277,278,279,280,281,282,283,284,285,286,287,288,289,290,291,292,293,294,295,296,297,298,299,300,301,302,303,304,305,306,307,308,309,310,311,312,313,314,315,316,317,318,319,sum64,*,+,(10),320,321,322,323,324,325,326,327,328,329,330,331,332,333,334,335,336,337,338,339,340,341,342,343,344,345,346,347,348,349,350,351,352,353,354,355,356,357,358,359,360,361,362,363,364,365,366,367,368,369,370,371,372,373,374,375,376,377,378,379,380,381,382,383,sum64,*,+,(12),384,385,386,387,388,389,390,391,392,393,394,395,396,397,398,399,400,401,402,403,404,405,406,407,408,409,410,411,412,413,414,415,416,417,418,419,420,421,422,423,424,425,426,427,428,429,430,431,432,433,434,435,436,437,438,439,440,441,442,443,444,445,446,447,sum64,*,+,(14),448,449,450,451,452,453,454,455,456,457,458,459,460,461,462,463,464,465,466,467,468,469,470,471,472,473,474,475,476,477,478,479,480,481,482,483,484,485,486,487,488,489,490,491,492,493,494,495,496,497,498,499,500,501,502,503,504,505,506,507,508,509,510,511,sum64,*,+,(16),512,513,514,515,516,517,518,519,520,521,522,523,524,525,526,527,528,529,530,531,532,533,534,535,536,537,538,539,540,541,542,543,544,545,546,547,548,549,550,551,552,553,554,555,556,557,558,559,560,561,562,563,564,565,566,567,568,569,570,571,572,573,574,575,sum64,*,+,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,sum64,+,128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,166,167,168,169,170,171,172,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,sum64,+,192,193,194,195,196,197,198,199,200,201,202,203,204,205,206,207,208,209,210,211,212,213,214,215,216,217,218,219,220,221,222,223,224,225,226,227,228,229,230,231,232,233,234,235,236,237,238,239,240,241,242,243,244,245,246,247,248,249,250,251,252,253,254,255,sum64,+,256,257,258,259,260,261,262,263,264,265,266,267,268,269,270,271,272,273,274,275,276,277,278,279,280,281,282,283,284,285,286,287,288,289,290,291,292,293,294,295,296,297,298,299,300,301,302,303,304,305,306,307,308,309,310,311,312,313,314,315,316,317,318,319,sum64,+,320,321,322,323,324,325,326,327,328,329,330,331,332,333,334,335,336,337,338,339,340,341,342,343,344,345,346,347,348,349,350,351,352,353,354,355,356,357,358,359,360,361,362,363,364,365,366,367,368,369,370,371,372,373,374,375,376,377,378,379,380,381,382,383,sum64,+,384,385,386,387,388,389,390,391,392,393,394,395,396,397,398,399,400,401,402,403,404,405,406,407,408,409,410,411,412,413,414,415,416,417,418,419,420,421,422,423,424,425,426,427,428,429,430,431,432,433,434,435,436,437,438,439,440,441,442,443,444,445,446,447,sum64,+,448,449,450,451,452,453,454,455,456,457,458,459,460,461,462,463,464,465,466,467,468,469,470,471,472,473,474,475,476,477,478,479,480,481,482,483,484,485,486,487,488,489,490,491,492,493,494,495,496,497,498,499,500,501,502,503,504,505,506,507,508,509,510,511,sum64,+,512,513,514,515,516,517,518,519,520,521,522,523,524,525,526,527,528,529,530,531,532,533,534,535,536,537,538,539,540,541,542,543,544,545,546,547,548,549,550,551,552,553,554,555,556,557,558,559,560,561,562,563,564,565,566,567,568,569,570,571,572,573,574,575,sum64,+,/", ComputeTexAveAnisotropy},
+    {"DepthStencilTestBusy", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16,16,/,(100),*", ComputeDepthStencilTestBusy},
+    {"DepthStencilTestBusyCount", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16", ComputeDepthStencilTestBusyCount},
+    {"HiZTilesAccepted", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,/,(100),*", ComputeHiZTilesAccepted},
+    {"HiZTilesAcceptedCount", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", ComputeHiZTilesAcceptedCount},
+    {"HiZTilesRejectedCount", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", ComputeHiZTilesRejectedCount},
+    {"PreZTilesDetailCulled", "16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,/,(100),*", ComputePreZTilesDetailCulled},
+    {"PreZTilesDetailCulledCount", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", ComputePreZTilesDetailCulledCount},
+    {"PreZTilesDetailSurvivingCount", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", ComputePreZTilesDetailSurvivingCount},
+    {"HiZQuadsCulled", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,-,(0),max,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,/,(100),*", ComputeHiZQuadsCulled},
+    {"HiZQuadsCulledCount", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,-,(0),max", ComputeHiZQuadsCulledCount},
+    {"HiZQuadsAcceptedCount", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", ComputeHiZQuadsAcceptedCount},
+    {"PreZQuadsCulled", "20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,sum16,16,17,18,19,sum4,-,(0),max,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,/,(100),*", ComputePreZQuadsCulled},
+    {"PreZQuadsCulledCount", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,sum4,+", ComputePreZQuadsCulledCount},
+    {"PreZQuadsSurvivingCount", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,-,(0),max", ComputePreZQuadsSurvivingCount},
+    {"PostZQuads", "0,1,2,3,sum4,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,sum16,/,(100),*", ComputePostZQuads},
+    {"PostZQuadCount", "0,1,2,3,sum4", ComputePostZQuadCount},
+    {"PreZSamplesPassing", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", ComputePreZSamplesPassing},
+    {"PreZSamplesFailingS", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", ComputePreZSamplesFailingS},
+    {"PreZSamplesFailingZ", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", ComputePreZSamplesFailingZ},
+    {"PostZSamplesPassing", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", ComputePostZSamplesPassing},
+    {"PostZSamplesFailingS", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", ComputePostZSamplesFailingS},
+    {"PostZSamplesFailingZ", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", ComputePostZSamplesFailingZ},
+    {"ZUnitStalled", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16,16,/,(100),*", ComputeZUnitStalled},
+    {"ZUnitStalledCycles", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16", ComputeZUnitStalledCycles},
+    {"DBMemRead", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,(256),*,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,(32),*,+", ComputeDBMemRead},
+    {"DBMemWritten", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,(32),*,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,(32),*,+", ComputeDBMemWritten},
+    {"CBMemRead", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,(32),*", ComputeCBMemRead},
+    {"CBColorAndMaskRead", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,(32),*", ComputeCBColorAndMaskRead},
+    {"CBMemWritten", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,(32),*", ComputeCBMemWritten},
+    {"CBColorAndMaskWritten", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum64,(32),*", ComputeCBColorAndMaskWritten},
+    {"CBSlowPixelPct", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,/,(100),*,(100),min", ComputeCBSlowPixelPct},
+    {"CBSlowPixelCount", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", ComputeCBSlowPixelCount},
+    {"FetchSize", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,(32),*", ComputeFetchSize},
+    {"WriteSize", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,(32),*", ComputeWriteSize},
+    {"CacheHit", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,+,/,(100),*", ComputeCacheHit},
+    {"CacheMiss", "16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum16,+,/,(100),*", ComputeCacheMiss},
+    {"CacheHitCount", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", ComputeCacheHitCount},
+    {"CacheMissCount", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,sum16", ComputeCacheMissCount},
+    {"MemUnitBusy", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64,64,/,(100),*", ComputeMemUnitBusy},
+    {"MemUnitBusyCycles", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64", ComputeMemUnitBusyCycles},
+    {"MemUnitStalled", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64,64,/,(100),*", ComputeMemUnitStalled},
+    {"MemUnitStalledCycles", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,max64", ComputeMemUnitStalledCycles},
+    {"WriteUnitStalled", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16,16,/,(100),*", ComputeWriteUnitStalled},
+    {"WriteUnitStalledCycles", "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,max16", ComputeWriteUnitStalledCycles},
+};
+
+GPA_DerivedCounterFunctionTable GetPublicDerivedCounterFunctionsDX11Gfx8()
+{
+    GPA_DerivedCounterFunctionTable functions;
+    functions.m_pEntries   = counterFunctions;
+    functions.m_numEntries = sizeof(counterFunctions) / sizeof(counterFunctions[0]);
+    return functions;
+}
+
@@ -16,4 +16,8 @@
 /// \param c derived counters instance
 void AutoDefinePublicDerivedCountersDX11Gfx8(GPA_DerivedCounters& c);
 
+/// Gets the native functions of the Public derived counters for DX11 GFX8
+/// \return the native functions, in the order the counters are defined
+GPA_DerivedCounterFunctionTable GetPublicDerivedCounterFunctionsDX11Gfx8();
+
 #endif  // _PUBLIC_COUNTER_DEFINITIONS_DX11_GFX8_H_
@@ -6,6 +6,7 @@
 //==============================================================================
 
 #include "gpa_counter.h"
+#include "gpa_common_defs.h"
 #include "public_counter_definitions_dx11_gfx8_baffin.h"
 
 // *** Note, this is an auto-generated file. Do not edit. Execute PublicCounterCompiler to rebuild.
@@ -14,6 +15,151 @@
 
 namespace dx11gfx8baffin
 {
+/// Computes the TessellatorBusy counter: 0,1,max,2,max,3,max,4,/,(100),*
+static void ComputeTessellatorBusy(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+
+    const gpa_float64 v0 = (r0 > r1) ? r0 : r1;
+    const gpa_float64 v1 = (v0 > r2) ? v0 : r2;
+    const gpa_float64 v2 = (v1 > r3) ? v1 : r3;
+    const gpa_float64 v3 = (r4 != 0.0) ? (v2 / r4) : 0.0;
+    const gpa_float64 v4 = v3 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v4;
+}
+
+/// Computes the TessellatorBusyCycles counter: 0,1,max,2,max,3,max
+static void ComputeTessellatorBusyCycles(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+
+    const gpa_float64 v0 = (r0 > r1) ? r0 : r1;
+    const gpa_float64 v1 = (v0 > r2) ? v0 : r2;
+    const gpa_float64 v2 = (v1 > r3) ? v1 : r3;
+
+    *static_cast<gpa_float64*>(pResult) = v2;
+}
+
+/// Computes the VSVerticesIn counter: 0,1,2,3,sum4,4,5,6,7,sum4,4,5,6,7,sum4,ifnotzero,8,9,10,11,sum4,8,9,10,11,sum4,ifnotzero
+static void ComputeVSVerticesIn(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = r7 + r6 + r5 + r4;
+    const gpa_float64 v3 = (v2 != 0.0) ? v1 : v0;
+    const gpa_float64 v4 = r11 + r10 + r9 + r8;
+    const gpa_float64 v5 = r11 + r10 + r9 + r8;
+    const gpa_float64 v6 = (v5 != 0.0) ? v4 : v3;
+
+    *static_cast<gpa_float64*>(pResult) = v6;
+}
+
+/// Computes the HSPatches counter: 0,1,2,3,sum4
+static void ComputeHSPatches(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the DSVerticesIn counter: (0),0,1,2,3,sum4,4,5,6,7,sum4,4,5,6,7,sum4,ifnotzero,8,9,10,11,sum4,ifnotzero
+static void ComputeDSVerticesIn(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+    const gpa_float64 r8 = static_cast<gpa_float64>(*results[8]);
+    const gpa_float64 r9 = static_cast<gpa_float64>(*results[9]);
+    const gpa_float64 r10 = static_cast<gpa_float64>(*results[10]);
+    const gpa_float64 r11 = static_cast<gpa_float64>(*results[11]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = r7 + r6 + r5 + r4;
+    const gpa_float64 v3 = (v2 != 0.0) ? v1 : v0;
+    const gpa_float64 v4 = r11 + r10 + r9 + r8;
+    const gpa_float64 v5 = (v4 != 0.0) ? v3 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v5;
+}
+
+/// Computes the GSPrimsIn counter: 0,1,2,3,sum4
+static void ComputeGSPrimsIn(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+
+    *static_cast<gpa_float64*>(pResult) = v0;
+}
+
+/// Computes the GSVerticesOut counter: (0),0,1,2,3,sum4,4,5,6,7,sum4,ifnotzero
+static void ComputeGSVerticesOut(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+    const gpa_float64 r2 = static_cast<gpa_float64>(*results[2]);
+    const gpa_float64 r3 = static_cast<gpa_float64>(*results[3]);
+    const gpa_float64 r4 = static_cast<gpa_float64>(*results[4]);
+    const gpa_float64 r5 = static_cast<gpa_float64>(*results[5]);
+    const gpa_float64 r6 = static_cast<gpa_float64>(*results[6]);
+    const gpa_float64 r7 = static_cast<gpa_float64>(*results[7]);
+
+    const gpa_float64 v0 = r3 + r2 + r1 + r0;
+    const gpa_float64 v1 = r7 + r6 + r5 + r4;
+    const gpa_float64 v2 = (v1 != 0.0) ? v0 : 0.0;
+
+    *static_cast<gpa_float64*>(pResult) = v2;
+}
+
 bool UpdatePublicAsicSpecificCounters(GDT_HW_GENERATION desired_generation, GDT_HW_ASIC_TYPE asic_type, GPA_DerivedCounters& c)
 {
     UNREFERENCED_PARAMETER(desired_generation);
@@ -34,7 +180,7 @@ bool UpdatePublicAsicSpecificCounters(GDT_HW_GENERATION desired_generation, GDT_
         internalCounters.push_back(49944);
         internalCounters.push_back(10620);
 
-        c.UpdateAsicSpecificDerivedCounter("TessellatorBusy", internalCounters, "0,1,max,2,max,3,max,4,/,(100),*");
+        c.UpdateAsicSpecificDerivedCounter("TessellatorBusy", internalCounters, "0,1,max,2,max,3,max,4,/,(100),*", ComputeTessellatorBusy);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -43,7 +189,7 @@ bool UpdatePublicAsicSpecificCounters(GDT_HW_GENERATION desired_generation, GDT_
         internalCounters.push_back(49797);
         internalCounters.push_back(49944);
 
-        c.UpdateAsicSpecificDerivedCounter("TessellatorBusyCycles", internalCounters, "0,1,max,2,max,3,max");
+        c.UpdateAsicSpecificDerivedCounter("TessellatorBusyCycles", internalCounters, "0,1,max,2,max,3,max", ComputeTessellatorBusyCycles);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -60,7 +206,7 @@ bool UpdatePublicAsicSpecificCounters(GDT_HW_GENERATION desired_generation, GDT_
         internalCounters.push_back(49768);
         internalCounters.push_back(49915);
 
-        c.UpdateAsicSpecificDerivedCounter("VSVerticesIn", internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,4,5,6,7,sum4,ifnotzero,8,9,10,11,sum4,8,9,10,11,sum4,ifnotzero");
+        c.UpdateAsicSpecificDerivedCounter("VSVerticesIn", internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,4,5,6,7,sum4,ifnotzero,8,9,10,11,sum4,8,9,10,11,sum4,ifnotzero", ComputeVSVerticesIn);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -69,7 +215,7 @@ bool UpdatePublicAsicSpecificCounters(GDT_HW_GENERATION desired_generation, GDT_
         internalCounters.push_back(49777);
         internalCounters.push_back(49924);
 
-        c.UpdateAsicSpecificDerivedCounter("HSPatches", internalCounters, "0,1,2,3,sum4");
+        c.UpdateAsicSpecificDerivedCounter("HSPatches", internalCounters, "0,1,2,3,sum4", ComputeHSPatches);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -86,7 +232,7 @@ bool UpdatePublicAsicSpecificCounters(GDT_HW_GENERATION desired_generation, GDT_
         internalCounters.push_back(49768);
         internalCounters.push_back(49915);
 
-        c.UpdateAsicSpecificDerivedCounter("DSVerticesIn", internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,4,5,6,7,sum4,ifnotzero,8,9,10,11,sum4,ifnotzero");
+        c.UpdateAsicSpecificDerivedCounter("DSVerticesIn", internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,4,5,6,7,sum4,ifnotzero,8,9,10,11,sum4,ifnotzero", ComputeDSVerticesIn);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -95,7 +241,7 @@ bool UpdatePublicAsicSpecificCounters(GDT_HW_GENERATION desired_generation, GDT_
         internalCounters.push_back(49681);
         internalCounters.push_back(49828);
 
-        c.UpdateAsicSpecificDerivedCounter("GSPrimsIn", internalCounters, "0,1,2,3,sum4");
+        c.UpdateAsicSpecificDerivedCounter("GSPrimsIn", internalCounters, "0,1,2,3,sum4", ComputeGSPrimsIn);
     }
     {
         vector<gpa_uint32> internalCounters;
@@ -108,10 +254,35 @@ bool UpdatePublicAsicSpecificCounters(GDT_HW_GENERATION desired_generation, GDT_
         internalCounters.push_back(49673);
         internalCounters.push_back(49820);
 
-        c.UpdateAsicSpecificDerivedCounter("GSVerticesOut", internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,ifnotzero");
+        c.UpdateAsicSpecificDerivedCounter("GSVerticesOut", internalCounters, "(0),0,1,2,3,sum4,4,5,6,7,sum4,ifnotzero", ComputeGSVerticesOut);
     }
     return true;
 }
 
+/// Native functions of the Public derived counters, in the order the counters are updated
+static const GPA_DerivedCounterFunctionEntry counterFunctions[] = {
+    {"TessellatorBusy", "0,1,max,2,max,3,max,4,/,(100),*", ComputeTessellatorBusy},
+    {"TessellatorBusyCycles", "0,1,max,2,max,3,max", ComputeTessellatorBusyCycles},
+    {"VSVerticesIn", "0,1,2,3,sum4,4,5,6,7,sum4,4,5,6,7,sum4,ifnotzero,8,9,10,11,sum4,8,9,10,11,sum4,ifnotzero", ComputeVSVerticesIn},
+    {"HSPatches", "0,1,2,3,sum4", ComputeHSPatches},
+    {"DSVerticesIn", "(0),0,1,2,3,sum4,4,5,6,7,sum4,4,5,6,7,sum4,ifnotzero,8,9,10,11,sum4,ifnotzero", ComputeDSVerticesIn},
+    {"GSPrimsIn", "0,1,2,3,sum4", ComputeGSPrimsIn},
+    {"GSVerticesOut", "(0),0,1,2,3,sum4,4,5,6,7,sum4,ifnotzero", ComputeGSVerticesOut},
+};
+
+bool GetPublicAsicSpecificCounterFunctions(GDT_HW_GENERATION desired_generation, GDT_HW_ASIC_TYPE asic_type, GPA_DerivedCounterFunctionTable& functions)
+{
+    UNREFERENCED_PARAMETER(desired_generation);
+
+    if (!countergfx8baffin::MatchAsic(asic_type))
+    {
+        return false;
+    }
+
+    functions.m_pEntries   = counterFunctions;
+    functions.m_numEntries = sizeof(counterFunctions) / sizeof(counterFunctions[0]);
+    return true;
+}
+
 }  // namespace dx11gfx8baffin
 
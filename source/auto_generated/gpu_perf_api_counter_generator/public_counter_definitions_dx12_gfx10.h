@@ -16,4 +16,8 @@
 /// \param c derived counters instance
 void AutoDefinePublicDerivedCountersDX12Gfx10(GPA_DerivedCounters& c);
 
+/// Gets the native functions of the Public derived counters for DX12 GFX10
+/// \return the native functions, in the order the counters are defined
+GPA_DerivedCounterFunctionTable GetPublicDerivedCounterFunctionsDX12Gfx10();
+
 #endif  // _PUBLIC_COUNTER_DEFINITIONS_DX12_GFX10_H_
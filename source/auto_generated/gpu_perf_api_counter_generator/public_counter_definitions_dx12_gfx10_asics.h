@@ -26,6 +26,20 @@ namespace dx12gfx10asics
         UNREFERENCED_PARAMETER(c);
     }
 
+    /// Gets the native functions of the ASIC specific derived counters if available.
+    /// \param desired_generation Hardware generation currently in use.
+    /// \param asic_type The ASIC type that is currently in use.
+    /// \param functions Returned native functions, if available.
+    /// \return True if the ASIC matched one available, and functions was set.
+    inline bool GetPublicAsicSpecificCounterFunctions(GDT_HW_GENERATION desired_generation, GDT_HW_ASIC_TYPE asic_type, GPA_DerivedCounterFunctionTable& functions)
+    {
+        UNREFERENCED_PARAMETER(desired_generation);
+        UNREFERENCED_PARAMETER(asic_type);
+        UNREFERENCED_PARAMETER(functions);
+
+        return false;
+    }
+
 }  // namespace dx12gfx10asics
 
 #endif  // _PUBLIC__COUNTER_DEFINITIONS_DX12GFX10_ASICS_H_
@@ -59,6 +59,46 @@ namespace dx12gfx8asics
         }
     }
 
+    /// Gets the native functions of the ASIC specific derived counters if available.
+    /// \param desired_generation Hardware generation currently in use.
+    /// \param asic_type The ASIC type that is currently in use.
+    /// \param functions Returned native functions, if available.
+    /// \return True if the ASIC matched one available, and functions was set.
+    inline bool GetPublicAsicSpecificCounterFunctions(GDT_HW_GENERATION desired_generation, GDT_HW_ASIC_TYPE asic_type, GPA_DerivedCounterFunctionTable& functions)
+    {
+        if (dx12gfx8baffin::GetPublicAsicSpecificCounterFunctions(desired_generation, asic_type, functions))
+        {
+            return true;
+        }
+
+        if (dx12gfx8carrizo::GetPublicAsicSpecificCounterFunctions(desired_generation, asic_type, functions))
+        {
+            return true;
+        }
+
+        if (dx12gfx8ellesmere::GetPublicAsicSpecificCounterFunctions(desired_generation, asic_type, functions))
+        {
+            return true;
+        }
+
+        if (dx12gfx8fiji::GetPublicAsicSpecificCounterFunctions(desired_generation, asic_type, functions))
+        {
+            return true;
+        }
+
+        if (dx12gfx8iceland::GetPublicAsicSpecificCounterFunctions(desired_generation, asic_type, functions))
+        {
+            return true;
+        }
+
+        if (dx12gfx8tonga::GetPublicAsicSpecificCounterFunctions(desired_generation, asic_type, functions))
+        {
+            return true;
+        }
+
+        return false;
+    }
+
 }  // namespace dx12gfx8asics
 
 #endif  // _PUBLIC__COUNTER_DEFINITIONS_DX12GFX8_ASICS_H_
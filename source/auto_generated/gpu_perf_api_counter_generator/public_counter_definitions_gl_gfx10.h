@@ -16,4 +16,8 @@
 /// \param c derived counters instance
 void AutoDefinePublicDerivedCountersGLGfx10(GPA_DerivedCounters& c);
 
+/// Gets the native functions of the Public derived counters for GL GFX10
+/// \return the native functions, in the order the counters are defined
+GPA_DerivedCounterFunctionTable GetPublicDerivedCounterFunctionsGLGfx10();
+
 #endif  // _PUBLIC_COUNTER_DEFINITIONS_GL_GFX10_H_
@@ -16,4 +16,8 @@
 /// \param c derived counters instance
 void AutoDefinePublicDerivedCountersGLGfx8(GPA_DerivedCounters& c);
 
+/// Gets the native functions of the Public derived counters for GL GFX8
+/// \return the native functions, in the order the counters are defined
+GPA_DerivedCounterFunctionTable GetPublicDerivedCounterFunctionsGLGfx8();
+
 #endif  // _PUBLIC_COUNTER_DEFINITIONS_GL_GFX8_H_
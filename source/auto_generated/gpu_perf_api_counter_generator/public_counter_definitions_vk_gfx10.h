@@ -16,4 +16,8 @@
 /// \param c derived counters instance
 void AutoDefinePublicDerivedCountersVKGfx10(GPA_DerivedCounters& c);
 
+/// Gets the native functions of the Public derived counters for VK GFX10
+/// \return the native functions, in the order the counters are defined
+GPA_DerivedCounterFunctionTable GetPublicDerivedCounterFunctionsVKGfx10();
+
 #endif  // _PUBLIC_COUNTER_DEFINITIONS_VK_GFX10_H_
@@ -16,4 +16,8 @@
 /// \param c derived counters instance
 void AutoDefinePublicDerivedCountersVKGfx8(GPA_DerivedCounters& c);
 
+/// Gets the native functions of the Public derived counters for VK GFX8
+/// \return the native functions, in the order the counters are defined
+GPA_DerivedCounterFunctionTable GetPublicDerivedCounterFunctionsVKGfx8();
+
 #endif  // _PUBLIC_COUNTER_DEFINITIONS_VK_GFX8_H_
@@ -5,6 +5,7 @@
 /// \brief  CL GPA Pass Object Implementation
 //==============================================================================
 
+#include <algorithm>
 #include <cassert>
 
 #include "cl_gpa_pass.h"
@@ -15,9 +16,41 @@
 
 CLGPAPass::CLGPAPass(IGPASession* pGpaSession, PassIndex passIndex, GPACounterSource counterSource, CounterList* pPassCounters)
     : GPAPass(pGpaSession, passIndex, counterSource, pPassCounters)
+    , m_maxPooledCounterBlockSets(0)
+    , m_counterBlockSetBytes(0)
+    , m_counterBlockPoolMemory(GPA_MEMORY_CATEGORY_BACKEND, 0)
 {
     EnableAllCountersForPass();
     InitializeCLCounterInfo();
+
+    size_t numCountersPerSet = 0;
+
+    for (auto groupIter = m_groupCountersMap.cbegin(); groupIter != m_groupCountersMap.cend(); ++groupIter)
+    {
+        numCountersPerSet += groupIter->second.size();
+    }
+
+    m_maxPooledCounterBlockSets = MAX_POOLED_CL_COUNTERS / std::max(numCountersPerSet, static_cast<size_t>(1));
+
+    // each counter is held by its block (id and driver counter) and by the counter list of the set
+    m_counterBlockSetBytes = sizeof(CLCounterBlockSet) + m_groupCountersMap.size() * (sizeof(clPerfCounterBlock*) + sizeof(clPerfCounterBlock)) +
+                             numCountersPerSet * (sizeof(cl_ulong) + 2 * sizeof(cl_perfcounter_amd));
+}
+
+CLGPAPass::~CLGPAPass()
+{
+    // the samples return their counter blocks to the pool, so they need to be deleted while the pool still exists
+    ResetSamples();
+
+    std::lock_guard<std::mutex> lock(m_counterBlockPoolMutex);
+
+    for (auto setIter = m_counterBlockPool.begin(); setIter != m_counterBlockPool.end(); ++setIter)
+    {
+        DeleteCounterBlockSet(*setIter);
+    }
+
+    m_counterBlockPool.clear();
+    UpdateCounterBlockPoolMemory_NotThreadSafe();
 }
 
 GPASample* CLGPAPass::CreateAPISpecificSample(IGPACommandList* pCmdList, GpaSampleType sampleType, ClientSampleId sampleId)
@@ -83,6 +116,110 @@ void CLGPAPass::IterateCLCounterMap(std::function<bool(GroupCountersPair groupCo
     }
 }
 
+CLCounterBlockSet* CLGPAPass::AcquireCounterBlockSet()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_counterBlockPoolMutex);
+
+        if (!m_counterBlockPool.empty())
+        {
+            CLCounterBlockSet* pCounterBlockSet = m_counterBlockPool.back();
+            m_counterBlockPool.pop_back();
+            UpdateCounterBlockPoolMemory_NotThreadSafe();
+            return pCounterBlockSet;
+        }
+    }
+
+    return CreateCounterBlockSet();
+}
+
+void CLGPAPass::ReleaseCounterBlockSet(CLCounterBlockSet* pCounterBlockSet)
+{
+    if (nullptr == pCounterBlockSet)
+    {
+        return;
+    }
+
+    for (auto blockIter = pCounterBlockSet->m_counterBlocks.begin(); blockIter != pCounterBlockSet->m_counterBlocks.end(); ++blockIter)
+    {
+        (*blockIter)->ResetResults();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_counterBlockPoolMutex);
+
+        if (m_counterBlockPool.size() < m_maxPooledCounterBlockSets)
+        {
+            m_counterBlockPool.push_back(pCounterBlockSet);
+            UpdateCounterBlockPoolMemory_NotThreadSafe();
+            return;
+        }
+    }
+
+    DeleteCounterBlockSet(pCounterBlockSet);
+}
+
+void CLGPAPass::DeleteCounterBlockSet(CLCounterBlockSet* pCounterBlockSet)
+{
+    if (nullptr != pCounterBlockSet)
+    {
+        for (auto blockIter = pCounterBlockSet->m_counterBlocks.begin(); blockIter != pCounterBlockSet->m_counterBlocks.end(); ++blockIter)
+        {
+            delete *blockIter;
+        }
+
+        delete pCounterBlockSet;
+    }
+}
+
+CLCounterBlockSet* CLGPAPass::CreateCounterBlockSet() const
+{
+    CLCounterBlockSet* pCounterBlockSet = new (std::nothrow) CLCounterBlockSet();
+
+    if (nullptr == pCounterBlockSet)
+    {
+        GPA_LogError("Unable to allocate memory for CL counter blocks.");
+        return nullptr;
+    }
+
+    CLGPAContext*               pCLGpaContext     = reinterpret_cast<CLGPAContext*>(GetGpaSession()->GetParentContext());
+    IGPACounterAccessor*        pCounterAccessor  = GPAContextCounterMediator::Instance()->GetCounterAccessor(pCLGpaContext);
+    const GPA_HardwareCounters* pHardwareCounters = pCounterAccessor->GetHardwareCounters();
+
+    pCounterBlockSet->m_counterBlocks.reserve(m_groupCountersMap.size());
+
+    for (auto groupIter = m_groupCountersMap.cbegin(); groupIter != m_groupCountersMap.cend(); ++groupIter)
+    {
+        gpa_uint32          maxCountersEnabled = static_cast<gpa_uint32>(pHardwareCounters->m_pGroups[groupIter->first].m_maxActiveDiscreteCounters);
+        clPerfCounterBlock* pClBlock =
+            new (std::nothrow) clPerfCounterBlock(pCLGpaContext->GetCLDeviceId(), groupIter->first, maxCountersEnabled, groupIter->second);
+
+        if (nullptr == pClBlock)
+        {
+            GPA_LogError("Unable to allocate memory for CL counter blocks.");
+            DeleteCounterBlockSet(pCounterBlockSet);
+            return nullptr;
+        }
+
+        pCounterBlockSet->m_counterBlocks.push_back(pClBlock);
+
+        // store the opencl counters into an array so we can use one call of clEnqueueBeginPerfCounterAMD for all of them
+        cl_perfcounter_amd* pClCounters = pClBlock->GetCounterArray(0);
+
+        if (nullptr != pClCounters)
+        {
+            pCounterBlockSet->m_counterList.insert(pCounterBlockSet->m_counterList.end(), pClCounters, pClCounters + pClBlock->GetCounterCount());
+        }
+    }
+
+    return pCounterBlockSet;
+}
+
+void CLGPAPass::UpdateCounterBlockPoolMemory_NotThreadSafe()
+{
+    m_counterBlockPoolMemory.SetBytes(GPAContainerBytes(m_counterBlockPool) + m_counterBlockPool.size() * m_counterBlockSetBytes);
+}
+
 void CLGPAPass::InitializeCLCounterInfo()
 {
     CLGPAContext*               pCLGpaContext     = reinterpret_cast<CLGPAContext*>(GetGpaSession()->GetParentContext());
@@ -8,15 +8,28 @@
 #ifndef _CL_GPA_PASS_H_
 #define _CL_GPA_PASS_H_
 
+#include <mutex>
+#include <vector>
+
 #include <CL/cl_platform.h>
 
 // GPA Common
 #include "gpa_pass.h"
 #include "gpa_command_list_interface.h"
+#include "gpa_memory_tracker.h"
+
+#include "cl_perf_counter_block.h"
 
 using GroupCountersPair = std::pair<gpa_uint32, std::vector<cl_ulong>>;  ///< type alias for pair of group and counters in that group
 using GroupCountersMap  = std::map<gpa_uint32, std::vector<cl_ulong>>;   ///< type alias for map of group and counters in that group
 
+/// The driver counters needed by one sample of a pass: one counter block per hardware group of the pass
+struct CLCounterBlockSet
+{
+    std::vector<clPerfCounterBlock*> m_counterBlocks;  ///< the counter block of each hardware group, in group order
+    std::vector<cl_perfcounter_amd>  m_counterList;    ///< the counters of all blocks, so they can be begun and ended with a single call
+};
+
 /// Class for OpenCL gpa pass
 class CLGPAPass : public GPAPass
 {
@@ -29,7 +42,7 @@ public:
     CLGPAPass(IGPASession* pGpaSession, PassIndex passIndex, GPACounterSource counterSource, CounterList* pPassCounters);
 
     /// Destructor
-    ~CLGPAPass() = default;
+    ~CLGPAPass();
 
     /// \copydoc GPAPass::CreateAPISpecificSample
     GPASample* CreateAPISpecificSample(IGPACommandList* pCmdList, GpaSampleType sampleType, ClientSampleId sampleId) override final;
@@ -47,11 +60,40 @@ public:
     /// \param[in] function function to be executed for each object in the list - function may return false to terminate iteration
     void IterateCLCounterMap(std::function<bool(GroupCountersPair groupCountrsPair)> function) const;
 
+    /// Takes a set of counter blocks for a sample out of the pool of the pass, creating a new one if the pool is empty
+    /// \return the counter blocks, or nullptr if they could not be created
+    CLCounterBlockSet* AcquireCounterBlockSet();
+
+    /// Returns the counter blocks of a sample to the pool, so that they can be used by a later sample of the pass.
+    /// The driver work using the counters must be complete. The blocks are deleted instead if the pool is full.
+    /// \param[in] pCounterBlockSet the counter blocks
+    void ReleaseCounterBlockSet(CLCounterBlockSet* pCounterBlockSet);
+
+    /// Deletes a set of counter blocks along with their driver counters
+    /// \param[in] pCounterBlockSet the counter blocks
+    static void DeleteCounterBlockSet(CLCounterBlockSet* pCounterBlockSet);
+
 private:
+    /// Maximum number of driver counters kept in the pool of idle counter blocks of a pass
+    static const size_t MAX_POOLED_CL_COUNTERS = 4096;
+
     /// Initializes the CL counter info
     void InitializeCLCounterInfo();
 
-    GroupCountersMap m_groupCountersMap;  ///< Map of all the CL counters in the group
+    /// Creates a set of counter blocks holding the counters of the pass
+    /// \return the counter blocks, or nullptr if they could not be created
+    CLCounterBlockSet* CreateCounterBlockSet() const;
+
+    /// Updates the accounting of the memory held by the idle counter blocks.
+    /// Does NOT lock the mutex, expects the calling method to do that.
+    void UpdateCounterBlockPoolMemory_NotThreadSafe();
+
+    GroupCountersMap                m_groupCountersMap;           ///< Map of all the CL counters in the group
+    size_t                          m_maxPooledCounterBlockSets;  ///< number of idle counter block sets the pool can hold, based on the number of counters per set
+    size_t                          m_counterBlockSetBytes;       ///< estimated number of bytes allocated for a set of counter blocks, which all have the counters of the pass
+    std::mutex                      m_counterBlockPoolMutex;      ///< mutex for the pool of idle counter blocks
+    std::vector<CLCounterBlockSet*> m_counterBlockPool;           ///< idle counter blocks, whose driver counters can be used by a new sample
+    GPATrackedMemory                m_counterBlockPoolMemory;     ///< accounting of the memory held by the idle counter blocks
 };
 
 #endif  // _CL_GPA_PASS_H_
@@ -17,6 +17,7 @@
 CLGPASample::CLGPASample(GPAPass* pPass, IGPACommandList* pCmdList, GpaSampleType sampleType, ClientSampleId sampleId)
     : GPASample(pPass, pCmdList, sampleType, sampleId)
     , m_pClCounters(nullptr)
+    , m_pCounterBlockSet(nullptr)
     , m_clEvent(nullptr)
     , m_dataReadyCount(0)
 {
@@ -33,8 +34,7 @@ CLGPASample::CLGPASample(GPAPass* pPass, IGPACommandList* pCmdList, GpaSampleTyp
 
 CLGPASample::~CLGPASample()
 {
-    ReleaseBlockCounters();
-    DeleteCounterBlocks();
+    ReleaseCounterBlocks();
     delete[] m_pClCounters;
 }
 
@@ -44,12 +44,14 @@ bool CLGPASample::UpdateResults()
 
     CounterCount counterCount = GetPass()->GetEnabledCounterCount();
 
-    if (nullptr != m_clEvent)
+    std::vector<clPerfCounterBlock*>* pCounterBlocks = nullptr != m_pCounterBlockSet ? &m_pCounterBlockSet->m_counterBlocks : nullptr;
+
+    if (nullptr != m_clEvent && nullptr != pCounterBlocks)
     {
         // Get the data from opencl interface
-        for (gpa_uint32 i = 0; i < m_clCounterBlocks.size(); ++i)
+        for (gpa_uint32 i = 0; i < pCounterBlocks->size(); ++i)
         {
-            m_clCounterBlocks[i]->CollectData(&m_clEvent);
+            (*pCounterBlocks)[i]->CollectData(&m_clEvent);
         }
 
         // get and set the result to m_pCounters
@@ -70,9 +72,9 @@ bool CLGPASample::UpdateResults()
                     return false;
                 }
 
-                if (m_clCounterBlocks[blockID]->IsComplete())
+                if ((*pCounterBlocks)[blockID]->IsComplete())
                 {
-                    GetSampleResultLocation()->GetAsCounterSampleResult()->GetResultBuffer()[i] = m_clCounterBlocks[blockID]->GetResult(counterID);
+                    GetSampleResultLocation()->GetAsCounterSampleResult()->GetResultBuffer()[i] = (*pCounterBlocks)[blockID]->GetResult(counterID);
                     m_pClCounters[i].m_isCounterResultReady                                     = true;
                     m_dataReadyCount++;
                 }
@@ -88,6 +90,8 @@ bool CLGPASample::UpdateResults()
 
     if (isComplete)
     {
+        // the results have been copied, so the driver counters can be used by the next sample of the pass
+        ReleaseCounterBlocks();
         MarkAsCompleted();
     }
 
@@ -110,53 +114,23 @@ bool CLGPASample::BeginRequest()
             return false;
         }
 
-        IGPACounterAccessor*        pCounterAccessor  = GPAContextCounterMediator::Instance()->GetCounterAccessor(m_pCLGpaContext);
-        const GPA_HardwareCounters* pHardwareCounters = pCounterAccessor->GetHardwareCounters();
-
-        bool         populateCounterInfoStatus = true;
-        unsigned int counterGroupSize          = 0u;
-
-        auto PopulateCLPerFCounterInfo = [&](GroupCountersPair groupCountersPair) -> bool {
-            bool counterStatus = true;
-
-            gpa_uint32          maxCountersEnabled = static_cast<gpa_uint32>(pHardwareCounters->m_pGroups[groupCountersPair.first].m_maxActiveDiscreteCounters);
-            clPerfCounterBlock* clBlock            = nullptr;
-
-            clBlock =
-                new (std::nothrow) clPerfCounterBlock(m_pCLGpaContext->GetCLDeviceId(), groupCountersPair.first, maxCountersEnabled, groupCountersPair.second);
-
-            if (nullptr == clBlock)
-            {
-                GPA_LogError("Unable to allocate memory for CL counter blocks.");
-                counterStatus = false;
-            }
-            else
-            {
-                m_clCounterBlocks.push_back(clBlock);
-
-                // store the opencl counters into an array so we can use one call of clEnqueueBeginPerfCounterAMD for all of them
-                cl_perfcounter_amd* pClCounters = clBlock->GetCounterArray(0);
-
-                for (gpa_uint32 i = 0; i < clBlock->GetCounterCount(); ++i)
-                {
-                    m_clCounterList.push_back(pClCounters[i]);
-                }
-            }
-
-            populateCounterInfoStatus &= counterStatus;
-            counterGroupSize++;
-            return counterStatus;
-        };
+        IGPACounterAccessor* pCounterAccessor = GPAContextCounterMediator::Instance()->GetCounterAccessor(m_pCLGpaContext);
 
         CLGPAPass* pClGpaPass = reinterpret_cast<CLGPAPass*>(GetPass());
 
-        // loop through the requested counters and create and enable them
-        pClGpaPass->IterateCLCounterMap(PopulateCLPerFCounterInfo);
+        // the counter blocks of samples whose results have been collected are reused, so the driver counters are only created once per pass
+        m_pCounterBlockSet = pClGpaPass->AcquireCounterBlockSet();
+
+        if (nullptr == m_pCounterBlockSet || m_pCounterBlockSet->m_counterList.empty())
+        {
+            GPA_LogError("Unable to create the CL counter blocks.");
+            return false;
+        }
 
-        assert(m_clCounterBlocks.size() == counterGroupSize);
+        std::vector<cl_perfcounter_amd>& clCounterList = m_pCounterBlockSet->m_counterList;
 
         if (CL_SUCCESS !=
-            my_clEnqueueBeginPerfCounterAMD(m_pCLGpaContext->GetCLCommandQueue(), static_cast<cl_uint>(m_clCounterList.size()), &m_clCounterList[0], 0, 0, 0))
+            my_clEnqueueBeginPerfCounterAMD(m_pCLGpaContext->GetCLCommandQueue(), static_cast<cl_uint>(clCounterList.size()), &clCounterList[0], 0, 0, 0))
         {
             //Reset(selectionID, pCounters);
             return false;
@@ -188,23 +162,31 @@ bool CLGPASample::BeginRequest()
 
 bool CLGPASample::EndRequest()
 {
-    bool success =
-        (CL_SUCCESS == my_clEnqueueEndPerfCounterAMD(
-                           m_pCLGpaContext->GetCLCommandQueue(), static_cast<cl_uint>(m_clCounterList.size()), &m_clCounterList[0], 0, 0, &m_clEvent));
+    if (nullptr == m_pCounterBlockSet)
+    {
+        return false;
+    }
+
+    std::vector<cl_perfcounter_amd>& clCounterList = m_pCounterBlockSet->m_counterList;
+
+    bool success = (CL_SUCCESS == my_clEnqueueEndPerfCounterAMD(
+                                      m_pCLGpaContext->GetCLCommandQueue(), static_cast<cl_uint>(clCounterList.size()), &clCounterList[0], 0, 0, &m_clEvent));
 
     return success;
 }
 
 void CLGPASample::ReleaseCounters()
 {
-    ReleaseBlockCounters();
+    ReleaseCounterBlocks();
 }
 
 bool CLGPASample::FindBlockID(gpa_uint32& blockID, gpa_uint32 groupID)
 {
-    for (gpa_uint32 i = 0; i < m_clCounterBlocks.size(); ++i)
+    const std::vector<clPerfCounterBlock*>& counterBlocks = m_pCounterBlockSet->m_counterBlocks;
+
+    for (gpa_uint32 i = 0; i < counterBlocks.size(); ++i)
     {
-        if (groupID == m_clCounterBlocks[i]->GetBlockID())
+        if (groupID == counterBlocks[i]->GetBlockID())
         {
             blockID = i;
             return true;
@@ -214,23 +196,22 @@ bool CLGPASample::FindBlockID(gpa_uint32& blockID, gpa_uint32 groupID)
     return false;
 }
 
-void CLGPASample::DeleteCounterBlocks()
+void CLGPASample::ReleaseCounterBlocks()
 {
-    if (!m_clCounterBlocks.empty())
+    if (nullptr == m_pCounterBlockSet)
     {
-        for (gpa_uint32 i = 0; i < m_clCounterBlocks.size(); ++i)
-        {
-            delete m_clCounterBlocks[i];
-        }
+        return;
     }
 
-    m_clCounterBlocks.clear();
-}
-
-void CLGPASample::ReleaseBlockCounters()
-{
-    for (gpa_uint32 i = 0; i < m_clCounterBlocks.size(); ++i)
+    if (m_dataReadyCount == GetPass()->GetEnabledCounterCount())
     {
-        m_clCounterBlocks[i]->ReleaseCounters();
+        reinterpret_cast<CLGPAPass*>(GetPass())->ReleaseCounterBlockSet(m_pCounterBlockSet);
     }
+    else
+    {
+        // the driver may still be using the counters of a sample whose results have not been collected
+        CLGPAPass::DeleteCounterBlockSet(m_pCounterBlockSet);
+    }
+
+    m_pCounterBlockSet = nullptr;
 }
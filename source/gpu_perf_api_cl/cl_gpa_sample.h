@@ -12,7 +12,7 @@
 
 #include "gpa_sample.h"
 #include "cl_gpa_context.h"
-#include "cl_perf_counter_block.h"
+#include "cl_gpa_pass.h"
 
 /// Class for CL Specific sample
 class CLGPASample : public GPASample
@@ -50,11 +50,8 @@ private:
     /// \return True if the group was found, false otherwise.
     bool FindBlockID(gpa_uint32& blockID, gpa_uint32 groupID);
 
-    /// Deletes counter block objects
-    void DeleteCounterBlocks();
-
-    /// Release allocated counters
-    void ReleaseBlockCounters();
+    /// Returns the counter blocks of the sample to the pool of the pass, or deletes them if their driver work may not be complete
+    void ReleaseCounterBlocks();
 
     /// structure used to store data that is needed to retrieve and store the results for a counter
     struct CLCounter
@@ -71,12 +68,10 @@ private:
         bool       m_isCounterResultReady = false;  ///< indicates whether the result has been stored in the pCounterResult buffer
     };
 
-    CLGPAContext* m_pCLGpaContext;  ///< Cache the context pointer
-    CLCounter*    m_pClCounters;    ///< store the counters' data
-
-    std::vector<clPerfCounterBlock*> m_clCounterBlocks;  ///< store the data to interface with opencl counters per HW block
-    std::vector<cl_perfcounter_amd>  m_clCounterList;    ///< store the opencl counters
-    cl_event                         m_clEvent;          ///< cl event to synchronize the counters
+    CLGPAContext*      m_pCLGpaContext;     ///< Cache the context pointer
+    CLCounter*         m_pClCounters;       ///< store the counters' data
+    CLCounterBlockSet* m_pCounterBlockSet;  ///< the counter blocks of the sample, taken from the pool of the pass
+    cl_event           m_clEvent;           ///< cl event to synchronize the counters
 
     gpa_uint32 m_dataReadyCount;  ///< number of counters with data ready
 };
@@ -47,6 +47,12 @@ public:
     /// Release the counters that were created in the CL runtime
     void ReleaseCounters();
 
+    /// Discards the collected results so that the counters of the block can be used by another sample
+    void ResetResults()
+    {
+        m_isResultReady = false;
+    }
+
     /// Collect data from the HW performance counters
     /// \param clEvent  event to synchronize the result (this should be the event from clEnqueueEndPerfCounterAMD())
     /// \return true if successfull, false otherwise
@@ -9,6 +9,8 @@
 #define _GPA_CIRCULAR_BUFFER_H_
 
 #include <assert.h>
+#include <atomic>
+#include <new>
 #ifdef _LINUX
 #include <cstddef>
 #endif
@@ -226,6 +228,8 @@ public:
         m_pArray[m_tailIndex] = item;
         circularIncrement(m_tailIndex);
         m_count++;
+
+        return true;
     }
 
     /// Gets a reference to the item at the head of the buffer.
@@ -364,4 +368,166 @@ protected:
     unsigned int m_count;      ///< current number of elements in the buffer
 };
 
+/// A bounded circular buffer of fixed-length records which can be used by one producer thread and one consumer thread
+/// at the same time without locking.
+/// Unlike CircularBuffer, adding to a full buffer does not remove the item at the head, as the head belongs to the
+/// consumer: lockNext fails instead and the producer decides what to do with the record.
+/// Each record is an array of getRecordLength() objects of the templated type.
+template <class T>
+class ConcurrentCircularBuffer
+{
+public:
+    /// Initializes a new instance of the ConcurrentCircularBuffer<T> class
+    ConcurrentCircularBuffer()
+        : m_pArray(nullptr)
+        , m_recordLength(0)
+        , m_size(0)
+        , m_headIndex(0)
+        , m_tailIndex(0)
+    {
+    }
+
+    /// Deletes the underlying array
+    ~ConcurrentCircularBuffer()
+    {
+        delete[] m_pArray;
+    }
+
+    /// Copying would not be thread-safe
+    ConcurrentCircularBuffer(const ConcurrentCircularBuffer<T>& obj) = delete;
+
+    /// Copying would not be thread-safe
+    ConcurrentCircularBuffer<T>& operator=(const ConcurrentCircularBuffer<T>& obj) = delete;
+
+    /// Sets the size of the circular buffer and removes all of its records.
+    /// Needs to be called before using the buffer, while neither the producer nor the consumer is using it.
+    /// \param size the number of records this circular buffer should be capable of holding, rounded up to a power of two.
+    /// \param recordLength the number of objects in each record
+    /// \return true if the size could be set, false otherwise
+    bool setSize(unsigned int size, unsigned int recordLength)
+    {
+        delete[] m_pArray;
+        m_pArray       = nullptr;
+        m_recordLength = 0;
+        m_size         = 0;
+        clear();
+
+        if (0 == size || 0 == recordLength || MAX_SIZE < size)
+        {
+            return false;
+        }
+
+        // with a power of two size, the free running indices below stay consistent when they wrap around
+        unsigned int roundedSize = 1;
+
+        while (roundedSize < size)
+        {
+            roundedSize <<= 1;
+        }
+
+        m_pArray = new (std::nothrow) T[static_cast<size_t>(roundedSize) * recordLength];
+
+        if (nullptr == m_pArray)
+        {
+            return false;
+        }
+
+        m_recordLength = recordLength;
+        m_size         = roundedSize;
+        return true;
+    }
+
+    /// Removes all records, but keeps the underlying array.
+    /// Must not be called while the producer or the consumer is using the buffer.
+    void clear()
+    {
+        m_headIndex.store(0, std::memory_order_relaxed);
+        m_tailIndex.store(0, std::memory_order_relaxed);
+    }
+
+    /// Indicates whether or not this buffer has been initialized
+    /// \return True if the buffer was initialized; false otherwise.
+    bool initialized() const
+    {
+        return nullptr != m_pArray;
+    }
+
+    /// Gets the size of the circular buffer.
+    /// \return the maximum number of records this circular buffer can hold.
+    unsigned int getSize() const
+    {
+        return m_size;
+    }
+
+    /// Gets the length of the records of the circular buffer.
+    /// \return the number of objects in each record.
+    unsigned int getRecordLength() const
+    {
+        return m_recordLength;
+    }
+
+    /// Gets the number of records in the circular buffer.
+    /// The count may already be outdated when it is returned if the other thread is using the buffer.
+    /// \return the number of records currently in the buffer.
+    unsigned int getCount() const
+    {
+        return m_tailIndex.load(std::memory_order_acquire) - m_headIndex.load(std::memory_order_acquire);
+    }
+
+    /// Gets direct access to the next record, to be filled in by the producer (avoids copying).
+    /// addLockedItem should be called once it's filled in.
+    /// Must only be called by the producer.
+    /// \return the next record, or nullptr if the buffer is full or not initialized
+    T* lockNext()
+    {
+        unsigned int tailIndex = m_tailIndex.load(std::memory_order_relaxed);
+
+        if (!initialized() || tailIndex - m_headIndex.load(std::memory_order_acquire) == m_size)
+        {
+            return nullptr;
+        }
+
+        return m_pArray + static_cast<size_t>(tailIndex & (m_size - 1)) * m_recordLength;
+    }
+
+    /// Makes the record returned by lockNext visible to the consumer.
+    /// Must only be called by the producer, after a successful call to lockNext.
+    void addLockedItem()
+    {
+        m_tailIndex.store(m_tailIndex.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /// Gets the record at the head of the buffer, without removing it.
+    /// Must only be called by the consumer.
+    /// \return the record at the head of the buffer, or nullptr if the buffer is empty
+    const T* getHead() const
+    {
+        unsigned int headIndex = m_headIndex.load(std::memory_order_relaxed);
+
+        if (headIndex == m_tailIndex.load(std::memory_order_acquire))
+        {
+            return nullptr;
+        }
+
+        return m_pArray + static_cast<size_t>(headIndex & (m_size - 1)) * m_recordLength;
+    }
+
+    /// Removes the record at the head of the buffer, making its storage available to the producer.
+    /// Must only be called by the consumer, after getHead returned a record.
+    void erase()
+    {
+        m_headIndex.store(m_headIndex.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    static const unsigned int MAX_SIZE = 1u << 31;  ///< largest number of records the buffer can hold
+
+private:
+    T*           m_pArray;        ///< underlying array of this circular buffer, holding m_size records
+    unsigned int m_recordLength;  ///< number of objects in each record
+    unsigned int m_size;          ///< maximum number of records in the buffer at any one time, a power of two
+
+    alignas(64) std::atomic<unsigned int> m_headIndex;  ///< number of records removed by the consumer, the head is at this index modulo m_size
+    alignas(64) std::atomic<unsigned int> m_tailIndex;  ///< number of records added by the producer, the tail is at this index modulo m_size
+};
+
 #endif  //_GPA_CIRCULAR_BUFFER_H_
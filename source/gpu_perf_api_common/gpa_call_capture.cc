@@ -0,0 +1,280 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Capture of the calls made through the GPA function table into a replayable call trace
+//==============================================================================
+
+#include <cstdlib>
+
+#include "gpa_call_capture.h"
+
+GPACallCapture g_callCapture;
+
+GPACallCapture::GPACallCapture()
+    : m_isEnabled(false)
+    , m_isFunctionTableSet(false)
+    , m_previousStartTime(0)
+    , m_nextHandleId(1)
+{
+    const char* pTraceFilePath = std::getenv(GPA_CALL_CAPTURE_FILE_ENV_VAR);
+
+    if (nullptr != pTraceFilePath && '\0' != *pTraceFilePath)
+    {
+        Start(pTraceFilePath);
+    }
+}
+
+GPACallCapture::~GPACallCapture()
+{
+    Stop();
+}
+
+bool GPACallCapture::Start(const std::string& traceFilePath)
+{
+    Stop();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_traceFile.open(traceFilePath.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+
+    if (!m_traceFile.is_open())
+    {
+        return false;
+    }
+
+    GPACallTraceWriter header;
+    GPA_WriteCallTraceHeader(header);
+    m_traceFile.write(header.GetData().data(), header.GetData().size());
+
+    // the handles and threads of a previous capture are unknown to the new trace
+    m_isFunctionTableSet = false;
+    m_previousStartTime  = 0;
+    m_nextHandleId       = 1;
+    m_handleIds.clear();
+    m_threadIndices.clear();
+
+    m_startTime = std::chrono::steady_clock::now();
+    m_isEnabled.store(true, std::memory_order_release);
+    return true;
+}
+
+void GPACallCapture::Stop()
+{
+    if (!m_isEnabled.exchange(false))
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_traceFile.close();
+}
+
+void GPACallCapture::WrapFunctionTable(GPAFunctionTable& functionTable)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (!m_isFunctionTableSet)
+    {
+        m_functionTable      = functionTable;
+        m_isFunctionTableSet = true;
+    }
+
+#define GPA_FUNCTION_PREFIX(func) \
+    functionTable.func = &GPACapturedCall<decltype(functionTable.func) GPAFunctionTable::*, &GPAFunctionTable::func, GPA_API_CALL_ID_##func>::Call;
+#include "gpu_perf_api_functions.h"
+#undef GPA_FUNCTION_PREFIX
+
+    // getting the function table again is not captured: it returns another capturing table
+    functionTable.GPA_GetFuncTable = m_functionTable.GPA_GetFuncTable;
+}
+
+gpa_uint64 GPACallCapture::GetHandleId_NotThreadSafe(const void* handle, bool isNew)
+{
+    if (nullptr == handle)
+    {
+        return 0;
+    }
+
+    // a handle which is not new and is unknown was created before the capture started, it gets an id on its first use
+    auto handleIdIter = m_handleIds.find(handle);
+
+    if (isNew || m_handleIds.end() == handleIdIter)
+    {
+        // the address of a deleted object may be reused by a new one, which must have another id
+        gpa_uint64 handleId = m_nextHandleId++;
+        m_handleIds[handle] = handleId;
+        return handleId;
+    }
+
+    return handleIdIter->second;
+}
+
+gpa_uint32 GPACallCapture::GetThreadIndex_NotThreadSafe()
+{
+    auto threadIndexIter = m_threadIndices.find(std::this_thread::get_id());
+
+    if (m_threadIndices.end() != threadIndexIter)
+    {
+        return threadIndexIter->second;
+    }
+
+    gpa_uint32 threadIndex                      = static_cast<gpa_uint32>(m_threadIndices.size());
+    m_threadIndices[std::this_thread::get_id()] = threadIndex;
+    return threadIndex;
+}
+
+void GPACallCapture::WritePayload(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_OpenContext>,
+                                  GPACallTraceWriter&  payload,
+                                  GPA_Status           status,
+                                  void*                pContext,
+                                  GPA_OpenContextFlags flags,
+                                  GPA_ContextId*       pContextId)
+{
+    UNREFERENCED_PARAMETER(pContext);
+    UNREFERENCED_PARAMETER(flags);
+
+    if (GPA_STATUS_OK != status || nullptr == pContextId)
+    {
+        return;
+    }
+
+    gpa_uint32 deviceId    = 0;
+    gpa_uint32 revisionId  = 0;
+    gpa_uint32 numCounters = 0;
+
+    // the functions of the table are not captured
+    if (GPA_STATUS_OK != m_functionTable.GPA_GetDeviceAndRevisionId(*pContextId, &deviceId, &revisionId) ||
+        GPA_STATUS_OK != m_functionTable.GPA_GetNumCounters(*pContextId, &numCounters))
+    {
+        return;
+    }
+
+    payload.WriteUInt(deviceId);
+    payload.WriteUInt(revisionId);
+    payload.WriteUInt(numCounters);
+
+    for (gpa_uint32 counterIndex = 0; counterIndex < numCounters; ++counterIndex)
+    {
+        const char* pCounterName = nullptr;
+        m_functionTable.GPA_GetCounterName(*pContextId, counterIndex, &pCounterName);
+        payload.WriteString(pCounterName);
+    }
+}
+
+void GPACallCapture::WritePayload(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_CopySecondarySamples>,
+                                  GPACallTraceWriter& payload,
+                                  GPA_Status          status,
+                                  GPA_CommandListId   secondaryCommandListId,
+                                  GPA_CommandListId   primaryCommandListId,
+                                  gpa_uint32          numSamples,
+                                  gpa_uint32*         pNewSampleIds)
+{
+    UNREFERENCED_PARAMETER(status);
+    UNREFERENCED_PARAMETER(secondaryCommandListId);
+    UNREFERENCED_PARAMETER(primaryCommandListId);
+
+    if (nullptr == pNewSampleIds)
+    {
+        return;
+    }
+
+    for (gpa_uint32 sampleIndex = 0; sampleIndex < numSamples; ++sampleIndex)
+    {
+        payload.WriteUInt(pNewSampleIds[sampleIndex]);
+    }
+}
+
+void GPACallCapture::WritePayload(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_GetSampleResult>,
+                                  GPACallTraceWriter& payload,
+                                  GPA_Status          status,
+                                  GPA_SessionId       sessionId,
+                                  gpa_uint32          sampleId,
+                                  size_t              sampleResultSizeInBytes,
+                                  void*               pCounterSampleResults)
+{
+    UNREFERENCED_PARAMETER(sessionId);
+    UNREFERENCED_PARAMETER(sampleId);
+
+    if (GPA_STATUS_OK == status && nullptr != pCounterSampleResults)
+    {
+        payload.WriteBytes(pCounterSampleResults, sampleResultSizeInBytes);
+    }
+}
+
+void GPACallCapture::WritePayload(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_GetSessionResultsByCounter>,
+                                  GPACallTraceWriter& payload,
+                                  GPA_Status          status,
+                                  GPA_SessionId       sessionId,
+                                  size_t              resultsSizeInBytes,
+                                  void*               pCounterResults)
+{
+    UNREFERENCED_PARAMETER(sessionId);
+
+    if (GPA_STATUS_OK == status && nullptr != pCounterResults)
+    {
+        payload.WriteBytes(pCounterResults, resultsSizeInBytes);
+    }
+}
+
+void GPACallCapture::WritePayload(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_GetPartialSampleResult>,
+                                  GPACallTraceWriter& payload,
+                                  GPA_Status          status,
+                                  GPA_SessionId       sessionId,
+                                  gpa_uint32          sampleId,
+                                  size_t              sampleResultSizeInBytes,
+                                  void*               pCounterSampleResults,
+                                  gpa_uint8*          pCounterResultAvailable)
+{
+    UNREFERENCED_PARAMETER(sampleId);
+
+    gpa_uint32 numEnabledCounters = 0;
+
+    if ((GPA_STATUS_OK != status && GPA_STATUS_RESULT_NOT_READY != status) || nullptr == pCounterSampleResults || nullptr == pCounterResultAvailable ||
+        GPA_STATUS_OK != m_functionTable.GPA_GetNumEnabledCounters(sessionId, &numEnabledCounters) ||
+        numEnabledCounters * sizeof(gpa_uint64) > sampleResultSizeInBytes)
+    {
+        return;
+    }
+
+    // only the available results were written
+    const gpa_uint64* pResults = static_cast<const gpa_uint64*>(pCounterSampleResults);
+
+    payload.WriteUInt(numEnabledCounters);
+
+    for (gpa_uint32 enabledIndex = 0; enabledIndex < numEnabledCounters; ++enabledIndex)
+    {
+        payload.WriteUInt(pCounterResultAvailable[enabledIndex]);
+
+        if (0 != pCounterResultAvailable[enabledIndex])
+        {
+            payload.WriteBytes(&pResults[enabledIndex], sizeof(gpa_uint64));
+        }
+    }
+}
+
+void GPACallCapture::WritePayload(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_GetStreamingCounterResults>,
+                                  GPACallTraceWriter&         payload,
+                                  GPA_Status                  status,
+                                  GPA_SessionId               sessionId,
+                                  gpa_uint64                  bucketDuration,
+                                  gpa_uint32                  maxBuckets,
+                                  GPA_StreamingCounterBucket* pBuckets,
+                                  void*                       pCounterResults,
+                                  gpa_uint32*                 pNumBuckets)
+{
+    UNREFERENCED_PARAMETER(bucketDuration);
+
+    gpa_uint32 numEnabledCounters = 0;
+
+    if ((GPA_STATUS_OK != status && GPA_STATUS_RESULT_NOT_READY != status) || nullptr == pBuckets || nullptr == pCounterResults ||
+        nullptr == pNumBuckets || *pNumBuckets > maxBuckets || GPA_STATUS_OK != m_functionTable.GPA_GetNumEnabledCounters(sessionId, &numEnabledCounters))
+    {
+        return;
+    }
+
+    payload.WriteUInt(*pNumBuckets);
+    payload.WriteUInt(numEnabledCounters);
+    payload.WriteBytes(pBuckets, *pNumBuckets * sizeof(GPA_StreamingCounterBucket));
+    payload.WriteBytes(pCounterResults, static_cast<size_t>(*pNumBuckets) * numEnabledCounters * sizeof(gpa_uint64));
+}
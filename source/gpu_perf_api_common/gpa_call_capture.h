@@ -0,0 +1,353 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Capture of the calls made through the GPA function table into a replayable call trace
+//==============================================================================
+
+#ifndef _GPA_CALL_CAPTURE_H_
+#define _GPA_CALL_CAPTURE_H_
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include "gpu_perf_api.h"
+#include "gpa_call_recorder.h"
+#include "gpa_call_trace.h"
+
+/// Environment variable holding the path of the call trace to capture, read when GPA is loaded
+#define GPA_CALL_CAPTURE_FILE_ENV_VAR "GPA_CALL_CAPTURE_FILE"
+
+template <typename FunctionMember, FunctionMember pFunction, GPA_ApiCallId apiId>
+struct GPACapturedCall;
+
+/// Captures the calls made through the GPA function table into a call trace (see gpa_call_trace.h).
+///
+/// While the capture is started, GPA_GetFuncTable returns a table whose functions call the GPA entry points and write
+/// each call, with its arguments, what it returned and how long it took, to the trace. Applications using
+/// gpu_perf_api_interface_loader.h get their functions from this table, so they can be captured without being rebuilt,
+/// by setting GPA_CALL_CAPTURE_FILE before GPA is loaded. Calls made to the exported functions directly are not captured.
+///
+/// The trace is not the log of GPACallRecorder: the recorder keeps the cost of each call to a fixed-size record of raw
+/// integer and pointer values, to diagnose an application, while the replay needs what the call read and wrote through
+/// its pointers, the handles it created and the counter names of each context, which only a variable-size encoding can hold.
+class GPACallCapture
+{
+public:
+    /// Initializes a new instance of the GPACallCapture class, starting the capture if GPA_CALL_CAPTURE_FILE is set
+    GPACallCapture();
+
+    /// Stops the capture, completing the trace
+    ~GPACallCapture();
+
+    /// Starts capturing the calls to a new trace, completing the trace of the previous capture
+    /// \param[in] traceFilePath the path of the trace, which is overwritten
+    /// \return true if the trace could be created, false otherwise
+    bool Start(const std::string& traceFilePath);
+
+    /// Stops capturing the calls, completing the trace. Calls made through a capturing function table are still forwarded to GPA.
+    void Stop();
+
+    /// Indicates whether the calls are captured
+    /// \return true if the capture is started
+    bool IsEnabled() const
+    {
+        return m_isEnabled.load(std::memory_order_acquire);
+    }
+
+    /// Replaces the functions of a function table with functions capturing the calls to them. The first table wrapped
+    /// after the capture starts holds the functions to which the captured calls are forwarded.
+    /// \param[in,out] functionTable the function table to wrap
+    void WrapFunctionTable(GPAFunctionTable& functionTable);
+
+private:
+    template <typename FunctionMember, FunctionMember pFunction, GPA_ApiCallId apiId>
+    friend struct GPACapturedCall;
+
+    GPACallCapture(const GPACallCapture&) = delete;
+    GPACallCapture& operator=(const GPACallCapture&) = delete;
+
+    /// Gets the time elapsed since the capture started
+    /// \return the time elapsed since the capture started, in nanoseconds
+    gpa_uint64 GetTime() const
+    {
+        return static_cast<gpa_uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_startTime).count());
+    }
+
+    /// Writes a call to the trace
+    /// \param[in] apiId the entry point called
+    /// \param[in] startTime the time at which the call started
+    /// \param[in] endTime the time at which the call returned
+    /// \param[in] payload the payload of the call
+    /// \param[in] retVal the value returned by the call
+    /// \param[in] args the arguments of the call
+    template <typename Ret, typename... Args>
+    void WriteCall(GPA_ApiCallId apiId, gpa_uint64 startTime, gpa_uint64 endTime, const GPACallTraceWriter& payload, Ret retVal, Args... args)
+    {
+        // an output is only read when the call succeeded, otherwise it may not have been initialized
+        const bool succeeded = IsSuccess(retVal);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (!m_traceFile.is_open())
+        {
+            return;
+        }
+
+        GPACallTraceWriter body;
+        EncodeValue(body, retVal, false, GPACallArgTag<Ret>());
+
+        const int encodedArgs[] = {0, (EncodeArg(body, args, succeeded), 0)...};
+        UNREFERENCED_PARAMETER(encodedArgs);
+        UNREFERENCED_PARAMETER(succeeded);
+
+        body.WriteSizedData(payload);
+
+        GPACallTraceCall call;
+        call.m_apiId       = static_cast<gpa_uint32>(apiId);
+        call.m_threadIndex = GetThreadIndex_NotThreadSafe();
+        call.m_startTime   = startTime;
+        call.m_duration    = endTime - startTime;
+
+        GPACallTraceWriter record;
+        GPA_WriteCallTraceRecord(record, m_previousStartTime, call, body);
+        m_traceFile.write(record.GetData().data(), record.GetData().size());
+    }
+
+    /// Indicates whether a call succeeded
+    /// \param[in] status the status returned by the call
+    /// \return true if the call succeeded
+    static bool IsSuccess(GPA_Status status)
+    {
+        return GPA_STATUS_OK == status;
+    }
+
+    /// Indicates whether a call succeeded, for the entry points which do not return a status
+    /// \return true
+    static bool IsSuccess(const char*)
+    {
+        return true;
+    }
+
+    /// Writes an argument of a call
+    /// \param[in,out] writer the writer of the call
+    /// \param[in] value the argument
+    /// \param[in] succeeded flag indicating whether the call succeeded
+    template <typename T>
+    void EncodeArg(GPACallTraceWriter& writer, T value, bool succeeded)
+    {
+        EncodeArg(writer, value, succeeded, GPACallArgTag<T>());
+    }
+
+    /// Writes an input argument of a call
+    /// \param[in,out] writer the writer of the call
+    /// \param[in] value the argument
+    /// \param[in] tag the encoding of the argument
+    template <typename T, GPACallArgKind kind>
+    void EncodeArg(GPACallTraceWriter& writer, T value, bool, std::integral_constant<GPACallArgKind, kind> tag)
+    {
+        EncodeValue(writer, value, false, tag);
+    }
+
+    /// Writes an output argument of a call
+    /// \param[in,out] writer the writer of the call
+    /// \param[in] pValue the argument
+    /// \param[in] succeeded flag indicating whether the call succeeded, in which case the output is written
+    template <typename T>
+    void EncodeArg(GPACallTraceWriter& writer, T* pValue, bool succeeded, std::integral_constant<GPACallArgKind, GPA_CALL_ARG_OUTPUT_POINTER>)
+    {
+        if (nullptr == pValue)
+        {
+            writer.WriteUInt(GPACallTraceWriter::POINTER_NULL);
+        }
+        else if (!succeeded)
+        {
+            writer.WriteUInt(GPACallTraceWriter::POINTER_NOT_WRITTEN);
+        }
+        else
+        {
+            writer.WriteUInt(GPACallTraceWriter::POINTER_VALUE);
+            EncodeValue(writer, *pValue, true, GPACallArgTag<T>());
+        }
+    }
+
+    /// Writes an integer or enum
+    /// \param[in,out] writer the writer of the call
+    /// \param[in] value the value
+    template <typename T>
+    void EncodeValue(GPACallTraceWriter& writer, T value, bool, std::integral_constant<GPACallArgKind, GPA_CALL_ARG_VALUE>)
+    {
+        writer.WriteInt(static_cast<int64_t>(value));
+    }
+
+    /// Writes a handle
+    /// \param[in,out] writer the writer of the call
+    /// \param[in] handle the handle
+    /// \param[in] isOutput flag indicating whether the handle was returned by the call, in which case it gets a new id
+    template <typename T>
+    void EncodeValue(GPACallTraceWriter& writer, T handle, bool isOutput, std::integral_constant<GPACallArgKind, GPA_CALL_ARG_HANDLE>)
+    {
+        writer.WriteUInt(GetHandleId_NotThreadSafe(handle, isOutput));
+    }
+
+    /// Writes a string
+    /// \param[in,out] writer the writer of the call
+    /// \param[in] pString the string
+    void EncodeValue(GPACallTraceWriter& writer, const char* pString, bool, std::integral_constant<GPACallArgKind, GPA_CALL_ARG_STRING>)
+    {
+        writer.WriteString(pString);
+    }
+
+    /// Writes a structure
+    /// \param[in,out] writer the writer of the call
+    /// \param[in] value the structure
+    template <typename T>
+    void EncodeValue(GPACallTraceWriter& writer, const T& value, bool, std::integral_constant<GPACallArgKind, GPA_CALL_ARG_STRUCT>)
+    {
+        writer.WriteBytes(&value, sizeof(T));
+    }
+
+    /// Writes a pointer to opaque data or to a function: only whether it is null is known
+    /// \param[in,out] writer the writer of the call
+    /// \param[in] pValue the pointer
+    template <typename T>
+    void EncodeValue(GPACallTraceWriter& writer, T pValue, bool, std::integral_constant<GPACallArgKind, GPA_CALL_ARG_OPAQUE_POINTER>)
+    {
+        writer.WriteUInt(nullptr == pValue ? GPACallTraceWriter::POINTER_NULL : GPACallTraceWriter::POINTER_VALUE);
+    }
+
+    /// Writes a pointer to a constant value
+    /// \param[in,out] writer the writer of the call
+    /// \param[in] pValue the pointer
+    template <typename T>
+    void EncodeValue(GPACallTraceWriter& writer, const T* pValue, bool, std::integral_constant<GPACallArgKind, GPA_CALL_ARG_INPUT_POINTER>)
+    {
+        if (nullptr == pValue)
+        {
+            writer.WriteUInt(GPACallTraceWriter::POINTER_NULL);
+        }
+        else
+        {
+            writer.WriteUInt(GPACallTraceWriter::POINTER_VALUE);
+            EncodeValue(writer, *pValue, false, GPACallArgTag<T>());
+        }
+    }
+
+    /// Gets the id of a handle in the trace. Requires m_mutex.
+    /// \param[in] handle the handle
+    /// \param[in] isNew flag indicating whether the handle was just created, in which case it gets a new id
+    /// \return the id of the handle, 0 for a null handle
+    gpa_uint64 GetHandleId_NotThreadSafe(const void* handle, bool isNew);
+
+    /// Gets the index of the calling thread in the trace. Requires m_mutex.
+    /// \return the index of the calling thread
+    gpa_uint32 GetThreadIndex_NotThreadSafe();
+
+    /// Writes the payload of a call: by default, there is none
+    template <GPA_ApiCallId apiId, typename Ret, typename... Args>
+    void WritePayload(std::integral_constant<GPA_ApiCallId, apiId>, GPACallTraceWriter&, Ret, Args...)
+    {
+    }
+
+    /// Writes the payload of GPA_OpenContext: the device of the context and the names of its counters, so that the replay
+    /// can simulate the device and find the counters of the capture
+    void WritePayload(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_OpenContext>,
+                      GPACallTraceWriter&  payload,
+                      GPA_Status           status,
+                      void*                pContext,
+                      GPA_OpenContextFlags flags,
+                      GPA_ContextId*       pContextId);
+
+    /// Writes the payload of GPA_CopySecondarySamples: the ids of the new samples
+    void WritePayload(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_CopySecondarySamples>,
+                      GPACallTraceWriter& payload,
+                      GPA_Status          status,
+                      GPA_CommandListId   secondaryCommandListId,
+                      GPA_CommandListId   primaryCommandListId,
+                      gpa_uint32          numSamples,
+                      gpa_uint32*         pNewSampleIds);
+
+    /// Writes the payload of GPA_GetSampleResult: the results of the sample
+    void WritePayload(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_GetSampleResult>,
+                      GPACallTraceWriter& payload,
+                      GPA_Status          status,
+                      GPA_SessionId       sessionId,
+                      gpa_uint32          sampleId,
+                      size_t              sampleResultSizeInBytes,
+                      void*               pCounterSampleResults);
+
+    /// Writes the payload of GPA_GetSessionResultsByCounter: the results of the session
+    void WritePayload(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_GetSessionResultsByCounter>,
+                      GPACallTraceWriter& payload,
+                      GPA_Status          status,
+                      GPA_SessionId       sessionId,
+                      size_t              resultsSizeInBytes,
+                      void*               pCounterResults);
+
+    /// Writes the payload of GPA_GetPartialSampleResult: the available results of the sample
+    void WritePayload(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_GetPartialSampleResult>,
+                      GPACallTraceWriter& payload,
+                      GPA_Status          status,
+                      GPA_SessionId       sessionId,
+                      gpa_uint32          sampleId,
+                      size_t              sampleResultSizeInBytes,
+                      void*               pCounterSampleResults,
+                      gpa_uint8*          pCounterResultAvailable);
+
+    /// Writes the payload of GPA_GetStreamingCounterResults: the retrieved buckets and their results
+    void WritePayload(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_GetStreamingCounterResults>,
+                      GPACallTraceWriter&         payload,
+                      GPA_Status                  status,
+                      GPA_SessionId               sessionId,
+                      gpa_uint64                  bucketDuration,
+                      gpa_uint32                  maxBuckets,
+                      GPA_StreamingCounterBucket* pBuckets,
+                      void*                       pCounterResults,
+                      gpa_uint32*                 pNumBuckets);
+
+    std::atomic<bool>                               m_isEnabled;           ///< flag indicating whether the calls are captured
+    GPAFunctionTable                                m_functionTable;       ///< the functions to which the captured calls are forwarded
+    bool                                            m_isFunctionTableSet;  ///< flag indicating whether m_functionTable was set by the capture
+    std::chrono::steady_clock::time_point           m_startTime;           ///< time at which the capture started
+    std::mutex                                      m_mutex;               ///< mutex protecting the trace and the ids of the handles and threads
+    std::ofstream                                   m_traceFile;           ///< the trace, while capturing
+    gpa_uint64                                      m_previousStartTime;   ///< start time of the previous call written to the trace
+    std::unordered_map<const void*, gpa_uint64>     m_handleIds;           ///< the ids of the handles in the trace
+    gpa_uint64                                      m_nextHandleId;        ///< id of the next handle created
+    std::unordered_map<std::thread::id, gpa_uint32> m_threadIndices;       ///< the indices of the threads in the trace
+};
+
+/// The capture of the calls made through the GPA function table
+extern GPACallCapture g_callCapture;
+
+/// Function capturing the calls to a GPA entry point, used in place of the entry point in a capturing function table
+template <typename Ret, typename... Args, Ret (*GPAFunctionTable::*pFunction)(Args...), GPA_ApiCallId apiId>
+struct GPACapturedCall<Ret (*GPAFunctionTable::*)(Args...), pFunction, apiId>
+{
+    /// Calls the entry point and writes the call to the trace
+    /// \param[in] args the arguments of the call
+    /// \return the value returned by the entry point
+    static Ret Call(Args... args)
+    {
+        if (!g_callCapture.IsEnabled())
+        {
+            return (g_callCapture.m_functionTable.*pFunction)(args...);
+        }
+
+        gpa_uint64 startTime = g_callCapture.GetTime();
+        Ret        retVal    = (g_callCapture.m_functionTable.*pFunction)(args...);
+        gpa_uint64 endTime   = g_callCapture.GetTime();
+
+        GPACallTraceWriter payload;
+        g_callCapture.WritePayload(std::integral_constant<GPA_ApiCallId, apiId>(), payload, retVal, args...);
+        g_callCapture.WriteCall(apiId, startTime, endTime, payload, retVal, args...);
+        return retVal;
+    }
+};
+
+#endif  // _GPA_CALL_CAPTURE_H_
@@ -0,0 +1,425 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Binary log of the calls to the GPA entry points, decoded offline
+//==============================================================================
+
+#include <algorithm>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+
+#include "gpa_call_recorder.h"
+#include "utility.h"
+
+static const char       CALL_LOG_MAGIC[8]  = {'G', 'P', 'A', 'C', 'A', 'L', 'L', 'S'};  ///< at the start of a call log file
+static const gpa_uint32 CALL_LOG_VERSION   = 1;                                         ///< version of the call log file format
+static const gpa_uint32 CHUNK_TYPE_RECORDS = 1;                                         ///< chunk holding the records of a thread
+static const gpa_uint32 CHUNK_TYPE_NAMES   = 2;                                         ///< chunk holding the names of the recorded entry points
+
+/// Header at the start of a call log file
+struct CallLogHeader
+{
+    char       m_magic[8];    ///< CALL_LOG_MAGIC
+    gpa_uint32 m_version;     ///< CALL_LOG_VERSION
+    gpa_uint32 m_recordSize;  ///< size of a record, in bytes
+};
+
+/// Header of a chunk of a call log file
+struct CallLogChunkHeader
+{
+    gpa_uint32 m_type;         ///< CHUNK_TYPE_RECORDS or CHUNK_TYPE_NAMES
+    gpa_uint32 m_threadIndex;  ///< index of the thread which made the recorded calls, for CHUNK_TYPE_RECORDS
+    gpa_uint64 m_size;         ///< number of bytes following the header in the chunk
+};
+
+/// Names of the GPA entry points, indexed by GPA_ApiCallId
+static const char* const API_NAMES[] = {
+#define GPA_FUNCTION_PREFIX(func) #func,
+#include "gpu_perf_api_functions.h"
+#undef GPA_FUNCTION_PREFIX
+};
+
+static_assert(sizeof(API_NAMES) / sizeof(API_NAMES[0]) == GPA_API_CALL_ID__LAST, "The names do not match the entry points");
+
+/// Buffer of the calling thread for the recorder which used it last
+struct ThreadBufferSlot
+{
+    gpa_uint64 m_recorderId;  ///< id of the recorder owning the buffer, 0 if there is no buffer
+    void*      m_pBuffer;     ///< the buffer of the thread
+};
+
+static thread_local ThreadBufferSlot s_threadBufferSlot = {0, nullptr};  ///< the buffer of the calling thread
+static std::atomic<gpa_uint64>       s_nextRecorderId(1);               ///< id of the next recorder to be created
+
+const gpa_uint32 GPA_CallRecord::MAX_ARGS;
+const gpa_uint32 GPACallRecorder::RECORDS_PER_BUFFER;
+
+GPACallRecorder g_callRecorder;
+
+GPACallRecorder::GPACallRecorder()
+    : m_recorderId(s_nextRecorderId++)
+    , m_isEnabled(false)
+{
+    for (std::atomic<const char*>& argNames : m_argNames)
+    {
+        argNames.store(nullptr, std::memory_order_relaxed);
+    }
+
+#ifdef _DEBUG
+    std::string currentModulePath;
+    GPAUtil::GetCurrentModulePath(currentModulePath);
+    Start(currentModulePath + "GPA-Call-Log.bin");
+#endif
+}
+
+GPACallRecorder::~GPACallRecorder()
+{
+    Stop();
+}
+
+bool GPACallRecorder::Start(const std::string& logFilePath)
+{
+    Stop();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_logFile.open(logFilePath.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+
+    if (!m_logFile.is_open())
+    {
+        return false;
+    }
+
+    CallLogHeader header = {};
+    memcpy(header.m_magic, CALL_LOG_MAGIC, sizeof(CALL_LOG_MAGIC));
+    header.m_version    = CALL_LOG_VERSION;
+    header.m_recordSize = sizeof(GPA_CallRecord);
+    m_logFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    // the buffers may hold the calls made while the previous recording stopped
+    for (std::unique_ptr<ThreadBuffer>& threadBuffer : m_threadBuffers)
+    {
+        std::lock_guard<std::mutex> bufferLock(threadBuffer->m_mutex);
+        threadBuffer->m_numRecords = 0;
+    }
+
+    for (std::atomic<const char*>& argNames : m_argNames)
+    {
+        argNames.store(nullptr, std::memory_order_relaxed);
+    }
+
+    m_startTime = std::chrono::steady_clock::now();
+    m_isEnabled.store(true, std::memory_order_release);
+    return true;
+}
+
+void GPACallRecorder::Stop()
+{
+    if (!m_isEnabled.exchange(false))
+    {
+        return;
+    }
+
+    // the buffers are flushed without holding m_mutex, as a thread holding the mutex of its buffer may wait for m_mutex
+    std::vector<ThreadBuffer*> threadBuffers;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        for (std::unique_ptr<ThreadBuffer>& threadBuffer : m_threadBuffers)
+        {
+            threadBuffers.push_back(threadBuffer.get());
+        }
+    }
+
+    for (ThreadBuffer* pThreadBuffer : threadBuffers)
+    {
+        std::lock_guard<std::mutex> bufferLock(pThreadBuffer->m_mutex);
+        FlushBuffer_NotThreadSafe(pThreadBuffer);
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // each recorded entry point is stored as its id, its name and the names of its status and arguments
+    std::string names;
+
+    for (gpa_uint32 apiId = 0; apiId < GPA_API_CALL_ID__LAST; ++apiId)
+    {
+        const char* pArgNames = m_argNames[apiId].load(std::memory_order_relaxed);
+
+        if (nullptr != pArgNames)
+        {
+            names.append(reinterpret_cast<const char*>(&apiId), sizeof(apiId));
+            names.append(API_NAMES[apiId]).push_back('\0');
+            names.append(pArgNames).push_back('\0');
+        }
+    }
+
+    CallLogChunkHeader chunkHeader = {};
+    chunkHeader.m_type             = CHUNK_TYPE_NAMES;
+    chunkHeader.m_size             = names.size();
+    m_logFile.write(reinterpret_cast<const char*>(&chunkHeader), sizeof(chunkHeader));
+    m_logFile.write(names.data(), names.size());
+    m_logFile.close();
+}
+
+void GPACallRecorder::Append(GPA_CallRecord& record, const char* pArgNames)
+{
+    record.m_timestamp =
+        static_cast<gpa_uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_startTime).count());
+
+    std::atomic<const char*>& argNames = m_argNames[record.m_apiId];
+
+    if (nullptr == argNames.load(std::memory_order_relaxed))
+    {
+        argNames.store(pArgNames, std::memory_order_relaxed);
+    }
+
+    ThreadBuffer* pThreadBuffer = GetThreadBuffer();
+
+    if (nullptr == pThreadBuffer)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> bufferLock(pThreadBuffer->m_mutex);
+    pThreadBuffer->m_records[pThreadBuffer->m_numRecords++] = record;
+
+    if (RECORDS_PER_BUFFER == pThreadBuffer->m_numRecords)
+    {
+        FlushBuffer_NotThreadSafe(pThreadBuffer);
+    }
+}
+
+GPACallRecorder::ThreadBuffer* GPACallRecorder::GetThreadBuffer()
+{
+    if (m_recorderId == s_threadBufferSlot.m_recorderId)
+    {
+        return static_cast<ThreadBuffer*>(s_threadBufferSlot.m_pBuffer);
+    }
+
+    std::unique_ptr<ThreadBuffer> threadBuffer(new (std::nothrow) ThreadBuffer);
+
+    if (nullptr == threadBuffer)
+    {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    threadBuffer->m_threadIndex = static_cast<gpa_uint32>(m_threadBuffers.size());
+    threadBuffer->m_numRecords  = 0;
+    m_threadBuffers.push_back(std::move(threadBuffer));
+
+    s_threadBufferSlot.m_recorderId = m_recorderId;
+    s_threadBufferSlot.m_pBuffer    = m_threadBuffers.back().get();
+    return m_threadBuffers.back().get();
+}
+
+void GPACallRecorder::FlushBuffer_NotThreadSafe(ThreadBuffer* pBuffer)
+{
+    if (0 == pBuffer->m_numRecords)
+    {
+        return;
+    }
+
+    CallLogChunkHeader chunkHeader = {};
+    chunkHeader.m_type             = CHUNK_TYPE_RECORDS;
+    chunkHeader.m_threadIndex      = pBuffer->m_threadIndex;
+    chunkHeader.m_size             = pBuffer->m_numRecords * sizeof(GPA_CallRecord);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_logFile.is_open())
+        {
+            m_logFile.write(reinterpret_cast<const char*>(&chunkHeader), sizeof(chunkHeader));
+            m_logFile.write(reinterpret_cast<const char*>(pBuffer->m_records), chunkHeader.m_size);
+        }
+    }
+
+    pBuffer->m_numRecords = 0;
+}
+
+/// A decoded call, with the thread which made it
+struct DecodedCall
+{
+    GPA_CallRecord m_record;       ///< the record of the call
+    gpa_uint32     m_threadIndex;  ///< index of the thread which made the call
+};
+
+/// Splits the names of the status and arguments of an entry point
+/// \param[in] argNames the names, separated by commas
+/// \return the names of the arguments, without the name of the status
+static std::vector<std::string> SplitArgNames(const std::string& argNames)
+{
+    std::vector<std::string> names;
+    std::string              name;
+    std::istringstream       nameStream(argNames);
+
+    while (std::getline(nameStream, name, ','))
+    {
+        size_t first = name.find_first_not_of(' ');
+        size_t last  = name.find_last_not_of(' ');
+        names.push_back(std::string::npos == first ? std::string() : name.substr(first, last - first + 1));
+    }
+
+    if (!names.empty())
+    {
+        names.erase(names.begin());
+    }
+
+    return names;
+}
+
+bool GPACallRecorder::DecodeLog(const std::string& logFilePath, std::ostream& output)
+{
+    std::ifstream logFile(logFilePath.c_str(), std::ios_base::in | std::ios_base::binary);
+    std::string   content((std::istreambuf_iterator<char>(logFile)), std::istreambuf_iterator<char>());
+
+    CallLogHeader header;
+
+    if (content.size() < sizeof(header))
+    {
+        return false;
+    }
+
+    memcpy(&header, content.data(), sizeof(header));
+
+    if (0 != memcmp(header.m_magic, CALL_LOG_MAGIC, sizeof(CALL_LOG_MAGIC)) || CALL_LOG_VERSION != header.m_version ||
+        sizeof(GPA_CallRecord) != header.m_recordSize)
+    {
+        return false;
+    }
+
+    std::vector<DecodedCall> calls;
+    std::vector<std::string> apiNames(GPA_API_CALL_ID__LAST);
+    std::vector<std::string> apiArgNames(GPA_API_CALL_ID__LAST);
+    size_t                   offset = sizeof(header);
+
+    while (offset < content.size())
+    {
+        CallLogChunkHeader chunkHeader;
+
+        if (content.size() - offset < sizeof(chunkHeader))
+        {
+            return false;
+        }
+
+        memcpy(&chunkHeader, content.data() + offset, sizeof(chunkHeader));
+        offset += sizeof(chunkHeader);
+
+        if (content.size() - offset < chunkHeader.m_size)
+        {
+            return false;
+        }
+
+        const char* pChunk = content.data() + offset;
+        offset += static_cast<size_t>(chunkHeader.m_size);
+
+        if (CHUNK_TYPE_RECORDS == chunkHeader.m_type)
+        {
+            for (size_t recordOffset = 0; recordOffset + sizeof(GPA_CallRecord) <= chunkHeader.m_size; recordOffset += sizeof(GPA_CallRecord))
+            {
+                DecodedCall call;
+                memcpy(&call.m_record, pChunk + recordOffset, sizeof(GPA_CallRecord));
+                call.m_threadIndex = chunkHeader.m_threadIndex;
+                calls.push_back(call);
+            }
+        }
+        else if (CHUNK_TYPE_NAMES == chunkHeader.m_type)
+        {
+            const char* pName = pChunk;
+            const char* pEnd  = pChunk + chunkHeader.m_size;
+
+            while (pEnd - pName > static_cast<ptrdiff_t>(sizeof(gpa_uint32)))
+            {
+                gpa_uint32 apiId;
+                memcpy(&apiId, pName, sizeof(apiId));
+                pName += sizeof(apiId);
+
+                std::string apiName(pName, strnlen(pName, pEnd - pName));
+                pName += apiName.size() + 1;
+
+                if (pName >= pEnd)
+                {
+                    return false;
+                }
+
+                std::string argNames(pName, strnlen(pName, pEnd - pName));
+                pName += argNames.size() + 1;
+
+                if (apiId >= apiNames.size())
+                {
+                    apiNames.resize(apiId + 1);
+                    apiArgNames.resize(apiId + 1);
+                }
+
+                apiNames[apiId]    = apiName;
+                apiArgNames[apiId] = argNames;
+            }
+        }
+    }
+
+    // the chunks of the threads are interleaved, so the calls are put back in the order in which they were made
+    std::stable_sort(calls.begin(), calls.end(), [](const DecodedCall& call1, const DecodedCall& call2) {
+        return call1.m_record.m_timestamp < call2.m_record.m_timestamp;
+    });
+
+    std::vector<std::vector<std::string>> splitArgNames(apiArgNames.size());
+
+    for (size_t apiId = 0; apiId < apiArgNames.size(); ++apiId)
+    {
+        splitArgNames[apiId] = SplitArgNames(apiArgNames[apiId]);
+    }
+
+    for (const DecodedCall& call : calls)
+    {
+        const GPA_CallRecord& record = call.m_record;
+
+        output << std::dec << std::fixed << std::setprecision(6) << static_cast<double>(record.m_timestamp) / 1000000.0 << " ms, thread "
+               << call.m_threadIndex << ": ";
+
+        if (record.m_apiId < apiNames.size() && !apiNames[record.m_apiId].empty())
+        {
+            output << apiNames[record.m_apiId];
+        }
+        else
+        {
+            output << "<entry point " << record.m_apiId << ">";
+        }
+
+        output << "(";
+
+        for (gpa_uint32 argIndex = 0; argIndex < record.m_numArgs && argIndex < GPA_CallRecord::MAX_ARGS; ++argIndex)
+        {
+            if (0 != argIndex)
+            {
+                output << ", ";
+            }
+
+            if (record.m_apiId < splitArgNames.size() && argIndex < splitArgNames[record.m_apiId].size())
+            {
+                output << splitArgNames[record.m_apiId][argIndex] << " = ";
+            }
+
+            // the type of the arguments is not recorded: small values are shown as integers, others as addresses
+            gpa_uint64 value = record.m_args[argIndex];
+
+            if (value <= UINT32_MAX)
+            {
+                output << std::dec << value;
+            }
+            else
+            {
+                output << "0x" << std::hex << value << std::dec;
+            }
+        }
+
+        output << ") = " << record.m_status << std::endl;
+    }
+
+    return true;
+}
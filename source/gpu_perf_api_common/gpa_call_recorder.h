@@ -0,0 +1,180 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Binary log of the calls to the GPA entry points, decoded offline
+//==============================================================================
+
+#ifndef _GPA_CALL_RECORDER_H_
+#define _GPA_CALL_RECORDER_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "gpu_perf_api_types.h"
+
+/// Identifies the GPA entry point of a recorded call
+enum GPA_ApiCallId
+{
+#define GPA_FUNCTION_PREFIX(func) GPA_API_CALL_ID_##func,  ///< id of a GPA entry point
+#include "gpu_perf_api_functions.h"
+#undef GPA_FUNCTION_PREFIX
+    GPA_API_CALL_ID__LAST  ///< number of GPA entry points, not a valid id
+};
+
+/// A call to a GPA entry point, as stored in the call log
+struct GPA_CallRecord
+{
+    static const gpa_uint32 MAX_ARGS = 6;  ///< largest number of arguments of a call
+
+    gpa_uint64 m_timestamp;       ///< time of the call, in nanoseconds since the recording started
+    gpa_uint64 m_args[MAX_ARGS];  ///< the arguments of the call; handles and pointers are stored as their address
+    gpa_uint16 m_apiId;           ///< the GPA_ApiCallId of the entry point
+    gpa_uint16 m_numArgs;         ///< number of arguments in m_args
+    int32_t    m_status;          ///< the status returned by the call
+};
+
+static_assert(sizeof(GPA_CallRecord) == 64, "Unexpected GPA_CallRecord size");
+
+/// Converts a pointer or handle argument to its value in a call record
+/// \param[in] pValue the argument
+/// \return the address held by the argument
+template <typename T>
+inline gpa_uint64 GPA_ToCallRecordArg(const T* pValue)
+{
+    return static_cast<gpa_uint64>(reinterpret_cast<uintptr_t>(pValue));
+}
+
+/// Converts an integer or enum argument to its value in a call record
+/// \param[in] value the argument
+/// \return the value of the argument
+template <typename T>
+inline typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value, gpa_uint64>::type GPA_ToCallRecordArg(T value)
+{
+    return static_cast<gpa_uint64>(value);
+}
+
+/// Records the calls to the GPA entry points into a binary log.
+///
+/// While the recorder is stopped, recording a call costs a single branch. While it is started, each call is stored as a
+/// fixed-size record in a buffer owned by the calling thread, so that threads do not contend with each other; a full buffer
+/// is appended to the log file. Nothing is formatted while recording: the log is turned into text offline by DecodeLog.
+///
+/// The log file is made of a header followed by chunks. A chunk holds either the records of a buffer, or, at the end of
+/// the file, the names of the recorded entry points and of their arguments.
+class GPACallRecorder
+{
+public:
+    /// Number of records in the buffer of each thread
+    static const gpa_uint32 RECORDS_PER_BUFFER = 1024;
+
+    /// Initializes a new instance of the GPACallRecorder class. Debug builds start recording to GPA-Call-Log.bin next to the GPA module.
+    GPACallRecorder();
+
+    /// Stops recording, completing the log file
+    ~GPACallRecorder();
+
+    /// Starts recording the calls to a new log file, completing the log file of the previous recording
+    /// \param[in] logFilePath the path of the log file, which is overwritten
+    /// \return true if the log file could be created, false otherwise
+    bool Start(const std::string& logFilePath);
+
+    /// Stops recording, writing the buffered records and the names of the recorded entry points to the log file.
+    /// The calls made concurrently with Stop may not be recorded.
+    void Stop();
+
+    /// Indicates whether the calls are recorded
+    /// \return true if the recorder is started
+    bool IsEnabled() const
+    {
+        return m_isEnabled.load(std::memory_order_acquire);
+    }
+
+    /// Records a call; use GPA_RECORD_CALL, which only evaluates the arguments when the recorder is enabled
+    /// \param[in] apiId the entry point called
+    /// \param[in] pArgNames the names of the status and arguments, separated by commas; must be a string literal
+    /// \param[in] status the status returned by the call
+    /// \param[in] args the arguments of the call
+    template <typename... Args>
+    void Record(GPA_ApiCallId apiId, const char* pArgNames, GPA_Status status, Args... args)
+    {
+        static_assert(sizeof...(Args) <= GPA_CallRecord::MAX_ARGS, "Too many arguments for a call record");
+
+        const gpa_uint64 values[] = {GPA_ToCallRecordArg(args)..., 0};
+
+        GPA_CallRecord record = {};
+        record.m_apiId        = static_cast<gpa_uint16>(apiId);
+        record.m_numArgs      = static_cast<gpa_uint16>(sizeof...(Args));
+        record.m_status       = static_cast<int32_t>(status);
+        memcpy(record.m_args, values, sizeof...(Args) * sizeof(gpa_uint64));
+
+        Append(record, pArgNames);
+    }
+
+    /// Decodes a log file into text, one line per call in the order of the calls
+    /// \param[in] logFilePath the path of the log file
+    /// \param[out] output the stream to which the text is written
+    /// \return true if the log file is valid, false otherwise
+    static bool DecodeLog(const std::string& logFilePath, std::ostream& output);
+
+private:
+    GPACallRecorder(const GPACallRecorder&) = delete;
+    GPACallRecorder& operator=(const GPACallRecorder&) = delete;
+
+    /// The records of a thread which are not in the log file yet. Buffers are kept until the recorder is destroyed,
+    /// so that a thread still recording while the recorder stops never writes to freed memory.
+    struct ThreadBuffer
+    {
+        std::mutex     m_mutex;                        ///< mutex protecting the buffer; only contended while the buffer is flushed by Stop
+        gpa_uint32     m_threadIndex;                  ///< index of the thread in the log file
+        gpa_uint32     m_numRecords;                   ///< number of records in the buffer
+        GPA_CallRecord m_records[RECORDS_PER_BUFFER];  ///< the records
+    };
+
+    /// Timestamps a call record and adds it to the buffer of the calling thread
+    /// \param[in,out] record the record of the call
+    /// \param[in] pArgNames the names of the status and arguments of the call
+    void Append(GPA_CallRecord& record, const char* pArgNames);
+
+    /// Gets the buffer of the calling thread, creating it on the first call of the thread
+    /// \return the buffer of the calling thread, or nullptr if it could not be allocated
+    ThreadBuffer* GetThreadBuffer();
+
+    /// Appends the records of a buffer to the log file and empties the buffer. Requires the mutex of the buffer.
+    /// \param[in] pBuffer the buffer to flush
+    void FlushBuffer_NotThreadSafe(ThreadBuffer* pBuffer);
+
+    const gpa_uint64                           m_recorderId;                       ///< unique id of the recorder, identifying the buffers of the threads
+    std::atomic<bool>                          m_isEnabled;                        ///< flag indicating whether the calls are recorded
+    std::atomic<const char*>                   m_argNames[GPA_API_CALL_ID__LAST];  ///< names of the status and arguments of each recorded entry point
+    std::chrono::steady_clock::time_point      m_startTime;                        ///< time at which the recording started
+    std::mutex                                 m_mutex;                            ///< mutex protecting the log file and the list of buffers
+    std::vector<std::unique_ptr<ThreadBuffer>> m_threadBuffers;                    ///< the buffers of the threads which recorded calls
+    std::ofstream                              m_logFile;                          ///< the log file, while recording
+};
+
+/// The recorder of the calls to the GPA entry points
+extern GPACallRecorder g_callRecorder;
+
+/// Macro recording a call to a GPA entry point: the status it returns, then up to GPA_CallRecord::MAX_ARGS integer,
+/// enum, handle or pointer arguments. The arguments are only evaluated while the recorder is enabled.
+/// The macro expands to a single statement, so it can be used as the body of an if without braces.
+#define GPA_RECORD_CALL(func, ...)                                                     \
+    do                                                                                 \
+    {                                                                                  \
+        if (g_callRecorder.IsEnabled())                                                \
+        {                                                                              \
+            g_callRecorder.Record(GPA_API_CALL_ID_##func, #__VA_ARGS__, __VA_ARGS__); \
+        }                                                                              \
+    } while (0)
+
+#endif  // _GPA_CALL_RECORDER_H_
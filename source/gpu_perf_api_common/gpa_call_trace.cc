@@ -0,0 +1,237 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Encoding of the GPA call traces written by the call capture and read by the replay tool
+//==============================================================================
+
+#include <cstring>
+
+#include "gpa_call_trace.h"
+
+static const char       CALL_TRACE_MAGIC[8] = {'G', 'P', 'A', 'T', 'R', 'A', 'C', 'E'};  ///< at the start of a call trace
+static const gpa_uint64 CALL_TRACE_VERSION  = 1;                                         ///< version of the call trace format
+
+/// Names of the GPA entry points, indexed by their id in the call traces written by this build
+static const char* const API_NAMES[] = {
+#define GPA_FUNCTION_PREFIX(func) #func,
+#include "gpu_perf_api_functions.h"
+#undef GPA_FUNCTION_PREFIX
+};
+
+const gpa_uint8 GPACallTraceWriter::POINTER_NULL;
+const gpa_uint8 GPACallTraceWriter::POINTER_NOT_WRITTEN;
+const gpa_uint8 GPACallTraceWriter::POINTER_VALUE;
+
+void GPACallTraceWriter::WriteUInt(gpa_uint64 value)
+{
+    // seven bits per byte, the high bit of each byte but the last one is set
+    while (value >= 0x80)
+    {
+        m_data.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+
+    m_data.push_back(static_cast<char>(value));
+}
+
+void GPACallTraceWriter::WriteInt(int64_t value)
+{
+    // zigzag encoding, so that small negative values are small unsigned values
+    gpa_uint64 unsignedValue = static_cast<gpa_uint64>(value);
+    WriteUInt((unsignedValue << 1) ^ (0 > value ? ~0ull : 0ull));
+}
+
+void GPACallTraceWriter::WriteBytes(const void* pData, size_t size)
+{
+    m_data.append(static_cast<const char*>(pData), size);
+}
+
+void GPACallTraceWriter::WriteString(const char* pString)
+{
+    if (nullptr == pString)
+    {
+        WriteUInt(0);
+        return;
+    }
+
+    size_t length = strlen(pString);
+    WriteUInt(static_cast<gpa_uint64>(length) + 1);
+    WriteBytes(pString, length);
+}
+
+void GPACallTraceWriter::WriteSizedData(const GPACallTraceWriter& writer)
+{
+    WriteUInt(writer.m_data.size());
+    m_data.append(writer.m_data);
+}
+
+GPACallTraceReader::GPACallTraceReader(const char* pData, size_t size)
+    : m_pData(pData)
+    , m_size(size)
+    , m_offset(0)
+{
+}
+
+bool GPACallTraceReader::ReadUInt(gpa_uint64& value)
+{
+    value = 0;
+
+    for (unsigned int shift = 0; shift < 64; shift += 7)
+    {
+        if (m_offset == m_size)
+        {
+            return false;
+        }
+
+        gpa_uint8 byte = static_cast<gpa_uint8>(m_pData[m_offset++]);
+        value |= static_cast<gpa_uint64>(byte & 0x7F) << shift;
+
+        if (0 == (byte & 0x80))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool GPACallTraceReader::ReadInt(int64_t& value)
+{
+    gpa_uint64 unsignedValue = 0;
+
+    if (!ReadUInt(unsignedValue))
+    {
+        return false;
+    }
+
+    value = static_cast<int64_t>((unsignedValue >> 1) ^ (0 - (unsignedValue & 1)));
+    return true;
+}
+
+bool GPACallTraceReader::ReadBytes(void* pData, size_t size)
+{
+    if (m_size - m_offset < size)
+    {
+        return false;
+    }
+
+    memcpy(pData, m_pData + m_offset, size);
+    m_offset += size;
+    return true;
+}
+
+bool GPACallTraceReader::ReadString(std::string& value, bool& isNull)
+{
+    gpa_uint64 lengthPlusOne = 0;
+
+    if (!ReadUInt(lengthPlusOne))
+    {
+        return false;
+    }
+
+    isNull = 0 == lengthPlusOne;
+    value.clear();
+
+    if (isNull)
+    {
+        return true;
+    }
+
+    if (m_size - m_offset < lengthPlusOne - 1)
+    {
+        return false;
+    }
+
+    value.assign(m_pData + m_offset, static_cast<size_t>(lengthPlusOne - 1));
+    m_offset += static_cast<size_t>(lengthPlusOne - 1);
+    return true;
+}
+
+bool GPACallTraceReader::ReadSizedData(GPACallTraceReader& data)
+{
+    gpa_uint64 size = 0;
+
+    if (!ReadUInt(size) || m_size - m_offset < size)
+    {
+        return false;
+    }
+
+    data = GPACallTraceReader(m_pData + m_offset, static_cast<size_t>(size));
+    m_offset += static_cast<size_t>(size);
+    return true;
+}
+
+void GPA_WriteCallTraceHeader(GPACallTraceWriter& writer)
+{
+    const size_t numApis = sizeof(API_NAMES) / sizeof(API_NAMES[0]);
+
+    writer.WriteBytes(CALL_TRACE_MAGIC, sizeof(CALL_TRACE_MAGIC));
+    writer.WriteUInt(CALL_TRACE_VERSION);
+    writer.WriteUInt(numApis);
+
+    for (size_t apiIndex = 0; apiIndex < numApis; ++apiIndex)
+    {
+        writer.WriteString(API_NAMES[apiIndex]);
+    }
+}
+
+bool GPA_ReadCallTraceHeader(GPACallTraceReader& reader, std::vector<std::string>& apiNames)
+{
+    char       magic[sizeof(CALL_TRACE_MAGIC)];
+    gpa_uint64 version = 0;
+    gpa_uint64 numApis = 0;
+
+    if (!reader.ReadBytes(magic, sizeof(magic)) || 0 != memcmp(magic, CALL_TRACE_MAGIC, sizeof(magic)) || !reader.ReadUInt(version) ||
+        CALL_TRACE_VERSION != version || !reader.ReadUInt(numApis) || 0xFFFF < numApis)
+    {
+        return false;
+    }
+
+    apiNames.resize(static_cast<size_t>(numApis));
+
+    for (std::string& apiName : apiNames)
+    {
+        bool isNull = false;
+
+        if (!reader.ReadString(apiName, isNull))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void GPA_WriteCallTraceRecord(GPACallTraceWriter& writer, gpa_uint64& previousStartTime, const GPACallTraceCall& call, const GPACallTraceWriter& body)
+{
+    // the records are written in the order in which the calls end, so a call may start before the previous one
+    GPACallTraceWriter record;
+    record.WriteUInt(call.m_threadIndex);
+    record.WriteInt(static_cast<int64_t>(call.m_startTime - previousStartTime));
+    record.WriteUInt(call.m_duration);
+    record.WriteBytes(body.GetData().data(), body.GetData().size());
+
+    writer.WriteUInt(call.m_apiId);
+    writer.WriteSizedData(record);
+    previousStartTime = call.m_startTime;
+}
+
+bool GPA_ReadCallTraceRecord(GPACallTraceReader& reader, gpa_uint64& previousStartTime, GPACallTraceCall& call, GPACallTraceReader& body)
+{
+    gpa_uint64 apiId       = 0;
+    gpa_uint64 threadIndex = 0;
+    int64_t    startDelta  = 0;
+
+    if (!reader.ReadUInt(apiId) || !reader.ReadSizedData(body) || !body.ReadUInt(threadIndex) || !body.ReadInt(startDelta) ||
+        !body.ReadUInt(call.m_duration))
+    {
+        return false;
+    }
+
+    call.m_apiId       = static_cast<gpa_uint32>(apiId);
+    call.m_threadIndex = static_cast<gpa_uint32>(threadIndex);
+    call.m_startTime   = previousStartTime + static_cast<gpa_uint64>(startDelta);
+    previousStartTime  = call.m_startTime;
+    return true;
+}
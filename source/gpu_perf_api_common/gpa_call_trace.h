@@ -0,0 +1,238 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Encoding of the GPA call traces written by the call capture and read by the replay tool
+//==============================================================================
+
+#ifndef _GPA_CALL_TRACE_H_
+#define _GPA_CALL_TRACE_H_
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "gpu_perf_api_types.h"
+
+/// A call trace holds the sequence of calls made to the GPA entry points, with what they returned, so that it can be replayed.
+///
+/// The trace starts with a header: the magic "GPATRACE", the version of the format and the names of the entry points of the
+/// capturing build, which the ids of the entry points in the records refer to. It is followed by one record per call:
+///  - the id of the entry point and the size of the rest of the record;
+///  - the index of the calling thread, the start time of the call relative to the start time of the previous record,
+///    and the duration of the call, in nanoseconds;
+///  - the value returned by the call and the arguments of the call, each encoded according to its type (see below);
+///  - the payload of the call: a byte count followed by the data which cannot be derived from the types of the
+///    arguments, such as the content of result buffers or the description of an opened context.
+///
+/// Integers and enums are written as zigzag-encoded variable-length integers. Handles (GPA_ContextId, GPA_SessionId...)
+/// are written as a small id, which is assigned when the handle is returned by a call; a null handle has id 0.
+/// Strings are written as their length plus one, followed by their characters; a null string is written as 0.
+/// Any other pointer starts with a state: 0 for a null pointer, 1 for an output which was not written because the call
+/// failed, 2 when the value it points to follows. Pointers to opaque data (void*, callbacks) only have a state.
+///
+/// Integers are variable-length so that the small values which make up most of a trace (ids, indices, statuses, short
+/// durations) take a single byte.
+class GPACallTraceWriter
+{
+public:
+    /// Pointer state: null pointer
+    static const gpa_uint8 POINTER_NULL = 0;
+
+    /// Pointer state: the call did not write the output
+    static const gpa_uint8 POINTER_NOT_WRITTEN = 1;
+
+    /// Pointer state: the value pointed to follows
+    static const gpa_uint8 POINTER_VALUE = 2;
+
+    /// Writes an unsigned integer
+    /// \param[in] value the value to write
+    void WriteUInt(gpa_uint64 value);
+
+    /// Writes a signed integer
+    /// \param[in] value the value to write
+    void WriteInt(int64_t value);
+
+    /// Writes raw bytes
+    /// \param[in] pData the bytes to write
+    /// \param[in] size the number of bytes to write
+    void WriteBytes(const void* pData, size_t size);
+
+    /// Writes a string
+    /// \param[in] pString the string to write, may be null
+    void WriteString(const char* pString);
+
+    /// Appends the data written by another writer, preceded by its size
+    /// \param[in] writer the other writer
+    void WriteSizedData(const GPACallTraceWriter& writer);
+
+    /// Gets the data written so far
+    /// \return the data written so far
+    const std::string& GetData() const
+    {
+        return m_data;
+    }
+
+    /// Discards the data written so far
+    void Clear()
+    {
+        m_data.clear();
+    }
+
+private:
+    std::string m_data;  ///< the data written so far
+};
+
+/// Reads the values written by a GPACallTraceWriter
+class GPACallTraceReader
+{
+public:
+    /// Initializes a new instance of the GPACallTraceReader class
+    /// \param[in] pData the data to read, which must outlive the reader
+    /// \param[in] size the size of the data in bytes
+    GPACallTraceReader(const char* pData, size_t size);
+
+    /// Reads an unsigned integer
+    /// \param[out] value the value read
+    /// \return false if the data is exhausted or invalid
+    bool ReadUInt(gpa_uint64& value);
+
+    /// Reads a signed integer
+    /// \param[out] value the value read
+    /// \return false if the data is exhausted or invalid
+    bool ReadInt(int64_t& value);
+
+    /// Reads raw bytes
+    /// \param[out] pData the buffer receiving the bytes
+    /// \param[in] size the number of bytes to read
+    /// \return false if the data is exhausted
+    bool ReadBytes(void* pData, size_t size);
+
+    /// Reads a string
+    /// \param[out] value the string read
+    /// \param[out] isNull true if a null string was written
+    /// \return false if the data is exhausted or invalid
+    bool ReadString(std::string& value, bool& isNull);
+
+    /// Reads data written with GPACallTraceWriter::WriteSizedData
+    /// \param[out] data a reader of the data
+    /// \return false if the data is exhausted or invalid
+    bool ReadSizedData(GPACallTraceReader& data);
+
+    /// Indicates whether all of the data has been read
+    /// \return true if all of the data has been read
+    bool IsAtEnd() const
+    {
+        return m_offset == m_size;
+    }
+
+private:
+    const char* m_pData;   ///< the data to read
+    size_t      m_size;    ///< the size of the data in bytes
+    size_t      m_offset;  ///< offset of the next value to read
+};
+
+/// Indicates whether a type is a GPA handle
+template <typename T>
+struct GPACallIsHandle : std::false_type
+{
+};
+
+template <>
+struct GPACallIsHandle<GPA_ContextId> : std::true_type
+{
+};
+
+template <>
+struct GPACallIsHandle<GPA_SessionId> : std::true_type
+{
+};
+
+template <>
+struct GPACallIsHandle<GPA_CommandListId> : std::true_type
+{
+};
+
+template <>
+struct GPACallIsHandle<GPA_SampleBlockId> : std::true_type
+{
+};
+
+template <>
+struct GPACallIsHandle<GPA_CounterStatisticsId> : std::true_type
+{
+};
+
+/// How a value returned by a GPA entry point or passed to it is encoded in a call trace
+enum GPACallArgKind
+{
+    GPA_CALL_ARG_VALUE,           ///< integer or enum
+    GPA_CALL_ARG_HANDLE,          ///< GPA handle
+    GPA_CALL_ARG_STRING,          ///< null-terminated string
+    GPA_CALL_ARG_STRUCT,          ///< structure, written as its bytes
+    GPA_CALL_ARG_OPAQUE_POINTER,  ///< pointer to data whose type is unknown, or to a function
+    GPA_CALL_ARG_INPUT_POINTER,   ///< pointer to a constant value
+    GPA_CALL_ARG_OUTPUT_POINTER,  ///< pointer to a value written by the call
+};
+
+/// Gets how a type is encoded in a call trace
+template <typename T>
+struct GPACallArgKindOf
+{
+    typedef typename std::remove_pointer<T>::type Pointee;  ///< the type pointed to, for a pointer
+
+    /// the kind of the type
+    static const GPACallArgKind value =
+        std::is_integral<T>::value || std::is_enum<T>::value
+            ? GPA_CALL_ARG_VALUE
+            : GPACallIsHandle<T>::value
+                  ? GPA_CALL_ARG_HANDLE
+                  : std::is_same<T, const char*>::value
+                        ? GPA_CALL_ARG_STRING
+                        : std::is_class<T>::value
+                              ? GPA_CALL_ARG_STRUCT
+                              : std::is_void<typename std::remove_cv<Pointee>::type>::value || std::is_function<Pointee>::value
+                                    ? GPA_CALL_ARG_OPAQUE_POINTER
+                                    : std::is_const<Pointee>::value ? GPA_CALL_ARG_INPUT_POINTER : GPA_CALL_ARG_OUTPUT_POINTER;
+};
+
+/// Tag selecting the encoding of a type in a call trace
+template <typename T>
+using GPACallArgTag = std::integral_constant<GPACallArgKind, GPACallArgKindOf<T>::value>;
+
+/// The fields at the start of each record of a call trace
+struct GPACallTraceCall
+{
+    gpa_uint32 m_apiId;        ///< id of the entry point called, in the capturing build
+    gpa_uint32 m_threadIndex;  ///< index of the calling thread, in the order in which the threads made their first call
+    gpa_uint64 m_startTime;    ///< start time of the call, in nanoseconds since the capture started
+    gpa_uint64 m_duration;     ///< duration of the call, in nanoseconds
+};
+
+/// Writes the header of a call trace
+/// \param[in,out] writer the writer of the trace
+void GPA_WriteCallTraceHeader(GPACallTraceWriter& writer);
+
+/// Reads the header of a call trace
+/// \param[in,out] reader the reader of the trace
+/// \param[out] apiNames the names of the entry points of the capturing build, indexed by the entry point ids of the trace
+/// \return false if the data is not a call trace, or was written by another version of the format
+bool GPA_ReadCallTraceHeader(GPACallTraceReader& reader, std::vector<std::string>& apiNames);
+
+/// Writes a record of a call trace
+/// \param[in,out] writer the writer of the trace
+/// \param[in,out] previousStartTime the start time of the previous record, updated to the start time of the call
+/// \param[in] call the call
+/// \param[in] body the value returned, the arguments and the payload of the call
+void GPA_WriteCallTraceRecord(GPACallTraceWriter& writer, gpa_uint64& previousStartTime, const GPACallTraceCall& call, const GPACallTraceWriter& body);
+
+/// Reads a record of a call trace
+/// \param[in,out] reader the reader of the trace
+/// \param[in,out] previousStartTime the start time of the previous record, updated to the start time of the call
+/// \param[out] call the call
+/// \param[out] body a reader of the value returned, the arguments and the payload of the call
+/// \return false if the record is truncated or invalid
+bool GPA_ReadCallTraceRecord(GPACallTraceReader& reader, gpa_uint64& previousStartTime, GPACallTraceCall& call, GPACallTraceReader& body);
+
+#endif  // _GPA_CALL_TRACE_H_
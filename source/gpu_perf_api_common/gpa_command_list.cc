@@ -14,6 +14,7 @@ GPACommandList::GPACommandList(IGPASession* pGpaSession, GPAPass* pGpaPass, Comm
     , m_commandListState(CommandListState::UNDEFINED)
     , m_commandListType(commandListType)
     , m_commandListId(commandListId)
+    , m_pOpenSampleBlock(nullptr)
 {
 }
 
@@ -70,6 +71,11 @@ bool GPACommandList::End()
             }
         }
 
+        if (nullptr != m_pOpenSampleBlock)
+        {
+            CommitOpenSampleBlock();
+        }
+
         success = EndCommandListRequest();
 
         if (!success)
@@ -100,7 +106,7 @@ GPAPass* GPACommandList::GetPass() const
 gpa_uint32 GPACommandList::GetSampleCount() const
 {
     std::lock_guard<std::mutex> lockCmdList(m_cmdListMutex);
-    return static_cast<gpa_uint32>(m_clientSampleIdGpaSampleUnorderedMap.size());
+    return static_cast<gpa_uint32>(m_clientSampleIdGpaSampleIndex.Size());
 }
 
 bool GPACommandList::BeginSample(ClientSampleId clientSampleIndex, GPASample* pSample)
@@ -193,25 +199,135 @@ bool GPACommandList::CloseLastSample(bool closingByClient)
     return succeeded;
 }
 
-GPASample* GPACommandList::GetLastSample() const
+GPASampleBlock* GPACommandList::BeginSampleBlock(ClientSampleId firstSampleId, gpa_uint32 sampleCount)
 {
-    return m_pLastSample;
+    if (CommandListState::SAMPLE_RECORDING_BEGIN != m_commandListState)
+    {
+        GPA_LogError("Command list must be in recording state to start/end a sample.");
+        return nullptr;
+    }
+
+    if (nullptr != m_pOpenSampleBlock)
+    {
+        GPA_LogError("Previous sample block must be ended before starting a new one.");
+        return nullptr;
+    }
+
+    if (nullptr != m_pLastSample)
+    {
+        GPA_LogError("Previous sample must be ended before starting a sample block.");
+        return nullptr;
+    }
+
+    std::unique_ptr<GPASampleBlock> pSampleBlock(new (std::nothrow) GPASampleBlock(this, firstSampleId));
+
+    if (nullptr == pSampleBlock)
+    {
+        GPA_LogError("Unable to allocate memory for the sample block.");
+        return nullptr;
+    }
+
+    // the pass validates the ids and reserves them, so that they cannot be used by another command list
+    if (!m_pGpaPass->CreateSampleBlock(firstSampleId, sampleCount, this, pSampleBlock->GetSamples()))
+    {
+        return nullptr;
+    }
+
+    m_pOpenSampleBlock = pSampleBlock.get();
+    m_sampleBlocks.push_back(std::move(pSampleBlock));
+    return m_pOpenSampleBlock;
 }
 
-GPASample* GPACommandList::GetSample(ClientSampleId clientSampleId) const
+bool GPACommandList::EndSampleBlock(GPASampleBlock* pSampleBlock)
 {
-    std::lock_guard<std::mutex> lockCmdList(m_cmdListMutex);
+    bool succeeded = false;
+
+    if (nullptr == pSampleBlock || pSampleBlock != m_pOpenSampleBlock)
+    {
+        GPA_LogError("The sample block has already been ended.");
+    }
+    else if (pSampleBlock->IsSampleOpen())
+    {
+        GPA_LogError("The last sample of the sample block must be ended before the block.");
+    }
+    else
+    {
+        CommitOpenSampleBlock();
+        succeeded = true;
+    }
 
-    GPASample* pRetGpaSample = nullptr;
+    return succeeded;
+}
 
-    ClientSampleIdGpaSampleUnorderedMap::const_iterator iter = m_clientSampleIdGpaSampleUnorderedMap.find(clientSampleId);
+bool GPACommandList::DoesSampleBlockExist(const GPASampleBlock* pSampleBlock) const
+{
+    bool exists = false;
 
-    if (iter != m_clientSampleIdGpaSampleUnorderedMap.end())
+    for (auto cIter = m_sampleBlocks.cbegin(); !exists && cIter != m_sampleBlocks.cend(); ++cIter)
     {
-        pRetGpaSample = iter->second;
+        if (cIter->get() == pSampleBlock)
+        {
+            exists = true;
+        }
     }
 
-    return pRetGpaSample;
+    return exists;
+}
+
+bool GPACommandList::BeginReservedSample(ClientSampleId clientSampleId, GPASample* pSample)
+{
+    // the sample id was validated when the block was reserved, only the state of the command list can have changed since
+    if (CommandListState::SAMPLE_RECORDING_BEGIN != m_commandListState)
+    {
+        GPA_LogError("Command list must be in recording state to start/end a sample.");
+        return false;
+    }
+
+    if (nullptr != m_pLastSample)
+    {
+        GPA_LogError("Previous sample must be ended before starting a new one.");
+        return false;
+    }
+
+    if (!BeginSampleRequest(clientSampleId, pSample) || !pSample->Begin())
+    {
+        GPA_LogError("Failed to begin sample on command list.");
+        return false;
+    }
+
+    // only the thread recording the command list sets the last sample, so no lock is needed here
+    m_pLastSample = pSample;
+    return true;
+}
+
+bool GPACommandList::EndReservedSample()
+{
+    if (nullptr == m_pLastSample)
+    {
+        GPA_LogError("Sample must be started before ending one.");
+        return false;
+    }
+
+    if (!CloseLastSampleRequest() || !m_pLastSample->End() || !m_pLastSample->SetAsClosedByClient())
+    {
+        GPA_LogError("Unable to end the sample on command list.");
+        return false;
+    }
+
+    m_pLastSample = nullptr;
+    return true;
+}
+
+GPASample* GPACommandList::GetLastSample() const
+{
+    return m_pLastSample;
+}
+
+GPASample* GPACommandList::GetSample(ClientSampleId clientSampleId) const
+{
+    std::lock_guard<std::mutex> lockCmdList(m_cmdListMutex);
+
+    return m_clientSampleIdGpaSampleIndex.Find(clientSampleId);
 }
 
 bool GPACommandList::IsLastSampleClosed() const
@@ -241,16 +357,32 @@ CommandListId GPACommandList::GetId() const
 
 void GPACommandList::IterateSampleUnorderedMap(std::function<bool(ClientSampleIdGpaSamplePair)> function) const
 {
-    bool next = true;
-
-    for (auto it = m_clientSampleIdGpaSampleUnorderedMap.cbegin(); it != m_clientSampleIdGpaSampleUnorderedMap.cend() && next; ++it)
-    {
-        next = function(*it);
-    }
+    m_clientSampleIdGpaSampleIndex.Iterate(
+        [&function](ClientSampleId clientSampleId, GPASample* pGpaSample) { return function(ClientSampleIdGpaSamplePair(clientSampleId, pGpaSample)); });
 }
 
 void GPACommandList::AddSample(ClientSampleId clientSampleId, GPASample* pGpaSample)
 {
     std::lock_guard<std::mutex> lockCmdList(m_cmdListMutex);
-    m_clientSampleIdGpaSampleUnorderedMap.insert(ClientSampleIdGpaSamplePair(clientSampleId, pGpaSample));
+    m_clientSampleIdGpaSampleIndex.Insert(clientSampleId, pGpaSample);
+}
+
+void GPACommandList::CommitOpenSampleBlock()
+{
+    const std::vector<GPASample*>& samples         = m_pOpenSampleBlock->GetSamples();
+    gpa_uint32                     usedSampleCount = m_pOpenSampleBlock->GetUsedSampleCount();
+    ClientSampleId                 firstSampleId   = m_pOpenSampleBlock->GetFirstSampleId();
+
+    m_cmdListMutex.lock();
+
+    for (gpa_uint32 sampleIndex = 0; sampleIndex < usedSampleCount; ++sampleIndex)
+    {
+        m_clientSampleIdGpaSampleIndex.Insert(firstSampleId + sampleIndex, samples[sampleIndex]);
+    }
+
+    m_cmdListMutex.unlock();
+
+    m_pGpaPass->CommitSampleBlock(samples, usedSampleCount);
+    m_pOpenSampleBlock->Close();
+    m_pOpenSampleBlock = nullptr;
 }
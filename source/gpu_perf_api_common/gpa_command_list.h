@@ -8,15 +8,19 @@
 #ifndef _GPA_COMMAND_LIST_H_
 #define _GPA_COMMAND_LIST_H_
 
-#include <unordered_map>
+// std
+#include <memory>
+#include <vector>
 
 // GPA Common
 #include "gpa_command_list_interface.h"
 #include "gpa_sample.h"
+#include "gpa_sample_block.h"
+#include "gpa_sample_index.h"
 
-using ClientSampleIdGpaSamplePair = std::pair<ClientSampleId, GPASample*>;  ///< type alias for pair of client sample id and GPA sample object pointer
-using ClientSampleIdGpaSampleUnorderedMap =
-    std::unordered_map<ClientSampleId, GPASample*>;  ///< type alias for map of client sample id and GPA sample object pointer
+using ClientSampleIdGpaSamplePair  = std::pair<ClientSampleId, GPASample*>;  ///< type alias for pair of client sample id and GPA sample object pointer
+using ClientSampleIdGpaSampleIndex = GPASampleIndex<GPASample>;               ///< type alias for index of client sample id and GPA sample object pointer
+using GPASampleBlocks              = std::vector<std::unique_ptr<GPASampleBlock>>;  ///< type alias for list of sample blocks owned by a command list
 
 /// Class for GPA Command List
 class GPACommandList : public IGPACommandList
@@ -77,9 +81,32 @@ public:
     /// \copydoc IGPAInterfaceTrait::ObjectType()
     GPAObjectType ObjectType() const override;
 
-    /// Returns the command lsit id
-    /// \return command list id
-    CommandListId GetId() const;
+    /// \copydoc IGPACommandList::GetId()
+    CommandListId GetId() const override;
+
+    /// \copydoc IGPACommandList::BeginSampleBlock()
+    GPASampleBlock* BeginSampleBlock(ClientSampleId firstSampleId, gpa_uint32 sampleCount) override;
+
+    /// \copydoc IGPACommandList::EndSampleBlock()
+    bool EndSampleBlock(GPASampleBlock* pSampleBlock) override;
+
+    /// Checks whether a sample block was begun on the command list.
+    /// Must only be called by the thread recording the command list.
+    /// \param[in] pSampleBlock the sample block
+    /// \return true if the command list owns the sample block
+    bool DoesSampleBlockExist(const GPASampleBlock* pSampleBlock) const;
+
+    /// Begins a sample of the open sample block, whose id and sample were validated when the block was reserved.
+    /// Must only be called by the thread recording the command list.
+    /// \param[in] clientSampleId client sample id of the sample
+    /// \param[in] pSample the reserved sample
+    /// \return true if the sample was begun, false otherwise
+    bool BeginReservedSample(ClientSampleId clientSampleId, GPASample* pSample);
+
+    /// Ends the sample begun by BeginReservedSample.
+    /// Must only be called by the thread recording the command list.
+    /// \return true if the sample was ended, false otherwise
+    bool EndReservedSample();
 
     /// Iterate over all the samples in the command list
     /// \param[in] function function to be executed for each object in the list - function may return false to terminate iteration
@@ -109,6 +136,9 @@ private:
     /// \param[in] pGpaSample The sample to start
     void AddSample(ClientSampleId clientSampleId, GPASample* pGpaSample);
 
+    /// Commits the samples of the open sample block which were begun to the command list and its pass, and releases the other ids
+    void CommitOpenSampleBlock();
+
     /// Enum for the state of command list
     enum class CommandListState
     {
@@ -122,9 +152,11 @@ private:
     GPAPass*                            m_pGpaPass;                             ///< GPA Pass
     GPASample*                          m_pLastSample;                          ///< the current open sample on this command list
     CommandListState                    m_commandListState;                     ///< command list state
-    ClientSampleIdGpaSampleUnorderedMap m_clientSampleIdGpaSampleUnorderedMap;  ///< Unordered Map of client sample id and GPA sample object
+    ClientSampleIdGpaSampleIndex        m_clientSampleIdGpaSampleIndex;         ///< Index of client sample id and GPA sample object
     GPA_Command_List_Type               m_commandListType;                      ///< GPA Command List type
     CommandListId                       m_commandListId;                        ///< command list id
+    GPASampleBlocks                     m_sampleBlocks;                         ///< the sample blocks begun on the command list, kept until it is deleted
+    GPASampleBlock*                     m_pOpenSampleBlock;                     ///< the sample block whose samples can be begun, if any
 };
 
 #endif  // _GPA_COMMAND_LIST_H_
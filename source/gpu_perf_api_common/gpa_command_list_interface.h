@@ -12,7 +12,8 @@
 #include "gpa_interface_trait_interface.h"
 #include "gpa_pass.h"
 
-class IGPASession;  // forward declaration
+class IGPASession;     // forward declaration
+class GPASampleBlock;  // forward declaration
 
 /// Interface for GPA Command List
 class IGPACommandList : public IGPAInterfaceTrait
@@ -76,6 +77,21 @@ public:
     /// Returns the cmd type of the command list
     /// \return cmd type of the command list
     virtual GPA_Command_List_Type GetCmdType() const = 0;
+
+    /// Returns the id of the command list, unique within its pass and increasing in creation order
+    /// \return command list id
+    virtual CommandListId GetId() const = 0;
+
+    /// Reserves a block of consecutive sample ids on the command list and creates their samples
+    /// \param[in] firstSampleId the client sample id of the first sample of the block
+    /// \param[in] sampleCount the number of samples in the block
+    /// \return the sample block, owned by the command list, or nullptr if the sample ids could not be reserved
+    virtual GPASampleBlock* BeginSampleBlock(ClientSampleId firstSampleId, gpa_uint32 sampleCount) = 0;
+
+    /// Ends the open sample block of the command list, committing the samples which were begun and releasing the other ids
+    /// \param[in] pSampleBlock the sample block
+    /// \return true if the sample block was ended, false if it is not the open block of the command list or one of its samples is open
+    virtual bool EndSampleBlock(GPASampleBlock* pSampleBlock) = 0;
 };
 
 #endif  // _I_GPA_COMMAND_LIST_H_
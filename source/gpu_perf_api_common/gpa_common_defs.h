@@ -19,15 +19,9 @@
 #define GPA_STRING(X) #X
 #define GPA_STRINGIFY(X) GPA_STRING(X)
 
-// The following will be merged into GPUPerfAPITypes.h in a future version that supports streaming counters and sqtt data
+// The following will be merged into GPUPerfAPITypes.h in a future version that exposes the sqtt collection options
 #define GPA_INITIALIZE_SIMULTANEOUS_QUEUES_ENABLE_BIT \
     static_cast<GPA_Initialize_Bits>(1)  ///< define for GPA_Initialize bit for enabling sqtt collection from all hardware queues
-#define GPA_SESSION_SAMPLE_TYPE_SQTT static_cast<GPA_Session_Sample_Type>(1)               ///< define for sqtt session sample type
-#define GPA_SESSION_SAMPLE_TYPE_STREAMING_COUNTER static_cast<GPA_Session_Sample_Type>(2)  ///< define for streaming counter session sample type
-#define GPA_SESSION_SAMPLE_TYPE_STREAMING_COUNTER_AND_SQTT \
-    static_cast<GPA_Session_Sample_Type>(3)                                                     ///< define for streaming counter and sqtt session sample type
-#define GPA_CONTEXT_SAMPLE_TYPE_SQTT static_cast<GPA_Context_Sample_Type_Bits>(2)               ///< define for sqtt context sample type
-#define GPA_CONTEXT_SAMPLE_TYPE_STREAMING_COUNTER static_cast<GPA_Context_Sample_Type_Bits>(4)  ///< define for streaming counter context sample type
 
 /// Type used to define the mask of instructions included in SQTT data.
 /// Currently, this supports "all" or "none", but may include specific instruction types
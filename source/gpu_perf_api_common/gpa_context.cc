@@ -23,6 +23,7 @@ GPAContext::GPAContext(GPA_HWInfo& hwInfo, GPA_OpenContextFlags flags)
     , m_isOpen(false)
     , m_isAmdDevice(false)
     , m_pActiveSession(nullptr)
+    , m_trackedMemory(GPA_MEMORY_CATEGORY_CONTEXT, sizeof(GPAContext))
 {
     gpa_uint32 vendorId;
 
@@ -187,6 +188,22 @@ GPA_Status GPAContext::GetCounterIndex(const char* pCounterName, gpa_uint32* pIn
     return pCounterAccessor->GetCounterIndex(pCounterName, pIndex) ? GPA_STATUS_OK : GPA_STATUS_ERROR_FAILED;
 }
 
+GPA_Status GPAContext::GetCounterIndexByUuid(const GPA_UUID* pCounterUuid, gpa_uint32* pIndex) const
+{
+    GPA_INTERNAL_CHECK_NULL_PARAM(pCounterUuid);
+    GPA_INTERNAL_CHECK_NULL_PARAM(pIndex);
+
+    IGPACounterAccessor* pCounterAccessor = GPAContextCounterMediator::Instance()->GetCounterAccessor(this);
+
+    if (nullptr == pCounterAccessor)
+    {
+        GPA_LogDebugError("Accessor is unassigned.");
+        return GPA_STATUS_ERROR_FAILED;
+    }
+
+    return pCounterAccessor->GetCounterIndexByUuid(*pCounterUuid, pIndex) ? GPA_STATUS_OK : GPA_STATUS_ERROR_FAILED;
+}
+
 bool GPAContext::GetCounterSourceLocalIndex(gpa_uint32 exposedCounterIndex, GPACounterSource* pSource, gpa_uint32* pSourceLocalIndex) const
 {
     assert(nullptr != pSource);
@@ -428,12 +445,14 @@ void GPAContext::AddGpaSession(IGPASession* pGpaSession)
 {
     std::lock_guard<std::mutex> lockSessionList(m_gpaSessionListMutex);
     m_gpaSessionList.push_back(pGpaSession);
+    m_trackedMemory.SetBytes(sizeof(GPAContext) + GPANodeContainerBytes(m_gpaSessionList));
 }
 
 void GPAContext::RemoveGpaSession(IGPASession* pGpaSession)
 {
     std::lock_guard<std::mutex> lockSessionList(m_gpaSessionListMutex);
     m_gpaSessionList.remove(pGpaSession);
+    m_trackedMemory.SetBytes(sizeof(GPAContext) + GPANodeContainerBytes(m_gpaSessionList));
 }
 
 void GPAContext::IterateGpaSessionList(std::function<bool(IGPASession* pGpaSession)> function) const
@@ -451,6 +470,7 @@ void GPAContext::ClearSessionList()
 {
     std::lock_guard<std::mutex> lockSessionList(m_gpaSessionListMutex);
     m_gpaSessionList.clear();
+    m_trackedMemory.SetBytes(sizeof(GPAContext));
 }
 
 bool GPAContext::GetIndex(IGPASession* pGpaSession, unsigned int* pIndex) const
@@ -16,6 +16,7 @@
 #include "gpu_perf_api_types.h"
 #include "gpa_context_interface.h"
 #include "gpa_session_interface.h"
+#include "gpa_memory_tracker.h"
 
 using GPASessionList = std::list<IGPASession*>;  ///< type alias for list of IGPASession objects
 
@@ -59,6 +60,9 @@ public:
     /// \copydoc IGPAContext::GetCounterIndex()
     GPA_Status GetCounterIndex(const char* pCounterName, gpa_uint32* pIndex) const override;
 
+    /// \copydoc IGPAContext::GetCounterIndexByUuid()
+    GPA_Status GetCounterIndexByUuid(const GPA_UUID* pCounterUuid, gpa_uint32* pIndex) const override;
+
     /// \copydoc IGPAContext::GetCounterSourceLocalIndex()
     bool GetCounterSourceLocalIndex(gpa_uint32 exposedCounterIndex, GPACounterSource* pSource, gpa_uint32* pSourceLocalIndex) const override;
 
@@ -157,6 +161,7 @@ private:
     mutable std::mutex   m_gpaSessionListMutex;               ///< Mutex for GPA session list
     IGPASession*         m_pActiveSession;                    ///< gpa session to keep track of active session
     mutable std::mutex   m_activeSessionMutex;                ///< mutex for active session
+    GPATrackedMemory     m_trackedMemory;                     ///< accounting of the memory held by the context, excluding its sessions
 };
 
 #endif  // _GPA_CONTEXT_H_
@@ -28,6 +28,11 @@ void GPAContextCounterMediator::DeleteInstance()
 
 GPAContextCounterMediator::~GPAContextCounterMediator()
 {
+    for (auto contextInfoIter = m_contextInfoMap.begin(); contextInfoIter != m_contextInfoMap.end(); ++contextInfoIter)
+    {
+        delete contextInfoIter->second.m_pCounterScheduler;
+    }
+
     m_contextInfoMap.clear();
 }
 
@@ -61,14 +66,21 @@ GPA_Status GPAContextCounterMediator::GenerateCounters(const IGPAContext* pGpaCo
 
         if (GPA_STATUS_OK == retStatus)
         {
-            GPAContextStatus contextStatus = {pCounterScheduler, pCounterAccessor};
+            // the device constants of the equations don't change while the context is open, so they are folded once here
+            // rather than each time a counter result is computed
+            std::shared_ptr<GPA_SpecializedCounterEquations> pSpecializedEquations = std::make_shared<GPA_SpecializedCounterEquations>();
+            pSpecializedEquations->Specialize(pCounterAccessor, pHwInfo);
+
+            GPAContextStatus contextStatus = {pCounterScheduler, pCounterAccessor, pSpecializedEquations};
 
             if (GPA_STATUS_OK == pCounterScheduler->SetCounterAccessor(pCounterAccessor, vendorId, deviceId, revisionId))
             {
                 m_contextInfoMap.insert(GpaCtxStatusInfoPair(pGpaContext, contextStatus));
+                PublishContextInfoMap_NotThreadSafe();
             }
             else
             {
+                delete pCounterScheduler;
                 retStatus = GPA_STATUS_ERROR_FAILED;
                 GPA_LogError("Failed to set counter accessor.");
             }
@@ -84,26 +96,38 @@ GPA_Status GPAContextCounterMediator::GenerateCounters(const IGPAContext* pGpaCo
 
 bool GPAContextCounterMediator::IsCounterSchedulingSupported(const IGPAContext* pGpaContext) const
 {
-    std::lock_guard<std::mutex> lock(m_contextInfoMapMutex);
+    GPAContextStatus contextStatus;
 
-    if (!DoesContextExist(pGpaContext))
+    if (!GetPublishedContextStatus(pGpaContext, contextStatus))
     {
         return false;
     }
 
-    return nullptr != m_contextInfoMap.at(pGpaContext).m_pCounterScheduler && nullptr != m_contextInfoMap.at(pGpaContext).m_pCounterAccessor;
+    return nullptr != contextStatus.m_pCounterScheduler && nullptr != contextStatus.m_pCounterAccessor;
 }
 
 IGPACounterAccessor* GPAContextCounterMediator::GetCounterAccessor(const IGPAContext* pGpaContext) const
 {
-    std::lock_guard<std::mutex> lock(m_contextInfoMapMutex);
+    GPAContextStatus contextStatus;
 
-    if (!DoesContextExist(pGpaContext))
+    if (!GetPublishedContextStatus(pGpaContext, contextStatus))
     {
         return nullptr;
     }
 
-    return m_contextInfoMap.at(pGpaContext).m_pCounterAccessor;
+    return contextStatus.m_pCounterAccessor;
+}
+
+std::shared_ptr<const GPA_SpecializedCounterEquations> GPAContextCounterMediator::GetSpecializedCounterEquations(const IGPAContext* pGpaContext) const
+{
+    GPAContextStatus contextStatus;
+
+    if (!GetPublishedContextStatus(pGpaContext, contextStatus))
+    {
+        return nullptr;
+    }
+
+    return contextStatus.m_pSpecializedEquations;
 }
 
 GPA_Status GPAContextCounterMediator::ScheduleCounters(const IGPAContext*             pGpaContext,
@@ -223,9 +247,14 @@ void GPAContextCounterMediator::RemoveContext(IGPAContext* pGpaContext)
 {
     std::lock_guard<std::mutex> lock(m_contextInfoMapMutex);
 
-    if (DoesContextExist(pGpaContext))
+    GpaCtxStatusInfoMap::iterator contextInfoIter = m_contextInfoMap.find(pGpaContext);
+
+    if (m_contextInfoMap.end() != contextInfoIter)
     {
-        m_contextInfoMap.erase(pGpaContext);
+        // the scheduler was created for this context, while the counter accessor is shared with the other contexts on the same device
+        delete contextInfoIter->second.m_pCounterScheduler;
+        m_contextInfoMap.erase(contextInfoIter);
+        PublishContextInfoMap_NotThreadSafe();
     }
 }
 
@@ -252,3 +281,30 @@ bool GPAContextCounterMediator::DoesContextExist(const IGPAContext* pGpaContext)
 {
     return m_contextInfoMap.find(pGpaContext) != m_contextInfoMap.cend();
 }
+
+void GPAContextCounterMediator::PublishContextInfoMap_NotThreadSafe()
+{
+    // readers keep using the previous copy until they are done with it, so it is never modified after being published
+    GpaCtxStatusInfoSnapshot publishedContextInfoMap = std::make_shared<const GpaCtxStatusInfoMap>(m_contextInfoMap);
+    std::atomic_store(&m_publishedContextInfoMap, publishedContextInfoMap);
+}
+
+bool GPAContextCounterMediator::GetPublishedContextStatus(const IGPAContext* pGpaContext, GPAContextStatus& contextStatus) const
+{
+    GpaCtxStatusInfoSnapshot publishedContextInfoMap = std::atomic_load(&m_publishedContextInfoMap);
+
+    if (nullptr == publishedContextInfoMap)
+    {
+        return false;
+    }
+
+    GpaCtxStatusInfoMap::const_iterator contextInfoIter = publishedContextInfoMap->find(pGpaContext);
+
+    if (publishedContextInfoMap->cend() == contextInfoIter)
+    {
+        return false;
+    }
+
+    contextStatus = contextInfoIter->second;
+    return true;
+}
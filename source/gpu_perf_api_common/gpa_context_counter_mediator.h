@@ -8,12 +8,14 @@
 #ifndef _GPA_CONTEXT_COUNTER_MEDIATOR_H_
 #define _GPA_CONTEXT_COUNTER_MEDIATOR_H_
 
+#include <memory>
 #include <vector>
 
 #include "gpa_context_interface.h"
 #include "gpa_session_interface.h"
 #include "gpa_pass.h"
 #include "gpa_counter_scheduler_interface.h"
+#include "gpa_specialized_counter_equations.h"
 
 /// GPAContextCounterMediator class
 class GPAContextCounterMediator
@@ -41,10 +43,17 @@ public:
     bool IsCounterSchedulingSupported(const IGPAContext* pGpaContext) const;
 
     /// Returns the counter accessor for the given context
+    /// This does not take the mediator lock, so it can be called concurrently from several threads reading results
     /// \param[in] pGpaContext GPA context
     /// \return GPA_STATUS_OK upon successful operation
     IGPACounterAccessor* GetCounterAccessor(const IGPAContext* pGpaContext) const;
 
+    /// Returns the equations of the public counters specialized for the device of the given context
+    /// This does not take the mediator lock, so it can be called concurrently from several threads reading results
+    /// \param[in] pGpaContext GPA context
+    /// \return the specialized equations, or nullptr if the context is not open
+    std::shared_ptr<const GPA_SpecializedCounterEquations> GetSpecializedCounterEquations(const IGPAContext* pGpaContext) const;
+
     /// Schedules the given set of counters for the given context
     /// \param[in] pGpaContext GPA context
     /// \param[in] pGpaSession GPA session
@@ -91,19 +100,32 @@ private:
     /// \return true if context info exist otherwise false
     bool DoesContextExist(const IGPAContext* pGpaContext) const;
 
+    /// Publishes a copy of the context info map for the lock-free readers
+    /// Must be called with m_contextInfoMapMutex held, after each change to m_contextInfoMap
+    void PublishContextInfoMap_NotThreadSafe();
+
     static GPAContextCounterMediator* ms_pCounterManager;  ///< static instance of the counter manager
 
     struct GPAContextStatus
     {
-        IGPACounterScheduler* m_pCounterScheduler;  ///< counter scheduler
-        IGPACounterAccessor*  m_pCounterAccessor;   ///< counter accessor
+        IGPACounterScheduler*                                  m_pCounterScheduler;      ///< counter scheduler, owned by the mediator
+        IGPACounterAccessor*                                   m_pCounterAccessor;       ///< counter accessor, shared by all contexts opened on the same device
+        std::shared_ptr<const GPA_SpecializedCounterEquations> m_pSpecializedEquations;  ///< equations of the public counters specialized for the context
     };
 
-    using GpaCtxStatusInfoPair = std::pair<const IGPAContext*, GPAContextStatus>;  ///< type alias for GPA context and its status info pair
-    using GpaCtxStatusInfoMap  = std::map<const IGPAContext*, GPAContextStatus>;   ///< type alias for GPA context and its status info map
+    using GpaCtxStatusInfoPair     = std::pair<const IGPAContext*, GPAContextStatus>;  ///< type alias for GPA context and its status info pair
+    using GpaCtxStatusInfoMap      = std::map<const IGPAContext*, GPAContextStatus>;   ///< type alias for GPA context and its status info map
+    using GpaCtxStatusInfoSnapshot = std::shared_ptr<const GpaCtxStatusInfoMap>;       ///< type alias for a published copy of the context info map
+
+    /// Gets the status info of the given context from the published context info map, without locking
+    /// \param[in] pGpaContext GPA context
+    /// \param[out] contextStatus the status info of the context
+    /// \return true if context info exist otherwise false
+    bool GetPublishedContextStatus(const IGPAContext* pGpaContext, GPAContextStatus& contextStatus) const;
 
-    GpaCtxStatusInfoMap m_contextInfoMap;       ///< map of context and its info
-    mutable std::mutex  m_contextInfoMapMutex;  ///< mutex for context info map
+    GpaCtxStatusInfoMap      m_contextInfoMap;           ///< map of context and its info
+    mutable std::mutex       m_contextInfoMapMutex;      ///< mutex for context info map, and for the schedulers of the contexts
+    GpaCtxStatusInfoSnapshot m_publishedContextInfoMap;  ///< immutable copy of the context info map, only accessed with std::atomic_load/std::atomic_store
 };
 
 #endif  // _GPA_CONTEXT_COUNTER_MEDIATOR_H_
\ No newline at end of file
@@ -114,6 +114,12 @@ public:
     /// \return GPA_STATUS_OK on successful execution
     virtual GPA_Status GetCounterIndex(const char* pCounterName, gpa_uint32* pIndex) const = 0;
 
+    /// Returns the index of a counter by its UUID
+    /// \param[in] pCounterUuid UUID of the counter
+    /// \param[out] pIndex index of the counter
+    /// \return GPA_STATUS_OK on successful execution
+    virtual GPA_Status GetCounterIndexByUuid(const GPA_UUID* pCounterUuid, gpa_uint32* pIndex) const = 0;
+
     /// Uses the exposedCounterIndex to look up which source the counter comes from and the relative (local)
     /// counter index into that source of counters.
     /// \param[in] exposedCounterIndex The counter index of which to get the source and local index.
@@ -0,0 +1,402 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Streaming statistics of counter results, accumulated across sessions
+//==============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <new>
+
+#include "gpa_counter_statistics.h"
+#include "logging.h"
+
+/// Largest relative error of the quantiles estimated by a sketch
+static const gpa_float64 s_relativeAccuracy = 0.01;
+
+/// Ratio between the magnitudes of two consecutive bins
+static const gpa_float64 s_binGamma = (1.0 + s_relativeAccuracy) / (1.0 - s_relativeAccuracy);
+
+/// Natural logarithm of s_binGamma
+static const gpa_float64 s_logBinGamma = std::log(s_binGamma);
+
+/// Values of a smaller magnitude are counted as zero, which keeps the bin indices in range
+static const gpa_float64 s_minBinnedMagnitude = 1e-12;
+
+std::mutex                                          GPACounterStatistics::ms_registryMutex;
+std::unordered_set<const _GPA_CounterStatisticsId*> GPACounterStatistics::ms_registry;
+
+GPAQuantileSketch::BinStore::BinStore()
+    : m_minIndex(0)
+    , m_count(0)
+{
+}
+
+void GPAQuantileSketch::BinStore::Add(int index, gpa_uint64 count)
+{
+    if (m_binCounts.empty())
+    {
+        m_minIndex = index;
+        m_binCounts.push_back(0);
+    }
+
+    int maxIndex = m_minIndex + static_cast<int>(m_binCounts.size()) - 1;
+
+    if (index > maxIndex)
+    {
+        int lowestKeptIndex = index - MAX_BINS + 1;
+
+        if (lowestKeptIndex > m_minIndex)
+        {
+            // the bins of the smallest magnitudes are folded into the lowest bin which is kept
+            size_t     numCollapsed   = std::min(static_cast<size_t>(lowestKeptIndex - m_minIndex), m_binCounts.size());
+            gpa_uint64 collapsedCount = 0;
+
+            for (size_t binIndex = 0; binIndex < numCollapsed; ++binIndex)
+            {
+                collapsedCount += m_binCounts[binIndex];
+            }
+
+            m_binCounts.erase(m_binCounts.begin(), m_binCounts.begin() + numCollapsed);
+            m_binCounts.insert(m_binCounts.begin(), m_binCounts.empty() ? 1 : 0, 0);
+            m_binCounts[0] += collapsedCount;
+            m_minIndex = lowestKeptIndex;
+        }
+
+        m_binCounts.resize(static_cast<size_t>(index - m_minIndex) + 1, 0);
+    }
+    else if (index < m_minIndex)
+    {
+        index = std::max(index, maxIndex - MAX_BINS + 1);
+        m_binCounts.insert(m_binCounts.begin(), static_cast<size_t>(m_minIndex - index), 0);
+        m_minIndex = index;
+    }
+
+    m_binCounts[index - m_minIndex] += count;
+    m_count += count;
+}
+
+void GPAQuantileSketch::BinStore::Merge(const BinStore& other)
+{
+    if (0 == other.m_count)
+    {
+        return;
+    }
+
+    // extend the range to both ends of the other store first, so that the bins are not moved for each added bin
+    size_t firstUsed = 0;
+    size_t lastUsed  = other.m_binCounts.size() - 1;
+
+    while (0 == other.m_binCounts[firstUsed])
+    {
+        ++firstUsed;
+    }
+
+    while (0 == other.m_binCounts[lastUsed])
+    {
+        --lastUsed;
+    }
+
+    Add(other.m_minIndex + static_cast<int>(lastUsed), 0);
+    Add(other.m_minIndex + static_cast<int>(firstUsed), 0);
+
+    for (size_t binIndex = firstUsed; binIndex <= lastUsed; ++binIndex)
+    {
+        if (0 != other.m_binCounts[binIndex])
+        {
+            Add(other.m_minIndex + static_cast<int>(binIndex), other.m_binCounts[binIndex]);
+        }
+    }
+}
+
+GPAQuantileSketch::GPAQuantileSketch()
+    : m_zeroCount(0)
+{
+}
+
+void GPAQuantileSketch::Add(gpa_float64 value)
+{
+    if (value >= s_minBinnedMagnitude)
+    {
+        m_positive.Add(GetBinIndex(value), 1);
+    }
+    else if (-value >= s_minBinnedMagnitude)
+    {
+        m_negative.Add(GetBinIndex(-value), 1);
+    }
+    else
+    {
+        ++m_zeroCount;
+    }
+}
+
+void GPAQuantileSketch::Merge(const GPAQuantileSketch& other)
+{
+    m_positive.Merge(other.m_positive);
+    m_negative.Merge(other.m_negative);
+    m_zeroCount += other.m_zeroCount;
+}
+
+gpa_float64 GPAQuantileSketch::GetQuantile(gpa_float64 quantile) const
+{
+    gpa_uint64 count = GetCount();
+
+    if (0 == count)
+    {
+        return 0.0;
+    }
+
+    gpa_float64 rank       = std::min(std::max(quantile, 0.0), 1.0) * static_cast<gpa_float64>(count - 1);
+    gpa_float64 cumulative = 0.0;
+
+    // the negative values, from the largest magnitude down
+    for (size_t binIndex = m_negative.m_binCounts.size(); 0 < binIndex; --binIndex)
+    {
+        cumulative += static_cast<gpa_float64>(m_negative.m_binCounts[binIndex - 1]);
+
+        if (cumulative > rank)
+        {
+            return -GetBinMagnitude(m_negative.m_minIndex + static_cast<int>(binIndex) - 1);
+        }
+    }
+
+    cumulative += static_cast<gpa_float64>(m_zeroCount);
+
+    if (cumulative > rank)
+    {
+        return 0.0;
+    }
+
+    for (size_t binIndex = 0; binIndex < m_positive.m_binCounts.size(); ++binIndex)
+    {
+        cumulative += static_cast<gpa_float64>(m_positive.m_binCounts[binIndex]);
+
+        if (cumulative > rank)
+        {
+            return GetBinMagnitude(m_positive.m_minIndex + static_cast<int>(binIndex));
+        }
+    }
+
+    return GetBinMagnitude(m_positive.m_minIndex + static_cast<int>(m_positive.m_binCounts.size()) - 1);
+}
+
+gpa_uint64 GPAQuantileSketch::GetCount() const
+{
+    return m_positive.m_count + m_negative.m_count + m_zeroCount;
+}
+
+size_t GPAQuantileSketch::GetAllocatedBytes() const
+{
+    return GPAContainerBytes(m_positive.m_binCounts) + GPAContainerBytes(m_negative.m_binCounts);
+}
+
+int GPAQuantileSketch::GetBinIndex(gpa_float64 magnitude)
+{
+    return static_cast<int>(std::ceil(std::log(magnitude) / s_logBinGamma));
+}
+
+gpa_float64 GPAQuantileSketch::GetBinMagnitude(int index)
+{
+    // the bin holds the magnitudes in (gamma^(index-1), gamma^index], all within the relative accuracy of this one
+    return 2.0 * std::pow(s_binGamma, index) / (s_binGamma + 1.0);
+}
+
+GPACounterStatistics::CounterSummary::CounterSummary()
+    : m_count(0)
+    , m_sum(0.0)
+    , m_min(0.0)
+    , m_max(0.0)
+    , m_mean(0.0)
+    , m_sumOfSquaredDeviations(0.0)
+{
+}
+
+void GPACounterStatistics::CounterSummary::Add(gpa_float64 value)
+{
+    if (0 == m_count)
+    {
+        m_min = value;
+        m_max = value;
+    }
+    else
+    {
+        m_min = std::min(m_min, value);
+        m_max = std::max(m_max, value);
+    }
+
+    // Welford's update, which does not lose precision when the variance is small relative to the mean
+    ++m_count;
+    m_sum += value;
+
+    gpa_float64 delta = value - m_mean;
+    m_mean += delta / static_cast<gpa_float64>(m_count);
+    m_sumOfSquaredDeviations += delta * (value - m_mean);
+
+    m_sketch.Add(value);
+}
+
+void GPACounterStatistics::CounterSummary::Merge(const CounterSummary& other)
+{
+    if (0 == other.m_count)
+    {
+        return;
+    }
+
+    if (0 == m_count)
+    {
+        *this = other;
+        return;
+    }
+
+    gpa_float64 count      = static_cast<gpa_float64>(m_count);
+    gpa_float64 otherCount = static_cast<gpa_float64>(other.m_count);
+    gpa_float64 totalCount = count + otherCount;
+    gpa_float64 delta      = other.m_mean - m_mean;
+
+    // pairwise combination of the means and the sums of squared deviations of both sets of results
+    m_mean += delta * otherCount / totalCount;
+    m_sumOfSquaredDeviations += other.m_sumOfSquaredDeviations + delta * delta * count * otherCount / totalCount;
+    m_count += other.m_count;
+    m_sum += other.m_sum;
+    m_min = std::min(m_min, other.m_min);
+    m_max = std::max(m_max, other.m_max);
+    m_sketch.Merge(other.m_sketch);
+}
+
+GPACounterStatistics::GPACounterStatistics()
+    : m_trackedMemory(GPA_MEMORY_CATEGORY_COUNTER_STATISTICS, sizeof(GPACounterStatistics))
+{
+}
+
+GPACounterStatistics* GPACounterStatistics::Create()
+{
+    GPACounterStatistics* pStatistics = new (std::nothrow) GPACounterStatistics();
+
+    if (nullptr == pStatistics)
+    {
+        GPA_LogError("Unable to allocate memory for the counter statistics.");
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(ms_registryMutex);
+    ms_registry.insert(pStatistics);
+    return pStatistics;
+}
+
+void GPACounterStatistics::Delete(GPACounterStatistics* pStatistics)
+{
+    {
+        std::lock_guard<std::mutex> lock(ms_registryMutex);
+        ms_registry.erase(pStatistics);
+    }
+
+    delete pStatistics;
+}
+
+GPACounterStatistics* GPACounterStatistics::FromId(_GPA_CounterStatisticsId* pStatisticsId)
+{
+    std::lock_guard<std::mutex> lock(ms_registryMutex);
+    return ms_registry.end() != ms_registry.find(pStatisticsId) ? static_cast<GPACounterStatistics*>(pStatisticsId) : nullptr;
+}
+
+void GPACounterStatistics::AddSampleResults(const std::vector<gpa_uint32>&    counterIndices,
+                                            const std::vector<GPA_Data_Type>& dataTypes,
+                                            const gpa_uint64*                 pResults,
+                                            size_t                            numSamples)
+{
+    size_t numCounters = counterIndices.size();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // look the summaries up once per batch rather than once per result
+    std::vector<CounterSummary*> summaries(numCounters);
+
+    for (size_t counter = 0; counter < numCounters; ++counter)
+    {
+        summaries[counter] = &m_summaries[counterIndices[counter]];
+    }
+
+    for (size_t sample = 0; sample < numSamples; ++sample)
+    {
+        const gpa_uint64* pSampleResults = pResults + sample * numCounters;
+
+        for (size_t counter = 0; counter < numCounters; ++counter)
+        {
+            gpa_float64 value = 0.0;
+
+            if (GPA_DATA_TYPE_FLOAT64 == dataTypes[counter])
+            {
+                memcpy(&value, &pSampleResults[counter], sizeof(value));
+            }
+            else
+            {
+                value = static_cast<gpa_float64>(pSampleResults[counter]);
+            }
+
+            if (std::isfinite(value))
+            {
+                summaries[counter]->Add(value);
+            }
+        }
+    }
+
+    UpdateTrackedMemory_NotThreadSafe();
+}
+
+void GPACounterStatistics::Merge(const GPACounterStatistics& other)
+{
+    std::lock(m_mutex, other.m_mutex);
+    std::lock_guard<std::mutex> lock(m_mutex, std::adopt_lock);
+    std::lock_guard<std::mutex> otherLock(other.m_mutex, std::adopt_lock);
+
+    for (const auto& otherSummary : other.m_summaries)
+    {
+        m_summaries[otherSummary.first].Merge(otherSummary.second);
+    }
+
+    UpdateTrackedMemory_NotThreadSafe();
+}
+
+bool GPACounterStatistics::GetStatistics(gpa_uint32 counterIndex, GPA_CounterStatistics& statistics) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto summaryIter = m_summaries.find(counterIndex);
+
+    if (m_summaries.end() == summaryIter || 0 == summaryIter->second.m_count)
+    {
+        return false;
+    }
+
+    const CounterSummary& summary = summaryIter->second;
+
+    // the quantile estimates are clamped to the exact extrema, which makes p0 and p100 exact
+    auto getQuantile = [&summary](gpa_float64 quantile) {
+        return std::min(std::max(summary.m_sketch.GetQuantile(quantile), summary.m_min), summary.m_max);
+    };
+
+    statistics.m_count    = summary.m_count;
+    statistics.m_sum      = summary.m_sum;
+    statistics.m_min      = summary.m_min;
+    statistics.m_max      = summary.m_max;
+    statistics.m_mean     = summary.m_mean;
+    statistics.m_variance = summary.m_sumOfSquaredDeviations / static_cast<gpa_float64>(summary.m_count);
+    statistics.m_p50      = getQuantile(0.50);
+    statistics.m_p95      = getQuantile(0.95);
+    statistics.m_p99      = getQuantile(0.99);
+    return true;
+}
+
+void GPACounterStatistics::UpdateTrackedMemory_NotThreadSafe()
+{
+    size_t numBytes = sizeof(GPACounterStatistics) + GPANodeContainerBytes(m_summaries);
+
+    for (const auto& summary : m_summaries)
+    {
+        numBytes += summary.second.m_sketch.GetAllocatedBytes();
+    }
+
+    m_trackedMemory.SetBytes(numBytes);
+}
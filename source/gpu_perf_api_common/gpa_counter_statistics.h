@@ -0,0 +1,182 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Streaming statistics of counter results, accumulated across sessions
+//==============================================================================
+
+#ifndef _GPA_COUNTER_STATISTICS_H_
+#define _GPA_COUNTER_STATISTICS_H_
+
+#include <map>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include "gpu_perf_api_types.h"
+#include "gpa_memory_tracker.h"
+
+/// Streaming estimate of the quantiles of a set of values, with a bounded relative error.
+///
+/// The values are counted in logarithmically sized bins: every value of a bin is within RELATIVE_ACCURACY of the value
+/// the bin represents, so any quantile is estimated within that relative error, whatever the distribution and the
+/// number of values. Two sketches are merged by adding their bin counts, which gives the same sketch as if all the
+/// values had been added to a single one.
+/// The number of bins is bounded by MAX_BINS per sign; beyond that, the bins of the smallest magnitudes are collapsed,
+/// which only affects the accuracy of the quantiles closest to zero.
+class GPAQuantileSketch
+{
+public:
+    /// Largest number of bins for the values of each sign
+    static const int MAX_BINS = 2048;
+
+    /// Initializes a new instance of the GPAQuantileSketch class
+    GPAQuantileSketch();
+
+    /// Adds a value to the sketch
+    /// \param[in] value the value to add, which must be finite
+    void Add(gpa_float64 value);
+
+    /// Adds the values of another sketch to this one
+    /// \param[in] other the sketch to merge
+    void Merge(const GPAQuantileSketch& other);
+
+    /// Estimates a quantile of the values of the sketch
+    /// \param[in] quantile the quantile, between 0 and 1
+    /// \return the estimated value of the quantile, or 0 if the sketch is empty
+    gpa_float64 GetQuantile(gpa_float64 quantile) const;
+
+    /// Gets the number of values in the sketch
+    /// \return the number of values added to the sketch
+    gpa_uint64 GetCount() const;
+
+    /// Estimates the number of bytes allocated by the sketch
+    /// \return the number of bytes allocated for the bins of the sketch
+    size_t GetAllocatedBytes() const;
+
+private:
+    /// The bins of the values of one sign, indexed by the logarithm of their magnitude
+    struct BinStore
+    {
+        int                     m_minIndex;   ///< logarithmic index of the first bin
+        std::vector<gpa_uint64> m_binCounts;  ///< number of values in each bin, from m_minIndex up
+        gpa_uint64              m_count;      ///< number of values in all the bins
+
+        /// Initializes an empty store
+        BinStore();
+
+        /// Adds values to a bin, collapsing the lowest bins if the store would exceed MAX_BINS
+        /// \param[in] index the logarithmic index of the bin
+        /// \param[in] count the number of values to add
+        void Add(int index, gpa_uint64 count);
+
+        /// Adds the bins of another store to this one
+        /// \param[in] other the store to merge
+        void Merge(const BinStore& other);
+    };
+
+    /// Gets the logarithmic index of the bin of a magnitude
+    /// \param[in] magnitude the magnitude, which must not be too close to zero to be binned
+    /// \return the index of the bin
+    static int GetBinIndex(gpa_float64 magnitude);
+
+    /// Gets the magnitude represented by a bin
+    /// \param[in] index the logarithmic index of the bin
+    /// \return the magnitude represented by the bin
+    static gpa_float64 GetBinMagnitude(int index);
+
+    BinStore   m_positive;   ///< bins of the positive values
+    BinStore   m_negative;   ///< bins of the magnitude of the negative values
+    gpa_uint64 m_zeroCount;  ///< number of values too close to zero to be binned
+};
+
+/// The opaque type of the counter statistics ids given to the client, which are the counter statistics themselves
+struct _GPA_CounterStatisticsId
+{
+};
+
+/// Streaming statistics of the results of each counter, accumulated from the samples of any number of sessions.
+///
+/// The results are folded into the statistics as they are computed, so that the statistics of many frames can be
+/// gathered without keeping their per-sample results. The statistics of a counter are its count, sum, extrema, mean and
+/// variance, which are exact, and quantiles estimated by a GPAQuantileSketch; all of them can be merged.
+/// The statistics are keyed by exposed counter index, so only sessions of contexts exposing the same counters should be
+/// accumulated into the same object.
+class GPACounterStatistics : public _GPA_CounterStatisticsId
+{
+public:
+    /// Creates a counter statistics object and registers it so that its id can be validated
+    /// \return the new object, or nullptr if it could not be allocated
+    static GPACounterStatistics* Create();
+
+    /// Unregisters and deletes a counter statistics object
+    /// \param[in] pStatistics the object to delete
+    static void Delete(GPACounterStatistics* pStatistics);
+
+    /// Checks whether a counter statistics id refers to a live object
+    /// \param[in] pStatisticsId the id to check
+    /// \return the object, or nullptr if the id was not created by Create or was deleted
+    static GPACounterStatistics* FromId(_GPA_CounterStatisticsId* pStatisticsId);
+
+    /// Adds the results of a batch of samples; results which are not finite are skipped
+    /// \param[in] counterIndices the exposed index of each counter in the results
+    /// \param[in] dataTypes the data type of each counter in the results
+    /// \param[in] pResults the results of each sample, one row of counterIndices.size() values per sample
+    /// \param[in] numSamples the number of samples in the batch
+    void AddSampleResults(const std::vector<gpa_uint32>&    counterIndices,
+                          const std::vector<GPA_Data_Type>& dataTypes,
+                          const gpa_uint64*                 pResults,
+                          size_t                            numSamples);
+
+    /// Adds the statistics of another object to this one
+    /// \param[in] other the statistics to merge, which must not be this object
+    void Merge(const GPACounterStatistics& other);
+
+    /// Gets the statistics of a counter
+    /// \param[in] counterIndex the exposed index of the counter
+    /// \param[out] statistics the statistics of the counter
+    /// \return false if no result of the counter was accumulated, otherwise true
+    bool GetStatistics(gpa_uint32 counterIndex, GPA_CounterStatistics& statistics) const;
+
+private:
+    /// The statistics of one counter
+    struct CounterSummary
+    {
+        gpa_uint64        m_count;                   ///< number of results
+        gpa_float64       m_sum;                     ///< sum of the results
+        gpa_float64       m_min;                     ///< smallest result
+        gpa_float64       m_max;                     ///< largest result
+        gpa_float64       m_mean;                    ///< running mean of the results
+        gpa_float64       m_sumOfSquaredDeviations;  ///< running sum of the squared deviations of the results from their mean
+        GPAQuantileSketch m_sketch;                  ///< quantile sketch of the results
+
+        /// Initializes an empty summary
+        CounterSummary();
+
+        /// Adds a result
+        /// \param[in] value the result
+        void Add(gpa_float64 value);
+
+        /// Adds the results of another summary
+        /// \param[in] other the summary to merge
+        void Merge(const CounterSummary& other);
+    };
+
+    /// Initializes a new instance of the GPACounterStatistics class
+    GPACounterStatistics();
+
+    GPACounterStatistics(const GPACounterStatistics&) = delete;
+    GPACounterStatistics& operator=(const GPACounterStatistics&) = delete;
+
+    /// Updates the accounting of the memory held by the statistics. Requires m_mutex.
+    void UpdateTrackedMemory_NotThreadSafe();
+
+    mutable std::mutex                   m_mutex;          ///< mutex protecting the summaries
+    std::map<gpa_uint32, CounterSummary> m_summaries;      ///< the statistics of each counter, keyed by exposed counter index
+    GPATrackedMemory                     m_trackedMemory;  ///< accounting of the memory held by the statistics
+
+    static std::mutex                                          ms_registryMutex;  ///< mutex protecting the registry
+    static std::unordered_set<const _GPA_CounterStatisticsId*> ms_registry;       ///< the live counter statistics objects
+};
+
+#endif  // _GPA_COUNTER_STATISTICS_H_
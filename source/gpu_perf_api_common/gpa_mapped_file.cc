@@ -0,0 +1,133 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Read-only memory mapping of a file
+//==============================================================================
+
+#include "gpa_mapped_file.h"
+
+#ifdef _LINUX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+GPAMappedFile::GPAMappedFile()
+    : m_pData(nullptr)
+    , m_size(0)
+#ifdef _WIN32
+    , m_hFile(INVALID_HANDLE_VALUE)
+    , m_hMapping(nullptr)
+#endif
+{
+}
+
+GPAMappedFile::~GPAMappedFile()
+{
+    Close();
+}
+
+bool GPAMappedFile::Open(const std::string& filePath)
+{
+    Close();
+
+#ifdef _WIN32
+    m_hFile = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    LARGE_INTEGER fileSize = {};
+
+    if (INVALID_HANDLE_VALUE == m_hFile || !GetFileSizeEx(m_hFile, &fileSize) || 0 == fileSize.QuadPart ||
+        static_cast<unsigned long long>(fileSize.QuadPart) > static_cast<size_t>(-1))
+    {
+        Close();
+        return false;
+    }
+
+    m_hMapping = CreateFileMappingA(m_hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+    if (nullptr != m_hMapping)
+    {
+        m_pData = static_cast<const gpa_uint8*>(MapViewOfFile(m_hMapping, FILE_MAP_READ, 0, 0, 0));
+    }
+
+    if (nullptr == m_pData)
+    {
+        Close();
+        return false;
+    }
+
+    m_size = static_cast<size_t>(fileSize.QuadPart);
+#else
+    int fileDescriptor = open(filePath.c_str(), O_RDONLY);
+
+    if (-1 == fileDescriptor)
+    {
+        return false;
+    }
+
+    struct stat fileStatus = {};
+
+    if (0 == fstat(fileDescriptor, &fileStatus) && 0 < fileStatus.st_size)
+    {
+        void* pMapping = mmap(nullptr, static_cast<size_t>(fileStatus.st_size), PROT_READ, MAP_SHARED, fileDescriptor, 0);
+
+        if (MAP_FAILED != pMapping)
+        {
+            m_pData = static_cast<const gpa_uint8*>(pMapping);
+            m_size  = static_cast<size_t>(fileStatus.st_size);
+        }
+    }
+
+    // the mapping keeps its own reference to the file
+    close(fileDescriptor);
+#endif
+
+    return nullptr != m_pData;
+}
+
+void GPAMappedFile::Close()
+{
+#ifdef _WIN32
+    if (nullptr != m_pData)
+    {
+        UnmapViewOfFile(m_pData);
+    }
+
+    if (nullptr != m_hMapping)
+    {
+        CloseHandle(m_hMapping);
+        m_hMapping = nullptr;
+    }
+
+    if (INVALID_HANDLE_VALUE != m_hFile)
+    {
+        CloseHandle(m_hFile);
+        m_hFile = INVALID_HANDLE_VALUE;
+    }
+#else
+    if (nullptr != m_pData)
+    {
+        munmap(const_cast<gpa_uint8*>(m_pData), m_size);
+    }
+#endif
+
+    m_pData = nullptr;
+    m_size  = 0;
+}
+
+bool GPAMappedFile::IsOpen() const
+{
+    return nullptr != m_pData;
+}
+
+const gpa_uint8* GPAMappedFile::GetData() const
+{
+    return m_pData;
+}
+
+size_t GPAMappedFile::GetSize() const
+{
+    return m_size;
+}
@@ -0,0 +1,63 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Read-only memory mapping of a file
+//==============================================================================
+
+#ifndef _GPA_MAPPED_FILE_H_
+#define _GPA_MAPPED_FILE_H_
+
+#include <string>
+
+#ifdef _WIN32
+#include <Windows.h>
+#endif
+
+#include "gpu_perf_api_types.h"
+
+/// A file mapped read-only into the address space of the process.
+/// The pages of the file are only loaded when they are accessed, and can be evicted by the OS without being written to the page file.
+class GPAMappedFile
+{
+public:
+    /// Initializes a new instance of the GPAMappedFile class
+    GPAMappedFile();
+
+    /// Unmaps the file, if it is mapped
+    ~GPAMappedFile();
+
+    /// Maps a file, unmapping the previously mapped one if any
+    /// \param[in] filePath the path of the file to map
+    /// \return true if the file could be mapped, false if it does not exist, is empty or could not be mapped
+    bool Open(const std::string& filePath);
+
+    /// Unmaps the file, if it is mapped
+    void Close();
+
+    /// Indicates whether a file is mapped
+    /// \return true if a file is mapped
+    bool IsOpen() const;
+
+    /// Gets the content of the mapped file
+    /// \return the address at which the file is mapped, or nullptr if no file is mapped
+    const gpa_uint8* GetData() const;
+
+    /// Gets the size of the mapped file
+    /// \return the size of the mapped file in bytes, or 0 if no file is mapped
+    size_t GetSize() const;
+
+private:
+    GPAMappedFile(const GPAMappedFile&) = delete;
+    GPAMappedFile& operator=(const GPAMappedFile&) = delete;
+
+    const gpa_uint8* m_pData;  ///< address at which the file is mapped
+    size_t           m_size;   ///< size of the mapped file in bytes
+
+#ifdef _WIN32
+    HANDLE m_hFile;     ///< handle of the mapped file
+    HANDLE m_hMapping;  ///< handle of the file mapping object
+#endif
+};
+
+#endif  // _GPA_MAPPED_FILE_H_
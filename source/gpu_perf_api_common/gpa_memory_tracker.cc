@@ -0,0 +1,90 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Process-wide accounting of the host memory held by GPA objects
+//==============================================================================
+
+#include "gpa_memory_tracker.h"
+
+GPAMemoryTracker::CategoryCounters GPAMemoryTracker::ms_counters[GPA_MEMORY_CATEGORY__LAST] = {};
+
+void GPAMemoryTracker::AddObject(GPA_Memory_Category category, size_t numBytes)
+{
+    ms_counters[category].m_numObjects.fetch_add(1, std::memory_order_relaxed);
+    ms_counters[category].m_numBytes.fetch_add(numBytes, std::memory_order_relaxed);
+}
+
+void GPAMemoryTracker::RemoveObject(GPA_Memory_Category category, size_t numBytes)
+{
+    ms_counters[category].m_numObjects.fetch_sub(1, std::memory_order_relaxed);
+    ms_counters[category].m_numBytes.fetch_sub(numBytes, std::memory_order_relaxed);
+}
+
+void GPAMemoryTracker::AdjustBytes(GPA_Memory_Category category, size_t oldNumBytes, size_t newNumBytes)
+{
+    if (newNumBytes > oldNumBytes)
+    {
+        ms_counters[category].m_numBytes.fetch_add(newNumBytes - oldNumBytes, std::memory_order_relaxed);
+    }
+    else if (newNumBytes < oldNumBytes)
+    {
+        ms_counters[category].m_numBytes.fetch_sub(oldNumBytes - newNumBytes, std::memory_order_relaxed);
+    }
+}
+
+bool GPAMemoryTracker::GetStats(GPA_Memory_Category category, gpa_uint64* pNumBytes, gpa_uint64* pNumObjects)
+{
+    if (GPA_MEMORY_CATEGORY__START > category || GPA_MEMORY_CATEGORY__LAST <= category)
+    {
+        return false;
+    }
+
+    *pNumBytes   = ms_counters[category].m_numBytes.load(std::memory_order_relaxed);
+    *pNumObjects = ms_counters[category].m_numObjects.load(std::memory_order_relaxed);
+
+    return true;
+}
+
+GPATrackedMemory::GPATrackedMemory(GPA_Memory_Category category, size_t numBytes)
+    : m_category(category)
+    , m_numBytes(numBytes)
+{
+    GPAMemoryTracker::AddObject(m_category, m_numBytes);
+}
+
+GPATrackedMemory::GPATrackedMemory(const GPATrackedMemory& other)
+    : m_category(other.m_category)
+    , m_numBytes(other.m_numBytes)
+{
+    GPAMemoryTracker::AddObject(m_category, m_numBytes);
+}
+
+GPATrackedMemory& GPATrackedMemory::operator=(const GPATrackedMemory& other)
+{
+    if (this != &other)
+    {
+        GPAMemoryTracker::RemoveObject(m_category, m_numBytes);
+        m_category = other.m_category;
+        m_numBytes = other.m_numBytes;
+        GPAMemoryTracker::AddObject(m_category, m_numBytes);
+    }
+
+    return *this;
+}
+
+GPATrackedMemory::~GPATrackedMemory()
+{
+    GPAMemoryTracker::RemoveObject(m_category, m_numBytes);
+}
+
+void GPATrackedMemory::SetBytes(size_t numBytes)
+{
+    GPAMemoryTracker::AdjustBytes(m_category, m_numBytes, numBytes);
+    m_numBytes = numBytes;
+}
+
+size_t GPATrackedMemory::GetBytes() const
+{
+    return m_numBytes;
+}
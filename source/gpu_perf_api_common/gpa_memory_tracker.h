@@ -0,0 +1,113 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Process-wide accounting of the host memory held by GPA objects
+//==============================================================================
+
+#ifndef _GPA_MEMORY_TRACKER_H_
+#define _GPA_MEMORY_TRACKER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#include "gpu_perf_api_types.h"
+
+/// Accounts the number of live objects and the bytes they hold per memory category.
+///
+/// The counters are updated with relaxed atomics: they are statistics, not synchronization, and the objects
+/// updating them are created and destroyed on any thread.
+class GPAMemoryTracker
+{
+public:
+    /// Accounts a new object
+    /// \param[in] category the memory category of the object
+    /// \param[in] numBytes the number of bytes held by the object
+    static void AddObject(GPA_Memory_Category category, size_t numBytes);
+
+    /// Accounts the destruction of an object
+    /// \param[in] category the memory category of the object
+    /// \param[in] numBytes the number of bytes the object was last accounted with
+    static void RemoveObject(GPA_Memory_Category category, size_t numBytes);
+
+    /// Accounts a change in the number of bytes held by an object
+    /// \param[in] category the memory category of the object
+    /// \param[in] oldNumBytes the number of bytes the object was last accounted with
+    /// \param[in] newNumBytes the number of bytes now held by the object
+    static void AdjustBytes(GPA_Memory_Category category, size_t oldNumBytes, size_t newNumBytes);
+
+    /// Gets the statistics of a memory category
+    /// \param[in] category the memory category
+    /// \param[out] pNumBytes the number of bytes held by the live objects of the category
+    /// \param[out] pNumObjects the number of live objects of the category
+    /// \return false if the category is invalid, otherwise true
+    static bool GetStats(GPA_Memory_Category category, gpa_uint64* pNumBytes, gpa_uint64* pNumObjects);
+
+private:
+    /// The counters of a memory category, on their own cache line since categories are updated from different threads
+    struct alignas(64) CategoryCounters
+    {
+        std::atomic<gpa_uint64> m_numBytes;    ///< number of bytes held by the live objects of the category
+        std::atomic<gpa_uint64> m_numObjects;  ///< number of live objects of the category
+    };
+
+    static CategoryCounters ms_counters[GPA_MEMORY_CATEGORY__LAST];  ///< the counters of each memory category
+};
+
+/// Member which accounts its owner with the memory tracker for the lifetime of the owner.
+///
+/// The owner reports the bytes it holds with SetBytes whenever its containers grow or shrink substantially;
+/// copying the owner accounts the copy as a new object.
+class GPATrackedMemory
+{
+public:
+    /// Constructor
+    /// \param[in] category the memory category of the owner
+    /// \param[in] numBytes the initial number of bytes held by the owner, usually the size of the owner itself
+    GPATrackedMemory(GPA_Memory_Category category, size_t numBytes);
+
+    /// Copy constructor
+    /// \param[in] other the tracked memory of the owner being copied
+    GPATrackedMemory(const GPATrackedMemory& other);
+
+    /// Assignment operator; the category and bytes of this object are replaced with those of the other object
+    /// \param[in] other the tracked memory of the owner being assigned
+    /// \return reference to this object
+    GPATrackedMemory& operator=(const GPATrackedMemory& other);
+
+    /// Destructor
+    ~GPATrackedMemory();
+
+    /// Updates the number of bytes held by the owner; the owner is responsible for serializing the calls
+    /// \param[in] numBytes the number of bytes now held by the owner
+    void SetBytes(size_t numBytes);
+
+    /// Gets the number of bytes the owner is accounted with
+    /// \return the number of bytes the owner is accounted with
+    size_t GetBytes() const;
+
+private:
+    GPA_Memory_Category m_category;  ///< the memory category of the owner
+    size_t              m_numBytes;  ///< the number of bytes the owner is accounted with
+};
+
+/// Estimates the number of bytes allocated by a vector
+/// \param[in] container the vector
+/// \return the number of bytes allocated for the elements of the vector
+template <class T, class Allocator>
+size_t GPAContainerBytes(const std::vector<T, Allocator>& container)
+{
+    return container.capacity() * sizeof(T);
+}
+
+/// Estimates the number of bytes allocated by a node based container (list, map, set or their unordered variants)
+/// \param[in] container the container
+/// \return the number of bytes allocated for the nodes of the container, assuming up to four pointers of overhead per node
+template <class Container>
+size_t GPANodeContainerBytes(const Container& container)
+{
+    return container.size() * (sizeof(typename Container::value_type) + 4 * sizeof(void*));
+}
+
+#endif  // _GPA_MEMORY_TRACKER_H_
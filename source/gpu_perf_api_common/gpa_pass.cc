@@ -10,6 +10,8 @@
 #include "gpa_hardware_counters.h"
 #include "gpa_context_counter_mediator.h"
 
+const CounterIndex GPAPass::COUNTER_SKIPPED;
+
 GPAPass::GPAPass(IGPASession* pGpaSession, PassIndex passIndex, GPACounterSource counterSource, CounterList* pPassCounters)
     : m_pGpaSession(pGpaSession)
     , m_uiPassIndex(passIndex)
@@ -21,6 +23,7 @@ GPAPass::GPAPass(IGPASession* pGpaSession, PassIndex passIndex, GPACounterSource
     , m_commandListCounter(0u)
     , m_isAllSampleValidInPass(false)
     , m_isPassComplete(false)
+    , m_trackedMemory(GPA_MEMORY_CATEGORY_PASS, sizeof(GPAPass))
 {
     m_pCounterList = pPassCounters;
 
@@ -48,15 +51,14 @@ GPAPass::~GPAPass()
     m_gpaCmdList.clear();
     m_gpaCmdListMutex.unlock();
 
-    std::lock_guard<std::mutex> lock(m_samplesUnorderedMapMutex);
+    std::lock_guard<std::mutex> lock(m_samplesMutex);
 
-    for (auto samplePair : m_samplesUnorderedMap)
-    {
-        GPASample* pSample = samplePair.second;
+    m_samples.Iterate([](ClientSampleId, GPASample* pSample) {
         delete pSample;
-    }
+        return true;
+    });
 
-    m_samplesUnorderedMap.clear();
+    m_samples.Clear();
 }
 
 GPACounterSource GPAPass::GetCounterSource() const
@@ -66,26 +68,19 @@ GPACounterSource GPAPass::GetCounterSource() const
 
 GPASample* GPAPass::GetSampleById(ClientSampleId sampleId) const
 {
-    std::lock_guard<std::mutex> lock(m_samplesUnorderedMapMutex);
+    std::lock_guard<std::mutex> lock(m_samplesMutex);
 
     return GetSampleById_NotThreadSafe(sampleId);
 }
 
 GPASample* GPAPass::GetSampleById_NotThreadSafe(ClientSampleId sampleId) const
 {
-    GPASample* pRetVal = nullptr;
-
-    if (m_samplesUnorderedMap.find(sampleId) != m_samplesUnorderedMap.end())
-    {
-        pRetVal = m_samplesUnorderedMap.at(sampleId);
-    }
-
-    return pRetVal;
+    return m_samples.Find(sampleId);
 }
 
 GPASample* GPAPass::CreateAndBeginSample(ClientSampleId clientSampleId, IGPACommandList* pCmdList)
 {
-    std::lock_guard<std::mutex> lock(m_samplesUnorderedMapMutex);
+    std::lock_guard<std::mutex> lock(m_samplesMutex);
 
     GPASample* pSample = nullptr;
 
@@ -110,7 +105,10 @@ GPASample* GPAPass::CreateAndBeginSample(ClientSampleId clientSampleId, IGPAComm
             }
             else
             {
-                m_samplesUnorderedMap.insert(std::pair<ClientSampleId, GPASample*>(clientSampleId, pSample));
+                m_samples.Insert(clientSampleId, pSample);
+                AddPendingSample_NotThreadSafe(pSample);
+                unsigned int internalSampleId = m_gpaInternalSampleCounter.fetch_add(1);
+                m_clientGpaSamplesMap.insert(std::pair<unsigned int, unsigned int>(internalSampleId, clientSampleId));
             }
         }
         else
@@ -126,9 +124,75 @@ GPASample* GPAPass::CreateAndBeginSample(ClientSampleId clientSampleId, IGPAComm
     return pSample;
 }
 
+bool GPAPass::CreateSampleBlock(ClientSampleId firstSampleId, gpa_uint32 sampleCount, IGPACommandList* pCmdList, std::vector<GPASample*>& samples)
+{
+    std::lock_guard<std::mutex> lock(m_samplesMutex);
+
+    for (gpa_uint32 sampleIndex = 0; sampleIndex < sampleCount; ++sampleIndex)
+    {
+        if (DoesSampleExist_NotThreadSafe(firstSampleId + sampleIndex))
+        {
+            GPA_LogError("Sample Id already exists.");
+            return false;
+        }
+    }
+
+    GpaSampleType sampleType = (GPACounterSource::HARDWARE == m_counterSource) ? GpaSampleType::Hardware : GpaSampleType::Software;
+    samples.reserve(sampleCount);
+
+    for (gpa_uint32 sampleIndex = 0; sampleIndex < sampleCount; ++sampleIndex)
+    {
+        GPASample* pSample = CreateAPISpecificSample(pCmdList, sampleType, firstSampleId + sampleIndex);
+
+        if (nullptr == pSample)
+        {
+            GPA_LogError("Unable to create sample.");
+
+            for (auto sampleIter = samples.begin(); sampleIter != samples.end(); ++sampleIter)
+            {
+                delete (*sampleIter);
+            }
+
+            samples.clear();
+            return false;
+        }
+
+        samples.push_back(pSample);
+    }
+
+    // the samples are indexed right away, so that their ids cannot be used by another command list
+    for (gpa_uint32 sampleIndex = 0; sampleIndex < sampleCount; ++sampleIndex)
+    {
+        m_samples.Insert(firstSampleId + sampleIndex, samples[sampleIndex]);
+    }
+
+    UpdateTrackedMemory_NotThreadSafe();
+    return true;
+}
+
+void GPAPass::CommitSampleBlock(const std::vector<GPASample*>& samples, gpa_uint32 usedSampleCount)
+{
+    std::lock_guard<std::mutex> lock(m_samplesMutex);
+
+    for (gpa_uint32 sampleIndex = 0; sampleIndex < usedSampleCount; ++sampleIndex)
+    {
+        AddPendingSample_NotThreadSafe(samples[sampleIndex]);
+        unsigned int internalSampleId = m_gpaInternalSampleCounter.fetch_add(1);
+        m_clientGpaSamplesMap.insert(std::pair<unsigned int, unsigned int>(internalSampleId, samples[sampleIndex]->GetClientSampleId()));
+    }
+
+    for (size_t sampleIndex = usedSampleCount; sampleIndex < samples.size(); ++sampleIndex)
+    {
+        m_samples.Erase(samples[sampleIndex]->GetClientSampleId());
+        delete samples[sampleIndex];
+    }
+
+    UpdateTrackedMemory_NotThreadSafe();
+}
+
 bool GPAPass::ContinueSample(ClientSampleId srcSampleId, IGPACommandList* pPrimaryGpaCmdList)
 {
-    std::lock_guard<std::mutex> lock(m_samplesUnorderedMapMutex);
+    std::lock_guard<std::mutex> lock(m_samplesMutex);
 
     // 1. Validate that sample already exists in the pass
     // 2. Create a new sample on the cmd
@@ -210,15 +274,55 @@ IGPACommandList* GPAPass::CreateCommandList(void* pCmd, GPA_Command_List_Type cm
     return pRetCmdList;
 }
 
+void GPAPass::ReserveSamples(ClientSampleId maxSampleId)
+{
+    std::lock_guard<std::mutex> lock(m_samplesMutex);
+    m_samples.Reserve(maxSampleId);
+}
+
+void GPAPass::ResetSamples()
+{
+    m_gpaCmdListMutex.lock();
+
+    for (auto it = m_gpaCmdList.begin(); it != m_gpaCmdList.end(); ++it)
+    {
+        delete (*it);
+    }
+
+    m_gpaCmdList.clear();
+    m_commandListCounter = 0u;
+    m_gpaCmdListMutex.unlock();
+
+    std::lock_guard<std::mutex> lock(m_samplesMutex);
+
+    m_samples.Iterate([](ClientSampleId, GPASample* pSample) {
+        delete pSample;
+        return true;
+    });
+
+    m_samples.Reset();
+    m_clientGpaSamplesMap.clear();
+    m_gpaInternalSampleCounter = 0u;
+    m_results.clear();
+    m_pendingSamples.clear();
+
+    m_isResultCollected      = false;
+    m_isResultReady          = false;
+    m_isAllSampleValidInPass = false;
+    m_isPassComplete         = false;
+
+    UpdateTrackedMemory_NotThreadSafe();
+}
+
 SampleCount GPAPass::GetSampleCount() const
 {
-    std::lock_guard<std::mutex> lock(m_samplesUnorderedMapMutex);
-    return static_cast<SampleCount>(m_samplesUnorderedMap.size());
+    std::lock_guard<std::mutex> lock(m_samplesMutex);
+    return static_cast<SampleCount>(m_samples.Size());
 }
 
 bool GPAPass::GetSampleIdByIndex(SampleIndex sampleIndex, ClientSampleId& clientSampleId) const
 {
-    std::lock_guard<std::mutex> lock(m_samplesUnorderedMapMutex);
+    std::lock_guard<std::mutex> lock(m_samplesMutex);
     bool                        found = m_clientGpaSamplesMap.find(sampleIndex) != m_clientGpaSamplesMap.end();
 
     if (found)
@@ -234,12 +338,12 @@ bool GPAPass::IsAllSampleValidInPass() const
     if (!m_isAllSampleValidInPass)
     {
         bool                        success = true;
-        std::lock_guard<std::mutex> lockSamples(m_samplesUnorderedMapMutex);
+        std::lock_guard<std::mutex> lockSamples(m_samplesMutex);
 
-        for (auto sampleIter = m_samplesUnorderedMap.cbegin(); sampleIter != m_samplesUnorderedMap.cend(); ++sampleIter)
-        {
-            success &= sampleIter->second->IsSampleValid();
-        }
+        m_samples.Iterate([&success](ClientSampleId, GPASample* pSample) {
+            success &= pSample->IsSampleValid();
+            return true;
+        });
 
         if (success)
         {
@@ -250,6 +354,23 @@ bool GPAPass::IsAllSampleValidInPass() const
     return m_isAllSampleValidInPass;
 }
 
+void GPAPass::AddPendingSample_NotThreadSafe(GPASample* pSample)
+{
+    IGPACommandList* pCmdList  = pSample->GetCmdList();
+    CommandListId    cmdListId = nullptr != pCmdList ? pCmdList->GetId() : 0u;
+
+    m_pendingSamples[cmdListId].push_back(pSample);
+}
+
+void GPAPass::UpdateTrackedMemory_NotThreadSafe()
+{
+    // the pending sample queues hold at most one pointer per sample of the pass
+    size_t numBytes = sizeof(GPAPass) + m_samples.GetMemoryUsage() + GPANodeContainerBytes(m_clientGpaSamplesMap) +
+                      GPANodeContainerBytes(m_pendingSamples) + m_samples.Size() * sizeof(GPASample*) + GPANodeContainerBytes(m_results);
+
+    m_trackedMemory.SetBytes(numBytes);
+}
+
 CounterCount GPAPass::GetEnabledCounterCount() const
 {
     return static_cast<unsigned int>(m_usedCounterListForPass.size());
@@ -272,18 +393,32 @@ bool GPAPass::IsTimingPass() const
 
 bool GPAPass::UpdateResults()
 {
-    std::lock_guard<std::mutex> lock(m_samplesUnorderedMapMutex);
+    std::lock_guard<std::mutex> lock(m_samplesMutex);
 
     if (!m_isResultCollected)
     {
-        bool tmpAllResultsCollected = true;
+        // Only the samples whose results are not collected yet are polled. Samples on a command list complete in the order
+        // in which they were submitted, so polling stops at the first sample whose results are not available.
+        PendingSamplesMap::iterator cmdListIter = m_pendingSamples.begin();
 
-        for (auto sampleIter = m_samplesUnorderedMap.begin(); sampleIter != m_samplesUnorderedMap.end(); ++sampleIter)
+        while (cmdListIter != m_pendingSamples.end())
         {
-            tmpAllResultsCollected &= sampleIter->second->UpdateResults();
+            std::deque<GPASample*>& pendingSamples = cmdListIter->second;
+
+            while (!pendingSamples.empty() && pendingSamples.front()->UpdateResults())
+            {
+                pendingSamples.pop_front();
+            }
+
+            if (!pendingSamples.empty())
+            {
+                break;
+            }
+
+            cmdListIter = m_pendingSamples.erase(cmdListIter);
         }
 
-        m_isResultCollected = tmpAllResultsCollected;
+        m_isResultCollected = m_pendingSamples.empty();
     }
 
     return m_isResultCollected;
@@ -356,57 +491,65 @@ bool GPAPass::IsResultCollected() const
 
 GPA_Status GPAPass::GetResult(ClientSampleId clientSampleId, CounterIndex internalCounterIndex, gpa_uint64* pResultBuffer) const
 {
-    *pResultBuffer = 0;
+    return GetResults(clientSampleId, 1, &internalCounterIndex, pResultBuffer);
+}
+
+GPA_Status GPAPass::GetResults(ClientSampleId      clientSampleId,
+                               size_t              counterCount,
+                               const CounterIndex* pInternalCounterIndices,
+                               gpa_uint64*         pResultBuffer) const
+{
+    std::fill(pResultBuffer, pResultBuffer + counterCount, 0);
 
-    std::lock_guard<std::mutex> lock(m_samplesUnorderedMapMutex);
+    std::lock_guard<std::mutex> lock(m_samplesMutex);
 
-    GPA_Status                 status     = GPA_STATUS_OK;
-    SamplesMap::const_iterator sampleIter = m_samplesUnorderedMap.find(clientSampleId);
+    const GPASample* pSample = m_samples.Find(clientSampleId);
 
-    if (sampleIter == m_samplesUnorderedMap.cend())
+    if (nullptr == pSample)
     {
         GPA_LogError("Invalid SampleId supplied while getting pass results.");
-        status = GPA_STATUS_ERROR_INVALID_PARAMETER;
+        return GPA_STATUS_ERROR_INVALID_PARAMETER;
     }
-    else
-    {
-        CounterIndex counterIndexWithinSample;
 
-        if (GetCounterIndexInPass(internalCounterIndex, &counterIndexWithinSample))
-        {
-            if (!sampleIter->second->GetResult(counterIndexWithinSample, pResultBuffer))
-            {
-                GPA_LogError("Failed to get counter result within pass.");
-                status = GPA_STATUS_ERROR_FAILED;
-            }
-        }
-        else if (m_skippedCounterList.find(internalCounterIndex) == m_skippedCounterList.end())
-        {
-            // we didn't skip the counter, so we wrongly think it was in this pass.
-            GPA_LogError("Failed to find internal counter index within pass counters.");
-            status = GPA_STATUS_ERROR_INVALID_PARAMETER;
-        }
+    GPA_Status status = GPA_STATUS_OK;
+
+    for (size_t counterIter = 0; counterIter < counterCount && GPA_STATUS_OK == status; ++counterIter)
+    {
+        status = GetSampleResult_NotThreadSafe(pSample, pInternalCounterIndices[counterIter], &pResultBuffer[counterIter]);
     }
 
     return status;
 }
 
+GPA_Status GPAPass::GetSampleResult_NotThreadSafe(const GPASample* pSample, CounterIndex internalCounterIndex, gpa_uint64* pResultBuffer) const
+{
+    CounterSlotMap::const_iterator slotIter = m_counterSlotMap.find(internalCounterIndex);
+
+    if (m_counterSlotMap.cend() == slotIter)
+    {
+        // we didn't skip the counter, so we wrongly think it was in this pass.
+        GPA_LogError("Failed to find internal counter index within pass counters.");
+        return GPA_STATUS_ERROR_INVALID_PARAMETER;
+    }
+
+    if (COUNTER_SKIPPED != slotIter->second && !pSample->GetResult(slotIter->second, pResultBuffer))
+    {
+        GPA_LogError("Failed to get counter result within pass.");
+        return GPA_STATUS_ERROR_FAILED;
+    }
+
+    return GPA_STATUS_OK;
+}
+
 bool GPAPass::DoesSampleExist(ClientSampleId clientSampleId) const
 {
-    std::lock_guard<std::mutex> lock(m_samplesUnorderedMapMutex);
+    std::lock_guard<std::mutex> lock(m_samplesMutex);
     return DoesSampleExist_NotThreadSafe(clientSampleId);
 }
 
 bool GPAPass::DoesSampleExist_NotThreadSafe(ClientSampleId clientSampleId) const
 {
-    bool exists = false;
-
-    if (m_samplesUnorderedMap.find(clientSampleId) != m_samplesUnorderedMap.end())
-    {
-        exists = true;
-    }
-
-    return exists;
+    return nullptr != m_samples.Find(clientSampleId);
 }
 
 bool GPAPass::DoesCommandListExist(IGPACommandList* pGpaCommandList) const
@@ -434,13 +577,23 @@ const GPACommandLists& GPAPass::GetCmdList() const
 void GPAPass::EnableCounterForPass(const CounterIndex& counterIndex)
 {
     std::lock_guard<std::mutex> lockPass(m_counterListMutex);
+    CounterIndex                slot = static_cast<CounterIndex>(m_usedCounterListForPass.size());
     m_usedCounterListForPass.push_back(counterIndex);
+
+    // the first enabled occurrence of a counter is the one whose result is reported
+    auto inserted = m_counterSlotMap.insert(CounterSlotMap::value_type(counterIndex, slot));
+
+    if (!inserted.second && COUNTER_SKIPPED == inserted.first->second)
+    {
+        inserted.first->second = slot;
+    }
 }
 
 void GPAPass::DisableCounterForPass(const CounterIndex& counterIndex)
 {
     std::lock_guard<std::mutex> lockPass(m_counterListMutex);
     m_skippedCounterList.insert(counterIndex);
+    m_counterSlotMap.insert(CounterSlotMap::value_type(counterIndex, COUNTER_SKIPPED));
 }
 
 void GPAPass::EnableAllCountersForPass()
@@ -448,6 +601,12 @@ void GPAPass::EnableAllCountersForPass()
     std::lock_guard<std::mutex> lockPass(m_counterListMutex);
     m_usedCounterListForPass = *m_pCounterList;
     m_skippedCounterList.clear();
+    m_counterSlotMap.clear();
+
+    for (CounterIndex slot = 0; slot < static_cast<CounterIndex>(m_usedCounterListForPass.size()); ++slot)
+    {
+        m_counterSlotMap.insert(CounterSlotMap::value_type(m_usedCounterListForPass[slot], slot));
+    }
 }
 
 void GPAPass::DisableAllCountersForPass()
@@ -456,6 +615,12 @@ void GPAPass::DisableAllCountersForPass()
     m_skippedCounterList.clear();
     m_skippedCounterList.insert(m_pCounterList->begin(), m_pCounterList->end());
     m_usedCounterListForPass.clear();
+    m_counterSlotMap.clear();
+
+    for (auto counterIter = m_pCounterList->cbegin(); counterIter != m_pCounterList->cend(); ++counterIter)
+    {
+        m_counterSlotMap.insert(CounterSlotMap::value_type(*counterIter, COUNTER_SKIPPED));
+    }
 }
 
 CounterCount GPAPass::GetNumEnabledCountersForPass() const
@@ -466,19 +631,15 @@ CounterCount GPAPass::GetNumEnabledCountersForPass() const
 
 bool GPAPass::GetCounterIndexInPass(CounterIndex internalCounterIndex, CounterIndex* pCounterIndexInPassList) const
 {
-    bool found = false;
-    if (!m_usedCounterListForPass.empty())
-    {
-        CounterList::const_iterator iter = std::find(m_usedCounterListForPass.begin(), m_usedCounterListForPass.end(), internalCounterIndex);
+    CounterSlotMap::const_iterator slotIter = m_counterSlotMap.find(internalCounterIndex);
 
-        if (m_usedCounterListForPass.end() != iter)
-        {
-            *pCounterIndexInPassList = static_cast<CounterIndex>(iter - m_usedCounterListForPass.begin());
-            found                    = true;
-        }
+    if (m_counterSlotMap.cend() == slotIter || COUNTER_SKIPPED == slotIter->second)
+    {
+        return false;
     }
 
-    return found;
+    *pCounterIndexInPassList = slotIter->second;
+    return true;
 }
 
 bool GPAPass::GetCounterByIndexInPass(CounterIndex counterIndexInPass, CounterIndex* pInternalCounterIndex) const
@@ -527,11 +688,13 @@ void GPAPass::UnlockCommandListMutex() const
 
 void GPAPass::AddClientSample(ClientSampleId sampleId, GPASample* pGPASample)
 {
-    m_samplesUnorderedMapMutex.lock();
-    m_samplesUnorderedMap.insert(std::pair<ClientSampleId, GPASample*>(sampleId, pGPASample));
+    m_samplesMutex.lock();
+    m_samples.Insert(sampleId, pGPASample);
+    AddPendingSample_NotThreadSafe(pGPASample);
     unsigned int internalSampleId = m_gpaInternalSampleCounter.fetch_add(1);
     m_clientGpaSamplesMap.insert(std::pair<unsigned int, unsigned int>(internalSampleId, sampleId));
-    m_samplesUnorderedMapMutex.unlock();
+    UpdateTrackedMemory_NotThreadSafe();
+    m_samplesMutex.unlock();
 }
 
 void GPAPass::IteratePassCounterList(std::function<bool(const CounterIndex& counterIndex)> function) const
@@ -10,6 +10,8 @@
 
 // std
 #include <vector>
+#include <deque>
+#include <map>
 #include <unordered_map>
 #include <set>
 #include <memory>
@@ -17,21 +19,25 @@
 
 #include "gpa_counter_scheduler_interface.h"
 #include "gpa_sample.h"
+#include "gpa_sample_index.h"
 #include "gpa_context.h"
+#include "gpa_memory_tracker.h"
 
 using PassIndex                = unsigned int;                                    ///< type alias for pass index
 using SampleCount              = unsigned int;                                    ///< type alias for sample count
 using CounterCount             = unsigned int;                                    ///< type alias for counter count
 using CounterIndex             = unsigned int;                                    ///< type alias for counter index
-using SamplesMap               = std::unordered_map<ClientSampleId, GPASample*>;  ///< type alias for map of client sample id and GPASample Object
+using SamplesIndex             = GPASampleIndex<GPASample>;                       ///< type alias for index of client sample id and GPASample Object
 using GpaInternalSampleCounter = std::atomic<unsigned int>;                       ///< type alias for GPA internal sample counter
 using ClientGpaSamplesMap      = std::map<unsigned int, unsigned int>;            ///< type alias for map of internal sample id and client sample id
 using CounterList              = std::vector<CounterIndex>;                       ///< type alias for counter list
 using SkippedCounters          = std::set<CounterIndex>;                          ///< type alias for list of skipped counters
+using CounterSlotMap           = std::unordered_map<CounterIndex, CounterIndex>;  ///< type alias for map of internal counter index and its index in the pass (or COUNTER_SKIPPED)
 using SampleIndex              = unsigned int;                                    ///< type alias for sample indexes
 using GPACommandLists          = std::vector<IGPACommandList*>;                   ///< type alias for list of GPA command lists
 using CommandListCounter       = unsigned int;                                    ///< type alias for command list counter
 using CommandListId            = unsigned int;                                    ///< type alias for command list Id
+using PendingSamplesMap        = std::map<CommandListId, std::deque<GPASample*>>;  ///< type alias for map of command list Id and its samples whose results are not collected yet
 
 /// Class for GPA pass
 class GPAPass
@@ -70,6 +76,19 @@ public:
     /// \return A pointer to the created sample; nullptr if creation failed or clientSampleId already exists.
     GPASample* CreateAndBeginSample(ClientSampleId clientSampleId, IGPACommandList* pCmdList);
 
+    /// Creates the samples of a sample block without beginning them, and reserves their client sample ids in the pass
+    /// \param[in] firstSampleId client sample id of the first sample of the block
+    /// \param[in] sampleCount number of samples in the block
+    /// \param[in] pCmdList the command list the samples are recorded on
+    /// \param[out] samples the created samples, in id order
+    /// \return true if the samples were created, false if one of the ids already exists or a sample could not be created
+    bool CreateSampleBlock(ClientSampleId firstSampleId, gpa_uint32 sampleCount, IGPACommandList* pCmdList, std::vector<GPASample*>& samples);
+
+    /// Commits the samples of a sample block which were begun, and deletes the other ones, releasing their client sample ids
+    /// \param[in] samples the samples of the block, in id order
+    /// \param[in] usedSampleCount the number of samples which were begun, at the start of the block
+    void CommitSampleBlock(const std::vector<GPASample*>& samples, gpa_uint32 usedSampleCount);
+
     /// Ends a sample created by the CreateAPISpecificSample
     /// \param[in] pCmdList GPA sample object
     /// \return true if operation is successful otherwise false
@@ -87,6 +106,15 @@ public:
     /// \return the Command list that was created or null if an error occurred
     virtual IGPACommandList* CreateCommandList(void* pCmd, GPA_Command_List_Type cmdType);
 
+    /// Preallocates the sample storage of the pass for the given range of client sample ids.
+    /// Must be called before any sample is created on the pass.
+    /// \param[in] maxSampleId the largest client sample id expected in the pass
+    void ReserveSamples(ClientSampleId maxSampleId);
+
+    /// Deletes the command lists and samples of the pass, so that the pass can be used to collect another set of samples.
+    /// The counters of the pass, the storage of its samples and its API-specific objects are kept.
+    virtual void ResetSamples();
+
     /// Returns the number of samples in the pass
     /// \return sample count
     SampleCount GetSampleCount() const;
@@ -146,6 +174,15 @@ public:
     /// \return GPA_STATUS_OK on successful execution
     virtual GPA_Status GetResult(ClientSampleId clientSampleId, CounterIndex internalCounterIndex, gpa_uint64* pResultBuffer) const;
 
+    /// Gets the results for several counters within a specific sample.
+    /// The sample is looked up, and the samples mutex taken, once for all of the counters.
+    /// \param[in] clientSampleId the Sample to get the results from.
+    /// \param[in] counterCount the number of counters whose results are needed.
+    /// \param[in] pInternalCounterIndices the internal counter indices, counterCount entries.
+    /// \param[out] pResultBuffer the 64-bit counter values, counterCount entries in the order of pInternalCounterIndices.
+    /// \return GPA_STATUS_OK on successful execution
+    GPA_Status GetResults(ClientSampleId clientSampleId, size_t counterCount, const CounterIndex* pInternalCounterIndices, gpa_uint64* pResultBuffer) const;
+
     /// Checks to see if the supplied command list exists on this pass.
     /// \param pGpaCommandList The IGPACommandList to search for.
     /// \return True if the command list exists; False otherwise
@@ -272,6 +309,25 @@ private:
     /// \return true if pass is ready to collect the result
     bool IsAllSampleValidInPass() const;
 
+    /// Adds a sample to the queue of samples whose results are not collected yet.
+    /// Does NOT lock the mutex, expects the calling method to do that.
+    /// \param[in] pSample the sample to add
+    void AddPendingSample_NotThreadSafe(GPASample* pSample);
+
+    /// Updates the accounting of the memory held by the sample containers of the pass.
+    /// Does NOT lock the mutex, expects the calling method to do that.
+    void UpdateTrackedMemory_NotThreadSafe();
+
+    /// Gets the result for a specific counter within a specific sample.
+    /// Does NOT lock the mutex, expects the calling method to do that.
+    /// \param[in] pSample the sample to get the result from.
+    /// \param[in] internalCounterIndex internal counter index.
+    /// \param[out] pResultBuffer the 64-bit counter value.
+    /// \return GPA_STATUS_OK on successful execution
+    GPA_Status GetSampleResult_NotThreadSafe(const GPASample* pSample, CounterIndex internalCounterIndex, gpa_uint64* pResultBuffer) const;
+
+    static const CounterIndex COUNTER_SKIPPED = static_cast<CounterIndex>(-1);  ///< slot of the counters which are skipped in the pass
+
     IGPASession*        m_pGpaSession;             ///< session of the pass
     PassIndex           m_uiPassIndex;             ///< index of the pass
     GPACounterSource    m_counterSource;           ///< counter source of the counters in the pass
@@ -281,16 +337,19 @@ private:
     mutable std::mutex  m_counterListMutex;        ///< Mutex to protect the m_usedCounterListForPass member
     CounterList         m_usedCounterListForPass;  ///< list of counters passed to driver for sample
     SkippedCounters     m_skippedCounterList;  ///< List of unsupported counters - these are counters whose blocks are not supported by the API specific driver
+    CounterSlotMap      m_counterSlotMap;      ///< index within the pass of each enabled counter, or COUNTER_SKIPPED for the skipped counters
     mutable std::mutex  m_gpaCmdListMutex;     ///< Mutex to protect the gpaCmdList
     GPACommandLists     m_gpaCmdList;          ///< list of API specific command Lists
-    mutable std::mutex  m_samplesUnorderedMapMutex;       ///< Mutex to protect the samples map
-    SamplesMap          m_samplesUnorderedMap;            ///< client sample id and GPASample object unordered map
+    mutable std::mutex  m_samplesMutex;                   ///< Mutex to protect the samples index
+    SamplesIndex        m_samples;                        ///< client sample id and GPASample object index
     ClientGpaSamplesMap m_clientGpaSamplesMap;            ///< client sample id and internal sample id map
+    PendingSamplesMap   m_pendingSamples;                 ///< samples whose results are not collected yet, per command list in the order they were begun
     GpaInternalSampleCounter m_gpaInternalSampleCounter;  ///< atomic counter for internal sample counter
     CommandListCounter
                  m_commandListCounter;  ///< counter representing number of command list created in this pass - This will help in validation and uniquely identifying two different command list
     mutable bool m_isAllSampleValidInPass;  ///< flag indicating all the sample in the pass is valid or not - for cache
     mutable bool m_isPassComplete;          ///< flag indicating whether or not the command list and sample on them is complete
+    GPATrackedMemory m_trackedMemory;       ///< accounting of the memory held by the pass, excluding its samples and their results
 };
 
 #endif  // _GPA_PASS_H_
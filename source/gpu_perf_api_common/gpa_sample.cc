@@ -22,6 +22,7 @@ GPASample::GPASample(GPAPass* pPass, IGPACommandList* pGpaCmdList, GpaSampleType
     , m_isClosedByClient(false)
     , m_isContinuedByClient(false)
     , m_isCopiedSample(false)
+    , m_trackedMemory(GPA_MEMORY_CATEGORY_SAMPLE, sizeof(GPASample))
 {
     m_isSecondary = (GPA_COMMAND_LIST_SECONDARY == pGpaCmdList->GetCmdType());
 
@@ -14,6 +14,7 @@
 
 // GPA Common
 #include "gpa_common_defs.h"
+#include "gpa_memory_tracker.h"
 
 class GPAPass;          // forward declaration
 class IGPACommandList;  // forward declaration
@@ -50,6 +51,7 @@ struct GPACounterSampleResult : public GPASampleResult
     /// Constructor
     /// \param[in] numOfCounters number of counters
     GPACounterSampleResult(size_t numOfCounters)
+        : m_trackedMemory(GPA_MEMORY_CATEGORY_SAMPLE_RESULT, sizeof(GPACounterSampleResult))
     {
         SetNumCounters(numOfCounters);
     }
@@ -74,6 +76,8 @@ struct GPACounterSampleResult : public GPASampleResult
         {
             m_resultBuffer.resize(numOfCounters);
         }
+
+        m_trackedMemory.SetBytes(sizeof(GPACounterSampleResult) + GPAContainerBytes(m_resultBuffer));
     }
 
     /// Returns the number of counters
@@ -91,7 +95,8 @@ struct GPACounterSampleResult : public GPASampleResult
     }
 
 private:
-    std::vector<gpa_uint64> m_resultBuffer;  ///< An array of counter results.
+    std::vector<gpa_uint64> m_resultBuffer;   ///< An array of counter results.
+    GPATrackedMemory        m_trackedMemory;  ///< accounting of the memory held by the result
 };
 
 /// Enum for GPA Sample type
@@ -274,6 +279,7 @@ private:
     bool                 m_isClosedByClient;     ///< flag indicating a sample is closed by the command list on which it is created
     bool                 m_isContinuedByClient;  ///< flag indicating a sample has been continued on another command list
     bool                 m_isCopiedSample;       ///< flag indicating that sample has been copied to primary command list
+    GPATrackedMemory     m_trackedMemory;        ///< accounting of the memory held by the sample
 };
 
 #endif  // _GPA_SAMPLE_H_
@@ -0,0 +1,115 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  A block of consecutive samples reserved on a command list
+//==============================================================================
+
+#include "gpa_sample_block.h"
+#include "gpa_command_list.h"
+
+std::mutex                                    GPASampleBlock::ms_registryMutex;
+std::unordered_set<const _GPA_SampleBlockId*> GPASampleBlock::ms_registry;
+
+GPASampleBlock::GPASampleBlock(GPACommandList* pCmdList, ClientSampleId firstSampleId)
+    : m_pCmdList(pCmdList)
+    , m_firstSampleId(firstSampleId)
+    , m_usedSampleCount(0)
+    , m_isSampleOpen(false)
+    , m_isOpen(true)
+{
+    std::lock_guard<std::mutex> lock(ms_registryMutex);
+    ms_registry.insert(this);
+}
+
+GPASampleBlock::~GPASampleBlock()
+{
+    std::lock_guard<std::mutex> lock(ms_registryMutex);
+    ms_registry.erase(this);
+}
+
+GPASampleBlock* GPASampleBlock::FromId(_GPA_SampleBlockId* pSampleBlockId)
+{
+    std::lock_guard<std::mutex> lock(ms_registryMutex);
+    return ms_registry.end() != ms_registry.find(pSampleBlockId) ? static_cast<GPASampleBlock*>(pSampleBlockId) : nullptr;
+}
+
+GPA_Status GPASampleBlock::BeginNextSample()
+{
+    if (!m_isOpen)
+    {
+        GPA_LogError("The sample block has already been ended.");
+        return GPA_STATUS_ERROR_FAILED;
+    }
+
+    if (m_isSampleOpen)
+    {
+        GPA_LogError("Previous sample must be ended before starting a new one.");
+        return GPA_STATUS_ERROR_FAILED;
+    }
+
+    if (m_samples.size() == m_usedSampleCount)
+    {
+        GPA_LogError("All the samples of the sample block have been begun.");
+        return GPA_STATUS_ERROR_INDEX_OUT_OF_RANGE;
+    }
+
+    if (!m_pCmdList->BeginReservedSample(m_firstSampleId + m_usedSampleCount, m_samples[m_usedSampleCount]))
+    {
+        return GPA_STATUS_ERROR_FAILED;
+    }
+
+    ++m_usedSampleCount;
+    m_isSampleOpen = true;
+    return GPA_STATUS_OK;
+}
+
+GPA_Status GPASampleBlock::EndSample()
+{
+    if (!m_isSampleOpen)
+    {
+        GPA_LogError("Sample must be started before ending one.");
+        return GPA_STATUS_ERROR_FAILED;
+    }
+
+    m_isSampleOpen = false;
+    return m_pCmdList->EndReservedSample() ? GPA_STATUS_OK : GPA_STATUS_ERROR_FAILED;
+}
+
+GPACommandList* GPASampleBlock::GetCmdList() const
+{
+    return m_pCmdList;
+}
+
+ClientSampleId GPASampleBlock::GetFirstSampleId() const
+{
+    return m_firstSampleId;
+}
+
+std::vector<GPASample*>& GPASampleBlock::GetSamples()
+{
+    return m_samples;
+}
+
+gpa_uint32 GPASampleBlock::GetUsedSampleCount() const
+{
+    return m_usedSampleCount;
+}
+
+bool GPASampleBlock::IsSampleOpen() const
+{
+    return m_isSampleOpen;
+}
+
+bool GPASampleBlock::IsOpen() const
+{
+    return m_isOpen;
+}
+
+void GPASampleBlock::Close()
+{
+    // the samples are now owned by the pass, only the block itself is kept until its command list is deleted
+    std::vector<GPASample*>().swap(m_samples);
+    m_isSampleOpen = false;
+    m_isOpen       = false;
+}
@@ -0,0 +1,98 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  A block of consecutive samples reserved on a command list
+//==============================================================================
+
+#ifndef _GPA_SAMPLE_BLOCK_H_
+#define _GPA_SAMPLE_BLOCK_H_
+
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include "gpu_perf_api_types.h"
+#include "gpa_sample.h"
+
+class GPACommandList;  // forward declaration
+
+/// The opaque type of the sample block ids given to the client, which are the sample blocks themselves
+struct _GPA_SampleBlockId
+{
+};
+
+/// A block of consecutive client sample ids reserved on a command list.
+///
+/// The samples of the block are created and their ids are validated when the block is begun, so that beginning and
+/// ending each sample only moves a cursor and calls the backend, without looking up, allocating or locking anything.
+/// The samples are begun in id order, and the samples which were begun are committed to the command list and its pass
+/// when the block is ended; the ids which were not used are released.
+/// The block is owned by its command list, and must only be used by the thread recording the command list.
+class GPASampleBlock : public _GPA_SampleBlockId
+{
+public:
+    /// Initializes a new instance of the GPASampleBlock class
+    /// \param[in] pCmdList the command list the samples are recorded on
+    /// \param[in] firstSampleId the client sample id of the first sample of the block
+    GPASampleBlock(GPACommandList* pCmdList, ClientSampleId firstSampleId);
+
+    /// Destructor; unregisters the sample block
+    ~GPASampleBlock();
+
+    /// Checks whether a sample block id refers to a live sample block
+    /// \param[in] pSampleBlockId the id to check
+    /// \return the sample block, or nullptr if the id was not returned by GPA_BeginSampleBlock or its command list was deleted
+    static GPASampleBlock* FromId(_GPA_SampleBlockId* pSampleBlockId);
+
+    /// Begins the next sample of the block
+    /// \return GPA_STATUS_OK if the sample was begun, GPA_STATUS_ERROR_INDEX_OUT_OF_RANGE if all the samples of the block were begun
+    GPA_Status BeginNextSample();
+
+    /// Ends the sample of the block which is open
+    /// \return GPA_STATUS_OK if the sample was ended
+    GPA_Status EndSample();
+
+    /// Gets the command list the samples are recorded on
+    /// \return the command list
+    GPACommandList* GetCmdList() const;
+
+    /// Gets the client sample id of the first sample of the block
+    /// \return the client sample id of the first sample
+    ClientSampleId GetFirstSampleId() const;
+
+    /// Gets the samples of the block, in id order, so that the pass can create them
+    /// \return the samples of the block; empty once the block is ended
+    std::vector<GPASample*>& GetSamples();
+
+    /// Gets the number of samples of the block which were begun
+    /// \return the number of samples begun
+    gpa_uint32 GetUsedSampleCount() const;
+
+    /// Indicates whether a sample of the block is open
+    /// \return true if a sample was begun and not ended yet
+    bool IsSampleOpen() const;
+
+    /// Indicates whether the samples of the block can still be begun
+    /// \return true until the block is ended
+    bool IsOpen() const;
+
+    /// Ends the block, once its samples were committed or released
+    void Close();
+
+private:
+    GPASampleBlock(const GPASampleBlock&) = delete;
+    GPASampleBlock& operator=(const GPASampleBlock&) = delete;
+
+    GPACommandList*         m_pCmdList;         ///< the command list the samples are recorded on
+    ClientSampleId          m_firstSampleId;    ///< client sample id of the first sample of the block
+    std::vector<GPASample*> m_samples;          ///< the samples of the block, in id order
+    gpa_uint32              m_usedSampleCount;  ///< number of samples which were begun; the next sample to begin
+    bool                    m_isSampleOpen;     ///< flag indicating the last sample begun is not ended yet
+    bool                    m_isOpen;           ///< flag indicating the block is not ended yet
+
+    static std::mutex                                    ms_registryMutex;  ///< mutex protecting the registry
+    static std::unordered_set<const _GPA_SampleBlockId*> ms_registry;       ///< the live sample blocks
+};
+
+#endif  // _GPA_SAMPLE_BLOCK_H_
@@ -0,0 +1,285 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  An index of objects by client sample id which adapts to the density of the ids.
+//==============================================================================
+
+#ifndef _GPA_SAMPLE_INDEX_H_
+#define _GPA_SAMPLE_INDEX_H_
+
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+
+#include "gpu_perf_api_types.h"
+
+/// An index of objects by client sample id.
+///
+/// Client sample ids are usually assigned sequentially, so the objects are stored in a flat vector indexed by
+/// the sample id (relative to the lowest id seen) for as long as the ids stay dense enough. Once a sample id
+/// would leave too many empty slots in the vector, the index switches to a hash map for the rest of its lifetime.
+/// T is the type of the indexed objects, which are referenced by pointer; the index does not own them.
+template <class T>
+class GPASampleIndex
+{
+public:
+    /// Number of empty slots the dense vector may always grow by, regardless of the number of objects
+    static const gpa_uint32 DENSE_MIN_SLACK = 64;
+
+    /// The dense vector may hold this many slots per indexed object before the index switches to the hash map
+    static const gpa_uint32 DENSE_MAX_SLOTS_PER_OBJECT = 2;
+
+    /// Largest number of slots which can be preallocated with Reserve
+    static const gpa_uint32 DENSE_MAX_RESERVED_SLOTS = 1 << 20;
+
+    /// Initializes a new instance of the GPASampleIndex class
+    GPASampleIndex()
+        : m_isDense(true)
+        , m_firstDenseId(0)
+        , m_reservedSlots(0)
+        , m_count(0)
+    {
+    }
+
+    /// Preallocates the dense vector for the sample ids 0 to maxSampleId.
+    /// The ids in this range are kept in the dense vector regardless of how many of them are used.
+    /// Has no effect once objects have been added to the index.
+    /// \param[in] maxSampleId the largest sample id expected to be added to the index
+    void Reserve(gpa_uint32 maxSampleId)
+    {
+        if (0 == m_count && m_isDense)
+        {
+            m_reservedSlots = std::min(maxSampleId, DENSE_MAX_RESERVED_SLOTS - 1) + 1;
+            m_firstDenseId  = 0;
+            m_denseObjects.assign(m_reservedSlots, nullptr);
+        }
+    }
+
+    /// Adds an object to the index
+    /// \param[in] sampleId the sample id of the object
+    /// \param[in] pObject the object to add, must not be null
+    /// \return false if an object with the same sample id has already been added, otherwise true
+    bool Insert(gpa_uint32 sampleId, T* pObject)
+    {
+        if (m_isDense && !MakeDenseSlot(sampleId))
+        {
+            ConvertToSparse();
+        }
+
+        bool inserted = false;
+
+        if (m_isDense)
+        {
+            T*& pSlot = m_denseObjects[sampleId - m_firstDenseId];
+            inserted  = nullptr == pSlot;
+
+            if (inserted)
+            {
+                pSlot = pObject;
+            }
+        }
+        else
+        {
+            inserted = m_sparseObjects.insert(std::make_pair(sampleId, pObject)).second;
+        }
+
+        if (inserted)
+        {
+            ++m_count;
+        }
+
+        return inserted;
+    }
+
+    /// Removes an object from the index; the storage of the dense vector is kept
+    /// \param[in] sampleId the sample id of the object
+    /// \return true if an object with the sample id was removed, false if there was none
+    bool Erase(gpa_uint32 sampleId)
+    {
+        bool erased = false;
+
+        if (m_isDense)
+        {
+            if (sampleId >= m_firstDenseId && sampleId - m_firstDenseId < m_denseObjects.size())
+            {
+                T*& pSlot = m_denseObjects[sampleId - m_firstDenseId];
+                erased    = nullptr != pSlot;
+                pSlot     = nullptr;
+            }
+        }
+        else
+        {
+            erased = 0 < m_sparseObjects.erase(sampleId);
+        }
+
+        if (erased)
+        {
+            --m_count;
+        }
+
+        return erased;
+    }
+
+    /// Finds the object with the given sample id
+    /// \param[in] sampleId the sample id of the object
+    /// \return the object, or nullptr if no object with the sample id has been added
+    T* Find(gpa_uint32 sampleId) const
+    {
+        T* pObject = nullptr;
+
+        if (m_isDense)
+        {
+            if (sampleId >= m_firstDenseId && sampleId - m_firstDenseId < m_denseObjects.size())
+            {
+                pObject = m_denseObjects[sampleId - m_firstDenseId];
+            }
+        }
+        else
+        {
+            typename SparseObjects::const_iterator objectIter = m_sparseObjects.find(sampleId);
+
+            if (m_sparseObjects.cend() != objectIter)
+            {
+                pObject = objectIter->second;
+            }
+        }
+
+        return pObject;
+    }
+
+    /// Gets the number of objects in the index
+    /// \return the number of objects in the index
+    size_t Size() const
+    {
+        return m_count;
+    }
+
+    /// Indicates whether the objects are stored in the dense vector
+    /// \return true if the objects are stored in the dense vector, false if they are stored in the hash map
+    bool IsDense() const
+    {
+        return m_isDense;
+    }
+
+    /// Estimates the number of bytes allocated by the index
+    /// \return the number of bytes allocated for the dense vector and the hash map
+    size_t GetMemoryUsage() const
+    {
+        return m_denseObjects.capacity() * sizeof(T*) + m_sparseObjects.size() * (sizeof(typename SparseObjects::value_type) + 2 * sizeof(void*)) +
+               m_sparseObjects.bucket_count() * sizeof(void*);
+    }
+
+    /// Removes all objects from the index, but keeps its storage so that the same sample ids can be added again without allocating
+    void Reset()
+    {
+        m_reservedSlots = std::max(m_reservedSlots, static_cast<gpa_uint32>(m_denseObjects.size()));
+        m_count         = 0;
+        std::fill(m_denseObjects.begin(), m_denseObjects.end(), nullptr);
+        m_sparseObjects.clear();
+    }
+
+    /// Removes all objects from the index and returns it to the dense storage
+    void Clear()
+    {
+        m_isDense       = true;
+        m_firstDenseId  = 0;
+        m_reservedSlots = 0;
+        m_count         = 0;
+        m_denseObjects.clear();
+        m_sparseObjects.clear();
+    }
+
+    /// Iterate over all the objects in the index, in an unspecified order
+    /// \param[in] function function to be executed for each sample id and object - function may return false to terminate iteration
+    template <class Function>
+    void Iterate(Function function) const
+    {
+        bool next = true;
+
+        if (m_isDense)
+        {
+            for (size_t slot = 0; slot < m_denseObjects.size() && next; ++slot)
+            {
+                if (nullptr != m_denseObjects[slot])
+                {
+                    next = function(m_firstDenseId + static_cast<gpa_uint32>(slot), m_denseObjects[slot]);
+                }
+            }
+        }
+        else
+        {
+            for (auto objectIter = m_sparseObjects.cbegin(); objectIter != m_sparseObjects.cend() && next; ++objectIter)
+            {
+                next = function(objectIter->first, objectIter->second);
+            }
+        }
+    }
+
+private:
+    using SparseObjects = std::unordered_map<gpa_uint32, T*>;  ///< type alias for the hash map of sample id and object
+
+    /// Grows the dense vector so that it has a slot for the sample id, unless this would make it too sparse
+    /// \param[in] sampleId the sample id which needs a slot
+    /// \return true if the dense vector has a slot for the sample id, false if the index should switch to the hash map
+    bool MakeDenseSlot(gpa_uint32 sampleId)
+    {
+        if (m_denseObjects.empty())
+        {
+            m_firstDenseId = sampleId;
+        }
+
+        gpa_uint64 firstId  = std::min(static_cast<gpa_uint64>(m_firstDenseId), static_cast<gpa_uint64>(sampleId));
+        gpa_uint64 endId    = std::max(static_cast<gpa_uint64>(m_firstDenseId) + m_denseObjects.size(), static_cast<gpa_uint64>(sampleId) + 1);
+        gpa_uint64 maxSlots = std::max(static_cast<gpa_uint64>(m_reservedSlots),
+                                       static_cast<gpa_uint64>(DENSE_MAX_SLOTS_PER_OBJECT) * (m_count + 1) + DENSE_MIN_SLACK);
+
+        if (endId - firstId > maxSlots)
+        {
+            return false;
+        }
+
+        if (firstId < m_firstDenseId)
+        {
+            // also make room for lower ids, so that ids added in decreasing order do not shift the vector every time
+            gpa_uint64 lowerSlots = std::min(std::min(firstId, static_cast<gpa_uint64>(m_denseObjects.size() / 2)), maxSlots - (endId - firstId));
+            firstId -= lowerSlots;
+
+            m_denseObjects.insert(m_denseObjects.begin(), static_cast<size_t>(m_firstDenseId - firstId), nullptr);
+            m_firstDenseId = static_cast<gpa_uint32>(firstId);
+        }
+
+        if (endId - firstId > m_denseObjects.size())
+        {
+            m_denseObjects.resize(static_cast<size_t>(endId - firstId), nullptr);
+        }
+
+        return true;
+    }
+
+    /// Moves the objects from the dense vector to the hash map
+    void ConvertToSparse()
+    {
+        m_sparseObjects.reserve(m_count + 1);
+
+        for (size_t slot = 0; slot < m_denseObjects.size(); ++slot)
+        {
+            if (nullptr != m_denseObjects[slot])
+            {
+                m_sparseObjects.insert(std::make_pair(m_firstDenseId + static_cast<gpa_uint32>(slot), m_denseObjects[slot]));
+            }
+        }
+
+        std::vector<T*>().swap(m_denseObjects);
+        m_isDense = false;
+    }
+
+    bool            m_isDense;        ///< flag indicating whether the objects are stored in the dense vector
+    gpa_uint32      m_firstDenseId;   ///< sample id of the first slot of the dense vector
+    gpa_uint32      m_reservedSlots;  ///< number of slots the dense vector may hold regardless of the number of objects (see Reserve and Reset)
+    size_t          m_count;          ///< number of objects in the index
+    std::vector<T*> m_denseObjects;   ///< objects indexed by sample id relative to m_firstDenseId, null for unused ids
+    SparseObjects   m_sparseObjects;  ///< objects indexed by sample id, once the ids are too sparse for the dense vector
+};
+
+#endif  // _GPA_SAMPLE_INDEX_H_
@@ -7,6 +7,7 @@
 
 // std
 #include <list>
+#include <map>
 #include <chrono>
 #include <thread>
 #include <algorithm>
@@ -18,19 +19,27 @@
 #include "gpa_pass.h"
 #include "gpu_perf_api_types.h"
 #include "gpa_context_counter_mediator.h"
+#include "gpa_counter_statistics.h"
 #include "gpa_split_counters_interfaces.h"
+#include "utility.h"
 
 // TODO: these are placeholder values (rough estimates) for right now. We should replace with reasonable values after testing
 static const gpa_uint32 DEFAULT_SPM_INTERVAL     = 4096;              ///< default SPM sampling interval (4096 clock cycles)
 static const gpa_uint64 DEFAULT_SPM_MEMORY_LIMIT = 16 * 1024 * 1024;  ///< default SPM memory limit size (16 MB)
 static const gpa_uint64 DEFAULT_SQTT_MEMORY_LIMIT =
     80 * 1024 * 1024;  ///< default SQTT memory limit size (80 MB) -- will likely need to be larger (512MB) if instruction-level trace is performed
+static const gpa_uint64 SQTT_HOST_MEMORY_LIMIT = 16 * 1024 * 1024;  ///< host memory holding the SQTT data not yet written to the trace file (16 MB)
+
+const gpa_uint32 GPASession::NO_EVALUATOR_OUTPUT;
 
 GPASession::GPASession(IGPAContext* pParentContext, GPA_Session_Sample_Type sampleType)
     : m_state(GPA_SESSION_STATE_NOT_STARTED)
     , m_pParentContext(pParentContext)
+    , m_pCounterAccessor(GPAContextCounterMediator::Instance()->GetCounterAccessor(pParentContext))
     , m_maxPassIndex(0u)
     , m_sampleType(sampleType)
+    , m_hasMaxSampleIdHint(false)
+    , m_maxSampleIdHint(0u)
     , m_spmInterval(DEFAULT_SPM_INTERVAL)
     , m_spmMemoryLimit(DEFAULT_SPM_MEMORY_LIMIT)
     , m_sqttInstructionMask(GPA_SQTT_INSTRUCTION_TYPE_NONE)
@@ -38,6 +47,10 @@ GPASession::GPASession(IGPAContext* pParentContext, GPA_Session_Sample_Type samp
     , m_sqttMemoryLimit(DEFAULT_SQTT_MEMORY_LIMIT)
     , m_passRequired(0u)
     , m_counterSetChanged(false)
+    , m_isPassPlanRetained(false)
+    , m_pSpecializedEquations(GPAContextCounterMediator::Instance()->GetSpecializedCounterEquations(pParentContext))
+    , m_isEvaluatorValid(false)
+    , m_trackedMemory(GPA_MEMORY_CATEGORY_SESSION, sizeof(GPASession))
 {
     TRACE_PRIVATE_FUNCTION(GPASession::CONSTRUCTOR);
 }
@@ -49,19 +62,7 @@ GPASession::~GPASession()
     std::lock_guard<std::mutex> lockResources(m_gpaSessionMutex);
 
     // clean up the passes
-    for (auto passIter = m_passes.begin(); passIter != m_passes.end(); ++passIter)
-    {
-        const GPACommandLists passCmdList = (*passIter)->GetCmdList();
-
-        for (auto cmdListIter = passCmdList.cbegin(); cmdListIter != passCmdList.cend(); ++cmdListIter)
-        {
-            GPAUniqueObjectManager::Instance()->DeleteObject(*cmdListIter);
-        }
-
-        delete *passIter;
-    }
-
-    m_passes.clear();
+    ReleasePasses_NotThreadSafe();
 }
 
 GPAObjectType GPASession::ObjectType() const
@@ -123,7 +124,8 @@ GPA_Status GPASession::EnableCounter(gpa_uint32 index)
 
     std::lock_guard<std::mutex> lock(m_sessionCountersMutex);
     m_sessionCounters.push_back(index);
-    m_counterSetChanged = true;
+    m_counterSetChanged  = true;
+    m_isPassPlanRetained = false;
     return GPA_STATUS_OK;
 }
 
@@ -149,7 +151,8 @@ GPA_Status GPASession::DisableCounter(gpa_uint32 index)
 
     std::lock_guard<std::mutex> lock(m_sessionCountersMutex);
     m_sessionCounters.erase(counterIter);
-    m_counterSetChanged = true;
+    m_counterSetChanged  = true;
+    m_isPassPlanRetained = false;
     return GPA_STATUS_OK;
 }
 
@@ -161,7 +164,8 @@ GPA_Status GPASession::DisableAllCounters()
     }
 
     m_sessionCounters.clear();
-    m_counterSetChanged = true;
+    m_counterSetChanged  = true;
+    m_isPassPlanRetained = false;
     return GPA_STATUS_OK;
 }
 
@@ -274,9 +278,18 @@ GPA_Status GPASession::Begin()
             status = GPA_STATUS_ERROR_NO_COUNTERS_ENABLED;
         }
 
-        // If so, we will then check how many passes are required and pre-create passes for the Session
-        if (GPA_STATUS_OK == status && GPAContextCounterMediator::Instance()->IsCounterSchedulingSupported(GetParentContext()))
+        // If the passes of the previous begin/end were retained by a reset, they are reused as-is.
+        // Otherwise, we will then check how many passes are required and pre-create passes for the Session
+        if (GPA_STATUS_OK == status && !m_isPassPlanRetained && GPAContextCounterMediator::Instance()->IsCounterSchedulingSupported(GetParentContext()))
         {
+            {
+                // release the passes of the previous counter set, if any
+                std::lock_guard<std::mutex> lockResources(m_gpaSessionMutex);
+                ReleasePasses_NotThreadSafe();
+                m_passCountersMap.clear();
+                m_counterResultLocations.clear();
+            }
+
             status = GPAContextCounterMediator::Instance()->ScheduleCounters(GetParentContext(), this, m_sessionCounters);
 
             if (GPA_STATUS_OK == status)
@@ -307,6 +320,11 @@ GPA_Status GPASession::Begin()
 
                         if (nullptr != pCurrentPass)
                         {
+                            if (m_hasMaxSampleIdHint)
+                            {
+                                pCurrentPass->ReserveSamples(m_maxSampleIdHint);
+                            }
+
                             m_passes.push_back(pCurrentPass);
                         }
                         else
@@ -336,11 +354,44 @@ GPA_Status GPASession::Begin()
         }
     }
 
+    // the results of streaming counters are read while the session runs, so they are resolved when it begins rather than when it ends
+    if (GPA_STATUS_OK == status && IsStreamingCounterSession())
+    {
+        std::lock_guard<std::mutex> lockStreaming(m_streamingCounterMutex);
+        bool                        isStreamingReady = m_isPassPlanRetained;
+
+        if (!isStreamingReady && GatherCounterResultLocations())
+        {
+            BuildDerivedCounterEvaluator();
+            isStreamingReady = BuildStreamingCounterLayout();
+        }
+
+        if (!isStreamingReady || !m_streamingCounterStream.Initialize(m_passes[0]->GetEnabledCounterCount(), m_spmMemoryLimit))
+        {
+            GPA_LogError("Unable to prepare the streaming counter records of the session.");
+            status = GPA_STATUS_ERROR_FAILED;
+        }
+    }
+
+    // the SQTT data is written to a trace file as it is collected, so it does not need to fit in host memory however large the GPU buffer is
+    if (GPA_STATUS_OK == status && IsSQTTSession())
+    {
+        std::string traceFilePath;
+
+        if (!GPAUtil::CreateTempFile("GPA-SQTT-", ".gpasqtt", traceFilePath) ||
+            !m_sqttTraceStore.Initialize(traceFilePath, std::min(m_sqttMemoryLimit, SQTT_HOST_MEMORY_LIMIT)))
+        {
+            GPA_LogError("Unable to prepare the SQTT data of the session.");
+            status = GPA_STATUS_ERROR_FAILED;
+        }
+    }
+
     // if we can successfully start the session, then mark the session as started
     if (GPA_STATUS_OK == status)
     {
         std::lock_guard<std::mutex> lockResources(m_gpaSessionMutex);
         m_state = GPA_SESSION_STATE_STARTED;
+        UpdateTrackedMemory_NotThreadSafe();
     }
 
     return status;
@@ -380,19 +431,63 @@ GPA_Status GPASession::End()
         status = GPA_STATUS_ERROR_SESSION_NOT_STARTED;
     }
 
-    if (GPA_STATUS_OK == status)
+    // the counter result locations and the derived counter evaluator of retained passes are still valid
+    if (GPA_STATUS_OK == status && !m_isPassPlanRetained)
     {
-        if (GPA_STATUS_OK == status && !GatherCounterResultLocations())
+        // those of streaming sessions were resolved when the session began, and may be in use by the consumer of the records
+        if (!IsStreamingCounterSession())
         {
-            status = GPA_STATUS_ERROR_FAILED;
+            if (GPA_STATUS_OK == status && !GatherCounterResultLocations())
+            {
+                status = GPA_STATUS_ERROR_FAILED;
+            }
+            else
+            {
+                BuildDerivedCounterEvaluator();
+            }
         }
 
         status = GPAContextCounterMediator::Instance()->UnscheduleCounters(GetParentContext(), this, m_sessionCounters);
+
+        std::lock_guard<std::mutex> lockResources(m_gpaSessionMutex);
+        UpdateTrackedMemory_NotThreadSafe();
     }
 
     return status;
 }
 
+GPA_Status GPASession::Reset()
+{
+    std::lock_guard<std::mutex> lockResources(m_gpaSessionMutex);
+
+    if (GPA_SESSION_STATE_STARTED == m_state)
+    {
+        GPA_LogError("Session is still running. End the session before resetting it.");
+        return GPA_STATUS_ERROR_SESSION_NOT_ENDED;
+    }
+
+    if (GPA_SESSION_STATE_NOT_STARTED != m_state)
+    {
+        for (auto passIter = m_passes.begin(); passIter != m_passes.end(); ++passIter)
+        {
+            const GPACommandLists passCmdList = (*passIter)->GetCmdList();
+
+            for (auto cmdListIter = passCmdList.cbegin(); cmdListIter != passCmdList.cend(); ++cmdListIter)
+            {
+                GPAUniqueObjectManager::Instance()->DeleteObject(*cmdListIter);
+            }
+
+            (*passIter)->ResetSamples();
+        }
+
+        m_maxPassIndex       = 0u;
+        m_isPassPlanRetained = !m_passes.empty();
+        m_state              = GPA_SESSION_STATE_NOT_STARTED;
+    }
+
+    return GPA_STATUS_OK;
+}
+
 GPA_CommandListId GPASession::CreateCommandList(gpa_uint32 passIndex, void* pCmd, GPA_Command_List_Type cmdType)
 {
     GPA_CommandListId pRetCmdId = nullptr;
@@ -589,16 +684,17 @@ size_t GPASession::GetSampleResultSizeInBytes(gpa_uint32 sampleId) const
     {
         GPA_LogError("Unable to GetSampleResultSizeInBytes, counter scheduler is invalid.");
     }
-    else if (GPA_SESSION_SAMPLE_TYPE_DISCRETE_COUNTER == m_sampleType)
+    else if (GPA_SESSION_SAMPLE_TYPE_DISCRETE_COUNTER == m_sampleType || IsStreamingCounterSession())
     {
+        // the results of a bucket of streaming counter records have the same layout as the results of a sample
         gpa_uint32 enableCounters = 0u;
         GetNumEnabledCounters(&enableCounters);
         sizeInBytes = sizeof(gpa_uint64) * enableCounters;
     }
     else
     {
+        // the SQTT data is not part of the sample results, it is read with GetSQTTChunk
         UNREFERENCED_PARAMETER(sampleId);
-        // TODO: retrieve data size for GPA_SAMPLE_TYPE_STREAMING_COUNTER and/or GPA_SAMPLE_TYPE_SQTT
     }
 
     return sizeInBytes;
@@ -644,272 +740,1050 @@ GPA_Status GPASession::GetSampleResult(gpa_uint32 sampleId, size_t sampleResultS
     // For each counter
     // Get the internal counter result locations that are needed
     // get the necessary results from each pass
-    // plug them into the counter equation (where does this come from?)
+    // plug them into the counter equation
     // put the result in the appropriate spot in the supplied buffer.
 
-    gpa_uint32 numEnabled = 0;
-    GetNumEnabledCounters(&numEnabled);
+    CounterResultScratch scratch;
+    return ComputeSampleResults(sampleId, scratch, reinterpret_cast<gpa_uint64*>(pCounterSampleResults), 1);
+}
 
-    GPA_Status status = GPA_STATUS_OK;
+GPA_Status GPASession::GetPartialSampleResult(gpa_uint32 sampleId,
+                                              size_t     sampleResultSizeInBytes,
+                                              void*      pCounterSampleResults,
+                                              gpa_uint8* pCounterResultAvailable)
+{
+    TRACE_PRIVATE_FUNCTION(GPASession::GetPartialSampleResult);
 
-    for (gpa_uint32 counterIndexIter = 0; counterIndexIter < numEnabled; counterIndexIter++)
+    if (sampleResultSizeInBytes < GetSampleResultSizeInBytes(sampleId))
     {
-        gpa_uint32 exposedCounterIndex;
+        GPA_LogError("The value of sampleResultSizeInBytes indicates that the buffer is too small to contain the results.");
+        return GPA_STATUS_ERROR_READING_SAMPLE_RESULT;
+    }
 
-        if (GPA_STATUS_OK != GetEnabledIndex(counterIndexIter, &exposedCounterIndex))
-        {
-            GPA_LogError("Invalid counter found while identifying enabled counter.");
-            return GPA_STATUS_ERROR_INDEX_OUT_OF_RANGE;
-        }
+    if (nullptr == pCounterSampleResults || nullptr == pCounterResultAvailable)
+    {
+        GPA_LogError("pCounterSampleResults or pCounterResultAvailable is NULL in GPASession::GetPartialSampleResult.");
+        return GPA_STATUS_ERROR_NULL_POINTER;
+    }
 
-        std::vector<const gpa_uint64*> results;
-        std::vector<GPA_Data_Type>     types;
-        std::vector<gpa_uint32>        internalCountersRequired =
-            GPAContextCounterMediator::Instance()->GetCounterAccessor(GetParentContext())->GetInternalCountersRequired(exposedCounterIndex);
-        CounterResultLocationMap resultLocations = m_counterResultLocations[exposedCounterIndex];
+    GPASample* pFirstPassSample = m_passes[0]->GetSampleById(sampleId);
 
-        gpa_uint32       sourceLocalIndex = 0;
-        GPACounterSource source           = GPACounterSource::UNKNOWN;
+    if (nullptr != pFirstPassSample && pFirstPassSample->IsSecondary() && !pFirstPassSample->IsCopied())
+    {
+        GPA_LogError("Results cannot be queried from secondary samples.");
+        return GPA_STATUS_ERROR_SAMPLE_IN_SECONDARY_COMMAND_LIST;
+    }
 
-        if (!m_pParentContext->GetCounterSourceLocalIndex(exposedCounterIndex, &source, &sourceLocalIndex))
-        {
-            GPA_LogError("Invalid counter index found while identifying counter source.");
-            return GPA_STATUS_ERROR_INDEX_OUT_OF_RANGE;
-        }
+    // Determine which passes already have their results available, without waiting on the others.
+    // The session state changes under the same lock, so that other threads never see it ahead of the collected results.
+    std::vector<bool> isPassCollected(m_passes.size(), false);
 
-        IGPACounterAccessor* pCounterAccessor = GPAContextCounterMediator::Instance()->GetCounterAccessor(GetParentContext());
+    {
+        std::lock_guard<std::mutex> lockResources(m_gpaSessionMutex);
+        bool                        areAllPassesCollected = true;
 
-        switch (source)
+        for (PassIndex passIndex = 0; passIndex < m_passes.size(); ++passIndex)
         {
-        case GPACounterSource::PUBLIC:
-        {
-            size_t requiredCount = internalCountersRequired.size();
-            results.reserve(requiredCount);
-            types.reserve(requiredCount);
-
-            std::vector<gpa_uint64> allResults(requiredCount);
-
-            unsigned int resultIndex = 0;
-
-            for (std::vector<gpa_uint32>::iterator requiredCounterIter = internalCountersRequired.begin();
-                 requiredCounterIter != internalCountersRequired.end();
-                 ++requiredCounterIter)
-            {
-                gpa_uint64* pResultBuffer = &(allResults.data()[resultIndex]);
-                ++resultIndex;
-                results.push_back(pResultBuffer);
-                GPA_Data_Type type = GPA_DATA_TYPE_UINT64;  // all hardware counters are UINT64
-                types.push_back(type);
+            isPassCollected[passIndex] = TryCollectPassResults_NotThreadSafe(passIndex);
+            areAllPassesCollected &= isPassCollected[passIndex];
+        }
 
-                std::map<unsigned int, GPA_CounterResultLocation>::iterator resultLocationIter = resultLocations.find(*requiredCounterIter);
+        if (areAllPassesCollected)
+        {
+            m_state = GPA_SESSION_STATE_RESULT_COLLECTED;
+        }
+    }
 
-                if (resultLocationIter == resultLocations.end())
-                {
-                    GPA_LogError("Could not find required counter among the results.");
-                    return GPA_STATUS_ERROR_READING_SAMPLE_RESULT;
-                }
+    gpa_uint32 numEnabled = 0;
+    GetNumEnabledCounters(&numEnabled);
 
-                status = m_passes[resultLocationIter->second.m_pass]->GetResult(sampleId, *requiredCounterIter, pResultBuffer);
+    GPA_Status           status              = GPA_STATUS_OK;
+    bool                 areAllCountersReady = true;
+    CounterResultInfo    counterResultInfo;
+    CounterResultScratch scratch;
 
-                if (GPA_STATUS_OK != status)
-                {
-                    return status;
-                }
+    for (gpa_uint32 counterIndexIter = 0; counterIndexIter < numEnabled && GPA_STATUS_OK == status; counterIndexIter++)
+    {
+        pCounterResultAvailable[counterIndexIter] = 0;
 
-#ifdef AMDT_INTERNAL
-                gpa_uint32  numPublicCounters = pCounterAccessor->GetNumPublicCounters();
-                const char* pInternalName     = pCounterAccessor->GetCounterName(numPublicCounters + *requiredCounterIter);
-                const char* pPublicName       = pCounterAccessor->GetCounterName(*requiredCounterIter);
+        status = GetCounterResultInfo(counterIndexIter, counterResultInfo);
 
-                std::stringstream message;
-                message << "Sample " << sampleId << ", pubCounter '" << pPublicName << "', iCounter: '" << pInternalName << "', [" << *requiredCounterIter
-                        << "] = ";
+        if (GPA_STATUS_OK == status)
+        {
+            bool isCounterReady = true;
 
-                if (type == GPA_DATA_TYPE_UINT64)
-                {
-                    gpa_uint64* pValue = pResultBuffer;
+            for (auto passIter = counterResultInfo.m_requiredCounterPasses.cbegin(); passIter != counterResultInfo.m_requiredCounterPasses.cend(); ++passIter)
+            {
+                isCounterReady &= isPassCollected[*passIter];
+            }
 
-                    message << *pValue;
-                }
-                else if (type == GPA_DATA_TYPE_FLOAT64)
-                {
-                    gpa_float64* pValue = reinterpret_cast<gpa_float64*>(pResultBuffer);
+            if (isCounterReady)
+            {
+                status = ComputeCounterResult(counterResultInfo, sampleId, scratch, reinterpret_cast<gpa_uint64*>(pCounterSampleResults) + counterIndexIter);
 
-                    message << *pValue;
-                }
-                else
+                if (GPA_STATUS_OK == status)
                 {
-                    // case not covered
-                    assert(false);
+                    pCounterResultAvailable[counterIndexIter] = 1;
                 }
-
-                message << ".";
-                GPA_LogDebugCounterDefs(message.str().c_str());
-#endif
-            }
-
-            GPA_Data_Type currentCounterType = pCounterAccessor->GetCounterDataType(exposedCounterIndex);
-
-            // compute using supplied function. value order is as defined when registered
-            if (GPA_DATA_TYPE_FLOAT64 == currentCounterType)
-            {
-                status = pCounterAccessor->ComputePublicCounterValue(
-                    sourceLocalIndex, results, types, reinterpret_cast<gpa_float64*>(pCounterSampleResults) + counterIndexIter, m_pParentContext->GetHwInfo());
-            }
-            else if (GPA_DATA_TYPE_UINT64 == currentCounterType)
-            {
-                status = pCounterAccessor->ComputePublicCounterValue(
-                    sourceLocalIndex, results, types, reinterpret_cast<gpa_uint64*>(pCounterSampleResults) + counterIndexIter, m_pParentContext->GetHwInfo());
             }
             else
             {
-                assert(0);
-                GPA_LogError("Unknown counter sample result data type.");
-                status = GPA_STATUS_ERROR_INVALID_DATATYPE;
+                areAllCountersReady = false;
             }
-
-            break;
         }
+    }
 
-        case GPACounterSource::HARDWARE:
-        {
-            gpa_uint64* pUint64Results = reinterpret_cast<gpa_uint64*>(pCounterSampleResults) + counterIndexIter;
-            assert(internalCountersRequired.size() == 1);  // Hardware counter will always have one internal counter required
-            gpa_uint16 counterResultPass = resultLocations[internalCountersRequired.at(0)].m_pass;
-            status                       = m_passes[counterResultPass]->GetResult(sampleId, internalCountersRequired[0], pUint64Results);
-            break;
-        }
-
-        case GPACounterSource::SOFTWARE:
-        {
-            gpa_uint64 buf = 0;
-
-            auto       iter              = resultLocations.begin();
-            gpa_uint16 counterResultPass = iter->second.m_pass;
-            status                       = m_passes[counterResultPass]->GetResult(sampleId, internalCountersRequired[0], &buf);
-
-            gpa_uint64* pUint64Results = reinterpret_cast<gpa_uint64*>(pCounterSampleResults) + counterIndexIter;
+    if (GPA_STATUS_OK == status && !areAllCountersReady)
+    {
+        status = GPA_STATUS_RESULT_NOT_READY;
+    }
 
-            // compute using supplied function. value order is as defined when registered
-            pCounterAccessor->ComputeSWCounterValue(sourceLocalIndex, buf, pUint64Results, m_pParentContext->GetHwInfo());
-            break;
-        }
+    return status;
+}
 
-        case GPACounterSource::UNKNOWN:
-            // Handled above
-            break;
+size_t GPASession::GetSessionResultsByCounterSizeInBytes() const
+{
+    size_t sizeInBytes = 0;
 
-        default:
-            status = GPA_STATUS_ERROR_FAILED;
-            GPA_LogError("Unknown counter source type.");
-            assert(0);
-            break;
-        }
+    if (!GPAContextCounterMediator::Instance()->IsCounterSchedulingSupported(GetParentContext()))
+    {
+        GPA_LogError("Unable to GetSessionResultsByCounterSizeInBytes, counter scheduler is invalid.");
+    }
+    else if (GPA_SESSION_SAMPLE_TYPE_DISCRETE_COUNTER == m_sampleType)
+    {
+        gpa_uint32                  enableCounters = 0u;
+        std::vector<ClientSampleId> sampleIds;
+        GetNumEnabledCounters(&enableCounters);
 
-        if (status != GPA_STATUS_OK)
+        if (GetExportedSampleIds(sampleIds))
         {
-            break;
+            sizeInBytes = sizeof(gpa_uint64) * enableCounters * sampleIds.size();
         }
     }
 
-    return status;
-}
-
-GPA_Session_Sample_Type GPASession::GetSampleType() const
-{
-    return m_sampleType;
-}
-
-gpa_uint32 GPASession::GetSPMInterval() const
-{
-    return m_spmInterval;
+    return sizeInBytes;
 }
 
-void GPASession::SetSPMInterval(gpa_uint32 interval)
+GPA_Status GPASession::GetSessionResultsByCounter(size_t resultsSizeInBytes, void* pCounterResults)
 {
-    m_spmInterval = interval;
-}
+    TRACE_PRIVATE_FUNCTION(GPASession::GetSessionResultsByCounter);
 
-gpa_uint64 GPASession::GetSPMMemoryLimit() const
-{
-    return m_spmMemoryLimit;
-}
+    if (GPA_SESSION_SAMPLE_TYPE_DISCRETE_COUNTER != m_sampleType)
+    {
+        GPA_LogError("Results by counter are only available for discrete counter sessions.");
+        return GPA_STATUS_ERROR_INCOMPATIBLE_SAMPLE_TYPES;
+    }
 
-void GPASession::SetSPMMemoryLimit(gpa_uint64 memoryLimit)
-{
-    m_spmMemoryLimit = memoryLimit;
-}
+    if (resultsSizeInBytes < GetSessionResultsByCounterSizeInBytes())
+    {
+        GPA_LogError("The value of resultsSizeInBytes indicates that the buffer is too small to contain the results.");
+        return GPA_STATUS_ERROR_READING_SAMPLE_RESULT;
+    }
 
-GPA_SQTTInstructionFlags GPASession::GetSQTTInstructionMask() const
-{
-    return m_sqttInstructionMask;
-}
+    if (nullptr == pCounterResults)
+    {
+        GPA_LogError("pCounterResults is NULL in GPASession::GetSessionResultsByCounter.");
+        return GPA_STATUS_ERROR_NULL_POINTER;
+    }
 
-void GPASession::SetSQTTInstructionMask(GPA_SQTTInstructionFlags sqttInstructionMask)
-{
-    m_sqttInstructionMask = sqttInstructionMask;
-}
+    const uint32_t timeout = 5 * 1000;  // 5 second timeout
 
-gpa_uint32 GPASession::GetSQTTComputeUnitId() const
-{
-    return m_sqttComputeUnitId;
-}
+    if (!Flush(timeout))
+    {
+        GPA_LogError("Failed to retrieve sample data due to timeout.");
+        return GPA_STATUS_ERROR_TIMEOUT;
+    }
 
-void GPASession::SetSQTTComputeUnitId(gpa_uint32 sqttComputeUnitId)
-{
-    m_sqttComputeUnitId = sqttComputeUnitId;
-}
+    // Resolve the client sample ids once
+    std::vector<ClientSampleId> sampleIds;
 
-gpa_uint64 GPASession::GetSQTTMemoryLimit() const
-{
-    return m_sqttMemoryLimit;
-}
+    if (!GetExportedSampleIds(sampleIds))
+    {
+        GPA_LogError("Unable to find a sample in the session.");
+        return GPA_STATUS_ERROR_SAMPLE_NOT_FOUND;
+    }
 
-void GPASession::SetSQTTMemoryLimit(gpa_uint64 memoryLimit)
-{
-    m_sqttMemoryLimit = memoryLimit;
-}
+    GPA_Status           status      = GPA_STATUS_OK;
+    CounterResultScratch scratch;
+    size_t               sampleCount = sampleIds.size();
 
-CounterList* GPASession::GetCountersForPass(PassIndex passIndex)
-{
-    if (m_passCountersMap.find(passIndex) == m_passCountersMap.end())
+    // Each sample fills one row of the column-major result table
+    for (size_t sampleIndex = 0; sampleIndex < sampleCount && GPA_STATUS_OK == status; ++sampleIndex)
     {
-        return nullptr;
+        status = ComputeSampleResults(sampleIds[sampleIndex], scratch, reinterpret_cast<gpa_uint64*>(pCounterResults) + sampleIndex, sampleCount);
     }
 
-    return &m_passCountersMap[passIndex];
+    return status;
 }
 
-bool GPASession::Flush(uint32_t timeout)
+bool GPASession::GetExportedSampleIds(std::vector<ClientSampleId>& sampleIds) const
 {
-    TRACE_PRIVATE_FUNCTION(GPASession::Flush);
+    gpa_uint32 sampleCount = GetSampleCount();
 
-    bool retVal = true;
-
-    auto startTime = std::chrono::steady_clock::now();
+    sampleIds.clear();
+    sampleIds.reserve(sampleCount);
 
-    // block until the session is complete or the timeout (if any) is reached
-    while (!IsResultReady())
+    for (gpa_uint32 sampleIndex = 0; sampleIndex < sampleCount; ++sampleIndex)
     {
-        if (timeout != GPA_TIMEOUT_INFINITE)
+        ClientSampleId sampleId = 0;
+
+        if (!GetSampleIdByIndex(sampleIndex, sampleId))
         {
-            auto currentTime = std::chrono::steady_clock::now();
-            auto duration    = currentTime - startTime;
+            return false;
+        }
 
-            if (std::chrono::duration_cast<std::chrono::milliseconds>(duration).count() > timeout)
-            {
-                GPA_LogError("GPA session completion timeout occurred.");
-                retVal = false;
-                break;
-            }
+        // NOTE: All the passes have the same sample ids, so pass 0 tells whether the sample is secondary and/or copied
+        GPASample* pFirstPassSample = m_passes[0]->GetSampleById(sampleId);
 
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        if (nullptr == pFirstPassSample || !pFirstPassSample->IsSecondary() || pFirstPassSample->IsCopied())
+        {
+            sampleIds.push_back(sampleId);
         }
+    }
 
-        UpdateResults();
+    return true;
+}
+
+GPA_Status GPASession::AccumulateCounterStatistics(GPACounterStatistics* pStatistics)
+{
+    TRACE_PRIVATE_FUNCTION(GPASession::AccumulateCounterStatistics);
+
+    if (GPA_SESSION_SAMPLE_TYPE_DISCRETE_COUNTER != m_sampleType)
+    {
+        GPA_LogError("Counter statistics are only available for discrete counter sessions.");
+        return GPA_STATUS_ERROR_INCOMPATIBLE_SAMPLE_TYPES;
     }
 
-    return retVal;
+    if (nullptr == pStatistics)
+    {
+        GPA_LogError("pStatistics is NULL in GPASession::AccumulateCounterStatistics.");
+        return GPA_STATUS_ERROR_NULL_POINTER;
+    }
+
+    const uint32_t timeout = 5 * 1000;  // 5 second timeout
+
+    if (!Flush(timeout))
+    {
+        GPA_LogError("Failed to retrieve sample data due to timeout.");
+        return GPA_STATUS_ERROR_TIMEOUT;
+    }
+
+    gpa_uint32 numEnabled = 0;
+    GetNumEnabledCounters(&numEnabled);
+
+    std::vector<gpa_uint32>    counterIndices(numEnabled);
+    std::vector<GPA_Data_Type> dataTypes(numEnabled);
+
+    for (gpa_uint32 enabledIndex = 0; enabledIndex < numEnabled; ++enabledIndex)
+    {
+        CounterResultInfo counterResultInfo;
+        GPA_Status        status = GetCounterResultInfo(enabledIndex, counterResultInfo);
+
+        if (GPA_STATUS_OK != status)
+        {
+            return status;
+        }
+
+        counterIndices[enabledIndex] = counterResultInfo.m_exposedCounterIndex;
+        dataTypes[enabledIndex]      = counterResultInfo.m_dataType;
+    }
+
+    // The results are computed into a buffer of a few samples, which is folded into the statistics whenever it is full
+    const gpa_uint32 batchSize   = 256;
+    gpa_uint32       sampleCount = GetSampleCount();
+    gpa_uint32       numBatched  = 0;
+
+    std::vector<gpa_uint64> batchResults(static_cast<size_t>(std::min(batchSize, sampleCount)) * numEnabled);
+    CounterResultScratch    scratch;
+
+    for (gpa_uint32 sampleIndex = 0; sampleIndex < sampleCount; ++sampleIndex)
+    {
+        ClientSampleId sampleId = 0;
+
+        if (!GetSampleIdByIndex(sampleIndex, sampleId))
+        {
+            GPA_LogError("Unable to find a sample in the session.");
+            return GPA_STATUS_ERROR_SAMPLE_NOT_FOUND;
+        }
+
+        // secondary samples which were not copied have no results of their own
+        GPASample* pFirstPassSample = m_passes[0]->GetSampleById(sampleId);
+
+        if (nullptr != pFirstPassSample && pFirstPassSample->IsSecondary() && !pFirstPassSample->IsCopied())
+        {
+            continue;
+        }
+
+        GPA_Status status = ComputeSampleResults(sampleId, scratch, batchResults.data() + static_cast<size_t>(numBatched) * numEnabled, 1);
+
+        if (GPA_STATUS_OK != status)
+        {
+            return status;
+        }
+
+        if (batchSize == ++numBatched)
+        {
+            pStatistics->AddSampleResults(counterIndices, dataTypes, batchResults.data(), numBatched);
+            numBatched = 0;
+        }
+    }
+
+    if (0 < numBatched)
+    {
+        pStatistics->AddSampleResults(counterIndices, dataTypes, batchResults.data(), numBatched);
+    }
+
+    return GPA_STATUS_OK;
+}
+
+GPA_Status GPASession::GetStreamingCounterResults(gpa_uint64                  bucketDuration,
+                                                  gpa_uint32                  maxBuckets,
+                                                  GPA_StreamingCounterBucket* pBuckets,
+                                                  void*                       pCounterResults,
+                                                  gpa_uint32*                 pNumBuckets)
+{
+    TRACE_PRIVATE_FUNCTION(GPASession::GetStreamingCounterResults);
+
+    if (!IsStreamingCounterSession())
+    {
+        GPA_LogError("Streaming counter results are only available for streaming counter sessions.");
+        return GPA_STATUS_ERROR_INCOMPATIBLE_SAMPLE_TYPES;
+    }
+
+    if (0 == bucketDuration)
+    {
+        GPA_LogError("The bucket duration must not be zero.");
+        return GPA_STATUS_ERROR_INVALID_PARAMETER;
+    }
+
+    if (nullptr == pBuckets || nullptr == pCounterResults || nullptr == pNumBuckets)
+    {
+        GPA_LogError("pBuckets, pCounterResults or pNumBuckets is NULL in GPASession::GetStreamingCounterResults.");
+        return GPA_STATUS_ERROR_NULL_POINTER;
+    }
+
+    if (GPA_SESSION_STATE_NOT_STARTED == m_state)
+    {
+        GPA_LogError("Session has not been started.");
+        return GPA_STATUS_ERROR_SESSION_NOT_STARTED;
+    }
+
+    std::lock_guard<std::mutex> lockStreaming(m_streamingCounterMutex);
+
+    gpa_uint32 numEnabled = 0;
+    GetNumEnabledCounters(&numEnabled);
+    m_streamingValueSums.resize(m_streamingCounterStream.GetNumValues());
+
+    gpa_uint64* pResults   = reinterpret_cast<gpa_uint64*>(pCounterResults);
+    gpa_uint32  numBuckets = 0;
+
+    while (numBuckets < maxBuckets && m_streamingCounterStream.ReadBucket(bucketDuration, pBuckets[numBuckets], m_streamingValueSums.data()))
+    {
+        ComputeStreamingCounterResults(m_streamingValueSums.data(), pResults + static_cast<size_t>(numBuckets) * numEnabled);
+        ++numBuckets;
+    }
+
+    *pNumBuckets = numBuckets;
+
+    return m_streamingCounterStream.IsDrained() ? GPA_STATUS_OK : GPA_STATUS_RESULT_NOT_READY;
+}
+
+GPA_Status GPASession::GetCounterResultInfo(gpa_uint32 enabledIndex, CounterResultInfo& counterResultInfo)
+{
+    gpa_uint32 exposedCounterIndex;
+
+    if (GPA_STATUS_OK != GetEnabledIndex(enabledIndex, &exposedCounterIndex))
+    {
+        GPA_LogError("Invalid counter found while identifying enabled counter.");
+        return GPA_STATUS_ERROR_INDEX_OUT_OF_RANGE;
+    }
+
+    counterResultInfo.m_exposedCounterIndex = exposedCounterIndex;
+    counterResultInfo.m_source              = GPACounterSource::UNKNOWN;
+    counterResultInfo.m_sourceLocalIndex    = 0;
+
+    if (!m_pParentContext->GetCounterSourceLocalIndex(exposedCounterIndex, &counterResultInfo.m_source, &counterResultInfo.m_sourceLocalIndex))
+    {
+        GPA_LogError("Invalid counter index found while identifying counter source.");
+        return GPA_STATUS_ERROR_INDEX_OUT_OF_RANGE;
+    }
+
+    IGPACounterAccessor* pCounterAccessor       = m_pCounterAccessor;
+    counterResultInfo.m_internalCountersRequired = pCounterAccessor->GetInternalCountersRequired(exposedCounterIndex);
+    counterResultInfo.m_dataType                 = pCounterAccessor->GetCounterDataType(exposedCounterIndex);
+    counterResultInfo.m_requiredCounterPasses.clear();
+
+    const CounterResultLocationMap& resultLocations = m_counterResultLocations[exposedCounterIndex];
+
+    if (GPACounterSource::SOFTWARE == counterResultInfo.m_source)
+    {
+        // software counters always use the pass of their only result location
+        if (resultLocations.empty() || counterResultInfo.m_internalCountersRequired.empty())
+        {
+            GPA_LogError("Could not find required counter among the results.");
+            return GPA_STATUS_ERROR_READING_SAMPLE_RESULT;
+        }
+
+        counterResultInfo.m_requiredCounterPasses.push_back(resultLocations.begin()->second.m_pass);
+        return GPA_STATUS_OK;
+    }
+
+    for (auto requiredCounterIter = counterResultInfo.m_internalCountersRequired.cbegin();
+         requiredCounterIter != counterResultInfo.m_internalCountersRequired.cend();
+         ++requiredCounterIter)
+    {
+        CounterResultLocationMap::const_iterator resultLocationIter = resultLocations.find(*requiredCounterIter);
+
+        if (resultLocationIter == resultLocations.end())
+        {
+            GPA_LogError("Could not find required counter among the results.");
+            return GPA_STATUS_ERROR_READING_SAMPLE_RESULT;
+        }
+
+        counterResultInfo.m_requiredCounterPasses.push_back(resultLocationIter->second.m_pass);
+    }
+
+    return GPA_STATUS_OK;
+}
+
+GPA_Status GPASession::ComputeCounterResult(const CounterResultInfo& counterResultInfo,
+                                            ClientSampleId           sampleId,
+                                            CounterResultScratch&    scratch,
+                                            void*                    pResult)
+{
+    GPA_Status status = GPA_STATUS_OK;
+
+    const std::vector<gpa_uint32>& internalCountersRequired = counterResultInfo.m_internalCountersRequired;
+    IGPACounterAccessor*           pCounterAccessor         = m_pCounterAccessor;
+
+    switch (counterResultInfo.m_source)
+    {
+    case GPACounterSource::PUBLIC:
+    {
+        size_t requiredCount = internalCountersRequired.size();
+        scratch.m_values.resize(requiredCount);
+        scratch.m_pointers.resize(requiredCount);
+        scratch.m_types.assign(requiredCount, GPA_DATA_TYPE_UINT64);  // all hardware counters are UINT64
+
+        for (size_t resultIndex = 0; resultIndex < requiredCount; ++resultIndex)
+        {
+            gpa_uint64* pResultBuffer        = &scratch.m_values[resultIndex];
+            scratch.m_pointers[resultIndex] = pResultBuffer;
+
+            status = m_passes[counterResultInfo.m_requiredCounterPasses[resultIndex]]->GetResult(sampleId, internalCountersRequired[resultIndex], pResultBuffer);
+
+            if (GPA_STATUS_OK != status)
+            {
+                return status;
+            }
+
+#ifdef AMDT_INTERNAL
+            gpa_uint32  numPublicCounters = pCounterAccessor->GetNumPublicCounters();
+            const char* pInternalName     = pCounterAccessor->GetCounterName(numPublicCounters + internalCountersRequired[resultIndex]);
+            const char* pPublicName       = pCounterAccessor->GetCounterName(internalCountersRequired[resultIndex]);
+
+            std::stringstream message;
+            message << "Sample " << sampleId << ", pubCounter '" << pPublicName << "', iCounter: '" << pInternalName << "', ["
+                    << internalCountersRequired[resultIndex] << "] = " << *pResultBuffer << ".";
+            GPA_LogDebugCounterDefs(message.str().c_str());
+#endif
+        }
+
+        // compute using supplied function. value order is as defined when registered
+        if (GPA_DATA_TYPE_FLOAT64 == counterResultInfo.m_dataType)
+        {
+            status = pCounterAccessor->ComputePublicCounterValue(counterResultInfo.m_sourceLocalIndex,
+                                                                 scratch.m_pointers,
+                                                                 scratch.m_types,
+                                                                 reinterpret_cast<gpa_float64*>(pResult),
+                                                                 m_pParentContext->GetHwInfo());
+        }
+        else if (GPA_DATA_TYPE_UINT64 == counterResultInfo.m_dataType)
+        {
+            status = pCounterAccessor->ComputePublicCounterValue(counterResultInfo.m_sourceLocalIndex,
+                                                                 scratch.m_pointers,
+                                                                 scratch.m_types,
+                                                                 reinterpret_cast<gpa_uint64*>(pResult),
+                                                                 m_pParentContext->GetHwInfo());
+        }
+        else
+        {
+            assert(0);
+            GPA_LogError("Unknown counter sample result data type.");
+            status = GPA_STATUS_ERROR_INVALID_DATATYPE;
+        }
+
+        break;
+    }
+
+    case GPACounterSource::HARDWARE:
+    {
+        assert(internalCountersRequired.size() == 1);  // Hardware counter will always have one internal counter required
+        status = m_passes[counterResultInfo.m_requiredCounterPasses[0]]->GetResult(sampleId, internalCountersRequired[0], reinterpret_cast<gpa_uint64*>(pResult));
+        break;
+    }
+
+    case GPACounterSource::SOFTWARE:
+    {
+        gpa_uint64 buf = 0;
+        status         = m_passes[counterResultInfo.m_requiredCounterPasses[0]]->GetResult(sampleId, internalCountersRequired[0], &buf);
+
+        // compute using supplied function. value order is as defined when registered
+        pCounterAccessor->ComputeSWCounterValue(counterResultInfo.m_sourceLocalIndex, buf, reinterpret_cast<gpa_uint64*>(pResult), m_pParentContext->GetHwInfo());
+        break;
+    }
+
+    case GPACounterSource::UNKNOWN:
+        // Handled in GetCounterResultInfo
+        break;
+
+    default:
+        status = GPA_STATUS_ERROR_FAILED;
+        GPA_LogError("Unknown counter source type.");
+        assert(0);
+        break;
+    }
+
+    return status;
+}
+
+void GPASession::BuildDerivedCounterEvaluator()
+{
+    TRACE_PRIVATE_FUNCTION(GPASession::BuildDerivedCounterEvaluator);
+
+    m_derivedCounterEvaluator.Clear();
+    m_evaluatorOutputIndices.clear();
+    m_evaluatorPassInputs.clear();
+    m_isEvaluatorValid = false;
+
+    IGPACounterAccessor* pCounterAccessor = m_pCounterAccessor;
+
+    if (nullptr == pCounterAccessor)
+    {
+        return;
+    }
+
+    gpa_uint32 numEnabled = 0;
+    GetNumEnabledCounters(&numEnabled);
+
+    std::map<gpa_uint32, PassIndex> internalCounterPasses;
+    CounterResultInfo               counterResultInfo;
+
+    for (gpa_uint32 counterIndexIter = 0; counterIndexIter < numEnabled; counterIndexIter++)
+    {
+        if (GPA_STATUS_OK != GetCounterResultInfo(counterIndexIter, counterResultInfo))
+        {
+            return;
+        }
+
+        if (GPACounterSource::PUBLIC != counterResultInfo.m_source)
+        {
+            m_evaluatorOutputIndices.push_back(NO_EVALUATOR_OUTPUT);
+            continue;
+        }
+
+        // An internal counter is a single input of the graph, so every counter must read it from the same pass
+        for (size_t requiredIndex = 0; requiredIndex < counterResultInfo.m_internalCountersRequired.size(); ++requiredIndex)
+        {
+            PassIndex pass     = counterResultInfo.m_requiredCounterPasses[requiredIndex];
+            auto      passIter = internalCounterPasses.insert(std::make_pair(counterResultInfo.m_internalCountersRequired[requiredIndex], pass)).first;
+
+            if (passIter->second != pass)
+            {
+                return;
+            }
+        }
+
+        const GPA_DerivedCounter* pPublicCounter = pCounterAccessor->GetPublicCounter(counterResultInfo.m_sourceLocalIndex);
+        gpa_uint32                outputIndex    = 0;
+
+        if (nullptr == pPublicCounter)
+        {
+            return;
+        }
+
+        // the equation with the device constants of the context folded in, if it could be specialized
+        const char* pExpression = nullptr;
+
+        if (nullptr != m_pSpecializedEquations)
+        {
+            pExpression = m_pSpecializedEquations->GetEquation(counterResultInfo.m_sourceLocalIndex);
+        }
+
+        if (nullptr == pExpression)
+        {
+            pExpression = pPublicCounter->m_pComputeExpression;
+        }
+
+        if (GPA_STATUS_OK != m_derivedCounterEvaluator.AddCounter(
+                                 pExpression, counterResultInfo.m_internalCountersRequired, counterResultInfo.m_dataType, m_pParentContext->GetHwInfo(), outputIndex))
+        {
+            return;
+        }
+
+        m_evaluatorOutputIndices.push_back(outputIndex);
+    }
+
+    const std::vector<gpa_uint32>& inputs = m_derivedCounterEvaluator.GetInputs();
+
+    std::map<PassIndex, size_t> passInputsIndices;
+
+    for (size_t inputIndex = 0; inputIndex < inputs.size(); ++inputIndex)
+    {
+        PassIndex pass             = internalCounterPasses[inputs[inputIndex]];
+        auto      passInputsInsert = passInputsIndices.insert(std::make_pair(pass, m_evaluatorPassInputs.size()));
+
+        if (passInputsInsert.second)
+        {
+            EvaluatorPassInputs passInputs;
+            passInputs.m_pass = pass;
+            m_evaluatorPassInputs.push_back(passInputs);
+        }
+
+        EvaluatorPassInputs& passInputs = m_evaluatorPassInputs[passInputsInsert.first->second];
+        passInputs.m_internalCounters.push_back(inputs[inputIndex]);
+        passInputs.m_inputIndices.push_back(inputIndex);
+    }
+
+    m_isEvaluatorValid = true;
+}
+
+GPA_Status GPASession::ComputeSampleResults(ClientSampleId sampleId, CounterResultScratch& scratch, gpa_uint64* pResults, size_t resultStride)
+{
+    // For each counter
+    // Get the internal counter result locations that are needed
+    // get the necessary results from each pass
+    // plug them into the counter equation
+    // put the result in the appropriate spot in the supplied buffer.
+
+    gpa_uint32 numEnabled = 0;
+    GetNumEnabledCounters(&numEnabled);
+
+    GPA_Status        status = GPA_STATUS_OK;
+    CounterResultInfo counterResultInfo;
+
+    if (m_isEvaluatorValid && m_evaluatorOutputIndices.size() == numEnabled)
+    {
+        // Each internal counter is read once and each shared sub-expression is computed once for all public counters
+        const std::vector<gpa_uint32>& inputs = m_derivedCounterEvaluator.GetInputs();
+        scratch.m_inputValues.resize(inputs.size());
+        scratch.m_outputValues.resize(m_derivedCounterEvaluator.GetNumOutputs());
+
+        // the inputs of each pass are read under a single acquisition of the pass' samples lock
+        for (auto passInputsIter = m_evaluatorPassInputs.cbegin(); passInputsIter != m_evaluatorPassInputs.cend() && GPA_STATUS_OK == status; ++passInputsIter)
+        {
+            size_t passInputCount = passInputsIter->m_internalCounters.size();
+            scratch.m_passValues.resize(passInputCount);
+
+            status = m_passes[passInputsIter->m_pass]->GetResults(sampleId, passInputCount, passInputsIter->m_internalCounters.data(), scratch.m_passValues.data());
+
+            for (size_t passInputIndex = 0; passInputIndex < passInputCount; ++passInputIndex)
+            {
+                scratch.m_inputValues[passInputsIter->m_inputIndices[passInputIndex]] = scratch.m_passValues[passInputIndex];
+            }
+        }
+
+        if (GPA_STATUS_OK != status)
+        {
+            return status;
+        }
+
+        m_derivedCounterEvaluator.Evaluate(scratch.m_inputValues.data(), scratch.m_nodeValues, scratch.m_outputValues.data());
+
+        for (gpa_uint32 counterIndexIter = 0; counterIndexIter < numEnabled && GPA_STATUS_OK == status; counterIndexIter++)
+        {
+            gpa_uint64* pResult     = pResults + counterIndexIter * resultStride;
+            gpa_uint32  outputIndex = m_evaluatorOutputIndices[counterIndexIter];
+
+            if (NO_EVALUATOR_OUTPUT != outputIndex)
+            {
+                *pResult = scratch.m_outputValues[outputIndex];
+            }
+            else
+            {
+                status = GetCounterResultInfo(counterIndexIter, counterResultInfo);
+
+                if (GPA_STATUS_OK == status)
+                {
+                    status = ComputeCounterResult(counterResultInfo, sampleId, scratch, pResult);
+                }
+            }
+        }
+
+        return status;
+    }
+
+    for (gpa_uint32 counterIndexIter = 0; counterIndexIter < numEnabled && GPA_STATUS_OK == status; counterIndexIter++)
+    {
+        status = GetCounterResultInfo(counterIndexIter, counterResultInfo);
+
+        if (GPA_STATUS_OK == status)
+        {
+            status = ComputeCounterResult(counterResultInfo, sampleId, scratch, pResults + counterIndexIter * resultStride);
+        }
+    }
+
+    return status;
+}
+
+bool GPASession::BuildStreamingCounterLayout()
+{
+    TRACE_PRIVATE_FUNCTION(GPASession::BuildStreamingCounterLayout);
+
+    m_streamingInputValueIndices.clear();
+    m_streamingCounterValueIndices.clear();
+
+    // streaming counters are sampled continuously, so they can't be spread over several passes
+    if (1 != m_passes.size())
+    {
+        GPA_LogError("The counters of a streaming counter session must be collected in a single pass.");
+        return false;
+    }
+
+    gpa_uint32 numEnabled = 0;
+    GetNumEnabledCounters(&numEnabled);
+
+    if (!m_isEvaluatorValid || m_evaluatorOutputIndices.size() != numEnabled)
+    {
+        return false;
+    }
+
+    // the values of a record are in the same order as the results of a sample of the pass
+    const GPAPass*                       pPass = m_passes[0];
+    std::map<CounterIndex, CounterIndex> recordValueIndices;
+
+    for (CounterIndex valueIndex = 0; valueIndex < pPass->GetEnabledCounterCount(); ++valueIndex)
+    {
+        CounterIndex internalCounterIndex = 0;
+
+        if (pPass->GetCounterByIndexInPass(valueIndex, &internalCounterIndex))
+        {
+            recordValueIndices.insert(std::make_pair(internalCounterIndex, valueIndex));
+        }
+    }
+
+    const std::vector<gpa_uint32>& inputs = m_derivedCounterEvaluator.GetInputs();
+
+    for (auto inputIter = inputs.cbegin(); inputIter != inputs.cend(); ++inputIter)
+    {
+        auto valueIter = recordValueIndices.find(*inputIter);
+
+        if (recordValueIndices.cend() == valueIter)
+        {
+            GPA_LogError("Could not find required counter among the streaming counters.");
+            return false;
+        }
+
+        m_streamingInputValueIndices.push_back(valueIter->second);
+    }
+
+    CounterResultInfo counterResultInfo;
+
+    for (gpa_uint32 counterIndexIter = 0; counterIndexIter < numEnabled; counterIndexIter++)
+    {
+        CounterIndex valueIndex = 0;
+
+        if (NO_EVALUATOR_OUTPUT == m_evaluatorOutputIndices[counterIndexIter])
+        {
+            // besides the public counters, only hardware counters are sampled by the streaming hardware
+            auto valueIter = recordValueIndices.cend();
+
+            if (GPA_STATUS_OK == GetCounterResultInfo(counterIndexIter, counterResultInfo) && GPACounterSource::HARDWARE == counterResultInfo.m_source)
+            {
+                valueIter = recordValueIndices.find(counterResultInfo.m_internalCountersRequired[0]);
+            }
+
+            if (recordValueIndices.cend() == valueIter)
+            {
+                GPA_LogError("Only public and hardware counters can be collected in a streaming counter session.");
+                return false;
+            }
+
+            valueIndex = valueIter->second;
+        }
+
+        m_streamingCounterValueIndices.push_back(valueIndex);
+    }
+
+    return true;
+}
+
+void GPASession::ComputeStreamingCounterResults(const gpa_uint64* pValueSums, gpa_uint64* pResults)
+{
+    // the derived counters of a bucket are computed from the sums of their hardware counters over the records of the bucket
+    size_t numInputs = m_streamingInputValueIndices.size();
+    m_streamingScratch.m_inputValues.resize(numInputs);
+    m_streamingScratch.m_outputValues.resize(m_derivedCounterEvaluator.GetNumOutputs());
+
+    for (size_t inputIndex = 0; inputIndex < numInputs; ++inputIndex)
+    {
+        m_streamingScratch.m_inputValues[inputIndex] = pValueSums[m_streamingInputValueIndices[inputIndex]];
+    }
+
+    m_derivedCounterEvaluator.Evaluate(m_streamingScratch.m_inputValues.data(), m_streamingScratch.m_nodeValues, m_streamingScratch.m_outputValues.data());
+
+    for (size_t counterIndexIter = 0; counterIndexIter < m_evaluatorOutputIndices.size(); ++counterIndexIter)
+    {
+        gpa_uint32 outputIndex = m_evaluatorOutputIndices[counterIndexIter];
+
+        if (NO_EVALUATOR_OUTPUT != outputIndex)
+        {
+            pResults[counterIndexIter] = m_streamingScratch.m_outputValues[outputIndex];
+        }
+        else
+        {
+            pResults[counterIndexIter] = pValueSums[m_streamingCounterValueIndices[counterIndexIter]];
+        }
+    }
+}
+
+GPA_Session_Sample_Type GPASession::GetSampleType() const
+{
+    return m_sampleType;
+}
+
+bool GPASession::IsStreamingCounterSession() const
+{
+    return GPA_SESSION_SAMPLE_TYPE_STREAMING_COUNTER == m_sampleType || GPA_SESSION_SAMPLE_TYPE_STREAMING_COUNTER_AND_SQTT == m_sampleType;
+}
+
+GPAStreamingCounterStream* GPASession::GetStreamingCounterStream()
+{
+    return &m_streamingCounterStream;
+}
+
+bool GPASession::IsSQTTSession() const
+{
+    return GPA_SESSION_SAMPLE_TYPE_SQTT == m_sampleType || GPA_SESSION_SAMPLE_TYPE_STREAMING_COUNTER_AND_SQTT == m_sampleType;
+}
+
+GPASQTTTraceStore* GPASession::GetSQTTTraceStore()
+{
+    return &m_sqttTraceStore;
+}
+
+GPA_Status GPASession::SetMaxSampleIdHint(gpa_uint32 maxSampleId)
+{
+    std::lock_guard<std::mutex> lockResources(m_gpaSessionMutex);
+
+    if (GPA_SESSION_STATE_STARTED <= m_state)
+    {
+        GPA_LogError("The sample id hint must be set before the session is started.");
+        return GPA_STATUS_ERROR_SESSION_ALREADY_STARTED;
+    }
+
+    m_hasMaxSampleIdHint = true;
+    m_maxSampleIdHint    = maxSampleId;
+
+    return GPA_STATUS_OK;
+}
+
+gpa_uint32 GPASession::GetSPMInterval() const
+{
+    return m_spmInterval;
+}
+
+void GPASession::SetSPMInterval(gpa_uint32 interval)
+{
+    m_spmInterval = interval;
+}
+
+gpa_uint64 GPASession::GetSPMMemoryLimit() const
+{
+    return m_spmMemoryLimit;
+}
+
+void GPASession::SetSPMMemoryLimit(gpa_uint64 memoryLimit)
+{
+    m_spmMemoryLimit = memoryLimit;
+}
+
+GPA_SQTTInstructionFlags GPASession::GetSQTTInstructionMask() const
+{
+    return m_sqttInstructionMask;
+}
+
+void GPASession::SetSQTTInstructionMask(GPA_SQTTInstructionFlags sqttInstructionMask)
+{
+    m_sqttInstructionMask = sqttInstructionMask;
+}
+
+gpa_uint32 GPASession::GetSQTTComputeUnitId() const
+{
+    return m_sqttComputeUnitId;
+}
+
+void GPASession::SetSQTTComputeUnitId(gpa_uint32 sqttComputeUnitId)
+{
+    m_sqttComputeUnitId = sqttComputeUnitId;
+}
+
+gpa_uint64 GPASession::GetSQTTMemoryLimit() const
+{
+    return m_sqttMemoryLimit;
+}
+
+void GPASession::SetSQTTMemoryLimit(gpa_uint64 memoryLimit)
+{
+    m_sqttMemoryLimit = memoryLimit;
+}
+
+GPA_Status GPASession::GetSQTTChunkCount(gpa_uint32* pChunkCount) const
+{
+    if (!IsSQTTSession())
+    {
+        GPA_LogError("SQTT data is only available for SQTT sessions.");
+        return GPA_STATUS_ERROR_INCOMPATIBLE_SAMPLE_TYPES;
+    }
+
+    if (nullptr == pChunkCount)
+    {
+        GPA_LogError("pChunkCount is NULL in GPASession::GetSQTTChunkCount.");
+        return GPA_STATUS_ERROR_NULL_POINTER;
+    }
+
+    if (GPA_SESSION_STATE_NOT_STARTED == m_state)
+    {
+        GPA_LogError("Session has not been started.");
+        return GPA_STATUS_ERROR_SESSION_NOT_STARTED;
+    }
+
+    // the chunks can only be read once the backend has written all of them to the trace file
+    if (!m_sqttTraceStore.IsReadable())
+    {
+        return GPA_STATUS_RESULT_NOT_READY;
+    }
+
+    *pChunkCount = m_sqttTraceStore.GetChunkCount();
+    return GPA_STATUS_OK;
+}
+
+GPA_Status GPASession::GetSQTTChunk(gpa_uint32 chunkIndex, GPA_SQTTChunkView* pChunkView) const
+{
+    gpa_uint32 chunkCount = 0;
+    GPA_Status status     = GetSQTTChunkCount(&chunkCount);
+
+    if (GPA_STATUS_OK != status)
+    {
+        return status;
+    }
+
+    if (nullptr == pChunkView)
+    {
+        GPA_LogError("pChunkView is NULL in GPASession::GetSQTTChunk.");
+        return GPA_STATUS_ERROR_NULL_POINTER;
+    }
+
+    if (!m_sqttTraceStore.GetChunk(chunkIndex, *pChunkView))
+    {
+        GPA_LogError("Invalid SQTT chunk index.");
+        return GPA_STATUS_ERROR_INDEX_OUT_OF_RANGE;
+    }
+
+    return GPA_STATUS_OK;
+}
+
+CounterList* GPASession::GetCountersForPass(PassIndex passIndex)
+{
+    if (m_passCountersMap.find(passIndex) == m_passCountersMap.end())
+    {
+        return nullptr;
+    }
+
+    return &m_passCountersMap[passIndex];
+}
+
+bool GPASession::Flush(uint32_t timeout)
+{
+    TRACE_PRIVATE_FUNCTION(GPASession::Flush);
+
+    bool retVal = true;
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    // block until the session is complete or the timeout (if any) is reached
+    while (!IsResultReady())
+    {
+        if (timeout != GPA_TIMEOUT_INFINITE)
+        {
+            auto currentTime = std::chrono::steady_clock::now();
+            auto duration    = currentTime - startTime;
+
+            if (std::chrono::duration_cast<std::chrono::milliseconds>(duration).count() > timeout)
+            {
+                GPA_LogError("GPA session completion timeout occurred.");
+                retVal = false;
+                break;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+
+        UpdateResults();
+    }
+
+    return retVal;
+}
+
+bool GPASession::TryCollectPassResults_NotThreadSafe(PassIndex passIndex)
+{
+    bool isCollected = false;
+
+    if (passIndex <= m_maxPassIndex && passIndex < m_passes.size())
+    {
+        GPAPass* pPass = m_passes[passIndex];
+
+        isCollected = pPass->IsResultCollected();
+
+        if (!isCollected)
+        {
+            isCollected = GPA_STATUS_OK == pPass->IsComplete() && pPass->IsResultReady() && pPass->UpdateResults();
+        }
+    }
+
+    return isCollected;
+}
+
+void GPASession::ReleasePasses_NotThreadSafe()
+{
+    for (auto passIter = m_passes.begin(); passIter != m_passes.end(); ++passIter)
+    {
+        const GPACommandLists passCmdList = (*passIter)->GetCmdList();
+
+        for (auto cmdListIter = passCmdList.cbegin(); cmdListIter != passCmdList.cend(); ++cmdListIter)
+        {
+            GPAUniqueObjectManager::Instance()->DeleteObject(*cmdListIter);
+        }
+
+        delete *passIter;
+    }
+
+    m_passes.clear();
+}
+
+void GPASession::UpdateTrackedMemory_NotThreadSafe()
+{
+    size_t numBytes = sizeof(GPASession) + GPAContainerBytes(m_passes) + GPAContainerBytes(m_sessionCounters) +
+                      m_derivedCounterEvaluator.GetMemoryUsage() + GPAContainerBytes(m_evaluatorOutputIndices) + GPAContainerBytes(m_evaluatorPassInputs) +
+                      m_streamingCounterStream.GetMemoryUsage() + GPAContainerBytes(m_streamingInputValueIndices) +
+                      GPAContainerBytes(m_streamingCounterValueIndices) + m_sqttTraceStore.GetMemoryUsage();
+
+    for (auto locationsIter = m_counterResultLocations.cbegin(); locationsIter != m_counterResultLocations.cend(); ++locationsIter)
+    {
+        numBytes += GPANodeContainerBytes(locationsIter->second) + sizeof(CounterResultLocations::value_type) + 4 * sizeof(void*);
+    }
+
+    for (auto passCountersIter = m_passCountersMap.cbegin(); passCountersIter != m_passCountersMap.cend(); ++passCountersIter)
+    {
+        numBytes += GPAContainerBytes(passCountersIter->second) + sizeof(PassCountersMap::value_type) + 4 * sizeof(void*);
+    }
+
+    for (auto passInputsIter = m_evaluatorPassInputs.cbegin(); passInputsIter != m_evaluatorPassInputs.cend(); ++passInputsIter)
+    {
+        numBytes += GPAContainerBytes(passInputsIter->m_internalCounters) + GPAContainerBytes(passInputsIter->m_inputIndices);
+    }
+
+    m_trackedMemory.SetBytes(numBytes);
 }
 
 bool GPASession::GatherCounterResultLocations()
@@ -10,7 +10,12 @@
 
 #include "gpa_session_interface.h"
 #include "gpa_counter_scheduler_interface.h"
+#include "gpa_derived_counter_evaluator.h"
+#include "gpa_specialized_counter_equations.h"
 #include "gpa_pass.h"
+#include "gpa_memory_tracker.h"
+#include "gpa_sqtt_trace_store.h"
+#include "gpa_streaming_counter_stream.h"
 
 using PassInfo = std::vector<GPAPass*>;  ///< type alias for pass index and its corresponding pass
 
@@ -118,9 +123,37 @@ public:
     /// \copydoc IGPASession::GetSampleResult()
     GPA_Status GetSampleResult(gpa_uint32 sampleId, size_t sampleResultSizeInBytes, void* pCounterSampleResults) override;
 
+    /// \copydoc IGPASession::GetPartialSampleResult()
+    GPA_Status GetPartialSampleResult(gpa_uint32 sampleId,
+                                      size_t     sampleResultSizeInBytes,
+                                      void*      pCounterSampleResults,
+                                      gpa_uint8* pCounterResultAvailable) override;
+
+    /// \copydoc IGPASession::GetSessionResultsByCounterSizeInBytes()
+    size_t GetSessionResultsByCounterSizeInBytes() const override;
+
+    /// \copydoc IGPASession::GetSessionResultsByCounter()
+    GPA_Status GetSessionResultsByCounter(size_t resultsSizeInBytes, void* pCounterResults) override;
+
+    /// \copydoc IGPASession::AccumulateCounterStatistics()
+    GPA_Status AccumulateCounterStatistics(GPACounterStatistics* pStatistics) override;
+
+    /// \copydoc IGPASession::GetStreamingCounterResults()
+    GPA_Status GetStreamingCounterResults(gpa_uint64                  bucketDuration,
+                                          gpa_uint32                  maxBuckets,
+                                          GPA_StreamingCounterBucket* pBuckets,
+                                          void*                       pCounterResults,
+                                          gpa_uint32*                 pNumBuckets) override;
+
     /// \copydoc IGPASession::GetSampleType()
     GPA_Session_Sample_Type GetSampleType() const override;
 
+    /// \copydoc IGPASession::Reset()
+    GPA_Status Reset() override;
+
+    /// \copydoc IGPASession::SetMaxSampleIdHint()
+    GPA_Status SetMaxSampleIdHint(gpa_uint32 maxSampleId) override;
+
     /// \copydoc IGPASession::GetSPMInterval()
     gpa_uint32 GetSPMInterval() const override;
 
@@ -151,6 +184,12 @@ public:
     /// \copydoc IGPASession::SetSQTTMemoryLimit()
     void SetSQTTMemoryLimit(gpa_uint64 memoryLimit) override;
 
+    /// \copydoc IGPASession::GetSQTTChunkCount()
+    GPA_Status GetSQTTChunkCount(gpa_uint32* pChunkCount) const override;
+
+    /// \copydoc IGPASession::GetSQTTChunk()
+    GPA_Status GetSQTTChunk(gpa_uint32 chunkIndex, GPA_SQTTChunkView* pChunkView) const override;
+
     /// \copydoc IGPASession::GetCountersForPass()
     CounterList* GetCountersForPass(PassIndex passIndex) override;
 
@@ -164,16 +203,121 @@ protected:
     /// \return API specific pass objec pointer
     virtual GPAPass* CreateAPIPass(PassIndex passIndex) = 0;
 
+    /// Indicates whether the session samples streaming counters
+    /// \return true if the session was created with a sample type which includes streaming counters
+    bool IsStreamingCounterSession() const;
+
+    /// Gets the stream to which the backend adds the streaming counter records of the session while it runs.
+    /// Each record holds the values of the counters of the (only) pass, in the same order as in the result buffer of a sample.
+    /// The backend should call Finish on the stream once it has added the last record of the session.
+    /// \return the streaming counter records of the session
+    GPAStreamingCounterStream* GetStreamingCounterStream();
+
+    /// Indicates whether the session collects SQTT data
+    /// \return true if the session was created with a sample type which includes SQTT
+    bool IsSQTTSession() const;
+
+    /// Gets the store to which the backend adds the SQTT data of the session as it reads it from the GPU.
+    /// The backend should call Finish on the store once it has added all the SQTT data of the session.
+    /// \return the SQTT data of the session
+    GPASQTTTraceStore* GetSQTTTraceStore();
+
 private:
     /// Waits for all data requests to be complete (blocking).
     /// \param timeout the amount of time (in milliseconds) to wait before giving up
     /// \return true if all data requests are complete, false if a timeout occurred
     virtual bool Flush(uint32_t timeout = GPA_TIMEOUT_INFINITE);
 
+    /// Collects the results of a pass if all of its samples have completed, without waiting or reporting an error otherwise.
+    /// Does NOT lock the mutex, expects the calling method to do that.
+    /// \param[in] passIndex index of the pass
+    /// \return true if the results of the pass are available
+    bool TryCollectPassResults_NotThreadSafe(PassIndex passIndex);
+
+    /// Deletes the passes of the session along with their command lists and samples.
+    /// Does NOT lock the mutex, expects the calling method to do that.
+    void ReleasePasses_NotThreadSafe();
+
+    /// Updates the accounting of the memory held by the pass plan and the result computation data of the session.
+    /// Does NOT lock the mutex, expects the calling method to do that.
+    void UpdateTrackedMemory_NotThreadSafe();
+
     /// Gathers the counter result locations
     /// \return true upon successful copying otherwise false
     bool GatherCounterResultLocations();
 
+    /// Everything needed to compute the result of one enabled counter, resolved once per counter rather than once per sample
+    struct CounterResultInfo
+    {
+        gpa_uint32              m_exposedCounterIndex;       ///< exposed index of the counter
+        GPACounterSource        m_source;                    ///< source of the counter
+        gpa_uint32              m_sourceLocalIndex;          ///< index of the counter local to its source
+        GPA_Data_Type           m_dataType;                  ///< data type of the counter
+        std::vector<gpa_uint32> m_internalCountersRequired;  ///< internal counters required to compute the counter
+        std::vector<PassIndex>  m_requiredCounterPasses;     ///< pass holding each of the internal counters required
+    };
+
+    /// Reusable storage for the internal counter results gathered while computing a counter result
+    struct CounterResultScratch
+    {
+        std::vector<gpa_uint64>        m_values;        ///< internal counter values
+        std::vector<const gpa_uint64*> m_pointers;      ///< pointers to the internal counter values, as expected by the counter accessor
+        std::vector<GPA_Data_Type>     m_types;         ///< types of the internal counter values
+        std::vector<gpa_uint64>        m_inputValues;   ///< values of the derived counter evaluator inputs
+        std::vector<gpa_uint64>        m_passValues;    ///< values of the derived counter evaluator inputs read from a single pass
+        std::vector<gpa_uint64>        m_nodeValues;    ///< values of the derived counter evaluator nodes
+        std::vector<gpa_uint64>        m_outputValues;  ///< values of the derived counter evaluator outputs
+    };
+
+    /// Evaluator inputs whose results are held by the same pass, so they can be read with a single GPAPass::GetResults call
+    struct EvaluatorPassInputs
+    {
+        PassIndex                 m_pass;              ///< the pass holding the results
+        std::vector<CounterIndex> m_internalCounters;  ///< the internal counters to read from the pass
+        std::vector<size_t>       m_inputIndices;      ///< the evaluator input index of each internal counter
+    };
+
+    /// Resolves the information needed to compute the result of an enabled counter
+    /// \param[in] enabledIndex index of the counter within the enabled counter list
+    /// \param[out] counterResultInfo the resolved counter information
+    /// \return GPA_STATUS_OK on success, otherwise an error code
+    GPA_Status GetCounterResultInfo(gpa_uint32 enabledIndex, CounterResultInfo& counterResultInfo);
+
+    /// Computes the result of a single counter for a single sample
+    /// \param[in] counterResultInfo the resolved counter information
+    /// \param[in] sampleId the sample to compute the counter result for
+    /// \param[in,out] scratch reusable storage for the internal counter results
+    /// \param[out] pResult address to which the counter result will be written
+    /// \return GPA_STATUS_OK on success, otherwise an error code
+    GPA_Status ComputeCounterResult(const CounterResultInfo& counterResultInfo, ClientSampleId sampleId, CounterResultScratch& scratch, void* pResult);
+
+    /// Builds the graph used to evaluate all enabled public counters at once, sharing their common sub-expressions.
+    /// If the graph cannot be built, the results are computed one counter at a time instead.
+    void BuildDerivedCounterEvaluator();
+
+    /// Computes the results of all enabled counters for a single sample
+    /// \param[in] sampleId the sample to compute the counter results for
+    /// \param[in,out] scratch reusable storage for the internal counter results
+    /// \param[out] pResults address to which the result of the first enabled counter will be written
+    /// \param[in] resultStride distance (in number of results) between the results of two consecutive enabled counters
+    /// \return GPA_STATUS_OK on success, otherwise an error code
+    GPA_Status ComputeSampleResults(ClientSampleId sampleId, CounterResultScratch& scratch, gpa_uint64* pResults, size_t resultStride);
+
+    /// Gets the ids of the samples exported by GetSessionResultsByCounter, in sample index order.
+    /// The samples begun on a secondary command list which were not copied are skipped, as their results cannot be queried.
+    /// \param[out] sampleIds the ids of the exported samples
+    /// \return true if every sample index of the session was resolved to a sample id, false otherwise
+    bool GetExportedSampleIds(std::vector<ClientSampleId>& sampleIds) const;
+
+    /// Resolves where the result of each enabled counter is computed from in the streaming counter records, once the derived counter evaluator is built
+    /// \return true if the results of all enabled counters can be computed from the records, false otherwise
+    bool BuildStreamingCounterLayout();
+
+    /// Computes the results of all enabled counters for a bucket of streaming counter records
+    /// \param[in] pValueSums the sum of each record value over the records of the bucket
+    /// \param[out] pResults address to which the results of the enabled counters will be written
+    void ComputeStreamingCounterResults(const gpa_uint64* pValueSums, gpa_uint64* pResults);
+
     using SessionCounters           = std::vector<gpa_uint32>;                                   ///< type alias for counters in the session
     using CounterResultLocationPair = std::pair<DerivedCounterIndex, CounterResultLocationMap>;  ///< type alias for counter and its reult location pair
     using CounterResultLocations    = std::map<DerivedCounterIndex, CounterResultLocationMap>;   ///< type alias for counter and its reult location map
@@ -183,9 +327,12 @@ private:
     mutable std::mutex       m_gpaSessionMutex;         ///< Mutex GPA session
     mutable GPASessionState  m_state;                   ///< The state of the session
     IGPAContext*             m_pParentContext;          ///< The context on which this session was created
+    IGPACounterAccessor*     m_pCounterAccessor;        ///< The counter accessor of the parent context, which does not change for the lifetime of the context
     PassInfo                 m_passes;                  ///< List of pass objects in the session
     PassIndex                m_maxPassIndex;            ///< maximum pass index reported for creating command list
     GPA_Session_Sample_Type  m_sampleType;              ///< the sample type suported by the session
+    bool                     m_hasMaxSampleIdHint;      ///< flag indicating whether the largest sample id of the session has been supplied
+    gpa_uint32               m_maxSampleIdHint;         ///< the largest sample id expected in the session, used to preallocate the samples of the passes
     gpa_uint32               m_spmInterval;             ///< the interval (in clock cycles) at which to sample SPM counters
     gpa_uint64               m_spmMemoryLimit;          ///< the maximum amount of GPU memory (in bytes) to use for SPM data
     GPA_SQTTInstructionFlags m_sqttInstructionMask;     ///< mask of instructions included in the SQTT data
@@ -195,8 +342,27 @@ private:
     std::mutex               m_sessionCountersMutex;    ///< mutex for enabled counter list
     gpa_uint32               m_passRequired;            ///< cached number of passes
     bool                     m_counterSetChanged;       ///< flag indicating the counter selection has changed or not for the pass
+    bool                     m_isPassPlanRetained;      ///< flag indicating the passes, their counters and the result locations are kept from the previous begin/end
     CounterResultLocations   m_counterResultLocations;  ///< counter result location for the scheduled counter in the session
     PassCountersMap          m_passCountersMap;         ///< map for the pass and its counters
+
+    static const gpa_uint32 NO_EVALUATOR_OUTPUT = static_cast<gpa_uint32>(-1);  ///< evaluator output index of counters which are not evaluated by the graph
+
+    std::shared_ptr<const GPA_SpecializedCounterEquations> m_pSpecializedEquations;    ///< equations of the public counters specialized for the parent context
+    GPA_DerivedCounterEvaluator                            m_derivedCounterEvaluator;  ///< shared evaluation graph of the enabled public counters
+    std::vector<gpa_uint32>                                m_evaluatorOutputIndices;   ///< evaluator output of each enabled counter, or NO_EVALUATOR_OUTPUT
+    std::vector<EvaluatorPassInputs>                       m_evaluatorPassInputs;      ///< evaluator inputs grouped by the pass holding their results
+    bool                                                   m_isEvaluatorValid;         ///< flag indicating whether the results are computed with the evaluator
+    GPATrackedMemory                                       m_trackedMemory;            ///< accounting of the memory held by the session, excluding its passes
+
+    std::mutex                m_streamingCounterMutex;         ///< mutex serializing the consumers of the streaming counter records
+    GPAStreamingCounterStream m_streamingCounterStream;        ///< the streaming counter records of the session
+    std::vector<CounterIndex> m_streamingInputValueIndices;    ///< record value index of each derived counter evaluator input
+    std::vector<CounterIndex> m_streamingCounterValueIndices;  ///< record value index of each enabled counter which is not evaluated by the graph
+    std::vector<gpa_uint64>   m_streamingValueSums;            ///< reusable storage for the record value sums of a bucket
+    CounterResultScratch      m_streamingScratch;              ///< reusable storage for the evaluation of the counters of a bucket
+
+    GPASQTTTraceStore m_sqttTraceStore;  ///< the SQTT data of the session
 };
 
 #endif  // _GPA_SESSION_H_
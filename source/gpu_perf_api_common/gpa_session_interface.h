@@ -13,7 +13,8 @@
 #include "gpa_common_defs.h"
 #include "gpa_interface_trait_interface.h"
 
-class IGPAContext;  // forward declaration
+class IGPAContext;           // forward declaration
+class GPACounterStatistics;  // forward declaration
 
 /// Enum for GPA Session limit
 enum GPASessionLimit : uint8_t
@@ -182,10 +183,64 @@ public:
     /// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
     virtual GPA_Status GetSampleResult(gpa_uint32 sampleId, size_t sampleResultSizeInBytes, void* pCounterSampleResults) = 0;
 
+    /// Get counter data of the sample for the counters whose results are entirely contained in passes that have already completed.
+    /// Unlike GetSampleResult, this does not wait for the remaining passes.
+    /// \param[in] sampleId The identifier of the sample to get the result for.
+    /// \param[in] sampleResultSizeInBytes size of sample in bytes
+    /// \param[out] pCounterSampleResults address to which the available counter data for the sample will be copied to
+    /// \param[out] pCounterResultAvailable one entry per enabled counter, set to 1 if the counter's result was written, otherwise 0
+    /// \return GPA_STATUS_OK if all counter results were written, GPA_STATUS_RESULT_NOT_READY if only some (or none) were, otherwise an error code
+    virtual GPA_Status GetPartialSampleResult(gpa_uint32 sampleId,
+                                              size_t     sampleResultSizeInBytes,
+                                              void*      pCounterSampleResults,
+                                              gpa_uint8* pCounterResultAvailable) = 0;
+
+    /// Returns the size of the column-major (one column per enabled counter) results of all samples in bytes
+    /// \return size of the session results in bytes
+    virtual size_t GetSessionResultsByCounterSizeInBytes() const = 0;
+
+    /// Get counter data of all samples in the session, laid out as one contiguous column per enabled counter.
+    /// Column i holds the value of the i-th enabled counter for every sample, in sample index order.
+    /// \param[in] resultsSizeInBytes size of the supplied buffer in bytes
+    /// \param[out] pCounterResults address to which the counter data columns will be copied to
+    /// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
+    virtual GPA_Status GetSessionResultsByCounter(size_t resultsSizeInBytes, void* pCounterResults) = 0;
+
+    /// Computes the counter results of all samples in the session and folds them into counter statistics, without keeping the per-sample results.
+    /// The samples are computed in small batches, so the memory needed does not depend on the number of samples.
+    /// \param[in,out] pStatistics the statistics to which the counter results are added
+    /// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
+    virtual GPA_Status AccumulateCounterStatistics(GPACounterStatistics* pStatistics) = 0;
+
+    /// Reads the next complete time buckets of the streaming counter records of the session and computes the counter results of each bucket.
+    /// The results of each bucket have the same layout as the result of a sample (see GetSampleResultSizeInBytes), one bucket after the other.
+    /// \param[in] bucketDuration the duration of each bucket, in GPU timestamp units
+    /// \param[in] maxBuckets the largest number of buckets to read
+    /// \param[out] pBuckets the time range of each bucket read, maxBuckets of them
+    /// \param[out] pCounterResults address to which the counter results of the buckets will be copied to, for maxBuckets buckets
+    /// \param[out] pNumBuckets the number of buckets read
+    /// \return GPA_STATUS_OK if all the records of the session have been read, GPA_STATUS_RESULT_NOT_READY if more buckets may follow, otherwise an error code
+    virtual GPA_Status GetStreamingCounterResults(gpa_uint64                  bucketDuration,
+                                                  gpa_uint32                  maxBuckets,
+                                                  GPA_StreamingCounterBucket* pBuckets,
+                                                  void*                       pCounterResults,
+                                                  gpa_uint32*                 pNumBuckets) = 0;
+
     /// Gets the supported sample type for this session
     /// \return the supported sample type for this session
     virtual GPA_Session_Sample_Type GetSampleType() const = 0;
 
+    /// Returns an ended session to the not-started state so that it can be begun again to collect another set of samples.
+    /// The samples and command lists of the session are deleted, while its passes, the counters scheduled in them and the
+    /// counter result locations are kept and reused by the next begin, as long as the enabled counters are not changed.
+    /// \return GPA_STATUS_OK on success, GPA_STATUS_ERROR_SESSION_NOT_ENDED if the session is running
+    virtual GPA_Status Reset() = 0;
+
+    /// Sets the largest sample id expected in this session, so the sample storage of its passes can be preallocated
+    /// \param[in] maxSampleId the largest sample id expected in this session
+    /// \return GPA_STATUS_OK on success, GPA_STATUS_ERROR_SESSION_ALREADY_STARTED if the session has already been started
+    virtual GPA_Status SetMaxSampleIdHint(gpa_uint32 maxSampleId) = 0;
+
     /// Gets the SPM sampling interval (in clock cycles) for this session
     /// \return the SPM sampling interval (in clock cycles) for this session
     virtual gpa_uint32 GetSPMInterval() const = 0;
@@ -226,6 +281,17 @@ public:
     /// \param memoryLimit the SQTT memory limit (in bytes) to set for this session
     virtual void SetSQTTMemoryLimit(gpa_uint64 memoryLimit) = 0;
 
+    /// Gets the number of chunks of SQTT data collected by this session
+    /// \param[out] pChunkCount the number of chunks of SQTT data
+    /// \return GPA_STATUS_OK if the SQTT data is available, GPA_STATUS_RESULT_NOT_READY if it is still being collected, otherwise an error
+    virtual GPA_Status GetSQTTChunkCount(gpa_uint32* pChunkCount) const = 0;
+
+    /// Gets a chunk of SQTT data collected by this session, without copying it
+    /// \param[in] chunkIndex the index of the chunk, less than the chunk count
+    /// \param[out] pChunkView the view of the chunk, valid until the session is deleted or begun again
+    /// \return GPA_STATUS_OK if the chunk is available, GPA_STATUS_RESULT_NOT_READY if the SQTT data is still being collected, otherwise an error
+    virtual GPA_Status GetSQTTChunk(gpa_uint32 chunkIndex, GPA_SQTTChunkView* pChunkView) const = 0;
+
     /// Returns the counter list for the given pass in the session
     /// \param[in] passIndex index of the pass
     /// \return counter list for the given pass
@@ -0,0 +1,463 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Bounded-memory storage of the SQTT data of a session, spilled to a chunked trace file
+//==============================================================================
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include "gpa_sqtt_trace_store.h"
+
+static const gpa_uint32 TRACE_FILE_MAGIC   = 0x54515347;  ///< "GSQT", at the start of the header and the footer of a trace file
+static const gpa_uint32 TRACE_FILE_VERSION = 1;           ///< version of the trace file format
+
+/// Header at the start of a trace file
+struct TraceFileHeader
+{
+    gpa_uint32 m_magic;           ///< TRACE_FILE_MAGIC
+    gpa_uint32 m_version;         ///< TRACE_FILE_VERSION
+    gpa_uint32 m_chunkAlignment;  ///< alignment of the chunks in the file, in bytes
+    gpa_uint32 m_reserved;        ///< reserved, zero
+};
+
+/// Footer at the end of a trace file, right after the index of the chunks
+struct TraceFileFooter
+{
+    gpa_uint64 m_indexOffset;  ///< offset of the index in the file
+    gpa_uint64 m_chunkCount;   ///< number of entries in the index
+    gpa_uint32 m_magic;        ///< TRACE_FILE_MAGIC
+    gpa_uint32 m_version;      ///< TRACE_FILE_VERSION
+};
+
+const gpa_uint32 GPASQTTTraceStore::DEFAULT_CHUNK_SIZE;
+const gpa_uint32 GPASQTTTraceStore::MIN_POOLED_CHUNKS;
+const gpa_uint32 GPASQTTTraceStore::CHUNK_FILE_ALIGNMENT;
+
+GPASQTTTraceStore::GPASQTTTraceStore()
+    : m_traceFileSize(0)
+    , m_ownsTraceFile(false)
+    , m_isCapturing(false)
+    , m_isSpillFinishing(false)
+    , m_hasSpillFailed(false)
+    , m_chunkSize(DEFAULT_CHUNK_SIZE)
+    , m_maxBuffers(MIN_POOLED_CHUNKS)
+    , m_pMappedIndex(nullptr)
+    , m_mappedChunkCount(0)
+{
+}
+
+GPASQTTTraceStore::~GPASQTTTraceStore()
+{
+    Reset();
+}
+
+bool GPASQTTTraceStore::Initialize(const std::string& traceFilePath, gpa_uint64 memoryLimit, gpa_uint32 chunkSize)
+{
+    Reset();
+
+    // the store owns the file from here on, so it is deleted even if the capture cannot start
+    m_traceFilePath = traceFilePath;
+    m_ownsTraceFile = true;
+
+    if (0 == chunkSize)
+    {
+        return false;
+    }
+
+    m_chunkSize  = chunkSize;
+    m_maxBuffers = static_cast<size_t>(std::max(memoryLimit / chunkSize, static_cast<gpa_uint64>(MIN_POOLED_CHUNKS)));
+
+    // the file was created exclusively by the caller; it is neither created nor truncated here, so a path swapped for a link fails to open
+    m_traceFile.open(traceFilePath.c_str(), std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+
+    if (!m_traceFile.is_open())
+    {
+        GPA_LogError("Unable to open the SQTT trace file.");
+        return false;
+    }
+
+    TraceFileHeader header = {TRACE_FILE_MAGIC, TRACE_FILE_VERSION, CHUNK_FILE_ALIGNMENT, 0};
+    m_traceFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    m_traceFileSize = sizeof(header);
+
+    m_isCapturing = true;
+    m_spillThread = std::thread(&GPASQTTTraceStore::SpillThreadMain, this);
+
+    return true;
+}
+
+bool GPASQTTTraceStore::AddTraceData(gpa_uint32 streamId, const void* pData, size_t size)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    if (!m_isCapturing || m_hasSpillFailed)
+    {
+        return false;
+    }
+
+    if (streamId >= m_openChunks.size())
+    {
+        m_openChunks.resize(static_cast<size_t>(streamId) + 1, Chunk());
+        m_streamSizes.resize(static_cast<size_t>(streamId) + 1, 0);
+    }
+
+    const gpa_uint8* pBytes = static_cast<const gpa_uint8*>(pData);
+
+    while (0 < size)
+    {
+        if (nullptr == m_openChunks[streamId].m_pData)
+        {
+            gpa_uint8* pBuffer = AcquireBuffer_NotThreadSafe(lock);
+
+            if (nullptr == pBuffer)
+            {
+                return false;
+            }
+
+            Chunk& openChunk         = m_openChunks[streamId];
+            openChunk.m_pData        = pBuffer;
+            openChunk.m_size         = 0;
+            openChunk.m_streamId     = streamId;
+            openChunk.m_streamOffset = m_streamSizes[streamId];
+        }
+
+        Chunk& openChunk = m_openChunks[streamId];
+        size_t copySize  = std::min(size, static_cast<size_t>(m_chunkSize) - openChunk.m_size);
+
+        memcpy(openChunk.m_pData + openChunk.m_size, pBytes, copySize);
+        openChunk.m_size += copySize;
+        m_streamSizes[streamId] += copySize;
+        pBytes += copySize;
+        size -= copySize;
+
+        if (m_chunkSize == openChunk.m_size)
+        {
+            QueueOpenChunk_NotThreadSafe(streamId);
+        }
+    }
+
+    return true;
+}
+
+bool GPASQTTTraceStore::Finish()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (!m_isCapturing)
+        {
+            return false;
+        }
+
+        for (size_t streamIndex = 0; streamIndex < m_openChunks.size(); ++streamIndex)
+        {
+            QueueOpenChunk_NotThreadSafe(streamIndex);
+        }
+
+        m_isCapturing      = false;
+        m_isSpillFinishing = true;
+        m_chunkQueued.notify_one();
+    }
+
+    m_spillThread.join();
+
+    // the index is aligned so that it can be read in place once the file is mapped
+    static const char s_padding[alignof(ChunkIndexEntry)] = {};
+
+    size_t          paddingSize = static_cast<size_t>((alignof(ChunkIndexEntry) - m_traceFileSize % alignof(ChunkIndexEntry)) % alignof(ChunkIndexEntry));
+    TraceFileFooter footer      = {m_traceFileSize + paddingSize, m_index.size(), TRACE_FILE_MAGIC, TRACE_FILE_VERSION};
+
+    m_traceFile.write(s_padding, paddingSize);
+    m_traceFile.write(reinterpret_cast<const char*>(m_index.data()), m_index.size() * sizeof(ChunkIndexEntry));
+    m_traceFile.write(reinterpret_cast<const char*>(&footer), sizeof(footer));
+    m_traceFile.close();
+
+    bool isWritten = !m_hasSpillFailed && !m_traceFile.fail();
+
+    {
+        // all the trace data is in the file now, so the pool is released
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_freeBuffers.clear();
+        m_buffers.clear();
+        m_openChunks.clear();
+        m_streamSizes.clear();
+        std::vector<ChunkIndexEntry>().swap(m_index);
+    }
+
+    if (!isWritten)
+    {
+        GPA_LogError("Unable to write the SQTT trace file.");
+        return false;
+    }
+
+    return m_mappedTraceFile.Open(m_traceFilePath) && ParseMappedFile();
+}
+
+bool GPASQTTTraceStore::Open(const std::string& traceFilePath)
+{
+    Reset();
+
+    m_traceFilePath = traceFilePath;
+
+    if (!m_mappedTraceFile.Open(traceFilePath))
+    {
+        GPA_LogError("Unable to map the SQTT trace file.");
+        return false;
+    }
+
+    return ParseMappedFile();
+}
+
+bool GPASQTTTraceStore::IsReadable() const
+{
+    return nullptr != m_pMappedIndex;
+}
+
+gpa_uint32 GPASQTTTraceStore::GetChunkCount() const
+{
+    return m_mappedChunkCount;
+}
+
+bool GPASQTTTraceStore::GetChunk(gpa_uint32 chunkIndex, GPA_SQTTChunkView& chunkView) const
+{
+    if (chunkIndex >= m_mappedChunkCount)
+    {
+        return false;
+    }
+
+    const ChunkIndexEntry& entry = m_pMappedIndex[chunkIndex];
+    chunkView.m_streamId         = entry.m_streamId;
+    chunkView.m_streamOffset     = entry.m_streamOffset;
+    chunkView.m_size             = entry.m_size;
+    chunkView.m_pData            = m_mappedTraceFile.GetData() + entry.m_fileOffset;
+
+    return true;
+}
+
+size_t GPASQTTTraceStore::GetMemoryUsage() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_buffers.size() * m_chunkSize + m_buffers.capacity() * sizeof(m_buffers[0]) + m_freeBuffers.capacity() * sizeof(gpa_uint8*) +
+           m_queuedChunks.size() * sizeof(Chunk) + m_openChunks.capacity() * sizeof(Chunk) + m_streamSizes.capacity() * sizeof(gpa_uint64) +
+           m_index.capacity() * sizeof(ChunkIndexEntry);
+}
+
+void GPASQTTTraceStore::Reset()
+{
+    {
+        // the queued chunks of an unfinished capture are discarded rather than written
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queuedChunks.clear();
+        m_isCapturing      = false;
+        m_isSpillFinishing = true;
+        m_chunkQueued.notify_one();
+    }
+
+    if (m_spillThread.joinable())
+    {
+        m_spillThread.join();
+    }
+
+    if (m_traceFile.is_open())
+    {
+        m_traceFile.close();
+    }
+
+    m_mappedTraceFile.Close();
+    m_pMappedIndex     = nullptr;
+    m_mappedChunkCount = 0;
+
+    if (m_ownsTraceFile)
+    {
+        std::remove(m_traceFilePath.c_str());
+    }
+
+    m_traceFilePath.clear();
+    m_ownsTraceFile    = false;
+    m_traceFileSize    = 0;
+    m_isSpillFinishing = false;
+    m_hasSpillFailed   = false;
+    m_freeBuffers.clear();
+    m_buffers.clear();
+    m_openChunks.clear();
+    m_streamSizes.clear();
+    m_index.clear();
+}
+
+gpa_uint8* GPASQTTTraceStore::AcquireBuffer_NotThreadSafe(std::unique_lock<std::mutex>& lock)
+{
+    while (m_freeBuffers.empty() && !m_hasSpillFailed)
+    {
+        if (m_buffers.size() < m_maxBuffers)
+        {
+            std::unique_ptr<gpa_uint8[]> pBuffer(new (std::nothrow) gpa_uint8[m_chunkSize]);
+
+            if (nullptr == pBuffer)
+            {
+                if (m_buffers.empty())
+                {
+                    GPA_LogError("Unable to allocate memory for the SQTT data.");
+                    return nullptr;
+                }
+
+                // make do with the buffers already allocated
+                m_maxBuffers = m_buffers.size();
+                continue;
+            }
+
+            m_freeBuffers.push_back(pBuffer.get());
+            m_buffers.push_back(std::move(pBuffer));
+        }
+        else if (m_queuedChunks.empty() &&
+                 m_buffers.size() == static_cast<size_t>(std::count_if(
+                                         m_openChunks.cbegin(), m_openChunks.cend(), [](const Chunk& openChunk) { return nullptr != openChunk.m_pData; })))
+        {
+            // every buffer is the open chunk of a stream, so the fullest one is written before it is full
+            auto fullestChunk = std::max_element(
+                m_openChunks.cbegin(), m_openChunks.cend(), [](const Chunk& lhs, const Chunk& rhs) { return lhs.m_size < rhs.m_size; });
+            QueueOpenChunk_NotThreadSafe(static_cast<size_t>(fullestChunk - m_openChunks.cbegin()));
+        }
+        else
+        {
+            m_bufferReleased.wait(lock);
+        }
+    }
+
+    if (m_hasSpillFailed)
+    {
+        return nullptr;
+    }
+
+    gpa_uint8* pBuffer = m_freeBuffers.back();
+    m_freeBuffers.pop_back();
+    return pBuffer;
+}
+
+void GPASQTTTraceStore::QueueOpenChunk_NotThreadSafe(size_t streamIndex)
+{
+    Chunk& openChunk = m_openChunks[streamIndex];
+
+    if (nullptr == openChunk.m_pData)
+    {
+        return;
+    }
+
+    if (0 < openChunk.m_size)
+    {
+        m_queuedChunks.push_back(openChunk);
+        m_chunkQueued.notify_one();
+    }
+    else
+    {
+        m_freeBuffers.push_back(openChunk.m_pData);
+    }
+
+    openChunk.m_pData = nullptr;
+    openChunk.m_size  = 0;
+}
+
+void GPASQTTTraceStore::SpillThreadMain()
+{
+    static const char s_padding[CHUNK_FILE_ALIGNMENT] = {};
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    for (;;)
+    {
+        m_chunkQueued.wait(lock, [this] { return !m_queuedChunks.empty() || m_isSpillFinishing; });
+
+        if (m_queuedChunks.empty())
+        {
+            break;
+        }
+
+        Chunk chunk = m_queuedChunks.front();
+        m_queuedChunks.pop_front();
+        bool hasSpillFailed = m_hasSpillFailed;
+
+        // the file is written without holding the lock, so the producer can keep filling the other buffers
+        lock.unlock();
+
+        ChunkIndexEntry entry = {};
+
+        if (!hasSpillFailed)
+        {
+            // each chunk starts on an aligned offset, so that it can be mapped on its own
+            size_t paddingSize = static_cast<size_t>((CHUNK_FILE_ALIGNMENT - m_traceFileSize % CHUNK_FILE_ALIGNMENT) % CHUNK_FILE_ALIGNMENT);
+            m_traceFile.write(s_padding, paddingSize);
+            m_traceFile.write(reinterpret_cast<const char*>(chunk.m_pData), chunk.m_size);
+
+            entry.m_fileOffset   = m_traceFileSize + paddingSize;
+            entry.m_size         = chunk.m_size;
+            entry.m_streamOffset = chunk.m_streamOffset;
+            entry.m_streamId     = chunk.m_streamId;
+            m_traceFileSize      = entry.m_fileOffset + entry.m_size;
+            hasSpillFailed       = !m_traceFile.good();
+        }
+
+        lock.lock();
+
+        if (hasSpillFailed)
+        {
+            m_hasSpillFailed = true;
+        }
+        else
+        {
+            m_index.push_back(entry);
+        }
+
+        m_freeBuffers.push_back(chunk.m_pData);
+        m_bufferReleased.notify_one();
+    }
+}
+
+bool GPASQTTTraceStore::ParseMappedFile()
+{
+    const gpa_uint8* pData   = m_mappedTraceFile.GetData();
+    size_t           size    = m_mappedTraceFile.GetSize();
+    TraceFileHeader  header  = {};
+    TraceFileFooter  footer  = {};
+    bool             isValid = sizeof(header) + sizeof(footer) <= size;
+
+    if (isValid)
+    {
+        memcpy(&header, pData, sizeof(header));
+        memcpy(&footer, pData + size - sizeof(footer), sizeof(footer));
+
+        gpa_uint64 indexEnd = size - sizeof(footer);
+
+        isValid = TRACE_FILE_MAGIC == header.m_magic && TRACE_FILE_VERSION == header.m_version && TRACE_FILE_MAGIC == footer.m_magic &&
+                  TRACE_FILE_VERSION == footer.m_version && 0 == footer.m_indexOffset % alignof(ChunkIndexEntry) && footer.m_indexOffset <= indexEnd &&
+                  footer.m_chunkCount == (indexEnd - footer.m_indexOffset) / sizeof(ChunkIndexEntry) && footer.m_chunkCount <= UINT32_MAX;
+    }
+
+    if (isValid)
+    {
+        const ChunkIndexEntry* pIndex = reinterpret_cast<const ChunkIndexEntry*>(pData + footer.m_indexOffset);
+
+        for (gpa_uint64 chunkIndex = 0; chunkIndex < footer.m_chunkCount && isValid; ++chunkIndex)
+        {
+            isValid = sizeof(header) <= pIndex[chunkIndex].m_fileOffset && pIndex[chunkIndex].m_fileOffset <= footer.m_indexOffset &&
+                      pIndex[chunkIndex].m_size <= footer.m_indexOffset - pIndex[chunkIndex].m_fileOffset;
+        }
+
+        if (isValid)
+        {
+            m_pMappedIndex     = pIndex;
+            m_mappedChunkCount = static_cast<gpa_uint32>(footer.m_chunkCount);
+        }
+    }
+
+    if (!isValid)
+    {
+        GPA_LogError("The SQTT trace file is invalid.");
+        m_mappedTraceFile.Close();
+    }
+
+    return isValid;
+}
@@ -0,0 +1,158 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Bounded-memory storage of the SQTT data of a session, spilled to a chunked trace file
+//==============================================================================
+
+#ifndef _GPA_SQTT_TRACE_STORE_H_
+#define _GPA_SQTT_TRACE_STORE_H_
+
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gpa_common_defs.h"
+#include "gpa_mapped_file.h"
+
+/// The SQTT data of a session.
+///
+/// The backend adds the trace data of each trace stream as it reads it from the GPU. The data is copied into fixed-size
+/// chunks taken from a bounded pool, and each full chunk is written to the trace file by a spill thread, which then returns
+/// the chunk to the pool. When the pool is exhausted, the backend waits for the spill thread, so the host memory used by
+/// a capture never exceeds the memory limit, however large the trace is.
+/// Once the capture is finished, the trace file is mapped and its chunks are read in place, without being copied.
+///
+/// The trace file is made of a header, the chunks, each of them aligned to CHUNK_FILE_ALIGNMENT bytes so that they can
+/// be mapped individually, then the index of the chunks and a footer holding the location of the index.
+class GPASQTTTraceStore
+{
+public:
+    /// Default size of the chunks, in bytes
+    static const gpa_uint32 DEFAULT_CHUNK_SIZE = 1024 * 1024;
+
+    /// Smallest number of chunks in the pool, so that the producer can fill a chunk while another one is written
+    static const gpa_uint32 MIN_POOLED_CHUNKS = 2;
+
+    /// Alignment of the chunks in the trace file, in bytes
+    static const gpa_uint32 CHUNK_FILE_ALIGNMENT = 4096;
+
+    /// Initializes a new instance of the GPASQTTTraceStore class
+    GPASQTTTraceStore();
+
+    /// Stops the spill thread, unmaps the trace file and deletes it if it was written by this store
+    ~GPASQTTTraceStore();
+
+    /// Prepares the store for a new capture, deleting the trace file of the previous one.
+    /// Must not be called while the producer or a reader is using the store.
+    /// \param[in] traceFilePath the path of an empty file created for the store (see GPAUtil::CreateTempFile), which is deleted with the store
+    /// \param[in] memoryLimit the largest number of bytes to use for the pool of chunks
+    /// \param[in] chunkSize the size of the chunks, in bytes
+    /// \return true if the trace file could be created, false otherwise
+    bool Initialize(const std::string& traceFilePath, gpa_uint64 memoryLimit, gpa_uint32 chunkSize = DEFAULT_CHUNK_SIZE);
+
+    /// Adds trace data to a trace stream, waiting for a chunk to be written if the pool is exhausted.
+    /// Must only be called by the producer.
+    /// \param[in] streamId the id of the trace stream
+    /// \param[in] pData the trace data to append to the stream
+    /// \param[in] size the size of the trace data, in bytes
+    /// \return true if the data was added, false if the store is not capturing or the trace file could not be written
+    bool AddTraceData(gpa_uint32 streamId, const void* pData, size_t size);
+
+    /// Writes the chunks which are not full yet and the index to the trace file, then maps it so that its chunks can be read.
+    /// Must only be called by the producer, once it has added all the trace data of the capture.
+    /// \return true if the trace file was completed and mapped, false otherwise
+    bool Finish();
+
+    /// Maps an existing trace file so that its chunks can be read. The file is not deleted with the store.
+    /// \param[in] traceFilePath the path of the trace file
+    /// \return true if the file could be mapped and is a valid trace file, false otherwise
+    bool Open(const std::string& traceFilePath);
+
+    /// Indicates whether the chunks of the trace file can be read
+    /// \return true if the capture was finished or an existing trace file was opened
+    bool IsReadable() const;
+
+    /// Gets the number of chunks in the trace file
+    /// \return the number of chunks, or 0 if the trace file is not readable
+    gpa_uint32 GetChunkCount() const;
+
+    /// Gets a chunk of the trace file
+    /// \param[in] chunkIndex the index of the chunk, less than GetChunkCount()
+    /// \param[out] chunkView the view of the chunk in the mapped trace file
+    /// \return true if the chunk exists, false otherwise
+    bool GetChunk(gpa_uint32 chunkIndex, GPA_SQTTChunkView& chunkView) const;
+
+    /// Estimates the number of bytes of host memory allocated by the store
+    /// \return the number of bytes allocated for the pool of chunks and the index; the mapped trace file is not included
+    size_t GetMemoryUsage() const;
+
+private:
+    /// A chunk of trace data, either being filled by the producer or waiting to be written
+    struct Chunk
+    {
+        gpa_uint8* m_pData;         ///< the pooled buffer holding the data of the chunk
+        size_t     m_size;          ///< number of bytes of trace data in the chunk
+        gpa_uint32 m_streamId;      ///< id of the trace stream of the chunk
+        gpa_uint64 m_streamOffset;  ///< offset of the chunk within the data of its trace stream
+    };
+
+    /// Entry of the index of the trace file
+    struct ChunkIndexEntry
+    {
+        gpa_uint64 m_fileOffset;    ///< offset of the chunk in the trace file
+        gpa_uint64 m_size;          ///< size of the chunk in bytes
+        gpa_uint64 m_streamOffset;  ///< offset of the chunk within the data of its trace stream
+        gpa_uint32 m_streamId;      ///< id of the trace stream of the chunk
+        gpa_uint32 m_reserved;      ///< reserved, zero
+    };
+
+    /// Stops the spill thread, unmaps the trace file and deletes it if it was written by this store
+    void Reset();
+
+    /// Takes a buffer from the pool, waiting for the spill thread to return one if the pool is exhausted. Requires m_mutex.
+    /// \param[in,out] lock the lock holding m_mutex
+    /// \return the buffer, or nullptr if the trace file could not be written
+    gpa_uint8* AcquireBuffer_NotThreadSafe(std::unique_lock<std::mutex>& lock);
+
+    /// Queues the chunk of a trace stream to be written by the spill thread, if it holds any data. Requires m_mutex.
+    /// \param[in] streamIndex the index of the trace stream in m_openChunks
+    void QueueOpenChunk_NotThreadSafe(size_t streamIndex);
+
+    /// Writes the queued chunks to the trace file until the capture is finished
+    void SpillThreadMain();
+
+    /// Validates the mapped trace file and locates its index
+    /// \return true if the mapped file is a valid trace file
+    bool ParseMappedFile();
+
+    mutable std::mutex                        m_mutex;             ///< mutex protecting the pool, the queue and the state shared with the spill thread
+    std::condition_variable                   m_chunkQueued;       ///< signaled when a chunk is queued or the capture is finished
+    std::condition_variable                   m_bufferReleased;    ///< signaled when a buffer returns to the pool or the spill fails
+    std::vector<std::unique_ptr<gpa_uint8[]>> m_buffers;           ///< the buffers of the pool
+    std::vector<gpa_uint8*>                   m_freeBuffers;       ///< the buffers of the pool which hold no data
+    std::deque<Chunk>                         m_queuedChunks;      ///< the chunks waiting to be written, in order
+    std::vector<Chunk>                        m_openChunks;        ///< the chunk being filled for each trace stream, indexed by stream id
+    std::vector<gpa_uint64>                   m_streamSizes;       ///< number of bytes added to each trace stream, indexed by stream id
+    std::vector<ChunkIndexEntry>              m_index;             ///< the index of the chunks written to the trace file
+    std::thread                               m_spillThread;       ///< thread writing the queued chunks to the trace file
+    std::ofstream                             m_traceFile;         ///< the trace file, while it is written
+    gpa_uint64                                m_traceFileSize;     ///< number of bytes written to the trace file
+    std::string                               m_traceFilePath;     ///< path of the trace file
+    bool                                      m_ownsTraceFile;     ///< flag indicating the trace file is deleted with the store
+    bool                                      m_isCapturing;       ///< flag indicating the producer may add trace data
+    bool                                      m_isSpillFinishing;  ///< flag indicating the spill thread should exit once the queue is empty
+    bool                                      m_hasSpillFailed;    ///< flag indicating the trace file could not be written
+    gpa_uint32                                m_chunkSize;         ///< size of the chunks, in bytes
+    size_t                                    m_maxBuffers;        ///< largest number of buffers in the pool
+    GPAMappedFile                             m_mappedTraceFile;   ///< the trace file, once it is readable
+    const ChunkIndexEntry*                    m_pMappedIndex;      ///< the index of the mapped trace file
+    gpa_uint32                                m_mappedChunkCount;  ///< number of chunks in the mapped trace file
+};
+
+#endif  // _GPA_SQTT_TRACE_STORE_H_
@@ -0,0 +1,163 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Delivery of the streaming counter records of a session, from the backend to the client, in time buckets
+//==============================================================================
+
+#include <algorithm>
+
+#include "gpa_streaming_counter_stream.h"
+
+const gpa_uint32 GPAStreamingCounterStream::MIN_BUFFERED_RECORDS;
+const gpa_uint32 GPAStreamingCounterStream::MAX_BUFFERED_RECORDS;
+
+GPAStreamingCounterStream::GPAStreamingCounterStream()
+    : m_numValues(0)
+    , m_numDroppedRecords(0)
+    , m_isFinished(false)
+    , m_hasPendingBucket(false)
+    , m_pendingBucket()
+    , m_numReportedDroppedRecords(0)
+{
+}
+
+bool GPAStreamingCounterStream::Initialize(gpa_uint32 numValues, gpa_uint64 memoryLimit)
+{
+    // each record is the timestamp followed by the counter values
+    gpa_uint64 recordSize = (static_cast<gpa_uint64>(numValues) + 1) * sizeof(gpa_uint64);
+    gpa_uint64 numRecords = std::min(memoryLimit / recordSize, static_cast<gpa_uint64>(MAX_BUFFERED_RECORDS));
+    numRecords            = std::max(numRecords, static_cast<gpa_uint64>(MIN_BUFFERED_RECORDS));
+
+    m_numValues = numValues;
+    m_numDroppedRecords.store(0, std::memory_order_relaxed);
+    m_isFinished.store(false, std::memory_order_relaxed);
+    m_hasPendingBucket          = false;
+    m_numReportedDroppedRecords = 0;
+    m_pendingValueSums.assign(numValues, 0);
+
+    // the record buffer of the previous capture is reused if it has the same shape
+    if (m_records.initialized() && m_records.getRecordLength() == numValues + 1 && m_records.getSize() >= numRecords)
+    {
+        m_records.clear();
+        return true;
+    }
+
+    return m_records.setSize(static_cast<unsigned int>(numRecords), numValues + 1);
+}
+
+gpa_uint32 GPAStreamingCounterStream::GetNumValues() const
+{
+    return m_numValues;
+}
+
+bool GPAStreamingCounterStream::AddRecord(gpa_uint64 timestamp, const gpa_uint64* pValues)
+{
+    if (!TryAddRecord(timestamp, pValues))
+    {
+        m_numDroppedRecords.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    return true;
+}
+
+bool GPAStreamingCounterStream::TryAddRecord(gpa_uint64 timestamp, const gpa_uint64* pValues)
+{
+    gpa_uint64* pRecord = m_records.lockNext();
+
+    if (nullptr == pRecord)
+    {
+        return false;
+    }
+
+    pRecord[0] = timestamp;
+    std::copy(pValues, pValues + m_numValues, pRecord + 1);
+    m_records.addLockedItem();
+
+    return true;
+}
+
+void GPAStreamingCounterStream::Finish()
+{
+    m_isFinished.store(true, std::memory_order_release);
+}
+
+bool GPAStreamingCounterStream::ReadBucket(gpa_uint64 bucketDuration, GPA_StreamingCounterBucket& bucket, gpa_uint64* pValueSums)
+{
+    if (0 == bucketDuration)
+    {
+        return false;
+    }
+
+    // read the flag before the records: once the producer has finished, all of its records are visible
+    bool isFinished   = m_isFinished.load(std::memory_order_acquire);
+    bool isBucketRead = false;
+
+    while (!isBucketRead)
+    {
+        const gpa_uint64* pRecord = m_records.getHead();
+
+        if (nullptr == pRecord)
+        {
+            // the last bucket is only complete once the producer has finished
+            isBucketRead = isFinished && m_hasPendingBucket;
+
+            if (!isBucketRead)
+            {
+                break;
+            }
+        }
+        else
+        {
+            gpa_uint64 bucketStart = pRecord[0] - pRecord[0] % bucketDuration;
+
+            // a record of a later bucket completes the pending one; it is kept in the buffer for the next call
+            isBucketRead = m_hasPendingBucket && bucketStart > m_pendingBucket.m_startTimestamp;
+
+            if (!isBucketRead)
+            {
+                if (!m_hasPendingBucket)
+                {
+                    m_hasPendingBucket               = true;
+                    m_pendingBucket.m_startTimestamp = bucketStart;
+                    m_pendingBucket.m_endTimestamp   = bucketStart + bucketDuration;
+                    m_pendingBucket.m_numRecords     = 0;
+                    std::fill(m_pendingValueSums.begin(), m_pendingValueSums.end(), 0);
+                }
+
+                // records which are out of order are accumulated in the pending bucket
+                for (gpa_uint32 valueIndex = 0; valueIndex < m_numValues; ++valueIndex)
+                {
+                    m_pendingValueSums[valueIndex] += pRecord[valueIndex + 1];
+                }
+
+                ++m_pendingBucket.m_numRecords;
+                m_records.erase();
+            }
+        }
+    }
+
+    if (isBucketRead)
+    {
+        gpa_uint64 numDroppedRecords        = m_numDroppedRecords.load(std::memory_order_relaxed);
+        m_pendingBucket.m_numDroppedRecords = numDroppedRecords - m_numReportedDroppedRecords;
+        m_numReportedDroppedRecords         = numDroppedRecords;
+        m_hasPendingBucket                  = false;
+
+        bucket = m_pendingBucket;
+        std::copy(m_pendingValueSums.cbegin(), m_pendingValueSums.cend(), pValueSums);
+    }
+
+    return isBucketRead;
+}
+
+bool GPAStreamingCounterStream::IsDrained() const
+{
+    return m_isFinished.load(std::memory_order_acquire) && !m_hasPendingBucket && nullptr == m_records.getHead();
+}
+
+size_t GPAStreamingCounterStream::GetMemoryUsage() const
+{
+    return static_cast<size_t>(m_records.getSize()) * m_records.getRecordLength() * sizeof(gpa_uint64) + m_pendingValueSums.capacity() * sizeof(gpa_uint64);
+}
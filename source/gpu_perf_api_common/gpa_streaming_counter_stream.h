@@ -0,0 +1,92 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Delivery of the streaming counter records of a session, from the backend to the client, in time buckets
+//==============================================================================
+
+#ifndef _GPA_STREAMING_COUNTER_STREAM_H_
+#define _GPA_STREAMING_COUNTER_STREAM_H_
+
+#include <atomic>
+#include <vector>
+
+#include "gpu_perf_api_types.h"
+#include "circular_buffer.h"
+
+/// The streaming counter records of a session.
+///
+/// A record holds the values of the hardware counters of the session over one sampling interval, along with the GPU
+/// timestamp at which they were sampled. The backend adds the records as it reads them from the GPU (the producer) while
+/// the client reads them in buckets of records whose timestamps fall within the same time range (the consumer), so a long
+/// capture only ever holds as many records in memory as fit in the bounded record buffer. Records added while the buffer
+/// is full are dropped and reported with the next bucket.
+/// The producer and the consumer can each be a different thread, but there can only be one of each at a time.
+class GPAStreamingCounterStream
+{
+public:
+    /// Smallest number of records held by the record buffer
+    static const gpa_uint32 MIN_BUFFERED_RECORDS = 64;
+
+    /// Largest number of records held by the record buffer
+    static const gpa_uint32 MAX_BUFFERED_RECORDS = 1 << 20;
+
+    /// Initializes a new instance of the GPAStreamingCounterStream class
+    GPAStreamingCounterStream();
+
+    /// Prepares the stream for a new capture, removing all the records of the previous one.
+    /// Must not be called while the producer or the consumer is using the stream.
+    /// \param[in] numValues the number of counter values in each record
+    /// \param[in] memoryLimit the largest number of bytes to use for the record buffer, clamped to the supported number of records
+    /// \return true if the record buffer could be allocated, false otherwise
+    bool Initialize(gpa_uint32 numValues, gpa_uint64 memoryLimit);
+
+    /// Gets the number of counter values in each record
+    /// \return the number of counter values in each record
+    gpa_uint32 GetNumValues() const;
+
+    /// Adds a record to the stream, or drops it if the record buffer is full. Must only be called by the producer.
+    /// \param[in] timestamp the GPU timestamp at which the values were sampled
+    /// \param[in] pValues the counter values, GetNumValues() of them, accumulated since the previous record
+    /// \return true if the record was added, false if it was dropped because the record buffer is full
+    bool AddRecord(gpa_uint64 timestamp, const gpa_uint64* pValues);
+
+    /// Adds a record to the stream if the record buffer is not full. Must only be called by the producer.
+    /// Unlike AddRecord, a record which could not be added is not counted as dropped, so the producer can try again later.
+    /// \param[in] timestamp the GPU timestamp at which the values were sampled
+    /// \param[in] pValues the counter values, GetNumValues() of them, accumulated since the previous record
+    /// \return true if the record was added, false if the record buffer is full
+    bool TryAddRecord(gpa_uint64 timestamp, const gpa_uint64* pValues);
+
+    /// Indicates that the producer will not add any more records to the stream, so the last bucket can be completed
+    void Finish();
+
+    /// Reads the next complete bucket of records from the stream. Must only be called by the consumer.
+    /// A bucket is complete once a record of a later bucket has been added, or once the producer has finished.
+    /// The same bucket duration should be used for all the buckets of a capture.
+    /// \param[in] bucketDuration the duration of each bucket, in GPU timestamp units, must not be zero
+    /// \param[out] bucket the time range and the number of records of the bucket
+    /// \param[out] pValueSums the sum of each counter value over the records of the bucket, GetNumValues() of them
+    /// \return true if a bucket was read, false if there is no complete bucket yet
+    bool ReadBucket(gpa_uint64 bucketDuration, GPA_StreamingCounterBucket& bucket, gpa_uint64* pValueSums);
+
+    /// Indicates whether all the records of the capture have been read. Must only be called by the consumer.
+    /// \return true if the producer has finished and all of its records have been read
+    bool IsDrained() const;
+
+    /// Estimates the number of bytes allocated by the stream
+    /// \return the number of bytes allocated for the record buffer and the bucket being read
+    size_t GetMemoryUsage() const;
+
+private:
+    ConcurrentCircularBuffer<gpa_uint64> m_records;                    ///< the records, each one a timestamp followed by m_numValues counter values
+    gpa_uint32                           m_numValues;                  ///< the number of counter values in each record
+    std::atomic<gpa_uint64>              m_numDroppedRecords;          ///< number of records dropped by the producer because the buffer was full
+    std::atomic<bool>                    m_isFinished;                 ///< flag indicating the producer will not add any more records
+    bool                                 m_hasPendingBucket;           ///< flag indicating the consumer has read records of a bucket which is not complete yet
+    GPA_StreamingCounterBucket           m_pendingBucket;              ///< the bucket which is not complete yet
+    std::vector<gpa_uint64>              m_pendingValueSums;           ///< the counter value sums of the bucket which is not complete yet
+    gpa_uint64                           m_numReportedDroppedRecords;  ///< number of dropped records already reported with a bucket
+};
+
+#endif  // _GPA_STREAMING_COUNTER_STREAM_H_
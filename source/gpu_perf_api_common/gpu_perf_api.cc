@@ -19,14 +19,19 @@
 // local
 #include "gpu_perf_api.h"
 #include "logging.h"
+#include "gpa_call_recorder.h"
+#include "gpa_call_capture.h"
 #include "gpa_profiler.h"
 #include "gpa_implementor_interface.h"
 #include "gpa_unique_object.h"
-#include "gpa_command_list_interface.h"
+#include "gpa_command_list.h"
 #include "gpa_context_interface.h"
 #include "gpa_session_interface.h"
 #include "gpa_version.h"
 #include "gpa_common_defs.h"
+#include "gpa_memory_tracker.h"
+#include "gpa_counter_statistics.h"
+#include "gpa_counter_generator.h"
 
 extern IGPAImplementor* s_pGpaImp;  ///< GPA implementor instance
 
@@ -102,6 +107,19 @@ extern IGPAImplementor* s_pGpaImp;  ///< GPA implementor instance
         return GPA_STATUS_ERROR_COMMAND_LIST_NOT_FOUND;  \
     }
 
+/// Macro to check if a counter statistics object exists
+#define CHECK_COUNTER_STATISTICS_ID_EXISTS(counterStatisticsId) \
+    if (!counterStatisticsId)                                   \
+    {                                                           \
+        GPA_LogError("Counter statistics object is null.");     \
+        return GPA_STATUS_ERROR_NULL_POINTER;                   \
+    }                                                           \
+    if (!GPACounterStatistics::FromId(counterStatisticsId))     \
+    {                                                           \
+        GPA_LogError("Unknown counter statistics object.");     \
+        return GPA_STATUS_ERROR_INVALID_PARAMETER;              \
+    }
+
 /// Macro to check if a session is still running
 #define CHECK_SESSION_RUNNING(sessionId)                                                               \
     if ((*sessionId)->IsSessionRunning())                                                              \
@@ -118,8 +136,6 @@ extern IGPAImplementor* s_pGpaImp;  ///< GPA implementor instance
         return GPA_STATUS_ERROR_CANNOT_CHANGE_COUNTERS_WHEN_SAMPLING;          \
     }
 
-#define MAKE_PARAM_STRING(X) #X << " : " << X << " "
-
 /// Validate that sample id exists in a pass
 /// \param[in] pPass The pass
 /// \param[in] sampleId The sample id
@@ -183,9 +199,7 @@ GPALIB_DECL GPA_Status GPA_GetVersion(gpa_uint32* pMajorVersion, gpa_uint32* pMi
         *pBuild         = GPA_BUILD_NUMBER;
         *pUpdateVersion = GPA_UPDATE_VERSION;
 
-        GPA_INTERNAL_LOG(GPA_GetVersion,
-                         MAKE_PARAM_STRING(*pMajorVersion)
-                             << MAKE_PARAM_STRING(*pMinorVersion) << MAKE_PARAM_STRING(*pBuild) << MAKE_PARAM_STRING(*pUpdateVersion));
+        GPA_RECORD_CALL(GPA_GetVersion, GPA_STATUS_OK, *pMajorVersion, *pMinorVersion, *pBuild, *pUpdateVersion);
 
         return GPA_STATUS_OK;
     }
@@ -232,12 +246,17 @@ GPALIB_DECL GPA_Status GPA_GetFuncTable(void* pGPAFuncTable)
 #include "GPAFunctions.h"
 #undef GPA_FUNCTION_PREFIX
 
+        if (g_callCapture.IsEnabled())
+        {
+            g_callCapture.WrapFunctionTable(gpaFuncTable);
+        }
+
         // if the client-supplied table is smaller than GPA's table,
         // this will only copy a subset of the table, ignoring the
         // functions at the end of the table
         memcpy(pFuncTable, &gpaFuncTable, clientSuppliedMinorVer);
 
-        GPA_INTERNAL_LOG(GPA_GetFuncTable, MAKE_PARAM_STRING(pGPAFuncTable));
+        GPA_RECORD_CALL(GPA_GetFuncTable, GPA_STATUS_OK, pGPAFuncTable);
 
         return GPA_STATUS_OK;
     }
@@ -279,7 +298,7 @@ GPALIB_DECL GPA_Status GPA_Initialize(GPA_InitializeFlags flags)
 
         GPA_Status retStatus = s_pGpaImp->Initialize(flags);
 
-        GPA_INTERNAL_LOG(GPA_Initialize, MAKE_PARAM_STRING(flags) << MAKE_PARAM_STRING(retStatus))
+        GPA_RECORD_CALL(GPA_Initialize, retStatus, flags);
 
         return retStatus;
     }
@@ -298,7 +317,7 @@ GPALIB_DECL GPA_Status GPA_Destroy()
         TRACE_FUNCTION(GPA_Destroy);
 
         GPA_Status retStatus = s_pGpaImp->Destroy();
-        GPA_INTERNAL_LOG(GPA_Destroy, MAKE_PARAM_STRING(retStatus));
+        GPA_RECORD_CALL(GPA_Destroy, retStatus);
 
         return retStatus;
     }
@@ -327,8 +346,7 @@ GPALIB_DECL GPA_Status GPA_OpenContext(void* pContext, GPA_OpenContextFlags flag
 
         GPA_Status retStatus = s_pGpaImp->OpenContext(pContext, flags, pContextId);
 
-        GPA_INTERNAL_LOG(GPA_OpenContext,
-                         MAKE_PARAM_STRING(pContext) << MAKE_PARAM_STRING(flags) << MAKE_PARAM_STRING(*pContextId) << MAKE_PARAM_STRING(retStatus));
+        GPA_RECORD_CALL(GPA_OpenContext, retStatus, pContext, flags, *pContextId);
 
         return retStatus;
     }
@@ -355,7 +373,7 @@ GPALIB_DECL GPA_Status GPA_CloseContext(GPA_ContextId contextId)
         }
 
         GPA_Status retStatus = s_pGpaImp->CloseContext(contextId);
-        GPA_INTERNAL_LOG(GPA_CloseContext, MAKE_PARAM_STRING(contextId) << MAKE_PARAM_STRING(retStatus));
+        GPA_RECORD_CALL(GPA_CloseContext, retStatus, contextId);
 
         return retStatus;
     }
@@ -405,8 +423,7 @@ GPALIB_DECL GPA_Status GPA_GetDeviceAndRevisionId(GPA_ContextId contextId, gpa_u
             retStatus = GPA_STATUS_OK;
         }
 
-        GPA_INTERNAL_LOG(GPA_GetDeviceAndRevisionId,
-                         MAKE_PARAM_STRING(contextId) << MAKE_PARAM_STRING(*pDeviceId) << MAKE_PARAM_STRING(*pRevisionId) << MAKE_PARAM_STRING(retStatus));
+        GPA_RECORD_CALL(GPA_GetDeviceAndRevisionId, retStatus, contextId, *pDeviceId, *pRevisionId);
 
         return retStatus;
     }
@@ -435,7 +452,7 @@ GPALIB_DECL GPA_Status GPA_GetDeviceName(GPA_ContextId contextId, const char** p
             retStatus = GPA_STATUS_OK;
         }
 
-        GPA_INTERNAL_LOG(GPA_GetDeviceAndRevisionId, MAKE_PARAM_STRING(contextId) << MAKE_PARAM_STRING(retStatus));
+        GPA_RECORD_CALL(GPA_GetDeviceName, retStatus, contextId);
 
         return retStatus;
     }
@@ -458,7 +475,7 @@ GPALIB_DECL GPA_Status GPA_GetNumCounters(GPA_ContextId contextId, gpa_uint32* p
 
         GPA_Status retStatus = (*contextId)->GetNumCounters(pCount);
 
-        GPA_INTERNAL_LOG(GPA_GetNumCounters, MAKE_PARAM_STRING(contextId) << MAKE_PARAM_STRING(*pCount) << MAKE_PARAM_STRING(retStatus));
+        GPA_RECORD_CALL(GPA_GetNumCounters, retStatus, contextId, *pCount);
 
         return retStatus;
     }
@@ -619,6 +636,32 @@ GPALIB_DECL GPA_Status GPA_GetCounterUuid(GPA_ContextId contextId, gpa_uint32 in
     }
 }
 
+//-----------------------------------------------------------------------------
+GPALIB_DECL GPA_Status GPA_GetCounterIndexByUuid(GPA_ContextId contextId, const GPA_UUID* pCounterUuid, gpa_uint32* pIndex)
+{
+    try
+    {
+        PROFILE_FUNCTION(GPA_GetCounterIndexByUuid);
+        TRACE_FUNCTION(GPA_GetCounterIndexByUuid);
+
+        CHECK_NULL_PARAM(pCounterUuid);
+        CHECK_NULL_PARAM(pIndex);
+        CHECK_CONTEXT_ID_EXISTS_AND_IS_OPEN(contextId);
+
+        if (GPA_STATUS_OK != (*contextId)->GetCounterIndexByUuid(pCounterUuid, pIndex))
+        {
+            GPA_LogError("Specified counter UUID was not found. Please check availability.");
+            return GPA_STATUS_ERROR_COUNTER_NOT_FOUND;
+        }
+
+        return GPA_STATUS_OK;
+    }
+    catch (...)
+    {
+        return GPA_STATUS_ERROR_EXCEPTION;
+    }
+}
+
 //-----------------------------------------------------------------------------
 GPALIB_DECL GPA_Status GPA_GetCounterSampleType(GPA_ContextId contextId, gpa_uint32 index, GPA_Counter_Sample_Type* pCounterSampleType)
 {
@@ -755,8 +798,7 @@ GPALIB_DECL GPA_Status GPA_CreateSession(GPA_ContextId contextId, GPA_Session_Sa
         *pSessionId          = (*contextId)->CreateSession(sampleType);
         GPA_Status retStatus = (nullptr != (*pSessionId)) ? GPA_STATUS_OK : GPA_STATUS_ERROR_FAILED;
 
-        GPA_INTERNAL_LOG(GPA_CreateSession,
-                         MAKE_PARAM_STRING(contextId) << MAKE_PARAM_STRING(sampleType) << MAKE_PARAM_STRING(*pSessionId) << MAKE_PARAM_STRING(retStatus));
+        GPA_RECORD_CALL(GPA_CreateSession, retStatus, contextId, sampleType, *pSessionId);
 
         return retStatus;
     }
@@ -779,7 +821,7 @@ GPALIB_DECL GPA_Status GPA_DeleteSession(GPA_SessionId sessionId)
         IGPAContext* pContextId = (*sessionId)->GetParentContext();
         GPA_Status   retStatus  = pContextId->DeleteSession(sessionId) ? GPA_STATUS_OK : GPA_STATUS_ERROR_FAILED;
 
-        GPA_INTERNAL_LOG(GPA_DeleteSession, MAKE_PARAM_STRING(sessionId) << MAKE_PARAM_STRING(retStatus));
+        GPA_RECORD_CALL(GPA_DeleteSession, retStatus, sessionId);
 
         return retStatus;
     }
@@ -804,7 +846,7 @@ GPALIB_DECL GPA_Status GPA_BeginSession(GPA_SessionId sessionId)
 
         GPA_Status retStatus = pContext->BeginSession(pGpaSession);
 
-        GPA_INTERNAL_LOG(GPA_BeginSession, MAKE_PARAM_STRING(sessionId) << MAKE_PARAM_STRING(retStatus));
+        GPA_RECORD_CALL(GPA_BeginSession, retStatus, sessionId);
 
         return retStatus;
     }
@@ -829,7 +871,51 @@ GPALIB_DECL GPA_Status GPA_EndSession(GPA_SessionId sessionId)
 
         GPA_Status retStatus = pContext->EndSession(pGpaSession);
 
-        GPA_INTERNAL_LOG(GPA_EndSession, MAKE_PARAM_STRING(sessionId) << MAKE_PARAM_STRING(retStatus));
+        GPA_RECORD_CALL(GPA_EndSession, retStatus, sessionId);
+
+        return retStatus;
+    }
+    catch (...)
+    {
+        return GPA_STATUS_ERROR_EXCEPTION;
+    }
+}
+
+//-----------------------------------------------------------------------------
+GPALIB_DECL GPA_Status GPA_ResetSession(GPA_SessionId sessionId)
+{
+    try
+    {
+        PROFILE_FUNCTION(GPA_ResetSession);
+        TRACE_FUNCTION(GPA_ResetSession);
+
+        CHECK_SESSION_ID_EXISTS(sessionId);
+
+        GPA_Status retStatus = (*sessionId)->Reset();
+
+        GPA_RECORD_CALL(GPA_ResetSession, retStatus, sessionId);
+
+        return retStatus;
+    }
+    catch (...)
+    {
+        return GPA_STATUS_ERROR_EXCEPTION;
+    }
+}
+
+//-----------------------------------------------------------------------------
+GPALIB_DECL GPA_Status GPA_SetSessionMaxSampleIdHint(GPA_SessionId sessionId, gpa_uint32 maxSampleId)
+{
+    try
+    {
+        PROFILE_FUNCTION(GPA_SetSessionMaxSampleIdHint);
+        TRACE_FUNCTION(GPA_SetSessionMaxSampleIdHint);
+
+        CHECK_SESSION_ID_EXISTS(sessionId);
+
+        GPA_Status retStatus = (*sessionId)->SetMaxSampleIdHint(maxSampleId);
+
+        GPA_RECORD_CALL(GPA_SetSessionMaxSampleIdHint, retStatus, sessionId, maxSampleId);
 
         return retStatus;
     }
@@ -853,7 +939,7 @@ GPALIB_DECL GPA_Status GPA_EnableCounter(GPA_SessionId sessionId, gpa_uint32 ind
 
         GPA_Status retStatus = (*sessionId)->EnableCounter(index);
 
-        GPA_INTERNAL_LOG(GPA_EnableCounter, MAKE_PARAM_STRING(sessionId) << MAKE_PARAM_STRING(retStatus));
+        GPA_RECORD_CALL(GPA_EnableCounter, retStatus, sessionId);
 
         return retStatus;
     }
@@ -877,7 +963,7 @@ GPALIB_DECL GPA_Status GPA_DisableCounter(GPA_SessionId sessionId, gpa_uint32 in
 
         GPA_Status retStatus = (*sessionId)->DisableCounter(index);
 
-        GPA_INTERNAL_LOG(GPA_DisableCounter, MAKE_PARAM_STRING(sessionId) << MAKE_PARAM_STRING(index) << MAKE_PARAM_STRING(retStatus));
+        GPA_RECORD_CALL(GPA_DisableCounter, retStatus, sessionId, index);
 
         return retStatus;
     }
@@ -984,7 +1070,7 @@ GPALIB_DECL GPA_Status GPA_EnableAllCounters(GPA_SessionId sessionId)
             }
         }
 
-        GPA_INTERNAL_LOG(GPA_EnableAllCounters, MAKE_PARAM_STRING(sessionId) << MAKE_PARAM_STRING(retStatus));
+        GPA_RECORD_CALL(GPA_EnableAllCounters, retStatus, sessionId);
 
         return retStatus;
     }
@@ -1008,7 +1094,7 @@ GPALIB_DECL GPA_Status GPA_DisableAllCounters(GPA_SessionId sessionId)
 
         GPA_Status retStatus = (*sessionId)->DisableAllCounters();
 
-        GPA_INTERNAL_LOG(GPA_DisableAllCounters, MAKE_PARAM_STRING(sessionId) << MAKE_PARAM_STRING(retStatus));
+        GPA_RECORD_CALL(GPA_DisableAllCounters, retStatus, sessionId);
 
         return retStatus;
     }
@@ -1031,7 +1117,7 @@ GPALIB_DECL GPA_Status GPA_GetPassCount(GPA_SessionId sessionId, gpa_uint32* pNu
         CHECK_CONTEXT_IS_OPEN((*sessionId)->GetParentContext());
         GPA_Status retStatus = (*sessionId)->GetNumRequiredPasses(pNumPasses);
 
-        GPA_INTERNAL_LOG(GPA_GetPassCount, MAKE_PARAM_STRING(sessionId) << MAKE_PARAM_STRING(*pNumPasses) << MAKE_PARAM_STRING(retStatus));
+        GPA_RECORD_CALL(GPA_GetPassCount, retStatus, sessionId, *pNumPasses);
 
         return retStatus;
     }
@@ -1054,7 +1140,7 @@ GPALIB_DECL GPA_Status GPA_GetNumEnabledCounters(GPA_SessionId sessionId, gpa_ui
         CHECK_CONTEXT_IS_OPEN((*sessionId)->GetParentContext());
         GPA_Status retStatus = (*sessionId)->GetNumEnabledCounters(pCount);
 
-        GPA_INTERNAL_LOG(GPA_GetNumEnabledCounters, MAKE_PARAM_STRING(sessionId) << MAKE_PARAM_STRING(*pCount) << MAKE_PARAM_STRING(retStatus));
+        GPA_RECORD_CALL(GPA_GetNumEnabledCounters, retStatus, sessionId, *pCount);
 
         return retStatus;
     }
@@ -1184,9 +1270,7 @@ GPALIB_DECL GPA_Status GPA_BeginCommandList(GPA_SessionId         sessionId,
 
         GPA_Status retStatus = status ? GPA_STATUS_OK : GPA_STATUS_ERROR_FAILED;
 
-        GPA_INTERNAL_LOG(GPA_BeginCommandList,
-                         MAKE_PARAM_STRING(sessionId) << MAKE_PARAM_STRING(passIndex) << MAKE_PARAM_STRING(pCommandList) << MAKE_PARAM_STRING(commandListType)
-                                                      << MAKE_PARAM_STRING(*pCommandListId) << MAKE_PARAM_STRING(retStatus));
+        GPA_RECORD_CALL(GPA_BeginCommandList, retStatus, sessionId, passIndex, pCommandList, commandListType, *pCommandListId);
 
         return retStatus;
     }
@@ -1214,7 +1298,7 @@ GPALIB_DECL GPA_Status GPA_EndCommandList(GPA_CommandListId commandListId)
 
         GPA_Status retStatus = (*commandListId)->End() ? GPA_STATUS_OK : GPA_STATUS_ERROR_FAILED;
 
-        GPA_INTERNAL_LOG(GPA_EndCommandList, MAKE_PARAM_STRING(commandListId) << MAKE_PARAM_STRING(retStatus));
+        GPA_RECORD_CALL(GPA_EndCommandList, retStatus, commandListId);
 
         return retStatus;
     }
@@ -1253,7 +1337,7 @@ GPALIB_DECL GPA_Status GPA_BeginSample(gpa_uint32 sampleId, GPA_CommandListId co
             }
         }
 
-        GPA_INTERNAL_LOG(GPA_BeginSample, MAKE_PARAM_STRING(sampleId) << MAKE_PARAM_STRING(commandListId) << MAKE_PARAM_STRING(retStatus));
+        GPA_RECORD_CALL(GPA_BeginSample, retStatus, sampleId, commandListId);
 
         return retStatus;
     }
@@ -1292,7 +1376,138 @@ GPALIB_DECL GPA_Status GPA_EndSample(GPA_CommandListId commandListId)
             }
         }
 
-        GPA_INTERNAL_LOG(GPA_EndSample, MAKE_PARAM_STRING(commandListId) << MAKE_PARAM_STRING(retStatus));
+        GPA_RECORD_CALL(GPA_EndSample, retStatus, commandListId);
+
+        return retStatus;
+    }
+    catch (...)
+    {
+        return GPA_STATUS_ERROR_EXCEPTION;
+    }
+}
+
+//-----------------------------------------------------------------------------
+GPALIB_DECL GPA_Status GPA_BeginSampleBlock(GPA_CommandListId  commandListId,
+                                            gpa_uint32         firstSampleId,
+                                            gpa_uint32         numSamples,
+                                            GPA_SampleBlockId* pSampleBlockId)
+{
+    try
+    {
+        PROFILE_FUNCTION(GPA_BeginSampleBlock);
+        TRACE_FUNCTION(GPA_BeginSampleBlock);
+
+        CHECK_COMMANDLIST_ID_EXISTS(commandListId);
+        CHECK_NULL_PARAM(pSampleBlockId);
+        *pSampleBlockId = nullptr;
+
+        if (0 == numSamples || firstSampleId > GPA_UINT32_MAX - (numSamples - 1))
+        {
+            GPA_LogError("Invalid number of samples in the sample block.");
+            return GPA_STATUS_ERROR_INVALID_PARAMETER;
+        }
+
+        GPA_Status retStatus = GPA_STATUS_OK;
+
+        // Only begin the sample block if the current pass index is valid
+        gpa_uint32 numRequiredPasses = 0;
+        retStatus                    = (*commandListId)->GetParentSession()->GetNumRequiredPasses(&numRequiredPasses);
+
+        if (GPA_STATUS_OK == retStatus)
+        {
+            if ((*commandListId)->GetPass()->GetIndex() < numRequiredPasses)
+            {
+                GPASampleBlock* pSampleBlock = (*commandListId)->BeginSampleBlock(firstSampleId, numSamples);
+
+                if (nullptr != pSampleBlock)
+                {
+                    *pSampleBlockId = pSampleBlock;
+                }
+                else
+                {
+                    retStatus = GPA_STATUS_ERROR_FAILED;
+                }
+            }
+            else
+            {
+                GPA_LogError("Invalid pass index.");
+                retStatus = GPA_STATUS_ERROR_INDEX_OUT_OF_RANGE;
+            }
+        }
+
+        GPA_RECORD_CALL(GPA_BeginSampleBlock, retStatus, commandListId, firstSampleId, numSamples, *pSampleBlockId);
+
+        return retStatus;
+    }
+    catch (...)
+    {
+        return GPA_STATUS_ERROR_EXCEPTION;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// GPA_BeginBlockSample and GPA_EndBlockSample are called once per sample, possibly for every draw call, so unlike the other
+// entry points they are neither profiled, traced nor logged, and the sample block id is trusted: all the validation was
+// done by GPA_BeginSampleBlock.
+GPALIB_DECL GPA_Status GPA_BeginBlockSample(GPA_SampleBlockId sampleBlockId)
+{
+    try
+    {
+        CHECK_NULL_PARAM(sampleBlockId);
+
+        return static_cast<GPASampleBlock*>(sampleBlockId)->BeginNextSample();
+    }
+    catch (...)
+    {
+        return GPA_STATUS_ERROR_EXCEPTION;
+    }
+}
+
+//-----------------------------------------------------------------------------
+GPALIB_DECL GPA_Status GPA_EndBlockSample(GPA_SampleBlockId sampleBlockId)
+{
+    try
+    {
+        CHECK_NULL_PARAM(sampleBlockId);
+
+        return static_cast<GPASampleBlock*>(sampleBlockId)->EndSample();
+    }
+    catch (...)
+    {
+        return GPA_STATUS_ERROR_EXCEPTION;
+    }
+}
+
+//-----------------------------------------------------------------------------
+GPALIB_DECL GPA_Status GPA_EndSampleBlock(GPA_SampleBlockId sampleBlockId)
+{
+    try
+    {
+        PROFILE_FUNCTION(GPA_EndSampleBlock);
+        TRACE_FUNCTION(GPA_EndSampleBlock);
+
+        CHECK_NULL_PARAM(sampleBlockId);
+
+        // unlike the samples of the block, the block itself is validated, as it is dereferenced once per block only
+        GPASampleBlock* pSampleBlock = GPASampleBlock::FromId(sampleBlockId);
+
+        if (nullptr == pSampleBlock)
+        {
+            GPA_LogError("Unknown sample block object.");
+            return GPA_STATUS_ERROR_INVALID_PARAMETER;
+        }
+
+        GPACommandList* pCmdList = pSampleBlock->GetCmdList();
+
+        if (!GPAUniqueObjectManager::Instance()->DoesExist(pCmdList) || !pCmdList->DoesSampleBlockExist(pSampleBlock))
+        {
+            GPA_LogError("The command list of the sample block does not exist.");
+            return GPA_STATUS_ERROR_COMMAND_LIST_NOT_FOUND;
+        }
+
+        GPA_Status retStatus = pCmdList->EndSampleBlock(pSampleBlock) ? GPA_STATUS_OK : GPA_STATUS_ERROR_FAILED;
+
+        GPA_RECORD_CALL(GPA_EndSampleBlock, retStatus, sampleBlockId);
 
         return retStatus;
     }
@@ -1326,8 +1541,7 @@ GPALIB_DECL GPA_Status GPA_ContinueSampleOnCommandList(gpa_uint32 srcSampleId, G
 
         retStatus = ((*primaryCommandListId)->GetParentSession()->ContinueSampleOnCommandList(srcSampleId, primaryCommandListId));
 
-        GPA_INTERNAL_LOG(GPA_ContinueSampleOnCommandList,
-                         MAKE_PARAM_STRING(srcSampleId) << MAKE_PARAM_STRING(primaryCommandListId) << MAKE_PARAM_STRING(retStatus));
+        GPA_RECORD_CALL(GPA_ContinueSampleOnCommandList, retStatus, srcSampleId, primaryCommandListId);
 
         return retStatus;
     }
@@ -1360,9 +1574,7 @@ GPALIB_DECL GPA_Status GPA_CopySecondarySamples(GPA_CommandListId secondaryComma
         GPA_Status retStatus =
             ((*primaryCommandListId)->GetParentSession()->CopySecondarySamples(secondaryCommandListId, primaryCommandListId, numSamples, pNewSampleIds));
 
-        GPA_INTERNAL_LOG(GPA_CopySecondarySamples,
-                         MAKE_PARAM_STRING(secondaryCommandListId) << MAKE_PARAM_STRING(primaryCommandListId) << MAKE_PARAM_STRING(numSamples)
-                                                                   << MAKE_PARAM_STRING(*pNewSampleIds) << MAKE_PARAM_STRING(retStatus));
+        GPA_RECORD_CALL(GPA_CopySecondarySamples, retStatus, secondaryCommandListId, primaryCommandListId, numSamples, *pNewSampleIds);
 
         return retStatus;
     }
@@ -1386,7 +1598,7 @@ GPALIB_DECL GPA_Status GPA_GetSampleCount(GPA_SessionId sessionId, gpa_uint32* p
 
         *pSampleCount = (*sessionId)->GetSampleCount();
 
-        GPA_INTERNAL_LOG(GPA_GetSampleCount, MAKE_PARAM_STRING(sessionId) << MAKE_PARAM_STRING(*pSampleCount));
+        GPA_RECORD_CALL(GPA_GetSampleCount, GPA_STATUS_OK, sessionId, *pSampleCount);
 
         return GPA_STATUS_OK;
     }
@@ -1418,8 +1630,7 @@ GPALIB_DECL GPA_Status GPA_GetSampleId(GPA_SessionId sessionId, gpa_uint32 index
             retStatus  = GPA_STATUS_OK;
         }
 
-        GPA_INTERNAL_LOG(GPA_GetSampleId,
-                         MAKE_PARAM_STRING(sessionId) << MAKE_PARAM_STRING(index) << MAKE_PARAM_STRING(*pSampleId) << MAKE_PARAM_STRING(retStatus));
+        GPA_RECORD_CALL(GPA_GetSampleId, retStatus, sessionId, index, *pSampleId);
 
         return retStatus;
     }
@@ -1456,7 +1667,7 @@ GPALIB_DECL GPA_Status GPA_IsSessionComplete(GPA_SessionId sessionId)
             retStatus = GPA_STATUS_OK;
         }
 
-        GPA_INTERNAL_LOG(GPA_IsSessionComplete, MAKE_PARAM_STRING(sessionId) << MAKE_PARAM_STRING(retStatus));
+        GPA_RECORD_CALL(GPA_IsSessionComplete, retStatus, sessionId);
 
         return retStatus;
     }
@@ -1498,7 +1709,7 @@ GPALIB_DECL GPA_Status GPA_IsPassComplete(GPA_SessionId sessionId, gpa_uint32 pa
             }
         }
 
-        GPA_INTERNAL_LOG(GPA_IsSessionComplete, MAKE_PARAM_STRING(sessionId) << MAKE_PARAM_STRING(passIndex) << MAKE_PARAM_STRING(retStatus));
+        GPA_RECORD_CALL(GPA_IsPassComplete, retStatus, sessionId, passIndex);
 
         return retStatus;
     }
@@ -1530,9 +1741,7 @@ GPALIB_DECL GPA_Status GPA_GetSampleResultSize(GPA_SessionId sessionId, gpa_uint
 
         *pSampleResultSizeInBytes = (*sessionId)->GetSampleResultSizeInBytes(sampleId);
 
-        GPA_INTERNAL_LOG(
-            GPA_GetSampleResultSize,
-            MAKE_PARAM_STRING(sessionId) << MAKE_PARAM_STRING(sampleId) << MAKE_PARAM_STRING(*pSampleResultSizeInBytes) << MAKE_PARAM_STRING(retStatus));
+        GPA_RECORD_CALL(GPA_GetSampleResultSize, retStatus, sessionId, sampleId, *pSampleResultSizeInBytes);
 
         return retStatus;
     }
@@ -1564,9 +1773,45 @@ GPALIB_DECL GPA_Status GPA_GetSampleResult(GPA_SessionId sessionId, gpa_uint32 s
 
         retStatus = (*sessionId)->GetSampleResult(sampleId, sampleResultSizeInBytes, pCounterSampleResults);
 
-        GPA_INTERNAL_LOG(GPA_GetSampleResult,
-                         MAKE_PARAM_STRING(sessionId) << MAKE_PARAM_STRING(sampleId) << MAKE_PARAM_STRING(sampleResultSizeInBytes)
-                                                      << MAKE_PARAM_STRING(pCounterSampleResults) << MAKE_PARAM_STRING(retStatus));
+        GPA_RECORD_CALL(GPA_GetSampleResult, retStatus, sessionId, sampleId, sampleResultSizeInBytes, pCounterSampleResults);
+
+        return retStatus;
+    }
+    catch (...)
+    {
+        return GPA_STATUS_ERROR_EXCEPTION;
+    }
+}
+
+//-----------------------------------------------------------------------------
+GPALIB_DECL GPA_Status GPA_GetPartialSampleResult(GPA_SessionId sessionId,
+                                                  gpa_uint32    sampleId,
+                                                  size_t        sampleResultSizeInBytes,
+                                                  void*         pCounterSampleResults,
+                                                  gpa_uint8*    pCounterResultAvailable)
+{
+    try
+    {
+        PROFILE_FUNCTION(GPA_GetPartialSampleResult);
+        TRACE_FUNCTION(GPA_GetPartialSampleResult);
+
+        GPA_Status retStatus = GPA_STATUS_OK;
+
+        CHECK_NULL_PARAM(pCounterSampleResults);
+        CHECK_NULL_PARAM(pCounterResultAvailable);
+        CHECK_SESSION_ID_EXISTS(sessionId);
+
+        if ((retStatus = CheckSampleIdExistsInSession(sessionId, sampleId)) != GPA_STATUS_OK)
+        {
+            return retStatus;
+        }
+
+        CHECK_SESSION_RUNNING(sessionId);
+
+        retStatus = (*sessionId)->GetPartialSampleResult(sampleId, sampleResultSizeInBytes, pCounterSampleResults, pCounterResultAvailable);
+
+        GPA_RECORD_CALL(
+            GPA_GetPartialSampleResult, retStatus, sessionId, sampleId, sampleResultSizeInBytes, pCounterSampleResults, pCounterResultAvailable);
 
         return retStatus;
     }
@@ -1576,6 +1821,314 @@ GPALIB_DECL GPA_Status GPA_GetSampleResult(GPA_SessionId sessionId, gpa_uint32 s
     }
 }
 
+//-----------------------------------------------------------------------------
+GPALIB_DECL GPA_Status GPA_GetSessionResultsByCounter(GPA_SessionId sessionId, size_t resultsSizeInBytes, void* pCounterResults)
+{
+    try
+    {
+        PROFILE_FUNCTION(GPA_GetSessionResultsByCounter);
+        TRACE_FUNCTION(GPA_GetSessionResultsByCounter);
+
+        GPA_Status retStatus = GPA_STATUS_OK;
+
+        CHECK_NULL_PARAM(pCounterResults);
+        CHECK_SESSION_ID_EXISTS(sessionId);
+
+        if (GPASessionState::GPA_SESSION_STATE_NOT_STARTED == (*sessionId)->GetState())
+        {
+            GPA_LogError("Session has not been started.");
+            return GPA_STATUS_ERROR_SESSION_NOT_STARTED;
+        }
+
+        CHECK_SESSION_RUNNING(sessionId);
+
+        retStatus = (*sessionId)->GetSessionResultsByCounter(resultsSizeInBytes, pCounterResults);
+
+        GPA_RECORD_CALL(GPA_GetSessionResultsByCounter, retStatus, sessionId, resultsSizeInBytes, pCounterResults);
+
+        return retStatus;
+    }
+    catch (...)
+    {
+        return GPA_STATUS_ERROR_EXCEPTION;
+    }
+}
+
+//-----------------------------------------------------------------------------
+GPALIB_DECL GPA_Status GPA_GetStreamingCounterResults(GPA_SessionId               sessionId,
+                                                      gpa_uint64                  bucketDuration,
+                                                      gpa_uint32                  maxBuckets,
+                                                      GPA_StreamingCounterBucket* pBuckets,
+                                                      void*                       pCounterResults,
+                                                      gpa_uint32*                 pNumBuckets)
+{
+    try
+    {
+        PROFILE_FUNCTION(GPA_GetStreamingCounterResults);
+        TRACE_FUNCTION(GPA_GetStreamingCounterResults);
+
+        CHECK_NULL_PARAM(pBuckets);
+        CHECK_NULL_PARAM(pCounterResults);
+        CHECK_NULL_PARAM(pNumBuckets);
+        CHECK_SESSION_ID_EXISTS(sessionId);
+
+        if (0 == bucketDuration)
+        {
+            GPA_LogError("Unable to get streaming counter results: the bucket duration must not be zero.");
+            return GPA_STATUS_ERROR_INVALID_PARAMETER;
+        }
+
+        if (GPASessionState::GPA_SESSION_STATE_NOT_STARTED == (*sessionId)->GetState())
+        {
+            GPA_LogError("Session has not been started.");
+            return GPA_STATUS_ERROR_SESSION_NOT_STARTED;
+        }
+
+        GPA_Status retStatus = (*sessionId)->GetStreamingCounterResults(bucketDuration, maxBuckets, pBuckets, pCounterResults, pNumBuckets);
+
+        GPA_RECORD_CALL(GPA_GetStreamingCounterResults, retStatus, sessionId, bucketDuration, maxBuckets, pBuckets, pCounterResults, *pNumBuckets);
+
+        return retStatus;
+    }
+    catch (...)
+    {
+        return GPA_STATUS_ERROR_EXCEPTION;
+    }
+}
+
+//-----------------------------------------------------------------------------
+GPALIB_DECL GPA_Status GPA_GetSQTTChunkCount(GPA_SessionId sessionId, gpa_uint32* pChunkCount)
+{
+    try
+    {
+        PROFILE_FUNCTION(GPA_GetSQTTChunkCount);
+        TRACE_FUNCTION(GPA_GetSQTTChunkCount);
+
+        CHECK_NULL_PARAM(pChunkCount);
+        CHECK_SESSION_ID_EXISTS(sessionId);
+
+        GPA_Status retStatus = (*sessionId)->GetSQTTChunkCount(pChunkCount);
+
+        GPA_RECORD_CALL(GPA_GetSQTTChunkCount, retStatus, sessionId, pChunkCount);
+
+        return retStatus;
+    }
+    catch (...)
+    {
+        return GPA_STATUS_ERROR_EXCEPTION;
+    }
+}
+
+//-----------------------------------------------------------------------------
+GPALIB_DECL GPA_Status GPA_GetSQTTChunk(GPA_SessionId sessionId, gpa_uint32 chunkIndex, GPA_SQTTChunkView* pChunkView)
+{
+    try
+    {
+        PROFILE_FUNCTION(GPA_GetSQTTChunk);
+        TRACE_FUNCTION(GPA_GetSQTTChunk);
+
+        CHECK_NULL_PARAM(pChunkView);
+        CHECK_SESSION_ID_EXISTS(sessionId);
+
+        GPA_Status retStatus = (*sessionId)->GetSQTTChunk(chunkIndex, pChunkView);
+
+        GPA_RECORD_CALL(GPA_GetSQTTChunk, retStatus, sessionId, chunkIndex, pChunkView);
+
+        return retStatus;
+    }
+    catch (...)
+    {
+        return GPA_STATUS_ERROR_EXCEPTION;
+    }
+}
+
+//-----------------------------------------------------------------------------
+GPALIB_DECL GPA_Status GPA_CreateCounterStatistics(GPA_CounterStatisticsId* pCounterStatisticsId)
+{
+    try
+    {
+        PROFILE_FUNCTION(GPA_CreateCounterStatistics);
+        TRACE_FUNCTION(GPA_CreateCounterStatistics);
+
+        CHECK_NULL_PARAM(pCounterStatisticsId);
+
+        GPACounterStatistics* pStatistics = GPACounterStatistics::Create();
+        GPA_Status            retStatus   = GPA_STATUS_ERROR_FAILED;
+
+        if (nullptr != pStatistics)
+        {
+            *pCounterStatisticsId = pStatistics;
+            retStatus             = GPA_STATUS_OK;
+        }
+
+        GPA_RECORD_CALL(GPA_CreateCounterStatistics, retStatus, *pCounterStatisticsId);
+
+        return retStatus;
+    }
+    catch (...)
+    {
+        return GPA_STATUS_ERROR_EXCEPTION;
+    }
+}
+
+//-----------------------------------------------------------------------------
+GPALIB_DECL GPA_Status GPA_DeleteCounterStatistics(GPA_CounterStatisticsId counterStatisticsId)
+{
+    try
+    {
+        PROFILE_FUNCTION(GPA_DeleteCounterStatistics);
+        TRACE_FUNCTION(GPA_DeleteCounterStatistics);
+
+        CHECK_COUNTER_STATISTICS_ID_EXISTS(counterStatisticsId);
+
+        GPACounterStatistics::Delete(static_cast<GPACounterStatistics*>(counterStatisticsId));
+
+        GPA_RECORD_CALL(GPA_DeleteCounterStatistics, GPA_STATUS_OK, counterStatisticsId);
+
+        return GPA_STATUS_OK;
+    }
+    catch (...)
+    {
+        return GPA_STATUS_ERROR_EXCEPTION;
+    }
+}
+
+//-----------------------------------------------------------------------------
+GPALIB_DECL GPA_Status GPA_AccumulateCounterStatistics(GPA_CounterStatisticsId counterStatisticsId, GPA_SessionId sessionId)
+{
+    try
+    {
+        PROFILE_FUNCTION(GPA_AccumulateCounterStatistics);
+        TRACE_FUNCTION(GPA_AccumulateCounterStatistics);
+
+        CHECK_COUNTER_STATISTICS_ID_EXISTS(counterStatisticsId);
+        CHECK_SESSION_ID_EXISTS(sessionId);
+
+        if (GPASessionState::GPA_SESSION_STATE_NOT_STARTED == (*sessionId)->GetState())
+        {
+            GPA_LogError("Session has not been started.");
+            return GPA_STATUS_ERROR_SESSION_NOT_STARTED;
+        }
+
+        CHECK_SESSION_RUNNING(sessionId);
+
+        GPA_Status retStatus = (*sessionId)->AccumulateCounterStatistics(static_cast<GPACounterStatistics*>(counterStatisticsId));
+
+        GPA_RECORD_CALL(GPA_AccumulateCounterStatistics, retStatus, counterStatisticsId, sessionId);
+
+        return retStatus;
+    }
+    catch (...)
+    {
+        return GPA_STATUS_ERROR_EXCEPTION;
+    }
+}
+
+//-----------------------------------------------------------------------------
+GPALIB_DECL GPA_Status GPA_MergeCounterStatistics(GPA_CounterStatisticsId destinationCounterStatisticsId, GPA_CounterStatisticsId sourceCounterStatisticsId)
+{
+    try
+    {
+        PROFILE_FUNCTION(GPA_MergeCounterStatistics);
+        TRACE_FUNCTION(GPA_MergeCounterStatistics);
+
+        CHECK_COUNTER_STATISTICS_ID_EXISTS(destinationCounterStatisticsId);
+        CHECK_COUNTER_STATISTICS_ID_EXISTS(sourceCounterStatisticsId);
+
+        if (destinationCounterStatisticsId == sourceCounterStatisticsId)
+        {
+            GPA_LogError("Counter statistics cannot be merged into themselves.");
+            return GPA_STATUS_ERROR_INVALID_PARAMETER;
+        }
+
+        static_cast<GPACounterStatistics*>(destinationCounterStatisticsId)->Merge(*static_cast<GPACounterStatistics*>(sourceCounterStatisticsId));
+
+        GPA_RECORD_CALL(GPA_MergeCounterStatistics, GPA_STATUS_OK, destinationCounterStatisticsId, sourceCounterStatisticsId);
+
+        return GPA_STATUS_OK;
+    }
+    catch (...)
+    {
+        return GPA_STATUS_ERROR_EXCEPTION;
+    }
+}
+
+//-----------------------------------------------------------------------------
+GPALIB_DECL GPA_Status GPA_GetCounterStatistics(GPA_CounterStatisticsId counterStatisticsId, gpa_uint32 counterIndex, GPA_CounterStatistics* pCounterStatistics)
+{
+    try
+    {
+        PROFILE_FUNCTION(GPA_GetCounterStatistics);
+        TRACE_FUNCTION(GPA_GetCounterStatistics);
+
+        CHECK_NULL_PARAM(pCounterStatistics);
+        CHECK_COUNTER_STATISTICS_ID_EXISTS(counterStatisticsId);
+
+        GPA_Status retStatus = GPA_STATUS_OK;
+
+        if (!static_cast<GPACounterStatistics*>(counterStatisticsId)->GetStatistics(counterIndex, *pCounterStatistics))
+        {
+            GPA_LogError("No result of the counter was accumulated in the counter statistics.");
+            retStatus = GPA_STATUS_ERROR_COUNTER_NOT_FOUND;
+        }
+
+        GPA_RECORD_CALL(GPA_GetCounterStatistics, retStatus, counterStatisticsId, counterIndex, pCounterStatistics);
+
+        return retStatus;
+    }
+    catch (...)
+    {
+        return GPA_STATUS_ERROR_EXCEPTION;
+    }
+}
+
+//-----------------------------------------------------------------------------
+GPALIB_DECL GPA_Status GPA_SetCounterCacheFilePath(const char* pCacheFilePath)
+{
+    try
+    {
+        PROFILE_FUNCTION(GPA_SetCounterCacheFilePath);
+        TRACE_FUNCTION(GPA_SetCounterCacheFilePath);
+
+        SetCounterCacheFilePath(pCacheFilePath);
+
+        GPA_RECORD_CALL(GPA_SetCounterCacheFilePath, GPA_STATUS_OK, pCacheFilePath);
+
+        return GPA_STATUS_OK;
+    }
+    catch (...)
+    {
+        return GPA_STATUS_ERROR_EXCEPTION;
+    }
+}
+
+//-----------------------------------------------------------------------------
+GPALIB_DECL GPA_Status GPA_GetMemoryStats(GPA_Memory_Category category, gpa_uint64* pNumBytes, gpa_uint64* pNumObjects)
+{
+    try
+    {
+        PROFILE_FUNCTION(GPA_GetMemoryStats);
+        TRACE_FUNCTION(GPA_GetMemoryStats);
+
+        CHECK_NULL_PARAM(pNumBytes);
+        CHECK_NULL_PARAM(pNumObjects);
+
+        if (!GPAMemoryTracker::GetStats(category, pNumBytes, pNumObjects))
+        {
+            GPA_LogError("Unable to get memory statistics: invalid memory category specified.");
+            return GPA_STATUS_ERROR_INVALID_PARAMETER;
+        }
+
+        GPA_RECORD_CALL(GPA_GetMemoryStats, GPA_STATUS_OK, category, *pNumBytes, *pNumObjects);
+
+        return GPA_STATUS_OK;
+    }
+    catch (...)
+    {
+        return GPA_STATUS_ERROR_EXCEPTION;
+    }
+}
+
 //-----------------------------------------------------------------------------
 /// array of strings representing GPA_Status status strings
 static const char* g_statusString[] = {GPA_ENUM_STRING_VAL(GPA_STATUS_OK, "GPA Status: Ok."),
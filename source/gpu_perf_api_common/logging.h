@@ -70,11 +70,6 @@
 /// \param[in] pLogMsg logging message
 extern void GPAInternalLogger(GPA_Logging_Type logType, const char* pLogMsg);
 
-#define GPA_INTERNAL_LOG(func, ...)                                                                            \
-    std::stringstream logAdditionalMessage;                                                                    \
-    logAdditionalMessage << "ThreadId: " << std::this_thread::get_id() << " " << #func << ": " << __VA_ARGS__; \
-    GPAInternalLogger(GPA_LOGGING_INTERNAL, logAdditionalMessage.str().c_str());
-
 /// Passes log messages of various types to a user-supplied callback function
 /// if the user has elected to receive messages of that particular type.
 class GPALogger
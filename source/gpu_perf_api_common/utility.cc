@@ -5,6 +5,9 @@
 /// \brief  Utility macros, constants and function declarations
 //==============================================================================
 
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
 #include <locale>
 
 #include "utility.h"
@@ -83,3 +86,100 @@ bool GPAUtil::GetCurrentModulePath(std::string& currentModulePath)
 
     return success;
 }
+
+bool GPAUtil::CreateUniqueFile(const std::string& filePathPrefix, const std::string& fileExtension, std::string& filePath)
+{
+#ifdef _WIN32
+
+    static std::atomic<unsigned int> s_fileCount(0);
+
+    // CREATE_NEW fails if the file exists, so a file created by another process or user is never reused
+    static const unsigned int MAX_ATTEMPTS = 100;
+
+    for (unsigned int attempt = 0; attempt < MAX_ATTEMPTS; ++attempt)
+    {
+        const std::string candidatePath =
+            filePathPrefix + std::to_string(GetProcessIdentifier()) + "-" + std::to_string(s_fileCount++) + fileExtension;
+        HANDLE hFile = ::CreateFileA(candidatePath.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_NEW, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+        if (INVALID_HANDLE_VALUE != hFile)
+        {
+            ::CloseHandle(hFile);
+            filePath = candidatePath;
+            return true;
+        }
+
+        if (ERROR_FILE_EXISTS != ::GetLastError())
+        {
+            return false;
+        }
+    }
+
+    return false;
+
+#else
+
+    // mkstemps picks a random name and creates the file with O_CREAT | O_EXCL and mode 0600
+    std::string fileTemplate = filePathPrefix + "XXXXXX" + fileExtension;
+    int         fd           = mkstemps(&fileTemplate[0], static_cast<int>(fileExtension.size()));
+
+    if (-1 == fd)
+    {
+        return false;
+    }
+
+    close(fd);
+    filePath = fileTemplate;
+    return true;
+
+#endif
+}
+
+bool GPAUtil::CreateTempFile(const std::string& filePrefix, const std::string& fileExtension, std::string& tempFilePath)
+{
+    std::string tempDirectory;
+
+#ifdef _WIN32
+
+    char szTempDirectory[MAX_PATH + 1] = { 0 };
+
+    if (0 == ::GetTempPathA(MAX_PATH + 1, szTempDirectory))
+    {
+        return false;
+    }
+
+    tempDirectory = szTempDirectory;
+
+#else
+
+    const char* pTempDirectory = std::getenv("TMPDIR");
+    tempDirectory              = (nullptr != pTempDirectory && '\0' != pTempDirectory[0]) ? pTempDirectory : "/tmp";
+
+    if ('/' != tempDirectory.back())
+    {
+        tempDirectory += '/';
+    }
+
+#endif
+
+    return CreateUniqueFile(tempDirectory + filePrefix, fileExtension, tempFilePath);
+}
+
+unsigned int GPAUtil::GetProcessIdentifier()
+{
+#ifdef _WIN32
+    return static_cast<unsigned int>(::GetCurrentProcessId());
+#else
+    return static_cast<unsigned int>(getpid());
+#endif
+}
+
+bool GPAUtil::RenameFile(const std::string& sourceFilePath, const std::string& destinationFilePath)
+{
+#ifdef _WIN32
+    return FALSE != ::MoveFileExA(sourceFilePath.c_str(), destinationFilePath.c_str(), MOVEFILE_REPLACE_EXISTING);
+#else
+    // rename replaces the destination atomically, so a process opening the destination sees either the old or the new file
+    return 0 == std::rename(sourceFilePath.c_str(), destinationFilePath.c_str());
+#endif
+}
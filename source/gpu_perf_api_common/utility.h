@@ -26,6 +26,31 @@ namespace GPAUtil
     /// \param[out] currentModulePath path of the module from where it was loaded
     /// \return true upon successful operation otherwise false
     bool GetCurrentModulePath(std::string& currentModulePath);
+
+    /// Creates a new empty file whose path starts with a prefix.
+    /// The file is created exclusively, so an existing file or link at that path is never opened or truncated.
+    /// \param[in] filePathPrefix the start of the path of the file, including the directory
+    /// \param[in] fileExtension extension of the file name, including the dot
+    /// \param[out] filePath path of the created file
+    /// \return true upon successful operation otherwise false
+    bool CreateUniqueFile(const std::string& filePathPrefix, const std::string& fileExtension, std::string& filePath);
+
+    /// Creates a new empty file in the temporary directory, as CreateUniqueFile does; the caller deletes it
+    /// \param[in] filePrefix prefix of the file name
+    /// \param[in] fileExtension extension of the file name, including the dot
+    /// \param[out] tempFilePath path of the created file
+    /// \return true upon successful operation otherwise false
+    bool CreateTempFile(const std::string& filePrefix, const std::string& fileExtension, std::string& tempFilePath);
+
+    /// Returns the identifier of the current process
+    /// \return the identifier of the current process
+    unsigned int GetProcessIdentifier();
+
+    /// Renames a file, replacing the destination file if it exists, atomically where the file system supports it
+    /// \param[in] sourceFilePath path of the file to rename
+    /// \param[in] destinationFilePath new path of the file
+    /// \return true upon successful operation otherwise false
+    bool RenameFile(const std::string& sourceFilePath, const std::string& destinationFilePath);
 }  // namespace GPAUtil
 
 #endif  // _GPA_COMMON_UTILITY_H_
@@ -35,12 +35,16 @@ set(INTERNALLY_EXPOSED_HEADERS
 
 set(COUNTER_GENERATOR_HEADERS
     gpa_counter_generator_base.h
+    gpa_counter_catalog.h
+    gpa_counter_catalog_cache.h
     gpa_counter_generator_scheduler_manager.h
     gpa_sw_counter_manager.h)
 
 set(COUNTER_GENERATOR_SRC
     gpa_counter_generator.cc
     gpa_counter_generator_base.cc
+    gpa_counter_catalog.cc
+    gpa_counter_catalog_cache.cc
     gpa_counter_generator_scheduler_manager.cc
     gpa_sw_counter_manager.cc)
 
@@ -76,10 +80,14 @@ endif()
 set(HARDWARE_COUNTER_SRC ${HARDWARE_COUNTER_SRC} ${HW_COUNTER_SRC})
 
 set(DERIVED_COUNTER_HEADERS
-    gpa_derived_counter.h)
+    gpa_derived_counter.h
+    gpa_derived_counter_evaluator.h
+    gpa_specialized_counter_equations.h)
 
 set(DERIVED_COUNTER_SRC
-    gpa_derived_counter.cc)
+    gpa_derived_counter.cc
+    gpa_derived_counter_evaluator.cc
+    gpa_specialized_counter_equations.cc)
 
 set(COUNTER_SPLITTING_ALGO_HEADERS
     gpa_split_counter_factory.h
@@ -21,6 +21,16 @@
 #define GPA_HIDE_NAME(_CounterName) ""
 #endif
 
+/// macro to remove the offsets of counter names in a string pool from public builds, whose string pools are empty
+#ifdef AMDT_INTERNAL
+#define GPA_HIDE_NAME_OFFSET(_Offset) (_Offset)
+#else
+#define GPA_HIDE_NAME_OFFSET(_Offset) 0
+#endif
+
+/// placeholder for the block instance in the names of counters shared by all instances of a hardware block
+#define GPA_BLOCK_INSTANCE_PLACEHOLDER '#'
+
 /// Contains the hardware exposed counter information
 struct GPA_CounterGroupExposedCounterDesc
 {
@@ -49,6 +59,48 @@ struct GPA_HardwareCounterDesc
     gpa_uint64    m_max;                  ///< max possible value
 };
 
+/// Contains the information of a counter shared by all instances of a hardware block
+struct GPA_HardwareBlockCounterDesc
+{
+    gpa_uint32 m_nameOffset;         ///< offset of the name of the counter in the string pool of the block
+    gpa_uint32 m_descriptionOffset;  ///< offset of the description of the counter in the string pool of the block
+};
+
+/// Describes the counters of a hardware block once for all of its instances.
+/// The names in the string pool contain GPA_BLOCK_INSTANCE_PLACEHOLDER where the names of the instances differ,
+/// the block instance is substituted when the name of a counter is requested.
+struct GPA_HardwareBlockDesc
+{
+    const char*                         m_pStrings;      ///< string pool of the block, holding the NUL-terminated strings of the counters
+    gpa_uint32                          m_groupOffset;   ///< offset of the group name of the block in the string pool
+    gpa_uint32                          m_numInstances;  ///< number of instances of the block
+    gpa_uint32                          m_numCounters;   ///< number of counters in each instance of the block
+    const GPA_HardwareBlockCounterDesc* m_pCounters;     ///< the counters of the block
+};
+
+/// Expands the counters of a hardware block into the counters of one of its instances.
+/// The strings of the expanded counters point into the string pool of the block.
+/// \param[in] block the hardware block
+/// \param[out] pInstanceCounters the counters of the block instance, which must hold the counters of the block
+inline void ExpandHardwareBlockCounters(const GPA_HardwareBlockDesc& block, GPA_HardwareCounterDesc* pInstanceCounters)
+{
+    char* pGroup = const_cast<char*>(block.m_pStrings + block.m_groupOffset);
+
+    for (gpa_uint32 counterIndex = 0; counterIndex < block.m_numCounters; ++counterIndex)
+    {
+        const GPA_HardwareBlockCounterDesc& blockCounter = block.m_pCounters[counterIndex];
+        GPA_HardwareCounterDesc&            counter      = pInstanceCounters[counterIndex];
+
+        counter.m_counterIndexInGroup = counterIndex;
+        counter.m_pName               = const_cast<char*>(block.m_pStrings + blockCounter.m_nameOffset);
+        counter.m_pGroup              = pGroup;
+        counter.m_pDescription        = const_cast<char*>(block.m_pStrings + blockCounter.m_descriptionOffset);
+        counter.m_type                = GPA_DATA_TYPE_UINT64;
+        counter.m_min                 = 0;
+        counter.m_max                 = GPA_UINT64_MAX;
+    }
+}
+
 /// Contains all information pertaining to an internal counter group (aka a hardware block instance).
 struct GPA_CounterGroupDesc
 {
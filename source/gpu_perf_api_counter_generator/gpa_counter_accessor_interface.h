@@ -144,6 +144,12 @@ public:
     /// \return true if the counter is found, false otherwise
     virtual bool GetCounterIndex(const char* pName, gpa_uint32* pIndex) const = 0;
 
+    /// Gets a counter's index from its UUID
+    /// \param[in] uuid The UUID of the counter to find
+    /// \param[out] pIndex The index of the counter
+    /// \return true if the counter is found, false otherwise
+    virtual bool GetCounterIndexByUuid(const GPA_UUID& uuid, gpa_uint32* pIndex) const = 0;
+
     /// Gets a counter index
     /// \param[in] gpa_hardware_block hardware block
     /// \param[in] block_instance instance of the block
@@ -0,0 +1,137 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Cache of the counters generated for each API/device combination
+//==============================================================================
+
+#include "gpa_counter_catalog.h"
+#include "gpa_counter_generator_base.h"
+#include "gpa_counter_generator_scheduler_manager.h"
+#include "logging.h"
+
+GPA_Status GPA_CounterCatalog::GetCounters(GPA_API_Type               desiredAPI,
+                                           GDT_HW_GENERATION          desiredGeneration,
+                                           GDT_HW_ASIC_TYPE           asicType,
+                                           gpa_uint32                 vendorId,
+                                           gpa_uint32                 deviceId,
+                                           gpa_uint32                 revisionId,
+                                           bool                       allowPublic,
+                                           bool                       allowHardware,
+                                           bool                       allowSoftware,
+                                           gpa_uint8                  generateAsicSpecificCounters,
+                                           GPA_CounterGeneratorBase*& pCounterGeneratorOut)
+{
+    GPA_CounterCatalogKey key;
+    key.m_api                          = desiredAPI;
+    key.m_vendorId                     = vendorId;
+    key.m_deviceId                     = deviceId;
+    key.m_revisionId                   = revisionId;
+    key.m_allowedCounters              = (allowPublic ? 1u : 0u) | (allowHardware ? 2u : 0u) | (allowSoftware ? 4u : 0u);
+    key.m_generateAsicSpecificCounters = generateAsicSpecificCounters;
+
+    // the lock is held while generating, so that concurrent requests for the same combination generate the counters only once
+    std::lock_guard<std::mutex> lock(m_catalogEntriesMutex);
+
+    auto entryIter = m_catalogEntries.find(key);
+
+    if (m_catalogEntries.end() != entryIter)
+    {
+        pCounterGeneratorOut = entryIter->second.m_counterGenerator.get();
+        return GPA_STATUS_OK;
+    }
+
+    GPA_CounterGeneratorBase* pCounterGenerator = nullptr;
+
+    if (!CounterGeneratorSchedulerManager::Instance()->CreateCounterGenerator(desiredAPI, desiredGeneration, pCounterGenerator))
+    {
+        GPA_LogError("Requesting available counters from an unsupported API or hardware generation.");
+        return GPA_STATUS_ERROR_HARDWARE_NOT_SUPPORTED;
+    }
+
+    std::shared_ptr<GPA_CounterGeneratorBase> counterGenerator(pCounterGenerator);
+
+    counterGenerator->SetAllowedCounters(allowPublic, allowHardware, allowSoftware);
+
+    CatalogEntry        entry;
+    GPA_DerivedCounters cachedPublicCounters;
+
+    if (allowPublic && nullptr != m_cache)
+    {
+        // the cache does not store the native functions of the counters, they are attached again when loading them
+        std::vector<GPA_DerivedCounterFunctionTable> functionTables;
+        counterGenerator->GetPublicCounterFunctions(desiredGeneration, asicType, generateAsicSpecificCounters, functionTables);
+
+        if (m_cache->LoadPublicCounters(key, functionTables, cachedPublicCounters))
+        {
+            entry.m_cache = m_cache;
+        }
+    }
+
+    GPA_Status status = counterGenerator->GenerateCounters(
+        desiredGeneration, asicType, generateAsicSpecificCounters, (nullptr != entry.m_cache) ? &cachedPublicCounters : nullptr);
+
+    if (GPA_STATUS_OK == status && nullptr != entry.m_cache && !ArePublicCountersConsistent(pCounterGenerator))
+    {
+        GPA_LogDebugMessage("Ignoring the cached public counters, which do not match the hardware counters.");
+        entry.m_cache = nullptr;
+        status        = counterGenerator->GenerateCounters(desiredGeneration, asicType, generateAsicSpecificCounters);
+    }
+
+    if (GPA_STATUS_OK == status)
+    {
+        if (allowPublic && nullptr != m_cache && nullptr == entry.m_cache)
+        {
+            m_cache->StorePublicCounters(key, *counterGenerator->GetPublicCounters());
+        }
+
+        entry.m_counterGenerator = counterGenerator;
+        m_catalogEntries.insert(CatalogEntryMap::value_type(key, entry));
+        pCounterGeneratorOut = pCounterGenerator;
+    }
+
+    return status;
+}
+
+void GPA_CounterCatalog::SetCacheFilePath(const std::string& cacheFilePath)
+{
+    std::lock_guard<std::mutex> lock(m_catalogEntriesMutex);
+
+    // the previous cache is released once no catalog entry references it
+    m_cache = nullptr;
+
+    if (!cacheFilePath.empty())
+    {
+        m_cache = std::make_shared<GPA_CounterCatalogCache>();
+
+        // a missing or outdated file is not an error: it is written when the next combination is generated
+        m_cache->Open(cacheFilePath);
+    }
+}
+
+size_t GPA_CounterCatalog::GetNumEntries() const
+{
+    std::lock_guard<std::mutex> lock(m_catalogEntriesMutex);
+    return m_catalogEntries.size();
+}
+
+bool GPA_CounterCatalog::ArePublicCountersConsistent(const GPA_CounterGeneratorBase* pCounterGenerator)
+{
+    const GPA_DerivedCounters* pPublicCounters     = pCounterGenerator->GetPublicCounters();
+    const gpa_uint32           numHardwareCounters = pCounterGenerator->GetHardwareCounters()->GetNumCounters();
+
+    for (gpa_uint32 counterIndex = 0; counterIndex < pPublicCounters->GetNumCounters(); ++counterIndex)
+    {
+        const std::vector<gpa_uint32>& internalCounters = pPublicCounters->GetInternalCountersRequired(counterIndex);
+
+        for (auto internalCounterIter = internalCounters.cbegin(); internalCounterIter != internalCounters.cend(); ++internalCounterIter)
+        {
+            if (*internalCounterIter >= numHardwareCounters)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
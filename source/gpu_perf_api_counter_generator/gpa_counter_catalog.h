@@ -0,0 +1,99 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Cache of the counters generated for each API/device combination
+//==============================================================================
+
+#ifndef _GPA_COUNTER_CATALOG_H_
+#define _GPA_COUNTER_CATALOG_H_
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <DeviceInfo.h>
+#include <TSingleton.h>
+
+#include "gpu_perf_api_types.h"
+#include "gpa_counter_catalog_cache.h"
+
+class GPA_CounterGeneratorBase;  ///< forward declaration
+
+/// Cache of the counters generated for each API/device combination.
+///
+/// The counters of a combination are generated the first time a context asks for them, by a counter generator
+/// instance owned by the catalog. Later contexts opened for the same combination share that instance. Once it has
+/// generated its counters, a catalog entry is never modified again, so it may be read concurrently by all the contexts
+/// using it; the mutable scheduling state lives in the scheduler instance each context creates for itself.
+/// When a cache file is set, the public counters resolved for a combination are also persisted, so that later processes
+/// load them from the file instead of resolving them again.
+class GPA_CounterCatalog : public TSingleton<GPA_CounterCatalog>
+{
+    friend class TSingleton<GPA_CounterCatalog>;  ///< friend declaration to allow access to the constructor
+
+public:
+    /// Gets the generated counters for the specified combination, generating them if this is the first request for it
+    /// \param[in] desiredAPI the API to generate counters for
+    /// \param[in] desiredGeneration the hardware generation to generate counters for
+    /// \param[in] asicType the ASIC type to generate counters for
+    /// \param[in] vendorId the vendor id to generate counters for
+    /// \param[in] deviceId the device id to generate counters for
+    /// \param[in] revisionId the revision id to generate counters for
+    /// \param[in] allowPublic flag indicating whether or not public counters are allowed
+    /// \param[in] allowHardware flag indicating whether or not hardware counters are allowed
+    /// \param[in] allowSoftware flag indicating whether or not software counters are allowed
+    /// \param[in] generateAsicSpecificCounters flag that indicates whether the counters should be ASIC specific, if available
+    /// \param[out] pCounterGeneratorOut the generator holding the generated counters, owned by the catalog
+    /// \return GPA_STATUS_ERROR_HARDWARE_NOT_SUPPORTED if no generator is registered for the API/generation
+    /// \return the status of the counter generation otherwise
+    GPA_Status GetCounters(GPA_API_Type               desiredAPI,
+                           GDT_HW_GENERATION          desiredGeneration,
+                           GDT_HW_ASIC_TYPE           asicType,
+                           gpa_uint32                 vendorId,
+                           gpa_uint32                 deviceId,
+                           gpa_uint32                 revisionId,
+                           bool                       allowPublic,
+                           bool                       allowHardware,
+                           bool                       allowSoftware,
+                           gpa_uint8                  generateAsicSpecificCounters,
+                           GPA_CounterGeneratorBase*& pCounterGeneratorOut);
+
+    /// Sets the file in which the resolved public counters are persisted across processes.
+    /// It applies to the combinations generated after the call; the combinations already generated are not affected.
+    /// \param[in] cacheFilePath the path of the cache file, or an empty string to disable the cache
+    void SetCacheFilePath(const std::string& cacheFilePath);
+
+    /// Gets the number of generated entries in the catalog
+    /// \return the number of generated entries in the catalog
+    size_t GetNumEntries() const;
+
+protected:
+    /// Constructor
+    GPA_CounterCatalog() = default;
+
+    /// Destructor
+    virtual ~GPA_CounterCatalog() = default;
+
+private:
+    /// The generated counters of a combination
+    struct CatalogEntry
+    {
+        std::shared_ptr<const GPA_CounterCatalogCache> m_cache;             ///< the cache the public counters were loaded from, kept alive while they reference it, or nullptr
+        std::shared_ptr<GPA_CounterGeneratorBase>      m_counterGenerator;  ///< the generator holding the generated counters
+    };
+
+    /// Verifies that the public counters loaded from the cache are consistent with the hardware counters generated in this process
+    /// \param[in] pCounterGenerator the generator holding the generated counters
+    /// \return true if every internal counter required by the public counters is a generated hardware counter
+    static bool ArePublicCountersConsistent(const GPA_CounterGeneratorBase* pCounterGenerator);
+
+    using CatalogEntryMap = std::map<GPA_CounterCatalogKey, CatalogEntry>;  ///< type alias for the map of catalog entries
+
+    CatalogEntryMap                          m_catalogEntries;       ///< the generated counters of each combination
+    std::shared_ptr<GPA_CounterCatalogCache> m_cache;                ///< the persistent cache of the public counters, or nullptr if it is disabled
+    mutable std::mutex                       m_catalogEntriesMutex;  ///< mutex protecting the catalog entries and the cache
+};
+
+#endif  // _GPA_COUNTER_CATALOG_H_
@@ -0,0 +1,506 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Persistent on-disk cache of the counter catalog
+//==============================================================================
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <tuple>
+
+#include "gpa_counter_catalog_cache.h"
+#include "gpa_derived_counter.h"
+#include "gpa_mapped_file.h"
+#include "gpa_version.h"
+#include "logging.h"
+#include "utility.h"
+
+static const gpa_uint32 CACHE_FILE_MAGIC   = 0x43435047;  ///< "GPCC", at the start of a cache file
+static const gpa_uint32 CACHE_FILE_VERSION = 2;           ///< version of the cache file format; 2 since the counter UUIDs are parsed correctly on Linux
+
+/// Header at the start of a cache file, followed by the entry records
+struct CacheFileHeader
+{
+    gpa_uint32 m_magic;          ///< CACHE_FILE_MAGIC
+    gpa_uint32 m_version;        ///< CACHE_FILE_VERSION
+    gpa_uint32 m_gpaVersion[4];  ///< major, minor, update and build number of the GPA version which wrote the file
+    gpa_uint32 m_entryCount;     ///< number of entry records
+    gpa_uint32 m_reserved;       ///< reserved, zero
+    gpa_uint64 m_fileSize;       ///< size of the file in bytes, used to detect truncated files
+};
+
+/// Record of the counters of an API/device combination
+struct CacheEntryRecord
+{
+    gpa_uint32 m_api;                           ///< the API of the counters
+    gpa_uint32 m_vendorId;                      ///< the vendor id of the device
+    gpa_uint32 m_deviceId;                      ///< the device id of the device
+    gpa_uint32 m_revisionId;                    ///< the revision id of the device
+    gpa_uint32 m_allowedCounters;               ///< bitmask of the allowed counter families
+    gpa_uint32 m_generateAsicSpecificCounters;  ///< flag indicating whether the counters are ASIC specific
+    gpa_uint32 m_counterCount;                  ///< number of counter records of the entry
+    gpa_uint32 m_reserved;                      ///< reserved, zero
+    gpa_uint64 m_countersOffset;                ///< offset of the first counter record of the entry in the file
+};
+
+/// Record of a public counter; string offsets are 0 for null strings
+struct CacheCounterRecord
+{
+    gpa_uint64 m_nameOffset;              ///< offset of the name in the file
+    gpa_uint64 m_groupOffset;             ///< offset of the group in the file
+    gpa_uint64 m_descriptionOffset;       ///< offset of the description in the file
+    gpa_uint64 m_expressionOffset;        ///< offset of the equation in the file
+    gpa_uint64 m_internalCountersOffset;  ///< offset of the indices of the internal counters required by the counter in the file
+    gpa_uint32 m_internalCounterCount;    ///< number of internal counters required by the counter
+    gpa_uint32 m_dataType;                ///< data type of the counter
+    gpa_uint32 m_usageType;               ///< usage type of the counter
+    gpa_uint32 m_reserved;                ///< reserved, zero
+    gpa_uint8  m_uuid[sizeof(GPA_UUID)];  ///< UUID of the counter, in the layout of the platform which wrote the file
+};
+
+bool GPA_CounterCatalogKey::operator<(const GPA_CounterCatalogKey& other) const
+{
+    return std::tie(m_api, m_vendorId, m_deviceId, m_revisionId, m_allowedCounters, m_generateAsicSpecificCounters) <
+           std::tie(other.m_api, other.m_vendorId, other.m_deviceId, other.m_revisionId, other.m_allowedCounters, other.m_generateAsicSpecificCounters);
+}
+
+bool GPA_CounterCatalogKey::operator==(const GPA_CounterCatalogKey& other) const
+{
+    return !(*this < other) && !(other < *this);
+}
+
+/// Gets the key of an entry record
+/// \param[in] entryRecord the entry record
+/// \return the key of the entry record
+static GPA_CounterCatalogKey GetEntryKey(const CacheEntryRecord& entryRecord)
+{
+    GPA_CounterCatalogKey key;
+    key.m_api                          = static_cast<GPA_API_Type>(entryRecord.m_api);
+    key.m_vendorId                     = entryRecord.m_vendorId;
+    key.m_deviceId                     = entryRecord.m_deviceId;
+    key.m_revisionId                   = entryRecord.m_revisionId;
+    key.m_allowedCounters              = entryRecord.m_allowedCounters;
+    key.m_generateAsicSpecificCounters = static_cast<gpa_uint8>(entryRecord.m_generateAsicSpecificCounters);
+    return key;
+}
+
+/// Gets the entry records of a mapped cache file
+/// \param[in] mappedFile the mapped cache file, whose header has been validated
+/// \param[out] entryCount the number of entry records
+/// \return the entry records
+static const CacheEntryRecord* GetEntryRecords(const GPAMappedFile& mappedFile, gpa_uint32& entryCount)
+{
+    const CacheFileHeader* pHeader = reinterpret_cast<const CacheFileHeader*>(mappedFile.GetData());
+    entryCount                     = pHeader->m_entryCount;
+    return reinterpret_cast<const CacheEntryRecord*>(mappedFile.GetData() + sizeof(CacheFileHeader));
+}
+
+/// Gets a string stored in a mapped cache file
+/// \param[in] mappedFile the mapped cache file
+/// \param[in] offset the offset of the string, 0 for a null string
+/// \param[out] pString the string, which points into the mapped file
+/// \return true if the string is within the file, false if the file is corrupt
+static bool GetString(const GPAMappedFile& mappedFile, gpa_uint64 offset, const char*& pString)
+{
+    pString = nullptr;
+
+    if (0 == offset)
+    {
+        return true;
+    }
+
+    if (offset >= mappedFile.GetSize())
+    {
+        return false;
+    }
+
+    const char* pStart = reinterpret_cast<const char*>(mappedFile.GetData() + offset);
+
+    if (nullptr == memchr(pStart, '\0', static_cast<size_t>(mappedFile.GetSize() - offset)))
+    {
+        return false;
+    }
+
+    pString = pStart;
+    return true;
+}
+
+/// Finds the entry of a counter in a table of native functions
+/// \param[in] functionTable the table of native functions
+/// \param[in,out] tableCursor the index of the entry following the previously found one, updated to follow the found entry
+/// \param[in] pName the name of the counter
+/// \return the entry of the counter, or nullptr if the table has none
+static const GPA_DerivedCounterFunctionEntry* FindFunctionEntry(const GPA_DerivedCounterFunctionTable& functionTable, size_t& tableCursor, const char* pName)
+{
+    // the tables list the counters in the order they are defined, so the entry is usually the one at the cursor
+    for (size_t entryCount = 0; entryCount < functionTable.m_numEntries; ++entryCount)
+    {
+        size_t entryIndex = (tableCursor + entryCount) % functionTable.m_numEntries;
+
+        if (0 == strcmp(functionTable.m_pEntries[entryIndex].m_pName, pName))
+        {
+            tableCursor = entryIndex + 1;
+            return &functionTable.m_pEntries[entryIndex];
+        }
+    }
+
+    return nullptr;
+}
+
+/// Attaches the native functions generated for the counters loaded from an entry record, which the file does not store
+/// \param[in] functionTables the tables of native functions, in order of precedence
+/// \param[in,out] counters the counters loaded from the entry record
+static void AttachComputeFunctions(const std::vector<GPA_DerivedCounterFunctionTable>& functionTables, std::vector<GPA_DerivedCounter>& counters)
+{
+    std::vector<size_t> tableCursors(functionTables.size(), 0);
+
+    for (auto counterIter = counters.begin(); counterIter != counters.end(); ++counterIter)
+    {
+        if (nullptr == counterIter->m_pName || nullptr == counterIter->m_pComputeExpression)
+        {
+            continue;
+        }
+
+        for (size_t tableIndex = 0; tableIndex < functionTables.size(); ++tableIndex)
+        {
+            const GPA_DerivedCounterFunctionEntry* pEntry = FindFunctionEntry(functionTables[tableIndex], tableCursors[tableIndex], counterIter->m_pName);
+
+            // a function only computes the equation it was generated from, the stored equation may come from other definitions
+            if (nullptr != pEntry && 0 == strcmp(pEntry->m_pComputeExpression, counterIter->m_pComputeExpression))
+            {
+                counterIter->m_pComputeFunction = pEntry->m_pComputeFunction;
+                break;
+            }
+        }
+    }
+}
+
+/// Loads the public counters of an entry record
+/// \param[in] mappedFile the mapped cache file holding the entry
+/// \param[in] entryRecord the entry record
+/// \param[in] functionTables the native functions generated for the counters of the entry, in order of precedence
+/// \param[out] publicCounters the public counters, which reference the mapped cache file
+/// \return true if the counters were loaded, false if the file is corrupt
+static bool LoadEntry(const GPAMappedFile&                                mappedFile,
+                      const CacheEntryRecord&                             entryRecord,
+                      const std::vector<GPA_DerivedCounterFunctionTable>& functionTables,
+                      GPA_DerivedCounters&                                publicCounters)
+{
+    const gpa_uint64 fileSize = mappedFile.GetSize();
+
+    if (entryRecord.m_countersOffset > fileSize || entryRecord.m_counterCount > (fileSize - entryRecord.m_countersOffset) / sizeof(CacheCounterRecord) ||
+        0 != entryRecord.m_countersOffset % alignof(CacheCounterRecord))
+    {
+        return false;
+    }
+
+    const CacheCounterRecord*       pCounterRecords = reinterpret_cast<const CacheCounterRecord*>(mappedFile.GetData() + entryRecord.m_countersOffset);
+    std::vector<GPA_DerivedCounter> counters(entryRecord.m_counterCount);
+
+    for (gpa_uint32 counterIndex = 0; counterIndex < entryRecord.m_counterCount; ++counterIndex)
+    {
+        const CacheCounterRecord& counterRecord = pCounterRecords[counterIndex];
+        GPA_DerivedCounter&       counter       = counters[counterIndex];
+
+        if (!GetString(mappedFile, counterRecord.m_nameOffset, counter.m_pName) || !GetString(mappedFile, counterRecord.m_groupOffset, counter.m_pGroup) ||
+            !GetString(mappedFile, counterRecord.m_descriptionOffset, counter.m_pDescription) ||
+            !GetString(mappedFile, counterRecord.m_expressionOffset, counter.m_pComputeExpression))
+        {
+            return false;
+        }
+
+        if (counterRecord.m_dataType >= GPA_DATA_TYPE__LAST || counterRecord.m_usageType >= GPA_USAGE_TYPE__LAST ||
+            counterRecord.m_internalCountersOffset > fileSize ||
+            counterRecord.m_internalCounterCount > (fileSize - counterRecord.m_internalCountersOffset) / sizeof(gpa_uint32) ||
+            0 != counterRecord.m_internalCountersOffset % alignof(gpa_uint32))
+        {
+            return false;
+        }
+
+        const gpa_uint32* pInternalCounters = reinterpret_cast<const gpa_uint32*>(mappedFile.GetData() + counterRecord.m_internalCountersOffset);
+
+        counter.m_index     = counterIndex;
+        counter.m_dataType  = static_cast<GPA_Data_Type>(counterRecord.m_dataType);
+        counter.m_usageType = static_cast<GPA_Usage_Type>(counterRecord.m_usageType);
+        counter.m_internalCountersRequired.assign(pInternalCounters, pInternalCounters + counterRecord.m_internalCounterCount);
+        memcpy(&counter.m_uuid, counterRecord.m_uuid, sizeof(GPA_UUID));
+    }
+
+    AttachComputeFunctions(functionTables, counters);
+
+    publicCounters.Clear();
+
+    for (auto counterIter = counters.begin(); counterIter != counters.end(); ++counterIter)
+    {
+        publicCounters.AddDerivedCounter(*counterIter);
+    }
+
+    return true;
+}
+
+/// Adds a string to the string pool of a cache file, sharing the strings which are already in it
+/// \param[in] pString the string, or nullptr
+/// \param[in] stringPoolOffset offset of the string pool in the file
+/// \param[in,out] stringPool the string pool
+/// \param[in,out] stringOffsets offset of each string already in the string pool
+/// \return the offset of the string in the file, 0 for a null string
+static gpa_uint64 AddString(const char* pString, gpa_uint64 stringPoolOffset, std::string& stringPool, std::map<std::string, gpa_uint64>& stringOffsets)
+{
+    if (nullptr == pString)
+    {
+        return 0;
+    }
+
+    auto stringIter = stringOffsets.find(pString);
+
+    if (stringOffsets.end() != stringIter)
+    {
+        return stringIter->second;
+    }
+
+    gpa_uint64 offset = stringPoolOffset + stringPool.size();
+    stringPool.append(pString);
+    stringPool.push_back('\0');
+    stringOffsets.insert(std::map<std::string, gpa_uint64>::value_type(pString, offset));
+    return offset;
+}
+
+GPA_CounterCatalogCache::GPA_CounterCatalogCache() = default;
+
+GPA_CounterCatalogCache::~GPA_CounterCatalogCache() = default;
+
+bool GPA_CounterCatalogCache::Open(const std::string& cacheFilePath)
+{
+    m_cacheFilePath = cacheFilePath;
+
+    std::unique_ptr<GPAMappedFile> mappedFile(new (std::nothrow) GPAMappedFile());
+
+    if (nullptr == mappedFile || !mappedFile->Open(cacheFilePath))
+    {
+        return false;
+    }
+
+    if (mappedFile->GetSize() < sizeof(CacheFileHeader))
+    {
+        GPA_LogDebugMessage("Ignoring the truncated counter cache file %s.", cacheFilePath.c_str());
+        return false;
+    }
+
+    const CacheFileHeader* pHeader = reinterpret_cast<const CacheFileHeader*>(mappedFile->GetData());
+
+    if (CACHE_FILE_MAGIC != pHeader->m_magic || CACHE_FILE_VERSION != pHeader->m_version || GPA_MAJOR_VERSION != pHeader->m_gpaVersion[0] ||
+        GPA_MINOR_VERSION != pHeader->m_gpaVersion[1] || GPA_UPDATE_VERSION != pHeader->m_gpaVersion[2] || GPA_BUILD_NUMBER != pHeader->m_gpaVersion[3])
+    {
+        GPA_LogDebugMessage("Ignoring the counter cache file %s, written by another version of GPA.", cacheFilePath.c_str());
+        return false;
+    }
+
+    if (mappedFile->GetSize() != pHeader->m_fileSize ||
+        pHeader->m_entryCount > (mappedFile->GetSize() - sizeof(CacheFileHeader)) / sizeof(CacheEntryRecord))
+    {
+        GPA_LogDebugMessage("Ignoring the corrupt counter cache file %s.", cacheFilePath.c_str());
+        return false;
+    }
+
+    m_mappedFiles.push_back(std::move(mappedFile));
+    return true;
+}
+
+bool GPA_CounterCatalogCache::LoadPublicCounters(const GPA_CounterCatalogKey&                        key,
+                                                 const std::vector<GPA_DerivedCounterFunctionTable>& functionTables,
+                                                 GPA_DerivedCounters&                                publicCounters) const
+{
+    const GPAMappedFile* pMappedFile = GetCurrentFile();
+
+    if (nullptr == pMappedFile)
+    {
+        return false;
+    }
+
+    gpa_uint32              entryCount    = 0;
+    const CacheEntryRecord* pEntryRecords = GetEntryRecords(*pMappedFile, entryCount);
+
+    for (gpa_uint32 entryIndex = 0; entryIndex < entryCount; ++entryIndex)
+    {
+        if (GetEntryKey(pEntryRecords[entryIndex]) == key)
+        {
+            if (!LoadEntry(*pMappedFile, pEntryRecords[entryIndex], functionTables, publicCounters))
+            {
+                GPA_LogDebugMessage("Ignoring a corrupt entry of the counter cache file %s.", m_cacheFilePath.c_str());
+                return false;
+            }
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool GPA_CounterCatalogCache::StorePublicCounters(const GPA_CounterCatalogKey& key, const GPA_DerivedCounters& publicCounters)
+{
+    if (m_cacheFilePath.empty())
+    {
+        return false;
+    }
+
+    // keep the valid entries of the other combinations, loaded from the current file; their native functions are not stored
+    std::vector<GPA_CounterCatalogKey>                 keys;
+    std::vector<GPA_DerivedCounters>                   storedCounters;
+    const std::vector<GPA_DerivedCounterFunctionTable> noFunctionTables;
+    const GPAMappedFile*                               pMappedFile = GetCurrentFile();
+
+    if (nullptr != pMappedFile)
+    {
+        gpa_uint32              entryCount    = 0;
+        const CacheEntryRecord* pEntryRecords = GetEntryRecords(*pMappedFile, entryCount);
+
+        storedCounters.reserve(entryCount);
+
+        for (gpa_uint32 entryIndex = 0; entryIndex < entryCount; ++entryIndex)
+        {
+            GPA_CounterCatalogKey entryKey = GetEntryKey(pEntryRecords[entryIndex]);
+            GPA_DerivedCounters   entryCounters;
+
+            if (!(entryKey == key) && LoadEntry(*pMappedFile, pEntryRecords[entryIndex], noFunctionTables, entryCounters))
+            {
+                keys.push_back(entryKey);
+                storedCounters.push_back(entryCounters);
+            }
+        }
+    }
+
+    std::vector<const GPA_DerivedCounters*> entries;
+
+    for (auto countersIter = storedCounters.cbegin(); countersIter != storedCounters.cend(); ++countersIter)
+    {
+        entries.push_back(&(*countersIter));
+    }
+
+    keys.push_back(key);
+    entries.push_back(&publicCounters);
+
+    // the file is laid out as the header, the entry records, the counter records, the internal counter indices and the string pool
+    gpa_uint64 counterCount         = 0;
+    gpa_uint64 internalCounterCount = 0;
+
+    for (auto entryIter = entries.cbegin(); entryIter != entries.cend(); ++entryIter)
+    {
+        counterCount += (*entryIter)->GetNumCounters();
+
+        for (gpa_uint32 counterIndex = 0; counterIndex < (*entryIter)->GetNumCounters(); ++counterIndex)
+        {
+            internalCounterCount += (*entryIter)->GetCounter(counterIndex)->m_internalCountersRequired.size();
+        }
+    }
+
+    const gpa_uint64 entryRecordsOffset     = sizeof(CacheFileHeader);
+    const gpa_uint64 counterRecordsOffset   = entryRecordsOffset + entries.size() * sizeof(CacheEntryRecord);
+    const gpa_uint64 internalCountersOffset = counterRecordsOffset + counterCount * sizeof(CacheCounterRecord);
+    const gpa_uint64 stringPoolOffset       = internalCountersOffset + internalCounterCount * sizeof(gpa_uint32);
+
+    std::vector<CacheEntryRecord>     entryRecords;
+    std::vector<CacheCounterRecord>   counterRecords;
+    std::vector<gpa_uint32>           internalCounters;
+    std::string                       stringPool;
+    std::map<std::string, gpa_uint64> stringOffsets;
+
+    for (size_t entryIndex = 0; entryIndex < entries.size(); ++entryIndex)
+    {
+        const GPA_DerivedCounters* pCounters   = entries[entryIndex];
+        CacheEntryRecord           entryRecord = {};
+
+        entryRecord.m_api                          = static_cast<gpa_uint32>(keys[entryIndex].m_api);
+        entryRecord.m_vendorId                     = keys[entryIndex].m_vendorId;
+        entryRecord.m_deviceId                     = keys[entryIndex].m_deviceId;
+        entryRecord.m_revisionId                   = keys[entryIndex].m_revisionId;
+        entryRecord.m_allowedCounters              = keys[entryIndex].m_allowedCounters;
+        entryRecord.m_generateAsicSpecificCounters = keys[entryIndex].m_generateAsicSpecificCounters;
+        entryRecord.m_counterCount                 = pCounters->GetNumCounters();
+        entryRecord.m_countersOffset               = counterRecordsOffset + counterRecords.size() * sizeof(CacheCounterRecord);
+        entryRecords.push_back(entryRecord);
+
+        for (gpa_uint32 counterIndex = 0; counterIndex < pCounters->GetNumCounters(); ++counterIndex)
+        {
+            const GPA_DerivedCounter* pCounter      = pCounters->GetCounter(counterIndex);
+            CacheCounterRecord        counterRecord = {};
+
+            counterRecord.m_nameOffset             = AddString(pCounter->m_pName, stringPoolOffset, stringPool, stringOffsets);
+            counterRecord.m_groupOffset            = AddString(pCounter->m_pGroup, stringPoolOffset, stringPool, stringOffsets);
+            counterRecord.m_descriptionOffset      = AddString(pCounter->m_pDescription, stringPoolOffset, stringPool, stringOffsets);
+            counterRecord.m_expressionOffset       = AddString(pCounter->m_pComputeExpression, stringPoolOffset, stringPool, stringOffsets);
+            counterRecord.m_internalCountersOffset = internalCountersOffset + internalCounters.size() * sizeof(gpa_uint32);
+            counterRecord.m_internalCounterCount   = static_cast<gpa_uint32>(pCounter->m_internalCountersRequired.size());
+            counterRecord.m_dataType               = static_cast<gpa_uint32>(pCounter->m_dataType);
+            counterRecord.m_usageType              = static_cast<gpa_uint32>(pCounter->m_usageType);
+            memcpy(counterRecord.m_uuid, &pCounter->m_uuid, sizeof(GPA_UUID));
+            counterRecords.push_back(counterRecord);
+
+            internalCounters.insert(internalCounters.end(), pCounter->m_internalCountersRequired.cbegin(), pCounter->m_internalCountersRequired.cend());
+        }
+    }
+
+    CacheFileHeader header = {};
+    header.m_magic         = CACHE_FILE_MAGIC;
+    header.m_version       = CACHE_FILE_VERSION;
+    header.m_gpaVersion[0] = GPA_MAJOR_VERSION;
+    header.m_gpaVersion[1] = GPA_MINOR_VERSION;
+    header.m_gpaVersion[2] = GPA_UPDATE_VERSION;
+    header.m_gpaVersion[3] = GPA_BUILD_NUMBER;
+    header.m_entryCount    = static_cast<gpa_uint32>(entryRecords.size());
+    header.m_fileSize      = stringPoolOffset + stringPool.size();
+
+    // write a new file private to this process, then rename it over the cache file, so that other processes never map a partial file
+    std::string tempFilePath;
+
+    if (!GPAUtil::CreateUniqueFile(m_cacheFilePath + ".", ".tmp", tempFilePath))
+    {
+        GPA_LogDebugMessage("Unable to create a temporary file for the counter cache file %s.", m_cacheFilePath.c_str());
+        return false;
+    }
+
+    {
+        std::ofstream cacheFile(tempFilePath.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+
+        if (!cacheFile.is_open())
+        {
+            std::remove(tempFilePath.c_str());
+            GPA_LogDebugMessage("Unable to open the counter cache file %s.", tempFilePath.c_str());
+            return false;
+        }
+
+        cacheFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        cacheFile.write(reinterpret_cast<const char*>(entryRecords.data()), entryRecords.size() * sizeof(CacheEntryRecord));
+        cacheFile.write(reinterpret_cast<const char*>(counterRecords.data()), counterRecords.size() * sizeof(CacheCounterRecord));
+        cacheFile.write(reinterpret_cast<const char*>(internalCounters.data()), internalCounters.size() * sizeof(gpa_uint32));
+        cacheFile.write(stringPool.data(), stringPool.size());
+
+        if (!cacheFile.good())
+        {
+            cacheFile.close();
+            std::remove(tempFilePath.c_str());
+            GPA_LogDebugMessage("Unable to write the counter cache file %s.", tempFilePath.c_str());
+            return false;
+        }
+    }
+
+    if (!GPAUtil::RenameFile(tempFilePath, m_cacheFilePath))
+    {
+        // another process may be mapping the cache file on platforms which do not allow replacing it; it is updated next time
+        std::remove(tempFilePath.c_str());
+        GPA_LogDebugMessage("Unable to replace the counter cache file %s.", m_cacheFilePath.c_str());
+        return false;
+    }
+
+    // the previously mapped file stays mapped, since counters loaded from it may still be in use
+    Open(m_cacheFilePath);
+    return true;
+}
+
+const GPAMappedFile* GPA_CounterCatalogCache::GetCurrentFile() const
+{
+    return m_mappedFiles.empty() ? nullptr : m_mappedFiles.back().get();
+}
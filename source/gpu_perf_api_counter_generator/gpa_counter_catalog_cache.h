@@ -0,0 +1,94 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Persistent on-disk cache of the counter catalog
+//==============================================================================
+
+#ifndef _GPA_COUNTER_CATALOG_CACHE_H_
+#define _GPA_COUNTER_CATALOG_CACHE_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gpu_perf_api_types.h"
+
+class GPA_DerivedCounters;               ///< forward declaration
+class GPAMappedFile;                     ///< forward declaration
+struct GPA_DerivedCounterFunctionTable;  ///< forward declaration
+
+/// Identifies the counters generated for an API/device combination
+struct GPA_CounterCatalogKey
+{
+    GPA_API_Type m_api;                           ///< the API of the counters
+    gpa_uint32   m_vendorId;                      ///< the vendor id of the device
+    gpa_uint32   m_deviceId;                      ///< the device id of the device
+    gpa_uint32   m_revisionId;                    ///< the revision id of the device
+    gpa_uint32   m_allowedCounters;               ///< bitmask of the allowed counter families
+    gpa_uint8    m_generateAsicSpecificCounters;  ///< flag indicating whether the counters are ASIC specific
+
+    /// Less-than operator used to look up the catalog entries
+    /// \param[in] other the key to compare with
+    /// \return true if this key orders before the other key
+    bool operator<(const GPA_CounterCatalogKey& other) const;
+
+    /// Equality operator
+    /// \param[in] other the key to compare with
+    /// \return true if both keys identify the same combination
+    bool operator==(const GPA_CounterCatalogKey& other) const;
+};
+
+/// Persistent cache of the public counters resolved for each API/device combination.
+///
+/// Resolving the public counters of a device means running the generated definitions of its hardware generation and
+/// applying the ASIC specific updates on top of them. The cache stores the result, so that the next process opening a
+/// context on the same device maps the file and points its counters at it, instead of resolving them again.
+/// The file is tagged with the GPA version that wrote it and is ignored by any other version. Strings are stored
+/// NUL-terminated and are used in place, so the counters loaded from a file are only valid while the cache is alive.
+/// Only the portable part of the counters is stored: the native function of a counter is not. It is attached again when
+/// the counter is loaded, from the functions generated for the device, provided that it was generated from the stored
+/// equation; otherwise the counter is computed from its equation.
+class GPA_CounterCatalogCache
+{
+public:
+    /// Initializes a new instance of the GPA_CounterCatalogCache class
+    GPA_CounterCatalogCache();
+
+    /// Destructor
+    ~GPA_CounterCatalogCache();
+
+    /// Maps the cache file, if it exists and was written by this version of GPA
+    /// \param[in] cacheFilePath the path of the cache file
+    /// \return true if the cache file was mapped, false if it does not exist or is not valid (it is then replaced on the next store)
+    bool Open(const std::string& cacheFilePath);
+
+    /// Loads the public counters of a combination from the cache file
+    /// \param[in] key the combination whose counters are loaded
+    /// \param[in] functionTables the native functions generated for the public counters of the combination, the ASIC specific table first
+    /// \param[out] publicCounters the public counters, which reference the mapped cache file
+    /// \return true if the counters of the combination are in the cache file, false otherwise
+    bool LoadPublicCounters(const GPA_CounterCatalogKey&                        key,
+                            const std::vector<GPA_DerivedCounterFunctionTable>& functionTables,
+                            GPA_DerivedCounters&                                publicCounters) const;
+
+    /// Stores the public counters of a combination in the cache file, keeping the other combinations already stored in it.
+    /// The file is written next to the cache file then renamed over it, so that other processes never map a partial file.
+    /// \param[in] key the combination whose counters are stored
+    /// \param[in] publicCounters the public counters to store
+    /// \return true if the cache file was written, false otherwise
+    bool StorePublicCounters(const GPA_CounterCatalogKey& key, const GPA_DerivedCounters& publicCounters);
+
+private:
+    GPA_CounterCatalogCache(const GPA_CounterCatalogCache&) = delete;
+    GPA_CounterCatalogCache& operator=(const GPA_CounterCatalogCache&) = delete;
+
+    /// Gets the mapped cache file the counters are loaded from
+    /// \return the most recently mapped cache file, or nullptr if no valid cache file is mapped
+    const GPAMappedFile* GetCurrentFile() const;
+
+    std::string                                 m_cacheFilePath;  ///< path of the cache file
+    std::vector<std::unique_ptr<GPAMappedFile>> m_mappedFiles;    ///< the mapped cache files; previous versions stay mapped while loaded counters reference them
+};
+
+#endif  // _GPA_COUNTER_CATALOG_CACHE_H_
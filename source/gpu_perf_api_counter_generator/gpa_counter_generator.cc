@@ -11,6 +11,7 @@
 #include "DeviceInfoUtils.h"
 #include "gpa_hw_info.h"
 #include "gpa_counter_generator_base.h"
+#include "gpa_counter_catalog.h"
 #include "gpa_counter_generator_scheduler_manager.h"
 
 
@@ -65,18 +66,6 @@ GPA_Status GenerateCounters(GPA_API_Type           desiredAPI,
         return GPA_STATUS_ERROR_HARDWARE_NOT_SUPPORTED;
     }
 
-    GPA_Status                status        = GPA_STATUS_OK;
-    GPA_CounterGeneratorBase* pTmpAccessor  = nullptr;
-    IGPACounterScheduler*     pTmpScheduler = nullptr;
-
-    bool retCode = CounterGeneratorSchedulerManager::Instance()->GetCounterGenerator(desiredAPI, desiredGeneration, pTmpAccessor);
-
-    if (!retCode)
-    {
-        GPA_LogError("Requesting available counters from an unsupported API or hardware generation.");
-        return GPA_STATUS_ERROR_HARDWARE_NOT_SUPPORTED;
-    }
-
     bool allowPublic          = (flags & GPA_OPENCONTEXT_HIDE_PUBLIC_COUNTERS_BIT) == 0;
     bool allowSoftware        = (flags & GPA_OPENCONTEXT_HIDE_SOFTWARE_COUNTERS_BIT) == 0;
     bool allowHardwareExposed = (flags & GPA_OPENCONTEXT_ENABLE_HARDWARE_COUNTERS_BIT) == GPA_OPENCONTEXT_ENABLE_HARDWARE_COUNTERS_BIT;
@@ -87,8 +76,19 @@ GPA_Status GenerateCounters(GPA_API_Type           desiredAPI,
     enableHardware        = allowAllHardware;
 #endif
 
-    pTmpAccessor->SetAllowedCounters(allowPublic, enableHardware, allowSoftware);
-    status = pTmpAccessor->GenerateCounters(desiredGeneration, cardInfo.m_asicType, generateAsicSpecificCounters);
+    GPA_CounterGeneratorBase* pTmpAccessor = nullptr;
+
+    GPA_Status status = GPA_CounterCatalog::Instance()->GetCounters(desiredAPI,
+                                                                    desiredGeneration,
+                                                                    cardInfo.m_asicType,
+                                                                    vendorId,
+                                                                    deviceId,
+                                                                    revisionId,
+                                                                    allowPublic,
+                                                                    enableHardware,
+                                                                    allowSoftware,
+                                                                    generateAsicSpecificCounters,
+                                                                    pTmpAccessor);
 
     if (status == GPA_STATUS_OK)
     {
@@ -96,9 +96,9 @@ GPA_Status GenerateCounters(GPA_API_Type           desiredAPI,
 
         if (nullptr != ppCounterSchedulerOut)
         {
-            retCode = CounterGeneratorSchedulerManager::Instance()->GetCounterScheduler(desiredAPI, desiredGeneration, pTmpScheduler);
+            IGPACounterScheduler* pTmpScheduler = nullptr;
 
-            if (!retCode)
+            if (!CounterGeneratorSchedulerManager::Instance()->CreateCounterScheduler(desiredAPI, desiredGeneration, pTmpScheduler))
             {
                 GPA_LogError("Requesting available counters from an unsupported API or hardware generation.");
                 return GPA_STATUS_ERROR_HARDWARE_NOT_SUPPORTED;
@@ -111,3 +111,8 @@ GPA_Status GenerateCounters(GPA_API_Type           desiredAPI,
 
     return status;
 }
+
+void SetCounterCacheFilePath(const char* pCacheFilePath)
+{
+    GPA_CounterCatalog::Instance()->SetCacheFilePath((nullptr != pCacheFilePath) ? pCacheFilePath : "");
+}
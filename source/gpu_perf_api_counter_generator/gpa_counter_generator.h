@@ -13,15 +13,17 @@
 #include "gpu_perf_api_types.h"
 
 // Internal function. We don't want this exposed by the internal DLLs though, so it doesn't use GPALIB_DECL
-/// Generates a counter accessor object that can be used to obtain the counters to expose
+/// Gets a counter accessor object that can be used to obtain the counters to expose, generating the counters if needed
 /// \param[in] desiredAPI The API to generate counters for
 /// \param[in] vendorId The vendor id to generate counters for
 /// \param[in] deviceId The device id to generate counters for
 /// \param[in] revisionId The revision id to generate counters for
 /// \param[in] flags Flags used to initialize the context. Should be a combination of GPA_OpenContext_Bits
 /// \param[in] generateAsicSpecificCounters Flag that indicates whether the counters should be ASIC specific, if available.
-/// \param[inout] ppCounterAccessorOut Address of a GPA_ICounterAccessor pointer which will be set to the necessary counter accessor
-/// \param[inout] ppCounterSchedulerOut Address of a GPA_ICounterScheduler pointer which will be set to the necessary counter scheduler
+/// \param[inout] ppCounterAccessorOut Address of a GPA_ICounterAccessor pointer which will be set to the necessary counter accessor.
+///                The accessor is shared with the other callers requesting the same counters and must not be modified or deleted
+/// \param[inout] ppCounterSchedulerOut Address of a GPA_ICounterScheduler pointer which will be set to a new counter scheduler (may be nullptr).
+///                The scheduler is owned by the caller, which must delete it when it is no longer needed
 /// \return GPA_STATUS_ERROR_NULL_POINTER if ppCounterAccessorOut or ppCounterSchedulerOut is nullptr
 /// \return GPA_STATUS_ERROR_COUNTER_NOT_FOUND if the desired API is not supported
 /// \return GPA_STATUS_ERROR_NOT_ENABLED if the desired API is not allowing any counters to be exposed
@@ -36,4 +38,8 @@ GPA_Status GenerateCounters(GPA_API_Type           desiredAPI,
                             IGPACounterAccessor**  ppCounterAccessorOut,
                             IGPACounterScheduler** ppCounterSchedulerOut);
 
+/// Sets the file in which the public counters resolved for each device are cached across processes
+/// \param[in] pCacheFilePath the path of the cache file, or nullptr or an empty string to disable the cache
+void SetCounterCacheFilePath(const char* pCacheFilePath);
+
 #endif  // _GPA_COUNTER_GENERATOR_H_
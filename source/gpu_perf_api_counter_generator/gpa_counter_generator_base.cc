@@ -5,6 +5,8 @@
 /// \brief Base class for counter generation
 //==============================================================================
 
+#include <cstring>
+
 #include "gpa_counter_generator_base.h"
 
 GPA_CounterGeneratorBase::GPA_CounterGeneratorBase()
@@ -12,6 +14,8 @@ GPA_CounterGeneratorBase::GPA_CounterGeneratorBase()
     , m_doAllowHardwareCounters(false)
     , m_doAllowSoftwareCounters(false)
     , m_doAllowHardwareExposedCounters(false)
+    , m_isCounterUuidIndexBuilt(false)
+    , m_trackedMemory(GPA_MEMORY_CATEGORY_COUNTER_CATALOG, sizeof(GPA_CounterGeneratorBase))
 {
 }
 
@@ -33,7 +37,10 @@ void GPA_CounterGeneratorBase::SetAllowedCounters(bool bAllowPublicCounters, boo
     m_doAllowSoftwareCounters = bAllowSoftwareCounters;
 }
 
-GPA_Status GPA_CounterGeneratorBase::GenerateCounters(GDT_HW_GENERATION desiredGeneration, GDT_HW_ASIC_TYPE asicType, gpa_uint8 generateAsicSpecificCounters)
+GPA_Status GPA_CounterGeneratorBase::GenerateCounters(GDT_HW_GENERATION          desiredGeneration,
+                                                      GDT_HW_ASIC_TYPE           asicType,
+                                                      gpa_uint8                  generateAsicSpecificCounters,
+                                                      const GPA_DerivedCounters* pCachedPublicCounters)
 {
     GPA_Status status = GPA_STATUS_ERROR_NOT_ENABLED;
 
@@ -41,7 +48,19 @@ GPA_Status GPA_CounterGeneratorBase::GenerateCounters(GDT_HW_GENERATION desiredG
     m_hardwareCounters.Clear();
     m_softwareCounters.Clear();
 
-    if (m_doAllowPublicCounters)
+    {
+        std::lock_guard<std::mutex> lock(m_counterIndexCacheMutex);
+        m_counterUuidIndex.clear();
+        m_isCounterUuidIndexBuilt = false;
+    }
+
+    if (m_doAllowPublicCounters && nullptr != pCachedPublicCounters)
+    {
+        m_publicCounters                     = *pCachedPublicCounters;
+        m_publicCounters.m_countersGenerated = true;
+        status                               = GPA_STATUS_OK;
+    }
+    else if (m_doAllowPublicCounters)
     {
         status = GeneratePublicCounters(desiredGeneration, asicType, generateAsicSpecificCounters, &m_publicCounters);
 
@@ -87,6 +106,9 @@ GPA_Status GPA_CounterGeneratorBase::GenerateCounters(GDT_HW_GENERATION desiredG
         status = GPA_STATUS_ERROR_HARDWARE_NOT_SUPPORTED;
     }
 
+    m_trackedMemory.SetBytes(sizeof(GPA_CounterGeneratorBase) + m_publicCounters.GetMemoryUsage() + m_hardwareCounters.GetMemoryUsage() +
+                             m_softwareCounters.GetMemoryUsage());
+
     return status;
 }
 
@@ -287,6 +309,8 @@ bool GPA_CounterGeneratorBase::GetCounterIndex(const char* pName, gpa_uint32* pI
         return false;
     }
 
+    std::lock_guard<std::mutex> lock(m_counterIndexCacheMutex);
+
     CounterNameIndexMap::const_iterator it = m_counterIndexCache.find(pName);
 
     if (m_counterIndexCache.end() != it)
@@ -435,6 +459,76 @@ bool GPA_CounterGeneratorBase::GetCounterIndex(const char* pName, gpa_uint32* pI
     return retVal;
 }
 
+bool GPA_CounterGeneratorBase::GetCounterIndexByUuid(const GPA_UUID& uuid, gpa_uint32* pIndex) const
+{
+    if (nullptr == pIndex)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_counterIndexCacheMutex);
+
+    BuildCounterUuidIndex();
+
+    CounterUuidIndexMap::const_iterator it = m_counterUuidIndex.find(uuid);
+
+    if (m_counterUuidIndex.end() == it)
+    {
+        return false;
+    }
+
+    *pIndex = it->second;
+    return true;
+}
+
+size_t GPA_CounterGeneratorBase::CounterUuidHash::operator()(const GPA_UUID& uuid) const
+{
+    // UUIDs are already well distributed, so folding their fields is enough
+#ifdef _WIN32
+    gpa_uint64 data123 = (static_cast<gpa_uint64>(uuid.Data1) << 32) ^ (static_cast<gpa_uint64>(uuid.Data2) << 16) ^ uuid.Data3;
+    gpa_uint64 data4   = 0;
+    memcpy(&data4, uuid.Data4, sizeof(uuid.Data4));
+#else
+    // the fields are read one by one, as GPA_UUID has padding on Linux
+    gpa_uint64 data123 = (static_cast<gpa_uint64>(uuid.m_data1) << 32) ^ (static_cast<gpa_uint64>(uuid.m_data2) << 16) ^ uuid.m_data3;
+    gpa_uint64 data4   = 0;
+    memcpy(&data4, uuid.m_data4, sizeof(uuid.m_data4));
+#endif
+
+    return std::hash<gpa_uint64>()(data123 ^ (data4 * 0x9E3779B97F4A7C15ull));
+}
+
+bool GPA_CounterGeneratorBase::CounterUuidEqual::operator()(const GPA_UUID& uuid1, const GPA_UUID& uuid2) const
+{
+#ifdef _WIN32
+    return 0 == memcmp(&uuid1, &uuid2, sizeof(GPA_UUID));
+#else
+    return uuid1.m_data1 == uuid2.m_data1 && uuid1.m_data2 == uuid2.m_data2 && uuid1.m_data3 == uuid2.m_data3 &&
+           0 == memcmp(uuid1.m_data4, uuid2.m_data4, sizeof(uuid1.m_data4));
+#endif
+}
+
+void GPA_CounterGeneratorBase::BuildCounterUuidIndex() const
+{
+    if (m_isCounterUuidIndexBuilt)
+    {
+        return;
+    }
+
+    // The index is built on the first lookup rather than in GenerateCounters, as hashing the UUID of a hardware
+    // counter synthesizes its name, which most applications never query
+    gpa_uint32 numCounters = GetNumCounters();
+    m_counterUuidIndex.reserve(numCounters);
+
+    for (gpa_uint32 i = 0; i < numCounters; i++)
+    {
+        // emplace keeps the lowest index if two counters share a UUID
+        m_counterUuidIndex.emplace(GetCounterUuid(i), i);
+    }
+
+    m_isCounterUuidIndexBuilt = true;
+}
+
 bool GPA_CounterGeneratorBase::GetCounterIndex(const GpaHwBlock&    gpa_hardware_block,
                                                const gpa_uint32&    block_instance,
                                                const gpa_uint32&    block_event_id,
@@ -772,6 +866,23 @@ const GPA_DerivedCounter* GPA_CounterGeneratorBase::GetPublicCounter(gpa_uint32
     return m_publicCounters.GetCounter(index);
 }
 
+const GPA_DerivedCounters* GPA_CounterGeneratorBase::GetPublicCounters() const
+{
+    return &m_publicCounters;
+}
+
+void GPA_CounterGeneratorBase::GetPublicCounterFunctions(GDT_HW_GENERATION                             desiredGeneration,
+                                                         GDT_HW_ASIC_TYPE                              asicType,
+                                                         gpa_uint8                                     generateAsicSpecificCounters,
+                                                         std::vector<GPA_DerivedCounterFunctionTable>& functionTables) const
+{
+    UNREFERENCED_PARAMETER(desiredGeneration);
+    UNREFERENCED_PARAMETER(asicType);
+    UNREFERENCED_PARAMETER(generateAsicSpecificCounters);
+
+    functionTables.clear();
+}
+
 const GPA_HardwareCounterDescExt* GPA_CounterGeneratorBase::GetHardwareCounterExt(gpa_uint32 index) const
 {
     return &(m_hardwareCounters.m_counters[index]);
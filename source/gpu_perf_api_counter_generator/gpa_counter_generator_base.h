@@ -8,11 +8,13 @@
 #ifndef _GPA_COUNTER_GENERATOR_BASE_H_
 #define _GPA_COUNTER_GENERATOR_BASE_H_
 
+#include <mutex>
 #include <unordered_map>
 
 #include "gpa_hardware_counters.h"
 #include "gpa_software_counters.h"
 #include "gpa_counter_accessor_interface.h"
+#include "gpa_memory_tracker.h"
 
 /// Base class for counter generation
 class GPA_CounterGeneratorBase : public IGPACounterAccessor
@@ -76,6 +78,9 @@ public:
     /// \copydoc IGPACounterAccessor::GetCounterIndex()
     bool GetCounterIndex(const char* pName, gpa_uint32* pIndex) const override;
 
+    /// \copydoc IGPACounterAccessor::GetCounterIndexByUuid()
+    bool GetCounterIndexByUuid(const GPA_UUID& uuid, gpa_uint32* pIndex) const override;
+
     /// \copydoc IGPACounterAccessor::GetCounterIndex()
     bool GetCounterIndex(const GpaHwBlock& gpa_hardware_block,
                          const gpa_uint32& block_instance,
@@ -96,8 +101,27 @@ public:
     /// \param desiredGeneration the generation whose counters are needed
     /// \param asicType the ASIC type whose counters are needed
     /// \param generateAsicSpecificCounters Flag that indicates whether the counters should be ASIC specific, if available.
+    /// \param pCachedPublicCounters the public counters previously resolved for the same device, used instead of generating them, or nullptr
     /// \return GPA_STATUS_OK on success
-    GPA_Status GenerateCounters(GDT_HW_GENERATION desiredGeneration, GDT_HW_ASIC_TYPE asicType, gpa_uint8 generateAsicSpecificCounters);
+    GPA_Status GenerateCounters(GDT_HW_GENERATION          desiredGeneration,
+                                GDT_HW_ASIC_TYPE           asicType,
+                                gpa_uint8                  generateAsicSpecificCounters,
+                                const GPA_DerivedCounters* pCachedPublicCounters = nullptr);
+
+    /// Gets the generated public counters
+    /// \return the generated public counters
+    const GPA_DerivedCounters* GetPublicCounters() const;
+
+    /// Gets the native functions of the public counters of the specified generation, so that they can be attached to
+    /// public counters which were not generated by this process, such as the ones loaded from the counter catalog cache
+    /// \param desiredGeneration the generation whose counters are needed
+    /// \param asicType the ASIC type whose counters are needed
+    /// \param generateAsicSpecificCounters Flag that indicates whether the counters should be ASIC specific, if available.
+    /// \param[out] functionTables the tables of native functions, the ASIC specific table before the generation one
+    virtual void GetPublicCounterFunctions(GDT_HW_GENERATION                             desiredGeneration,
+                                           GDT_HW_ASIC_TYPE                              asicType,
+                                           gpa_uint8                                     generateAsicSpecificCounters,
+                                           std::vector<GPA_DerivedCounterFunctionTable>& functionTables) const;
 
     /// \copydoc IGPACounterAccessor::ComputeSWCounterValue()
     void ComputeSWCounterValue(gpa_uint32 softwareCounterIndex, gpa_uint64 value, void* pResult, const GPA_HWInfo* pHwInfo) const override;
@@ -188,6 +212,35 @@ private:
     typedef std::unordered_map<std::string, gpa_uint32> CounterNameIndexMap;  ///< typedef for an unordered_map from counter name to index
     static const gpa_uint32                             ms_COUNTER_NOT_FOUND = static_cast<gpa_uint32>(-1);  ///< const indicating that a counter was not found
     mutable CounterNameIndexMap m_counterIndexCache;  ///< cache of counter indexes, so we don't have to look up a counter more than once (it can be expensive)
+    mutable std::mutex          m_counterIndexCacheMutex;  ///< mutex protecting the counter index cache, as the generated counters may be shared by several contexts
+
+    /// Hash functor for a counter UUID
+    struct CounterUuidHash
+    {
+        /// Hashes a counter UUID
+        /// \param[in] uuid the UUID to hash
+        /// \return the hash of the UUID
+        size_t operator()(const GPA_UUID& uuid) const;
+    };
+
+    /// Equality functor for a counter UUID
+    struct CounterUuidEqual
+    {
+        /// Compares two counter UUIDs
+        /// \param[in] uuid1 the first UUID
+        /// \param[in] uuid2 the second UUID
+        /// \return true if both UUIDs are the same
+        bool operator()(const GPA_UUID& uuid1, const GPA_UUID& uuid2) const;
+    };
+
+    typedef std::unordered_map<GPA_UUID, gpa_uint32, CounterUuidHash, CounterUuidEqual> CounterUuidIndexMap;  ///< typedef for an unordered_map from counter UUID to index
+
+    /// Builds the index of the counter UUIDs, if it is not built yet for the generated counters. Must be called with m_counterIndexCacheMutex held.
+    void BuildCounterUuidIndex() const;
+
+    mutable CounterUuidIndexMap m_counterUuidIndex;         ///< index of the generated counters by UUID, built on the first lookup by UUID
+    mutable bool                m_isCounterUuidIndexBuilt;  ///< flag indicating whether the UUID index is built for the generated counters
+    GPATrackedMemory            m_trackedMemory;            ///< accounting of the memory held by the generated counters
 };
 
 #endif  //_GPA_COUNTER_GENERATOR_BASE_H_
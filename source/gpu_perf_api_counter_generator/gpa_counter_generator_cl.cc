@@ -32,7 +32,8 @@ GPA_CounterGeneratorCL::GPA_CounterGeneratorCL()
 
     for (int gen = GDT_HW_GENERATION_FIRST_AMD; gen < GDT_HW_GENERATION_LAST; gen++)
     {
-        CounterGeneratorSchedulerManager::Instance()->RegisterCounterGenerator(GPA_API_OPENCL, static_cast<GDT_HW_GENERATION>(gen), this);
+        CounterGeneratorSchedulerManager::Instance()->RegisterCounterGenerator(
+            GPA_API_OPENCL, static_cast<GDT_HW_GENERATION>(gen), CreateCounterGeneratorInstance<GPA_CounterGeneratorCL>);
     }
 }
 
@@ -108,6 +109,44 @@ GPA_Status GPA_CounterGeneratorCL::GeneratePublicCounters(GDT_HW_GENERATION    d
     return status;
 }
 
+void GPA_CounterGeneratorCL::GetPublicCounterFunctions(GDT_HW_GENERATION                             desired_generation,
+                                                       GDT_HW_ASIC_TYPE                              asic_type,
+                                                       gpa_uint8                                     generate_asic_specific_counters,
+                                                       std::vector<GPA_DerivedCounterFunctionTable>& function_tables) const
+{
+    GPA_DerivedCounterFunctionTable asic_functions = {nullptr, 0};
+
+    function_tables.clear();
+
+    if (desired_generation == GDT_HW_GENERATION_VOLCANICISLAND)
+    {
+        if (generate_asic_specific_counters && clgfx8asics::GetPublicAsicSpecificCounterFunctions(desired_generation, asic_type, asic_functions))
+        {
+            function_tables.push_back(asic_functions);
+        }
+
+        function_tables.push_back(GetPublicDerivedCounterFunctionsCLGfx8());
+    }
+    else if (desired_generation == GDT_HW_GENERATION_GFX9)
+    {
+        if (generate_asic_specific_counters && clgfx9asics::GetPublicAsicSpecificCounterFunctions(desired_generation, asic_type, asic_functions))
+        {
+            function_tables.push_back(asic_functions);
+        }
+
+        function_tables.push_back(GetPublicDerivedCounterFunctionsCLGfx9());
+    }
+    else if (desired_generation == GDT_HW_GENERATION_GFX10)
+    {
+        if (generate_asic_specific_counters && clgfx10asics::GetPublicAsicSpecificCounterFunctions(desired_generation, asic_type, asic_functions))
+        {
+            function_tables.push_back(asic_functions);
+        }
+
+        function_tables.push_back(GetPublicDerivedCounterFunctionsCLGfx10());
+    }
+}
+
 int GPA_CounterGeneratorCL::GetDriverGroupId(GDT_HW_GENERATION desired_generation, int blockIndex) const
 {
     int result = blockIndex;
@@ -237,14 +276,17 @@ bool GPA_CounterGeneratorCL::GenerateInternalCounters(GPA_HardwareCounters* hard
 
             counter.m_counterIdDriver = 0;
 
+            hardware_counters->m_counters.push_back(counter);
+
 #if defined(_DEBUG) && defined(_WIN32) && defined(AMDT_INTERNAL)
 
             if (nullptr != pFile)
             {
+                // block instance counters only have a name once they have been added
+                const char* pCounterName = hardware_counters->GetCounterName(static_cast<gpa_uint32>(hardware_counters->m_counters.size() - 1));
+                size_t      size         = strlen(pCounterName);
                 fwrite("    \"", 1, 5, pFile);
-                std::string tmpName(counter.m_pHardwareCounter->m_pName);
-                size_t      size = tmpName.size();
-                fwrite(counter.m_pHardwareCounter->m_pName, 1, size, pFile);
+                fwrite(pCounterName, 1, size, pFile);
                 fwrite("\",", 1, 2, pFile);
 #ifdef EXTRA_COUNTER_INFO
                 // this can be useful for debugging counter definitions
@@ -259,7 +301,6 @@ bool GPA_CounterGeneratorCL::GenerateInternalCounters(GPA_HardwareCounters* hard
             }
 
 #endif
-            hardware_counters->m_counters.push_back(counter);
         }
     }
 
@@ -40,7 +40,8 @@ GPA_CounterGeneratorDX11::GPA_CounterGeneratorDX11()
 
     for (int gen = GDT_HW_GENERATION_FIRST_AMD; gen < GDT_HW_GENERATION_LAST; gen++)
     {
-        CounterGeneratorSchedulerManager::Instance()->RegisterCounterGenerator(GPA_API_DIRECTX_11, static_cast<GDT_HW_GENERATION>(gen), this);
+        CounterGeneratorSchedulerManager::Instance()->RegisterCounterGenerator(
+            GPA_API_DIRECTX_11, static_cast<GDT_HW_GENERATION>(gen), CreateCounterGeneratorInstance<GPA_CounterGeneratorDX11>);
     }
 }
 
@@ -121,14 +122,17 @@ bool GPA_CounterGeneratorDX11::GenerateInternalCounters(GPA_HardwareCounters* pH
                 counter.m_counterIdDriver = 0;
             }
 
+            pHardwareCounters->m_counters.push_back(counter);
+
 #if defined(_DEBUG) && defined(AMDT_INTERNAL)
 
             if (nullptr != pFile)
             {
+                // block instance counters only have a name once they have been added
+                const char* pCounterName = pHardwareCounters->GetCounterName(static_cast<gpa_uint32>(pHardwareCounters->m_counters.size() - 1));
+                size_t      size         = strlen(pCounterName);
                 fwrite("    \"", 1, 5, pFile);
-                std::string tmpName(counter.m_pHardwareCounter->m_pName);
-                size_t      size = tmpName.size();
-                fwrite(counter.m_pHardwareCounter->m_pName, 1, size, pFile);
+                fwrite(pCounterName, 1, size, pFile);
                 fwrite("\",", 1, 2, pFile);
 #ifdef EXTRA_COUNTER_INFO
                 // this can be useful for debugging counter definitions
@@ -143,7 +147,6 @@ bool GPA_CounterGeneratorDX11::GenerateInternalCounters(GPA_HardwareCounters* pH
             }
 
 #endif
-            pHardwareCounters->m_counters.push_back(counter);
             ++globalCounterIndex;
         }
     }
@@ -230,6 +233,44 @@ GPA_Status GPA_CounterGeneratorDX11::GeneratePublicCounters(GDT_HW_GENERATION
     return status;
 }
 
+void GPA_CounterGeneratorDX11::GetPublicCounterFunctions(GDT_HW_GENERATION                             desiredGeneration,
+                                                         GDT_HW_ASIC_TYPE                              asicType,
+                                                         gpa_uint8                                     generateAsicSpecificCounters,
+                                                         std::vector<GPA_DerivedCounterFunctionTable>& functionTables) const
+{
+    GPA_DerivedCounterFunctionTable asicFunctions = {nullptr, 0};
+
+    functionTables.clear();
+
+    if (desiredGeneration == GDT_HW_GENERATION_VOLCANICISLAND)
+    {
+        if (generateAsicSpecificCounters && dx11gfx8asics::GetPublicAsicSpecificCounterFunctions(desiredGeneration, asicType, asicFunctions))
+        {
+            functionTables.push_back(asicFunctions);
+        }
+
+        functionTables.push_back(GetPublicDerivedCounterFunctionsDX11Gfx8());
+    }
+    else if (desiredGeneration == GDT_HW_GENERATION_GFX9)
+    {
+        if (generateAsicSpecificCounters && dx11gfx9asics::GetPublicAsicSpecificCounterFunctions(desiredGeneration, asicType, asicFunctions))
+        {
+            functionTables.push_back(asicFunctions);
+        }
+
+        functionTables.push_back(GetPublicDerivedCounterFunctionsDX11Gfx9());
+    }
+    else if (desiredGeneration == GDT_HW_GENERATION_GFX10)
+    {
+        if (generateAsicSpecificCounters && dx11gfx10asics::GetPublicAsicSpecificCounterFunctions(desiredGeneration, asicType, asicFunctions))
+        {
+            functionTables.push_back(asicFunctions);
+        }
+
+        functionTables.push_back(GetPublicDerivedCounterFunctionsDX11Gfx10());
+    }
+}
+
 GPA_Status GPA_CounterGeneratorDX11::GenerateHardwareCounters(GDT_HW_GENERATION     desiredGeneration,
                                                               GDT_HW_ASIC_TYPE      asicType,
                                                               gpa_uint8             generateAsicSpecificCounters,
@@ -13,7 +13,7 @@ GPA_CounterGeneratorDX11NonAMD::GPA_CounterGeneratorDX11NonAMD()
     GPA_CounterGeneratorBase::SetAllowedCounters(false, false, true);  //enable sw counters
 
     CounterGeneratorSchedulerManager::Instance()->RegisterCounterGenerator(
-        GPA_API_DIRECTX_11, GDT_HW_GENERATION_INTEL, this, false);  // allow future registrations to override this default one
+        GPA_API_DIRECTX_11, GDT_HW_GENERATION_INTEL, CreateCounterGeneratorInstance<GPA_CounterGeneratorDX11NonAMD>, false);  // allow future registrations to override this default one
     CounterGeneratorSchedulerManager::Instance()->RegisterCounterGenerator(
-        GPA_API_DIRECTX_11, GDT_HW_GENERATION_NVIDIA, this, false);  // allow future registrations to override this default one
+        GPA_API_DIRECTX_11, GDT_HW_GENERATION_NVIDIA, CreateCounterGeneratorInstance<GPA_CounterGeneratorDX11NonAMD>, false);  // allow future registrations to override this default one
 }
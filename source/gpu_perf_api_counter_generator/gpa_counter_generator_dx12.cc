@@ -66,7 +66,8 @@ GPA_CounterGeneratorDX12::GPA_CounterGeneratorDX12()
 
     for (int gen = GDT_HW_GENERATION_SOUTHERNISLAND; gen < GDT_HW_GENERATION_LAST; gen++)
     {
-        CounterGeneratorSchedulerManager::Instance()->RegisterCounterGenerator(GPA_API_DIRECTX_12, static_cast<GDT_HW_GENERATION>(gen), this);
+        CounterGeneratorSchedulerManager::Instance()->RegisterCounterGenerator(
+            GPA_API_DIRECTX_12, static_cast<GDT_HW_GENERATION>(gen), CreateCounterGeneratorInstance<GPA_CounterGeneratorDX12>);
     }
 }
 
@@ -153,6 +154,44 @@ GPA_Status GPA_CounterGeneratorDX12::GeneratePublicCounters(GDT_HW_GENERATION
     return status;
 }
 
+void GPA_CounterGeneratorDX12::GetPublicCounterFunctions(GDT_HW_GENERATION                             desiredGeneration,
+                                                         GDT_HW_ASIC_TYPE                              asicType,
+                                                         gpa_uint8                                     generateAsicSpecificCounters,
+                                                         std::vector<GPA_DerivedCounterFunctionTable>& functionTables) const
+{
+    GPA_DerivedCounterFunctionTable asicFunctions = {nullptr, 0};
+
+    functionTables.clear();
+
+    if (desiredGeneration == GDT_HW_GENERATION_VOLCANICISLAND)
+    {
+        if (generateAsicSpecificCounters && dx12gfx8asics::GetPublicAsicSpecificCounterFunctions(desiredGeneration, asicType, asicFunctions))
+        {
+            functionTables.push_back(asicFunctions);
+        }
+
+        functionTables.push_back(GetPublicDerivedCounterFunctionsDX12Gfx8());
+    }
+    else if (desiredGeneration == GDT_HW_GENERATION_GFX9)
+    {
+        if (generateAsicSpecificCounters && dx12gfx9asics::GetPublicAsicSpecificCounterFunctions(desiredGeneration, asicType, asicFunctions))
+        {
+            functionTables.push_back(asicFunctions);
+        }
+
+        functionTables.push_back(GetPublicDerivedCounterFunctionsDX12Gfx9());
+    }
+    else if (desiredGeneration == GDT_HW_GENERATION_GFX10)
+    {
+        if (generateAsicSpecificCounters && dx12gfx10asics::GetPublicAsicSpecificCounterFunctions(desiredGeneration, asicType, asicFunctions))
+        {
+            functionTables.push_back(asicFunctions);
+        }
+
+        functionTables.push_back(GetPublicDerivedCounterFunctionsDX12Gfx10());
+    }
+}
+
 bool GPA_CounterGeneratorDX12::GenerateInternalCounters(GPA_HardwareCounters* pHardwareCounters, GDT_HW_GENERATION generation)
 {
     pHardwareCounters->m_counters.clear();
@@ -185,14 +224,17 @@ bool GPA_CounterGeneratorDX12::GenerateInternalCounters(GPA_HardwareCounters* pH
             counter.m_pHardwareCounter = &(pGroupCounters[c]);
             counter.m_groupIdDriver    = blockId;
 
+            pHardwareCounters->m_counters.push_back(counter);
+
 #if defined(_DEBUG) && defined(AMDT_INTERNAL)
 
             if (nullptr != pFile)
             {
+                // block instance counters only have a name once they have been added
+                const char* pCounterName = pHardwareCounters->GetCounterName(static_cast<gpa_uint32>(pHardwareCounters->m_counters.size() - 1));
+                size_t      size         = strlen(pCounterName);
                 fwrite("    \"", 1, 5, pFile);
-                std::string tmpName(counter.m_pHardwareCounter->m_pName);
-                size_t      size = tmpName.size();
-                fwrite(counter.m_pHardwareCounter->m_pName, 1, size, pFile);
+                fwrite(pCounterName, 1, size, pFile);
                 fwrite("\",", 1, 2, pFile);
 #ifdef EXTRA_COUNTER_INFO
                 // this can be useful for debugging counter definitions
@@ -207,7 +249,6 @@ bool GPA_CounterGeneratorDX12::GenerateInternalCounters(GPA_HardwareCounters* pH
             }
 
 #endif
-            pHardwareCounters->m_counters.push_back(counter);
             ++globalCounterIndex;
         }
     }
@@ -17,6 +17,12 @@ public:
     /// Constructor
     GPA_CounterGeneratorDX12();
 
+    /// \copydoc GPA_CounterGeneratorBase::GetPublicCounterFunctions
+    void GetPublicCounterFunctions(GDT_HW_GENERATION                             desiredGeneration,
+                                   GDT_HW_ASIC_TYPE                              asicType,
+                                   gpa_uint8                                     generateAsicSpecificCounters,
+                                   std::vector<GPA_DerivedCounterFunctionTable>& functionTables) const override;
+
     /// Destructor
     virtual ~GPA_CounterGeneratorDX12() = default;
 
@@ -39,7 +39,8 @@ GPA_CounterGeneratorGL::GPA_CounterGeneratorGL()
     // TODO: need to make some changes to support GPUTime counter on Intel and NVidia in public build
     for (int gen = GDT_HW_GENERATION_FIRST_AMD; gen < GDT_HW_GENERATION_LAST; gen++)
     {
-        CounterGeneratorSchedulerManager::Instance()->RegisterCounterGenerator(GPA_API_OPENGL, static_cast<GDT_HW_GENERATION>(gen), this);
+        CounterGeneratorSchedulerManager::Instance()->RegisterCounterGenerator(
+            GPA_API_OPENGL, static_cast<GDT_HW_GENERATION>(gen), CreateCounterGeneratorInstance<GPA_CounterGeneratorGL>);
     }
 }
 
@@ -241,14 +242,17 @@ GPA_Status GPA_CounterGeneratorGL::GenerateInternalCounters(GPA_HardwareCounters
             counter.m_groupIdDriver   = g;
             counter.m_counterIdDriver = 0;
 
+            pHardwareCounters->m_counters.push_back(counter);
+
 #if defined(_DEBUG) && defined(_WIN32) && defined(AMDT_INTERNAL)
 
             if (nullptr != pFile)
             {
+                // block instance counters only have a name once they have been added
+                const char* pCounterName = pHardwareCounters->GetCounterName(static_cast<gpa_uint32>(pHardwareCounters->m_counters.size() - 1));
+                size_t      size         = strlen(pCounterName);
                 fwrite("    \"", 1, 5, pFile);
-                std::string tmpName(counter.m_pHardwareCounter->m_pName);
-                size_t      size = tmpName.size();
-                fwrite(counter.m_pHardwareCounter->m_pName, 1, size, pFile);
+                fwrite(pCounterName, 1, size, pFile);
                 fwrite("\",", 1, 2, pFile);
 #ifdef EXTRA_COUNTER_INFO
                 // this can be useful for debugging counter definitions
@@ -263,7 +267,6 @@ GPA_Status GPA_CounterGeneratorGL::GenerateInternalCounters(GPA_HardwareCounters
             }
 
 #endif
-            pHardwareCounters->m_counters.push_back(counter);
         }
     }
 
@@ -387,6 +390,44 @@ GPA_Status GPA_CounterGeneratorGL::GeneratePublicCounters(GDT_HW_GENERATION    d
     return status;
 }
 
+void GPA_CounterGeneratorGL::GetPublicCounterFunctions(GDT_HW_GENERATION                             desiredGeneration,
+                                                       GDT_HW_ASIC_TYPE                              asicType,
+                                                       gpa_uint8                                     generateAsicSpecificCounters,
+                                                       std::vector<GPA_DerivedCounterFunctionTable>& functionTables) const
+{
+    GPA_DerivedCounterFunctionTable asicFunctions = {nullptr, 0};
+
+    functionTables.clear();
+
+    if (desiredGeneration == GDT_HW_GENERATION_VOLCANICISLAND)
+    {
+        if (generateAsicSpecificCounters && glgfx8asics::GetPublicAsicSpecificCounterFunctions(desiredGeneration, asicType, asicFunctions))
+        {
+            functionTables.push_back(asicFunctions);
+        }
+
+        functionTables.push_back(GetPublicDerivedCounterFunctionsGLGfx8());
+    }
+    else if (desiredGeneration == GDT_HW_GENERATION_GFX9)
+    {
+        if (generateAsicSpecificCounters && glgfx9asics::GetPublicAsicSpecificCounterFunctions(desiredGeneration, asicType, asicFunctions))
+        {
+            functionTables.push_back(asicFunctions);
+        }
+
+        functionTables.push_back(GetPublicDerivedCounterFunctionsGLGfx9());
+    }
+    else if (desiredGeneration == GDT_HW_GENERATION_GFX10)
+    {
+        if (generateAsicSpecificCounters && glgfx10asics::GetPublicAsicSpecificCounterFunctions(desiredGeneration, asicType, asicFunctions))
+        {
+            functionTables.push_back(asicFunctions);
+        }
+
+        functionTables.push_back(GetPublicDerivedCounterFunctionsGLGfx10());
+    }
+}
+
 GPA_Status GPA_CounterGeneratorGL::GenerateHardwareCounters(GDT_HW_GENERATION     desiredGeneration,
                                                             GDT_HW_ASIC_TYPE      asicType,
                                                             gpa_uint8             generateAsicSpecificCounters,
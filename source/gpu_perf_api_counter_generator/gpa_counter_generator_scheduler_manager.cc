@@ -7,74 +7,92 @@
 
 #include "gpa_counter_generator_scheduler_manager.h"
 
-void CounterGeneratorSchedulerManager::RegisterCounterGenerator(GPA_API_Type              apiType,
-                                                                GDT_HW_GENERATION         generation,
-                                                                GPA_CounterGeneratorBase* pCounterGenerator,
-                                                                bool                      replaceExisting)
+void CounterGeneratorSchedulerManager::RegisterCounterGenerator(GPA_API_Type            apiType,
+                                                                GDT_HW_GENERATION       generation,
+                                                                CounterGeneratorFactory counterGeneratorFactory,
+                                                                bool                    replaceExisting)
 {
-    GenerationGeneratorMap localMap;
+    std::lock_guard<std::mutex> lock(m_registrationMutex);
 
-    if (0 < m_counterGeneratorItems.count(apiType))
-    {
-        localMap = m_counterGeneratorItems[apiType];
-    }
+    GenerationGeneratorMap& localMap = m_counterGeneratorItems[apiType];
 
     if (0 == localMap.count(generation) || replaceExisting)
     {
-        localMap[generation] = pCounterGenerator;
+        localMap[generation] = counterGeneratorFactory;
     }
-
-    m_counterGeneratorItems[apiType] = localMap;
 }
 
-bool CounterGeneratorSchedulerManager::GetCounterGenerator(GPA_API_Type apiType, GDT_HW_GENERATION generation, GPA_CounterGeneratorBase*& pCounterGeneratorOut)
+bool CounterGeneratorSchedulerManager::CreateCounterGenerator(GPA_API_Type apiType, GDT_HW_GENERATION generation, GPA_CounterGeneratorBase*& pCounterGeneratorOut)
 {
-    bool retVal = false;
+    CounterGeneratorFactory counterGeneratorFactory = nullptr;
 
-    if (0 < m_counterGeneratorItems.count(apiType))
     {
-        if (0 < m_counterGeneratorItems[apiType].count(generation))
+        std::lock_guard<std::mutex> lock(m_registrationMutex);
+
+        auto apiIter = m_counterGeneratorItems.find(apiType);
+
+        if (m_counterGeneratorItems.end() != apiIter)
         {
-            pCounterGeneratorOut = m_counterGeneratorItems[apiType][generation];
-            retVal               = true;
+            auto generationIter = apiIter->second.find(generation);
+
+            if (apiIter->second.end() != generationIter)
+            {
+                counterGeneratorFactory = generationIter->second;
+            }
         }
     }
 
-    return retVal;
+    // the factory is invoked outside of the lock, as the constructor of the new instance registers itself
+    if (nullptr == counterGeneratorFactory)
+    {
+        return false;
+    }
+
+    pCounterGeneratorOut = counterGeneratorFactory();
+    return nullptr != pCounterGeneratorOut;
 }
 
-void CounterGeneratorSchedulerManager::RegisterCounterScheduler(GPA_API_Type          apiType,
-                                                                GDT_HW_GENERATION     generation,
-                                                                IGPACounterScheduler* pCounterScheduler,
-                                                                bool                  replaceExisting)
+void CounterGeneratorSchedulerManager::RegisterCounterScheduler(GPA_API_Type            apiType,
+                                                                GDT_HW_GENERATION       generation,
+                                                                CounterSchedulerFactory counterSchedulerFactory,
+                                                                bool                    replaceExisting)
 {
-    GenerationSchedulerMap localMap;
+    std::lock_guard<std::mutex> lock(m_registrationMutex);
 
-    if (0 < m_counterSchedulerItems.count(apiType))
-    {
-        localMap = m_counterSchedulerItems[apiType];
-    }
+    GenerationSchedulerMap& localMap = m_counterSchedulerItems[apiType];
 
     if (0 == localMap.count(generation) || replaceExisting)
     {
-        localMap[generation] = pCounterScheduler;
+        localMap[generation] = counterSchedulerFactory;
     }
-
-    m_counterSchedulerItems[apiType] = localMap;
 }
 
-bool CounterGeneratorSchedulerManager::GetCounterScheduler(GPA_API_Type apiType, GDT_HW_GENERATION generation, IGPACounterScheduler*& pCounterSchedulerOut)
+bool CounterGeneratorSchedulerManager::CreateCounterScheduler(GPA_API_Type apiType, GDT_HW_GENERATION generation, IGPACounterScheduler*& pCounterSchedulerOut)
 {
-    bool retVal = false;
+    CounterSchedulerFactory counterSchedulerFactory = nullptr;
 
-    if (0 < m_counterSchedulerItems.count(apiType))
     {
-        if (0 < m_counterSchedulerItems[apiType].count(generation))
+        std::lock_guard<std::mutex> lock(m_registrationMutex);
+
+        auto apiIter = m_counterSchedulerItems.find(apiType);
+
+        if (m_counterSchedulerItems.end() != apiIter)
         {
-            pCounterSchedulerOut = m_counterSchedulerItems[apiType][generation];
-            retVal               = true;
+            auto generationIter = apiIter->second.find(generation);
+
+            if (apiIter->second.end() != generationIter)
+            {
+                counterSchedulerFactory = generationIter->second;
+            }
         }
     }
 
-    return retVal;
+    // the factory is invoked outside of the lock, as the constructor of the new instance registers itself
+    if (nullptr == counterSchedulerFactory)
+    {
+        return false;
+    }
+
+    pCounterSchedulerOut = counterSchedulerFactory();
+    return nullptr != pCounterSchedulerOut;
 }
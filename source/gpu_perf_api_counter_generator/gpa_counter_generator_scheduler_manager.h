@@ -9,6 +9,8 @@
 #define _GPA_COUNTER_GENERATOR_SCHEDULER_MANAGER_H_
 
 #include <map>
+#include <mutex>
+#include <new>
 
 #include <DeviceInfo.h>
 #include <TSingleton.h>
@@ -18,7 +20,32 @@
 class GPA_CounterGeneratorBase;  ///< forward declaration
 class IGPACounterScheduler;      ///< forward declaration
 
+/// Function which creates a new instance of a counter generator
+typedef GPA_CounterGeneratorBase* (*CounterGeneratorFactory)();
+
+/// Function which creates a new instance of a counter scheduler
+typedef IGPACounterScheduler* (*CounterSchedulerFactory)();
+
+/// Creates a new instance of the specified counter generator class
+/// \return the new counter generator, or nullptr if it could not be allocated
+template <class CounterGenerator>
+GPA_CounterGeneratorBase* CreateCounterGeneratorInstance()
+{
+    return new (std::nothrow) CounterGenerator();
+}
+
+/// Creates a new instance of the specified counter scheduler class
+/// \return the new counter scheduler, or nullptr if it could not be allocated
+template <class CounterScheduler>
+IGPACounterScheduler* CreateCounterSchedulerInstance()
+{
+    return new (std::nothrow) CounterScheduler();
+}
+
 /// Class that will get the correct Generator and Scheduler for an API/Generation combination
+///
+/// Generators and schedulers are registered as factories rather than as instances, so that every caller
+/// gets its own instance instead of sharing (and regenerating) a single process-wide one.
 class CounterGeneratorSchedulerManager : public TSingleton<CounterGeneratorSchedulerManager>
 {
     friend class TSingleton<CounterGeneratorSchedulerManager>;  ///< friend declaration to allow access to the constructor
@@ -27,30 +54,36 @@ public:
     /// Registers an API/HwGen-specific counter generator
     /// \param apiType the API the generator is being registered for
     /// \param generation the hardware generation the generator is being registered for
-    /// \param pCounterGenerator the generator to register
+    /// \param counterGeneratorFactory the function creating instances of the generator to register
     /// \param replaceExisting flag indicating whether an existing generator for the specified api/generation combination should be replaced by this one. If false, then this one is ignored if an existing registration is found
-    void RegisterCounterGenerator(GPA_API_Type apiType, GDT_HW_GENERATION generation, GPA_CounterGeneratorBase* pCounterGenerator, bool replaceExisting = true);
+    void RegisterCounterGenerator(GPA_API_Type            apiType,
+                                  GDT_HW_GENERATION       generation,
+                                  CounterGeneratorFactory counterGeneratorFactory,
+                                  bool                    replaceExisting = true);
 
-    /// Get the registered generator for the specified API/HwGen
+    /// Creates a new instance of the registered generator for the specified API/HwGen
     /// \param apiType the API whose generator is needed
     /// \param generation the hardware generation whose generator is needed
-    /// \param[out] pCounterGeneratorOut the generator registered for the specified API/HwGen
-    /// \return true if there is a generator registered for the API/HwGen, false otherwise
-    bool GetCounterGenerator(GPA_API_Type apiType, GDT_HW_GENERATION generation, GPA_CounterGeneratorBase*& pCounterGeneratorOut);
+    /// \param[out] pCounterGeneratorOut the new generator, owned by the caller
+    /// \return true if there is a generator registered for the API/HwGen and it was created, false otherwise
+    bool CreateCounterGenerator(GPA_API_Type apiType, GDT_HW_GENERATION generation, GPA_CounterGeneratorBase*& pCounterGeneratorOut);
 
     /// Registers an API/HwGen-specific counter scheduler
     /// \param apiType the API the scheduler is being registered for
     /// \param generation the hardware generation the scheduler is being registered for
-    /// \param pCounterScheduler the scheduler to register
+    /// \param counterSchedulerFactory the function creating instances of the scheduler to register
     /// \param replaceExisting flag indicating whether an existing scheduler for the specified api/generation combination should be replaced by this one. If false, then this one is ignored if an existing registration is found
-    void RegisterCounterScheduler(GPA_API_Type apiType, GDT_HW_GENERATION generation, IGPACounterScheduler* pCounterScheduler, bool replaceExisting = true);
+    void RegisterCounterScheduler(GPA_API_Type            apiType,
+                                  GDT_HW_GENERATION       generation,
+                                  CounterSchedulerFactory counterSchedulerFactory,
+                                  bool                    replaceExisting = true);
 
-    /// Get the registered scheduler for the specified API/HwGen
+    /// Creates a new instance of the registered scheduler for the specified API/HwGen
     /// \param apiType the API whose scheduler is needed
     /// \param generation the hardware generation whose scheduler is needed
-    /// \param[out] pCounterSchedulerOut the scheduler registered for the specified API/HwGen
-    /// \return true if there is a scheduler registered for the API/HwGen, false otherwise
-    bool GetCounterScheduler(GPA_API_Type apiType, GDT_HW_GENERATION generation, IGPACounterScheduler*& pCounterSchedulerOut);
+    /// \param[out] pCounterSchedulerOut the new scheduler, owned by the caller
+    /// \return true if there is a scheduler registered for the API/HwGen and it was created, false otherwise
+    bool CreateCounterScheduler(GPA_API_Type apiType, GDT_HW_GENERATION generation, IGPACounterScheduler*& pCounterSchedulerOut);
 
 protected:
     /// Constructor
@@ -60,7 +93,7 @@ protected:
     virtual ~CounterGeneratorSchedulerManager() = default;
 
     /// typedef for HWGen to Generator Map
-    typedef std::map<GDT_HW_GENERATION, GPA_CounterGeneratorBase*> GenerationGeneratorMap;
+    typedef std::map<GDT_HW_GENERATION, CounterGeneratorFactory> GenerationGeneratorMap;
 
     /// typedef for API to GenerationGeneratorMap Map
     typedef std::map<GPA_API_Type, GenerationGeneratorMap> APITypeGenerationGeneratorMap;
@@ -69,13 +102,16 @@ protected:
     APITypeGenerationGeneratorMap m_counterGeneratorItems;
 
     /// typedef for HWGen to Scheduler Map
-    typedef std::map<GDT_HW_GENERATION, IGPACounterScheduler*> GenerationSchedulerMap;
+    typedef std::map<GDT_HW_GENERATION, CounterSchedulerFactory> GenerationSchedulerMap;
 
     /// typedef for HWGen to Scheduler Map
     typedef std::map<GPA_API_Type, GenerationSchedulerMap> APITypeGenerationSchedulerMap;
 
     /// Map of registered schedulers
     APITypeGenerationSchedulerMap m_counterSchedulerItems;
+
+    /// Mutex protecting the registrations (the constructors of created instances register themselves again)
+    std::mutex m_registrationMutex;
 };
 
 #endif  // _GPA_COUNTER_GENERATOR_SCHEDULER_MANAGER_H_
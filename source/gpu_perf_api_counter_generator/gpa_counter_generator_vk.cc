@@ -60,7 +60,8 @@ GPA_CounterGeneratorVK::GPA_CounterGeneratorVK()
 
     for (int gen = GDT_HW_GENERATION_SOUTHERNISLAND; gen < GDT_HW_GENERATION_LAST; gen++)
     {
-        CounterGeneratorSchedulerManager::Instance()->RegisterCounterGenerator(GPA_API_VULKAN, static_cast<GDT_HW_GENERATION>(gen), this);
+        CounterGeneratorSchedulerManager::Instance()->RegisterCounterGenerator(
+            GPA_API_VULKAN, static_cast<GDT_HW_GENERATION>(gen), CreateCounterGeneratorInstance<GPA_CounterGeneratorVK>);
     }
 }
 
@@ -148,6 +149,44 @@ GPA_Status GPA_CounterGeneratorVK::GeneratePublicCounters(GDT_HW_GENERATION    d
     return status;
 }
 
+void GPA_CounterGeneratorVK::GetPublicCounterFunctions(GDT_HW_GENERATION                             desiredGeneration,
+                                                       GDT_HW_ASIC_TYPE                              asicType,
+                                                       gpa_uint8                                     generateAsicSpecificCounters,
+                                                       std::vector<GPA_DerivedCounterFunctionTable>& functionTables) const
+{
+    GPA_DerivedCounterFunctionTable asicFunctions = {nullptr, 0};
+
+    functionTables.clear();
+
+    if (desiredGeneration == GDT_HW_GENERATION_VOLCANICISLAND)
+    {
+        if (generateAsicSpecificCounters && vkgfx8asics::GetPublicAsicSpecificCounterFunctions(desiredGeneration, asicType, asicFunctions))
+        {
+            functionTables.push_back(asicFunctions);
+        }
+
+        functionTables.push_back(GetPublicDerivedCounterFunctionsVKGfx8());
+    }
+    else if (desiredGeneration == GDT_HW_GENERATION_GFX9)
+    {
+        if (generateAsicSpecificCounters && vkgfx9asics::GetPublicAsicSpecificCounterFunctions(desiredGeneration, asicType, asicFunctions))
+        {
+            functionTables.push_back(asicFunctions);
+        }
+
+        functionTables.push_back(GetPublicDerivedCounterFunctionsVKGfx9());
+    }
+    else if (desiredGeneration == GDT_HW_GENERATION_GFX10)
+    {
+        if (generateAsicSpecificCounters && vkgfx10asics::GetPublicAsicSpecificCounterFunctions(desiredGeneration, asicType, asicFunctions))
+        {
+            functionTables.push_back(asicFunctions);
+        }
+
+        functionTables.push_back(GetPublicDerivedCounterFunctionsVKGfx10());
+    }
+}
+
 bool GPA_CounterGeneratorVK::GenerateInternalCounters(GPA_HardwareCounters* pHardwareCounters, GDT_HW_GENERATION generation)
 {
     pHardwareCounters->m_counters.clear();
@@ -180,14 +219,17 @@ bool GPA_CounterGeneratorVK::GenerateInternalCounters(GPA_HardwareCounters* pHar
             counter.m_pHardwareCounter = &(pGroupCounters[c]);
             counter.m_groupIdDriver    = blockId;
 
+            pHardwareCounters->m_counters.push_back(counter);
+
 #if defined(_DEBUG) && defined(_WIN32) && defined(AMDT_INTERNAL)
 
             if (nullptr != pFile)
             {
+                // block instance counters only have a name once they have been added
+                const char* pCounterName = pHardwareCounters->GetCounterName(static_cast<gpa_uint32>(pHardwareCounters->m_counters.size() - 1));
+                size_t      size         = strlen(pCounterName);
                 fwrite("    \"", 1, 5, pFile);
-                std::string tmpName(counter.m_pHardwareCounter->m_pName);
-                size_t      size = tmpName.size();
-                fwrite(counter.m_pHardwareCounter->m_pName, 1, size, pFile);
+                fwrite(pCounterName, 1, size, pFile);
                 fwrite("\",", 1, 2, pFile);
 #ifdef EXTRA_COUNTER_INFO
                 // this can be useful for debugging counter definitions
@@ -202,7 +244,6 @@ bool GPA_CounterGeneratorVK::GenerateInternalCounters(GPA_HardwareCounters* pHar
             }
 
 #endif
-            pHardwareCounters->m_counters.push_back(counter);
             ++globalCounterIndex;
         }
     }
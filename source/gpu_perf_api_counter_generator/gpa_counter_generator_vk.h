@@ -34,6 +34,12 @@ public:
     /// \return reference to object
     GPA_CounterGeneratorVK& operator=(GPA_CounterGeneratorVK&&) = delete;
 
+    /// \copydoc GPA_CounterGeneratorBase::GetPublicCounterFunctions
+    void GetPublicCounterFunctions(GDT_HW_GENERATION                             desiredGeneration,
+                                   GDT_HW_ASIC_TYPE                              asicType,
+                                   gpa_uint8                                     generateAsicSpecificCounters,
+                                   std::vector<GPA_DerivedCounterFunctionTable>& functionTables) const override;
+
 protected:
     /// \copydoc GPA_CounterGeneratorBase::GeneratePublicCounters
     virtual GPA_Status GeneratePublicCounters(GDT_HW_GENERATION    desiredGeneration,
@@ -13,7 +13,7 @@ GPA_CounterGeneratorVKNonAMD::GPA_CounterGeneratorVKNonAMD()
     GPA_CounterGeneratorBase::SetAllowedCounters(false, false, true);  //enable sw counters
 
     CounterGeneratorSchedulerManager::Instance()->RegisterCounterGenerator(
-        GPA_API_VULKAN, GDT_HW_GENERATION_INTEL, this, false);  // allow future registrations to override this default one
+        GPA_API_VULKAN, GDT_HW_GENERATION_INTEL, CreateCounterGeneratorInstance<GPA_CounterGeneratorVKNonAMD>, false);  // allow future registrations to override this default one
     CounterGeneratorSchedulerManager::Instance()->RegisterCounterGenerator(
-        GPA_API_VULKAN, GDT_HW_GENERATION_NVIDIA, this, false);  // allow future registrations to override this default one
+        GPA_API_VULKAN, GDT_HW_GENERATION_NVIDIA, CreateCounterGeneratorInstance<GPA_CounterGeneratorVKNonAMD>, false);  // allow future registrations to override this default one
 }
@@ -23,6 +23,7 @@ GPA_CounterSchedulerBase::GPA_CounterSchedulerBase()
     , m_revisionId(0)
     , m_counterSelectionChanged(false)
     , m_passIndex(0)
+    , m_trackedMemory(GPA_MEMORY_CATEGORY_COUNTER_SCHEDULER, sizeof(GPA_CounterSchedulerBase))
 {
 }
 
@@ -50,6 +51,7 @@ GPA_Status GPA_CounterSchedulerBase::SetCounterAccessor(IGPACounterAccessor* pCo
     // make sure there are enough bits to track the enabled counters
     m_enabledPublicCounterBits.resize(pCounterAccessor->GetNumCounters());
     fill(m_enabledPublicCounterBits.begin(), m_enabledPublicCounterBits.end(), false);
+    UpdateTrackedMemory();
 
     return GPA_STATUS_OK;
 }
@@ -118,6 +120,7 @@ void GPA_CounterSchedulerBase::DisableAllCounters()
     m_enabledPublicIndices.clear();
     fill(m_enabledPublicCounterBits.begin(), m_enabledPublicCounterBits.end(), false);
     m_counterSelectionChanged = true;
+    UpdateTrackedMemory();
 }
 
 GPA_Status GPA_CounterSchedulerBase::GetEnabledIndex(gpa_uint32 enabledIndex, gpa_uint32* pCounterAtIndex) const
@@ -342,6 +345,7 @@ GPA_Status GPA_CounterSchedulerBase::GetNumRequiredPasses(gpa_uint32* pNumRequir
 
     m_counterSelectionChanged = false;
     *pNumRequiredPassesOut    = static_cast<gpa_uint32>(m_passPartitions.size());
+    UpdateTrackedMemory();
 
     return GPA_STATUS_OK;
 }
@@ -469,3 +473,21 @@ void GPA_CounterSchedulerBase::DoSetDrawCallCounts(int iCount)
     UNREFERENCED_PARAMETER(iCount);
     // do nothing in base
 }
+
+void GPA_CounterSchedulerBase::UpdateTrackedMemory()
+{
+    size_t numBytes = sizeof(GPA_CounterSchedulerBase) + GPAContainerBytes(m_enabledPublicIndices) + m_enabledPublicCounterBits.capacity() / 8 +
+                      GPANodeContainerBytes(m_passPartitions) + GPANodeContainerBytes(m_counterResultLocationMap);
+
+    for (auto passIter = m_passPartitions.cbegin(); passIter != m_passPartitions.cend(); ++passIter)
+    {
+        numBytes += GPAContainerBytes(passIter->m_counters);
+    }
+
+    for (auto locationIter = m_counterResultLocationMap.cbegin(); locationIter != m_counterResultLocationMap.cend(); ++locationIter)
+    {
+        numBytes += GPANodeContainerBytes(locationIter->second);
+    }
+
+    m_trackedMemory.SetBytes(numBytes);
+}
@@ -10,6 +10,7 @@
 
 #include "gpa_counter_scheduler_interface.h"
 #include "gpa_split_counter_factory.h"
+#include "gpa_memory_tracker.h"
 
 /// Base Class for counter scheduling
 class GPA_CounterSchedulerBase : public IGPACounterScheduler
@@ -104,6 +105,9 @@ protected:
     /// \param iCount draw call count per frame
     virtual void DoSetDrawCallCounts(int iCount);
 
+    /// Updates the accounting of the memory held by the enabled counters and the pass partitions
+    void UpdateTrackedMemory();
+
     /// A map between a public counter index and the set of hardware counters that compose the public counter.
     /// For each hardware counter, there is a map from the hardware counter to the counter result location (pass and offset) for that specific counter.
     /// Multiple public counters may be enabled which require the same hardware counter, but the hardware counter may be profiled in multiple passes so
@@ -140,6 +144,9 @@ protected:
 
     /// As the profile is happening, this tracks the current pass.
     unsigned int m_passIndex;
+
+    /// Accounting of the memory held by the scheduler.
+    GPATrackedMemory m_trackedMemory;
 };
 
 #endif  //_GPA_COUNTER_GENERATOR_BASE_H_
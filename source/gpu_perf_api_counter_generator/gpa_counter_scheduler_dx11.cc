@@ -12,11 +12,13 @@
 
 GPA_CounterSchedulerDX11::GPA_CounterSchedulerDX11()
 {
-    CounterGeneratorSchedulerManager::Instance()->RegisterCounterScheduler(GPA_API_DIRECTX_11, GDT_HW_GENERATION_NVIDIA, this, false);
+    CounterGeneratorSchedulerManager::Instance()->RegisterCounterScheduler(
+        GPA_API_DIRECTX_11, GDT_HW_GENERATION_NVIDIA, CreateCounterSchedulerInstance<GPA_CounterSchedulerDX11>, false);
 
     for (int gen = GDT_HW_GENERATION_INTEL; gen < GDT_HW_GENERATION_LAST; gen++)
     {
-        CounterGeneratorSchedulerManager::Instance()->RegisterCounterScheduler(GPA_API_DIRECTX_11, static_cast<GDT_HW_GENERATION>(gen), this);
+        CounterGeneratorSchedulerManager::Instance()->RegisterCounterScheduler(
+            GPA_API_DIRECTX_11, static_cast<GDT_HW_GENERATION>(gen), CreateCounterSchedulerInstance<GPA_CounterSchedulerDX11>);
     }
 }
 
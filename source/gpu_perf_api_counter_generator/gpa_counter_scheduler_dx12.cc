@@ -12,7 +12,8 @@ GPA_CounterSchedulerDX12::GPA_CounterSchedulerDX12()
 {
     for (int gen = GDT_HW_GENERATION_NVIDIA; gen < GDT_HW_GENERATION_LAST; gen++)
     {
-        CounterGeneratorSchedulerManager::Instance()->RegisterCounterScheduler(GPA_API_DIRECTX_12, static_cast<GDT_HW_GENERATION>(gen), this);
+        CounterGeneratorSchedulerManager::Instance()->RegisterCounterScheduler(
+            GPA_API_DIRECTX_12, static_cast<GDT_HW_GENERATION>(gen), CreateCounterSchedulerInstance<GPA_CounterSchedulerDX12>);
     }
 }
 
@@ -13,7 +13,8 @@ GPA_CounterSchedulerGL::GPA_CounterSchedulerGL()
     // TODO: need to make some changes to support GPUTime counter on non-AMD in public build
     for (int gen = GDT_HW_GENERATION_FIRST_AMD; gen < GDT_HW_GENERATION_LAST; gen++)
     {
-        CounterGeneratorSchedulerManager::Instance()->RegisterCounterScheduler(GPA_API_OPENGL, static_cast<GDT_HW_GENERATION>(gen), this);
+        CounterGeneratorSchedulerManager::Instance()->RegisterCounterScheduler(
+            GPA_API_OPENGL, static_cast<GDT_HW_GENERATION>(gen), CreateCounterSchedulerInstance<GPA_CounterSchedulerGL>);
     }
 }
 
@@ -15,6 +15,7 @@
 #include "gpa_derived_counter.h"
 #include "gpa_common_defs.h"
 #include "gpa_hardware_counters.h"
+#include "gpa_memory_tracker.h"
 
 #ifdef __cplusplus
 #include <cstdint>
@@ -30,20 +31,22 @@ GPA_DerivedCounter::GPA_DerivedCounter()
     , m_dataType(GPA_DATA_TYPE__LAST)
     , m_usageType(GPA_USAGE_TYPE__LAST)
     , m_pComputeExpression(nullptr)
+    , m_pComputeFunction(nullptr)
     , derived_counter_hardware_info_(nullptr)
     , derived_counter_info_init_(false)
 {
 }
 
-GPA_DerivedCounter::GPA_DerivedCounter(unsigned int        index,
-                                       const char*         pName,
-                                       const char*         pGroup,
-                                       const char*         pDescription,
-                                       GPA_Data_Type       dataType,
-                                       GPA_Usage_Type      usageType,
-                                       vector<gpa_uint32>& internalCountersRequired,
-                                       const char*         pComputeExpression,
-                                       const char*         pUuid)
+GPA_DerivedCounter::GPA_DerivedCounter(unsigned int               index,
+                                       const char*                pName,
+                                       const char*                pGroup,
+                                       const char*                pDescription,
+                                       GPA_Data_Type              dataType,
+                                       GPA_Usage_Type             usageType,
+                                       vector<gpa_uint32>&        internalCountersRequired,
+                                       const char*                pComputeExpression,
+                                       const char*                pUuid,
+                                       GPA_DerivedCounterFunction pComputeFunction)
     : m_index(index)
     , m_pName(pName)
     , m_pGroup(pGroup)
@@ -52,6 +55,7 @@ GPA_DerivedCounter::GPA_DerivedCounter(unsigned int        index,
     , m_usageType(usageType)
     , m_internalCountersRequired(internalCountersRequired)
     , m_pComputeExpression(pComputeExpression)
+    , m_pComputeFunction(pComputeFunction)
     , derived_counter_hardware_info_(nullptr)
     , derived_counter_info_init_(false)
 {
@@ -80,10 +84,12 @@ GPA_DerivedCounter::GPA_DerivedCounter(unsigned int        index,
     /*
     Autogenerated hash is MD5 hash which are fixed length of 128-bits (16 bytes).
     */
-    uint32_t data1;
+    uint32_t data1 = 0;
     static_assert(sizeof(short) == sizeof(uint16_t), "short is more than 2 bytes for UUID");
+    static_assert(sizeof(unsigned int) == sizeof(uint32_t), "int is not 4 bytes for UUID");
+    memset(bytes, 0, sizeof(bytes));
     sscanf(pUuid,
-           "%08uiX-%04hX-%04hX-%02X%02X-%02X%02X%02X%02X%02X%02X",
+           "%08X-%04hX-%04hX-%02X%02X-%02X%02X%02X%02X%02X%02X",
            &data1,
            &m_uuid.m_data2,
            &m_uuid.m_data3,
@@ -118,6 +124,18 @@ GPA_DerivedCounter::~GPA_DerivedCounter()
     delete derived_counter_hardware_info_;
 }
 
+size_t GPA_DerivedCounter::GetMemoryUsage() const
+{
+    size_t numBytes = GPAContainerBytes(m_internalCountersRequired) + GPAContainerBytes(hw_counter_info_list_);
+
+    if (nullptr != derived_counter_hardware_info_)
+    {
+        numBytes += sizeof(GpaDerivedCounterInfo);
+    }
+
+    return numBytes;
+}
+
 bool GPA_DerivedCounter::InitializeDerivedCounterHardwareInfo(const IGPACounterAccessor* gpa_counter_accessor)
 {
     bool counter_init = false;
@@ -212,14 +230,15 @@ GpaDerivedCounterInfo* GPA_DerivedCounter::GetDerivedCounterHardwareInfo(const I
 
 //------------------------------------------------------------------------------------------------------------------------------------------------------------
 
-void GPA_DerivedCounters::DefineDerivedCounter(const char*         pName,
-                                               const char*         pGroup,
-                                               const char*         pDescription,
-                                               GPA_Data_Type       dataType,
-                                               GPA_Usage_Type      usageType,
-                                               vector<gpa_uint32>& internalCountersRequired,
-                                               const char*         pComputeExpression,
-                                               const char*         pUuid)
+void GPA_DerivedCounters::DefineDerivedCounter(const char*                pName,
+                                               const char*                pGroup,
+                                               const char*                pDescription,
+                                               GPA_Data_Type              dataType,
+                                               GPA_Usage_Type             usageType,
+                                               vector<gpa_uint32>&        internalCountersRequired,
+                                               const char*                pComputeExpression,
+                                               const char*                pUuid,
+                                               GPA_DerivedCounterFunction pComputeFunction)
 {
     assert(pName);
     assert(pGroup);
@@ -239,10 +258,14 @@ void GPA_DerivedCounters::DefineDerivedCounter(const char*         pName,
     }
 #endif
 
-    m_counters.push_back(GPA_DerivedCounter(index, pName, pGroup, pDescription, dataType, usageType, internalCountersRequired, pComputeExpression, pUuid));
+    m_counters.push_back(
+        GPA_DerivedCounter(index, pName, pGroup, pDescription, dataType, usageType, internalCountersRequired, pComputeExpression, pUuid, pComputeFunction));
 }
 
-void GPA_DerivedCounters::UpdateAsicSpecificDerivedCounter(const char* pName, vector<gpa_uint32>& internalCountersRequired, const char* pComputeExpression)
+void GPA_DerivedCounters::UpdateAsicSpecificDerivedCounter(const char*                pName,
+                                                           vector<gpa_uint32>&        internalCountersRequired,
+                                                           const char*                pComputeExpression,
+                                                           GPA_DerivedCounterFunction pComputeFunction)
 {
     for (auto& counter : m_counters)
     {
@@ -251,6 +274,9 @@ void GPA_DerivedCounters::UpdateAsicSpecificDerivedCounter(const char* pName, ve
             counter.m_internalCountersRequired.clear();
             counter.m_internalCountersRequired = internalCountersRequired;
             counter.m_pComputeExpression       = pComputeExpression;
+
+            // the native function of the generic counter computes its generic expression, so it is replaced too
+            counter.m_pComputeFunction = pComputeFunction;
             return;
         }
     }
@@ -270,6 +296,18 @@ void GPA_DerivedCounters::Clear()
     m_countersGenerated = false;
 }
 
+size_t GPA_DerivedCounters::GetMemoryUsage() const
+{
+    size_t numBytes = GPAContainerBytes(m_counters);
+
+    for (auto counterIter = m_counters.cbegin(); counterIter != m_counters.cend(); ++counterIter)
+    {
+        numBytes += counterIter->GetMemoryUsage();
+    }
+
+    return numBytes;
+}
+
 gpa_uint32 GPA_DerivedCounters::GetNumCounters() const
 {
     return static_cast<gpa_uint32>(m_counters.size());
@@ -1255,6 +1293,26 @@ GPA_Status GPA_DerivedCounters::ComputeCounterValue(gpa_uint32
                                                     vector<GPA_Data_Type>&           internalCounterTypes,
                                                     void*                            pResult,
                                                     const GPA_HWInfo*                pHwInfo) const
+{
+    const GPA_DerivedCounter& counter = m_counters[counterIndex];
+
+    // The native function reads every internal counter result of the expression without checking them, so the interpreter
+    // reports the errors of the calls which don't provide them
+    if (nullptr != counter.m_pComputeFunction && nullptr != pHwInfo && results.size() >= counter.m_internalCountersRequired.size() &&
+        !internalCounterTypes.empty() && GPA_DATA_TYPE_UINT64 == internalCounterTypes[0])
+    {
+        counter.m_pComputeFunction(results, pResult, pHwInfo);
+        return GPA_STATUS_OK;
+    }
+
+    return EvaluateCounterExpression(counterIndex, results, internalCounterTypes, pResult, pHwInfo);
+}
+
+GPA_Status GPA_DerivedCounters::EvaluateCounterExpression(gpa_uint32                       counterIndex,
+                                                          const vector<const gpa_uint64*>& results,
+                                                          vector<GPA_Data_Type>&           internalCounterTypes,
+                                                          void*                            pResult,
+                                                          const GPA_HWInfo*                pHwInfo) const
 {
     if (nullptr == m_counters[counterIndex].m_pComputeExpression)
     {
@@ -16,6 +16,27 @@
 class IGPACounterAccessor;
 using std::vector;
 
+/// Native function computing a derived counter, generated from its compute expression by the counter compiler
+/// \param results the results of the internal counters required by the derived counter
+/// \param[out] pResult the result of the computation, of the data type of the derived counter
+/// \param pHwInfo the hardware info for the current hardware
+typedef void (*GPA_DerivedCounterFunction)(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo);
+
+/// Native function generated for a derived counter of a counter definition file
+struct GPA_DerivedCounterFunctionEntry
+{
+    const char*                m_pName;               ///< the name of the derived counter
+    const char*                m_pComputeExpression;  ///< the formula the function was generated from
+    GPA_DerivedCounterFunction m_pComputeFunction;    ///< the native function computing the derived counter
+};
+
+/// Native functions generated for the derived counters of a counter definition file, in the order the counters are defined
+struct GPA_DerivedCounterFunctionTable
+{
+    const GPA_DerivedCounterFunctionEntry* m_pEntries;    ///< the entries, or nullptr if there are none
+    size_t                                 m_numEntries;  ///< the number of entries
+};
+
 /// Information about a derived counter that is exposed through the interface
 class GPA_DerivedCounter
 {
@@ -30,15 +51,17 @@ public:
     /// \param internalCountersRequired the list of hardware counters required by the derived counter
     /// \param pComputeExpression the formula used to compute the derived counter
     /// \param pUuid UUID string that uniquely and consistently identifies the derived counter
-    GPA_DerivedCounter(unsigned int        index,
-                       const char*         pName,
-                       const char*         pGroup,
-                       const char*         pDescription,
-                       GPA_Data_Type       dataType,
-                       GPA_Usage_Type      usageType,
-                       vector<gpa_uint32>& internalCountersRequired,
-                       const char*         pComputeExpression,
-                       const char*         pUuid);
+    /// \param pComputeFunction the native function computing the derived counter, or nullptr to interpret the formula
+    GPA_DerivedCounter(unsigned int               index,
+                       const char*                pName,
+                       const char*                pGroup,
+                       const char*                pDescription,
+                       GPA_Data_Type              dataType,
+                       GPA_Usage_Type             usageType,
+                       vector<gpa_uint32>&        internalCountersRequired,
+                       const char*                pComputeExpression,
+                       const char*                pUuid,
+                       GPA_DerivedCounterFunction pComputeFunction = nullptr);
 
     /// Default Constructor.
     /// temporary addition of a default constructor to allow vector to build and execute.
@@ -52,15 +75,20 @@ public:
     /// \return pointer to derived counter info
     GpaDerivedCounterInfo* GetDerivedCounterHardwareInfo(const IGPACounterAccessor* gpa_counter_accessor);
 
-    unsigned int       m_index;                     ///< index of this counter
-    const char*        m_pName;                     ///< The name of the counter
-    const char*        m_pGroup;                    ///< A group to which the counter is related
-    const char*        m_pDescription;              ///< A description of what the counter means.
-    GPA_Data_Type      m_dataType;                  ///< Data type
-    GPA_Usage_Type     m_usageType;                 ///< How the counter should be interpreted (percentage, ratio, bytes, etc)
-    vector<gpa_uint32> m_internalCountersRequired;  ///< List of internal counters that are needed to calculate this derived counter
-    const char*        m_pComputeExpression;        ///< A string expression that shows how to calculate this counter.
-    GPA_UUID           m_uuid = {};                 ///< UUID that uniquely and consistently identifies a counter.
+    /// Estimates the number of bytes allocated by the counter, excluding its static strings
+    /// \return the number of bytes allocated by the counter
+    size_t GetMemoryUsage() const;
+
+    unsigned int               m_index;                     ///< index of this counter
+    const char*                m_pName;                     ///< The name of the counter
+    const char*                m_pGroup;                    ///< A group to which the counter is related
+    const char*                m_pDescription;              ///< A description of what the counter means.
+    GPA_Data_Type              m_dataType;                  ///< Data type
+    GPA_Usage_Type             m_usageType;                 ///< How the counter should be interpreted (percentage, ratio, bytes, etc)
+    vector<gpa_uint32>         m_internalCountersRequired;  ///< List of internal counters that are needed to calculate this derived counter
+    const char*                m_pComputeExpression;        ///< A string expression that shows how to calculate this counter.
+    GPA_DerivedCounterFunction m_pComputeFunction;          ///< Native function computing this counter, generated from m_pComputeExpression, or nullptr
+    GPA_UUID                   m_uuid = {};                 ///< UUID that uniquely and consistently identifies a counter.
 
 private:
     /// Initializes the derived counter info
@@ -90,6 +118,10 @@ public:
     /// \return the number of derived counters
     virtual gpa_uint32 GetNumCounters() const;
 
+    /// Estimates the number of bytes allocated for the derived counters
+    /// \return the number of bytes allocated for the derived counters
+    size_t GetMemoryUsage() const;
+
     /// Gets a counter's name
     /// \param index the index of the requested counter
     /// \return the counter's name
@@ -169,20 +201,26 @@ public:
     /// \param internalCountersRequired the list of required internal counters
     /// \param pComputeExpression the compute expression of the counter
     /// \param pUuid UUID string that uniquely and consistently identifies the counter
-    virtual void DefineDerivedCounter(const char*         pName,
-                                      const char*         pGroup,
-                                      const char*         pDescription,
-                                      GPA_Data_Type       dataType,
-                                      GPA_Usage_Type      usageType,
-                                      vector<gpa_uint32>& internalCountersRequired,
-                                      const char*         pComputeExpression,
-                                      const char*         pUuid);
+    /// \param pComputeFunction the native function computing the counter, or nullptr to interpret the compute expression
+    virtual void DefineDerivedCounter(const char*                pName,
+                                      const char*                pGroup,
+                                      const char*                pDescription,
+                                      GPA_Data_Type              dataType,
+                                      GPA_Usage_Type             usageType,
+                                      vector<gpa_uint32>&        internalCountersRequired,
+                                      const char*                pComputeExpression,
+                                      const char*                pUuid,
+                                      GPA_DerivedCounterFunction pComputeFunction = nullptr);
 
     /// Updates an existing derived counter based on ASIC-specific registers.
     /// \param pName the name of the counter
     /// \param internalCountersRequired the list of required internal counters
     /// \param pComputeExpression the compute expression of the counter
-    virtual void UpdateAsicSpecificDerivedCounter(const char* pName, vector<gpa_uint32>& internalCountersRequired, const char* pComputeExpression);
+    /// \param pComputeFunction the native function computing the counter, or nullptr to interpret the compute expression
+    virtual void UpdateAsicSpecificDerivedCounter(const char*                pName,
+                                                  vector<gpa_uint32>&        internalCountersRequired,
+                                                  const char*                pComputeExpression,
+                                                  GPA_DerivedCounterFunction pComputeFunction = nullptr);
 
     /// Adds a derived counter to the set of available counters
     /// \param derivedCounter the derived counter to add
@@ -212,7 +250,7 @@ public:
         return m_counters[index].m_internalCountersRequired;
     }
 
-    /// Computes a counter's result
+    /// Computes a counter's result, using its native function if it has one
     /// \param counterIndex the index of the counter
     /// \param results the counter results buffer
     /// \param internalCounterTypes the list of internal counter types
@@ -225,6 +263,20 @@ public:
                                            void*                            pResult,
                                            const GPA_HWInfo*                pHwInfo) const;
 
+    /// Computes a counter's result by interpreting its compute expression, even if it has a native function.
+    /// The interpreter is the reference against which the native functions are verified.
+    /// \param counterIndex the index of the counter
+    /// \param results the counter results buffer
+    /// \param internalCounterTypes the list of internal counter types
+    /// \param pResult the result of the computation
+    /// \param pHwInfo the hardware info for the current hardware
+    /// \return GPA_STATUS_OK on success, otherwise an error code
+    GPA_Status EvaluateCounterExpression(gpa_uint32                       counterIndex,
+                                         const vector<const gpa_uint64*>& results,
+                                         vector<GPA_Data_Type>&           internalCounterTypes,
+                                         void*                            pResult,
+                                         const GPA_HWInfo*                pHwInfo) const;
+
     bool m_countersGenerated;  ///< indicates that the derived counters have been generated
 
 protected:
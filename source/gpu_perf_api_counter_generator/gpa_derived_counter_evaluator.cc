@@ -0,0 +1,653 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Evaluates a set of derived counters as one graph with shared sub-expressions
+//==============================================================================
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <sstream>
+#include <cctype>
+#include <cstdlib>
+
+#include "logging.h"
+#include "gpa_common_defs.h"
+#include "gpa_hw_info.h"
+#include "gpa_derived_counter_evaluator.h"
+#include "gpa_memory_tracker.h"
+
+static_assert(sizeof(gpa_float64) == sizeof(gpa_uint64), "node values are stored as 64-bit values");
+
+/// Converts a value to the 64-bit representation stored in the graph
+/// T is the node type
+/// \param value the value to convert
+/// \return the value bits
+template <class T>
+static gpa_uint64 ToBits(T value)
+{
+    gpa_uint64 bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+/// Converts the 64-bit representation stored in the graph to a value
+/// T is the node type
+/// \param bits the value bits
+/// \return the value
+template <class T>
+static T FromBits(gpa_uint64 bits)
+{
+    T value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/// Splits a formula token into its alphabetic name and its numeric width suffix (e.g. "sum16" -> "sum", 16)
+/// \param token the formula token
+/// \param[out] name the name part of the token
+/// \param[out] width the numeric suffix of the token, or 0 if there is none
+static void SplitToken(const std::string& token, std::string& name, int32_t& width)
+{
+    size_t suffixStart = token.size();
+
+    while (suffixStart > 0 && isdigit(static_cast<unsigned char>(token[suffixStart - 1])))
+    {
+        --suffixStart;
+    }
+
+    name  = token.substr(0, suffixStart);
+    width = suffixStart < token.size() ? atoi(token.c_str() + suffixStart) : 0;
+}
+
+bool GPA_DerivedCounterEvaluator::Node::operator<(const Node& other) const
+{
+    if (m_op != other.m_op)
+    {
+        return m_op < other.m_op;
+    }
+
+    if (m_type != other.m_type)
+    {
+        return m_type < other.m_type;
+    }
+
+    if (m_payload != other.m_payload)
+    {
+        return m_payload < other.m_payload;
+    }
+
+    return m_operands < other.m_operands;
+}
+
+GPA_DerivedCounterEvaluator::GPA_DerivedCounterEvaluator()
+    : m_numUnsharedNodes(0)
+{
+}
+
+GPA_Status GPA_DerivedCounterEvaluator::AddCounter(const char*                    pExpression,
+                                                   const std::vector<gpa_uint32>& internalCountersRequired,
+                                                   GPA_Data_Type                  dataType,
+                                                   const GPA_HWInfo*              pHwInfo,
+                                                   gpa_uint32&                    outputIndex)
+{
+    if (nullptr == pExpression)
+    {
+        GPA_LogError("Unable to add counter to evaluator: no equation specified.");
+        return GPA_STATUS_ERROR_INVALID_COUNTER_EQUATION;
+    }
+
+    if (nullptr == pHwInfo)
+    {
+        assert(nullptr != pHwInfo);
+        return GPA_STATUS_ERROR_INVALID_PARAMETER;
+    }
+
+    GPA_Status status   = GPA_STATUS_OK;
+    gpa_uint32 rootNode = 0;
+
+    // remember the size of the graph, so that a counter which fails to parse does not leave nodes behind
+    size_t     numNodes         = m_nodes.size();
+    size_t     numInputs        = m_inputs.size();
+    gpa_uint32 numUnsharedNodes = m_numUnsharedNodes;
+
+    if (GPA_DATA_TYPE_FLOAT64 == dataType)
+    {
+        status = ParseExpression<gpa_float64>(pExpression, internalCountersRequired, dataType, pHwInfo, rootNode);
+    }
+    else if (GPA_DATA_TYPE_UINT64 == dataType)
+    {
+        status = ParseExpression<gpa_uint64>(pExpression, internalCountersRequired, dataType, pHwInfo, rootNode);
+    }
+    else
+    {
+        GPA_LogError("Unable to add counter to evaluator: unrecognized derived counter type.");
+        status = GPA_STATUS_ERROR_INVALID_DATATYPE;
+    }
+
+    if (GPA_STATUS_OK == status)
+    {
+        outputIndex = static_cast<gpa_uint32>(m_outputs.size());
+        m_outputs.push_back(rootNode);
+    }
+    else
+    {
+        Truncate(numNodes, numInputs, numUnsharedNodes);
+    }
+
+    return status;
+}
+
+void GPA_DerivedCounterEvaluator::Clear()
+{
+    m_nodes.clear();
+    m_nodeIndexMap.clear();
+    m_inputs.clear();
+    m_inputIndexMap.clear();
+    m_outputs.clear();
+    m_numUnsharedNodes = 0;
+}
+
+const std::vector<gpa_uint32>& GPA_DerivedCounterEvaluator::GetInputs() const
+{
+    return m_inputs;
+}
+
+gpa_uint32 GPA_DerivedCounterEvaluator::GetNumOutputs() const
+{
+    return static_cast<gpa_uint32>(m_outputs.size());
+}
+
+gpa_uint32 GPA_DerivedCounterEvaluator::GetNumNodes() const
+{
+    return static_cast<gpa_uint32>(m_nodes.size());
+}
+
+gpa_uint32 GPA_DerivedCounterEvaluator::GetNumUnsharedNodes() const
+{
+    return m_numUnsharedNodes;
+}
+
+size_t GPA_DerivedCounterEvaluator::GetMemoryUsage() const
+{
+    size_t numOperandBytes = 0;
+
+    for (auto nodeIter = m_nodes.cbegin(); nodeIter != m_nodes.cend(); ++nodeIter)
+    {
+        numOperandBytes += GPAContainerBytes(nodeIter->m_operands);
+    }
+
+    // the keys of the node index map are copies of the nodes, operands included
+    return GPAContainerBytes(m_nodes) + GPANodeContainerBytes(m_nodeIndexMap) + 2 * numOperandBytes + GPAContainerBytes(m_inputs) +
+           GPANodeContainerBytes(m_inputIndexMap) + GPAContainerBytes(m_outputs);
+}
+
+void GPA_DerivedCounterEvaluator::Evaluate(const gpa_uint64* pInputValues, std::vector<gpa_uint64>& nodeValues, gpa_uint64* pOutputValues) const
+{
+    nodeValues.resize(m_nodes.size());
+
+    // nodes are stored after their operands, so a single forward sweep evaluates each of them once
+    for (size_t nodeIndex = 0; nodeIndex < m_nodes.size(); ++nodeIndex)
+    {
+        const Node& node = m_nodes[nodeIndex];
+
+        if (GPA_DATA_TYPE_FLOAT64 == node.m_type)
+        {
+            nodeValues[nodeIndex] = EvaluateNode<gpa_float64>(node, pInputValues, nodeValues);
+        }
+        else
+        {
+            nodeValues[nodeIndex] = EvaluateNode<gpa_uint64>(node, pInputValues, nodeValues);
+        }
+    }
+
+    for (size_t outputIndex = 0; outputIndex < m_outputs.size(); ++outputIndex)
+    {
+        pOutputValues[outputIndex] = nodeValues[m_outputs[outputIndex]];
+    }
+}
+
+gpa_uint32 GPA_DerivedCounterEvaluator::AddNode(const Node& node)
+{
+    ++m_numUnsharedNodes;
+
+    auto nodeIter = m_nodeIndexMap.find(node);
+
+    if (nodeIter != m_nodeIndexMap.end())
+    {
+        return nodeIter->second;
+    }
+
+    gpa_uint32 nodeIndex = static_cast<gpa_uint32>(m_nodes.size());
+    m_nodes.push_back(node);
+    m_nodeIndexMap.insert(std::make_pair(node, nodeIndex));
+    return nodeIndex;
+}
+
+void GPA_DerivedCounterEvaluator::Truncate(size_t numNodes, size_t numInputs, gpa_uint32 numUnsharedNodes)
+{
+    for (size_t nodeIndex = numNodes; nodeIndex < m_nodes.size(); ++nodeIndex)
+    {
+        m_nodeIndexMap.erase(m_nodes[nodeIndex]);
+    }
+
+    for (size_t inputIndex = numInputs; inputIndex < m_inputs.size(); ++inputIndex)
+    {
+        m_inputIndexMap.erase(m_inputs[inputIndex]);
+    }
+
+    m_nodes.resize(numNodes);
+    m_inputs.resize(numInputs);
+    m_numUnsharedNodes = numUnsharedNodes;
+}
+
+gpa_uint32 GPA_DerivedCounterEvaluator::AddConstant(GPA_Data_Type type, gpa_uint64 valueBits)
+{
+    Node node;
+    node.m_op      = NodeOp::CONSTANT;
+    node.m_type    = type;
+    node.m_payload = valueBits;
+    return AddNode(node);
+}
+
+template <class T>
+GPA_Status GPA_DerivedCounterEvaluator::ParseExpression(const char*                    pExpression,
+                                                        const std::vector<gpa_uint32>& internalCountersRequired,
+                                                        GPA_Data_Type                  dataType,
+                                                        const GPA_HWInfo*              pHwInfo,
+                                                        gpa_uint32&                    rootNode)
+{
+    std::vector<gpa_uint32> stack;
+    std::stringstream       tokens(pExpression);
+    std::string             token;
+
+    // Pops the specified number of operands into a node, preserving their formula stack order
+    auto PopOperands = [&stack](Node& node, size_t count) -> bool {
+        if (stack.size() < count)
+        {
+            return false;
+        }
+
+        node.m_operands.assign(stack.end() - count, stack.end());
+        stack.resize(stack.size() - count);
+        return true;
+    };
+
+    auto MakeNode = [dataType](NodeOp op) -> Node {
+        Node node;
+        node.m_op      = op;
+        node.m_type    = dataType;
+        node.m_payload = 0;
+        return node;
+    };
+
+    bool isValid = true;
+
+    while (isValid && std::getline(tokens, token, ','))
+    {
+        // the formula separators are ',' and ' '
+        size_t first = token.find_first_not_of(' ');
+        size_t last  = token.find_last_not_of(' ');
+
+        if (std::string::npos == first)
+        {
+            continue;
+        }
+
+        token = token.substr(first, last - first + 1);
+
+        std::string name;
+        int32_t     width = 0;
+        SplitToken(token, name, width);
+
+        if (token[0] == '*' || token[0] == '/' || token[0] == '+' || token[0] == '-')
+        {
+            NodeOp op = NodeOp::ADD;
+
+            switch (token[0])
+            {
+            case '*':
+                op = NodeOp::MUL;
+                break;
+
+            case '/':
+                op = NodeOp::DIV;
+                break;
+
+            case '-':
+                op = NodeOp::SUB;
+                break;
+
+            default:
+                break;
+            }
+
+            Node node = MakeNode(op);
+            isValid   = PopOperands(node, 2);
+
+            if (isValid)
+            {
+                stack.push_back(AddNode(node));
+            }
+        }
+        else if (token[0] == '(')
+        {
+            // constant
+            T   constant   = static_cast<T>(0);
+            int scanResult = 0;
+
+            if (GPA_DATA_TYPE_FLOAT64 == dataType)
+            {
+                gpa_float64 value = 0;
+                scanResult        = sscanf(token.c_str(), "(%lf)", &value);
+                constant          = static_cast<T>(value);
+            }
+            else
+            {
+                unsigned long long value = 0;
+                scanResult               = sscanf(token.c_str(), "(%llu)", &value);
+                constant                 = static_cast<T>(value);
+            }
+
+            isValid = 1 == scanResult;
+
+            if (isValid)
+            {
+                stack.push_back(AddConstant(dataType, ToBits(constant)));
+            }
+        }
+        else if (_strcmpi(token.c_str(), "num_shader_engines") == 0)
+        {
+            stack.push_back(AddConstant(dataType, ToBits(static_cast<T>(pHwInfo->GetNumberShaderEngines()))));
+        }
+        else if (_strcmpi(token.c_str(), "num_shader_arrays") == 0)
+        {
+            stack.push_back(AddConstant(dataType, ToBits(static_cast<T>(pHwInfo->GetNumberShaderArrays()))));
+        }
+        else if (_strcmpi(token.c_str(), "num_simds") == 0)
+        {
+            stack.push_back(AddConstant(dataType, ToBits(static_cast<T>(pHwInfo->GetNumberSIMDs()))));
+        }
+        else if (_strcmpi(token.c_str(), "su_clocks_prim") == 0)
+        {
+            stack.push_back(AddConstant(dataType, ToBits(static_cast<T>(pHwInfo->GetSUClocksPrim()))));
+        }
+        else if (_strcmpi(token.c_str(), "num_prim_pipes") == 0)
+        {
+            stack.push_back(AddConstant(dataType, ToBits(static_cast<T>(pHwInfo->GetNumberPrimPipes()))));
+        }
+        else if (_strcmpi(token.c_str(), "num_cus") == 0)
+        {
+            stack.push_back(AddConstant(dataType, ToBits(static_cast<T>(pHwInfo->GetNumberCUs()))));
+        }
+        else if (_strcmpi(token.c_str(), "TS_FREQ") == 0)
+        {
+            gpa_uint64 freq = 1u;
+            GPA_ASSERT(pHwInfo->GetTimeStampFrequency(freq));
+            stack.push_back(AddConstant(dataType, ToBits(static_cast<T>(freq))));
+        }
+        else if (_strcmpi(token.c_str(), "max") == 0 || _strcmpi(token.c_str(), "min") == 0)
+        {
+            Node node = MakeNode(_strcmpi(token.c_str(), "max") == 0 ? NodeOp::MAX : NodeOp::MIN);
+            isValid   = PopOperands(node, 2);
+
+            if (isValid)
+            {
+                stack.push_back(AddNode(node));
+            }
+        }
+        else if (_strcmpi(token.c_str(), "ifnotzero") == 0)
+        {
+            Node node = MakeNode(NodeOp::IF_NOT_ZERO);
+            isValid   = PopOperands(node, 3);
+
+            if (isValid)
+            {
+                stack.push_back(AddNode(node));
+            }
+        }
+        else if (_strcmpi(token.c_str(), "comparemax4") == 0)
+        {
+            Node node = MakeNode(NodeOp::COMPARE_MAX_4);
+            isValid   = PopOperands(node, 8);
+
+            if (isValid)
+            {
+                stack.push_back(AddNode(node));
+            }
+        }
+        else if (0 < width && (_strcmpi(name.c_str(), "max") == 0 || _strcmpi(name.c_str(), "sum") == 0 || _strcmpi(name.c_str(), "avg") == 0))
+        {
+            NodeOp op = NodeOp::MAX_N;
+
+            if (_strcmpi(name.c_str(), "sum") == 0)
+            {
+                op = NodeOp::SUM_N;
+            }
+            else if (_strcmpi(name.c_str(), "avg") == 0)
+            {
+                op = NodeOp::AVG_N;
+            }
+
+            Node node = MakeNode(op);
+            isValid   = PopOperands(node, static_cast<size_t>(width));
+
+            if (isValid)
+            {
+                stack.push_back(AddNode(node));
+            }
+        }
+        else if (0 < width && (_strcmpi(name.c_str(), "vecsum") == 0 || _strcmpi(name.c_str(), "vecsub") == 0 || _strcmpi(name.c_str(), "vecdiv") == 0))
+        {
+            // element-wise operation on two vectors, expressed as one binary node per element
+            NodeOp op = NodeOp::ADD;
+
+            if (_strcmpi(name.c_str(), "vecsub") == 0)
+            {
+                op = NodeOp::SUB;
+            }
+            else if (_strcmpi(name.c_str(), "vecdiv") == 0)
+            {
+                op = NodeOp::DIV;
+            }
+
+            Node vectors = MakeNode(op);
+            isValid      = PopOperands(vectors, 2 * static_cast<size_t>(width));
+
+            for (int32_t i = 0; isValid && i < width; ++i)
+            {
+                Node node = MakeNode(op);
+                node.m_operands.push_back(vectors.m_operands[i]);
+                node.m_operands.push_back(vectors.m_operands[width + i]);
+                stack.push_back(AddNode(node));
+            }
+        }
+        else if (0 < width && (_strcmpi(name.c_str(), "scalarSub") == 0 || _strcmpi(name.c_str(), "scalarDiv") == 0))
+        {
+            // the scalar is on top of the vector
+            bool isSub    = _strcmpi(name.c_str(), "scalarSub") == 0;
+            Node operands = MakeNode(NodeOp::SUB_CLAMPED);
+            isValid       = PopOperands(operands, static_cast<size_t>(width) + 1);
+
+            for (int32_t i = 0; isValid && i < width; ++i)
+            {
+                Node node = MakeNode(isSub ? NodeOp::SUB_CLAMPED : NodeOp::DIV);
+
+                if (isSub)
+                {
+                    node.m_operands.push_back(operands.m_operands[width]);
+                    node.m_operands.push_back(operands.m_operands[i]);
+                }
+                else
+                {
+                    node.m_operands.push_back(operands.m_operands[i]);
+                    node.m_operands.push_back(operands.m_operands[width]);
+                }
+
+                stack.push_back(AddNode(node));
+            }
+        }
+        else if (0 < width && _strcmpi(name.c_str(), "scalarMul") == 0)
+        {
+            // the scalar is below the vector
+            Node operands = MakeNode(NodeOp::MUL);
+            isValid       = PopOperands(operands, static_cast<size_t>(width) + 1);
+
+            for (int32_t i = 0; isValid && i < width; ++i)
+            {
+                Node node = MakeNode(NodeOp::MUL);
+                node.m_operands.push_back(operands.m_operands[i + 1]);
+                node.m_operands.push_back(operands.m_operands[0]);
+                stack.push_back(AddNode(node));
+            }
+        }
+        else
+        {
+            // must be number, reference to internal counter
+            char*         pEnd  = nullptr;
+            unsigned long index = strtoul(token.c_str(), &pEnd, 10);
+            isValid             = nullptr != pEnd && '\0' == *pEnd && index < internalCountersRequired.size();
+
+            if (isValid)
+            {
+                gpa_uint32 internalCounterIndex = internalCountersRequired[index];
+                auto       inputIter            = m_inputIndexMap.find(internalCounterIndex);
+
+                if (inputIter == m_inputIndexMap.end())
+                {
+                    inputIter = m_inputIndexMap.insert(std::make_pair(internalCounterIndex, static_cast<gpa_uint32>(m_inputs.size()))).first;
+                    m_inputs.push_back(internalCounterIndex);
+                }
+
+                Node node      = MakeNode(NodeOp::INPUT);
+                node.m_payload = inputIter->second;
+                stack.push_back(AddNode(node));
+            }
+        }
+    }
+
+    if (!isValid || stack.size() != 1)
+    {
+        std::stringstream ss;
+        ss << "Invalid formula: " << pExpression << ".";
+        GPA_LogError(ss.str().c_str());
+        return GPA_STATUS_ERROR_INVALID_COUNTER_EQUATION;
+    }
+
+    rootNode = stack.back();
+    return GPA_STATUS_OK;
+}
+
+template <class T>
+gpa_uint64 GPA_DerivedCounterEvaluator::EvaluateNode(const Node& node, const gpa_uint64* pInputValues, const std::vector<gpa_uint64>& nodeValues) const
+{
+    // the operations below mirror the ones of the formula interpreter in gpa_derived_counter.cc, including the order
+    // in which the operands are combined, so that both produce identical results
+    const std::vector<gpa_uint32>& operands = node.m_operands;
+
+    auto Operand = [&operands, &nodeValues](size_t i) -> T { return FromBits<T>(nodeValues[operands[i]]); };
+
+    T value = static_cast<T>(0);
+
+    switch (node.m_op)
+    {
+    case NodeOp::CONSTANT:
+        return node.m_payload;
+
+    case NodeOp::INPUT:
+        value = static_cast<T>(pInputValues[node.m_payload]);
+        break;
+
+    case NodeOp::ADD:
+        value = Operand(0) + Operand(1);
+        break;
+
+    case NodeOp::SUB:
+        value = Operand(0) - Operand(1);
+        break;
+
+    case NodeOp::MUL:
+        value = Operand(0) * Operand(1);
+        break;
+
+    case NodeOp::DIV:
+        value = Operand(1) != static_cast<T>(0) ? Operand(0) / Operand(1) : static_cast<T>(0);
+        break;
+
+    case NodeOp::SUB_CLAMPED:
+        value = Operand(0) - Operand(1);
+
+        if (value < static_cast<T>(0))
+        {
+            value = static_cast<T>(0);
+        }
+
+        break;
+
+    case NodeOp::MAX:
+        value = Operand(0) > Operand(1) ? Operand(0) : Operand(1);
+        break;
+
+    case NodeOp::MIN:
+        value = Operand(0) < Operand(1) ? Operand(0) : Operand(1);
+        break;
+
+    case NodeOp::IF_NOT_ZERO:
+        value = Operand(2) != static_cast<T>(0) ? Operand(1) : Operand(0);
+        break;
+
+    case NodeOp::SUM_N:
+    case NodeOp::AVG_N:
+        for (size_t i = operands.size(); i > 0; --i)
+        {
+            value += Operand(i - 1);
+        }
+
+        if (NodeOp::AVG_N == node.m_op)
+        {
+            value /= static_cast<T>(operands.size());
+        }
+
+        break;
+
+    case NodeOp::MAX_N:
+        value = Operand(operands.size() - 1);
+
+        for (size_t i = operands.size() - 1; i > 0; --i)
+        {
+            T current = Operand(i - 1);
+            value     = (value > current) ? value : current;
+        }
+
+        break;
+
+    case NodeOp::COMPARE_MAX_4:
+    {
+        // the last four operands select which of the first four are considered (top of stack pairs with top of stack)
+        bool found = false;
+
+        for (size_t i = 0; i < 4; ++i)
+        {
+            if (Operand(7 - i) != static_cast<T>(0))
+            {
+                T current = Operand(3 - i);
+
+                if (!found || value < current)
+                {
+                    value = current;
+                    found = true;
+                }
+            }
+        }
+
+        break;
+    }
+
+    default:
+        assert(false);
+        break;
+    }
+
+    return ToBits(value);
+}
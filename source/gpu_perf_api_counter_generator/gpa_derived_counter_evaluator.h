@@ -0,0 +1,156 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Evaluates a set of derived counters as one graph with shared sub-expressions
+//==============================================================================
+
+#ifndef _GPA_DERIVED_COUNTER_EVALUATOR_H_
+#define _GPA_DERIVED_COUNTER_EVALUATOR_H_
+
+#include <vector>
+#include <map>
+
+#include "gpu_perf_api_types.h"
+
+class GPA_HWInfo;  // forward declaration
+
+/// Evaluates the equations of a set of derived counters as a single graph.
+///
+/// Each equation is parsed once into nodes; identical sub-expressions (the same operation applied to
+/// the same operands, such as a sum over all instances of a block or a TS_FREQ scaling) are shared
+/// between all counters added to the evaluator, so that each of them is evaluated only once per sample.
+/// Internal counter references are resolved to global internal counter indices, so the same hardware
+/// counter referenced by several equations maps to a single input.
+class GPA_DerivedCounterEvaluator
+{
+public:
+    /// Constructor
+    GPA_DerivedCounterEvaluator();
+
+    /// Adds a derived counter equation to the graph
+    /// \param[in] pExpression the counter formula (in the RPN format used by GPA_DerivedCounter)
+    /// \param[in] internalCountersRequired the internal counters referenced by the formula, in formula index order
+    /// \param[in] dataType the data type of the counter result
+    /// \param[in] pHwInfo the hardware info used to resolve device constants
+    /// \param[out] outputIndex the index of the counter's value in the evaluated outputs
+    /// \return GPA_STATUS_OK on success, otherwise an error code
+    GPA_Status AddCounter(const char*                    pExpression,
+                          const std::vector<gpa_uint32>& internalCountersRequired,
+                          GPA_Data_Type                  dataType,
+                          const GPA_HWInfo*              pHwInfo,
+                          gpa_uint32&                    outputIndex);
+
+    /// Removes all counters from the graph
+    void Clear();
+
+    /// Gets the internal counters which are the inputs of the graph
+    /// \return the global indices of the internal counters, in input order
+    const std::vector<gpa_uint32>& GetInputs() const;
+
+    /// Gets the number of outputs (one per added counter)
+    /// \return the number of outputs
+    gpa_uint32 GetNumOutputs() const;
+
+    /// Gets the number of nodes in the graph
+    /// \return the number of nodes in the graph
+    gpa_uint32 GetNumNodes() const;
+
+    /// Gets the number of nodes the added equations would have required without sharing
+    /// \return the number of nodes the added equations would have required without sharing
+    gpa_uint32 GetNumUnsharedNodes() const;
+
+    /// Estimates the number of bytes allocated by the graph
+    /// \return the number of bytes allocated for the nodes, inputs and outputs of the graph
+    size_t GetMemoryUsage() const;
+
+    /// Evaluates the graph
+    /// \param[in] pInputValues one value per input, in the order returned by GetInputs()
+    /// \param[in,out] nodeValues scratch storage for the node values (resized as needed)
+    /// \param[out] pOutputValues one 64-bit value per output, of the data type of the corresponding counter
+    void Evaluate(const gpa_uint64* pInputValues, std::vector<gpa_uint64>& nodeValues, gpa_uint64* pOutputValues) const;
+
+private:
+    /// Operations performed by the nodes of the graph
+    enum class NodeOp : gpa_uint8
+    {
+        CONSTANT,       ///< constant value
+        INPUT,          ///< internal counter value converted to the node type
+        ADD,            ///< a + b
+        SUB,            ///< a - b
+        MUL,            ///< a * b
+        DIV,            ///< a / b, or 0 if b is 0
+        SUB_CLAMPED,    ///< a - b, clamped to 0 if negative
+        MAX,            ///< binary max
+        MIN,            ///< binary min
+        IF_NOT_ZERO,    ///< operand 2 != 0 ? operand 1 : operand 0
+        SUM_N,          ///< sum of the operands
+        AVG_N,          ///< average of the operands
+        MAX_N,          ///< max of the operands
+        COMPARE_MAX_4,  ///< max of the first four operands whose matching value in the last four operands is non-zero
+    };
+
+    /// Node of the graph, also used as the key to find identical nodes
+    struct Node
+    {
+        NodeOp                  m_op;        ///< the operation of the node
+        GPA_Data_Type           m_type;      ///< the type the node is evaluated in
+        gpa_uint64              m_payload;   ///< constant value bits or input index
+        std::vector<gpa_uint32> m_operands;  ///< the operand nodes, in formula stack order
+
+        /// Less-than operator used to find identical nodes
+        /// \param[in] other the node to compare with
+        /// \return true if this node orders before the other node
+        bool operator<(const Node& other) const;
+    };
+
+    /// Adds a node to the graph, or returns the index of an identical existing node
+    /// \param[in] node the node to add
+    /// \return the index of the node
+    gpa_uint32 AddNode(const Node& node);
+
+    /// Removes the nodes and inputs added after the graph had the given size
+    /// \param[in] numNodes the number of nodes to keep
+    /// \param[in] numInputs the number of inputs to keep
+    /// \param[in] numUnsharedNodes the number of unshared nodes of the kept nodes
+    void Truncate(size_t numNodes, size_t numInputs, gpa_uint32 numUnsharedNodes);
+
+    /// Adds a constant node
+    /// \param[in] type the type of the node
+    /// \param[in] valueBits the bits of the constant value, in the node type
+    /// \return the index of the node
+    gpa_uint32 AddConstant(GPA_Data_Type type, gpa_uint64 valueBits);
+
+    /// Parses an equation and adds its nodes to the graph
+    /// T is the type the equation is evaluated in
+    /// \param[in] pExpression the counter formula
+    /// \param[in] internalCountersRequired the internal counters referenced by the formula
+    /// \param[in] dataType the data type of the counter result
+    /// \param[in] pHwInfo the hardware info used to resolve device constants
+    /// \param[out] rootNode the node holding the result of the formula
+    /// \return GPA_STATUS_OK on success, otherwise an error code
+    template <class T>
+    GPA_Status ParseExpression(const char*                    pExpression,
+                               const std::vector<gpa_uint32>& internalCountersRequired,
+                               GPA_Data_Type                  dataType,
+                               const GPA_HWInfo*              pHwInfo,
+                               gpa_uint32&                    rootNode);
+
+    /// Evaluates the nodes of the graph in the given type
+    /// T is the node type
+    /// \param[in] node the node to evaluate
+    /// \param[in] pInputValues the input values
+    /// \param[in] nodeValues the values of the previously evaluated nodes
+    /// \return the value bits of the node
+    template <class T>
+    gpa_uint64 EvaluateNode(const Node& node, const gpa_uint64* pInputValues, const std::vector<gpa_uint64>& nodeValues) const;
+
+    std::vector<Node>                m_nodes;             ///< nodes of the graph, in evaluation order
+    std::map<Node, gpa_uint32>       m_nodeIndexMap;      ///< map of node to its index, used to share identical nodes
+    std::vector<gpa_uint32>          m_inputs;            ///< global internal counter index of each input
+    std::map<gpa_uint32, gpa_uint32> m_inputIndexMap;     ///< map of global internal counter index to input index
+    std::vector<gpa_uint32>          m_outputs;           ///< node index of each output
+    gpa_uint32                       m_numUnsharedNodes;  ///< number of nodes that would be needed without sharing
+};
+
+#endif  // _GPA_DERIVED_COUNTER_EVALUATOR_H_
@@ -8,15 +8,14 @@
 #ifndef _GPA_HARDWARE_COUNTERS_H_
 #define _GPA_HARDWARE_COUNTERS_H_
 
-#ifdef AMDT_INTERNAL
-#include <unordered_map>
-#endif
-
+#include <mutex>
 #include <sstream>
+#include <unordered_map>
 #include "gpa_counter.h"
 #include "gpa_common_defs.h"
 #include "gpa_split_counters_interfaces.h"
 #include "gpa_counter_scheduler_interface.h"
+#include "gpa_memory_tracker.h"
 
 /// Struct to describe a hardware counter
 struct GPA_HardwareCounterDescExt
@@ -207,6 +206,10 @@ public:
         m_hardwareExposedCounters.clear();
         m_hardwareExposedCounterInternalIndices.clear();
         m_hardwareExposedCountersGenerated = false;
+
+        std::lock_guard<std::mutex> lock(cache_mutex_);
+        block_instance_names_.clear();
+        block_instance_descriptions_.clear();
     }
 
     /// Obtains the number of hardware counters
@@ -223,6 +226,28 @@ public:
         return static_cast<gpa_uint32>(m_hardwareExposedCounters.size());
     }
 
+    /// Estimates the number of bytes allocated for the hardware counters and their caches, excluding the static counter tables
+    /// \return the number of bytes allocated for the hardware counters
+    size_t GetMemoryUsage() const
+    {
+        size_t numBytes = GPAContainerBytes(m_counters) + GPAContainerBytes(m_currentGroupUsedCounts) + GPANodeContainerBytes(m_timestampBlockIds) +
+                          GPANodeContainerBytes(m_timeCounterIndices) + GPAContainerBytes(m_hardwareExposedCounters) +
+                          GPAContainerBytes(m_hardwareExposedCounterInternalIndices);
+
+        std::lock_guard<std::mutex> lock(cache_mutex_);
+
+        numBytes += GPAContainerBytes(block_instance_counters_index_cache_) + GPAContainerBytes(gpa_hw_block_hardware_block_group_cache_) +
+                    GPANodeContainerBytes(counter_hardware_info_map_) + GPANodeContainerBytes(block_instance_names_) +
+                    GPANodeContainerBytes(block_instance_descriptions_);
+
+        for (auto blockIter = block_instance_counters_index_cache_.cbegin(); blockIter != block_instance_counters_index_cache_.cend(); ++blockIter)
+        {
+            numBytes += GPAContainerBytes(*blockIter);
+        }
+
+        return numBytes;
+    }
+
     /// Obtains the index of the counter
     /// \param[in] gpa_hardware_block Gpa hardware block
     /// \param[in] block_instance block instance
@@ -236,6 +261,8 @@ public:
                   const GpaShaderMask& sq_shader_mask,
                   gpa_uint32*          counter_index) const
     {
+        std::lock_guard<std::mutex> lock(cache_mutex_);
+
         auto update_hardware_info_in_cache = [&](GpaInternalHardwareBlock gpa_internal_hardware_block) -> bool {
 
             if (gpa_hw_block_hardware_block_group_cache_.empty())
@@ -395,7 +422,7 @@ public:
             return m_alternateNameMap.at(index).c_str();
         }
 #endif
-        return m_counters[index].m_pHardwareCounter->m_pName;
+        return GetBlockInstanceString(index, m_counters[index].m_pHardwareCounter->m_pName, block_instance_names_);
     }
 
     /// Gets the name of the specified hardware exposed counter
@@ -490,6 +517,8 @@ public:
 
     bool GetHardwareInfo(const gpa_uint32& counter_index, GpaHwCounter& gpa_hw_counter) const
     {
+        std::lock_guard<std::mutex> lock(cache_mutex_);
+
         if (counter_index <= m_counters.size())
         {
             auto counter_hardware_info = counter_hardware_info_map_.find(counter_index);
@@ -538,7 +567,7 @@ public:
     /// \return the description of the specified counter
     const char* GetCounterDescription(gpa_uint32 index) const
     {
-        return m_counters[index].m_pHardwareCounter->m_pDescription;
+        return GetBlockInstanceString(index, m_counters[index].m_pHardwareCounter->m_pDescription, block_instance_descriptions_);
     }
 
     /// Gets the description of the specified counter
@@ -659,6 +688,48 @@ public:
                counterIndex == m_gpuTimeTopToBottomEndCounterIndex;
     }
 
+    /// Gets a string of a counter, substituting its block instance if the counter is shared by all instances of its hardware block.
+    /// The strings of the instances are only synthesized when they are requested, then kept until the counters are cleared.
+    /// \param[in] index the index of the counter
+    /// \param[in] pString the name or the description of the counter
+    /// \param[in,out] blockInstanceStrings the strings already synthesized for the counters
+    /// \return the string of the counter for its block instance
+    const char* GetBlockInstanceString(gpa_uint32                                   index,
+                                       const char*                                  pString,
+                                       std::unordered_map<gpa_uint32, std::string>& blockInstanceStrings) const
+    {
+        if (nullptr == pString || nullptr == strchr(pString, GPA_BLOCK_INSTANCE_PLACEHOLDER))
+        {
+            return pString;
+        }
+
+        std::lock_guard<std::mutex> lock(cache_mutex_);
+
+        auto blockInstanceString = blockInstanceStrings.find(index);
+
+        if (blockInstanceString == blockInstanceStrings.end())
+        {
+            gpa_uint32 groupIndex    = m_counters[index].m_groupIndex;
+            gpa_uint32 blockInstance = (groupIndex < m_groupCount) ? m_pGroups[groupIndex].m_blockInstance
+                                                                   : m_pAdditionalGroups[groupIndex - m_groupCount].m_blockInstance;
+
+            std::string instanceString(pString);
+            std::string blockInstanceNumber = std::to_string(blockInstance);
+
+            size_t placeholder = instanceString.find(GPA_BLOCK_INSTANCE_PLACEHOLDER);
+
+            while (std::string::npos != placeholder)
+            {
+                instanceString.replace(placeholder, 1, blockInstanceNumber);
+                placeholder = instanceString.find(GPA_BLOCK_INSTANCE_PLACEHOLDER, placeholder + blockInstanceNumber.size());
+            }
+
+            blockInstanceString = blockInstanceStrings.emplace(index, std::move(instanceString)).first;
+        }
+
+        return blockInstanceString->second.c_str();
+    }
+
     GPA_HardwareCounterDesc** m_ppCounterGroupArray;                   ///< List of counter groups as defined by the list of internal counters in each group.
     GPA_CounterGroupDesc*     m_pGroups;                               ///< List of internal counter groups
     GPA_CounterGroupDesc*     m_pAdditionalGroups;                     ///< List of internal counter groups exposed by the driver, but not known by GPA
@@ -687,6 +758,11 @@ public:
 
     using CounterIndex = gpa_uint32;
     mutable std::map<CounterIndex, GpaHwCounter> counter_hardware_info_map_;  ///< cache of the counter index and hardware info
+    mutable std::mutex                           cache_mutex_;  ///< mutex protecting the caches, as the counters may be shared by several contexts
+
+    /// the names and descriptions synthesized for the counters shared by all instances of their hardware block, the strings never move once inserted
+    mutable std::unordered_map<CounterIndex, std::string> block_instance_names_;         ///< cache of the synthesized counter names
+    mutable std::unordered_map<CounterIndex, std::string> block_instance_descriptions_;  ///< cache of the synthesized counter descriptions
 
     /// Hardware exposed counters
     GPA_HardwareCounterDesc**
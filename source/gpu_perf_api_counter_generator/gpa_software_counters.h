@@ -13,6 +13,7 @@
 #include "gpa_counter.h"
 #include "logging.h"
 #include "gpa_sw_counter_manager.h"
+#include "gpa_memory_tracker.h"
 
 
 /// Struct to describe a software counter
@@ -56,6 +57,13 @@ public:
         return static_cast<gpa_uint32>(m_counters.size());
     }
 
+    /// Estimates the number of bytes allocated for the software counters, excluding the static counter tables
+    /// \return the number of bytes allocated for the software counters
+    size_t GetMemoryUsage() const
+    {
+        return GPAContainerBytes(m_counters);
+    }
+
     /// Gets the name of the specified counter
     /// \param index the index of the counter whose name is needed
     /// \return the name of the specified counter
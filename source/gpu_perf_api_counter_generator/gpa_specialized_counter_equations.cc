@@ -0,0 +1,624 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Derived counter equations specialized for the device of a context
+//==============================================================================
+
+#include <stdio.h>
+#include <string.h>
+#include <cctype>
+#include <cstdlib>
+#include <sstream>
+
+#include "logging.h"
+#include "gpa_common_defs.h"
+#include "gpa_hw_info.h"
+#include "gpa_counter_accessor_interface.h"
+#include "gpa_derived_counter.h"
+#include "gpa_specialized_counter_equations.h"
+
+/// An operand of the formula stack while an equation is specialized
+/// T is the type the equation is evaluated in
+template <class T>
+struct SpecializedTerm
+{
+    bool        m_isConstant;   ///< flag indicating the value of the operand is known
+    T           m_value;        ///< the value of the operand, if it is constant
+    std::string m_expression;   ///< the formula of the operand, if it is not constant
+    T           m_multiplier;   ///< constant the formula is multiplied by (floating point equations only)
+    T           m_divisor;      ///< constant the formula is divided by (floating point equations only)
+};
+
+/// Creates a constant operand
+/// T is the type the equation is evaluated in
+/// \param value the value of the operand
+/// \return the operand
+template <class T>
+static SpecializedTerm<T> MakeConstantTerm(T value)
+{
+    SpecializedTerm<T> term = {true, value, std::string(), static_cast<T>(1), static_cast<T>(1)};
+    return term;
+}
+
+/// Creates an operand whose value is only known once the internal counters are sampled
+/// T is the type the equation is evaluated in
+/// \param expression the formula of the operand
+/// \return the operand
+template <class T>
+static SpecializedTerm<T> MakeExpressionTerm(const std::string& expression)
+{
+    SpecializedTerm<T> term = {false, static_cast<T>(0), expression, static_cast<T>(1), static_cast<T>(1)};
+    return term;
+}
+
+/// Formats a constant of a floating point equation, so that it is parsed back to the same value
+/// \param value the constant
+/// \return the constant token
+static std::string FormatConstant(gpa_float64 value)
+{
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "(%.17g)", value);
+    return buffer;
+}
+
+/// Formats a constant of an integer equation
+/// \param value the constant
+/// \return the constant token
+static std::string FormatConstant(gpa_uint64 value)
+{
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "(%llu)", static_cast<unsigned long long>(value));
+    return buffer;
+}
+
+/// Parses a constant token the way the formula interpreter does
+/// \param token the constant token
+/// \param[out] value the constant
+/// \return true if the token is a valid constant
+static bool ParseConstant(const std::string& token, gpa_float64& value)
+{
+    return 1 == sscanf(token.c_str(), "(%lf)", &value);
+}
+
+/// Parses a constant token the way the formula interpreter does
+/// \param token the constant token
+/// \param[out] value the constant
+/// \return true if the token is a valid constant
+static bool ParseConstant(const std::string& token, gpa_uint64& value)
+{
+    unsigned long long parsedValue = 0;
+    bool               isValid     = 1 == sscanf(token.c_str(), "(%llu)", &parsedValue);
+    value                          = static_cast<gpa_uint64>(parsedValue);
+    return isValid;
+}
+
+/// Gets the formula of an operand
+/// T is the type the equation is evaluated in
+/// \param term the operand
+/// \return the formula of the operand
+template <class T>
+static std::string GetTermExpression(const SpecializedTerm<T>& term)
+{
+    if (term.m_isConstant)
+    {
+        return FormatConstant(term.m_value);
+    }
+
+    if (static_cast<T>(1) == term.m_divisor)
+    {
+        return (static_cast<T>(1) == term.m_multiplier) ? term.m_expression : term.m_expression + "," + FormatConstant(term.m_multiplier) + ",*";
+    }
+
+    if (static_cast<T>(1) == term.m_multiplier)
+    {
+        return term.m_expression + "," + FormatConstant(term.m_divisor) + ",/";
+    }
+
+    T scale = term.m_multiplier / term.m_divisor;
+    return (static_cast<T>(1) == scale) ? term.m_expression : term.m_expression + "," + FormatConstant(scale) + ",*";
+}
+
+/// Builds the operand computed by an operation which could not be folded
+/// T is the type the equation is evaluated in
+/// \param operands the operands of the operation, in formula stack order
+/// \param token the operation token
+/// \return the operand
+template <class T>
+static SpecializedTerm<T> MakeOperationTerm(const std::vector<SpecializedTerm<T>>& operands, const std::string& token)
+{
+    std::string expression;
+
+    for (auto operandIter = operands.cbegin(); operandIter != operands.cend(); ++operandIter)
+    {
+        expression += GetTermExpression(*operandIter) + ",";
+    }
+
+    return MakeExpressionTerm<T>(expression + token);
+}
+
+/// Folds the multiplication or division of an operand by a constant into its scaling.
+/// Only floating point equations are scaled, as the integer divisions of the original formula truncate.
+/// \param term the operand which is not constant
+/// \param constant the constant operand
+/// \param isDivision flag indicating the operand is divided by the constant, rather than multiplied
+/// \return the scaled operand
+static SpecializedTerm<gpa_float64> ScaleTerm(const SpecializedTerm<gpa_float64>& term, gpa_float64 constant, bool isDivision)
+{
+    SpecializedTerm<gpa_float64> scaledTerm = term;
+
+    if (isDivision)
+    {
+        scaledTerm.m_divisor *= constant;
+    }
+    else
+    {
+        scaledTerm.m_multiplier *= constant;
+    }
+
+    return scaledTerm;
+}
+
+/// Integer operands are never scaled
+/// \param term the operand which is not constant
+/// \param constant the constant operand
+/// \param isDivision flag indicating the operand is divided by the constant, rather than multiplied
+/// \return the operand computed by the operation
+static SpecializedTerm<gpa_uint64> ScaleTerm(const SpecializedTerm<gpa_uint64>& term, gpa_uint64 constant, bool isDivision)
+{
+    std::vector<SpecializedTerm<gpa_uint64>> operands = {term, MakeConstantTerm(constant)};
+    return MakeOperationTerm(operands, isDivision ? "/" : "*");
+}
+
+/// Splits a formula token into its alphabetic name and its numeric width suffix (e.g. "sum16" -> "sum", 16)
+/// \param token the formula token
+/// \param[out] name the name part of the token
+/// \param[out] width the numeric suffix of the token, or 0 if there is none
+static void SplitToken(const std::string& token, std::string& name, int32_t& width)
+{
+    size_t suffixStart = token.size();
+
+    while (suffixStart > 0 && isdigit(static_cast<unsigned char>(token[suffixStart - 1])))
+    {
+        --suffixStart;
+    }
+
+    name  = token.substr(0, suffixStart);
+    width = suffixStart < token.size() ? atoi(token.c_str() + suffixStart) : 0;
+}
+
+/// Gets the value of a device constant of a formula
+/// \param token the formula token
+/// \param pHwInfo the hardware info
+/// \param[out] value the value of the device constant
+/// \return true if the token is a device constant whose value is known
+static bool GetDeviceConstant(const std::string& token, const GPA_HWInfo* pHwInfo, gpa_uint64& value)
+{
+    const char* pToken = token.c_str();
+
+    if (_strcmpi(pToken, "num_shader_engines") == 0)
+    {
+        value = pHwInfo->GetNumberShaderEngines();
+    }
+    else if (_strcmpi(pToken, "num_shader_arrays") == 0)
+    {
+        value = pHwInfo->GetNumberShaderArrays();
+    }
+    else if (_strcmpi(pToken, "num_simds") == 0)
+    {
+        value = pHwInfo->GetNumberSIMDs();
+    }
+    else if (_strcmpi(pToken, "su_clocks_prim") == 0)
+    {
+        value = pHwInfo->GetSUClocksPrim();
+    }
+    else if (_strcmpi(pToken, "num_prim_pipes") == 0)
+    {
+        value = pHwInfo->GetNumberPrimPipes();
+    }
+    else if (_strcmpi(pToken, "num_cus") == 0)
+    {
+        value = pHwInfo->GetNumberCUs();
+    }
+    else if (_strcmpi(pToken, "TS_FREQ") == 0)
+    {
+        // the timestamp frequency is not known by all the APIs, in which case the token is left for the evaluator to resolve
+        return pHwInfo->GetTimeStampFrequency(value);
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/// Specializes an equation whose operations all produce a single value, folding its constant sub-expressions
+/// T is the type the equation is evaluated in
+/// \param tokens the tokens of the formula
+/// \param pHwInfo the hardware info
+/// \param[out] specializedExpression the specialized formula
+/// \return true if the formula is valid
+template <class T>
+static bool FoldEquation(const std::vector<std::string>& tokens, const GPA_HWInfo* pHwInfo, std::string& specializedExpression)
+{
+    std::vector<SpecializedTerm<T>> stack;
+    std::vector<SpecializedTerm<T>> operands;
+
+    // Pops the specified number of operands, preserving their formula stack order
+    auto PopOperands = [&stack, &operands](size_t count) -> bool {
+        if (stack.size() < count)
+        {
+            return false;
+        }
+
+        operands.assign(stack.end() - count, stack.end());
+        stack.resize(stack.size() - count);
+        return true;
+    };
+
+    auto AreOperandsConstant = [&operands]() -> bool {
+        for (auto operandIter = operands.cbegin(); operandIter != operands.cend(); ++operandIter)
+        {
+            if (!operandIter->m_isConstant)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    };
+
+    // the constant operations below mirror the ones of the formula interpreter in gpa_derived_counter.cc, including the order
+    // in which the operands are combined, so that the folded constants are those the interpreter would compute
+    for (auto tokenIter = tokens.cbegin(); tokenIter != tokens.cend(); ++tokenIter)
+    {
+        const std::string& token = *tokenIter;
+        gpa_uint64         deviceConstant = 0;
+
+        std::string name;
+        int32_t     width = 0;
+        SplitToken(token, name, width);
+
+        if (token == "*" || token == "/" || token == "+" || token == "-")
+        {
+            if (!PopOperands(2))
+            {
+                return false;
+            }
+
+            const SpecializedTerm<T>& p1 = operands[0];
+            const SpecializedTerm<T>& p2 = operands[1];
+
+            if ('/' == token[0] && p2.m_isConstant && static_cast<T>(0) == p2.m_value)
+            {
+                // the interpreter divides by zero as 0
+                stack.push_back(MakeConstantTerm(static_cast<T>(0)));
+            }
+            else if (AreOperandsConstant())
+            {
+                T value = static_cast<T>(0);
+
+                switch (token[0])
+                {
+                case '*':
+                    value = p1.m_value * p2.m_value;
+                    break;
+
+                case '/':
+                    value = p1.m_value / p2.m_value;
+                    break;
+
+                case '+':
+                    value = p1.m_value + p2.m_value;
+                    break;
+
+                default:
+                    value = p1.m_value - p2.m_value;
+                    break;
+                }
+
+                stack.push_back(MakeConstantTerm(value));
+            }
+            else if ('*' == token[0] && p2.m_isConstant)
+            {
+                stack.push_back(ScaleTerm(p1, p2.m_value, false));
+            }
+            else if ('*' == token[0] && p1.m_isConstant)
+            {
+                stack.push_back(ScaleTerm(p2, p1.m_value, false));
+            }
+            else if ('/' == token[0] && p2.m_isConstant)
+            {
+                stack.push_back(ScaleTerm(p1, p2.m_value, true));
+            }
+            else
+            {
+                stack.push_back(MakeOperationTerm(operands, token));
+            }
+        }
+        else if ('(' == token[0])
+        {
+            T value = static_cast<T>(0);
+
+            if (!ParseConstant(token, value))
+            {
+                return false;
+            }
+
+            stack.push_back(MakeConstantTerm(value));
+        }
+        else if (GetDeviceConstant(token, pHwInfo, deviceConstant))
+        {
+            stack.push_back(MakeConstantTerm(static_cast<T>(deviceConstant)));
+        }
+        else if (_strcmpi(token.c_str(), "TS_FREQ") == 0)
+        {
+            stack.push_back(MakeExpressionTerm<T>(token));
+        }
+        else if (_strcmpi(token.c_str(), "max") == 0 || _strcmpi(token.c_str(), "min") == 0)
+        {
+            if (!PopOperands(2))
+            {
+                return false;
+            }
+
+            if (AreOperandsConstant())
+            {
+                T    p1    = operands[0].m_value;
+                T    p2    = operands[1].m_value;
+                bool isMax = _strcmpi(token.c_str(), "max") == 0;
+                stack.push_back(MakeConstantTerm(isMax ? (p1 > p2 ? p1 : p2) : (p1 < p2 ? p1 : p2)));
+            }
+            else
+            {
+                stack.push_back(MakeOperationTerm(operands, token));
+            }
+        }
+        else if (_strcmpi(token.c_str(), "ifnotzero") == 0)
+        {
+            if (!PopOperands(3))
+            {
+                return false;
+            }
+
+            // the condition is on top of the result if true, itself on top of the result if false
+            if (operands[2].m_isConstant)
+            {
+                stack.push_back(static_cast<T>(0) != operands[2].m_value ? operands[1] : operands[0]);
+            }
+            else
+            {
+                stack.push_back(MakeOperationTerm(operands, token));
+            }
+        }
+        else if (_strcmpi(token.c_str(), "comparemax4") == 0)
+        {
+            if (!PopOperands(8))
+            {
+                return false;
+            }
+
+            if (AreOperandsConstant())
+            {
+                // the last four operands select which of the first four are considered (top of stack pairs with top of stack)
+                T    value = static_cast<T>(0);
+                bool found = false;
+
+                for (size_t i = 0; i < 4; ++i)
+                {
+                    if (static_cast<T>(0) != operands[7 - i].m_value && (!found || value < operands[3 - i].m_value))
+                    {
+                        value = operands[3 - i].m_value;
+                        found = true;
+                    }
+                }
+
+                stack.push_back(MakeConstantTerm(value));
+            }
+            else
+            {
+                stack.push_back(MakeOperationTerm(operands, token));
+            }
+        }
+        else if (0 < width && (_strcmpi(name.c_str(), "max") == 0 || _strcmpi(name.c_str(), "sum") == 0 || _strcmpi(name.c_str(), "avg") == 0))
+        {
+            if (!PopOperands(static_cast<size_t>(width)))
+            {
+                return false;
+            }
+
+            if (AreOperandsConstant())
+            {
+                bool isMax = _strcmpi(name.c_str(), "max") == 0;
+                T    value = isMax ? operands.back().m_value : static_cast<T>(0);
+
+                // the operands are combined from the top of the stack down
+                for (size_t i = operands.size(); i > 0; --i)
+                {
+                    T current = operands[i - 1].m_value;
+
+                    if (isMax)
+                    {
+                        value = (value > current) ? value : current;
+                    }
+                    else
+                    {
+                        value += current;
+                    }
+                }
+
+                if (_strcmpi(name.c_str(), "avg") == 0)
+                {
+                    value /= static_cast<T>(width);
+                }
+
+                stack.push_back(MakeConstantTerm(value));
+            }
+            else
+            {
+                stack.push_back(MakeOperationTerm(operands, token));
+            }
+        }
+        else
+        {
+            // must be number, reference to internal counter
+            char* pEnd = nullptr;
+            strtoul(token.c_str(), &pEnd, 10);
+
+            if (nullptr == pEnd || '\0' != *pEnd || !isdigit(static_cast<unsigned char>(token[0])))
+            {
+                return false;
+            }
+
+            stack.push_back(MakeExpressionTerm<T>(token));
+        }
+    }
+
+    if (1 != stack.size())
+    {
+        return false;
+    }
+
+    specializedExpression = GetTermExpression(stack.back());
+    return true;
+}
+
+/// Substitutes the device constants of an equation with their values, without folding its operations.
+/// Used for the equations with vector operations, which push several values at once.
+/// T is the type the equation is evaluated in
+/// \param tokens the tokens of the formula
+/// \param pHwInfo the hardware info
+/// \param[out] specializedExpression the specialized formula
+template <class T>
+static void SubstituteDeviceConstants(const std::vector<std::string>& tokens, const GPA_HWInfo* pHwInfo, std::string& specializedExpression)
+{
+    specializedExpression.clear();
+
+    for (auto tokenIter = tokens.cbegin(); tokenIter != tokens.cend(); ++tokenIter)
+    {
+        gpa_uint64 deviceConstant = 0;
+
+        if (!specializedExpression.empty())
+        {
+            specializedExpression += ",";
+        }
+
+        if (GetDeviceConstant(*tokenIter, pHwInfo, deviceConstant))
+        {
+            specializedExpression += FormatConstant(static_cast<T>(deviceConstant));
+        }
+        else
+        {
+            specializedExpression += *tokenIter;
+        }
+    }
+}
+
+/// Specializes an equation
+/// T is the type the equation is evaluated in
+/// \param pExpression the counter formula
+/// \param pHwInfo the hardware info
+/// \param[out] specializedExpression the specialized formula
+/// \return true if the formula is valid
+template <class T>
+static bool SpecializeEquationOfType(const char* pExpression, const GPA_HWInfo* pHwInfo, std::string& specializedExpression)
+{
+    std::vector<std::string> tokens;
+    std::stringstream        expression(pExpression);
+    std::string              token;
+    bool                     hasVectorOperation = false;
+
+    while (std::getline(expression, token, ','))
+    {
+        // the formula separators are ',' and ' '
+        size_t first = token.find_first_not_of(' ');
+        size_t last  = token.find_last_not_of(' ');
+
+        if (std::string::npos == first)
+        {
+            continue;
+        }
+
+        tokens.push_back(token.substr(first, last - first + 1));
+
+        std::string name;
+        int32_t     width = 0;
+        SplitToken(tokens.back(), name, width);
+
+        hasVectorOperation |= 0 < width && (_strcmpi(name.c_str(), "vecsum") == 0 || _strcmpi(name.c_str(), "vecsub") == 0 ||
+                                            _strcmpi(name.c_str(), "vecdiv") == 0 || _strcmpi(name.c_str(), "scalarSub") == 0 ||
+                                            _strcmpi(name.c_str(), "scalarDiv") == 0 || _strcmpi(name.c_str(), "scalarMul") == 0);
+    }
+
+    if (hasVectorOperation)
+    {
+        SubstituteDeviceConstants<T>(tokens, pHwInfo, specializedExpression);
+        return true;
+    }
+
+    return FoldEquation<T>(tokens, pHwInfo, specializedExpression);
+}
+
+void GPA_SpecializedCounterEquations::Specialize(const IGPACounterAccessor* pCounterAccessor, const GPA_HWInfo* pHwInfo)
+{
+    m_equations.clear();
+
+    if (nullptr == pCounterAccessor || nullptr == pHwInfo)
+    {
+        return;
+    }
+
+    gpa_uint32 numPublicCounters = pCounterAccessor->GetNumPublicCounters();
+    m_equations.resize(numPublicCounters);
+
+    for (gpa_uint32 counterIndex = 0; counterIndex < numPublicCounters; ++counterIndex)
+    {
+        const GPA_DerivedCounter* pPublicCounter = pCounterAccessor->GetPublicCounter(counterIndex);
+
+        if (nullptr != pPublicCounter && nullptr != pPublicCounter->m_pComputeExpression &&
+            !SpecializeEquation(pPublicCounter->m_pComputeExpression, pPublicCounter->m_dataType, pHwInfo, m_equations[counterIndex]))
+        {
+            m_equations[counterIndex].clear();
+
+            std::stringstream ss;
+            ss << "Unable to specialize the equation of counter " << pPublicCounter->m_pName << ".";
+            GPA_LogDebugMessage(ss.str().c_str());
+        }
+    }
+}
+
+const char* GPA_SpecializedCounterEquations::GetEquation(gpa_uint32 publicCounterIndex) const
+{
+    if (publicCounterIndex >= m_equations.size() || m_equations[publicCounterIndex].empty())
+    {
+        return nullptr;
+    }
+
+    return m_equations[publicCounterIndex].c_str();
+}
+
+bool GPA_SpecializedCounterEquations::SpecializeEquation(const char*       pExpression,
+                                                         GPA_Data_Type     dataType,
+                                                         const GPA_HWInfo* pHwInfo,
+                                                         std::string&      specializedExpression)
+{
+    specializedExpression.clear();
+
+    if (nullptr == pExpression || nullptr == pHwInfo)
+    {
+        return false;
+    }
+
+    if (GPA_DATA_TYPE_FLOAT64 == dataType)
+    {
+        return SpecializeEquationOfType<gpa_float64>(pExpression, pHwInfo, specializedExpression);
+    }
+
+    if (GPA_DATA_TYPE_UINT64 == dataType)
+    {
+        return SpecializeEquationOfType<gpa_uint64>(pExpression, pHwInfo, specializedExpression);
+    }
+
+    return false;
+}
@@ -0,0 +1,52 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Derived counter equations specialized for the device of a context
+//==============================================================================
+
+#ifndef _GPA_SPECIALIZED_COUNTER_EQUATIONS_H_
+#define _GPA_SPECIALIZED_COUNTER_EQUATIONS_H_
+
+#include <string>
+#include <vector>
+
+#include "gpu_perf_api_types.h"
+
+class GPA_HWInfo;           // forward declaration
+class IGPACounterAccessor;  // forward declaration
+
+/// The equations of the public counters of a context, with the device constants folded in.
+///
+/// The device constants (num_shader_engines, num_simds, num_cus, su_clocks_prim, num_prim_pipes, TS_FREQ...) do not change
+/// while a context is open, so they are substituted with their values once, when the counters of the context are generated.
+/// The sub-expressions whose operands are all constant are then folded, a conditional whose condition is constant is
+/// replaced with the selected operand, and for floating point counters a chain of multiplications and divisions by
+/// constants (such as "TS_FREQ,/,(1000000000),*") is collapsed into a single scaling.
+/// The result is an equation in the same RPN format, which references the same internal counters as the original one.
+class GPA_SpecializedCounterEquations
+{
+public:
+    /// Specializes the equations of all the public counters of a counter accessor
+    /// \param[in] pCounterAccessor the counter accessor of the context
+    /// \param[in] pHwInfo the hardware info of the context
+    void Specialize(const IGPACounterAccessor* pCounterAccessor, const GPA_HWInfo* pHwInfo);
+
+    /// Gets the specialized equation of a public counter
+    /// \param[in] publicCounterIndex the index of the public counter
+    /// \return the specialized equation, or nullptr if the equation of the counter could not be specialized
+    const char* GetEquation(gpa_uint32 publicCounterIndex) const;
+
+    /// Specializes a derived counter equation for a device
+    /// \param[in] pExpression the counter formula (in the RPN format used by GPA_DerivedCounter)
+    /// \param[in] dataType the data type of the counter result
+    /// \param[in] pHwInfo the hardware info used to resolve the device constants
+    /// \param[out] specializedExpression the specialized formula
+    /// \return true if the formula was specialized, false if it is invalid
+    static bool SpecializeEquation(const char* pExpression, GPA_Data_Type dataType, const GPA_HWInfo* pHwInfo, std::string& specializedExpression);
+
+private:
+    std::vector<std::string> m_equations;  ///< specialized equation of each public counter, empty if it could not be specialized
+};
+
+#endif  // _GPA_SPECIALIZED_COUNTER_EQUATIONS_H_
@@ -58,6 +58,12 @@ GpaCounterContext::GpaCounterContext(const GPA_API_Type&         api_type,
     gpa_hw_info_.SetRevisionID(revision_id);
 }
 
+GpaCounterContext::~GpaCounterContext()
+{
+    delete gpa_counter_scheduler_;
+    gpa_counter_scheduler_ = nullptr;
+}
+
 bool GpaCounterContext::InitCounters()
 {
     if (!initialized_)
@@ -27,6 +27,9 @@ public:
                       const GPA_OpenContextFlags& context_flags,
                       const gpa_uint8&            generate_asic_specific_counters);
 
+    /// Destructor
+    ~GpaCounterContext();
+
     /// Initializes the counter for the context
     /// \return true upon success otherwise false
     bool InitCounters();
@@ -51,7 +54,7 @@ private:
     GPA_OpenContextFlags  gpa_open_context_flags_;      ///< context flags
     bool                  initialized_;                 ///< flag indicating context initialization status
     IGPACounterAccessor*  gpa_counter_accessor_;        ///< context counter accessor
-    IGPACounterScheduler* gpa_counter_scheduler_;       ///< context counter scheduler
+    IGPACounterScheduler* gpa_counter_scheduler_;       ///< context counter scheduler, owned by the context
 };
 
 /// _GPA_CounterContext struct
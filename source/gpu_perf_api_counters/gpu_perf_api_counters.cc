@@ -327,6 +327,35 @@ GPU_PERF_API_COUNTERS_DECL GPA_Status GpaCounterLib_GetCounterUuid(const GPA_Cou
     return GPA_STATUS_ERROR_FAILED;
 }
 
+GPU_PERF_API_COUNTERS_DECL GPA_Status GpaCounterLib_GetCounterIndexByUuid(const GPA_CounterContext gpa_virtual_context,
+                                                                          const GPA_UUID*          gpa_counter_uuid,
+                                                                          gpa_uint32*              gpa_counter_index)
+{
+    if (nullptr == gpa_virtual_context || nullptr == gpa_counter_uuid || nullptr == gpa_counter_index)
+    {
+        return GPA_STATUS_ERROR_NULL_POINTER;
+    }
+
+    if (!GpaCounterContextManager::Instance()->IsCounterContextOpen(gpa_virtual_context))
+    {
+        return GPA_STATUS_ERROR_CONTEXT_NOT_OPEN;
+    }
+
+    const IGPACounterAccessor* counter_accessor = GpaCounterContextManager::Instance()->GetCounterAccessor(gpa_virtual_context);
+
+    if (nullptr != counter_accessor)
+    {
+        if (counter_accessor->GetCounterIndexByUuid(*gpa_counter_uuid, gpa_counter_index))
+        {
+            return GPA_STATUS_OK;
+        }
+
+        return GPA_STATUS_ERROR_COUNTER_NOT_FOUND;
+    }
+
+    return GPA_STATUS_ERROR_FAILED;
+}
+
 GPU_PERF_API_COUNTERS_DECL GPA_Status GpaCounterLib_GetCounterSampleType(const GPA_CounterContext gpa_virtual_context,
                                                                          gpa_uint32               gpa_counter_index,
                                                                          GPA_Counter_Sample_Type* gpa_counter_sample_type)
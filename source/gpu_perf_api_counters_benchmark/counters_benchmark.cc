@@ -0,0 +1,634 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Microbenchmarks for the hot paths of the counter library and of the sample index
+//==============================================================================
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+#include "gpu_perf_api_counters.h"
+#include "gpa_hw_info.h"
+#include "gpa_sample_index.h"
+
+#ifdef _WIN32
+/// Name of the counter library
+static const char* s_pCountersLibName = "GPUPerfAPICounters" AMDT_PLATFORM_SUFFIX AMDT_DEBUG_SUFFIX AMDT_BUILD_SUFFIX ".dll";
+#else
+/// Name of the counter library
+static const char* s_pCountersLibName = "libGPUPerfAPICounters" AMDT_PLATFORM_SUFFIX AMDT_DEBUG_SUFFIX AMDT_BUILD_SUFFIX ".so";
+#endif
+
+/// An API whose counters are measured
+struct BenchmarkApi
+{
+    GPA_API_Type m_api;    ///< the API
+    const char*  m_pName;  ///< name of the API in the benchmark names
+};
+
+/// A hardware generation whose counters are measured
+struct BenchmarkGeneration
+{
+    gpa_uint32  m_deviceId;  ///< device id of a GPU of the generation
+    const char* m_pName;     ///< name of the generation in the benchmark names
+};
+
+/// The APIs whose counters are measured; the APIs which are not built into the counter library are skipped
+static const BenchmarkApi s_apis[] = {{GPA_API_OPENGL, "GL"},
+                                      {GPA_API_OPENCL, "CL"},
+                                      {GPA_API_VULKAN, "VK"},
+                                      {GPA_API_DIRECTX_11, "DX11"},
+                                      {GPA_API_DIRECTX_12, "DX12"}};
+
+/// The hardware generations whose counters are measured
+static const BenchmarkGeneration s_generations[] = {{0x67DF, "Gfx8"}, {0x6863, "Gfx9"}, {0x7310, "Gfx10"}};
+
+/// A layout of client sample ids whose lookup is measured
+struct SampleIdLayout
+{
+    const char* m_pName;     ///< name of the layout in the benchmark names
+    gpa_uint32  m_firstId;   ///< the first sample id
+    gpa_uint32  m_idStride;  ///< the difference between consecutive sample ids
+};
+
+/// The sample id layouts: sequential ids, sequential ids which do not start at 0, and ids too far apart for the dense storage of the index
+static const SampleIdLayout s_sampleIdLayouts[] = {{"Dense", 0, 1}, {"Offset", 0x10000000, 1}, {"Sparse", 0, 7919}};
+
+/// Number of samples indexed by the sample index benchmarks
+static const gpa_uint32 s_numIndexedSamples = 4096;
+
+/// An object indexed by the sample index benchmarks
+struct IndexedSample
+{
+    gpa_uint32 m_sampleId;  ///< the sample id of the object
+};
+
+/// Result of a benchmark
+struct BenchmarkResult
+{
+    std::string m_name;        ///< name of the benchmark, <operation>/<API>/<generation>
+    gpa_uint64  m_iterations;  ///< number of times the operation was executed
+    double      m_nsPerOp;     ///< average time of the operation
+};
+
+/// Runs an operation repeatedly, for at least the minimum duration
+/// \param[in] name the name of the benchmark
+/// \param[in] minDurationMs the minimum duration of the benchmark
+/// \param[in] operation function executing the operation one or more times, returns the number of executions
+/// \param[in,out] results the benchmark results, the result of this benchmark is appended
+template <class Operation>
+static void RunBenchmark(const std::string& name, gpa_uint32 minDurationMs, Operation operation, std::vector<BenchmarkResult>& results)
+{
+    const std::chrono::steady_clock::duration minDuration = std::chrono::milliseconds(minDurationMs);
+
+    gpa_uint64                            iterations = 0;
+    std::chrono::steady_clock::time_point start      = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::duration   elapsed    = std::chrono::steady_clock::duration::zero();
+
+    do
+    {
+        iterations += operation();
+        elapsed = std::chrono::steady_clock::now() - start;
+    } while (elapsed < minDuration);
+
+    BenchmarkResult result;
+    result.m_name       = name;
+    result.m_iterations = iterations;
+    result.m_nsPerOp    = std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(iterations);
+    results.push_back(result);
+
+    std::cout << name << ": " << result.m_nsPerOp << " ns (" << iterations << " iterations)" << std::endl;
+}
+
+/// Gets a deterministic, non-trivial value for a hardware counter result
+/// \param[in] resultIndex the index of the result
+/// \return the value of the result
+static gpa_uint64 GetHardwareCounterValue(gpa_uint32 resultIndex)
+{
+    return 1000 + (static_cast<gpa_uint64>(resultIndex) * 2654435761u) % 100003u;
+}
+
+/// Gets the number of hardware counter results needed to compute a derived counter
+/// \param[in] funcTable the counter library function table
+/// \param[in] counterContext the counter context
+/// \param[in] counterIndex the index of the derived counter
+/// \param[out] resultCount the number of hardware counter results
+/// \return true if the number of results could be determined
+static bool GetHardwareResultCount(const GpaCounterLibFuncTable& funcTable, GPA_CounterContext counterContext, gpa_uint32 counterIndex, gpa_uint32& resultCount)
+{
+    const GpaDerivedCounterInfo* pCounterInfo = nullptr;
+
+    if (GPA_STATUS_OK == funcTable.GpaCounterLib_GetDerivedCounterInfo(counterContext, counterIndex, &pCounterInfo) && !pCounterInfo->is_gpu_time)
+    {
+        resultCount = pCounterInfo->gpa_hw_counter_count;
+        return true;
+    }
+
+    // the info of the timing counters does not include their number of results, so find the count the library accepts
+    static const gpa_uint32 s_maxTimingResults = 8;
+    gpa_uint64              values[s_maxTimingResults];
+    gpa_float64             derivedResult = 0.0;
+
+    for (gpa_uint32 valueIndex = 0; valueIndex < s_maxTimingResults; ++valueIndex)
+    {
+        values[valueIndex] = GetHardwareCounterValue(valueIndex);
+    }
+
+    for (resultCount = 1; resultCount <= s_maxTimingResults; ++resultCount)
+    {
+        if (GPA_STATUS_OK == funcTable.GpaCounterLib_ComputeDerivedCounterResult(counterContext, counterIndex, values, resultCount, &derivedResult))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/// Runs the benchmarks of the counters of one API and generation
+/// \param[in] funcTable the counter library function table
+/// \param[in] api the API
+/// \param[in] generation the hardware generation
+/// \param[in] minDurationMs the minimum duration of each benchmark
+/// \param[in,out] results the benchmark results
+static void RunCounterBenchmarks(const GpaCounterLibFuncTable&  funcTable,
+                                 const BenchmarkApi&            api,
+                                 const BenchmarkGeneration&     generation,
+                                 gpa_uint32                     minDurationMs,
+                                 std::vector<BenchmarkResult>&  results)
+{
+    const std::string suffix = std::string("/") + api.m_pName + "/" + generation.m_pName;
+
+    // the first context generates the counters, later contexts may reuse them
+    GPA_CounterContext counterContext = nullptr;
+    auto               coldStart      = std::chrono::steady_clock::now();
+    GPA_Status         status         = funcTable.GpaCounterLib_OpenCounterContext(
+        api.m_api, AMD_VENDOR_ID, generation.m_deviceId, REVISION_ID_ANY, GPA_OPENCONTEXT_DEFAULT_BIT, false, &counterContext);
+
+    if (GPA_STATUS_OK != status)
+    {
+        std::cout << "Skipping " << api.m_pName << "/" << generation.m_pName << ": GpaCounterLib_OpenCounterContext returned " << status << std::endl;
+        return;
+    }
+
+    BenchmarkResult coldResult;
+    coldResult.m_name       = "OpenCounterContextCold" + suffix;
+    coldResult.m_iterations = 1;
+    coldResult.m_nsPerOp    = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - coldStart).count();
+    results.push_back(coldResult);
+    std::cout << coldResult.m_name << ": " << coldResult.m_nsPerOp << " ns" << std::endl;
+
+    RunBenchmark("OpenCounterContext" + suffix,
+                 minDurationMs,
+                 [&]() {
+                     GPA_CounterContext warmContext = nullptr;
+                     funcTable.GpaCounterLib_OpenCounterContext(
+                         api.m_api, AMD_VENDOR_ID, generation.m_deviceId, REVISION_ID_ANY, GPA_OPENCONTEXT_DEFAULT_BIT, false, &warmContext);
+                     funcTable.GpaCounterLib_CloseCounterContext(warmContext);
+                     return 1;
+                 },
+                 results);
+
+    gpa_uint32 numCounters = 0;
+    funcTable.GpaCounterLib_GetNumCounters(counterContext, &numCounters);
+
+    std::vector<const char*>                       counterNames(numCounters, nullptr);
+    std::vector<gpa_uint32>                        allCounters;
+    std::map<std::string, std::vector<gpa_uint32>> groupCounters;
+
+    for (gpa_uint32 counterIndex = 0; counterIndex < numCounters; ++counterIndex)
+    {
+        const char* pGroup = nullptr;
+        funcTable.GpaCounterLib_GetCounterName(counterContext, counterIndex, &counterNames[counterIndex]);
+        funcTable.GpaCounterLib_GetCounterGroup(counterContext, counterIndex, &pGroup);
+        allCounters.push_back(counterIndex);
+        groupCounters[nullptr != pGroup ? pGroup : ""].push_back(counterIndex);
+    }
+
+    RunBenchmark("GetCounterIndex" + suffix,
+                 minDurationMs,
+                 [&]() {
+                     GpaCounterParam counterParam;
+                     counterParam.is_derived_counter = true;
+
+                     for (gpa_uint32 counterIndex = 0; counterIndex < numCounters; ++counterIndex)
+                     {
+                         gpa_uint32 foundIndex             = 0;
+                         counterParam.derived_counter_name = counterNames[counterIndex];
+                         funcTable.GpaCounterLib_GetCounterIndex(counterContext, &counterParam, &foundIndex);
+                     }
+
+                     return numCounters;
+                 },
+                 results);
+
+    gpa_uint32 numPasses = 0;
+
+    RunBenchmark("GetPassCountAll" + suffix,
+                 minDurationMs,
+                 [&]() {
+                     funcTable.GpaCounterLib_GetPassCount(counterContext, allCounters.data(), numCounters, &numPasses);
+                     return 1;
+                 },
+                 results);
+
+    RunBenchmark("GetPassCountGroup" + suffix,
+                 minDurationMs,
+                 [&]() {
+                     for (auto groupIter = groupCounters.cbegin(); groupIter != groupCounters.cend(); ++groupIter)
+                     {
+                         funcTable.GpaCounterLib_GetPassCount(
+                             counterContext, groupIter->second.data(), static_cast<gpa_uint32>(groupIter->second.size()), &numPasses);
+                     }
+
+                     return static_cast<gpa_uint32>(groupCounters.size());
+                 },
+                 results);
+
+    RunBenchmark("GetPassCountSingle" + suffix,
+                 minDurationMs,
+                 [&]() {
+                     for (gpa_uint32 counterIndex = 0; counterIndex < numCounters; ++counterIndex)
+                     {
+                         funcTable.GpaCounterLib_GetPassCount(counterContext, &counterIndex, 1, &numPasses);
+                     }
+
+                     return numCounters;
+                 },
+                 results);
+
+    std::vector<gpa_uint32>              derivedCounters;
+    std::vector<std::vector<gpa_uint64>> hardwareResults;
+
+    for (gpa_uint32 counterIndex = 0; counterIndex < numCounters; ++counterIndex)
+    {
+        gpa_uint32 resultCount = 0;
+
+        if (GetHardwareResultCount(funcTable, counterContext, counterIndex, resultCount))
+        {
+            std::vector<gpa_uint64> values;
+
+            for (gpa_uint32 valueIndex = 0; valueIndex < resultCount; ++valueIndex)
+            {
+                values.push_back(GetHardwareCounterValue(counterIndex + valueIndex));
+            }
+
+            derivedCounters.push_back(counterIndex);
+            hardwareResults.push_back(values);
+        }
+        else
+        {
+            std::cout << "Counter " << counterNames[counterIndex] << " can not be computed and is excluded from ComputeDerivedCounterResult" << std::endl;
+        }
+    }
+
+    if (!derivedCounters.empty())
+    {
+        RunBenchmark("ComputeDerivedCounterResult" + suffix,
+                     minDurationMs,
+                     [&]() {
+                         gpa_float64 derivedResult = 0.0;
+
+                         for (size_t derivedIndex = 0; derivedIndex < derivedCounters.size(); ++derivedIndex)
+                         {
+                             funcTable.GpaCounterLib_ComputeDerivedCounterResult(counterContext,
+                                                                                 derivedCounters[derivedIndex],
+                                                                                 hardwareResults[derivedIndex].data(),
+                                                                                 static_cast<gpa_uint32>(hardwareResults[derivedIndex].size()),
+                                                                                 &derivedResult);
+                         }
+
+                         return static_cast<gpa_uint32>(derivedCounters.size());
+                     },
+                     results);
+    }
+
+    funcTable.GpaCounterLib_CloseCounterContext(counterContext);
+}
+
+/// Runs the benchmarks of the lookup of sample ids in GPASampleIndex and in std::unordered_map, which it replaces, for one layout of the ids
+/// \param[in] layout the layout of the sample ids
+/// \param[in] minDurationMs the minimum duration of each benchmark
+/// \param[in,out] results the benchmark results
+/// \return true if both containers found the indexed objects, otherwise false
+static bool RunSampleIndexBenchmarks(const SampleIdLayout& layout, gpa_uint32 minDurationMs, std::vector<BenchmarkResult>& results)
+{
+    std::vector<IndexedSample>                     samples(s_numIndexedSamples);
+    GPASampleIndex<IndexedSample>                  sampleIndex;
+    std::unordered_map<gpa_uint32, IndexedSample*> sampleMap;
+    gpa_uint64                                     expectedChecksum = 0;
+
+    for (gpa_uint32 sampleIndexInLayout = 0; sampleIndexInLayout < s_numIndexedSamples; ++sampleIndexInLayout)
+    {
+        IndexedSample& sample = samples[sampleIndexInLayout];
+        sample.m_sampleId     = layout.m_firstId + sampleIndexInLayout * layout.m_idStride;
+        sampleIndex.Insert(sample.m_sampleId, &sample);
+        sampleMap.insert(std::make_pair(sample.m_sampleId, &sample));
+        expectedChecksum += sample.m_sampleId;
+    }
+
+    std::cout << "Sample ids " << layout.m_pName << ": the index uses " << (sampleIndex.IsDense() ? "dense" : "hash map") << " storage" << std::endl;
+
+    // every round looks up all of the samples; a round whose checksum differs found the wrong objects
+    gpa_uint32 numFailedRounds = 0;
+
+    RunBenchmark(std::string("SampleIndexFind/") + layout.m_pName,
+                 minDurationMs,
+                 [&]() {
+                     gpa_uint64 checksum = 0;
+
+                     for (const IndexedSample& sample : samples)
+                     {
+                         IndexedSample* pFoundSample = sampleIndex.Find(sample.m_sampleId);
+                         checksum += nullptr != pFoundSample ? pFoundSample->m_sampleId : 0;
+                     }
+
+                     numFailedRounds += expectedChecksum != checksum ? 1 : 0;
+                     return s_numIndexedSamples;
+                 },
+                 results);
+
+    RunBenchmark(std::string("UnorderedMapFind/") + layout.m_pName,
+                 minDurationMs,
+                 [&]() {
+                     gpa_uint64 checksum = 0;
+
+                     for (const IndexedSample& sample : samples)
+                     {
+                         auto sampleIter = sampleMap.find(sample.m_sampleId);
+                         checksum += sampleMap.end() != sampleIter ? sampleIter->second->m_sampleId : 0;
+                     }
+
+                     numFailedRounds += expectedChecksum != checksum ? 1 : 0;
+                     return s_numIndexedSamples;
+                 },
+                 results);
+
+    if (0 != numFailedRounds)
+    {
+        std::cerr << "Sample ids " << layout.m_pName << ": " << numFailedRounds << " rounds of lookups did not find the indexed objects" << std::endl;
+    }
+
+    return 0 == numFailedRounds;
+}
+
+/// Writes the benchmark results as JSON
+/// \param[in] results the benchmark results
+/// \param[out] stream the stream to write to
+static void WriteResults(const std::vector<BenchmarkResult>& results, std::ostream& stream)
+{
+    stream << "{" << std::endl << "    \"benchmarks\": [" << std::endl;
+
+    for (size_t resultIndex = 0; resultIndex < results.size(); ++resultIndex)
+    {
+        const BenchmarkResult& result = results[resultIndex];
+        stream << "        {\"name\": \"" << result.m_name << "\", \"iterations\": " << result.m_iterations << ", \"ns_per_op\": " << result.m_nsPerOp << "}"
+               << (resultIndex + 1 < results.size() ? "," : "") << std::endl;
+    }
+
+    stream << "    ]" << std::endl << "}" << std::endl;
+}
+
+/// Reads the baseline times from a JSON file written by this benchmark, or written by hand in the same format.
+/// A baseline name ending in '*' applies to all of the benchmarks whose name starts with the text before the '*'.
+/// A "tolerance_percent" value sets the percentage by which a result may exceed its baseline time.
+/// \param[in] pFileName the name of the baseline file
+/// \param[out] baseline the baseline time of each benchmark name
+/// \param[in,out] tolerance the fraction by which a result may exceed its baseline, left unchanged if the file does not set it
+/// \return true if the file could be read
+static bool ReadBaseline(const char* pFileName, std::map<std::string, double>& baseline, double& tolerance)
+{
+    std::ifstream file(pFileName);
+
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    std::stringstream contents;
+    contents << file.rdbuf();
+    const std::string text = contents.str();
+
+    static const std::string s_nameKey      = "\"name\"";
+    static const std::string s_timeKey      = "\"ns_per_op\"";
+    static const std::string s_toleranceKey = "\"tolerance_percent\"";
+
+    size_t tolerancePos = text.find(s_toleranceKey);
+
+    if (std::string::npos != tolerancePos)
+    {
+        tolerance = strtod(text.c_str() + text.find(':', tolerancePos) + 1, nullptr) / 100.0;
+    }
+
+    for (size_t namePos = text.find(s_nameKey); std::string::npos != namePos; namePos = text.find(s_nameKey, namePos + 1))
+    {
+        size_t nameStart = text.find('"', text.find(':', namePos + s_nameKey.size()));
+        size_t nameEnd   = text.find('"', nameStart + 1);
+        size_t timePos   = text.find(s_timeKey, nameEnd);
+        size_t entryEnd  = text.find('}', nameEnd);
+
+        if (std::string::npos == nameStart || std::string::npos == nameEnd || std::string::npos == timePos || timePos > entryEnd)
+        {
+            return false;
+        }
+
+        baseline[text.substr(nameStart + 1, nameEnd - nameStart - 1)] = strtod(text.c_str() + text.find(':', timePos) + 1, nullptr);
+    }
+
+    return true;
+}
+
+/// Compares the benchmark results against the baseline
+/// \param[in] results the benchmark results
+/// \param[in] baseline the baseline time of each benchmark name
+/// \param[in] tolerance the fraction by which a result may exceed its baseline
+/// \return the number of results which exceed their baseline
+static gpa_uint32 CompareWithBaseline(const std::vector<BenchmarkResult>& results, const std::map<std::string, double>& baseline, double tolerance)
+{
+    gpa_uint32 numRegressions = 0;
+
+    for (auto resultIter = results.cbegin(); resultIter != results.cend(); ++resultIter)
+    {
+        // an exact name takes precedence over the longest matching wildcard
+        auto   baselineIter = baseline.find(resultIter->m_name);
+        size_t matchLength  = 0;
+
+        if (baseline.cend() == baselineIter)
+        {
+            for (auto wildcardIter = baseline.cbegin(); wildcardIter != baseline.cend(); ++wildcardIter)
+            {
+                const std::string& pattern = wildcardIter->first;
+
+                if (!pattern.empty() && '*' == pattern.back() && pattern.size() - 1 >= matchLength &&
+                    0 == resultIter->m_name.compare(0, pattern.size() - 1, pattern, 0, pattern.size() - 1))
+                {
+                    baselineIter = wildcardIter;
+                    matchLength  = pattern.size() - 1;
+                }
+            }
+        }
+
+        if (baseline.cend() != baselineIter && resultIter->m_nsPerOp > baselineIter->second * (1.0 + tolerance))
+        {
+            std::cerr << "Regression: " << resultIter->m_name << " takes " << resultIter->m_nsPerOp << " ns, baseline " << baselineIter->first << " is "
+                      << baselineIter->second << " ns" << std::endl;
+            ++numRegressions;
+        }
+    }
+
+    return numRegressions;
+}
+
+/// Prints the usage of the benchmark
+/// \param[in] pExecutable the name of the executable
+static void PrintUsage(const char* pExecutable)
+{
+    std::cout << "Usage: " << pExecutable << " [options]" << std::endl
+              << "  --output <file>        write the results as JSON to the file" << std::endl
+              << "  --baseline <file>      fail if a result exceeds its time in the baseline JSON file" << std::endl
+              << "  --tolerance <percent>  percentage by which a result may exceed its baseline (default: the tolerance_percent of the baseline, or 25)" << std::endl
+              << "  --min-time-ms <n>      minimum duration of each benchmark (default 200)" << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    const char* pOutputFile   = nullptr;
+    const char* pBaselineFile = nullptr;
+    double      tolerance     = -1.0;  // negative unless set on the command line
+    gpa_uint32  minDurationMs = 200;
+
+    for (int argIndex = 1; argIndex + 1 < argc; argIndex += 2)
+    {
+        const char* pArg   = argv[argIndex];
+        const char* pValue = argv[argIndex + 1];
+
+        if (0 == strcmp(pArg, "--output"))
+        {
+            pOutputFile = pValue;
+        }
+        else if (0 == strcmp(pArg, "--baseline"))
+        {
+            pBaselineFile = pValue;
+        }
+        else if (0 == strcmp(pArg, "--tolerance"))
+        {
+            tolerance = strtod(pValue, nullptr) / 100.0;
+        }
+        else if (0 == strcmp(pArg, "--min-time-ms"))
+        {
+            minDurationMs = static_cast<gpa_uint32>(strtoul(pValue, nullptr, 10));
+        }
+        else
+        {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (0 == argc % 2)
+    {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+#ifdef _WIN32
+    HMODULE libHandle = LoadLibraryA(s_pCountersLibName);
+#else
+    void* libHandle = dlopen(s_pCountersLibName, RTLD_NOW);
+#endif
+
+    if (nullptr == libHandle)
+    {
+        std::cerr << "Unable to load " << s_pCountersLibName << std::endl;
+        return 1;
+    }
+
+#ifdef _WIN32
+    GpaCounterLib_GetFuncTablePtrType pGetFuncTable = reinterpret_cast<GpaCounterLib_GetFuncTablePtrType>(GetProcAddress(libHandle, "GpaCounterLib_GetFuncTable"));
+#else
+    GpaCounterLib_GetFuncTablePtrType pGetFuncTable = reinterpret_cast<GpaCounterLib_GetFuncTablePtrType>(dlsym(libHandle, "GpaCounterLib_GetFuncTable"));
+#endif
+
+    GpaCounterLibFuncTable funcTable;
+
+    if (nullptr == pGetFuncTable || GPA_STATUS_OK != pGetFuncTable(&funcTable))
+    {
+        std::cerr << "Unable to get the function table of " << s_pCountersLibName << std::endl;
+        return 1;
+    }
+
+    std::vector<BenchmarkResult> results;
+
+    for (const BenchmarkApi& api : s_apis)
+    {
+        for (const BenchmarkGeneration& generation : s_generations)
+        {
+            RunCounterBenchmarks(funcTable, api, generation, minDurationMs, results);
+        }
+    }
+
+    int exitCode = 0;
+
+    for (const SampleIdLayout& layout : s_sampleIdLayouts)
+    {
+        if (!RunSampleIndexBenchmarks(layout, minDurationMs, results))
+        {
+            exitCode = 1;
+        }
+    }
+
+    if (nullptr != pOutputFile)
+    {
+        std::ofstream outputFile(pOutputFile);
+        WriteResults(results, outputFile);
+
+        if (!outputFile.good())
+        {
+            std::cerr << "Unable to write " << pOutputFile << std::endl;
+            exitCode = 1;
+        }
+    }
+    else
+    {
+        WriteResults(results, std::cout);
+    }
+
+    if (nullptr != pBaselineFile)
+    {
+        std::map<std::string, double> baseline;
+        double                        baselineTolerance = 0.25;
+
+        if (!ReadBaseline(pBaselineFile, baseline, baselineTolerance))
+        {
+            std::cerr << "Unable to read the baseline " << pBaselineFile << std::endl;
+            exitCode = 1;
+        }
+        else if (0 != CompareWithBaseline(results, baseline, 0.0 > tolerance ? baselineTolerance : tolerance))
+        {
+            exitCode = 1;
+        }
+    }
+
+#ifdef _WIN32
+    FreeLibrary(libHandle);
+#else
+    dlclose(libHandle);
+#endif
+
+    return exitCode;
+}
@@ -16,11 +16,27 @@ GLGPAContext::GLGPAContext(GLContextPtr context, GPA_HWInfo& pHwInfo, GPA_OpenCo
     , m_glContext(context)
     , m_clockMode(oglUtils::AMDX_DefaultMode)
     , m_driverVersion(driverVersion)
+    , m_numPooledPerfMonitors(0)
+    , m_glPerfMonitorMemory(GPA_MEMORY_CATEGORY_BACKEND, 0)
+    , m_glCounterMemory(GPA_MEMORY_CATEGORY_BACKEND, 0)
 {
 }
 
 GLGPAContext::~GLGPAContext()
 {
+    for (auto poolIter = m_glPerfMonitorPool.begin(); poolIter != m_glPerfMonitorPool.end(); ++poolIter)
+    {
+        if (!poolIter->second.empty())
+        {
+            oglUtils::_oglDeletePerfMonitorsAMD(static_cast<GLsizei>(poolIter->second.size()), poolIter->second.data());
+            oglUtils::CheckForGLError("Unable to delete AMD PerfMonitor GL extension.");
+        }
+    }
+
+    m_glPerfMonitorPool.clear();
+    m_numPooledPerfMonitors = 0;
+    UpdatePerfMonitorPoolMemory_NotThreadSafe();
+
     GPA_Status setStableClocksStatus = SetStableClocks(false);
 
     if (GPA_STATUS_OK != setStableClocksStatus)
@@ -187,6 +203,132 @@ GPA_Status GLGPAContext::SetStableClocks(bool useProfilingClocks)
     return result;
 }
 
+bool GLGPAContext::GetGLCounter(CounterIndex counterIndex, GLCounter& glCounter)
+{
+    std::lock_guard<std::mutex> lock(m_glCounterMutex);
+
+    GLCounterMap::const_iterator glCounterIter = m_glCounters.find(counterIndex);
+
+    if (m_glCounters.cend() != glCounterIter)
+    {
+        glCounter = glCounterIter->second;
+        return true;
+    }
+
+    IGPACounterAccessor*              pCounterAccessor  = GPAContextCounterMediator::Instance()->GetCounterAccessor(this);
+    const GPA_HardwareCounters*       pHardwareCounters = pCounterAccessor->GetHardwareCounters();
+    const GPA_HardwareCounterDescExt* pCounter          = pCounterAccessor->GetHardwareCounterExt(counterIndex);
+
+    unsigned int uGroupIndex = pCounter->m_groupIndex;
+
+    GLint nCounters = 0;
+
+    if (uGroupIndex < pHardwareCounters->m_groupCount)
+    {
+        nCounters = static_cast<GLint>(pHardwareCounters->m_pGroups[uGroupIndex].m_numCounters);
+    }
+    else
+    {
+        nCounters = static_cast<GLint>(pHardwareCounters->m_pAdditionalGroups[uGroupIndex - pHardwareCounters->m_groupCount].m_numCounters);
+    }
+
+    assert(pCounter->m_pHardwareCounter->m_counterIndexInGroup <= static_cast<unsigned int>(nCounters));
+
+    // validate Counter result type
+    GLuint resultType = 0;
+    oglUtils::_oglGetPerfMonitorCounterInfoAMD(
+        pCounter->m_groupIdDriver, static_cast<GLuint>(pCounter->m_pHardwareCounter->m_counterIndexInGroup), GL_COUNTER_TYPE_AMD, &resultType);
+
+    if (oglUtils::CheckForGLError("glGetPerfMonitorCounterInfoAMD failed to get the counter type."))
+    {
+        // the counter is not cached, so that the failure is reported for every pass that uses it
+        char groupName[256];
+        char counterName[256];
+        memset(groupName, 0, 256);
+        memset(counterName, 0, 256);
+        GLsizei nLength = 0;
+
+        if (uGroupIndex <= (pHardwareCounters->m_groupCount + pHardwareCounters->m_additionalGroupCount))
+        {
+            oglUtils::_oglGetPerfMonitorGroupStringAMD(pCounter->m_groupIdDriver, 256, &nLength, groupName);
+
+            if (oglUtils::CheckForGLError("glGetPerfMonitorGroupStringAMD failed to get the group name."))
+            {
+                return false;
+            }
+        }
+
+        if (pCounter->m_pHardwareCounter->m_counterIndexInGroup <= static_cast<unsigned int>(nCounters))
+        {
+            oglUtils::_oglGetPerfMonitorCounterStringAMD(
+                pCounter->m_groupIdDriver, static_cast<GLuint>(pCounter->m_pHardwareCounter->m_counterIndexInGroup), 256, &nLength, counterName);
+
+            oglUtils::CheckForGLError("glGetPerfMonitorCounterStringAMD failed to get the counter name.");
+        }
+
+        std::stringstream error;
+        error << "Unable to get the type of counter '" << counterName << "' in group '" << groupName << "'.";
+        GPA_LogError(error.str().c_str());
+        return false;
+    }
+
+    glCounter.m_counterType  = resultType;
+    glCounter.m_counterID    = counterIndex;
+    glCounter.m_counterGroup = pCounter->m_groupIdDriver;
+    glCounter.m_counterIndex = static_cast<GLuint>(pCounter->m_pHardwareCounter->m_counterIndexInGroup);
+    m_glCounters.insert(std::make_pair(counterIndex, glCounter));
+    m_glCounterMemory.SetBytes(GPANodeContainerBytes(m_glCounters));
+
+    return true;
+}
+
+bool GLGPAContext::AcquirePerfMonitor(const CounterList& counterSelection, GLPerfMonitorId& glPerfMonitorId)
+{
+    std::lock_guard<std::mutex> lock(m_glPerfMonitorMutex);
+
+    GLPerfMonitorPool::iterator poolIter = m_glPerfMonitorPool.find(counterSelection);
+
+    if (m_glPerfMonitorPool.end() == poolIter || poolIter->second.empty())
+    {
+        return false;
+    }
+
+    glPerfMonitorId = poolIter->second.back();
+    poolIter->second.pop_back();
+    --m_numPooledPerfMonitors;
+    UpdatePerfMonitorPoolMemory_NotThreadSafe();
+
+    return true;
+}
+
+void GLGPAContext::ReleasePerfMonitor(const CounterList& counterSelection, GLPerfMonitorId glPerfMonitorId)
+{
+    std::lock_guard<std::mutex> lock(m_glPerfMonitorMutex);
+
+    if (MAX_POOLED_PERF_MONITORS <= m_numPooledPerfMonitors)
+    {
+        oglUtils::_oglDeletePerfMonitorsAMD(1, &glPerfMonitorId);
+        oglUtils::CheckForGLError("Unable to delete AMD PerfMonitor GL extension.");
+        return;
+    }
+
+    m_glPerfMonitorPool[counterSelection].push_back(glPerfMonitorId);
+    ++m_numPooledPerfMonitors;
+    UpdatePerfMonitorPoolMemory_NotThreadSafe();
+}
+
+void GLGPAContext::UpdatePerfMonitorPoolMemory_NotThreadSafe()
+{
+    size_t bytes = GPANodeContainerBytes(m_glPerfMonitorPool);
+
+    for (auto poolIter = m_glPerfMonitorPool.cbegin(); poolIter != m_glPerfMonitorPool.cend(); ++poolIter)
+    {
+        bytes += GPAContainerBytes(poolIter->first) + GPAContainerBytes(poolIter->second);
+    }
+
+    m_glPerfMonitorMemory.SetBytes(bytes);
+}
+
 bool GLGPAContext::ValidateAndUpdateGLCounters() const
 {
     bool              success    = false;
@@ -8,11 +8,17 @@
 #ifndef _GL_GPA_CONTEXT_H_
 #define _GL_GPA_CONTEXT_H_
 
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 #include "gl_entry_points.h"
 #include "gl_amd_driver_ext.h"
 
 // GPA Common
 #include "gpa_context.h"
+#include "gpa_pass.h"
 
 #ifndef GLES
 #ifdef _WIN32
@@ -24,6 +30,30 @@ using GLContextPtr = GLXContext;  ///< type alias for GL Context
 using GLContextPtr = EGLContext;  ///< type alias for GL Context
 #endif  // GLES
 
+using GLPerfMonitorId = GLuint;  ///< type alias for GL perf monitor id
+
+/// GLCounter Struct
+/// structure used to store data that is needed to retrieve and store the
+/// results for a counter.
+struct GLCounter
+{
+    /// Initializes a new instance of the GLCounter class
+    GLCounter()
+    {
+        m_counterID            = 0;
+        m_counterType          = 0;
+        m_counterGroup         = 0;
+        m_counterIndex         = 0;
+        m_isCounterResultReady = false;
+    }
+
+    GLuint m_counterID;             ///< ID that is calculated in the CounterDefinition files
+    GLenum m_counterType;           ///< data type that GL specifies the result will be
+    GLuint m_counterGroup;          ///< group that this counter is in
+    GLuint m_counterIndex;          ///< index to this counter within its group
+    bool   m_isCounterResultReady;  ///< indicates whether the result has been stored in the pCounterResult buffer
+};
+
 /// Class for OpenGL GPA Context
 class GLGPAContext : public GPAContext
 {
@@ -61,14 +91,50 @@ public:
     /// \copydoc IGPAContext::SetStableClocks()
     GPA_Status SetStableClocks(bool useProfilingClocks) override;
 
+    /// Gets the driver's description of a hardware counter.
+    /// The driver is only queried the first time a counter is requested in the context.
+    /// \param[in] counterIndex the index of the hardware counter
+    /// \param[out] glCounter the driver's description of the counter
+    /// \return true if the counter can be enabled in the driver otherwise false
+    bool GetGLCounter(CounterIndex counterIndex, GLCounter& glCounter);
+
+    /// Takes an idle perf monitor with the given counter selection out of the monitor pool of the context
+    /// \param[in] counterSelection the hardware counters selected on the monitor
+    /// \param[out] glPerfMonitorId the pooled perf monitor
+    /// \return true if a pooled perf monitor was available otherwise false
+    bool AcquirePerfMonitor(const CounterList& counterSelection, GLPerfMonitorId& glPerfMonitorId);
+
+    /// Returns an idle perf monitor to the monitor pool of the context, so that it can be reused by a later pass
+    /// with the same counter selection. The monitor is deleted instead if the pool is full.
+    /// \param[in] counterSelection the hardware counters selected on the monitor
+    /// \param[in] glPerfMonitorId the perf monitor
+    void ReleasePerfMonitor(const CounterList& counterSelection, GLPerfMonitorId glPerfMonitorId);
+
 private:
+    /// Maximum number of idle perf monitors kept in the pool of the context
+    static const size_t MAX_POOLED_PERF_MONITORS = 64;
+
+    using GLCounterMap      = std::unordered_map<CounterIndex, GLCounter>;          ///< type alias for the map of hardware counter index to driver counter description
+    using GLPerfMonitorPool = std::map<CounterList, std::vector<GLPerfMonitorId>>;  ///< type alias for the idle perf monitors of each counter selection
+
     /// Validates the counter from counter generator and gl driver counters and updates it if necessary
     /// \return true upon successful operation otherwise false
     bool ValidateAndUpdateGLCounters() const;
 
-    GLContextPtr            m_glContext;      ///< GL rendering context pointer
-    oglUtils::AMDXClockMode m_clockMode;      ///< GPU Clock mode
-    int                     m_driverVersion;  ///< GL driver version
+    /// Updates the accounting of the memory held by the perf monitor pool
+    /// Does NOT lock the mutex, expects the calling method to do that.
+    void UpdatePerfMonitorPoolMemory_NotThreadSafe();
+
+    GLContextPtr            m_glContext;              ///< GL rendering context pointer
+    oglUtils::AMDXClockMode m_clockMode;              ///< GPU Clock mode
+    int                     m_driverVersion;          ///< GL driver version
+    std::mutex              m_glCounterMutex;         ///< mutex for the driver counter descriptions
+    GLCounterMap            m_glCounters;             ///< driver counter descriptions which have been queried in the context
+    std::mutex              m_glPerfMonitorMutex;     ///< mutex for the perf monitor pool
+    GLPerfMonitorPool       m_glPerfMonitorPool;      ///< idle perf monitors, by counter selection
+    size_t                  m_numPooledPerfMonitors;  ///< number of perf monitors in the pool
+    GPATrackedMemory        m_glPerfMonitorMemory;    ///< accounting of the memory held by the perf monitor pool
+    GPATrackedMemory        m_glCounterMemory;        ///< accounting of the memory held by the driver counter descriptions
 };
 
 #endif  // _CL_GPA_CONTEXT_H_
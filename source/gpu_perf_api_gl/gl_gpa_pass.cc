@@ -8,20 +8,22 @@
 #include "gl_gpa_pass.h"
 #include "gl_gpa_command_list.h"
 #include "gl_gpa_sample.h"
-#include "gpa_hardware_counters.h"
-#include "gpa_context_counter_mediator.h"
 
 GLGPAPass::GLGPAPass(IGPASession* pGpaSession, PassIndex passIndex, GPACounterSource counterSource, CounterList* pPassCounters)
     : GPAPass(pGpaSession, passIndex, counterSource, pPassCounters)
+    , m_pGLGpaContext(reinterpret_cast<GLGPAContext*>(pGpaSession->GetParentContext()))
+    , m_isCounterInfoInitialized(false)
+    , m_areCountersValid(false)
 {
     EnableAllCountersForPass();
 }
 
 GLGPAPass::~GLGPAPass()
 {
-    for (auto iter = m_glPerfMonitorInfoList.begin(); iter != m_glPerfMonitorInfoList.end(); ++iter)
+    // hand the monitors over to the context, so that a later session with the same counters does not need to create them again
+    for (auto perfMonitorIter = m_glPerfMonitors.cbegin(); perfMonitorIter != m_glPerfMonitors.cend(); ++perfMonitorIter)
     {
-        iter->second.Clear(true);
+        m_pGLGpaContext->ReleasePerfMonitor(m_counterSelection, *perfMonitorIter);
     }
 }
 
@@ -72,57 +74,48 @@ bool GLGPAPass::EndSample(IGPACommandList* pCmdList)
     return retVal;
 }
 
-bool GLGPAPass::GetPerfMonitor(GLPerfMonitorId& glPerfMonitorId)
+void GLGPAPass::ResetSamples()
 {
-    bool success              = false;
-    bool perfMonitorAvailable = false;
+    GPAPass::ResetSamples();
 
-    GLPerfMonitor glPerfMonitorFound;
+    // none of the samples which used the monitors exist anymore
+    std::lock_guard<std::mutex> lock(m_glPerfMonitorMutex);
+    m_idleGlPerfMonitors = m_glPerfMonitors;
+}
 
-    if (!m_glPerfMonitorInfoList.empty())
+bool GLGPAPass::GetPerfMonitor(GLPerfMonitorId& glPerfMonitorId)
+{
+    std::lock_guard<std::mutex> lock(m_glPerfMonitorMutex);
+
+    if (!InitializeCounters_NotThreadSafe())
     {
-        for (auto perfMonitorListConstIter = m_glPerfMonitorInfoList.cbegin(); perfMonitorListConstIter != m_glPerfMonitorInfoList.cend();
-             ++perfMonitorListConstIter)
-        {
-            if (perfMonitorListConstIter->second.IsDataCollected())
-            {
-                perfMonitorAvailable = true;
-                glPerfMonitorFound   = perfMonitorListConstIter->second;
-                success              = true;
-                break;
-            }
-        }
+        return false;
     }
 
-    if (!perfMonitorAvailable)
+    if (!m_idleGlPerfMonitors.empty())
     {
-        GLPerfMonitor newPerfMonitor;
-
-        if (newPerfMonitor.Initialize())
-        {
-            GLPerfMonitorId newPerfMonitorId = newPerfMonitor.GetPerfMonitorId();
-
-            if (InitializeCounters(newPerfMonitorId))
-            {
-                m_glPerfMonitorInfoList.insert(std::pair<GLPerfMonitorId, GLPerfMonitor>(newPerfMonitorId, newPerfMonitor));
-                success            = true;
-                glPerfMonitorFound = newPerfMonitor;
-            }
-        }
+        glPerfMonitorId = m_idleGlPerfMonitors.back();
+        m_idleGlPerfMonitors.pop_back();
+        return true;
     }
 
-    if (success)
+    GLPerfMonitorId newPerfMonitorId = 0u;
+
+    // a pooled monitor already has the counters of the pass selected
+    if (!m_pGLGpaContext->AcquirePerfMonitor(m_counterSelection, newPerfMonitorId) && !CreatePerfMonitor(newPerfMonitorId))
     {
-        glPerfMonitorId = glPerfMonitorFound.GetPerfMonitorId();
-        glPerfMonitorFound.AddRef();
+        return false;
     }
 
-    return success;
+    m_glPerfMonitors.push_back(newPerfMonitorId);
+    glPerfMonitorId = newPerfMonitorId;
+    return true;
 }
 
 void GLGPAPass::MarkDataCollected(const GLPerfMonitorId glPerfMonitorId)
 {
-    m_glPerfMonitorInfoList.at(glPerfMonitorId).Release();
+    std::lock_guard<std::mutex> lock(m_glPerfMonitorMutex);
+    m_idleGlPerfMonitors.push_back(glPerfMonitorId);
 }
 
 const GLCounter* GLGPAPass::GetGLCounter(const GLuint& counterGroup, const GLuint& counterIndex, unsigned int& indexOfCounterWithinPass) const
@@ -151,135 +144,58 @@ const GLCounter* GLGPAPass::GetGLCounter(const GLuint& counterGroup, const GLuin
     return pRetGlCounter;
 }
 
-bool GLGPAPass::InitializeCounters(const GLPerfMonitorId& glPerfMonitorId)
+bool GLGPAPass::InitializeCounters_NotThreadSafe()
 {
-    bool isSuccessful = true;
-
-    auto EnableCounter = [&](const CounterIndex& counterIndex) -> bool {
-        bool isCounterEnabled = false;
-        // need to Enable counters
-        IGPACounterAccessor*              pCounterAccessor  = GPAContextCounterMediator::Instance()->GetCounterAccessor(GetGpaSession()->GetParentContext());
-        const GPA_HardwareCounters*       pHardwareCounters = pCounterAccessor->GetHardwareCounters();
-        const GPA_HardwareCounterDescExt* pCounter          = pCounterAccessor->GetHardwareCounterExt(counterIndex);
-
-        unsigned int uGroupIndex = pCounter->m_groupIndex;
-
-        GLint nCounters = 0;
-
-        if (uGroupIndex < pHardwareCounters->m_groupCount)
-        {
-            nCounters = static_cast<GLint>(pHardwareCounters->m_pGroups[uGroupIndex].m_numCounters);
-        }
-        else
-        {
-            nCounters = static_cast<GLint>(pHardwareCounters->m_pAdditionalGroups[uGroupIndex - pHardwareCounters->m_groupCount].m_numCounters);
-        }
+    if (m_isCounterInfoInitialized)
+    {
+        return m_areCountersValid;
+    }
 
-        assert(pCounter->m_pHardwareCounter->m_counterIndexInGroup <= static_cast<unsigned int>(nCounters));
+    bool isSuccessful = true;
 
-        // validate Counter result type
-        GLuint resultType = 0;
-        oglUtils::_oglGetPerfMonitorCounterInfoAMD(
-            pCounter->m_groupIdDriver, static_cast<GLuint>(pCounter->m_pHardwareCounter->m_counterIndexInGroup), GL_COUNTER_TYPE_AMD, &resultType);
+    auto AddCounter = [&](const CounterIndex& counterIndex) -> bool {
+        GLCounter glCounter;
+        bool      isCounterValid = m_pGLGpaContext->GetGLCounter(counterIndex, glCounter);
 
-        if (!oglUtils::CheckForGLError("glGetPerfMonitorCounterInfoAMD failed to get the counter type."))
-        {
-            oglUtils::_oglSelectPerfMonitorCountersAMD(
-                glPerfMonitorId, GL_TRUE, pCounter->m_groupIdDriver, 1, reinterpret_cast<GLuint*>(&pCounter->m_pHardwareCounter->m_counterIndexInGroup));
+        isSuccessful &= isCounterValid;
 
-            if (!oglUtils::CheckForGLError("Unable to enable counter in GL driver."))
-            {
-                isCounterEnabled = true;
-            }
-        }
-        else
+        if (isCounterValid)
         {
-            char groupName[256];
-            char counterName[256];
-            memset(groupName, 0, 256);
-            memset(counterName, 0, 256);
-            GLsizei nLength = 0;
-
-            if (uGroupIndex <= (pHardwareCounters->m_groupCount + pHardwareCounters->m_additionalGroupCount))
-            {
-                oglUtils::_oglGetPerfMonitorGroupStringAMD(pCounter->m_groupIdDriver, 256, &nLength, groupName);
-
-                if (oglUtils::CheckForGLError("glGetPerfMonitorGroupStringAMD failed to get the group name."))
-                {
-                    return false;
-                }
-            }
-
-            if (pCounter->m_pHardwareCounter->m_counterIndexInGroup <= static_cast<unsigned int>(nCounters))
-            {
-                oglUtils::_oglGetPerfMonitorCounterStringAMD(
-                    pCounter->m_groupIdDriver, static_cast<GLuint>(pCounter->m_pHardwareCounter->m_counterIndexInGroup), 256, &nLength, counterName);
-
-                oglUtils::CheckForGLError("glGetPerfMonitorCounterStringAMD failed to get the counter name.");
-            }
-        }
-
-        isSuccessful &= isCounterEnabled;
-
-        if (isCounterEnabled)
-        {
-            GLCounter glCounter;
-            glCounter.m_counterType  = resultType;
-            glCounter.m_counterID    = counterIndex;
-            glCounter.m_counterGroup = pCounter->m_groupIdDriver;
-            glCounter.m_counterIndex = static_cast<GLuint>(pCounter->m_pHardwareCounter->m_counterIndexInGroup);
+            m_counterSelection.push_back(counterIndex);
             m_glCounterList.push_back(glCounter);
         }
 
-        return isCounterEnabled;
+        return isCounterValid;
     };
 
-    IterateEnabledCounterList(EnableCounter);
+    IterateEnabledCounterList(AddCounter);
 
+    m_isCounterInfoInitialized = true;
+    m_areCountersValid         = isSuccessful;
     return isSuccessful;
 }
 
-GLGPAPass::GLPerfMonitor::GLPerfMonitor()
-    : m_glPerfMonitorId(0u)
-    , m_refCount(0u)
-{
-}
-
-bool GLGPAPass::GLPerfMonitor::Initialize()
+bool GLGPAPass::CreatePerfMonitor(GLPerfMonitorId& glPerfMonitorId) const
 {
     // Create perf monitor
-    oglUtils::_oglGenPerfMonitorsAMD(1, &m_glPerfMonitorId);
-    return !oglUtils::CheckForGLError("Unable to create AMD PerfMonitor GL extension.");
-}
+    oglUtils::_oglGenPerfMonitorsAMD(1, &glPerfMonitorId);
 
-GLPerfMonitorId GLGPAPass::GLPerfMonitor::GetPerfMonitorId() const
-{
-    return m_glPerfMonitorId;
-}
-
-bool GLGPAPass::GLPerfMonitor::IsDataCollected() const
-{
-    // Even count will have no pending results
-    return (m_refCount % 2 == 0);
-}
-
-unsigned int GLGPAPass::GLPerfMonitor::AddRef()
-{
-    return ++m_refCount;
-}
-
-unsigned int GLGPAPass::GLPerfMonitor::Release()
-{
-    return --m_refCount;
-}
-
-bool GLGPAPass::GLPerfMonitor::Clear(bool forceClear)
-{
-    if (!forceClear && m_refCount != 0)
+    if (oglUtils::CheckForGLError("Unable to create AMD PerfMonitor GL extension."))
     {
         return false;
     }
 
-    oglUtils::_oglDeletePerfMonitorsAMD(1, &m_glPerfMonitorId);
-    return !oglUtils::CheckForGLError("Unable to delete AMD PerfMonitor GL extension.");
+    for (auto glCounterIter = m_glCounterList.cbegin(); glCounterIter != m_glCounterList.cend(); ++glCounterIter)
+    {
+        GLuint counterIndexInGroup = glCounterIter->m_counterIndex;
+        oglUtils::_oglSelectPerfMonitorCountersAMD(glPerfMonitorId, GL_TRUE, glCounterIter->m_counterGroup, 1, &counterIndexInGroup);
+
+        if (oglUtils::CheckForGLError("Unable to enable counter in GL driver."))
+        {
+            oglUtils::_oglDeletePerfMonitorsAMD(1, &glPerfMonitorId);
+            return false;
+        }
+    }
+
+    return true;
 }
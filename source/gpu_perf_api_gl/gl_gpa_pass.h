@@ -12,30 +12,7 @@
 #include "gpa_pass.h"
 #include "gpa_command_list_interface.h"
 #include "gl_entry_points.h"
-
-using GLPerfMonitorId = GLuint;  ///< type alias for GL perf monitor id
-
-/// GLCounter Struct
-/// structure used to store data that is needed to retrieve and store the
-/// results for a counter.
-struct GLCounter
-{
-    /// Initializes a new instance of the GLCounter class
-    GLCounter()
-    {
-        m_counterID            = 0;
-        m_counterType          = 0;
-        m_counterGroup         = 0;
-        m_counterIndex         = 0;
-        m_isCounterResultReady = false;
-    }
-
-    GLuint m_counterID;             ///< ID that is calculated in the CounterDefinition files
-    GLenum m_counterType;           ///< data type that GL specifies the result will be
-    GLuint m_counterGroup;          ///< group that this counter is in
-    GLuint m_counterIndex;          ///< index to this counter within its group
-    bool   m_isCounterResultReady;  ///< indicates whether the result has been stored in the pCounterResult buffer
-};
+#include "gl_gpa_context.h"
 
 /// Class for OpenGL gpa pass
 class GLGPAPass : public GPAPass
@@ -63,12 +40,16 @@ public:
     /// \copydoc GPAPass::EndSample
     bool EndSample(IGPACommandList* pCmdList) override final;
 
-    /// Returns the GL performance monitor, it may return if cached monitor is available otherwise returns by creating one.
-    /// \param[out] glPerfMonitorId cached/new performance moniotr Id
+    /// \copydoc GPAPass::ResetSamples
+    void ResetSamples() override final;
+
+    /// Returns an idle GL performance monitor with the counters of the pass selected.
+    /// The monitor is taken from the idle monitors of the pass, then from the monitor pool of the context, and only created if neither has one.
+    /// \param[out] glPerfMonitorId cached/new performance monitor Id
     /// \return true upon successful operation otherwise false
     bool GetPerfMonitor(GLPerfMonitorId& glPerfMonitorId);
 
-    /// Marks the data for the passed performance moniotr to be collected and it can be used as for cache
+    /// Marks the data for the passed performance monitor as collected, so that the monitor can be used by another sample
     /// \param[in] glPerfMonitorId performance monitor Id
     void MarkDataCollected(const GLPerfMonitorId glPerfMonitorId);
 
@@ -80,53 +61,24 @@ public:
     const GLCounter* GetGLCounter(const GLuint& counterGroup, const GLuint& counterIndex, unsigned int& indexOfCounterWithinPass) const;
 
 private:
-    /// Intializes the counter info for the passed performance Id
-    /// \param[in] glPerfMonitorId performance monitor Id
+    /// Initializes the counter info of the pass from the driver counter descriptions cached in the context.
+    /// Only the first call does any work, as the counters of a pass do not change.
+    /// \return true if all counters of the pass can be enabled in the driver otherwise false
+    bool InitializeCounters_NotThreadSafe();
+
+    /// Creates a performance monitor and selects the counters of the pass on it
+    /// \param[out] glPerfMonitorId the new performance monitor Id
     /// \return true upon successful operation otherwise false
-    bool InitializeCounters(const GLPerfMonitorId& glPerfMonitorId);
-
-    /// Class for handling perf monitor
-    class GLPerfMonitor
-    {
-    public:
-        /// Constructor
-        GLPerfMonitor();
-
-        /// Initializes the perf monitor id
-        /// \return true upon successful operation otherwise false
-        bool Initialize();
-
-        /// Returns the perf monitor Id
-        /// \return GL perf monitor Id
-        GLPerfMonitorId GetPerfMonitorId() const;
-
-        /// Checks whether or not the data has been collected from the monitor
-        /// \return true upon successful operation otherwise false
-        bool IsDataCollected() const;
-
-        /// Adds/increments the reference of the monitor
-        /// \return value of the monitor reference after adding
-        unsigned int AddRef();
-
-        /// Release/decrements the reference of the monitor
-        /// \return value of the reference after releasing
-        unsigned int Release();
-
-        /// Deletes the performance monitor in the driver if it's not being used
-        /// \param[in] forceClear flag indicating whether the monitor needs to be deleted even if it's data is not populated
-        /// \return true upon successful operation otherwise false
-        bool Clear(bool forceClear = false);
-
-        /// Destructor
-        ~GLPerfMonitor() = default;
-
-    private:
-        GLPerfMonitorId m_glPerfMonitorId;  ///< Perf Monitor Id
-        unsigned int    m_refCount;         ///< reference count
-    };
-
-    std::map<GLPerfMonitorId, GLPerfMonitor> m_glPerfMonitorInfoList;  ///< Map of perf monitor Id and GLPerfMonitor
-    mutable std::vector<GLCounter>           m_glCounterList;          ///< List of counters in the pass
+    bool CreatePerfMonitor(GLPerfMonitorId& glPerfMonitorId) const;
+
+    GLGPAContext*                m_pGLGpaContext;             ///< the GL context of the pass, which owns the perf monitor pool
+    std::mutex                   m_glPerfMonitorMutex;        ///< mutex for the perf monitors and counter info of the pass
+    bool                         m_isCounterInfoInitialized;  ///< flag indicating whether the counter info of the pass has been initialized
+    bool                         m_areCountersValid;          ///< flag indicating whether all counters of the pass can be enabled in the driver
+    CounterList                  m_counterSelection;          ///< hardware counters selected on the perf monitors of the pass, the key of the monitor pool
+    std::vector<GLPerfMonitorId> m_glPerfMonitors;            ///< all perf monitors used by the pass
+    std::vector<GLPerfMonitorId> m_idleGlPerfMonitors;        ///< perf monitors of the pass which are not used by any uncollected sample
+    std::vector<GLCounter>       m_glCounterList;             ///< List of counters in the pass
 };
 
 #endif  // _GL_GPA_PASS_H_
@@ -58,6 +58,12 @@ bool GLGPASample::UpdateResults()
 
         if (isDataCollected)
         {
+            if (!m_pGlGpaPass->IsTimingPass())
+            {
+                // the results have been copied out of the monitor, so it can be reused by another sample
+                m_pGlGpaPass->MarkDataCollected(m_sampleDataBuffer.m_glPerfMonitorId);
+            }
+
             MarkAsCompleted();
         }
     }
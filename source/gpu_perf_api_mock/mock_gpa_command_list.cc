@@ -0,0 +1,40 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief Mock GPA Command List Implementation
+//==============================================================================
+
+#include "mock_gpa_command_list.h"
+
+MockGPACommandList::MockGPACommandList(IGPASession* pGpaSession, GPAPass* pGpaPass, CommandListId commandListId)
+    : GPACommandList(pGpaSession, pGpaPass, commandListId)
+{
+}
+
+GPA_API_Type MockGPACommandList::GetAPIType() const
+{
+    return GPA_API_OPENCL;
+}
+
+bool MockGPACommandList::BeginCommandListRequest()
+{
+    return true;
+}
+
+bool MockGPACommandList::EndCommandListRequest()
+{
+    return true;
+}
+
+bool MockGPACommandList::BeginSampleRequest(ClientSampleId clientSampleId, GPASample* pGpaSample)
+{
+    UNREFERENCED_PARAMETER(clientSampleId);
+    UNREFERENCED_PARAMETER(pGpaSample);
+    return true;
+}
+
+bool MockGPACommandList::CloseLastSampleRequest()
+{
+    return true;
+}
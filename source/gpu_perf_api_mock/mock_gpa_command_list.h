@@ -0,0 +1,47 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief Mock GPA Command List Declarations
+//==============================================================================
+
+#ifndef _MOCK_GPA_COMMAND_LIST_H_
+#define _MOCK_GPA_COMMAND_LIST_H_
+
+// GPA Common
+#include "gpa_command_list.h"
+
+/// Class for mock GPA Command List
+class MockGPACommandList : public GPACommandList
+{
+public:
+    /// Constructor
+    /// \param[in] pGpaSession GPA session pointer
+    /// \param[in] pGpaPass pass object pointer
+    /// \param[in] commandListId command list id
+    MockGPACommandList(IGPASession* pGpaSession, GPAPass* pGpaPass, CommandListId commandListId);
+
+    /// Delete Default constructor
+    MockGPACommandList() = delete;
+
+    /// Destructor
+    ~MockGPACommandList() = default;
+
+    /// \copydoc IGPAInterfaceTrait::GetAPIType()
+    GPA_API_Type GetAPIType() const override final;
+
+private:
+    /// \copydoc GPACommandList::BeginCommandListRequest()
+    bool BeginCommandListRequest() override final;
+
+    /// \copydoc GPACommandList::EndCommandListRequest()
+    bool EndCommandListRequest() override final;
+
+    /// \copydoc GPACommandList::BeginSampleRequest()
+    bool BeginSampleRequest(ClientSampleId clientSampleId, GPASample* pGpaSample) override final;
+
+    /// \copydoc GPACommandList::CloseLastSampleRequest()
+    bool CloseLastSampleRequest() override final;
+};
+
+#endif  // _MOCK_GPA_COMMAND_LIST_H_
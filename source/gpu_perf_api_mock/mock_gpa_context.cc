@@ -0,0 +1,97 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Mock GPA Context Implementation
+//==============================================================================
+
+#include "mock_gpa_context.h"
+#include "gpa_unique_object.h"
+#include "mock_gpa_session.h"
+
+MockGPAContext::MockGPAContext(const MockGPADevice& device, GPA_HWInfo& hwInfo, GPA_OpenContextFlags contextFlags)
+    : GPAContext(hwInfo, contextFlags)
+    , m_device(device)
+{
+}
+
+GPA_SessionId MockGPAContext::CreateSession(GPA_Session_Sample_Type sampleType)
+{
+    GPA_SessionId pRetSessionId = nullptr;
+
+    MockGPASession* pNewMockGpaSession = new (std::nothrow) MockGPASession(this, sampleType);
+
+    if (nullptr == pNewMockGpaSession)
+    {
+        GPA_LogError("Unable to allocate memory for the session.");
+    }
+    else
+    {
+        AddGpaSession(pNewMockGpaSession);
+        pRetSessionId = reinterpret_cast<GPA_SessionId>(GPAUniqueObjectManager::Instance()->CreateObject(pNewMockGpaSession));
+    }
+
+    return pRetSessionId;
+}
+
+bool MockGPAContext::DeleteSession(GPA_SessionId sessionId)
+{
+    bool isDeleted = false;
+
+    MockGPASession* pMockSession = reinterpret_cast<MockGPASession*>(sessionId->Object());
+
+    if (nullptr != pMockSession)
+    {
+        RemoveGpaSession(pMockSession);
+        GPAUniqueObjectManager::Instance()->DeleteObject(pMockSession);
+        delete pMockSession;
+        isDeleted = true;
+    }
+
+    return isDeleted;
+}
+
+GPA_Status MockGPAContext::GetSupportedSampleTypes(GPA_ContextSampleTypeFlags* pSampleTypes) const
+{
+    GPA_INTERNAL_CHECK_NULL_PARAM(pSampleTypes);
+
+    // the simulated device also produces streaming counter records and SQTT data, see MockGPASession::AddSimulatedStreamingRecords
+    // and MockGPASession::AddSimulatedSQTTData
+    *pSampleTypes = GPA_CONTEXT_SAMPLE_TYPE_DISCRETE_COUNTER | GPA_CONTEXT_SAMPLE_TYPE_SQTT | GPA_CONTEXT_SAMPLE_TYPE_STREAMING_COUNTER;
+    return GPA_STATUS_OK;
+}
+
+gpa_uint32 MockGPAContext::GetMaxGPASessions() const
+{
+    // same as the OpenCL backend whose counters are exposed
+    return 4;
+}
+
+GPA_API_Type MockGPAContext::GetAPIType() const
+{
+    return GPA_API_OPENCL;
+}
+
+GPA_Status MockGPAContext::SetStableClocks(bool useProfilingClocks)
+{
+    // there are no clocks to change on the simulated device
+    UNREFERENCED_PARAMETER(useProfilingClocks);
+    return GPA_STATUS_OK;
+}
+
+bool MockGPAContext::Initialize()
+{
+    bool success = OpenCounters();
+
+    if (success)
+    {
+        SetAsOpened(true);
+    }
+
+    return success;
+}
+
+const MockGPADevice& MockGPAContext::GetDevice() const
+{
+    return m_device;
+}
@@ -0,0 +1,59 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Mock GPA Context declarations
+//==============================================================================
+
+#ifndef _MOCK_GPA_CONTEXT_H_
+#define _MOCK_GPA_CONTEXT_H_
+
+// GPA Common
+#include "gpa_context.h"
+
+#include "mock_gpa_device.h"
+
+/// Class for mock GPA Context
+class MockGPAContext : public GPAContext
+{
+public:
+    /// Constructor
+    /// \param[in] device the simulated device the context is opened on
+    /// \param[in] hwInfo the hardware info used to create the context
+    /// \param[in] contextFlags the flags used to create the context
+    MockGPAContext(const MockGPADevice& device, GPA_HWInfo& hwInfo, GPA_OpenContextFlags contextFlags);
+
+    /// Destructor
+    ~MockGPAContext() = default;
+
+    /// \copydoc IGPAContext::CreateSession()
+    GPA_SessionId CreateSession(GPA_Session_Sample_Type sampleType) override;
+
+    /// \copydoc IGPAContext::DeleteSession()
+    bool DeleteSession(GPA_SessionId sessionId) override;
+
+    /// \copydoc IGPAContext::GetSupportedSampleTypes()
+    GPA_Status GetSupportedSampleTypes(GPA_ContextSampleTypeFlags* pSampleTypes) const override;
+
+    /// \copydoc IGPAContext::GetMaxGPASessions()
+    gpa_uint32 GetMaxGPASessions() const override;
+
+    /// \copydoc IGPAInterfaceTrait::GetAPIType()
+    GPA_API_Type GetAPIType() const override;
+
+    /// \copydoc IGPAContext::SetStableClocks()
+    GPA_Status SetStableClocks(bool useProfilingClocks) override;
+
+    /// Initializes the mock context
+    /// \return true if initialization is successful otherwise false
+    bool Initialize();
+
+    /// Gets the simulated device of the context
+    /// \return the simulated device of the context
+    const MockGPADevice& GetDevice() const;
+
+private:
+    MockGPADevice m_device;  ///< copy of the simulated device, taken when the context was opened
+};
+
+#endif  // _MOCK_GPA_CONTEXT_H_
@@ -0,0 +1,44 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Description of the simulated device used by the mock GPA backend
+//==============================================================================
+
+#ifndef _MOCK_GPA_DEVICE_H_
+#define _MOCK_GPA_DEVICE_H_
+
+#include <atomic>
+
+#include "gpu_perf_api_types.h"
+
+/// Describes the simulated device on which a mock GPA context is opened.
+///
+/// The mock backend has no API of its own: a pointer to an instance of this structure is passed to
+/// GPA_OpenContext in place of an API context, and identifies the GPA context while it is open.
+/// The backend exposes the OpenCL counters of the simulated device, so it behaves like the OpenCL
+/// backend: command lists are not required and GPA_NULL_COMMAND_LIST is used for each pass.
+struct MockGPADevice
+{
+    /// Device id of a Gfx9 GPU, the default simulated device
+    static const gpa_uint32 DEFAULT_DEVICE_ID = 0x6863;
+
+    /// Revision id which selects the first known revision of the device
+    static const gpa_uint32 ANY_REVISION_ID = 0xFFFFFFFF;
+
+    /// Initializes a new instance of the MockGPADevice structure for the default simulated device
+    MockGPADevice()
+        : m_deviceId(DEFAULT_DEVICE_ID)
+        , m_revisionId(ANY_REVISION_ID)
+        , m_sampleLatencyMicroseconds(0)
+        , m_pNumCreatedPasses(nullptr)
+    {
+    }
+
+    gpa_uint32               m_deviceId;                   ///< device id of the simulated AMD GPU
+    gpa_uint32               m_revisionId;                 ///< revision id of the simulated AMD GPU
+    gpa_uint32               m_sampleLatencyMicroseconds;  ///< time after a sample has been ended until its results are available
+    std::atomic<gpa_uint32>* m_pNumCreatedPasses;          ///< if not null, incremented for each pass created on the device, so that tests can check when passes are reused
+};
+
+#endif  // _MOCK_GPA_DEVICE_H_
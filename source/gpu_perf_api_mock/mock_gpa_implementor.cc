@@ -0,0 +1,109 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief Mock GPA Implementation
+//==============================================================================
+
+#include <assert.h>
+
+#include <DeviceInfoUtils.h>
+
+#include "mock_gpa_implementor.h"
+#include "mock_gpa_context.h"
+#include "mock_gpa_device.h"
+
+#include "gpa_counter_generator_cl.h"
+#include "gpa_counter_scheduler_cl.h"
+
+IGPAImplementor* s_pGpaImp = MockGPAImplementor::Instance();
+static GPA_CounterGeneratorCL s_generatorCL;  ///< static instance of CL generator, the mock backend exposes the OpenCL counters
+static GPA_CounterSchedulerCL s_schedulerCL;  ///< static instance of CL scheduler
+
+GPA_API_Type MockGPAImplementor::GetAPIType() const
+{
+    return GPA_API_OPENCL;
+}
+
+bool MockGPAImplementor::GetHwInfoFromAPI(const GPAContextInfoPtr pContextInfo, GPA_HWInfo& hwInfo) const
+{
+    const MockGPADevice* pDevice = static_cast<const MockGPADevice*>(pContextInfo);
+
+    if (nullptr == pDevice)
+    {
+        GPA_LogError("Mock device is NULL.");
+        return false;
+    }
+
+    hwInfo.SetVendorID(AMD_VENDOR_ID);
+    hwInfo.SetDeviceID(pDevice->m_deviceId);
+    hwInfo.SetRevisionID(MockGPADevice::ANY_REVISION_ID == pDevice->m_revisionId ? REVISION_ID_ANY : pDevice->m_revisionId);
+
+    // fills in the name, generation and shader engine configuration of the simulated device
+    if (!hwInfo.UpdateDeviceInfoBasedOnDeviceID())
+    {
+        GPA_LogError("The device id of the mock device is not a known AMD device.");
+        return false;
+    }
+
+    return true;
+}
+
+bool MockGPAImplementor::VerifyAPIHwSupport(const GPAContextInfoPtr pContextInfo, const GPA_HWInfo& hwInfo) const
+{
+    UNREFERENCED_PARAMETER(pContextInfo);
+
+    GDT_HW_GENERATION generation = GDT_HW_GENERATION_NONE;
+
+    if (!hwInfo.GetHWGeneration(generation))
+    {
+        GPA_LogError("Unable to get hardware generation.");
+        return false;
+    }
+
+    return true;
+}
+
+IGPAContext* MockGPAImplementor::OpenAPIContext(GPAContextInfoPtr pContextInfo, GPA_HWInfo& hwInfo, GPA_OpenContextFlags flags)
+{
+    MockGPAContext* pRetGpaContext = nullptr;
+
+    const MockGPADevice* pDevice = static_cast<const MockGPADevice*>(pContextInfo);
+
+    MockGPAContext* pMockGpaContext = new (std::nothrow) MockGPAContext(*pDevice, hwInfo, flags);
+
+    if (nullptr == pMockGpaContext)
+    {
+        GPA_LogError("Unable to allocate memory for the context.");
+    }
+    else if (pMockGpaContext->Initialize())
+    {
+        pRetGpaContext = pMockGpaContext;
+    }
+    else
+    {
+        delete pMockGpaContext;
+        GPA_LogError("Unable to open a context.");
+    }
+
+    return pRetGpaContext;
+}
+
+bool MockGPAImplementor::CloseAPIContext(GPADeviceIdentifier pDeviceIdentifier, IGPAContext* pContext)
+{
+    assert(nullptr != pDeviceIdentifier);
+    assert(nullptr != pContext);
+
+    if (nullptr != pContext)
+    {
+        delete reinterpret_cast<MockGPAContext*>(pContext);
+        pContext = nullptr;
+    }
+
+    return (nullptr == pContext) && (nullptr != pDeviceIdentifier);
+}
+
+GPADeviceIdentifier MockGPAImplementor::GetDeviceIdentifierFromContextInfo(GPAContextInfoPtr pContextInfo) const
+{
+    return pContextInfo;
+}
@@ -0,0 +1,49 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Mock GPA Implementation declarations
+//==============================================================================
+
+#ifndef _MOCK_GPA_IMPLEMENTOR_H_
+#define _MOCK_GPA_IMPLEMENTOR_H_
+
+// Common
+#include "TSingleton.h"
+
+// GPA Common
+#include "gpa_implementor.h"
+
+/// Class for the mock GPA Implementation, which simulates a device without using a graphics or compute API
+class MockGPAImplementor : public GPAImplementor, public TSingleton<MockGPAImplementor>
+{
+    friend class TSingleton<MockGPAImplementor>;  ///< friend declaration to allow access to the constructor
+
+public:
+    /// Destructor
+    ~MockGPAImplementor() = default;
+
+    /// \copydoc IGPAInterfaceTrait::GetAPIType()
+    GPA_API_Type GetAPIType() const override final;
+
+    /// \copydoc GPAImplementor::GetHwInfoFromAPI
+    bool GetHwInfoFromAPI(const GPAContextInfoPtr pContextInfo, GPA_HWInfo& hwInfo) const override final;
+
+    /// \copydoc GPAImplementor::VerifyAPIHwSupport
+    bool VerifyAPIHwSupport(const GPAContextInfoPtr pContextInfo, const GPA_HWInfo& hwInfo) const override final;
+
+private:
+    /// Constructor
+    MockGPAImplementor() = default;
+
+    /// \copydoc GPAImplementor::OpenAPIContext
+    IGPAContext* OpenAPIContext(GPAContextInfoPtr pContextInfo, GPA_HWInfo& hwInfo, GPA_OpenContextFlags flags) override final;
+
+    /// \copydoc GPAImplementor::CloseAPIContext
+    bool CloseAPIContext(GPADeviceIdentifier pDeviceIdentifier, IGPAContext* pContext) override final;
+
+    /// \copydoc GPAImplementor::GetDeviceIdentifierFromContextInfo()
+    GPADeviceIdentifier GetDeviceIdentifierFromContextInfo(GPAContextInfoPtr pContextInfo) const override final;
+};
+
+#endif  // _MOCK_GPA_IMPLEMENTOR_H_
@@ -0,0 +1,97 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Mock GPA Pass Object Implementation
+//==============================================================================
+
+#include "mock_gpa_pass.h"
+#include "mock_gpa_command_list.h"
+#include "mock_gpa_context.h"
+#include "mock_gpa_sample.h"
+
+MockGPAPass::MockGPAPass(IGPASession* pGpaSession, PassIndex passIndex, GPACounterSource counterSource, CounterList* pPassCounters)
+    : GPAPass(pGpaSession, passIndex, counterSource, pPassCounters)
+{
+    EnableAllCountersForPass();
+
+    const MockGPAContext* pMockGpaContext = reinterpret_cast<const MockGPAContext*>(pGpaSession->GetParentContext());
+    m_sampleLatency                       = std::chrono::microseconds(pMockGpaContext->GetDevice().m_sampleLatencyMicroseconds);
+
+    IterateEnabledCounterList([this](const CounterIndex& counterIndex) -> bool {
+        m_enabledCounters.push_back(counterIndex);
+        return true;
+    });
+}
+
+GPASample* MockGPAPass::CreateAPISpecificSample(IGPACommandList* pCmdList, GpaSampleType sampleType, ClientSampleId sampleId)
+{
+    GPASample* pRetSample = nullptr;
+
+    MockGPASample* pMockGpaSample = new (std::nothrow) MockGPASample(this, pCmdList, sampleType, sampleId);
+
+    if (nullptr == pMockGpaSample)
+    {
+        GPA_LogError("Unable to allocate memory for the sample.");
+    }
+    else
+    {
+        pRetSample = pMockGpaSample;
+    }
+
+    return pRetSample;
+}
+
+bool MockGPAPass::ContinueSample(ClientSampleId srcSampleId, IGPACommandList* pPrimaryGpaCmdList)
+{
+    // continuing samples not supported, as for the OpenCL backend
+    UNREFERENCED_PARAMETER(srcSampleId);
+    UNREFERENCED_PARAMETER(pPrimaryGpaCmdList);
+    return false;
+}
+
+IGPACommandList* MockGPAPass::CreateAPISpecificCommandList(void* pCmd, CommandListId commandListId, GPA_Command_List_Type cmdType)
+{
+    UNREFERENCED_PARAMETER(pCmd);
+    UNREFERENCED_PARAMETER(cmdType);
+
+    MockGPACommandList* pRetCmdList = new (std::nothrow) MockGPACommandList(GetGpaSession(), this, commandListId);
+
+    if (nullptr == pRetCmdList)
+    {
+        GPA_LogError("Unable to allocate memory for the command list.");
+    }
+
+    return pRetCmdList;
+}
+
+bool MockGPAPass::EndSample(IGPACommandList* pCmdList)
+{
+    bool retVal = false;
+
+    if (nullptr != pCmdList)
+    {
+        retVal = pCmdList->CloseLastSample();
+    }
+
+    return retVal;
+}
+
+std::chrono::microseconds MockGPAPass::GetSampleLatency() const
+{
+    return m_sampleLatency;
+}
+
+void MockGPAPass::GetSimulatedResults(ClientSampleId sampleId, gpa_uint64* pResults) const
+{
+    for (size_t counterIter = 0; counterIter < m_enabledCounters.size(); ++counterIter)
+    {
+        // mix the sample id and the counter index, so that every counter of every sample has a different, reproducible value
+        gpa_uint64 value = (static_cast<gpa_uint64>(sampleId) << 32) | m_enabledCounters[counterIter];
+        value ^= value >> 33;
+        value *= 0xFF51AFD7ED558CCDull;
+        value ^= value >> 33;
+
+        pResults[counterIter] = value % 1000000u;
+    }
+}
@@ -0,0 +1,57 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Mock GPA Pass Object Header
+//==============================================================================
+
+#ifndef _MOCK_GPA_PASS_H_
+#define _MOCK_GPA_PASS_H_
+
+#include <chrono>
+
+// GPA Common
+#include "gpa_pass.h"
+#include "gpa_command_list_interface.h"
+
+/// Class for mock gpa pass
+class MockGPAPass : public GPAPass
+{
+public:
+    /// Constructor
+    /// \param[in] pGpaSession GPA session object pointer
+    /// \param[in] passIndex pass index
+    /// \param[in] counterSource counter source
+    /// \param[in] pPassCounters counter list for the pass
+    MockGPAPass(IGPASession* pGpaSession, PassIndex passIndex, GPACounterSource counterSource, CounterList* pPassCounters);
+
+    /// Destructor
+    ~MockGPAPass() = default;
+
+    /// \copydoc GPAPass::CreateAPISpecificSample
+    GPASample* CreateAPISpecificSample(IGPACommandList* pCmdList, GpaSampleType sampleType, ClientSampleId sampleId) override final;
+
+    /// \copydoc GPAPass::ContinueSample
+    bool ContinueSample(ClientSampleId srcSampleId, IGPACommandList* pPrimaryGpaCmdList) override final;
+
+    /// \copydoc GPAPass::CreateAPISpecificCommandList
+    IGPACommandList* CreateAPISpecificCommandList(void* pCmd, CommandListId commandListId, GPA_Command_List_Type cmdType) override final;
+
+    /// \copydoc GPAPass::EndSample
+    bool EndSample(IGPACommandList* pCmdList) override final;
+
+    /// Gets the time a sample has to wait after it has been ended until its results are available
+    /// \return the simulated latency of the samples of the pass
+    std::chrono::microseconds GetSampleLatency() const;
+
+    /// Writes the simulated results of a sample, in the order of the enabled counters of the pass
+    /// \param[in] sampleId the client sample id of the sample
+    /// \param[out] pResults buffer receiving one result per enabled counter of the pass
+    void GetSimulatedResults(ClientSampleId sampleId, gpa_uint64* pResults) const;
+
+private:
+    std::chrono::microseconds m_sampleLatency;    ///< simulated latency of the samples of the pass
+    CounterList               m_enabledCounters;  ///< the enabled counters of the pass, in the order of the sample results
+};
+
+#endif  // _MOCK_GPA_PASS_H_
@@ -0,0 +1,62 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Mock GPA Sample Implementation
+//==============================================================================
+
+#include "mock_gpa_sample.h"
+#include "mock_gpa_pass.h"
+#include "mock_gpa_session.h"
+
+MockGPASample::MockGPASample(MockGPAPass* pPass, IGPACommandList* pCmdList, GpaSampleType sampleType, ClientSampleId sampleId)
+    : GPASample(pPass, pCmdList, sampleType, sampleId)
+    , m_pMockGpaPass(pPass)
+    , m_resultsAvailableTime()
+{
+}
+
+bool MockGPASample::UpdateResults()
+{
+    bool isDataCollected = IsResultCollected();
+
+    if (!isDataCollected && IsClosed())
+    {
+        std::chrono::microseconds latency = m_pMockGpaPass->GetSampleLatency();
+
+        if (0 == latency.count() || std::chrono::steady_clock::now() >= m_resultsAvailableTime)
+        {
+            m_pMockGpaPass->GetSimulatedResults(GetClientSampleId(), GetSampleResultLocation()->GetAsCounterSampleResult()->GetResultBuffer());
+            MarkAsCompleted();
+            isDataCollected = true;
+        }
+    }
+
+    return isDataCollected;
+}
+
+bool MockGPASample::BeginRequest()
+{
+    return true;
+}
+
+bool MockGPASample::EndRequest()
+{
+    // the streaming counters are sampled and the shaders are traced while the sample runs
+    MockGPASession* pMockGpaSession = static_cast<MockGPASession*>(m_pMockGpaPass->GetGpaSession());
+    pMockGpaSession->AddSimulatedStreamingRecords(m_pMockGpaPass, GetClientSampleId());
+    pMockGpaSession->AddSimulatedSQTTData(GetClientSampleId());
+
+    std::chrono::microseconds latency = m_pMockGpaPass->GetSampleLatency();
+
+    if (0 != latency.count())
+    {
+        m_resultsAvailableTime = std::chrono::steady_clock::now() + latency;
+    }
+
+    return true;
+}
+
+void MockGPASample::ReleaseCounters()
+{
+}
@@ -0,0 +1,51 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Mock GPA Sample declarations
+//==============================================================================
+
+#ifndef _MOCK_GPA_SAMPLE_H_
+#define _MOCK_GPA_SAMPLE_H_
+
+#include <chrono>
+
+#include "gpa_sample.h"
+
+class MockGPAPass;
+
+/// Class for mock samples, whose results are synthesized once the simulated latency has passed
+class MockGPASample : public GPASample
+{
+public:
+    /// Constructor
+    /// \param[in] pPass GPA Pass object
+    /// \param[in] pCmdList gpa command list
+    /// \param[in] sampleType gpa sample type
+    /// \param[in] sampleId user-supplied sample id
+    MockGPASample(MockGPAPass* pPass, IGPACommandList* pCmdList, GpaSampleType sampleType, ClientSampleId sampleId);
+
+    /// Delete default constructor
+    MockGPASample() = delete;
+
+    /// Destructor
+    ~MockGPASample() = default;
+
+    /// \copydoc GPASample::UpdateResults
+    bool UpdateResults() override final;
+
+    /// \copydoc GPASample::BeginRequest
+    bool BeginRequest() override final;
+
+    /// \copydoc GPASample::EndRequest
+    bool EndRequest() override final;
+
+    /// \copydoc GPASample::ReleaseCounters
+    void ReleaseCounters() override final;
+
+private:
+    MockGPAPass*                          m_pMockGpaPass;          ///< Cache the GPA pass pointer
+    std::chrono::steady_clock::time_point m_resultsAvailableTime;  ///< time at which the results of the sample become available
+};
+
+#endif  // _MOCK_GPA_SAMPLE_H_
@@ -0,0 +1,124 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief Mock GPA Session Implementation
+//==============================================================================
+
+#include "mock_gpa_session.h"
+#include "mock_gpa_context.h"
+#include "mock_gpa_pass.h"
+
+MockGPASession::MockGPASession(IGPAContext* pParentContext, GPA_Session_Sample_Type sampleType)
+    : GPASession(pParentContext, sampleType)
+    , m_streamingTimestamp(0)
+{
+}
+
+GPA_API_Type MockGPASession::GetAPIType() const
+{
+    return GPA_API_OPENCL;
+}
+
+GPAPass* MockGPASession::CreateAPIPass(PassIndex passIndex)
+{
+    GPAPass* pRetPass = nullptr;
+
+    CounterList*     passCounters  = GetCountersForPass(passIndex);
+    GPACounterSource counterSource = GetParentContext()->GetCounterSource((*passCounters)[0]);
+
+    MockGPAPass* pMockPass = new (std::nothrow) MockGPAPass(this, passIndex, counterSource, passCounters);
+
+    if (nullptr == pMockPass)
+    {
+        GPA_LogError("Unable to allocate memory for the pass.");
+    }
+    else
+    {
+        std::atomic<gpa_uint32>* pNumCreatedPasses = reinterpret_cast<const MockGPAContext*>(GetParentContext())->GetDevice().m_pNumCreatedPasses;
+
+        if (nullptr != pNumCreatedPasses)
+        {
+            ++(*pNumCreatedPasses);
+        }
+
+        pRetPass = pMockPass;
+    }
+
+    return pRetPass;
+}
+
+GPA_Status MockGPASession::End()
+{
+    GPA_Status status = GPASession::End();
+
+    // all the records and SQTT data of the session were added when its samples ended
+    if (GPA_STATUS_OK == status && IsStreamingCounterSession())
+    {
+        GetStreamingCounterStream()->Finish();
+    }
+
+    if (GPA_STATUS_OK == status && IsSQTTSession() && !GetSQTTTraceStore()->Finish())
+    {
+        GPA_LogError("Unable to write the SQTT data of the session.");
+        status = GPA_STATUS_ERROR_FAILED;
+    }
+
+    return status;
+}
+
+void MockGPASession::AddSimulatedStreamingRecords(const MockGPAPass* pPass, ClientSampleId sampleId)
+{
+    if (!IsStreamingCounterSession())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lockProducer(m_streamingProducerMutex);
+
+    GPAStreamingCounterStream* pStream   = GetStreamingCounterStream();
+    gpa_uint32                 numValues = pStream->GetNumValues();
+
+    m_sampleResults.resize(numValues);
+    m_recordValues.resize(numValues);
+    pPass->GetSimulatedResults(sampleId, m_sampleResults.data());
+
+    // the results of the sample are spread evenly over its records, so the sum of its records is the result of the sample
+    for (gpa_uint32 recordIndex = 0; recordIndex < SIMULATED_RECORDS_PER_SAMPLE; ++recordIndex)
+    {
+        for (gpa_uint32 valueIndex = 0; valueIndex < numValues; ++valueIndex)
+        {
+            gpa_uint64 value           = m_sampleResults[valueIndex] / SIMULATED_RECORDS_PER_SAMPLE;
+            m_recordValues[valueIndex] = (SIMULATED_RECORDS_PER_SAMPLE - 1 == recordIndex) ? m_sampleResults[valueIndex] - value * recordIndex : value;
+        }
+
+        pStream->AddRecord(m_streamingTimestamp, m_recordValues.data());
+        m_streamingTimestamp += GetSPMInterval();
+    }
+}
+
+void MockGPASession::AddSimulatedSQTTData(ClientSampleId sampleId)
+{
+    if (!IsSQTTSession())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lockProducer(m_sqttProducerMutex);
+
+    const gpa_uint32 numWords = SIMULATED_SQTT_BYTES_PER_SAMPLE / sizeof(gpa_uint32);
+    m_sqttData.resize(numWords);
+
+    for (gpa_uint32 streamId = 0; streamId < SIMULATED_SQTT_STREAMS; ++streamId)
+    {
+        for (gpa_uint32 wordIndex = 0; wordIndex < numWords; ++wordIndex)
+        {
+            m_sqttData[wordIndex] = (sampleId << 16) | (streamId << 12) | wordIndex;
+        }
+
+        if (!GetSQTTTraceStore()->AddTraceData(streamId, m_sqttData.data(), SIMULATED_SQTT_BYTES_PER_SAMPLE))
+        {
+            GPA_LogError("Unable to add the SQTT data of the sample.");
+        }
+    }
+}
@@ -0,0 +1,70 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief Mock GPA Session declaration
+//==============================================================================
+
+#ifndef _MOCK_GPA_SESSION_H_
+#define _MOCK_GPA_SESSION_H_
+
+#include <mutex>
+#include <vector>
+
+// GPA Common
+#include "gpa_session.h"
+
+class MockGPAPass;
+
+/// Class for mock GPA Session
+class MockGPASession : public GPASession
+{
+public:
+    /// Constructor
+    /// \param[in] pParentContext The context Id on which this session is created
+    /// \param[in] sampleType The sample type that will be created on this session
+    MockGPASession(IGPAContext* pParentContext, GPA_Session_Sample_Type sampleType);
+
+    /// Destructor
+    ~MockGPASession() = default;
+
+    /// \copydoc IGPAInterfaceTrait::GetAPIType()
+    GPA_API_Type GetAPIType() const override;
+
+    /// \copydoc IGPASession::End()
+    GPA_Status End() override;
+
+    /// Adds the streaming counter records sampled while a sample ran, if the session samples streaming counters.
+    /// Each sample spans SIMULATED_RECORDS_PER_SAMPLE sampling intervals, over which its simulated results are spread.
+    /// \param[in] pPass the pass of the sample
+    /// \param[in] sampleId the client sample id of the sample
+    void AddSimulatedStreamingRecords(const MockGPAPass* pPass, ClientSampleId sampleId);
+
+    /// Adds the SQTT data traced while a sample ran, if the session collects SQTT data.
+    /// The data of the sample on each trace stream is SIMULATED_SQTT_BYTES_PER_SAMPLE bytes, holding the 32-bit words
+    /// (sampleId << 16) | (streamId << 12) | wordIndex, so that the client can check where each byte came from.
+    /// \param[in] sampleId the client sample id of the sample
+    void AddSimulatedSQTTData(ClientSampleId sampleId);
+
+    /// Number of streaming counter records added for each sample
+    static const gpa_uint32 SIMULATED_RECORDS_PER_SAMPLE = 4;
+
+    /// Number of SQTT trace streams of the simulated device, one per shader engine
+    static const gpa_uint32 SIMULATED_SQTT_STREAMS = 4;
+
+    /// Number of bytes of SQTT data added to each trace stream for each sample
+    static const gpa_uint32 SIMULATED_SQTT_BYTES_PER_SAMPLE = 16 * 1024;
+
+private:
+    /// \copydoc GPASession::CreateAPIPass()
+    GPAPass* CreateAPIPass(PassIndex passIndex) override;
+
+    std::mutex              m_streamingProducerMutex;  ///< mutex serializing the samples adding records, as the stream has a single producer
+    gpa_uint64              m_streamingTimestamp;      ///< simulated GPU timestamp of the next streaming counter record
+    std::vector<gpa_uint64> m_sampleResults;           ///< reusable storage for the simulated results of a sample
+    std::vector<gpa_uint64> m_recordValues;            ///< reusable storage for the values of a record
+    std::mutex              m_sqttProducerMutex;       ///< mutex serializing the samples adding SQTT data, as the trace store has a single producer
+    std::vector<gpa_uint32> m_sqttData;                ///< reusable storage for the SQTT data of a sample on a trace stream
+};
+
+#endif  // _MOCK_GPA_SESSION_H_
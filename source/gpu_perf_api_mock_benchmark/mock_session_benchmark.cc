@@ -0,0 +1,346 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Measures the CPU overhead of GPA by driving sessions on the mock backend from several threads
+//==============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "gpu_perf_api.h"
+#include "mock_gpa_device.h"
+
+/// Largest number of benchmark threads
+static const gpa_uint32 MAX_THREADS = 64;
+
+/// Options of the benchmark
+struct BenchmarkOptions
+{
+    gpa_uint32 m_numThreads;           ///< number of threads, each profiling its own context
+    gpa_uint32 m_numSamples;           ///< number of samples per session
+    gpa_uint32 m_numCounters;          ///< number of counters to enable, 0 to enable all counters
+    gpa_uint32 m_latencyMicroseconds;  ///< simulated time until the results of a sample are available
+    gpa_uint32 m_blockSize;            ///< number of samples per sample block, 0 to begin and end each sample with GPA_BeginSample/GPA_EndSample
+    double     m_maxNsPerSample;       ///< largest acceptable time per sample and pass, 0 for no limit
+};
+
+/// Time spent in each phase of a session, and the checksum of its results
+struct ThreadResult
+{
+    GPA_Status  m_status;       ///< status of the first failing call, or GPA_STATUS_OK
+    const char* m_pFailedCall;  ///< name of the first failing call
+    gpa_uint32  m_numPasses;    ///< number of passes of the session
+    double      m_setupNs;      ///< time to open the context, create the session and enable the counters
+    double      m_sampleNs;     ///< time to begin and end all of the samples in all of the passes
+    double      m_collectNs;    ///< time until the session is complete, and to read all of the sample results
+    double      m_teardownNs;   ///< time to delete the session and close the context
+    gpa_uint64  m_checksum;     ///< checksum of all of the sample results
+};
+
+/// Checks the status of a GPA call and records the first failure of the thread
+#define BENCHMARK_CALL(result, call)                \
+    {                                               \
+        GPA_Status benchmarkStatus = call;          \
+        if (GPA_STATUS_OK != benchmarkStatus)       \
+        {                                           \
+            result.m_status      = benchmarkStatus; \
+            result.m_pFailedCall = #call;           \
+            return;                                 \
+        }                                           \
+    }
+
+/// Gets the time elapsed since a point in time
+/// \param[in,out] start the point in time, set to now
+/// \return the elapsed time in nanoseconds
+static double GetElapsedNs(std::chrono::steady_clock::time_point& start)
+{
+    std::chrono::steady_clock::time_point now     = std::chrono::steady_clock::now();
+    double                                elapsed = std::chrono::duration<double, std::nano>(now - start).count();
+    start                                         = now;
+    return elapsed;
+}
+
+/// Profiles one session on its own simulated device
+/// \param[in] options the options of the benchmark
+/// \param[in,out] device the simulated device
+/// \param[out] result the timings and the checksum of the session
+static void ProfileSession(const BenchmarkOptions& options, MockGPADevice& device, ThreadResult& result)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    GPA_ContextId contextId   = nullptr;
+    GPA_SessionId sessionId   = nullptr;
+    gpa_uint32    numCounters = 0;
+
+    BENCHMARK_CALL(result, GPA_OpenContext(&device, GPA_OPENCONTEXT_DEFAULT_BIT, &contextId));
+    BENCHMARK_CALL(result, GPA_CreateSession(contextId, GPA_SESSION_SAMPLE_TYPE_DISCRETE_COUNTER, &sessionId));
+    BENCHMARK_CALL(result, GPA_GetNumCounters(contextId, &numCounters));
+
+    if (0 == options.m_numCounters || options.m_numCounters >= numCounters)
+    {
+        BENCHMARK_CALL(result, GPA_EnableAllCounters(sessionId));
+    }
+    else
+    {
+        for (gpa_uint32 counterIndex = 0; counterIndex < options.m_numCounters; ++counterIndex)
+        {
+            BENCHMARK_CALL(result, GPA_EnableCounter(sessionId, counterIndex));
+        }
+    }
+
+    BENCHMARK_CALL(result, GPA_SetSessionMaxSampleIdHint(sessionId, options.m_numSamples - 1));
+    BENCHMARK_CALL(result, GPA_BeginSession(sessionId));
+    BENCHMARK_CALL(result, GPA_GetPassCount(sessionId, &result.m_numPasses));
+    result.m_setupNs = GetElapsedNs(start);
+
+    for (gpa_uint32 passIndex = 0; passIndex < result.m_numPasses; ++passIndex)
+    {
+        GPA_CommandListId commandListId = nullptr;
+        BENCHMARK_CALL(result, GPA_BeginCommandList(sessionId, passIndex, GPA_NULL_COMMAND_LIST, GPA_COMMAND_LIST_NONE, &commandListId));
+
+        if (0 == options.m_blockSize)
+        {
+            for (gpa_uint32 sampleId = 0; sampleId < options.m_numSamples; ++sampleId)
+            {
+                BENCHMARK_CALL(result, GPA_BeginSample(sampleId, commandListId));
+                BENCHMARK_CALL(result, GPA_EndSample(commandListId));
+            }
+        }
+        else
+        {
+            for (gpa_uint32 firstSampleId = 0; firstSampleId < options.m_numSamples; firstSampleId += options.m_blockSize)
+            {
+                gpa_uint32        numBlockSamples = std::min(options.m_blockSize, options.m_numSamples - firstSampleId);
+                GPA_SampleBlockId sampleBlockId   = nullptr;
+                BENCHMARK_CALL(result, GPA_BeginSampleBlock(commandListId, firstSampleId, numBlockSamples, &sampleBlockId));
+
+                for (gpa_uint32 sampleIndex = 0; sampleIndex < numBlockSamples; ++sampleIndex)
+                {
+                    BENCHMARK_CALL(result, GPA_BeginBlockSample(sampleBlockId));
+                    BENCHMARK_CALL(result, GPA_EndBlockSample(sampleBlockId));
+                }
+
+                BENCHMARK_CALL(result, GPA_EndSampleBlock(sampleBlockId));
+            }
+        }
+
+        BENCHMARK_CALL(result, GPA_EndCommandList(commandListId));
+    }
+
+    BENCHMARK_CALL(result, GPA_EndSession(sessionId));
+    result.m_sampleNs = GetElapsedNs(start);
+
+    GPA_Status completeStatus = GPA_STATUS_RESULT_NOT_READY;
+
+    while (GPA_STATUS_RESULT_NOT_READY == completeStatus)
+    {
+        completeStatus = GPA_IsSessionComplete(sessionId);
+    }
+
+    BENCHMARK_CALL(result, completeStatus);
+
+    size_t sampleResultSize = 0;
+    BENCHMARK_CALL(result, GPA_GetSampleResultSize(sessionId, 0, &sampleResultSize));
+
+    std::vector<gpa_uint64> sampleResult(sampleResultSize / sizeof(gpa_uint64));
+
+    for (gpa_uint32 sampleId = 0; sampleId < options.m_numSamples; ++sampleId)
+    {
+        BENCHMARK_CALL(result, GPA_GetSampleResult(sessionId, sampleId, sampleResultSize, sampleResult.data()));
+
+        for (auto valueIter = sampleResult.cbegin(); valueIter != sampleResult.cend(); ++valueIter)
+        {
+            result.m_checksum = result.m_checksum * 31 + *valueIter;
+        }
+    }
+
+    result.m_collectNs = GetElapsedNs(start);
+
+    BENCHMARK_CALL(result, GPA_DeleteSession(sessionId));
+    BENCHMARK_CALL(result, GPA_CloseContext(contextId));
+    result.m_teardownNs = GetElapsedNs(start);
+}
+
+/// Parses an unsigned option value
+/// \param[in] pValue the option value, may be null if the option was the last argument
+/// \param[in] minValue the smallest accepted value
+/// \param[in] maxValue the largest accepted value
+/// \param[out] value the parsed value
+/// \return true if the value is valid
+static bool ParseOption(const char* pValue, gpa_uint32 minValue, gpa_uint32 maxValue, gpa_uint32& value)
+{
+    if (nullptr == pValue)
+    {
+        return false;
+    }
+
+    char*         pEnd        = nullptr;
+    unsigned long parsedValue = strtoul(pValue, &pEnd, 10);
+
+    if ('\0' != *pEnd || parsedValue < minValue || parsedValue > maxValue)
+    {
+        return false;
+    }
+
+    value = static_cast<gpa_uint32>(parsedValue);
+    return true;
+}
+
+/// Prints the usage of the benchmark
+/// \param[in] pExecutable the name of the executable
+static void PrintUsage(const char* pExecutable)
+{
+    std::cout << "Usage: " << pExecutable << " [options]" << std::endl
+              << "  --threads <1-" << MAX_THREADS << ">           number of threads, each with its own context and session (default 1)" << std::endl
+              << "  --samples <n>              number of samples per session (default 10000)" << std::endl
+              << "  --counters <n>             number of counters to enable, 0 for all counters (default 0)" << std::endl
+              << "  --latency-us <n>           simulated time until the results of a sample are available (default 0)" << std::endl
+              << "  --block-size <n>           reserve the samples in blocks of n with GPA_BeginSampleBlock, 0 for GPA_BeginSample (default 0)" << std::endl
+              << "  --max-ns-per-sample <n>    fail if a sample and pass takes longer than this on average (default no limit)" << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    BenchmarkOptions options = {1, 10000, 0, 0, 0, 0.0};
+
+    for (int argIndex = 1; argIndex < argc; ++argIndex)
+    {
+        const char* pArg   = argv[argIndex];
+        const char* pValue = argIndex + 1 < argc ? argv[argIndex + 1] : nullptr;
+        bool        valid  = false;
+
+        if (0 == strcmp(pArg, "--threads"))
+        {
+            valid = ParseOption(pValue, 1, MAX_THREADS, options.m_numThreads);
+        }
+        else if (0 == strcmp(pArg, "--samples"))
+        {
+            valid = ParseOption(pValue, 1, 0x7FFFFFFF, options.m_numSamples);
+        }
+        else if (0 == strcmp(pArg, "--counters"))
+        {
+            valid = ParseOption(pValue, 0, 0x7FFFFFFF, options.m_numCounters);
+        }
+        else if (0 == strcmp(pArg, "--latency-us"))
+        {
+            valid = ParseOption(pValue, 0, 10000000, options.m_latencyMicroseconds);
+        }
+        else if (0 == strcmp(pArg, "--block-size"))
+        {
+            valid = ParseOption(pValue, 0, 0x7FFFFFFF, options.m_blockSize);
+        }
+        else if (0 == strcmp(pArg, "--max-ns-per-sample"))
+        {
+            gpa_uint32 maxNsPerSample = 0;
+            valid                     = ParseOption(pValue, 1, 0x7FFFFFFF, maxNsPerSample);
+            options.m_maxNsPerSample  = maxNsPerSample;
+        }
+
+        if (!valid)
+        {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+
+        ++argIndex;
+    }
+
+    if (GPA_STATUS_OK != GPA_Initialize(GPA_INITIALIZE_DEFAULT_BIT))
+    {
+        std::cerr << "GPA_Initialize failed" << std::endl;
+        return 1;
+    }
+
+    std::vector<MockGPADevice> devices(options.m_numThreads);
+    std::vector<ThreadResult>  results(options.m_numThreads);
+    std::vector<std::thread>   threads;
+
+    for (gpa_uint32 threadIndex = 0; threadIndex < options.m_numThreads; ++threadIndex)
+    {
+        devices[threadIndex].m_sampleLatencyMicroseconds = options.m_latencyMicroseconds;
+        memset(&results[threadIndex], 0, sizeof(ThreadResult));
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for (gpa_uint32 threadIndex = 0; threadIndex < options.m_numThreads; ++threadIndex)
+    {
+        threads.push_back(std::thread(ProfileSession, std::cref(options), std::ref(devices[threadIndex]), std::ref(results[threadIndex])));
+    }
+
+    for (auto threadIter = threads.begin(); threadIter != threads.end(); ++threadIter)
+    {
+        threadIter->join();
+    }
+
+    double totalNs = GetElapsedNs(start);
+
+    GPA_Destroy();
+
+    int exitCode = 0;
+
+    for (gpa_uint32 threadIndex = 0; threadIndex < options.m_numThreads; ++threadIndex)
+    {
+        const ThreadResult& result = results[threadIndex];
+
+        if (GPA_STATUS_OK != result.m_status)
+        {
+            std::cerr << "Thread " << threadIndex << ": " << result.m_pFailedCall << " failed with status " << result.m_status << std::endl;
+            exitCode = 1;
+        }
+        else if (result.m_checksum != results[0].m_checksum || result.m_numPasses != results[0].m_numPasses)
+        {
+            // every thread profiles the same device with the same counters, so the results must be identical
+            std::cerr << "Thread " << threadIndex << ": the sample results differ from the results of thread 0" << std::endl;
+            exitCode = 1;
+        }
+    }
+
+    if (0 != exitCode)
+    {
+        return exitCode;
+    }
+
+    double setupNs    = 0.0;
+    double sampleNs   = 0.0;
+    double collectNs  = 0.0;
+    double teardownNs = 0.0;
+
+    for (auto resultIter = results.cbegin(); resultIter != results.cend(); ++resultIter)
+    {
+        setupNs += resultIter->m_setupNs;
+        sampleNs += resultIter->m_sampleNs;
+        collectNs += resultIter->m_collectNs;
+        teardownNs += resultIter->m_teardownNs;
+    }
+
+    double numSessions     = static_cast<double>(options.m_numThreads);
+    double numSamplePasses = numSessions * options.m_numSamples * results[0].m_numPasses;
+    double nsPerSample     = (sampleNs + collectNs) / numSamplePasses;
+
+    std::cout << "Threads:               " << options.m_numThreads << std::endl
+              << "Samples per session:   " << options.m_numSamples << std::endl
+              << "Passes per session:    " << results[0].m_numPasses << std::endl
+              << "Sample latency:        " << options.m_latencyMicroseconds << " us" << std::endl
+              << "Sample block size:     " << options.m_blockSize << (0 == options.m_blockSize ? " (GPA_BeginSample/GPA_EndSample)" : "") << std::endl
+              << "Session setup:         " << setupNs / numSessions / 1000.0 << " us" << std::endl
+              << "Begin/End sample:      " << sampleNs / numSamplePasses << " ns per sample and pass" << std::endl
+              << "Result collection:     " << collectNs / numSamplePasses << " ns per sample and pass" << std::endl
+              << "Session teardown:      " << teardownNs / numSessions / 1000.0 << " us" << std::endl
+              << "Total:                 " << totalNs / 1000000.0 << " ms" << std::endl
+              << "Result checksum:       " << std::hex << results[0].m_checksum << std::dec << std::endl;
+
+    if (0.0 < options.m_maxNsPerSample && nsPerSample > options.m_maxNsPerSample)
+    {
+        std::cerr << "Average time per sample and pass (" << nsPerSample << " ns) exceeds the limit of " << options.m_maxNsPerSample << " ns" << std::endl;
+        exitCode = 1;
+    }
+
+    return exitCode;
+}
@@ -0,0 +1,168 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Tests of the accumulation of the results of sessions on the mock backend into counter statistics
+//==============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "mock_gpa_test.h"
+
+/// Public counters accumulated by the tests
+static const char* STATISTICS_COUNTER_NAMES[] = {"Wavefronts", "VALUInsts", "VALUBusy", "L2CacheHit"};
+
+/// Number of counters accumulated by the tests
+static const size_t NUM_STATISTICS_COUNTERS = sizeof(STATISTICS_COUNTER_NAMES) / sizeof(STATISTICS_COUNTER_NAMES[0]);
+
+/// Number of samples of each session: the first session has more samples than a batch of GPASession::AccumulateCounterStatistics
+static const gpa_uint32 SESSION_SAMPLE_COUNTS[] = {300, 5};
+
+/// Statistics of the results of a counter, computed from the results returned by GPA_GetSampleResult
+struct ExpectedStatistics
+{
+    gpa_uint32  m_counterIndex;  ///< index of the counter
+    gpa_uint64  m_count;         ///< number of finite results
+    gpa_float64 m_sum;           ///< sum of the finite results
+    gpa_float64 m_min;           ///< smallest finite result
+    gpa_float64 m_max;           ///< largest finite result
+};
+
+/// Fixture which accumulates sessions into counter statistics
+class MockGPACounterStatisticsTest : public MockGPATest
+{
+protected:
+    /// Creates a session with the counters of the tests enabled
+    /// \param[out] sessionId the session
+    void CreateSession(GPA_SessionId& sessionId)
+    {
+        ASSERT_EQ(GPA_STATUS_OK, GPA_CreateSession(m_contextId, GPA_SESSION_SAMPLE_TYPE_DISCRETE_COUNTER, &sessionId));
+
+        for (const char* pCounterName : STATISTICS_COUNTER_NAMES)
+        {
+            ASSERT_EQ(GPA_STATUS_OK, GPA_EnableCounterByName(sessionId, pCounterName));
+        }
+    }
+
+    /// Profiles a session, adds its results to the statistics, and adds the results returned by GPA_GetSampleResult to the expected statistics
+    /// \param[in] numSamples the number of samples of the session
+    /// \param[in] counterStatisticsId the statistics to accumulate the session into
+    /// \param[in,out] expected the expected statistics of each enabled counter
+    void AccumulateSession(gpa_uint32 numSamples, GPA_CounterStatisticsId counterStatisticsId, std::vector<ExpectedStatistics>& expected)
+    {
+        GPA_SessionId sessionId = nullptr;
+        ASSERT_NO_FATAL_FAILURE(CreateSession(sessionId));
+        ASSERT_EQ(GPA_STATUS_OK, GPA_BeginSession(sessionId));
+        ASSERT_NO_FATAL_FAILURE(ProfileSamples(sessionId, numSamples));
+        ASSERT_NO_FATAL_FAILURE(WaitForSession(sessionId));
+
+        ASSERT_EQ(GPA_STATUS_OK, GPA_AccumulateCounterStatistics(counterStatisticsId, sessionId));
+
+        std::vector<gpa_uint64> results;
+        ASSERT_NO_FATAL_FAILURE(GetSampleResults(sessionId, numSamples, results));
+
+        for (size_t counter = 0; counter < NUM_STATISTICS_COUNTERS; ++counter)
+        {
+            gpa_uint32    counterIndex = 0;
+            GPA_Data_Type dataType     = GPA_DATA_TYPE_UINT64;
+            ASSERT_EQ(GPA_STATUS_OK, GPA_GetEnabledIndex(sessionId, static_cast<gpa_uint32>(counter), &counterIndex));
+            ASSERT_EQ(GPA_STATUS_OK, GPA_GetCounterDataType(m_contextId, counterIndex, &dataType));
+
+            ExpectedStatistics& counterExpected = expected[counter];
+            counterExpected.m_counterIndex      = counterIndex;
+
+            for (gpa_uint32 sampleId = 0; sampleId < numSamples; ++sampleId)
+            {
+                gpa_uint64  result = results[sampleId * NUM_STATISTICS_COUNTERS + counter];
+                gpa_float64 value  = static_cast<gpa_float64>(result);
+
+                if (GPA_DATA_TYPE_FLOAT64 == dataType)
+                {
+                    memcpy(&value, &result, sizeof(value));
+                }
+
+                if (std::isfinite(value))
+                {
+                    counterExpected.m_min               = 0 == counterExpected.m_count ? value : std::min(counterExpected.m_min, value);
+                    counterExpected.m_max               = 0 == counterExpected.m_count ? value : std::max(counterExpected.m_max, value);
+                    counterExpected.m_sum += value;
+                    ++counterExpected.m_count;
+                }
+            }
+        }
+
+        EXPECT_EQ(GPA_STATUS_OK, GPA_DeleteSession(sessionId));
+    }
+};
+
+// Accumulates two sessions into two statistics objects and merges them: the statistics of each counter are those of the results of
+// all of the samples of both sessions, as returned by GPA_GetSampleResult
+TEST_F(MockGPACounterStatisticsTest, AccumulatesAndMergesSessions)
+{
+    GPA_CounterStatisticsId statisticsIds[2] = {nullptr, nullptr};
+    ExpectedStatistics      noResults        = {0, 0, 0.0, 0.0, 0.0};
+
+    std::vector<ExpectedStatistics> expected(NUM_STATISTICS_COUNTERS, noResults);
+
+    for (int sessionIndex = 0; sessionIndex < 2; ++sessionIndex)
+    {
+        ASSERT_EQ(GPA_STATUS_OK, GPA_CreateCounterStatistics(&statisticsIds[sessionIndex]));
+        ASSERT_NO_FATAL_FAILURE(AccumulateSession(SESSION_SAMPLE_COUNTS[sessionIndex], statisticsIds[sessionIndex], expected));
+    }
+
+    ASSERT_EQ(GPA_STATUS_OK, GPA_MergeCounterStatistics(statisticsIds[0], statisticsIds[1]));
+
+    for (const ExpectedStatistics& counterExpected : expected)
+    {
+        // every sample of the simulated device has results
+        ASSERT_LT(0u, counterExpected.m_count) << "counter " << counterExpected.m_counterIndex;
+
+        GPA_CounterStatistics statistics = {};
+        ASSERT_EQ(GPA_STATUS_OK, GPA_GetCounterStatistics(statisticsIds[0], counterExpected.m_counterIndex, &statistics));
+        EXPECT_EQ(counterExpected.m_count, statistics.m_count) << "counter " << counterExpected.m_counterIndex;
+        EXPECT_NEAR(counterExpected.m_sum, statistics.m_sum, 1e-9 * std::fabs(counterExpected.m_sum)) << "counter " << counterExpected.m_counterIndex;
+        EXPECT_EQ(counterExpected.m_min, statistics.m_min) << "counter " << counterExpected.m_counterIndex;
+        EXPECT_EQ(counterExpected.m_max, statistics.m_max) << "counter " << counterExpected.m_counterIndex;
+
+        // the source of the merge is not modified
+        GPA_CounterStatistics secondStatistics = {};
+        ASSERT_EQ(GPA_STATUS_OK, GPA_GetCounterStatistics(statisticsIds[1], counterExpected.m_counterIndex, &secondStatistics));
+        EXPECT_GT(statistics.m_count, secondStatistics.m_count);
+    }
+
+    for (GPA_CounterStatisticsId statisticsId : statisticsIds)
+    {
+        EXPECT_EQ(GPA_STATUS_OK, GPA_DeleteCounterStatistics(statisticsId));
+    }
+}
+
+// Only sessions whose results can be collected are accumulated: a session which was not begun or not ended is rejected
+TEST_F(MockGPACounterStatisticsTest, RejectsSessionsWithoutResults)
+{
+    GPA_CounterStatisticsId statisticsId = nullptr;
+    ASSERT_EQ(GPA_STATUS_OK, GPA_CreateCounterStatistics(&statisticsId));
+
+    GPA_SessionId sessionId = nullptr;
+    ASSERT_NO_FATAL_FAILURE(CreateSession(sessionId));
+    EXPECT_EQ(GPA_STATUS_ERROR_SESSION_NOT_STARTED, GPA_AccumulateCounterStatistics(statisticsId, sessionId));
+
+    ASSERT_EQ(GPA_STATUS_OK, GPA_BeginSession(sessionId));
+    EXPECT_EQ(GPA_STATUS_ERROR_SESSION_NOT_ENDED, GPA_AccumulateCounterStatistics(statisticsId, sessionId));
+
+    // nothing was accumulated
+    GPA_CounterStatistics statistics   = {};
+    gpa_uint32            counterIndex = 0;
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetCounterIndex(m_contextId, STATISTICS_COUNTER_NAMES[0], &counterIndex));
+    EXPECT_EQ(GPA_STATUS_ERROR_COUNTER_NOT_FOUND, GPA_GetCounterStatistics(statisticsId, counterIndex, &statistics));
+
+    ASSERT_NO_FATAL_FAILURE(ProfileSamples(sessionId, 1));
+    ASSERT_NO_FATAL_FAILURE(WaitForSession(sessionId));
+    EXPECT_EQ(GPA_STATUS_OK, GPA_AccumulateCounterStatistics(statisticsId, sessionId));
+    EXPECT_EQ(GPA_STATUS_OK, GPA_GetCounterStatistics(statisticsId, counterIndex, &statistics));
+    EXPECT_EQ(1u, statistics.m_count);
+
+    EXPECT_EQ(GPA_STATUS_OK, GPA_DeleteSession(sessionId));
+    EXPECT_EQ(GPA_STATUS_OK, GPA_DeleteCounterStatistics(statisticsId));
+}
@@ -0,0 +1,15 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Tests of GPUPerfAPI against the mock backend
+//==============================================================================
+
+#include <gtest/gtest.h>
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    auto result(RUN_ALL_TESTS());
+    return result;
+}
@@ -0,0 +1,77 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Test fixture which profiles sessions on the mock backend
+//==============================================================================
+
+#include "mock_gpa_test.h"
+
+void MockGPATest::SetUp()
+{
+    m_contextId = nullptr;
+
+    ASSERT_EQ(GPA_STATUS_OK, GPA_Initialize(GPA_INITIALIZE_DEFAULT_BIT));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_OpenContext(&m_device, GPA_OPENCONTEXT_DEFAULT_BIT, &m_contextId));
+}
+
+void MockGPATest::TearDown()
+{
+    if (nullptr != m_contextId)
+    {
+        EXPECT_EQ(GPA_STATUS_OK, GPA_CloseContext(m_contextId));
+    }
+
+    EXPECT_EQ(GPA_STATUS_OK, GPA_Destroy());
+}
+
+void MockGPATest::ProfileSamples(GPA_SessionId sessionId, gpa_uint32 numSamples)
+{
+    gpa_uint32 numPasses = 0;
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetPassCount(sessionId, &numPasses));
+    ASSERT_LT(0u, numPasses);
+
+    for (gpa_uint32 passIndex = 0; passIndex < numPasses; ++passIndex)
+    {
+        GPA_CommandListId commandListId = nullptr;
+        ASSERT_EQ(GPA_STATUS_OK, GPA_BeginCommandList(sessionId, passIndex, GPA_NULL_COMMAND_LIST, GPA_COMMAND_LIST_NONE, &commandListId));
+
+        for (gpa_uint32 sampleId = 0; sampleId < numSamples; ++sampleId)
+        {
+            ASSERT_EQ(GPA_STATUS_OK, GPA_BeginSample(sampleId, commandListId));
+            ASSERT_EQ(GPA_STATUS_OK, GPA_EndSample(commandListId));
+        }
+
+        ASSERT_EQ(GPA_STATUS_OK, GPA_EndCommandList(commandListId));
+    }
+
+    ASSERT_EQ(GPA_STATUS_OK, GPA_EndSession(sessionId));
+}
+
+void MockGPATest::WaitForSession(GPA_SessionId sessionId)
+{
+    GPA_Status status = GPA_STATUS_RESULT_NOT_READY;
+
+    while (GPA_STATUS_RESULT_NOT_READY == status)
+    {
+        status = GPA_IsSessionComplete(sessionId);
+    }
+
+    ASSERT_EQ(GPA_STATUS_OK, status);
+}
+
+void MockGPATest::GetSampleResults(GPA_SessionId sessionId, gpa_uint32 numSamples, std::vector<gpa_uint64>& results)
+{
+    gpa_uint32 numEnabledCounters = 0;
+    size_t     sampleResultSize   = 0;
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetNumEnabledCounters(sessionId, &numEnabledCounters));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetSampleResultSize(sessionId, 0, &sampleResultSize));
+    ASSERT_EQ(numEnabledCounters * sizeof(gpa_uint64), sampleResultSize);
+
+    results.assign(static_cast<size_t>(numSamples) * numEnabledCounters, 0);
+
+    for (gpa_uint32 sampleId = 0; sampleId < numSamples; ++sampleId)
+    {
+        ASSERT_EQ(GPA_STATUS_OK, GPA_GetSampleResult(sessionId, sampleId, sampleResultSize, &results[sampleId * numEnabledCounters]));
+    }
+}
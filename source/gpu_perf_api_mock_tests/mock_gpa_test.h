@@ -0,0 +1,49 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Test fixture which profiles sessions on the mock backend
+//==============================================================================
+
+#ifndef _MOCK_GPA_TEST_H_
+#define _MOCK_GPA_TEST_H_
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "gpu_perf_api.h"
+#include "mock_gpa_device.h"
+
+/// Initializes GPA and opens a context on a simulated device for each test.
+///
+/// The helpers report their failures with gtest assertions, so their calls are wrapped in ASSERT_NO_FATAL_FAILURE.
+class MockGPATest : public ::testing::Test
+{
+protected:
+    /// Initializes GPA and opens the context
+    void SetUp() override;
+
+    /// Closes the context and destroys GPA
+    void TearDown() override;
+
+    /// Records the samples 0 to numSamples - 1 in every pass of a session which was begun, then ends the session
+    /// \param[in] sessionId the session
+    /// \param[in] numSamples the number of samples
+    void ProfileSamples(GPA_SessionId sessionId, gpa_uint32 numSamples);
+
+    /// Waits until the results of a session which was ended are available
+    /// \param[in] sessionId the session
+    void WaitForSession(GPA_SessionId sessionId);
+
+    /// Gets the results of the samples 0 to numSamples - 1 of a complete session, sample after sample
+    /// \param[in] sessionId the session
+    /// \param[in] numSamples the number of samples
+    /// \param[out] results the results of the enabled counters of each sample
+    void GetSampleResults(GPA_SessionId sessionId, gpa_uint32 numSamples, std::vector<gpa_uint64>& results);
+
+    MockGPADevice m_device;     ///< the simulated device of the context
+    GPA_ContextId m_contextId;  ///< the context opened on the simulated device
+};
+
+#endif  // _MOCK_GPA_TEST_H_
@@ -0,0 +1,184 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Tests of the capture of calls to the mock backend and of their replay
+//==============================================================================
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "mock_gpa_test.h"
+#include "gpa_call_capture.h"
+#include "gpa_call_replayer.h"
+#include "utility.h"
+
+/// Number of samples profiled in each pass of the captured session
+static const gpa_uint32 NUM_CAPTURED_SAMPLES = 3;
+
+/// Number of times the trace is replayed
+static const gpa_uint32 NUM_REPLAYS = 2;
+
+/// Makes calls to the mock backend through a function table, profiling a session from GPA_Initialize to GPA_Destroy
+/// \param[in] functionTable the function table
+/// \param[out] numPasses the number of passes of the session
+static void ProfileSessionThroughTable(const GPAFunctionTable& functionTable, gpa_uint32& numPasses)
+{
+    MockGPADevice device;
+    GPA_ContextId contextId = nullptr;
+    GPA_SessionId sessionId = nullptr;
+    gpa_uint32    numCounters = 0;
+
+    ASSERT_EQ(GPA_STATUS_OK, functionTable.GPA_Initialize(GPA_INITIALIZE_DEFAULT_BIT));
+    ASSERT_EQ(GPA_STATUS_OK, functionTable.GPA_OpenContext(&device, GPA_OPENCONTEXT_DEFAULT_BIT, &contextId));
+    ASSERT_EQ(GPA_STATUS_OK, functionTable.GPA_GetNumCounters(contextId, &numCounters));
+    ASSERT_EQ(GPA_STATUS_OK, functionTable.GPA_CreateSession(contextId, GPA_SESSION_SAMPLE_TYPE_DISCRETE_COUNTER, &sessionId));
+    ASSERT_EQ(GPA_STATUS_OK, functionTable.GPA_EnableCounterByName(sessionId, "Wavefronts"));
+    ASSERT_EQ(GPA_STATUS_OK, functionTable.GPA_EnableCounter(sessionId, numCounters - 1));
+
+    // failed calls are captured too, the replay must fail them the same way
+    ASSERT_EQ(GPA_STATUS_ERROR_COUNTER_NOT_FOUND, functionTable.GPA_EnableCounterByName(sessionId, "NotACounter"));
+    ASSERT_EQ(GPA_STATUS_ERROR_INDEX_OUT_OF_RANGE, functionTable.GPA_EnableCounter(sessionId, numCounters));
+
+    ASSERT_EQ(GPA_STATUS_OK, functionTable.GPA_BeginSession(sessionId));
+    ASSERT_EQ(GPA_STATUS_OK, functionTable.GPA_GetPassCount(sessionId, &numPasses));
+
+    for (gpa_uint32 passIndex = 0; passIndex < numPasses; ++passIndex)
+    {
+        GPA_CommandListId commandListId = nullptr;
+        ASSERT_EQ(GPA_STATUS_OK,
+                  functionTable.GPA_BeginCommandList(sessionId, passIndex, GPA_NULL_COMMAND_LIST, GPA_COMMAND_LIST_NONE, &commandListId));
+
+        for (gpa_uint32 sampleId = 0; sampleId < NUM_CAPTURED_SAMPLES; ++sampleId)
+        {
+            ASSERT_EQ(GPA_STATUS_OK, functionTable.GPA_BeginSample(sampleId, commandListId));
+            ASSERT_EQ(GPA_STATUS_OK, functionTable.GPA_EndSample(commandListId));
+        }
+
+        ASSERT_EQ(GPA_STATUS_OK, functionTable.GPA_EndCommandList(commandListId));
+    }
+
+    ASSERT_EQ(GPA_STATUS_OK, functionTable.GPA_EndSession(sessionId));
+
+    // the simulated device has no latency: the results are available as soon as the session ends
+    ASSERT_EQ(GPA_STATUS_OK, functionTable.GPA_IsSessionComplete(sessionId));
+
+    size_t sampleResultSize = 0;
+    ASSERT_EQ(GPA_STATUS_OK, functionTable.GPA_GetSampleResultSize(sessionId, 0, &sampleResultSize));
+    ASSERT_EQ(2 * sizeof(gpa_uint64), sampleResultSize);
+
+    for (gpa_uint32 sampleId = 0; sampleId < NUM_CAPTURED_SAMPLES; ++sampleId)
+    {
+        gpa_uint64 results[2] = {};
+        ASSERT_EQ(GPA_STATUS_OK, functionTable.GPA_GetSampleResult(sessionId, sampleId, sampleResultSize, results));
+    }
+
+    ASSERT_EQ(GPA_STATUS_ERROR_SAMPLE_NOT_FOUND, functionTable.GPA_GetSampleResultSize(sessionId, NUM_CAPTURED_SAMPLES, &sampleResultSize));
+
+    ASSERT_EQ(GPA_STATUS_OK, functionTable.GPA_DeleteSession(sessionId));
+    ASSERT_EQ(GPA_STATUS_OK, functionTable.GPA_CloseContext(contextId));
+    ASSERT_EQ(GPA_STATUS_OK, functionTable.GPA_Destroy());
+}
+
+// A session profiled through a capturing function table is replayed against the mock backend: every call is replayed
+// as many times as it was captured, and returns the status the captured call returned
+TEST(MockGPAReplayTest, ReplaysCapturedSession)
+{
+    std::string traceFilePath;
+    ASSERT_TRUE(GPAUtil::CreateTempFile("GPA-CallTrace-MockTest-", ".bin", traceFilePath));
+    ASSERT_TRUE(g_callCapture.Start(traceFilePath));
+
+    GPAFunctionTable captureTable = {};
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetFuncTable(&captureTable));
+    g_callCapture.WrapFunctionTable(captureTable);
+
+    gpa_uint32 numPasses = 0;
+    ProfileSessionThroughTable(captureTable, numPasses);
+    g_callCapture.Stop();
+    ASSERT_FALSE(HasFatalFailure());
+
+    std::ifstream      traceFile(traceFilePath.c_str(), std::ios_base::in | std::ios_base::binary);
+    std::ostringstream traceStream;
+    traceStream << traceFile.rdbuf();
+    traceFile.close();
+    std::remove(traceFilePath.c_str());
+
+    GPAFunctionTable replayTable = {};
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetFuncTable(&replayTable));
+
+    GPACallReplayer::Options options = {0, 0};
+    GPACallReplayer          replayer(replayTable, options);
+    std::string              error;
+
+    for (gpa_uint32 replayIndex = 0; replayIndex < NUM_REPLAYS; ++replayIndex)
+    {
+        ASSERT_TRUE(replayer.Replay(traceStream.str(), error)) << error;
+    }
+
+    const std::vector<GPACallReplayStatistics>& statistics = replayer.GetStatistics();
+    ASSERT_EQ(static_cast<size_t>(GPA_API_CALL_ID__LAST), statistics.size());
+
+    // the number of calls captured to each entry point, GPA_GetFuncTable being left out of the replay
+    std::vector<gpa_uint64> numCapturedCalls(GPA_API_CALL_ID__LAST, 0);
+    numCapturedCalls[GPA_API_CALL_ID_GPA_Initialize]            = 1;
+    numCapturedCalls[GPA_API_CALL_ID_GPA_OpenContext]           = 1;
+    numCapturedCalls[GPA_API_CALL_ID_GPA_GetNumCounters]        = 1;
+    numCapturedCalls[GPA_API_CALL_ID_GPA_CreateSession]         = 1;
+    numCapturedCalls[GPA_API_CALL_ID_GPA_EnableCounterByName]   = 2;
+    numCapturedCalls[GPA_API_CALL_ID_GPA_EnableCounter]         = 2;
+    numCapturedCalls[GPA_API_CALL_ID_GPA_BeginSession]          = 1;
+    numCapturedCalls[GPA_API_CALL_ID_GPA_GetPassCount]          = 1;
+    numCapturedCalls[GPA_API_CALL_ID_GPA_BeginCommandList]      = numPasses;
+    numCapturedCalls[GPA_API_CALL_ID_GPA_BeginSample]           = numPasses * NUM_CAPTURED_SAMPLES;
+    numCapturedCalls[GPA_API_CALL_ID_GPA_EndSample]             = numPasses * NUM_CAPTURED_SAMPLES;
+    numCapturedCalls[GPA_API_CALL_ID_GPA_EndCommandList]        = numPasses;
+    numCapturedCalls[GPA_API_CALL_ID_GPA_EndSession]            = 1;
+    numCapturedCalls[GPA_API_CALL_ID_GPA_IsSessionComplete]     = 1;
+    numCapturedCalls[GPA_API_CALL_ID_GPA_GetSampleResultSize]   = 2;
+    numCapturedCalls[GPA_API_CALL_ID_GPA_GetSampleResult]       = NUM_CAPTURED_SAMPLES;
+    numCapturedCalls[GPA_API_CALL_ID_GPA_DeleteSession]         = 1;
+    numCapturedCalls[GPA_API_CALL_ID_GPA_CloseContext]          = 1;
+    numCapturedCalls[GPA_API_CALL_ID_GPA_Destroy]               = 1;
+
+    for (gpa_uint32 apiId = 0; apiId < GPA_API_CALL_ID__LAST; ++apiId)
+    {
+        EXPECT_EQ(NUM_REPLAYS * numCapturedCalls[apiId], statistics[apiId].m_numCalls) << "API call id " << apiId;
+        EXPECT_EQ(0u, statistics[apiId].m_numMismatches) << "API call id " << apiId;
+        EXPECT_EQ(statistics[apiId].m_numCalls, statistics[apiId].m_captureDurations.size());
+        EXPECT_EQ(statistics[apiId].m_numCalls, statistics[apiId].m_replayDurations.size());
+    }
+
+    // the report has a line for each entry point which was called
+    std::ostringstream report;
+    replayer.WriteReport(report);
+    EXPECT_NE(std::string::npos, report.str().find("GPA_EnableCounterByName"));
+    EXPECT_EQ(std::string::npos, report.str().find("GPA_GetFuncTable"));
+
+    // a trace which is not a call trace is rejected
+    EXPECT_FALSE(replayer.Replay("not a trace", error));
+    EXPECT_FALSE(error.empty());
+}
+
+// A captured call whose record ends before its return value cannot be compared with its replay: the replay fails
+TEST(MockGPAReplayTest, RejectsCallWithoutReturnValue)
+{
+    GPACallTraceWriter trace;
+    GPA_WriteCallTraceHeader(trace);
+
+    gpa_uint64         previousStartTime = 0;
+    GPACallTraceCall   call              = {GPA_API_CALL_ID_GPA_Destroy, 0, 0, 0};
+    GPACallTraceWriter body;
+    GPA_WriteCallTraceRecord(trace, previousStartTime, call, body);
+
+    GPAFunctionTable replayTable = {};
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetFuncTable(&replayTable));
+
+    GPACallReplayer::Options options = {0, 0};
+    GPACallReplayer          replayer(replayTable, options);
+    std::string              error;
+
+    EXPECT_FALSE(replayer.Replay(trace.GetData(), error));
+    EXPECT_NE(std::string::npos, error.find("GPA_Destroy"));
+    EXPECT_EQ(0u, replayer.GetStatistics()[GPA_API_CALL_ID_GPA_Destroy].m_numCalls);
+}
@@ -0,0 +1,139 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Tests of the enumeration and the export of the sample results of a session on the mock backend
+//==============================================================================
+
+#include <iterator>
+
+#include "mock_gpa_test.h"
+
+/// Ids of the samples begun one at a time, in this order, neither zero-based nor consecutive
+static const gpa_uint32 SINGLE_SAMPLE_IDS[] = {10, 3, 7};
+
+/// Id of the first sample of the sample block, begun after the single samples
+static const gpa_uint32 BLOCK_FIRST_SAMPLE_ID = 20;
+
+/// Number of samples of the sample block
+static const gpa_uint32 BLOCK_SAMPLE_COUNT = 3;
+
+/// Fixture which profiles a session with single samples and a sample block
+class MockGPASessionResultsTest : public MockGPATest
+{
+protected:
+    /// Profiles the session with a few counters, and waits for its results
+    void SetUp() override
+    {
+        ASSERT_NO_FATAL_FAILURE(MockGPATest::SetUp());
+
+        m_sessionId = nullptr;
+        ASSERT_EQ(GPA_STATUS_OK, GPA_CreateSession(m_contextId, GPA_SESSION_SAMPLE_TYPE_DISCRETE_COUNTER, &m_sessionId));
+
+        for (gpa_uint32 counterIndex = 0; counterIndex < 3; ++counterIndex)
+        {
+            ASSERT_EQ(GPA_STATUS_OK, GPA_EnableCounter(m_sessionId, counterIndex));
+        }
+
+        ASSERT_EQ(GPA_STATUS_OK, GPA_BeginSession(m_sessionId));
+
+        gpa_uint32 numPasses = 0;
+        ASSERT_EQ(GPA_STATUS_OK, GPA_GetPassCount(m_sessionId, &numPasses));
+
+        for (gpa_uint32 passIndex = 0; passIndex < numPasses; ++passIndex)
+        {
+            GPA_CommandListId commandListId = nullptr;
+            ASSERT_EQ(GPA_STATUS_OK, GPA_BeginCommandList(m_sessionId, passIndex, GPA_NULL_COMMAND_LIST, GPA_COMMAND_LIST_NONE, &commandListId));
+
+            for (gpa_uint32 sampleId : SINGLE_SAMPLE_IDS)
+            {
+                ASSERT_EQ(GPA_STATUS_OK, GPA_BeginSample(sampleId, commandListId));
+                ASSERT_EQ(GPA_STATUS_OK, GPA_EndSample(commandListId));
+            }
+
+            GPA_SampleBlockId sampleBlockId = nullptr;
+            ASSERT_EQ(GPA_STATUS_OK, GPA_BeginSampleBlock(commandListId, BLOCK_FIRST_SAMPLE_ID, BLOCK_SAMPLE_COUNT, &sampleBlockId));
+
+            for (gpa_uint32 sampleIndex = 0; sampleIndex < BLOCK_SAMPLE_COUNT; ++sampleIndex)
+            {
+                ASSERT_EQ(GPA_STATUS_OK, GPA_BeginBlockSample(sampleBlockId));
+                ASSERT_EQ(GPA_STATUS_OK, GPA_EndBlockSample(sampleBlockId));
+            }
+
+            ASSERT_EQ(GPA_STATUS_OK, GPA_EndSampleBlock(sampleBlockId));
+            ASSERT_EQ(GPA_STATUS_OK, GPA_EndCommandList(commandListId));
+        }
+
+        ASSERT_EQ(GPA_STATUS_OK, GPA_EndSession(m_sessionId));
+        ASSERT_NO_FATAL_FAILURE(WaitForSession(m_sessionId));
+    }
+
+    /// Deletes the session
+    void TearDown() override
+    {
+        if (nullptr != m_sessionId)
+        {
+            EXPECT_EQ(GPA_STATUS_OK, GPA_DeleteSession(m_sessionId));
+        }
+
+        MockGPATest::TearDown();
+    }
+
+    GPA_SessionId m_sessionId;  ///< the profiled session
+};
+
+// The samples are indexed in the order in which they were begun, and the samples of a block when the block is ended
+TEST_F(MockGPASessionResultsTest, SampleIdsInBeginOrder)
+{
+    std::vector<gpa_uint32> expectedSampleIds(std::begin(SINGLE_SAMPLE_IDS), std::end(SINGLE_SAMPLE_IDS));
+
+    for (gpa_uint32 sampleIndex = 0; sampleIndex < BLOCK_SAMPLE_COUNT; ++sampleIndex)
+    {
+        expectedSampleIds.push_back(BLOCK_FIRST_SAMPLE_ID + sampleIndex);
+    }
+
+    gpa_uint32 sampleCount = 0;
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetSampleCount(m_sessionId, &sampleCount));
+    ASSERT_EQ(expectedSampleIds.size(), sampleCount);
+
+    for (gpa_uint32 sampleIndex = 0; sampleIndex < sampleCount; ++sampleIndex)
+    {
+        gpa_uint32 sampleId = 0;
+        ASSERT_EQ(GPA_STATUS_OK, GPA_GetSampleId(m_sessionId, sampleIndex, &sampleId));
+        EXPECT_EQ(expectedSampleIds[sampleIndex], sampleId);
+    }
+
+    gpa_uint32 sampleId = 0;
+    EXPECT_EQ(GPA_STATUS_ERROR_SAMPLE_NOT_FOUND, GPA_GetSampleId(m_sessionId, sampleCount, &sampleId));
+}
+
+// The results by counter are the transposition of the results of the samples, in sample index order
+TEST_F(MockGPASessionResultsTest, ResultsByCounterMatchSampleResults)
+{
+    gpa_uint32 sampleCount        = 0;
+    gpa_uint32 numEnabledCounters = 0;
+    size_t     sampleResultSize   = 0;
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetSampleCount(m_sessionId, &sampleCount));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetNumEnabledCounters(m_sessionId, &numEnabledCounters));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetSampleResultSize(m_sessionId, SINGLE_SAMPLE_IDS[0], &sampleResultSize));
+
+    std::vector<gpa_uint64> resultsByCounter(static_cast<size_t>(sampleCount) * numEnabledCounters);
+    size_t                  resultsSize = resultsByCounter.size() * sizeof(gpa_uint64);
+
+    EXPECT_EQ(GPA_STATUS_ERROR_READING_SAMPLE_RESULT, GPA_GetSessionResultsByCounter(m_sessionId, resultsSize - 1, resultsByCounter.data()));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetSessionResultsByCounter(m_sessionId, resultsSize, resultsByCounter.data()));
+
+    std::vector<gpa_uint64> sampleResults(numEnabledCounters);
+
+    for (gpa_uint32 sampleIndex = 0; sampleIndex < sampleCount; ++sampleIndex)
+    {
+        gpa_uint32 sampleId = 0;
+        ASSERT_EQ(GPA_STATUS_OK, GPA_GetSampleId(m_sessionId, sampleIndex, &sampleId));
+        ASSERT_EQ(GPA_STATUS_OK, GPA_GetSampleResult(m_sessionId, sampleId, sampleResultSize, sampleResults.data()));
+
+        for (gpa_uint32 enabledIndex = 0; enabledIndex < numEnabledCounters; ++enabledIndex)
+        {
+            EXPECT_EQ(sampleResults[enabledIndex], resultsByCounter[enabledIndex * sampleCount + sampleIndex]);
+        }
+    }
+}
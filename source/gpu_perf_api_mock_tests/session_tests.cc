@@ -0,0 +1,209 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Tests of the lifetime of discrete counter sessions on the mock backend
+//==============================================================================
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "mock_gpa_test.h"
+
+/// Number of samples profiled by the tests
+static const gpa_uint32 NUM_TEST_SAMPLES = 8;
+
+/// Time after a sample has been ended until its results are available, for the tests which need pending passes
+static const gpa_uint32 SAMPLE_LATENCY_MICROSECONDS = 200000;
+
+// Profiles a session with all the counters, from GPA_CreateSession to GPA_DeleteSession, and checks that the results of the
+// samples are reproducible: the simulated device gives every counter of every sample its own value.
+TEST_F(MockGPATest, DiscreteSessionWithAllCounters)
+{
+    gpa_uint32 numCounters = 0;
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetNumCounters(m_contextId, &numCounters));
+    ASSERT_LT(0u, numCounters);
+
+    std::vector<gpa_uint64> sessionResults[2];
+
+    for (int sessionIndex = 0; sessionIndex < 2; ++sessionIndex)
+    {
+        GPA_SessionId sessionId = nullptr;
+        ASSERT_EQ(GPA_STATUS_OK, GPA_CreateSession(m_contextId, GPA_SESSION_SAMPLE_TYPE_DISCRETE_COUNTER, &sessionId));
+        ASSERT_EQ(GPA_STATUS_OK, GPA_EnableAllCounters(sessionId));
+
+        gpa_uint32 numEnabledCounters = 0;
+        ASSERT_EQ(GPA_STATUS_OK, GPA_GetNumEnabledCounters(sessionId, &numEnabledCounters));
+        ASSERT_EQ(numCounters, numEnabledCounters);
+
+        ASSERT_EQ(GPA_STATUS_OK, GPA_BeginSession(sessionId));
+        ASSERT_NO_FATAL_FAILURE(ProfileSamples(sessionId, NUM_TEST_SAMPLES));
+        ASSERT_NO_FATAL_FAILURE(WaitForSession(sessionId));
+
+        gpa_uint32 sampleCount = 0;
+        ASSERT_EQ(GPA_STATUS_OK, GPA_GetSampleCount(sessionId, &sampleCount));
+        ASSERT_EQ(NUM_TEST_SAMPLES, sampleCount);
+
+        for (gpa_uint32 sampleIndex = 0; sampleIndex < sampleCount; ++sampleIndex)
+        {
+            gpa_uint32 sampleId = 0;
+            ASSERT_EQ(GPA_STATUS_OK, GPA_GetSampleId(sessionId, sampleIndex, &sampleId));
+            EXPECT_EQ(sampleIndex, sampleId);
+        }
+
+        ASSERT_NO_FATAL_FAILURE(GetSampleResults(sessionId, NUM_TEST_SAMPLES, sessionResults[sessionIndex]));
+        ASSERT_EQ(GPA_STATUS_OK, GPA_DeleteSession(sessionId));
+    }
+
+    EXPECT_EQ(sessionResults[0], sessionResults[1]);
+
+    std::vector<gpa_uint64> firstSampleResults(sessionResults[0].begin(), sessionResults[0].begin() + numCounters);
+    std::vector<gpa_uint64> secondSampleResults(sessionResults[0].begin() + numCounters, sessionResults[0].begin() + 2 * numCounters);
+    EXPECT_NE(firstSampleResults, secondSampleResults);
+}
+
+// Checks that the calls which need the results of a session fail until it is complete
+TEST_F(MockGPATest, SampleResultsBeforeSessionEnd)
+{
+    GPA_SessionId sessionId = nullptr;
+    ASSERT_EQ(GPA_STATUS_OK, GPA_CreateSession(m_contextId, GPA_SESSION_SAMPLE_TYPE_DISCRETE_COUNTER, &sessionId));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_EnableCounter(sessionId, 0));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_BeginSession(sessionId));
+
+    gpa_uint64 result = 0;
+    EXPECT_NE(GPA_STATUS_OK, GPA_GetSampleResult(sessionId, 0, sizeof(result), &result));
+
+    ASSERT_NO_FATAL_FAILURE(ProfileSamples(sessionId, 1));
+    ASSERT_NO_FATAL_FAILURE(WaitForSession(sessionId));
+    EXPECT_EQ(GPA_STATUS_OK, GPA_GetSampleResult(sessionId, 0, sizeof(result), &result));
+    EXPECT_EQ(GPA_STATUS_OK, GPA_DeleteSession(sessionId));
+}
+
+// Profiles a session, resets it and profiles it again with fewer samples: the passes of the first run are reused, the samples
+// of the first run are discarded, and the results of the second run are those of the same samples in the first run.
+TEST_F(MockGPATest, ResetSessionReusesPasses)
+{
+    // the context must be opened on a device which counts the passes it creates
+    std::atomic<gpa_uint32> numCreatedPasses(0);
+    ASSERT_EQ(GPA_STATUS_OK, GPA_CloseContext(m_contextId));
+    m_device.m_pNumCreatedPasses = &numCreatedPasses;
+    ASSERT_EQ(GPA_STATUS_OK, GPA_OpenContext(&m_device, GPA_OPENCONTEXT_DEFAULT_BIT, &m_contextId));
+
+    GPA_SessionId sessionId = nullptr;
+    ASSERT_EQ(GPA_STATUS_OK, GPA_CreateSession(m_contextId, GPA_SESSION_SAMPLE_TYPE_DISCRETE_COUNTER, &sessionId));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_EnableAllCounters(sessionId));
+
+    ASSERT_EQ(GPA_STATUS_OK, GPA_BeginSession(sessionId));
+    ASSERT_NO_FATAL_FAILURE(ProfileSamples(sessionId, NUM_TEST_SAMPLES));
+    ASSERT_NO_FATAL_FAILURE(WaitForSession(sessionId));
+
+    gpa_uint32 numPasses = 0;
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetPassCount(sessionId, &numPasses));
+    EXPECT_EQ(numPasses, numCreatedPasses.load());
+
+    std::vector<gpa_uint64> firstResults;
+    ASSERT_NO_FATAL_FAILURE(GetSampleResults(sessionId, NUM_TEST_SAMPLES, firstResults));
+
+    ASSERT_EQ(GPA_STATUS_OK, GPA_ResetSession(sessionId));
+
+    gpa_uint32 sampleCount = NUM_TEST_SAMPLES;
+    EXPECT_EQ(GPA_STATUS_OK, GPA_GetSampleCount(sessionId, &sampleCount));
+    EXPECT_EQ(0u, sampleCount);
+
+    const gpa_uint32 numSecondRunSamples = NUM_TEST_SAMPLES / 2;
+    ASSERT_EQ(GPA_STATUS_OK, GPA_BeginSession(sessionId));
+    ASSERT_NO_FATAL_FAILURE(ProfileSamples(sessionId, numSecondRunSamples));
+    ASSERT_NO_FATAL_FAILURE(WaitForSession(sessionId));
+
+    gpa_uint32 numSecondRunPasses = 0;
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetPassCount(sessionId, &numSecondRunPasses));
+    EXPECT_EQ(numPasses, numSecondRunPasses);
+    EXPECT_EQ(numPasses, numCreatedPasses.load());
+
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetSampleCount(sessionId, &sampleCount));
+    EXPECT_EQ(numSecondRunSamples, sampleCount);
+
+    std::vector<gpa_uint64> secondResults;
+    ASSERT_NO_FATAL_FAILURE(GetSampleResults(sessionId, numSecondRunSamples, secondResults));
+    ASSERT_LE(secondResults.size(), firstResults.size());
+    EXPECT_TRUE(std::equal(secondResults.begin(), secondResults.end(), firstResults.begin()));
+
+    gpa_uint64 result = 0;
+    EXPECT_NE(GPA_STATUS_OK, GPA_GetSampleResult(sessionId, numSecondRunSamples, sizeof(result), &result));
+
+    EXPECT_EQ(GPA_STATUS_OK, GPA_DeleteSession(sessionId));
+}
+
+// Profiles a session whose first pass completes long before the others: the partial results of a sample are those of the
+// counters of the first pass until the other passes complete, and are the results of GPA_GetSampleResult
+TEST_F(MockGPATest, PartialSampleResultsOfCompletedPasses)
+{
+    // the context must be opened on a device whose samples take time to complete
+    ASSERT_EQ(GPA_STATUS_OK, GPA_CloseContext(m_contextId));
+    m_device.m_sampleLatencyMicroseconds = SAMPLE_LATENCY_MICROSECONDS;
+    ASSERT_EQ(GPA_STATUS_OK, GPA_OpenContext(&m_device, GPA_OPENCONTEXT_DEFAULT_BIT, &m_contextId));
+
+    GPA_SessionId sessionId = nullptr;
+    ASSERT_EQ(GPA_STATUS_OK, GPA_CreateSession(m_contextId, GPA_SESSION_SAMPLE_TYPE_DISCRETE_COUNTER, &sessionId));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_EnableAllCounters(sessionId));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_BeginSession(sessionId));
+
+    gpa_uint32 numPasses = 0;
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetPassCount(sessionId, &numPasses));
+    ASSERT_LT(1u, numPasses);
+
+    for (gpa_uint32 passIndex = 0; passIndex < numPasses; ++passIndex)
+    {
+        GPA_CommandListId commandListId = nullptr;
+        ASSERT_EQ(GPA_STATUS_OK, GPA_BeginCommandList(sessionId, passIndex, GPA_NULL_COMMAND_LIST, GPA_COMMAND_LIST_NONE, &commandListId));
+        ASSERT_EQ(GPA_STATUS_OK, GPA_BeginSample(0, commandListId));
+        ASSERT_EQ(GPA_STATUS_OK, GPA_EndSample(commandListId));
+        ASSERT_EQ(GPA_STATUS_OK, GPA_EndCommandList(commandListId));
+
+        if (0 == passIndex)
+        {
+            // the sample of the first pass completes before the samples of the other passes are ended
+            std::this_thread::sleep_for(std::chrono::microseconds(2 * SAMPLE_LATENCY_MICROSECONDS));
+        }
+    }
+
+    ASSERT_EQ(GPA_STATUS_OK, GPA_EndSession(sessionId));
+
+    gpa_uint32 numEnabledCounters = 0;
+    size_t     sampleResultSize   = 0;
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetNumEnabledCounters(sessionId, &numEnabledCounters));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetSampleResultSize(sessionId, 0, &sampleResultSize));
+
+    std::vector<gpa_uint64> partialResults(numEnabledCounters, 0);
+    std::vector<gpa_uint8>  isAvailable(numEnabledCounters, 0);
+    ASSERT_EQ(GPA_STATUS_RESULT_NOT_READY, GPA_GetPartialSampleResult(sessionId, 0, sampleResultSize, partialResults.data(), isAvailable.data()));
+    EXPECT_EQ(GPA_STATUS_RESULT_NOT_READY, GPA_IsSessionComplete(sessionId));
+
+    // the counters of the first pass are available, the counters which need a later pass are not
+    gpa_uint32 numAvailableCounters = static_cast<gpa_uint32>(std::count(isAvailable.begin(), isAvailable.end(), 1));
+    EXPECT_LT(0u, numAvailableCounters);
+    EXPECT_GT(numEnabledCounters, numAvailableCounters);
+
+    ASSERT_NO_FATAL_FAILURE(WaitForSession(sessionId));
+
+    std::vector<gpa_uint64> sampleResults;
+    ASSERT_NO_FATAL_FAILURE(GetSampleResults(sessionId, 1, sampleResults));
+
+    for (gpa_uint32 counterIndex = 0; counterIndex < numEnabledCounters; ++counterIndex)
+    {
+        if (0 != isAvailable[counterIndex])
+        {
+            EXPECT_EQ(sampleResults[counterIndex], partialResults[counterIndex]) << "counter " << counterIndex;
+        }
+    }
+
+    // once all of the passes are collected, the results of all of the counters are available
+    std::vector<gpa_uint64> completeResults(numEnabledCounters, 0);
+    EXPECT_EQ(GPA_STATUS_OK, GPA_GetPartialSampleResult(sessionId, 0, sampleResultSize, completeResults.data(), isAvailable.data()));
+    EXPECT_EQ(numEnabledCounters, static_cast<gpa_uint32>(std::count(isAvailable.begin(), isAvailable.end(), 1)));
+    EXPECT_EQ(sampleResults, completeResults);
+
+    EXPECT_EQ(GPA_STATUS_OK, GPA_DeleteSession(sessionId));
+}
@@ -0,0 +1,122 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Tests of SQTT sessions on the mock backend
+//==============================================================================
+
+#include <algorithm>
+#include <cstring>
+
+#include "mock_gpa_test.h"
+
+/// Number of trace streams of the simulated device (see MockGPASession::SIMULATED_SQTT_STREAMS)
+static const gpa_uint32 NUM_SQTT_STREAMS = 4;
+
+/// Number of bytes the simulated device traces on each stream while a sample runs (see MockGPASession::SIMULATED_SQTT_BYTES_PER_SAMPLE)
+static const gpa_uint32 SQTT_BYTES_PER_SAMPLE = 16 * 1024;
+
+/// Number of samples profiled by the tests, so that each stream spans several chunks of the trace file
+static const gpa_uint32 NUM_SQTT_SAMPLES = 80;
+
+/// Fixture which profiles SQTT sessions
+class MockGPASQTTTest : public MockGPATest
+{
+protected:
+    /// Creates a session which collects SQTT data along with a streaming counter, then begins it
+    /// \param[out] sessionId the session
+    void BeginSQTTSession(GPA_SessionId& sessionId)
+    {
+        ASSERT_EQ(GPA_STATUS_OK, GPA_CreateSession(m_contextId, GPA_SESSION_SAMPLE_TYPE_STREAMING_COUNTER_AND_SQTT, &sessionId));
+        ASSERT_EQ(GPA_STATUS_OK, GPA_EnableCounterByName(sessionId, "Wavefronts"));
+        ASSERT_EQ(GPA_STATUS_OK, GPA_BeginSession(sessionId));
+    }
+};
+
+// The SQTT data of every sample is read back, stream by stream, from the chunks of the trace file
+TEST_F(MockGPASQTTTest, TraceStreamsOfAllSamples)
+{
+    GPA_ContextSampleTypeFlags sampleTypes = 0;
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetSupportedSampleTypes(m_contextId, &sampleTypes));
+    EXPECT_EQ(GPA_CONTEXT_SAMPLE_TYPE_SQTT, sampleTypes & GPA_CONTEXT_SAMPLE_TYPE_SQTT);
+
+    GPA_SessionId sessionId = nullptr;
+    ASSERT_NO_FATAL_FAILURE(BeginSQTTSession(sessionId));
+
+    // the chunks can only be read once the session has ended
+    gpa_uint32 chunkCount = 0;
+    EXPECT_EQ(GPA_STATUS_RESULT_NOT_READY, GPA_GetSQTTChunkCount(sessionId, &chunkCount));
+
+    ASSERT_NO_FATAL_FAILURE(ProfileSamples(sessionId, NUM_SQTT_SAMPLES));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetSQTTChunkCount(sessionId, &chunkCount));
+    EXPECT_LT(NUM_SQTT_STREAMS, chunkCount);
+
+    std::vector<std::vector<GPA_SQTTChunkView>> streamChunks(NUM_SQTT_STREAMS);
+
+    for (gpa_uint32 chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex)
+    {
+        GPA_SQTTChunkView chunkView = {};
+        ASSERT_EQ(GPA_STATUS_OK, GPA_GetSQTTChunk(sessionId, chunkIndex, &chunkView));
+        ASSERT_LT(chunkView.m_streamId, NUM_SQTT_STREAMS);
+        ASSERT_NE(nullptr, chunkView.m_pData);
+        streamChunks[chunkView.m_streamId].push_back(chunkView);
+    }
+
+    GPA_SQTTChunkView chunkView = {};
+    EXPECT_EQ(GPA_STATUS_ERROR_INDEX_OUT_OF_RANGE, GPA_GetSQTTChunk(sessionId, chunkCount, &chunkView));
+
+    // each stream is the concatenation of its chunks, which hold the words (sampleId << 16) | (streamId << 12) | wordIndex of each sample
+    const gpa_uint32 wordsPerSample = SQTT_BYTES_PER_SAMPLE / sizeof(gpa_uint32);
+
+    for (gpa_uint32 streamId = 0; streamId < NUM_SQTT_STREAMS; ++streamId)
+    {
+        std::vector<GPA_SQTTChunkView>& chunks = streamChunks[streamId];
+        std::sort(chunks.begin(), chunks.end(), [](const GPA_SQTTChunkView& a, const GPA_SQTTChunkView& b) { return a.m_streamOffset < b.m_streamOffset; });
+
+        std::vector<gpa_uint32> streamData;
+
+        for (const GPA_SQTTChunkView& chunk : chunks)
+        {
+            ASSERT_EQ(streamData.size() * sizeof(gpa_uint32), chunk.m_streamOffset);
+            ASSERT_EQ(0u, chunk.m_size % sizeof(gpa_uint32));
+
+            size_t firstWord = streamData.size();
+            streamData.resize(firstWord + static_cast<size_t>(chunk.m_size / sizeof(gpa_uint32)));
+            memcpy(&streamData[firstWord], chunk.m_pData, static_cast<size_t>(chunk.m_size));
+        }
+
+        ASSERT_EQ(NUM_SQTT_SAMPLES * wordsPerSample, streamData.size());
+
+        for (size_t wordIndex = 0; wordIndex < streamData.size(); ++wordIndex)
+        {
+            const gpa_uint32 sampleId = static_cast<gpa_uint32>(wordIndex / wordsPerSample);
+            ASSERT_EQ((sampleId << 16) | (streamId << 12) | static_cast<gpa_uint32>(wordIndex % wordsPerSample), streamData[wordIndex]);
+        }
+    }
+
+    EXPECT_EQ(GPA_STATUS_OK, GPA_DeleteSession(sessionId));
+}
+
+// SQTT data is only available for started sessions which collect it
+TEST_F(MockGPASQTTTest, SQTTErrors)
+{
+    GPA_SessionId     sessionId  = nullptr;
+    gpa_uint32        chunkCount = 0;
+    GPA_SQTTChunkView chunkView  = {};
+
+    ASSERT_EQ(GPA_STATUS_OK, GPA_CreateSession(m_contextId, GPA_SESSION_SAMPLE_TYPE_STREAMING_COUNTER_AND_SQTT, &sessionId));
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, GPA_GetSQTTChunkCount(sessionId, nullptr));
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, GPA_GetSQTTChunk(sessionId, 0, nullptr));
+    EXPECT_EQ(GPA_STATUS_ERROR_SESSION_NOT_STARTED, GPA_GetSQTTChunkCount(sessionId, &chunkCount));
+    EXPECT_EQ(GPA_STATUS_ERROR_SESSION_NOT_STARTED, GPA_GetSQTTChunk(sessionId, 0, &chunkView));
+    EXPECT_EQ(GPA_STATUS_OK, GPA_DeleteSession(sessionId));
+
+    ASSERT_EQ(GPA_STATUS_OK, GPA_CreateSession(m_contextId, GPA_SESSION_SAMPLE_TYPE_DISCRETE_COUNTER, &sessionId));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_EnableCounterByName(sessionId, "Wavefronts"));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_BeginSession(sessionId));
+    ASSERT_NO_FATAL_FAILURE(ProfileSamples(sessionId, 1));
+    EXPECT_EQ(GPA_STATUS_ERROR_INCOMPATIBLE_SAMPLE_TYPES, GPA_GetSQTTChunkCount(sessionId, &chunkCount));
+    EXPECT_EQ(GPA_STATUS_ERROR_INCOMPATIBLE_SAMPLE_TYPES, GPA_GetSQTTChunk(sessionId, 0, &chunkView));
+    ASSERT_NO_FATAL_FAILURE(WaitForSession(sessionId));
+    EXPECT_EQ(GPA_STATUS_OK, GPA_DeleteSession(sessionId));
+}
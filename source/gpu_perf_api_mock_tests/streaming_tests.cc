@@ -0,0 +1,181 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Tests of streaming counter sessions on the mock backend
+//==============================================================================
+
+#include "mock_gpa_test.h"
+
+/// Public counters collected by the tests, which are computed from hardware counters sampled in a single pass
+static const char* STREAMING_COUNTER_NAMES[] = {"Wavefronts", "VALUInsts", "VALUBusy", "L2CacheHit"};
+
+/// Number of counters collected by the tests
+static const size_t NUM_STREAMING_COUNTERS = sizeof(STREAMING_COUNTER_NAMES) / sizeof(STREAMING_COUNTER_NAMES[0]);
+
+/// Number of samples profiled by the tests
+static const gpa_uint32 NUM_STREAMING_SAMPLES = 6;
+
+/// Number of records the simulated device produces while a sample runs (see MockGPASession::SIMULATED_RECORDS_PER_SAMPLE)
+static const gpa_uint32 RECORDS_PER_SAMPLE = 4;
+
+/// Interval between two records, in GPU timestamp units: the default streaming counter sampling interval of a session
+static const gpa_uint64 RECORD_INTERVAL = 4096;
+
+/// Fixture which profiles streaming counter sessions
+class MockGPAStreamingTest : public MockGPATest
+{
+protected:
+    /// Creates a session and enables the streaming counters
+    /// \param[in] sampleType the sample type of the session
+    /// \param[out] sessionId the session
+    void CreateSession(GPA_Session_Sample_Type sampleType, GPA_SessionId& sessionId)
+    {
+        ASSERT_EQ(GPA_STATUS_OK, GPA_CreateSession(m_contextId, sampleType, &sessionId));
+
+        for (const char* pCounterName : STREAMING_COUNTER_NAMES)
+        {
+            ASSERT_EQ(GPA_STATUS_OK, GPA_EnableCounterByName(sessionId, pCounterName));
+        }
+
+        gpa_uint32 numPasses = 0;
+        ASSERT_EQ(GPA_STATUS_OK, GPA_GetPassCount(sessionId, &numPasses));
+        ASSERT_EQ(1u, numPasses);
+    }
+
+    /// Reads all the buckets of a streaming counter session which was ended, a few buckets per call
+    /// \param[in] sessionId the session
+    /// \param[in] bucketDuration the duration of the buckets
+    /// \param[out] buckets the buckets
+    /// \param[out] results the results of the enabled counters of each bucket
+    void ReadAllBuckets(GPA_SessionId sessionId, gpa_uint64 bucketDuration, std::vector<GPA_StreamingCounterBucket>& buckets, std::vector<gpa_uint64>& results)
+    {
+        const gpa_uint32 maxBucketsPerCall = 3;
+
+        GPA_Status status = GPA_STATUS_RESULT_NOT_READY;
+        buckets.clear();
+        results.clear();
+
+        while (GPA_STATUS_RESULT_NOT_READY == status)
+        {
+            size_t     firstBucket = buckets.size();
+            gpa_uint32 numBuckets  = maxBucketsPerCall + 1;
+            buckets.resize(firstBucket + maxBucketsPerCall);
+            results.resize(buckets.size() * NUM_STREAMING_COUNTERS);
+
+            status = GPA_GetStreamingCounterResults(
+                sessionId, bucketDuration, maxBucketsPerCall, &buckets[firstBucket], &results[firstBucket * NUM_STREAMING_COUNTERS], &numBuckets);
+            ASSERT_LE(numBuckets, maxBucketsPerCall);
+
+            // the session has ended, so every call returns buckets until all of them are read
+            ASSERT_TRUE(GPA_STATUS_OK == status || maxBucketsPerCall == numBuckets);
+            buckets.resize(firstBucket + numBuckets);
+            results.resize(buckets.size() * NUM_STREAMING_COUNTERS);
+        }
+
+        ASSERT_EQ(GPA_STATUS_OK, status);
+    }
+};
+
+// Each record is read in its own bucket when the buckets are shorter than the sampling interval
+TEST_F(MockGPAStreamingTest, OneRecordPerBucket)
+{
+    GPA_SessionId sessionId = nullptr;
+    ASSERT_NO_FATAL_FAILURE(CreateSession(GPA_SESSION_SAMPLE_TYPE_STREAMING_COUNTER, sessionId));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_BeginSession(sessionId));
+
+    // no record was produced yet
+    GPA_StreamingCounterBucket bucket                          = {};
+    gpa_uint64                 results[NUM_STREAMING_COUNTERS] = {};
+    gpa_uint32                 numBuckets                      = 1;
+    EXPECT_EQ(GPA_STATUS_RESULT_NOT_READY, GPA_GetStreamingCounterResults(sessionId, RECORD_INTERVAL, 1, &bucket, results, &numBuckets));
+    EXPECT_EQ(0u, numBuckets);
+
+    ASSERT_NO_FATAL_FAILURE(ProfileSamples(sessionId, NUM_STREAMING_SAMPLES));
+
+    std::vector<GPA_StreamingCounterBucket> buckets;
+    std::vector<gpa_uint64>                 bucketResults;
+    ASSERT_NO_FATAL_FAILURE(ReadAllBuckets(sessionId, 1, buckets, bucketResults));
+    ASSERT_EQ(NUM_STREAMING_SAMPLES * RECORDS_PER_SAMPLE, buckets.size());
+
+    for (size_t bucketIndex = 0; bucketIndex < buckets.size(); ++bucketIndex)
+    {
+        EXPECT_EQ(bucketIndex * RECORD_INTERVAL, buckets[bucketIndex].m_startTimestamp);
+        EXPECT_EQ(bucketIndex * RECORD_INTERVAL + 1, buckets[bucketIndex].m_endTimestamp);
+        EXPECT_EQ(1u, buckets[bucketIndex].m_numRecords);
+        EXPECT_EQ(0u, buckets[bucketIndex].m_numDroppedRecords);
+    }
+
+    EXPECT_EQ(GPA_STATUS_OK, GPA_DeleteSession(sessionId));
+}
+
+// The records of a sample spread its results over the time it runs, so the results of a bucket spanning the records of a sample
+// are the results of the sample in a discrete counter session
+TEST_F(MockGPAStreamingTest, BucketResultsMatchSampleResults)
+{
+    GPA_SessionId discreteSessionId = nullptr;
+    ASSERT_NO_FATAL_FAILURE(CreateSession(GPA_SESSION_SAMPLE_TYPE_DISCRETE_COUNTER, discreteSessionId));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_BeginSession(discreteSessionId));
+    ASSERT_NO_FATAL_FAILURE(ProfileSamples(discreteSessionId, NUM_STREAMING_SAMPLES));
+    ASSERT_NO_FATAL_FAILURE(WaitForSession(discreteSessionId));
+
+    std::vector<gpa_uint64> sampleResults;
+    ASSERT_NO_FATAL_FAILURE(GetSampleResults(discreteSessionId, NUM_STREAMING_SAMPLES, sampleResults));
+    EXPECT_EQ(GPA_STATUS_OK, GPA_DeleteSession(discreteSessionId));
+
+    GPA_SessionId streamingSessionId = nullptr;
+    ASSERT_NO_FATAL_FAILURE(CreateSession(GPA_SESSION_SAMPLE_TYPE_STREAMING_COUNTER, streamingSessionId));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_BeginSession(streamingSessionId));
+    ASSERT_NO_FATAL_FAILURE(ProfileSamples(streamingSessionId, NUM_STREAMING_SAMPLES));
+
+    // a bucket result has the layout of a sample result
+    size_t bucketResultSize = 0;
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetSampleResultSize(streamingSessionId, 0, &bucketResultSize));
+    EXPECT_EQ(NUM_STREAMING_COUNTERS * sizeof(gpa_uint64), bucketResultSize);
+
+    const gpa_uint64                        bucketDuration = RECORDS_PER_SAMPLE * RECORD_INTERVAL;
+    std::vector<GPA_StreamingCounterBucket> buckets;
+    std::vector<gpa_uint64>                 bucketResults;
+    ASSERT_NO_FATAL_FAILURE(ReadAllBuckets(streamingSessionId, bucketDuration, buckets, bucketResults));
+    ASSERT_EQ(NUM_STREAMING_SAMPLES, buckets.size());
+
+    for (size_t bucketIndex = 0; bucketIndex < buckets.size(); ++bucketIndex)
+    {
+        EXPECT_EQ(bucketIndex * bucketDuration, buckets[bucketIndex].m_startTimestamp);
+        EXPECT_EQ(RECORDS_PER_SAMPLE, buckets[bucketIndex].m_numRecords);
+    }
+
+    EXPECT_EQ(sampleResults, bucketResults);
+
+    // once all the buckets are read, the next calls return none
+    GPA_StreamingCounterBucket bucket                          = {};
+    gpa_uint64                 results[NUM_STREAMING_COUNTERS] = {};
+    gpa_uint32                 numBuckets                      = 1;
+    EXPECT_EQ(GPA_STATUS_OK, GPA_GetStreamingCounterResults(streamingSessionId, bucketDuration, 1, &bucket, results, &numBuckets));
+    EXPECT_EQ(0u, numBuckets);
+
+    EXPECT_EQ(GPA_STATUS_OK, GPA_DeleteSession(streamingSessionId));
+}
+
+// Streaming counter results are only available for streaming counter sessions, whose counters are collected in a single pass
+TEST_F(MockGPAStreamingTest, StreamingCounterErrors)
+{
+    GPA_SessionId sessionId = nullptr;
+    ASSERT_NO_FATAL_FAILURE(CreateSession(GPA_SESSION_SAMPLE_TYPE_DISCRETE_COUNTER, sessionId));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_BeginSession(sessionId));
+
+    GPA_StreamingCounterBucket bucket                          = {};
+    gpa_uint64                 results[NUM_STREAMING_COUNTERS] = {};
+    gpa_uint32                 numBuckets                      = 0;
+    EXPECT_EQ(GPA_STATUS_ERROR_INCOMPATIBLE_SAMPLE_TYPES, GPA_GetStreamingCounterResults(sessionId, RECORD_INTERVAL, 1, &bucket, results, &numBuckets));
+
+    ASSERT_NO_FATAL_FAILURE(ProfileSamples(sessionId, 1));
+    ASSERT_NO_FATAL_FAILURE(WaitForSession(sessionId));
+    EXPECT_EQ(GPA_STATUS_OK, GPA_DeleteSession(sessionId));
+
+    // a counter which needs two passes cannot be streamed
+    ASSERT_EQ(GPA_STATUS_OK, GPA_CreateSession(m_contextId, GPA_SESSION_SAMPLE_TYPE_STREAMING_COUNTER, &sessionId));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_EnableCounterByName(sessionId, "L1CacheHit"));
+    EXPECT_EQ(GPA_STATUS_ERROR_FAILED, GPA_BeginSession(sessionId));
+    EXPECT_EQ(GPA_STATUS_OK, GPA_DeleteSession(sessionId));
+}
@@ -0,0 +1,457 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Replay of a GPA call trace against the mock GPA backend
+//==============================================================================
+
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+
+#include "gpa_call_replayer.h"
+
+const gpa_uint32 GPACallReplayer::INVALID_COUNTER_INDEX;
+
+/// Names of the GPA entry points, indexed by GPA_ApiCallId
+static const char* const API_NAMES[] = {
+#define GPA_FUNCTION_PREFIX(func) #func,
+#include "gpu_perf_api_functions.h"
+#undef GPA_FUNCTION_PREFIX
+};
+
+/// Logging callback used in place of the callback of the captured application
+static void IgnoreLoggingMessage(GPA_Logging_Type loggingType, const char* pLogMsg)
+{
+    UNREFERENCED_PARAMETER(loggingType);
+    UNREFERENCED_PARAMETER(pLogMsg);
+}
+
+/// Gets a percentile of sorted durations
+/// \param[in] sortedDurations the durations, in increasing order
+/// \param[in] percentile the percentile, from 0 to 100
+/// \return the duration at the percentile
+static gpa_uint64 GetPercentile(const std::vector<gpa_uint64>& sortedDurations, size_t percentile)
+{
+    if (sortedDurations.empty())
+    {
+        return 0;
+    }
+
+    return sortedDurations[(sortedDurations.size() - 1) * percentile / 100];
+}
+
+GPACallReplayer::GPACallReplayer(const GPAFunctionTable& functionTable, const Options& options)
+    : m_functionTable(functionTable)
+    , m_options(options)
+    , m_statistics(GPA_API_CALL_ID__LAST)
+{
+    m_replayFunctions.reserve(GPA_API_CALL_ID__LAST);
+
+#define GPA_FUNCTION_PREFIX(func) \
+    m_replayFunctions.push_back(&GPAReplayedCall<decltype(m_functionTable.func) GPAFunctionTable::*, &GPAFunctionTable::func, GPA_API_CALL_ID_##func>::Replay);
+#include "gpu_perf_api_functions.h"
+#undef GPA_FUNCTION_PREFIX
+
+    // the calls to the entry points missing from the table, when it was filled by an older GPA, are skipped
+#define GPA_FUNCTION_PREFIX(func)                                    \
+    if (nullptr == m_functionTable.func)                             \
+    {                                                                \
+        m_replayFunctions[GPA_API_CALL_ID_##func] = nullptr;         \
+    }
+#include "gpu_perf_api_functions.h"
+#undef GPA_FUNCTION_PREFIX
+
+    // getting the function table only matters to the captured application
+    m_replayFunctions[GPA_API_CALL_ID_GPA_GetFuncTable] = nullptr;
+
+    for (GPACallReplayStatistics& statistics : m_statistics)
+    {
+        statistics.m_numCalls      = 0;
+        statistics.m_numMismatches = 0;
+    }
+}
+
+bool GPACallReplayer::Replay(const std::string& trace, std::string& error)
+{
+    GPACallTraceReader       reader(trace.data(), trace.size());
+    std::vector<std::string> traceApiNames;
+
+    if (!GPA_ReadCallTraceHeader(reader, traceApiNames))
+    {
+        error = "the file is not a GPA call trace, or was captured by an incompatible version of GPA";
+        return false;
+    }
+
+    // the entry points are identified by name, so that a trace can be replayed by another build
+    std::vector<gpa_uint32> apiIds(traceApiNames.size(), GPA_API_CALL_ID__LAST);
+
+    for (size_t traceApiId = 0; traceApiId < traceApiNames.size(); ++traceApiId)
+    {
+        for (gpa_uint32 apiId = 0; apiId < GPA_API_CALL_ID__LAST; ++apiId)
+        {
+            if (traceApiNames[traceApiId] == API_NAMES[apiId])
+            {
+                apiIds[traceApiId] = apiId;
+                break;
+            }
+        }
+    }
+
+    // each replay starts from scratch, as the trace did
+    m_handles.clear();
+    m_counterIndices.clear();
+    m_sessionContexts.clear();
+
+    gpa_uint64 previousStartTime = 0;
+
+    while (!reader.IsAtEnd())
+    {
+        GPACallTraceCall   call;
+        GPACallTraceReader body(nullptr, 0);
+
+        if (!GPA_ReadCallTraceRecord(reader, previousStartTime, call, body) || call.m_apiId >= apiIds.size())
+        {
+            error = "the call trace is truncated or corrupted";
+            return false;
+        }
+
+        gpa_uint32 apiId = apiIds[call.m_apiId];
+
+        if (GPA_API_CALL_ID__LAST == apiId)
+        {
+            error = "the call trace holds calls to " + traceApiNames[call.m_apiId] + ", which this build does not know";
+            return false;
+        }
+
+        if (nullptr == m_replayFunctions[apiId])
+        {
+            continue;
+        }
+
+        GPACallReplayResult result = {0, true};
+
+        if (!m_replayFunctions[apiId](*this, body, result))
+        {
+            error = std::string("the call to ") + API_NAMES[apiId] + " is truncated";
+            return false;
+        }
+
+        GPACallReplayStatistics& statistics = m_statistics[apiId];
+        ++statistics.m_numCalls;
+        statistics.m_numMismatches += result.m_isSameResult ? 0 : 1;
+        statistics.m_captureDurations.push_back(call.m_duration);
+        statistics.m_replayDurations.push_back(result.m_duration);
+    }
+
+    return true;
+}
+
+void GPACallReplayer::WriteReport(std::ostream& stream) const
+{
+    stream << std::left << std::setw(36) << "Entry point" << std::right << std::setw(10) << "Calls" << std::setw(12) << "Mismatches"
+           << std::setw(14) << "Capture p50" << std::setw(14) << "Capture p99" << std::setw(12) << "Min" << std::setw(12) << "p50"
+           << std::setw(12) << "p90" << std::setw(12) << "p99" << std::setw(12) << "Max" << std::endl;
+
+    for (gpa_uint32 apiId = 0; apiId < GPA_API_CALL_ID__LAST; ++apiId)
+    {
+        const GPACallReplayStatistics& statistics = m_statistics[apiId];
+
+        if (0 == statistics.m_numCalls)
+        {
+            continue;
+        }
+
+        std::vector<gpa_uint64> captureDurations = statistics.m_captureDurations;
+        std::vector<gpa_uint64> replayDurations  = statistics.m_replayDurations;
+        std::sort(captureDurations.begin(), captureDurations.end());
+        std::sort(replayDurations.begin(), replayDurations.end());
+
+        stream << std::left << std::setw(36) << API_NAMES[apiId] << std::right << std::setw(10) << statistics.m_numCalls << std::setw(12)
+               << statistics.m_numMismatches << std::setw(14) << GetPercentile(captureDurations, 50) << std::setw(14)
+               << GetPercentile(captureDurations, 99) << std::setw(12) << replayDurations.front() << std::setw(12)
+               << GetPercentile(replayDurations, 50) << std::setw(12) << GetPercentile(replayDurations, 90) << std::setw(12)
+               << GetPercentile(replayDurations, 99) << std::setw(12) << replayDurations.back() << std::endl;
+    }
+
+    stream << "All durations are in nanoseconds. Mismatches are the calls which did not return the status of the captured call." << std::endl;
+}
+
+void* GPACallReplayer::GetHandle(gpa_uint64 handleId) const
+{
+    auto handleIter = m_handles.find(handleId);
+    return m_handles.end() == handleIter ? nullptr : handleIter->second;
+}
+
+void GPACallReplayer::SetHandle(gpa_uint64 handleId, void* handle)
+{
+    m_handles[handleId] = handle;
+}
+
+gpa_uint32 GPACallReplayer::GetCounterIndex(GPA_ContextId contextId, gpa_uint32 counterIndex) const
+{
+    auto counterIndicesIter = m_counterIndices.find(contextId);
+
+    // the counters of a context opened before the capture started are unknown, its indices are replayed as captured
+    if (m_counterIndices.end() == counterIndicesIter)
+    {
+        return counterIndex;
+    }
+
+    const std::vector<gpa_uint32>& counterIndices = counterIndicesIter->second;
+    return counterIndex < counterIndices.size() ? counterIndices[counterIndex] : INVALID_COUNTER_INDEX;
+}
+
+void* GPACallReplayer::GetBuffer(size_t bufferIndex, size_t size)
+{
+    std::vector<gpa_uint64>& buffer = m_buffers[bufferIndex];
+    buffer.resize((size + sizeof(gpa_uint64) - 1) / sizeof(gpa_uint64) + 1);
+    return buffer.data();
+}
+
+bool GPACallReplayer::IsSameResult(const char* pCapturedString, const char* pString)
+{
+    if (nullptr == pCapturedString || nullptr == pString)
+    {
+        return pCapturedString == pString;
+    }
+
+    return 0 == strcmp(pCapturedString, pString);
+}
+
+void GPACallReplayer::PrepareCall(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_RegisterLoggingCallback>,
+                                  GPACallTraceReader&                         payload,
+                                  GPAReplayedArg<GPA_Logging_Type>&           loggingType,
+                                  GPAReplayedArg<GPA_LoggingCallbackPtrType>& callback)
+{
+    UNREFERENCED_PARAMETER(payload);
+    UNREFERENCED_PARAMETER(loggingType);
+
+    callback.m_value = callback.m_isNull ? nullptr : IgnoreLoggingMessage;
+}
+
+void GPACallReplayer::PrepareCall(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_OpenContext>,
+                                  GPACallTraceReader&                   payload,
+                                  GPAReplayedArg<void*>&                context,
+                                  GPAReplayedArg<GPA_OpenContextFlags>& flags,
+                                  GPAReplayedArg<GPA_ContextId*>&       contextId)
+{
+    UNREFERENCED_PARAMETER(flags);
+    UNREFERENCED_PARAMETER(contextId);
+
+    gpa_uint64 deviceId    = MockGPADevice::DEFAULT_DEVICE_ID;
+    gpa_uint64 revisionId  = MockGPADevice::ANY_REVISION_ID;
+    gpa_uint64 numCounters = 0;
+
+    m_openedCounterNames.clear();
+
+    // the payload is empty if the captured call failed
+    if (payload.ReadUInt(deviceId) && payload.ReadUInt(revisionId) && payload.ReadUInt(numCounters))
+    {
+        for (gpa_uint64 counterIndex = 0; counterIndex < numCounters; ++counterIndex)
+        {
+            std::string counterName;
+            bool        isNull = false;
+
+            if (!payload.ReadString(counterName, isNull))
+            {
+                break;
+            }
+
+            m_openedCounterNames.push_back(counterName);
+        }
+    }
+
+    // each context is identified by its own device
+    m_devices.push_back(MockGPADevice());
+    MockGPADevice& device = m_devices.back();
+
+    if (0 != m_options.m_deviceId)
+    {
+        device.m_deviceId = m_options.m_deviceId;
+    }
+    else
+    {
+        device.m_deviceId   = static_cast<gpa_uint32>(deviceId);
+        device.m_revisionId = static_cast<gpa_uint32>(revisionId);
+    }
+
+    device.m_sampleLatencyMicroseconds = m_options.m_latencyMicroseconds;
+
+    context.m_value = context.m_isNull ? nullptr : &device;
+}
+
+void GPACallReplayer::CompleteCall(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_OpenContext>,
+                                   GPA_Status                            status,
+                                   GPAReplayedArg<void*>&                context,
+                                   GPAReplayedArg<GPA_OpenContextFlags>& flags,
+                                   GPAReplayedArg<GPA_ContextId*>&       contextId)
+{
+    UNREFERENCED_PARAMETER(context);
+    UNREFERENCED_PARAMETER(flags);
+
+    if (GPA_STATUS_OK != status || nullptr == contextId.m_value || m_openedCounterNames.empty())
+    {
+        return;
+    }
+
+    std::vector<gpa_uint32>& counterIndices = m_counterIndices[contextId.m_output];
+    counterIndices.assign(m_openedCounterNames.size(), INVALID_COUNTER_INDEX);
+
+    for (size_t counterIndex = 0; counterIndex < m_openedCounterNames.size(); ++counterIndex)
+    {
+        m_functionTable.GPA_GetCounterIndex(contextId.m_output, m_openedCounterNames[counterIndex].c_str(), &counterIndices[counterIndex]);
+    }
+}
+
+void GPACallReplayer::CompleteCall(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_CreateSession>,
+                                   GPA_Status                               status,
+                                   GPAReplayedArg<GPA_ContextId>&           contextId,
+                                   GPAReplayedArg<GPA_Session_Sample_Type>& sampleType,
+                                   GPAReplayedArg<GPA_SessionId*>&          sessionId)
+{
+    UNREFERENCED_PARAMETER(sampleType);
+
+    if (GPA_STATUS_OK == status && nullptr != sessionId.m_value)
+    {
+        m_sessionContexts[sessionId.m_output] = contextId.m_value;
+    }
+}
+
+void GPACallReplayer::PrepareCall(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_EnableCounter>,
+                                  GPACallTraceReader&            payload,
+                                  GPAReplayedArg<GPA_SessionId>& sessionId,
+                                  GPAReplayedArg<gpa_uint32>&    counterIndex)
+{
+    UNREFERENCED_PARAMETER(payload);
+
+    auto sessionContextIter = m_sessionContexts.find(sessionId.m_value);
+
+    if (m_sessionContexts.end() != sessionContextIter)
+    {
+        counterIndex.m_value = GetCounterIndex(sessionContextIter->second, counterIndex.m_value);
+    }
+}
+
+void GPACallReplayer::PrepareCall(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_DisableCounter>,
+                                  GPACallTraceReader&            payload,
+                                  GPAReplayedArg<GPA_SessionId>& sessionId,
+                                  GPAReplayedArg<gpa_uint32>&    counterIndex)
+{
+    PrepareCall(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_EnableCounter>(), payload, sessionId, counterIndex);
+}
+
+void GPACallReplayer::PrepareCall(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_IsCounterEnabled>,
+                                  GPACallTraceReader&            payload,
+                                  GPAReplayedArg<GPA_SessionId>& sessionId,
+                                  GPAReplayedArg<gpa_uint32>&    counterIndex)
+{
+    PrepareCall(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_EnableCounter>(), payload, sessionId, counterIndex);
+}
+
+void GPACallReplayer::PrepareCall(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_BeginCommandList>,
+                                  GPACallTraceReader&                    payload,
+                                  GPAReplayedArg<GPA_SessionId>&         sessionId,
+                                  GPAReplayedArg<gpa_uint32>&            passIndex,
+                                  GPAReplayedArg<void*>&                 commandList,
+                                  GPAReplayedArg<GPA_Command_List_Type>& commandListType,
+                                  GPAReplayedArg<GPA_CommandListId*>&    commandListId)
+{
+    UNREFERENCED_PARAMETER(payload);
+    UNREFERENCED_PARAMETER(sessionId);
+    UNREFERENCED_PARAMETER(passIndex);
+    UNREFERENCED_PARAMETER(commandListId);
+
+    // the mock backend behaves like the OpenCL backend, which has no command lists
+    commandList.m_value     = GPA_NULL_COMMAND_LIST;
+    commandListType.m_value = GPA_COMMAND_LIST_NONE;
+}
+
+void GPACallReplayer::PrepareCall(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_CopySecondarySamples>,
+                                  GPACallTraceReader&                payload,
+                                  GPAReplayedArg<GPA_CommandListId>& secondaryCommandListId,
+                                  GPAReplayedArg<GPA_CommandListId>& primaryCommandListId,
+                                  GPAReplayedArg<gpa_uint32>&        numSamples,
+                                  GPAReplayedArg<gpa_uint32*>&       newSampleIds)
+{
+    UNREFERENCED_PARAMETER(payload);
+    UNREFERENCED_PARAMETER(secondaryCommandListId);
+    UNREFERENCED_PARAMETER(primaryCommandListId);
+
+    if (nullptr != newSampleIds.m_value)
+    {
+        newSampleIds.m_value = static_cast<gpa_uint32*>(GetBuffer(0, numSamples.m_value * sizeof(gpa_uint32)));
+    }
+}
+
+void GPACallReplayer::PrepareCall(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_GetSampleResult>,
+                                  GPACallTraceReader&            payload,
+                                  GPAReplayedArg<GPA_SessionId>& sessionId,
+                                  GPAReplayedArg<gpa_uint32>&    sampleId,
+                                  GPAReplayedArg<size_t>&        sampleResultSizeInBytes,
+                                  GPAReplayedArg<void*>&         counterSampleResults)
+{
+    UNREFERENCED_PARAMETER(payload);
+    UNREFERENCED_PARAMETER(sessionId);
+    UNREFERENCED_PARAMETER(sampleId);
+
+    counterSampleResults.m_value = counterSampleResults.m_isNull ? nullptr : GetBuffer(0, sampleResultSizeInBytes.m_value);
+}
+
+void GPACallReplayer::PrepareCall(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_GetSessionResultsByCounter>,
+                                  GPACallTraceReader&            payload,
+                                  GPAReplayedArg<GPA_SessionId>& sessionId,
+                                  GPAReplayedArg<size_t>&        resultsSizeInBytes,
+                                  GPAReplayedArg<void*>&         counterResults)
+{
+    UNREFERENCED_PARAMETER(payload);
+    UNREFERENCED_PARAMETER(sessionId);
+
+    counterResults.m_value = counterResults.m_isNull ? nullptr : GetBuffer(0, resultsSizeInBytes.m_value);
+}
+
+void GPACallReplayer::PrepareCall(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_GetPartialSampleResult>,
+                                  GPACallTraceReader&            payload,
+                                  GPAReplayedArg<GPA_SessionId>& sessionId,
+                                  GPAReplayedArg<gpa_uint32>&    sampleId,
+                                  GPAReplayedArg<size_t>&        sampleResultSizeInBytes,
+                                  GPAReplayedArg<void*>&         counterSampleResults,
+                                  GPAReplayedArg<gpa_uint8*>&    counterResultAvailable)
+{
+    UNREFERENCED_PARAMETER(payload);
+    UNREFERENCED_PARAMETER(sessionId);
+    UNREFERENCED_PARAMETER(sampleId);
+
+    counterSampleResults.m_value = counterSampleResults.m_isNull ? nullptr : GetBuffer(0, sampleResultSizeInBytes.m_value);
+
+    // one availability flag per result
+    if (nullptr != counterResultAvailable.m_value)
+    {
+        counterResultAvailable.m_value = static_cast<gpa_uint8*>(GetBuffer(1, sampleResultSizeInBytes.m_value / sizeof(gpa_uint64)));
+    }
+}
+
+void GPACallReplayer::PrepareCall(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_GetStreamingCounterResults>,
+                                  GPACallTraceReader&                          payload,
+                                  GPAReplayedArg<GPA_SessionId>&               sessionId,
+                                  GPAReplayedArg<gpa_uint64>&                  bucketDuration,
+                                  GPAReplayedArg<gpa_uint32>&                  maxBuckets,
+                                  GPAReplayedArg<GPA_StreamingCounterBucket*>& buckets,
+                                  GPAReplayedArg<void*>&                       counterResults,
+                                  GPAReplayedArg<gpa_uint32*>&                 numBuckets)
+{
+    UNREFERENCED_PARAMETER(payload);
+    UNREFERENCED_PARAMETER(bucketDuration);
+    UNREFERENCED_PARAMETER(numBuckets);
+
+    gpa_uint32 numEnabledCounters = 0;
+    m_functionTable.GPA_GetNumEnabledCounters(sessionId.m_value, &numEnabledCounters);
+
+    if (nullptr != buckets.m_value)
+    {
+        buckets.m_value = static_cast<GPA_StreamingCounterBucket*>(GetBuffer(0, maxBuckets.m_value * sizeof(GPA_StreamingCounterBucket)));
+    }
+
+    counterResults.m_value =
+        counterResults.m_isNull ? nullptr : GetBuffer(1, static_cast<size_t>(maxBuckets.m_value) * numEnabledCounters * sizeof(gpa_uint64));
+}
@@ -0,0 +1,606 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Replay of a GPA call trace against the mock GPA backend
+//==============================================================================
+
+#ifndef _GPA_CALL_REPLAYER_H_
+#define _GPA_CALL_REPLAYER_H_
+
+#include <chrono>
+#include <deque>
+#include <ostream>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "gpu_perf_api.h"
+#include "gpa_call_recorder.h"
+#include "gpa_call_trace.h"
+#include "mock_gpa_device.h"
+
+class GPACallReplayer;
+
+/// Sequence of indices, used to expand the arguments of a replayed call
+template <size_t... Indices>
+struct GPAIndexSequence
+{
+};
+
+/// Makes the sequence of indices from 0 to N - 1
+template <size_t N, size_t... Indices>
+struct GPAMakeIndexSequence : GPAMakeIndexSequence<N - 1, N - 1, Indices...>
+{
+};
+
+template <size_t... Indices>
+struct GPAMakeIndexSequence<0, Indices...>
+{
+    typedef GPAIndexSequence<Indices...> type;  ///< the sequence of indices
+};
+
+/// An argument of a replayed call, decoded from the trace. m_value holds the value passed to the entry point.
+template <typename T, GPACallArgKind kind = GPACallArgKindOf<T>::value>
+struct GPAReplayedArg;
+
+/// An integer or enum argument
+template <typename T>
+struct GPAReplayedArg<T, GPA_CALL_ARG_VALUE>
+{
+    /// Decodes the argument
+    /// \param[in,out] reader the reader of the call
+    /// \return false if the call is truncated
+    bool Decode(GPACallTraceReader& reader, GPACallReplayer&)
+    {
+        int64_t value = 0;
+
+        if (!reader.ReadInt(value))
+        {
+            return false;
+        }
+
+        m_value = static_cast<T>(value);
+        return true;
+    }
+
+    /// Completes the argument once the entry point returned
+    void Complete(GPACallReplayer&, bool)
+    {
+    }
+
+    T m_value{};  ///< the value of the argument
+};
+
+/// A handle argument, which is translated to the handle created by the replay
+template <typename T>
+struct GPAReplayedArg<T, GPA_CALL_ARG_HANDLE>
+{
+    /// Decodes the argument
+    /// \param[in,out] reader the reader of the call
+    /// \param[in] replayer the replayer, which holds the handles created by the replay
+    /// \return false if the call is truncated
+    bool Decode(GPACallTraceReader& reader, GPACallReplayer& replayer);
+
+    /// Completes the argument once the entry point returned
+    void Complete(GPACallReplayer&, bool)
+    {
+    }
+
+    gpa_uint64 m_id;     ///< the id of the handle in the trace
+    T          m_value;  ///< the handle created by the replay, null if the handle is unknown
+};
+
+/// A string argument
+template <typename T>
+struct GPAReplayedArg<T, GPA_CALL_ARG_STRING>
+{
+    /// Decodes the argument
+    /// \param[in,out] reader the reader of the call
+    /// \return false if the call is truncated
+    bool Decode(GPACallTraceReader& reader, GPACallReplayer&)
+    {
+        bool isNull = false;
+
+        if (!reader.ReadString(m_string, isNull))
+        {
+            return false;
+        }
+
+        m_value = isNull ? nullptr : m_string.c_str();
+        return true;
+    }
+
+    /// Completes the argument once the entry point returned
+    void Complete(GPACallReplayer&, bool)
+    {
+    }
+
+    std::string m_string;  ///< the characters of the string
+    T           m_value;   ///< the string, may be null
+};
+
+/// A structure argument
+template <typename T>
+struct GPAReplayedArg<T, GPA_CALL_ARG_STRUCT>
+{
+    /// Decodes the argument
+    /// \param[in,out] reader the reader of the call
+    /// \return false if the call is truncated
+    bool Decode(GPACallTraceReader& reader, GPACallReplayer&)
+    {
+        return reader.ReadBytes(&m_value, sizeof(T));
+    }
+
+    /// Completes the argument once the entry point returned
+    void Complete(GPACallReplayer&, bool)
+    {
+    }
+
+    T m_value;  ///< the structure
+};
+
+/// A pointer to opaque data or to a function. Only whether it was null is known: it is passed as null unless the
+/// replayer substitutes a value of its own for it.
+template <typename T>
+struct GPAReplayedArg<T, GPA_CALL_ARG_OPAQUE_POINTER>
+{
+    /// Decodes the argument
+    /// \param[in,out] reader the reader of the call
+    /// \return false if the call is truncated
+    bool Decode(GPACallTraceReader& reader, GPACallReplayer&)
+    {
+        gpa_uint64 state = 0;
+
+        if (!reader.ReadUInt(state))
+        {
+            return false;
+        }
+
+        m_isNull = GPACallTraceWriter::POINTER_NULL == state;
+        m_value  = nullptr;
+        return true;
+    }
+
+    /// Completes the argument once the entry point returned
+    void Complete(GPACallReplayer&, bool)
+    {
+    }
+
+    bool m_isNull;  ///< flag indicating whether the captured pointer was null
+    T    m_value;   ///< the pointer passed to the entry point
+};
+
+/// A pointer to a constant value
+template <typename T>
+struct GPAReplayedArg<const T*, GPA_CALL_ARG_INPUT_POINTER>
+{
+    /// Decodes the argument
+    /// \param[in,out] reader the reader of the call
+    /// \param[in] replayer the replayer
+    /// \return false if the call is truncated
+    bool Decode(GPACallTraceReader& reader, GPACallReplayer& replayer)
+    {
+        gpa_uint64 state = 0;
+
+        if (!reader.ReadUInt(state))
+        {
+            return false;
+        }
+
+        m_value = nullptr;
+
+        if (GPACallTraceWriter::POINTER_NULL == state)
+        {
+            return true;
+        }
+
+        m_value = &m_pointee.m_value;
+        return m_pointee.Decode(reader, replayer);
+    }
+
+    /// Completes the argument once the entry point returned
+    void Complete(GPACallReplayer&, bool)
+    {
+    }
+
+    GPAReplayedArg<T> m_pointee;  ///< the value pointed to
+    const T*          m_value;    ///< the pointer
+};
+
+/// A pointer to a value written by the call. The value captured is decoded, the value written by the replay is ignored,
+/// except for handles, which are associated with the handle id of the trace.
+template <typename T>
+struct GPAReplayedArg<T*, GPA_CALL_ARG_OUTPUT_POINTER>
+{
+    /// Decodes the argument
+    /// \param[in,out] reader the reader of the call
+    /// \param[in] replayer the replayer
+    /// \return false if the call is truncated
+    bool Decode(GPACallTraceReader& reader, GPACallReplayer& replayer)
+    {
+        gpa_uint64 state = 0;
+
+        if (!reader.ReadUInt(state))
+        {
+            return false;
+        }
+
+        m_state  = state;
+        m_output = T();
+        m_value  = GPACallTraceWriter::POINTER_NULL == state ? nullptr : &m_output;
+
+        return GPACallTraceWriter::POINTER_VALUE != state || m_captured.Decode(reader, replayer);
+    }
+
+    /// Completes the argument once the entry point returned
+    /// \param[in] replayer the replayer
+    /// \param[in] succeeded flag indicating whether the replayed call succeeded
+    void Complete(GPACallReplayer& replayer, bool succeeded)
+    {
+        Complete(replayer, succeeded, GPACallArgTag<T>());
+    }
+
+    /// Completes an output which is not a handle: nothing to do
+    template <GPACallArgKind kind>
+    void Complete(GPACallReplayer&, bool, std::integral_constant<GPACallArgKind, kind>)
+    {
+    }
+
+    /// Completes a handle output: the handle created by the replay is used in place of the handle of the trace
+    /// \param[in] replayer the replayer
+    /// \param[in] succeeded flag indicating whether the replayed call succeeded
+    void Complete(GPACallReplayer& replayer, bool succeeded, std::integral_constant<GPACallArgKind, GPA_CALL_ARG_HANDLE>);
+
+    gpa_uint64        m_state;     ///< the state of the captured pointer
+    GPAReplayedArg<T> m_captured;  ///< the value written by the captured call
+    T                 m_output;    ///< the value written by the replayed call
+    T*                m_value;     ///< the pointer passed to the entry point
+};
+
+/// Result of the replay of a call
+struct GPACallReplayResult
+{
+    gpa_uint64 m_duration;      ///< duration of the replayed call, in nanoseconds
+    bool       m_isSameResult;  ///< flag indicating whether the replayed call returned the value returned by the captured call
+};
+
+/// Statistics of the calls to an entry point during the replay
+struct GPACallReplayStatistics
+{
+    gpa_uint64              m_numCalls;          ///< number of calls replayed
+    gpa_uint64              m_numMismatches;     ///< number of calls which did not return what the captured call returned
+    std::vector<gpa_uint64> m_captureDurations;  ///< durations of the captured calls, in nanoseconds
+    std::vector<gpa_uint64> m_replayDurations;   ///< durations of the replayed calls, in nanoseconds
+};
+
+/// Replays a call trace written by GPACallCapture against the functions of a GPA function table, normally those of the
+/// mock backend, and measures how long each call takes.
+///
+/// The calls are replayed one after the other, in the order of the trace, whatever thread made them. The mock backend
+/// has no API of its own, so the replayer substitutes a simulated device (MockGPADevice) for the API context of each
+/// opened context, and GPA_NULL_COMMAND_LIST for each command list. The counter indices of the trace are translated
+/// through the counter names captured when each context was opened, since the mock backend may expose other counters.
+/// Result buffers are allocated by the replayer, with the size passed to the captured call.
+class GPACallReplayer
+{
+public:
+    /// Options of the replay
+    struct Options
+    {
+        gpa_uint32 m_deviceId;             ///< device id of the simulated devices, 0 to use the device ids of the trace
+        gpa_uint32 m_latencyMicroseconds;  ///< simulated time until the results of a sample are available
+    };
+
+    /// Initializes a new instance of the GPACallReplayer class
+    /// \param[in] functionTable the functions to replay the calls against
+    /// \param[in] options the options of the replay
+    GPACallReplayer(const GPAFunctionTable& functionTable, const Options& options);
+
+    /// Replays all of the calls of a trace once, adding the durations of the calls to the statistics
+    /// \param[in] trace the content of the trace
+    /// \param[out] error description of the error, if the trace is invalid
+    /// \return false if the trace is invalid or was captured by a build with unknown entry points
+    bool Replay(const std::string& trace, std::string& error);
+
+    /// Gets the statistics of the calls replayed so far
+    /// \return the statistics, indexed by GPA_ApiCallId
+    const std::vector<GPACallReplayStatistics>& GetStatistics() const
+    {
+        return m_statistics;
+    }
+
+    /// Writes the latency distribution of the calls to each entry point
+    /// \param[in,out] stream the stream to write to
+    void WriteReport(std::ostream& stream) const;
+
+    /// Gets the handle created by the replay for a handle of the trace
+    /// \param[in] handleId the id of the handle in the trace
+    /// \return the handle, null if the handle is null or unknown
+    void* GetHandle(gpa_uint64 handleId) const;
+
+    /// Sets the handle created by the replay for a handle of the trace
+    /// \param[in] handleId the id of the handle in the trace
+    /// \param[in] handle the handle created by the replay
+    void SetHandle(gpa_uint64 handleId, void* handle);
+
+private:
+    template <typename FunctionMember, FunctionMember pFunction, GPA_ApiCallId apiId>
+    friend struct GPAReplayedCall;
+
+    /// Function replaying a call, given the return value, arguments and payload of the captured call
+    typedef bool (*ReplayFunction)(GPACallReplayer& replayer, GPACallTraceReader& body, GPACallReplayResult& result);
+
+    /// Counter index of the trace without an equivalent counter in the replay
+    static const gpa_uint32 INVALID_COUNTER_INDEX = 0xFFFFFFFF;
+
+    /// Translates the counter index of a context from the trace to the replay
+    /// \param[in] contextId the context created by the replay
+    /// \param[in] counterIndex the counter index in the trace
+    /// \return the index of the counter with the same name in the replay
+    gpa_uint32 GetCounterIndex(GPA_ContextId contextId, gpa_uint32 counterIndex) const;
+
+    /// Gets a buffer for the replayed call to write to
+    /// \param[in] bufferIndex index of the buffer, for calls writing to several buffers
+    /// \param[in] size the size of the buffer in bytes
+    /// \return the buffer, valid until the next call
+    void* GetBuffer(size_t bufferIndex, size_t size);
+
+    /// Prepares the arguments of a replayed call: by default, they are replayed as captured
+    template <GPA_ApiCallId apiId, typename... ReplayedArgs>
+    void PrepareCall(std::integral_constant<GPA_ApiCallId, apiId>, GPACallTraceReader&, ReplayedArgs&...)
+    {
+    }
+
+    /// Translates the counter index of the calls describing a counter of a context
+    template <GPA_ApiCallId apiId, typename Output>
+    void PrepareCall(std::integral_constant<GPA_ApiCallId, apiId>,
+                     GPACallTraceReader&,
+                     GPAReplayedArg<GPA_ContextId>& contextId,
+                     GPAReplayedArg<gpa_uint32>&    counterIndex,
+                     GPAReplayedArg<Output*>&)
+    {
+        counterIndex.m_value = GetCounterIndex(contextId.m_value, counterIndex.m_value);
+    }
+
+    /// Substitutes a no-op callback for the logging callback of the application
+    void PrepareCall(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_RegisterLoggingCallback>,
+                     GPACallTraceReader&                         payload,
+                     GPAReplayedArg<GPA_Logging_Type>&           loggingType,
+                     GPAReplayedArg<GPA_LoggingCallbackPtrType>& callback);
+
+    /// Substitutes a simulated device for the API context, keeping the captured counter names for the counter index translation
+    void PrepareCall(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_OpenContext>,
+                     GPACallTraceReader&                   payload,
+                     GPAReplayedArg<void*>&                context,
+                     GPAReplayedArg<GPA_OpenContextFlags>& flags,
+                     GPAReplayedArg<GPA_ContextId*>&       contextId);
+
+    /// Translates the counter index of GPA_EnableCounter
+    void PrepareCall(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_EnableCounter>,
+                     GPACallTraceReader&            payload,
+                     GPAReplayedArg<GPA_SessionId>& sessionId,
+                     GPAReplayedArg<gpa_uint32>&    counterIndex);
+
+    /// Translates the counter index of GPA_DisableCounter
+    void PrepareCall(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_DisableCounter>,
+                     GPACallTraceReader&            payload,
+                     GPAReplayedArg<GPA_SessionId>& sessionId,
+                     GPAReplayedArg<gpa_uint32>&    counterIndex);
+
+    /// Translates the counter index of GPA_IsCounterEnabled
+    void PrepareCall(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_IsCounterEnabled>,
+                     GPACallTraceReader&            payload,
+                     GPAReplayedArg<GPA_SessionId>& sessionId,
+                     GPAReplayedArg<gpa_uint32>&    counterIndex);
+
+    /// Substitutes GPA_NULL_COMMAND_LIST for the command list of the application
+    void PrepareCall(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_BeginCommandList>,
+                     GPACallTraceReader&                    payload,
+                     GPAReplayedArg<GPA_SessionId>&         sessionId,
+                     GPAReplayedArg<gpa_uint32>&            passIndex,
+                     GPAReplayedArg<void*>&                 commandList,
+                     GPAReplayedArg<GPA_Command_List_Type>& commandListType,
+                     GPAReplayedArg<GPA_CommandListId*>&    commandListId);
+
+    /// Allocates the new sample ids of GPA_CopySecondarySamples
+    void PrepareCall(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_CopySecondarySamples>,
+                     GPACallTraceReader&                payload,
+                     GPAReplayedArg<GPA_CommandListId>& secondaryCommandListId,
+                     GPAReplayedArg<GPA_CommandListId>& primaryCommandListId,
+                     GPAReplayedArg<gpa_uint32>&        numSamples,
+                     GPAReplayedArg<gpa_uint32*>&       newSampleIds);
+
+    /// Allocates the results of GPA_GetSampleResult
+    void PrepareCall(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_GetSampleResult>,
+                     GPACallTraceReader&            payload,
+                     GPAReplayedArg<GPA_SessionId>& sessionId,
+                     GPAReplayedArg<gpa_uint32>&    sampleId,
+                     GPAReplayedArg<size_t>&        sampleResultSizeInBytes,
+                     GPAReplayedArg<void*>&         counterSampleResults);
+
+    /// Allocates the results of GPA_GetSessionResultsByCounter
+    void PrepareCall(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_GetSessionResultsByCounter>,
+                     GPACallTraceReader&            payload,
+                     GPAReplayedArg<GPA_SessionId>& sessionId,
+                     GPAReplayedArg<size_t>&        resultsSizeInBytes,
+                     GPAReplayedArg<void*>&         counterResults);
+
+    /// Allocates the results of GPA_GetPartialSampleResult
+    void PrepareCall(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_GetPartialSampleResult>,
+                     GPACallTraceReader&            payload,
+                     GPAReplayedArg<GPA_SessionId>& sessionId,
+                     GPAReplayedArg<gpa_uint32>&    sampleId,
+                     GPAReplayedArg<size_t>&        sampleResultSizeInBytes,
+                     GPAReplayedArg<void*>&         counterSampleResults,
+                     GPAReplayedArg<gpa_uint8*>&    counterResultAvailable);
+
+    /// Allocates the buckets and results of GPA_GetStreamingCounterResults
+    void PrepareCall(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_GetStreamingCounterResults>,
+                     GPACallTraceReader&                          payload,
+                     GPAReplayedArg<GPA_SessionId>&               sessionId,
+                     GPAReplayedArg<gpa_uint64>&                  bucketDuration,
+                     GPAReplayedArg<gpa_uint32>&                  maxBuckets,
+                     GPAReplayedArg<GPA_StreamingCounterBucket*>& buckets,
+                     GPAReplayedArg<void*>&                       counterResults,
+                     GPAReplayedArg<gpa_uint32*>&                 numBuckets);
+
+    /// Completes a replayed call: by default, there is nothing to do
+    template <GPA_ApiCallId apiId, typename Ret, typename... ReplayedArgs>
+    void CompleteCall(std::integral_constant<GPA_ApiCallId, apiId>, Ret, ReplayedArgs&...)
+    {
+    }
+
+    /// Maps the counters of the trace to the counters of the opened context
+    void CompleteCall(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_OpenContext>,
+                      GPA_Status                            status,
+                      GPAReplayedArg<void*>&                context,
+                      GPAReplayedArg<GPA_OpenContextFlags>& flags,
+                      GPAReplayedArg<GPA_ContextId*>&       contextId);
+
+    /// Keeps the context of the created session, for the counter index translation
+    void CompleteCall(std::integral_constant<GPA_ApiCallId, GPA_API_CALL_ID_GPA_CreateSession>,
+                      GPA_Status                               status,
+                      GPAReplayedArg<GPA_ContextId>&           contextId,
+                      GPAReplayedArg<GPA_Session_Sample_Type>& sampleType,
+                      GPAReplayedArg<GPA_SessionId*>&          sessionId);
+
+    /// Indicates whether a call succeeded
+    /// \param[in] status the status returned by the call
+    /// \return true if the call succeeded
+    static bool IsSuccess(GPA_Status status)
+    {
+        return GPA_STATUS_OK == status;
+    }
+
+    /// Indicates whether a call succeeded, for the entry points which do not return a status
+    /// \return true
+    static bool IsSuccess(const char*)
+    {
+        return true;
+    }
+
+    /// Indicates whether a replayed call returned what the captured call returned
+    /// \param[in] capturedStatus the status returned by the captured call
+    /// \param[in] status the status returned by the replayed call
+    /// \return true if the statuses are the same
+    static bool IsSameResult(GPA_Status capturedStatus, GPA_Status status)
+    {
+        return capturedStatus == status;
+    }
+
+    /// Indicates whether a replayed call returned what the captured call returned, for GPA_GetStatusAsStr
+    /// \param[in] pCapturedString the string returned by the captured call
+    /// \param[in] pString the string returned by the replayed call
+    /// \return true if the strings are the same
+    static bool IsSameResult(const char* pCapturedString, const char* pString);
+
+    GPAFunctionTable                                           m_functionTable;       ///< the functions to replay the calls against
+    Options                                                    m_options;             ///< the options of the replay
+    std::vector<ReplayFunction>                                m_replayFunctions;     ///< the functions replaying each entry point, indexed by GPA_ApiCallId
+    std::vector<GPACallReplayStatistics>                       m_statistics;          ///< the statistics of each entry point, indexed by GPA_ApiCallId
+    std::unordered_map<gpa_uint64, void*>                      m_handles;             ///< the handles created by the replay, by handle id of the trace
+    std::deque<MockGPADevice>                                  m_devices;             ///< the simulated devices of the opened contexts
+    std::vector<std::string>                                   m_openedCounterNames;  ///< the counter names of the context being opened
+    std::unordered_map<GPA_ContextId, std::vector<gpa_uint32>> m_counterIndices;      ///< the counter index translation of each context
+    std::unordered_map<GPA_SessionId, GPA_ContextId>           m_sessionContexts;     ///< the context of each session
+    std::vector<gpa_uint64>                                    m_buffers[2];          ///< the buffers written by the replayed calls
+};
+
+template <typename T>
+bool GPAReplayedArg<T, GPA_CALL_ARG_HANDLE>::Decode(GPACallTraceReader& reader, GPACallReplayer& replayer)
+{
+    if (!reader.ReadUInt(m_id))
+    {
+        return false;
+    }
+
+    m_value = static_cast<T>(replayer.GetHandle(m_id));
+    return true;
+}
+
+template <typename T>
+void GPAReplayedArg<T*, GPA_CALL_ARG_OUTPUT_POINTER>::Complete(GPACallReplayer& replayer,
+                                                               bool             succeeded,
+                                                               std::integral_constant<GPACallArgKind, GPA_CALL_ARG_HANDLE>)
+{
+    if (succeeded && GPACallTraceWriter::POINTER_VALUE == m_state && 0 != m_captured.m_id)
+    {
+        replayer.SetHandle(m_captured.m_id, m_output);
+    }
+}
+
+/// Function replaying the calls to a GPA entry point
+template <typename FunctionMember, FunctionMember pFunction, GPA_ApiCallId apiId>
+struct GPAReplayedCall;
+
+template <typename Ret, typename... Args, Ret (*GPAFunctionTable::*pFunction)(Args...), GPA_ApiCallId apiId>
+struct GPAReplayedCall<Ret (*GPAFunctionTable::*)(Args...), pFunction, apiId>
+{
+    /// Replays a call
+    /// \param[in] replayer the replayer
+    /// \param[in,out] body the reader of the return value, arguments and payload of the captured call
+    /// \param[out] result the result of the replay
+    /// \return false if the call is truncated
+    static bool Replay(GPACallReplayer& replayer, GPACallTraceReader& body, GPACallReplayResult& result)
+    {
+        return Replay(replayer, body, result, typename GPAMakeIndexSequence<sizeof...(Args)>::type());
+    }
+
+    /// Replays a call
+    /// \param[in] replayer the replayer
+    /// \param[in,out] body the reader of the return value, arguments and payload of the captured call
+    /// \param[out] result the result of the replay
+    /// \return false if the call is truncated
+    template <size_t... Indices>
+    static bool Replay(GPACallReplayer& replayer, GPACallTraceReader& body, GPACallReplayResult& result, GPAIndexSequence<Indices...>)
+    {
+        GPAReplayedArg<Ret>                 capturedRetVal{};
+        std::tuple<GPAReplayedArg<Args>...> args;
+        GPACallTraceReader                  payload(nullptr, 0);
+
+        // the return value is written first: without it, there is nothing to compare the replayed call against
+        if (!capturedRetVal.Decode(body, replayer))
+        {
+            result.m_isSameResult = false;
+            return false;
+        }
+
+        // the arguments are decoded in order, as they were written; the leading element keeps the array non-empty
+        const bool decoded[] = {true, std::get<Indices>(args).Decode(body, replayer)...};
+
+        for (bool isDecoded : decoded)
+        {
+            if (!isDecoded)
+            {
+                return false;
+            }
+        }
+
+        if (!body.ReadSizedData(payload))
+        {
+            return false;
+        }
+
+        std::integral_constant<GPA_ApiCallId, apiId> apiTag;
+        replayer.PrepareCall(apiTag, payload, std::get<Indices>(args)...);
+
+        std::chrono::steady_clock::time_point start  = std::chrono::steady_clock::now();
+        Ret                                   retVal = (replayer.m_functionTable.*pFunction)(std::get<Indices>(args).m_value...);
+        std::chrono::steady_clock::time_point end    = std::chrono::steady_clock::now();
+
+        result.m_duration     = static_cast<gpa_uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        result.m_isSameResult = GPACallReplayer::IsSameResult(capturedRetVal.m_value, retVal);
+
+        const bool succeeded   = GPACallReplayer::IsSuccess(retVal);
+        const int  completed[] = {0, (std::get<Indices>(args).Complete(replayer, succeeded), 0)...};
+        UNREFERENCED_PARAMETER(completed);
+        UNREFERENCED_PARAMETER(succeeded);
+
+        replayer.CompleteCall(apiTag, retVal, std::get<Indices>(args)...);
+        return true;
+    }
+};
+
+#endif  // _GPA_CALL_REPLAYER_H_
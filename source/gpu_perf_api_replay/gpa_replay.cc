@@ -0,0 +1,132 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Replays a GPA call trace against the mock backend and reports the latency of each entry point
+//==============================================================================
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include "gpa_call_replayer.h"
+
+/// Parses an unsigned option value
+/// \param[in] pValue the option value, may be null if the option was the last argument
+/// \param[in] minValue the smallest accepted value
+/// \param[in] maxValue the largest accepted value
+/// \param[out] value the parsed value
+/// \return true if the value is valid
+static bool ParseOption(const char* pValue, gpa_uint32 minValue, gpa_uint32 maxValue, gpa_uint32& value)
+{
+    if (nullptr == pValue)
+    {
+        return false;
+    }
+
+    char*         pEnd        = nullptr;
+    unsigned long parsedValue = strtoul(pValue, &pEnd, 0);
+
+    if ('\0' != *pEnd || parsedValue < minValue || parsedValue > maxValue)
+    {
+        return false;
+    }
+
+    value = static_cast<gpa_uint32>(parsedValue);
+    return true;
+}
+
+/// Prints the usage of the replay tool
+/// \param[in] pExecutable the name of the executable
+static void PrintUsage(const char* pExecutable)
+{
+    std::cout << "Usage: " << pExecutable << " [options] <trace file>" << std::endl
+              << "Replays a trace captured with GPA_CALL_CAPTURE_FILE against the mock backend." << std::endl
+              << "  --iterations <n>           number of times the trace is replayed (default 1)" << std::endl
+              << "  --device-id <id>           device id of the simulated devices, 0 for the device ids of the trace (default 0)" << std::endl
+              << "  --latency-us <n>           simulated time until the results of a sample are available (default 0)" << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    GPACallReplayer::Options options       = {0, 0};
+    gpa_uint32               numIterations = 1;
+    const char*              pTraceFile    = nullptr;
+
+    for (int argIndex = 1; argIndex < argc; ++argIndex)
+    {
+        const char* pArg   = argv[argIndex];
+        const char* pValue = argIndex + 1 < argc ? argv[argIndex + 1] : nullptr;
+        bool        valid  = false;
+
+        if (0 == strcmp(pArg, "--iterations"))
+        {
+            valid = ParseOption(pValue, 1, 0x7FFFFFFF, numIterations);
+        }
+        else if (0 == strcmp(pArg, "--device-id"))
+        {
+            valid = ParseOption(pValue, 0, 0xFFFF, options.m_deviceId);
+        }
+        else if (0 == strcmp(pArg, "--latency-us"))
+        {
+            valid = ParseOption(pValue, 0, 10000000, options.m_latencyMicroseconds);
+        }
+        else if (nullptr == pTraceFile && '-' != *pArg)
+        {
+            pTraceFile = pArg;
+            continue;
+        }
+
+        if (!valid)
+        {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+
+        ++argIndex;
+    }
+
+    if (nullptr == pTraceFile)
+    {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::ifstream traceFile(pTraceFile, std::ios_base::in | std::ios_base::binary);
+
+    if (!traceFile.is_open())
+    {
+        std::cerr << "Unable to open " << pTraceFile << std::endl;
+        return 1;
+    }
+
+    std::ostringstream traceStream;
+    traceStream << traceFile.rdbuf();
+    const std::string trace = traceStream.str();
+
+    GPAFunctionTable functionTable = {};
+
+    if (GPA_STATUS_OK != GPA_GetFuncTable(&functionTable))
+    {
+        std::cerr << "GPA_GetFuncTable failed" << std::endl;
+        return 1;
+    }
+
+    GPACallReplayer replayer(functionTable, options);
+    std::string     error;
+
+    for (gpa_uint32 iteration = 0; iteration < numIterations; ++iteration)
+    {
+        if (!replayer.Replay(trace, error))
+        {
+            std::cerr << pTraceFile << ": " << error << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << "Trace:                 " << pTraceFile << std::endl << "Iterations:            " << numIterations << std::endl << std::endl;
+    replayer.WriteReport(std::cout);
+    return 0;
+}
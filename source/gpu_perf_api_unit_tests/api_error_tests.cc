@@ -108,6 +108,16 @@ TEST_P(GPAAPIErrorTest, TestGPA_RegisterLoggingCallback)
     EXPECT_EQ(GPA_STATUS_OK, status);
 }
 
+TEST_P(GPAAPIErrorTest, TestGPA_SetCounterCacheFilePath)
+{
+    // both disable the cache, which is the default
+    GPA_Status status = m_pGpaFuncTable->GPA_SetCounterCacheFilePath(nullptr);
+    EXPECT_EQ(GPA_STATUS_OK, status);
+
+    status = m_pGpaFuncTable->GPA_SetCounterCacheFilePath("");
+    EXPECT_EQ(GPA_STATUS_OK, status);
+}
+
 TEST_P(GPAAPIErrorTest, TestGPA_InitializeAndDestroy)
 {
     GPA_Status status = m_pGpaFuncTable->GPA_Destroy();
@@ -444,6 +454,26 @@ TEST_P(GPAAPIErrorTest, TestGPA_CounterInterrogation)
     status      = m_pGpaFuncTable->GPA_GetCounterUuid(badContextId, static_cast<gpa_uint32>(-1), &counterUUID);
     EXPECT_EQ(GPA_STATUS_ERROR_CONTEXT_NOT_FOUND, status);
 
+    // GPA_GetCounterIndexByUuid
+    status = m_pGpaFuncTable->GPA_GetCounterIndexByUuid(nullptr, nullptr, nullptr);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    counterUUID = {};
+    status      = m_pGpaFuncTable->GPA_GetCounterIndexByUuid(nullptr, &counterUUID, nullptr);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_GetCounterIndexByUuid(nullptr, nullptr, &index);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_GetCounterIndexByUuid(nullptr, &counterUUID, &index);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_GetCounterIndexByUuid(badContextId, &counterUUID, nullptr);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_GetCounterIndexByUuid(badContextId, &counterUUID, &index);
+    EXPECT_EQ(GPA_STATUS_ERROR_CONTEXT_NOT_FOUND, status);
+
     // GPA_GetCounterSampleTypes
     status = m_pGpaFuncTable->GPA_GetCounterSampleType(nullptr, 0, nullptr);
     EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
@@ -622,6 +652,92 @@ TEST_P(GPAAPIErrorTest, TestGPA_SessionHandling)
 
     status = m_pGpaFuncTable->GPA_EndSession(sessionId);
     EXPECT_EQ(GPA_STATUS_ERROR_SESSION_NOT_FOUND, status);
+
+    // GPA_ResetSession
+    status = m_pGpaFuncTable->GPA_ResetSession(nullptr);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_ResetSession(sessionId);
+    EXPECT_EQ(GPA_STATUS_ERROR_SESSION_NOT_FOUND, status);
+
+    // GPA_SetSessionMaxSampleIdHint
+    status = m_pGpaFuncTable->GPA_SetSessionMaxSampleIdHint(nullptr, 0);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_SetSessionMaxSampleIdHint(sessionId, 0x7FFFFFFF);
+    EXPECT_EQ(GPA_STATUS_ERROR_SESSION_NOT_FOUND, status);
+
+    // GPA_GetMemoryStats
+    gpa_uint64 numBytes   = 0;
+    gpa_uint64 numObjects = 0;
+    status                = m_pGpaFuncTable->GPA_GetMemoryStats(GPA_MEMORY_CATEGORY_SESSION, nullptr, &numObjects);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_GetMemoryStats(GPA_MEMORY_CATEGORY_SESSION, &numBytes, nullptr);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_GetMemoryStats(GPA_MEMORY_CATEGORY__LAST, &numBytes, &numObjects);
+    EXPECT_EQ(GPA_STATUS_ERROR_INVALID_PARAMETER, status);
+
+    status = m_pGpaFuncTable->GPA_GetMemoryStats(static_cast<GPA_Memory_Category>(0xFFFF), &numBytes, &numObjects);
+    EXPECT_EQ(GPA_STATUS_ERROR_INVALID_PARAMETER, status);
+
+    status = m_pGpaFuncTable->GPA_GetMemoryStats(GPA_MEMORY_CATEGORY_SESSION, &numBytes, &numObjects);
+    EXPECT_EQ(GPA_STATUS_OK, status);
+
+    // GPA_CreateCounterStatistics
+    GPA_CounterStatisticsId counterStatisticsId    = nullptr;
+    GPA_CounterStatisticsId badCounterStatisticsId = reinterpret_cast<GPA_CounterStatisticsId>(0xBADF00D);
+    status                                         = m_pGpaFuncTable->GPA_CreateCounterStatistics(nullptr);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_CreateCounterStatistics(&counterStatisticsId);
+    EXPECT_EQ(GPA_STATUS_OK, status);
+    EXPECT_NE(nullptr, counterStatisticsId);
+
+    // GPA_AccumulateCounterStatistics
+    status = m_pGpaFuncTable->GPA_AccumulateCounterStatistics(nullptr, sessionId);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_AccumulateCounterStatistics(badCounterStatisticsId, sessionId);
+    EXPECT_EQ(GPA_STATUS_ERROR_INVALID_PARAMETER, status);
+
+    status = m_pGpaFuncTable->GPA_AccumulateCounterStatistics(counterStatisticsId, nullptr);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_AccumulateCounterStatistics(counterStatisticsId, sessionId);
+    EXPECT_EQ(GPA_STATUS_ERROR_SESSION_NOT_FOUND, status);
+
+    // GPA_MergeCounterStatistics
+    status = m_pGpaFuncTable->GPA_MergeCounterStatistics(counterStatisticsId, nullptr);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_MergeCounterStatistics(badCounterStatisticsId, counterStatisticsId);
+    EXPECT_EQ(GPA_STATUS_ERROR_INVALID_PARAMETER, status);
+
+    status = m_pGpaFuncTable->GPA_MergeCounterStatistics(counterStatisticsId, counterStatisticsId);
+    EXPECT_EQ(GPA_STATUS_ERROR_INVALID_PARAMETER, status);
+
+    // GPA_GetCounterStatistics
+    GPA_CounterStatistics counterStatistics = {};
+    status                                  = m_pGpaFuncTable->GPA_GetCounterStatistics(counterStatisticsId, 0, nullptr);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_GetCounterStatistics(badCounterStatisticsId, 0, &counterStatistics);
+    EXPECT_EQ(GPA_STATUS_ERROR_INVALID_PARAMETER, status);
+
+    status = m_pGpaFuncTable->GPA_GetCounterStatistics(counterStatisticsId, 0, &counterStatistics);
+    EXPECT_EQ(GPA_STATUS_ERROR_COUNTER_NOT_FOUND, status);
+
+    // GPA_DeleteCounterStatistics
+    status = m_pGpaFuncTable->GPA_DeleteCounterStatistics(nullptr);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_DeleteCounterStatistics(counterStatisticsId);
+    EXPECT_EQ(GPA_STATUS_OK, status);
+
+    status = m_pGpaFuncTable->GPA_DeleteCounterStatistics(counterStatisticsId);
+    EXPECT_EQ(GPA_STATUS_ERROR_INVALID_PARAMETER, status);
 }
 
 TEST_P(GPAAPIErrorTest, TestGPA_CounterScheduling)
@@ -852,6 +968,34 @@ TEST_P(GPAAPIErrorTest, TestGPA_SampleHandling)
     status = m_pGpaFuncTable->GPA_EndSample(badCommandList);
     EXPECT_EQ(GPA_STATUS_ERROR_COMMAND_LIST_NOT_FOUND, status);
 
+    // GPA_BeginSampleBlock
+    GPA_SampleBlockId sampleBlockId = nullptr;
+    status                          = m_pGpaFuncTable->GPA_BeginSampleBlock(nullptr, 0, 1, nullptr);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_BeginSampleBlock(nullptr, 0, 1, &sampleBlockId);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_BeginSampleBlock(badCommandList, 0, 1, &sampleBlockId);
+    EXPECT_EQ(GPA_STATUS_ERROR_COMMAND_LIST_NOT_FOUND, status);
+    EXPECT_EQ(nullptr, sampleBlockId);
+
+    // GPA_BeginBlockSample
+    status = m_pGpaFuncTable->GPA_BeginBlockSample(nullptr);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    // GPA_EndBlockSample
+    status = m_pGpaFuncTable->GPA_EndBlockSample(nullptr);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    // GPA_EndSampleBlock
+    status = m_pGpaFuncTable->GPA_EndSampleBlock(nullptr);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    GPA_SampleBlockId badSampleBlock = reinterpret_cast<GPA_SampleBlockId>(0xBADF00D);
+    status                           = m_pGpaFuncTable->GPA_EndSampleBlock(badSampleBlock);
+    EXPECT_EQ(GPA_STATUS_ERROR_INVALID_PARAMETER, status);
+
     // GPA_ContinueSampleOnCommandList
     status = m_pGpaFuncTable->GPA_ContinueSampleOnCommandList(0, nullptr);
 
@@ -1205,6 +1349,98 @@ TEST_P(GPAAPIErrorTest, TestGPA_QueryResults)
 
     status = m_pGpaFuncTable->GPA_GetSampleResult(badSession, 0, 0x7FFFFFFF, reinterpret_cast<void*>(this));
     EXPECT_EQ(GPA_STATUS_ERROR_SESSION_NOT_FOUND, status);
+
+    // GPA_GetPartialSampleResult
+    gpa_uint8 counterResultAvailable = 0;
+
+    status = m_pGpaFuncTable->GPA_GetPartialSampleResult(nullptr, 0, 0, nullptr, nullptr);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_GetPartialSampleResult(nullptr, 0, 0, reinterpret_cast<void*>(this), nullptr);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_GetPartialSampleResult(nullptr, 0, 0, nullptr, &counterResultAvailable);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_GetPartialSampleResult(nullptr, 0, 0, reinterpret_cast<void*>(this), &counterResultAvailable);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_GetPartialSampleResult(badSession, 0, 0, reinterpret_cast<void*>(this), nullptr);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_GetPartialSampleResult(badSession, 0, 0, reinterpret_cast<void*>(this), &counterResultAvailable);
+    EXPECT_EQ(GPA_STATUS_ERROR_SESSION_NOT_FOUND, status);
+
+    status = m_pGpaFuncTable->GPA_GetPartialSampleResult(badSession, 0x7FFFFFFF, 0x7FFFFFFF, reinterpret_cast<void*>(this), &counterResultAvailable);
+    EXPECT_EQ(GPA_STATUS_ERROR_SESSION_NOT_FOUND, status);
+
+    // GPA_GetSessionResultsByCounter
+    status = m_pGpaFuncTable->GPA_GetSessionResultsByCounter(nullptr, 0, nullptr);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_GetSessionResultsByCounter(nullptr, 0x7FFFFFFF, nullptr);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_GetSessionResultsByCounter(nullptr, 0, reinterpret_cast<void*>(this));
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_GetSessionResultsByCounter(badSession, 0, nullptr);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_GetSessionResultsByCounter(badSession, 0, reinterpret_cast<void*>(this));
+    EXPECT_EQ(GPA_STATUS_ERROR_SESSION_NOT_FOUND, status);
+
+    status = m_pGpaFuncTable->GPA_GetSessionResultsByCounter(badSession, 0x7FFFFFFF, reinterpret_cast<void*>(this));
+    EXPECT_EQ(GPA_STATUS_ERROR_SESSION_NOT_FOUND, status);
+
+    // GPA_GetStreamingCounterResults
+    GPA_StreamingCounterBucket bucket     = {};
+    gpa_uint32                 numBuckets = 0;
+    status                                = m_pGpaFuncTable->GPA_GetStreamingCounterResults(nullptr, 4096, 1, nullptr, nullptr, nullptr);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_GetStreamingCounterResults(nullptr, 4096, 1, &bucket, reinterpret_cast<void*>(this), &numBuckets);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_GetStreamingCounterResults(badSession, 4096, 1, nullptr, reinterpret_cast<void*>(this), &numBuckets);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_GetStreamingCounterResults(badSession, 4096, 1, &bucket, nullptr, &numBuckets);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_GetStreamingCounterResults(badSession, 4096, 1, &bucket, reinterpret_cast<void*>(this), nullptr);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_GetStreamingCounterResults(badSession, 4096, 1, &bucket, reinterpret_cast<void*>(this), &numBuckets);
+    EXPECT_EQ(GPA_STATUS_ERROR_SESSION_NOT_FOUND, status);
+
+    // GPA_GetSQTTChunkCount
+    gpa_uint32 chunkCount = 0;
+    status                = m_pGpaFuncTable->GPA_GetSQTTChunkCount(nullptr, nullptr);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_GetSQTTChunkCount(nullptr, &chunkCount);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_GetSQTTChunkCount(badSession, nullptr);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_GetSQTTChunkCount(badSession, &chunkCount);
+    EXPECT_EQ(GPA_STATUS_ERROR_SESSION_NOT_FOUND, status);
+
+    // GPA_GetSQTTChunk
+    GPA_SQTTChunkView chunkView = {};
+    status                      = m_pGpaFuncTable->GPA_GetSQTTChunk(nullptr, 0, nullptr);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_GetSQTTChunk(nullptr, 0, &chunkView);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_GetSQTTChunk(badSession, 0, nullptr);
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, status);
+
+    status = m_pGpaFuncTable->GPA_GetSQTTChunk(badSession, 0, &chunkView);
+    EXPECT_EQ(GPA_STATUS_ERROR_SESSION_NOT_FOUND, status);
 }
 
 TEST_P(GPAAPIErrorTest, TestGPA_StatusErrorQuery)
@@ -1292,7 +1528,7 @@ TEST_P(GPAAPIErrorTest, TestGPA_GPAFunctionTable)
     EXPECT_EQ(m_pGpaFuncTable->m_majorVer, GPA_FUNCTION_TABLE_MAJOR_VERSION_NUMBER);
     EXPECT_EQ(m_pGpaFuncTable->m_minorVer, GPA_FUNCTION_TABLE_MINOR_VERSION_NUMBER);
     // Note: Whenever GPA function table changes, we need to update this with the last function in the GPA function table
-    EXPECT_EQ(nullptr, pFuncTable->GPA_GetVersion);
+    EXPECT_EQ(nullptr, pFuncTable->GPA_GetSQTTChunk);
 
     delete pFuncTable;
 }
@@ -0,0 +1,289 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Unit tests for the capture of the calls made through the GPA function table
+//==============================================================================
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "gpa_call_capture.h"
+#include "utility.h"
+
+/// Context returned by the fake entry points
+static int s_fakeContext = 0;
+
+/// Session returned by the fake entry points
+static int s_fakeSession = 0;
+
+/// Names of the counters of the fake context
+static const char* const FAKE_COUNTER_NAMES[] = {"GPUTime", "VALUBusy"};
+
+/// Fake entry points, to which the captured calls are forwarded
+static GPA_Status FakeOpenContext(void* pContext, GPA_OpenContextFlags flags, GPA_ContextId* pContextId)
+{
+    UNREFERENCED_PARAMETER(pContext);
+    UNREFERENCED_PARAMETER(flags);
+    *pContextId = reinterpret_cast<GPA_ContextId>(&s_fakeContext);
+    return GPA_STATUS_OK;
+}
+
+static GPA_Status FakeGetDeviceAndRevisionId(GPA_ContextId contextId, gpa_uint32* pDeviceId, gpa_uint32* pRevisionId)
+{
+    UNREFERENCED_PARAMETER(contextId);
+    *pDeviceId   = 0x6863;
+    *pRevisionId = 0xC1;
+    return GPA_STATUS_OK;
+}
+
+static GPA_Status FakeGetNumCounters(GPA_ContextId contextId, gpa_uint32* pCount)
+{
+    UNREFERENCED_PARAMETER(contextId);
+    *pCount = 2;
+    return GPA_STATUS_OK;
+}
+
+static GPA_Status FakeGetCounterName(GPA_ContextId contextId, gpa_uint32 index, const char** ppName)
+{
+    UNREFERENCED_PARAMETER(contextId);
+    *ppName = FAKE_COUNTER_NAMES[index];
+    return GPA_STATUS_OK;
+}
+
+static GPA_Status FakeCreateSession(GPA_ContextId contextId, GPA_Session_Sample_Type sampleType, GPA_SessionId* pSessionId)
+{
+    UNREFERENCED_PARAMETER(contextId);
+    UNREFERENCED_PARAMETER(sampleType);
+    *pSessionId = reinterpret_cast<GPA_SessionId>(&s_fakeSession);
+    return GPA_STATUS_OK;
+}
+
+static GPA_Status FakeEnableCounter(GPA_SessionId sessionId, gpa_uint32 index)
+{
+    return nullptr != sessionId && index < 2 ? GPA_STATUS_OK : GPA_STATUS_ERROR_NULL_POINTER;
+}
+
+static GPA_Status FakeGetSampleResultSize(GPA_SessionId sessionId, gpa_uint32 sampleId, size_t* pSampleResultSizeInBytes)
+{
+    UNREFERENCED_PARAMETER(sessionId);
+    UNREFERENCED_PARAMETER(sampleId);
+    UNREFERENCED_PARAMETER(pSampleResultSizeInBytes);
+
+    // the output is not written when the call fails
+    return GPA_STATUS_ERROR_SAMPLE_NOT_FOUND;
+}
+
+static GPA_Status FakeGetSampleResult(GPA_SessionId sessionId, gpa_uint32 sampleId, size_t sampleResultSizeInBytes, void* pCounterSampleResults)
+{
+    UNREFERENCED_PARAMETER(sessionId);
+    gpa_uint64* pResults = static_cast<gpa_uint64*>(pCounterSampleResults);
+
+    for (size_t resultIndex = 0; resultIndex < sampleResultSizeInBytes / sizeof(gpa_uint64); ++resultIndex)
+    {
+        pResults[resultIndex] = sampleId * 100 + resultIndex;
+    }
+
+    return GPA_STATUS_OK;
+}
+
+/// Reads a whole file
+/// \param filePath the path of the file
+/// \return the content of the file
+static std::string ReadFile(const std::string& filePath)
+{
+    std::ifstream      file(filePath.c_str(), std::ios_base::in | std::ios_base::binary);
+    std::ostringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+/// Reads the next record of a call trace and its return value
+/// \param reader the reader of the trace
+/// \param previousStartTime the start time of the previous record
+/// \param apiId the expected entry point
+/// \param expectedStatus the expected status returned by the call
+/// \return a reader of the arguments and payload of the call
+static GPACallTraceReader ReadCall(GPACallTraceReader& reader, gpa_uint64& previousStartTime, GPA_ApiCallId apiId, GPA_Status expectedStatus)
+{
+    GPACallTraceCall   call;
+    GPACallTraceReader body(nullptr, 0);
+    int64_t            status = 0;
+
+    EXPECT_TRUE(GPA_ReadCallTraceRecord(reader, previousStartTime, call, body));
+    EXPECT_EQ(static_cast<gpa_uint32>(apiId), call.m_apiId);
+    EXPECT_EQ(0u, call.m_threadIndex);
+    EXPECT_TRUE(body.ReadInt(status));
+    EXPECT_EQ(expectedStatus, static_cast<GPA_Status>(status));
+    return body;
+}
+
+/// Reads an unsigned value of a call trace
+/// \param reader the reader of the trace
+/// \return the value
+static gpa_uint64 ReadUInt(GPACallTraceReader& reader)
+{
+    gpa_uint64 value = 0;
+    EXPECT_TRUE(reader.ReadUInt(value));
+    return value;
+}
+
+TEST(GPUPerfAPICallCaptureTests, CapturesCallsThroughFunctionTable)
+{
+    std::string traceFilePath;
+    ASSERT_TRUE(GPAUtil::CreateTempFile("GPA-CallTrace-Test-", ".bin", traceFilePath));
+    ASSERT_TRUE(g_callCapture.Start(traceFilePath));
+
+    // the constructor of the table sets its version and nulls its functions
+    GPAFunctionTable functionTable = {};
+    EXPECT_EQ(GPA_FUNCTION_TABLE_MAJOR_VERSION_NUMBER, functionTable.m_majorVer);
+    EXPECT_EQ(GPA_FUNCTION_TABLE_MINOR_VERSION_NUMBER, functionTable.m_minorVer);
+    EXPECT_EQ(nullptr, functionTable.GPA_BeginSession);
+
+    functionTable.GPA_OpenContext            = FakeOpenContext;
+    functionTable.GPA_GetDeviceAndRevisionId = FakeGetDeviceAndRevisionId;
+    functionTable.GPA_GetNumCounters         = FakeGetNumCounters;
+    functionTable.GPA_GetCounterName         = FakeGetCounterName;
+    functionTable.GPA_CreateSession          = FakeCreateSession;
+    functionTable.GPA_EnableCounter          = FakeEnableCounter;
+    functionTable.GPA_GetSampleResultSize    = FakeGetSampleResultSize;
+    functionTable.GPA_GetSampleResult        = FakeGetSampleResult;
+    g_callCapture.WrapFunctionTable(functionTable);
+    EXPECT_NE(static_cast<GPA_OpenContextPtrType>(FakeOpenContext), functionTable.GPA_OpenContext);
+
+    int           apiContext = 0;
+    GPA_ContextId contextId  = nullptr;
+    GPA_SessionId sessionId  = nullptr;
+    size_t        resultSize = 0;
+    gpa_uint64    results[2] = {};
+
+    // the calls are forwarded to the functions of the table
+    EXPECT_EQ(GPA_STATUS_OK, functionTable.GPA_OpenContext(&apiContext, GPA_OPENCONTEXT_DEFAULT_BIT, &contextId));
+    EXPECT_EQ(reinterpret_cast<GPA_ContextId>(&s_fakeContext), contextId);
+    EXPECT_EQ(GPA_STATUS_OK, functionTable.GPA_CreateSession(contextId, GPA_SESSION_SAMPLE_TYPE_DISCRETE_COUNTER, &sessionId));
+    EXPECT_EQ(GPA_STATUS_OK, functionTable.GPA_EnableCounter(sessionId, 1));
+    EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, functionTable.GPA_EnableCounter(nullptr, 1));
+    EXPECT_EQ(GPA_STATUS_ERROR_SAMPLE_NOT_FOUND, functionTable.GPA_GetSampleResultSize(sessionId, 3, &resultSize));
+    EXPECT_EQ(GPA_STATUS_OK, functionTable.GPA_GetSampleResult(sessionId, 3, sizeof(results), results));
+    EXPECT_EQ(301u, results[1]);
+
+    g_callCapture.Stop();
+    EXPECT_FALSE(g_callCapture.IsEnabled());
+
+    // calls made once the capture stopped are forwarded, but not captured
+    EXPECT_EQ(GPA_STATUS_OK, functionTable.GPA_EnableCounter(sessionId, 0));
+
+    const std::string  trace = ReadFile(traceFilePath);
+    GPACallTraceReader reader(trace.data(), trace.size());
+
+    std::vector<std::string> apiNames;
+    ASSERT_TRUE(GPA_ReadCallTraceHeader(reader, apiNames));
+    ASSERT_EQ(static_cast<size_t>(GPA_API_CALL_ID__LAST), apiNames.size());
+    EXPECT_EQ("GPA_OpenContext", apiNames[GPA_API_CALL_ID_GPA_OpenContext]);
+
+    gpa_uint64 previousStartTime = 0;
+
+    std::string counterName;
+    bool        isNull = false;
+
+    // GPA_OpenContext: the API context is opaque, the new context gets the first handle id, the payload describes the context
+    GPACallTraceReader openContext = ReadCall(reader, previousStartTime, GPA_API_CALL_ID_GPA_OpenContext, GPA_STATUS_OK);
+    EXPECT_EQ(GPACallTraceWriter::POINTER_VALUE, ReadUInt(openContext));
+    EXPECT_EQ(GPA_OPENCONTEXT_DEFAULT_BIT, ReadUInt(openContext) / 2);
+    EXPECT_EQ(GPACallTraceWriter::POINTER_VALUE, ReadUInt(openContext));
+    EXPECT_EQ(1u, ReadUInt(openContext));
+
+    GPACallTraceReader openContextPayload(nullptr, 0);
+    ASSERT_TRUE(openContext.ReadSizedData(openContextPayload));
+    EXPECT_EQ(0x6863u, ReadUInt(openContextPayload));
+    EXPECT_EQ(0xC1u, ReadUInt(openContextPayload));
+    EXPECT_EQ(2u, ReadUInt(openContextPayload));
+    EXPECT_TRUE(openContextPayload.ReadString(counterName, isNull));
+    EXPECT_EQ("GPUTime", counterName);
+    EXPECT_TRUE(openContextPayload.ReadString(counterName, isNull));
+    EXPECT_EQ("VALUBusy", counterName);
+    EXPECT_TRUE(openContextPayload.IsAtEnd());
+    EXPECT_TRUE(openContext.IsAtEnd());
+
+    // GPA_CreateSession: the context is referred to by its id, the new session gets the next id
+    GPACallTraceReader createSession = ReadCall(reader, previousStartTime, GPA_API_CALL_ID_GPA_CreateSession, GPA_STATUS_OK);
+    EXPECT_EQ(1u, ReadUInt(createSession));
+    ReadUInt(createSession);
+    EXPECT_EQ(GPACallTraceWriter::POINTER_VALUE, ReadUInt(createSession));
+    EXPECT_EQ(2u, ReadUInt(createSession));
+
+    GPACallTraceReader enableCounter = ReadCall(reader, previousStartTime, GPA_API_CALL_ID_GPA_EnableCounter, GPA_STATUS_OK);
+    EXPECT_EQ(2u, ReadUInt(enableCounter));
+    EXPECT_EQ(2u, ReadUInt(enableCounter));
+
+    // a null handle has id 0
+    GPACallTraceReader enableNullCounter = ReadCall(reader, previousStartTime, GPA_API_CALL_ID_GPA_EnableCounter, GPA_STATUS_ERROR_NULL_POINTER);
+    EXPECT_EQ(0u, ReadUInt(enableNullCounter));
+
+    // the output of a failed call is not written
+    GPACallTraceReader getResultSize = ReadCall(reader, previousStartTime, GPA_API_CALL_ID_GPA_GetSampleResultSize, GPA_STATUS_ERROR_SAMPLE_NOT_FOUND);
+    EXPECT_EQ(2u, ReadUInt(getResultSize));
+    ReadUInt(getResultSize);
+    EXPECT_EQ(GPACallTraceWriter::POINTER_NOT_WRITTEN, ReadUInt(getResultSize));
+
+    // the results of the sample are in the payload
+    GPACallTraceReader getResult = ReadCall(reader, previousStartTime, GPA_API_CALL_ID_GPA_GetSampleResult, GPA_STATUS_OK);
+    EXPECT_EQ(2u, ReadUInt(getResult));
+    ReadUInt(getResult);
+    EXPECT_EQ(sizeof(results) * 2, ReadUInt(getResult));
+    EXPECT_EQ(GPACallTraceWriter::POINTER_VALUE, ReadUInt(getResult));
+
+    GPACallTraceReader getResultPayload(nullptr, 0);
+    gpa_uint64         capturedResults[2] = {};
+    ASSERT_TRUE(getResult.ReadSizedData(getResultPayload));
+    EXPECT_TRUE(getResultPayload.ReadBytes(capturedResults, sizeof(capturedResults)));
+    EXPECT_EQ(0, memcmp(results, capturedResults, sizeof(results)));
+    EXPECT_TRUE(getResultPayload.IsAtEnd());
+
+    EXPECT_TRUE(reader.IsAtEnd());
+
+    std::remove(traceFilePath.c_str());
+}
+
+TEST(GPUPerfAPICallCaptureTests, EncodesValuesCompactly)
+{
+    GPACallTraceWriter writer;
+    writer.WriteUInt(127);
+    EXPECT_EQ(1u, writer.GetData().size());
+    writer.WriteInt(-1);
+    EXPECT_EQ(2u, writer.GetData().size());
+    writer.WriteUInt(0xFFFFFFFFFFFFFFFFull);
+    writer.WriteInt(INT64_MIN);
+    writer.WriteString(nullptr);
+    writer.WriteString("");
+
+    GPACallTraceReader reader(writer.GetData().data(), writer.GetData().size());
+    gpa_uint64         unsignedValue = 0;
+    int64_t            signedValue   = 0;
+    std::string        value;
+    bool               isNull = false;
+
+    EXPECT_TRUE(reader.ReadUInt(unsignedValue));
+    EXPECT_EQ(127u, unsignedValue);
+    EXPECT_TRUE(reader.ReadInt(signedValue));
+    EXPECT_EQ(-1, signedValue);
+    EXPECT_TRUE(reader.ReadUInt(unsignedValue));
+    EXPECT_EQ(0xFFFFFFFFFFFFFFFFull, unsignedValue);
+    EXPECT_TRUE(reader.ReadInt(signedValue));
+    EXPECT_EQ(INT64_MIN, signedValue);
+    EXPECT_TRUE(reader.ReadString(value, isNull));
+    EXPECT_TRUE(isNull);
+    EXPECT_TRUE(reader.ReadString(value, isNull));
+    EXPECT_FALSE(isNull);
+    EXPECT_TRUE(value.empty());
+    EXPECT_TRUE(reader.IsAtEnd());
+
+    // reading past the end fails
+    EXPECT_FALSE(reader.ReadUInt(unsignedValue));
+}
@@ -0,0 +1,139 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Unit tests for the binary log of the calls to the GPA entry points
+//==============================================================================
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "gpa_call_recorder.h"
+#include "utility.h"
+
+/// Counts the lines of a text which contain a string
+/// \param text the text
+/// \param searched the string to find
+/// \return the number of lines of the text containing the string
+static size_t CountLines(const std::string& text, const std::string& searched)
+{
+    std::istringstream textStream(text);
+    std::string        line;
+    size_t             numLines = 0;
+
+    while (std::getline(textStream, line))
+    {
+        if (std::string::npos != line.find(searched))
+        {
+            ++numLines;
+        }
+    }
+
+    return numLines;
+}
+
+TEST(GPUPerfAPICallRecorderTests, RecordsAndDecodesCalls)
+{
+    std::string logFilePath;
+    ASSERT_TRUE(GPAUtil::CreateTempFile("GPA-CallLog-Test-", ".bin", logFilePath));
+
+    GPACallRecorder recorder;
+    recorder.Stop();
+    ASSERT_TRUE(recorder.Start(logFilePath));
+    EXPECT_TRUE(recorder.IsEnabled());
+
+    gpa_uint32  commandList  = 0;
+    gpa_uint32* pCommandList = &commandList;
+    recorder.Record(GPA_API_CALL_ID_GPA_BeginSample, "retStatus, sampleId, gpaCommandListId", GPA_STATUS_OK, 7u, pCommandList);
+    recorder.Record(GPA_API_CALL_ID_GPA_EndSample, "retStatus, gpaCommandListId", GPA_STATUS_ERROR_FAILED, pCommandList);
+    recorder.Stop();
+    EXPECT_FALSE(recorder.IsEnabled());
+
+    std::ostringstream decodedLog;
+    ASSERT_TRUE(GPACallRecorder::DecodeLog(logFilePath, decodedLog));
+
+    const std::string text = decodedLog.str();
+    EXPECT_EQ(1u, CountLines(text, "thread 0: GPA_BeginSample(sampleId = 7, gpaCommandListId = "));
+    EXPECT_EQ(1u, CountLines(text, "GPA_EndSample(gpaCommandListId = "));
+    EXPECT_EQ(1u, CountLines(text, ") = " + std::to_string(GPA_STATUS_ERROR_FAILED)));
+    EXPECT_LT(text.find("GPA_BeginSample"), text.find("GPA_EndSample"));
+
+    std::remove(logFilePath.c_str());
+
+    // a file which is not a call log is rejected
+    std::ostringstream invalidLog;
+    EXPECT_FALSE(GPACallRecorder::DecodeLog(logFilePath, invalidLog));
+}
+
+TEST(GPUPerfAPICallRecorderTests, RecordsCallsOfSeveralThreads)
+{
+    std::string logFilePath;
+    ASSERT_TRUE(GPAUtil::CreateTempFile("GPA-CallLog-Test-", ".bin", logFilePath));
+
+    const gpa_uint32 numCallsPerThread = GPACallRecorder::RECORDS_PER_BUFFER * 2 + 5;
+
+    GPACallRecorder recorder;
+    ASSERT_TRUE(recorder.Start(logFilePath));
+
+    auto recordCalls = [&recorder, numCallsPerThread](gpa_uint32 passIndexBase) {
+        for (gpa_uint32 callIndex = 0; callIndex < numCallsPerThread; ++callIndex)
+        {
+            recorder.Record(GPA_API_CALL_ID_GPA_IsPassComplete, "retStatus, passIndex", GPA_STATUS_OK, passIndexBase + callIndex);
+        }
+    };
+
+    std::thread thread1(recordCalls, 0u);
+    std::thread thread2(recordCalls, numCallsPerThread);
+    thread1.join();
+    thread2.join();
+    recorder.Stop();
+
+    std::ostringstream decodedLog;
+    ASSERT_TRUE(GPACallRecorder::DecodeLog(logFilePath, decodedLog));
+
+    // every call is decoded, whether its buffer was flushed when it was full or when the recorder stopped
+    const std::string text = decodedLog.str();
+    EXPECT_EQ(numCallsPerThread * 2, CountLines(text, "GPA_IsPassComplete(passIndex = "));
+    EXPECT_EQ(numCallsPerThread, CountLines(text, "thread 0: "));
+    EXPECT_EQ(numCallsPerThread, CountLines(text, "thread 1: "));
+
+    std::remove(logFilePath.c_str());
+}
+
+/// Records that an argument of a recorded call was evaluated
+/// \param[in,out] numEvaluations the number of evaluations of the argument
+/// \return the value of the argument
+static gpa_uint32 EvaluateArg(gpa_uint32& numEvaluations)
+{
+    return ++numEvaluations;
+}
+
+TEST(GPUPerfAPICallRecorderTests, SkipsArgumentsWhileDisabled)
+{
+    g_callRecorder.Stop();
+
+    gpa_uint32 numEvaluations = 0;
+    GPA_RECORD_CALL(GPA_IsPassComplete, GPA_STATUS_OK, EvaluateArg(numEvaluations));
+    EXPECT_EQ(0u, numEvaluations);
+}
+
+TEST(GPUPerfAPICallRecorderTests, ExpandsToSingleStatement)
+{
+    g_callRecorder.Stop();
+
+    gpa_uint32 numEvaluations = 0;
+    bool       isElseTaken    = false;
+
+    // an else following the macro binds to the if of the caller, not to the if inside the macro
+    if (0u == numEvaluations)
+        GPA_RECORD_CALL(GPA_IsPassComplete, GPA_STATUS_OK, EvaluateArg(numEvaluations));
+    else
+        isElseTaken = true;
+
+    EXPECT_FALSE(isElseTaken);
+    EXPECT_EQ(0u, numEvaluations);
+}
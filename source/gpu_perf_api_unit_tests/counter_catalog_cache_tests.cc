@@ -0,0 +1,281 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Unit tests for the persistent on-disk cache of the counter catalog
+//==============================================================================
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "gpa_counter_catalog_cache.h"
+#include "gpa_derived_counter.h"
+#include "gpa_hw_info.h"
+#include "utility.h"
+
+#ifdef GL
+#include "public_counter_definitions_gl_gfx9.h"
+#include "public_counter_definitions_gl_gfx10.h"
+#include "public_counter_definitions_gl_gfx9_asics.h"
+
+/// Creates the key of a combination
+/// \param deviceId the device id of the combination
+/// \return the key of the combination
+static GPA_CounterCatalogKey MakeKey(gpa_uint32 deviceId)
+{
+    GPA_CounterCatalogKey key;
+    key.m_api                          = GPA_API_OPENGL;
+    key.m_vendorId                     = 0x1002;
+    key.m_deviceId                     = deviceId;
+    key.m_revisionId                   = 0;
+    key.m_allowedCounters              = 1;
+    key.m_generateAsicSpecificCounters = 1;
+    return key;
+}
+
+/// Compares two strings which may be null
+/// \param pExpected the expected string
+/// \param pActual the actual string
+/// \return true if both strings are null or equal
+static bool AreStringsEqual(const char* pExpected, const char* pActual)
+{
+    return (nullptr == pExpected || nullptr == pActual) ? pExpected == pActual : 0 == strcmp(pExpected, pActual);
+}
+
+/// Verifies that the counters loaded from the cache are the stored ones
+/// \param expectedCounters the stored counters
+/// \param loadedCounters the counters loaded from the cache
+static void VerifyLoadedCounters(const GPA_DerivedCounters& expectedCounters, const GPA_DerivedCounters& loadedCounters)
+{
+    ASSERT_EQ(expectedCounters.GetNumCounters(), loadedCounters.GetNumCounters());
+
+    for (gpa_uint32 counterIndex = 0; counterIndex < expectedCounters.GetNumCounters(); ++counterIndex)
+    {
+        const GPA_DerivedCounter* pExpected = expectedCounters.GetCounter(counterIndex);
+        const GPA_DerivedCounter* pLoaded   = loadedCounters.GetCounter(counterIndex);
+
+        EXPECT_EQ(counterIndex, pLoaded->m_index);
+        EXPECT_TRUE(AreStringsEqual(pExpected->m_pName, pLoaded->m_pName)) << pExpected->m_pName;
+        EXPECT_TRUE(AreStringsEqual(pExpected->m_pGroup, pLoaded->m_pGroup)) << pExpected->m_pName;
+        EXPECT_TRUE(AreStringsEqual(pExpected->m_pDescription, pLoaded->m_pDescription)) << pExpected->m_pName;
+        EXPECT_TRUE(AreStringsEqual(pExpected->m_pComputeExpression, pLoaded->m_pComputeExpression)) << pExpected->m_pName;
+        EXPECT_EQ(pExpected->m_dataType, pLoaded->m_dataType) << pExpected->m_pName;
+        EXPECT_EQ(pExpected->m_usageType, pLoaded->m_usageType) << pExpected->m_pName;
+        EXPECT_EQ(pExpected->m_internalCountersRequired, pLoaded->m_internalCountersRequired) << pExpected->m_pName;
+        EXPECT_EQ(0, memcmp(&pExpected->m_uuid, &pLoaded->m_uuid, sizeof(GPA_UUID))) << pExpected->m_pName;
+
+        // native functions are not persisted, they are attached again from the generated functions
+        EXPECT_EQ(pExpected->m_pComputeFunction, pLoaded->m_pComputeFunction) << pExpected->m_pName;
+    }
+}
+
+TEST(GPUPerfAPICounterCatalogCacheTests, StoresAndLoadsPublicCounters)
+{
+    std::string cacheFilePath;
+    ASSERT_TRUE(GPAUtil::CreateTempFile("GPA-CounterCache-Test-", ".gpacache", cacheFilePath));
+
+    GPA_DerivedCounters gfx9Counters;
+    GPA_DerivedCounters gfx10Counters;
+    AutoDefinePublicDerivedCountersGLGfx9(gfx9Counters);
+    AutoDefinePublicDerivedCountersGLGfx10(gfx10Counters);
+
+    const std::vector<GPA_DerivedCounterFunctionTable> gfx9Functions(1, GetPublicDerivedCounterFunctionsGLGfx9());
+    const std::vector<GPA_DerivedCounterFunctionTable> gfx10Functions(1, GetPublicDerivedCounterFunctionsGLGfx10());
+
+    {
+        // the cache file is still empty
+        GPA_CounterCatalogCache cache;
+        EXPECT_FALSE(cache.Open(cacheFilePath));
+
+        GPA_DerivedCounters loadedCounters;
+        EXPECT_FALSE(cache.LoadPublicCounters(MakeKey(1), gfx9Functions, loadedCounters));
+
+        ASSERT_TRUE(cache.StorePublicCounters(MakeKey(1), gfx9Counters));
+        ASSERT_TRUE(cache.LoadPublicCounters(MakeKey(1), gfx9Functions, loadedCounters));
+        VerifyLoadedCounters(gfx9Counters, loadedCounters);
+
+        // storing another combination keeps the first one, whose counters loaded from the previous file remain valid
+        ASSERT_TRUE(cache.StorePublicCounters(MakeKey(2), gfx10Counters));
+        VerifyLoadedCounters(gfx9Counters, loadedCounters);
+    }
+
+    {
+        // another process maps the file written by the first one
+        GPA_CounterCatalogCache cache;
+        ASSERT_TRUE(cache.Open(cacheFilePath));
+
+        GPA_DerivedCounters loadedGfx9Counters;
+        GPA_DerivedCounters loadedGfx10Counters;
+        GPA_DerivedCounters loadedCounters;
+        ASSERT_TRUE(cache.LoadPublicCounters(MakeKey(1), gfx9Functions, loadedGfx9Counters));
+        ASSERT_TRUE(cache.LoadPublicCounters(MakeKey(2), gfx10Functions, loadedGfx10Counters));
+        EXPECT_FALSE(cache.LoadPublicCounters(MakeKey(3), gfx10Functions, loadedCounters));
+        VerifyLoadedCounters(gfx9Counters, loadedGfx9Counters);
+        VerifyLoadedCounters(gfx10Counters, loadedGfx10Counters);
+
+        // a loaded counter gives the same result as the generated one
+        gpa_uint64                     values[64];
+        std::vector<const gpa_uint64*> results;
+
+        for (gpa_uint32 valueIndex = 0; valueIndex < 64; ++valueIndex)
+        {
+            values[valueIndex] = (valueIndex + 1) * 977u;
+            results.push_back(&values[valueIndex]);
+        }
+
+        GPA_HWInfo hwInfo;
+        hwInfo.SetNumberShaderEngines(4);
+        hwInfo.SetNumberCUs(64);
+        hwInfo.SetNumberSIMDs(256);
+        hwInfo.SetTimeStampFrequency(100000000);
+
+        for (gpa_uint32 counterIndex = 0; counterIndex < gfx10Counters.GetNumCounters(); ++counterIndex)
+        {
+            size_t numResults = gfx10Counters.GetCounter(counterIndex)->m_internalCountersRequired.size();
+
+            if (numResults > results.size())
+            {
+                continue;
+            }
+
+            std::vector<const gpa_uint64*> counterResults(results.cbegin(), results.cbegin() + numResults);
+            std::vector<GPA_Data_Type>     types(numResults, GPA_DATA_TYPE_UINT64);
+            gpa_uint64                     expected = 0;
+            gpa_uint64                     actual   = 0;
+
+            ASSERT_EQ(GPA_STATUS_OK, gfx10Counters.ComputeCounterValue(counterIndex, counterResults, types, &expected, &hwInfo));
+            ASSERT_EQ(GPA_STATUS_OK, loadedGfx10Counters.ComputeCounterValue(counterIndex, counterResults, types, &actual, &hwInfo));
+            EXPECT_EQ(expected, actual) << gfx10Counters.GetCounter(counterIndex)->m_pName;
+        }
+    }
+
+    std::remove(cacheFilePath.c_str());
+}
+
+TEST(GPUPerfAPICounterCatalogCacheTests, AttachesGeneratedFunctions)
+{
+    std::string cacheFilePath;
+    ASSERT_TRUE(GPAUtil::CreateTempFile("GPA-CounterCache-Test-", ".gpacache", cacheFilePath));
+
+    GPA_DerivedCounters gfx9Counters;
+    GPA_DerivedCounters asicCounters;
+    AutoDefinePublicDerivedCountersGLGfx9(gfx9Counters);
+    AutoDefinePublicDerivedCountersGLGfx9(asicCounters);
+    glgfx9asics::UpdatePublicAsicSpecificCounters(GDT_HW_GENERATION_GFX9, GDT_GFX9_0_6, asicCounters);
+
+    std::vector<GPA_DerivedCounterFunctionTable> asicFunctions(1);
+    ASSERT_TRUE(glgfx9asics::GetPublicAsicSpecificCounterFunctions(GDT_HW_GENERATION_GFX9, GDT_GFX9_0_6, asicFunctions[0]));
+    ASSERT_LT(0u, asicFunctions[0].m_numEntries);
+    asicFunctions.push_back(GetPublicDerivedCounterFunctionsGLGfx9());
+
+    GPA_CounterCatalogCache cache;
+    EXPECT_FALSE(cache.Open(cacheFilePath));
+    ASSERT_TRUE(cache.StorePublicCounters(MakeKey(1), asicCounters));
+
+    GPA_DerivedCounters loadedCounters;
+    ASSERT_TRUE(cache.LoadPublicCounters(MakeKey(1), asicFunctions, loadedCounters));
+    VerifyLoadedCounters(asicCounters, loadedCounters);
+
+    // a counter stored with another equation than the one its function was generated from is computed from its equation
+    const std::vector<GPA_DerivedCounterFunctionTable> gfx9Functions(1, asicFunctions.back());
+    const gpa_uint32                                   replacedCounterIndex = 1;
+    const GPA_DerivedCounter*                          pReplacedCounter     = gfx9Counters.GetCounter(replacedCounterIndex);
+    std::vector<gpa_uint32>                            internalCounters     = pReplacedCounter->m_internalCountersRequired;
+    GPA_DerivedCounters                                replacedCounters;
+
+    AutoDefinePublicDerivedCountersGLGfx9(replacedCounters);
+    replacedCounters.UpdateAsicSpecificDerivedCounter(pReplacedCounter->m_pName, internalCounters, "0");
+    ASSERT_TRUE(cache.StorePublicCounters(MakeKey(2), replacedCounters));
+    ASSERT_TRUE(cache.LoadPublicCounters(MakeKey(2), gfx9Functions, loadedCounters));
+    ASSERT_EQ(gfx9Counters.GetNumCounters(), loadedCounters.GetNumCounters());
+
+    for (gpa_uint32 counterIndex = 0; counterIndex < gfx9Counters.GetNumCounters(); ++counterIndex)
+    {
+        const GPA_DerivedCounterFunction expectedFunction = (replacedCounterIndex == counterIndex) ? nullptr : gfx9Counters.GetCounter(counterIndex)->m_pComputeFunction;
+        EXPECT_EQ(expectedFunction, loadedCounters.GetCounter(counterIndex)->m_pComputeFunction) << gfx9Counters.GetCounter(counterIndex)->m_pName;
+    }
+
+    std::remove(cacheFilePath.c_str());
+}
+
+TEST(GPUPerfAPICounterCatalogCacheTests, RejectsInvalidFiles)
+{
+    std::string cacheFilePath;
+    ASSERT_TRUE(GPAUtil::CreateTempFile("GPA-CounterCache-Test-", ".gpacache", cacheFilePath));
+
+    GPA_DerivedCounters gfx10Counters;
+    AutoDefinePublicDerivedCountersGLGfx10(gfx10Counters);
+
+    {
+        std::ofstream cacheFile(cacheFilePath.c_str(), std::ios_base::out | std::ios_base::binary);
+        std::string   garbage(4096, 'x');
+        cacheFile.write(garbage.data(), garbage.size());
+    }
+
+    {
+        // a corrupt file is ignored, then replaced on the next store
+        GPA_CounterCatalogCache cache;
+        EXPECT_FALSE(cache.Open(cacheFilePath));
+        ASSERT_TRUE(cache.StorePublicCounters(MakeKey(1), gfx10Counters));
+    }
+
+    std::string cacheFileContent;
+
+    {
+        std::ifstream cacheFile(cacheFilePath.c_str(), std::ios_base::in | std::ios_base::binary);
+        cacheFileContent.assign(std::istreambuf_iterator<char>(cacheFile), std::istreambuf_iterator<char>());
+    }
+
+    {
+        GPA_CounterCatalogCache cache;
+        EXPECT_TRUE(cache.Open(cacheFilePath));
+    }
+
+    // a truncated file is ignored
+    {
+        std::ofstream cacheFile(cacheFilePath.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+        cacheFile.write(cacheFileContent.data(), cacheFileContent.size() / 2);
+    }
+
+    {
+        GPA_CounterCatalogCache cache;
+        EXPECT_FALSE(cache.Open(cacheFilePath));
+    }
+
+    // a file in the previous format, whose counter UUIDs may be wrong, is ignored
+    gpa_uint32  previousFormatVersion = 1;
+    std::string previousFormatContent = cacheFileContent;
+    memcpy(&previousFormatContent[sizeof(gpa_uint32)], &previousFormatVersion, sizeof(previousFormatVersion));
+
+    {
+        std::ofstream cacheFile(cacheFilePath.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+        cacheFile.write(previousFormatContent.data(), previousFormatContent.size());
+    }
+
+    {
+        GPA_CounterCatalogCache cache;
+        EXPECT_FALSE(cache.Open(cacheFilePath));
+    }
+
+    // a file written by another version of GPA is ignored
+    cacheFileContent[8] ^= 0x7f;
+
+    {
+        std::ofstream cacheFile(cacheFilePath.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+        cacheFile.write(cacheFileContent.data(), cacheFileContent.size());
+    }
+
+    {
+        GPA_CounterCatalogCache cache;
+        EXPECT_FALSE(cache.Open(cacheFilePath));
+    }
+
+    std::remove(cacheFilePath.c_str());
+}
+#endif
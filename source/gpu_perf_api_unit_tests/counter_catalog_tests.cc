@@ -0,0 +1,57 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Unit tests for the counter catalog shared by the contexts
+//==============================================================================
+
+#include <gtest/gtest.h>
+
+#include "counter_generator_tests.h"
+#include "gpa_counter_generator.h"
+#include "gpa_counter_catalog.h"
+
+#ifdef CL
+#include "gpa_counter_generator_cl.h"
+#include "gpa_counter_scheduler_cl.h"
+
+TEST(GPUPerfAPICounterCatalogTests, SharesCountersBetweenContexts)
+{
+    // constructing the generator and scheduler registers them for CL
+    GPA_CounterGeneratorCL clGenerator;
+    GPA_CounterSchedulerCL clScheduler;
+
+    IGPACounterAccessor*  pFirstAccessor    = nullptr;
+    IGPACounterScheduler* pFirstScheduler   = nullptr;
+    IGPACounterAccessor*  pSecondAccessor   = nullptr;
+    IGPACounterScheduler* pSecondScheduler  = nullptr;
+    IGPACounterAccessor*  pHardwareAccessor = nullptr;
+
+    ASSERT_EQ(GPA_STATUS_OK,
+              GenerateCounters(GPA_API_OPENCL, AMD_VENDOR_ID, gDevIdGfx9, REVISION_ID_ANY, GPA_OPENCONTEXT_DEFAULT_BIT, false, &pFirstAccessor, &pFirstScheduler));
+    size_t numEntries = GPA_CounterCatalog::Instance()->GetNumEntries();
+
+    ASSERT_EQ(GPA_STATUS_OK,
+              GenerateCounters(GPA_API_OPENCL, AMD_VENDOR_ID, gDevIdGfx9, REVISION_ID_ANY, GPA_OPENCONTEXT_DEFAULT_BIT, false, &pSecondAccessor, &pSecondScheduler));
+
+    // the counters are generated once and shared, while each context gets its own scheduler
+    EXPECT_EQ(pFirstAccessor, pSecondAccessor);
+    EXPECT_NE(pFirstScheduler, pSecondScheduler);
+    EXPECT_EQ(numEntries, GPA_CounterCatalog::Instance()->GetNumEntries());
+
+    // enabling a counter on one scheduler does not affect the other one
+    EXPECT_EQ(GPA_STATUS_OK, pFirstScheduler->EnableCounter(0));
+    EXPECT_EQ(1u, pFirstScheduler->GetNumEnabledCounters());
+    EXPECT_EQ(0u, pSecondScheduler->GetNumEnabledCounters());
+
+    // a different set of allowed counters is a different catalog entry
+    ASSERT_EQ(GPA_STATUS_OK,
+              GenerateCounters(
+                  GPA_API_OPENCL, AMD_VENDOR_ID, gDevIdGfx9, REVISION_ID_ANY, GPA_OPENCONTEXT_ENABLE_HARDWARE_COUNTERS_BIT, false, &pHardwareAccessor, nullptr));
+    EXPECT_NE(pFirstAccessor, pHardwareAccessor);
+    EXPECT_GT(pHardwareAccessor->GetNumCounters(), pFirstAccessor->GetNumCounters());
+
+    delete pFirstScheduler;
+    delete pSecondScheduler;
+}
+#endif
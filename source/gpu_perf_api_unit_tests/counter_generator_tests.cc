@@ -5,6 +5,7 @@
 /// \brief  Helper functions for Counter Generator Unit Tests
 //==============================================================================
 
+#include <cstring>
 #include <map>
 #include <algorithm>
 
@@ -326,6 +327,34 @@ void VerifyCounterLibInterface(GPA_API_Type                       api,
             EXPECT_EQ(gpa_status, GPA_STATUS_OK);
         }
 
+        // every counter is found from its UUID; counters sharing a UUID resolve to the first of them
+        gpa_uint32 num_counters = 0;
+        gpa_status              = gpa_counter_lib_func_table.GpaCounterLib_GetNumCounters(gpa_counter_context, &num_counters);
+        EXPECT_EQ(GPA_STATUS_OK, gpa_status);
+
+        for (gpa_uint32 counter_index = 0; counter_index < num_counters; ++counter_index)
+        {
+            GPA_UUID counter_uuid = {};
+            gpa_status            = gpa_counter_lib_func_table.GpaCounterLib_GetCounterUuid(gpa_counter_context, counter_index, &counter_uuid);
+            EXPECT_EQ(GPA_STATUS_OK, gpa_status);
+
+            gpa_status = gpa_counter_lib_func_table.GpaCounterLib_GetCounterIndexByUuid(gpa_counter_context, &counter_uuid, &index);
+            EXPECT_EQ(GPA_STATUS_OK, gpa_status);
+            EXPECT_LE(index, counter_index);
+
+            GPA_UUID found_uuid = {};
+            gpa_status          = gpa_counter_lib_func_table.GpaCounterLib_GetCounterUuid(gpa_counter_context, index, &found_uuid);
+            EXPECT_EQ(GPA_STATUS_OK, gpa_status);
+            EXPECT_EQ(0, memcmp(&counter_uuid, &found_uuid, sizeof(GPA_UUID)));
+        }
+
+        GPA_UUID unknown_uuid = {};
+        gpa_status            = gpa_counter_lib_func_table.GpaCounterLib_GetCounterIndexByUuid(gpa_counter_context, &unknown_uuid, &index);
+        EXPECT_EQ(GPA_STATUS_ERROR_COUNTER_NOT_FOUND, gpa_status);
+
+        gpa_status = gpa_counter_lib_func_table.GpaCounterLib_GetCounterIndexByUuid(gpa_counter_context, nullptr, &index);
+        EXPECT_EQ(GPA_STATUS_ERROR_NULL_POINTER, gpa_status);
+
         gpa_status = gpa_counter_lib_func_table.GpaCounterLib_CloseCounterContext(gpa_counter_context);
         EXPECT_EQ(GPA_STATUS_OK, gpa_status);
         gpa_counter_context = nullptr;
@@ -0,0 +1,200 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Unit tests for the streaming counter statistics
+//==============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "gpa_counter_statistics.h"
+
+/// Gets the exact quantile of a set of values, with the same rank convention as the sketch
+/// \param[in] values the values, sorted
+/// \param[in] quantile the quantile, between 0 and 1
+/// \return the value of the quantile
+static gpa_float64 GetExactQuantile(const std::vector<gpa_float64>& values, gpa_float64 quantile)
+{
+    return values[static_cast<size_t>(quantile * static_cast<gpa_float64>(values.size() - 1))];
+}
+
+/// Generates values spread over several orders of magnitude, including negative values and zeros
+/// \param[in] numValues the number of values
+/// \param[in] seed the seed of the sequence
+/// \return the values
+static std::vector<gpa_float64> GenerateValues(size_t numValues, gpa_uint32 seed)
+{
+    std::vector<gpa_float64> values(numValues);
+    gpa_uint32               state = seed;
+
+    for (size_t valueIndex = 0; valueIndex < numValues; ++valueIndex)
+    {
+        state = state * 1664525u + 1013904223u;
+
+        gpa_float64 uniform = static_cast<gpa_float64>(state >> 8) / static_cast<gpa_float64>(1u << 24);
+        values[valueIndex]  = (0 == valueIndex % 97) ? 0.0 : std::exp(uniform * 12.0) - 20.0;
+    }
+
+    return values;
+}
+
+/// Adds values to the statistics of a float64 counter, in batches
+/// \param[in,out] statistics the statistics
+/// \param[in] counterIndex the exposed index of the counter
+/// \param[in] values the values to add
+static void AddValues(GPACounterStatistics& statistics, gpa_uint32 counterIndex, const std::vector<gpa_float64>& values)
+{
+    std::vector<gpa_uint32>    counterIndices(1, counterIndex);
+    std::vector<GPA_Data_Type> dataTypes(1, GPA_DATA_TYPE_FLOAT64);
+    std::vector<gpa_uint64>    results(values.size());
+
+    memcpy(results.data(), values.data(), values.size() * sizeof(gpa_float64));
+
+    for (size_t first = 0; first < values.size(); first += 256)
+    {
+        statistics.AddSampleResults(counterIndices, dataTypes, results.data() + first, std::min<size_t>(256, values.size() - first));
+    }
+}
+
+/// Checks the statistics of a counter against the values which were accumulated
+/// \param[in] statistics the statistics
+/// \param[in] counterIndex the exposed index of the counter
+/// \param[in] values the values accumulated for the counter
+static void CheckStatistics(const GPACounterStatistics& statistics, gpa_uint32 counterIndex, std::vector<gpa_float64> values)
+{
+    GPA_CounterStatistics counterStatistics = {};
+    ASSERT_TRUE(statistics.GetStatistics(counterIndex, counterStatistics));
+
+    std::sort(values.begin(), values.end());
+
+    gpa_float64 sum = 0.0;
+
+    for (gpa_float64 value : values)
+    {
+        sum += value;
+    }
+
+    gpa_float64 mean     = sum / static_cast<gpa_float64>(values.size());
+    gpa_float64 variance = 0.0;
+
+    for (gpa_float64 value : values)
+    {
+        variance += (value - mean) * (value - mean);
+    }
+
+    variance /= static_cast<gpa_float64>(values.size());
+
+    EXPECT_EQ(values.size(), counterStatistics.m_count);
+    EXPECT_NEAR(sum, counterStatistics.m_sum, 1e-9 * std::fabs(sum));
+    EXPECT_EQ(values.front(), counterStatistics.m_min);
+    EXPECT_EQ(values.back(), counterStatistics.m_max);
+    EXPECT_NEAR(mean, counterStatistics.m_mean, 1e-9 * std::fabs(mean));
+    EXPECT_NEAR(variance, counterStatistics.m_variance, 1e-9 * variance);
+
+    // the quantiles are within the relative accuracy of the sketch
+    EXPECT_NEAR(GetExactQuantile(values, 0.50), counterStatistics.m_p50, 0.01 * std::fabs(GetExactQuantile(values, 0.50)));
+    EXPECT_NEAR(GetExactQuantile(values, 0.95), counterStatistics.m_p95, 0.01 * std::fabs(GetExactQuantile(values, 0.95)));
+    EXPECT_NEAR(GetExactQuantile(values, 0.99), counterStatistics.m_p99, 0.01 * std::fabs(GetExactQuantile(values, 0.99)));
+}
+
+TEST(GPUPerfAPICounterStatisticsTests, AccumulatesResults)
+{
+    GPACounterStatistics* pStatistics = GPACounterStatistics::Create();
+    ASSERT_NE(nullptr, pStatistics);
+    EXPECT_EQ(pStatistics, GPACounterStatistics::FromId(pStatistics));
+
+    std::vector<gpa_float64> values = GenerateValues(50000, 1);
+    AddValues(*pStatistics, 7, values);
+    CheckStatistics(*pStatistics, 7, values);
+
+    GPA_CounterStatistics counterStatistics = {};
+    EXPECT_FALSE(pStatistics->GetStatistics(8, counterStatistics));
+
+    GPACounterStatistics::Delete(pStatistics);
+    EXPECT_EQ(nullptr, GPACounterStatistics::FromId(pStatistics));
+}
+
+TEST(GPUPerfAPICounterStatisticsTests, MergeMatchesCombinedResults)
+{
+    GPACounterStatistics* pFirst  = GPACounterStatistics::Create();
+    GPACounterStatistics* pSecond = GPACounterStatistics::Create();
+    ASSERT_NE(nullptr, pFirst);
+    ASSERT_NE(nullptr, pSecond);
+
+    // the second set of values is shifted, so the means and the ranges of the two sets differ
+    std::vector<gpa_float64> firstValues  = GenerateValues(20000, 2);
+    std::vector<gpa_float64> secondValues = GenerateValues(30000, 3);
+
+    for (gpa_float64& value : secondValues)
+    {
+        value = value * 3.0 + 1000.0;
+    }
+
+    AddValues(*pFirst, 3, firstValues);
+    AddValues(*pSecond, 3, secondValues);
+    AddValues(*pSecond, 4, secondValues);
+    pFirst->Merge(*pSecond);
+
+    std::vector<gpa_float64> allValues = firstValues;
+    allValues.insert(allValues.end(), secondValues.begin(), secondValues.end());
+
+    CheckStatistics(*pFirst, 3, allValues);
+    CheckStatistics(*pFirst, 4, secondValues);
+    CheckStatistics(*pSecond, 3, secondValues);
+
+    GPACounterStatistics::Delete(pFirst);
+    GPACounterStatistics::Delete(pSecond);
+}
+
+TEST(GPUPerfAPICounterStatisticsTests, IntegerResultsAndSmallVariance)
+{
+    GPACounterStatistics* pStatistics = GPACounterStatistics::Create();
+    ASSERT_NE(nullptr, pStatistics);
+
+    // a large constant offset must not cost the variance its precision
+    std::vector<gpa_uint32>    counterIndices(1, 0);
+    std::vector<GPA_Data_Type> dataTypes(1, GPA_DATA_TYPE_UINT64);
+    std::vector<gpa_uint64>    results;
+
+    for (gpa_uint64 sample = 0; sample < 1000; ++sample)
+    {
+        results.push_back(1000000000000ull + sample % 2);
+    }
+
+    pStatistics->AddSampleResults(counterIndices, dataTypes, results.data(), results.size());
+
+    GPA_CounterStatistics counterStatistics = {};
+    ASSERT_TRUE(pStatistics->GetStatistics(0, counterStatistics));
+    EXPECT_EQ(1000u, counterStatistics.m_count);
+    EXPECT_EQ(1000000000000.0, counterStatistics.m_min);
+    EXPECT_EQ(1000000000001.0, counterStatistics.m_max);
+    EXPECT_NEAR(0.25, counterStatistics.m_variance, 1e-6);
+    EXPECT_LE(counterStatistics.m_min, counterStatistics.m_p50);
+    EXPECT_GE(counterStatistics.m_max, counterStatistics.m_p99);
+
+    GPACounterStatistics::Delete(pStatistics);
+}
+
+TEST(GPUPerfAPICounterStatisticsTests, SketchMemoryIsBounded)
+{
+    GPAQuantileSketch sketch;
+
+    // values spanning far more orders of magnitude than the bins can hold
+    for (int exponent = -300; exponent <= 300; ++exponent)
+    {
+        sketch.Add(std::pow(10.0, exponent));
+        sketch.Add(-std::pow(10.0, exponent));
+    }
+
+    EXPECT_EQ(1202u, sketch.GetCount());
+    EXPECT_LE(sketch.GetAllocatedBytes(), 2 * 2 * GPAQuantileSketch::MAX_BINS * sizeof(gpa_uint64));
+
+    // the largest magnitudes keep their accuracy
+    EXPECT_NEAR(1e300, sketch.GetQuantile(1.0), 0.01 * 1e300);
+    EXPECT_NEAR(-1e300, sketch.GetQuantile(0.0), 0.01 * 1e300);
+}
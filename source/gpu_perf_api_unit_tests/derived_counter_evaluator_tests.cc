@@ -0,0 +1,232 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Unit tests for the shared derived counter evaluator
+//==============================================================================
+
+#include <string.h>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "gpa_hw_info.h"
+#include "gpa_derived_counter.h"
+#include "gpa_derived_counter_evaluator.h"
+
+#ifdef GL
+#include "public_counter_definitions_gl_gfx9.h"
+#endif
+
+/// Creates the hardware info used to resolve the device constants of the formulas
+/// \param[out] hwInfo the hardware info to initialize
+static void InitHwInfo(GPA_HWInfo& hwInfo)
+{
+    hwInfo.SetNumberShaderEngines(4);
+    hwInfo.SetNumberShaderArrays(8);
+    hwInfo.SetNumberSIMDs(256);
+    hwInfo.SetNumberCUs(64);
+    hwInfo.SetTimeStampFrequency(100000000);
+}
+
+/// Gets a deterministic, non-trivial value for an internal counter
+/// \param internalCounterIndex the global index of the internal counter
+/// \return the value of the internal counter
+static gpa_uint64 GetInternalCounterValue(gpa_uint32 internalCounterIndex)
+{
+    return (static_cast<gpa_uint64>(internalCounterIndex) * 2654435761u) % 100003u;
+}
+
+/// Evaluates every counter of the derived counter set with both the formula interpreter and the shared evaluator
+/// and verifies that the results are identical
+/// \param derivedCounters the derived counters to verify
+/// \param hwInfo the hardware info used to resolve the device constants
+/// \param[out] evaluator the evaluator holding all of the counters
+static void VerifyEvaluatorMatchesInterpreter(const GPA_DerivedCounters& derivedCounters, const GPA_HWInfo& hwInfo, GPA_DerivedCounterEvaluator& evaluator)
+{
+    gpa_uint32              numCounters = derivedCounters.GetNumCounters();
+    std::vector<gpa_uint32> outputIndices(numCounters);
+
+    for (gpa_uint32 counterIndex = 0; counterIndex < numCounters; ++counterIndex)
+    {
+        const GPA_DerivedCounter* pCounter = derivedCounters.GetCounter(counterIndex);
+        ASSERT_EQ(GPA_STATUS_OK,
+                  evaluator.AddCounter(
+                      pCounter->m_pComputeExpression, pCounter->m_internalCountersRequired, pCounter->m_dataType, &hwInfo, outputIndices[counterIndex]))
+            << pCounter->m_pName;
+    }
+
+    const std::vector<gpa_uint32>& inputs = evaluator.GetInputs();
+    std::vector<gpa_uint64>        inputValues;
+
+    for (auto inputIter = inputs.cbegin(); inputIter != inputs.cend(); ++inputIter)
+    {
+        inputValues.push_back(GetInternalCounterValue(*inputIter));
+    }
+
+    std::vector<gpa_uint64> nodeValues;
+    std::vector<gpa_uint64> outputValues(evaluator.GetNumOutputs());
+    evaluator.Evaluate(inputValues.data(), nodeValues, outputValues.data());
+
+    for (gpa_uint32 counterIndex = 0; counterIndex < numCounters; ++counterIndex)
+    {
+        const GPA_DerivedCounter* pCounter = derivedCounters.GetCounter(counterIndex);
+
+        std::vector<gpa_uint64>        values;
+        std::vector<const gpa_uint64*> results;
+        std::vector<GPA_Data_Type>     types(pCounter->m_internalCountersRequired.size(), GPA_DATA_TYPE_UINT64);
+
+        for (auto requiredIter = pCounter->m_internalCountersRequired.cbegin(); requiredIter != pCounter->m_internalCountersRequired.cend(); ++requiredIter)
+        {
+            values.push_back(GetInternalCounterValue(*requiredIter));
+        }
+
+        for (auto valueIter = values.cbegin(); valueIter != values.cend(); ++valueIter)
+        {
+            results.push_back(&(*valueIter));
+        }
+
+        gpa_uint64 expected = 0;
+        ASSERT_EQ(GPA_STATUS_OK, derivedCounters.EvaluateCounterExpression(counterIndex, results, types, &expected, &hwInfo)) << pCounter->m_pName;
+        EXPECT_EQ(0, memcmp(&expected, &outputValues[outputIndices[counterIndex]], sizeof(expected))) << pCounter->m_pName;
+    }
+}
+
+TEST(GPUPerfAPIDerivedCounterEvaluatorTests, SharesCommonSubExpressions)
+{
+    GPA_HWInfo hwInfo;
+    InitHwInfo(hwInfo);
+
+    GPA_DerivedCounters derivedCounters;
+
+    std::vector<gpa_uint32> busyCounters = {10, 11, 12, 13, 20};
+    derivedCounters.DefineDerivedCounter("BusyPct",
+                                         "Test",
+                                         "Percentage of time the blocks are busy",
+                                         GPA_DATA_TYPE_FLOAT64,
+                                         GPA_USAGE_TYPE_PERCENTAGE,
+                                         busyCounters,
+                                         "0,1,2,3,sum4,4,/,(100),*",
+                                         "00000000-0000-0000-0000-000000000001");
+
+    std::vector<gpa_uint32> busyCyclesCounters = {10, 11, 12, 13, 20};
+    derivedCounters.DefineDerivedCounter("BusyCycles",
+                                         "Test",
+                                         "Number of cycles the blocks are busy",
+                                         GPA_DATA_TYPE_FLOAT64,
+                                         GPA_USAGE_TYPE_CYCLES,
+                                         busyCyclesCounters,
+                                         "0,1,2,3,sum4,num_shader_engines,/",
+                                         "00000000-0000-0000-0000-000000000002");
+
+    std::vector<gpa_uint32> timeCounters = {20, 21};
+    derivedCounters.DefineDerivedCounter("Time",
+                                         "Test",
+                                         "Time in nanoseconds",
+                                         GPA_DATA_TYPE_FLOAT64,
+                                         GPA_USAGE_TYPE_NANOSECONDS,
+                                         timeCounters,
+                                         "1,0,-,TS_FREQ,/,(1000000000),*",
+                                         "00000000-0000-0000-0000-000000000003");
+
+    std::vector<gpa_uint32> countCounters = {13, 12, 11, 10, 21, 20};
+    derivedCounters.DefineDerivedCounter("Count",
+                                         "Test",
+                                         "Selected count",
+                                         GPA_DATA_TYPE_UINT64,
+                                         GPA_USAGE_TYPE_ITEMS,
+                                         countCounters,
+                                         "0,1,2,3,4,5,4,5,comparemax4,0,1,max,2,3,min,ifnotzero",
+                                         "00000000-0000-0000-0000-000000000004");
+
+    std::vector<gpa_uint32> vectorCounters = {10, 11, 12, 13, 20};
+    derivedCounters.DefineDerivedCounter("Vector",
+                                         "Test",
+                                         "Vector operations",
+                                         GPA_DATA_TYPE_FLOAT64,
+                                         GPA_USAGE_TYPE_RATIO,
+                                         vectorCounters,
+                                         "0,1,2,3,vecsub2,4,scalarDiv2,4,0,1,scalarMul2,vecdiv2,avg2",
+                                         "00000000-0000-0000-0000-000000000005");
+
+    GPA_DerivedCounterEvaluator evaluator;
+    VerifyEvaluatorMatchesInterpreter(derivedCounters, hwInfo, evaluator);
+
+    // the formulas only reference six distinct hardware counters, and the busy sum is computed once
+    EXPECT_EQ(6u, evaluator.GetInputs().size());
+    EXPECT_EQ(5u, evaluator.GetNumOutputs());
+    EXPECT_LT(evaluator.GetNumNodes(), evaluator.GetNumUnsharedNodes());
+}
+
+TEST(GPUPerfAPIDerivedCounterEvaluatorTests, RejectsInvalidFormulas)
+{
+    GPA_HWInfo hwInfo;
+    InitHwInfo(hwInfo);
+
+    GPA_DerivedCounterEvaluator evaluator;
+    std::vector<gpa_uint32>     internalCounters = {1, 2};
+    gpa_uint32                  outputIndex      = 0;
+
+    EXPECT_EQ(GPA_STATUS_ERROR_INVALID_COUNTER_EQUATION, evaluator.AddCounter("0,1", internalCounters, GPA_DATA_TYPE_UINT64, &hwInfo, outputIndex));
+    EXPECT_EQ(GPA_STATUS_ERROR_INVALID_COUNTER_EQUATION, evaluator.AddCounter("0,+", internalCounters, GPA_DATA_TYPE_UINT64, &hwInfo, outputIndex));
+    EXPECT_EQ(GPA_STATUS_ERROR_INVALID_COUNTER_EQUATION, evaluator.AddCounter("0,2,+", internalCounters, GPA_DATA_TYPE_UINT64, &hwInfo, outputIndex));
+    EXPECT_EQ(GPA_STATUS_ERROR_INVALID_COUNTER_EQUATION, evaluator.AddCounter(nullptr, internalCounters, GPA_DATA_TYPE_UINT64, &hwInfo, outputIndex));
+    EXPECT_EQ(0u, evaluator.GetNumOutputs());
+    EXPECT_EQ(0u, evaluator.GetNumNodes());
+    EXPECT_EQ(0u, evaluator.GetNumUnsharedNodes());
+    EXPECT_TRUE(evaluator.GetInputs().empty());
+}
+
+TEST(GPUPerfAPIDerivedCounterEvaluatorTests, RejectedFormulaLeavesGraphUnchanged)
+{
+    GPA_HWInfo hwInfo;
+    InitHwInfo(hwInfo);
+
+    GPA_DerivedCounterEvaluator evaluator;
+    std::vector<gpa_uint32>     sumCounters     = {1, 2};
+    std::vector<gpa_uint32>     invalidCounters = {2, 3, 4};
+    gpa_uint32                  sumOutput       = 0;
+    gpa_uint32                  invalidOutput   = 0;
+
+    ASSERT_EQ(GPA_STATUS_OK, evaluator.AddCounter("0,1,+", sumCounters, GPA_DATA_TYPE_UINT64, &hwInfo, sumOutput));
+
+    gpa_uint32 numNodes         = evaluator.GetNumNodes();
+    gpa_uint32 numUnsharedNodes = evaluator.GetNumUnsharedNodes();
+
+    // the formula adds new inputs and nodes before the missing operand of the last operator is detected
+    EXPECT_EQ(GPA_STATUS_ERROR_INVALID_COUNTER_EQUATION, evaluator.AddCounter("1,2,*,(3),+,-", invalidCounters, GPA_DATA_TYPE_UINT64, &hwInfo, invalidOutput));
+    EXPECT_EQ(numNodes, evaluator.GetNumNodes());
+    EXPECT_EQ(numUnsharedNodes, evaluator.GetNumUnsharedNodes());
+    EXPECT_EQ(sumCounters, evaluator.GetInputs());
+    EXPECT_EQ(1u, evaluator.GetNumOutputs());
+
+    // the nodes of the rejected formula can be added again by a valid one
+    gpa_uint32 productOutput = 0;
+    ASSERT_EQ(GPA_STATUS_OK, evaluator.AddCounter("1,2,*,(3),+", invalidCounters, GPA_DATA_TYPE_UINT64, &hwInfo, productOutput));
+
+    std::vector<gpa_uint64> inputValues = {5, 7, 11, 13};
+    std::vector<gpa_uint64> nodeValues;
+    std::vector<gpa_uint64> outputValues(evaluator.GetNumOutputs());
+    ASSERT_EQ(4u, evaluator.GetInputs().size());
+    evaluator.Evaluate(inputValues.data(), nodeValues, outputValues.data());
+
+    EXPECT_EQ(12u, outputValues[sumOutput]);
+    EXPECT_EQ(11u * 13u + 3u, outputValues[productOutput]);
+}
+
+#ifdef GL
+TEST(GPUPerfAPIDerivedCounterEvaluatorTests, MatchesInterpreterForGLGfx9Counters)
+{
+    GPA_HWInfo hwInfo;
+    InitHwInfo(hwInfo);
+
+    GPA_DerivedCounters derivedCounters;
+    AutoDefinePublicDerivedCountersGLGfx9(derivedCounters);
+
+    GPA_DerivedCounterEvaluator evaluator;
+    VerifyEvaluatorMatchesInterpreter(derivedCounters, hwInfo, evaluator);
+
+    EXPECT_EQ(derivedCounters.GetNumCounters(), evaluator.GetNumOutputs());
+    EXPECT_LT(evaluator.GetNumNodes(), evaluator.GetNumUnsharedNodes());
+}
+#endif
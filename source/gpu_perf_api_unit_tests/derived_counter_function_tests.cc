@@ -0,0 +1,280 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Unit tests for the native derived counter functions generated by the counter compiler
+//==============================================================================
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "gpa_hw_info.h"
+#include "gpa_derived_counter.h"
+
+#ifdef CL
+#include "public_counter_definitions_cl_gfx8.h"
+#include "public_counter_definitions_cl_gfx8_asics.h"
+#include "public_counter_definitions_cl_gfx9.h"
+#include "public_counter_definitions_cl_gfx9_asics.h"
+#include "public_counter_definitions_cl_gfx10.h"
+#include "public_counter_definitions_cl_gfx10_asics.h"
+#endif
+
+#ifdef DX11
+#include "public_counter_definitions_dx11_gfx8.h"
+#include "public_counter_definitions_dx11_gfx8_asics.h"
+#include "public_counter_definitions_dx11_gfx9.h"
+#include "public_counter_definitions_dx11_gfx9_asics.h"
+#include "public_counter_definitions_dx11_gfx10.h"
+#include "public_counter_definitions_dx11_gfx10_asics.h"
+#endif
+
+#ifdef DX12
+#include "public_counter_definitions_dx12_gfx8.h"
+#include "public_counter_definitions_dx12_gfx8_asics.h"
+#include "public_counter_definitions_dx12_gfx9.h"
+#include "public_counter_definitions_dx12_gfx9_asics.h"
+#include "public_counter_definitions_dx12_gfx10.h"
+#include "public_counter_definitions_dx12_gfx10_asics.h"
+#endif
+
+#ifdef GL
+#include "public_counter_definitions_gl_gfx8.h"
+#include "public_counter_definitions_gl_gfx8_asics.h"
+#include "public_counter_definitions_gl_gfx9.h"
+#include "public_counter_definitions_gl_gfx9_asics.h"
+#include "public_counter_definitions_gl_gfx10.h"
+#include "public_counter_definitions_gl_gfx10_asics.h"
+#endif
+
+#ifdef VK
+#include "public_counter_definitions_vk_gfx8.h"
+#include "public_counter_definitions_vk_gfx8_asics.h"
+#include "public_counter_definitions_vk_gfx9.h"
+#include "public_counter_definitions_vk_gfx9_asics.h"
+#include "public_counter_definitions_vk_gfx10.h"
+#include "public_counter_definitions_vk_gfx10_asics.h"
+#endif
+
+/// Number of sets of internal counter values with which each counter is verified
+static const gpa_uint32 s_numValueSets = 4;
+
+/// Creates the hardware info used to resolve the device constants of the formulas
+/// \param[out] hwInfo the hardware info to initialize
+static void InitHwInfo(GPA_HWInfo& hwInfo)
+{
+    hwInfo.SetNumberShaderEngines(4);
+    hwInfo.SetNumberShaderArrays(8);
+    hwInfo.SetNumberSIMDs(256);
+    hwInfo.SetNumberCUs(64);
+    hwInfo.SetTimeStampFrequency(100000000);
+}
+
+/// Gets a value for an internal counter result, so that formulas are verified with large, small and zero results
+/// \param valueSet the index of the set of values
+/// \param resultIndex the index of the result in the formula
+/// \return the value of the internal counter result
+static gpa_uint64 GetInternalCounterValue(gpa_uint32 valueSet, size_t resultIndex)
+{
+    gpa_uint64 hash = (static_cast<gpa_uint64>(resultIndex) + 1) * 2654435761u + valueSet * 40503u;
+
+    switch (valueSet)
+    {
+    case 0:
+        return hash % 100003u;
+
+    case 1:
+        // every other result is zero, which exercises the divisions by zero and the conditional operators
+        return (0 == resultIndex % 2) ? 0 : hash % 1000u;
+
+    case 2:
+        return 0;
+
+    default:
+        return hash % 7u;
+    }
+}
+
+/// Computes every counter of the derived counter set with its native function and with the formula interpreter
+/// and verifies that the results are identical
+/// \param derivedCounters the derived counters to verify
+/// \param hwInfo the hardware info used to resolve the device constants
+static void VerifyFunctionsMatchInterpreter(const GPA_DerivedCounters& derivedCounters, const GPA_HWInfo& hwInfo)
+{
+    for (gpa_uint32 counterIndex = 0; counterIndex < derivedCounters.GetNumCounters(); ++counterIndex)
+    {
+        const GPA_DerivedCounter* pCounter = derivedCounters.GetCounter(counterIndex);
+
+        // the counter compiler generates a function for every public counter
+        ASSERT_NE(nullptr, pCounter->m_pComputeFunction) << pCounter->m_pName;
+
+        for (gpa_uint32 valueSet = 0; valueSet < s_numValueSets; ++valueSet)
+        {
+            std::vector<gpa_uint64>        values;
+            std::vector<const gpa_uint64*> results;
+            std::vector<GPA_Data_Type>     types(pCounter->m_internalCountersRequired.size(), GPA_DATA_TYPE_UINT64);
+
+            for (size_t resultIndex = 0; resultIndex < pCounter->m_internalCountersRequired.size(); ++resultIndex)
+            {
+                values.push_back(GetInternalCounterValue(valueSet, resultIndex));
+            }
+
+            for (auto valueIter = values.cbegin(); valueIter != values.cend(); ++valueIter)
+            {
+                results.push_back(&(*valueIter));
+            }
+
+            gpa_float64 expected = 0;
+            gpa_float64 actual   = 0;
+            ASSERT_EQ(GPA_STATUS_OK, derivedCounters.EvaluateCounterExpression(counterIndex, results, types, &expected, &hwInfo)) << pCounter->m_pName;
+            ASSERT_EQ(GPA_STATUS_OK, derivedCounters.ComputeCounterValue(counterIndex, results, types, &actual, &hwInfo)) << pCounter->m_pName;
+            EXPECT_EQ(expected, actual) << pCounter->m_pName << " with value set " << valueSet;
+        }
+    }
+}
+
+/// Defines the public counters of a hardware generation
+typedef void (*DefinePublicCountersFunction)(GPA_DerivedCounters& c);
+
+/// Replaces the public counters of a hardware generation with the formulas specific to an ASIC
+typedef void (*UpdateAsicSpecificCountersFunction)(GDT_HW_GENERATION desired_generation, GDT_HW_ASIC_TYPE asic_type, GPA_DerivedCounters& c);
+
+/// Verifies that the native functions of the public counters of a hardware generation, and of each of its ASICs,
+/// compute the same results as the formula interpreter
+/// \param generation the hardware generation
+/// \param defineCounters the function defining the public counters of the generation
+/// \param updateAsicCounters the function applying the ASIC specific formulas of the generation
+/// \param hwInfo the hardware info used to resolve the device constants
+static void VerifyGenerationFunctionsMatchInterpreter(GDT_HW_GENERATION                  generation,
+                                                      DefinePublicCountersFunction       defineCounters,
+                                                      UpdateAsicSpecificCountersFunction updateAsicCounters,
+                                                      const GPA_HWInfo&                  hwInfo)
+{
+    GPA_DerivedCounters generationCounters;
+    defineCounters(generationCounters);
+    ASSERT_LT(0u, generationCounters.GetNumCounters());
+    VerifyFunctionsMatchInterpreter(generationCounters, hwInfo);
+
+    // ASICs which do not belong to the generation leave its counters unchanged
+    for (int asicType = GDT_ASIC_TYPE_NONE + 1; asicType < GDT_LAST; ++asicType)
+    {
+        GPA_DerivedCounters asicCounters;
+        defineCounters(asicCounters);
+        updateAsicCounters(generation, static_cast<GDT_HW_ASIC_TYPE>(asicType), asicCounters);
+        ASSERT_NO_FATAL_FAILURE(VerifyFunctionsMatchInterpreter(asicCounters, hwInfo)) << "ASIC type " << asicType;
+    }
+}
+
+/// Native function of a test counter, as generated for the formula "0,1,/,(100),*"
+/// \param results the results of the internal counters required by the counter
+/// \param[out] pResult the result of the computation
+/// \param pHwInfo the hardware info
+static void ComputeTestPercentage(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    const gpa_float64 r0 = static_cast<gpa_float64>(*results[0]);
+    const gpa_float64 r1 = static_cast<gpa_float64>(*results[1]);
+
+    const gpa_float64 v0 = (r1 != 0.0) ? (r0 / r1) : 0.0;
+    const gpa_float64 v1 = v0 * 100.0;
+
+    *static_cast<gpa_float64*>(pResult) = v1;
+}
+
+TEST(GPUPerfAPIDerivedCounterFunctionTests, FunctionIsUsedAndReplacedByAsicUpdate)
+{
+    GPA_HWInfo hwInfo;
+    InitHwInfo(hwInfo);
+
+    GPA_DerivedCounters     derivedCounters;
+    std::vector<gpa_uint32> internalCounters = {3, 7};
+    derivedCounters.DefineDerivedCounter("TestPercentage",
+                                         "Test",
+                                         "Percentage of the first counter relative to the second one",
+                                         GPA_DATA_TYPE_FLOAT64,
+                                         GPA_USAGE_TYPE_PERCENTAGE,
+                                         internalCounters,
+                                         "0,1,/,(100),*",
+                                         "00000000-0000-0000-0000-000000000001",
+                                         ComputeTestPercentage);
+
+    ASSERT_EQ(1u, derivedCounters.GetNumCounters());
+    EXPECT_EQ(&ComputeTestPercentage, derivedCounters.GetCounter(0)->m_pComputeFunction);
+
+    gpa_uint64                     values[] = {25, 200};
+    std::vector<const gpa_uint64*> results  = {&values[0], &values[1]};
+    std::vector<GPA_Data_Type>     types(2, GPA_DATA_TYPE_UINT64);
+    gpa_float64                    result = 0;
+
+    EXPECT_EQ(GPA_STATUS_OK, derivedCounters.ComputeCounterValue(0, results, types, &result, &hwInfo));
+    EXPECT_EQ(12.5, result);
+
+    // an ASIC specific formula without a function of its own is interpreted
+    derivedCounters.UpdateAsicSpecificDerivedCounter("TestPercentage", internalCounters, "1,0,/,(100),*");
+    EXPECT_EQ(nullptr, derivedCounters.GetCounter(0)->m_pComputeFunction);
+
+    EXPECT_EQ(GPA_STATUS_OK, derivedCounters.ComputeCounterValue(0, results, types, &result, &hwInfo));
+    EXPECT_EQ(800.0, result);
+}
+
+#ifdef CL
+TEST(GPUPerfAPIDerivedCounterFunctionTests, MatchInterpreterForCLCounters)
+{
+    GPA_HWInfo hwInfo;
+    InitHwInfo(hwInfo);
+
+    VerifyGenerationFunctionsMatchInterpreter(GDT_HW_GENERATION_VOLCANICISLAND, AutoDefinePublicDerivedCountersCLGfx8, clgfx8asics::UpdatePublicAsicSpecificCounters, hwInfo);
+    VerifyGenerationFunctionsMatchInterpreter(GDT_HW_GENERATION_GFX9, AutoDefinePublicDerivedCountersCLGfx9, clgfx9asics::UpdatePublicAsicSpecificCounters, hwInfo);
+    VerifyGenerationFunctionsMatchInterpreter(GDT_HW_GENERATION_GFX10, AutoDefinePublicDerivedCountersCLGfx10, clgfx10asics::UpdatePublicAsicSpecificCounters, hwInfo);
+}
+#endif
+
+#ifdef DX11
+TEST(GPUPerfAPIDerivedCounterFunctionTests, MatchInterpreterForDX11Counters)
+{
+    GPA_HWInfo hwInfo;
+    InitHwInfo(hwInfo);
+
+    VerifyGenerationFunctionsMatchInterpreter(GDT_HW_GENERATION_VOLCANICISLAND, AutoDefinePublicDerivedCountersDX11Gfx8, dx11gfx8asics::UpdatePublicAsicSpecificCounters, hwInfo);
+    VerifyGenerationFunctionsMatchInterpreter(GDT_HW_GENERATION_GFX9, AutoDefinePublicDerivedCountersDX11Gfx9, dx11gfx9asics::UpdatePublicAsicSpecificCounters, hwInfo);
+    VerifyGenerationFunctionsMatchInterpreter(GDT_HW_GENERATION_GFX10, AutoDefinePublicDerivedCountersDX11Gfx10, dx11gfx10asics::UpdatePublicAsicSpecificCounters, hwInfo);
+}
+#endif
+
+#ifdef DX12
+TEST(GPUPerfAPIDerivedCounterFunctionTests, MatchInterpreterForDX12Counters)
+{
+    GPA_HWInfo hwInfo;
+    InitHwInfo(hwInfo);
+
+    VerifyGenerationFunctionsMatchInterpreter(GDT_HW_GENERATION_VOLCANICISLAND, AutoDefinePublicDerivedCountersDX12Gfx8, dx12gfx8asics::UpdatePublicAsicSpecificCounters, hwInfo);
+    VerifyGenerationFunctionsMatchInterpreter(GDT_HW_GENERATION_GFX9, AutoDefinePublicDerivedCountersDX12Gfx9, dx12gfx9asics::UpdatePublicAsicSpecificCounters, hwInfo);
+    VerifyGenerationFunctionsMatchInterpreter(GDT_HW_GENERATION_GFX10, AutoDefinePublicDerivedCountersDX12Gfx10, dx12gfx10asics::UpdatePublicAsicSpecificCounters, hwInfo);
+}
+#endif
+
+#ifdef GL
+TEST(GPUPerfAPIDerivedCounterFunctionTests, MatchInterpreterForGLCounters)
+{
+    GPA_HWInfo hwInfo;
+    InitHwInfo(hwInfo);
+
+    VerifyGenerationFunctionsMatchInterpreter(GDT_HW_GENERATION_VOLCANICISLAND, AutoDefinePublicDerivedCountersGLGfx8, glgfx8asics::UpdatePublicAsicSpecificCounters, hwInfo);
+    VerifyGenerationFunctionsMatchInterpreter(GDT_HW_GENERATION_GFX9, AutoDefinePublicDerivedCountersGLGfx9, glgfx9asics::UpdatePublicAsicSpecificCounters, hwInfo);
+    VerifyGenerationFunctionsMatchInterpreter(GDT_HW_GENERATION_GFX10, AutoDefinePublicDerivedCountersGLGfx10, glgfx10asics::UpdatePublicAsicSpecificCounters, hwInfo);
+}
+#endif
+
+#ifdef VK
+TEST(GPUPerfAPIDerivedCounterFunctionTests, MatchInterpreterForVKCounters)
+{
+    GPA_HWInfo hwInfo;
+    InitHwInfo(hwInfo);
+
+    VerifyGenerationFunctionsMatchInterpreter(GDT_HW_GENERATION_VOLCANICISLAND, AutoDefinePublicDerivedCountersVKGfx8, vkgfx8asics::UpdatePublicAsicSpecificCounters, hwInfo);
+    VerifyGenerationFunctionsMatchInterpreter(GDT_HW_GENERATION_GFX9, AutoDefinePublicDerivedCountersVKGfx9, vkgfx9asics::UpdatePublicAsicSpecificCounters, hwInfo);
+    VerifyGenerationFunctionsMatchInterpreter(GDT_HW_GENERATION_GFX10, AutoDefinePublicDerivedCountersVKGfx10, vkgfx10asics::UpdatePublicAsicSpecificCounters, hwInfo);
+}
+#endif
@@ -0,0 +1,104 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Unit tests for the hardware counters described once for all instances of their block
+//==============================================================================
+
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include "gpa_hardware_counters.h"
+
+/// String pool of the test block, laid out like the generated string pools
+static const char testBlockStrings[] =
+    "\0"
+    "CB#\0"
+    "CB#_000\0"
+    "Counter 0 from group CB#\0"
+    "CB#_PERF_SEL_DRAWN_PIXEL\0"
+    "Number of drawn pixels.";
+
+/// The counters of the test block
+static const GPA_HardwareBlockCounterDesc testBlockCounters[] = {
+    {5, 13},
+    {38, 63},
+};
+
+/// The test block, which has two instances
+static const GPA_HardwareBlockDesc testBlock = {testBlockStrings, 1, 2, 2, testBlockCounters};
+
+TEST(GPUPerfAPIHardwareCountersTests, ExpandsBlockCounters)
+{
+    GPA_HardwareCounterDesc instanceCounters[2] = {};
+    ExpandHardwareBlockCounters(testBlock, instanceCounters);
+
+    EXPECT_EQ(0u, instanceCounters[0].m_counterIndexInGroup);
+    EXPECT_EQ(1u, instanceCounters[1].m_counterIndexInGroup);
+    EXPECT_STREQ("CB#_000", instanceCounters[0].m_pName);
+    EXPECT_STREQ("CB#", instanceCounters[0].m_pGroup);
+    EXPECT_STREQ("Counter 0 from group CB#", instanceCounters[0].m_pDescription);
+    EXPECT_STREQ("CB#_PERF_SEL_DRAWN_PIXEL", instanceCounters[1].m_pName);
+    EXPECT_STREQ("Number of drawn pixels.", instanceCounters[1].m_pDescription);
+    EXPECT_EQ(GPA_DATA_TYPE_UINT64, instanceCounters[1].m_type);
+    EXPECT_EQ(0u, instanceCounters[1].m_min);
+    EXPECT_EQ(GPA_UINT64_MAX, instanceCounters[1].m_max);
+}
+
+TEST(GPUPerfAPIHardwareCountersTests, SynthesizesBlockInstanceNames)
+{
+    GPA_HardwareCounterDesc cb0Counters[2] = {};
+    GPA_HardwareCounterDesc cb1Counters[2] = {};
+    ExpandHardwareBlockCounters(testBlock, cb0Counters);
+    ExpandHardwareBlockCounters(testBlock, cb1Counters);
+
+    // a counter which is not shared by the instances of its block keeps its own strings
+    char                    rpbName[]        = "RPB_000";
+    char                    rpbDescription[] = "Counter 0 from group RPB";
+    GPA_HardwareCounterDesc rpbCounters[1]   = {{0, rpbName, rpbName, rpbDescription, GPA_DATA_TYPE_UINT64, 0, GPA_UINT64_MAX}};
+
+    char                     cb0GroupName[]  = "CB0";
+    char                     cb1GroupName[]  = "CB1";
+    char                     rpbGroupName[]  = "RPB";
+    GPA_CounterGroupDesc     groups[]        = {{0, cb0GroupName, 0, 2, 4, 0}, {1, cb1GroupName, 1, 2, 4, 0}, {2, rpbGroupName, 0, 1, 4, 0}};
+    GPA_HardwareCounterDesc* counterGroups[] = {cb0Counters, cb1Counters, rpbCounters};
+
+    GPA_HardwareCounters hardwareCounters;
+    hardwareCounters.m_ppCounterGroupArray = counterGroups;
+    hardwareCounters.m_pGroups             = groups;
+    hardwareCounters.m_groupCount          = 3;
+
+    for (gpa_uint32 groupIndex = 0; groupIndex < hardwareCounters.m_groupCount; ++groupIndex)
+    {
+        for (gpa_uint32 counterIndex = 0; counterIndex < groups[groupIndex].m_numCounters; ++counterIndex)
+        {
+            GPA_HardwareCounterDescExt counter = {};
+            counter.m_groupIndex               = groupIndex;
+            counter.m_pHardwareCounter         = &counterGroups[groupIndex][counterIndex];
+            hardwareCounters.m_counters.push_back(counter);
+        }
+    }
+
+    EXPECT_STREQ("CB0_000", hardwareCounters.GetCounterName(0));
+    EXPECT_STREQ("Counter 0 from group CB0", hardwareCounters.GetCounterDescription(0));
+    EXPECT_STREQ("CB0_PERF_SEL_DRAWN_PIXEL", hardwareCounters.GetCounterName(1));
+    EXPECT_STREQ("CB1_000", hardwareCounters.GetCounterName(2));
+    EXPECT_STREQ("Counter 0 from group CB1", hardwareCounters.GetCounterDescription(2));
+    EXPECT_STREQ("CB1_PERF_SEL_DRAWN_PIXEL", hardwareCounters.GetCounterName(3));
+
+    // the description has no block instance, so it is the one of the block
+    EXPECT_EQ(cb1Counters[1].m_pDescription, hardwareCounters.GetCounterDescription(3));
+    EXPECT_EQ(rpbName, hardwareCounters.GetCounterName(4));
+    EXPECT_EQ(rpbDescription, hardwareCounters.GetCounterDescription(4));
+
+    // a synthesized name is kept, so that it can be returned to the application
+    const char* pSynthesizedName = hardwareCounters.GetCounterName(3);
+    hardwareCounters.GetCounterName(0);
+    EXPECT_EQ(pSynthesizedName, hardwareCounters.GetCounterName(3));
+
+    // the UUID of a counter depends on the name of its block instance
+    GPA_UUID cb0Uuid = hardwareCounters.GetCounterUuid(1);
+    GPA_UUID cb1Uuid = hardwareCounters.GetCounterUuid(3);
+    EXPECT_NE(0, memcmp(&cb0Uuid, &cb1Uuid, sizeof(GPA_UUID)));
+}
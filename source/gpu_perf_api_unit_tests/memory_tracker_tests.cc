@@ -0,0 +1,83 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Unit tests for the memory tracker
+//==============================================================================
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "gpa_memory_tracker.h"
+
+/// Gets the statistics of a memory category, expecting the category to be valid
+/// \param[in] category the memory category
+/// \param[out] numBytes the number of bytes held by the category
+/// \param[out] numObjects the number of live objects of the category
+static void GetStats(GPA_Memory_Category category, gpa_uint64& numBytes, gpa_uint64& numObjects)
+{
+    EXPECT_TRUE(GPAMemoryTracker::GetStats(category, &numBytes, &numObjects));
+}
+
+TEST(GPUPerfAPIMemoryTrackerTests, InvalidCategory)
+{
+    gpa_uint64 numBytes   = 0;
+    gpa_uint64 numObjects = 0;
+
+    EXPECT_FALSE(GPAMemoryTracker::GetStats(GPA_MEMORY_CATEGORY__LAST, &numBytes, &numObjects));
+    EXPECT_FALSE(GPAMemoryTracker::GetStats(static_cast<GPA_Memory_Category>(-1), &numBytes, &numObjects));
+}
+
+TEST(GPUPerfAPIMemoryTrackerTests, TrackedMemoryLifetime)
+{
+    // the backend category is not used by the objects of the unit tests, so the statistics are not disturbed
+    gpa_uint64 baseBytes   = 0;
+    gpa_uint64 baseObjects = 0;
+    GetStats(GPA_MEMORY_CATEGORY_BACKEND, baseBytes, baseObjects);
+
+    gpa_uint64 numBytes   = 0;
+    gpa_uint64 numObjects = 0;
+
+    {
+        GPATrackedMemory trackedMemory(GPA_MEMORY_CATEGORY_BACKEND, 100);
+        GetStats(GPA_MEMORY_CATEGORY_BACKEND, numBytes, numObjects);
+        EXPECT_EQ(baseBytes + 100, numBytes);
+        EXPECT_EQ(baseObjects + 1, numObjects);
+
+        trackedMemory.SetBytes(1000);
+        EXPECT_EQ(1000u, trackedMemory.GetBytes());
+        GetStats(GPA_MEMORY_CATEGORY_BACKEND, numBytes, numObjects);
+        EXPECT_EQ(baseBytes + 1000, numBytes);
+
+        trackedMemory.SetBytes(10);
+        GetStats(GPA_MEMORY_CATEGORY_BACKEND, numBytes, numObjects);
+        EXPECT_EQ(baseBytes + 10, numBytes);
+
+        // a copy is accounted as a new object
+        GPATrackedMemory copiedMemory(trackedMemory);
+        GetStats(GPA_MEMORY_CATEGORY_BACKEND, numBytes, numObjects);
+        EXPECT_EQ(baseBytes + 20, numBytes);
+        EXPECT_EQ(baseObjects + 2, numObjects);
+
+        // assigning moves the accounting of the target to the category and size of the source
+        GPATrackedMemory assignedMemory(GPA_MEMORY_CATEGORY_BACKEND, 5000);
+        assignedMemory = trackedMemory;
+        GetStats(GPA_MEMORY_CATEGORY_BACKEND, numBytes, numObjects);
+        EXPECT_EQ(baseBytes + 30, numBytes);
+        EXPECT_EQ(baseObjects + 3, numObjects);
+    }
+
+    GetStats(GPA_MEMORY_CATEGORY_BACKEND, numBytes, numObjects);
+    EXPECT_EQ(baseBytes, numBytes);
+    EXPECT_EQ(baseObjects, numObjects);
+}
+
+TEST(GPUPerfAPIMemoryTrackerTests, ContainerEstimates)
+{
+    std::vector<gpa_uint64> values;
+    EXPECT_EQ(0u, GPAContainerBytes(values));
+
+    values.reserve(16);
+    EXPECT_EQ(values.capacity() * sizeof(gpa_uint64), GPAContainerBytes(values));
+}
@@ -0,0 +1,235 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Unit tests for the sample index
+//==============================================================================
+
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "gpa_sample_index.h"
+
+/// Object stored in the sample indices under test
+struct TestSample
+{
+    gpa_uint32 m_sampleId;  ///< the sample id the object was added with
+};
+
+/// Creates one object per sample id
+/// \param[in] sampleIds the sample ids
+/// \return the objects, in sample id order
+static std::vector<TestSample> CreateSamples(const std::vector<gpa_uint32>& sampleIds)
+{
+    std::vector<TestSample> samples;
+
+    for (auto idIter = sampleIds.cbegin(); idIter != sampleIds.cend(); ++idIter)
+    {
+        samples.push_back({*idIter});
+    }
+
+    return samples;
+}
+
+/// Adds the objects to the index and verifies that they can all be found
+/// \param[in] samples the objects to add
+/// \param[in,out] sampleIndex the index
+static void VerifyInsertAndFind(std::vector<TestSample>& samples, GPASampleIndex<TestSample>& sampleIndex)
+{
+    for (auto sampleIter = samples.begin(); sampleIter != samples.end(); ++sampleIter)
+    {
+        EXPECT_TRUE(sampleIndex.Insert(sampleIter->m_sampleId, &(*sampleIter)));
+    }
+
+    EXPECT_EQ(samples.size(), sampleIndex.Size());
+
+    for (auto sampleIter = samples.begin(); sampleIter != samples.end(); ++sampleIter)
+    {
+        EXPECT_EQ(&(*sampleIter), sampleIndex.Find(sampleIter->m_sampleId));
+    }
+
+    size_t iterated = 0;
+
+    sampleIndex.Iterate([&iterated](gpa_uint32 sampleId, TestSample* pSample) {
+        EXPECT_EQ(sampleId, pSample->m_sampleId);
+        ++iterated;
+        return true;
+    });
+
+    EXPECT_EQ(samples.size(), iterated);
+}
+
+TEST(GPUPerfAPISampleIndexTests, SequentialIdsStayDense)
+{
+    std::vector<gpa_uint32> sampleIds;
+
+    for (gpa_uint32 sampleId = 0; sampleId < 1000; ++sampleId)
+    {
+        sampleIds.push_back(sampleId);
+    }
+
+    std::vector<TestSample>    samples = CreateSamples(sampleIds);
+    GPASampleIndex<TestSample> sampleIndex;
+    VerifyInsertAndFind(samples, sampleIndex);
+
+    EXPECT_TRUE(sampleIndex.IsDense());
+    EXPECT_EQ(nullptr, sampleIndex.Find(1000));
+    EXPECT_EQ(nullptr, sampleIndex.Find(0xFFFFFFFF));
+
+    // a sample id can only be added once
+    TestSample duplicate = {10};
+    EXPECT_FALSE(sampleIndex.Insert(10, &duplicate));
+    EXPECT_EQ(&samples[10], sampleIndex.Find(10));
+    EXPECT_EQ(samples.size(), sampleIndex.Size());
+}
+
+TEST(GPUPerfAPISampleIndexTests, OffsetAndReversedIdsStayDense)
+{
+    // samples begun on a secondary command list, or ids handed out in reverse order
+    std::vector<gpa_uint32> sampleIds;
+
+    for (gpa_uint32 sampleId = 5000; sampleId > 4000; --sampleId)
+    {
+        sampleIds.push_back(sampleId);
+    }
+
+    std::vector<TestSample>    samples = CreateSamples(sampleIds);
+    GPASampleIndex<TestSample> sampleIndex;
+    VerifyInsertAndFind(samples, sampleIndex);
+
+    EXPECT_TRUE(sampleIndex.IsDense());
+    EXPECT_EQ(nullptr, sampleIndex.Find(0));
+    EXPECT_EQ(nullptr, sampleIndex.Find(4000));
+}
+
+TEST(GPUPerfAPISampleIndexTests, SparseIdsSwitchToHashing)
+{
+    std::vector<gpa_uint32> sampleIds = {0, 1, 2, 0x10000, 0x7FFFFFFF, 3, 0xFFFFFFFF};
+
+    std::vector<TestSample>    samples = CreateSamples(sampleIds);
+    GPASampleIndex<TestSample> sampleIndex;
+    VerifyInsertAndFind(samples, sampleIndex);
+
+    EXPECT_FALSE(sampleIndex.IsDense());
+    EXPECT_EQ(nullptr, sampleIndex.Find(4));
+
+    sampleIndex.Clear();
+    EXPECT_TRUE(sampleIndex.IsDense());
+    EXPECT_EQ(0u, sampleIndex.Size());
+    EXPECT_EQ(nullptr, sampleIndex.Find(0));
+}
+
+TEST(GPUPerfAPISampleIndexTests, ReservedIdsStayDense)
+{
+    // with the hint, a sparse subset of the reserved range does not switch to hashing
+    std::vector<gpa_uint32> sampleIds = {9999, 0, 5000};
+
+    std::vector<TestSample>    samples = CreateSamples(sampleIds);
+    GPASampleIndex<TestSample> sampleIndex;
+    sampleIndex.Reserve(9999);
+    VerifyInsertAndFind(samples, sampleIndex);
+
+    EXPECT_TRUE(sampleIndex.IsDense());
+
+    // ids outside of the reservation are still supported
+    TestSample outsideReservation = {0x80000000};
+    EXPECT_TRUE(sampleIndex.Insert(outsideReservation.m_sampleId, &outsideReservation));
+    EXPECT_EQ(&outsideReservation, sampleIndex.Find(outsideReservation.m_sampleId));
+    EXPECT_EQ(&samples[2], sampleIndex.Find(5000));
+    EXPECT_FALSE(sampleIndex.IsDense());
+}
+
+TEST(GPUPerfAPISampleIndexTests, ResetKeepsDenseStorage)
+{
+    // a reset session adds the same sample ids again, possibly in a different order
+    std::vector<gpa_uint32> sampleIds;
+
+    for (gpa_uint32 sampleId = 0; sampleId < 1000; ++sampleId)
+    {
+        sampleIds.push_back(sampleId);
+    }
+
+    std::vector<TestSample>    samples = CreateSamples(sampleIds);
+    GPASampleIndex<TestSample> sampleIndex;
+    VerifyInsertAndFind(samples, sampleIndex);
+
+    sampleIndex.Reset();
+    EXPECT_TRUE(sampleIndex.IsDense());
+    EXPECT_EQ(0u, sampleIndex.Size());
+    EXPECT_EQ(nullptr, sampleIndex.Find(0));
+
+    // the storage of the previous frame is reused, so sparse use of the same ids does not switch to hashing
+    std::vector<gpa_uint32> nextSampleIds = {999, 0, 500};
+    std::vector<TestSample> nextSamples   = CreateSamples(nextSampleIds);
+    VerifyInsertAndFind(nextSamples, sampleIndex);
+
+    EXPECT_TRUE(sampleIndex.IsDense());
+    EXPECT_EQ(nullptr, sampleIndex.Find(1));
+}
+
+TEST(GPUPerfAPISampleIndexTests, EraseReleasesIds)
+{
+    // the unused ids of a sample block are released when the block is ended
+    std::vector<gpa_uint32> denseIds      = {0, 1, 2, 3};
+    std::vector<gpa_uint32> sparseIds     = {0, 0x10000, 0x7FFFFFFF};
+    std::vector<TestSample> denseSamples  = CreateSamples(denseIds);
+    std::vector<TestSample> sparseSamples = CreateSamples(sparseIds);
+
+    GPASampleIndex<TestSample> denseIndex;
+    VerifyInsertAndFind(denseSamples, denseIndex);
+
+    EXPECT_TRUE(denseIndex.Erase(2));
+    EXPECT_FALSE(denseIndex.Erase(2));
+    EXPECT_FALSE(denseIndex.Erase(1000));
+    EXPECT_EQ(nullptr, denseIndex.Find(2));
+    EXPECT_EQ(&denseSamples[3], denseIndex.Find(3));
+    EXPECT_EQ(3u, denseIndex.Size());
+    EXPECT_TRUE(denseIndex.Insert(2, &denseSamples[2]));
+    EXPECT_TRUE(denseIndex.IsDense());
+
+    GPASampleIndex<TestSample> sparseIndex;
+    VerifyInsertAndFind(sparseSamples, sparseIndex);
+    EXPECT_FALSE(sparseIndex.IsDense());
+
+    EXPECT_TRUE(sparseIndex.Erase(0x10000));
+    EXPECT_FALSE(sparseIndex.Erase(0x10000));
+    EXPECT_EQ(nullptr, sparseIndex.Find(0x10000));
+    EXPECT_EQ(&sparseSamples[2], sparseIndex.Find(0x7FFFFFFF));
+    EXPECT_EQ(2u, sparseIndex.Size());
+}
+
+TEST(GPUPerfAPISampleIndexTests, LookupMatchesUnorderedMap)
+{
+    static const gpa_uint32 s_numSamples = 4096;
+
+    std::vector<gpa_uint32> sampleIds;
+
+    for (gpa_uint32 sampleId = 0; sampleId < s_numSamples; ++sampleId)
+    {
+        sampleIds.push_back(sampleId);
+    }
+
+    std::vector<TestSample> samples = CreateSamples(sampleIds);
+
+    GPASampleIndex<TestSample>                  sampleIndex;
+    std::unordered_map<gpa_uint32, TestSample*> sampleMap;
+
+    for (auto sampleIter = samples.begin(); sampleIter != samples.end(); ++sampleIter)
+    {
+        EXPECT_TRUE(sampleIndex.Insert(sampleIter->m_sampleId, &(*sampleIter)));
+        sampleMap.insert(std::make_pair(sampleIter->m_sampleId, &(*sampleIter)));
+    }
+
+    ASSERT_TRUE(sampleIndex.IsDense());
+    ASSERT_EQ(sampleMap.size(), sampleIndex.Size());
+
+    // the dense index finds the same objects as the map it replaces, and nothing past the last id
+    for (gpa_uint32 sampleId = 0; sampleId < 2 * s_numSamples; ++sampleId)
+    {
+        auto        mapIter         = sampleMap.find(sampleId);
+        TestSample* pExpectedSample = sampleMap.end() == mapIter ? nullptr : mapIter->second;
+        EXPECT_EQ(pExpectedSample, sampleIndex.Find(sampleId)) << "sample id " << sampleId;
+    }
+}
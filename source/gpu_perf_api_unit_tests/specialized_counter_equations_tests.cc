@@ -0,0 +1,201 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Unit tests for the derived counter equations specialized for the device of a context
+//==============================================================================
+
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "gpa_hw_info.h"
+#include "gpa_derived_counter.h"
+#include "gpa_derived_counter_evaluator.h"
+#include "gpa_specialized_counter_equations.h"
+
+#ifdef GL
+#include "public_counter_definitions_gl_gfx8.h"
+#include "public_counter_definitions_gl_gfx9.h"
+#include "public_counter_definitions_gl_gfx10.h"
+#endif
+
+/// Creates the hardware info whose device constants are folded into the formulas
+/// \param[out] hwInfo the hardware info to initialize
+static void InitHwInfo(GPA_HWInfo& hwInfo)
+{
+    hwInfo.SetNumberShaderEngines(4);
+    hwInfo.SetNumberShaderArrays(8);
+    hwInfo.SetNumberSIMDs(256);
+    hwInfo.SetNumberCUs(64);
+    hwInfo.SetTimeStampFrequency(100000000);
+}
+
+/// Specializes a formula
+/// \param pExpression the formula
+/// \param dataType the data type of the counter
+/// \param hwInfo the hardware info
+/// \return the specialized formula, or "invalid" if the formula could not be specialized
+static std::string Specialize(const char* pExpression, GPA_Data_Type dataType, const GPA_HWInfo& hwInfo)
+{
+    std::string specializedExpression;
+
+    if (!GPA_SpecializedCounterEquations::SpecializeEquation(pExpression, dataType, &hwInfo, specializedExpression))
+    {
+        return "invalid";
+    }
+
+    return specializedExpression;
+}
+
+TEST(GPUPerfAPISpecializedCounterEquationsTests, FoldsDeviceConstants)
+{
+    GPA_HWInfo hwInfo;
+    InitHwInfo(hwInfo);
+
+    // a timestamp duration in nanoseconds is a single scaling
+    EXPECT_EQ("1,0,-,(10),*", Specialize("1,0,-,TS_FREQ,/,(1000000000),*", GPA_DATA_TYPE_FLOAT64, hwInfo));
+
+    // a single division by a constant is kept as is
+    EXPECT_EQ("0,(64),/", Specialize("0,num_cus,/", GPA_DATA_TYPE_FLOAT64, hwInfo));
+
+    // constant sub-expressions are evaluated, and a multiplication by one disappears
+    EXPECT_EQ("0,1,+,(0.25),*", Specialize("0,1,+,num_cus,num_simds,/,*", GPA_DATA_TYPE_FLOAT64, hwInfo));
+    EXPECT_EQ("0", Specialize("0,num_shader_engines,*,num_shader_engines,/", GPA_DATA_TYPE_FLOAT64, hwInfo));
+    EXPECT_EQ("(68)", Specialize("num_cus,num_shader_engines,sum2", GPA_DATA_TYPE_FLOAT64, hwInfo));
+
+    // a division by zero is zero, whatever the dividend
+    EXPECT_EQ("(0)", Specialize("0,1,+,(0),/", GPA_DATA_TYPE_FLOAT64, hwInfo));
+
+    // a conditional with a constant condition selects its operand
+    EXPECT_EQ("1", Specialize("0,1,num_shader_engines,ifnotzero", GPA_DATA_TYPE_FLOAT64, hwInfo));
+    EXPECT_EQ("0", Specialize("0,1,(0),ifnotzero", GPA_DATA_TYPE_FLOAT64, hwInfo));
+    EXPECT_EQ("0,1,2,ifnotzero", Specialize("0,1,2,ifnotzero", GPA_DATA_TYPE_FLOAT64, hwInfo));
+
+    // integer equations are folded, but not reassociated, since their divisions truncate
+    EXPECT_EQ("(256)", Specialize("num_shader_engines,num_cus,*", GPA_DATA_TYPE_UINT64, hwInfo));
+    EXPECT_EQ("0,(64),/,(4),*", Specialize("0,num_cus,/,num_shader_engines,*", GPA_DATA_TYPE_UINT64, hwInfo));
+
+    // the operands of vector operations are only substituted
+    EXPECT_EQ("0,1,(4),(64),vecsum2,sum2", Specialize("0,1,num_shader_engines,num_cus,vecsum2,sum2", GPA_DATA_TYPE_UINT64, hwInfo));
+
+    EXPECT_EQ("invalid", Specialize("0,+", GPA_DATA_TYPE_FLOAT64, hwInfo));
+    EXPECT_EQ("invalid", Specialize("0,1", GPA_DATA_TYPE_FLOAT64, hwInfo));
+    EXPECT_EQ("invalid", Specialize("0,unknown,+", GPA_DATA_TYPE_FLOAT64, hwInfo));
+}
+
+TEST(GPUPerfAPISpecializedCounterEquationsTests, UnknownTimestampFrequencyIsNotFolded)
+{
+    GPA_HWInfo hwInfo;
+    hwInfo.SetNumberCUs(64);
+
+    EXPECT_EQ("0,TS_FREQ,/,(1000000000),*", Specialize("0,TS_FREQ,/,(1000000000),*", GPA_DATA_TYPE_FLOAT64, hwInfo));
+    EXPECT_EQ("0,TS_FREQ,/,(64),*", Specialize("0,TS_FREQ,/,num_cus,*", GPA_DATA_TYPE_FLOAT64, hwInfo));
+}
+
+#ifdef GL
+/// Gets a value for an internal counter, so that formulas are verified with large, small and zero results
+/// \param valueSet the index of the set of values
+/// \param internalCounterIndex the global index of the internal counter
+/// \return the value of the internal counter
+static gpa_uint64 GetInternalCounterValue(gpa_uint32 valueSet, gpa_uint32 internalCounterIndex)
+{
+    gpa_uint64 hash = (static_cast<gpa_uint64>(internalCounterIndex) + 1) * 2654435761u + valueSet * 40503u;
+    return (0 == valueSet) ? hash % 100003u : ((0 == internalCounterIndex % 2) ? 0 : hash % 1000u);
+}
+
+/// Evaluates every counter of a derived counter set with its original and its specialized equation,
+/// and verifies that the results match and that the specialized equations need fewer nodes
+/// \param derivedCounters the derived counters to verify
+/// \param hwInfo the hardware info whose device constants are folded
+static void VerifySpecializedEquations(const GPA_DerivedCounters& derivedCounters, const GPA_HWInfo& hwInfo)
+{
+    GPA_DerivedCounterEvaluator originalEvaluator;
+    GPA_DerivedCounterEvaluator specializedEvaluator;
+    std::vector<GPA_Data_Type>  dataTypes;
+
+    for (gpa_uint32 counterIndex = 0; counterIndex < derivedCounters.GetNumCounters(); ++counterIndex)
+    {
+        const GPA_DerivedCounter* pCounter = derivedCounters.GetCounter(counterIndex);
+        std::string               specializedExpression;
+        gpa_uint32                outputIndex = 0;
+
+        ASSERT_TRUE(GPA_SpecializedCounterEquations::SpecializeEquation(pCounter->m_pComputeExpression, pCounter->m_dataType, &hwInfo, specializedExpression))
+            << pCounter->m_pName;
+
+        ASSERT_EQ(GPA_STATUS_OK,
+                  originalEvaluator.AddCounter(pCounter->m_pComputeExpression, pCounter->m_internalCountersRequired, pCounter->m_dataType, &hwInfo, outputIndex))
+            << pCounter->m_pName;
+        ASSERT_EQ(GPA_STATUS_OK,
+                  specializedEvaluator.AddCounter(specializedExpression.c_str(), pCounter->m_internalCountersRequired, pCounter->m_dataType, &hwInfo, outputIndex))
+            << pCounter->m_pName << ": " << specializedExpression;
+
+        dataTypes.push_back(pCounter->m_dataType);
+    }
+
+    EXPECT_LT(specializedEvaluator.GetNumNodes(), originalEvaluator.GetNumNodes());
+
+    for (gpa_uint32 valueSet = 0; valueSet < 2; ++valueSet)
+    {
+        std::vector<gpa_uint64> originalInputs;
+        std::vector<gpa_uint64> specializedInputs;
+        std::vector<gpa_uint64> nodeValues;
+        std::vector<gpa_uint64> originalOutputs(originalEvaluator.GetNumOutputs());
+        std::vector<gpa_uint64> specializedOutputs(specializedEvaluator.GetNumOutputs());
+
+        // a folded conditional may no longer reference some internal counters, so the inputs of the graphs can differ
+        for (auto inputIter = originalEvaluator.GetInputs().cbegin(); inputIter != originalEvaluator.GetInputs().cend(); ++inputIter)
+        {
+            originalInputs.push_back(GetInternalCounterValue(valueSet, *inputIter));
+        }
+
+        for (auto inputIter = specializedEvaluator.GetInputs().cbegin(); inputIter != specializedEvaluator.GetInputs().cend(); ++inputIter)
+        {
+            specializedInputs.push_back(GetInternalCounterValue(valueSet, *inputIter));
+        }
+
+        originalEvaluator.Evaluate(originalInputs.data(), nodeValues, originalOutputs.data());
+        specializedEvaluator.Evaluate(specializedInputs.data(), nodeValues, specializedOutputs.data());
+
+        for (size_t outputIndex = 0; outputIndex < dataTypes.size(); ++outputIndex)
+        {
+            const char* pName = derivedCounters.GetCounter(static_cast<gpa_uint32>(outputIndex))->m_pName;
+
+            if (GPA_DATA_TYPE_FLOAT64 == dataTypes[outputIndex])
+            {
+                // the constants of the floating point equations are reassociated, which only changes the rounding of the results
+                gpa_float64 expected = 0;
+                gpa_float64 actual   = 0;
+                memcpy(&expected, &originalOutputs[outputIndex], sizeof(expected));
+                memcpy(&actual, &specializedOutputs[outputIndex], sizeof(actual));
+                EXPECT_NEAR(expected, actual, 1e-12 * std::fabs(expected)) << pName << " with value set " << valueSet;
+            }
+            else
+            {
+                EXPECT_EQ(originalOutputs[outputIndex], specializedOutputs[outputIndex]) << pName << " with value set " << valueSet;
+            }
+        }
+    }
+}
+
+TEST(GPUPerfAPISpecializedCounterEquationsTests, MatchOriginalEquationsForGLCounters)
+{
+    GPA_HWInfo hwInfo;
+    InitHwInfo(hwInfo);
+
+    GPA_DerivedCounters gfx8Counters;
+    AutoDefinePublicDerivedCountersGLGfx8(gfx8Counters);
+    VerifySpecializedEquations(gfx8Counters, hwInfo);
+
+    GPA_DerivedCounters gfx9Counters;
+    AutoDefinePublicDerivedCountersGLGfx9(gfx9Counters);
+    VerifySpecializedEquations(gfx9Counters, hwInfo);
+
+    GPA_DerivedCounters gfx10Counters;
+    AutoDefinePublicDerivedCountersGLGfx10(gfx10Counters);
+    VerifySpecializedEquations(gfx10Counters, hwInfo);
+}
+#endif
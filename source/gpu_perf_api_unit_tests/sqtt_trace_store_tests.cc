@@ -0,0 +1,188 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Unit tests for the SQTT data spilled to a chunked trace file
+//==============================================================================
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "gpa_sqtt_trace_store.h"
+#include "utility.h"
+
+static const gpa_uint32 s_numStreams = 3;           ///< number of trace streams, as if the GPU had three shader engines
+static const gpa_uint32 s_chunkSize  = 4096;        ///< size of the chunks, small so that the traces span many chunks
+static const size_t     s_streamSize = 300 * 1000;  ///< number of bytes of trace data in each stream
+
+/// Synthetic trace data byte
+/// \param[in] streamId the id of the trace stream
+/// \param[in] streamOffset the offset of the byte within the trace stream
+/// \return the byte
+static gpa_uint8 GetSyntheticByte(gpa_uint32 streamId, size_t streamOffset)
+{
+    return static_cast<gpa_uint8>(streamId * 31 + streamOffset * 7 + streamOffset / 251);
+}
+
+/// Checks that the chunks of a readable store hold the synthetic trace data of all the streams
+/// \param[in] store the store
+static void CheckSyntheticTrace(const GPASQTTTraceStore& store)
+{
+    ASSERT_TRUE(store.IsReadable());
+
+    std::vector<size_t> streamSizes(s_numStreams, 0);
+    GPA_SQTTChunkView   chunkView = {};
+
+    for (gpa_uint32 chunkIndex = 0; chunkIndex < store.GetChunkCount(); ++chunkIndex)
+    {
+        ASSERT_TRUE(store.GetChunk(chunkIndex, chunkView));
+        ASSERT_LT(chunkView.m_streamId, s_numStreams);
+
+        // the chunks of a stream are in order, and each one is aligned in the mapped file
+        EXPECT_EQ(streamSizes[chunkView.m_streamId], chunkView.m_streamOffset);
+        EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(chunkView.m_pData) % GPASQTTTraceStore::CHUNK_FILE_ALIGNMENT);
+        EXPECT_LE(chunkView.m_size, s_chunkSize);
+
+        const gpa_uint8* pData = static_cast<const gpa_uint8*>(chunkView.m_pData);
+
+        for (size_t byteIndex = 0; byteIndex < chunkView.m_size; ++byteIndex)
+        {
+            ASSERT_EQ(GetSyntheticByte(chunkView.m_streamId, chunkView.m_streamOffset + byteIndex), pData[byteIndex]);
+        }
+
+        streamSizes[chunkView.m_streamId] += static_cast<size_t>(chunkView.m_size);
+    }
+
+    EXPECT_FALSE(store.GetChunk(store.GetChunkCount(), chunkView));
+
+    for (gpa_uint32 streamId = 0; streamId < s_numStreams; ++streamId)
+    {
+        EXPECT_EQ(s_streamSize, streamSizes[streamId]);
+    }
+}
+
+/// Adds the synthetic trace data of all the streams to a store, in pieces of varying sizes interleaved between the streams
+/// \param[in,out] store the store
+/// \param[out] maxMemoryUsage the largest memory usage of the store while the data was added
+static void AddSyntheticTrace(GPASQTTTraceStore& store, size_t& maxMemoryUsage)
+{
+    std::vector<gpa_uint8> piece;
+    std::vector<size_t>    streamSizes(s_numStreams, 0);
+    size_t                 pieceIndex = 0;
+
+    maxMemoryUsage = 0;
+
+    for (bool isAdding = true; isAdding; ++pieceIndex)
+    {
+        isAdding = false;
+
+        for (gpa_uint32 streamId = 0; streamId < s_numStreams; ++streamId)
+        {
+            size_t pieceSize = std::min(s_streamSize - streamSizes[streamId], 1 + (pieceIndex * 977 + streamId * 3001) % 10000);
+
+            piece.resize(pieceSize);
+
+            for (size_t byteIndex = 0; byteIndex < pieceSize; ++byteIndex)
+            {
+                piece[byteIndex] = GetSyntheticByte(streamId, streamSizes[streamId] + byteIndex);
+            }
+
+            if (0 < pieceSize)
+            {
+                ASSERT_TRUE(store.AddTraceData(streamId, piece.data(), pieceSize));
+                streamSizes[streamId] += pieceSize;
+                isAdding = true;
+            }
+
+            maxMemoryUsage = std::max(maxMemoryUsage, store.GetMemoryUsage());
+        }
+    }
+}
+
+TEST(GPUPerfAPISQTTTraceStoreTests, SpillsWithBoundedMemory)
+{
+    std::string traceFilePath;
+    ASSERT_TRUE(GPAUtil::CreateTempFile("GPA-SQTT-Test-", ".gpasqtt", traceFilePath));
+
+    {
+        // the pool only holds two chunks for three streams, so the producer regularly waits for the spill thread
+        GPASQTTTraceStore store;
+        ASSERT_TRUE(store.Initialize(traceFilePath, 2 * s_chunkSize, s_chunkSize));
+        EXPECT_FALSE(store.IsReadable());
+
+        size_t maxMemoryUsage = 0;
+        AddSyntheticTrace(store, maxMemoryUsage);
+
+        // the pool never grows beyond the memory limit, although the traces are much larger; only the index grows, by a few bytes per chunk
+        EXPECT_LT(maxMemoryUsage, 3 * s_chunkSize + (s_numStreams * s_streamSize / s_chunkSize + s_numStreams) * 64);
+
+        ASSERT_TRUE(store.Finish());
+        EXPECT_FALSE(store.Finish());
+        EXPECT_FALSE(store.AddTraceData(0, &traceFilePath, 1));
+        EXPECT_LT(store.GetMemoryUsage(), s_chunkSize);
+        CheckSyntheticTrace(store);
+
+        // the trace file can also be mapped by another store, which does not delete it
+        {
+            GPASQTTTraceStore reader;
+            ASSERT_TRUE(reader.Open(traceFilePath));
+            CheckSyntheticTrace(reader);
+        }
+
+        CheckSyntheticTrace(store);
+    }
+
+    // the trace file was deleted with the store which wrote it
+    std::ifstream traceFile(traceFilePath.c_str());
+    EXPECT_FALSE(traceFile.is_open());
+}
+
+TEST(GPUPerfAPISQTTTraceStoreTests, RestartedCaptureReplacesTraceFile)
+{
+    std::string firstTraceFilePath;
+    std::string secondTraceFilePath;
+    ASSERT_TRUE(GPAUtil::CreateTempFile("GPA-SQTT-Test-", ".gpasqtt", firstTraceFilePath));
+    ASSERT_TRUE(GPAUtil::CreateTempFile("GPA-SQTT-Test-", ".gpasqtt", secondTraceFilePath));
+    EXPECT_NE(firstTraceFilePath, secondTraceFilePath);
+
+    GPASQTTTraceStore store;
+    gpa_uint8         data[] = {1, 2, 3};
+
+    // a capture which is not finished is discarded
+    ASSERT_TRUE(store.Initialize(firstTraceFilePath, 0, s_chunkSize));
+    ASSERT_TRUE(store.AddTraceData(1, data, sizeof(data)));
+    ASSERT_TRUE(store.Initialize(secondTraceFilePath, 0, s_chunkSize));
+
+    std::ifstream firstTraceFile(firstTraceFilePath.c_str());
+    EXPECT_FALSE(firstTraceFile.is_open());
+
+    // an empty capture is readable and has no chunks
+    ASSERT_TRUE(store.Finish());
+    EXPECT_TRUE(store.IsReadable());
+    EXPECT_EQ(0u, store.GetChunkCount());
+}
+
+TEST(GPUPerfAPISQTTTraceStoreTests, InvalidTraceFileIsRejected)
+{
+    std::string traceFilePath;
+    ASSERT_TRUE(GPAUtil::CreateTempFile("GPA-SQTT-Test-", ".gpasqtt", traceFilePath));
+
+    GPASQTTTraceStore store;
+    EXPECT_FALSE(store.Open(traceFilePath));
+
+    {
+        std::ofstream traceFile(traceFilePath.c_str(), std::ios_base::out | std::ios_base::binary);
+        std::vector<char> garbage(3 * GPASQTTTraceStore::CHUNK_FILE_ALIGNMENT, 'x');
+        traceFile.write(garbage.data(), garbage.size());
+    }
+
+    EXPECT_FALSE(store.Open(traceFilePath));
+    EXPECT_FALSE(store.IsReadable());
+    EXPECT_EQ(0u, store.GetChunkCount());
+
+    std::remove(traceFilePath.c_str());
+}
@@ -0,0 +1,191 @@
+//==============================================================================
+// Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Unit tests for the streaming counter records, fed by a synthetic producer
+//==============================================================================
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "gpa_streaming_counter_stream.h"
+
+static const gpa_uint32 s_numValues     = 3;     ///< number of counter values in each record of the synthetic producer
+static const gpa_uint64 s_spmInterval   = 4096;  ///< timestamp interval between two records of the synthetic producer
+static const gpa_uint64 s_bucketRecords = 16;    ///< number of records in each full bucket
+
+/// Synthetic counter value of a record
+/// \param[in] recordIndex the index of the record
+/// \param[in] valueIndex the index of the value within the record
+/// \return the value
+static gpa_uint64 GetSyntheticValue(gpa_uint64 recordIndex, gpa_uint32 valueIndex)
+{
+    return (recordIndex % 7) * (valueIndex + 1) + valueIndex;
+}
+
+/// Adds the records of the synthetic producer to the stream, waiting for the consumer whenever the stream is full
+/// \param[in] numRecords the number of records to add
+/// \param[in,out] pStream the stream
+static void ProduceRecords(gpa_uint64 numRecords, GPAStreamingCounterStream* pStream)
+{
+    gpa_uint64 values[s_numValues];
+
+    for (gpa_uint64 recordIndex = 0; recordIndex < numRecords; ++recordIndex)
+    {
+        for (gpa_uint32 valueIndex = 0; valueIndex < s_numValues; ++valueIndex)
+        {
+            values[valueIndex] = GetSyntheticValue(recordIndex, valueIndex);
+        }
+
+        while (!pStream->TryAddRecord(recordIndex * s_spmInterval, values))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    pStream->Finish();
+}
+
+TEST(GPUPerfAPIStreamingCounterTests, ConcurrentCircularBuffer)
+{
+    ConcurrentCircularBuffer<gpa_uint64> buffer;
+    EXPECT_EQ(nullptr, buffer.lockNext());
+    EXPECT_FALSE(buffer.setSize(0, 2));
+    ASSERT_TRUE(buffer.setSize(3, 2));
+
+    // the size is rounded up to a power of two
+    EXPECT_EQ(4u, buffer.getSize());
+    EXPECT_EQ(nullptr, buffer.getHead());
+
+    for (gpa_uint64 recordIndex = 0; recordIndex < 4; ++recordIndex)
+    {
+        gpa_uint64* pRecord = buffer.lockNext();
+        ASSERT_NE(nullptr, pRecord);
+        pRecord[0] = recordIndex;
+        pRecord[1] = recordIndex * 10;
+        buffer.addLockedItem();
+    }
+
+    // a full buffer does not overwrite its oldest record
+    EXPECT_EQ(4u, buffer.getCount());
+    EXPECT_EQ(nullptr, buffer.lockNext());
+
+    for (gpa_uint64 recordIndex = 0; recordIndex < 4; ++recordIndex)
+    {
+        const gpa_uint64* pRecord = buffer.getHead();
+        ASSERT_NE(nullptr, pRecord);
+        EXPECT_EQ(recordIndex, pRecord[0]);
+        EXPECT_EQ(recordIndex * 10, pRecord[1]);
+        buffer.erase();
+    }
+
+    EXPECT_EQ(nullptr, buffer.getHead());
+    EXPECT_EQ(0u, buffer.getCount());
+}
+
+TEST(GPUPerfAPIStreamingCounterTests, ConcurrentProducerAndConsumer)
+{
+    static const gpa_uint64 s_numRecords = 200000 + 5;  // the last bucket is not full
+
+    // a small buffer, so the producer has to wait for the consumer many times
+    GPAStreamingCounterStream stream;
+    ASSERT_TRUE(stream.Initialize(s_numValues, 0));
+    EXPECT_EQ(s_numValues, stream.GetNumValues());
+
+    std::thread producer(ProduceRecords, s_numRecords, &stream);
+
+    GPA_StreamingCounterBucket bucket = {};
+    gpa_uint64                 valueSums[s_numValues];
+    gpa_uint64                 numRecordsRead = 0;
+    gpa_uint64                 numBuckets     = 0;
+
+    while (!stream.IsDrained())
+    {
+        if (!stream.ReadBucket(s_bucketRecords * s_spmInterval, bucket, valueSums))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // each bucket holds consecutive records, whose values are the synthetic values of these records
+        EXPECT_EQ(numBuckets * s_bucketRecords * s_spmInterval, bucket.m_startTimestamp);
+        EXPECT_EQ(bucket.m_startTimestamp + s_bucketRecords * s_spmInterval, bucket.m_endTimestamp);
+        EXPECT_EQ(std::min(s_bucketRecords, s_numRecords - numRecordsRead), bucket.m_numRecords);
+        EXPECT_EQ(0u, bucket.m_numDroppedRecords);
+
+        for (gpa_uint32 valueIndex = 0; valueIndex < s_numValues; ++valueIndex)
+        {
+            gpa_uint64 expectedSum = 0;
+
+            for (gpa_uint64 recordIndex = numRecordsRead; recordIndex < numRecordsRead + bucket.m_numRecords; ++recordIndex)
+            {
+                expectedSum += GetSyntheticValue(recordIndex, valueIndex);
+            }
+
+            EXPECT_EQ(expectedSum, valueSums[valueIndex]);
+        }
+
+        numRecordsRead += bucket.m_numRecords;
+        ++numBuckets;
+    }
+
+    producer.join();
+
+    EXPECT_EQ(s_numRecords, numRecordsRead);
+    EXPECT_EQ((s_numRecords + s_bucketRecords - 1) / s_bucketRecords, numBuckets);
+    EXPECT_FALSE(stream.ReadBucket(s_bucketRecords * s_spmInterval, bucket, valueSums));
+}
+
+TEST(GPUPerfAPIStreamingCounterTests, DroppedRecordsAreReported)
+{
+    GPAStreamingCounterStream stream;
+    ASSERT_TRUE(stream.Initialize(s_numValues, 0));
+
+    // the producer does not wait for the consumer, so the records added while the buffer is full are dropped
+    gpa_uint64 values[s_numValues] = {1, 2, 3};
+    gpa_uint64 numAdded            = 0;
+    gpa_uint64 numRecords          = GPAStreamingCounterStream::MIN_BUFFERED_RECORDS * 3;
+
+    for (gpa_uint64 recordIndex = 0; recordIndex < numRecords; ++recordIndex)
+    {
+        if (stream.AddRecord(recordIndex * s_spmInterval, values))
+        {
+            ++numAdded;
+        }
+    }
+
+    EXPECT_EQ(GPAStreamingCounterStream::MIN_BUFFERED_RECORDS, numAdded);
+
+    // the last bucket is not complete until the producer has finished
+    GPA_StreamingCounterBucket bucket = {};
+    gpa_uint64                 valueSums[s_numValues];
+    gpa_uint64                 numRecordsRead    = 0;
+    gpa_uint64                 numDroppedRecords = 0;
+
+    while (stream.ReadBucket(s_bucketRecords * s_spmInterval, bucket, valueSums))
+    {
+        EXPECT_EQ(bucket.m_numRecords * 3, valueSums[2]);
+        numRecordsRead += bucket.m_numRecords;
+        numDroppedRecords += bucket.m_numDroppedRecords;
+    }
+
+    EXPECT_EQ(numAdded - s_bucketRecords, numRecordsRead);
+    EXPECT_FALSE(stream.IsDrained());
+
+    stream.Finish();
+    ASSERT_TRUE(stream.ReadBucket(s_bucketRecords * s_spmInterval, bucket, valueSums));
+    numRecordsRead += bucket.m_numRecords;
+    numDroppedRecords += bucket.m_numDroppedRecords;
+
+    EXPECT_TRUE(stream.IsDrained());
+    EXPECT_EQ(numAdded, numRecordsRead);
+    EXPECT_EQ(numRecords - numAdded, numDroppedRecords);
+
+    // a new capture starts without any records
+    ASSERT_TRUE(stream.Initialize(s_numValues, 0));
+    EXPECT_FALSE(stream.IsDrained());
+    EXPECT_FALSE(stream.ReadBucket(s_bucketRecords * s_spmInterval, bucket, valueSums));
+}
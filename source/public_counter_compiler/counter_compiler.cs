@@ -15,6 +15,7 @@ namespace PublicCounterCompiler
     using System;
     using System.Collections.Generic;
     using System.IO;
+    using System.Text;
     using System.Windows.Forms;
     using System.Diagnostics;
     using GPATools;
@@ -79,6 +80,11 @@ namespace PublicCounterCompiler
         /// </summary>
         public bool isInternal = false;
 
+        /// <summary>
+        /// Flag indicating a native C++ function is generated for the equation of each derived counter, in addition to the equation string
+        /// </summary>
+        public bool emitNativeCounterFunctions = true;
+
         /// <summary>
         /// A map of Counter Group to a map of counter name to documentation info for Graphics Counters
         /// </summary>
@@ -314,6 +320,41 @@ namespace PublicCounterCompiler
                 }
             }
 
+            includeFile.WriteLine("    }");
+            includeFile.WriteLine();
+
+            includeFile.WriteLine("    /// Gets the native functions of the ASIC specific derived counters if available.");
+            includeFile.WriteLine("    /// \\param desired_generation Hardware generation currently in use.");
+            includeFile.WriteLine("    /// \\param asic_type The ASIC type that is currently in use.");
+            includeFile.WriteLine("    /// \\param functions Returned native functions, if available.");
+            includeFile.WriteLine("    /// \\return True if the ASIC matched one available, and functions was set.");
+            includeFile.WriteLine("    inline bool Get{0}AsicSpecificCounterFunctions(GDT_HW_GENERATION desired_generation, GDT_HW_ASIC_TYPE asic_type, GPA_DerivedCounterFunctionTable& functions)", derivedCounterFileInput.compiler_type_str);
+            includeFile.WriteLine("    {");
+
+            if (asicSpecificFiles.Count == 0)
+            {
+                includeFile.WriteLine("        UNREFERENCED_PARAMETER(desired_generation);");
+                includeFile.WriteLine("        UNREFERENCED_PARAMETER(asic_type);");
+                includeFile.WriteLine("        UNREFERENCED_PARAMETER(functions);");
+            }
+            else
+            {
+                foreach (string asic in asicSpecificFiles)
+                {
+                    includeFile.WriteLine("        if ({0}{1}::Get{2}AsicSpecificCounterFunctions(desired_generation, asic_type, functions))", section.ToLower(), asic.ToLower(), derivedCounterFileInput.compiler_type_str);
+                    includeFile.WriteLine("        {");
+                    includeFile.WriteLine("            return true;");
+                    includeFile.WriteLine("        }");
+                    includeFile.WriteLine();
+                }
+            }
+
+            if (asicSpecificFiles.Count == 0)
+            {
+                includeFile.WriteLine();
+            }
+
+            includeFile.WriteLine("        return false;");
             includeFile.WriteLine("    }");
 
             includeFile.WriteLine();
@@ -1932,6 +1973,10 @@ namespace PublicCounterCompiler
                 hsw.WriteLine("/// Defines the {0} derived counters for {1} {2}", derivedCounterFileInput.compiler_type_str, api.ToUpper(), asic_prefix_str.ToUpper());
                 hsw.WriteLine("/// \\param c derived counters instance");
                 hsw.WriteLine("void AutoDefine{0}DerivedCounters{1}(GPA_DerivedCounters& c);", derivedCounterFileInput.compiler_type_str, activeSectionLabel);
+                hsw.WriteLine();
+                hsw.WriteLine("/// Gets the native functions of the {0} derived counters for {1} {2}", derivedCounterFileInput.compiler_type_str, api.ToUpper(), generation.ToUpper());
+                hsw.WriteLine("/// \\return the native functions, in the order the counters are defined");
+                hsw.WriteLine("GPA_DerivedCounterFunctionTable Get{0}DerivedCounterFunctions{1}();", derivedCounterFileInput.compiler_type_str, activeSectionLabel);
             }
             else
             {
@@ -1944,6 +1989,13 @@ namespace PublicCounterCompiler
                 hsw.WriteLine("    /// \\return True if the ASIC matched one available, and derivedCounters was updated.");
                 hsw.WriteLine("    extern bool Update{0}AsicSpecificCounters(GDT_HW_GENERATION desired_generation, GDT_HW_ASIC_TYPE asic_type, GPA_DerivedCounters& c);", derivedCounterFileInput.compiler_type_str);
                 hsw.WriteLine();
+                hsw.WriteLine("    /// Gets the native functions of the ASIC specific {0} derived counters if available.", derivedCounterFileInput.compiler_type_str);
+                hsw.WriteLine("    /// \\param desired_generation Hardware generation currently in use.");
+                hsw.WriteLine("    /// \\param asic_type The ASIC type that is currently in use.");
+                hsw.WriteLine("    /// \\param functions Returned native functions, in the order the counters are updated.");
+                hsw.WriteLine("    /// \\return True if the ASIC matched one available, and functions was set.");
+                hsw.WriteLine("    extern bool Get{0}AsicSpecificCounterFunctions(GDT_HW_GENERATION desired_generation, GDT_HW_ASIC_TYPE asic_type, GPA_DerivedCounterFunctionTable& functions);", derivedCounterFileInput.compiler_type_str);
+                hsw.WriteLine();
                 hsw.WriteLine("}  // namespace " + activeSectionLabel.ToLower() + asic.ToLower());
             }
 
@@ -1989,14 +2041,23 @@ namespace PublicCounterCompiler
             }
 
             csw.WriteLine("#include \"{0}\"", Gpa.GPACounterHeaderFileStr);
+
+            if (emitNativeCounterFunctions)
+            {
+                csw.WriteLine("#include \"gpa_common_defs.h\"");
+            }
+
             csw.WriteLine("#include \"{0}counter_definitions_{1}_{2}{3}.h\"", rootFilename.ToLower(), api.ToLower(), generation.ToLower(), asic_prefix_str.ToLower());
             csw.WriteLine();
             csw.WriteLine(
                 "// *** Note, this is an auto-generated file. Do not edit. Execute {0}CounterCompiler to rebuild.", derivedCounterFileInput.compiler_type_str);
             csw.WriteLine();
 
+            Dictionary<string, string> counterFunctionNames = GenerateCounterFunctions(ref internalCounterList, ref counterDefList, asicSpecific, infoHandler);
+
             if (!asicSpecific)
             {
+                WriteCounterFunctions(csw);
                 csw.WriteLine("void AutoDefine{0}DerivedCounters{1}{2}(GPA_DerivedCounters& c)", derivedCounterFileInput.compiler_type_str, activeSectionLabel, asic);
                 csw.WriteLine("{");
             }
@@ -2006,6 +2067,7 @@ namespace PublicCounterCompiler
                 csw.WriteLine();
                 csw.WriteLine("namespace {0}{1}", activeSectionLabel.ToLower(), asic.ToLower());
                 csw.WriteLine("{");
+                WriteCounterFunctions(csw);
                 csw.WriteLine("bool Update{0}AsicSpecificCounters(GDT_HW_GENERATION desired_generation, GDT_HW_ASIC_TYPE asic_type, GPA_DerivedCounters& c)", derivedCounterFileInput.compiler_type_str);
                 csw.WriteLine("{");
                 csw.WriteLine("    UNREFERENCED_PARAMETER(desired_generation);");
@@ -2038,6 +2100,8 @@ namespace PublicCounterCompiler
                 }
             }
 
+            List<string> counterFunctionEntries = new List<string>();
+
             foreach (DerivedCounterDef c in counterDefList)
             {
                 if (asicSpecific && !DerivedCounterReferencesAsicRegisters(ref internalCounterList, c))
@@ -2059,17 +2123,26 @@ namespace PublicCounterCompiler
 
                 csw.WriteLine();
 
+                string counterFunction;
+                string counterFunctionArg = string.Empty;
+
+                if (counterFunctionNames.TryGetValue(c.Name, out counterFunction))
+                {
+                    counterFunctionArg = ", " + counterFunction;
+                    counterFunctionEntries.Add(string.Format("    {{\"{0}\", \"{1}\", {2}}},", c.Name, c.Comp, counterFunction));
+                }
+
                 if (!asicSpecific)
                 {
                     csw.WriteLine(
-                    "        c.DefineDerivedCounter(\"{0}\", \"{1}\", \"{2}\", {3}, {4}, internalCounters, \"{5}\", \"{6}\");",
-                    c.Name, c.Group, c.Desc, c.Type, c.Usage, c.Comp, c.GuidHash.ToString("D"));
+                    "        c.DefineDerivedCounter(\"{0}\", \"{1}\", \"{2}\", {3}, {4}, internalCounters, \"{5}\", \"{6}\"{7});",
+                    c.Name, c.Group, c.Desc, c.Type, c.Usage, c.Comp, c.GuidHash.ToString("D"), counterFunctionArg);
                 }
                 else
                 {
                     csw.WriteLine(
-                    "        c.UpdateAsicSpecificDerivedCounter(\"{0}\", internalCounters, \"{1}\");",
-                    c.Name, c.Comp);
+                    "        c.UpdateAsicSpecificDerivedCounter(\"{0}\", internalCounters, \"{1}\"{2});",
+                    c.Name, c.Comp, counterFunctionArg);
                 }
 
                 csw.WriteLine("    }");
@@ -2079,9 +2152,30 @@ namespace PublicCounterCompiler
             {
                 csw.WriteLine("}");
                 csw.WriteLine();
+                WriteCounterFunctionTable(csw, counterFunctionEntries, "defined");
+                csw.WriteLine("GPA_DerivedCounterFunctionTable Get{0}DerivedCounterFunctions{1}{2}()", derivedCounterFileInput.compiler_type_str, activeSectionLabel, asic);
+                csw.WriteLine("{");
+                WriteCounterFunctionTableAssignment(csw, counterFunctionEntries, "    GPA_DerivedCounterFunctionTable functions;");
+                csw.WriteLine("    return functions;");
+                csw.WriteLine("}");
+                csw.WriteLine();
             }
             else
             {
+                csw.WriteLine("    return true;");
+                csw.WriteLine("}");
+                csw.WriteLine();
+                WriteCounterFunctionTable(csw, counterFunctionEntries, "updated");
+                csw.WriteLine("bool Get{0}AsicSpecificCounterFunctions(GDT_HW_GENERATION desired_generation, GDT_HW_ASIC_TYPE asic_type, GPA_DerivedCounterFunctionTable& functions)", derivedCounterFileInput.compiler_type_str);
+                csw.WriteLine("{");
+                csw.WriteLine("    UNREFERENCED_PARAMETER(desired_generation);");
+                csw.WriteLine();
+                csw.WriteLine("    if (!counter{0}{1}::MatchAsic(asic_type))", generation.ToLower(), asic.ToLower());
+                csw.WriteLine("    {");
+                csw.WriteLine("        return false;");
+                csw.WriteLine("    }");
+                csw.WriteLine();
+                WriteCounterFunctionTableAssignment(csw, counterFunctionEntries, null);
                 csw.WriteLine("    return true;");
                 csw.WriteLine("}");
                 csw.WriteLine();
@@ -2103,6 +2197,135 @@ namespace PublicCounterCompiler
             return true;
         }
 
+        /// <summary>
+        /// Native C++ functions of the derived counters of the file being generated, in the order of the counters
+        /// </summary>
+        private List<string> counterFunctionLines = new List<string>();
+
+        /// <summary>
+        /// Generates the native C++ functions computing the derived counters of a public counter definition file.
+        /// </summary>
+        /// <param name="internalCounterList">List of internal counters.</param>
+        /// <param name="counterDefList">List of public counter definitions.</param>
+        /// <param name="asicSpecific">Flag indicating the file only holds the counters referencing ASIC specific registers.</param>
+        /// <param name="infoHandler">Handler of the counters which are computed by interpreting their equation.</param>
+        /// <returns>The names of the generated functions, by counter name.</returns>
+        private Dictionary<string, string> GenerateCounterFunctions(
+            ref List<InternalCounterDef> internalCounterList,
+            ref List<DerivedCounterDef> counterDefList,
+            bool asicSpecific,
+            Func<string, bool> infoHandler)
+        {
+            Dictionary<string, string> counterFunctionNames = new Dictionary<string, string>();
+            HashSet<string> usedFunctionNames = new HashSet<string>();
+
+            counterFunctionLines.Clear();
+
+            if (!emitNativeCounterFunctions)
+            {
+                return counterFunctionNames;
+            }
+
+            foreach (DerivedCounterDef c in counterDefList)
+            {
+                if (asicSpecific && !DerivedCounterReferencesAsicRegisters(ref internalCounterList, c))
+                {
+                    continue;
+                }
+
+                StringBuilder functionName = new StringBuilder("Compute");
+
+                foreach (char nameChar in c.Name)
+                {
+                    functionName.Append(char.IsLetterOrDigit(nameChar) ? nameChar : '_');
+                }
+
+                while (!usedFunctionNames.Add(functionName.ToString()))
+                {
+                    functionName.Append('_');
+                }
+
+                List<string> lines;
+                string error;
+
+                if (!DerivedCounterFunctionGenerator.GenerateFunction(functionName.ToString(), c, string.Empty, out lines, out error))
+                {
+                    // the interpreter still computes the counter from its equation
+                    infoHandler(string.Format("No native function generated for {0}: {1}", c.Name, error));
+                    continue;
+                }
+
+                counterFunctionNames[c.Name] = functionName.ToString();
+                counterFunctionLines.AddRange(lines);
+                counterFunctionLines.Add(string.Empty);
+            }
+
+            return counterFunctionNames;
+        }
+
+        /// <summary>
+        /// Writes the native C++ functions generated by GenerateCounterFunctions.
+        /// </summary>
+        /// <param name="csw">The writer of the cpp file.</param>
+        private void WriteCounterFunctions(StreamWriter csw)
+        {
+            foreach (string line in counterFunctionLines)
+            {
+                csw.WriteLine(line);
+            }
+        }
+
+        /// <summary>
+        /// Writes the table of the native functions of the derived counters of the file being generated.
+        /// No table is written when no function was generated, as C++ does not allow empty arrays.
+        /// </summary>
+        /// <param name="csw">The writer of the cpp file.</param>
+        /// <param name="counterFunctionEntries">The initializers of the entries of the table, in the order of the counters.</param>
+        /// <param name="counterOrder">How the counters are ordered in the file, for the comment of the table.</param>
+        private void WriteCounterFunctionTable(StreamWriter csw, List<string> counterFunctionEntries, string counterOrder)
+        {
+            if (0 == counterFunctionEntries.Count)
+            {
+                return;
+            }
+
+            csw.WriteLine("/// Native functions of the {0} derived counters, in the order the counters are {1}", derivedCounterFileInput.compiler_type_str, counterOrder);
+            csw.WriteLine("static const GPA_DerivedCounterFunctionEntry counterFunctions[] = {");
+
+            foreach (string entry in counterFunctionEntries)
+            {
+                csw.WriteLine(entry);
+            }
+
+            csw.WriteLine("};");
+            csw.WriteLine();
+        }
+
+        /// <summary>
+        /// Writes the statements pointing a GPA_DerivedCounterFunctionTable named functions at the table written by WriteCounterFunctionTable.
+        /// </summary>
+        /// <param name="csw">The writer of the cpp file.</param>
+        /// <param name="counterFunctionEntries">The initializers of the entries of the table.</param>
+        /// <param name="declaration">The declaration of the functions variable, or null if it is a parameter.</param>
+        private void WriteCounterFunctionTableAssignment(StreamWriter csw, List<string> counterFunctionEntries, string declaration)
+        {
+            if (null != declaration)
+            {
+                csw.WriteLine(declaration);
+            }
+
+            if (0 == counterFunctionEntries.Count)
+            {
+                csw.WriteLine("    functions.m_pEntries   = nullptr;");
+                csw.WriteLine("    functions.m_numEntries = 0;");
+            }
+            else
+            {
+                csw.WriteLine("    functions.m_pEntries   = counterFunctions;");
+                csw.WriteLine("    functions.m_numEntries = sizeof(counterFunctions) / sizeof(counterFunctions[0]);");
+            }
+        }
+
         /// <summary>
         /// Generate the test output file
         /// </summary>
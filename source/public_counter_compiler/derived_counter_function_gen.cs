@@ -0,0 +1,644 @@
+// =====================================================================
+// <copyright file="DerivedCounterFunctionGen.cs" company="Advanced Micro Devices, Inc.">
+//    Copyright (c) 2020 Advanced Micro Devices, Inc. All rights reserved.
+// </copyright>
+// <author>
+//    AMD Developer Tools Team
+// </author>
+// <summary>
+//      Translates the RPN equation of a derived counter into a native C++ function.
+// </summary>
+// =====================================================================
+namespace PublicCounterCompiler
+{
+    using System;
+    using System.Collections.Generic;
+    using System.Globalization;
+
+    /// <summary>
+    /// Generates a C++ function computing a derived counter from its RPN equation, so that the C++ compiler can inline
+    /// and vectorize the arithmetic instead of interpreting the equation at runtime.
+    /// The generated code performs the same operations, on the same operands and in the same order, as the equation
+    /// interpreter (EvaluateExpression in gpa_derived_counter.cc), so both produce the same results.
+    /// </summary>
+    class DerivedCounterFunctionGenerator
+    {
+        /// <summary>
+        /// Device constants which can be referenced by an equation, and the GPA_HWInfo getter returning their value
+        /// </summary>
+        private static readonly Dictionary<string, string> hardwareConstantGetters = new Dictionary<string, string>(StringComparer.OrdinalIgnoreCase)
+        {
+            { "num_shader_engines", "GetNumberShaderEngines" },
+            { "num_shader_arrays", "GetNumberShaderArrays" },
+            { "num_simds", "GetNumberSIMDs" },
+            { "su_clocks_prim", "GetSUClocksPrim" },
+            { "num_prim_pipes", "GetNumberPrimPipes" },
+            { "num_cus", "GetNumberCUs" },
+        };
+
+        /// <summary>
+        /// Name of the equation token referencing the timestamp frequency
+        /// </summary>
+        private const string timestampFrequencyToken = "TS_FREQ";
+
+        /// <summary>
+        /// C++ type of the values of the equation
+        /// </summary>
+        private string valueType;
+
+        /// <summary>
+        /// C++ literal of the zero value of the equation
+        /// </summary>
+        private string zero;
+
+        /// <summary>
+        /// Statements of the body of the function, computing the values of the equation
+        /// </summary>
+        private List<string> statements = new List<string>();
+
+        /// <summary>
+        /// Operands of the equation, each of them a C++ identifier or literal
+        /// </summary>
+        private List<string> stack = new List<string>();
+
+        /// <summary>
+        /// Indices of the internal counter results read by the equation
+        /// </summary>
+        private SortedSet<int> resultIndices = new SortedSet<int>();
+
+        /// <summary>
+        /// Getters of the device constants read by the equation, by name of the local variable holding their value
+        /// </summary>
+        private SortedDictionary<string, string> hardwareConstants = new SortedDictionary<string, string>();
+
+        /// <summary>
+        /// Flag indicating the equation reads the timestamp frequency
+        /// </summary>
+        private bool usesTimestampFrequency = false;
+
+        /// <summary>
+        /// Number of values computed by the equation so far
+        /// </summary>
+        private int valueCount = 0;
+
+        /// <summary>
+        /// Initializes a new instance of the DerivedCounterFunctionGenerator class.
+        /// </summary>
+        /// <param name="dataType">The data type of the derived counter.</param>
+        private DerivedCounterFunctionGenerator(string dataType)
+        {
+            if (dataType == "GPA_DATA_TYPE_UINT64")
+            {
+                valueType = "gpa_uint64";
+                zero = "0u";
+            }
+            else
+            {
+                valueType = "gpa_float64";
+                zero = "0.0";
+            }
+        }
+
+        /// <summary>
+        /// Generates the C++ function computing a derived counter.
+        /// </summary>
+        /// <param name="functionName">The name of the generated function.</param>
+        /// <param name="counter">The derived counter.</param>
+        /// <param name="indent">The indentation of the generated function.</param>
+        /// <param name="lines">The lines of the generated function.</param>
+        /// <param name="error">The reason why the function could not be generated, if any.</param>
+        /// <returns>True if the function was generated; false if the counter must be computed by interpreting its equation.</returns>
+        public static bool GenerateFunction(string functionName, DerivedCounterDef counter, string indent, out List<string> lines, out string error)
+        {
+            lines = new List<string>();
+
+            if (counter.Type != "GPA_DATA_TYPE_FLOAT64" && counter.Type != "GPA_DATA_TYPE_UINT64")
+            {
+                error = "unsupported data type " + counter.Type;
+                return false;
+            }
+
+            DerivedCounterFunctionGenerator generator = new DerivedCounterFunctionGenerator(counter.Type);
+
+            if (!generator.Translate(counter.Comp, counter.GetCounters().Count, out error))
+            {
+                return false;
+            }
+
+            lines.Add(indent + "/// Computes the " + counter.Name + " counter: " + counter.Comp);
+            lines.Add(indent + "static void " + functionName + "(const vector<const gpa_uint64*>& results, void* pResult, const GPA_HWInfo* pHwInfo)");
+            lines.Add(indent + "{");
+
+            if (0 == generator.hardwareConstants.Count && !generator.usesTimestampFrequency)
+            {
+                lines.Add(indent + "    UNREFERENCED_PARAMETER(pHwInfo);");
+                lines.Add(string.Empty);
+            }
+
+            if (generator.usesTimestampFrequency)
+            {
+                lines.Add(indent + "    gpa_uint64 timestampFrequency = 1u;");
+                lines.Add(indent + "    GPA_ASSERT(pHwInfo->GetTimeStampFrequency(timestampFrequency));");
+                lines.Add(string.Empty);
+            }
+
+            foreach (KeyValuePair<string, string> hardwareConstant in generator.hardwareConstants)
+            {
+                lines.Add(string.Format("{0}    const {1} {2} = static_cast<{1}>(pHwInfo->{3}());", indent, generator.valueType, hardwareConstant.Key, hardwareConstant.Value));
+            }
+
+            foreach (int resultIndex in generator.resultIndices)
+            {
+                lines.Add(string.Format("{0}    const {1} r{2} = static_cast<{1}>(*results[{2}]);", indent, generator.valueType, resultIndex));
+            }
+
+            if (0 < generator.hardwareConstants.Count || 0 < generator.resultIndices.Count)
+            {
+                lines.Add(string.Empty);
+            }
+
+            foreach (string statement in generator.statements)
+            {
+                lines.Add(indent + "    " + statement);
+            }
+
+            if (0 < generator.statements.Count)
+            {
+                lines.Add(string.Empty);
+            }
+
+            lines.Add(string.Format("{0}    *static_cast<{1}*>(pResult) = {2};", indent, generator.valueType, generator.stack[0]));
+            lines.Add(indent + "}");
+
+            return true;
+        }
+
+        /// <summary>
+        /// Translates an equation into statements.
+        /// </summary>
+        /// <param name="equation">The RPN equation.</param>
+        /// <param name="numResults">The number of internal counter results available to the equation.</param>
+        /// <param name="error">The reason why the equation could not be translated, if any.</param>
+        /// <returns>True if the equation was translated.</returns>
+        private bool Translate(string equation, int numResults, out string error)
+        {
+            error = null;
+
+            if (string.IsNullOrEmpty(equation))
+            {
+                error = "empty equation";
+                return false;
+            }
+
+            foreach (string token in equation.Split(new char[] { ' ', ',' }, StringSplitOptions.RemoveEmptyEntries))
+            {
+                if (!TranslateToken(token, numResults, out error))
+                {
+                    error = string.Format("'{0}' at token '{1}'", error, token);
+                    return false;
+                }
+            }
+
+            if (1 != stack.Count)
+            {
+                error = "the equation leaves " + stack.Count + " values on the stack";
+                return false;
+            }
+
+            return true;
+        }
+
+        /// <summary>
+        /// Translates a token of an equation.
+        /// The operators are matched the same way as they are by the equation interpreter.
+        /// </summary>
+        /// <param name="token">The token.</param>
+        /// <param name="numResults">The number of internal counter results available to the equation.</param>
+        /// <param name="error">The reason why the token could not be translated, if any.</param>
+        /// <returns>True if the token was translated.</returns>
+        private bool TranslateToken(string token, int numResults, out string error)
+        {
+            error = null;
+
+            switch (token[0])
+            {
+                case '*':
+                    return Binary("{0} * {1}", out error);
+
+                case '/':
+                    return Binary("({1} != " + zero + ") ? ({0} / {1}) : " + zero, out error);
+
+                case '+':
+                    return Binary("{0} + {1}", out error);
+
+                case '-':
+                    return Binary("{0} - {1}", out error);
+
+                case '(':
+                    return Constant(token, out error);
+            }
+
+            string getter;
+
+            if (hardwareConstantGetters.TryGetValue(token, out getter))
+            {
+                string name = token.ToLowerInvariant();
+                hardwareConstants[name] = getter;
+                stack.Add(name);
+                return true;
+            }
+
+            if (string.Equals(token, timestampFrequencyToken, StringComparison.OrdinalIgnoreCase))
+            {
+                usesTimestampFrequency = true;
+                stack.Add("static_cast<" + valueType + ">(timestampFrequency)");
+                return true;
+            }
+
+            string op = token.ToLowerInvariant();
+
+            if (op == "max")
+            {
+                return Binary("({0} > {1}) ? {0} : {1}", out error);
+            }
+
+            if (op == "min")
+            {
+                return Binary("({0} < {1}) ? {0} : {1}", out error);
+            }
+
+            if (op == "ifnotzero")
+            {
+                return IfNotZero(out error);
+            }
+
+            if (op == "comparemax4")
+            {
+                return CompareMax4(out error);
+            }
+
+            int width;
+
+            if (TryParseOperator(op, "max", new int[] { 4, 10, 16, 24, 32, 44, 64, 80 }, out width))
+            {
+                return MaxN(width, out error);
+            }
+
+            if (TryParseOperator(op, "sum", new int[] { 2, 4, 8, 10, 11, 12, 16, 24, 32, 40, 44, 64, 80, 256, 320 }, out width))
+            {
+                return SumN(width, false, out error);
+            }
+
+            if (TryParseOperator(op, "avg", new int[] { 2, 4, 8, 16, 20 }, out width))
+            {
+                return SumN(width, true, out error);
+            }
+
+            if (TryParseOperator(op, "vecsum", new int[] { 2, 4, 8, 16, 64 }, out width))
+            {
+                return VectorN(width, "{0} + {1}", out error);
+            }
+
+            if (TryParseOperator(op, "vecsub", new int[] { 2, 16 }, out width))
+            {
+                return VectorN(width, "{0} - {1}", out error);
+            }
+
+            if (TryParseOperator(op, "vecdiv", new int[] { 2, 4, 8, 10, 16, 20, 32, 64, 80 }, out width))
+            {
+                return VectorN(width, "({1} != " + zero + ") ? ({0} / {1}) : " + zero, out error);
+            }
+
+            if (TryParseOperator(op, "scalarsub", new int[] { 10, 20, 40, 80 }, out width))
+            {
+                // a negative difference is clamped to zero, which can't happen with unsigned values
+                string format = valueType == "gpa_uint64" ? "{1} - {0}" : "({1} - {0} < " + zero + ") ? " + zero + " : ({1} - {0})";
+                return ScalarN(width, format, true, out error);
+            }
+
+            if (TryParseOperator(op, "scalardiv", new int[] { 2, 4, 8 }, out width))
+            {
+                return ScalarN(width, "({1} != " + zero + ") ? ({0} / {1}) : " + zero, true, out error);
+            }
+
+            if (TryParseOperator(op, "scalarmul", new int[] { 2, 4, 8, 16, 20, 32, 40, 64 }, out width))
+            {
+                return ScalarN(width, "{0} * {1}", false, out error);
+            }
+
+            // must be the index of an internal counter result
+            int resultIndex;
+
+            if (!int.TryParse(token, NumberStyles.None, CultureInfo.InvariantCulture, out resultIndex))
+            {
+                error = "unknown operator";
+                return false;
+            }
+
+            if (resultIndex >= numResults)
+            {
+                error = "internal counter index out of range";
+                return false;
+            }
+
+            resultIndices.Add(resultIndex);
+            stack.Add("r" + resultIndex);
+            return true;
+        }
+
+        /// <summary>
+        /// Parses an operator taking a number of operands, such as sum4.
+        /// </summary>
+        /// <param name="op">The lower case operator.</param>
+        /// <param name="prefix">The name of the operator.</param>
+        /// <param name="supportedWidths">The numbers of operands supported by the equation interpreter.</param>
+        /// <param name="width">The number of operands of the operator.</param>
+        /// <returns>True if the operator is the named operator with a supported number of operands.</returns>
+        private static bool TryParseOperator(string op, string prefix, int[] supportedWidths, out int width)
+        {
+            width = 0;
+
+            return op.StartsWith(prefix, StringComparison.Ordinal) &&
+                   int.TryParse(op.Substring(prefix.Length), NumberStyles.None, CultureInfo.InvariantCulture, out width) &&
+                   Array.IndexOf(supportedWidths, width) >= 0;
+        }
+
+        /// <summary>
+        /// Pops the top value of the stack.
+        /// </summary>
+        /// <returns>The popped value.</returns>
+        private string Pop()
+        {
+            string value = stack[stack.Count - 1];
+            stack.RemoveAt(stack.Count - 1);
+            return value;
+        }
+
+        /// <summary>
+        /// Pops a number of values, the top one first.
+        /// </summary>
+        /// <param name="count">The number of values to pop.</param>
+        /// <returns>The popped values, in the order they were popped.</returns>
+        private List<string> PopValues(int count)
+        {
+            List<string> values = new List<string>();
+
+            for (int i = 0; i < count; ++i)
+            {
+                values.Add(Pop());
+            }
+
+            return values;
+        }
+
+        /// <summary>
+        /// Checks that the stack holds enough values for an operator.
+        /// </summary>
+        /// <param name="count">The number of values needed by the operator.</param>
+        /// <param name="error">The error, if the stack does not hold enough values.</param>
+        /// <returns>True if the stack holds enough values.</returns>
+        private bool CheckStack(int count, out string error)
+        {
+            error = count > stack.Count ? "not enough values on the stack" : null;
+            return null == error;
+        }
+
+        /// <summary>
+        /// Adds a statement computing a new value and pushes the value.
+        /// </summary>
+        /// <param name="expression">The C++ expression of the value.</param>
+        private void PushValue(string expression)
+        {
+            string name = "v" + valueCount++;
+            statements.Add(string.Format("const {0} {1} = {2};", valueType, name, expression));
+            stack.Add(name);
+        }
+
+        /// <summary>
+        /// Translates a binary operator.
+        /// </summary>
+        /// <param name="format">Format of the expression of the result, {0} being the first operand and {1} the top of the stack.</param>
+        /// <param name="error">The error, if any.</param>
+        /// <returns>True if the operator was translated.</returns>
+        private bool Binary(string format, out string error)
+        {
+            if (!CheckStack(2, out error))
+            {
+                return false;
+            }
+
+            string p2 = Pop();
+            string p1 = Pop();
+            PushValue(string.Format(format, p1, p2));
+            return true;
+        }
+
+        /// <summary>
+        /// Translates a constant.
+        /// </summary>
+        /// <param name="token">The constant token, such as (100).</param>
+        /// <param name="error">The error, if any.</param>
+        /// <returns>True if the constant was translated.</returns>
+        private bool Constant(string token, out string error)
+        {
+            error = null;
+            string text = token.Trim('(', ')');
+
+            if (valueType == "gpa_uint64")
+            {
+                ulong constant;
+
+                if (!ulong.TryParse(text, NumberStyles.None, CultureInfo.InvariantCulture, out constant))
+                {
+                    error = "invalid integer constant";
+                    return false;
+                }
+
+                stack.Add(constant.ToString(CultureInfo.InvariantCulture) + "ull");
+                return true;
+            }
+
+            double value;
+
+            if (!double.TryParse(text, NumberStyles.Float, CultureInfo.InvariantCulture, out value) || double.IsNaN(value) || double.IsInfinity(value))
+            {
+                error = "invalid constant";
+                return false;
+            }
+
+            // the round-trip format is parsed back by the C++ compiler into the same double as %lf does at runtime
+            string literal = value.ToString("R", CultureInfo.InvariantCulture);
+
+            if (literal.IndexOfAny(new char[] { '.', 'E' }) < 0)
+            {
+                literal += ".0";
+            }
+
+            stack.Add(literal);
+            return true;
+        }
+
+        /// <summary>
+        /// Translates the ifnotzero operator: pops the condition, then the value if it is not zero, then the value if it is zero.
+        /// </summary>
+        /// <param name="error">The error, if any.</param>
+        /// <returns>True if the operator was translated.</returns>
+        private bool IfNotZero(out string error)
+        {
+            if (!CheckStack(3, out error))
+            {
+                return false;
+            }
+
+            string condition = Pop();
+            string resultTrue = Pop();
+            string resultFalse = Pop();
+            PushValue(string.Format("({0} != {1}) ? {2} : {3}", condition, zero, resultTrue, resultFalse));
+            return true;
+        }
+
+        /// <summary>
+        /// Translates the comparemax4 operator: pops 4 values, then 4 potential results, and computes the largest
+        /// potential result whose value is not zero, or zero if all values are zero.
+        /// </summary>
+        /// <param name="error">The error, if any.</param>
+        /// <returns>True if the operator was translated.</returns>
+        private bool CompareMax4(out string error)
+        {
+            if (!CheckStack(8, out error))
+            {
+                return false;
+            }
+
+            List<string> values = PopValues(4);
+            List<string> potentialResults = PopValues(4);
+
+            string name = "v" + valueCount++;
+            string found = name + "Found";
+
+            statements.Add(string.Format("{0} {1} = {2};", valueType, name, zero));
+            statements.Add(string.Format("bool {0} = false;", found));
+
+            // std::max_element keeps the first of the largest results
+            for (int i = 0; i < 4; ++i)
+            {
+                statements.Add(string.Format("if (({0} != {1}) && (!{2} || ({3} < {4})))", values[i], zero, found, name, potentialResults[i]));
+                statements.Add("{");
+                statements.Add(string.Format("    {0} = {1};", name, potentialResults[i]));
+                statements.Add(string.Format("    {0} = true;", found));
+                statements.Add("}");
+            }
+
+            stack.Add(name);
+            return true;
+        }
+
+        /// <summary>
+        /// Translates a maxN operator, which starts from the top of the stack and keeps the larger value.
+        /// </summary>
+        /// <param name="count">The number of operands.</param>
+        /// <param name="error">The error, if any.</param>
+        /// <returns>True if the operator was translated.</returns>
+        private bool MaxN(int count, out string error)
+        {
+            if (!CheckStack(count, out error))
+            {
+                return false;
+            }
+
+            string maxValue = Pop();
+
+            for (int i = 1; i < count; ++i)
+            {
+                string value = Pop();
+                string name = "v" + valueCount++;
+                statements.Add(string.Format("const {0} {1} = ({2} > {3}) ? {2} : {3};", valueType, name, maxValue, value));
+                maxValue = name;
+            }
+
+            stack.Add(maxValue);
+            return true;
+        }
+
+        /// <summary>
+        /// Translates a sumN or avgN operator, which adds the operands starting from the top of the stack.
+        /// </summary>
+        /// <param name="count">The number of operands.</param>
+        /// <param name="isAverage">Flag indicating the sum is divided by the number of operands.</param>
+        /// <param name="error">The error, if any.</param>
+        /// <returns>True if the operator was translated.</returns>
+        private bool SumN(int count, bool isAverage, out string error)
+        {
+            if (!CheckStack(count, out error))
+            {
+                return false;
+            }
+
+            string sum = string.Join(" + ", PopValues(count));
+
+            if (isAverage)
+            {
+                sum = string.Format("({0}) / static_cast<{1}>({2})", sum, valueType, count);
+            }
+
+            PushValue(sum);
+            return true;
+        }
+
+        /// <summary>
+        /// Translates an element-wise operator on two vectors: pops the second vector, then the first one, and pushes the results.
+        /// </summary>
+        /// <param name="width">The width of the vectors.</param>
+        /// <param name="format">Format of the expression of each result, {0} being the element of the first vector.</param>
+        /// <param name="error">The error, if any.</param>
+        /// <returns>True if the operator was translated.</returns>
+        private bool VectorN(int width, string format, out string error)
+        {
+            if (!CheckStack(2 * width, out error))
+            {
+                return false;
+            }
+
+            List<string> values2 = PopValues(width);
+            List<string> values1 = PopValues(width);
+
+            for (int i = width - 1; i >= 0; --i)
+            {
+                PushValue(string.Format(format, values1[i], values2[i]));
+            }
+
+            return true;
+        }
+
+        /// <summary>
+        /// Translates an operator between a scalar and a vector, and pushes the results.
+        /// </summary>
+        /// <param name="width">The width of the vector.</param>
+        /// <param name="format">Format of the expression of each result, {0} being the element of the vector and {1} the scalar.</param>
+        /// <param name="isScalarOnTop">Flag indicating the scalar is popped before the vector, rather than after it.</param>
+        /// <param name="error">The error, if any.</param>
+        /// <returns>True if the operator was translated.</returns>
+        private bool ScalarN(int width, string format, bool isScalarOnTop, out string error)
+        {
+            if (!CheckStack(width + 1, out error))
+            {
+                return false;
+            }
+
+            string scalar = isScalarOnTop ? Pop() : null;
+            List<string> vector = PopValues(width);
+
+            if (!isScalarOnTop)
+            {
+                scalar = Pop();
+            }
+
+            for (int i = width - 1; i >= 0; --i)
+            {
+                PushValue(string.Format(format, vector[i], scalar));
+            }
+
+            return true;
+        }
+    }
+}